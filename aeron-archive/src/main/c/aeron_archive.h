@@ -0,0 +1,464 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_ARCHIVE_H
+#define AERON_ARCHIVE_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "aeronc.h"
+
+typedef struct aeron_archive_context_stct aeron_archive_context_t;
+typedef struct aeron_archive_stct aeron_archive_t;
+typedef struct aeron_archive_async_connect_stct aeron_archive_async_connect_t;
+typedef struct aeron_archive_replay_merge_stct aeron_archive_replay_merge_t;
+
+#define AERON_ARCHIVE_NULL_POSITION (-1)
+#define AERON_ARCHIVE_NULL_LENGTH (-1)
+#define AERON_ARCHIVE_NULL_TIMESTAMP (-1)
+
+#define AERON_ARCHIVE_CONTROL_RESPONSE_CODE_OK (0)
+#define AERON_ARCHIVE_CONTROL_RESPONSE_CODE_ERROR (1)
+#define AERON_ARCHIVE_CONTROL_RESPONSE_CODE_RECORDING_UNKNOWN (2)
+#define AERON_ARCHIVE_CONTROL_RESPONSE_CODE_SUBSCRIPTION_UNKNOWN (3)
+
+typedef enum aeron_archive_source_location_en
+{
+    AERON_ARCHIVE_SOURCE_LOCATION_LOCAL = 0,
+    AERON_ARCHIVE_SOURCE_LOCATION_REMOTE = 1
+}
+aeron_archive_source_location_t;
+
+/**
+ * A recording descriptor returned from the list recording requests. The channel and source identity strings are not
+ * NUL terminated and are only valid for the duration of the callback.
+ */
+typedef struct aeron_archive_recording_descriptor_stct
+{
+    int64_t control_session_id;
+    int64_t correlation_id;
+    int64_t recording_id;
+    int64_t start_timestamp;
+    int64_t stop_timestamp;
+    int64_t start_position;
+    int64_t stop_position;
+    int32_t initial_term_id;
+    int32_t segment_file_length;
+    int32_t term_buffer_length;
+    int32_t mtu_length;
+    int32_t session_id;
+    int32_t stream_id;
+    const char *stripped_channel;
+    size_t stripped_channel_length;
+    const char *original_channel;
+    size_t original_channel_length;
+    const char *source_identity;
+    size_t source_identity_length;
+}
+aeron_archive_recording_descriptor_t;
+
+/**
+ * Callback for each recording descriptor returned from a list recordings request.
+ *
+ * @param descriptor of the recording.
+ * @param clientd    passed to the list call.
+ */
+typedef void (*aeron_archive_recording_descriptor_consumer_func_t)(
+    aeron_archive_recording_descriptor_t *descriptor, void *clientd);
+
+/**
+ * Callback to supply the encoded credentials in response to a challenge from the archive when authenticating.
+ *
+ * @param encoded_challenge        from the archive.
+ * @param encoded_challenge_length of the challenge.
+ * @param encoded_credentials      to be set to the credentials to send in response, must remain valid until the
+ *                                 connect completes.
+ * @param encoded_credentials_length to be set to the length of the credentials.
+ * @param clientd                  registered with the callback.
+ */
+typedef void (*aeron_archive_on_challenge_func_t)(
+    const uint8_t *encoded_challenge,
+    size_t encoded_challenge_length,
+    const uint8_t **encoded_credentials,
+    size_t *encoded_credentials_length,
+    void *clientd);
+
+/*
+ * Context configuration
+ */
+
+#define AERON_ARCHIVE_CONTROL_CHANNEL_ENV_VAR "AERON_ARCHIVE_CONTROL_CHANNEL"
+#define AERON_ARCHIVE_CONTROL_CHANNEL_DEFAULT "aeron:udp?endpoint=localhost:8010"
+
+#define AERON_ARCHIVE_CONTROL_STREAM_ID_ENV_VAR "AERON_ARCHIVE_CONTROL_STREAM_ID"
+#define AERON_ARCHIVE_CONTROL_STREAM_ID_DEFAULT (10)
+
+#define AERON_ARCHIVE_CONTROL_RESPONSE_CHANNEL_ENV_VAR "AERON_ARCHIVE_CONTROL_RESPONSE_CHANNEL"
+#define AERON_ARCHIVE_CONTROL_RESPONSE_CHANNEL_DEFAULT "aeron:udp?endpoint=localhost:8020"
+
+#define AERON_ARCHIVE_CONTROL_RESPONSE_STREAM_ID_ENV_VAR "AERON_ARCHIVE_CONTROL_RESPONSE_STREAM_ID"
+#define AERON_ARCHIVE_CONTROL_RESPONSE_STREAM_ID_DEFAULT (20)
+
+#define AERON_ARCHIVE_MESSAGE_TIMEOUT_ENV_VAR "AERON_ARCHIVE_MESSAGE_TIMEOUT"
+#define AERON_ARCHIVE_MESSAGE_TIMEOUT_NS_DEFAULT (5 * 1000 * 1000 * 1000LL)
+
+/**
+ * Create a context with the defaults, overridden by any of the environment variables above that are set.
+ *
+ * @param context to be set when created successfully.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_archive_context_init(aeron_archive_context_t **context);
+
+/**
+ * Close and delete a context. An archive client takes a copy of its context when connecting, so the context may be
+ * closed once the connect has been started.
+ *
+ * @param context to close.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_archive_context_close(aeron_archive_context_t *context);
+
+/**
+ * The Aeron client used for the control publication and subscription. It is not owned by the archive client and
+ * must be closed by the application after the archive client.
+ */
+int aeron_archive_context_set_aeron(aeron_archive_context_t *context, aeron_t *aeron);
+aeron_t *aeron_archive_context_get_aeron(aeron_archive_context_t *context);
+
+int aeron_archive_context_set_control_request_channel(aeron_archive_context_t *context, const char *channel);
+const char *aeron_archive_context_get_control_request_channel(aeron_archive_context_t *context);
+int aeron_archive_context_set_control_request_stream_id(aeron_archive_context_t *context, int32_t stream_id);
+int32_t aeron_archive_context_get_control_request_stream_id(aeron_archive_context_t *context);
+
+/**
+ * Channel on which control responses are received. The C client has no channel endpoint resolution, so unlike the
+ * C++ client the channel must name a concrete port rather than port 0.
+ */
+int aeron_archive_context_set_control_response_channel(aeron_archive_context_t *context, const char *channel);
+const char *aeron_archive_context_get_control_response_channel(aeron_archive_context_t *context);
+int aeron_archive_context_set_control_response_stream_id(aeron_archive_context_t *context, int32_t stream_id);
+int32_t aeron_archive_context_get_control_response_stream_id(aeron_archive_context_t *context);
+
+int aeron_archive_context_set_message_timeout_ns(aeron_archive_context_t *context, uint64_t timeout_ns);
+uint64_t aeron_archive_context_get_message_timeout_ns(aeron_archive_context_t *context);
+
+/**
+ * Credentials sent with the connect request. They are copied into the context.
+ */
+int aeron_archive_context_set_credentials(
+    aeron_archive_context_t *context, const uint8_t *encoded_credentials, size_t encoded_credentials_length);
+
+int aeron_archive_context_set_on_challenge(
+    aeron_archive_context_t *context, aeron_archive_on_challenge_func_t on_challenge, void *clientd);
+
+/**
+ * Handler for errors in responses to requests other than the one being waited for.
+ */
+int aeron_archive_context_set_error_handler(
+    aeron_archive_context_t *context, aeron_error_handler_t error_handler, void *clientd);
+
+/*
+ * Connection
+ */
+
+/**
+ * Begin connecting to an archive. The connect is progressed by aeron_archive_async_connect_poll.
+ *
+ * @param async   to be set to the connect to poll.
+ * @param context for the connection which is copied.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_archive_async_connect(aeron_archive_async_connect_t **async, aeron_archive_context_t *context);
+
+/**
+ * Poll for the completion of a connect. The async is deleted when the connect completes or fails.
+ *
+ * @param archive to be set when connected.
+ * @param async   connect to poll.
+ * @return 1 when connected, 0 if not yet connected, or -1 for error.
+ */
+int aeron_archive_async_connect_poll(aeron_archive_t **archive, aeron_archive_async_connect_t *async);
+
+/**
+ * Connect to an archive, waiting for the connect to complete or for the message timeout to expire.
+ *
+ * @param archive to be set when connected.
+ * @param context for the connection which is copied.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_archive_connect(aeron_archive_t **archive, aeron_archive_context_t *context);
+
+/**
+ * Close the control session with the archive and delete the client. The Aeron client is not closed.
+ *
+ * @param archive to close.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_archive_close(aeron_archive_t *archive);
+
+int64_t aeron_archive_control_session_id(aeron_archive_t *archive);
+
+/**
+ * The publication to the archive control channel, for use with an aeron_archive_proxy_t when sending requests
+ * without waiting.
+ */
+aeron_exclusive_publication_t *aeron_archive_control_publication(aeron_archive_t *archive);
+
+/**
+ * The subscription to the archive control response channel, for use with the pollers when handling responses in
+ * an event loop.
+ */
+aeron_subscription_t *aeron_archive_control_subscription(aeron_archive_t *archive);
+
+/*
+ * Blocking requests. Each sends a request and waits for its response or the message timeout. The archive client is
+ * not thread safe, requests on one client must be made from a single thread at a time.
+ */
+
+/**
+ * Start recording a channel and stream pairing.
+ *
+ * @param subscription_id to be set to the registration id of the recording subscription, may be NULL.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_archive_start_recording(
+    int64_t *subscription_id,
+    aeron_archive_t *archive,
+    const char *recording_channel,
+    int32_t recording_stream_id,
+    aeron_archive_source_location_t source_location);
+
+/**
+ * Extend an existing, non-active recording of a channel and stream pairing.
+ *
+ * @param subscription_id to be set to the registration id of the recording subscription, may be NULL.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_archive_extend_recording(
+    int64_t *subscription_id,
+    aeron_archive_t *archive,
+    int64_t recording_id,
+    const char *recording_channel,
+    int32_t recording_stream_id,
+    aeron_archive_source_location_t source_location);
+
+int aeron_archive_stop_recording_channel_and_stream(
+    aeron_archive_t *archive, const char *channel, int32_t stream_id);
+
+int aeron_archive_stop_recording_subscription(aeron_archive_t *archive, int64_t subscription_id);
+
+/**
+ * Get the position recorded for an active recording.
+ *
+ * @param recording_position to be set to the position or AERON_ARCHIVE_NULL_POSITION if the recording is not active.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_archive_get_recording_position(int64_t *recording_position, aeron_archive_t *archive, int64_t recording_id);
+
+int aeron_archive_get_start_position(int64_t *start_position, aeron_archive_t *archive, int64_t recording_id);
+
+/**
+ * Get the stop position of a recording.
+ *
+ * @param stop_position to be set to the position or AERON_ARCHIVE_NULL_POSITION if the recording is active.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_archive_get_stop_position(int64_t *stop_position, aeron_archive_t *archive, int64_t recording_id);
+
+/**
+ * Find the last recording after min_recording_id which matches the channel fragment, stream id and session id.
+ *
+ * @param recording_id to be set to the recording id or -1 if none was found.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_archive_find_last_matching_recording(
+    int64_t *recording_id,
+    aeron_archive_t *archive,
+    int64_t min_recording_id,
+    const char *channel_fragment,
+    int32_t stream_id,
+    int32_t session_id);
+
+/**
+ * Truncate a stopped recording to a position.
+ *
+ * @return 0 for success and -1 for error.
+ */
+int aeron_archive_truncate_recording(aeron_archive_t *archive, int64_t recording_id, int64_t position);
+
+/**
+ * Start a replay of a recording from a position for a length, use AERON_ARCHIVE_NULL_POSITION to replay from the
+ * start and INT64_MAX to follow a live recording.
+ *
+ * @param replay_session_id to be set to the replay session id, the lower 32 bits of which are the image session id.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_archive_start_replay(
+    int64_t *replay_session_id,
+    aeron_archive_t *archive,
+    int64_t recording_id,
+    int64_t position,
+    int64_t length,
+    const char *replay_channel,
+    int32_t replay_stream_id);
+
+/**
+ * Start a replay bounded by the position held in the counter with limit_counter_id.
+ *
+ * @param replay_session_id to be set to the replay session id, the lower 32 bits of which are the image session id.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_archive_start_bounded_replay(
+    int64_t *replay_session_id,
+    aeron_archive_t *archive,
+    int64_t recording_id,
+    int64_t position,
+    int64_t length,
+    int32_t limit_counter_id,
+    const char *replay_channel,
+    int32_t replay_stream_id);
+
+int aeron_archive_stop_replay(aeron_archive_t *archive, int64_t replay_session_id);
+
+/**
+ * Stop all replays of a recording, or all replays if recording_id is AERON_NULL_VALUE.
+ */
+int aeron_archive_stop_all_replays(aeron_archive_t *archive, int64_t recording_id);
+
+/**
+ * List up to record_count recording descriptors from from_recording_id.
+ *
+ * @param count_out to be set to the number of descriptors passed to the consumer.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_archive_list_recordings(
+    int32_t *count_out,
+    aeron_archive_t *archive,
+    int64_t from_recording_id,
+    int32_t record_count,
+    aeron_archive_recording_descriptor_consumer_func_t consumer,
+    void *clientd);
+
+/**
+ * List up to record_count recording descriptors from from_recording_id which match the channel fragment and stream.
+ *
+ * @param count_out to be set to the number of descriptors passed to the consumer.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_archive_list_recordings_for_uri(
+    int32_t *count_out,
+    aeron_archive_t *archive,
+    int64_t from_recording_id,
+    int32_t record_count,
+    const char *channel_fragment,
+    int32_t stream_id,
+    aeron_archive_recording_descriptor_consumer_func_t consumer,
+    void *clientd);
+
+/**
+ * List the descriptor of a single recording.
+ *
+ * @param count_out to be set to 1 if the recording was found otherwise 0.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_archive_list_recording(
+    int32_t *count_out,
+    aeron_archive_t *archive,
+    int64_t recording_id,
+    aeron_archive_recording_descriptor_consumer_func_t consumer,
+    void *clientd);
+
+/*
+ * Replay merge
+ */
+
+#define AERON_ARCHIVE_REPLAY_MERGE_LIVE_ADD_MAX_WINDOW (32 * 1024 * 1024)
+#define AERON_ARCHIVE_REPLAY_MERGE_REPLAY_REMOVE_THRESHOLD (0)
+#define AERON_ARCHIVE_REPLAY_MERGE_PROGRESS_TIMEOUT_DEFAULT_MS (10 * 1000)
+
+/**
+ * Replay a recording into a multi-destination subscription in manual control mode, catch up with the live stream and
+ * then merge onto it, removing the replay destination. The subscription must not be closed before the merge is.
+ *
+ * @param replay_merge         to be set when created successfully.
+ * @param subscription         in manual control mode to merge into.
+ * @param archive              to replay from.
+ * @param replay_channel       for the replay, which is given linger=0 and eos=false.
+ * @param replay_destination   added to the subscription for the replay.
+ * @param live_destination     added to the subscription once the replay is close to the live stream.
+ * @param recording_id         to replay.
+ * @param start_position       of the replay.
+ * @param merge_progress_timeout_ms after which a merge that has made no progress fails.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_archive_replay_merge_init(
+    aeron_archive_replay_merge_t **replay_merge,
+    aeron_subscription_t *subscription,
+    aeron_archive_t *archive,
+    const char *replay_channel,
+    const char *replay_destination,
+    const char *live_destination,
+    int64_t recording_id,
+    int64_t start_position,
+    int64_t merge_progress_timeout_ms);
+
+/**
+ * Stop the replay if active, remove the replay destination if not merged and delete the replay merge.
+ */
+int aeron_archive_replay_merge_close(aeron_archive_replay_merge_t *replay_merge);
+
+/**
+ * Progress the merge without blocking.
+ *
+ * @return the amount of work done or -1 if the merge has failed.
+ */
+int aeron_archive_replay_merge_do_work(aeron_archive_replay_merge_t *replay_merge);
+
+/**
+ * Progress the merge and poll the image being merged when available.
+ *
+ * @return the number of fragments read or -1 if the merge has failed.
+ */
+int aeron_archive_replay_merge_poll(
+    aeron_archive_replay_merge_t *replay_merge,
+    aeron_fragment_handler_t handler,
+    void *clientd,
+    size_t fragment_limit);
+
+/**
+ * The image being merged, or NULL before the replay image is available.
+ */
+aeron_image_t *aeron_archive_replay_merge_image(aeron_archive_replay_merge_t *replay_merge);
+
+bool aeron_archive_replay_merge_is_merged(aeron_archive_replay_merge_t *replay_merge);
+
+bool aeron_archive_replay_merge_has_failed(aeron_archive_replay_merge_t *replay_merge);
+
+bool aeron_archive_replay_merge_is_live_added(aeron_archive_replay_merge_t *replay_merge);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //AERON_ARCHIVE_H
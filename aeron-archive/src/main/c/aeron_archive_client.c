@@ -0,0 +1,902 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <stdio.h>
+#include <inttypes.h>
+
+#include "aeron_archive_client.h"
+#include "aeron_archive_codecs.h"
+#include "aeron_alloc.h"
+#include "aeron_agent.h"
+#include "util/aeron_error.h"
+
+static void aeron_archive_async_connect_delete(aeron_archive_async_connect_t *async, bool close_resources)
+{
+    if (async->is_poller_initialised)
+    {
+        aeron_archive_control_response_poller_close(&async->control_response_poller);
+    }
+
+    if (close_resources)
+    {
+        if (NULL != async->publication)
+        {
+            aeron_exclusive_publication_close(async->publication, NULL, NULL);
+        }
+
+        if (NULL != async->subscription)
+        {
+            aeron_subscription_close(async->subscription, NULL, NULL);
+        }
+    }
+
+    aeron_free(async);
+}
+
+int aeron_archive_async_connect(aeron_archive_async_connect_t **async, aeron_archive_context_t *context)
+{
+    aeron_archive_async_connect_t *_async = NULL;
+
+    if (NULL == async || NULL == context || NULL == context->aeron)
+    {
+        aeron_set_err(EINVAL, "aeron_archive_async_connect: %s", "context with an aeron client is required");
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&_async, sizeof(aeron_archive_async_connect_t)) < 0)
+    {
+        return -1;
+    }
+
+    memcpy(&_async->ctx, context, sizeof(aeron_archive_context_t));
+    _async->step = AERON_ARCHIVE_ASYNC_CONNECT_AWAIT_RESOURCES;
+    _async->publication = NULL;
+    _async->subscription = NULL;
+    _async->is_poller_initialised = false;
+    _async->challenge_credentials = NULL;
+    _async->challenge_credentials_length = 0;
+    _async->correlation_id = AERON_NULL_VALUE;
+    _async->control_session_id = AERON_NULL_VALUE;
+    _async->deadline_ns = aeron_nano_clock() + (int64_t)context->message_timeout_ns;
+
+    if (aeron_async_add_subscription(
+        &_async->async_add_subscription,
+        context->aeron,
+        context->control_response_channel,
+        context->control_response_stream_id,
+        NULL,
+        NULL,
+        NULL,
+        NULL) < 0)
+    {
+        aeron_free(_async);
+        return -1;
+    }
+
+    if (aeron_async_add_exclusive_publication(
+        &_async->async_add_publication,
+        context->aeron,
+        context->control_request_channel,
+        context->control_request_stream_id) < 0)
+    {
+        aeron_free(_async);
+        return -1;
+    }
+
+    *async = _async;
+    return 0;
+}
+
+static int aeron_archive_async_connect_await_resources(aeron_archive_async_connect_t *async)
+{
+    if (NULL == async->subscription)
+    {
+        int result = aeron_async_add_subscription_poll(&async->subscription, async->async_add_subscription);
+        if (result < 0)
+        {
+            return -1;
+        }
+    }
+
+    if (NULL == async->publication)
+    {
+        int result = aeron_async_add_exclusive_publication_poll(&async->publication, async->async_add_publication);
+        if (result < 0)
+        {
+            return -1;
+        }
+    }
+
+    if (NULL != async->subscription && NULL != async->publication)
+    {
+        aeron_archive_proxy_init(&async->proxy, async->publication, AERON_ARCHIVE_PROXY_RETRY_ATTEMPTS_DEFAULT);
+        if (aeron_archive_control_response_poller_init(
+            &async->control_response_poller,
+            async->subscription,
+            AERON_ARCHIVE_CONTROL_RESPONSE_POLLER_FRAGMENT_LIMIT_DEFAULT) < 0)
+        {
+            return -1;
+        }
+
+        async->is_poller_initialised = true;
+        async->step = AERON_ARCHIVE_ASYNC_CONNECT_SEND_CONNECT;
+    }
+
+    return 0;
+}
+
+static int aeron_archive_create(aeron_archive_t **archive, aeron_archive_async_connect_t *async)
+{
+    aeron_archive_t *_archive = NULL;
+
+    if (aeron_alloc((void **)&_archive, sizeof(aeron_archive_t)) < 0)
+    {
+        return -1;
+    }
+
+    memcpy(&_archive->ctx, &async->ctx, sizeof(aeron_archive_context_t));
+    _archive->publication = async->publication;
+    _archive->subscription = async->subscription;
+    _archive->control_session_id = async->control_session_id;
+    _archive->use_conductor_agent_invoker =
+        aeron_context_get_use_conductor_agent_invoker(aeron_context(async->ctx.aeron));
+
+    aeron_archive_proxy_init(&_archive->proxy, _archive->publication, AERON_ARCHIVE_PROXY_RETRY_ATTEMPTS_DEFAULT);
+
+    if (aeron_archive_control_response_poller_init(
+        &_archive->control_response_poller,
+        _archive->subscription,
+        AERON_ARCHIVE_CONTROL_RESPONSE_POLLER_FRAGMENT_LIMIT_DEFAULT) < 0)
+    {
+        aeron_free(_archive);
+        return -1;
+    }
+
+    if (aeron_archive_recording_descriptor_poller_init(
+        &_archive->recording_descriptor_poller,
+        _archive->subscription,
+        _archive->control_session_id,
+        AERON_ARCHIVE_CONTROL_RESPONSE_POLLER_FRAGMENT_LIMIT_DEFAULT,
+        _archive->ctx.error_handler,
+        _archive->ctx.error_handler_clientd) < 0)
+    {
+        aeron_archive_control_response_poller_close(&_archive->control_response_poller);
+        aeron_free(_archive);
+        return -1;
+    }
+
+    *archive = _archive;
+    return 0;
+}
+
+static int aeron_archive_async_connect_do_poll(aeron_archive_t **archive, aeron_archive_async_connect_t *async)
+{
+    aeron_archive_control_response_poller_t *poller = &async->control_response_poller;
+
+    if (AERON_ARCHIVE_ASYNC_CONNECT_AWAIT_RESOURCES == async->step)
+    {
+        if (aeron_archive_async_connect_await_resources(async) < 0)
+        {
+            return -1;
+        }
+    }
+
+    if (AERON_ARCHIVE_ASYNC_CONNECT_SEND_CONNECT == async->step)
+    {
+        if (!aeron_exclusive_publication_is_connected(async->publication))
+        {
+            return 0;
+        }
+
+        async->correlation_id = aeron_next_correlation_id(async->ctx.aeron);
+
+        int result = aeron_archive_proxy_try_connect(
+            &async->proxy,
+            async->ctx.control_response_channel,
+            async->ctx.control_response_stream_id,
+            async->ctx.encoded_credentials,
+            async->ctx.encoded_credentials_length,
+            async->correlation_id);
+
+        if (result <= 0)
+        {
+            return result;
+        }
+
+        async->step = AERON_ARCHIVE_ASYNC_CONNECT_AWAIT_SUBSCRIPTION_CONNECTED;
+    }
+
+    if (AERON_ARCHIVE_ASYNC_CONNECT_AWAIT_SUBSCRIPTION_CONNECTED == async->step)
+    {
+        if (!aeron_subscription_is_connected(async->subscription))
+        {
+            return 0;
+        }
+
+        async->step = AERON_ARCHIVE_ASYNC_CONNECT_AWAIT_CONNECT_RESPONSE;
+    }
+
+    if (AERON_ARCHIVE_ASYNC_CONNECT_SEND_CHALLENGE_RESPONSE == async->step)
+    {
+        int result = aeron_archive_proxy_try_challenge_response(
+            &async->proxy,
+            async->challenge_credentials,
+            async->challenge_credentials_length,
+            async->correlation_id,
+            async->control_session_id);
+
+        if (result <= 0)
+        {
+            return result;
+        }
+
+        async->step = AERON_ARCHIVE_ASYNC_CONNECT_AWAIT_CHALLENGE_RESPONSE;
+    }
+
+    if (aeron_archive_control_response_poller_poll(poller) < 0)
+    {
+        return -1;
+    }
+
+    if (!poller->is_poll_complete || poller->correlation_id != async->correlation_id)
+    {
+        return 0;
+    }
+
+    async->control_session_id = poller->control_session_id;
+
+    if (AERON_ARCHIVE_CHALLENGE_TEMPLATE_ID == poller->template_id)
+    {
+        if (NULL == async->ctx.on_challenge)
+        {
+            aeron_set_err(EPERM, "%s", "archive sent challenge but no on_challenge callback is set");
+            return -1;
+        }
+
+        async->challenge_credentials = NULL;
+        async->challenge_credentials_length = 0;
+        async->ctx.on_challenge(
+            poller->encoded_challenge,
+            poller->encoded_challenge_length,
+            &async->challenge_credentials,
+            &async->challenge_credentials_length,
+            async->ctx.on_challenge_clientd);
+
+        async->correlation_id = aeron_next_correlation_id(async->ctx.aeron);
+        async->step = AERON_ARCHIVE_ASYNC_CONNECT_SEND_CHALLENGE_RESPONSE;
+        return 0;
+    }
+
+    if (!poller->is_code_ok)
+    {
+        aeron_set_err(
+            EINVAL,
+            "error connecting to archive: code=%d error=%s",
+            (int)poller->code,
+            poller->error_message);
+        return -1;
+    }
+
+    if (aeron_archive_create(archive, async) < 0)
+    {
+        return -1;
+    }
+
+    return 1;
+}
+
+int aeron_archive_async_connect_poll(aeron_archive_t **archive, aeron_archive_async_connect_t *async)
+{
+    if (NULL == archive || NULL == async)
+    {
+        aeron_set_err(EINVAL, "aeron_archive_async_connect_poll: %s", strerror(EINVAL));
+        return -1;
+    }
+
+    int result = aeron_archive_async_connect_do_poll(archive, async);
+
+    if (0 == result && aeron_nano_clock() > async->deadline_ns)
+    {
+        aeron_set_err(
+            ETIMEDOUT,
+            "archive connect timeout: step=%d correlation_id=%" PRId64,
+            (int)async->step,
+            async->correlation_id);
+        result = -1;
+    }
+
+    if (0 != result)
+    {
+        aeron_archive_async_connect_delete(async, result < 0);
+    }
+
+    return result;
+}
+
+static void aeron_archive_idle(aeron_t *aeron, bool use_conductor_agent_invoker)
+{
+    if (use_conductor_agent_invoker)
+    {
+        aeron_main_do_work(aeron);
+    }
+
+    aeron_idle_strategy_yielding_idle(NULL, 0);
+}
+
+int aeron_archive_connect(aeron_archive_t **archive, aeron_archive_context_t *context)
+{
+    aeron_archive_async_connect_t *async = NULL;
+    int result;
+
+    if (aeron_archive_async_connect(&async, context) < 0)
+    {
+        return -1;
+    }
+
+    const bool use_conductor_agent_invoker =
+        aeron_context_get_use_conductor_agent_invoker(aeron_context(context->aeron));
+
+    while (0 == (result = aeron_archive_async_connect_poll(archive, async)))
+    {
+        aeron_archive_idle(context->aeron, use_conductor_agent_invoker);
+    }
+
+    return result < 0 ? -1 : 0;
+}
+
+int aeron_archive_close(aeron_archive_t *archive)
+{
+    if (NULL == archive)
+    {
+        return 0;
+    }
+
+    if (!aeron_is_closed(archive->ctx.aeron))
+    {
+        if (NULL != archive->publication && aeron_exclusive_publication_is_connected(archive->publication))
+        {
+            aeron_archive_proxy_close_session(&archive->proxy, archive->control_session_id);
+        }
+
+        aeron_exclusive_publication_close(archive->publication, NULL, NULL);
+        aeron_subscription_close(archive->subscription, NULL, NULL);
+    }
+
+    aeron_archive_recording_descriptor_poller_close(&archive->recording_descriptor_poller);
+    aeron_archive_control_response_poller_close(&archive->control_response_poller);
+    aeron_free(archive);
+
+    return 0;
+}
+
+int64_t aeron_archive_control_session_id(aeron_archive_t *archive)
+{
+    return archive->control_session_id;
+}
+
+aeron_exclusive_publication_t *aeron_archive_control_publication(aeron_archive_t *archive)
+{
+    return archive->publication;
+}
+
+aeron_subscription_t *aeron_archive_control_subscription(aeron_archive_t *archive)
+{
+    return archive->subscription;
+}
+
+static int aeron_archive_check_sent(int result, const char *request)
+{
+    if (0 == result)
+    {
+        aeron_set_err(EAGAIN, "failed to send %s request", request);
+        return -1;
+    }
+
+    return result < 0 ? -1 : 0;
+}
+
+static int aeron_archive_poll_next_response(aeron_archive_t *archive, int64_t correlation_id, int64_t deadline_ns)
+{
+    aeron_archive_control_response_poller_t *poller = &archive->control_response_poller;
+
+    while (true)
+    {
+        const int fragments = aeron_archive_control_response_poller_poll(poller);
+
+        if (fragments < 0)
+        {
+            return -1;
+        }
+
+        if (poller->is_poll_complete)
+        {
+            if (AERON_ARCHIVE_CONTROL_RESPONSE_TEMPLATE_ID == poller->template_id)
+            {
+                return 0;
+            }
+
+            continue;
+        }
+
+        if (fragments > 0)
+        {
+            continue;
+        }
+
+        if (!aeron_subscription_is_connected(archive->subscription))
+        {
+            aeron_set_err(ENOTCONN, "%s", "subscription to archive is not connected");
+            return -1;
+        }
+
+        if (aeron_nano_clock() > deadline_ns)
+        {
+            aeron_set_err(ETIMEDOUT, "awaiting response - correlation_id=%" PRId64, correlation_id);
+            return -1;
+        }
+
+        aeron_archive_idle(archive->ctx.aeron, archive->use_conductor_agent_invoker);
+    }
+}
+
+static int aeron_archive_poll_for_response(int64_t *relevant_id, aeron_archive_t *archive, int64_t correlation_id)
+{
+    aeron_archive_control_response_poller_t *poller = &archive->control_response_poller;
+    const int64_t deadline_ns = aeron_nano_clock() + (int64_t)archive->ctx.message_timeout_ns;
+
+    while (true)
+    {
+        if (aeron_archive_poll_next_response(archive, correlation_id, deadline_ns) < 0)
+        {
+            return -1;
+        }
+
+        if (poller->control_session_id != archive->control_session_id)
+        {
+            continue;
+        }
+
+        if (poller->is_code_error)
+        {
+            if (poller->correlation_id == correlation_id)
+            {
+                aeron_set_err(
+                    EINVAL,
+                    "response for correlation_id=%" PRId64 ", error: %s",
+                    correlation_id,
+                    poller->error_message);
+                return -1;
+            }
+            else if (NULL != archive->ctx.error_handler)
+            {
+                archive->ctx.error_handler(
+                    archive->ctx.error_handler_clientd, (int)poller->relevant_id, poller->error_message);
+            }
+
+            continue;
+        }
+
+        if (poller->correlation_id == correlation_id)
+        {
+            if (!poller->is_code_ok)
+            {
+                aeron_set_err(EINVAL, "unexpected response code: %d", (int)poller->code);
+                return -1;
+            }
+
+            if (NULL != relevant_id)
+            {
+                *relevant_id = poller->relevant_id;
+            }
+
+            return 0;
+        }
+    }
+}
+
+static int aeron_archive_poll_for_descriptors(
+    int32_t *count_out,
+    aeron_archive_t *archive,
+    int64_t correlation_id,
+    int32_t record_count,
+    aeron_archive_recording_descriptor_consumer_func_t consumer,
+    void *clientd)
+{
+    aeron_archive_recording_descriptor_poller_t *poller = &archive->recording_descriptor_poller;
+    int64_t deadline_ns = aeron_nano_clock() + (int64_t)archive->ctx.message_timeout_ns;
+    int32_t existing_remaining_count = record_count;
+
+    aeron_archive_recording_descriptor_poller_reset(poller, correlation_id, record_count, consumer, clientd);
+
+    while (true)
+    {
+        const int fragments = aeron_archive_recording_descriptor_poller_poll(poller);
+
+        if (fragments < 0)
+        {
+            return -1;
+        }
+
+        const int32_t remaining_count = poller->remaining_record_count;
+
+        if (poller->is_dispatch_complete)
+        {
+            if (NULL != count_out)
+            {
+                *count_out = record_count - remaining_count;
+            }
+
+            return 0;
+        }
+
+        if (remaining_count != existing_remaining_count)
+        {
+            existing_remaining_count = remaining_count;
+            deadline_ns = aeron_nano_clock() + (int64_t)archive->ctx.message_timeout_ns;
+        }
+
+        if (fragments > 0)
+        {
+            continue;
+        }
+
+        if (!aeron_subscription_is_connected(archive->subscription))
+        {
+            aeron_set_err(ENOTCONN, "%s", "subscription to archive is not connected");
+            return -1;
+        }
+
+        if (aeron_nano_clock() > deadline_ns)
+        {
+            aeron_set_err(ETIMEDOUT, "awaiting recording descriptors - correlation_id=%" PRId64, correlation_id);
+            return -1;
+        }
+
+        aeron_archive_idle(archive->ctx.aeron, archive->use_conductor_agent_invoker);
+    }
+}
+
+int aeron_archive_start_recording(
+    int64_t *subscription_id,
+    aeron_archive_t *archive,
+    const char *recording_channel,
+    int32_t recording_stream_id,
+    aeron_archive_source_location_t source_location)
+{
+    const int64_t correlation_id = aeron_next_correlation_id(archive->ctx.aeron);
+
+    if (aeron_archive_check_sent(
+        aeron_archive_proxy_start_recording(
+            &archive->proxy,
+            recording_channel,
+            recording_stream_id,
+            source_location,
+            correlation_id,
+            archive->control_session_id),
+        "start recording") < 0)
+    {
+        return -1;
+    }
+
+    return aeron_archive_poll_for_response(subscription_id, archive, correlation_id);
+}
+
+int aeron_archive_extend_recording(
+    int64_t *subscription_id,
+    aeron_archive_t *archive,
+    int64_t recording_id,
+    const char *recording_channel,
+    int32_t recording_stream_id,
+    aeron_archive_source_location_t source_location)
+{
+    const int64_t correlation_id = aeron_next_correlation_id(archive->ctx.aeron);
+
+    if (aeron_archive_check_sent(
+        aeron_archive_proxy_extend_recording(
+            &archive->proxy,
+            recording_channel,
+            recording_stream_id,
+            source_location,
+            recording_id,
+            correlation_id,
+            archive->control_session_id),
+        "extend recording") < 0)
+    {
+        return -1;
+    }
+
+    return aeron_archive_poll_for_response(subscription_id, archive, correlation_id);
+}
+
+int aeron_archive_stop_recording_channel_and_stream(
+    aeron_archive_t *archive, const char *channel, int32_t stream_id)
+{
+    const int64_t correlation_id = aeron_next_correlation_id(archive->ctx.aeron);
+
+    if (aeron_archive_check_sent(
+        aeron_archive_proxy_stop_recording(
+            &archive->proxy, channel, stream_id, correlation_id, archive->control_session_id),
+        "stop recording") < 0)
+    {
+        return -1;
+    }
+
+    return aeron_archive_poll_for_response(NULL, archive, correlation_id);
+}
+
+int aeron_archive_stop_recording_subscription(aeron_archive_t *archive, int64_t subscription_id)
+{
+    const int64_t correlation_id = aeron_next_correlation_id(archive->ctx.aeron);
+
+    if (aeron_archive_check_sent(
+        aeron_archive_proxy_stop_recording_subscription(
+            &archive->proxy, subscription_id, correlation_id, archive->control_session_id),
+        "stop recording") < 0)
+    {
+        return -1;
+    }
+
+    return aeron_archive_poll_for_response(NULL, archive, correlation_id);
+}
+
+int aeron_archive_get_recording_position(int64_t *recording_position, aeron_archive_t *archive, int64_t recording_id)
+{
+    const int64_t correlation_id = aeron_next_correlation_id(archive->ctx.aeron);
+
+    if (aeron_archive_check_sent(
+        aeron_archive_proxy_get_recording_position(
+            &archive->proxy, recording_id, correlation_id, archive->control_session_id),
+        "get recording position") < 0)
+    {
+        return -1;
+    }
+
+    return aeron_archive_poll_for_response(recording_position, archive, correlation_id);
+}
+
+int aeron_archive_get_start_position(int64_t *start_position, aeron_archive_t *archive, int64_t recording_id)
+{
+    const int64_t correlation_id = aeron_next_correlation_id(archive->ctx.aeron);
+
+    if (aeron_archive_check_sent(
+        aeron_archive_proxy_get_start_position(
+            &archive->proxy, recording_id, correlation_id, archive->control_session_id),
+        "get start position") < 0)
+    {
+        return -1;
+    }
+
+    return aeron_archive_poll_for_response(start_position, archive, correlation_id);
+}
+
+int aeron_archive_get_stop_position(int64_t *stop_position, aeron_archive_t *archive, int64_t recording_id)
+{
+    const int64_t correlation_id = aeron_next_correlation_id(archive->ctx.aeron);
+
+    if (aeron_archive_check_sent(
+        aeron_archive_proxy_get_stop_position(
+            &archive->proxy, recording_id, correlation_id, archive->control_session_id),
+        "get stop position") < 0)
+    {
+        return -1;
+    }
+
+    return aeron_archive_poll_for_response(stop_position, archive, correlation_id);
+}
+
+int aeron_archive_find_last_matching_recording(
+    int64_t *recording_id,
+    aeron_archive_t *archive,
+    int64_t min_recording_id,
+    const char *channel_fragment,
+    int32_t stream_id,
+    int32_t session_id)
+{
+    const int64_t correlation_id = aeron_next_correlation_id(archive->ctx.aeron);
+
+    if (aeron_archive_check_sent(
+        aeron_archive_proxy_find_last_matching_recording(
+            &archive->proxy,
+            min_recording_id,
+            channel_fragment,
+            stream_id,
+            session_id,
+            correlation_id,
+            archive->control_session_id),
+        "find last matching recording") < 0)
+    {
+        return -1;
+    }
+
+    return aeron_archive_poll_for_response(recording_id, archive, correlation_id);
+}
+
+int aeron_archive_truncate_recording(aeron_archive_t *archive, int64_t recording_id, int64_t position)
+{
+    const int64_t correlation_id = aeron_next_correlation_id(archive->ctx.aeron);
+
+    if (aeron_archive_check_sent(
+        aeron_archive_proxy_truncate_recording(
+            &archive->proxy, recording_id, position, correlation_id, archive->control_session_id),
+        "truncate recording") < 0)
+    {
+        return -1;
+    }
+
+    return aeron_archive_poll_for_response(NULL, archive, correlation_id);
+}
+
+int aeron_archive_start_replay(
+    int64_t *replay_session_id,
+    aeron_archive_t *archive,
+    int64_t recording_id,
+    int64_t position,
+    int64_t length,
+    const char *replay_channel,
+    int32_t replay_stream_id)
+{
+    const int64_t correlation_id = aeron_next_correlation_id(archive->ctx.aeron);
+
+    if (aeron_archive_check_sent(
+        aeron_archive_proxy_replay(
+            &archive->proxy,
+            recording_id,
+            position,
+            length,
+            replay_channel,
+            replay_stream_id,
+            correlation_id,
+            archive->control_session_id),
+        "replay") < 0)
+    {
+        return -1;
+    }
+
+    return aeron_archive_poll_for_response(replay_session_id, archive, correlation_id);
+}
+
+int aeron_archive_start_bounded_replay(
+    int64_t *replay_session_id,
+    aeron_archive_t *archive,
+    int64_t recording_id,
+    int64_t position,
+    int64_t length,
+    int32_t limit_counter_id,
+    const char *replay_channel,
+    int32_t replay_stream_id)
+{
+    const int64_t correlation_id = aeron_next_correlation_id(archive->ctx.aeron);
+
+    if (aeron_archive_check_sent(
+        aeron_archive_proxy_bounded_replay(
+            &archive->proxy,
+            recording_id,
+            position,
+            length,
+            limit_counter_id,
+            replay_channel,
+            replay_stream_id,
+            correlation_id,
+            archive->control_session_id),
+        "bounded replay") < 0)
+    {
+        return -1;
+    }
+
+    return aeron_archive_poll_for_response(replay_session_id, archive, correlation_id);
+}
+
+int aeron_archive_stop_replay(aeron_archive_t *archive, int64_t replay_session_id)
+{
+    const int64_t correlation_id = aeron_next_correlation_id(archive->ctx.aeron);
+
+    if (aeron_archive_check_sent(
+        aeron_archive_proxy_stop_replay(
+            &archive->proxy, replay_session_id, correlation_id, archive->control_session_id),
+        "stop replay") < 0)
+    {
+        return -1;
+    }
+
+    return aeron_archive_poll_for_response(NULL, archive, correlation_id);
+}
+
+int aeron_archive_stop_all_replays(aeron_archive_t *archive, int64_t recording_id)
+{
+    const int64_t correlation_id = aeron_next_correlation_id(archive->ctx.aeron);
+
+    if (aeron_archive_check_sent(
+        aeron_archive_proxy_stop_all_replays(
+            &archive->proxy, recording_id, correlation_id, archive->control_session_id),
+        "stop all replays") < 0)
+    {
+        return -1;
+    }
+
+    return aeron_archive_poll_for_response(NULL, archive, correlation_id);
+}
+
+int aeron_archive_list_recordings(
+    int32_t *count_out,
+    aeron_archive_t *archive,
+    int64_t from_recording_id,
+    int32_t record_count,
+    aeron_archive_recording_descriptor_consumer_func_t consumer,
+    void *clientd)
+{
+    const int64_t correlation_id = aeron_next_correlation_id(archive->ctx.aeron);
+
+    if (aeron_archive_check_sent(
+        aeron_archive_proxy_list_recordings(
+            &archive->proxy, from_recording_id, record_count, correlation_id, archive->control_session_id),
+        "list recordings") < 0)
+    {
+        return -1;
+    }
+
+    return aeron_archive_poll_for_descriptors(count_out, archive, correlation_id, record_count, consumer, clientd);
+}
+
+int aeron_archive_list_recordings_for_uri(
+    int32_t *count_out,
+    aeron_archive_t *archive,
+    int64_t from_recording_id,
+    int32_t record_count,
+    const char *channel_fragment,
+    int32_t stream_id,
+    aeron_archive_recording_descriptor_consumer_func_t consumer,
+    void *clientd)
+{
+    const int64_t correlation_id = aeron_next_correlation_id(archive->ctx.aeron);
+
+    if (aeron_archive_check_sent(
+        aeron_archive_proxy_list_recordings_for_uri(
+            &archive->proxy,
+            from_recording_id,
+            record_count,
+            channel_fragment,
+            stream_id,
+            correlation_id,
+            archive->control_session_id),
+        "list recordings for uri") < 0)
+    {
+        return -1;
+    }
+
+    return aeron_archive_poll_for_descriptors(count_out, archive, correlation_id, record_count, consumer, clientd);
+}
+
+int aeron_archive_list_recording(
+    int32_t *count_out,
+    aeron_archive_t *archive,
+    int64_t recording_id,
+    aeron_archive_recording_descriptor_consumer_func_t consumer,
+    void *clientd)
+{
+    const int64_t correlation_id = aeron_next_correlation_id(archive->ctx.aeron);
+
+    if (aeron_archive_check_sent(
+        aeron_archive_proxy_list_recording(
+            &archive->proxy, recording_id, correlation_id, archive->control_session_id),
+        "list recording") < 0)
+    {
+        return -1;
+    }
+
+    return aeron_archive_poll_for_descriptors(count_out, archive, correlation_id, 1, consumer, clientd);
+}
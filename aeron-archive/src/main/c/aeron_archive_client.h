@@ -0,0 +1,75 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_ARCHIVE_CLIENT_H
+#define AERON_ARCHIVE_CLIENT_H
+
+#include "aeron_archive.h"
+#include "aeron_archive_context.h"
+#include "aeron_archive_proxy.h"
+#include "aeron_archive_control_response_poller.h"
+#include "aeron_archive_recording_descriptor_poller.h"
+
+typedef enum aeron_archive_async_connect_step_en
+{
+    AERON_ARCHIVE_ASYNC_CONNECT_AWAIT_RESOURCES = 0,
+    AERON_ARCHIVE_ASYNC_CONNECT_SEND_CONNECT = 1,
+    AERON_ARCHIVE_ASYNC_CONNECT_AWAIT_SUBSCRIPTION_CONNECTED = 2,
+    AERON_ARCHIVE_ASYNC_CONNECT_AWAIT_CONNECT_RESPONSE = 3,
+    AERON_ARCHIVE_ASYNC_CONNECT_SEND_CHALLENGE_RESPONSE = 4,
+    AERON_ARCHIVE_ASYNC_CONNECT_AWAIT_CHALLENGE_RESPONSE = 5
+}
+aeron_archive_async_connect_step_t;
+
+typedef struct aeron_archive_async_connect_stct
+{
+    aeron_archive_context_t ctx;
+    aeron_archive_async_connect_step_t step;
+
+    aeron_async_add_exclusive_publication_t *async_add_publication;
+    aeron_async_add_subscription_t *async_add_subscription;
+    aeron_exclusive_publication_t *publication;
+    aeron_subscription_t *subscription;
+
+    aeron_archive_proxy_t proxy;
+    aeron_archive_control_response_poller_t control_response_poller;
+    bool is_poller_initialised;
+
+    const uint8_t *challenge_credentials;
+    size_t challenge_credentials_length;
+
+    int64_t correlation_id;
+    int64_t control_session_id;
+    int64_t deadline_ns;
+}
+aeron_archive_async_connect_t;
+
+typedef struct aeron_archive_stct
+{
+    aeron_archive_context_t ctx;
+    aeron_exclusive_publication_t *publication;
+    aeron_subscription_t *subscription;
+
+    aeron_archive_proxy_t proxy;
+    aeron_archive_control_response_poller_t control_response_poller;
+    aeron_archive_recording_descriptor_poller_t recording_descriptor_poller;
+
+    int64_t control_session_id;
+    bool use_conductor_agent_invoker;
+}
+aeron_archive_t;
+
+#endif //AERON_ARCHIVE_CLIENT_H
@@ -0,0 +1,564 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "aeron_archive_codecs.h"
+#include "util/aeron_error.h"
+
+typedef struct aeron_archive_encoder_stct
+{
+    uint8_t *buffer;
+    size_t capacity;
+    size_t offset;
+    bool overflow;
+}
+aeron_archive_encoder_t;
+
+static void aeron_archive_encoder_put(aeron_archive_encoder_t *encoder, const void *value, size_t length)
+{
+    if (encoder->overflow || encoder->offset + length > encoder->capacity)
+    {
+        encoder->overflow = true;
+        return;
+    }
+
+    memcpy(encoder->buffer + encoder->offset, value, length);
+    encoder->offset += length;
+}
+
+static void aeron_archive_encoder_put_uint16(aeron_archive_encoder_t *encoder, uint16_t value)
+{
+    aeron_archive_encoder_put(encoder, &value, sizeof(value));
+}
+
+static void aeron_archive_encoder_put_int32(aeron_archive_encoder_t *encoder, int32_t value)
+{
+    aeron_archive_encoder_put(encoder, &value, sizeof(value));
+}
+
+static void aeron_archive_encoder_put_int64(aeron_archive_encoder_t *encoder, int64_t value)
+{
+    aeron_archive_encoder_put(encoder, &value, sizeof(value));
+}
+
+static void aeron_archive_encoder_put_var_data(aeron_archive_encoder_t *encoder, const void *value, size_t length)
+{
+    uint32_t length_field = (uint32_t)length;
+    aeron_archive_encoder_put(encoder, &length_field, sizeof(length_field));
+    if (length > 0)
+    {
+        aeron_archive_encoder_put(encoder, value, length);
+    }
+}
+
+static void aeron_archive_encoder_put_string(aeron_archive_encoder_t *encoder, const char *value)
+{
+    aeron_archive_encoder_put_var_data(encoder, value, NULL == value ? 0 : strlen(value));
+}
+
+static void aeron_archive_encoder_init(
+    aeron_archive_encoder_t *encoder, uint8_t *buffer, size_t capacity, uint16_t block_length, uint16_t template_id)
+{
+    encoder->buffer = buffer;
+    encoder->capacity = capacity;
+    encoder->offset = 0;
+    encoder->overflow = false;
+
+    aeron_archive_encoder_put_uint16(encoder, block_length);
+    aeron_archive_encoder_put_uint16(encoder, template_id);
+    aeron_archive_encoder_put_uint16(encoder, AERON_ARCHIVE_SCHEMA_ID);
+    aeron_archive_encoder_put_uint16(encoder, AERON_ARCHIVE_SCHEMA_VERSION);
+}
+
+static int aeron_archive_encoder_length(aeron_archive_encoder_t *encoder)
+{
+    if (encoder->overflow)
+    {
+        aeron_set_err(EINVAL, "archive request exceeds buffer capacity: %d", (int)encoder->capacity);
+        return -1;
+    }
+
+    return (int)encoder->offset;
+}
+
+static int64_t aeron_archive_get_int64(const uint8_t *buffer, size_t offset)
+{
+    int64_t value;
+    memcpy(&value, buffer + offset, sizeof(value));
+    return value;
+}
+
+static int32_t aeron_archive_get_int32(const uint8_t *buffer, size_t offset)
+{
+    int32_t value;
+    memcpy(&value, buffer + offset, sizeof(value));
+    return value;
+}
+
+static int aeron_archive_get_var_data(
+    const uint8_t *buffer, size_t length, size_t *offset, const uint8_t **value, size_t *value_length)
+{
+    uint32_t length_field;
+
+    if (*offset + AERON_ARCHIVE_VAR_DATA_LENGTH_FIELD_LENGTH > length)
+    {
+        aeron_set_err(EINVAL, "%s", "archive message truncated in var data length");
+        return -1;
+    }
+
+    memcpy(&length_field, buffer + *offset, sizeof(length_field));
+    *offset += AERON_ARCHIVE_VAR_DATA_LENGTH_FIELD_LENGTH;
+
+    if (*offset + length_field > length)
+    {
+        aeron_set_err(EINVAL, "archive message truncated in var data of length: %u", length_field);
+        return -1;
+    }
+
+    *value = buffer + *offset;
+    *value_length = length_field;
+    *offset += length_field;
+
+    return 0;
+}
+
+static int aeron_archive_check_block(
+    const aeron_archive_message_header_t *header, size_t length, size_t min_block_length)
+{
+    if (header->block_length < min_block_length ||
+        AERON_ARCHIVE_MESSAGE_HEADER_LENGTH + (size_t)header->block_length > length)
+    {
+        aeron_set_err(
+            EINVAL,
+            "archive message block too short: template_id=%d block_length=%d length=%d",
+            (int)header->template_id,
+            (int)header->block_length,
+            (int)length);
+        return -1;
+    }
+
+    return 0;
+}
+
+int aeron_archive_decode_message_header(
+    aeron_archive_message_header_t *header, const uint8_t *buffer, size_t length)
+{
+    if (length < AERON_ARCHIVE_MESSAGE_HEADER_LENGTH)
+    {
+        aeron_set_err(EINVAL, "archive message too short for header: %d", (int)length);
+        return -1;
+    }
+
+    memcpy(&header->block_length, buffer, sizeof(uint16_t));
+    memcpy(&header->template_id, buffer + 2, sizeof(uint16_t));
+    memcpy(&header->schema_id, buffer + 4, sizeof(uint16_t));
+    memcpy(&header->version, buffer + 6, sizeof(uint16_t));
+
+    if (AERON_ARCHIVE_SCHEMA_ID != header->schema_id)
+    {
+        aeron_set_err(
+            EINVAL, "archive schema id mismatch: expected=%d actual=%d", AERON_ARCHIVE_SCHEMA_ID, header->schema_id);
+        return -1;
+    }
+
+    return 0;
+}
+
+int aeron_archive_decode_control_response(
+    aeron_archive_control_response_t *response,
+    const aeron_archive_message_header_t *header,
+    const uint8_t *buffer,
+    size_t length)
+{
+    const uint8_t *body = buffer + AERON_ARCHIVE_MESSAGE_HEADER_LENGTH;
+    const uint8_t *error_message = NULL;
+    size_t offset = AERON_ARCHIVE_MESSAGE_HEADER_LENGTH + header->block_length;
+
+    if (aeron_archive_check_block(header, length, 28) < 0)
+    {
+        return -1;
+    }
+
+    response->control_session_id = aeron_archive_get_int64(body, 0);
+    response->correlation_id = aeron_archive_get_int64(body, 8);
+    response->relevant_id = aeron_archive_get_int64(body, 16);
+    response->code = aeron_archive_get_int32(body, 24);
+    response->version = header->block_length >= AERON_ARCHIVE_CONTROL_RESPONSE_BLOCK_LENGTH ?
+        aeron_archive_get_int32(body, 28) : 0;
+
+    if (aeron_archive_get_var_data(buffer, length, &offset, &error_message, &response->error_message_length) < 0)
+    {
+        return -1;
+    }
+
+    response->error_message = (const char *)error_message;
+
+    return 0;
+}
+
+int aeron_archive_decode_challenge(
+    aeron_archive_challenge_t *challenge,
+    const aeron_archive_message_header_t *header,
+    const uint8_t *buffer,
+    size_t length)
+{
+    const uint8_t *body = buffer + AERON_ARCHIVE_MESSAGE_HEADER_LENGTH;
+    size_t offset = AERON_ARCHIVE_MESSAGE_HEADER_LENGTH + header->block_length;
+
+    if (aeron_archive_check_block(header, length, AERON_ARCHIVE_CHALLENGE_BLOCK_LENGTH) < 0)
+    {
+        return -1;
+    }
+
+    challenge->control_session_id = aeron_archive_get_int64(body, 0);
+    challenge->correlation_id = aeron_archive_get_int64(body, 8);
+    challenge->version = aeron_archive_get_int32(body, 16);
+
+    return aeron_archive_get_var_data(
+        buffer, length, &offset, &challenge->encoded_challenge, &challenge->encoded_challenge_length);
+}
+
+int aeron_archive_decode_recording_descriptor(
+    aeron_archive_recording_descriptor_t *descriptor,
+    const aeron_archive_message_header_t *header,
+    const uint8_t *buffer,
+    size_t length)
+{
+    const uint8_t *body = buffer + AERON_ARCHIVE_MESSAGE_HEADER_LENGTH;
+    const uint8_t *value = NULL;
+    size_t offset = AERON_ARCHIVE_MESSAGE_HEADER_LENGTH + header->block_length;
+
+    if (aeron_archive_check_block(header, length, AERON_ARCHIVE_RECORDING_DESCRIPTOR_BLOCK_LENGTH) < 0)
+    {
+        return -1;
+    }
+
+    descriptor->control_session_id = aeron_archive_get_int64(body, 0);
+    descriptor->correlation_id = aeron_archive_get_int64(body, 8);
+    descriptor->recording_id = aeron_archive_get_int64(body, 16);
+    descriptor->start_timestamp = aeron_archive_get_int64(body, 24);
+    descriptor->stop_timestamp = aeron_archive_get_int64(body, 32);
+    descriptor->start_position = aeron_archive_get_int64(body, 40);
+    descriptor->stop_position = aeron_archive_get_int64(body, 48);
+    descriptor->initial_term_id = aeron_archive_get_int32(body, 56);
+    descriptor->segment_file_length = aeron_archive_get_int32(body, 60);
+    descriptor->term_buffer_length = aeron_archive_get_int32(body, 64);
+    descriptor->mtu_length = aeron_archive_get_int32(body, 68);
+    descriptor->session_id = aeron_archive_get_int32(body, 72);
+    descriptor->stream_id = aeron_archive_get_int32(body, 76);
+
+    if (aeron_archive_get_var_data(buffer, length, &offset, &value, &descriptor->stripped_channel_length) < 0)
+    {
+        return -1;
+    }
+    descriptor->stripped_channel = (const char *)value;
+
+    if (aeron_archive_get_var_data(buffer, length, &offset, &value, &descriptor->original_channel_length) < 0)
+    {
+        return -1;
+    }
+    descriptor->original_channel = (const char *)value;
+
+    if (aeron_archive_get_var_data(buffer, length, &offset, &value, &descriptor->source_identity_length) < 0)
+    {
+        return -1;
+    }
+    descriptor->source_identity = (const char *)value;
+
+    return 0;
+}
+
+int aeron_archive_encode_auth_connect_request(
+    uint8_t *buffer,
+    size_t capacity,
+    int64_t correlation_id,
+    int32_t response_stream_id,
+    const char *response_channel,
+    const uint8_t *encoded_credentials,
+    size_t encoded_credentials_length)
+{
+    aeron_archive_encoder_t encoder;
+
+    aeron_archive_encoder_init(&encoder, buffer, capacity, 16, AERON_ARCHIVE_AUTH_CONNECT_REQUEST_TEMPLATE_ID);
+    aeron_archive_encoder_put_int64(&encoder, correlation_id);
+    aeron_archive_encoder_put_int32(&encoder, response_stream_id);
+    aeron_archive_encoder_put_int32(&encoder, AERON_ARCHIVE_PROTOCOL_SEMANTIC_VERSION);
+    aeron_archive_encoder_put_string(&encoder, response_channel);
+    aeron_archive_encoder_put_var_data(&encoder, encoded_credentials, encoded_credentials_length);
+
+    return aeron_archive_encoder_length(&encoder);
+}
+
+int aeron_archive_encode_challenge_response(
+    uint8_t *buffer,
+    size_t capacity,
+    int64_t control_session_id,
+    int64_t correlation_id,
+    const uint8_t *encoded_credentials,
+    size_t encoded_credentials_length)
+{
+    aeron_archive_encoder_t encoder;
+
+    aeron_archive_encoder_init(&encoder, buffer, capacity, 16, AERON_ARCHIVE_CHALLENGE_RESPONSE_TEMPLATE_ID);
+    aeron_archive_encoder_put_int64(&encoder, control_session_id);
+    aeron_archive_encoder_put_int64(&encoder, correlation_id);
+    aeron_archive_encoder_put_var_data(&encoder, encoded_credentials, encoded_credentials_length);
+
+    return aeron_archive_encoder_length(&encoder);
+}
+
+int aeron_archive_encode_close_session_request(uint8_t *buffer, size_t capacity, int64_t control_session_id)
+{
+    aeron_archive_encoder_t encoder;
+
+    aeron_archive_encoder_init(&encoder, buffer, capacity, 8, AERON_ARCHIVE_CLOSE_SESSION_REQUEST_TEMPLATE_ID);
+    aeron_archive_encoder_put_int64(&encoder, control_session_id);
+
+    return aeron_archive_encoder_length(&encoder);
+}
+
+int aeron_archive_encode_keep_alive_request(
+    uint8_t *buffer, size_t capacity, int64_t control_session_id, int64_t correlation_id)
+{
+    aeron_archive_encoder_t encoder;
+
+    aeron_archive_encoder_init(&encoder, buffer, capacity, 16, AERON_ARCHIVE_KEEP_ALIVE_REQUEST_TEMPLATE_ID);
+    aeron_archive_encoder_put_int64(&encoder, control_session_id);
+    aeron_archive_encoder_put_int64(&encoder, correlation_id);
+
+    return aeron_archive_encoder_length(&encoder);
+}
+
+int aeron_archive_encode_start_recording_request(
+    uint8_t *buffer,
+    size_t capacity,
+    int64_t control_session_id,
+    int64_t correlation_id,
+    int32_t stream_id,
+    aeron_archive_source_location_t source_location,
+    const char *channel)
+{
+    aeron_archive_encoder_t encoder;
+
+    aeron_archive_encoder_init(&encoder, buffer, capacity, 24, AERON_ARCHIVE_START_RECORDING_REQUEST_TEMPLATE_ID);
+    aeron_archive_encoder_put_int64(&encoder, control_session_id);
+    aeron_archive_encoder_put_int64(&encoder, correlation_id);
+    aeron_archive_encoder_put_int32(&encoder, stream_id);
+    aeron_archive_encoder_put_int32(&encoder, (int32_t)source_location);
+    aeron_archive_encoder_put_string(&encoder, channel);
+
+    return aeron_archive_encoder_length(&encoder);
+}
+
+int aeron_archive_encode_extend_recording_request(
+    uint8_t *buffer,
+    size_t capacity,
+    int64_t control_session_id,
+    int64_t correlation_id,
+    int64_t recording_id,
+    int32_t stream_id,
+    aeron_archive_source_location_t source_location,
+    const char *channel)
+{
+    aeron_archive_encoder_t encoder;
+
+    aeron_archive_encoder_init(&encoder, buffer, capacity, 32, AERON_ARCHIVE_EXTEND_RECORDING_REQUEST_TEMPLATE_ID);
+    aeron_archive_encoder_put_int64(&encoder, control_session_id);
+    aeron_archive_encoder_put_int64(&encoder, correlation_id);
+    aeron_archive_encoder_put_int64(&encoder, recording_id);
+    aeron_archive_encoder_put_int32(&encoder, stream_id);
+    aeron_archive_encoder_put_int32(&encoder, (int32_t)source_location);
+    aeron_archive_encoder_put_string(&encoder, channel);
+
+    return aeron_archive_encoder_length(&encoder);
+}
+
+int aeron_archive_encode_stop_recording_request(
+    uint8_t *buffer,
+    size_t capacity,
+    int64_t control_session_id,
+    int64_t correlation_id,
+    int32_t stream_id,
+    const char *channel)
+{
+    aeron_archive_encoder_t encoder;
+
+    aeron_archive_encoder_init(&encoder, buffer, capacity, 20, AERON_ARCHIVE_STOP_RECORDING_REQUEST_TEMPLATE_ID);
+    aeron_archive_encoder_put_int64(&encoder, control_session_id);
+    aeron_archive_encoder_put_int64(&encoder, correlation_id);
+    aeron_archive_encoder_put_int32(&encoder, stream_id);
+    aeron_archive_encoder_put_string(&encoder, channel);
+
+    return aeron_archive_encoder_length(&encoder);
+}
+
+int aeron_archive_encode_replay_request(
+    uint8_t *buffer,
+    size_t capacity,
+    int64_t control_session_id,
+    int64_t correlation_id,
+    int64_t recording_id,
+    int64_t position,
+    int64_t length,
+    int32_t replay_stream_id,
+    const char *replay_channel)
+{
+    aeron_archive_encoder_t encoder;
+
+    aeron_archive_encoder_init(&encoder, buffer, capacity, 44, AERON_ARCHIVE_REPLAY_REQUEST_TEMPLATE_ID);
+    aeron_archive_encoder_put_int64(&encoder, control_session_id);
+    aeron_archive_encoder_put_int64(&encoder, correlation_id);
+    aeron_archive_encoder_put_int64(&encoder, recording_id);
+    aeron_archive_encoder_put_int64(&encoder, position);
+    aeron_archive_encoder_put_int64(&encoder, length);
+    aeron_archive_encoder_put_int32(&encoder, replay_stream_id);
+    aeron_archive_encoder_put_string(&encoder, replay_channel);
+
+    return aeron_archive_encoder_length(&encoder);
+}
+
+int aeron_archive_encode_bounded_replay_request(
+    uint8_t *buffer,
+    size_t capacity,
+    int64_t control_session_id,
+    int64_t correlation_id,
+    int64_t recording_id,
+    int64_t position,
+    int64_t length,
+    int32_t limit_counter_id,
+    int32_t replay_stream_id,
+    const char *replay_channel)
+{
+    aeron_archive_encoder_t encoder;
+
+    aeron_archive_encoder_init(&encoder, buffer, capacity, 48, AERON_ARCHIVE_BOUNDED_REPLAY_REQUEST_TEMPLATE_ID);
+    aeron_archive_encoder_put_int64(&encoder, control_session_id);
+    aeron_archive_encoder_put_int64(&encoder, correlation_id);
+    aeron_archive_encoder_put_int64(&encoder, recording_id);
+    aeron_archive_encoder_put_int64(&encoder, position);
+    aeron_archive_encoder_put_int64(&encoder, length);
+    aeron_archive_encoder_put_int32(&encoder, limit_counter_id);
+    aeron_archive_encoder_put_int32(&encoder, replay_stream_id);
+    aeron_archive_encoder_put_string(&encoder, replay_channel);
+
+    return aeron_archive_encoder_length(&encoder);
+}
+
+int aeron_archive_encode_id_request(
+    uint8_t *buffer,
+    size_t capacity,
+    uint16_t template_id,
+    int64_t control_session_id,
+    int64_t correlation_id,
+    int64_t id)
+{
+    aeron_archive_encoder_t encoder;
+
+    aeron_archive_encoder_init(&encoder, buffer, capacity, 24, template_id);
+    aeron_archive_encoder_put_int64(&encoder, control_session_id);
+    aeron_archive_encoder_put_int64(&encoder, correlation_id);
+    aeron_archive_encoder_put_int64(&encoder, id);
+
+    return aeron_archive_encoder_length(&encoder);
+}
+
+int aeron_archive_encode_list_recordings_request(
+    uint8_t *buffer,
+    size_t capacity,
+    int64_t control_session_id,
+    int64_t correlation_id,
+    int64_t from_recording_id,
+    int32_t record_count)
+{
+    aeron_archive_encoder_t encoder;
+
+    aeron_archive_encoder_init(&encoder, buffer, capacity, 28, AERON_ARCHIVE_LIST_RECORDINGS_REQUEST_TEMPLATE_ID);
+    aeron_archive_encoder_put_int64(&encoder, control_session_id);
+    aeron_archive_encoder_put_int64(&encoder, correlation_id);
+    aeron_archive_encoder_put_int64(&encoder, from_recording_id);
+    aeron_archive_encoder_put_int32(&encoder, record_count);
+
+    return aeron_archive_encoder_length(&encoder);
+}
+
+int aeron_archive_encode_list_recordings_for_uri_request(
+    uint8_t *buffer,
+    size_t capacity,
+    int64_t control_session_id,
+    int64_t correlation_id,
+    int64_t from_recording_id,
+    int32_t record_count,
+    int32_t stream_id,
+    const char *channel)
+{
+    aeron_archive_encoder_t encoder;
+
+    aeron_archive_encoder_init(
+        &encoder, buffer, capacity, 32, AERON_ARCHIVE_LIST_RECORDINGS_FOR_URI_REQUEST_TEMPLATE_ID);
+    aeron_archive_encoder_put_int64(&encoder, control_session_id);
+    aeron_archive_encoder_put_int64(&encoder, correlation_id);
+    aeron_archive_encoder_put_int64(&encoder, from_recording_id);
+    aeron_archive_encoder_put_int32(&encoder, record_count);
+    aeron_archive_encoder_put_int32(&encoder, stream_id);
+    aeron_archive_encoder_put_string(&encoder, channel);
+
+    return aeron_archive_encoder_length(&encoder);
+}
+
+int aeron_archive_encode_truncate_recording_request(
+    uint8_t *buffer,
+    size_t capacity,
+    int64_t control_session_id,
+    int64_t correlation_id,
+    int64_t recording_id,
+    int64_t position)
+{
+    aeron_archive_encoder_t encoder;
+
+    aeron_archive_encoder_init(&encoder, buffer, capacity, 32, AERON_ARCHIVE_TRUNCATE_RECORDING_REQUEST_TEMPLATE_ID);
+    aeron_archive_encoder_put_int64(&encoder, control_session_id);
+    aeron_archive_encoder_put_int64(&encoder, correlation_id);
+    aeron_archive_encoder_put_int64(&encoder, recording_id);
+    aeron_archive_encoder_put_int64(&encoder, position);
+
+    return aeron_archive_encoder_length(&encoder);
+}
+
+int aeron_archive_encode_find_last_matching_recording_request(
+    uint8_t *buffer,
+    size_t capacity,
+    int64_t control_session_id,
+    int64_t correlation_id,
+    int64_t min_recording_id,
+    int32_t session_id,
+    int32_t stream_id,
+    const char *channel)
+{
+    aeron_archive_encoder_t encoder;
+
+    aeron_archive_encoder_init(
+        &encoder, buffer, capacity, 32, AERON_ARCHIVE_FIND_LAST_MATCHING_RECORDING_REQUEST_TEMPLATE_ID);
+    aeron_archive_encoder_put_int64(&encoder, control_session_id);
+    aeron_archive_encoder_put_int64(&encoder, correlation_id);
+    aeron_archive_encoder_put_int64(&encoder, min_recording_id);
+    aeron_archive_encoder_put_int32(&encoder, session_id);
+    aeron_archive_encoder_put_int32(&encoder, stream_id);
+    aeron_archive_encoder_put_string(&encoder, channel);
+
+    return aeron_archive_encoder_length(&encoder);
+}
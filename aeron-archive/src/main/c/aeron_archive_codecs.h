@@ -0,0 +1,242 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_ARCHIVE_CODECS_H
+#define AERON_ARCHIVE_CODECS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "aeron_archive.h"
+
+/*
+ * Encoders and decoders for the subset of the archive control protocol used by the C client, written by hand from
+ * aeron-archive-codecs.xml so the C client does not depend on generated SBE code. Encoders return the encoded length
+ * or -1 if the buffer is too small. Decoders return 0 or -1 if the message is truncated.
+ */
+
+#define AERON_ARCHIVE_SCHEMA_ID (101)
+#define AERON_ARCHIVE_SCHEMA_VERSION (4)
+#define AERON_ARCHIVE_PROTOCOL_SEMANTIC_VERSION ((1 << 16) | (5 << 8) | 0)
+
+#define AERON_ARCHIVE_MESSAGE_HEADER_LENGTH (8)
+#define AERON_ARCHIVE_VAR_DATA_LENGTH_FIELD_LENGTH (4)
+
+#define AERON_ARCHIVE_CONTROL_RESPONSE_TEMPLATE_ID (1)
+#define AERON_ARCHIVE_CONNECT_REQUEST_TEMPLATE_ID (2)
+#define AERON_ARCHIVE_CLOSE_SESSION_REQUEST_TEMPLATE_ID (3)
+#define AERON_ARCHIVE_START_RECORDING_REQUEST_TEMPLATE_ID (4)
+#define AERON_ARCHIVE_STOP_RECORDING_REQUEST_TEMPLATE_ID (5)
+#define AERON_ARCHIVE_REPLAY_REQUEST_TEMPLATE_ID (6)
+#define AERON_ARCHIVE_STOP_REPLAY_REQUEST_TEMPLATE_ID (7)
+#define AERON_ARCHIVE_LIST_RECORDINGS_REQUEST_TEMPLATE_ID (8)
+#define AERON_ARCHIVE_LIST_RECORDINGS_FOR_URI_REQUEST_TEMPLATE_ID (9)
+#define AERON_ARCHIVE_LIST_RECORDING_REQUEST_TEMPLATE_ID (10)
+#define AERON_ARCHIVE_EXTEND_RECORDING_REQUEST_TEMPLATE_ID (11)
+#define AERON_ARCHIVE_RECORDING_POSITION_REQUEST_TEMPLATE_ID (12)
+#define AERON_ARCHIVE_TRUNCATE_RECORDING_REQUEST_TEMPLATE_ID (13)
+#define AERON_ARCHIVE_STOP_RECORDING_SUBSCRIPTION_REQUEST_TEMPLATE_ID (14)
+#define AERON_ARCHIVE_STOP_POSITION_REQUEST_TEMPLATE_ID (15)
+#define AERON_ARCHIVE_FIND_LAST_MATCHING_RECORDING_REQUEST_TEMPLATE_ID (16)
+#define AERON_ARCHIVE_BOUNDED_REPLAY_REQUEST_TEMPLATE_ID (18)
+#define AERON_ARCHIVE_STOP_ALL_REPLAYS_REQUEST_TEMPLATE_ID (19)
+#define AERON_ARCHIVE_RECORDING_DESCRIPTOR_TEMPLATE_ID (22)
+#define AERON_ARCHIVE_START_POSITION_REQUEST_TEMPLATE_ID (52)
+#define AERON_ARCHIVE_AUTH_CONNECT_REQUEST_TEMPLATE_ID (58)
+#define AERON_ARCHIVE_CHALLENGE_TEMPLATE_ID (59)
+#define AERON_ARCHIVE_CHALLENGE_RESPONSE_TEMPLATE_ID (60)
+#define AERON_ARCHIVE_KEEP_ALIVE_REQUEST_TEMPLATE_ID (61)
+
+#define AERON_ARCHIVE_CONTROL_RESPONSE_BLOCK_LENGTH (32)
+#define AERON_ARCHIVE_CHALLENGE_BLOCK_LENGTH (20)
+#define AERON_ARCHIVE_RECORDING_DESCRIPTOR_BLOCK_LENGTH (80)
+
+#define AERON_ARCHIVE_ERROR_MESSAGE_MAX_LENGTH (1024)
+
+typedef struct aeron_archive_message_header_stct
+{
+    uint16_t block_length;
+    uint16_t template_id;
+    uint16_t schema_id;
+    uint16_t version;
+}
+aeron_archive_message_header_t;
+
+typedef struct aeron_archive_control_response_stct
+{
+    int64_t control_session_id;
+    int64_t correlation_id;
+    int64_t relevant_id;
+    int32_t code;
+    int32_t version;
+    const char *error_message;
+    size_t error_message_length;
+}
+aeron_archive_control_response_t;
+
+typedef struct aeron_archive_challenge_stct
+{
+    int64_t control_session_id;
+    int64_t correlation_id;
+    int32_t version;
+    const uint8_t *encoded_challenge;
+    size_t encoded_challenge_length;
+}
+aeron_archive_challenge_t;
+
+int aeron_archive_decode_message_header(
+    aeron_archive_message_header_t *header, const uint8_t *buffer, size_t length);
+
+int aeron_archive_decode_control_response(
+    aeron_archive_control_response_t *response,
+    const aeron_archive_message_header_t *header,
+    const uint8_t *buffer,
+    size_t length);
+
+int aeron_archive_decode_challenge(
+    aeron_archive_challenge_t *challenge,
+    const aeron_archive_message_header_t *header,
+    const uint8_t *buffer,
+    size_t length);
+
+int aeron_archive_decode_recording_descriptor(
+    aeron_archive_recording_descriptor_t *descriptor,
+    const aeron_archive_message_header_t *header,
+    const uint8_t *buffer,
+    size_t length);
+
+int aeron_archive_encode_auth_connect_request(
+    uint8_t *buffer,
+    size_t capacity,
+    int64_t correlation_id,
+    int32_t response_stream_id,
+    const char *response_channel,
+    const uint8_t *encoded_credentials,
+    size_t encoded_credentials_length);
+
+int aeron_archive_encode_challenge_response(
+    uint8_t *buffer,
+    size_t capacity,
+    int64_t control_session_id,
+    int64_t correlation_id,
+    const uint8_t *encoded_credentials,
+    size_t encoded_credentials_length);
+
+int aeron_archive_encode_close_session_request(uint8_t *buffer, size_t capacity, int64_t control_session_id);
+
+int aeron_archive_encode_keep_alive_request(
+    uint8_t *buffer, size_t capacity, int64_t control_session_id, int64_t correlation_id);
+
+int aeron_archive_encode_start_recording_request(
+    uint8_t *buffer,
+    size_t capacity,
+    int64_t control_session_id,
+    int64_t correlation_id,
+    int32_t stream_id,
+    aeron_archive_source_location_t source_location,
+    const char *channel);
+
+int aeron_archive_encode_extend_recording_request(
+    uint8_t *buffer,
+    size_t capacity,
+    int64_t control_session_id,
+    int64_t correlation_id,
+    int64_t recording_id,
+    int32_t stream_id,
+    aeron_archive_source_location_t source_location,
+    const char *channel);
+
+int aeron_archive_encode_stop_recording_request(
+    uint8_t *buffer,
+    size_t capacity,
+    int64_t control_session_id,
+    int64_t correlation_id,
+    int32_t stream_id,
+    const char *channel);
+
+int aeron_archive_encode_replay_request(
+    uint8_t *buffer,
+    size_t capacity,
+    int64_t control_session_id,
+    int64_t correlation_id,
+    int64_t recording_id,
+    int64_t position,
+    int64_t length,
+    int32_t replay_stream_id,
+    const char *replay_channel);
+
+int aeron_archive_encode_bounded_replay_request(
+    uint8_t *buffer,
+    size_t capacity,
+    int64_t control_session_id,
+    int64_t correlation_id,
+    int64_t recording_id,
+    int64_t position,
+    int64_t length,
+    int32_t limit_counter_id,
+    int32_t replay_stream_id,
+    const char *replay_channel);
+
+/*
+ * The requests which carry a single id after the session and correlation ids share one encoder, selected by
+ * template id: stop replay, stop all replays, list recording, recording position, start position, stop position and
+ * stop recording subscription.
+ */
+int aeron_archive_encode_id_request(
+    uint8_t *buffer,
+    size_t capacity,
+    uint16_t template_id,
+    int64_t control_session_id,
+    int64_t correlation_id,
+    int64_t id);
+
+int aeron_archive_encode_list_recordings_request(
+    uint8_t *buffer,
+    size_t capacity,
+    int64_t control_session_id,
+    int64_t correlation_id,
+    int64_t from_recording_id,
+    int32_t record_count);
+
+int aeron_archive_encode_list_recordings_for_uri_request(
+    uint8_t *buffer,
+    size_t capacity,
+    int64_t control_session_id,
+    int64_t correlation_id,
+    int64_t from_recording_id,
+    int32_t record_count,
+    int32_t stream_id,
+    const char *channel);
+
+int aeron_archive_encode_truncate_recording_request(
+    uint8_t *buffer,
+    size_t capacity,
+    int64_t control_session_id,
+    int64_t correlation_id,
+    int64_t recording_id,
+    int64_t position);
+
+int aeron_archive_encode_find_last_matching_recording_request(
+    uint8_t *buffer,
+    size_t capacity,
+    int64_t control_session_id,
+    int64_t correlation_id,
+    int64_t min_recording_id,
+    int32_t session_id,
+    int32_t stream_id,
+    const char *channel);
+
+#endif //AERON_ARCHIVE_CODECS_H
@@ -0,0 +1,256 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "aeron_archive_context.h"
+#include "aeron_alloc.h"
+#include "util/aeron_error.h"
+#include "util/aeron_parse_util.h"
+
+#define AERON_ARCHIVE_CONTEXT_SET_CHECK_ARG_AND_RETURN(r, a) \
+do \
+{ \
+    if (NULL == (a)) \
+    { \
+        aeron_set_err(EINVAL, "%s", strerror(EINVAL)); \
+        return (r); \
+    } \
+} \
+while (false)
+
+static int aeron_archive_context_parse_stream_id(const char *env_var, int32_t *stream_id)
+{
+    const char *value = getenv(env_var);
+
+    if (NULL != value)
+    {
+        errno = 0;
+        char *end_ptr = NULL;
+        long result = strtol(value, &end_ptr, 0);
+
+        if (0 != errno || '\0' != *end_ptr || result < INT32_MIN || result > INT32_MAX)
+        {
+            aeron_set_err(EINVAL, "could not parse stream id: %s=%s", env_var, value);
+            return -1;
+        }
+
+        *stream_id = (int32_t)result;
+    }
+
+    return 0;
+}
+
+int aeron_archive_context_init(aeron_archive_context_t **context)
+{
+    aeron_archive_context_t *_context = NULL;
+    char *value = NULL;
+
+    if (NULL == context)
+    {
+        aeron_set_err(EINVAL, "aeron_archive_context_init(NULL): %s", strerror(EINVAL));
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&_context, sizeof(aeron_archive_context_t)) < 0)
+    {
+        return -1;
+    }
+
+    _context->aeron = NULL;
+    _context->control_request_stream_id = AERON_ARCHIVE_CONTROL_STREAM_ID_DEFAULT;
+    _context->control_response_stream_id = AERON_ARCHIVE_CONTROL_RESPONSE_STREAM_ID_DEFAULT;
+    _context->message_timeout_ns = AERON_ARCHIVE_MESSAGE_TIMEOUT_NS_DEFAULT;
+    _context->encoded_credentials_length = 0;
+    _context->on_challenge = NULL;
+    _context->on_challenge_clientd = NULL;
+    _context->error_handler = NULL;
+    _context->error_handler_clientd = NULL;
+
+    value = getenv(AERON_ARCHIVE_CONTROL_CHANNEL_ENV_VAR);
+    snprintf(
+        _context->control_request_channel,
+        sizeof(_context->control_request_channel),
+        "%s",
+        NULL != value ? value : AERON_ARCHIVE_CONTROL_CHANNEL_DEFAULT);
+
+    value = getenv(AERON_ARCHIVE_CONTROL_RESPONSE_CHANNEL_ENV_VAR);
+    snprintf(
+        _context->control_response_channel,
+        sizeof(_context->control_response_channel),
+        "%s",
+        NULL != value ? value : AERON_ARCHIVE_CONTROL_RESPONSE_CHANNEL_DEFAULT);
+
+    if (aeron_archive_context_parse_stream_id(
+        AERON_ARCHIVE_CONTROL_STREAM_ID_ENV_VAR, &_context->control_request_stream_id) < 0 ||
+        aeron_archive_context_parse_stream_id(
+        AERON_ARCHIVE_CONTROL_RESPONSE_STREAM_ID_ENV_VAR, &_context->control_response_stream_id) < 0)
+    {
+        aeron_free(_context);
+        return -1;
+    }
+
+    if ((value = getenv(AERON_ARCHIVE_MESSAGE_TIMEOUT_ENV_VAR)))
+    {
+        uint64_t result;
+        if (aeron_parse_duration_ns(value, &result) < 0)
+        {
+            aeron_set_err(EINVAL, "could not parse: %s=%s", AERON_ARCHIVE_MESSAGE_TIMEOUT_ENV_VAR, value);
+            aeron_free(_context);
+            return -1;
+        }
+
+        _context->message_timeout_ns = result;
+    }
+
+    *context = _context;
+    return 0;
+}
+
+int aeron_archive_context_close(aeron_archive_context_t *context)
+{
+    aeron_free(context);
+    return 0;
+}
+
+int aeron_archive_context_set_aeron(aeron_archive_context_t *context, aeron_t *aeron)
+{
+    AERON_ARCHIVE_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->aeron = aeron;
+    return 0;
+}
+
+aeron_t *aeron_archive_context_get_aeron(aeron_archive_context_t *context)
+{
+    return NULL != context ? context->aeron : NULL;
+}
+
+int aeron_archive_context_set_control_request_channel(aeron_archive_context_t *context, const char *channel)
+{
+    AERON_ARCHIVE_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+    AERON_ARCHIVE_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, channel);
+
+    snprintf(context->control_request_channel, sizeof(context->control_request_channel), "%s", channel);
+    return 0;
+}
+
+const char *aeron_archive_context_get_control_request_channel(aeron_archive_context_t *context)
+{
+    return NULL != context ? context->control_request_channel : NULL;
+}
+
+int aeron_archive_context_set_control_request_stream_id(aeron_archive_context_t *context, int32_t stream_id)
+{
+    AERON_ARCHIVE_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->control_request_stream_id = stream_id;
+    return 0;
+}
+
+int32_t aeron_archive_context_get_control_request_stream_id(aeron_archive_context_t *context)
+{
+    return NULL != context ? context->control_request_stream_id : AERON_ARCHIVE_CONTROL_STREAM_ID_DEFAULT;
+}
+
+int aeron_archive_context_set_control_response_channel(aeron_archive_context_t *context, const char *channel)
+{
+    AERON_ARCHIVE_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+    AERON_ARCHIVE_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, channel);
+
+    snprintf(context->control_response_channel, sizeof(context->control_response_channel), "%s", channel);
+    return 0;
+}
+
+const char *aeron_archive_context_get_control_response_channel(aeron_archive_context_t *context)
+{
+    return NULL != context ? context->control_response_channel : NULL;
+}
+
+int aeron_archive_context_set_control_response_stream_id(aeron_archive_context_t *context, int32_t stream_id)
+{
+    AERON_ARCHIVE_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->control_response_stream_id = stream_id;
+    return 0;
+}
+
+int32_t aeron_archive_context_get_control_response_stream_id(aeron_archive_context_t *context)
+{
+    return NULL != context ?
+        context->control_response_stream_id : AERON_ARCHIVE_CONTROL_RESPONSE_STREAM_ID_DEFAULT;
+}
+
+int aeron_archive_context_set_message_timeout_ns(aeron_archive_context_t *context, uint64_t timeout_ns)
+{
+    AERON_ARCHIVE_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->message_timeout_ns = timeout_ns;
+    return 0;
+}
+
+uint64_t aeron_archive_context_get_message_timeout_ns(aeron_archive_context_t *context)
+{
+    return NULL != context ? context->message_timeout_ns : AERON_ARCHIVE_MESSAGE_TIMEOUT_NS_DEFAULT;
+}
+
+int aeron_archive_context_set_credentials(
+    aeron_archive_context_t *context, const uint8_t *encoded_credentials, size_t encoded_credentials_length)
+{
+    AERON_ARCHIVE_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    if (encoded_credentials_length > sizeof(context->encoded_credentials))
+    {
+        aeron_set_err(
+            EINVAL,
+            "credentials length %d exceeds max %d",
+            (int)encoded_credentials_length,
+            AERON_ARCHIVE_CREDENTIALS_MAX_LENGTH);
+        return -1;
+    }
+
+    if (encoded_credentials_length > 0)
+    {
+        AERON_ARCHIVE_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, encoded_credentials);
+        memcpy(context->encoded_credentials, encoded_credentials, encoded_credentials_length);
+    }
+
+    context->encoded_credentials_length = encoded_credentials_length;
+    return 0;
+}
+
+int aeron_archive_context_set_on_challenge(
+    aeron_archive_context_t *context, aeron_archive_on_challenge_func_t on_challenge, void *clientd)
+{
+    AERON_ARCHIVE_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->on_challenge = on_challenge;
+    context->on_challenge_clientd = clientd;
+    return 0;
+}
+
+int aeron_archive_context_set_error_handler(
+    aeron_archive_context_t *context, aeron_error_handler_t error_handler, void *clientd)
+{
+    AERON_ARCHIVE_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->error_handler = error_handler;
+    context->error_handler_clientd = clientd;
+    return 0;
+}
@@ -0,0 +1,45 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_ARCHIVE_CONTEXT_H
+#define AERON_ARCHIVE_CONTEXT_H
+
+#include "aeron_archive.h"
+#include "aeron_common.h"
+
+#define AERON_ARCHIVE_CREDENTIALS_MAX_LENGTH (1024)
+
+typedef struct aeron_archive_context_stct
+{
+    aeron_t *aeron;
+    char control_request_channel[AERON_MAX_PATH];
+    int32_t control_request_stream_id;
+    char control_response_channel[AERON_MAX_PATH];
+    int32_t control_response_stream_id;
+    uint64_t message_timeout_ns;
+
+    uint8_t encoded_credentials[AERON_ARCHIVE_CREDENTIALS_MAX_LENGTH];
+    size_t encoded_credentials_length;
+
+    aeron_archive_on_challenge_func_t on_challenge;
+    void *on_challenge_clientd;
+
+    aeron_error_handler_t error_handler;
+    void *error_handler_clientd;
+}
+aeron_archive_context_t;
+
+#endif //AERON_ARCHIVE_CONTEXT_H
@@ -0,0 +1,169 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+
+#include "aeron_archive_control_response_poller.h"
+#include "aeron_archive_codecs.h"
+#include "aeron_alloc.h"
+
+int aeron_archive_control_response_poller_init(
+    aeron_archive_control_response_poller_t *poller, aeron_subscription_t *subscription, size_t fragment_limit)
+{
+    memset(poller, 0, sizeof(aeron_archive_control_response_poller_t));
+    poller->subscription = subscription;
+    poller->fragment_limit = fragment_limit;
+    poller->control_session_id = AERON_NULL_VALUE;
+    poller->correlation_id = AERON_NULL_VALUE;
+    poller->relevant_id = AERON_NULL_VALUE;
+    poller->template_id = AERON_NULL_VALUE;
+
+    return aeron_controlled_fragment_assembler_create(
+        &poller->fragment_assembler, aeron_archive_control_response_poller_on_fragment, poller);
+}
+
+int aeron_archive_control_response_poller_close(aeron_archive_control_response_poller_t *poller)
+{
+    if (NULL != poller->fragment_assembler)
+    {
+        aeron_controlled_fragment_assembler_delete(poller->fragment_assembler);
+        poller->fragment_assembler = NULL;
+    }
+
+    aeron_free(poller->encoded_challenge);
+    poller->encoded_challenge = NULL;
+
+    return 0;
+}
+
+int aeron_archive_control_response_poller_poll(aeron_archive_control_response_poller_t *poller)
+{
+    poller->control_session_id = AERON_NULL_VALUE;
+    poller->correlation_id = AERON_NULL_VALUE;
+    poller->relevant_id = AERON_NULL_VALUE;
+    poller->template_id = AERON_NULL_VALUE;
+    poller->version = 0;
+    poller->code = AERON_NULL_VALUE;
+    poller->error_message[0] = '\0';
+    poller->encoded_challenge_length = 0;
+    poller->is_poll_complete = false;
+    poller->is_code_error = false;
+    poller->is_code_ok = false;
+    poller->is_decode_error = false;
+
+    int fragments = aeron_subscription_controlled_poll(
+        poller->subscription,
+        aeron_controlled_fragment_assembler_handler,
+        poller->fragment_assembler,
+        poller->fragment_limit);
+
+    return poller->is_decode_error ? -1 : fragments;
+}
+
+static aeron_controlled_fragment_handler_action_t aeron_archive_control_response_poller_on_challenge(
+    aeron_archive_control_response_poller_t *poller,
+    const aeron_archive_message_header_t *message_header,
+    const uint8_t *buffer,
+    size_t length)
+{
+    aeron_archive_challenge_t challenge;
+
+    if (aeron_archive_decode_challenge(&challenge, message_header, buffer, length) < 0)
+    {
+        poller->is_decode_error = true;
+        return AERON_ACTION_BREAK;
+    }
+
+    if (challenge.encoded_challenge_length > poller->encoded_challenge_capacity)
+    {
+        if (aeron_reallocf((void **)&poller->encoded_challenge, challenge.encoded_challenge_length) < 0)
+        {
+            poller->encoded_challenge_capacity = 0;
+            poller->is_decode_error = true;
+            return AERON_ACTION_BREAK;
+        }
+
+        poller->encoded_challenge_capacity = challenge.encoded_challenge_length;
+    }
+
+    if (challenge.encoded_challenge_length > 0)
+    {
+        memcpy(poller->encoded_challenge, challenge.encoded_challenge, challenge.encoded_challenge_length);
+    }
+
+    poller->control_session_id = challenge.control_session_id;
+    poller->correlation_id = challenge.correlation_id;
+    poller->relevant_id = AERON_NULL_VALUE;
+    poller->version = challenge.version;
+    poller->encoded_challenge_length = challenge.encoded_challenge_length;
+    poller->template_id = AERON_ARCHIVE_CHALLENGE_TEMPLATE_ID;
+    poller->is_poll_complete = true;
+
+    return AERON_ACTION_BREAK;
+}
+
+aeron_controlled_fragment_handler_action_t aeron_archive_control_response_poller_on_fragment(
+    void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header)
+{
+    aeron_archive_control_response_poller_t *poller = (aeron_archive_control_response_poller_t *)clientd;
+    aeron_archive_message_header_t message_header;
+    aeron_archive_control_response_t response;
+
+    if (poller->is_poll_complete)
+    {
+        return AERON_ACTION_ABORT;
+    }
+
+    if (aeron_archive_decode_message_header(&message_header, buffer, length) < 0)
+    {
+        poller->is_decode_error = true;
+        return AERON_ACTION_BREAK;
+    }
+
+    if (AERON_ARCHIVE_CHALLENGE_TEMPLATE_ID == message_header.template_id)
+    {
+        return aeron_archive_control_response_poller_on_challenge(poller, &message_header, buffer, length);
+    }
+
+    if (AERON_ARCHIVE_CONTROL_RESPONSE_TEMPLATE_ID != message_header.template_id)
+    {
+        return AERON_ACTION_CONTINUE;
+    }
+
+    if (aeron_archive_decode_control_response(&response, &message_header, buffer, length) < 0)
+    {
+        poller->is_decode_error = true;
+        return AERON_ACTION_BREAK;
+    }
+
+    size_t error_message_length = response.error_message_length < sizeof(poller->error_message) ?
+        response.error_message_length : sizeof(poller->error_message) - 1;
+
+    memcpy(poller->error_message, response.error_message, error_message_length);
+    poller->error_message[error_message_length] = '\0';
+
+    poller->control_session_id = response.control_session_id;
+    poller->correlation_id = response.correlation_id;
+    poller->relevant_id = response.relevant_id;
+    poller->version = response.version;
+    poller->code = response.code;
+    poller->template_id = AERON_ARCHIVE_CONTROL_RESPONSE_TEMPLATE_ID;
+    poller->is_code_ok = AERON_ARCHIVE_CONTROL_RESPONSE_CODE_OK == response.code;
+    poller->is_code_error = AERON_ARCHIVE_CONTROL_RESPONSE_CODE_ERROR == response.code;
+    poller->is_poll_complete = true;
+
+    return AERON_ACTION_BREAK;
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_ARCHIVE_CONTROL_RESPONSE_POLLER_H
+#define AERON_ARCHIVE_CONTROL_RESPONSE_POLLER_H
+
+#include "aeron_archive.h"
+#include "aeron_archive_codecs.h"
+
+#define AERON_ARCHIVE_CONTROL_RESPONSE_POLLER_FRAGMENT_LIMIT_DEFAULT (10)
+
+/*
+ * Polls the control response subscription for a single control response or challenge per poll. The error message
+ * and encoded challenge are copied so they remain valid until the next poll.
+ */
+typedef struct aeron_archive_control_response_poller_stct
+{
+    aeron_subscription_t *subscription;
+    aeron_controlled_fragment_assembler_t *fragment_assembler;
+    size_t fragment_limit;
+
+    int64_t control_session_id;
+    int64_t correlation_id;
+    int64_t relevant_id;
+    int32_t template_id;
+    int32_t version;
+    int32_t code;
+    char error_message[AERON_ARCHIVE_ERROR_MESSAGE_MAX_LENGTH];
+
+    uint8_t *encoded_challenge;
+    size_t encoded_challenge_length;
+    size_t encoded_challenge_capacity;
+
+    bool is_poll_complete;
+    bool is_code_error;
+    bool is_code_ok;
+    bool is_decode_error;
+}
+aeron_archive_control_response_poller_t;
+
+int aeron_archive_control_response_poller_init(
+    aeron_archive_control_response_poller_t *poller, aeron_subscription_t *subscription, size_t fragment_limit);
+
+int aeron_archive_control_response_poller_close(aeron_archive_control_response_poller_t *poller);
+
+/*
+ * Poll for the next response, returning the number of fragments read or -1 if a response could not be decoded.
+ */
+int aeron_archive_control_response_poller_poll(aeron_archive_control_response_poller_t *poller);
+
+aeron_controlled_fragment_handler_action_t aeron_archive_control_response_poller_on_fragment(
+    void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header);
+
+#endif //AERON_ARCHIVE_CONTROL_RESPONSE_POLLER_H
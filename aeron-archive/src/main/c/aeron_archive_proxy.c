@@ -0,0 +1,403 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <errno.h>
+
+#include "aeron_archive_proxy.h"
+#include "aeron_archive_codecs.h"
+#include "aeron_agent.h"
+#include "util/aeron_error.h"
+
+void aeron_archive_proxy_init(
+    aeron_archive_proxy_t *proxy, aeron_exclusive_publication_t *publication, int retry_attempts)
+{
+    proxy->publication = publication;
+    proxy->retry_attempts = retry_attempts;
+}
+
+static int aeron_archive_proxy_offer_with_attempts(aeron_archive_proxy_t *proxy, int length, int attempts)
+{
+    if (length < 0)
+    {
+        return -1;
+    }
+
+    while (true)
+    {
+        int64_t result = aeron_exclusive_publication_offer(
+            proxy->publication, proxy->buffer, (size_t)length, NULL, NULL);
+
+        if (result > 0)
+        {
+            return 1;
+        }
+
+        if (AERON_PUBLICATION_CLOSED == result)
+        {
+            aeron_set_err(EPIPE, "%s", "archive control publication is closed");
+            return -1;
+        }
+
+        if (AERON_PUBLICATION_NOT_CONNECTED == result)
+        {
+            aeron_set_err(ENOTCONN, "%s", "archive control publication is not connected");
+            return -1;
+        }
+
+        if (AERON_PUBLICATION_MAX_POSITION_EXCEEDED == result)
+        {
+            aeron_set_err(EOVERFLOW, "%s", "archive control publication at max position");
+            return -1;
+        }
+
+        if (--attempts <= 0)
+        {
+            return 0;
+        }
+
+        aeron_idle_strategy_yielding_idle(NULL, 0);
+    }
+}
+
+static int aeron_archive_proxy_offer(aeron_archive_proxy_t *proxy, int length)
+{
+    return aeron_archive_proxy_offer_with_attempts(proxy, length, proxy->retry_attempts);
+}
+
+int aeron_archive_proxy_try_connect(
+    aeron_archive_proxy_t *proxy,
+    const char *response_channel,
+    int32_t response_stream_id,
+    const uint8_t *encoded_credentials,
+    size_t encoded_credentials_length,
+    int64_t correlation_id)
+{
+    int length = aeron_archive_encode_auth_connect_request(
+        proxy->buffer,
+        sizeof(proxy->buffer),
+        correlation_id,
+        response_stream_id,
+        response_channel,
+        encoded_credentials,
+        encoded_credentials_length);
+
+    return aeron_archive_proxy_offer_with_attempts(proxy, length, 1);
+}
+
+int aeron_archive_proxy_try_challenge_response(
+    aeron_archive_proxy_t *proxy,
+    const uint8_t *encoded_credentials,
+    size_t encoded_credentials_length,
+    int64_t correlation_id,
+    int64_t control_session_id)
+{
+    int length = aeron_archive_encode_challenge_response(
+        proxy->buffer,
+        sizeof(proxy->buffer),
+        control_session_id,
+        correlation_id,
+        encoded_credentials,
+        encoded_credentials_length);
+
+    return aeron_archive_proxy_offer_with_attempts(proxy, length, 1);
+}
+
+int aeron_archive_proxy_close_session(aeron_archive_proxy_t *proxy, int64_t control_session_id)
+{
+    return aeron_archive_proxy_offer(
+        proxy, aeron_archive_encode_close_session_request(proxy->buffer, sizeof(proxy->buffer), control_session_id));
+}
+
+int aeron_archive_proxy_keep_alive(aeron_archive_proxy_t *proxy, int64_t correlation_id, int64_t control_session_id)
+{
+    return aeron_archive_proxy_offer(
+        proxy,
+        aeron_archive_encode_keep_alive_request(
+            proxy->buffer, sizeof(proxy->buffer), control_session_id, correlation_id));
+}
+
+int aeron_archive_proxy_start_recording(
+    aeron_archive_proxy_t *proxy,
+    const char *channel,
+    int32_t stream_id,
+    aeron_archive_source_location_t source_location,
+    int64_t correlation_id,
+    int64_t control_session_id)
+{
+    return aeron_archive_proxy_offer(
+        proxy,
+        aeron_archive_encode_start_recording_request(
+            proxy->buffer,
+            sizeof(proxy->buffer),
+            control_session_id,
+            correlation_id,
+            stream_id,
+            source_location,
+            channel));
+}
+
+int aeron_archive_proxy_extend_recording(
+    aeron_archive_proxy_t *proxy,
+    const char *channel,
+    int32_t stream_id,
+    aeron_archive_source_location_t source_location,
+    int64_t recording_id,
+    int64_t correlation_id,
+    int64_t control_session_id)
+{
+    return aeron_archive_proxy_offer(
+        proxy,
+        aeron_archive_encode_extend_recording_request(
+            proxy->buffer,
+            sizeof(proxy->buffer),
+            control_session_id,
+            correlation_id,
+            recording_id,
+            stream_id,
+            source_location,
+            channel));
+}
+
+int aeron_archive_proxy_stop_recording(
+    aeron_archive_proxy_t *proxy,
+    const char *channel,
+    int32_t stream_id,
+    int64_t correlation_id,
+    int64_t control_session_id)
+{
+    return aeron_archive_proxy_offer(
+        proxy,
+        aeron_archive_encode_stop_recording_request(
+            proxy->buffer, sizeof(proxy->buffer), control_session_id, correlation_id, stream_id, channel));
+}
+
+int aeron_archive_proxy_stop_recording_subscription(
+    aeron_archive_proxy_t *proxy, int64_t subscription_id, int64_t correlation_id, int64_t control_session_id)
+{
+    return aeron_archive_proxy_offer(
+        proxy,
+        aeron_archive_encode_id_request(
+            proxy->buffer,
+            sizeof(proxy->buffer),
+            AERON_ARCHIVE_STOP_RECORDING_SUBSCRIPTION_REQUEST_TEMPLATE_ID,
+            control_session_id,
+            correlation_id,
+            subscription_id));
+}
+
+int aeron_archive_proxy_replay(
+    aeron_archive_proxy_t *proxy,
+    int64_t recording_id,
+    int64_t position,
+    int64_t length,
+    const char *replay_channel,
+    int32_t replay_stream_id,
+    int64_t correlation_id,
+    int64_t control_session_id)
+{
+    return aeron_archive_proxy_offer(
+        proxy,
+        aeron_archive_encode_replay_request(
+            proxy->buffer,
+            sizeof(proxy->buffer),
+            control_session_id,
+            correlation_id,
+            recording_id,
+            position,
+            length,
+            replay_stream_id,
+            replay_channel));
+}
+
+int aeron_archive_proxy_bounded_replay(
+    aeron_archive_proxy_t *proxy,
+    int64_t recording_id,
+    int64_t position,
+    int64_t length,
+    int32_t limit_counter_id,
+    const char *replay_channel,
+    int32_t replay_stream_id,
+    int64_t correlation_id,
+    int64_t control_session_id)
+{
+    return aeron_archive_proxy_offer(
+        proxy,
+        aeron_archive_encode_bounded_replay_request(
+            proxy->buffer,
+            sizeof(proxy->buffer),
+            control_session_id,
+            correlation_id,
+            recording_id,
+            position,
+            length,
+            limit_counter_id,
+            replay_stream_id,
+            replay_channel));
+}
+
+int aeron_archive_proxy_stop_replay(
+    aeron_archive_proxy_t *proxy, int64_t replay_session_id, int64_t correlation_id, int64_t control_session_id)
+{
+    return aeron_archive_proxy_offer(
+        proxy,
+        aeron_archive_encode_id_request(
+            proxy->buffer,
+            sizeof(proxy->buffer),
+            AERON_ARCHIVE_STOP_REPLAY_REQUEST_TEMPLATE_ID,
+            control_session_id,
+            correlation_id,
+            replay_session_id));
+}
+
+int aeron_archive_proxy_stop_all_replays(
+    aeron_archive_proxy_t *proxy, int64_t recording_id, int64_t correlation_id, int64_t control_session_id)
+{
+    return aeron_archive_proxy_offer(
+        proxy,
+        aeron_archive_encode_id_request(
+            proxy->buffer,
+            sizeof(proxy->buffer),
+            AERON_ARCHIVE_STOP_ALL_REPLAYS_REQUEST_TEMPLATE_ID,
+            control_session_id,
+            correlation_id,
+            recording_id));
+}
+
+int aeron_archive_proxy_list_recordings(
+    aeron_archive_proxy_t *proxy,
+    int64_t from_recording_id,
+    int32_t record_count,
+    int64_t correlation_id,
+    int64_t control_session_id)
+{
+    return aeron_archive_proxy_offer(
+        proxy,
+        aeron_archive_encode_list_recordings_request(
+            proxy->buffer, sizeof(proxy->buffer), control_session_id, correlation_id, from_recording_id, record_count));
+}
+
+int aeron_archive_proxy_list_recordings_for_uri(
+    aeron_archive_proxy_t *proxy,
+    int64_t from_recording_id,
+    int32_t record_count,
+    const char *channel_fragment,
+    int32_t stream_id,
+    int64_t correlation_id,
+    int64_t control_session_id)
+{
+    return aeron_archive_proxy_offer(
+        proxy,
+        aeron_archive_encode_list_recordings_for_uri_request(
+            proxy->buffer,
+            sizeof(proxy->buffer),
+            control_session_id,
+            correlation_id,
+            from_recording_id,
+            record_count,
+            stream_id,
+            channel_fragment));
+}
+
+int aeron_archive_proxy_list_recording(
+    aeron_archive_proxy_t *proxy, int64_t recording_id, int64_t correlation_id, int64_t control_session_id)
+{
+    return aeron_archive_proxy_offer(
+        proxy,
+        aeron_archive_encode_id_request(
+            proxy->buffer,
+            sizeof(proxy->buffer),
+            AERON_ARCHIVE_LIST_RECORDING_REQUEST_TEMPLATE_ID,
+            control_session_id,
+            correlation_id,
+            recording_id));
+}
+
+int aeron_archive_proxy_get_recording_position(
+    aeron_archive_proxy_t *proxy, int64_t recording_id, int64_t correlation_id, int64_t control_session_id)
+{
+    return aeron_archive_proxy_offer(
+        proxy,
+        aeron_archive_encode_id_request(
+            proxy->buffer,
+            sizeof(proxy->buffer),
+            AERON_ARCHIVE_RECORDING_POSITION_REQUEST_TEMPLATE_ID,
+            control_session_id,
+            correlation_id,
+            recording_id));
+}
+
+int aeron_archive_proxy_get_start_position(
+    aeron_archive_proxy_t *proxy, int64_t recording_id, int64_t correlation_id, int64_t control_session_id)
+{
+    return aeron_archive_proxy_offer(
+        proxy,
+        aeron_archive_encode_id_request(
+            proxy->buffer,
+            sizeof(proxy->buffer),
+            AERON_ARCHIVE_START_POSITION_REQUEST_TEMPLATE_ID,
+            control_session_id,
+            correlation_id,
+            recording_id));
+}
+
+int aeron_archive_proxy_get_stop_position(
+    aeron_archive_proxy_t *proxy, int64_t recording_id, int64_t correlation_id, int64_t control_session_id)
+{
+    return aeron_archive_proxy_offer(
+        proxy,
+        aeron_archive_encode_id_request(
+            proxy->buffer,
+            sizeof(proxy->buffer),
+            AERON_ARCHIVE_STOP_POSITION_REQUEST_TEMPLATE_ID,
+            control_session_id,
+            correlation_id,
+            recording_id));
+}
+
+int aeron_archive_proxy_find_last_matching_recording(
+    aeron_archive_proxy_t *proxy,
+    int64_t min_recording_id,
+    const char *channel_fragment,
+    int32_t stream_id,
+    int32_t session_id,
+    int64_t correlation_id,
+    int64_t control_session_id)
+{
+    return aeron_archive_proxy_offer(
+        proxy,
+        aeron_archive_encode_find_last_matching_recording_request(
+            proxy->buffer,
+            sizeof(proxy->buffer),
+            control_session_id,
+            correlation_id,
+            min_recording_id,
+            session_id,
+            stream_id,
+            channel_fragment));
+}
+
+int aeron_archive_proxy_truncate_recording(
+    aeron_archive_proxy_t *proxy,
+    int64_t recording_id,
+    int64_t position,
+    int64_t correlation_id,
+    int64_t control_session_id)
+{
+    return aeron_archive_proxy_offer(
+        proxy,
+        aeron_archive_encode_truncate_recording_request(
+            proxy->buffer, sizeof(proxy->buffer), control_session_id, correlation_id, recording_id, position));
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_ARCHIVE_PROXY_H
+#define AERON_ARCHIVE_PROXY_H
+
+#include "aeron_archive.h"
+
+#define AERON_ARCHIVE_PROXY_BUFFER_LENGTH (8 * 1024)
+#define AERON_ARCHIVE_PROXY_RETRY_ATTEMPTS_DEFAULT (3)
+
+/*
+ * Encodes and offers control requests to the archive. Each request returns 1 when sent, 0 if it could not be sent
+ * within the retry attempts due to back pressure, or -1 if the publication is closed, not connected or at its max
+ * position.
+ */
+typedef struct aeron_archive_proxy_stct
+{
+    aeron_exclusive_publication_t *publication;
+    int retry_attempts;
+    uint8_t buffer[AERON_ARCHIVE_PROXY_BUFFER_LENGTH];
+}
+aeron_archive_proxy_t;
+
+void aeron_archive_proxy_init(
+    aeron_archive_proxy_t *proxy, aeron_exclusive_publication_t *publication, int retry_attempts);
+
+/*
+ * Connect and challenge responses are tried once only as the caller polls for the response.
+ */
+int aeron_archive_proxy_try_connect(
+    aeron_archive_proxy_t *proxy,
+    const char *response_channel,
+    int32_t response_stream_id,
+    const uint8_t *encoded_credentials,
+    size_t encoded_credentials_length,
+    int64_t correlation_id);
+
+int aeron_archive_proxy_try_challenge_response(
+    aeron_archive_proxy_t *proxy,
+    const uint8_t *encoded_credentials,
+    size_t encoded_credentials_length,
+    int64_t correlation_id,
+    int64_t control_session_id);
+
+int aeron_archive_proxy_close_session(aeron_archive_proxy_t *proxy, int64_t control_session_id);
+
+int aeron_archive_proxy_keep_alive(aeron_archive_proxy_t *proxy, int64_t correlation_id, int64_t control_session_id);
+
+int aeron_archive_proxy_start_recording(
+    aeron_archive_proxy_t *proxy,
+    const char *channel,
+    int32_t stream_id,
+    aeron_archive_source_location_t source_location,
+    int64_t correlation_id,
+    int64_t control_session_id);
+
+int aeron_archive_proxy_extend_recording(
+    aeron_archive_proxy_t *proxy,
+    const char *channel,
+    int32_t stream_id,
+    aeron_archive_source_location_t source_location,
+    int64_t recording_id,
+    int64_t correlation_id,
+    int64_t control_session_id);
+
+int aeron_archive_proxy_stop_recording(
+    aeron_archive_proxy_t *proxy,
+    const char *channel,
+    int32_t stream_id,
+    int64_t correlation_id,
+    int64_t control_session_id);
+
+int aeron_archive_proxy_stop_recording_subscription(
+    aeron_archive_proxy_t *proxy, int64_t subscription_id, int64_t correlation_id, int64_t control_session_id);
+
+int aeron_archive_proxy_replay(
+    aeron_archive_proxy_t *proxy,
+    int64_t recording_id,
+    int64_t position,
+    int64_t length,
+    const char *replay_channel,
+    int32_t replay_stream_id,
+    int64_t correlation_id,
+    int64_t control_session_id);
+
+int aeron_archive_proxy_bounded_replay(
+    aeron_archive_proxy_t *proxy,
+    int64_t recording_id,
+    int64_t position,
+    int64_t length,
+    int32_t limit_counter_id,
+    const char *replay_channel,
+    int32_t replay_stream_id,
+    int64_t correlation_id,
+    int64_t control_session_id);
+
+int aeron_archive_proxy_stop_replay(
+    aeron_archive_proxy_t *proxy, int64_t replay_session_id, int64_t correlation_id, int64_t control_session_id);
+
+int aeron_archive_proxy_stop_all_replays(
+    aeron_archive_proxy_t *proxy, int64_t recording_id, int64_t correlation_id, int64_t control_session_id);
+
+int aeron_archive_proxy_list_recordings(
+    aeron_archive_proxy_t *proxy,
+    int64_t from_recording_id,
+    int32_t record_count,
+    int64_t correlation_id,
+    int64_t control_session_id);
+
+int aeron_archive_proxy_list_recordings_for_uri(
+    aeron_archive_proxy_t *proxy,
+    int64_t from_recording_id,
+    int32_t record_count,
+    const char *channel_fragment,
+    int32_t stream_id,
+    int64_t correlation_id,
+    int64_t control_session_id);
+
+int aeron_archive_proxy_list_recording(
+    aeron_archive_proxy_t *proxy, int64_t recording_id, int64_t correlation_id, int64_t control_session_id);
+
+int aeron_archive_proxy_get_recording_position(
+    aeron_archive_proxy_t *proxy, int64_t recording_id, int64_t correlation_id, int64_t control_session_id);
+
+int aeron_archive_proxy_get_start_position(
+    aeron_archive_proxy_t *proxy, int64_t recording_id, int64_t correlation_id, int64_t control_session_id);
+
+int aeron_archive_proxy_get_stop_position(
+    aeron_archive_proxy_t *proxy, int64_t recording_id, int64_t correlation_id, int64_t control_session_id);
+
+int aeron_archive_proxy_find_last_matching_recording(
+    aeron_archive_proxy_t *proxy,
+    int64_t min_recording_id,
+    const char *channel_fragment,
+    int32_t stream_id,
+    int32_t session_id,
+    int64_t correlation_id,
+    int64_t control_session_id);
+
+int aeron_archive_proxy_truncate_recording(
+    aeron_archive_proxy_t *proxy,
+    int64_t recording_id,
+    int64_t position,
+    int64_t correlation_id,
+    int64_t control_session_id);
+
+#endif //AERON_ARCHIVE_PROXY_H
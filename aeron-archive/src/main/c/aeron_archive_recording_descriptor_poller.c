@@ -0,0 +1,187 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <stdio.h>
+#include <inttypes.h>
+
+#include "aeron_archive_recording_descriptor_poller.h"
+#include "aeron_archive_codecs.h"
+#include "util/aeron_error.h"
+
+int aeron_archive_recording_descriptor_poller_init(
+    aeron_archive_recording_descriptor_poller_t *poller,
+    aeron_subscription_t *subscription,
+    int64_t control_session_id,
+    size_t fragment_limit,
+    aeron_error_handler_t error_handler,
+    void *error_handler_clientd)
+{
+    memset(poller, 0, sizeof(aeron_archive_recording_descriptor_poller_t));
+    poller->subscription = subscription;
+    poller->control_session_id = control_session_id;
+    poller->fragment_limit = fragment_limit;
+    poller->error_handler = error_handler;
+    poller->error_handler_clientd = error_handler_clientd;
+    poller->correlation_id = AERON_NULL_VALUE;
+
+    return aeron_controlled_fragment_assembler_create(
+        &poller->fragment_assembler, aeron_archive_recording_descriptor_poller_on_fragment, poller);
+}
+
+int aeron_archive_recording_descriptor_poller_close(aeron_archive_recording_descriptor_poller_t *poller)
+{
+    if (NULL != poller->fragment_assembler)
+    {
+        aeron_controlled_fragment_assembler_delete(poller->fragment_assembler);
+        poller->fragment_assembler = NULL;
+    }
+
+    return 0;
+}
+
+void aeron_archive_recording_descriptor_poller_reset(
+    aeron_archive_recording_descriptor_poller_t *poller,
+    int64_t correlation_id,
+    int32_t record_count,
+    aeron_archive_recording_descriptor_consumer_func_t consumer,
+    void *clientd)
+{
+    poller->correlation_id = correlation_id;
+    poller->remaining_record_count = record_count;
+    poller->consumer = consumer;
+    poller->consumer_clientd = clientd;
+    poller->is_dispatch_complete = false;
+    poller->is_error = false;
+}
+
+int aeron_archive_recording_descriptor_poller_poll(aeron_archive_recording_descriptor_poller_t *poller)
+{
+    poller->is_dispatch_complete = false;
+
+    int fragments = aeron_subscription_controlled_poll(
+        poller->subscription,
+        aeron_controlled_fragment_assembler_handler,
+        poller->fragment_assembler,
+        poller->fragment_limit);
+
+    return poller->is_error ? -1 : fragments;
+}
+
+static aeron_controlled_fragment_handler_action_t aeron_archive_recording_descriptor_poller_on_control_response(
+    aeron_archive_recording_descriptor_poller_t *poller,
+    const aeron_archive_message_header_t *message_header,
+    const uint8_t *buffer,
+    size_t length)
+{
+    aeron_archive_control_response_t response;
+
+    if (aeron_archive_decode_control_response(&response, message_header, buffer, length) < 0)
+    {
+        poller->is_error = true;
+        return AERON_ACTION_BREAK;
+    }
+
+    if (response.control_session_id != poller->control_session_id)
+    {
+        return AERON_ACTION_CONTINUE;
+    }
+
+    if (AERON_ARCHIVE_CONTROL_RESPONSE_CODE_RECORDING_UNKNOWN == response.code &&
+        response.correlation_id == poller->correlation_id)
+    {
+        poller->is_dispatch_complete = true;
+        return AERON_ACTION_BREAK;
+    }
+
+    if (AERON_ARCHIVE_CONTROL_RESPONSE_CODE_ERROR == response.code)
+    {
+        char message[AERON_ARCHIVE_ERROR_MESSAGE_MAX_LENGTH];
+        snprintf(
+            message,
+            sizeof(message),
+            "response for correlation_id=%" PRId64 ", error: %.*s",
+            response.correlation_id,
+            (int)response.error_message_length,
+            response.error_message);
+
+        if (response.correlation_id == poller->correlation_id)
+        {
+            aeron_set_err(EINVAL, "%s", message);
+            poller->is_error = true;
+            poller->is_dispatch_complete = true;
+            return AERON_ACTION_BREAK;
+        }
+        else if (NULL != poller->error_handler)
+        {
+            poller->error_handler(poller->error_handler_clientd, (int)response.relevant_id, message);
+        }
+    }
+
+    return AERON_ACTION_CONTINUE;
+}
+
+aeron_controlled_fragment_handler_action_t aeron_archive_recording_descriptor_poller_on_fragment(
+    void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header)
+{
+    aeron_archive_recording_descriptor_poller_t *poller = (aeron_archive_recording_descriptor_poller_t *)clientd;
+    aeron_archive_message_header_t message_header;
+
+    if (poller->is_dispatch_complete)
+    {
+        return AERON_ACTION_ABORT;
+    }
+
+    if (aeron_archive_decode_message_header(&message_header, buffer, length) < 0)
+    {
+        poller->is_error = true;
+        poller->is_dispatch_complete = true;
+        return AERON_ACTION_BREAK;
+    }
+
+    if (AERON_ARCHIVE_CONTROL_RESPONSE_TEMPLATE_ID == message_header.template_id)
+    {
+        return aeron_archive_recording_descriptor_poller_on_control_response(
+            poller, &message_header, buffer, length);
+    }
+
+    if (AERON_ARCHIVE_RECORDING_DESCRIPTOR_TEMPLATE_ID == message_header.template_id)
+    {
+        aeron_archive_recording_descriptor_t descriptor;
+
+        if (aeron_archive_decode_recording_descriptor(&descriptor, &message_header, buffer, length) < 0)
+        {
+            poller->is_error = true;
+            poller->is_dispatch_complete = true;
+            return AERON_ACTION_BREAK;
+        }
+
+        if (descriptor.control_session_id == poller->control_session_id &&
+            descriptor.correlation_id == poller->correlation_id)
+        {
+            poller->consumer(&descriptor, poller->consumer_clientd);
+
+            if (0 == --poller->remaining_record_count)
+            {
+                poller->is_dispatch_complete = true;
+                return AERON_ACTION_BREAK;
+            }
+        }
+    }
+
+    return AERON_ACTION_CONTINUE;
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_ARCHIVE_RECORDING_DESCRIPTOR_POLLER_H
+#define AERON_ARCHIVE_RECORDING_DESCRIPTOR_POLLER_H
+
+#include "aeron_archive.h"
+
+/*
+ * Polls the control response subscription for the recording descriptors of a list request, dispatching each to a
+ * consumer until the requested count is reached or the archive reports there are no more recordings.
+ */
+typedef struct aeron_archive_recording_descriptor_poller_stct
+{
+    aeron_subscription_t *subscription;
+    aeron_controlled_fragment_assembler_t *fragment_assembler;
+    size_t fragment_limit;
+    int64_t control_session_id;
+
+    int64_t correlation_id;
+    int32_t remaining_record_count;
+    aeron_archive_recording_descriptor_consumer_func_t consumer;
+    void *consumer_clientd;
+
+    aeron_error_handler_t error_handler;
+    void *error_handler_clientd;
+
+    bool is_dispatch_complete;
+    bool is_error;
+}
+aeron_archive_recording_descriptor_poller_t;
+
+int aeron_archive_recording_descriptor_poller_init(
+    aeron_archive_recording_descriptor_poller_t *poller,
+    aeron_subscription_t *subscription,
+    int64_t control_session_id,
+    size_t fragment_limit,
+    aeron_error_handler_t error_handler,
+    void *error_handler_clientd);
+
+int aeron_archive_recording_descriptor_poller_close(aeron_archive_recording_descriptor_poller_t *poller);
+
+void aeron_archive_recording_descriptor_poller_reset(
+    aeron_archive_recording_descriptor_poller_t *poller,
+    int64_t correlation_id,
+    int32_t record_count,
+    aeron_archive_recording_descriptor_consumer_func_t consumer,
+    void *clientd);
+
+/*
+ * Poll for descriptors, returning the number of fragments read or -1 if the archive returned an error for the
+ * request or a message could not be decoded.
+ */
+int aeron_archive_recording_descriptor_poller_poll(aeron_archive_recording_descriptor_poller_t *poller);
+
+aeron_controlled_fragment_handler_action_t aeron_archive_recording_descriptor_poller_on_fragment(
+    void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header);
+
+#endif //AERON_ARCHIVE_RECORDING_DESCRIPTOR_POLLER_H
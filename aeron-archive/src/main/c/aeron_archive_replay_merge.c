@@ -0,0 +1,612 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <stdio.h>
+#include <inttypes.h>
+
+#include "aeron_archive_replay_merge.h"
+#include "aeron_archive_client.h"
+#include "aeron_alloc.h"
+#include "aeron_agent.h"
+#include "util/aeron_error.h"
+
+#define AERON_ARCHIVE_REPLAY_MERGE_IPC_PREFIX "aeron:ipc"
+#define AERON_ARCHIVE_REPLAY_MERGE_MANUAL_CONTROL_MODE "control-mode=manual"
+
+static bool aeron_archive_replay_merge_is_ipc(const char *channel)
+{
+    return 0 == strncmp(channel, AERON_ARCHIVE_REPLAY_MERGE_IPC_PREFIX, strlen(AERON_ARCHIVE_REPLAY_MERGE_IPC_PREFIX));
+}
+
+static void aeron_archive_replay_merge_await_destination(aeron_archive_replay_merge_t *merge)
+{
+    while (NULL != merge->async_destination)
+    {
+        int result = aeron_subscription_async_destination_poll(merge->async_destination);
+        if (0 != result)
+        {
+            merge->async_destination = NULL;
+            break;
+        }
+
+        if (merge->archive->use_conductor_agent_invoker)
+        {
+            aeron_main_do_work(merge->archive->ctx.aeron);
+        }
+
+        aeron_idle_strategy_yielding_idle(NULL, 0);
+    }
+}
+
+static int aeron_archive_replay_merge_poll_destination(aeron_archive_replay_merge_t *merge)
+{
+    if (NULL == merge->async_destination)
+    {
+        return 1;
+    }
+
+    int result = aeron_subscription_async_destination_poll(merge->async_destination);
+    if (0 != result)
+    {
+        merge->async_destination = NULL;
+    }
+
+    return result;
+}
+
+static int aeron_archive_replay_merge_add_destination(aeron_archive_replay_merge_t *merge, const char *destination)
+{
+    return aeron_subscription_async_add_destination(
+        &merge->async_destination, merge->archive->ctx.aeron, merge->subscription, destination);
+}
+
+static int aeron_archive_replay_merge_remove_destination(
+    aeron_archive_replay_merge_t *merge, const char *destination)
+{
+    return aeron_subscription_async_remove_destination(
+        &merge->async_destination, merge->archive->ctx.aeron, merge->subscription, destination);
+}
+
+int aeron_archive_replay_merge_init(
+    aeron_archive_replay_merge_t **replay_merge,
+    aeron_subscription_t *subscription,
+    aeron_archive_t *archive,
+    const char *replay_channel,
+    const char *replay_destination,
+    const char *live_destination,
+    int64_t recording_id,
+    int64_t start_position,
+    int64_t merge_progress_timeout_ms)
+{
+    aeron_archive_replay_merge_t *_merge = NULL;
+    aeron_subscription_constants_t constants;
+
+    if (NULL == replay_merge || NULL == subscription || NULL == archive ||
+        NULL == replay_channel || NULL == replay_destination || NULL == live_destination)
+    {
+        aeron_set_err(EINVAL, "aeron_archive_replay_merge_init: %s", strerror(EINVAL));
+        return -1;
+    }
+
+    if (aeron_subscription_constants(subscription, &constants) < 0)
+    {
+        return -1;
+    }
+
+    if (NULL == strstr(constants.channel, AERON_ARCHIVE_REPLAY_MERGE_MANUAL_CONTROL_MODE))
+    {
+        aeron_set_err(EINVAL, "subscription channel must be manual control mode: %s", constants.channel);
+        return -1;
+    }
+
+    if (aeron_archive_replay_merge_is_ipc(constants.channel) ||
+        aeron_archive_replay_merge_is_ipc(replay_channel) ||
+        aeron_archive_replay_merge_is_ipc(replay_destination) ||
+        aeron_archive_replay_merge_is_ipc(live_destination))
+    {
+        aeron_set_err(EINVAL, "%s", "IPC merging is not supported");
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&_merge, sizeof(aeron_archive_replay_merge_t)) < 0)
+    {
+        return -1;
+    }
+
+    snprintf(
+        _merge->replay_channel,
+        sizeof(_merge->replay_channel),
+        "%s%clinger=0|eos=false",
+        replay_channel,
+        NULL == strchr(replay_channel, '?') ? '?' : '|');
+    snprintf(_merge->replay_destination, sizeof(_merge->replay_destination), "%s", replay_destination);
+    snprintf(_merge->live_destination, sizeof(_merge->live_destination), "%s", live_destination);
+
+    _merge->subscription = subscription;
+    _merge->archive = archive;
+    _merge->image = NULL;
+    _merge->async_destination = NULL;
+    _merge->state = AERON_ARCHIVE_REPLAY_MERGE_GET_RECORDING_POSITION;
+    _merge->recording_id = recording_id;
+    _merge->start_position = start_position;
+    _merge->merge_progress_timeout_ms = merge_progress_timeout_ms;
+    _merge->active_correlation_id = AERON_NULL_VALUE;
+    _merge->next_target_position = AERON_NULL_VALUE;
+    _merge->replay_session_id = AERON_NULL_VALUE;
+    _merge->position_of_last_progress = AERON_NULL_VALUE;
+    _merge->time_of_last_progress_ms = aeron_epoch_clock();
+    _merge->stream_id = constants.stream_id;
+    _merge->is_live_added = false;
+    _merge->is_replay_active = false;
+
+    if (aeron_archive_replay_merge_add_destination(_merge, _merge->replay_destination) < 0)
+    {
+        aeron_free(_merge);
+        return -1;
+    }
+
+    *replay_merge = _merge;
+    return 0;
+}
+
+static void aeron_archive_replay_merge_stop_replay(aeron_archive_replay_merge_t *merge)
+{
+    const int64_t correlation_id = aeron_next_correlation_id(merge->archive->ctx.aeron);
+
+    if (aeron_archive_proxy_stop_replay(
+        &merge->archive->proxy, merge->replay_session_id, correlation_id, merge->archive->control_session_id) > 0)
+    {
+        merge->is_replay_active = false;
+    }
+}
+
+int aeron_archive_replay_merge_close(aeron_archive_replay_merge_t *replay_merge)
+{
+    if (NULL == replay_merge)
+    {
+        return 0;
+    }
+
+    if (AERON_ARCHIVE_REPLAY_MERGE_CLOSED != replay_merge->state &&
+        !aeron_is_closed(replay_merge->archive->ctx.aeron))
+    {
+        aeron_archive_replay_merge_await_destination(replay_merge);
+
+        if (AERON_ARCHIVE_REPLAY_MERGE_MERGED != replay_merge->state &&
+            aeron_archive_replay_merge_remove_destination(replay_merge, replay_merge->replay_destination) == 0)
+        {
+            aeron_archive_replay_merge_await_destination(replay_merge);
+        }
+
+        if (replay_merge->is_replay_active &&
+            aeron_exclusive_publication_is_connected(replay_merge->archive->publication))
+        {
+            aeron_archive_replay_merge_stop_replay(replay_merge);
+        }
+
+        if (NULL != replay_merge->image)
+        {
+            aeron_subscription_image_release(replay_merge->subscription, replay_merge->image);
+        }
+    }
+
+    replay_merge->state = AERON_ARCHIVE_REPLAY_MERGE_CLOSED;
+    aeron_free(replay_merge);
+
+    return 0;
+}
+
+/*
+ * Returns 1 when the response for correlation_id has arrived, 0 if not yet, and -1 if the archive returned an error.
+ */
+static int aeron_archive_replay_merge_poll_for_response(aeron_archive_t *archive, int64_t correlation_id)
+{
+    aeron_archive_control_response_poller_t *poller = &archive->control_response_poller;
+
+    int fragments = aeron_archive_control_response_poller_poll(poller);
+    if (fragments < 0)
+    {
+        return -1;
+    }
+
+    if (fragments > 0 && poller->is_poll_complete && poller->control_session_id == archive->control_session_id)
+    {
+        if (poller->is_code_error)
+        {
+            aeron_set_err(
+                EINVAL,
+                "archive response for correlation_id=%" PRId64 ", error: %s",
+                poller->correlation_id,
+                poller->error_message);
+            return -1;
+        }
+
+        return poller->correlation_id == correlation_id ? 1 : 0;
+    }
+
+    return 0;
+}
+
+static int aeron_archive_replay_merge_get_recording_position(aeron_archive_replay_merge_t *merge, int64_t now_ms)
+{
+    aeron_archive_t *archive = merge->archive;
+    int work_count = 0;
+
+    if (AERON_NULL_VALUE == merge->active_correlation_id)
+    {
+        const int64_t correlation_id = aeron_next_correlation_id(archive->ctx.aeron);
+        int result = aeron_archive_proxy_get_recording_position(
+            &archive->proxy, merge->recording_id, correlation_id, archive->control_session_id);
+
+        if (result < 0)
+        {
+            return -1;
+        }
+
+        if (result > 0)
+        {
+            merge->time_of_last_progress_ms = now_ms;
+            merge->active_correlation_id = correlation_id;
+            work_count += 1;
+        }
+    }
+    else
+    {
+        int result = aeron_archive_replay_merge_poll_for_response(archive, merge->active_correlation_id);
+
+        if (result < 0)
+        {
+            return -1;
+        }
+
+        if (result > 0)
+        {
+            merge->next_target_position = archive->control_response_poller.relevant_id;
+            merge->active_correlation_id = AERON_NULL_VALUE;
+
+            if (AERON_ARCHIVE_NULL_POSITION == merge->next_target_position)
+            {
+                const int64_t correlation_id = aeron_next_correlation_id(archive->ctx.aeron);
+                result = aeron_archive_proxy_get_stop_position(
+                    &archive->proxy, merge->recording_id, correlation_id, archive->control_session_id);
+
+                if (result < 0)
+                {
+                    return -1;
+                }
+
+                if (result > 0)
+                {
+                    merge->time_of_last_progress_ms = now_ms;
+                    merge->active_correlation_id = correlation_id;
+                    work_count += 1;
+                }
+            }
+            else
+            {
+                merge->time_of_last_progress_ms = now_ms;
+                merge->state = AERON_ARCHIVE_REPLAY_MERGE_REPLAY;
+            }
+
+            work_count += 1;
+        }
+    }
+
+    return work_count;
+}
+
+static int aeron_archive_replay_merge_replay(aeron_archive_replay_merge_t *merge, int64_t now_ms)
+{
+    aeron_archive_t *archive = merge->archive;
+    int work_count = 0;
+
+    if (AERON_NULL_VALUE == merge->active_correlation_id)
+    {
+        const int64_t correlation_id = aeron_next_correlation_id(archive->ctx.aeron);
+        int result = aeron_archive_proxy_replay(
+            &archive->proxy,
+            merge->recording_id,
+            merge->start_position,
+            INT64_MAX,
+            merge->replay_channel,
+            merge->stream_id,
+            correlation_id,
+            archive->control_session_id);
+
+        if (result < 0)
+        {
+            return -1;
+        }
+
+        if (result > 0)
+        {
+            merge->time_of_last_progress_ms = now_ms;
+            merge->active_correlation_id = correlation_id;
+            work_count += 1;
+        }
+    }
+    else
+    {
+        int result = aeron_archive_replay_merge_poll_for_response(archive, merge->active_correlation_id);
+
+        if (result < 0)
+        {
+            return -1;
+        }
+
+        if (result > 0)
+        {
+            merge->is_replay_active = true;
+            merge->replay_session_id = archive->control_response_poller.relevant_id;
+            merge->time_of_last_progress_ms = now_ms;
+            merge->active_correlation_id = AERON_NULL_VALUE;
+            merge->state = AERON_ARCHIVE_REPLAY_MERGE_CATCHUP;
+            work_count += 1;
+        }
+    }
+
+    return work_count;
+}
+
+static int aeron_archive_replay_merge_catchup(aeron_archive_replay_merge_t *merge, int64_t now_ms)
+{
+    int work_count = 0;
+
+    if (NULL == merge->image && aeron_subscription_is_connected(merge->subscription))
+    {
+        merge->time_of_last_progress_ms = now_ms;
+        merge->image = aeron_subscription_image_by_session_id(merge->subscription, (int32_t)merge->replay_session_id);
+        merge->position_of_last_progress = NULL != merge->image ? aeron_image_position(merge->image) : AERON_NULL_VALUE;
+    }
+
+    if (NULL != merge->image)
+    {
+        const int64_t position = aeron_image_position(merge->image);
+
+        if (position >= merge->next_target_position)
+        {
+            merge->time_of_last_progress_ms = now_ms;
+            merge->position_of_last_progress = position;
+            merge->active_correlation_id = AERON_NULL_VALUE;
+            merge->state = AERON_ARCHIVE_REPLAY_MERGE_ATTEMPT_LIVE_JOIN;
+            work_count += 1;
+        }
+        else if (position > merge->position_of_last_progress)
+        {
+            merge->time_of_last_progress_ms = now_ms;
+            merge->position_of_last_progress = position;
+        }
+        else if (aeron_image_is_closed(merge->image))
+        {
+            aeron_set_err(ETIMEDOUT, "%s", "replay merge image closed unexpectedly");
+            return -1;
+        }
+    }
+
+    return work_count;
+}
+
+static bool aeron_archive_replay_merge_should_add_live_destination(
+    aeron_archive_replay_merge_t *merge, int64_t position)
+{
+    aeron_image_constants_t constants;
+    int64_t window = AERON_ARCHIVE_REPLAY_MERGE_LIVE_ADD_MAX_WINDOW;
+
+    if (aeron_image_constants(merge->image, &constants) == 0 && (int64_t)(constants.term_buffer_length / 4) < window)
+    {
+        window = (int64_t)(constants.term_buffer_length / 4);
+    }
+
+    return !merge->is_live_added && (merge->next_target_position - position) <= window;
+}
+
+static bool aeron_archive_replay_merge_should_stop_and_remove_replay(
+    aeron_archive_replay_merge_t *merge, int64_t position)
+{
+    return merge->is_live_added &&
+        (merge->next_target_position - position) <= AERON_ARCHIVE_REPLAY_MERGE_REPLAY_REMOVE_THRESHOLD &&
+        aeron_image_active_transport_count(merge->image) >= 2;
+}
+
+static int aeron_archive_replay_merge_attempt_live_join(aeron_archive_replay_merge_t *merge, int64_t now_ms)
+{
+    aeron_archive_t *archive = merge->archive;
+    int work_count = 0;
+
+    if (AERON_NULL_VALUE == merge->active_correlation_id)
+    {
+        const int64_t correlation_id = aeron_next_correlation_id(archive->ctx.aeron);
+        int result = aeron_archive_proxy_get_recording_position(
+            &archive->proxy, merge->recording_id, correlation_id, archive->control_session_id);
+
+        if (result < 0)
+        {
+            return -1;
+        }
+
+        if (result > 0)
+        {
+            merge->active_correlation_id = correlation_id;
+            work_count += 1;
+        }
+    }
+    else
+    {
+        int result = aeron_archive_replay_merge_poll_for_response(archive, merge->active_correlation_id);
+
+        if (result < 0)
+        {
+            return -1;
+        }
+
+        if (result > 0)
+        {
+            merge->next_target_position = archive->control_response_poller.relevant_id;
+            merge->active_correlation_id = AERON_NULL_VALUE;
+
+            if (AERON_ARCHIVE_NULL_POSITION == merge->next_target_position)
+            {
+                const int64_t correlation_id = aeron_next_correlation_id(archive->ctx.aeron);
+                result = aeron_archive_proxy_get_recording_position(
+                    &archive->proxy, merge->recording_id, correlation_id, archive->control_session_id);
+
+                if (result < 0)
+                {
+                    return -1;
+                }
+
+                if (result > 0)
+                {
+                    merge->active_correlation_id = correlation_id;
+                }
+            }
+            else
+            {
+                aeron_archive_replay_merge_state_t next_state = AERON_ARCHIVE_REPLAY_MERGE_CATCHUP;
+
+                if (NULL != merge->image)
+                {
+                    const int64_t position = aeron_image_position(merge->image);
+
+                    if (aeron_archive_replay_merge_should_add_live_destination(merge, position))
+                    {
+                        if (aeron_archive_replay_merge_add_destination(merge, merge->live_destination) < 0)
+                        {
+                            return -1;
+                        }
+
+                        merge->time_of_last_progress_ms = now_ms;
+                        merge->position_of_last_progress = position;
+                        merge->is_live_added = true;
+                    }
+                    else if (aeron_archive_replay_merge_should_stop_and_remove_replay(merge, position))
+                    {
+                        if (aeron_archive_replay_merge_remove_destination(merge, merge->replay_destination) < 0)
+                        {
+                            return -1;
+                        }
+
+                        aeron_archive_replay_merge_stop_replay(merge);
+                        merge->time_of_last_progress_ms = now_ms;
+                        merge->position_of_last_progress = position;
+                        next_state = AERON_ARCHIVE_REPLAY_MERGE_MERGED;
+                    }
+                }
+
+                merge->state = next_state;
+            }
+
+            work_count += 1;
+        }
+    }
+
+    return work_count;
+}
+
+int aeron_archive_replay_merge_do_work(aeron_archive_replay_merge_t *replay_merge)
+{
+    const int64_t now_ms = aeron_epoch_clock();
+    int work_count = 0;
+
+    if (AERON_ARCHIVE_REPLAY_MERGE_FAILED == replay_merge->state)
+    {
+        return -1;
+    }
+
+    int destination_result = aeron_archive_replay_merge_poll_destination(replay_merge);
+    if (destination_result < 0)
+    {
+        replay_merge->state = AERON_ARCHIVE_REPLAY_MERGE_FAILED;
+        return -1;
+    }
+
+    if (0 == destination_result)
+    {
+        return 0;
+    }
+
+    switch (replay_merge->state)
+    {
+        case AERON_ARCHIVE_REPLAY_MERGE_GET_RECORDING_POSITION:
+            work_count = aeron_archive_replay_merge_get_recording_position(replay_merge, now_ms);
+            break;
+
+        case AERON_ARCHIVE_REPLAY_MERGE_REPLAY:
+            work_count = aeron_archive_replay_merge_replay(replay_merge, now_ms);
+            break;
+
+        case AERON_ARCHIVE_REPLAY_MERGE_CATCHUP:
+            work_count = aeron_archive_replay_merge_catchup(replay_merge, now_ms);
+            break;
+
+        case AERON_ARCHIVE_REPLAY_MERGE_ATTEMPT_LIVE_JOIN:
+            work_count = aeron_archive_replay_merge_attempt_live_join(replay_merge, now_ms);
+            break;
+
+        default:
+            return 0;
+    }
+
+    if (work_count >= 0 && AERON_ARCHIVE_REPLAY_MERGE_MERGED != replay_merge->state &&
+        now_ms > replay_merge->time_of_last_progress_ms + replay_merge->merge_progress_timeout_ms)
+    {
+        aeron_set_err(ETIMEDOUT, "replay merge no progress: state=%d", (int)replay_merge->state);
+        work_count = -1;
+    }
+
+    if (work_count < 0)
+    {
+        replay_merge->state = AERON_ARCHIVE_REPLAY_MERGE_FAILED;
+    }
+
+    return work_count;
+}
+
+int aeron_archive_replay_merge_poll(
+    aeron_archive_replay_merge_t *replay_merge,
+    aeron_fragment_handler_t handler,
+    void *clientd,
+    size_t fragment_limit)
+{
+    if (aeron_archive_replay_merge_do_work(replay_merge) < 0)
+    {
+        return -1;
+    }
+
+    return NULL == replay_merge->image ? 0 : aeron_image_poll(replay_merge->image, handler, clientd, fragment_limit);
+}
+
+aeron_image_t *aeron_archive_replay_merge_image(aeron_archive_replay_merge_t *replay_merge)
+{
+    return replay_merge->image;
+}
+
+bool aeron_archive_replay_merge_is_merged(aeron_archive_replay_merge_t *replay_merge)
+{
+    return AERON_ARCHIVE_REPLAY_MERGE_MERGED == replay_merge->state;
+}
+
+bool aeron_archive_replay_merge_has_failed(aeron_archive_replay_merge_t *replay_merge)
+{
+    return AERON_ARCHIVE_REPLAY_MERGE_FAILED == replay_merge->state;
+}
+
+bool aeron_archive_replay_merge_is_live_added(aeron_archive_replay_merge_t *replay_merge)
+{
+    return replay_merge->is_live_added;
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_ARCHIVE_REPLAY_MERGE_H
+#define AERON_ARCHIVE_REPLAY_MERGE_H
+
+#include "aeron_archive.h"
+#include "aeron_common.h"
+
+typedef enum aeron_archive_replay_merge_state_en
+{
+    AERON_ARCHIVE_REPLAY_MERGE_GET_RECORDING_POSITION = 0,
+    AERON_ARCHIVE_REPLAY_MERGE_REPLAY = 1,
+    AERON_ARCHIVE_REPLAY_MERGE_CATCHUP = 2,
+    AERON_ARCHIVE_REPLAY_MERGE_ATTEMPT_LIVE_JOIN = 3,
+    AERON_ARCHIVE_REPLAY_MERGE_MERGED = 4,
+    AERON_ARCHIVE_REPLAY_MERGE_FAILED = 5,
+    AERON_ARCHIVE_REPLAY_MERGE_CLOSED = 6
+}
+aeron_archive_replay_merge_state_t;
+
+typedef struct aeron_archive_replay_merge_stct
+{
+    aeron_subscription_t *subscription;
+    aeron_archive_t *archive;
+    aeron_image_t *image;
+    aeron_async_destination_t *async_destination;
+
+    char replay_channel[AERON_MAX_PATH];
+    char replay_destination[AERON_MAX_PATH];
+    char live_destination[AERON_MAX_PATH];
+
+    aeron_archive_replay_merge_state_t state;
+    int64_t recording_id;
+    int64_t start_position;
+    int64_t merge_progress_timeout_ms;
+    int64_t active_correlation_id;
+    int64_t next_target_position;
+    int64_t replay_session_id;
+    int64_t position_of_last_progress;
+    int64_t time_of_last_progress_ms;
+    int32_t stream_id;
+    bool is_live_added;
+    bool is_replay_active;
+}
+aeron_archive_replay_merge_t;
+
+#endif //AERON_ARCHIVE_REPLAY_MERGE_H
@@ -16,14 +16,19 @@
 #ifndef AERON_ARCHIVE_AERON_ARCHIVE_H
 #define AERON_ARCHIVE_AERON_ARCHIVE_H
 
+#include <deque>
+#include <unordered_set>
+
 #include "ArchiveConfiguration.h"
 #include "ArchiveProxy.h"
 #include "ControlResponsePoller.h"
+#include "ControlResponseAdapter.h"
 #include "RecordingDescriptorPoller.h"
 #include "RecordingSubscriptionDescriptorPoller.h"
 #include "concurrent/BackOffIdleStrategy.h"
 #include "concurrent/YieldingIdleStrategy.h"
 #include "ArchiveException.h"
+#include "Awaitable.h"
 
 namespace aeron { namespace archive { namespace client
 {
@@ -38,7 +43,8 @@ constexpr const char NOT_CONNECTED_MSG[] = "not connected";
  * <p>
  * This client provides a simple interaction model which is mostly synchronous and may not be optimal.
  * The underlying components such as the ArchiveProxy and the ControlResponsePoller or
- * RecordingDescriptorPoller may be used directly if a more asynchronous interaction is required.
+ * RecordingDescriptorPoller may be used directly if a more asynchronous interaction is required, or the *Async
+ * methods used to have many requests outstanding with their responses delivered by #pollAsyncResponses.
  * <p>
  * Note: This class is threadsafe.
  */
@@ -121,6 +127,23 @@ public:
         return AeronArchive::asyncConnect(ctx);
     }
 
+#if defined(AERON_HAS_COROUTINES)
+    /**
+     * Begin an attempt at creating a connection and await its completion from a coroutine. The connection is
+     * progressed by AwaitScheduler::poll rather than by spinning on AsyncConnect#poll.
+     *
+     * @param scheduler to resume the awaiting coroutine.
+     * @param ctx       for the archive connection.
+     * @return awaitable for the newly created Aeron Archive client.
+     */
+    inline static PollAwaitable<std::shared_ptr<AeronArchive>> awaitConnect(AwaitScheduler &scheduler, Context_t &ctx)
+    {
+        std::shared_ptr<AsyncConnect> asyncConnect = AeronArchive::asyncConnect(ctx);
+
+        return { scheduler, [asyncConnect]() { return asyncConnect->poll(); } };
+    }
+#endif
+
     /**
      * Connect to an Aeron archive by providing a Context. This will create a control session.
      * <p>
@@ -316,6 +339,295 @@ public:
         }
     }
 
+    /**
+     * Send a request to start recording a channel and stream pairing without waiting for the response. The
+     * response is delivered by #pollAsyncResponses with the relevantId being the subscriptionId of the recording.
+     *
+     * @param channel        to be recorded.
+     * @param streamId       to be recorded.
+     * @param sourceLocation of the publication to be recorded.
+     * @tparam IdleStrategy  to use for retrying the send.
+     * @return the correlationId of the request.
+     * @see #startRecording
+     */
+    template<typename IdleStrategy = aeron::concurrent::BackoffIdleStrategy>
+    inline std::int64_t startRecordingAsync(
+        const std::string &channel, std::int32_t streamId, SourceLocation sourceLocation)
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_lock);
+        ensureOpen();
+
+        const std::int64_t correlationId = m_aeron->nextCorrelationId();
+
+        if (!m_archiveProxy->startRecording<IdleStrategy>(
+            channel, streamId, sourceLocation == SourceLocation::LOCAL, correlationId, m_controlSessionId))
+        {
+            throw ArchiveException("failed to send start recording request", SOURCEINFO);
+        }
+
+        return addAsyncRequest(correlationId);
+    }
+
+    /**
+     * Send a request to stop recording for a subscriptionId without waiting for the response.
+     *
+     * @param subscriptionId is the Subscription#registrationId for the recording in the archive.
+     * @tparam IdleStrategy  to use for retrying the send.
+     * @return the correlationId of the request.
+     * @see #stopRecording
+     */
+    template<typename IdleStrategy = aeron::concurrent::BackoffIdleStrategy>
+    inline std::int64_t stopRecordingAsync(std::int64_t subscriptionId)
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_lock);
+        ensureOpen();
+
+        const std::int64_t correlationId = m_aeron->nextCorrelationId();
+
+        if (!m_archiveProxy->stopRecording<IdleStrategy>(subscriptionId, correlationId, m_controlSessionId))
+        {
+            throw ArchiveException("failed to send stop recording request", SOURCEINFO);
+        }
+
+        return addAsyncRequest(correlationId);
+    }
+
+    /**
+     * Send a request for the position recorded for an active recording without waiting for the response. The
+     * relevantId of the response is the position or #NULL_POSITION if the recording is not active.
+     *
+     * @param recordingId   of the active recording for which the position is required.
+     * @tparam IdleStrategy to use for retrying the send.
+     * @return the correlationId of the request.
+     * @see #getRecordingPosition
+     */
+    template<typename IdleStrategy = aeron::concurrent::BackoffIdleStrategy>
+    inline std::int64_t getRecordingPositionAsync(std::int64_t recordingId)
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_lock);
+        ensureOpen();
+
+        const std::int64_t correlationId = m_aeron->nextCorrelationId();
+
+        if (!m_archiveProxy->getRecordingPosition<IdleStrategy>(recordingId, correlationId, m_controlSessionId))
+        {
+            throw ArchiveException("failed to send get recording position request", SOURCEINFO);
+        }
+
+        return addAsyncRequest(correlationId);
+    }
+
+    /**
+     * Send a request for the stop position of a recording without waiting for the response. The relevantId of
+     * the response is the stop position or #NULL_POSITION if the recording is still active.
+     *
+     * @param recordingId   of the recording for which the stop position is required.
+     * @tparam IdleStrategy to use for retrying the send.
+     * @return the correlationId of the request.
+     * @see #getStopPosition
+     */
+    template<typename IdleStrategy = aeron::concurrent::BackoffIdleStrategy>
+    inline std::int64_t getStopPositionAsync(std::int64_t recordingId)
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_lock);
+        ensureOpen();
+
+        const std::int64_t correlationId = m_aeron->nextCorrelationId();
+
+        if (!m_archiveProxy->getStopPosition<IdleStrategy>(recordingId, correlationId, m_controlSessionId))
+        {
+            throw ArchiveException("failed to send get stop position request", SOURCEINFO);
+        }
+
+        return addAsyncRequest(correlationId);
+    }
+
+    /**
+     * Send a request to replay a recording without waiting for the response. The relevantId of the response is
+     * the replay session id as returned from #startReplay.
+     *
+     * @param recordingId    to be replayed.
+     * @param position       from which the replay should begin or #NULL_POSITION if from the start.
+     * @param length         of the stream to be replayed.
+     * @param replayChannel  to which the replay should be sent.
+     * @param replayStreamId to which the replay should be sent.
+     * @tparam IdleStrategy  to use for retrying the send.
+     * @return the correlationId of the request.
+     * @see #startReplay
+     */
+    template<typename IdleStrategy = aeron::concurrent::BackoffIdleStrategy>
+    inline std::int64_t startReplayAsync(
+        std::int64_t recordingId,
+        std::int64_t position,
+        std::int64_t length,
+        const std::string &replayChannel,
+        std::int32_t replayStreamId)
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_lock);
+        ensureOpen();
+
+        const std::int64_t correlationId = m_aeron->nextCorrelationId();
+
+        if (!m_archiveProxy->replay<IdleStrategy>(
+            recordingId, position, length, replayChannel, replayStreamId, correlationId, m_controlSessionId))
+        {
+            throw ArchiveException("failed to send replay request", SOURCEINFO);
+        }
+
+        return addAsyncRequest(correlationId);
+    }
+
+    /**
+     * Send a request to stop a replay session without waiting for the response.
+     *
+     * @param replaySessionId to stop replay for.
+     * @tparam IdleStrategy   to use for retrying the send.
+     * @return the correlationId of the request.
+     * @see #stopReplay
+     */
+    template<typename IdleStrategy = aeron::concurrent::BackoffIdleStrategy>
+    inline std::int64_t stopReplayAsync(std::int64_t replaySessionId)
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_lock);
+        ensureOpen();
+
+        const std::int64_t correlationId = m_aeron->nextCorrelationId();
+
+        if (!m_archiveProxy->stopReplay<IdleStrategy>(replaySessionId, correlationId, m_controlSessionId))
+        {
+            throw ArchiveException("failed to send stop replay request", SOURCEINFO);
+        }
+
+        return addAsyncRequest(correlationId);
+    }
+
+    /**
+     * Poll the control response stream without blocking and deliver the responses to outstanding asynchronous
+     * requests to the consumer. Responses to other requests are skipped, with errors passed to Context#errorHandler
+     * when set. Responses to asynchronous requests which arrive while a blocking method is waiting are held and
+     * delivered by the next call.
+     * <p>
+     * Further asynchronous requests may be sent from within the consumer but the blocking methods may not be called.
+     *
+     * @param consumer      for the responses to asynchronous requests.
+     * @param responseLimit for the number of responses to deliver.
+     * @return the number of responses delivered.
+     */
+    inline int pollAsyncResponses(const on_control_response_t &consumer, int responseLimit = 10)
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_lock);
+        ensureOpen();
+        ensureNotReentrant();
+
+        CallbackGuard callbackGuard(m_isInCallback);
+        int responseCount = 0;
+
+        while (responseCount < responseLimit && !m_deferredAsyncResponses.empty())
+        {
+            const AsyncResponse response = m_deferredAsyncResponses.front();
+            m_deferredAsyncResponses.pop_front();
+            m_pendingAsyncRequests.erase(response.correlationId);
+
+            consumer(
+                m_controlSessionId,
+                response.correlationId,
+                response.relevantId,
+                response.code,
+                response.errorMessage);
+            responseCount++;
+        }
+
+        while (responseCount < responseLimit && !m_pendingAsyncRequests.empty())
+        {
+            const int fragments = m_controlResponsePoller->poll();
+
+            if (!m_controlResponsePoller->isPollComplete())
+            {
+                if (0 == fragments)
+                {
+                    break;
+                }
+
+                continue;
+            }
+
+            if (m_controlResponsePoller->controlSessionId() != m_controlSessionId ||
+                !m_controlResponsePoller->isControlResponse())
+            {
+                continue;
+            }
+
+            const std::int64_t correlationId = m_controlResponsePoller->correlationId();
+
+            if (m_pendingAsyncRequests.erase(correlationId) > 0)
+            {
+                consumer(
+                    m_controlSessionId,
+                    correlationId,
+                    m_controlResponsePoller->relevantId(),
+                    m_controlResponsePoller->codeValue(),
+                    m_controlResponsePoller->errorMessage());
+                responseCount++;
+            }
+            else if (m_controlResponsePoller->isCodeError() && m_ctx->errorHandler() != nullptr)
+            {
+                ArchiveException ex(
+                    static_cast<std::int32_t>(m_controlResponsePoller->relevantId()),
+                    correlationId,
+                    "response for correlationId=" + std::to_string(correlationId) +
+                    ", error: " + m_controlResponsePoller->errorMessage(),
+                    SOURCEINFO);
+                m_ctx->errorHandler()(ex);
+            }
+        }
+
+        return responseCount;
+    }
+
+    /**
+     * The number of asynchronous requests for which a response has not yet been delivered by #pollAsyncResponses.
+     *
+     * @return the number of outstanding asynchronous requests.
+     */
+    inline std::size_t pendingAsyncRequestCount()
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_lock);
+        return m_pendingAsyncRequests.size();
+    }
+
+    /**
+     * Start batching asynchronous requests so they can be sent together by #flushBatch, e.g. to start recording a
+     * large number of streams in one pass. The responses are delivered by #pollAsyncResponses as usual.
+     * <p>
+     * Only the asynchronous methods may be called while batching as the blocking methods would wait for a response
+     * to a request which has not been sent.
+     *
+     * @see ArchiveProxy#startBatch
+     */
+    inline void startBatch()
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_lock);
+        ensureOpen();
+
+        m_archiveProxy->startBatch();
+    }
+
+    /**
+     * Send the requests batched since #startBatch.
+     *
+     * @tparam IdleStrategy to use between Publication::tryClaim attempts.
+     * @return true if all batched requests have been sent otherwise false, in which case this may be called again.
+     * @see ArchiveProxy#flushBatch
+     */
+    template<typename IdleStrategy = aeron::concurrent::BackoffIdleStrategy>
+    inline bool flushBatch()
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_lock);
+        ensureOpen();
+
+        return m_archiveProxy->flushBatch<IdleStrategy>();
+    }
+
     /**
      * Add a Publication and set it up to be recorded. If this is not the first,
      * i.e. Publication#isOriginal is true, then an ArchiveException
@@ -1521,6 +1833,17 @@ private:
     bool m_isClosed = false;
     bool m_isInCallback = false;
 
+    struct AsyncResponse
+    {
+        std::int64_t correlationId;
+        std::int64_t relevantId;
+        std::int32_t code;
+        std::string errorMessage;
+    };
+
+    std::unordered_set<std::int64_t> m_pendingAsyncRequests;
+    std::deque<AsyncResponse> m_deferredAsyncResponses;
+
     inline void ensureOpen() const
     {
         if (m_isClosed)
@@ -1537,6 +1860,36 @@ private:
         }
     }
 
+    inline std::int64_t addAsyncRequest(std::int64_t correlationId)
+    {
+        m_pendingAsyncRequests.insert(correlationId);
+        m_lastCorrelationId = correlationId;
+
+        return correlationId;
+    }
+
+    inline bool deferAsyncResponse(std::int64_t correlationId)
+    {
+        const std::int64_t responseCorrelationId = m_controlResponsePoller->correlationId();
+
+        if (responseCorrelationId != correlationId &&
+            m_controlResponsePoller->isControlResponse() &&
+            m_pendingAsyncRequests.count(responseCorrelationId) > 0)
+        {
+            m_deferredAsyncResponses.push_back(
+                {
+                    responseCorrelationId,
+                    m_controlResponsePoller->relevantId(),
+                    m_controlResponsePoller->codeValue(),
+                    m_controlResponsePoller->errorMessage()
+                });
+
+            return true;
+        }
+
+        return false;
+    }
+
     inline void checkDeadline(long long deadlineNs, const std::string &errorMessage, std::int64_t correlationId)
     {
         if ((deadlineNs - m_nanoClock()) < 0)
@@ -1598,6 +1951,11 @@ private:
                 continue;
             }
 
+            if (deferAsyncResponse(correlationId))
+            {
+                continue;
+            }
+
             if (m_controlResponsePoller->isCodeError())
             {
                 if (m_controlResponsePoller->correlationId() == correlationId)
@@ -1649,6 +2007,11 @@ private:
                 continue;
             }
 
+            if (deferAsyncResponse(correlationId))
+            {
+                continue;
+            }
+
             if (m_controlResponsePoller->isCodeError())
             {
                 if (m_controlResponsePoller->correlationId() == correlationId)
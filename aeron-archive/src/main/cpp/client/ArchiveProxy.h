@@ -19,6 +19,7 @@
 
 #include <array>
 #include <utility>
+#include <vector>
 
 #include "Aeron.h"
 #include "concurrent/BackOffIdleStrategy.h"
@@ -845,15 +846,142 @@ public:
         return offer<IdleStrategy>(m_buffer, 0, length);
     }
 
+    /**
+     * Start batching requests. Until #flushBatch is called, requests which would be offered with retries are
+     * instead encoded into the batch and reported as successfully offered. The try methods for connect and
+     * challenge responses are never batched.
+     * <p>
+     * The archive decodes one request per message so the batched requests are still sent as individual messages,
+     * but they are claimed and written back to back in a single pass without waiting on any responses.
+     */
+    inline void startBatch()
+    {
+        m_isBatching = true;
+    }
+
+    /**
+     * Is the proxy batching requests?
+     *
+     * @return true if the proxy is batching requests.
+     */
+    inline bool isBatching() const
+    {
+        return m_isBatching;
+    }
+
+    /**
+     * Number of requests in the batch which have not yet been sent.
+     *
+     * @return number of requests in the batch which have not yet been sent.
+     */
+    inline std::size_t batchedRequestCount() const
+    {
+        return m_batchLengths.size() - m_batchSentCount;
+    }
+
+    /**
+     * Send the batched requests to the archive. If back pressure persists for the number of retry attempts then
+     * the unsent requests remain in the batch and this method can be called again to continue. Once all requests
+     * are sent the proxy stops batching.
+     *
+     * @tparam IdleStrategy to use between Publication::tryClaim attempts.
+     * @return true if all batched requests have been sent otherwise false.
+     */
+    template<typename IdleStrategy = aeron::concurrent::BackoffIdleStrategy>
+    bool flushBatch()
+    {
+        IdleStrategy idle;
+        BufferClaim bufferClaim;
+
+        int attempts = m_retryAttempts;
+        while (m_batchSentCount < m_batchLengths.size())
+        {
+            const util::index_t length = m_batchLengths[m_batchSentCount];
+            std::uint8_t *message = m_batchBuffer.data() + m_batchSentOffset;
+            std::int64_t result;
+
+            if (length <= m_publication->maxPayloadLength())
+            {
+                result = m_publication->tryClaim(length, bufferClaim);
+                if (result > 0)
+                {
+                    bufferClaim.buffer().putBytes(bufferClaim.offset(), message, length);
+                    bufferClaim.commit();
+                }
+            }
+            else
+            {
+                result = m_publication->offer(AtomicBuffer(message, static_cast<std::size_t>(length)), 0, length);
+            }
+
+            if (result > 0)
+            {
+                m_batchSentOffset += static_cast<std::size_t>(length);
+                m_batchSentCount++;
+                attempts = m_retryAttempts;
+                continue;
+            }
+
+            checkOfferResult(result);
+
+            if (--attempts <= 0)
+            {
+                return false;
+            }
+
+            idle.idle();
+        }
+
+        m_batchBuffer.clear();
+        m_batchLengths.clear();
+        m_batchSentOffset = 0;
+        m_batchSentCount = 0;
+        m_isBatching = false;
+
+        return true;
+    }
+
 private:
     std::array<std::uint8_t, PROXY_REQUEST_BUFFER_LENGTH> m_array;
     AtomicBuffer m_buffer;
     std::shared_ptr<ExclusivePublication> m_publication;
     const int m_retryAttempts;
+    bool m_isBatching = false;
+    std::vector<std::uint8_t> m_batchBuffer;
+    std::vector<util::index_t> m_batchLengths;
+    std::size_t m_batchSentOffset = 0;
+    std::size_t m_batchSentCount = 0;
+
+    static void checkOfferResult(std::int64_t result)
+    {
+        if (result == PUBLICATION_CLOSED)
+        {
+            throw ArchiveException("connection to the archive has been closed", SOURCEINFO);
+        }
+
+        if (result == NOT_CONNECTED)
+        {
+            throw ArchiveException("connection to the archive is no longer available", SOURCEINFO);
+        }
+
+        if (result == MAX_POSITION_EXCEEDED)
+        {
+            throw ArchiveException("offer failed due to max position being reached", SOURCEINFO);
+        }
+    }
 
     template<typename IdleStrategy = aeron::concurrent::BackoffIdleStrategy>
     bool offer(AtomicBuffer &buffer, util::index_t offset, util::index_t length)
     {
+        if (m_isBatching)
+        {
+            const std::uint8_t *message = buffer.buffer() + offset;
+
+            m_batchBuffer.insert(m_batchBuffer.end(), message, message + length);
+            m_batchLengths.push_back(length);
+            return true;
+        }
+
         IdleStrategy idle;
 
         int attempts = m_retryAttempts;
@@ -865,20 +993,7 @@ private:
                 return true;
             }
 
-            if (result == PUBLICATION_CLOSED)
-            {
-                throw ArchiveException("connection to the archive has been closed", SOURCEINFO);
-            }
-
-            if (result == NOT_CONNECTED)
-            {
-                throw ArchiveException("connection to the archive is no longer available", SOURCEINFO);
-            }
-
-            if (result == MAX_POSITION_EXCEEDED)
-            {
-                throw ArchiveException("offer failed due to max position being reached", SOURCEINFO);
-            }
+            checkOfferResult(result);
 
             if (--attempts <= 0)
             {
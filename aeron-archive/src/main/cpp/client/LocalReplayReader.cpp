@@ -0,0 +1,133 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "LocalReplayReader.h"
+
+using namespace aeron;
+using namespace aeron::archive::client;
+
+LocalReplayReader::LocalReplayReader(
+    const std::string &archiveDir,
+    std::int64_t recordingId,
+    std::int64_t startPosition,
+    std::int64_t stopPosition,
+    std::int32_t initialTermId,
+    std::int32_t segmentFileLength,
+    std::int32_t termBufferLength,
+    std::int64_t position) :
+    m_archiveDir(archiveDir),
+    m_recordingId(recordingId),
+    m_startPosition(startPosition),
+    m_stopPosition(stopPosition),
+    m_segmentFileLength(segmentFileLength),
+    m_termBufferLength(termBufferLength),
+    m_position(NULL_POSITION == position ? startPosition : position),
+    m_header(initialTermId, termBufferLength, nullptr)
+{
+    if (m_position < startPosition || (NULL_POSITION != stopPosition && m_position > stopPosition))
+    {
+        throw ArchiveException(
+            "position " + std::to_string(m_position) + " outside range " + std::to_string(startPosition) +
+            "-" + std::to_string(stopPosition) + " for recording " + std::to_string(recordingId),
+            SOURCEINFO);
+    }
+
+    if (0 != (m_position & (FrameDescriptor::FRAME_ALIGNMENT - 1)))
+    {
+        throw ArchiveException(
+            "position " + std::to_string(m_position) + " not aligned to FRAME_ALIGNMENT", SOURCEINFO);
+    }
+}
+
+int LocalReplayReader::poll(const fragment_handler_t &fragmentHandler, int fragmentLimit)
+{
+    int fragmentsRead = 0;
+
+    while (fragmentsRead < fragmentLimit && !isDone())
+    {
+        if (!m_segmentFile && !mapSegment())
+        {
+            break;
+        }
+
+        const auto segmentOffset = static_cast<util::index_t>(m_position - m_segmentBasePosition);
+        if (segmentOffset >= m_segmentBuffer.capacity())
+        {
+            m_segmentFile.reset();
+            continue;
+        }
+
+        const std::int32_t frameLength = FrameDescriptor::frameLengthVolatile(m_segmentBuffer, segmentOffset);
+        if (frameLength <= 0)
+        {
+            break;
+        }
+
+        const std::int32_t alignedLength = util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+        if (!FrameDescriptor::isPaddingFrame(m_segmentBuffer, segmentOffset))
+        {
+            m_header.buffer(m_segmentBuffer);
+            m_header.offset(segmentOffset);
+
+            fragmentHandler(
+                m_segmentBuffer,
+                segmentOffset + DataFrameHeader::LENGTH,
+                frameLength - DataFrameHeader::LENGTH,
+                m_header);
+
+            ++fragmentsRead;
+        }
+
+        m_position += alignedLength;
+    }
+
+    return fragmentsRead;
+}
+
+std::string LocalReplayReader::segmentFileName(std::int64_t recordingId, std::int64_t segmentBasePosition)
+{
+    return std::to_string(recordingId) + "-" + std::to_string(segmentBasePosition) + ".rec";
+}
+
+std::int64_t LocalReplayReader::segmentFileBasePosition(
+    std::int64_t startPosition, std::int64_t position, std::int32_t termBufferLength, std::int32_t segmentFileLength)
+{
+    const std::int64_t startTermBasePosition = startPosition - (startPosition & (termBufferLength - 1));
+    const std::int64_t lengthFromBasePosition = position - startTermBasePosition;
+    const std::int64_t segments = lengthFromBasePosition - (lengthFromBasePosition & (segmentFileLength - 1));
+
+    return startTermBasePosition + segments;
+}
+
+bool LocalReplayReader::mapSegment()
+{
+    const std::int64_t segmentBasePosition = segmentFileBasePosition(
+        m_startPosition, m_position, m_termBufferLength, m_segmentFileLength);
+    const std::string filename =
+        m_archiveDir + std::string(1, AERON_PATH_SEP) + segmentFileName(m_recordingId, segmentBasePosition);
+
+    // the next segment file is created by the archive as the recording progresses
+    if (MemoryMappedFile::getFileSize(filename.c_str()) <= 0)
+    {
+        return false;
+    }
+
+    m_segmentFile = MemoryMappedFile::mapExistingReadOnly(filename.c_str());
+    m_segmentBuffer.wrap(m_segmentFile->getMemoryPtr(), m_segmentFile->getMemorySize());
+    m_segmentBasePosition = segmentBasePosition;
+
+    return true;
+}
@@ -0,0 +1,205 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef AERON_ARCHIVE_LOCAL_REPLAY_READER_H
+#define AERON_ARCHIVE_LOCAL_REPLAY_READER_H
+
+#include <memory>
+#include <string>
+
+#include "AeronArchive.h"
+#include "util/MemoryMappedFile.h"
+
+namespace aeron { namespace archive { namespace client
+{
+
+/**
+ * Replay a recording by mapping its segment files from the archive directory directly into the client process
+ * rather than requesting a replay over a publication from the archive.
+ * <p>
+ * This is only possible when the archive directory is on the same machine. The segment files are mapped read-only
+ * and fragments are delivered from the mapped memory, without copying, to the same #fragment_handler_t used with
+ * Image::poll. Fragments are not reassembled, so a FragmentAssembler should be used if messages may be
+ * fragmented.
+ * <p>
+ * The position and segment layout is taken from the descriptor of the recording as provided by
+ * AeronArchive::listRecording. If the recording is active, i.e. has a stop position of #NULL_POSITION, then
+ * the reader will follow the recording as it progresses.
+ * <p>
+ * Not thread safe.
+ */
+class LocalReplayReader
+{
+public:
+    /**
+     * Create a reader for a recording from the fields of its descriptor.
+     *
+     * @param archiveDir        in which the segment files of the recording are stored.
+     * @param recordingId       of the recording.
+     * @param startPosition     of the recording.
+     * @param stopPosition      of the recording or #NULL_POSITION if still active.
+     * @param initialTermId     of the recorded publication.
+     * @param segmentFileLength of the recording.
+     * @param termBufferLength  of the recorded publication.
+     * @param position          from which to begin reading or #NULL_POSITION to begin at the start position.
+     */
+    LocalReplayReader(
+        const std::string &archiveDir,
+        std::int64_t recordingId,
+        std::int64_t startPosition,
+        std::int64_t stopPosition,
+        std::int32_t initialTermId,
+        std::int32_t segmentFileLength,
+        std::int32_t termBufferLength,
+        std::int64_t position = NULL_POSITION);
+
+    /**
+     * Create a reader for a recording by looking up its descriptor in the archive.
+     *
+     * @param archive     to query for the recording descriptor.
+     * @param archiveDir  in which the segment files of the recording are stored.
+     * @param recordingId of the recording.
+     * @param position    from which to begin reading or #NULL_POSITION to begin at the start position.
+     * @tparam IdleStrategy to use for polling operations.
+     * @return a reader for the recording.
+     * @throws ArchiveException if the recording is not known to the archive.
+     */
+    template<typename IdleStrategy = aeron::concurrent::BackoffIdleStrategy>
+    static std::unique_ptr<LocalReplayReader> forRecording(
+        AeronArchive &archive,
+        const std::string &archiveDir,
+        std::int64_t recordingId,
+        std::int64_t position = NULL_POSITION)
+    {
+        std::unique_ptr<LocalReplayReader> reader;
+
+        const std::int32_t count = archive.listRecording<IdleStrategy>(
+            recordingId,
+            [&](
+                std::int64_t controlSessionId,
+                std::int64_t correlationId,
+                std::int64_t recordingId,
+                std::int64_t startTimestamp,
+                std::int64_t stopTimestamp,
+                std::int64_t startPosition,
+                std::int64_t stopPosition,
+                std::int32_t initialTermId,
+                std::int32_t segmentFileLength,
+                std::int32_t termBufferLength,
+                std::int32_t mtuLength,
+                std::int32_t sessionId,
+                std::int32_t streamId,
+                const std::string &strippedChannel,
+                const std::string &originalChannel,
+                const std::string &sourceIdentity)
+            {
+                reader.reset(new LocalReplayReader(
+                    archiveDir,
+                    recordingId,
+                    startPosition,
+                    stopPosition,
+                    initialTermId,
+                    segmentFileLength,
+                    termBufferLength,
+                    position));
+            });
+
+        if (0 == count || !reader)
+        {
+            throw ArchiveException("unknown recording id: " + std::to_string(recordingId), SOURCEINFO);
+        }
+
+        return reader;
+    }
+
+    /**
+     * Poll the mapped segment files for new fragments up to the stop position of the recording.
+     *
+     * @param fragmentHandler to which fragments are delivered.
+     * @param fragmentLimit   for the number of fragments to be consumed during one polling operation.
+     * @return the number of fragments that have been consumed.
+     */
+    int poll(const fragment_handler_t &fragmentHandler, int fragmentLimit);
+
+    /**
+     * Position of the reader within the recording which is the position of the next fragment to be read.
+     *
+     * @return position of the reader within the recording.
+     */
+    inline std::int64_t position() const
+    {
+        return m_position;
+    }
+
+    /**
+     * Has the reader reached the stop position of the recording. Always false while the recording is active.
+     *
+     * @return true if the stop position of the recording has been reached.
+     */
+    inline bool isDone() const
+    {
+        return NULL_POSITION != m_stopPosition && m_position >= m_stopPosition;
+    }
+
+    /**
+     * Recording id of the recording being read.
+     *
+     * @return recording id of the recording being read.
+     */
+    inline std::int64_t recordingId() const
+    {
+        return m_recordingId;
+    }
+
+    /**
+     * Name of the segment file, relative to the archive directory, which holds the given segment base position.
+     *
+     * @param recordingId         of the recording.
+     * @param segmentBasePosition of the segment file.
+     * @return the name of the segment file.
+     */
+    static std::string segmentFileName(std::int64_t recordingId, std::int64_t segmentBasePosition);
+
+    /**
+     * Base position of the segment file which contains a position in a recording.
+     *
+     * @param startPosition     of the recording.
+     * @param position          within the recording.
+     * @param termBufferLength  of the recorded publication.
+     * @param segmentFileLength of the recording.
+     * @return the base position of the segment file containing the position.
+     */
+    static std::int64_t segmentFileBasePosition(
+        std::int64_t startPosition, std::int64_t position, std::int32_t termBufferLength, std::int32_t segmentFileLength);
+
+private:
+    bool mapSegment();
+
+    const std::string m_archiveDir;
+    const std::int64_t m_recordingId;
+    const std::int64_t m_startPosition;
+    const std::int64_t m_stopPosition;
+    const std::int32_t m_segmentFileLength;
+    const std::int32_t m_termBufferLength;
+    std::int64_t m_position;
+    std::int64_t m_segmentBasePosition = NULL_POSITION;
+    MemoryMappedFile::ptr_t m_segmentFile;
+    AtomicBuffer m_segmentBuffer;
+    Header m_header;
+};
+
+}}}
+
+#endif //AERON_ARCHIVE_LOCAL_REPLAY_READER_H
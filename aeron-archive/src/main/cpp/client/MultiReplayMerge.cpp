@@ -0,0 +1,390 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MultiReplayMerge.h"
+#include "aeron_archive_client/ControlResponseCode.h"
+
+using namespace aeron;
+using namespace aeron::archive::client;
+
+MultiReplayMerge::MultiReplayMerge(
+    std::shared_ptr<AeronArchive> archive, epoch_clock_t epochClock, std::int64_t mergeProgressTimeoutMs) :
+    m_archive(std::move(archive)),
+    m_mergeProgressTimeoutMs(mergeProgressTimeoutMs),
+    m_epochClock(std::move(epochClock))
+{
+    m_onResponse =
+        [this](
+            std::int64_t controlSessionId,
+            std::int64_t correlationId,
+            std::int64_t relevantId,
+            std::int32_t code,
+            const std::string &errorMessage)
+        {
+            onResponse(correlationId, relevantId, code, errorMessage);
+        };
+}
+
+MultiReplayMerge::~MultiReplayMerge()
+{
+    const bool isAeronClosed = m_archive->context().aeron()->isClosed();
+
+    for (Recording &recording : m_recordings)
+    {
+        if (State::CLOSED != recording.state)
+        {
+            if (!isAeronClosed)
+            {
+                if (State::MERGED != recording.state)
+                {
+                    recording.subscription->removeDestination(recording.replayDestination);
+                }
+
+                if (recording.isReplayActive && m_archive->archiveProxy().publication()->isConnected())
+                {
+                    stopReplay(recording);
+                }
+            }
+
+            recording.state = State::CLOSED;
+        }
+    }
+}
+
+std::size_t MultiReplayMerge::addRecording(
+    std::shared_ptr<Subscription> subscription,
+    const std::string &replayChannel,
+    const std::string &replayDestination,
+    const std::string &liveDestination,
+    std::int64_t recordingId,
+    std::int64_t startPosition)
+{
+    std::shared_ptr<ChannelUri> subscriptionChannelUri = ChannelUri::parse(subscription->channel());
+
+    if (subscriptionChannelUri->get(MDC_CONTROL_MODE_PARAM_NAME) != MDC_CONTROL_MODE_MANUAL)
+    {
+        throw util::IllegalArgumentException("subscription channel must be manual control mode: mode=" +
+            subscriptionChannelUri->get(MDC_CONTROL_MODE_PARAM_NAME), SOURCEINFO);
+    }
+
+    if (subscription->channel().compare(0, 9, IPC_CHANNEL) == 0 ||
+        replayChannel.compare(0, 9, IPC_CHANNEL) == 0 ||
+        replayDestination.compare(0, 9, IPC_CHANNEL) == 0 ||
+        liveDestination.compare(0, 9, IPC_CHANNEL) == 0)
+    {
+        throw util::IllegalArgumentException("IPC merging is not supported", SOURCEINFO);
+    }
+
+    std::shared_ptr<ChannelUri> replayChannelUri = ChannelUri::parse(replayChannel);
+    replayChannelUri->put(LINGER_PARAM_NAME, "0");
+    replayChannelUri->put(EOS_PARAM_NAME, "false");
+
+    subscription->addDestination(replayDestination);
+
+    Recording recording;
+    recording.subscription = std::move(subscription);
+    recording.replayChannel = replayChannelUri->toString();
+    recording.replayDestination = replayDestination;
+    recording.liveDestination = liveDestination;
+    recording.recordingId = recordingId;
+    recording.startPosition = startPosition;
+    recording.timeOfLastProgressMs = m_epochClock();
+
+    m_recordings.push_back(std::move(recording));
+
+    return m_recordings.size() - 1;
+}
+
+int MultiReplayMerge::doWork()
+{
+    int workCount = 0;
+    const long long nowMs = m_epochClock();
+
+    try
+    {
+        m_nowMs = nowMs;
+
+        if (!m_recordingIndexByCorrelationId.empty())
+        {
+            workCount += m_archive->pollAsyncResponses(
+                m_onResponse, static_cast<int>(m_recordingIndexByCorrelationId.size()));
+        }
+
+        for (std::size_t i = 0, size = m_recordings.size(); i < size; i++)
+        {
+            workCount += doWork(m_recordings[i], i, nowMs);
+        }
+    }
+    catch (...)
+    {
+        m_hasFailed = true;
+        throw;
+    }
+
+    return workCount;
+}
+
+std::int64_t MultiReplayMerge::replayedLength() const
+{
+    std::int64_t length = 0;
+
+    for (const Recording &recording : m_recordings)
+    {
+        if (nullptr != recording.image)
+        {
+            length += recording.image->position() - recording.startPosition;
+        }
+    }
+
+    return length;
+}
+
+std::int64_t MultiReplayMerge::targetLength() const
+{
+    std::int64_t length = 0;
+
+    for (const Recording &recording : m_recordings)
+    {
+        if (aeron::NULL_VALUE != recording.nextTargetPosition)
+        {
+            length += recording.nextTargetPosition - recording.startPosition;
+        }
+    }
+
+    return length;
+}
+
+int MultiReplayMerge::doWork(Recording &recording, std::size_t index, long long nowMs)
+{
+    int workCount = 0;
+
+    switch (recording.state)
+    {
+        case State::GET_RECORDING_POSITION:
+        case State::ATTEMPT_LIVE_JOIN:
+            if (aeron::NULL_VALUE == recording.activeCorrelationId)
+            {
+                sendRecordingPositionRequest(recording, index);
+                workCount += 1;
+            }
+            break;
+
+        case State::REPLAY:
+            if (aeron::NULL_VALUE == recording.activeCorrelationId)
+            {
+                const std::int64_t correlationId = m_archive->startReplayAsync(
+                    recording.recordingId,
+                    recording.startPosition,
+                    std::numeric_limits<std::int64_t>::max(),
+                    recording.replayChannel,
+                    recording.subscription->streamId());
+
+                recording.activeCorrelationId = correlationId;
+                recording.timeOfLastProgressMs = nowMs;
+                m_recordingIndexByCorrelationId[correlationId] = index;
+                workCount += 1;
+            }
+            break;
+
+        case State::CATCHUP:
+            workCount += catchup(recording, nowMs);
+            break;
+
+        default:
+            return workCount;
+    }
+
+    if (State::MERGED != recording.state && nowMs > (recording.timeOfLastProgressMs + m_mergeProgressTimeoutMs))
+    {
+        throw TimeoutException(
+            "MultiReplayMerge no progress: recordingId=" + std::to_string(recording.recordingId) +
+            " state=" + std::to_string(recording.state),
+            SOURCEINFO);
+    }
+
+    return workCount;
+}
+
+int MultiReplayMerge::catchup(Recording &recording, long long nowMs)
+{
+    int workCount = 0;
+
+    if (nullptr == recording.image && recording.subscription->isConnected())
+    {
+        recording.timeOfLastProgressMs = nowMs;
+        recording.image = recording.subscription->imageBySessionId(
+            static_cast<std::int32_t>(recording.replaySessionId));
+        recording.positionOfLastProgress = recording.image ? recording.image->position() : aeron::NULL_VALUE;
+    }
+
+    if (nullptr != recording.image)
+    {
+        const std::int64_t position = recording.image->position();
+        if (position >= recording.nextTargetPosition)
+        {
+            recording.timeOfLastProgressMs = nowMs;
+            recording.positionOfLastProgress = position;
+            recording.activeCorrelationId = aeron::NULL_VALUE;
+            recording.state = State::ATTEMPT_LIVE_JOIN;
+            workCount += 1;
+        }
+        else if (position > recording.positionOfLastProgress)
+        {
+            recording.timeOfLastProgressMs = nowMs;
+            recording.positionOfLastProgress = position;
+        }
+        else if (recording.image->isClosed())
+        {
+            throw TimeoutException("MultiReplayMerge Image closed unexpectedly", SOURCEINFO);
+        }
+    }
+
+    return workCount;
+}
+
+void MultiReplayMerge::onResponse(
+    std::int64_t correlationId, std::int64_t relevantId, std::int32_t code, const std::string &errorMessage)
+{
+    auto it = m_recordingIndexByCorrelationId.find(correlationId);
+    if (m_recordingIndexByCorrelationId.end() == it)
+    {
+        return;
+    }
+
+    const std::size_t index = it->second;
+    m_recordingIndexByCorrelationId.erase(it);
+
+    Recording &recording = m_recordings[index];
+    recording.activeCorrelationId = aeron::NULL_VALUE;
+
+    if (ControlResponseCode::Value::ERROR == code)
+    {
+        throw ArchiveException(
+            static_cast<std::int32_t>(relevantId),
+            correlationId,
+            "archive response for correlationId=" + std::to_string(correlationId) + ", error: " + errorMessage,
+            SOURCEINFO);
+    }
+
+    switch (recording.state)
+    {
+        case State::GET_RECORDING_POSITION:
+            onRecordingPosition(recording, index, relevantId);
+            break;
+
+        case State::REPLAY:
+            recording.isReplayActive = true;
+            recording.replaySessionId = relevantId;
+            recording.timeOfLastProgressMs = m_nowMs;
+            recording.state = State::CATCHUP;
+            break;
+
+        case State::ATTEMPT_LIVE_JOIN:
+            onLiveJoinPosition(recording, index, relevantId);
+            break;
+
+        default:
+            break;
+    }
+}
+
+void MultiReplayMerge::onRecordingPosition(Recording &recording, std::size_t index, std::int64_t position)
+{
+    if (NULL_POSITION == position)
+    {
+        if (recording.isStopPositionRequested)
+        {
+            recording.isStopPositionRequested = false;
+            sendRecordingPositionRequest(recording, index);
+        }
+        else
+        {
+            const std::int64_t correlationId = m_archive->getStopPositionAsync(recording.recordingId);
+
+            recording.activeCorrelationId = correlationId;
+            recording.isStopPositionRequested = true;
+            m_recordingIndexByCorrelationId[correlationId] = index;
+        }
+    }
+    else
+    {
+        recording.nextTargetPosition = position;
+        recording.isStopPositionRequested = false;
+        recording.timeOfLastProgressMs = m_nowMs;
+        recording.state = State::REPLAY;
+    }
+}
+
+void MultiReplayMerge::onLiveJoinPosition(Recording &recording, std::size_t index, std::int64_t position)
+{
+    if (NULL_POSITION == position)
+    {
+        sendRecordingPositionRequest(recording, index);
+        return;
+    }
+
+    recording.nextTargetPosition = position;
+    State nextState = State::CATCHUP;
+
+    if (nullptr != recording.image)
+    {
+        const std::int64_t imagePosition = recording.image->position();
+
+        if (shouldAddLiveDestination(recording, imagePosition))
+        {
+            recording.subscription->addDestination(recording.liveDestination);
+            recording.timeOfLastProgressMs = m_nowMs;
+            recording.positionOfLastProgress = imagePosition;
+            recording.isLiveAdded = true;
+        }
+        else if (shouldStopAndRemoveReplay(recording, imagePosition))
+        {
+            recording.subscription->removeDestination(recording.replayDestination);
+            stopReplay(recording);
+            recording.timeOfLastProgressMs = m_nowMs;
+            recording.positionOfLastProgress = imagePosition;
+            nextState = State::MERGED;
+        }
+    }
+
+    if (State::MERGED == nextState)
+    {
+        merged(recording);
+    }
+    else
+    {
+        recording.state = nextState;
+    }
+}
+
+void MultiReplayMerge::sendRecordingPositionRequest(Recording &recording, std::size_t index)
+{
+    const std::int64_t correlationId = m_archive->getRecordingPositionAsync(recording.recordingId);
+
+    recording.activeCorrelationId = correlationId;
+    m_recordingIndexByCorrelationId[correlationId] = index;
+}
+
+void MultiReplayMerge::stopReplay(Recording &recording)
+{
+    const std::int64_t correlationId = m_archive->context().aeron()->nextCorrelationId();
+
+    if (m_archive->archiveProxy().stopReplay(
+        recording.replaySessionId, correlationId, m_archive->controlSessionId()))
+    {
+        recording.isReplayActive = false;
+    }
+}
@@ -0,0 +1,287 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef AERON_ARCHIVE_MULTI_REPLAY_MERGE_H
+#define AERON_ARCHIVE_MULTI_REPLAY_MERGE_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "ReplayMerge.h"
+
+namespace aeron { namespace archive { namespace client
+{
+
+/**
+ * Replay a number of recorded streams concurrently, e.g. one recording per shard of a service, and merge each of
+ * them with its live stream.
+ * <p>
+ * Each recording follows the same progression as a ReplayMerge but all of them share the control session of the
+ * archive. Requests for all recordings are pipelined as asynchronous requests with AeronArchive and their responses
+ * are dispatched by correlation id, so the recordings are replayed in parallel rather than one after another. The
+ * AeronArchive should not be used for other asynchronous requests while the merge is in progress.
+ * <p>
+ * Once recordings have been added with #addRecording, #poll should be called in a duty cycle loop until
+ * #isMerged() is true. The fragment limit given to #poll is shared across the recordings in a round robin manner.
+ * If an exception occurs or progress stops on any recording, the merge will fail and #hasFailed() will be true.
+ * <p>
+ * NOTE: Merging is only supported with UDP streams.
+ */
+class MultiReplayMerge
+{
+public:
+    /**
+     * Create a MultiReplayMerge to which recordings are added with #addRecording.
+     *
+     * @param archive to use for the replays.
+     * @param epochClock to use for progress checks.
+     * @param mergeProgressTimeoutMs to use for progress checks of each recording.
+     */
+    explicit MultiReplayMerge(
+        std::shared_ptr<AeronArchive> archive,
+        epoch_clock_t epochClock = aeron::currentTimeMillis,
+        std::int64_t mergeProgressTimeoutMs = REPLAY_MERGE_PROGRESS_TIMEOUT_DEFAULT_MS);
+
+    ~MultiReplayMerge();
+
+    /**
+     * Add a recording to be replayed and merged with its live stream. The arguments are as for ReplayMerge.
+     *
+     * @param subscription to use for the replay and live stream. Must be a multi-destination subscription.
+     * @param replayChannel to use for the replay.
+     * @param replayDestination to send the replay to and the destination added by the Subscription.
+     * @param liveDestination for the live stream and the destination added by the Subscription.
+     * @param recordingId for the replay.
+     * @param startPosition for the replay.
+     * @return the index of the recording which is passed to the fragment handler of #poll.
+     */
+    std::size_t addRecording(
+        std::shared_ptr<Subscription> subscription,
+        const std::string &replayChannel,
+        const std::string &replayDestination,
+        const std::string &liveDestination,
+        std::int64_t recordingId,
+        std::int64_t startPosition);
+
+    /**
+     * Process the operation of the merge for all recordings. Do not call the processing of fragments on the
+     * subscriptions.
+     *
+     * @return indication of work done processing the merge.
+     */
+    int doWork();
+
+    /**
+     * Poll the images of the recordings as part of the merge operation.
+     * <p>
+     * The fragment handler is called with the index of the recording, as returned by #addRecording, followed by
+     * the arguments of a #fragment_handler_t.
+     *
+     * @param fragmentHandler to call for fragments.
+     * @param fragmentLimit for the poll operation shared across all recordings.
+     * @return number of fragments processed.
+     */
+    template<typename F>
+    inline int poll(F &&fragmentHandler, int fragmentLimit)
+    {
+        doWork();
+
+        const std::size_t count = m_recordings.size();
+        int fragmentsRead = 0;
+
+        for (std::size_t i = 0; i < count && fragmentsRead < fragmentLimit; i++)
+        {
+            const std::size_t index = (m_pollIndex + i) % count;
+            const std::shared_ptr<Image> &image = m_recordings[index].image;
+
+            if (nullptr != image)
+            {
+                fragmentsRead += image->poll(
+                    [&](AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
+                    {
+                        fragmentHandler(index, buffer, offset, length, header);
+                    },
+                    fragmentLimit - fragmentsRead);
+            }
+        }
+
+        if (count > 0)
+        {
+            m_pollIndex = (m_pollIndex + 1) % count;
+        }
+
+        return fragmentsRead;
+    }
+
+    /**
+     * Image used for the replay and live stream of a recording.
+     *
+     * @param index of the recording as returned by #addRecording.
+     * @return the Image or nullptr if not yet available.
+     */
+    inline std::shared_ptr<Image> image(std::size_t index)
+    {
+        return m_recordings.at(index).image;
+    }
+
+    /**
+     * Is the live stream of a recording merged and the replay stopped?
+     *
+     * @param index of the recording as returned by #addRecording.
+     * @return true if the live stream is merged and the replay stopped.
+     */
+    inline bool isMerged(std::size_t index) const
+    {
+        return State::MERGED == m_recordings.at(index).state;
+    }
+
+    /**
+     * Are the live streams of all recordings merged and their replays stopped?
+     *
+     * @return true if all recordings are merged.
+     */
+    inline bool isMerged() const
+    {
+        return !m_recordings.empty() && m_mergedCount == m_recordings.size();
+    }
+
+    /**
+     * Has the merge failed due to an error on any of the recordings?
+     *
+     * @return true if the merge has failed.
+     */
+    inline bool hasFailed() const
+    {
+        return m_hasFailed;
+    }
+
+    /**
+     * Number of recordings added to the merge.
+     *
+     * @return number of recordings added to the merge.
+     */
+    inline std::size_t recordingCount() const
+    {
+        return m_recordings.size();
+    }
+
+    /**
+     * Number of recordings which have been merged with their live stream.
+     *
+     * @return number of recordings which have been merged.
+     */
+    inline std::size_t mergedCount() const
+    {
+        return m_mergedCount;
+    }
+
+    /**
+     * Length consumed across all recordings from their start positions, for reporting the progress of the merge.
+     *
+     * @return length consumed across all recordings.
+     */
+    std::int64_t replayedLength() const;
+
+    /**
+     * Length to be replayed across all recordings from their start positions to the most recent recorded
+     * positions known to the merge. Recordings whose position is not yet known do not contribute.
+     *
+     * @return length to be replayed across all recordings.
+     */
+    std::int64_t targetLength() const;
+
+private:
+    enum State : std::int8_t
+    {
+        GET_RECORDING_POSITION,
+        REPLAY,
+        CATCHUP,
+        ATTEMPT_LIVE_JOIN,
+        MERGED,
+        CLOSED
+    };
+
+    struct Recording
+    {
+        std::shared_ptr<Subscription> subscription;
+        std::string replayChannel;
+        std::string replayDestination;
+        std::string liveDestination;
+        std::int64_t recordingId;
+        std::int64_t startPosition;
+
+        State state = GET_RECORDING_POSITION;
+        std::shared_ptr<Image> image = nullptr;
+        std::int64_t activeCorrelationId = aeron::NULL_VALUE;
+        std::int64_t nextTargetPosition = aeron::NULL_VALUE;
+        std::int64_t replaySessionId = aeron::NULL_VALUE;
+        std::int64_t positionOfLastProgress = aeron::NULL_VALUE;
+        long long timeOfLastProgressMs = 0;
+        bool isStopPositionRequested = false;
+        bool isLiveAdded = false;
+        bool isReplayActive = false;
+    };
+
+    const std::shared_ptr<AeronArchive> m_archive;
+    const long long m_mergeProgressTimeoutMs;
+    epoch_clock_t m_epochClock;
+    on_control_response_t m_onResponse;
+
+    std::vector<Recording> m_recordings;
+    std::unordered_map<std::int64_t, std::size_t> m_recordingIndexByCorrelationId;
+    std::size_t m_pollIndex = 0;
+    std::size_t m_mergedCount = 0;
+    long long m_nowMs = 0;
+    bool m_hasFailed = false;
+
+    int doWork(Recording &recording, std::size_t index, long long nowMs);
+
+    int catchup(Recording &recording, long long nowMs);
+
+    void onResponse(
+        std::int64_t correlationId, std::int64_t relevantId, std::int32_t code, const std::string &errorMessage);
+
+    void onRecordingPosition(Recording &recording, std::size_t index, std::int64_t position);
+
+    void onLiveJoinPosition(Recording &recording, std::size_t index, std::int64_t position);
+
+    void sendRecordingPositionRequest(Recording &recording, std::size_t index);
+
+    void stopReplay(Recording &recording);
+
+    inline void merged(Recording &recording)
+    {
+        recording.state = State::MERGED;
+        m_mergedCount++;
+    }
+
+    inline bool shouldAddLiveDestination(const Recording &recording, std::int64_t position) const
+    {
+        return !recording.isLiveAdded &&
+            (recording.nextTargetPosition - position) <=
+                std::min(recording.image->termBufferLength() / 4, REPLAY_MERGE_LIVE_ADD_MAX_WINDOW);
+    }
+
+    inline bool shouldStopAndRemoveReplay(const Recording &recording, std::int64_t position) const
+    {
+        return recording.isLiveAdded &&
+            (recording.nextTargetPosition - position) <= REPLAY_MERGE_REPLAY_REMOVE_THRESHOLD &&
+                recording.image->activeTransportCount() >= 2;
+    }
+};
+
+}}}
+
+#endif //AERON_ARCHIVE_MULTI_REPLAY_MERGE_H
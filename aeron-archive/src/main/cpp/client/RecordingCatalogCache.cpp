@@ -0,0 +1,177 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+
+#include "RecordingCatalogCache.h"
+
+using namespace aeron;
+using namespace aeron::archive::client;
+
+static const std::vector<std::int64_t> EMPTY_RECORDING_IDS;
+
+RecordingCatalogCache::RecordingCatalogCache(std::shared_ptr<AeronArchive> archive, std::int32_t pageSize) :
+    m_archive(std::move(archive)),
+    m_pageSize(pageSize)
+{
+    if (pageSize <= 0)
+    {
+        throw util::IllegalArgumentException("pageSize must be positive: " + std::to_string(pageSize), SOURCEINFO);
+    }
+}
+
+const CachedRecordingDescriptor *RecordingCatalogCache::findByRecordingId(std::int64_t recordingId) const
+{
+    auto it = m_recordingsById.find(recordingId);
+
+    return m_recordingsById.end() != it ? &it->second : nullptr;
+}
+
+const std::vector<std::int64_t> &RecordingCatalogCache::findByChannelAndStream(
+    const std::string &channel, std::int32_t streamId) const
+{
+    auto it = m_recordingIdsByChannel.find(ChannelStreamKey{ channel, streamId });
+
+    return m_recordingIdsByChannel.end() != it ? it->second : EMPTY_RECORDING_IDS;
+}
+
+const CachedRecordingDescriptor *RecordingCatalogCache::findLastMatching(
+    const std::string &channel, std::int32_t streamId) const
+{
+    const std::vector<std::int64_t> &recordingIds = findByChannelAndStream(channel, streamId);
+
+    return recordingIds.empty() ? nullptr : findByRecordingId(recordingIds.back());
+}
+
+void RecordingCatalogCache::onRecordingStart(
+    std::int64_t recordingId,
+    std::int64_t startPosition,
+    std::int32_t sessionId,
+    std::int32_t streamId,
+    const std::string &channel,
+    const std::string &sourceIdentity)
+{
+    auto it = m_recordingsById.find(recordingId);
+    if (m_recordingsById.end() == it)
+    {
+        markStale(recordingId);
+    }
+    else
+    {
+        it->second.stopPosition = NULL_POSITION;
+        it->second.stopTimestamp = aeron::NULL_VALUE;
+    }
+}
+
+void RecordingCatalogCache::onRecordingProgress(
+    std::int64_t recordingId, std::int64_t startPosition, std::int64_t position)
+{
+    if (m_recordingsById.end() == m_recordingsById.find(recordingId))
+    {
+        markStale(recordingId);
+    }
+}
+
+void RecordingCatalogCache::onRecordingStop(
+    std::int64_t recordingId, std::int64_t startPosition, std::int64_t stopPosition)
+{
+    auto it = m_recordingsById.find(recordingId);
+    if (m_recordingsById.end() == it)
+    {
+        markStale(recordingId);
+    }
+    else
+    {
+        it->second.stopPosition = stopPosition;
+    }
+}
+
+void RecordingCatalogCache::onRecordingSignal(
+    std::int64_t controlSessionId,
+    std::int64_t recordingId,
+    std::int64_t subscriptionId,
+    std::int64_t position,
+    RecordingSignal::Value signal)
+{
+    auto it = m_recordingsById.find(recordingId);
+    if (m_recordingsById.end() == it)
+    {
+        markStale(recordingId);
+        return;
+    }
+
+    switch (signal)
+    {
+        case RecordingSignal::Value::START:
+        case RecordingSignal::Value::EXTEND:
+            it->second.stopPosition = NULL_POSITION;
+            it->second.stopTimestamp = aeron::NULL_VALUE;
+            break;
+
+        case RecordingSignal::Value::STOP:
+            it->second.stopPosition = position;
+            break;
+
+        default:
+            markStale(recordingId);
+            break;
+    }
+}
+
+std::unique_ptr<RecordingEventsAdapter> RecordingCatalogCache::newRecordingEventsAdapter(
+    std::shared_ptr<Subscription> subscription, int fragmentLimit)
+{
+    using namespace std::placeholders;
+
+    return std::unique_ptr<RecordingEventsAdapter>(new RecordingEventsAdapter(
+        std::bind(&RecordingCatalogCache::onRecordingStart, this, _1, _2, _3, _4, _5, _6),
+        std::bind(&RecordingCatalogCache::onRecordingProgress, this, _1, _2, _3),
+        std::bind(&RecordingCatalogCache::onRecordingStop, this, _1, _2, _3),
+        std::move(subscription),
+        fragmentLimit));
+}
+
+void RecordingCatalogCache::put(CachedRecordingDescriptor &&descriptor)
+{
+    const std::int64_t recordingId = descriptor.recordingId;
+
+    if (m_recordingsById.end() == m_recordingsById.find(recordingId))
+    {
+        index(descriptor.strippedChannel, descriptor.streamId, recordingId);
+        if (descriptor.originalChannel != descriptor.strippedChannel)
+        {
+            index(descriptor.originalChannel, descriptor.streamId, recordingId);
+        }
+    }
+
+    m_recordingsById[recordingId] = std::move(descriptor);
+    m_nextRecordingId = std::max(m_nextRecordingId, recordingId + 1);
+}
+
+void RecordingCatalogCache::index(const std::string &channel, std::int32_t streamId, std::int64_t recordingId)
+{
+    std::vector<std::int64_t> &recordingIds = m_recordingIdsByChannel[ChannelStreamKey{ channel, streamId }];
+
+    recordingIds.insert(std::upper_bound(recordingIds.begin(), recordingIds.end(), recordingId), recordingId);
+}
+
+void RecordingCatalogCache::markStale(std::int64_t recordingId)
+{
+    if (recordingId < m_nextRecordingId)
+    {
+        m_staleRecordingIds.insert(recordingId);
+    }
+}
@@ -0,0 +1,258 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef AERON_ARCHIVE_RECORDING_CATALOG_CACHE_H
+#define AERON_ARCHIVE_RECORDING_CATALOG_CACHE_H
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "AeronArchive.h"
+#include "RecordingEventsAdapter.h"
+#include "RecordingSignalAdapter.h"
+
+namespace aeron { namespace archive { namespace client
+{
+
+/**
+ * Copy of a recording descriptor held by the RecordingCatalogCache.
+ */
+struct CachedRecordingDescriptor
+{
+    std::int64_t recordingId;
+    std::int64_t startTimestamp;
+    std::int64_t stopTimestamp;
+    std::int64_t startPosition;
+    std::int64_t stopPosition;
+    std::int32_t initialTermId;
+    std::int32_t segmentFileLength;
+    std::int32_t termBufferLength;
+    std::int32_t mtuLength;
+    std::int32_t sessionId;
+    std::int32_t streamId;
+    std::string strippedChannel;
+    std::string originalChannel;
+    std::string sourceIdentity;
+};
+
+/**
+ * Client side cache of the recording catalog of an archive which allows recordings to be looked up by recording id
+ * or by channel and stream id without a round trip to the archive.
+ * <p>
+ * The cache is populated incrementally by #refresh which only requests descriptors for recordings that have not
+ * been seen before, or which events have marked as stale. Recording events and recording signals should be fed to
+ * the cache, e.g. via #newRecordingEventsAdapter or by calling #onRecordingSignal from a RecordingSignalAdapter,
+ * so that the stop position of known recordings is kept current and new recordings are picked up on the next
+ * #refresh.
+ * <p>
+ * Channel lookups are exact matches on the stripped or original channel of the descriptor rather than the
+ * contains match of AeronArchive::listRecordingsForUri.
+ * <p>
+ * Not thread safe.
+ */
+class RecordingCatalogCache
+{
+public:
+    /**
+     * Create a cache over the catalog of the archive. The cache is empty until #refresh is called.
+     *
+     * @param archive  to query for recording descriptors.
+     * @param pageSize for the number of descriptors to request in each list recordings request.
+     */
+    explicit RecordingCatalogCache(std::shared_ptr<AeronArchive> archive, std::int32_t pageSize = 100);
+
+    /**
+     * Request descriptors for recordings which are new since the last refresh and for recordings which have been
+     * marked as stale by events.
+     *
+     * @tparam IdleStrategy to use for polling operations.
+     * @return the number of descriptors loaded into the cache.
+     */
+    template<typename IdleStrategy = aeron::concurrent::BackoffIdleStrategy>
+    std::int32_t refresh()
+    {
+        std::int32_t loaded = 0;
+        const recording_descriptor_consumer_t consumer =
+            [&](
+                std::int64_t controlSessionId,
+                std::int64_t correlationId,
+                std::int64_t recordingId,
+                std::int64_t startTimestamp,
+                std::int64_t stopTimestamp,
+                std::int64_t startPosition,
+                std::int64_t stopPosition,
+                std::int32_t initialTermId,
+                std::int32_t segmentFileLength,
+                std::int32_t termBufferLength,
+                std::int32_t mtuLength,
+                std::int32_t sessionId,
+                std::int32_t streamId,
+                const std::string &strippedChannel,
+                const std::string &originalChannel,
+                const std::string &sourceIdentity)
+            {
+                put(CachedRecordingDescriptor{
+                    recordingId,
+                    startTimestamp,
+                    stopTimestamp,
+                    startPosition,
+                    stopPosition,
+                    initialTermId,
+                    segmentFileLength,
+                    termBufferLength,
+                    mtuLength,
+                    sessionId,
+                    streamId,
+                    strippedChannel,
+                    originalChannel,
+                    sourceIdentity });
+                loaded++;
+            };
+
+        std::int32_t count;
+        do
+        {
+            count = m_archive->listRecordings<IdleStrategy>(m_nextRecordingId, m_pageSize, consumer);
+        }
+        while (count >= m_pageSize);
+
+        for (const std::int64_t recordingId : m_staleRecordingIds)
+        {
+            if (recordingId < m_nextRecordingId)
+            {
+                m_archive->listRecording<IdleStrategy>(recordingId, consumer);
+            }
+        }
+        m_staleRecordingIds.clear();
+
+        return loaded;
+    }
+
+    /**
+     * Find a recording by its id.
+     *
+     * @param recordingId of the recording.
+     * @return the cached descriptor or nullptr if the recording is not in the cache.
+     */
+    const CachedRecordingDescriptor *findByRecordingId(std::int64_t recordingId) const;
+
+    /**
+     * Find the recordings of a channel and stream id in ascending recording id order.
+     *
+     * @param channel  which is matched exactly against the stripped or original channel of the recordings.
+     * @param streamId of the recordings.
+     * @return the ids of the matching recordings which may be empty.
+     */
+    const std::vector<std::int64_t> &findByChannelAndStream(const std::string &channel, std::int32_t streamId) const;
+
+    /**
+     * Find the last recording, i.e. with the highest recording id, of a channel and stream id.
+     *
+     * @param channel  which is matched exactly against the stripped or original channel of the recordings.
+     * @param streamId of the recordings.
+     * @return the cached descriptor or nullptr if there is no matching recording in the cache.
+     */
+    const CachedRecordingDescriptor *findLastMatching(const std::string &channel, std::int32_t streamId) const;
+
+    /**
+     * Number of recordings held in the cache.
+     *
+     * @return number of recordings held in the cache.
+     */
+    inline std::size_t size() const
+    {
+        return m_recordingsById.size();
+    }
+
+    /**
+     * Handle a recording started event. Has the signature of #on_recording_start_t.
+     */
+    void onRecordingStart(
+        std::int64_t recordingId,
+        std::int64_t startPosition,
+        std::int32_t sessionId,
+        std::int32_t streamId,
+        const std::string &channel,
+        const std::string &sourceIdentity);
+
+    /**
+     * Handle a recording progress event. Has the signature of #on_recording_event_t.
+     */
+    void onRecordingProgress(std::int64_t recordingId, std::int64_t startPosition, std::int64_t position);
+
+    /**
+     * Handle a recording stopped event. Has the signature of #on_recording_event_t.
+     */
+    void onRecordingStop(std::int64_t recordingId, std::int64_t startPosition, std::int64_t stopPosition);
+
+    /**
+     * Handle a recording signal. Has the signature of #on_recording_signal_t.
+     */
+    void onRecordingSignal(
+        std::int64_t controlSessionId,
+        std::int64_t recordingId,
+        std::int64_t subscriptionId,
+        std::int64_t position,
+        RecordingSignal::Value signal);
+
+    /**
+     * Create a RecordingEventsAdapter which dispatches recording events to this cache. The cache must outlive the
+     * adapter.
+     *
+     * @param subscription  to the recording events channel of the archive.
+     * @param fragmentLimit to apply for each polling operation.
+     * @return a new adapter bound to this cache.
+     */
+    std::unique_ptr<RecordingEventsAdapter> newRecordingEventsAdapter(
+        std::shared_ptr<Subscription> subscription, int fragmentLimit = 10);
+
+private:
+    struct ChannelStreamKey
+    {
+        std::string channel;
+        std::int32_t streamId;
+
+        inline bool operator==(const ChannelStreamKey &other) const
+        {
+            return streamId == other.streamId && channel == other.channel;
+        }
+    };
+
+    struct ChannelStreamKeyHash
+    {
+        inline std::size_t operator()(const ChannelStreamKey &key) const
+        {
+            return std::hash<std::string>()(key.channel) * 31u + static_cast<std::size_t>(key.streamId);
+        }
+    };
+
+    void put(CachedRecordingDescriptor &&descriptor);
+    void index(const std::string &channel, std::int32_t streamId, std::int64_t recordingId);
+    void markStale(std::int64_t recordingId);
+
+    std::shared_ptr<AeronArchive> m_archive;
+    const std::int32_t m_pageSize;
+    std::int64_t m_nextRecordingId = 0;
+    std::unordered_map<std::int64_t, CachedRecordingDescriptor> m_recordingsById;
+    std::unordered_map<ChannelStreamKey, std::vector<std::int64_t>, ChannelStreamKeyHash> m_recordingIdsByChannel;
+    std::unordered_set<std::int64_t> m_staleRecordingIds;
+};
+
+}}}
+
+#endif //AERON_ARCHIVE_RECORDING_CATALOG_CACHE_H
@@ -17,6 +17,7 @@
 #define AERON_ARCHIVE_RECORDING_POS_H
 
 #include "Aeron.h"
+#include "concurrent/CountersIndex.h"
 
 namespace aeron { namespace archive { namespace client
 {
@@ -118,6 +119,42 @@ inline static std::int32_t findCounterIdBySessionId(CountersReader &countersRead
     return CountersReader::NULL_COUNTER_ID;
 }
 
+/**
+ * Find the active counter id for a stream based on the recording id using an index of the counters rather than
+ * scanning them all.
+ *
+ * @param countersIndex to search within.
+ * @param recordingId   for the active recording.
+ * @return the counter id if found otherwise #NULL_COUNTER_ID.
+ */
+inline static std::int32_t findCounterIdByRecordingId(CountersIndex &countersIndex, std::int64_t recordingId)
+{
+    return countersIndex.findByTypeId(
+        RECORDING_POSITION_TYPE_ID,
+        [&](std::int32_t, const AtomicBuffer &keyBuffer)
+        {
+            return keyBuffer.overlayStruct<RecordingPosKeyDefn>(0).recordingId == recordingId;
+        });
+}
+
+/**
+ * Find the active counter id for a stream based on the session id using an index of the counters rather than
+ * scanning them all.
+ *
+ * @param countersIndex to search within.
+ * @param sessionId     for the active recording.
+ * @return the counter id if found otherwise #NULL_COUNTER_ID.
+ */
+inline static std::int32_t findCounterIdBySessionId(CountersIndex &countersIndex, std::int32_t sessionId)
+{
+    return countersIndex.findByTypeId(
+        RECORDING_POSITION_TYPE_ID,
+        [&](std::int32_t, const AtomicBuffer &keyBuffer)
+        {
+            return keyBuffer.overlayStruct<RecordingPosKeyDefn>(0).sessionId == sessionId;
+        });
+}
+
 /**
  * Get the recording id for a given counter id.
  *
@@ -86,14 +86,28 @@ int ReplayMerge::getRecordingPosition(long long nowMs)
 
     if (aeron::NULL_VALUE == m_activeCorrelationId)
     {
-        const std::int64_t correlationId = m_archive->context().aeron()->nextCorrelationId();
+        std::int64_t recordingPosition;
 
-        if (m_archive->archiveProxy().getRecordingPosition(m_recordingId, correlationId, m_archive->controlSessionId()))
+        if (readRecordingPositionCounter(recordingPosition))
         {
+            m_nextTargetPosition = recordingPosition;
             m_timeOfLastProgressMs = nowMs;
-            m_activeCorrelationId = correlationId;
+            state(State::REPLAY);
             workCount += 1;
         }
+        else
+        {
+            const std::int64_t correlationId = m_archive->context().aeron()->nextCorrelationId();
+
+            if (m_archive->archiveProxy().getRecordingPosition(
+                m_recordingId, correlationId, m_archive->controlSessionId()))
+            {
+                m_timeOfLastProgressMs = nowMs;
+                m_activeCorrelationId = correlationId;
+                m_controlRequestCount++;
+                workCount += 1;
+            }
+        }
     }
     else if (pollForResponse(*m_archive, m_activeCorrelationId))
     {
@@ -108,6 +122,7 @@ int ReplayMerge::getRecordingPosition(long long nowMs)
             {
                 m_timeOfLastProgressMs = nowMs;
                 m_activeCorrelationId = correlationId;
+                m_controlRequestCount++;
                 workCount += 1;
             }
         }
@@ -145,6 +160,7 @@ int ReplayMerge::replay(long long nowMs)
         {
             m_timeOfLastProgressMs = nowMs;
             m_activeCorrelationId = correlationId;
+            m_controlRequestCount++;
             workCount += 1;
         }
     }
@@ -203,13 +219,26 @@ int ReplayMerge::attemptLiveJoin(long long nowMs)
 
     if (aeron::NULL_VALUE == m_activeCorrelationId)
     {
-        const std::int64_t correlationId = m_archive->context().aeron()->nextCorrelationId();
+        std::int64_t recordingPosition;
 
-        if (m_archive->archiveProxy().getRecordingPosition(m_recordingId, correlationId, m_archive->controlSessionId()))
+        if (readRecordingPositionCounter(recordingPosition))
         {
-            m_activeCorrelationId = correlationId;
+            m_nextTargetPosition = recordingPosition;
+            joinLive(nowMs);
             workCount += 1;
         }
+        else
+        {
+            const std::int64_t correlationId = m_archive->context().aeron()->nextCorrelationId();
+
+            if (m_archive->archiveProxy().getRecordingPosition(
+                m_recordingId, correlationId, m_archive->controlSessionId()))
+            {
+                m_activeCorrelationId = correlationId;
+                m_controlRequestCount++;
+                workCount += 1;
+            }
+        }
     }
     else if (pollForResponse(*m_archive, m_activeCorrelationId))
     {
@@ -224,34 +253,12 @@ int ReplayMerge::attemptLiveJoin(long long nowMs)
                 m_recordingId, correlationId, m_archive->controlSessionId()))
             {
                 m_activeCorrelationId = correlationId;
+                m_controlRequestCount++;
             }
         }
         else
         {
-            State nextState = State::CATCHUP;
-
-            if (nullptr != m_image)
-            {
-                const std::int64_t position = m_image->position();
-
-                if (shouldAddLiveDestination(position))
-                {
-                    m_subscription->addDestination(m_liveDestination);
-                    m_timeOfLastProgressMs = nowMs;
-                    m_positionOfLastProgress = position;
-                    m_isLiveAdded = true;
-                }
-                else if (shouldStopAndRemoveReplay(position))
-                {
-                    m_subscription->removeDestination(m_replayDestination);
-                    stopReplay();
-                    m_timeOfLastProgressMs = nowMs;
-                    m_positionOfLastProgress = position;
-                    nextState = State::MERGED;
-                }
-            }
-
-            state(nextState);
+            joinLive(nowMs);
         }
 
         workCount += 1;
@@ -260,12 +267,69 @@ int ReplayMerge::attemptLiveJoin(long long nowMs)
     return workCount;
 }
 
+void ReplayMerge::joinLive(long long nowMs)
+{
+    State nextState = State::CATCHUP;
+
+    if (nullptr != m_image)
+    {
+        const std::int64_t position = m_image->position();
+
+        if (shouldAddLiveDestination(position))
+        {
+            m_subscription->addDestination(m_liveDestination);
+            m_timeOfLastProgressMs = nowMs;
+            m_positionOfLastProgress = position;
+            m_isLiveAdded = true;
+        }
+        else if (shouldStopAndRemoveReplay(position))
+        {
+            m_subscription->removeDestination(m_replayDestination);
+            stopReplay();
+            m_timeOfLastProgressMs = nowMs;
+            m_positionOfLastProgress = position;
+            nextState = State::MERGED;
+        }
+    }
+
+    state(nextState);
+}
+
+bool ReplayMerge::readRecordingPositionCounter(std::int64_t &position)
+{
+    CountersReader &countersReader = m_archive->context().aeron()->countersReader();
+
+    if (!m_isRecordingPositionCounterSearched)
+    {
+        m_recordingPositionCounterId = RecordingPos::findCounterIdByRecordingId(countersReader, m_recordingId);
+        m_isRecordingPositionCounterSearched = true;
+    }
+
+    if (CountersReader::NULL_COUNTER_ID == m_recordingPositionCounterId)
+    {
+        return false;
+    }
+
+    position = countersReader.getCounterValue(m_recordingPositionCounterId);
+
+    if (!RecordingPos::isActive(countersReader, m_recordingPositionCounterId, m_recordingId))
+    {
+        m_recordingPositionCounterId = CountersReader::NULL_COUNTER_ID;
+        return false;
+    }
+
+    m_positionCounterReadCount++;
+
+    return true;
+}
+
 void ReplayMerge::stopReplay()
 {
     const std::int64_t correlationId = m_archive->context().aeron()->nextCorrelationId();
 
     if (m_archive->archiveProxy().stopReplay(m_replaySessionId, correlationId, m_archive->controlSessionId()))
     {
+        m_controlRequestCount++;
         m_isReplayActive = false;
     }
 }
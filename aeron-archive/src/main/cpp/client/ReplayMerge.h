@@ -17,6 +17,7 @@
 #define AERON_ARCHIVE_REPLAY_MERGE_H
 
 #include "AeronArchive.h"
+#include "RecordingPos.h"
 
 namespace aeron { namespace archive { namespace client
 {
@@ -24,6 +25,7 @@ namespace aeron { namespace archive { namespace client
 constexpr const std::int32_t REPLAY_MERGE_LIVE_ADD_MAX_WINDOW = 32 * 1024 * 1024;
 constexpr const std::int32_t REPLAY_MERGE_REPLAY_REMOVE_THRESHOLD = 0;
 constexpr const std::int64_t REPLAY_MERGE_PROGRESS_TIMEOUT_DEFAULT_MS = 10 * 1000;
+constexpr const std::int32_t REPLAY_MERGE_CATCHUP_FRAGMENT_LIMIT_MAX_SCALE = 16;
 
 /**
  * Replay a recorded stream from a starting position and merge with live stream to consume a full history of a stream.
@@ -34,6 +36,13 @@ constexpr const std::int64_t REPLAY_MERGE_PROGRESS_TIMEOUT_DEFAULT_MS = 10 * 100
  * parent Subscription. If an exception occurs or progress stops, the merge will fail and
  * #hasErrored() will be true.
  * <p>
+ * While the replay is further behind the recording than the window for adding the live destination the fragment
+ * limit passed to #poll is scaled up, to at most #REPLAY_MERGE_CATCHUP_FRAGMENT_LIMIT_MAX_SCALE times, so that
+ * catch up can converge on a recording which is progressing under load. When the recording position counter of
+ * an active recording is visible via the CountersReader of the client, i.e. the archive shares the media driver,
+ * the recorded position is read from the counter rather than requested from the archive on each attempt to join
+ * the live stream.
+ * <p>
  * NOTE: Merging is only supported with UDP streams.
  */
 class ReplayMerge
@@ -125,7 +134,30 @@ public:
     inline int poll(F &&fragmentHandler, int fragmentLimit)
     {
         doWork();
-        return nullptr == m_image ? 0 : m_image->poll(fragmentHandler, fragmentLimit);
+        return nullptr == m_image ? 0 : m_image->poll(fragmentHandler, catchupFragmentLimit(fragmentLimit));
+    }
+
+    /**
+     * The fragment limit to be used when polling the Image given the limit requested. This is scaled up while the
+     * replay is far behind the recording and is otherwise the requested limit.
+     *
+     * @param fragmentLimit requested for a poll.
+     * @return the fragment limit to use for the poll.
+     */
+    inline int catchupFragmentLimit(int fragmentLimit) const
+    {
+        if (State::MERGED == m_state || nullptr == m_image || aeron::NULL_VALUE == m_nextTargetPosition)
+        {
+            return fragmentLimit;
+        }
+
+        const std::int64_t window = std::min(m_image->termBufferLength() / 4, REPLAY_MERGE_LIVE_ADD_MAX_WINDOW);
+        const std::int64_t scale = std::min<std::int64_t>(
+            (m_nextTargetPosition - m_image->position()) / window, REPLAY_MERGE_CATCHUP_FRAGMENT_LIMIT_MAX_SCALE);
+
+        return scale > 1 ?
+            static_cast<int>(std::min<std::int64_t>(fragmentLimit * scale, std::numeric_limits<int>::max())) :
+            fragmentLimit;
     }
 
     /**
@@ -168,6 +200,47 @@ public:
         return m_isLiveAdded;
     }
 
+    /**
+     * The recorded position which the replay is catching up to, or #NULL_POSITION if not yet known.
+     *
+     * @return the recorded position which the replay is catching up to.
+     */
+    inline std::int64_t targetPosition() const
+    {
+        return m_nextTargetPosition;
+    }
+
+    /**
+     * The position of the Image at the last progress of the merge, or #NULL_POSITION if not yet known.
+     *
+     * @return position of the Image at the last progress of the merge.
+     */
+    inline std::int64_t positionOfLastProgress() const
+    {
+        return m_positionOfLastProgress;
+    }
+
+    /**
+     * Number of control requests sent to the archive by the merge.
+     *
+     * @return number of control requests sent to the archive.
+     */
+    inline std::int64_t controlRequestCount() const
+    {
+        return m_controlRequestCount;
+    }
+
+    /**
+     * Number of times the recorded position was read from the recording position counter rather than requested
+     * from the archive.
+     *
+     * @return number of reads of the recording position counter.
+     */
+    inline std::int64_t positionCounterReadCount() const
+    {
+        return m_positionCounterReadCount;
+    }
+
 private:
     enum State : std::int8_t
     {
@@ -196,7 +269,11 @@ private:
     std::int64_t m_nextTargetPosition = aeron::NULL_VALUE;
     std::int64_t m_replaySessionId = aeron::NULL_VALUE;
     std::int64_t m_positionOfLastProgress = aeron::NULL_VALUE;
+    std::int64_t m_controlRequestCount = 0;
+    std::int64_t m_positionCounterReadCount = 0;
+    std::int32_t m_recordingPositionCounterId = CountersReader::NULL_COUNTER_ID;
     long long m_timeOfLastProgressMs = 0;
+    bool m_isRecordingPositionCounterSearched = false;
     bool m_isLiveAdded = false;
     bool m_isReplayActive = false;
 
@@ -228,6 +305,10 @@ private:
 
     int attemptLiveJoin(long long nowMs);
 
+    void joinLive(long long nowMs);
+
+    bool readRecordingPositionCounter(std::int64_t &position);
+
     inline bool hasProgressStalled(long long nowMs)
     {
         return nowMs > (m_timeOfLastProgressMs + m_mergeProgressTimeoutMs);
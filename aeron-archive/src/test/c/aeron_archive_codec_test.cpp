@@ -0,0 +1,316 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "aeron_archive_codecs.h"
+#include "aeron_archive_control_response_poller.h"
+#include "aeron_archive_recording_descriptor_poller.h"
+}
+
+#define CONTROL_SESSION_ID (7)
+#define CORRELATION_ID (42)
+
+class ArchiveCodecTest : public testing::Test
+{
+public:
+    ArchiveCodecTest()
+    {
+        m_buffer.fill(0);
+    }
+
+protected:
+    template<typename T>
+    static T get(const uint8_t *buffer, size_t offset)
+    {
+        T value;
+        std::memcpy(&value, buffer + offset, sizeof(T));
+        return value;
+    }
+
+    template<typename T>
+    static void put(std::vector<uint8_t> &message, T value)
+    {
+        const auto *bytes = reinterpret_cast<const uint8_t *>(&value);
+        message.insert(message.end(), bytes, bytes + sizeof(T));
+    }
+
+    static void putString(std::vector<uint8_t> &message, const std::string &value)
+    {
+        put<uint32_t>(message, static_cast<uint32_t>(value.length()));
+        message.insert(message.end(), value.begin(), value.end());
+    }
+
+    static std::vector<uint8_t> header(uint16_t blockLength, uint16_t templateId)
+    {
+        std::vector<uint8_t> message;
+        put<uint16_t>(message, blockLength);
+        put<uint16_t>(message, templateId);
+        put<uint16_t>(message, AERON_ARCHIVE_SCHEMA_ID);
+        put<uint16_t>(message, AERON_ARCHIVE_SCHEMA_VERSION);
+        return message;
+    }
+
+    static std::vector<uint8_t> controlResponse(
+        int64_t controlSessionId, int64_t correlationId, int64_t relevantId, int32_t code, const std::string &error)
+    {
+        std::vector<uint8_t> message = header(
+            AERON_ARCHIVE_CONTROL_RESPONSE_BLOCK_LENGTH, AERON_ARCHIVE_CONTROL_RESPONSE_TEMPLATE_ID);
+        put<int64_t>(message, controlSessionId);
+        put<int64_t>(message, correlationId);
+        put<int64_t>(message, relevantId);
+        put<int32_t>(message, code);
+        put<int32_t>(message, AERON_ARCHIVE_PROTOCOL_SEMANTIC_VERSION);
+        putString(message, error);
+        return message;
+    }
+
+    static std::vector<uint8_t> recordingDescriptor(int64_t correlationId, int64_t recordingId)
+    {
+        std::vector<uint8_t> message = header(
+            AERON_ARCHIVE_RECORDING_DESCRIPTOR_BLOCK_LENGTH, AERON_ARCHIVE_RECORDING_DESCRIPTOR_TEMPLATE_ID);
+        put<int64_t>(message, CONTROL_SESSION_ID);
+        put<int64_t>(message, correlationId);
+        put<int64_t>(message, recordingId);
+        put<int64_t>(message, 1000);
+        put<int64_t>(message, 2000);
+        put<int64_t>(message, 0);
+        put<int64_t>(message, 4096);
+        put<int32_t>(message, 5);
+        put<int32_t>(message, 128 * 1024 * 1024);
+        put<int32_t>(message, 64 * 1024);
+        put<int32_t>(message, 1408);
+        put<int32_t>(message, 99);
+        put<int32_t>(message, 1001);
+        putString(message, "aeron:udp?endpoint=localhost:3333");
+        putString(message, "aeron:udp?endpoint=localhost:3333|term-length=64k");
+        putString(message, "127.0.0.1:4444");
+        return message;
+    }
+
+    static void onDescriptor(aeron_archive_recording_descriptor_t *descriptor, void *clientd)
+    {
+        auto *test = static_cast<ArchiveCodecTest *>(clientd);
+        test->m_recordingIds.push_back(descriptor->recording_id);
+        test->m_channels.emplace_back(descriptor->stripped_channel, descriptor->stripped_channel_length);
+    }
+
+    static void onError(void *clientd, int errcode, const char *message)
+    {
+        auto *test = static_cast<ArchiveCodecTest *>(clientd);
+        test->m_errors.emplace_back(message);
+    }
+
+    std::array<uint8_t, 1024> m_buffer = {};
+    std::vector<int64_t> m_recordingIds;
+    std::vector<std::string> m_channels;
+    std::vector<std::string> m_errors;
+};
+
+TEST_F(ArchiveCodecTest, shouldEncodeStartRecordingRequest)
+{
+    const std::string channel = "aeron:udp?endpoint=localhost:3333";
+
+    int length = aeron_archive_encode_start_recording_request(
+        m_buffer.data(),
+        m_buffer.size(),
+        CONTROL_SESSION_ID,
+        CORRELATION_ID,
+        1001,
+        AERON_ARCHIVE_SOURCE_LOCATION_REMOTE,
+        channel.c_str());
+
+    ASSERT_EQ(length, (int)(AERON_ARCHIVE_MESSAGE_HEADER_LENGTH + 24 + 4 + channel.length()));
+
+    aeron_archive_message_header_t header;
+    ASSERT_EQ(aeron_archive_decode_message_header(&header, m_buffer.data(), (size_t)length), 0);
+    EXPECT_EQ(header.block_length, 24);
+    EXPECT_EQ(header.template_id, AERON_ARCHIVE_START_RECORDING_REQUEST_TEMPLATE_ID);
+    EXPECT_EQ(header.schema_id, AERON_ARCHIVE_SCHEMA_ID);
+    EXPECT_EQ(header.version, AERON_ARCHIVE_SCHEMA_VERSION);
+
+    const uint8_t *body = m_buffer.data() + AERON_ARCHIVE_MESSAGE_HEADER_LENGTH;
+    EXPECT_EQ(get<int64_t>(body, 0), CONTROL_SESSION_ID);
+    EXPECT_EQ(get<int64_t>(body, 8), CORRELATION_ID);
+    EXPECT_EQ(get<int32_t>(body, 16), 1001);
+    EXPECT_EQ(get<int32_t>(body, 20), AERON_ARCHIVE_SOURCE_LOCATION_REMOTE);
+    EXPECT_EQ(get<uint32_t>(body, 24), channel.length());
+    EXPECT_EQ(std::string(reinterpret_cast<const char *>(body + 28), channel.length()), channel);
+}
+
+TEST_F(ArchiveCodecTest, shouldEncodeAuthConnectRequestWithCredentials)
+{
+    const std::string channel = "aeron:udp?endpoint=localhost:8020";
+    const uint8_t credentials[] = { 'a', 'b', 'c' };
+
+    int length = aeron_archive_encode_auth_connect_request(
+        m_buffer.data(), m_buffer.size(), CORRELATION_ID, 20, channel.c_str(), credentials, sizeof(credentials));
+
+    ASSERT_EQ(length, (int)(AERON_ARCHIVE_MESSAGE_HEADER_LENGTH + 16 + 4 + channel.length() + 4 + 3));
+
+    const uint8_t *body = m_buffer.data() + AERON_ARCHIVE_MESSAGE_HEADER_LENGTH;
+    EXPECT_EQ(get<uint16_t>(m_buffer.data(), 2), AERON_ARCHIVE_AUTH_CONNECT_REQUEST_TEMPLATE_ID);
+    EXPECT_EQ(get<int64_t>(body, 0), CORRELATION_ID);
+    EXPECT_EQ(get<int32_t>(body, 8), 20);
+    EXPECT_EQ(get<int32_t>(body, 12), AERON_ARCHIVE_PROTOCOL_SEMANTIC_VERSION);
+    EXPECT_EQ(get<uint32_t>(body, 16 + 4 + channel.length()), 3u);
+    EXPECT_EQ(0, std::memcmp(body + 16 + 4 + channel.length() + 4, credentials, sizeof(credentials)));
+}
+
+TEST_F(ArchiveCodecTest, shouldFailToEncodeWhenBufferTooSmall)
+{
+    const std::string channel(200, 'x');
+
+    EXPECT_EQ(-1, aeron_archive_encode_replay_request(
+        m_buffer.data(), 64, CONTROL_SESSION_ID, CORRELATION_ID, 1, 0, INT64_MAX, 1002, channel.c_str()));
+}
+
+TEST_F(ArchiveCodecTest, shouldCompleteControlResponsePollOnResponse)
+{
+    aeron_archive_control_response_poller_t poller;
+    ASSERT_EQ(aeron_archive_control_response_poller_init(&poller, nullptr, 10), 0);
+
+    std::vector<uint8_t> response = controlResponse(
+        CONTROL_SESSION_ID, CORRELATION_ID, 3, AERON_ARCHIVE_CONTROL_RESPONSE_CODE_ERROR, "unknown recording");
+
+    EXPECT_EQ(AERON_ACTION_BREAK, aeron_archive_control_response_poller_on_fragment(
+        &poller, response.data(), response.size(), nullptr));
+    EXPECT_TRUE(poller.is_poll_complete);
+    EXPECT_TRUE(poller.is_code_error);
+    EXPECT_FALSE(poller.is_code_ok);
+    EXPECT_EQ(poller.control_session_id, CONTROL_SESSION_ID);
+    EXPECT_EQ(poller.correlation_id, CORRELATION_ID);
+    EXPECT_EQ(poller.relevant_id, 3);
+    EXPECT_EQ(poller.template_id, AERON_ARCHIVE_CONTROL_RESPONSE_TEMPLATE_ID);
+    EXPECT_STREQ(poller.error_message, "unknown recording");
+
+    EXPECT_EQ(AERON_ACTION_ABORT, aeron_archive_control_response_poller_on_fragment(
+        &poller, response.data(), response.size(), nullptr));
+
+    aeron_archive_control_response_poller_close(&poller);
+}
+
+TEST_F(ArchiveCodecTest, shouldSkipMessagesOtherThanResponsesAndChallenges)
+{
+    aeron_archive_control_response_poller_t poller;
+    ASSERT_EQ(aeron_archive_control_response_poller_init(&poller, nullptr, 10), 0);
+
+    std::vector<uint8_t> descriptor = recordingDescriptor(CORRELATION_ID, 1);
+
+    EXPECT_EQ(AERON_ACTION_CONTINUE, aeron_archive_control_response_poller_on_fragment(
+        &poller, descriptor.data(), descriptor.size(), nullptr));
+    EXPECT_FALSE(poller.is_poll_complete);
+
+    aeron_archive_control_response_poller_close(&poller);
+}
+
+TEST_F(ArchiveCodecTest, shouldDispatchDescriptorsUntilRecordingUnknown)
+{
+    aeron_archive_recording_descriptor_poller_t poller;
+    ASSERT_EQ(aeron_archive_recording_descriptor_poller_init(
+        &poller, nullptr, CONTROL_SESSION_ID, 10, onError, this), 0);
+    aeron_archive_recording_descriptor_poller_reset(&poller, CORRELATION_ID, 10, onDescriptor, this);
+
+    std::vector<uint8_t> first = recordingDescriptor(CORRELATION_ID, 1);
+    std::vector<uint8_t> other = recordingDescriptor(CORRELATION_ID + 1, 2);
+    std::vector<uint8_t> second = recordingDescriptor(CORRELATION_ID, 3);
+    std::vector<uint8_t> otherError = controlResponse(
+        CONTROL_SESSION_ID, CORRELATION_ID - 1, 0, AERON_ARCHIVE_CONTROL_RESPONSE_CODE_ERROR, "old request");
+    std::vector<uint8_t> unknown = controlResponse(
+        CONTROL_SESSION_ID, CORRELATION_ID, 4, AERON_ARCHIVE_CONTROL_RESPONSE_CODE_RECORDING_UNKNOWN, "");
+
+    EXPECT_EQ(AERON_ACTION_CONTINUE, aeron_archive_recording_descriptor_poller_on_fragment(
+        &poller, first.data(), first.size(), nullptr));
+    EXPECT_EQ(AERON_ACTION_CONTINUE, aeron_archive_recording_descriptor_poller_on_fragment(
+        &poller, other.data(), other.size(), nullptr));
+    EXPECT_EQ(AERON_ACTION_CONTINUE, aeron_archive_recording_descriptor_poller_on_fragment(
+        &poller, otherError.data(), otherError.size(), nullptr));
+    EXPECT_EQ(AERON_ACTION_CONTINUE, aeron_archive_recording_descriptor_poller_on_fragment(
+        &poller, second.data(), second.size(), nullptr));
+    EXPECT_EQ(AERON_ACTION_BREAK, aeron_archive_recording_descriptor_poller_on_fragment(
+        &poller, unknown.data(), unknown.size(), nullptr));
+
+    EXPECT_TRUE(poller.is_dispatch_complete);
+    EXPECT_FALSE(poller.is_error);
+    EXPECT_EQ(poller.remaining_record_count, 8);
+    ASSERT_EQ(m_recordingIds.size(), 2u);
+    EXPECT_EQ(m_recordingIds[0], 1);
+    EXPECT_EQ(m_recordingIds[1], 3);
+    EXPECT_EQ(m_channels[0], "aeron:udp?endpoint=localhost:3333");
+    ASSERT_EQ(m_errors.size(), 1u);
+    EXPECT_NE(m_errors[0].find("old request"), std::string::npos);
+
+    aeron_archive_recording_descriptor_poller_close(&poller);
+}
+
+TEST_F(ArchiveCodecTest, shouldCompleteDescriptorDispatchAtRecordCount)
+{
+    aeron_archive_recording_descriptor_poller_t poller;
+    ASSERT_EQ(aeron_archive_recording_descriptor_poller_init(
+        &poller, nullptr, CONTROL_SESSION_ID, 10, nullptr, nullptr), 0);
+    aeron_archive_recording_descriptor_poller_reset(&poller, CORRELATION_ID, 1, onDescriptor, this);
+
+    std::vector<uint8_t> descriptor = recordingDescriptor(CORRELATION_ID, 5);
+
+    EXPECT_EQ(AERON_ACTION_BREAK, aeron_archive_recording_descriptor_poller_on_fragment(
+        &poller, descriptor.data(), descriptor.size(), nullptr));
+    EXPECT_TRUE(poller.is_dispatch_complete);
+    EXPECT_EQ(AERON_ACTION_ABORT, aeron_archive_recording_descriptor_poller_on_fragment(
+        &poller, descriptor.data(), descriptor.size(), nullptr));
+    EXPECT_EQ(m_recordingIds.size(), 1u);
+
+    aeron_archive_recording_descriptor_poller_close(&poller);
+}
+
+TEST_F(ArchiveCodecTest, shouldFailDescriptorDispatchOnErrorForRequest)
+{
+    aeron_archive_recording_descriptor_poller_t poller;
+    ASSERT_EQ(aeron_archive_recording_descriptor_poller_init(
+        &poller, nullptr, CONTROL_SESSION_ID, 10, onError, this), 0);
+    aeron_archive_recording_descriptor_poller_reset(&poller, CORRELATION_ID, 10, onDescriptor, this);
+
+    std::vector<uint8_t> error = controlResponse(
+        CONTROL_SESSION_ID, CORRELATION_ID, 0, AERON_ARCHIVE_CONTROL_RESPONSE_CODE_ERROR, "bad request");
+
+    EXPECT_EQ(AERON_ACTION_BREAK, aeron_archive_recording_descriptor_poller_on_fragment(
+        &poller, error.data(), error.size(), nullptr));
+    EXPECT_TRUE(poller.is_error);
+    EXPECT_TRUE(m_errors.empty());
+
+    aeron_archive_recording_descriptor_poller_close(&poller);
+}
+
+TEST_F(ArchiveCodecTest, shouldRejectTruncatedRecordingDescriptor)
+{
+    std::vector<uint8_t> descriptor = recordingDescriptor(CORRELATION_ID, 5);
+    aeron_archive_message_header_t header;
+    aeron_archive_recording_descriptor_t decoded;
+
+    ASSERT_EQ(aeron_archive_decode_message_header(&header, descriptor.data(), descriptor.size()), 0);
+    EXPECT_EQ(0, aeron_archive_decode_recording_descriptor(&decoded, &header, descriptor.data(), descriptor.size()));
+    EXPECT_EQ(decoded.term_buffer_length, 64 * 1024);
+    EXPECT_EQ(std::string(decoded.source_identity, decoded.source_identity_length), "127.0.0.1:4444");
+
+    EXPECT_EQ(-1, aeron_archive_decode_recording_descriptor(
+        &decoded, &header, descriptor.data(), descriptor.size() - 2));
+}
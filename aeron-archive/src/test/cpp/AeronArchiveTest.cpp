@@ -33,6 +33,7 @@ typedef intptr_t pid_t;
 #include <thread>
 #include <iostream>
 #include <iosfwd>
+#include <map>
 #include <vector>
 #include <cstring>
 
@@ -43,6 +44,9 @@ typedef intptr_t pid_t;
 #include "client/RecordingEventsAdapter.h"
 #include "client/RecordingPos.h"
 #include "client/ReplayMerge.h"
+#include "client/LocalReplayReader.h"
+#include "client/RecordingCatalogCache.h"
+#include "client/MultiReplayMerge.h"
 
 using namespace aeron;
 using namespace aeron::archive::client;
@@ -338,6 +342,8 @@ public:
             idleStrategy.idle(fragments);
         }
 
+        EXPECT_GT(replayMerge.positionCounterReadCount(), 0);
+
         Image &image = *replayMerge.image();
         while (receivedMessageCount < totalMessageCount)
         {
@@ -464,6 +470,187 @@ TEST_F(AeronArchiveTest, shouldRecordPublicationAndFindRecording)
     EXPECT_EQ(count, 1);
 }
 
+TEST_F(AeronArchiveTest, shouldFindRecordingInCatalogCache)
+{
+    const std::string messagePrefix = "Message ";
+    const std::size_t messageCount = 10;
+    std::int64_t recordingIdFromCounter;
+    std::int64_t stopPosition;
+
+    std::shared_ptr<AeronArchive> aeronArchive = AeronArchive::connect(m_context);
+    RecordingCatalogCache cache(aeronArchive);
+
+    EXPECT_EQ(cache.refresh(), 0);
+
+    const std::int64_t subscriptionId = aeronArchive->startRecording(
+        m_recordingChannel, m_recordingStreamId, AeronArchive::SourceLocation::LOCAL);
+
+    {
+        std::shared_ptr<Subscription> subscription = addSubscription(
+            *aeronArchive->context().aeron(), m_recordingChannel, m_recordingStreamId);
+        std::shared_ptr<Publication> publication = addPublication(
+            *aeronArchive->context().aeron(), m_recordingChannel, m_recordingStreamId);
+
+        CountersReader &countersReader = aeronArchive->context().aeron()->countersReader();
+        const std::int32_t counterId = getRecordingCounterId(publication->sessionId(), countersReader);
+        recordingIdFromCounter = RecordingPos::getRecordingId(countersReader, counterId);
+
+        offerMessages(*publication, messageCount, messagePrefix);
+        consumeMessages(*subscription, messageCount, messagePrefix);
+
+        stopPosition = publication->position();
+
+        aeron::concurrent::YieldingIdleStrategy idle;
+        while (countersReader.getCounterValue(counterId) < stopPosition)
+        {
+            idle.idle();
+        }
+    }
+
+    EXPECT_EQ(cache.refresh(), 1);
+    EXPECT_EQ(cache.refresh(), 0);
+
+    const CachedRecordingDescriptor *descriptor = cache.findLastMatching(m_recordingChannel, m_recordingStreamId);
+    ASSERT_NE(descriptor, nullptr);
+    EXPECT_EQ(descriptor, cache.findByRecordingId(recordingIdFromCounter));
+    EXPECT_EQ(descriptor->stopPosition, NULL_POSITION);
+
+    aeronArchive->stopRecording(subscriptionId);
+
+    cache.onRecordingStop(recordingIdFromCounter, descriptor->startPosition, stopPosition);
+    EXPECT_EQ(cache.findByRecordingId(recordingIdFromCounter)->stopPosition, stopPosition);
+    EXPECT_EQ(cache.size(), 1u);
+}
+
+TEST_F(AeronArchiveTest, shouldRecordUsingAsyncRequests)
+{
+    const std::string messagePrefix = "Message ";
+    const std::size_t messageCount = 10;
+    std::map<std::int64_t, std::int64_t> relevantIdByCorrelationId;
+    aeron::concurrent::YieldingIdleStrategy idle;
+
+    std::shared_ptr<AeronArchive> aeronArchive = AeronArchive::connect(m_context);
+    const on_control_response_t consumer =
+        [&](std::int64_t controlSessionId,
+            std::int64_t correlationId,
+            std::int64_t relevantId,
+            std::int32_t code,
+            const std::string &errorMessage)
+        {
+            EXPECT_EQ(aeronArchive->controlSessionId(), controlSessionId);
+            EXPECT_EQ(CONTROL_RESPONSE_CODE_OK, code) << errorMessage;
+            relevantIdByCorrelationId[correlationId] = relevantId;
+        };
+
+    const std::int64_t startCorrelationId = aeronArchive->startRecordingAsync(
+        m_recordingChannel, m_recordingStreamId, AeronArchive::SourceLocation::LOCAL);
+    EXPECT_EQ(1u, aeronArchive->pendingAsyncRequestCount());
+
+    while (aeronArchive->pollAsyncResponses(consumer) == 0)
+    {
+        idle.idle();
+    }
+
+    const std::int64_t subscriptionId = relevantIdByCorrelationId[startCorrelationId];
+    std::int64_t recordingIdFromCounter;
+    std::int64_t stopPosition;
+
+    {
+        std::shared_ptr<Subscription> subscription = addSubscription(
+            *aeronArchive->context().aeron(), m_recordingChannel, m_recordingStreamId);
+        std::shared_ptr<Publication> publication = addPublication(
+            *aeronArchive->context().aeron(), m_recordingChannel, m_recordingStreamId);
+
+        CountersReader &countersReader = aeronArchive->context().aeron()->countersReader();
+        const std::int32_t counterId = getRecordingCounterId(publication->sessionId(), countersReader);
+        recordingIdFromCounter = RecordingPos::getRecordingId(countersReader, counterId);
+
+        offerMessages(*publication, messageCount, messagePrefix);
+        consumeMessages(*subscription, messageCount, messagePrefix);
+
+        stopPosition = publication->position();
+
+        while (countersReader.getCounterValue(counterId) < stopPosition)
+        {
+            idle.idle();
+        }
+
+        const std::int64_t positionCorrelationId = aeronArchive->getRecordingPositionAsync(recordingIdFromCounter);
+        const std::int64_t stopCorrelationId = aeronArchive->getStopPositionAsync(recordingIdFromCounter);
+        EXPECT_EQ(2u, aeronArchive->pendingAsyncRequestCount());
+
+        EXPECT_EQ(aeronArchive->getRecordingPosition(recordingIdFromCounter), stopPosition);
+
+        while (aeronArchive->pendingAsyncRequestCount() > 0)
+        {
+            aeronArchive->pollAsyncResponses(consumer);
+            idle.idle();
+        }
+
+        EXPECT_EQ(relevantIdByCorrelationId[positionCorrelationId], stopPosition);
+        EXPECT_EQ(relevantIdByCorrelationId[stopCorrelationId], aeron::NULL_VALUE);
+    }
+
+    aeronArchive->stopRecordingAsync(subscriptionId);
+
+    while (aeronArchive->pendingAsyncRequestCount() > 0)
+    {
+        aeronArchive->pollAsyncResponses(consumer);
+        idle.idle();
+    }
+
+    EXPECT_EQ(aeronArchive->getStopPosition(recordingIdFromCounter), stopPosition);
+}
+
+TEST_F(AeronArchiveTest, shouldBatchAsyncRecordingRequests)
+{
+    const std::int32_t streamCount = 10;
+    std::map<std::int64_t, std::int64_t> relevantIdByCorrelationId;
+    std::vector<std::int64_t> startCorrelationIds;
+    aeron::concurrent::YieldingIdleStrategy idle;
+
+    std::shared_ptr<AeronArchive> aeronArchive = AeronArchive::connect(m_context);
+    const on_control_response_t consumer =
+        [&](std::int64_t controlSessionId,
+            std::int64_t correlationId,
+            std::int64_t relevantId,
+            std::int32_t code,
+            const std::string &errorMessage)
+        {
+            EXPECT_EQ(CONTROL_RESPONSE_CODE_OK, code) << errorMessage;
+            relevantIdByCorrelationId[correlationId] = relevantId;
+        };
+
+    aeronArchive->startBatch();
+    EXPECT_TRUE(aeronArchive->archiveProxy().isBatching());
+
+    for (std::int32_t i = 0; i < streamCount; i++)
+    {
+        startCorrelationIds.push_back(aeronArchive->startRecordingAsync(
+            m_recordingChannel, m_recordingStreamId + i, AeronArchive::SourceLocation::LOCAL));
+    }
+
+    EXPECT_EQ(static_cast<std::size_t>(streamCount), aeronArchive->archiveProxy().batchedRequestCount());
+
+    while (!aeronArchive->flushBatch())
+    {
+        idle.idle();
+    }
+
+    EXPECT_FALSE(aeronArchive->archiveProxy().isBatching());
+
+    while (aeronArchive->pendingAsyncRequestCount() > 0)
+    {
+        aeronArchive->pollAsyncResponses(consumer);
+        idle.idle();
+    }
+
+    for (const std::int64_t correlationId : startCorrelationIds)
+    {
+        aeronArchive->stopRecording(relevantIdByCorrelationId[correlationId]);
+    }
+}
+
 TEST_F(AeronArchiveTest, shouldRecordThenReplay)
 {
     const std::string messagePrefix = "Message ";
@@ -520,6 +707,67 @@ TEST_F(AeronArchiveTest, shouldRecordThenReplay)
     }
 }
 
+TEST_F(AeronArchiveTest, shouldRecordThenReadLocally)
+{
+    const std::string messagePrefix = "Message ";
+    const std::size_t messageCount = 10;
+    std::int64_t recordingIdFromCounter;
+    std::int64_t stopPosition;
+
+    std::shared_ptr<AeronArchive> aeronArchive = AeronArchive::connect(m_context);
+
+    const std::int64_t subscriptionId = aeronArchive->startRecording(
+        m_recordingChannel, m_recordingStreamId, AeronArchive::SourceLocation::LOCAL);
+
+    {
+        std::shared_ptr<Subscription> subscription = addSubscription(
+            *aeronArchive->context().aeron(), m_recordingChannel, m_recordingStreamId);
+        std::shared_ptr<Publication> publication = addPublication(
+            *aeronArchive->context().aeron(), m_recordingChannel, m_recordingStreamId);
+
+        CountersReader &countersReader = aeronArchive->context().aeron()->countersReader();
+        const std::int32_t counterId = getRecordingCounterId(publication->sessionId(), countersReader);
+        recordingIdFromCounter = RecordingPos::getRecordingId(countersReader, counterId);
+
+        offerMessages(*publication, messageCount, messagePrefix);
+        consumeMessages(*subscription, messageCount, messagePrefix);
+
+        stopPosition = publication->position();
+
+        aeron::concurrent::YieldingIdleStrategy idle;
+        while (countersReader.getCounterValue(counterId) < stopPosition)
+        {
+            idle.idle();
+        }
+    }
+
+    aeronArchive->stopRecording(subscriptionId);
+
+    std::unique_ptr<LocalReplayReader> reader = LocalReplayReader::forRecording(
+        *aeronArchive, m_archiveDir, recordingIdFromCounter);
+
+    std::size_t received = 0;
+    fragment_handler_t handler =
+        [&](AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
+        {
+            const std::string expected = messagePrefix + std::to_string(received);
+            const std::string actual = buffer.getStringWithoutLength(offset, static_cast<std::size_t>(length));
+
+            EXPECT_EQ(expected, actual);
+            EXPECT_GT(header.position(), reader->position());
+
+            received++;
+        };
+
+    while (!reader->isDone())
+    {
+        ASSERT_GT(reader->poll(handler, m_fragmentLimit), 0);
+    }
+
+    EXPECT_EQ(messageCount, received);
+    EXPECT_EQ(stopPosition, reader->position());
+}
+
 TEST_F(AeronArchiveTest, shouldRecordThenReplayThenTruncate)
 {
     const std::string messagePrefix = "Message ";
@@ -894,6 +1142,124 @@ TEST_F(AeronArchiveTest, shouldMergeFromReplayToLive)
     EXPECT_EQ(receivedPosition, publication->position());
 }
 
+TEST_F(AeronArchiveTest, shouldMergeMultipleRecordingsFromReplayToLive)
+{
+    const std::size_t recordingCount = 2;
+    const std::size_t messageCount = 100;
+    const std::string messagePrefix = "Message ";
+    aeron::concurrent::YieldingIdleStrategy idleStrategy;
+
+    std::shared_ptr<AeronArchive> aeronArchive = AeronArchive::connect(m_context);
+    CountersReader &countersReader = aeronArchive->context().aeron()->countersReader();
+    MultiReplayMerge multiReplayMerge(aeronArchive);
+
+    std::vector<std::shared_ptr<Publication>> publications;
+    std::vector<std::shared_ptr<Subscription>> subscriptions;
+
+    for (std::size_t i = 0; i < recordingCount; i++)
+    {
+        const std::int32_t streamId = m_recordingStreamId + static_cast<std::int32_t>(i);
+        const std::string controlEndpoint = "localhost:" + std::to_string(23365 + (i * 10));
+        const std::string recordingEndpoint = "localhost:" + std::to_string(23366 + (i * 10));
+        const std::string liveEndpoint = "localhost:" + std::to_string(23367 + (i * 10));
+        const std::string replayEndpoint = "localhost:" + std::to_string(23368 + (i * 10));
+        const std::int64_t groupTag = 99902 + static_cast<std::int64_t>(i);
+
+        ChannelUriStringBuilder publicationChannel, recordingChannel, subscriptionChannel;
+        ChannelUriStringBuilder liveDestination, replayDestination, replayChannel;
+
+        publicationChannel
+            .media(UDP_MEDIA)
+            .tags(std::to_string(i + 10) + "," + std::to_string(i + 20))
+            .controlEndpoint(controlEndpoint)
+            .controlMode(MDC_CONTROL_MODE_DYNAMIC)
+            .flowControl("tagged,g:" + std::to_string(groupTag) + "/1,t:5s");
+
+        std::shared_ptr<Publication> publication = addPublication(
+            *aeronArchive->context().aeron(), publicationChannel.build(), streamId);
+        const std::int32_t sessionId = publication->sessionId();
+
+        recordingChannel
+            .media(UDP_MEDIA)
+            .groupTag(groupTag)
+            .endpoint(recordingEndpoint)
+            .controlEndpoint(controlEndpoint)
+            .sessionId(sessionId);
+
+        subscriptionChannel
+            .media(UDP_MEDIA)
+            .controlMode(MDC_CONTROL_MODE_MANUAL)
+            .sessionId(sessionId);
+
+        liveDestination
+            .media(UDP_MEDIA)
+            .endpoint(liveEndpoint)
+            .controlEndpoint(controlEndpoint);
+
+        replayDestination
+            .media(UDP_MEDIA)
+            .endpoint(replayEndpoint);
+
+        replayChannel
+            .media(UDP_MEDIA)
+            .isSessionIdTagged(true)
+            .sessionId(static_cast<std::int32_t>(i + 20))
+            .endpoint(replayEndpoint);
+
+        aeronArchive->startRecording(
+            recordingChannel.build(), streamId, AeronArchive::SourceLocation::REMOTE, true);
+
+        const std::int32_t counterId = getRecordingCounterId(sessionId, countersReader);
+        const std::int64_t recordingId = RecordingPos::getRecordingId(countersReader, counterId);
+
+        offerMessages(*publication, messageCount, messagePrefix);
+        while (countersReader.getCounterValue(counterId) < publication->position())
+        {
+            idleStrategy.idle();
+        }
+
+        std::shared_ptr<Subscription> subscription = addSubscription(
+            *aeronArchive->context().aeron(), subscriptionChannel.build(), streamId);
+
+        EXPECT_EQ(i, multiReplayMerge.addRecording(
+            subscription,
+            replayChannel.build(),
+            replayDestination.build(),
+            liveDestination.build(),
+            recordingId,
+            0));
+
+        publications.push_back(publication);
+        subscriptions.push_back(subscription);
+    }
+
+    std::vector<std::size_t> receivedMessageCounts(recordingCount, 0);
+    auto handler =
+        [&](std::size_t index, AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
+        {
+            const std::string expected = messagePrefix + std::to_string(receivedMessageCounts[index]);
+            const std::string actual = buffer.getStringWithoutLength(offset, static_cast<std::size_t>(length));
+
+            EXPECT_EQ(expected, actual);
+
+            receivedMessageCounts[index]++;
+        };
+
+    while (!multiReplayMerge.isMerged())
+    {
+        ASSERT_FALSE(multiReplayMerge.hasFailed());
+        idleStrategy.idle(multiReplayMerge.poll(handler, m_fragmentLimit));
+    }
+
+    for (std::size_t i = 0; i < recordingCount; i++)
+    {
+        EXPECT_EQ(messageCount, receivedMessageCounts[i]);
+        EXPECT_EQ(publications[i]->position(), multiReplayMerge.image(i)->position());
+    }
+
+    EXPECT_EQ(multiReplayMerge.replayedLength(), multiReplayMerge.targetLength());
+}
+
 TEST_F(AeronArchiveTest, shouldExceptionForIncorrectInitialCredentials)
 {
     auto onEncodedCredentials =
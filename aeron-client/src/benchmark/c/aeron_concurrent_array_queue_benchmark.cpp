@@ -0,0 +1,149 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+extern "C"
+{
+#include "concurrent/aeron_mpsc_concurrent_array_queue.h"
+#include "concurrent/aeron_spsc_concurrent_array_queue.h"
+}
+
+#define CAPACITY (1024)
+#define BURST_LENGTH (16)
+
+static aeron_mpsc_concurrent_array_queue_t mpsc_queue;
+static aeron_spsc_concurrent_array_queue_t spsc_queue;
+static int64_t element = 7;
+
+static void drain_func(void *clientd, volatile void *item)
+{
+    (*static_cast<int64_t *>(clientd))++;
+}
+
+static void BM_mpsc_concurrent_array_queue_offer_drain(benchmark::State &state)
+{
+    int64_t items = 0;
+
+    aeron_mpsc_concurrent_array_queue_init(&mpsc_queue, CAPACITY);
+
+    for (auto _ : state)
+    {
+        for (int i = 0; i < BURST_LENGTH; i++)
+        {
+            aeron_mpsc_concurrent_array_queue_offer(&mpsc_queue, &element);
+        }
+
+        aeron_mpsc_concurrent_array_queue_drain(&mpsc_queue, drain_func, &items, BURST_LENGTH);
+    }
+
+    aeron_mpsc_concurrent_array_queue_close(&mpsc_queue);
+    state.SetItemsProcessed(items);
+}
+
+BENCHMARK(BM_mpsc_concurrent_array_queue_offer_drain);
+
+static void BM_spsc_concurrent_array_queue_offer_drain(benchmark::State &state)
+{
+    int64_t items = 0;
+
+    aeron_spsc_concurrent_array_queue_init(&spsc_queue, CAPACITY);
+
+    for (auto _ : state)
+    {
+        for (int i = 0; i < BURST_LENGTH; i++)
+        {
+            aeron_spsc_concurrent_array_queue_offer(&spsc_queue, &element);
+        }
+
+        aeron_spsc_concurrent_array_queue_drain(&spsc_queue, drain_func, &items, BURST_LENGTH);
+    }
+
+    aeron_spsc_concurrent_array_queue_close(&spsc_queue);
+    state.SetItemsProcessed(items);
+}
+
+BENCHMARK(BM_spsc_concurrent_array_queue_offer_drain);
+
+/*
+ * Thread 0 is the consumer and every other thread is a producer. A producer which finds the queue full moves on
+ * rather than spinning so that it cannot block once the consumer has stopped.
+ */
+static void BM_mpsc_concurrent_array_queue_contended(benchmark::State &state)
+{
+    int64_t items = 0;
+
+    if (0 == state.thread_index())
+    {
+        aeron_mpsc_concurrent_array_queue_init(&mpsc_queue, CAPACITY);
+    }
+
+    for (auto _ : state)
+    {
+        if (0 == state.thread_index())
+        {
+            aeron_mpsc_concurrent_array_queue_drain(&mpsc_queue, drain_func, &items, BURST_LENGTH);
+        }
+        else if (AERON_OFFER_SUCCESS == aeron_mpsc_concurrent_array_queue_offer(&mpsc_queue, &element))
+        {
+            items++;
+        }
+    }
+
+    if (0 == state.thread_index())
+    {
+        aeron_mpsc_concurrent_array_queue_close(&mpsc_queue);
+    }
+
+    state.SetItemsProcessed(items);
+}
+
+BENCHMARK(BM_mpsc_concurrent_array_queue_contended)->ThreadRange(2, 8)->UseRealTime();
+
+static void BM_spsc_concurrent_array_queue_contended(benchmark::State &state)
+{
+    int64_t items = 0;
+
+    if (0 == state.thread_index())
+    {
+        aeron_spsc_concurrent_array_queue_init(&spsc_queue, CAPACITY);
+    }
+
+    for (auto _ : state)
+    {
+        if (0 == state.thread_index())
+        {
+            aeron_spsc_concurrent_array_queue_drain(&spsc_queue, drain_func, &items, BURST_LENGTH);
+        }
+        else if (AERON_OFFER_SUCCESS == aeron_spsc_concurrent_array_queue_offer(&spsc_queue, &element))
+        {
+            items++;
+        }
+    }
+
+    if (0 == state.thread_index())
+    {
+        aeron_spsc_concurrent_array_queue_close(&spsc_queue);
+    }
+
+    state.SetItemsProcessed(items);
+}
+
+BENCHMARK(BM_spsc_concurrent_array_queue_contended)->Threads(2)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,147 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+extern "C"
+{
+#include "aeronc.h"
+#include "aeron_image.h"
+#include "aeron_fragment_assembler.h"
+}
+
+#define STREAM_ID (10)
+#define SESSION_ID (200)
+#define ACTIVE_TERM_ID (101)
+#define MAX_PAYLOAD_LENGTH (1376)
+
+static void fragment_handler(void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header)
+{
+    *static_cast<size_t *>(clientd) += length;
+}
+
+/*
+ * Lay out a message of the given length as a sequence of frames of at most MAX_PAYLOAD_LENGTH each.
+ */
+static size_t fill_frames(std::vector<std::uint8_t> &frames, size_t message_length)
+{
+    const size_t fragment_count = (message_length + MAX_PAYLOAD_LENGTH - 1) / MAX_PAYLOAD_LENGTH;
+    const size_t frame_stride = AERON_ALIGN(
+        AERON_DATA_HEADER_LENGTH + MAX_PAYLOAD_LENGTH, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    size_t remaining = message_length;
+
+    frames.assign(fragment_count * frame_stride, 0);
+
+    for (size_t i = 0; i < fragment_count; i++)
+    {
+        auto frame = (aeron_data_header_t *)(frames.data() + (i * frame_stride));
+        const size_t length = remaining < MAX_PAYLOAD_LENGTH ? remaining : MAX_PAYLOAD_LENGTH;
+        uint8_t flags = 0;
+
+        flags |= 0 == i ? AERON_DATA_HEADER_BEGIN_FLAG : 0;
+        flags |= fragment_count - 1 == i ? AERON_DATA_HEADER_END_FLAG : 0;
+
+        frame->frame_header.frame_length = (int32_t)(AERON_DATA_HEADER_LENGTH + length);
+        frame->frame_header.version = AERON_FRAME_HEADER_VERSION;
+        frame->frame_header.flags = flags;
+        frame->frame_header.type = AERON_HDR_TYPE_DATA;
+        frame->term_offset = (int32_t)(i * frame_stride);
+        frame->session_id = SESSION_ID;
+        frame->stream_id = STREAM_ID;
+        frame->term_id = ACTIVE_TERM_ID;
+
+        remaining -= length;
+    }
+
+    return fragment_count;
+}
+
+static void deliver(
+    aeron_fragment_assembler_t *assembler, std::vector<std::uint8_t> &frames, size_t fragment_count)
+{
+    const size_t frame_stride = frames.size() / fragment_count;
+    aeron_header_t header = {};
+
+    for (size_t i = 0; i < fragment_count; i++)
+    {
+        uint8_t *frame = frames.data() + (i * frame_stride);
+        header.frame = (aeron_data_header_t *)frame;
+
+        aeron_fragment_assembler_handler(
+            assembler,
+            frame + AERON_DATA_HEADER_LENGTH,
+            header.frame->frame_header.frame_length - AERON_DATA_HEADER_LENGTH,
+            &header);
+    }
+}
+
+static void BM_fragment_assembler(benchmark::State &state)
+{
+    const auto message_length = static_cast<size_t>(state.range(0));
+    std::vector<std::uint8_t> frames;
+    aeron_fragment_assembler_t *assembler = nullptr;
+    size_t bytes_delivered = 0;
+
+    const size_t fragment_count = fill_frames(frames, message_length);
+    if (aeron_fragment_assembler_create(&assembler, fragment_handler, &bytes_delivered) < 0)
+    {
+        state.SkipWithError(aeron_errmsg());
+        return;
+    }
+
+    for (auto _ : state)
+    {
+        deliver(assembler, frames, fragment_count);
+    }
+
+    aeron_fragment_assembler_delete(assembler);
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(static_cast<int64_t>(bytes_delivered));
+}
+
+BENCHMARK(BM_fragment_assembler)->Arg(256)->Arg(4 * 1024)->Arg(64 * 1024);
+
+static void BM_fragment_assembler_pooled(benchmark::State &state)
+{
+    const auto message_length = static_cast<size_t>(state.range(0));
+    std::vector<std::uint8_t> frames;
+    aeron_fragment_assembler_t *assembler = nullptr;
+    size_t bytes_delivered = 0;
+
+    const size_t fragment_count = fill_frames(frames, message_length);
+    if (aeron_fragment_assembler_create_pooled(
+        &assembler, fragment_handler, &bytes_delivered, message_length, 1) < 0)
+    {
+        state.SkipWithError(aeron_errmsg());
+        return;
+    }
+
+    for (auto _ : state)
+    {
+        deliver(assembler, frames, fragment_count);
+    }
+
+    aeron_fragment_assembler_delete(assembler);
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(static_cast<int64_t>(bytes_delivered));
+}
+
+BENCHMARK(BM_fragment_assembler_pooled)->Arg(256)->Arg(4 * 1024)->Arg(64 * 1024);
+
+BENCHMARK_MAIN();
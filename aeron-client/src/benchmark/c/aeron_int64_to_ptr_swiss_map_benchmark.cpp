@@ -0,0 +1,127 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+extern "C"
+{
+#include "collections/aeron_int64_to_ptr_swiss_map.h"
+}
+
+#define LOAD_FACTOR (AERON_MAP_DEFAULT_LOAD_FACTOR)
+
+static int64_t value = 7;
+
+static void BM_int64_to_ptr_swiss_map_get(benchmark::State &state)
+{
+    const auto count = static_cast<int64_t>(state.range(0));
+    aeron_int64_to_ptr_swiss_map_t map;
+    int64_t key = 0;
+
+    aeron_int64_to_ptr_swiss_map_init(&map, 64, LOAD_FACTOR);
+    for (int64_t i = 0; i < count; i++)
+    {
+        aeron_int64_to_ptr_swiss_map_put(&map, i, &value);
+    }
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(aeron_int64_to_ptr_swiss_map_get(&map, key));
+        key = (key + 1) % count;
+    }
+
+    aeron_int64_to_ptr_swiss_map_delete(&map);
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_int64_to_ptr_swiss_map_get)->Arg(16)->Arg(1024)->Arg(64 * 1024);
+
+static void BM_int64_to_ptr_swiss_map_get_missing(benchmark::State &state)
+{
+    const auto count = static_cast<int64_t>(state.range(0));
+    aeron_int64_to_ptr_swiss_map_t map;
+    int64_t key = 0;
+
+    aeron_int64_to_ptr_swiss_map_init(&map, 64, LOAD_FACTOR);
+    for (int64_t i = 0; i < count; i++)
+    {
+        aeron_int64_to_ptr_swiss_map_put(&map, i, &value);
+    }
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(aeron_int64_to_ptr_swiss_map_get(&map, count + key));
+        key = (key + 1) % count;
+    }
+
+    aeron_int64_to_ptr_swiss_map_delete(&map);
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_int64_to_ptr_swiss_map_get_missing)->Arg(16)->Arg(1024)->Arg(64 * 1024);
+
+static void BM_int64_to_ptr_swiss_map_get_strided(benchmark::State &state)
+{
+    const auto count = static_cast<int64_t>(state.range(0));
+    aeron_int64_to_ptr_swiss_map_t map;
+    int64_t key = 0;
+
+    aeron_int64_to_ptr_swiss_map_init(&map, 64, LOAD_FACTOR);
+    for (int64_t i = 0; i < count; i++)
+    {
+        aeron_int64_to_ptr_swiss_map_put(&map, i << 16, &value);
+    }
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(aeron_int64_to_ptr_swiss_map_get(&map, key << 16));
+        key = (key + 1) % count;
+    }
+
+    aeron_int64_to_ptr_swiss_map_delete(&map);
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_int64_to_ptr_swiss_map_get_strided)->Arg(16)->Arg(1024);
+
+static void BM_int64_to_ptr_swiss_map_put_remove(benchmark::State &state)
+{
+    const auto count = static_cast<int64_t>(state.range(0));
+    aeron_int64_to_ptr_swiss_map_t map;
+    int64_t key = 0;
+
+    aeron_int64_to_ptr_swiss_map_init(&map, 64, LOAD_FACTOR);
+    for (int64_t i = 0; i < count; i++)
+    {
+        aeron_int64_to_ptr_swiss_map_put(&map, i, &value);
+    }
+
+    for (auto _ : state)
+    {
+        aeron_int64_to_ptr_swiss_map_put(&map, count + key, &value);
+        benchmark::DoNotOptimize(aeron_int64_to_ptr_swiss_map_remove(&map, count + key));
+        key = (key + 1) % count;
+    }
+
+    aeron_int64_to_ptr_swiss_map_delete(&map);
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_int64_to_ptr_swiss_map_put_remove)->Arg(16)->Arg(1024)->Arg(64 * 1024);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,157 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+extern "C"
+{
+#include "concurrent/aeron_mpsc_rb.h"
+#include "concurrent/aeron_spsc_rb.h"
+}
+
+#define CAPACITY (64 * 1024)
+#define BUFFER_SZ (CAPACITY + AERON_RB_TRAILER_LENGTH)
+#define MSG_TYPE_ID (101)
+#define MAX_MESSAGE_LENGTH (1024)
+#define BURST_LENGTH (16)
+
+static std::vector<std::uint8_t> rb_buffer(BUFFER_SZ);
+static std::array<std::uint8_t, MAX_MESSAGE_LENGTH> src_buffer;
+static aeron_mpsc_rb_t mpsc_rb;
+static aeron_spsc_rb_t spsc_rb;
+
+static void rb_handler(int32_t msg_type_id, const void *msg, size_t length, void *clientd)
+{
+    *static_cast<size_t *>(clientd) += length;
+}
+
+static void BM_mpsc_rb_write_read(benchmark::State &state)
+{
+    const auto message_length = static_cast<size_t>(state.range(0));
+    size_t bytes_read = 0;
+
+    std::fill(rb_buffer.begin(), rb_buffer.end(), 0);
+    aeron_mpsc_rb_init(&mpsc_rb, rb_buffer.data(), rb_buffer.size());
+
+    for (auto _ : state)
+    {
+        for (int i = 0; i < BURST_LENGTH; i++)
+        {
+            aeron_mpsc_rb_write(&mpsc_rb, MSG_TYPE_ID, src_buffer.data(), message_length);
+        }
+
+        benchmark::DoNotOptimize(aeron_mpsc_rb_read(&mpsc_rb, rb_handler, &bytes_read, BURST_LENGTH));
+    }
+
+    state.SetItemsProcessed(state.iterations() * BURST_LENGTH);
+    state.SetBytesProcessed(static_cast<int64_t>(bytes_read));
+}
+
+BENCHMARK(BM_mpsc_rb_write_read)->Arg(32)->Arg(256);
+
+static void BM_spsc_rb_write_read(benchmark::State &state)
+{
+    const auto message_length = static_cast<size_t>(state.range(0));
+    size_t bytes_read = 0;
+
+    std::fill(rb_buffer.begin(), rb_buffer.end(), 0);
+    aeron_spsc_rb_init(&spsc_rb, rb_buffer.data(), rb_buffer.size());
+
+    for (auto _ : state)
+    {
+        for (int i = 0; i < BURST_LENGTH; i++)
+        {
+            aeron_spsc_rb_write(&spsc_rb, MSG_TYPE_ID, src_buffer.data(), message_length);
+        }
+
+        benchmark::DoNotOptimize(aeron_spsc_rb_read(&spsc_rb, rb_handler, &bytes_read, BURST_LENGTH));
+    }
+
+    state.SetItemsProcessed(state.iterations() * BURST_LENGTH);
+    state.SetBytesProcessed(static_cast<int64_t>(bytes_read));
+}
+
+BENCHMARK(BM_spsc_rb_write_read)->Arg(32)->Arg(256);
+
+/*
+ * Thread 0 is the consumer and every other thread is a producer. A producer which finds the ring buffer full moves
+ * on rather than spinning so that it cannot block once the consumer has stopped. Items are the messages which were
+ * successfully written or read by each thread.
+ */
+static void BM_mpsc_rb_contended(benchmark::State &state)
+{
+    const size_t message_length = 32;
+    int64_t items = 0;
+    size_t bytes_read = 0;
+
+    if (0 == state.thread_index())
+    {
+        std::fill(rb_buffer.begin(), rb_buffer.end(), 0);
+        aeron_mpsc_rb_init(&mpsc_rb, rb_buffer.data(), rb_buffer.size());
+    }
+
+    for (auto _ : state)
+    {
+        if (0 == state.thread_index())
+        {
+            items += static_cast<int64_t>(aeron_mpsc_rb_read(&mpsc_rb, rb_handler, &bytes_read, BURST_LENGTH));
+        }
+        else if (AERON_RB_SUCCESS == aeron_mpsc_rb_write(&mpsc_rb, MSG_TYPE_ID, src_buffer.data(), message_length))
+        {
+            items++;
+        }
+    }
+
+    state.SetItemsProcessed(items);
+}
+
+BENCHMARK(BM_mpsc_rb_contended)->ThreadRange(2, 8)->UseRealTime();
+
+static void BM_spsc_rb_contended(benchmark::State &state)
+{
+    const size_t message_length = 32;
+    int64_t items = 0;
+    size_t bytes_read = 0;
+
+    if (0 == state.thread_index())
+    {
+        std::fill(rb_buffer.begin(), rb_buffer.end(), 0);
+        aeron_spsc_rb_init(&spsc_rb, rb_buffer.data(), rb_buffer.size());
+    }
+
+    for (auto _ : state)
+    {
+        if (0 == state.thread_index())
+        {
+            items += static_cast<int64_t>(aeron_spsc_rb_read(&spsc_rb, rb_handler, &bytes_read, BURST_LENGTH));
+        }
+        else if (AERON_RB_SUCCESS == aeron_spsc_rb_write(&spsc_rb, MSG_TYPE_ID, src_buffer.data(), message_length))
+        {
+            items++;
+        }
+    }
+
+    state.SetItemsProcessed(items);
+}
+
+BENCHMARK(BM_spsc_rb_contended)->Threads(2)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,148 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+extern "C"
+{
+#include "concurrent/aeron_term_appender.h"
+#include "concurrent/aeron_term_scanner.h"
+}
+
+#define TERM_BUFFER_CAPACITY (AERON_LOGBUFFER_TERM_MIN_LENGTH)
+#define META_DATA_BUFFER_CAPACITY (AERON_LOGBUFFER_META_DATA_LENGTH)
+#define MAX_MESSAGE_LENGTH (4 * 1024)
+#define TERM_ID (101)
+#define PARTITION_INDEX (0)
+#define SESSION_ID (11)
+#define STREAM_ID (10)
+
+typedef std::array<std::uint8_t, TERM_BUFFER_CAPACITY> term_buffer_t;
+typedef std::array<std::uint8_t, META_DATA_BUFFER_CAPACITY> meta_data_buffer_t;
+
+static AERON_DECL_ALIGNED(term_buffer_t term_buffer, 16);
+static AERON_DECL_ALIGNED(meta_data_buffer_t meta_data_buffer, 16);
+static std::array<std::uint8_t, MAX_MESSAGE_LENGTH> src_buffer;
+
+static int64_t pack_raw_tail(int32_t term_id, int32_t term_offset)
+{
+    return static_cast<int64_t>(term_id) << 32 | term_offset;
+}
+
+static void fill_term(size_t message_length)
+{
+    aeron_mapped_buffer_t mapped_buffer = { term_buffer.data(), term_buffer.size() };
+    auto metadata = (aeron_logbuffer_metadata_t *)meta_data_buffer.data();
+    volatile int64_t *term_tail_counter = &metadata->term_tail_counters[PARTITION_INDEX];
+    const size_t aligned_frame_length = AERON_ALIGN(
+        message_length + AERON_DATA_HEADER_LENGTH, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+
+    term_buffer.fill(0);
+    *term_tail_counter = pack_raw_tail(TERM_ID, 0);
+
+    for (size_t i = 0, count = term_buffer.size() / aligned_frame_length; i < count; i++)
+    {
+        aeron_term_appender_append_unfragmented_message(
+            &mapped_buffer,
+            term_tail_counter,
+            src_buffer.data(),
+            message_length,
+            nullptr,
+            nullptr,
+            TERM_ID,
+            SESSION_ID,
+            STREAM_ID);
+    }
+}
+
+static void BM_term_appender_append_unfragmented_message(benchmark::State &state)
+{
+    const auto message_length = static_cast<size_t>(state.range(0));
+    const size_t aligned_frame_length = AERON_ALIGN(
+        message_length + AERON_DATA_HEADER_LENGTH, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    const auto tail_limit = static_cast<int32_t>(term_buffer.size() - aligned_frame_length);
+    aeron_mapped_buffer_t mapped_buffer = { term_buffer.data(), term_buffer.size() };
+    auto metadata = (aeron_logbuffer_metadata_t *)meta_data_buffer.data();
+    volatile int64_t *term_tail_counter = &metadata->term_tail_counters[PARTITION_INDEX];
+
+    term_buffer.fill(0);
+    *term_tail_counter = pack_raw_tail(TERM_ID, 0);
+
+    for (auto _ : state)
+    {
+        int32_t result = aeron_term_appender_append_unfragmented_message(
+            &mapped_buffer,
+            term_tail_counter,
+            src_buffer.data(),
+            message_length,
+            nullptr,
+            nullptr,
+            TERM_ID,
+            SESSION_ID,
+            STREAM_ID);
+        benchmark::DoNotOptimize(result);
+
+        if ((int32_t)*term_tail_counter > tail_limit)
+        {
+            *term_tail_counter = pack_raw_tail(TERM_ID, 0);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(message_length));
+}
+
+BENCHMARK(BM_term_appender_append_unfragmented_message)->Arg(32)->Arg(288)->Arg(1344);
+
+static void BM_term_scanner_scan_for_availability(benchmark::State &state)
+{
+    const auto message_length = static_cast<size_t>(state.range(0));
+    const auto max_length = static_cast<size_t>(state.range(1));
+    int64_t bytes_scanned = 0;
+
+    fill_term(message_length);
+
+    for (auto _ : state)
+    {
+        size_t offset = 0;
+        size_t padding = 0;
+
+        while (offset < term_buffer.size())
+        {
+            const size_t available = aeron_term_scanner_scan_for_availability(
+                term_buffer.data() + offset, term_buffer.size() - offset, max_length, &padding);
+
+            if (0 == available)
+            {
+                break;
+            }
+
+            offset += available + padding;
+        }
+
+        benchmark::DoNotOptimize(offset);
+        bytes_scanned += static_cast<int64_t>(offset);
+    }
+
+    state.SetBytesProcessed(bytes_scanned);
+}
+
+BENCHMARK(BM_term_scanner_scan_for_availability)->Args({ 32, 1408 })->Args({ 32, 8192 })->Args({ 1344, 8192 });
+
+BENCHMARK_MAIN();
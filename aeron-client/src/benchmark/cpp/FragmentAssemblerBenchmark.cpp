@@ -0,0 +1,173 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "FragmentAssembler.h"
+
+using namespace aeron::concurrent::logbuffer;
+using namespace aeron::concurrent;
+using namespace aeron;
+
+#define STREAM_ID (10)
+#define SESSION_ID (200)
+#define ACTIVE_TERM_ID (101)
+#define TERM_LENGTH (LogBufferDescriptor::TERM_MIN_LENGTH)
+#define MAX_PAYLOAD_LENGTH (1376)
+#define FRAME_STRIDE \
+    (util::BitUtil::align(DataFrameHeader::LENGTH + MAX_PAYLOAD_LENGTH, FrameDescriptor::FRAME_ALIGNMENT))
+
+/*
+ * Lay out a message of the given length as a sequence of frames of at most MAX_PAYLOAD_LENGTH each.
+ */
+static util::index_t fillFrames(std::vector<std::uint8_t> &frames, util::index_t messageLength)
+{
+    const util::index_t fragmentCount = (messageLength + MAX_PAYLOAD_LENGTH - 1) / MAX_PAYLOAD_LENGTH;
+    util::index_t remaining = messageLength;
+
+    frames.assign(static_cast<std::size_t>(fragmentCount * FRAME_STRIDE), 0);
+    AtomicBuffer buffer(frames.data(), frames.size());
+
+    for (util::index_t i = 0; i < fragmentCount; i++)
+    {
+        const util::index_t offset = i * FRAME_STRIDE;
+        const util::index_t length = std::min(remaining, MAX_PAYLOAD_LENGTH);
+        std::uint8_t flags = 0;
+
+        flags |= 0 == i ? FrameDescriptor::BEGIN_FRAG : 0;
+        flags |= fragmentCount - 1 == i ? FrameDescriptor::END_FRAG : 0;
+
+        auto &frame = buffer.overlayStruct<DataFrameHeader::DataFrameHeaderDefn>(offset);
+        frame.frameLength = DataFrameHeader::LENGTH + length;
+        frame.version = DataFrameHeader::CURRENT_VERSION;
+        frame.flags = flags;
+        frame.type = DataFrameHeader::HDR_TYPE_DATA;
+        frame.termOffset = offset;
+        frame.sessionId = SESSION_ID;
+        frame.streamId = STREAM_ID;
+        frame.termId = ACTIVE_TERM_ID;
+
+        remaining -= length;
+    }
+
+    return fragmentCount;
+}
+
+template<typename Assembler>
+static void deliver(Assembler &assembler, AtomicBuffer &buffer, util::index_t fragmentCount, Header &header)
+{
+    header.buffer(buffer);
+
+    for (util::index_t i = 0; i < fragmentCount; i++)
+    {
+        const util::index_t offset = i * FRAME_STRIDE;
+        header.offset(offset);
+
+        assembler(
+            buffer,
+            offset + DataFrameHeader::LENGTH,
+            buffer.getInt32(offset) - DataFrameHeader::LENGTH,
+            header);
+    }
+}
+
+static void BM_FragmentAssembler(benchmark::State &state)
+{
+    const auto messageLength = static_cast<util::index_t>(state.range(0));
+    std::vector<std::uint8_t> frames;
+    std::int64_t bytesDelivered = 0;
+
+    const util::index_t fragmentCount = fillFrames(frames, messageLength);
+    AtomicBuffer buffer(frames.data(), frames.size());
+    Header header(ACTIVE_TERM_ID, TERM_LENGTH, nullptr);
+
+    FragmentAssembler assembler(
+        [&](AtomicBuffer &, util::index_t, util::index_t length, Header &)
+        {
+            bytesDelivered += length;
+        });
+
+    for (auto _ : state)
+    {
+        deliver(assembler, buffer, fragmentCount, header);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(bytesDelivered);
+}
+
+BENCHMARK(BM_FragmentAssembler)->Arg(256)->Arg(4 * 1024)->Arg(64 * 1024);
+
+static void BM_FragmentAssemblerT(benchmark::State &state)
+{
+    const auto messageLength = static_cast<util::index_t>(state.range(0));
+    std::vector<std::uint8_t> frames;
+    std::int64_t bytesDelivered = 0;
+
+    const util::index_t fragmentCount = fillFrames(frames, messageLength);
+    AtomicBuffer buffer(frames.data(), frames.size());
+    Header header(ACTIVE_TERM_ID, TERM_LENGTH, nullptr);
+
+    auto assembler = makeFragmentAssembler(
+        [&](AtomicBuffer &, util::index_t, util::index_t length, Header &)
+        {
+            bytesDelivered += length;
+        });
+
+    for (auto _ : state)
+    {
+        deliver(assembler, buffer, fragmentCount, header);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(bytesDelivered);
+}
+
+BENCHMARK(BM_FragmentAssemblerT)->Arg(256)->Arg(4 * 1024)->Arg(64 * 1024);
+
+static void BM_FragmentAssemblerPooled(benchmark::State &state)
+{
+    const auto messageLength = static_cast<util::index_t>(state.range(0));
+    std::vector<std::uint8_t> frames;
+    std::int64_t bytesDelivered = 0;
+
+    const util::index_t fragmentCount = fillFrames(frames, messageLength);
+    AtomicBuffer buffer(frames.data(), frames.size());
+    Header header(ACTIVE_TERM_ID, TERM_LENGTH, nullptr);
+
+    FragmentAssembler assembler(
+        [&](AtomicBuffer &, util::index_t, util::index_t length, Header &)
+        {
+            bytesDelivered += length;
+        },
+        static_cast<std::size_t>(messageLength),
+        1);
+
+    for (auto _ : state)
+    {
+        deliver(assembler, buffer, fragmentCount, header);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(bytesDelivered);
+}
+
+BENCHMARK(BM_FragmentAssemblerPooled)->Arg(256)->Arg(4 * 1024)->Arg(64 * 1024);
+
+BENCHMARK_MAIN();
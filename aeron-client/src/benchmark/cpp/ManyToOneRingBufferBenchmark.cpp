@@ -0,0 +1,117 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include "concurrent/ringbuffer/ManyToOneRingBuffer.h"
+
+using namespace aeron::concurrent::ringbuffer;
+using namespace aeron::concurrent;
+using namespace aeron;
+
+#define CAPACITY (64 * 1024)
+#define BUFFER_SZ (CAPACITY + RingBufferDescriptor::TRAILER_LENGTH)
+#define MSG_TYPE_ID (101)
+#define MAX_MESSAGE_LENGTH (1024)
+#define BURST_LENGTH (16)
+
+typedef std::array<std::uint8_t, BUFFER_SZ> buffer_t;
+typedef std::array<std::uint8_t, MAX_MESSAGE_LENGTH> src_buffer_t;
+
+static AERON_DECL_ALIGNED(buffer_t buffer, 16);
+static AERON_DECL_ALIGNED(src_buffer_t srcBuffer, 16);
+
+static void BM_ManyToOneRingBuffer_writeRead(benchmark::State &state)
+{
+    const auto messageLength = static_cast<util::index_t>(state.range(0));
+    buffer.fill(0);
+    AtomicBuffer ab(buffer.data(), buffer.size());
+    AtomicBuffer src(srcBuffer, 0);
+    ManyToOneRingBuffer ringBuffer(ab);
+    std::int64_t bytesRead = 0;
+
+    const handler_t handler = [&](std::int32_t, AtomicBuffer &, util::index_t, util::index_t length)
+    {
+        bytesRead += length;
+    };
+
+    for (auto _ : state)
+    {
+        for (int i = 0; i < BURST_LENGTH; i++)
+        {
+            ringBuffer.write(MSG_TYPE_ID, src, 0, messageLength);
+        }
+
+        benchmark::DoNotOptimize(ringBuffer.read(handler, BURST_LENGTH));
+    }
+
+    state.SetItemsProcessed(state.iterations() * BURST_LENGTH);
+    state.SetBytesProcessed(bytesRead);
+}
+
+BENCHMARK(BM_ManyToOneRingBuffer_writeRead)->Arg(32)->Arg(256);
+
+static AtomicBuffer sharedBuffer(buffer.data(), buffer.size());
+static ManyToOneRingBuffer *sharedRingBuffer = nullptr;
+
+/*
+ * Thread 0 is the consumer and every other thread is a producer. A producer which finds the ring buffer full moves
+ * on rather than spinning so that it cannot block once the consumer has stopped.
+ */
+static void BM_ManyToOneRingBuffer_contended(benchmark::State &state)
+{
+    const util::index_t messageLength = 32;
+    AtomicBuffer src(srcBuffer, 0);
+    std::int64_t items = 0;
+
+    const handler_t handler = [&](std::int32_t, AtomicBuffer &, util::index_t, util::index_t)
+    {
+        items++;
+    };
+
+    if (0 == state.thread_index())
+    {
+        buffer.fill(0);
+        sharedRingBuffer = new ManyToOneRingBuffer(sharedBuffer);
+    }
+
+    for (auto _ : state)
+    {
+        if (0 == state.thread_index())
+        {
+            sharedRingBuffer->read(handler, BURST_LENGTH);
+        }
+        else if (sharedRingBuffer->write(MSG_TYPE_ID, src, 0, messageLength))
+        {
+            items++;
+        }
+    }
+
+    if (0 == state.thread_index())
+    {
+        delete sharedRingBuffer;
+        sharedRingBuffer = nullptr;
+    }
+
+    state.SetItemsProcessed(items);
+}
+
+BENCHMARK(BM_ManyToOneRingBuffer_contended)->ThreadRange(2, 8)->UseRealTime();
+
+BENCHMARK_MAIN();
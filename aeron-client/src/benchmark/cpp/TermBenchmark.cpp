@@ -0,0 +1,133 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include "concurrent/logbuffer/ExclusiveTermAppender.h"
+#include "concurrent/logbuffer/TermAppender.h"
+#include "concurrent/logbuffer/TermReader.h"
+
+using namespace aeron::concurrent::logbuffer;
+using namespace aeron::concurrent;
+using namespace aeron;
+
+#define TERM_BUFFER_CAPACITY (LogBufferDescriptor::TERM_MIN_LENGTH)
+#define META_DATA_BUFFER_CAPACITY (LogBufferDescriptor::LOG_META_DATA_LENGTH)
+#define MAX_MESSAGE_LENGTH (4 * 1024)
+#define TERM_ID (101)
+#define PARTITION_INDEX (0)
+#define TERM_TAIL_OFFSET (LogBufferDescriptor::TERM_TAIL_COUNTER_OFFSET + (PARTITION_INDEX * sizeof(std::int64_t)))
+
+typedef std::array<std::uint8_t, TERM_BUFFER_CAPACITY> term_buffer_t;
+typedef std::array<std::uint8_t, META_DATA_BUFFER_CAPACITY> meta_data_buffer_t;
+typedef std::array<std::uint8_t, DataFrameHeader::LENGTH> hdr_t;
+typedef std::array<std::uint8_t, MAX_MESSAGE_LENGTH> src_buffer_t;
+
+static AERON_DECL_ALIGNED(term_buffer_t logBuffer, 16);
+static AERON_DECL_ALIGNED(meta_data_buffer_t stateBuffer, 16);
+static AERON_DECL_ALIGNED(hdr_t hdrBuffer, 16);
+static AERON_DECL_ALIGNED(src_buffer_t srcBuffer, 16);
+
+static void fillTerm(util::index_t messageLength)
+{
+    AtomicBuffer termBuffer(logBuffer.data(), logBuffer.size());
+    AtomicBuffer metaDataBuffer(stateBuffer.data(), stateBuffer.size());
+    AtomicBuffer src(srcBuffer, 0);
+    AtomicBuffer hdr(hdrBuffer, 0);
+    HeaderWriter headerWriter(hdr);
+    ExclusiveTermAppender termAppender(termBuffer, metaDataBuffer, PARTITION_INDEX);
+    const util::index_t alignedFrameLength = util::BitUtil::align(
+        messageLength + DataFrameHeader::LENGTH, FrameDescriptor::FRAME_ALIGNMENT);
+
+    logBuffer.fill(0);
+    stateBuffer.fill(0);
+
+    std::int32_t termOffset = 0;
+    while (termOffset + alignedFrameLength <= termBuffer.capacity())
+    {
+        termOffset = termAppender.appendUnfragmentedMessage(
+            TERM_ID, termOffset, headerWriter, src, 0, messageLength, DEFAULT_RESERVED_VALUE_SUPPLIER);
+    }
+}
+
+static void BM_ExclusiveTermAppender_appendUnfragmentedMessage(benchmark::State &state)
+{
+    const auto messageLength = static_cast<util::index_t>(state.range(0));
+    AtomicBuffer termBuffer(logBuffer.data(), logBuffer.size());
+    AtomicBuffer metaDataBuffer(stateBuffer.data(), stateBuffer.size());
+    AtomicBuffer src(srcBuffer, 0);
+    AtomicBuffer hdr(hdrBuffer, 0);
+    HeaderWriter headerWriter(hdr);
+    ExclusiveTermAppender termAppender(termBuffer, metaDataBuffer, PARTITION_INDEX);
+    const util::index_t alignedFrameLength = util::BitUtil::align(
+        messageLength + DataFrameHeader::LENGTH, FrameDescriptor::FRAME_ALIGNMENT);
+    const util::index_t offsetLimit = termBuffer.capacity() - alignedFrameLength;
+
+    logBuffer.fill(0);
+    stateBuffer.fill(0);
+
+    std::int32_t termOffset = 0;
+    for (auto _ : state)
+    {
+        termOffset = termAppender.appendUnfragmentedMessage(
+            TERM_ID, termOffset, headerWriter, src, 0, messageLength, DEFAULT_RESERVED_VALUE_SUPPLIER);
+
+        if (termOffset > offsetLimit)
+        {
+            termOffset = 0;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * messageLength);
+}
+
+BENCHMARK(BM_ExclusiveTermAppender_appendUnfragmentedMessage)->Arg(32)->Arg(288)->Arg(1344);
+
+static void BM_TermReader_read(benchmark::State &state)
+{
+    const auto messageLength = static_cast<util::index_t>(state.range(0));
+    AtomicBuffer termBuffer(logBuffer.data(), logBuffer.size());
+    Header header(TERM_ID, termBuffer.capacity(), nullptr);
+    TermReader::ReadOutcome outcome{ 0, 0 };
+    std::int64_t bytesRead = 0;
+    std::int64_t fragmentsRead = 0;
+
+    fillTerm(messageLength);
+
+    auto handler = [&](AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &)
+    {
+        bytesRead += length;
+    };
+
+    auto exceptionHandler = [](const std::exception &) {};
+
+    for (auto _ : state)
+    {
+        TermReader::read(outcome, termBuffer, 0, handler, INT32_MAX, header, exceptionHandler);
+        fragmentsRead += outcome.fragmentsRead;
+    }
+
+    state.SetItemsProcessed(fragmentsRead);
+    state.SetBytesProcessed(bytesRead);
+}
+
+BENCHMARK(BM_TermReader_read)->Arg(32)->Arg(288)->Arg(1344);
+
+BENCHMARK_MAIN();
@@ -23,6 +23,7 @@
 #include <stdio.h>
 #include <errno.h>
 #include <stdlib.h>
+#include <inttypes.h>
 #include "concurrent/aeron_thread.h"
 #include "aeron_agent.h"
 #include "aeron_alloc.h"
@@ -183,6 +184,253 @@ int aeron_idle_strategy_backoff_state_init(
     return 0;
 }
 
+#define AERON_IDLE_STRATEGY_ADAPTIVE_STATE_NOT_IDLE 0
+#define AERON_IDLE_STRATEGY_ADAPTIVE_STATE_SPINNING 1
+#define AERON_IDLE_STRATEGY_ADAPTIVE_STATE_YIELDING 2
+#define AERON_IDLE_STRATEGY_ADAPTIVE_STATE_PARKING 3
+
+typedef struct aeron_idle_strategy_adaptive_state_stct
+{
+    uint8_t pre_pad[AERON_CACHE_LINE_LENGTH];
+    uint64_t min_spin_period_ns;
+    uint64_t max_spin_period_ns;
+    uint64_t min_park_period_ns;
+    uint64_t max_park_period_ns;
+    uint64_t smoothed_gap_ns;
+    uint64_t spin_period_ns;
+    uint64_t park_period_ns;
+    uint64_t yields;
+    int64_t idle_start_ns;
+    uint8_t state;
+    uint8_t post_pad[AERON_CACHE_LINE_LENGTH];
+}
+aeron_idle_strategy_adaptive_state_t;
+
+static void aeron_idle_strategy_adaptive_on_work(aeron_idle_strategy_adaptive_state_t *adaptive_state)
+{
+    const int64_t gap_ns = aeron_nano_clock() - adaptive_state->idle_start_ns;
+    const uint64_t gap = gap_ns > 0 ? (uint64_t)gap_ns : 0;
+
+    if (gap >= adaptive_state->smoothed_gap_ns)
+    {
+        adaptive_state->smoothed_gap_ns +=
+            (gap - adaptive_state->smoothed_gap_ns) >> AERON_IDLE_STRATEGY_ADAPTIVE_GAP_SMOOTHING_SHIFT;
+    }
+    else
+    {
+        adaptive_state->smoothed_gap_ns -=
+            (adaptive_state->smoothed_gap_ns - gap) >> AERON_IDLE_STRATEGY_ADAPTIVE_GAP_SMOOTHING_SHIFT;
+    }
+
+    const uint64_t spin_period_ns = adaptive_state->smoothed_gap_ns << 1;
+
+    if (adaptive_state->smoothed_gap_ns > adaptive_state->max_spin_period_ns ||
+        spin_period_ns < adaptive_state->min_spin_period_ns)
+    {
+        adaptive_state->spin_period_ns = adaptive_state->min_spin_period_ns;
+    }
+    else
+    {
+        adaptive_state->spin_period_ns = spin_period_ns < adaptive_state->max_spin_period_ns ?
+            spin_period_ns : adaptive_state->max_spin_period_ns;
+    }
+}
+
+void aeron_idle_strategy_adaptive_idle(void *state, int work_count)
+{
+    aeron_idle_strategy_adaptive_state_t *adaptive_state = (aeron_idle_strategy_adaptive_state_t *)state;
+
+    if (work_count > 0)
+    {
+        if (AERON_IDLE_STRATEGY_ADAPTIVE_STATE_NOT_IDLE != adaptive_state->state)
+        {
+            aeron_idle_strategy_adaptive_on_work(adaptive_state);
+            adaptive_state->state = AERON_IDLE_STRATEGY_ADAPTIVE_STATE_NOT_IDLE;
+        }
+    }
+    else
+    {
+        switch (adaptive_state->state)
+        {
+            case AERON_IDLE_STRATEGY_ADAPTIVE_STATE_NOT_IDLE:
+                adaptive_state->idle_start_ns = aeron_nano_clock();
+                adaptive_state->state = AERON_IDLE_STRATEGY_ADAPTIVE_STATE_SPINNING;
+                break;
+
+            case AERON_IDLE_STRATEGY_ADAPTIVE_STATE_SPINNING:
+                proc_yield();
+                if (aeron_nano_clock() - adaptive_state->idle_start_ns > (int64_t)adaptive_state->spin_period_ns)
+                {
+                    adaptive_state->state = AERON_IDLE_STRATEGY_ADAPTIVE_STATE_YIELDING;
+                    adaptive_state->yields = 0;
+                }
+                break;
+
+            case AERON_IDLE_STRATEGY_ADAPTIVE_STATE_YIELDING:
+                if (++adaptive_state->yields > AERON_IDLE_STRATEGY_ADAPTIVE_MAX_YIELDS)
+                {
+                    adaptive_state->state = AERON_IDLE_STRATEGY_ADAPTIVE_STATE_PARKING;
+                    adaptive_state->park_period_ns = adaptive_state->min_park_period_ns;
+                }
+                else
+                {
+                    sched_yield();
+                }
+                break;
+
+            case AERON_IDLE_STRATEGY_ADAPTIVE_STATE_PARKING:
+            default:
+                aeron_nano_sleep(adaptive_state->park_period_ns);
+                adaptive_state->park_period_ns =
+                    ((adaptive_state->park_period_ns << 1) < adaptive_state->max_park_period_ns) ?
+                        adaptive_state->park_period_ns << 1 : adaptive_state->max_park_period_ns;
+                break;
+        }
+    }
+}
+
+int aeron_idle_strategy_adaptive_state_init(
+    void **state,
+    uint64_t min_spin_period_ns,
+    uint64_t max_spin_period_ns,
+    uint64_t min_park_period_ns,
+    uint64_t max_park_period_ns)
+{
+    if (min_spin_period_ns > max_spin_period_ns || min_park_period_ns > max_park_period_ns)
+    {
+        aeron_set_err(EINVAL, "%s:%d: %s", __FILE__, __LINE__, "min period greater than max period");
+        return -1;
+    }
+
+    if (aeron_alloc(state, sizeof(aeron_idle_strategy_adaptive_state_t)) < 0)
+    {
+        aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
+        return -1;
+    }
+
+    aeron_idle_strategy_adaptive_state_t *adaptive_state = (aeron_idle_strategy_adaptive_state_t *)*state;
+
+    adaptive_state->min_spin_period_ns = min_spin_period_ns;
+    adaptive_state->max_spin_period_ns = max_spin_period_ns;
+    adaptive_state->min_park_period_ns = min_park_period_ns;
+    adaptive_state->max_park_period_ns = max_park_period_ns;
+    adaptive_state->smoothed_gap_ns = max_spin_period_ns;
+    adaptive_state->spin_period_ns = max_spin_period_ns;
+    adaptive_state->park_period_ns = min_park_period_ns;
+    adaptive_state->yields = 0;
+    adaptive_state->idle_start_ns = 0;
+    adaptive_state->state = AERON_IDLE_STRATEGY_ADAPTIVE_STATE_NOT_IDLE;
+
+    return 0;
+}
+
+static int aeron_idle_strategy_adaptive_state_init_args(void **state, const char *env_var, const char *init_args)
+{
+    if (NULL == init_args)
+    {
+        return aeron_idle_strategy_adaptive_state_init(
+            state,
+            AERON_IDLE_STRATEGY_ADAPTIVE_MIN_SPIN_PERIOD_NS,
+            AERON_IDLE_STRATEGY_ADAPTIVE_MAX_SPIN_PERIOD_NS,
+            AERON_IDLE_STRATEGY_ADAPTIVE_MIN_PARK_PERIOD_NS,
+            AERON_IDLE_STRATEGY_ADAPTIVE_MAX_PARK_PERIOD_NS);
+    }
+
+    char min_spin_str[17], max_spin_str[17], min_park_str[17], max_park_str[17];
+
+    int matches = sscanf(
+        init_args,
+        "%16[,.0-9mus]-%16[,.0-9mus]-%16[,.0-9mus]-%16[,.0-9mus]",
+        min_spin_str,
+        max_spin_str,
+        min_park_str,
+        max_park_str);
+
+    if (4 != matches)
+    {
+        aeron_set_err(EINVAL, "%s:%d: %s", __FILE__, __LINE__, "init args malformed");
+        return -1;
+    }
+
+    uint64_t min_spin_ns, max_spin_ns, min_park_ns, max_park_ns;
+    if (aeron_parse_duration_ns(min_spin_str, &min_spin_ns) < 0 ||
+        aeron_parse_duration_ns(max_spin_str, &max_spin_ns) < 0 ||
+        aeron_parse_duration_ns(min_park_str, &min_park_ns) < 0 ||
+        aeron_parse_duration_ns(max_park_str, &max_park_ns) < 0)
+    {
+        aeron_set_err(EINVAL, "%s:%d: %s", __FILE__, __LINE__, "period not parseable");
+        return -1;
+    }
+
+    return aeron_idle_strategy_adaptive_state_init(state, min_spin_ns, max_spin_ns, min_park_ns, max_park_ns);
+}
+
+typedef struct aeron_idle_strategy_tpause_state_stct
+{
+    uint64_t max_spins;
+    uint64_t wait_cycles;
+    uint64_t spins;
+}
+aeron_idle_strategy_tpause_state_t;
+
+void aeron_idle_strategy_tpause_idle(void *state, int work_count)
+{
+    aeron_idle_strategy_tpause_state_t *tpause_state = (aeron_idle_strategy_tpause_state_t *)state;
+
+    if (work_count > 0)
+    {
+        tpause_state->spins = 0;
+    }
+    else if (tpause_state->spins < tpause_state->max_spins)
+    {
+        tpause_state->spins++;
+        proc_yield();
+    }
+    else
+    {
+        proc_timed_pause(tpause_state->wait_cycles);
+    }
+}
+
+int aeron_idle_strategy_tpause_state_init(void **state, uint64_t max_spins, uint64_t wait_cycles)
+{
+    if (aeron_alloc(state, sizeof(aeron_idle_strategy_tpause_state_t)) < 0)
+    {
+        aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
+        return -1;
+    }
+
+    aeron_idle_strategy_tpause_state_t *tpause_state = (aeron_idle_strategy_tpause_state_t *)*state;
+
+    tpause_state->max_spins = max_spins;
+    tpause_state->wait_cycles = wait_cycles;
+    tpause_state->spins = 0;
+
+    return 0;
+}
+
+static int aeron_idle_strategy_tpause_state_init_args(void **state, const char *env_var, const char *init_args)
+{
+    uint64_t max_spins = AERON_IDLE_STRATEGY_TPAUSE_MAX_SPINS;
+    uint64_t wait_cycles = AERON_IDLE_STRATEGY_TPAUSE_WAIT_CYCLES;
+
+    if (NULL != init_args)
+    {
+        char spins_str[21], cycles_str[21], *end_ptr = NULL;
+
+        if (2 != sscanf(init_args, "%20[0-9]-%20[0-9]", spins_str, cycles_str))
+        {
+            aeron_set_err(EINVAL, "%s:%d: %s", __FILE__, __LINE__, "init args malformed");
+            return -1;
+        }
+
+        max_spins = strtoull(spins_str, &end_ptr, 10);
+        wait_cycles = strtoull(cycles_str, &end_ptr, 10);
+    }
+
+    return aeron_idle_strategy_tpause_state_init(state, max_spins, wait_cycles);
+}
+
 static int aeron_idle_strategy_backoff_state_init_args(void **state, const char *env_var, const char *init_args)
 {
     if (NULL == init_args)
@@ -286,6 +534,18 @@ aeron_idle_strategy_t aeron_idle_strategy_backoff =
         aeron_idle_strategy_backoff_state_init_args
     };
 
+aeron_idle_strategy_t aeron_idle_strategy_tpause =
+    {
+        aeron_idle_strategy_tpause_idle,
+        aeron_idle_strategy_tpause_state_init_args
+    };
+
+aeron_idle_strategy_t aeron_idle_strategy_adaptive =
+    {
+        aeron_idle_strategy_adaptive_idle,
+        aeron_idle_strategy_adaptive_state_init_args
+    };
+
 aeron_idle_strategy_func_t aeron_idle_strategy_load(
     const char *idle_strategy_name,
     void **idle_strategy_state,
@@ -326,6 +586,14 @@ aeron_idle_strategy_func_t aeron_idle_strategy_load(
     {
         return aeron_idle_strategy_load("aeron_idle_strategy_backoff", idle_strategy_state, env_var, init_args);
     }
+    else if (strncmp(idle_strategy_name, "tpause", sizeof("tpause") - 1) == 0)
+    {
+        return aeron_idle_strategy_load("aeron_idle_strategy_tpause", idle_strategy_state, env_var, init_args);
+    }
+    else if (strncmp(idle_strategy_name, "adaptive", sizeof("adaptive") - 1) == 0)
+    {
+        return aeron_idle_strategy_load("aeron_idle_strategy_adaptive", idle_strategy_state, env_var, init_args);
+    }
     else
     {
         aeron_idle_strategy_t *idle_strat = NULL;
@@ -394,6 +662,10 @@ int aeron_agent_init(
     runner->on_start_state = on_start_state;
     runner->do_work = do_work;
     runner->on_close = on_close;
+    runner->on_duty_cycle = NULL;
+    runner->duty_cycle_state = NULL;
+    runner->cpu_affinity = NULL;
+    runner->fifo_priority = 0;
     if (aeron_alloc((void **)&runner->role_name, role_name_length + 1) < 0)
     {
         aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
@@ -409,6 +681,19 @@ int aeron_agent_init(
     return 0;
 }
 
+void aeron_agent_set_duty_cycle_func(
+    aeron_agent_runner_t *runner, aeron_agent_duty_cycle_func_t on_duty_cycle, void *duty_cycle_state)
+{
+    runner->duty_cycle_state = duty_cycle_state;
+    runner->on_duty_cycle = on_duty_cycle;
+}
+
+void aeron_agent_set_thread_config(aeron_agent_runner_t *runner, const char *cpu_affinity, int32_t fifo_priority)
+{
+    runner->cpu_affinity = cpu_affinity;
+    runner->fifo_priority = fifo_priority;
+}
+
 static void *agent_main(void *arg)
 {
     aeron_agent_runner_t *runner = (aeron_agent_runner_t *)arg;
@@ -422,7 +707,7 @@ static void *agent_main(void *arg)
 
     while (aeron_agent_is_running(runner))
     {
-        runner->idle_strategy(runner->idle_strategy_state, runner->do_work(runner->agent_state));
+        runner->idle_strategy(runner->idle_strategy_state, aeron_agent_do_work(runner));
     }
 
     return NULL;
@@ -445,6 +730,30 @@ int aeron_agent_start(aeron_agent_runner_t *runner)
         return -1;
     }
 
+    if (NULL != runner->cpu_affinity && '\0' != runner->cpu_affinity[0] &&
+        (pthread_result = aeron_thread_attr_set_affinity(&attr, runner->cpu_affinity)) != 0)
+    {
+        aeron_set_err(
+            pthread_result,
+            "%s cpu affinity %s: %s",
+            runner->role_name,
+            runner->cpu_affinity,
+            strerror(pthread_result));
+        return -1;
+    }
+
+    if (runner->fifo_priority > 0 &&
+        (pthread_result = aeron_thread_attr_set_fifo_priority(&attr, runner->fifo_priority)) != 0)
+    {
+        aeron_set_err(
+            pthread_result,
+            "%s SCHED_FIFO priority %" PRId32 ": %s",
+            runner->role_name,
+            runner->fifo_priority,
+            strerror(pthread_result));
+        return -1;
+    }
+
     if ((pthread_result = aeron_thread_create(&runner->thread, &attr, agent_main, runner)) != 0)
     {
         aeron_set_err(pthread_result, "aeron_thread_create: %s", strerror(pthread_result));
@@ -26,6 +26,8 @@ typedef int (*aeron_agent_do_work_func_t)(void *);
 
 typedef void (*aeron_agent_on_close_func_t)(void *);
 
+typedef void (*aeron_agent_duty_cycle_func_t)(void *, int64_t);
+
 #define AERON_AGENT_STATE_UNUSED 0
 #define AERON_AGENT_STATE_INITED 1
 #define AERON_AGENT_STATE_STARTED 2
@@ -55,9 +57,37 @@ void aeron_idle_strategy_noop_idle(void *state, int work_count);
 
 void aeron_idle_strategy_backoff_idle(void *state, int work_count);
 
+#define AERON_IDLE_STRATEGY_TPAUSE_MAX_SPINS (100)
+#define AERON_IDLE_STRATEGY_TPAUSE_WAIT_CYCLES (10 * 1000)
+
+void aeron_idle_strategy_tpause_idle(void *state, int work_count);
+
+int aeron_idle_strategy_tpause_state_init(void **state, uint64_t max_spins, uint64_t wait_cycles);
+
 int aeron_idle_strategy_backoff_state_init(
     void **state, uint64_t max_spins, uint64_t max_yields, uint64_t min_park_period_ns, uint64_t max_park_period_ns);
 
+#define AERON_IDLE_STRATEGY_ADAPTIVE_MIN_SPIN_PERIOD_NS (1000LL)
+#define AERON_IDLE_STRATEGY_ADAPTIVE_MAX_SPIN_PERIOD_NS (100 * 1000LL)
+#define AERON_IDLE_STRATEGY_ADAPTIVE_MIN_PARK_PERIOD_NS (1000LL)
+#define AERON_IDLE_STRATEGY_ADAPTIVE_MAX_PARK_PERIOD_NS (1 * 1000 * 1000LL)
+#define AERON_IDLE_STRATEGY_ADAPTIVE_MAX_YIELDS (20)
+#define AERON_IDLE_STRATEGY_ADAPTIVE_GAP_SMOOTHING_SHIFT (3)
+
+/*
+ * Spins for a window learned from the smoothed gap between bursts of work, then yields and parks with a doubling
+ * period. While work arrives within the max spin period the window covers twice the typical gap so the agent keeps
+ * busy spin latency, and once gaps grow beyond it the window drops to the min spin period so a quiet agent sleeps.
+ */
+void aeron_idle_strategy_adaptive_idle(void *state, int work_count);
+
+int aeron_idle_strategy_adaptive_state_init(
+    void **state,
+    uint64_t min_spin_period_ns,
+    uint64_t max_spin_period_ns,
+    uint64_t min_park_period_ns,
+    uint64_t max_park_period_ns);
+
 int aeron_idle_strategy_init_null(void **state, const char *env_var, const char *load_args);
 
 typedef struct aeron_agent_runner_stct
@@ -69,6 +99,10 @@ typedef struct aeron_agent_runner_stct
     aeron_agent_on_start_func_t on_start;
     aeron_agent_do_work_func_t do_work;
     aeron_agent_on_close_func_t on_close;
+    aeron_agent_duty_cycle_func_t on_duty_cycle;
+    void *duty_cycle_state;
+    const char *cpu_affinity;
+    int32_t fifo_priority;
     aeron_idle_strategy_func_t idle_strategy;
     aeron_thread_t thread;
     volatile bool running;
@@ -95,11 +129,32 @@ int aeron_agent_init(
     aeron_idle_strategy_func_t idle_strategy_func,
     void *idle_strategy_state);
 
+/*
+ * Have the time taken by each do_work call reported to the given function.
+ */
+void aeron_agent_set_duty_cycle_func(
+    aeron_agent_runner_t *runner, aeron_agent_duty_cycle_func_t on_duty_cycle, void *duty_cycle_state);
+
+/*
+ * Pin the agent thread to a list of cpus such as "1,3-5" and/or run it under SCHED_FIFO when priority is greater than
+ * 0. Applied when the agent is started so a setting that cannot be honoured fails the start.
+ */
+void aeron_agent_set_thread_config(aeron_agent_runner_t *runner, const char *cpu_affinity, int32_t fifo_priority);
+
 int aeron_agent_start(aeron_agent_runner_t *runner);
 
 inline int aeron_agent_do_work(aeron_agent_runner_t *runner)
 {
-    return runner->do_work(runner->agent_state);
+    if (NULL == runner->on_duty_cycle)
+    {
+        return runner->do_work(runner->agent_state);
+    }
+
+    int64_t start_ns = aeron_nano_clock();
+    int work_count = runner->do_work(runner->agent_state);
+    runner->on_duty_cycle(runner->duty_cycle_state, aeron_nano_clock() - start_ns);
+
+    return work_count;
 }
 
 inline bool aeron_agent_is_running(aeron_agent_runner_t *runner)
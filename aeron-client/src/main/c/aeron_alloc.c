@@ -114,3 +114,29 @@ void aeron_free(void *ptr)
 {
     free(ptr);
 }
+
+int aeron_allocator_alloc(aeron_allocator_t *allocator, void **ptr, size_t size)
+{
+    if (NULL == allocator)
+    {
+        return aeron_alloc(ptr, size);
+    }
+
+    return allocator->alloc_func(allocator->state, ptr, size);
+}
+
+void aeron_allocator_free(aeron_allocator_t *allocator, void *ptr, size_t size)
+{
+    if (NULL == ptr)
+    {
+        return;
+    }
+
+    if (NULL == allocator)
+    {
+        aeron_free(ptr);
+        return;
+    }
+
+    allocator->free_func(allocator->state, ptr, size);
+}
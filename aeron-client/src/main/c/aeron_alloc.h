@@ -25,4 +25,22 @@ int aeron_alloc_aligned(void **ptr, size_t *offset, size_t size, size_t alignmen
 int aeron_reallocf(void **ptr, size_t size);
 void aeron_free(void *ptr);
 
+typedef int (*aeron_allocator_alloc_func_t)(void *state, void **ptr, size_t size);
+typedef void (*aeron_allocator_free_func_t)(void *state, void *ptr, size_t size);
+
+/*
+ * Pluggable allocator for resources that are created and freed on a single agent. Frees are sized so an
+ * implementation can keep fixed size slots without a header per allocation. A NULL allocator is the system allocator.
+ */
+typedef struct aeron_allocator_stct
+{
+    aeron_allocator_alloc_func_t alloc_func;
+    aeron_allocator_free_func_t free_func;
+    void *state;
+}
+aeron_allocator_t;
+
+int aeron_allocator_alloc(aeron_allocator_t *allocator, void **ptr, size_t size);
+void aeron_allocator_free(aeron_allocator_t *allocator, void *ptr, size_t size);
+
 #endif //AERON_ALLOC_H
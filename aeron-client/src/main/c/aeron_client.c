@@ -92,6 +92,9 @@ int aeron_init(aeron_t **client, aeron_context_t *context)
         goto error;
     }
 
+    aeron_agent_set_thread_config(
+        &_client->runner, _client->context->conductor_cpu_affinity, _client->context->conductor_fifo_priority);
+
     *client = _client;
     return 0;
 
@@ -588,6 +591,70 @@ int aeron_async_add_counter_poll(aeron_counter_t **counter, aeron_async_add_coun
     }
 }
 
+int aeron_async_add_counter_lease(aeron_async_add_counter_lease_t **async, aeron_t *client, int32_t counter_count)
+{
+    if (NULL == async || NULL == client)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_async_add_counter_lease: %s", strerror(EINVAL));
+        return -1;
+    }
+
+    return aeron_client_conductor_async_add_counter_lease(async, &client->conductor, counter_count);
+}
+
+int aeron_async_add_counter_lease_poll(aeron_counter_lease_t **lease, aeron_async_add_counter_lease_t *async)
+{
+    if (NULL == lease || NULL == async || AERON_CLIENT_TYPE_COUNTER_LEASE != async->type)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_async_add_counter_lease_poll: %s", strerror(EINVAL));
+        return -1;
+    }
+
+    *lease = NULL;
+
+    aeron_client_registration_status_t registration_status;
+    AERON_GET_VOLATILE(registration_status, async->registration_status);
+
+    switch (registration_status)
+    {
+        case AERON_CLIENT_AWAITING_MEDIA_DRIVER:
+        {
+            return 0;
+        }
+
+        case AERON_CLIENT_ERRORED_MEDIA_DRIVER:
+        {
+            aeron_set_err(EINVAL, "async_add_counter_lease registration (error code %" PRId32 "): %*s",
+                async->error_code, async->error_message_length, async->error_message);
+            aeron_async_cmd_free(async);
+            return -1;
+        }
+
+        case AERON_CLIENT_REGISTERED_MEDIA_DRIVER:
+        {
+            *lease = async->resource.counter_lease;
+            aeron_async_cmd_free(async);
+            return 1;
+        }
+
+        case AERON_CLIENT_TIMEOUT_MEDIA_DRIVER:
+        {
+            aeron_set_err(ETIMEDOUT, "%s", "async_add_counter_lease no response from media driver");
+            aeron_async_cmd_free(async);
+            return -1;
+        }
+
+        default:
+        {
+            aeron_set_err(EINVAL, "async_add_counter_lease async status %s", "unknown");
+            aeron_async_cmd_free(async);
+            return -1;
+        }
+    }
+}
+
 static int aeron_async_destination_poll(aeron_async_destination_t *async)
 {
     if (NULL == async || AERON_CLIENT_TYPE_DESTINATION != async->type)
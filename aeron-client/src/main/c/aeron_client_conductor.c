@@ -28,6 +28,7 @@
 #include "aeron_cnc_file_descriptor.h"
 #include "aeron_image.h"
 #include "aeron_counter.h"
+#include "aeron_counter_lease.h"
 
 int aeron_client_conductor_init(aeron_client_conductor_t *conductor, aeron_context_t *context)
 {
@@ -64,7 +65,18 @@ int aeron_client_conductor_init(aeron_client_conductor_t *conductor, aeron_conte
         return -1;
     }
 
-    if (aeron_int64_to_ptr_hash_map_init(
+    if (aeron_counters_reader_init_compact(
+        &conductor->counters_reader,
+        aeron_cnc_counters_compact_buffer(metadata),
+        (size_t)metadata->counter_compact_buffer_length) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "aeron_client_conductor_init - counters_reader compact: %s", strerror(errcode));
+        return -1;
+    }
+
+    if (aeron_int64_to_ptr_swiss_map_init(
         &conductor->log_buffer_by_id_map, 16, AERON_MAP_DEFAULT_LOAD_FACTOR) < 0)
     {
         int errcode = errno;
@@ -73,7 +85,7 @@ int aeron_client_conductor_init(aeron_client_conductor_t *conductor, aeron_conte
         return -1;
     }
 
-    if (aeron_int64_to_ptr_hash_map_init(
+    if (aeron_int64_to_ptr_swiss_map_init(
         &conductor->resource_by_id_map, 16, AERON_MAP_DEFAULT_LOAD_FACTOR) < 0)
     {
         int errcode = errno;
@@ -82,7 +94,7 @@ int aeron_client_conductor_init(aeron_client_conductor_t *conductor, aeron_conte
         return -1;
     }
 
-    if (aeron_int64_to_ptr_hash_map_init(
+    if (aeron_int64_to_ptr_swiss_map_init(
         &conductor->image_by_id_map, 16, AERON_MAP_DEFAULT_LOAD_FACTOR) < 0)
     {
         int errcode = errno;
@@ -91,7 +103,36 @@ int aeron_client_conductor_init(aeron_client_conductor_t *conductor, aeron_conte
         return -1;
     }
 
+    if (aeron_epoch_reclaimer_init(&conductor->epoch_reclaimer) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "aeron_client_conductor_init - epoch_reclaimer: %s", strerror(errcode));
+        return -1;
+    }
+
     conductor->client_id = aeron_mpsc_rb_next_correlation_id(&conductor->to_driver_buffer);
+    conductor->aeron_dir = context->aeron_dir;
+
+    conductor->has_directed_responses = false;
+    conductor->directed_responses_map.addr = NULL;
+    conductor->directed_responses_map.length = 0;
+    conductor->directed_responses_correlation_id = AERON_NULL_VALUE;
+
+    if (context->use_directed_responses)
+    {
+        aeron_correlated_command_t command;
+
+        command.client_id = conductor->client_id;
+        command.correlation_id = aeron_mpsc_rb_next_correlation_id(&conductor->to_driver_buffer);
+
+        /* sent before any other command so that no response for this client can be broadcast after the switch */
+        if (AERON_RB_SUCCESS == aeron_mpsc_rb_write(
+            &conductor->to_driver_buffer, AERON_COMMAND_ADD_DIRECTED_RESPONSES, &command, sizeof(command)))
+        {
+            conductor->directed_responses_correlation_id = command.correlation_id;
+        }
+    }
 
     conductor->available_counter_handlers.array = NULL;
     conductor->available_counter_handlers.capacity = 0;
@@ -204,6 +245,9 @@ int aeron_client_conductor_init(aeron_client_conductor_t *conductor, aeron_conte
 
     conductor->invoker_mode = context->use_conductor_agent_invoker;
     conductor->pre_touch = context->pre_touch_mapped_memory;
+    conductor->log_buffer_socket_path = context->log_buffer_socket_path;
+    conductor->lock_memory = context->lock_mapped_memory;
+    conductor->lazy_image_mapping = context->lazy_image_mapping;
     conductor->is_terminating = false;
 
     return 0;
@@ -343,6 +387,20 @@ void aeron_client_conductor_on_driver_response(int32_t type_id, uint8_t *buffer,
             break;
         }
 
+        case AERON_RESPONSE_ON_COUNTER_LEASE_READY:
+        {
+            aeron_counter_lease_ready_t *response = (aeron_counter_lease_ready_t *)buffer;
+
+            if (length < sizeof(aeron_counter_lease_ready_t) ||
+                length < sizeof(aeron_counter_lease_ready_t) + ((size_t)response->counter_count * sizeof(int32_t)))
+            {
+                goto malformed_command;
+            }
+
+            result = aeron_client_conductor_on_counter_lease_ready(conductor, response);
+            break;
+        }
+
         case AERON_RESPONSE_ON_CLIENT_TIMEOUT:
         {
             aeron_client_timeout_t *response = (aeron_client_timeout_t *)buffer;
@@ -454,14 +512,26 @@ int aeron_client_conductor_check_liveness(aeron_client_conductor_t *conductor, l
     return 0;
 }
 
+static void aeron_client_conductor_release_image_log_buffer(aeron_client_conductor_t *conductor, aeron_image_t *image)
+{
+    /* a lazily mapped image owns its log buffer and deletes it with the image */
+    if (NULL == image->log_file)
+    {
+        aeron_client_conductor_release_log_buffer(conductor, image->log_buffer);
+    }
+}
+
 int aeron_client_conductor_check_lingering_resources(aeron_client_conductor_t *conductor, long long now_ns)
 {
     int work_count = 0;
 
     /*
      * Currently, only images are lingered and only until refcnt is 0. Even in the case of client timeout,
-     * etc. we let the application call aeron_close to clean up and shutdown the thread, etc.
+     * etc. we let the application call aeron_close to clean up and shutdown the thread, etc. A removed image keeps
+     * the reference its subscription held until no poll can still be using it, which the reclaim releases.
      */
+    work_count += aeron_epoch_reclaimer_reclaim(&conductor->epoch_reclaimer);
+
     for (size_t i = 0, size = conductor->lingering_resources.length, last_index = size - 1; i < size; i++)
     {
         aeron_client_managed_resource_t *resource = &conductor->lingering_resources.array[i];
@@ -470,20 +540,9 @@ int aeron_client_conductor_check_lingering_resources(aeron_client_conductor_t *c
         {
             aeron_image_t *image = resource->resource.image;
 
-            if (INT64_MIN != image->removal_change_number)
-            {
-                if (!aeron_image_is_in_use_by_subscription(
-                    image, aeron_subscription_last_image_list_change_number(image->subscription)))
-                {
-                    aeron_image_decr_refcnt(image);
-                    image->subscription = NULL;
-                    image->removal_change_number = INT64_MIN;
-                }
-            }
-
             if (aeron_image_refcnt_volatile(image) <= 0)
             {
-                aeron_client_conductor_release_log_buffer(conductor, image->log_buffer);
+                aeron_client_conductor_release_image_log_buffer(conductor, image);
                 aeron_image_delete(image);
 
                 aeron_array_fast_unordered_remove(
@@ -583,9 +642,15 @@ int aeron_client_conductor_do_work(aeron_client_conductor_t *conductor)
     work_count += (int)aeron_mpsc_concurrent_array_queue_drain(
         conductor->command_queue, aeron_client_conductor_on_command, conductor, 10);
 
-    work_count += aeron_broadcast_receiver_receive(
+    work_count += aeron_broadcast_receiver_receive_batch(
         &conductor->to_client_buffer, aeron_client_conductor_on_driver_response, conductor);
 
+    if (conductor->has_directed_responses)
+    {
+        work_count += aeron_broadcast_receiver_receive_batch(
+            &conductor->directed_responses, aeron_client_conductor_on_driver_response, conductor);
+    }
+
     if ((result = aeron_client_conductor_on_check_timeouts(conductor)) < 0)
     {
         return work_count;
@@ -622,6 +687,10 @@ void aeron_client_conductor_delete_resource(void *clientd, int64_t key, void *va
             aeron_counter_delete((aeron_counter_t *)value);
             break;
 
+        case AERON_CLIENT_TYPE_COUNTER_LEASE:
+            aeron_counter_lease_delete((aeron_counter_lease_t *)value);
+            break;
+
         case AERON_CLIENT_TYPE_IMAGE:
             aeron_image_delete((aeron_image_t *)value);
             break;
@@ -646,11 +715,14 @@ void aeron_client_conductor_on_close(aeron_client_conductor_t *conductor)
 {
     aeron_client_conductor_notify_close_handlers(conductor);
 
-    aeron_int64_to_ptr_hash_map_for_each(
+    /* no poll can run once closing, so release retired image lists and images before deleting what they refer to */
+    aeron_epoch_reclaimer_close(&conductor->epoch_reclaimer);
+
+    aeron_int64_to_ptr_swiss_map_for_each(
         &conductor->log_buffer_by_id_map, aeron_client_conductor_delete_log_buffer, NULL);
-    aeron_int64_to_ptr_hash_map_for_each(
+    aeron_int64_to_ptr_swiss_map_for_each(
         &conductor->resource_by_id_map, aeron_client_conductor_delete_resource, NULL);
-    aeron_int64_to_ptr_hash_map_for_each(
+    aeron_int64_to_ptr_swiss_map_for_each(
         &conductor->image_by_id_map, aeron_client_conductor_delete_resource, NULL);
 
     for (size_t i = 0, length = conductor->lingering_resources.length; i < length; i++)
@@ -658,14 +730,20 @@ void aeron_client_conductor_on_close(aeron_client_conductor_t *conductor)
         aeron_client_conductor_delete_lingering_resource(&conductor->lingering_resources.array[i]);
     }
 
-    aeron_int64_to_ptr_hash_map_delete(&conductor->log_buffer_by_id_map);
-    aeron_int64_to_ptr_hash_map_delete(&conductor->resource_by_id_map);
-    aeron_int64_to_ptr_hash_map_delete(&conductor->image_by_id_map);
+    aeron_int64_to_ptr_swiss_map_delete(&conductor->log_buffer_by_id_map);
+    aeron_int64_to_ptr_swiss_map_delete(&conductor->resource_by_id_map);
+    aeron_int64_to_ptr_swiss_map_delete(&conductor->image_by_id_map);
     aeron_free(conductor->registering_resources.array);
     aeron_free(conductor->lingering_resources.array);
     aeron_free(conductor->available_counter_handlers.array);
     aeron_free(conductor->unavailable_counter_handlers.array);
     aeron_free(conductor->close_handlers.array);
+
+    if (conductor->has_directed_responses)
+    {
+        aeron_unmap(&conductor->directed_responses_map);
+        conductor->has_directed_responses = false;
+    }
 }
 
 void aeron_client_conductor_force_close_resource(void *clientd, int64_t key, void *value)
@@ -690,6 +768,10 @@ void aeron_client_conductor_force_close_resource(void *clientd, int64_t key, voi
             aeron_counter_force_close((aeron_counter_t *)value);
             break;
 
+        case AERON_CLIENT_TYPE_COUNTER_LEASE:
+            aeron_counter_lease_force_close((aeron_counter_lease_t *)value);
+            break;
+
         case AERON_CLIENT_TYPE_IMAGE:
             aeron_image_force_close((aeron_image_t *)value);
             break;
@@ -710,9 +792,9 @@ void aeron_client_conductor_force_close_resources(aeron_client_conductor_t *cond
      */
     AERON_PUT_VOLATILE(conductor->is_closed, true);
 
-    aeron_int64_to_ptr_hash_map_for_each(
+    aeron_int64_to_ptr_swiss_map_for_each(
         &conductor->image_by_id_map, aeron_client_conductor_force_close_resource, NULL);
-    aeron_int64_to_ptr_hash_map_for_each(
+    aeron_int64_to_ptr_swiss_map_for_each(
         &conductor->resource_by_id_map, aeron_client_conductor_force_close_resource, NULL);
 }
 
@@ -755,11 +837,11 @@ int aeron_client_conductor_linger_or_delete_all_images(
         aeron_image_decr_refcnt(image);
         refcnt = aeron_image_refcnt_volatile(image);
 
-        aeron_int64_to_ptr_hash_map_remove(&conductor->image_by_id_map, image->correlation_id);
+        aeron_int64_to_ptr_swiss_map_remove(&conductor->image_by_id_map, image->correlation_id);
 
         if (refcnt <= 0)
         {
-            aeron_client_conductor_release_log_buffer(conductor, image->log_buffer);
+            aeron_client_conductor_release_image_log_buffer(conductor, image);
             aeron_image_delete(image);
         }
         else if (!image->is_lingering)
@@ -781,12 +863,7 @@ int aeron_client_conductor_linger_or_delete_all_images(
 
             if (subscription == lingering_image->subscription)
             {
-                if (INT64_MIN != lingering_image->removal_change_number)
-                {
-                    aeron_image_decr_refcnt(lingering_image);
-                    lingering_image->subscription = NULL;
-                    lingering_image->removal_change_number = INT64_MIN;
-                }
+                lingering_image->subscription = NULL;
             }
         }
     }
@@ -850,7 +927,7 @@ void aeron_client_conductor_on_cmd_close_publication(void *clientd, void *item)
     aeron_notification_t on_close_complete = publication->on_close_complete;
     void *on_close_complete_clientd = publication->on_close_complete_clientd;
 
-    aeron_int64_to_ptr_hash_map_remove(&conductor->resource_by_id_map, publication->registration_id);
+    aeron_int64_to_ptr_swiss_map_remove(&conductor->resource_by_id_map, publication->registration_id);
 
     aeron_client_conductor_release_log_buffer(conductor, publication->log_buffer);
     aeron_publication_delete(publication);
@@ -917,7 +994,7 @@ void aeron_client_conductor_on_cmd_close_exclusive_publication(void *clientd, vo
     aeron_notification_t on_close_complete = publication->on_close_complete;
     void *on_close_complete_clientd = publication->on_close_complete_clientd;
 
-    aeron_int64_to_ptr_hash_map_remove(&conductor->resource_by_id_map, publication->registration_id);
+    aeron_int64_to_ptr_swiss_map_remove(&conductor->resource_by_id_map, publication->registration_id);
 
     aeron_client_conductor_release_log_buffer(conductor, publication->log_buffer);
     aeron_exclusive_publication_delete(publication);
@@ -984,7 +1061,7 @@ void aeron_client_conductor_on_cmd_close_subscription(void *clientd, void *item)
     aeron_notification_t on_close_complete = subscription->on_close_complete;
     void *on_close_complete_clientd = subscription->on_close_complete_clientd;
 
-    aeron_int64_to_ptr_hash_map_remove(&conductor->resource_by_id_map, subscription->registration_id);
+    aeron_int64_to_ptr_swiss_map_remove(&conductor->resource_by_id_map, subscription->registration_id);
 
     aeron_client_conductor_linger_or_delete_all_images(conductor, subscription);
     aeron_subscription_delete(subscription);
@@ -1062,7 +1139,7 @@ void aeron_client_conductor_on_cmd_close_counter(void *clientd, void *item)
     aeron_notification_t on_close_complete = counter->on_close_complete;
     void *on_close_complete_clientd = counter->on_close_complete_clientd;
 
-    aeron_int64_to_ptr_hash_map_remove(&conductor->resource_by_id_map, counter->registration_id);
+    aeron_int64_to_ptr_swiss_map_remove(&conductor->resource_by_id_map, counter->registration_id);
 
     aeron_counter_delete(counter);
 
@@ -1072,6 +1149,65 @@ void aeron_client_conductor_on_cmd_close_counter(void *clientd, void *item)
     }
 }
 
+void aeron_client_conductor_on_cmd_add_counter_lease(void *clientd, void *item)
+{
+    aeron_client_conductor_t *conductor = (aeron_client_conductor_t *)clientd;
+    aeron_async_add_counter_lease_t *async = (aeron_async_add_counter_lease_t *)item;
+    aeron_counter_lease_command_t command;
+    int ensure_capacity_result = 0, rb_offer_fail_count = 0;
+
+    command.correlated.correlation_id = async->registration_id;
+    command.correlated.client_id = conductor->client_id;
+    command.counter_count = async->counter.lease_length;
+
+    while (AERON_RB_SUCCESS != aeron_mpsc_rb_write(
+        &conductor->to_driver_buffer, AERON_COMMAND_ADD_COUNTER_LEASE, &command, sizeof(command)))
+    {
+        if (++rb_offer_fail_count > AERON_CLIENT_COMMAND_RB_FAIL_THRESHOLD)
+        {
+            char err_buffer[AERON_MAX_PATH];
+
+            snprintf(err_buffer, sizeof(err_buffer) - 1, "ADD_COUNTER_LEASE could not be sent (%s:%d)",
+                __FILE__, __LINE__);
+            conductor->error_handler(conductor->error_handler_clientd, ETIMEDOUT, err_buffer);
+            return;
+        }
+
+        sched_yield();
+    }
+
+    AERON_ARRAY_ENSURE_CAPACITY(
+        ensure_capacity_result, conductor->registering_resources, aeron_client_registering_resource_entry_t);
+    if (ensure_capacity_result < 0)
+    {
+        char err_buffer[AERON_MAX_PATH];
+
+        snprintf(err_buffer, sizeof(err_buffer) - 1, "counter lease registering_resources: %s", aeron_errmsg());
+        conductor->error_handler(conductor->error_handler_clientd, aeron_errcode(), err_buffer);
+        return;
+    }
+
+    conductor->registering_resources.array[conductor->registering_resources.length++].resource = async;
+    async->registration_deadline_ns = (long long)(conductor->nano_clock() + conductor->driver_timeout_ns);
+}
+
+void aeron_client_conductor_on_cmd_close_counter_lease(void *clientd, void *item)
+{
+    aeron_client_conductor_t *conductor = (aeron_client_conductor_t *)clientd;
+    aeron_counter_lease_t *lease = (aeron_counter_lease_t *)item;
+    aeron_notification_t on_close_complete = lease->on_close_complete;
+    void *on_close_complete_clientd = lease->on_close_complete_clientd;
+
+    aeron_int64_to_ptr_swiss_map_remove(&conductor->resource_by_id_map, lease->registration_id);
+
+    aeron_counter_lease_delete(lease);
+
+    if (NULL != on_close_complete)
+    {
+        on_close_complete(on_close_complete_clientd);
+    }
+}
+
 static void aeron_client_conductor_on_cmd_destination(const void *clientd, const void *item, int32_t msg_type_id)
 {
     aeron_client_conductor_t *conductor = (aeron_client_conductor_t *)clientd;
@@ -1099,6 +1235,7 @@ static void aeron_client_conductor_on_cmd_destination(const void *clientd, const
         case AERON_CLIENT_TYPE_IMAGE:
         case AERON_CLIENT_TYPE_LOGBUFFER:
         case AERON_CLIENT_TYPE_COUNTER:
+        case AERON_CLIENT_TYPE_COUNTER_LEASE:
         case AERON_CLIENT_TYPE_DESTINATION:
         {
             char err_buffer[AERON_MAX_PATH];
@@ -1683,6 +1820,92 @@ int aeron_client_conductor_async_close_counter(
     return 0;
 }
 
+int aeron_client_conductor_async_add_counter_lease(
+    aeron_async_add_counter_lease_t **async, aeron_client_conductor_t *conductor, int32_t counter_count)
+{
+    aeron_async_add_counter_lease_t *cmd = NULL;
+
+    *async = NULL;
+
+    if (counter_count <= 0 || counter_count > AERON_COUNTER_CLIENT_LEASE_MAX_LENGTH)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_async_add_counter_lease: counter_count must be between 1 and %d: %" PRId32,
+            AERON_COUNTER_CLIENT_LEASE_MAX_LENGTH, counter_count);
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&cmd, sizeof(aeron_async_add_counter_lease_t)) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "aeron_async_add_counter_lease (%d): %s", errcode, strerror(errcode));
+        return -1;
+    }
+
+    cmd->command_base.func = aeron_client_conductor_on_cmd_add_counter_lease;
+    cmd->command_base.item = NULL;
+    cmd->resource.counter_lease = NULL;
+    cmd->error_message = NULL;
+    cmd->uri = NULL;
+    cmd->counter.key_buffer = NULL;
+    cmd->counter.label_buffer = NULL;
+    cmd->counter.lease_length = counter_count;
+    cmd->registration_id = aeron_mpsc_rb_next_correlation_id(&conductor->to_driver_buffer);
+    cmd->registration_status = AERON_CLIENT_AWAITING_MEDIA_DRIVER;
+    cmd->type = AERON_CLIENT_TYPE_COUNTER_LEASE;
+
+    if (conductor->invoker_mode)
+    {
+        *async = cmd;
+        aeron_client_conductor_on_cmd_add_counter_lease(conductor, cmd);
+    }
+    else
+    {
+        if (aeron_client_conductor_command_offer(conductor->command_queue, cmd) < 0)
+        {
+            aeron_free(cmd);
+            return -1;
+        }
+
+        *async = cmd;
+    }
+
+    return 0;
+}
+
+int aeron_client_conductor_async_close_counter_lease(
+    aeron_client_conductor_t *conductor,
+    aeron_counter_lease_t *lease,
+    aeron_notification_t on_close_complete,
+    void *on_close_complete_clientd)
+{
+    lease->command_base.func = aeron_client_conductor_on_cmd_close_counter_lease;
+    lease->command_base.item = NULL;
+    lease->on_close_complete = on_close_complete;
+    lease->on_close_complete_clientd = on_close_complete_clientd;
+
+    if (aeron_client_conductor_offer_remove_command(
+        conductor, lease->registration_id, AERON_COMMAND_REMOVE_COUNTER) < 0)
+    {
+        return -1;
+    }
+
+    if (conductor->invoker_mode)
+    {
+        aeron_client_conductor_on_cmd_close_counter_lease(conductor, lease);
+    }
+    else
+    {
+        if (aeron_client_conductor_command_offer(conductor->command_queue, lease) < 0)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
 static int aeron_client_conductor_async_destination(
     aeron_async_destination_t **async,
     union aeron_client_registering_resource_un *resource,
@@ -1883,6 +2106,44 @@ int aeron_client_conductor_on_error(aeron_client_conductor_t *conductor, aeron_e
     return 0;
 }
 
+/*
+ * Only reads configuration fixed at init, so images mapped lazily may call it from the thread that polls them.
+ */
+int aeron_client_conductor_map_log_buffer(
+    aeron_client_conductor_t *conductor,
+    aeron_log_buffer_t **log_buffer,
+    const char *log_file,
+    int64_t original_registration_id,
+    bool pre_touch)
+{
+    if (NULL != conductor->log_buffer_socket_path)
+    {
+        if (aeron_log_buffer_create_from_socket(
+            log_buffer,
+            conductor->log_buffer_socket_path,
+            log_file,
+            original_registration_id,
+            pre_touch,
+            (int64_t)conductor->driver_timeout_ms) < 0)
+        {
+            return -1;
+        }
+    }
+    else if (aeron_log_buffer_create(log_buffer, log_file, original_registration_id, pre_touch) < 0)
+    {
+        return -1;
+    }
+
+    if (conductor->lock_memory && aeron_lock_mapped_file(&(*log_buffer)->mapped_raw_log.mapped_file) < 0)
+    {
+        aeron_set_err(aeron_errcode(), "could not lock log buffer %s: %s", log_file, aeron_errmsg());
+        aeron_log_buffer_delete(*log_buffer);
+        return -1;
+    }
+
+    return 0;
+}
+
 int aeron_client_conductor_get_or_create_log_buffer(
     aeron_client_conductor_t *conductor,
     aeron_log_buffer_t **log_buffer,
@@ -1890,15 +2151,16 @@ int aeron_client_conductor_get_or_create_log_buffer(
     int64_t original_registration_id,
     bool pre_touch)
 {
-    if (NULL == (*log_buffer = aeron_int64_to_ptr_hash_map_get(
+    if (NULL == (*log_buffer = aeron_int64_to_ptr_swiss_map_get(
         &conductor->log_buffer_by_id_map, original_registration_id)))
     {
-        if (aeron_log_buffer_create(log_buffer, log_file, original_registration_id, pre_touch) < 0)
+        if (aeron_client_conductor_map_log_buffer(
+            conductor, log_buffer, log_file, original_registration_id, pre_touch) < 0)
         {
             return -1;
         }
 
-        if (aeron_int64_to_ptr_hash_map_put(
+        if (aeron_int64_to_ptr_swiss_map_put(
             &conductor->log_buffer_by_id_map, original_registration_id, *log_buffer) < 0)
         {
             int errcode = errno;
@@ -1919,7 +2181,7 @@ int aeron_client_conductor_release_log_buffer(aeron_client_conductor_t *conducto
 {
     if (--log_buffer->refcnt <= 0)
     {
-        aeron_int64_to_ptr_hash_map_remove(&conductor->log_buffer_by_id_map, log_buffer->correlation_id);
+        aeron_int64_to_ptr_swiss_map_remove(&conductor->log_buffer_by_id_map, log_buffer->correlation_id);
 
         aeron_log_buffer_delete(log_buffer);
     }
@@ -1982,7 +2244,7 @@ int aeron_client_conductor_on_publication_ready(
                 resource->uri = NULL;
                 resource->resource.exclusive_publication = publication;
 
-                if (aeron_int64_to_ptr_hash_map_put(
+                if (aeron_int64_to_ptr_swiss_map_put(
                     &conductor->resource_by_id_map, resource->registration_id, publication) < 0)
                 {
                     int errcode = errno;
@@ -2020,7 +2282,7 @@ int aeron_client_conductor_on_publication_ready(
                 resource->uri = NULL;
                 resource->resource.publication = publication;
 
-                if (aeron_int64_to_ptr_hash_map_put(
+                if (aeron_int64_to_ptr_swiss_map_put(
                     &conductor->resource_by_id_map, resource->registration_id, publication) < 0)
                 {
                     int errcode = errno;
@@ -2108,7 +2370,7 @@ int aeron_client_conductor_on_subscription_ready(
                 last_index);
             conductor->registering_resources.length--;
 
-            if (aeron_int64_to_ptr_hash_map_put(
+            if (aeron_int64_to_ptr_swiss_map_put(
                 &conductor->resource_by_id_map, resource->registration_id, subscription) < 0)
             {
                 int errcode = errno;
@@ -2136,9 +2398,40 @@ int aeron_client_conductor_on_subscription_ready(
     return 0;
 }
 
+int aeron_client_conductor_on_directed_responses_ready(aeron_client_conductor_t *conductor)
+{
+    char path[AERON_MAX_PATH];
+
+    conductor->directed_responses_correlation_id = AERON_NULL_VALUE;
+    aeron_client_responses_location(path, sizeof(path), conductor->aeron_dir, conductor->client_id);
+
+    if (aeron_map_existing_file(&conductor->directed_responses_map, path) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_broadcast_receiver_init(
+        &conductor->directed_responses,
+        conductor->directed_responses_map.addr,
+        conductor->directed_responses_map.length) < 0)
+    {
+        aeron_unmap(&conductor->directed_responses_map);
+        return -1;
+    }
+
+    conductor->has_directed_responses = true;
+
+    return 0;
+}
+
 int aeron_client_conductor_on_operation_success(
     aeron_client_conductor_t *conductor, aeron_operation_succeeded_t *response)
 {
+    if (response->correlation_id == conductor->directed_responses_correlation_id)
+    {
+        return aeron_client_conductor_on_directed_responses_ready(conductor);
+    }
+
     for (size_t i = 0, size = conductor->registering_resources.length, last_index = size - 1; i < size; i++)
     {
         aeron_client_registering_resource_t *resource = conductor->registering_resources.array[i].resource;
@@ -2163,7 +2456,7 @@ int aeron_client_conductor_on_operation_success(
 aeron_subscription_t *aeron_client_conductor_find_subscription_by_id(
     aeron_client_conductor_t *conductor, int64_t registration_id)
 {
-    aeron_subscription_t *subscription = aeron_int64_to_ptr_hash_map_get(
+    aeron_subscription_t *subscription = aeron_int64_to_ptr_swiss_map_get(
         &conductor->resource_by_id_map, registration_id);
 
     if (NULL != subscription && AERON_CLIENT_TYPE_SUBSCRIPTION == subscription->command_base.type)
@@ -2194,9 +2487,9 @@ int aeron_client_conductor_on_available_image(
         memcpy(source_identity_str, source_identity, (size_t)source_identity_length);
         source_identity_str[source_identity_length] = '\0';
 
-        aeron_log_buffer_t *log_buffer;
+        aeron_log_buffer_t *log_buffer = NULL;
 
-        if (aeron_client_conductor_get_or_create_log_buffer(
+        if (!conductor->lazy_image_mapping && aeron_client_conductor_get_or_create_log_buffer(
             conductor, &log_buffer, log_file_str, response->correlation_id, conductor->pre_touch) < 0)
         {
             return -1;
@@ -2211,6 +2504,7 @@ int aeron_client_conductor_on_available_image(
             subscription,
             conductor,
             log_buffer,
+            conductor->lazy_image_mapping ? log_file_str : NULL,
             response->subscriber_position_id,
             subscriber_position,
             response->correlation_id,
@@ -2221,7 +2515,7 @@ int aeron_client_conductor_on_available_image(
             return -1;
         }
 
-        if (aeron_int64_to_ptr_hash_map_put(&conductor->image_by_id_map, response->correlation_id, image) < 0)
+        if (aeron_int64_to_ptr_swiss_map_put(&conductor->image_by_id_map, response->correlation_id, image) < 0)
         {
             int errcode = errno;
 
@@ -2235,8 +2529,6 @@ int aeron_client_conductor_on_available_image(
             return -1;
         }
 
-        aeron_client_conductor_subscription_prune_image_lists(subscription);
-
         if (NULL != subscription->on_available_image)
         {
             subscription->on_available_image(subscription->on_available_image_clientd, subscription, image);
@@ -2253,7 +2545,7 @@ int aeron_client_conductor_on_unavailable_image(aeron_client_conductor_t *conduc
 
     if (NULL != subscription)
     {
-        aeron_image_t *image = aeron_int64_to_ptr_hash_map_remove(
+        aeron_image_t *image = aeron_int64_to_ptr_swiss_map_remove(
             &conductor->image_by_id_map, response->correlation_id);
 
         if (NULL != image)
@@ -2263,8 +2555,6 @@ int aeron_client_conductor_on_unavailable_image(aeron_client_conductor_t *conduc
                 return -1;
             }
 
-            aeron_client_conductor_subscription_prune_image_lists(subscription);
-
             if (NULL != subscription->on_unavailable_image)
             {
                 subscription->on_unavailable_image(subscription->on_unavailable_image_clientd, subscription, image);
@@ -2310,7 +2600,7 @@ int aeron_client_conductor_on_counter_ready(aeron_client_conductor_t *conductor,
                 last_index);
             conductor->registering_resources.length--;
 
-            if (aeron_int64_to_ptr_hash_map_put(
+            if (aeron_int64_to_ptr_swiss_map_put(
                 &conductor->resource_by_id_map, resource->registration_id, counter) < 0)
             {
                 int errcode = errno;
@@ -2335,6 +2625,56 @@ int aeron_client_conductor_on_counter_ready(aeron_client_conductor_t *conductor,
     return 0;
 }
 
+int aeron_client_conductor_on_counter_lease_ready(
+    aeron_client_conductor_t *conductor, aeron_counter_lease_ready_t *response)
+{
+    const int32_t *counter_ids = (const int32_t *)((const uint8_t *)response + sizeof(aeron_counter_lease_ready_t));
+
+    for (size_t i = 0, size = conductor->registering_resources.length, last_index = size - 1; i < size; i++)
+    {
+        aeron_client_registering_resource_t *resource = conductor->registering_resources.array[i].resource;
+
+        if (response->correlation_id == resource->registration_id)
+        {
+            aeron_counter_lease_t *lease;
+
+            if (aeron_counter_lease_create(
+                &lease,
+                conductor,
+                response->correlation_id,
+                counter_ids,
+                (size_t)response->counter_count) < 0)
+            {
+                return -1;
+            }
+
+            resource->resource.counter_lease = lease;
+
+            aeron_array_fast_unordered_remove(
+                (uint8_t *)conductor->registering_resources.array,
+                sizeof(aeron_client_registering_resource_entry_t),
+                i,
+                last_index);
+            conductor->registering_resources.length--;
+
+            if (aeron_int64_to_ptr_swiss_map_put(
+                &conductor->resource_by_id_map, resource->registration_id, lease) < 0)
+            {
+                int errcode = errno;
+
+                aeron_set_err(errcode, "on_counter_lease_ready - resource_by_id_map put (%d): %s",
+                    errcode, strerror(errcode));
+                return -1;
+            }
+
+            AERON_PUT_ORDERED(resource->registration_status, AERON_CLIENT_REGISTERED_MEDIA_DRIVER);
+            break;
+        }
+    }
+
+    return 0;
+}
+
 int aeron_client_conductor_on_unavailable_counter(aeron_client_conductor_t *conductor, aeron_counter_update_t *response)
 {
     for (size_t i = 0, length = conductor->unavailable_counter_handlers.length; i < length; i++)
@@ -20,10 +20,12 @@
 #include "concurrent/aeron_mpsc_concurrent_array_queue.h"
 #include "concurrent/aeron_broadcast_receiver.h"
 #include "concurrent/aeron_mpsc_rb.h"
+#include "concurrent/aeron_epoch_reclaimer.h"
 #include "command/aeron_control_protocol.h"
 #include "aeronc.h"
 #include "concurrent/aeron_counters_manager.h"
-#include "collections/aeron_int64_to_ptr_hash_map.h"
+#include "collections/aeron_int64_to_ptr_swiss_map.h"
+#include "util/aeron_fileutil.h"
 
 #define AERON_CLIENT_COMMAND_QUEUE_FAIL_THRESHOLD (10)
 #define AERON_CLIENT_COMMAND_RB_FAIL_THRESHOLD (10)
@@ -47,6 +49,7 @@ typedef enum aeron_client_managed_resource_type_en
     AERON_CLIENT_TYPE_IMAGE,
     AERON_CLIENT_TYPE_LOGBUFFER,
     AERON_CLIENT_TYPE_COUNTER,
+    AERON_CLIENT_TYPE_COUNTER_LEASE,
     AERON_CLIENT_TYPE_DESTINATION
 }
 aeron_client_managed_resource_type_t;
@@ -68,6 +71,7 @@ typedef struct aeron_client_registering_resource_stct
         aeron_exclusive_publication_t *exclusive_publication;
         aeron_subscription_t *subscription;
         aeron_counter_t *counter;
+        aeron_counter_lease_t *counter_lease;
         aeron_client_command_base_t *base_resource;
     }
     resource;
@@ -92,6 +96,7 @@ typedef struct aeron_client_registering_resource_stct
         uint64_t key_buffer_length;
         uint64_t label_buffer_length;
         int32_t type_id;
+        int32_t lease_length;
     }
     counter;
     aeron_client_registration_status_t registration_status;
@@ -154,11 +159,17 @@ typedef struct aeron_client_conductor_stct
 {
     aeron_broadcast_receiver_t to_client_buffer;
     aeron_mpsc_rb_t to_driver_buffer;
+    aeron_broadcast_receiver_t directed_responses;
+    aeron_mapped_file_t directed_responses_map;
+    int64_t directed_responses_correlation_id;
+    bool has_directed_responses;
     aeron_counters_reader_t counters_reader;
 
-    aeron_int64_to_ptr_hash_map_t log_buffer_by_id_map;
-    aeron_int64_to_ptr_hash_map_t resource_by_id_map;
-    aeron_int64_to_ptr_hash_map_t image_by_id_map;
+    aeron_int64_to_ptr_swiss_map_t log_buffer_by_id_map;
+    aeron_int64_to_ptr_swiss_map_t resource_by_id_map;
+    aeron_int64_to_ptr_swiss_map_t image_by_id_map;
+
+    aeron_epoch_reclaimer_t epoch_reclaimer;
 
     struct available_counter_handlers_stct
     {
@@ -219,6 +230,7 @@ typedef struct aeron_client_conductor_stct
     long long time_of_last_keepalive_ns;
 
     int64_t client_id;
+    const char *aeron_dir;
 
     aeron_error_handler_t error_handler;
     void *error_handler_clientd;
@@ -234,8 +246,11 @@ typedef struct aeron_client_conductor_stct
 
     aeron_clock_func_t nano_clock;
     aeron_clock_func_t epoch_clock;
+    const char *log_buffer_socket_path;
     bool invoker_mode;
     bool pre_touch;
+    bool lock_memory;
+    bool lazy_image_mapping;
     bool is_terminating;
     bool is_closed;
 }
@@ -299,6 +314,14 @@ int aeron_client_conductor_async_close_counter(
     aeron_notification_t on_close_complete,
     void *on_close_complete_clientd);
 
+int aeron_client_conductor_async_add_counter_lease(
+    aeron_async_add_counter_lease_t **async, aeron_client_conductor_t *conductor, int32_t counter_count);
+int aeron_client_conductor_async_close_counter_lease(
+    aeron_client_conductor_t *conductor,
+    aeron_counter_lease_t *lease,
+    aeron_notification_t on_close_complete,
+    void *on_close_complete_clientd);
+
 int aeron_client_conductor_async_add_publication_destination(
     aeron_async_destination_t **async,
     aeron_client_conductor_t *conductor,
@@ -342,6 +365,8 @@ int aeron_client_conductor_on_publication_ready(
     aeron_client_conductor_t *conductor, aeron_publication_buffers_ready_t *response);
 int aeron_client_conductor_on_subscription_ready(
     aeron_client_conductor_t *conductor, aeron_subscription_ready_t *response);
+int aeron_client_conductor_on_directed_responses_ready(aeron_client_conductor_t *conductor);
+
 int aeron_client_conductor_on_operation_success(
     aeron_client_conductor_t *conductor, aeron_operation_succeeded_t *response);
 int aeron_client_conductor_on_available_image(
@@ -355,8 +380,16 @@ int aeron_client_conductor_on_unavailable_image(aeron_client_conductor_t *conduc
 int aeron_client_conductor_on_counter_ready(aeron_client_conductor_t *conductor, aeron_counter_update_t *response);
 int aeron_client_conductor_on_unavailable_counter(
     aeron_client_conductor_t *conductor, aeron_counter_update_t *response);
+int aeron_client_conductor_on_counter_lease_ready(
+    aeron_client_conductor_t *conductor, aeron_counter_lease_ready_t *response);
 int aeron_client_conductor_on_client_timeout(aeron_client_conductor_t *conductor, aeron_client_timeout_t *response);
 
+int aeron_client_conductor_map_log_buffer(
+    aeron_client_conductor_t *conductor,
+    aeron_log_buffer_t **log_buffer,
+    const char *log_file,
+    int64_t original_registration_id,
+    bool pre_touch);
 int aeron_client_conductor_get_or_create_log_buffer(
     aeron_client_conductor_t *conductor,
     aeron_log_buffer_t **log_buffer,
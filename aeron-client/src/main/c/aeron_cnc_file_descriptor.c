@@ -27,6 +27,7 @@ extern uint8_t *aeron_cnc_to_driver_buffer(aeron_cnc_metadata_t *metadata);
 extern uint8_t *aeron_cnc_to_clients_buffer(aeron_cnc_metadata_t *metadata);
 extern uint8_t *aeron_cnc_counters_metadata_buffer(aeron_cnc_metadata_t *metadata);
 extern uint8_t *aeron_cnc_counters_values_buffer(aeron_cnc_metadata_t *metadata);
+extern uint8_t *aeron_cnc_counters_compact_buffer(aeron_cnc_metadata_t *metadata);
 extern uint8_t *aeron_cnc_error_log_buffer(aeron_cnc_metadata_t *metadata);
 extern size_t aeron_cnc_computed_length(size_t total_length_of_buffers, size_t alignment);
 extern bool aeron_cnc_is_file_length_sufficient(aeron_mapped_file_t *cnc_mmap);
@@ -36,6 +36,7 @@ typedef struct aeron_cnc_metadata_stct
     int64_t client_liveness_timeout;
     int64_t start_timestamp;
     int64_t pid;
+    int32_t counter_compact_buffer_length;
 }
 aeron_cnc_metadata_t;
 #pragma pack(pop)
@@ -76,6 +77,20 @@ inline uint8_t *aeron_cnc_error_log_buffer(aeron_cnc_metadata_t *metadata)
         metadata->counter_values_buffer_length;
 }
 
+/*
+ * The compact counters region follows the error log so the offsets of the other buffers are unchanged. Drivers which
+ * do not create one leave its length zero.
+ */
+inline uint8_t *aeron_cnc_counters_compact_buffer(aeron_cnc_metadata_t *metadata)
+{
+    return (uint8_t *)metadata + AERON_CNC_VERSION_AND_META_DATA_LENGTH +
+        metadata->to_driver_buffer_length +
+        metadata->to_clients_buffer_length +
+        metadata->counter_metadata_buffer_length +
+        metadata->counter_values_buffer_length +
+        metadata->error_log_buffer_length;
+}
+
 inline size_t aeron_cnc_computed_length(size_t total_length_of_buffers, size_t alignment)
 {
     return AERON_ALIGN(AERON_CNC_VERSION_AND_META_DATA_LENGTH + total_length_of_buffers, alignment);
@@ -95,6 +110,11 @@ inline bool aeron_cnc_is_file_length_sufficient(aeron_mapped_file_t *cnc_mmap)
         (size_t)metadata->counter_metadata_buffer_length +
         (size_t)metadata->counter_values_buffer_length;
 
+    if (metadata->counter_compact_buffer_length > 0)
+    {
+        cnc_length += (size_t)metadata->error_log_buffer_length + (size_t)metadata->counter_compact_buffer_length;
+    }
+
     return cnc_mmap->length >= cnc_length;
 }
 
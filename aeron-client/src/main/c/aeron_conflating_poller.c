@@ -0,0 +1,208 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <errno.h>
+
+#include "aeron_conflating_poller.h"
+#include "aeron_alloc.h"
+#include "util/aeron_error.h"
+
+int aeron_conflating_poller_create(
+    aeron_conflating_poller_t **poller,
+    aeron_fragment_handler_t delegate,
+    void *delegate_clientd,
+    aeron_conflation_key_func_t key_func,
+    void *key_clientd,
+    size_t fragment_limit)
+{
+    aeron_conflating_poller_t *_poller;
+
+    if (NULL == poller || NULL == delegate || NULL == key_func || 0 == fragment_limit)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_conflating_poller_create: %s", strerror(EINVAL));
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&_poller, sizeof(aeron_conflating_poller_t)) < 0)
+    {
+        aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&_poller->entries.array, sizeof(aeron_conflation_entry_t) * fragment_limit) < 0)
+    {
+        aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
+        aeron_free(_poller);
+        return -1;
+    }
+
+    /* sized so a full scan of distinct keys never needs to rehash on the poll path */
+    if (aeron_int64_to_ptr_swiss_map_init(&_poller->entry_by_key_map, 2 * fragment_limit, AERON_MAP_DEFAULT_LOAD_FACTOR) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "aeron_conflating_poller_create - entry_by_key_map: %s", strerror(errcode));
+        aeron_free(_poller->entries.array);
+        aeron_free(_poller);
+        return -1;
+    }
+
+    _poller->delegate = delegate;
+    _poller->delegate_clientd = delegate_clientd;
+    _poller->key_func = key_func;
+    _poller->key_clientd = key_clientd;
+    _poller->entries.length = 0;
+    _poller->entries.capacity = fragment_limit;
+    _poller->fragments_read = 0;
+
+    *poller = _poller;
+    return 0;
+}
+
+int aeron_conflating_poller_delete(aeron_conflating_poller_t *poller)
+{
+    if (NULL != poller)
+    {
+        aeron_int64_to_ptr_swiss_map_delete(&poller->entry_by_key_map);
+        aeron_free(poller->entries.array);
+        aeron_free(poller);
+    }
+
+    return 0;
+}
+
+static aeron_controlled_fragment_handler_action_t aeron_conflating_poller_on_fragment(
+    void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header)
+{
+    aeron_conflating_poller_t *poller = (aeron_conflating_poller_t *)clientd;
+
+    if (poller->entries.length >= poller->entries.capacity)
+    {
+        return AERON_ACTION_ABORT;
+    }
+
+    const size_t index = poller->entries.length++;
+    aeron_conflation_entry_t *entry = &poller->entries.array[index];
+
+    entry->buffer = buffer;
+    entry->length = length;
+    entry->header = *header;
+    entry->is_superseded = false;
+    entry->has_key = false;
+
+    /* only whole messages are conflated, the fragments of a larger message are delivered as they are */
+    if (AERON_DATA_HEADER_UNFRAGMENTED == (header->frame->frame_header.flags & AERON_DATA_HEADER_UNFRAGMENTED) &&
+        poller->key_func(poller->key_clientd, buffer, length, &entry->key))
+    {
+        entry->has_key = true;
+
+        void *previous = aeron_int64_to_ptr_swiss_map_get(&poller->entry_by_key_map, entry->key);
+        if (NULL != previous)
+        {
+            poller->entries.array[(uintptr_t)previous - 1].is_superseded = true;
+        }
+
+        aeron_int64_to_ptr_swiss_map_put(&poller->entry_by_key_map, entry->key, (void *)(uintptr_t)(index + 1));
+    }
+
+    return AERON_ACTION_CONTINUE;
+}
+
+/*
+ * The scan peeks ahead without moving the subscriber position, so the frames it points at cannot be overwritten until
+ * the latest value for each key has been delivered and the position is then set past everything that was scanned.
+ */
+int aeron_conflating_poller_image_poll(aeron_conflating_poller_t *poller, aeron_image_t *image)
+{
+    if (NULL == poller || NULL == image)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_conflating_poller_image_poll(NULL): %s", strerror(EINVAL));
+        return -1;
+    }
+
+    if (aeron_image_ensure_mapped(image) < 0)
+    {
+        return -1;
+    }
+
+    const int64_t initial_position = aeron_image_position(image);
+    const int64_t limit_position = initial_position + image->term_length_mask + 1;
+
+    poller->entries.length = 0;
+    const int64_t resulting_position = aeron_image_controlled_peek(
+        image, initial_position, aeron_conflating_poller_on_fragment, poller, limit_position);
+
+    int fragments_delivered = 0;
+    for (size_t i = 0, length = poller->entries.length; i < length; i++)
+    {
+        aeron_conflation_entry_t *entry = &poller->entries.array[i];
+
+        if (entry->has_key)
+        {
+            aeron_int64_to_ptr_swiss_map_remove(&poller->entry_by_key_map, entry->key);
+        }
+
+        if (resulting_position > initial_position &&
+            !entry->is_superseded &&
+            aeron_header_position(&entry->header) <= resulting_position)
+        {
+            poller->delegate(poller->delegate_clientd, entry->buffer, entry->length, &entry->header);
+            fragments_delivered++;
+        }
+    }
+    poller->entries.length = 0;
+
+    if (resulting_position < 0)
+    {
+        return -1;
+    }
+
+    if (resulting_position > initial_position && aeron_image_set_position(image, resulting_position) < 0)
+    {
+        return -1;
+    }
+
+    return fragments_delivered;
+}
+
+static void aeron_conflating_poller_poll_image(aeron_image_t *image, void *clientd)
+{
+    aeron_conflating_poller_t *poller = (aeron_conflating_poller_t *)clientd;
+    const int result = aeron_conflating_poller_image_poll(poller, image);
+
+    if (result > 0)
+    {
+        poller->fragments_read += result;
+    }
+}
+
+int aeron_conflating_poller_poll(aeron_conflating_poller_t *poller, aeron_subscription_t *subscription)
+{
+    if (NULL == poller || NULL == subscription)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_conflating_poller_poll(NULL): %s", strerror(EINVAL));
+        return -1;
+    }
+
+    poller->fragments_read = 0;
+    aeron_subscription_for_each_image(subscription, aeron_conflating_poller_poll_image, poller);
+
+    return poller->fragments_read;
+}
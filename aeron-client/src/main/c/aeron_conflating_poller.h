@@ -0,0 +1,56 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef AERON_C_CONFLATING_POLLER_H
+#define AERON_C_CONFLATING_POLLER_H
+
+#include "aeronc.h"
+#include "aeron_image.h"
+#include "collections/aeron_int64_to_ptr_swiss_map.h"
+
+typedef struct aeron_conflation_entry_stct
+{
+    const uint8_t *buffer;
+    size_t length;
+    aeron_header_t header;
+    int64_t key;
+    bool has_key;
+    bool is_superseded;
+}
+aeron_conflation_entry_t;
+
+typedef struct aeron_conflating_poller_stct
+{
+    aeron_fragment_handler_t delegate;
+    void *delegate_clientd;
+    aeron_conflation_key_func_t key_func;
+    void *key_clientd;
+    aeron_int64_to_ptr_swiss_map_t entry_by_key_map;
+
+    struct aeron_conflating_poller_entries_stct
+    {
+        aeron_conflation_entry_t *array;
+        size_t length;
+        size_t capacity;
+    }
+    entries;
+
+    int fragments_read;
+}
+aeron_conflating_poller_t;
+
+#endif //AERON_C_CONFLATING_POLLER_H
@@ -34,12 +34,18 @@
 #include "aeron_context.h"
 #include "util/aeron_error.h"
 #include "util/aeron_parse_util.h"
+#include "util/aeron_clock.h"
 
 #define AERON_CONTEXT_USE_CONDUCTOR_AGENT_INVOKER_DEFAULT (false)
 #define AERON_CONTEXT_DRIVER_TIMEOUT_MS_DEFAULT (10 * 1000L)
 #define AERON_CONTEXT_KEEPALIVE_INTERVAL_NS_DEFAULT (500 * 1000 * 1000LL)
 #define AERON_CONTEXT_RESOURCE_LINGER_DURATION_NS_DEFAULT (3 * 1000 * 1000 * 1000LL)
 #define AERON_CONTEXT_PRE_TOUCH_MAPPED_MEMORY_DEFAULT (false)
+#define AERON_CONTEXT_DRIVER_CONNECT_SPIN_DEFAULT (false)
+#define AERON_CONTEXT_USE_DIRECTED_RESPONSES_DEFAULT (false)
+#define AERON_CONTEXT_LOCK_MAPPED_MEMORY_DEFAULT (false)
+#define AERON_CONTEXT_LAZY_IMAGE_MAPPING_DEFAULT (false)
+#define AERON_CONTEXT_CONDUCTOR_FIFO_PRIORITY_DEFAULT (0)
 
 #ifdef _MSC_VER
 #define AERON_FILE_SEP '\\'
@@ -106,6 +112,9 @@ int aeron_context_init(aeron_context_t **context)
     _context->driver_timeout_ms = AERON_CONTEXT_DRIVER_TIMEOUT_MS_DEFAULT;
     _context->keepalive_interval_ns = AERON_CONTEXT_KEEPALIVE_INTERVAL_NS_DEFAULT;
     _context->resource_linger_duration_ns = AERON_CONTEXT_RESOURCE_LINGER_DURATION_NS_DEFAULT;
+    _context->conductor_cpu_affinity = getenv(AERON_CLIENT_CONDUCTOR_CPU_AFFINITY_ENV_VAR);
+    _context->log_buffer_socket_path = getenv(AERON_LOG_BUFFER_SOCKET_ENV_VAR);
+    _context->conductor_fifo_priority = AERON_CONTEXT_CONDUCTOR_FIFO_PRIORITY_DEFAULT;
 
     _context->epoch_clock = aeron_epoch_clock;
     _context->nano_clock = aeron_nano_clock;
@@ -133,6 +142,23 @@ int aeron_context_init(aeron_context_t **context)
         _context->driver_timeout_ms = result;
     }
 
+    if ((value = getenv(AERON_CLIENT_CONDUCTOR_FIFO_PRIORITY_ENV_VAR)))
+    {
+        errno = 0;
+        char *end_ptr = NULL;
+        long result = strtol(value, &end_ptr, 0);
+
+        if (0 != errno || '\0' != *end_ptr || result < 0 || result > INT32_MAX)
+        {
+            errno = EINVAL;
+            aeron_set_err(
+                EINVAL, "could not parse conductor priority: %s=%s", AERON_CLIENT_CONDUCTOR_FIFO_PRIORITY_ENV_VAR, value);
+            return -1;
+        }
+
+        _context->conductor_fifo_priority = (int32_t)result;
+    }
+
     if ((value = getenv(AERON_CLIENT_RESOURCE_LINGER_DURATION_ENV_VAR)))
     {
         uint64_t result;
@@ -148,6 +174,19 @@ int aeron_context_init(aeron_context_t **context)
 
     _context->pre_touch_mapped_memory = aeron_parse_bool(
         getenv(AERON_CLIENT_PRE_TOUCH_MAPPED_MEMORY_ENV_VAR), AERON_CONTEXT_PRE_TOUCH_MAPPED_MEMORY_DEFAULT);
+    _context->driver_connect_spin = aeron_parse_bool(
+        getenv(AERON_CLIENT_DRIVER_CONNECT_SPIN_ENV_VAR), AERON_CONTEXT_DRIVER_CONNECT_SPIN_DEFAULT);
+    _context->lock_mapped_memory = aeron_parse_bool(
+        getenv(AERON_CLIENT_LOCK_MAPPED_MEMORY_ENV_VAR), AERON_CONTEXT_LOCK_MAPPED_MEMORY_DEFAULT);
+    _context->lazy_image_mapping = aeron_parse_bool(
+        getenv(AERON_CLIENT_LAZY_IMAGE_MAPPING_ENV_VAR), AERON_CONTEXT_LAZY_IMAGE_MAPPING_DEFAULT);
+    _context->use_directed_responses = aeron_parse_bool(
+        getenv(AERON_CLIENT_DIRECTED_RESPONSES_ENV_VAR), AERON_CONTEXT_USE_DIRECTED_RESPONSES_DEFAULT);
+
+    if (aeron_parse_bool(getenv(AERON_CLIENT_TSC_NANO_CLOCK_ENV_VAR), false) && aeron_tsc_clock_init() == 0)
+    {
+        _context->nano_clock = aeron_tsc_nano_clock;
+    }
 
     if ((_context->idle_strategy_func = aeron_idle_strategy_load(
         "sleeping",
@@ -255,6 +294,116 @@ bool aeron_context_get_pre_touch_mapped_memory(aeron_context_t *context)
     return NULL != context ? context->pre_touch_mapped_memory : AERON_CONTEXT_PRE_TOUCH_MAPPED_MEMORY_DEFAULT;
 }
 
+int aeron_context_set_driver_connect_spin(aeron_context_t *context, bool value)
+{
+    AERON_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->driver_connect_spin = value;
+    return 0;
+}
+
+bool aeron_context_get_driver_connect_spin(aeron_context_t *context)
+{
+    return NULL != context ? context->driver_connect_spin : AERON_CONTEXT_DRIVER_CONNECT_SPIN_DEFAULT;
+}
+
+int aeron_context_set_use_directed_responses(aeron_context_t *context, bool value)
+{
+    AERON_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->use_directed_responses = value;
+    return 0;
+}
+
+bool aeron_context_get_use_directed_responses(aeron_context_t *context)
+{
+    return NULL != context ? context->use_directed_responses : AERON_CONTEXT_USE_DIRECTED_RESPONSES_DEFAULT;
+}
+
+int aeron_context_set_conductor_cpu_affinity(aeron_context_t *context, const char *value)
+{
+    AERON_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->conductor_cpu_affinity = value;
+    return 0;
+}
+
+const char *aeron_context_get_conductor_cpu_affinity(aeron_context_t *context)
+{
+    return NULL != context ? context->conductor_cpu_affinity : NULL;
+}
+
+int aeron_context_set_log_buffer_socket(aeron_context_t *context, const char *value)
+{
+    AERON_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->log_buffer_socket_path = value;
+    return 0;
+}
+
+const char *aeron_context_get_log_buffer_socket(aeron_context_t *context)
+{
+    return NULL != context ? context->log_buffer_socket_path : NULL;
+}
+
+int aeron_context_set_conductor_fifo_priority(aeron_context_t *context, int32_t value)
+{
+    AERON_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->conductor_fifo_priority = value;
+    return 0;
+}
+
+int32_t aeron_context_get_conductor_fifo_priority(aeron_context_t *context)
+{
+    return NULL != context ? context->conductor_fifo_priority : AERON_CONTEXT_CONDUCTOR_FIFO_PRIORITY_DEFAULT;
+}
+
+int aeron_context_set_lock_mapped_memory(aeron_context_t *context, bool value)
+{
+    AERON_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->lock_mapped_memory = value;
+    return 0;
+}
+
+bool aeron_context_get_lock_mapped_memory(aeron_context_t *context)
+{
+    return NULL != context ? context->lock_mapped_memory : AERON_CONTEXT_LOCK_MAPPED_MEMORY_DEFAULT;
+}
+
+int aeron_context_set_lazy_image_mapping(aeron_context_t *context, bool value)
+{
+    AERON_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->lazy_image_mapping = value;
+    return 0;
+}
+
+bool aeron_context_get_lazy_image_mapping(aeron_context_t *context)
+{
+    return NULL != context ? context->lazy_image_mapping : AERON_CONTEXT_LAZY_IMAGE_MAPPING_DEFAULT;
+}
+
+int aeron_context_set_use_tsc_nano_clock(aeron_context_t *context, bool value)
+{
+    AERON_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    if (value && aeron_tsc_clock_init() < 0)
+    {
+        aeron_set_err(ENOTSUP, "%s", "cpu has no invariant TSC");
+        return -1;
+    }
+
+    context->nano_clock = value ? aeron_tsc_nano_clock : aeron_nano_clock;
+    return 0;
+}
+
+bool aeron_context_get_use_tsc_nano_clock(aeron_context_t *context)
+{
+    return NULL != context && aeron_tsc_nano_clock == context->nano_clock;
+}
+
 int aeron_context_set_error_handler(aeron_context_t *context, aeron_error_handler_t handler, void *clientd)
 {
     AERON_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
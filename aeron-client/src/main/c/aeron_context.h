@@ -69,6 +69,14 @@ typedef struct aeron_context_stct
 
     bool use_conductor_agent_invoker;
     bool pre_touch_mapped_memory;
+    bool lock_mapped_memory;
+    bool lazy_image_mapping;
+    bool use_directed_responses;
+    bool driver_connect_spin;
+
+    const char *conductor_cpu_affinity;
+    const char *log_buffer_socket_path;
+    int32_t conductor_fifo_priority;
 
     aeron_clock_func_t nano_clock;
     aeron_clock_func_t epoch_clock;
@@ -0,0 +1,319 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include "aeron_counter_lease.h"
+#include "command/aeron_control_protocol.h"
+
+int aeron_counter_lease_create(
+    aeron_counter_lease_t **lease,
+    aeron_client_conductor_t *conductor,
+    int64_t registration_id,
+    const int32_t *counter_ids,
+    size_t length)
+{
+    aeron_counter_lease_t *_lease;
+
+    *lease = NULL;
+    if (aeron_alloc((void **)&_lease, sizeof(aeron_counter_lease_t)) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "aeron_counter_lease_create (%d): %s", errcode, strerror(errcode));
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&_lease->entries, sizeof(aeron_counter_lease_entry_t) * length) < 0 ||
+        aeron_alloc((void **)&_lease->free_indices, sizeof(size_t) * length) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "aeron_counter_lease_create (%d): %s", errcode, strerror(errcode));
+        aeron_counter_lease_delete(_lease);
+        return -1;
+    }
+
+    _lease->command_base.type = AERON_CLIENT_TYPE_COUNTER_LEASE;
+
+    /* free indices form a stack, so fill it in reverse to hand out counters in the order the driver gave them */
+    for (size_t i = 0; i < length; i++)
+    {
+        _lease->entries[i].registration_id = AERON_NULL_VALUE;
+        _lease->entries[i].counter_id = counter_ids[i];
+        _lease->entries[i].is_allocated = false;
+        _lease->free_indices[i] = length - 1 - i;
+    }
+
+    _lease->conductor = conductor;
+    _lease->registration_id = registration_id;
+    _lease->length = length;
+    _lease->free_length = length;
+    _lease->is_closed = false;
+
+    *lease = _lease;
+    return 0;
+}
+
+int aeron_counter_lease_delete(aeron_counter_lease_t *lease)
+{
+    aeron_free(lease->entries);
+    aeron_free(lease->free_indices);
+    aeron_free(lease);
+    return 0;
+}
+
+void aeron_counter_lease_force_close(aeron_counter_lease_t *lease)
+{
+    AERON_PUT_ORDERED(lease->is_closed, true);
+}
+
+static aeron_counter_lease_entry_t *aeron_counter_lease_find_entry(aeron_counter_lease_t *lease, int32_t counter_id)
+{
+    for (size_t i = 0; i < lease->length; i++)
+    {
+        if (counter_id == lease->entries[i].counter_id)
+        {
+            return &lease->entries[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * The record is taken out of the ALLOCATED state while it is rewritten so readers scanning the counters skip it
+ * rather than see a mix of the old and new registration id, key, and label.
+ */
+static void aeron_counter_lease_write_metadata(
+    aeron_counter_lease_t *lease,
+    int32_t counter_id,
+    int64_t registration_id,
+    int32_t type_id,
+    const uint8_t *key_buffer,
+    size_t key_buffer_length,
+    const char *label_buffer,
+    size_t label_buffer_length)
+{
+    aeron_counters_reader_t *reader = &lease->conductor->counters_reader;
+    aeron_counter_metadata_descriptor_t *metadata = (aeron_counter_metadata_descriptor_t *)(
+        reader->metadata + AERON_COUNTER_METADATA_OFFSET(counter_id));
+    aeron_counter_value_descriptor_t *value = (aeron_counter_value_descriptor_t *)(
+        reader->values + AERON_COUNTER_OFFSET(counter_id));
+
+    if (key_buffer_length > sizeof(metadata->key))
+    {
+        key_buffer_length = sizeof(metadata->key);
+    }
+
+    if (label_buffer_length > sizeof(metadata->label))
+    {
+        label_buffer_length = sizeof(metadata->label);
+    }
+
+    AERON_PUT_ORDERED(metadata->state, AERON_COUNTER_RECORD_RECLAIMED);
+
+    AERON_PUT_ORDERED(value->registration_id, registration_id);
+    metadata->type_id = type_id;
+    memset(metadata->key, 0, sizeof(metadata->key));
+    if (NULL != key_buffer && key_buffer_length > 0)
+    {
+        memcpy(metadata->key, key_buffer, key_buffer_length);
+    }
+
+    if (NULL != label_buffer && label_buffer_length > 0)
+    {
+        memcpy(metadata->label, label_buffer, label_buffer_length);
+    }
+    metadata->label_length = (int32_t)label_buffer_length;
+
+    AERON_PUT_ORDERED(metadata->state, AERON_COUNTER_RECORD_ALLOCATED);
+}
+
+static void aeron_counter_lease_reset_metadata(aeron_counter_lease_t *lease, int32_t counter_id)
+{
+    aeron_counter_client_lease_key_layout_t key =
+        {
+            .registration_id = lease->registration_id,
+            .client_id = lease->conductor->client_id
+        };
+    char label[AERON_MAX_PATH];
+    int label_length = snprintf(
+        label,
+        sizeof(label),
+        "%s: client-id=%" PRId64 " lease=%" PRId64,
+        AERON_COUNTER_CLIENT_LEASE_NAME,
+        key.client_id,
+        key.registration_id);
+
+    aeron_counter_lease_write_metadata(
+        lease,
+        counter_id,
+        AERON_COUNTER_REGISTRATION_ID_DEFAULT,
+        AERON_COUNTER_CLIENT_LEASE_TYPE_ID,
+        (const uint8_t *)&key,
+        sizeof(key),
+        label,
+        (size_t)label_length);
+}
+
+static int aeron_counter_lease_send_update(
+    aeron_counter_lease_t *lease, aeron_counter_lease_entry_t *entry, bool is_allocated)
+{
+    aeron_counter_lease_update_t command;
+
+    command.correlated.correlation_id = lease->registration_id;
+    command.correlated.client_id = lease->conductor->client_id;
+    command.registration_id = entry->registration_id;
+    command.counter_id = entry->counter_id;
+    command.is_allocated = is_allocated ? 1 : 0;
+
+    if (AERON_RB_SUCCESS != aeron_mpsc_rb_write(
+        &lease->conductor->to_driver_buffer, AERON_COMMAND_COUNTER_LEASE_UPDATE, &command, sizeof(command)))
+    {
+        aeron_set_err(ETIMEDOUT, "%s", "COUNTER_LEASE_UPDATE could not be sent");
+        return -1;
+    }
+
+    return 0;
+}
+
+int aeron_counter_lease_allocate(
+    aeron_counter_lease_t *lease,
+    int32_t type_id,
+    const uint8_t *key_buffer,
+    size_t key_buffer_length,
+    const char *label_buffer,
+    size_t label_buffer_length,
+    aeron_counter_constants_t *constants)
+{
+    if (NULL == lease || NULL == constants || AERON_COUNTER_CLIENT_LEASE_TYPE_ID == type_id)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_counter_lease_allocate: %s", strerror(EINVAL));
+        return -1;
+    }
+
+    if (0 == lease->free_length)
+    {
+        errno = ENOSPC;
+        aeron_set_err(ENOSPC, "aeron_counter_lease_allocate: no free counters in lease=%" PRId64,
+            lease->registration_id);
+        return -1;
+    }
+
+    size_t index = lease->free_indices[lease->free_length - 1];
+    aeron_counter_lease_entry_t *entry = &lease->entries[index];
+    aeron_counter_value_descriptor_t *value = (aeron_counter_value_descriptor_t *)(
+        lease->conductor->counters_reader.values + AERON_COUNTER_OFFSET(entry->counter_id));
+
+    entry->registration_id = aeron_mpsc_rb_next_correlation_id(&lease->conductor->to_driver_buffer);
+
+    AERON_PUT_ORDERED(value->counter_value, 0);
+    aeron_counter_lease_write_metadata(
+        lease,
+        entry->counter_id,
+        entry->registration_id,
+        type_id,
+        key_buffer,
+        key_buffer_length,
+        label_buffer,
+        label_buffer_length);
+
+    if (aeron_counter_lease_send_update(lease, entry, true) < 0)
+    {
+        aeron_counter_lease_reset_metadata(lease, entry->counter_id);
+        entry->registration_id = AERON_NULL_VALUE;
+        return -1;
+    }
+
+    entry->is_allocated = true;
+    lease->free_length--;
+
+    constants->registration_id = entry->registration_id;
+    constants->counter_id = entry->counter_id;
+    return 0;
+}
+
+int aeron_counter_lease_free(aeron_counter_lease_t *lease, int32_t counter_id)
+{
+    aeron_counter_lease_entry_t *entry = NULL;
+
+    if (NULL == lease ||
+        NULL == (entry = aeron_counter_lease_find_entry(lease, counter_id)) ||
+        !entry->is_allocated)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_counter_lease_free: counter_id=%" PRId32 " not allocated from lease", counter_id);
+        return -1;
+    }
+
+    aeron_counter_lease_reset_metadata(lease, counter_id);
+
+    if (aeron_counter_lease_send_update(lease, entry, false) < 0)
+    {
+        return -1;
+    }
+
+    entry->is_allocated = false;
+    entry->registration_id = AERON_NULL_VALUE;
+    lease->free_indices[lease->free_length++] = (size_t)(entry - lease->entries);
+
+    return 0;
+}
+
+int64_t *aeron_counter_lease_counter_addr(aeron_counter_lease_t *lease, int32_t counter_id)
+{
+    return aeron_counters_reader_addr(&lease->conductor->counters_reader, counter_id);
+}
+
+size_t aeron_counter_lease_available(aeron_counter_lease_t *lease)
+{
+    return lease->free_length;
+}
+
+int aeron_counter_lease_close(
+    aeron_counter_lease_t *lease, aeron_notification_t on_close_complete, void *on_close_complete_clientd)
+{
+    if (NULL != lease)
+    {
+        bool is_closed;
+
+        AERON_GET_VOLATILE(is_closed, lease->is_closed);
+        if (!is_closed)
+        {
+            AERON_PUT_ORDERED(lease->is_closed, true);
+            if (aeron_client_conductor_async_close_counter_lease(
+                lease->conductor, lease, on_close_complete, on_close_complete_clientd) < 0)
+            {
+                return -1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+bool aeron_counter_lease_is_closed(aeron_counter_lease_t *lease)
+{
+    bool is_closed = false;
+    if (NULL != lease)
+    {
+        AERON_GET_VOLATILE(is_closed, lease->is_closed);
+    }
+    return is_closed;
+}
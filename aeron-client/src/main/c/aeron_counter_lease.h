@@ -0,0 +1,60 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_C_COUNTER_LEASE_H
+#define AERON_C_COUNTER_LEASE_H
+
+#include "aeronc.h"
+#include "aeron_agent.h"
+#include "aeron_context.h"
+#include "aeron_client_conductor.h"
+
+typedef struct aeron_counter_lease_entry_stct
+{
+    int64_t registration_id;
+    int32_t counter_id;
+    bool is_allocated;
+}
+aeron_counter_lease_entry_t;
+
+typedef struct aeron_counter_lease_stct
+{
+    aeron_client_command_base_t command_base;
+    aeron_client_conductor_t *conductor;
+
+    int64_t registration_id;
+    aeron_counter_lease_entry_t *entries;
+    size_t *free_indices;
+    size_t length;
+    size_t free_length;
+
+    aeron_notification_t on_close_complete;
+    void *on_close_complete_clientd;
+    bool is_closed;
+}
+aeron_counter_lease_t;
+
+int aeron_counter_lease_create(
+    aeron_counter_lease_t **lease,
+    aeron_client_conductor_t *conductor,
+    int64_t registration_id,
+    const int32_t *counter_ids,
+    size_t length);
+
+int aeron_counter_lease_delete(aeron_counter_lease_t *lease);
+void aeron_counter_lease_force_close(aeron_counter_lease_t *lease);
+
+#endif //AERON_C_COUNTER_LEASE_H
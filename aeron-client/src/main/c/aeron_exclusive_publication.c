@@ -21,8 +21,77 @@
 #include "aeron_common.h"
 #include "aeron_exclusive_publication.h"
 #include "concurrent/aeron_exclusive_term_appender.h"
+#include "concurrent/aeron_term_scanner.h"
+#include "util/aeron_netutil.h"
 #include "aeron_log_buffer.h"
 
+#define AERON_EXCLUSIVE_PUBLICATION_INLINE_SEND_PARAM "inline-send=true"
+
+static int aeron_exclusive_publication_inline_send_init(
+    aeron_exclusive_publication_t *publication, aeron_counters_reader_t *counters_reader)
+{
+    publication->inline_send.position = NULL;
+    publication->inline_send.sender_limit = NULL;
+    publication->inline_send.fd = -1;
+
+    if (NULL == strstr(publication->channel, AERON_EXCLUSIVE_PUBLICATION_INLINE_SEND_PARAM))
+    {
+        return 0;
+    }
+
+    const int32_t position_counter_id = aeron_counter_heartbeat_timestamp_find_counter_id_by_registration_id(
+        counters_reader, AERON_COUNTER_SENDER_INLINE_POSITION_TYPE_ID, publication->registration_id);
+    const int32_t sender_limit_counter_id = aeron_counter_heartbeat_timestamp_find_counter_id_by_registration_id(
+        counters_reader, AERON_COUNTER_SENDER_LIMIT_TYPE_ID, publication->registration_id);
+
+    if (AERON_NULL_COUNTER_ID == position_counter_id || AERON_NULL_COUNTER_ID == sender_limit_counter_id)
+    {
+        return 0;
+    }
+
+    aeron_counter_metadata_descriptor_t *metadata = (aeron_counter_metadata_descriptor_t *)(
+        counters_reader->metadata + AERON_COUNTER_METADATA_OFFSET(position_counter_id));
+    aeron_sender_inline_position_key_layout_t layout;
+    memcpy(&layout, metadata->key, sizeof(layout));
+    memset(&publication->inline_send.addr, 0, sizeof(publication->inline_send.addr));
+
+    if (AERON_COUNTER_SENDER_INLINE_ADDRESS_IPV6 == layout.address_type)
+    {
+        struct sockaddr_in6 *in6_addr = (struct sockaddr_in6 *)&publication->inline_send.addr;
+        in6_addr->sin6_family = AF_INET6;
+        in6_addr->sin6_port = htons((uint16_t)layout.port);
+        memcpy(&in6_addr->sin6_addr, layout.address, sizeof(struct in6_addr));
+    }
+    else
+    {
+        struct sockaddr_in *in_addr = (struct sockaddr_in *)&publication->inline_send.addr;
+        in_addr->sin_family = AF_INET;
+        in_addr->sin_port = htons((uint16_t)layout.port);
+        memcpy(&in_addr->sin_addr, layout.address, sizeof(struct in_addr));
+    }
+
+    aeron_socket_t fd = aeron_socket(publication->inline_send.addr.ss_family, SOCK_DGRAM, 0);
+    if (fd < 0)
+    {
+        aeron_set_err_from_last_err_code("inline send socket for %s", publication->channel);
+        return -1;
+    }
+
+    if (set_socket_non_blocking(fd) < 0)
+    {
+        aeron_set_err_from_last_err_code("inline send socket non-blocking for %s", publication->channel);
+        aeron_close_socket(fd);
+        return -1;
+    }
+
+    publication->inline_send.fd = fd;
+    publication->inline_send.mtu_length = (size_t)publication->log_meta_data->mtu_length;
+    publication->inline_send.sender_limit = aeron_counters_reader_addr(counters_reader, sender_limit_counter_id);
+    publication->inline_send.position = aeron_counters_reader_addr(counters_reader, position_counter_id);
+
+    return 0;
+}
+
 int aeron_exclusive_publication_create(
     aeron_exclusive_publication_t **publication,
     aeron_client_conductor_t *conductor,
@@ -84,13 +153,36 @@ int aeron_exclusive_publication_create(
     _publication->max_message_length = aeron_frame_compute_max_message_length(term_length);
     _publication->term_buffer_length = (int32_t)term_length;
 
+    if (aeron_exclusive_publication_inline_send_init(_publication, &conductor->counters_reader) < 0)
+    {
+        aeron_free(_publication);
+        return -1;
+    }
+
+    if (aeron_offer_stats_create(&_publication->offer_stats, conductor, channel, registration_id, false) < 0)
+    {
+        if (-1 != _publication->inline_send.fd)
+        {
+            aeron_close_socket(_publication->inline_send.fd);
+        }
+
+        aeron_free(_publication);
+        return -1;
+    }
+
     *publication = _publication;
     return 0;
 }
 
 int aeron_exclusive_publication_delete(aeron_exclusive_publication_t *publication)
 {
+    if (-1 != publication->inline_send.fd)
+    {
+        aeron_close_socket(publication->inline_send.fd);
+    }
+
     aeron_free((void *)publication->channel);
+    aeron_offer_stats_delete(publication->offer_stats);
     aeron_free(publication);
 
     return 0;
@@ -101,6 +193,81 @@ void aeron_exclusive_publication_force_close(aeron_exclusive_publication_t *publ
     AERON_PUT_ORDERED(publication->is_closed, true);
 }
 
+static inline int64_t aeron_exclusive_publication_record_offer(
+    aeron_exclusive_publication_t *publication, size_t length, int64_t result)
+{
+    if (NULL != publication->offer_stats)
+    {
+        aeron_offer_stats_record(publication->offer_stats, length, result);
+    }
+
+    return result;
+}
+
+/*
+ * Frames are sent one datagram each from the highest position sent so far, by this publisher or the Sender, up to the
+ * sender limit. Any left behind by a full socket or the limit are sent by the Sender once its grace period is over.
+ */
+void aeron_exclusive_publication_inline_send(aeron_exclusive_publication_t *publication)
+{
+    int64_t start_position;
+    int64_t sender_limit;
+    AERON_GET_VOLATILE(start_position, *publication->inline_send.position);
+    AERON_GET_VOLATILE(sender_limit, *publication->inline_send.sender_limit);
+
+    const int64_t producer_position = publication->term_begin_position + publication->term_offset;
+    const int64_t limit = producer_position < sender_limit ? producer_position : sender_limit;
+    const int32_t term_length_mask = publication->term_buffer_length - 1;
+    int64_t position = start_position;
+
+    while (position < limit)
+    {
+        const size_t index = aeron_logbuffer_index_by_position(position, publication->position_bits_to_shift);
+        const int32_t term_offset = (int32_t)position & term_length_mask;
+        const size_t window = (size_t)(limit - position);
+        size_t padding = 0;
+
+        uint8_t *ptr = publication->log_buffer->mapped_raw_log.term_buffers[index].addr + term_offset;
+        const size_t available = aeron_term_scanner_scan_for_availability(
+            ptr,
+            (size_t)(publication->term_buffer_length - term_offset),
+            window < publication->inline_send.mtu_length ? window : publication->inline_send.mtu_length,
+            &padding);
+
+        if (available > 0)
+        {
+            struct iovec iov;
+            struct msghdr message;
+
+            iov.iov_base = ptr;
+            iov.iov_len = (uint32_t)available;
+            message.msg_name = &publication->inline_send.addr;
+            message.msg_namelen = AERON_ADDR_LEN(&publication->inline_send.addr);
+            message.msg_iov = &iov;
+            message.msg_iovlen = 1;
+            message.msg_control = NULL;
+            message.msg_controllen = 0;
+            message.msg_flags = 0;
+
+            if (sendmsg(publication->inline_send.fd, &message, 0) < 0)
+            {
+                break;
+            }
+        }
+        else if (0 == padding)
+        {
+            break;
+        }
+
+        position += (int64_t)(available + padding);
+    }
+
+    if (position > start_position)
+    {
+        aeron_counter_propose_max_atomic(publication->inline_send.position, position);
+    }
+}
+
 int aeron_exclusive_publication_close(
     aeron_exclusive_publication_t *publication,
     aeron_notification_t on_close_complete,
@@ -201,7 +368,7 @@ int64_t aeron_exclusive_publication_offer(
         }
     }
 
-    return new_position;
+    return aeron_exclusive_publication_record_offer(publication, length, new_position);
 }
 
 int64_t aeron_exclusive_publication_offerv(
@@ -288,7 +455,7 @@ int64_t aeron_exclusive_publication_offerv(
         }
     }
 
-    return new_position;
+    return aeron_exclusive_publication_record_offer(publication, length, new_position);
 }
 
 int64_t aeron_exclusive_publication_try_claim(
@@ -339,7 +506,7 @@ int64_t aeron_exclusive_publication_try_claim(
         }
     }
 
-    return new_position;
+    return aeron_exclusive_publication_record_offer(publication, length, new_position);
 }
 
 int64_t aeron_exclusive_publication_append_padding(aeron_exclusive_publication_t *publication, size_t length)
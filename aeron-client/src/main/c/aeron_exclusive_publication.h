@@ -21,6 +21,8 @@
 #include "aeron_agent.h"
 #include "aeron_context.h"
 #include "aeron_client_conductor.h"
+#include "aeron_offer_stats.h"
+#include "aeron_socket.h"
 
 typedef struct aeron_exclusive_publication_stct
 {
@@ -50,9 +52,24 @@ typedef struct aeron_exclusive_publication_stct
     int32_t channel_status_indicator_id;
     aeron_notification_t on_close_complete;
     void *on_close_complete_clientd;
+    aeron_offer_stats_t *offer_stats;
 
     bool is_closed;
 
+    /*
+     * Set when the channel has inline-send=true, the publisher then sends the frames it appends itself rather than
+     * waiting for the Sender to pick them up.
+     */
+    struct aeron_exclusive_publication_inline_send_stct
+    {
+        int64_t *position;
+        int64_t *sender_limit;
+        aeron_socket_t fd;
+        struct sockaddr_storage addr;
+        size_t mtu_length;
+    }
+    inline_send;
+
     uint8_t pre_fields_padding[AERON_CACHE_LINE_LENGTH];
     int64_t term_begin_position;
     int32_t term_offset;
@@ -79,6 +96,8 @@ int aeron_exclusive_publication_create(
 int aeron_exclusive_publication_delete(aeron_exclusive_publication_t *publication);
 void aeron_exclusive_publication_force_close(aeron_exclusive_publication_t *publication);
 
+void aeron_exclusive_publication_inline_send(aeron_exclusive_publication_t *publication);
+
 inline void aeron_exclusive_publication_rotate_term(aeron_exclusive_publication_t *publication)
 {
     const int32_t next_term_id = publication->term_id + 1;
@@ -100,7 +119,14 @@ inline int64_t aeron_exclusive_publication_new_position(
 {
     if (resulting_offset > 0)
     {
+        aeron_logbuffer_notify_data(publication->log_meta_data);
         publication->term_offset = resulting_offset;
+
+        if (NULL != publication->inline_send.position)
+        {
+            aeron_exclusive_publication_inline_send(publication);
+        }
+
         return publication->term_begin_position + resulting_offset;
     }
 
@@ -36,6 +36,7 @@ int aeron_buffer_builder_create(aeron_buffer_builder_t **buffer_builder)
     _buffer_builder->buffer = NULL;
     _buffer_builder->buffer_length = 0;
     _buffer_builder->limit = 0;
+    _buffer_builder->is_pooled = false;
 
     *buffer_builder = _buffer_builder;
     return 0;
@@ -78,6 +79,17 @@ int aeron_buffer_builder_ensure_capacity(aeron_buffer_builder_t *buffer_builder,
 
     if (required_capacity > buffer_builder->buffer_length)
     {
+        if (buffer_builder->is_pooled)
+        {
+            errno = EMSGSIZE;
+            aeron_set_err(
+                EMSGSIZE,
+                "message exceeds pooled buffer length: required=%" PRIu64 " length=%" PRIu64,
+                (uint64_t)required_capacity,
+                (uint64_t)buffer_builder->buffer_length);
+            return -1;
+        }
+
         int suitable_capacity = aeron_buffer_builder_find_suitable_capacity(
             buffer_builder->buffer_length, required_capacity);
 
@@ -86,7 +98,7 @@ int aeron_buffer_builder_ensure_capacity(aeron_buffer_builder_t *buffer_builder,
             return -1;
         }
 
-        if (aeron_alloc((void **)&buffer_builder->buffer, (size_t)suitable_capacity) < 0)
+        if (aeron_reallocf((void **)&buffer_builder->buffer, (size_t)suitable_capacity) < 0)
         {
             aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
             return -1;
@@ -107,6 +119,52 @@ void aeron_buffer_builder_delete(aeron_buffer_builder_t *buffer_builder)
     }
 }
 
+int aeron_buffer_builder_pool_init(aeron_buffer_builder_pool_t *pool, size_t pool_size, size_t max_message_length)
+{
+    pool->arena = NULL;
+    pool->builders = NULL;
+    pool->free_builders = NULL;
+    pool->free_count = 0;
+    pool->pool_size = 0;
+
+    if (aeron_alloc((void **)&pool->arena, pool_size * max_message_length) < 0 ||
+        aeron_alloc((void **)&pool->builders, pool_size * sizeof(aeron_buffer_builder_t)) < 0 ||
+        aeron_alloc((void **)&pool->free_builders, pool_size * sizeof(aeron_buffer_builder_t *)) < 0)
+    {
+        aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
+        aeron_buffer_builder_pool_close(pool);
+        return -1;
+    }
+
+    for (size_t i = 0; i < pool_size; i++)
+    {
+        aeron_buffer_builder_t *buffer_builder = &pool->builders[i];
+
+        buffer_builder->buffer = pool->arena + (i * max_message_length);
+        buffer_builder->buffer_length = max_message_length;
+        buffer_builder->limit = 0;
+        buffer_builder->is_pooled = true;
+        pool->free_builders[i] = buffer_builder;
+    }
+
+    pool->free_count = pool_size;
+    pool->pool_size = pool_size;
+
+    return 0;
+}
+
+void aeron_buffer_builder_pool_close(aeron_buffer_builder_pool_t *pool)
+{
+    aeron_free(pool->arena);
+    aeron_free(pool->builders);
+    aeron_free(pool->free_builders);
+    pool->arena = NULL;
+    pool->builders = NULL;
+    pool->free_builders = NULL;
+    pool->free_count = 0;
+    pool->pool_size = 0;
+}
+
 int aeron_image_fragment_assembler_create(
     aeron_image_fragment_assembler_t **assembler,
     aeron_fragment_handler_t delegate,
@@ -175,6 +233,104 @@ void aeron_image_fragment_assembler_handler(
     }
 }
 
+int aeron_image_vectored_fragment_assembler_create(
+    aeron_image_vectored_fragment_assembler_t **assembler,
+    aeron_vectored_fragment_handler_t delegate,
+    void *delegate_clientd)
+{
+    aeron_image_vectored_fragment_assembler_t *_assembler;
+
+    if (aeron_alloc((void **)&_assembler, sizeof(aeron_image_vectored_fragment_assembler_t)) < 0)
+    {
+        aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
+        return -1;
+    }
+
+    _assembler->delegate = delegate;
+    _assembler->delegate_clientd = delegate_clientd;
+    _assembler->iov = NULL;
+    _assembler->iovcnt = 0;
+    _assembler->iov_capacity = 0;
+    _assembler->next_fragment = NULL;
+
+    *assembler = _assembler;
+    return 0;
+}
+
+int aeron_image_vectored_fragment_assembler_delete(aeron_image_vectored_fragment_assembler_t *assembler)
+{
+    if (assembler)
+    {
+        aeron_free(assembler->iov);
+        aeron_free(assembler);
+    }
+
+    return 0;
+}
+
+static int aeron_image_vectored_fragment_assembler_append(
+    aeron_image_vectored_fragment_assembler_t *assembler, const uint8_t *buffer, size_t length)
+{
+    if (assembler->iovcnt == assembler->iov_capacity)
+    {
+        size_t new_capacity = 0 == assembler->iov_capacity ? 16 : assembler->iov_capacity << 1u;
+
+        if (aeron_reallocf((void **)&assembler->iov, new_capacity * sizeof(aeron_iovec_t)) < 0)
+        {
+            aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
+            assembler->iov_capacity = 0;
+            assembler->iovcnt = 0;
+            return -1;
+        }
+
+        assembler->iov_capacity = new_capacity;
+    }
+
+    assembler->iov[assembler->iovcnt].iov_base = (uint8_t *)buffer;
+    assembler->iov[assembler->iovcnt].iov_len = length;
+    assembler->iovcnt++;
+    assembler->next_fragment =
+        buffer + AERON_ALIGN(length + AERON_DATA_HEADER_LENGTH, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+
+    return 0;
+}
+
+void aeron_image_vectored_fragment_assembler_handler(
+    void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header)
+{
+    aeron_image_vectored_fragment_assembler_t *assembler = (aeron_image_vectored_fragment_assembler_t *)clientd;
+    uint8_t flags = header->frame->frame_header.flags;
+
+    if ((flags & AERON_DATA_HEADER_UNFRAGMENTED) == AERON_DATA_HEADER_UNFRAGMENTED)
+    {
+        aeron_iovec_t iov;
+
+        iov.iov_base = (uint8_t *)buffer;
+        iov.iov_len = length;
+        assembler->delegate(assembler->delegate_clientd, &iov, 1, header);
+    }
+    else if (flags & AERON_DATA_HEADER_BEGIN_FLAG)
+    {
+        assembler->iovcnt = 0;
+        aeron_image_vectored_fragment_assembler_append(assembler, buffer, length);
+    }
+    else if (assembler->iovcnt > 0)
+    {
+        if (buffer != assembler->next_fragment ||
+            aeron_image_vectored_fragment_assembler_append(assembler, buffer, length) < 0)
+        {
+            assembler->iovcnt = 0;
+            return;
+        }
+
+        if (flags & AERON_DATA_HEADER_END_FLAG)
+        {
+            assembler->delegate(assembler->delegate_clientd, assembler->iov, assembler->iovcnt, header);
+            assembler->iovcnt = 0;
+        }
+    }
+}
+
 int aeron_image_controlled_fragment_assembler_create(
     aeron_image_controlled_fragment_assembler_t **assembler,
     aeron_controlled_fragment_handler_t delegate,
@@ -271,7 +427,7 @@ int aeron_fragment_assembler_create(
         return -1;
     }
 
-    if (aeron_int64_to_ptr_hash_map_init(
+    if (aeron_int64_to_ptr_swiss_map_init(
         &_assembler->builder_by_session_id_map, 8, AERON_MAP_DEFAULT_LOAD_FACTOR) < 0)
     {
         int errcode = errno;
@@ -295,19 +451,109 @@ void aeron_fragment_assembler_entry_delete(void *clientd, int64_t key, void *val
     aeron_buffer_builder_delete(builder);
 }
 
+int aeron_fragment_assembler_create_pooled(
+    aeron_fragment_assembler_t **assembler,
+    aeron_fragment_handler_t delegate,
+    void *delegate_clientd,
+    size_t max_message_length,
+    size_t max_sessions)
+{
+    aeron_fragment_assembler_t *_assembler;
+
+    if (0 == max_message_length || 0 == max_sessions)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_fragment_assembler_create_pooled: %s", strerror(EINVAL));
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&_assembler, sizeof(aeron_fragment_assembler_t)) < 0)
+    {
+        aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
+        return -1;
+    }
+
+    if (aeron_int64_to_ptr_swiss_map_init(
+        &_assembler->builder_by_session_id_map, 2 * max_sessions, AERON_MAP_DEFAULT_LOAD_FACTOR) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "aeron_fragment_assembler_create_pooled - builder_by_session_id_map: %s",
+            strerror(errcode));
+        aeron_free(_assembler);
+        return -1;
+    }
+
+    if (aeron_buffer_builder_pool_init(&_assembler->pool, max_sessions, max_message_length) < 0)
+    {
+        aeron_int64_to_ptr_swiss_map_delete(&_assembler->builder_by_session_id_map);
+        aeron_free(_assembler);
+        return -1;
+    }
+
+    _assembler->delegate = delegate;
+    _assembler->delegate_clientd = delegate_clientd;
+
+    *assembler = _assembler;
+    return 0;
+}
+
 int aeron_fragment_assembler_delete(aeron_fragment_assembler_t *assembler)
 {
     if (assembler)
     {
-        aeron_int64_to_ptr_hash_map_for_each(
-            &assembler->builder_by_session_id_map, aeron_fragment_assembler_entry_delete, NULL);
-        aeron_int64_to_ptr_hash_map_delete(&assembler->builder_by_session_id_map);
+        if (0 == assembler->pool.pool_size)
+        {
+            aeron_int64_to_ptr_swiss_map_for_each(
+                &assembler->builder_by_session_id_map, aeron_fragment_assembler_entry_delete, NULL);
+        }
+
+        aeron_int64_to_ptr_swiss_map_delete(&assembler->builder_by_session_id_map);
+        aeron_buffer_builder_pool_close(&assembler->pool);
         aeron_free(assembler);
     }
 
     return 0;
 }
 
+int aeron_fragment_assembler_delete_session_buffer(aeron_fragment_assembler_t *assembler, int32_t session_id)
+{
+    if (NULL == assembler)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_fragment_assembler_delete_session_buffer(NULL): %s", strerror(EINVAL));
+        return -1;
+    }
+
+    aeron_buffer_builder_t *buffer_builder = aeron_int64_to_ptr_swiss_map_remove(
+        &assembler->builder_by_session_id_map, session_id);
+
+    if (NULL != buffer_builder)
+    {
+        if (buffer_builder->is_pooled)
+        {
+            aeron_buffer_builder_pool_release(&assembler->pool, buffer_builder);
+        }
+        else
+        {
+            aeron_buffer_builder_delete(buffer_builder);
+        }
+    }
+
+    return 0;
+}
+
+static void aeron_fragment_assembler_release_pooled(aeron_fragment_assembler_t *assembler, int32_t session_id)
+{
+    aeron_buffer_builder_t *buffer_builder = aeron_int64_to_ptr_swiss_map_remove(
+        &assembler->builder_by_session_id_map, session_id);
+
+    if (NULL != buffer_builder)
+    {
+        aeron_buffer_builder_pool_release(&assembler->pool, buffer_builder);
+    }
+}
+
 void aeron_fragment_assembler_handler(
     void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header)
 {
@@ -320,33 +566,58 @@ void aeron_fragment_assembler_handler(
     }
     else
     {
-        aeron_buffer_builder_t *buffer_builder = aeron_int64_to_ptr_hash_map_get(
-            &assembler->builder_by_session_id_map, header->frame->session_id);
+        const int32_t session_id = header->frame->session_id;
+        const bool is_pooled = assembler->pool.pool_size > 0;
+        aeron_buffer_builder_t *buffer_builder = aeron_int64_to_ptr_swiss_map_get(
+            &assembler->builder_by_session_id_map, session_id);
 
         if (flags & AERON_DATA_HEADER_BEGIN_FLAG)
         {
             if (NULL == buffer_builder)
             {
-                if (aeron_buffer_builder_create(&buffer_builder) < 0 ||
-                    aeron_int64_to_ptr_hash_map_put(
-                        &assembler->builder_by_session_id_map, header->frame->session_id, buffer_builder) < 0)
+                if (is_pooled)
+                {
+                    if (NULL == (buffer_builder = aeron_buffer_builder_pool_acquire(&assembler->pool)))
+                    {
+                        return;
+                    }
+                }
+                else if (aeron_buffer_builder_create(&buffer_builder) < 0)
+                {
+                    return;
+                }
+
+                if (aeron_int64_to_ptr_swiss_map_put(
+                    &assembler->builder_by_session_id_map, session_id, buffer_builder) < 0)
                 {
                     return;
                 }
             }
 
             aeron_buffer_builder_reset(buffer_builder);
-            aeron_buffer_builder_append(buffer_builder, buffer, length);
+            if (aeron_buffer_builder_append(buffer_builder, buffer, length) < 0 && is_pooled)
+            {
+                aeron_fragment_assembler_release_pooled(assembler, session_id);
+            }
         }
         else if (buffer_builder && buffer_builder->limit > 0)
         {
-            aeron_buffer_builder_append(buffer_builder, buffer, length);
+            if (aeron_buffer_builder_append(buffer_builder, buffer, length) < 0 && is_pooled)
+            {
+                aeron_fragment_assembler_release_pooled(assembler, session_id);
+                return;
+            }
 
             if (flags & AERON_DATA_HEADER_END_FLAG)
             {
                 assembler->delegate(
                     assembler->delegate_clientd, buffer_builder->buffer, buffer_builder->limit, header);
                 aeron_buffer_builder_reset(buffer_builder);
+
+                if (is_pooled)
+                {
+                    aeron_fragment_assembler_release_pooled(assembler, session_id);
+                }
             }
         }
     }
@@ -365,7 +636,7 @@ int aeron_controlled_fragment_assembler_create(
         return -1;
     }
 
-    if (aeron_int64_to_ptr_hash_map_init(
+    if (aeron_int64_to_ptr_swiss_map_init(
         &_assembler->builder_by_session_id_map, 8, AERON_MAP_DEFAULT_LOAD_FACTOR) < 0)
     {
         int errcode = errno;
@@ -393,9 +664,9 @@ int aeron_controlled_fragment_assembler_delete(aeron_controlled_fragment_assembl
 {
     if (assembler)
     {
-        aeron_int64_to_ptr_hash_map_for_each(
+        aeron_int64_to_ptr_swiss_map_for_each(
             &assembler->builder_by_session_id_map, aeron_controlled_fragment_assembler_entry_delete, NULL);
-        aeron_int64_to_ptr_hash_map_delete(&assembler->builder_by_session_id_map);
+        aeron_int64_to_ptr_swiss_map_delete(&assembler->builder_by_session_id_map);
         aeron_free(assembler);
     }
 
@@ -415,7 +686,7 @@ aeron_controlled_fragment_handler_action_t aeron_controlled_fragment_assembler_h
     }
     else
     {
-        aeron_buffer_builder_t *buffer_builder = aeron_int64_to_ptr_hash_map_get(
+        aeron_buffer_builder_t *buffer_builder = aeron_int64_to_ptr_swiss_map_get(
             &assembler->builder_by_session_id_map, header->frame->session_id);
 
         if (flags & AERON_DATA_HEADER_BEGIN_FLAG)
@@ -423,7 +694,7 @@ aeron_controlled_fragment_handler_action_t aeron_controlled_fragment_assembler_h
             if (NULL == buffer_builder)
             {
                 if (aeron_buffer_builder_create(&buffer_builder) < 0 ||
-                    aeron_int64_to_ptr_hash_map_put(
+                    aeron_int64_to_ptr_swiss_map_put(
                         &assembler->builder_by_session_id_map, header->frame->session_id, buffer_builder) < 0)
                 {
                     return AERON_ACTION_ABORT;
@@ -461,6 +732,9 @@ aeron_controlled_fragment_handler_action_t aeron_controlled_fragment_assembler_h
     return action;
 }
 
+extern aeron_buffer_builder_t *aeron_buffer_builder_pool_acquire(aeron_buffer_builder_pool_t *pool);
+extern void aeron_buffer_builder_pool_release(
+    aeron_buffer_builder_pool_t *pool, aeron_buffer_builder_t *buffer_builder);
 extern void aeron_buffer_builder_reset(aeron_buffer_builder_t *buffer_builder);
 extern int aeron_buffer_builder_append(
     aeron_buffer_builder_t *buffer_builder, const uint8_t *buffer, size_t length);
@@ -20,16 +20,27 @@
 #include <string.h>
 
 #include "aeronc.h"
-#include "collections/aeron_int64_to_ptr_hash_map.h"
+#include "collections/aeron_int64_to_ptr_swiss_map.h"
 
 typedef struct aeron_buffer_builder_stct
 {
     uint8_t *buffer;
     size_t buffer_length;
     size_t limit;
+    bool is_pooled;
 }
 aeron_buffer_builder_t;
 
+typedef struct aeron_buffer_builder_pool_stct
+{
+    uint8_t *arena;
+    aeron_buffer_builder_t *builders;
+    aeron_buffer_builder_t **free_builders;
+    size_t free_count;
+    size_t pool_size;
+}
+aeron_buffer_builder_pool_t;
+
 typedef struct aeron_image_fragment_assembler_stct
 {
     aeron_fragment_handler_t delegate;
@@ -38,6 +49,17 @@ typedef struct aeron_image_fragment_assembler_stct
 }
 aeron_image_fragment_assembler_t;
 
+typedef struct aeron_image_vectored_fragment_assembler_stct
+{
+    aeron_vectored_fragment_handler_t delegate;
+    void *delegate_clientd;
+    aeron_iovec_t *iov;
+    size_t iovcnt;
+    size_t iov_capacity;
+    const uint8_t *next_fragment;
+}
+aeron_image_vectored_fragment_assembler_t;
+
 typedef struct aeron_image_controlled_fragment_assembler_stct
 {
     aeron_controlled_fragment_handler_t delegate;
@@ -50,7 +72,8 @@ typedef struct aeron_fragment_assembler_stct
 {
     aeron_fragment_handler_t delegate;
     void *delegate_clientd;
-    aeron_int64_to_ptr_hash_map_t builder_by_session_id_map;
+    aeron_int64_to_ptr_swiss_map_t builder_by_session_id_map;
+    aeron_buffer_builder_pool_t pool;
 }
 aeron_fragment_assembler_t;
 
@@ -58,7 +81,7 @@ typedef struct aeron_controlled_fragment_assembler_stct
 {
     aeron_controlled_fragment_handler_t delegate;
     void *delegate_clientd;
-    aeron_int64_to_ptr_hash_map_t builder_by_session_id_map;
+    aeron_int64_to_ptr_swiss_map_t builder_by_session_id_map;
 }
 aeron_controlled_fragment_assembler_t;
 
@@ -67,6 +90,28 @@ int aeron_buffer_builder_find_suitable_capacity(size_t current_capacity, size_t
 int aeron_buffer_builder_ensure_capacity(aeron_buffer_builder_t *buffer_builder, size_t additional_capacity);
 void aeron_buffer_builder_delete(aeron_buffer_builder_t *buffer_builder);
 
+int aeron_buffer_builder_pool_init(aeron_buffer_builder_pool_t *pool, size_t pool_size, size_t max_message_length);
+void aeron_buffer_builder_pool_close(aeron_buffer_builder_pool_t *pool);
+
+inline aeron_buffer_builder_t *aeron_buffer_builder_pool_acquire(aeron_buffer_builder_pool_t *pool)
+{
+    if (0 == pool->free_count)
+    {
+        return NULL;
+    }
+
+    aeron_buffer_builder_t *buffer_builder = pool->free_builders[--pool->free_count];
+    buffer_builder->limit = 0;
+
+    return buffer_builder;
+}
+
+inline void aeron_buffer_builder_pool_release(
+    aeron_buffer_builder_pool_t *pool, aeron_buffer_builder_t *buffer_builder)
+{
+    pool->free_builders[pool->free_count++] = buffer_builder;
+}
+
 inline void aeron_buffer_builder_reset(aeron_buffer_builder_t *buffer_builder)
 {
     buffer_builder->limit = 0;
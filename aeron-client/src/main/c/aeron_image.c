@@ -18,8 +18,10 @@
 
 #include "aeron_image.h"
 #include "aeron_alloc.h"
+#include "aeron_windows.h"
 #include "aeron_log_buffer.h"
 #include "aeron_subscription.h"
+#include "concurrent/aeron_term_rebuilder.h"
 
 #ifdef _MSC_VER
 #define _Static_assert static_assert
@@ -55,12 +57,28 @@ _Static_assert(
 _Static_assert(
     offsetof(aeron_header_values_frame_t, reserved_value) == offsetof(aeron_data_header_t, reserved_value),
     "offsetof(aeron_header_values_frame_t, reserved_value) == offsetof(aeron_data_header_t, reserved_value)");
+_Static_assert(
+    offsetof(aeron_image_t, log_buffer) >=
+        offsetof(aeron_image_t, is_lingering) + sizeof(bool) + (2 * AERON_CACHE_LINE_LENGTH),
+    "fields of aeron_image_t read on poll must not share a cache line with those changed by the conductor");
+
+static void aeron_image_set_log_buffer(aeron_image_t *image, aeron_log_buffer_t *log_buffer)
+{
+    aeron_logbuffer_metadata_t *metadata = (aeron_logbuffer_metadata_t *)log_buffer->mapped_raw_log.log_meta_data.addr;
+    int32_t term_length = metadata->term_length;
+
+    image->log_buffer = log_buffer;
+    image->term_length_mask = term_length - 1;
+    image->position_bits_to_shift = (size_t)aeron_number_of_trailing_zeroes(term_length);
+    AERON_PUT_ORDERED(image->metadata, metadata);
+}
 
 int aeron_image_create(
     aeron_image_t **image,
     aeron_subscription_t *subscription,
     aeron_client_conductor_t *conductor,
     aeron_log_buffer_t *log_buffer,
+    const char *log_file,
     int32_t subscriber_position_id,
     int64_t *subscriber_position,
     int64_t correlation_id,
@@ -85,6 +103,17 @@ int aeron_image_create(
     memcpy(_image->source_identity, source_identity, source_identity_length);
     _image->source_identity[source_identity_length] = '\0';
 
+    _image->log_file = NULL;
+    if (NULL != log_file && NULL == (_image->log_file = aeron_strndup(log_file, AERON_MAX_PATH)))
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "aeron_image_create - log_file (%d): %s", errcode, strerror(errcode));
+        aeron_free(_image->source_identity);
+        aeron_free(_image);
+        return -1;
+    }
+
     _image->subscription = subscription;
     _image->log_buffer = log_buffer;
 
@@ -93,28 +122,131 @@ int aeron_image_create(
     _image->conductor = conductor;
     _image->correlation_id = correlation_id;
     _image->session_id = session_id;
-    _image->removal_change_number = INT64_MAX;
     _image->final_position = 0;
     _image->join_position = *subscriber_position;
     _image->refcnt = 1;
+    _image->map_lock = 0;
+    _image->metadata = NULL;
+    _image->term_length_mask = 0;
+    _image->position_bits_to_shift = 0;
 
-    _image->metadata =
-        (aeron_logbuffer_metadata_t *)log_buffer->mapped_raw_log.log_meta_data.addr;
-    int32_t term_length = _image->metadata->term_length;
-
-    _image->term_length_mask = term_length - 1;
-    _image->position_bits_to_shift = (size_t)aeron_number_of_trailing_zeroes(term_length);
+    if (NULL != log_buffer)
+    {
+        aeron_image_set_log_buffer(_image, log_buffer);
+    }
 
     _image->is_closed = false;
     _image->is_lingering = false;
+    _image->receiver_hwm_position = NULL;
 
     *image = _image;
 
     return 0;
 }
 
+/*
+ * The window is half a term from the subscriber position, which the receiver window never exceeds, so frames are only
+ * written where the subscriber has not yet read. The hwm is shared with the receiver and advanced with a CAS, leaving
+ * the driver to scan it for loss and NAK as usual.
+ */
+size_t aeron_image_rebuild_inline(aeron_image_t *image, const uint8_t *buffer, size_t length)
+{
+    if (image->is_closed || aeron_image_ensure_mapped(image) < 0)
+    {
+        return 0;
+    }
+
+    if (NULL == image->receiver_hwm_position)
+    {
+        aeron_counters_reader_t *counters_reader = &image->conductor->counters_reader;
+        const int32_t counter_id = aeron_counter_heartbeat_timestamp_find_counter_id_by_registration_id(
+            counters_reader, AERON_COUNTER_RECEIVER_HWM_TYPE_ID, image->correlation_id);
+
+        if (AERON_NULL_COUNTER_ID == counter_id)
+        {
+            return 0;
+        }
+
+        image->receiver_hwm_position = aeron_counters_reader_addr(counters_reader, counter_id);
+    }
+
+    const aeron_data_header_t *header = (const aeron_data_header_t *)buffer;
+    const int32_t term_length = image->term_length_mask + 1;
+    const int32_t term_offset = header->term_offset;
+
+    if (term_offset < 0 || 0 != (term_offset & (AERON_LOGBUFFER_FRAME_ALIGNMENT - 1)) ||
+        (size_t)term_offset + length > (size_t)term_length)
+    {
+        return 0;
+    }
+
+    const int64_t packet_position = aeron_logbuffer_compute_position(
+        header->term_id, term_offset, image->position_bits_to_shift, image->metadata->initial_term_id);
+    const int64_t proposed_position = packet_position + (int64_t)length;
+    int64_t subscriber_position;
+    AERON_GET_VOLATILE(subscriber_position, *image->subscriber_position);
+
+    if (packet_position < subscriber_position || proposed_position > subscriber_position + (term_length >> 1))
+    {
+        return 0;
+    }
+
+    const size_t index = aeron_logbuffer_index_by_position(packet_position, image->position_bits_to_shift);
+    aeron_term_rebuilder_insert(
+        image->log_buffer->mapped_raw_log.term_buffers[index].addr + term_offset, buffer, length);
+    aeron_logbuffer_notify_data(image->metadata);
+    aeron_counter_propose_max_atomic(image->receiver_hwm_position, proposed_position);
+
+    return length;
+}
+
+int aeron_image_map_log_buffer(aeron_image_t *image)
+{
+    aeron_logbuffer_metadata_t *metadata;
+    int result = 0;
+
+    while (!aeron_cmpxchg32(&image->map_lock, 0, 1))
+    {
+        proc_yield();
+    }
+
+    AERON_GET_VOLATILE(metadata, image->metadata);
+    if (NULL == metadata)
+    {
+        aeron_log_buffer_t *log_buffer;
+
+        if (NULL == image->log_file)
+        {
+            aeron_set_err(EINVAL, "image %" PRId64 " has no log buffer to map", image->correlation_id);
+            result = -1;
+        }
+        else if (aeron_client_conductor_map_log_buffer(
+            image->conductor, &log_buffer, image->log_file, image->correlation_id, image->conductor->pre_touch) < 0)
+        {
+            result = -1;
+        }
+        else
+        {
+            aeron_image_set_log_buffer(image, log_buffer);
+        }
+    }
+
+    AERON_PUT_ORDERED(image->map_lock, 0);
+
+    return result;
+}
+
 int aeron_image_delete(aeron_image_t *image)
 {
+    if (NULL != image->log_file)
+    {
+        if (NULL != image->log_buffer)
+        {
+            aeron_log_buffer_delete(image->log_buffer);
+        }
+        aeron_free(image->log_file);
+    }
+
     aeron_free((void *)image->source_identity);
     aeron_free(image);
 
@@ -123,9 +255,14 @@ int aeron_image_delete(aeron_image_t *image)
 
 void aeron_image_force_close(aeron_image_t *image)
 {
-    int64_t end_of_stream_position;
+    int64_t end_of_stream_position = INT64_MAX;
+    aeron_logbuffer_metadata_t *metadata;
 
-    AERON_GET_VOLATILE(end_of_stream_position, image->metadata->end_of_stream_position);
+    AERON_GET_VOLATILE(metadata, image->metadata);
+    if (NULL != metadata)
+    {
+        AERON_GET_VOLATILE(end_of_stream_position, metadata->end_of_stream_position);
+    }
 
     AERON_PUT_ORDERED(image->final_position, *image->subscriber_position);
     AERON_PUT_ORDERED(image->is_eos, (image->final_position >= end_of_stream_position));
@@ -141,6 +278,11 @@ int aeron_image_constants(aeron_image_t *image, aeron_image_constants_t *constan
         return -1;
     }
 
+    if (aeron_image_ensure_mapped(image) < 0)
+    {
+        return -1;
+    }
+
     constants->subscription = image->subscription;
     constants->source_identity = image->source_identity;
     constants->correlation_id = image->correlation_id;
@@ -189,7 +331,7 @@ int aeron_image_set_position(aeron_image_t *image, int64_t position)
     AERON_GET_VOLATILE(is_closed, image->is_closed);
     if (!is_closed)
     {
-        if (aeron_image_validate_position(image, position) < 0)
+        if (aeron_image_ensure_mapped(image) < 0 || aeron_image_validate_position(image, position) < 0)
         {
             return -1;
         }
@@ -218,6 +360,11 @@ bool aeron_image_is_end_of_stream(aeron_image_t *image)
         return image->is_eos;
     }
 
+    if (aeron_image_ensure_mapped(image) < 0)
+    {
+        return -1;
+    }
+
     AERON_GET_VOLATILE(end_of_stream_position, image->metadata->end_of_stream_position);
     AERON_GET_VOLATILE(subscriber_position, *image->subscriber_position);
 
@@ -242,6 +389,11 @@ int aeron_image_active_transport_count(aeron_image_t *image)
         return 0;
     }
 
+    if (aeron_image_ensure_mapped(image) < 0)
+    {
+        return -1;
+    }
+
     AERON_GET_VOLATILE(active_transport_count, image->metadata->active_transport_count);
 
     return (int)active_transport_count;
@@ -265,15 +417,22 @@ int aeron_image_poll(aeron_image_t *image, aeron_fragment_handler_t handler, voi
         return 0;
     }
 
+    if (aeron_image_ensure_mapped(image) < 0)
+    {
+        return -1;
+    }
+
     const int64_t initial_position = *image->subscriber_position;
     const size_t index = aeron_logbuffer_index_by_position(initial_position, image->position_bits_to_shift);
     const uint8_t *term_buffer = image->log_buffer->mapped_raw_log.term_buffers[index].addr;
     const int32_t initial_offset = (int32_t)initial_position & image->term_length_mask;
     const int32_t capacity = (const int32_t)image->log_buffer->mapped_raw_log.term_length;
     int32_t offset = initial_offset;
+    int32_t prefetch_offset = initial_offset;
 
     while (fragments_read < fragment_limit && offset < capacity)
     {
+        prefetch_offset = aeron_logbuffer_prefetch_ahead(term_buffer, offset, prefetch_offset, capacity);
         aeron_data_header_t *frame = (aeron_data_header_t *)(term_buffer + offset);
         int32_t frame_length, frame_offset;
 
@@ -315,6 +474,140 @@ int aeron_image_poll(aeron_image_t *image, aeron_fragment_handler_t handler, voi
     return (int)fragments_read;
 }
 
+bool aeron_image_is_data_available(aeron_image_t *image)
+{
+    if (aeron_image_ensure_mapped(image) < 0)
+    {
+        return false;
+    }
+
+    const int64_t position = *image->subscriber_position;
+    const size_t index = aeron_logbuffer_index_by_position(position, image->position_bits_to_shift);
+    const uint8_t *term_buffer = image->log_buffer->mapped_raw_log.term_buffers[index].addr;
+    const int32_t offset = (int32_t)position & image->term_length_mask;
+    aeron_data_header_t *frame = (aeron_data_header_t *)(term_buffer + offset);
+    int32_t frame_length;
+
+    AERON_GET_VOLATILE(frame_length, frame->frame_header.frame_length);
+
+    return frame_length > 0;
+}
+
+int aeron_image_wait_for_data(aeron_image_t *image, int64_t timeout_ns)
+{
+    if (NULL == image)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_image_wait_for_data(NULL): %s", strerror(EINVAL));
+        return -1;
+    }
+
+    if (aeron_image_ensure_mapped(image) < 0)
+    {
+        return -1;
+    }
+
+    const int64_t deadline_ns = aeron_nano_clock() + timeout_ns;
+    int32_t original;
+    int result = 0;
+
+    AERON_GET_AND_ADD_INT32(original, image->metadata->data_waiter_count, 1);
+
+    while (!aeron_image_is_closed(image))
+    {
+        int32_t sequence;
+        AERON_GET_VOLATILE(sequence, image->metadata->data_notification_sequence);
+
+        if (aeron_image_is_data_available(image))
+        {
+            result = 1;
+            break;
+        }
+
+        const int64_t remaining_ns = deadline_ns - aeron_nano_clock();
+        if (remaining_ns <= 0)
+        {
+            break;
+        }
+
+        aeron_logbuffer_wait_for_data_notification(
+            image->metadata,
+            sequence,
+            remaining_ns < AERON_LOGBUFFER_DATA_WAIT_SLICE_NS ? remaining_ns : AERON_LOGBUFFER_DATA_WAIT_SLICE_NS);
+    }
+
+    AERON_GET_AND_ADD_INT32(original, image->metadata->data_waiter_count, -1);
+
+    return result;
+}
+
+int aeron_image_batch_poll(aeron_image_t *image, aeron_fragment_t *fragments, size_t fragment_limit)
+{
+    bool is_closed;
+    size_t fragments_read = 0;
+
+    if (NULL == image || NULL == fragments)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_image_batch_poll(NULL): %s", strerror(EINVAL));
+        return -1;
+    }
+
+    AERON_GET_VOLATILE(is_closed, image->is_closed);
+    if (is_closed)
+    {
+        return 0;
+    }
+
+    if (aeron_image_ensure_mapped(image) < 0)
+    {
+        return -1;
+    }
+
+    const int64_t initial_position = *image->subscriber_position;
+    const size_t index = aeron_logbuffer_index_by_position(initial_position, image->position_bits_to_shift);
+    const uint8_t *term_buffer = image->log_buffer->mapped_raw_log.term_buffers[index].addr;
+    const int32_t initial_offset = (int32_t)initial_position & image->term_length_mask;
+    const int32_t capacity = (const int32_t)image->log_buffer->mapped_raw_log.term_length;
+    int32_t offset = initial_offset;
+    int32_t prefetch_offset = initial_offset;
+
+    while (fragments_read < fragment_limit && offset < capacity)
+    {
+        prefetch_offset = aeron_logbuffer_prefetch_ahead(term_buffer, offset, prefetch_offset, capacity);
+        aeron_data_header_t *frame = (aeron_data_header_t *)(term_buffer + offset);
+        int32_t frame_length, frame_offset;
+
+        AERON_GET_VOLATILE(frame_length, frame->frame_header.frame_length);
+
+        if (frame_length <= 0)
+        {
+            break;
+        }
+
+        frame_offset = offset;
+        offset += AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+
+        if (AERON_HDR_TYPE_PAD != frame->frame_header.type)
+        {
+            aeron_fragment_t *fragment = &fragments[fragments_read++];
+
+            fragment->buffer = term_buffer + frame_offset + AERON_DATA_HEADER_LENGTH;
+            fragment->length = (size_t)(frame_length - AERON_DATA_HEADER_LENGTH);
+            fragment->frame = (const aeron_header_values_frame_t *)frame;
+            fragment->position = initial_position + (offset - initial_offset);
+        }
+    }
+
+    int64_t new_position = initial_position + (offset - initial_offset);
+    if (new_position > initial_position)
+    {
+        aeron_counter_set_ordered(image->subscriber_position, new_position);
+    }
+
+    return (int)fragments_read;
+}
+
 int aeron_image_controlled_poll(
     aeron_image_t *image, aeron_controlled_fragment_handler_t handler, void *clientd, size_t fragment_limit)
 {
@@ -334,15 +627,22 @@ int aeron_image_controlled_poll(
         return 0;
     }
 
+    if (aeron_image_ensure_mapped(image) < 0)
+    {
+        return -1;
+    }
+
     int64_t initial_position = *image->subscriber_position;
     const size_t index = aeron_logbuffer_index_by_position(initial_position, image->position_bits_to_shift);
     const uint8_t *term_buffer = image->log_buffer->mapped_raw_log.term_buffers[index].addr;
     const int32_t capacity = (const int32_t)image->log_buffer->mapped_raw_log.term_length;
     int32_t initial_offset = (int32_t)initial_position & image->term_length_mask;
     int32_t offset = initial_offset;
+    int32_t prefetch_offset = initial_offset;
 
     while (fragments_read < fragment_limit && offset < capacity)
     {
+        prefetch_offset = aeron_logbuffer_prefetch_ahead(term_buffer, offset, prefetch_offset, capacity);
         aeron_data_header_t *frame = (aeron_data_header_t *)(term_buffer + offset);
         int32_t frame_length, frame_offset, aligned_frame_length;
 
@@ -423,6 +723,11 @@ int aeron_image_bounded_poll(
         return 0;
     }
 
+    if (aeron_image_ensure_mapped(image) < 0)
+    {
+        return -1;
+    }
+
     const int64_t initial_position = *image->subscriber_position;
     const size_t index = aeron_logbuffer_index_by_position(initial_position, image->position_bits_to_shift);
     const uint8_t *term_buffer = image->log_buffer->mapped_raw_log.term_buffers[index].addr;
@@ -431,9 +736,11 @@ int aeron_image_bounded_poll(
     const int64_t high_limit_offset = limit_position - initial_position + initial_offset;
     const int32_t limit_offset = (int64_t)capacity < high_limit_offset ? capacity : (int32_t)high_limit_offset;
     int32_t offset = initial_offset;
+    int32_t prefetch_offset = initial_offset;
 
     while (fragments_read < fragment_limit && offset < limit_offset)
     {
+        prefetch_offset = aeron_logbuffer_prefetch_ahead(term_buffer, offset, prefetch_offset, limit_offset);
         aeron_data_header_t *frame = (aeron_data_header_t *)(term_buffer + offset);
         int32_t frame_length, frame_offset;
 
@@ -494,6 +801,11 @@ int aeron_image_bounded_controlled_poll(
         return 0;
     }
 
+    if (aeron_image_ensure_mapped(image) < 0)
+    {
+        return -1;
+    }
+
     int64_t initial_position = *image->subscriber_position;
     const size_t index = aeron_logbuffer_index_by_position(initial_position, image->position_bits_to_shift);
     const uint8_t *term_buffer = image->log_buffer->mapped_raw_log.term_buffers[index].addr;
@@ -502,9 +814,11 @@ int aeron_image_bounded_controlled_poll(
     const int64_t high_limit_offset = limit_position - initial_position + initial_offset;
     const int32_t limit_offset = (int64_t)capacity < high_limit_offset ? capacity : (int32_t)high_limit_offset;
     int32_t offset = initial_offset;
+    int32_t prefetch_offset = initial_offset;
 
     while (fragments_read < fragment_limit && offset < limit_offset)
     {
+        prefetch_offset = aeron_logbuffer_prefetch_ahead(term_buffer, offset, prefetch_offset, limit_offset);
         aeron_data_header_t *frame = (aeron_data_header_t *)(term_buffer + offset);
         int32_t frame_length, frame_offset, aligned_frame_length;
 
@@ -588,6 +902,11 @@ int64_t aeron_image_controlled_peek(
         return initial_position;
     }
 
+    if (aeron_image_ensure_mapped(image) < 0)
+    {
+        return -1;
+    }
+
     if (aeron_image_validate_position(image, initial_position) < 0)
     {
         return -1;
@@ -684,6 +1003,11 @@ int aeron_image_block_poll(
         return 0;
     }
 
+    if (aeron_image_ensure_mapped(image) < 0)
+    {
+        return -1;
+    }
+
     const int64_t position = *image->subscriber_position;
     const size_t index = aeron_logbuffer_index_by_position(position, image->position_bits_to_shift);
     const uint8_t *term_buffer = image->log_buffer->mapped_raw_log.term_buffers[index].addr;
@@ -745,6 +1069,119 @@ int aeron_image_block_poll(
     return (int)length;
 }
 
+/*
+ * Scan from offset to the end of the last whole message which fits before limit_offset. A padding frame at offset is
+ * a block on its own. If extend_first_message is set then the first message is completed even when it crosses the
+ * limit, which is safe as the fragments of a message never span a term.
+ */
+static int32_t aeron_image_scan_message_block(
+    const uint8_t *term_buffer, int32_t offset, int32_t limit_offset, int32_t capacity, bool extend_first_message)
+{
+    int32_t scan_offset = offset;
+    int32_t block_end_offset = offset;
+
+    while (scan_offset < capacity)
+    {
+        aeron_data_header_t *frame = (aeron_data_header_t *)(term_buffer + scan_offset);
+        int32_t frame_length, aligned_frame_length;
+
+        AERON_GET_VOLATILE(frame_length, frame->frame_header.frame_length);
+
+        if (frame_length <= 0)
+        {
+            break;
+        }
+
+        aligned_frame_length = AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+        const bool is_over_limit = scan_offset + aligned_frame_length > limit_offset;
+
+        if (AERON_HDR_TYPE_PAD == frame->frame_header.type)
+        {
+            if (offset == scan_offset && (extend_first_message || !is_over_limit))
+            {
+                block_end_offset = scan_offset + aligned_frame_length;
+            }
+
+            break;
+        }
+
+        if (is_over_limit && (offset < block_end_offset || !extend_first_message))
+        {
+            break;
+        }
+
+        scan_offset += aligned_frame_length;
+
+        if (frame->frame_header.flags & AERON_DATA_HEADER_END_FLAG)
+        {
+            block_end_offset = scan_offset;
+
+            if (scan_offset >= limit_offset)
+            {
+                break;
+            }
+        }
+    }
+
+    return block_end_offset;
+}
+
+int aeron_image_controlled_block_poll(
+    aeron_image_t *image, aeron_controlled_block_handler_t handler, void *clientd, size_t block_length_limit)
+{
+    bool is_closed;
+
+    if (NULL == image || NULL == handler)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_image_controlled_block_poll(NULL): %s", strerror(EINVAL));
+        return -1;
+    }
+
+    AERON_GET_VOLATILE(is_closed, image->is_closed);
+    if (is_closed)
+    {
+        return 0;
+    }
+
+    if (aeron_image_ensure_mapped(image) < 0)
+    {
+        return -1;
+    }
+
+    const int64_t position = *image->subscriber_position;
+    const size_t index = aeron_logbuffer_index_by_position(position, image->position_bits_to_shift);
+    const uint8_t *term_buffer = image->log_buffer->mapped_raw_log.term_buffers[index].addr;
+    const int32_t offset = (int32_t)position & image->term_length_mask;
+    const int32_t capacity = (const int32_t)image->log_buffer->mapped_raw_log.term_length;
+    const int64_t high_limit_offset = offset + block_length_limit;
+    const int32_t limit_offset = (int64_t)capacity < high_limit_offset ? capacity : (int32_t)high_limit_offset;
+    const int32_t block_end_offset = aeron_image_scan_message_block(term_buffer, offset, limit_offset, capacity, true);
+
+    if (block_end_offset <= offset)
+    {
+        return 0;
+    }
+
+    const int32_t length = block_end_offset - offset;
+    const int32_t term_id = ((aeron_data_header_t *)(term_buffer + offset))->term_id;
+    const size_t consumed = handler(clientd, term_buffer + offset, (size_t)length, image->session_id, term_id);
+    int32_t committed_length = length;
+
+    if (consumed < (size_t)length)
+    {
+        committed_length = aeron_image_scan_message_block(
+            term_buffer, offset, offset + (int32_t)consumed, capacity, false) - offset;
+    }
+
+    if (committed_length > 0)
+    {
+        aeron_counter_set_ordered(image->subscriber_position, position + committed_length);
+    }
+
+    return (int)committed_length;
+}
+
 bool aeron_image_is_closed(aeron_image_t *image)
 {
     bool is_closed = false;
@@ -757,8 +1194,7 @@ bool aeron_image_is_closed(aeron_image_t *image)
     return is_closed;
 }
 
-extern int64_t aeron_image_removal_change_number(aeron_image_t *image);
-extern bool aeron_image_is_in_use_by_subscription(aeron_image_t *image, int64_t last_change_number);
+extern int aeron_image_ensure_mapped(aeron_image_t *image);
 extern int aeron_image_validate_position(aeron_image_t *image, int64_t position);
 extern int64_t aeron_image_incr_refcnt(aeron_image_t *image);
 extern int64_t aeron_image_decr_refcnt(aeron_image_t *image);
@@ -28,29 +28,30 @@ typedef struct aeron_image_stct
     aeron_client_command_base_t command_base;
     aeron_client_conductor_t *conductor;
     char *source_identity;
-
+    char *log_file;
     aeron_subscription_t *subscription;
-    aeron_log_buffer_t *log_buffer;
-    aeron_logbuffer_metadata_t *metadata;
-
-    int64_t *subscriber_position;
 
+    /* changed by the conductor and by threads taking references as images come and go */
     int64_t correlation_id;
-    int64_t removal_change_number;
     int64_t join_position;
-    int64_t final_position;
     int64_t refcnt;
+    volatile int32_t map_lock;
+    bool is_lingering;
 
+    /* read on every poll */
+    uint8_t pre_fields_padding[2 * AERON_CACHE_LINE_LENGTH];
+    aeron_log_buffer_t *log_buffer;
+    aeron_logbuffer_metadata_t *metadata;
+    int64_t *subscriber_position;
+    int64_t final_position;
     int32_t session_id;
     int32_t term_length_mask;
-
     int32_t subscriber_position_id;
-
     size_t position_bits_to_shift;
-
     bool is_closed;
     bool is_eos;
-    bool is_lingering;
+    int64_t *receiver_hwm_position;
+    uint8_t post_fields_padding[2 * AERON_CACHE_LINE_LENGTH];
 }
 aeron_image_t;
 
@@ -67,6 +68,7 @@ int aeron_image_create(
     aeron_subscription_t *subscription,
     aeron_client_conductor_t *conductor,
     aeron_log_buffer_t *log_buffer,
+    const char *log_file,
     int32_t subscriber_position_id,
     int64_t *subscriber_position,
     int64_t correlation_id,
@@ -75,17 +77,24 @@ int aeron_image_create(
     size_t source_identity_length);
 
 int aeron_image_delete(aeron_image_t *image);
-void aeron_image_force_close(aeron_image_t *image);
 
-inline int64_t aeron_image_removal_change_number(aeron_image_t *image)
-{
-    return image->removal_change_number;
-}
+bool aeron_image_is_data_available(aeron_image_t *image);
+int aeron_image_map_log_buffer(aeron_image_t *image);
 
-inline bool aeron_image_is_in_use_by_subscription(aeron_image_t *image, int64_t last_change_number)
+/*
+ * An image created with a log file rather than a log buffer is mapped by whichever thread first polls or queries it.
+ */
+inline int aeron_image_ensure_mapped(aeron_image_t *image)
 {
-    return image->removal_change_number > last_change_number;
+    return NULL != image->metadata ? 0 : aeron_image_map_log_buffer(image);
 }
+void aeron_image_force_close(aeron_image_t *image);
+
+/*
+ * Rebuild a datagram of data frames an inline subscriber received for the image into its log, as the receiver would.
+ * Returns the length rebuilt, or 0 when it falls outside the window the image may be written in and is dropped.
+ */
+size_t aeron_image_rebuild_inline(aeron_image_t *image, const uint8_t *buffer, size_t length);
 
 inline int aeron_image_validate_position(aeron_image_t *image, int64_t position)
 {
@@ -121,7 +130,7 @@ inline int64_t aeron_image_incr_refcnt(aeron_image_t *image)
 inline int64_t aeron_image_decr_refcnt(aeron_image_t *image)
 {
     int64_t result;
-    AERON_GET_AND_ADD_INT64(result, image->refcnt, -1);
+    AERON_GET_AND_ADD_INT64(result, image->refcnt, INT64_C(-1));
     return result;
 }
 
@@ -0,0 +1,169 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <errno.h>
+#include <string.h>
+
+#include "aeron_latency_histogram.h"
+#include "aeron_image.h"
+#include "aeron_alloc.h"
+#include "util/aeron_bitutil.h"
+#include "util/aeron_clock.h"
+#include "util/aeron_error.h"
+
+static volatile aeron_clock_func_t aeron_send_timestamp_clock = aeron_nano_clock;
+
+int aeron_send_timestamp_clock_init(void)
+{
+    if (aeron_tsc_clock_init() == 0)
+    {
+        aeron_send_timestamp_clock = aeron_tsc_nano_clock;
+        return 1;
+    }
+
+    return 0;
+}
+
+int64_t aeron_send_timestamp_nano_clock(void)
+{
+    return aeron_send_timestamp_clock();
+}
+
+int64_t aeron_send_timestamp_reserved_value_supplier(void *clientd, uint8_t *buffer, size_t frame_length)
+{
+    return aeron_send_timestamp_clock();
+}
+
+static inline size_t aeron_latency_histogram_bucket_index(int64_t value)
+{
+    if (value < AERON_LATENCY_HISTOGRAM_SUB_BUCKET_COUNT)
+    {
+        return (size_t)value;
+    }
+
+    const int msb = 63 - aeron_number_of_leading_zeroes_u64((uint64_t)value);
+    const int shift = msb - AERON_LATENCY_HISTOGRAM_SUB_BUCKET_BITS;
+    const size_t sub_bucket = (size_t)((value >> shift) & (AERON_LATENCY_HISTOGRAM_SUB_BUCKET_COUNT - 1));
+
+    return ((size_t)(shift + 1) * AERON_LATENCY_HISTOGRAM_SUB_BUCKET_COUNT) + sub_bucket;
+}
+
+static inline int64_t aeron_latency_histogram_bucket_upper_bound(size_t index)
+{
+    if (index < AERON_LATENCY_HISTOGRAM_SUB_BUCKET_COUNT)
+    {
+        return (int64_t)index;
+    }
+
+    const int shift = (int)(index / AERON_LATENCY_HISTOGRAM_SUB_BUCKET_COUNT) - 1;
+    const uint64_t sub_bucket = index % AERON_LATENCY_HISTOGRAM_SUB_BUCKET_COUNT;
+    const uint64_t lower_bound = (AERON_LATENCY_HISTOGRAM_SUB_BUCKET_COUNT + sub_bucket) << shift;
+
+    return (int64_t)(lower_bound + (UINT64_C(1) << shift) - 1);
+}
+
+int aeron_latency_histogram_create(aeron_latency_histogram_t **histogram)
+{
+    aeron_latency_histogram_t *_histogram;
+
+    if (NULL == histogram)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_latency_histogram_create: %s", strerror(EINVAL));
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&_histogram, sizeof(aeron_latency_histogram_t)) < 0)
+    {
+        aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
+        return -1;
+    }
+
+    aeron_latency_histogram_reset(_histogram);
+
+    *histogram = _histogram;
+    return 0;
+}
+
+int aeron_latency_histogram_delete(aeron_latency_histogram_t *histogram)
+{
+    aeron_free(histogram);
+    return 0;
+}
+
+void aeron_latency_histogram_reset(aeron_latency_histogram_t *histogram)
+{
+    memset(histogram, 0, sizeof(aeron_latency_histogram_t));
+}
+
+void aeron_latency_histogram_record_value(aeron_latency_histogram_t *histogram, int64_t value_ns)
+{
+    /* clocks of different processes can be a little apart so a negative latency is recorded as zero */
+    const int64_t value = value_ns < 0 ? 0 : value_ns;
+
+    histogram->counts[aeron_latency_histogram_bucket_index(value)]++;
+    histogram->total_count++;
+
+    if (value > histogram->max_value)
+    {
+        histogram->max_value = value;
+    }
+}
+
+int64_t aeron_latency_histogram_record_header(aeron_latency_histogram_t *histogram, aeron_header_t *header)
+{
+    const int64_t latency_ns = aeron_send_timestamp_clock() - header->frame->reserved_value;
+
+    aeron_latency_histogram_record_value(histogram, latency_ns);
+
+    return latency_ns;
+}
+
+int64_t aeron_latency_histogram_count(aeron_latency_histogram_t *histogram)
+{
+    return histogram->total_count;
+}
+
+int64_t aeron_latency_histogram_max(aeron_latency_histogram_t *histogram)
+{
+    return histogram->max_value;
+}
+
+int64_t aeron_latency_histogram_value_at_percentile(aeron_latency_histogram_t *histogram, double percentile)
+{
+    if (0 == histogram->total_count)
+    {
+        return 0;
+    }
+
+    const double clamped = percentile < 0.0 ? 0.0 : (percentile > 100.0 ? 100.0 : percentile);
+    int64_t target_count = (int64_t)((clamped / 100.0) * (double)histogram->total_count + 0.5);
+    target_count = target_count < 1 ? 1 : target_count;
+
+    int64_t count = 0;
+    for (size_t i = 0; i < AERON_LATENCY_HISTOGRAM_BUCKET_COUNT; i++)
+    {
+        count += histogram->counts[i];
+        if (count >= target_count)
+        {
+            const int64_t upper_bound = aeron_latency_histogram_bucket_upper_bound(i);
+            return upper_bound < histogram->max_value ? upper_bound : histogram->max_value;
+        }
+    }
+
+    return histogram->max_value;
+}
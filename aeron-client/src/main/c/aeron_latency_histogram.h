@@ -0,0 +1,39 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef AERON_C_LATENCY_HISTOGRAM_H
+#define AERON_C_LATENCY_HISTOGRAM_H
+
+#include "aeronc.h"
+
+/*
+ * Log-linear buckets: values below 8ns have a bucket each, above that every power of two is split into 8 sub-buckets
+ * so a recorded value is within 12.5% of its bucket's upper bound.
+ */
+#define AERON_LATENCY_HISTOGRAM_SUB_BUCKET_BITS (3)
+#define AERON_LATENCY_HISTOGRAM_SUB_BUCKET_COUNT (1 << AERON_LATENCY_HISTOGRAM_SUB_BUCKET_BITS)
+#define AERON_LATENCY_HISTOGRAM_BUCKET_COUNT ((63 - AERON_LATENCY_HISTOGRAM_SUB_BUCKET_BITS + 1) * AERON_LATENCY_HISTOGRAM_SUB_BUCKET_COUNT)
+
+typedef struct aeron_latency_histogram_stct
+{
+    int64_t total_count;
+    int64_t max_value;
+    int64_t counts[AERON_LATENCY_HISTOGRAM_BUCKET_COUNT];
+}
+aeron_latency_histogram_t;
+
+#endif //AERON_C_LATENCY_HISTOGRAM_H
@@ -0,0 +1,397 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <string.h>
+
+#include "aeron_local_ipc.h"
+#include "aeron_alloc.h"
+#include "aeron_publication.h"
+#include "aeron_subscription.h"
+#include "aeron_image.h"
+#include "concurrent/aeron_counters_manager.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+#include "util/aeron_arrayutil.h"
+#include "util/aeron_error.h"
+
+int aeron_local_ipc_init(aeron_local_ipc_t **local_ipc, size_t term_length)
+{
+    aeron_local_ipc_t *_local_ipc = NULL;
+
+    if (NULL == local_ipc)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_local_ipc_init(NULL): %s", strerror(EINVAL));
+        return -1;
+    }
+
+    *local_ipc = NULL;
+    if (aeron_logbuffer_check_term_length(term_length) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&_local_ipc, sizeof(aeron_local_ipc_t)) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "aeron_local_ipc_init (%d): %s", errcode, strerror(errcode));
+        return -1;
+    }
+
+    _local_ipc->streams.array = NULL;
+    _local_ipc->streams.length = 0;
+    _local_ipc->streams.capacity = 0;
+    _local_ipc->term_length = term_length;
+    _local_ipc->next_registration_id = 1;
+
+    *local_ipc = _local_ipc;
+    return 0;
+}
+
+static char *aeron_local_ipc_channel()
+{
+    char *channel = NULL;
+
+    if (aeron_alloc((void **)&channel, sizeof(AERON_LOCAL_IPC_CHANNEL)) < 0)
+    {
+        return NULL;
+    }
+
+    memcpy(channel, AERON_LOCAL_IPC_CHANNEL, sizeof(AERON_LOCAL_IPC_CHANNEL));
+    return channel;
+}
+
+static int64_t aeron_local_ipc_producer_position(aeron_local_ipc_stream_t *stream)
+{
+    aeron_logbuffer_metadata_t *log_meta_data =
+        (aeron_logbuffer_metadata_t *)stream->log_buffer.mapped_raw_log.log_meta_data.addr;
+    const int32_t term_count = aeron_logbuffer_active_term_count(log_meta_data);
+    const size_t index = aeron_logbuffer_index_by_term_count(term_count);
+    int64_t raw_tail;
+
+    AERON_GET_VOLATILE(raw_tail, log_meta_data->term_tail_counters[index]);
+
+    const int64_t term_length = log_meta_data->term_length;
+    const int64_t term_offset = term_length < (raw_tail & 0xFFFFFFFF) ? term_length : (raw_tail & 0xFFFFFFFF);
+
+    return aeron_logbuffer_compute_position(
+        aeron_logbuffer_term_id(raw_tail),
+        (int32_t)term_offset,
+        stream->position_bits_to_shift,
+        log_meta_data->initial_term_id);
+}
+
+static aeron_local_ipc_stream_t *aeron_local_ipc_find_or_add_stream(aeron_local_ipc_t *local_ipc, int32_t stream_id)
+{
+    aeron_local_ipc_stream_t *stream = NULL;
+    const size_t term_length = local_ipc->term_length;
+    const size_t page_size = AERON_PAGE_MIN_SIZE;
+    const size_t log_length = (size_t)aeron_logbuffer_compute_log_length(term_length, page_size);
+    size_t offset = 0;
+    int ensure_capacity_result = 0;
+
+    for (size_t i = 0; i < local_ipc->streams.length; i++)
+    {
+        if (stream_id == local_ipc->streams.array[i]->stream_id)
+        {
+            return local_ipc->streams.array[i];
+        }
+    }
+
+    AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, local_ipc->streams, aeron_local_ipc_stream_t *)
+    if (ensure_capacity_result < 0)
+    {
+        return NULL;
+    }
+
+    if (aeron_alloc((void **)&stream, sizeof(aeron_local_ipc_stream_t)) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "aeron_local_ipc_add_stream (%d): %s", errcode, strerror(errcode));
+        return NULL;
+    }
+
+    if (aeron_alloc_aligned(&stream->log_memory, &offset, log_length, page_size) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "aeron_local_ipc_add_stream log (%d): %s", errcode, strerror(errcode));
+        aeron_free(stream);
+        return NULL;
+    }
+
+    aeron_mapped_raw_log_t *mapped_raw_log = &stream->log_buffer.mapped_raw_log;
+    uint8_t *log_addr = (uint8_t *)stream->log_memory + offset;
+
+    mapped_raw_log->mapped_file.addr = log_addr;
+    mapped_raw_log->mapped_file.length = log_length;
+    mapped_raw_log->term_length = term_length;
+    for (size_t i = 0; i < AERON_LOGBUFFER_PARTITION_COUNT; i++)
+    {
+        mapped_raw_log->term_buffers[i].addr = log_addr + (i * term_length);
+        mapped_raw_log->term_buffers[i].length = term_length;
+    }
+    mapped_raw_log->log_meta_data.addr = log_addr + (log_length - AERON_LOGBUFFER_META_DATA_LENGTH);
+    mapped_raw_log->log_meta_data.length = AERON_LOGBUFFER_META_DATA_LENGTH;
+
+    stream->registration_id = local_ipc->next_registration_id++;
+    stream->stream_id = stream_id;
+    stream->session_id = (int32_t)stream->registration_id;
+    stream->log_buffer.correlation_id = stream->registration_id;
+    stream->log_buffer.refcnt = 0;
+    stream->position_bits_to_shift = (size_t)aeron_number_of_trailing_zeroes((int32_t)term_length);
+    stream->term_window_length = (int64_t)(term_length / 2);
+    stream->clean_position = 0;
+    stream->position_limit.value = 0;
+    stream->channel_status.value = AERON_COUNTER_CHANNEL_ENDPOINT_STATUS_ACTIVE;
+
+    const int32_t initial_term_id = 0;
+    aeron_logbuffer_metadata_t *log_meta_data = (aeron_logbuffer_metadata_t *)mapped_raw_log->log_meta_data.addr;
+
+    log_meta_data->term_tail_counters[0] = (int64_t)initial_term_id << 32;
+    for (int i = 1; i < AERON_LOGBUFFER_PARTITION_COUNT; i++)
+    {
+        int64_t expected_term_id = (initial_term_id + i) - AERON_LOGBUFFER_PARTITION_COUNT;
+        log_meta_data->term_tail_counters[i] = expected_term_id * ((int64_t)1 << 32);
+    }
+
+    log_meta_data->active_term_count = 0;
+    log_meta_data->initial_term_id = initial_term_id;
+    log_meta_data->mtu_length = AERON_LOCAL_IPC_MTU_LENGTH;
+    log_meta_data->term_length = (int32_t)term_length;
+    log_meta_data->page_size = (int32_t)page_size;
+    log_meta_data->correlation_id = stream->registration_id;
+    log_meta_data->is_connected = 0;
+    log_meta_data->end_of_stream_position = INT64_MAX;
+    aeron_logbuffer_fill_default_header(
+        mapped_raw_log->log_meta_data.addr, stream->session_id, stream_id, initial_term_id);
+
+    local_ipc->streams.array[local_ipc->streams.length++] = stream;
+
+    return stream;
+}
+
+int aeron_local_ipc_add_publication(aeron_publication_t **publication, aeron_local_ipc_t *local_ipc, int32_t stream_id)
+{
+    if (NULL == publication || NULL == local_ipc)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_local_ipc_add_publication(NULL): %s", strerror(EINVAL));
+        return -1;
+    }
+
+    aeron_local_ipc_stream_t *stream = aeron_local_ipc_find_or_add_stream(local_ipc, stream_id);
+    if (NULL == stream)
+    {
+        return -1;
+    }
+
+    if (NULL == stream->publication)
+    {
+        char *channel = aeron_local_ipc_channel();
+
+        if (NULL == channel || aeron_publication_create(
+            &stream->publication,
+            NULL,
+            channel,
+            stream_id,
+            stream->session_id,
+            -1,
+            &stream->position_limit.value,
+            -1,
+            &stream->channel_status.value,
+            &stream->log_buffer,
+            stream->registration_id,
+            stream->registration_id) < 0)
+        {
+            aeron_free(channel);
+            return -1;
+        }
+    }
+
+    *publication = stream->publication;
+    return 0;
+}
+
+int aeron_local_ipc_add_subscription(
+    aeron_subscription_t **subscription, aeron_local_ipc_t *local_ipc, int32_t stream_id)
+{
+    aeron_subscription_t *_subscription = NULL;
+    aeron_image_t *image = NULL;
+
+    if (NULL == subscription || NULL == local_ipc)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_local_ipc_add_subscription(NULL): %s", strerror(EINVAL));
+        return -1;
+    }
+
+    aeron_local_ipc_stream_t *stream = aeron_local_ipc_find_or_add_stream(local_ipc, stream_id);
+    if (NULL == stream)
+    {
+        return -1;
+    }
+
+    if (stream->subscriber_count >= AERON_LOCAL_IPC_MAX_SUBSCRIBERS)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_local_ipc_add_subscription: more than %d subscriptions to stream %" PRId32,
+            AERON_LOCAL_IPC_MAX_SUBSCRIBERS, stream_id);
+        return -1;
+    }
+
+    const size_t index = stream->subscriber_count;
+    const int64_t registration_id = local_ipc->next_registration_id++;
+    char *channel = aeron_local_ipc_channel();
+
+    if (NULL == channel || aeron_subscription_create(
+        &_subscription,
+        NULL,
+        channel,
+        stream_id,
+        registration_id,
+        -1,
+        &stream->channel_status.value,
+        NULL,
+        NULL,
+        NULL,
+        NULL) < 0)
+    {
+        aeron_free(channel);
+        return -1;
+    }
+
+    stream->subscriber_positions[index].value = aeron_local_ipc_producer_position(stream);
+
+    if (aeron_image_create(
+        &image,
+        _subscription,
+        NULL,
+        &stream->log_buffer,
+        NULL,
+        -1,
+        &stream->subscriber_positions[index].value,
+        stream->registration_id,
+        stream->session_id,
+        AERON_LOCAL_IPC_CHANNEL,
+        strlen(AERON_LOCAL_IPC_CHANNEL)) < 0)
+    {
+        aeron_subscription_delete(_subscription);
+        return -1;
+    }
+
+    if (aeron_client_conductor_subscription_add_image(_subscription, image) < 0)
+    {
+        aeron_image_delete(image);
+        aeron_subscription_delete(_subscription);
+        return -1;
+    }
+
+    stream->subscriptions[index] = _subscription;
+    stream->images[index] = image;
+    stream->subscriber_count++;
+
+    aeron_logbuffer_metadata_t *log_meta_data =
+        (aeron_logbuffer_metadata_t *)stream->log_buffer.mapped_raw_log.log_meta_data.addr;
+    AERON_PUT_ORDERED(log_meta_data->is_connected, 1);
+
+    *subscription = _subscription;
+    return 0;
+}
+
+static void aeron_local_ipc_clean_buffer(aeron_local_ipc_stream_t *stream, int64_t position)
+{
+    const int64_t clean_position = stream->clean_position;
+
+    if (position > clean_position)
+    {
+        aeron_mapped_raw_log_t *mapped_raw_log = &stream->log_buffer.mapped_raw_log;
+        size_t dirty_index = aeron_logbuffer_index_by_position(clean_position, stream->position_bits_to_shift);
+        size_t bytes_to_clean = (size_t)(position - clean_position);
+        size_t term_length = mapped_raw_log->term_length;
+        size_t term_offset = (size_t)(clean_position & (term_length - 1));
+        size_t bytes_left_in_term = term_length - term_offset;
+        size_t length = bytes_to_clean < bytes_left_in_term ? bytes_to_clean : bytes_left_in_term;
+
+        memset(mapped_raw_log->term_buffers[dirty_index].addr + term_offset, 0, length);
+        stream->clean_position = clean_position + length;
+    }
+}
+
+int aeron_local_ipc_do_work(aeron_local_ipc_t *local_ipc)
+{
+    int work_count = 0;
+
+    for (size_t i = 0; i < local_ipc->streams.length; i++)
+    {
+        aeron_local_ipc_stream_t *stream = local_ipc->streams.array[i];
+        int64_t min_sub_pos = INT64_MAX;
+
+        if (0 == stream->subscriber_count)
+        {
+            continue;
+        }
+
+        for (size_t j = 0; j < stream->subscriber_count; j++)
+        {
+            int64_t position = aeron_counter_get_volatile(&stream->subscriber_positions[j].value);
+            min_sub_pos = position < min_sub_pos ? position : min_sub_pos;
+        }
+
+        const int64_t proposed_limit = min_sub_pos + stream->term_window_length;
+        if (proposed_limit > stream->position_limit.value)
+        {
+            aeron_local_ipc_clean_buffer(stream, min_sub_pos);
+            aeron_counter_set_ordered(&stream->position_limit.value, proposed_limit);
+            work_count++;
+        }
+    }
+
+    return work_count;
+}
+
+int aeron_local_ipc_close(aeron_local_ipc_t *local_ipc)
+{
+    if (NULL != local_ipc)
+    {
+        for (size_t i = 0; i < local_ipc->streams.length; i++)
+        {
+            aeron_local_ipc_stream_t *stream = local_ipc->streams.array[i];
+
+            for (size_t j = 0; j < stream->subscriber_count; j++)
+            {
+                aeron_image_delete(stream->images[j]);
+                aeron_subscription_delete(stream->subscriptions[j]);
+            }
+
+            if (NULL != stream->publication)
+            {
+                aeron_publication_delete(stream->publication);
+            }
+
+            aeron_free(stream->log_memory);
+            aeron_free(stream);
+        }
+
+        aeron_free(local_ipc->streams.array);
+        aeron_free(local_ipc);
+    }
+
+    return 0;
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_C_LOCAL_IPC_H
+#define AERON_C_LOCAL_IPC_H
+
+#include "aeronc.h"
+#include "aeron_log_buffer.h"
+#include "util/aeron_bitutil.h"
+
+#define AERON_LOCAL_IPC_CHANNEL "aeron:ipc"
+#define AERON_LOCAL_IPC_MAX_SUBSCRIBERS (16)
+#define AERON_LOCAL_IPC_MTU_LENGTH (1408)
+
+typedef struct aeron_local_ipc_position_stct
+{
+    int64_t value;
+    uint8_t pad[AERON_CACHE_LINE_LENGTH - sizeof(int64_t)];
+}
+aeron_local_ipc_position_t;
+
+/*
+ * A stream shares one log, held in process memory, between the publication and subscriptions added for its
+ * stream id. The counters the driver would otherwise hold in the CnC live here.
+ */
+typedef struct aeron_local_ipc_stream_stct
+{
+    aeron_local_ipc_position_t position_limit;
+    aeron_local_ipc_position_t channel_status;
+    aeron_local_ipc_position_t subscriber_positions[AERON_LOCAL_IPC_MAX_SUBSCRIBERS];
+
+    aeron_log_buffer_t log_buffer;
+    void *log_memory;
+
+    aeron_publication_t *publication;
+    aeron_subscription_t *subscriptions[AERON_LOCAL_IPC_MAX_SUBSCRIBERS];
+    aeron_image_t *images[AERON_LOCAL_IPC_MAX_SUBSCRIBERS];
+    size_t subscriber_count;
+
+    int64_t registration_id;
+    int64_t clean_position;
+    int64_t term_window_length;
+    size_t position_bits_to_shift;
+    int32_t stream_id;
+    int32_t session_id;
+}
+aeron_local_ipc_stream_t;
+
+typedef struct aeron_local_ipc_stct
+{
+    struct local_ipc_streams_stct
+    {
+        aeron_local_ipc_stream_t **array;
+        size_t length;
+        size_t capacity;
+    }
+    streams;
+
+    size_t term_length;
+    int64_t next_registration_id;
+}
+aeron_local_ipc_t;
+
+#endif //AERON_C_LOCAL_IPC_H
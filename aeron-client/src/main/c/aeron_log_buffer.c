@@ -19,6 +19,7 @@
 #include "aeron_log_buffer.h"
 #include "aeron_alloc.h"
 #include "util/aeron_error.h"
+#include "util/aeron_fd_transfer.h"
 
 int aeron_log_buffer_create(
     aeron_log_buffer_t **log_buffer, const char *log_file, int64_t correlation_id, bool pre_touch)
@@ -48,6 +49,47 @@ int aeron_log_buffer_create(
     return 0;
 }
 
+int aeron_log_buffer_create_from_socket(
+    aeron_log_buffer_t **log_buffer,
+    const char *socket_path,
+    const char *log_file,
+    int64_t correlation_id,
+    bool pre_touch,
+    int64_t timeout_ms)
+{
+    aeron_log_buffer_t *_log_buffer = NULL;
+    int fd;
+
+    *log_buffer = NULL;
+    if (aeron_alloc((void **)&_log_buffer, sizeof(aeron_log_buffer_t)) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "aeron_log_buffer_create_from_socket (%d): %s", errcode, strerror(errcode));
+        return -1;
+    }
+
+    if ((fd = aeron_fd_transfer_request(socket_path, log_file, timeout_ms)) < 0)
+    {
+        aeron_set_err(aeron_errcode(), "could not receive log buffer %s: %s", log_file, aeron_errmsg());
+        aeron_free(_log_buffer);
+        return -1;
+    }
+
+    if (aeron_map_existing_log_fd(&_log_buffer->mapped_raw_log, fd, pre_touch) < 0)
+    {
+        aeron_set_err(aeron_errcode(), "could not map received log buffer %s: %s", log_file, aeron_errmsg());
+        aeron_free(_log_buffer);
+        return -1;
+    }
+
+    _log_buffer->correlation_id = correlation_id;
+    _log_buffer->refcnt = 0;
+
+    *log_buffer = _log_buffer;
+    return 0;
+}
+
 int aeron_log_buffer_delete(aeron_log_buffer_t *log_buffer)
 {
     if (NULL != log_buffer)
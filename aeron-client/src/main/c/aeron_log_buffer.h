@@ -32,6 +32,13 @@ aeron_log_buffer_t;
 
 int aeron_log_buffer_create(
     aeron_log_buffer_t **log_buffer, const char *log_file, int64_t correlation_id, bool pre_touch);
+int aeron_log_buffer_create_from_socket(
+    aeron_log_buffer_t **log_buffer,
+    const char *socket_path,
+    const char *log_file,
+    int64_t correlation_id,
+    bool pre_touch,
+    int64_t timeout_ms);
 int aeron_log_buffer_delete(aeron_log_buffer_t *log_buffer);
 
 #endif //AERON_C_LOG_BUFFER_H
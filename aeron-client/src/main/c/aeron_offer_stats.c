@@ -0,0 +1,207 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "aeron_offer_stats.h"
+#include "aeron_alloc.h"
+#include "util/aeron_error.h"
+
+static const int64_t aeron_offer_stats_bucket_limits_ns[AERON_PUBLICATION_OFFER_BACK_PRESSURED_BUCKET_COUNT - 1] =
+    {
+        10 * 1000LL,
+        100 * 1000LL,
+        1000 * 1000LL,
+        10 * 1000 * 1000LL
+    };
+
+int aeron_offer_stats_create(
+    aeron_offer_stats_t **stats,
+    aeron_client_conductor_t *conductor,
+    const char *channel,
+    int64_t registration_id,
+    bool is_shared)
+{
+    int32_t counter_ids[AERON_PUBLICATION_OFFER_METRIC_COUNT];
+    aeron_offer_stats_t *_stats;
+
+    *stats = NULL;
+
+    if (NULL == conductor || NULL == channel || NULL == strstr(channel, AERON_OFFER_STATS_PARAM))
+    {
+        return 0;
+    }
+
+    for (int i = 0; i < AERON_PUBLICATION_OFFER_METRIC_COUNT; i++)
+    {
+        counter_ids[i] = AERON_NULL_COUNTER_ID;
+    }
+
+    aeron_counters_reader_t *counters_reader = &conductor->counters_reader;
+    for (int32_t i = 0; i < counters_reader->max_counter_id; i++)
+    {
+        aeron_counter_metadata_descriptor_t *metadata = (aeron_counter_metadata_descriptor_t *)(
+            counters_reader->metadata + AERON_COUNTER_METADATA_OFFSET(i));
+        int32_t record_state;
+
+        AERON_GET_VOLATILE(record_state, metadata->state);
+
+        if (AERON_COUNTER_RECORD_ALLOCATED == record_state &&
+            AERON_COUNTER_PUBLICATION_OFFER_TYPE_ID == metadata->type_id)
+        {
+            aeron_publication_offer_key_layout_t layout;
+
+            memcpy(&layout, metadata->key, sizeof(layout));
+            if (registration_id == layout.registration_id &&
+                layout.metric >= 0 && layout.metric < AERON_PUBLICATION_OFFER_METRIC_COUNT)
+            {
+                counter_ids[layout.metric] = i;
+            }
+        }
+    }
+
+    for (int i = 0; i < AERON_PUBLICATION_OFFER_METRIC_COUNT; i++)
+    {
+        if (AERON_NULL_COUNTER_ID == counter_ids[i])
+        {
+            return 0;
+        }
+    }
+
+    if (aeron_alloc((void **)&_stats, sizeof(aeron_offer_stats_t)) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "aeron_offer_stats_create (%d): %s", errcode, strerror(errcode));
+        return -1;
+    }
+
+    for (int i = 0; i < AERON_PUBLICATION_OFFER_METRIC_COUNT; i++)
+    {
+        _stats->counters[i] = aeron_counters_reader_addr(counters_reader, counter_ids[i]);
+    }
+
+    _stats->back_pressured_since_ns = 0;
+    _stats->is_shared = is_shared;
+
+    *stats = _stats;
+    return 0;
+}
+
+void aeron_offer_stats_delete(aeron_offer_stats_t *stats)
+{
+    aeron_free(stats);
+}
+
+static inline void aeron_offer_stats_add(aeron_offer_stats_t *stats, int metric, int64_t value)
+{
+    if (stats->is_shared)
+    {
+        aeron_counter_increment(stats->counters[metric], value);
+    }
+    else
+    {
+        aeron_counter_add_ordered(stats->counters[metric], value);
+    }
+}
+
+static void aeron_offer_stats_end_back_pressure(aeron_offer_stats_t *stats, int64_t since_ns)
+{
+    if (stats->is_shared)
+    {
+        if (!aeron_cmpxchg64(&stats->back_pressured_since_ns, since_ns, 0))
+        {
+            return;
+        }
+    }
+    else
+    {
+        stats->back_pressured_since_ns = 0;
+    }
+
+    const int64_t duration_ns = aeron_nano_clock() - since_ns;
+    int bucket = 0;
+
+    while (bucket < AERON_PUBLICATION_OFFER_BACK_PRESSURED_BUCKET_COUNT - 1 &&
+        duration_ns > aeron_offer_stats_bucket_limits_ns[bucket])
+    {
+        bucket++;
+    }
+
+    aeron_offer_stats_add(stats, AERON_PUBLICATION_OFFER_METRIC_BACK_PRESSURED_NS, duration_ns);
+    aeron_offer_stats_add(stats, AERON_PUBLICATION_OFFER_METRIC_BACK_PRESSURED_BUCKET + bucket, 1);
+}
+
+static void aeron_offer_stats_begin_back_pressure(aeron_offer_stats_t *stats)
+{
+    const int64_t now_ns = aeron_nano_clock();
+
+    if (stats->is_shared)
+    {
+        aeron_cmpxchg64(&stats->back_pressured_since_ns, 0, now_ns);
+    }
+    else
+    {
+        stats->back_pressured_since_ns = now_ns;
+    }
+}
+
+void aeron_offer_stats_record(aeron_offer_stats_t *stats, size_t length, int64_t result)
+{
+    int64_t since_ns;
+
+    aeron_offer_stats_add(stats, AERON_PUBLICATION_OFFER_METRIC_OFFERED_BYTES, (int64_t)length);
+    AERON_GET_VOLATILE(since_ns, stats->back_pressured_since_ns);
+
+    if (result > 0)
+    {
+        aeron_offer_stats_add(stats, AERON_PUBLICATION_OFFER_METRIC_ACCEPTED_BYTES, (int64_t)length);
+
+        if (0 != since_ns)
+        {
+            aeron_offer_stats_end_back_pressure(stats, since_ns);
+        }
+
+        return;
+    }
+
+    switch (result)
+    {
+        case AERON_PUBLICATION_BACK_PRESSURED:
+            aeron_offer_stats_add(stats, AERON_PUBLICATION_OFFER_METRIC_BACK_PRESSURED, 1);
+            if (0 == since_ns)
+            {
+                aeron_offer_stats_begin_back_pressure(stats);
+            }
+            break;
+
+        case AERON_PUBLICATION_NOT_CONNECTED:
+            aeron_offer_stats_add(stats, AERON_PUBLICATION_OFFER_METRIC_NOT_CONNECTED, 1);
+            break;
+
+        case AERON_PUBLICATION_ADMIN_ACTION:
+            aeron_offer_stats_add(stats, AERON_PUBLICATION_OFFER_METRIC_ADMIN_ACTION, 1);
+            break;
+
+        case AERON_PUBLICATION_MAX_POSITION_EXCEEDED:
+            aeron_offer_stats_add(stats, AERON_PUBLICATION_OFFER_METRIC_MAX_POSITION_EXCEEDED, 1);
+            break;
+
+        default:
+            break;
+    }
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_C_OFFER_STATS_H
+#define AERON_C_OFFER_STATS_H
+
+#include "aeronc.h"
+#include "aeron_client_conductor.h"
+#include "concurrent/aeron_counters_manager.h"
+
+#define AERON_OFFER_STATS_PARAM "offer-stats=true"
+
+/*
+ * The pub-offer counters the driver allocates for a publication with offer-stats=true, written as the client offers.
+ * A back pressured period starts with the first back pressured offer and ends with the next accepted one, so the
+ * clock is only read as a period starts and ends. Shared publications update the counters atomically as several
+ * threads may offer at once.
+ */
+typedef struct aeron_offer_stats_stct
+{
+    int64_t *counters[AERON_PUBLICATION_OFFER_METRIC_COUNT];
+    volatile int64_t back_pressured_since_ns;
+    bool is_shared;
+}
+aeron_offer_stats_t;
+
+/*
+ * Resolves the counters when the channel asks for them, otherwise leaves stats as NULL.
+ */
+int aeron_offer_stats_create(
+    aeron_offer_stats_t **stats,
+    aeron_client_conductor_t *conductor,
+    const char *channel,
+    int64_t registration_id,
+    bool is_shared);
+
+void aeron_offer_stats_delete(aeron_offer_stats_t *stats);
+
+void aeron_offer_stats_record(aeron_offer_stats_t *stats, size_t length, int64_t result);
+
+#endif //AERON_C_OFFER_STATS_H
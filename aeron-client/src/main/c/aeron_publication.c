@@ -21,8 +21,22 @@
 #include "aeron_common.h"
 #include "aeron_publication.h"
 #include "concurrent/aeron_term_appender.h"
+#include "concurrent/aeron_thread.h"
 #include "aeron_log_buffer.h"
 
+#ifdef _MSC_VER
+#define _Static_assert static_assert
+#endif
+
+_Static_assert(
+    offsetof(aeron_publication_t, combining_next_slot) >=
+        offsetof(aeron_publication_t, is_closed) + sizeof(bool) + (2 * AERON_CACHE_LINE_LENGTH),
+    "combining fields of aeron_publication_t must not share a cache line with those read on offer");
+_Static_assert(
+    sizeof(aeron_publication_t) >=
+        offsetof(aeron_publication_t, combining_lock) + sizeof(int32_t) + (2 * AERON_CACHE_LINE_LENGTH),
+    "combining fields of aeron_publication_t must be followed by padding");
+
 int aeron_publication_create(
     aeron_publication_t **publication,
     aeron_client_conductor_t *conductor,
@@ -48,6 +62,20 @@ int aeron_publication_create(
         return -1;
     }
 
+    if (aeron_alloc(
+        (void **)&_publication->combining_slots,
+        sizeof(aeron_publication_combining_slot_t) * AERON_PUBLICATION_COMBINING_SLOT_COUNT) < 0)
+    {
+        int errcode = errno;
+
+        aeron_free(_publication);
+        aeron_set_err(errcode, "aeron_publication_create (%d): %s", errcode, strerror(errcode));
+        return -1;
+    }
+
+    _publication->combining_next_slot = 0;
+    _publication->combining_lock = 0;
+
     _publication->command_base.type = AERON_CLIENT_TYPE_PUBLICATION;
 
     _publication->log_buffer = log_buffer;
@@ -74,6 +102,13 @@ int aeron_publication_create(
     _publication->position_bits_to_shift = (size_t)aeron_number_of_trailing_zeroes((int32_t)term_length);
     _publication->initial_term_id = _publication->log_meta_data->initial_term_id;
 
+    if (aeron_offer_stats_create(&_publication->offer_stats, conductor, channel, registration_id, true) < 0)
+    {
+        aeron_free(_publication->combining_slots);
+        aeron_free(_publication);
+        return -1;
+    }
+
     *publication = _publication;
     return 0;
 }
@@ -81,6 +116,8 @@ int aeron_publication_create(
 int aeron_publication_delete(aeron_publication_t *publication)
 {
     aeron_free((void *)publication->channel);
+    aeron_free(publication->combining_slots);
+    aeron_offer_stats_delete(publication->offer_stats);
     aeron_free(publication);
 
     return 0;
@@ -91,6 +128,17 @@ void aeron_publication_force_close(aeron_publication_t *publication)
     AERON_PUT_ORDERED(publication->is_closed, true);
 }
 
+static inline int64_t aeron_publication_record_offer(
+    aeron_publication_t *publication, size_t length, int64_t result)
+{
+    if (NULL != publication->offer_stats)
+    {
+        aeron_offer_stats_record(publication->offer_stats, length, result);
+    }
+
+    return result;
+}
+
 int aeron_publication_close(
     aeron_publication_t *publication, aeron_notification_t on_close_complete, void *on_close_complete_clientd)
 {
@@ -103,7 +151,7 @@ int aeron_publication_close(
         {
             AERON_PUT_ORDERED(publication->is_closed, true);
 
-            if (aeron_client_conductor_async_close_publication(
+            if (NULL != publication->conductor && aeron_client_conductor_async_close_publication(
                 publication->conductor, publication, on_close_complete, on_close_complete_clientd) < 0)
             {
                 return -1;
@@ -146,7 +194,7 @@ int64_t aeron_publication_offer(
 
         if (term_count != (term_id - publication->initial_term_id))
         {
-            return AERON_PUBLICATION_ADMIN_ACTION;
+            return aeron_publication_record_offer(publication, length, AERON_PUBLICATION_ADMIN_ACTION);
         }
 
         if (position < limit)
@@ -197,7 +245,7 @@ int64_t aeron_publication_offer(
         }
     }
 
-    return new_position;
+    return aeron_publication_record_offer(publication, length, new_position);
 }
 
 int64_t aeron_publication_offerv(
@@ -238,7 +286,7 @@ int64_t aeron_publication_offerv(
 
         if (term_count != (term_id - publication->initial_term_id))
         {
-            return AERON_PUBLICATION_ADMIN_ACTION;
+            return aeron_publication_record_offer(publication, length, AERON_PUBLICATION_ADMIN_ACTION);
         }
 
         if (position < limit)
@@ -291,6 +339,310 @@ int64_t aeron_publication_offerv(
         }
     }
 
+    return aeron_publication_record_offer(publication, length, new_position);
+}
+
+int64_t aeron_publication_offer_batch(
+    aeron_publication_t *publication,
+    aeron_iovec_t *messages,
+    size_t count,
+    size_t *appended_count,
+    aeron_reserved_value_supplier_t reserved_value_supplier,
+    void *clientd)
+{
+    int64_t new_position = AERON_PUBLICATION_CLOSED;
+    bool is_closed;
+
+    if (NULL == publication || NULL == messages || NULL == appended_count || 0 == count)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_publication_offer_batch(NULL): %s", strerror(EINVAL));
+        return AERON_PUBLICATION_ERROR;
+    }
+
+    *appended_count = 0;
+
+    size_t batch_length = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        if (messages[i].iov_len > publication->max_payload_length)
+        {
+            errno = EINVAL;
+            aeron_set_err(EINVAL, "aeron_publication_offer_batch: length=%" PRIu32 " > max_payload_length=%" PRIu32,
+                (uint32_t)messages[i].iov_len, (uint32_t)publication->max_payload_length);
+            return AERON_PUBLICATION_ERROR;
+        }
+
+        batch_length += AERON_ALIGN(messages[i].iov_len + AERON_DATA_HEADER_LENGTH, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    }
+
+    if (batch_length > publication->log_buffer->mapped_raw_log.term_length)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_publication_offer_batch: batch length=%" PRIu64 " > term_length=%" PRIu64,
+            (uint64_t)batch_length, (uint64_t)publication->log_buffer->mapped_raw_log.term_length);
+        return AERON_PUBLICATION_ERROR;
+    }
+
+    AERON_GET_VOLATILE(is_closed, publication->is_closed);
+    if (!is_closed)
+    {
+        const int64_t limit = aeron_counter_get_volatile(publication->position_limit);
+        const int32_t term_count = aeron_logbuffer_active_term_count(publication->log_meta_data);
+        const size_t index = aeron_logbuffer_index_by_term_count(term_count);
+        const int64_t raw_tail = aeron_term_appender_raw_tail_volatile(
+            &publication->log_meta_data->term_tail_counters[index]);
+        const int64_t term_offset = raw_tail & 0xFFFFFFFF;
+        const int32_t term_id = aeron_logbuffer_term_id(raw_tail);
+        const int64_t position = aeron_logbuffer_compute_term_begin_position(
+            term_id, publication->position_bits_to_shift, publication->initial_term_id) + term_offset;
+
+        if (term_count != (term_id - publication->initial_term_id))
+        {
+            return AERON_PUBLICATION_ADMIN_ACTION;
+        }
+
+        if (position < limit)
+        {
+            const int32_t resulting_offset = aeron_term_appender_append_unfragmented_batch(
+                &publication->log_buffer->mapped_raw_log.term_buffers[index],
+                &publication->log_meta_data->term_tail_counters[index],
+                messages,
+                count,
+                batch_length,
+                appended_count,
+                reserved_value_supplier,
+                clientd,
+                term_id,
+                publication->session_id,
+                publication->stream_id);
+
+            new_position = aeron_publication_new_position(
+                publication, term_count, (int32_t)term_offset, term_id, position, resulting_offset);
+        }
+        else
+        {
+            new_position = aeron_publication_back_pressure_status(publication, position, (int32_t)batch_length);
+        }
+    }
+
+    return new_position;
+}
+
+/*
+ * Append the messages pending in the combining slots with a single claim on the term tail and hand each its result.
+ * Only called while holding the combining lock so there is one combiner at a time.
+ */
+static void aeron_publication_combine(aeron_publication_t *publication)
+{
+    aeron_iovec_t messages[AERON_PUBLICATION_COMBINING_SLOT_COUNT];
+    aeron_publication_combining_slot_t *slots[AERON_PUBLICATION_COMBINING_SLOT_COUNT];
+    const size_t term_length = publication->log_buffer->mapped_raw_log.term_length;
+    size_t count = 0;
+    size_t batch_length = 0;
+
+    for (size_t i = 0; i < AERON_PUBLICATION_COMBINING_SLOT_COUNT; i++)
+    {
+        aeron_publication_combining_slot_t *slot = &publication->combining_slots[i];
+        int32_t state;
+
+        AERON_GET_VOLATILE(state, slot->state);
+        if (AERON_PUBLICATION_COMBINING_SLOT_PENDING == state)
+        {
+            const size_t aligned_length = AERON_ALIGN(
+                slot->length + AERON_DATA_HEADER_LENGTH, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+
+            if (batch_length + aligned_length > term_length)
+            {
+                break;
+            }
+
+            messages[count].iov_base = (uint8_t *)slot->buffer;
+            messages[count].iov_len = slot->length;
+            slots[count] = slot;
+            batch_length += aligned_length;
+            count++;
+        }
+    }
+
+    if (0 == count)
+    {
+        return;
+    }
+
+    size_t appended_count = 0;
+    const int64_t result = aeron_publication_offer_batch(publication, messages, count, &appended_count, NULL, NULL);
+    int64_t appended_result = result;
+
+    if (result < 0 && appended_count > 0)
+    {
+        /* the batch ran off the end of the term which has now been rotated so its end is where the next begins */
+        appended_result = AERON_PUBLICATION_MAX_POSITION_EXCEEDED == result ?
+            publication->max_possible_position : aeron_publication_position(publication);
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        slots[i]->result = i < appended_count ? appended_result : result;
+        AERON_PUT_ORDERED(slots[i]->state, AERON_PUBLICATION_COMBINING_SLOT_COMPLETE);
+    }
+}
+
+int64_t aeron_publication_offer_combining(aeron_publication_t *publication, const uint8_t *buffer, size_t length)
+{
+    if (NULL == publication || NULL == buffer)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_publication_offer_combining(NULL): %s", strerror(EINVAL));
+        return AERON_PUBLICATION_ERROR;
+    }
+
+    if (length > publication->max_payload_length)
+    {
+        return aeron_publication_offer(publication, buffer, length, NULL, NULL);
+    }
+
+    int32_t start;
+    AERON_GET_AND_ADD_INT32(start, publication->combining_next_slot, 1);
+
+    aeron_publication_combining_slot_t *slot = NULL;
+    for (size_t i = 0; i < AERON_PUBLICATION_COMBINING_SLOT_COUNT; i++)
+    {
+        aeron_publication_combining_slot_t *candidate = &publication->combining_slots[
+            ((size_t)(uint32_t)start + i) & (AERON_PUBLICATION_COMBINING_SLOT_COUNT - 1)];
+
+        if (aeron_cmpxchg32(
+            &candidate->state, AERON_PUBLICATION_COMBINING_SLOT_FREE, AERON_PUBLICATION_COMBINING_SLOT_CLAIMED))
+        {
+            slot = candidate;
+            break;
+        }
+    }
+
+    if (NULL == slot)
+    {
+        return aeron_publication_offer(publication, buffer, length, NULL, NULL);
+    }
+
+    slot->buffer = buffer;
+    slot->length = length;
+    AERON_PUT_ORDERED(slot->state, AERON_PUBLICATION_COMBINING_SLOT_PENDING);
+
+    while (true)
+    {
+        int32_t state;
+
+        AERON_GET_VOLATILE(state, slot->state);
+        if (AERON_PUBLICATION_COMBINING_SLOT_COMPLETE == state)
+        {
+            break;
+        }
+
+        if (aeron_cmpxchg32(&publication->combining_lock, 0, 1))
+        {
+            aeron_publication_combine(publication);
+            AERON_PUT_ORDERED(publication->combining_lock, 0);
+        }
+        else
+        {
+            proc_yield();
+        }
+    }
+
+    const int64_t result = slot->result;
+    AERON_PUT_ORDERED(slot->state, AERON_PUBLICATION_COMBINING_SLOT_FREE);
+
+    return result;
+}
+
+int64_t aeron_publication_offer_block(aeron_publication_t *publication, const uint8_t *buffer, size_t length)
+{
+    int64_t new_position = AERON_PUBLICATION_CLOSED;
+    bool is_closed;
+
+    if (NULL == publication || NULL == buffer)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_publication_offer_block(NULL): %s", strerror(EINVAL));
+        return AERON_PUBLICATION_ERROR;
+    }
+
+    if (length < AERON_DATA_HEADER_LENGTH ||
+        length > publication->log_buffer->mapped_raw_log.term_length ||
+        0 != (length & (AERON_LOGBUFFER_FRAME_ALIGNMENT - 1)))
+    {
+        errno = EINVAL;
+        aeron_set_err(
+            EINVAL,
+            "aeron_publication_offer_block: invalid block length %" PRIu32 ", term_length=%" PRIu32,
+            (uint32_t)length,
+            (uint32_t)publication->log_buffer->mapped_raw_log.term_length);
+        return AERON_PUBLICATION_ERROR;
+    }
+
+    size_t block_offset = 0;
+    while (block_offset < length)
+    {
+        aeron_frame_header_t *frame_header = (aeron_frame_header_t *)(buffer + block_offset);
+
+        if (frame_header->frame_length < (int32_t)AERON_DATA_HEADER_LENGTH ||
+            (0 == block_offset && AERON_HDR_TYPE_DATA != frame_header->type) ||
+            (AERON_HDR_TYPE_DATA != frame_header->type && AERON_HDR_TYPE_PAD != frame_header->type) ||
+            block_offset + AERON_ALIGN((size_t)frame_header->frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT) > length)
+        {
+            errno = EINVAL;
+            aeron_set_err(
+                EINVAL,
+                "aeron_publication_offer_block improperly formatted block:"
+                " frame_length=%" PRId32 " frame_type=%" PRId32 " at offset=%" PRIu32 " of length=%" PRIu32,
+                frame_header->frame_length,
+                (int32_t)frame_header->type,
+                (uint32_t)block_offset,
+                (uint32_t)length);
+            return AERON_PUBLICATION_ERROR;
+        }
+
+        block_offset += AERON_ALIGN((size_t)frame_header->frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    }
+
+    AERON_GET_VOLATILE(is_closed, publication->is_closed);
+    if (!is_closed)
+    {
+        const int64_t limit = aeron_counter_get_volatile(publication->position_limit);
+        const int32_t term_count = aeron_logbuffer_active_term_count(publication->log_meta_data);
+        const size_t index = aeron_logbuffer_index_by_term_count(term_count);
+        const int64_t raw_tail = aeron_term_appender_raw_tail_volatile(
+            &publication->log_meta_data->term_tail_counters[index]);
+        const int64_t term_offset = raw_tail & 0xFFFFFFFF;
+        const int32_t term_id = aeron_logbuffer_term_id(raw_tail);
+        const int64_t position = aeron_logbuffer_compute_term_begin_position(
+            term_id, publication->position_bits_to_shift, publication->initial_term_id) + term_offset;
+
+        if (term_count != (term_id - publication->initial_term_id))
+        {
+            return AERON_PUBLICATION_ADMIN_ACTION;
+        }
+
+        if (position < limit)
+        {
+            const int32_t resulting_offset = aeron_term_appender_append_block(
+                &publication->log_buffer->mapped_raw_log.term_buffers[index],
+                &publication->log_meta_data->term_tail_counters[index],
+                buffer,
+                length,
+                term_id,
+                publication->session_id,
+                publication->stream_id);
+
+            new_position = aeron_publication_new_position(
+                publication, term_count, (int32_t)term_offset, term_id, position, resulting_offset);
+        }
+        else
+        {
+            new_position = aeron_publication_back_pressure_status(publication, position, (int32_t)length);
+        }
+    }
+
     return new_position;
 }
 
@@ -328,7 +680,7 @@ int64_t aeron_publication_try_claim(aeron_publication_t *publication, size_t len
 
         if (term_count != (term_id - publication->initial_term_id))
         {
-            return AERON_PUBLICATION_ADMIN_ACTION;
+            return aeron_publication_record_offer(publication, length, AERON_PUBLICATION_ADMIN_ACTION);
         }
 
         if (position < limit)
@@ -351,6 +703,110 @@ int64_t aeron_publication_try_claim(aeron_publication_t *publication, size_t len
         }
     }
 
+    return aeron_publication_record_offer(publication, length, new_position);
+}
+
+int64_t aeron_publication_try_claim_fragmented(
+    aeron_publication_t *publication,
+    size_t length,
+    aeron_buffer_claim_t *buffer_claims,
+    size_t buffer_claims_length,
+    size_t *claim_count)
+{
+    int64_t new_position = AERON_PUBLICATION_CLOSED;
+    bool is_closed;
+
+    if (NULL == publication || NULL == buffer_claims || NULL == claim_count)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_publication_try_claim_fragmented(NULL): %s", strerror(EINVAL));
+        return AERON_PUBLICATION_ERROR;
+    }
+    else if (length > publication->max_message_length)
+    {
+        errno = EINVAL;
+        aeron_set_err(
+            EINVAL,
+            "aeron_publication_try_claim_fragmented: length=%" PRIu32 " > max_message_length=%" PRIu32,
+            (uint32_t)length, (uint32_t)publication->max_message_length);
+        return AERON_PUBLICATION_ERROR;
+    }
+
+    const size_t fragment_count = length <= publication->max_payload_length ?
+        1 : (length + publication->max_payload_length - 1) / publication->max_payload_length;
+
+    if (fragment_count > buffer_claims_length)
+    {
+        errno = EINVAL;
+        aeron_set_err(
+            EINVAL,
+            "aeron_publication_try_claim_fragmented: buffer_claims_length=%" PRIu32 " < fragment count=%" PRIu32,
+            (uint32_t)buffer_claims_length, (uint32_t)fragment_count);
+        return AERON_PUBLICATION_ERROR;
+    }
+
+    *claim_count = 0;
+
+    AERON_GET_VOLATILE(is_closed, publication->is_closed);
+    if (!is_closed)
+    {
+        const int64_t limit = aeron_counter_get_volatile(publication->position_limit);
+        const int32_t term_count = aeron_logbuffer_active_term_count(publication->log_meta_data);
+        const size_t index = aeron_logbuffer_index_by_term_count(term_count);
+        const int64_t raw_tail = aeron_term_appender_raw_tail_volatile(
+            &publication->log_meta_data->term_tail_counters[index]);
+        const int64_t term_offset = raw_tail & 0xFFFFFFFF;
+        const int32_t term_id = aeron_logbuffer_term_id(raw_tail);
+        const int64_t position = aeron_logbuffer_compute_term_begin_position(
+            term_id, publication->position_bits_to_shift, publication->initial_term_id) + term_offset;
+
+        if (term_count != (term_id - publication->initial_term_id))
+        {
+            return AERON_PUBLICATION_ADMIN_ACTION;
+        }
+
+        if (position < limit)
+        {
+            int32_t resulting_offset;
+
+            if (1 == fragment_count)
+            {
+                resulting_offset = aeron_term_appender_claim(
+                    &publication->log_buffer->mapped_raw_log.term_buffers[index],
+                    &publication->log_meta_data->term_tail_counters[index],
+                    length,
+                    buffer_claims,
+                    term_id,
+                    publication->session_id,
+                    publication->stream_id);
+            }
+            else
+            {
+                resulting_offset = aeron_term_appender_claim_fragmented(
+                    &publication->log_buffer->mapped_raw_log.term_buffers[index],
+                    &publication->log_meta_data->term_tail_counters[index],
+                    length,
+                    publication->max_payload_length,
+                    buffer_claims,
+                    term_id,
+                    publication->session_id,
+                    publication->stream_id);
+            }
+
+            if (resulting_offset > 0)
+            {
+                *claim_count = fragment_count;
+            }
+
+            new_position = aeron_publication_new_position(
+                publication, term_count, (int32_t)term_offset, term_id, position, resulting_offset);
+        }
+        else
+        {
+            new_position = aeron_publication_back_pressure_status(publication, position, (int32_t)length);
+        }
+    }
+
     return new_position;
 }
 
@@ -21,6 +21,29 @@
 #include "aeron_agent.h"
 #include "aeron_context.h"
 #include "aeron_client_conductor.h"
+#include "aeron_offer_stats.h"
+#include "util/aeron_bitutil.h"
+
+#define AERON_PUBLICATION_COMBINING_SLOT_COUNT (64)
+
+#define AERON_PUBLICATION_COMBINING_SLOT_FREE (0)
+#define AERON_PUBLICATION_COMBINING_SLOT_CLAIMED (1)
+#define AERON_PUBLICATION_COMBINING_SLOT_PENDING (2)
+#define AERON_PUBLICATION_COMBINING_SLOT_COMPLETE (3)
+
+/*
+ * A message waiting in the combining front end for a combiner to append it along with those of other threads, each
+ * slot on its own cache line so waiting threads do not share lines.
+ */
+typedef struct aeron_publication_combining_slot_stct
+{
+    const uint8_t *buffer;
+    size_t length;
+    int64_t result;
+    volatile int32_t state;
+    uint8_t pad[AERON_CACHE_LINE_LENGTH - (sizeof(uint8_t *) + sizeof(size_t) + sizeof(int64_t) + sizeof(int32_t))];
+}
+aeron_publication_combining_slot_t;
 
 typedef struct aeron_publication_stct
 {
@@ -51,7 +74,16 @@ typedef struct aeron_publication_stct
     aeron_notification_t on_close_complete;
     void *on_close_complete_clientd;
 
+    aeron_publication_combining_slot_t *combining_slots;
+    aeron_offer_stats_t *offer_stats;
+
     bool is_closed;
+
+    /* contended by every offering thread so kept off the lines they only read */
+    uint8_t pre_fields_padding[2 * AERON_CACHE_LINE_LENGTH];
+    volatile int32_t combining_next_slot;
+    volatile int32_t combining_lock;
+    uint8_t post_fields_padding[2 * AERON_CACHE_LINE_LENGTH];
 }
 aeron_publication_t;
 
@@ -82,6 +114,7 @@ inline int64_t aeron_publication_new_position(
 {
     if (resulting_offset > 0)
     {
+        aeron_logbuffer_notify_data(publication->log_meta_data);
         return (position - term_offset) + resulting_offset;
     }
 
@@ -0,0 +1,189 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <errno.h>
+
+#include "aeron_sub_stream_demultiplexer.h"
+#include "aeron_alloc.h"
+#include "util/aeron_error.h"
+
+static int64_t aeron_sub_stream_reserved_value_supplier(void *clientd, uint8_t *buffer, size_t frame_length)
+{
+    return *(int64_t *)clientd;
+}
+
+int64_t aeron_publication_offer_sub_stream(
+    aeron_publication_t *publication, int64_t sub_stream_id, const uint8_t *buffer, size_t length)
+{
+    return aeron_publication_offer(
+        publication, buffer, length, aeron_sub_stream_reserved_value_supplier, &sub_stream_id);
+}
+
+int64_t aeron_exclusive_publication_offer_sub_stream(
+    aeron_exclusive_publication_t *publication, int64_t sub_stream_id, const uint8_t *buffer, size_t length)
+{
+    return aeron_exclusive_publication_offer(
+        publication, buffer, length, aeron_sub_stream_reserved_value_supplier, &sub_stream_id);
+}
+
+int aeron_sub_stream_demultiplexer_create(
+    aeron_sub_stream_demultiplexer_t **demultiplexer, aeron_fragment_handler_t default_handler, void *default_clientd)
+{
+    aeron_sub_stream_demultiplexer_t *_demultiplexer;
+
+    if (NULL == demultiplexer)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_sub_stream_demultiplexer_create: %s", strerror(EINVAL));
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&_demultiplexer, sizeof(aeron_sub_stream_demultiplexer_t)) < 0)
+    {
+        aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
+        return -1;
+    }
+
+    if (aeron_int64_to_ptr_swiss_map_init(
+        &_demultiplexer->handler_by_sub_stream_id_map, 64, AERON_MAP_DEFAULT_LOAD_FACTOR) < 0)
+    {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "aeron_sub_stream_demultiplexer_create - handler map: %s", strerror(errcode));
+        aeron_free(_demultiplexer);
+        return -1;
+    }
+
+    _demultiplexer->default_handler.handler = default_handler;
+    _demultiplexer->default_handler.clientd = default_clientd;
+    _demultiplexer->last_sub_stream_id = 0;
+    _demultiplexer->last_handler = NULL;
+
+    *demultiplexer = _demultiplexer;
+    return 0;
+}
+
+static void aeron_sub_stream_demultiplexer_delete_handler(void *clientd, int64_t key, void *value)
+{
+    aeron_free(value);
+}
+
+int aeron_sub_stream_demultiplexer_delete(aeron_sub_stream_demultiplexer_t *demultiplexer)
+{
+    if (NULL != demultiplexer)
+    {
+        aeron_int64_to_ptr_swiss_map_for_each(
+            &demultiplexer->handler_by_sub_stream_id_map, aeron_sub_stream_demultiplexer_delete_handler, NULL);
+        aeron_int64_to_ptr_swiss_map_delete(&demultiplexer->handler_by_sub_stream_id_map);
+        aeron_free(demultiplexer);
+    }
+
+    return 0;
+}
+
+int aeron_sub_stream_demultiplexer_add(
+    aeron_sub_stream_demultiplexer_t *demultiplexer,
+    int64_t sub_stream_id,
+    aeron_fragment_handler_t handler,
+    void *clientd)
+{
+    if (NULL == demultiplexer || NULL == handler)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_sub_stream_demultiplexer_add: %s", strerror(EINVAL));
+        return -1;
+    }
+
+    aeron_sub_stream_handler_t *entry = aeron_int64_to_ptr_swiss_map_get(
+        &demultiplexer->handler_by_sub_stream_id_map, sub_stream_id);
+
+    if (NULL == entry)
+    {
+        if (aeron_alloc((void **)&entry, sizeof(aeron_sub_stream_handler_t)) < 0)
+        {
+            aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
+            return -1;
+        }
+
+        if (aeron_int64_to_ptr_swiss_map_put(&demultiplexer->handler_by_sub_stream_id_map, sub_stream_id, entry) < 0)
+        {
+            int errcode = errno;
+
+            aeron_set_err(errcode, "aeron_sub_stream_demultiplexer_add - handler map: %s", strerror(errcode));
+            aeron_free(entry);
+            return -1;
+        }
+    }
+
+    entry->handler = handler;
+    entry->clientd = clientd;
+
+    return 0;
+}
+
+int aeron_sub_stream_demultiplexer_remove(aeron_sub_stream_demultiplexer_t *demultiplexer, int64_t sub_stream_id)
+{
+    if (NULL == demultiplexer)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_sub_stream_demultiplexer_remove: %s", strerror(EINVAL));
+        return -1;
+    }
+
+    aeron_sub_stream_handler_t *entry = aeron_int64_to_ptr_swiss_map_remove(
+        &demultiplexer->handler_by_sub_stream_id_map, sub_stream_id);
+
+    if (NULL == entry)
+    {
+        return 0;
+    }
+
+    if (entry == demultiplexer->last_handler)
+    {
+        demultiplexer->last_handler = NULL;
+    }
+
+    aeron_free(entry);
+
+    return 1;
+}
+
+void aeron_sub_stream_demultiplexer_handler(
+    void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header)
+{
+    aeron_sub_stream_demultiplexer_t *demultiplexer = (aeron_sub_stream_demultiplexer_t *)clientd;
+    const int64_t sub_stream_id = header->frame->reserved_value;
+    aeron_sub_stream_handler_t *entry = demultiplexer->last_handler;
+
+    if (NULL == entry || sub_stream_id != demultiplexer->last_sub_stream_id)
+    {
+        entry = aeron_int64_to_ptr_swiss_map_get(&demultiplexer->handler_by_sub_stream_id_map, sub_stream_id);
+        if (NULL == entry)
+        {
+            entry = &demultiplexer->default_handler;
+        }
+        else
+        {
+            demultiplexer->last_sub_stream_id = sub_stream_id;
+            demultiplexer->last_handler = entry;
+        }
+    }
+
+    if (NULL != entry->handler)
+    {
+        entry->handler(entry->clientd, buffer, length, header);
+    }
+}
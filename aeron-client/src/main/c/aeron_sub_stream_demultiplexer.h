@@ -0,0 +1,42 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_C_SUB_STREAM_DEMULTIPLEXER_H
+#define AERON_C_SUB_STREAM_DEMULTIPLEXER_H
+
+#include "aeronc.h"
+#include "aeron_image.h"
+#include "collections/aeron_int64_to_ptr_swiss_map.h"
+
+typedef struct aeron_sub_stream_handler_stct
+{
+    aeron_fragment_handler_t handler;
+    void *clientd;
+}
+aeron_sub_stream_handler_t;
+
+typedef struct aeron_sub_stream_demultiplexer_stct
+{
+    aeron_int64_to_ptr_swiss_map_t handler_by_sub_stream_id_map;
+    aeron_sub_stream_handler_t default_handler;
+
+    /* frames of a sub-stream tend to arrive in runs so the last lookup is kept to skip the map */
+    int64_t last_sub_stream_id;
+    aeron_sub_stream_handler_t *last_handler;
+}
+aeron_sub_stream_demultiplexer_t;
+
+#endif //AERON_C_SUB_STREAM_DEMULTIPLEXER_H
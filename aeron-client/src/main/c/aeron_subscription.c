@@ -18,6 +18,95 @@
 
 #include "aeron_subscription.h"
 #include "aeron_image.h"
+#include "concurrent/aeron_thread.h"
+
+#define AERON_SUBSCRIPTION_INLINE_RECEIVE_PARAM "inline-receive=true"
+
+static int aeron_subscription_inline_receive_init(aeron_subscription_t *subscription)
+{
+    subscription->inline_receive.bytes_received = NULL;
+    subscription->inline_receive.fd = -1;
+    subscription->inline_receive.buffer = NULL;
+
+    if (NULL == subscription->conductor ||
+        NULL == strstr(subscription->channel, AERON_SUBSCRIPTION_INLINE_RECEIVE_PARAM))
+    {
+        return 0;
+    }
+
+    aeron_counters_reader_t *counters_reader = &subscription->conductor->counters_reader;
+    const int32_t counter_id = aeron_counter_heartbeat_timestamp_find_counter_id_by_registration_id(
+        counters_reader, AERON_COUNTER_RECEIVER_INLINE_TYPE_ID, subscription->registration_id);
+
+    if (AERON_NULL_COUNTER_ID == counter_id)
+    {
+        return 0;
+    }
+
+    aeron_counter_metadata_descriptor_t *metadata = (aeron_counter_metadata_descriptor_t *)(
+        counters_reader->metadata + AERON_COUNTER_METADATA_OFFSET(counter_id));
+    aeron_receiver_inline_key_layout_t layout;
+    struct sockaddr_storage bind_addr;
+    memcpy(&layout, metadata->key, sizeof(layout));
+    memset(&bind_addr, 0, sizeof(bind_addr));
+
+    if (AERON_COUNTER_SENDER_INLINE_ADDRESS_IPV6 == layout.address_type)
+    {
+        struct sockaddr_in6 *in6_addr = (struct sockaddr_in6 *)&bind_addr;
+        in6_addr->sin6_family = AF_INET6;
+        in6_addr->sin6_port = htons((uint16_t)layout.port);
+        memcpy(&in6_addr->sin6_addr, layout.address, sizeof(struct in6_addr));
+    }
+    else
+    {
+        struct sockaddr_in *in_addr = (struct sockaddr_in *)&bind_addr;
+        in_addr->sin_family = AF_INET;
+        in_addr->sin_port = htons((uint16_t)layout.port);
+        memcpy(&in_addr->sin_addr, layout.address, sizeof(struct in_addr));
+    }
+
+    aeron_socket_t fd = aeron_socket(bind_addr.ss_family, SOCK_DGRAM, 0);
+    if (fd < 0)
+    {
+        aeron_set_err_from_last_err_code("inline receive socket for %s", subscription->channel);
+        return -1;
+    }
+
+#if defined(SO_REUSEPORT)
+    int reuse = 1;
+    if (aeron_setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &reuse, sizeof(reuse)) < 0)
+    {
+        aeron_set_err_from_last_err_code("inline receive setsockopt(SO_REUSEPORT) for %s", subscription->channel);
+        aeron_close_socket(fd);
+        return -1;
+    }
+#else
+    aeron_set_err(EINVAL, "SO_REUSEPORT not supported on this platform for %s", subscription->channel);
+    aeron_close_socket(fd);
+    return -1;
+#endif
+
+    const socklen_t bind_addr_len = AF_INET6 == bind_addr.ss_family ?
+        sizeof(struct sockaddr_in6) : sizeof(struct sockaddr_in);
+
+    if (set_socket_non_blocking(fd) < 0 || bind(fd, (struct sockaddr *)&bind_addr, bind_addr_len) < 0)
+    {
+        aeron_set_err_from_last_err_code("inline receive bind for %s", subscription->channel);
+        aeron_close_socket(fd);
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&subscription->inline_receive.buffer, AERON_MAX_UDP_PAYLOAD_LENGTH) < 0)
+    {
+        aeron_close_socket(fd);
+        return -1;
+    }
+
+    subscription->inline_receive.fd = fd;
+    subscription->inline_receive.bytes_received = aeron_counters_reader_addr(counters_reader, counter_id);
+
+    return 0;
+}
 
 int aeron_subscription_create(
     aeron_subscription_t **subscription,
@@ -45,12 +134,23 @@ int aeron_subscription_create(
 
     _subscription->command_base.type = AERON_CLIENT_TYPE_SUBSCRIPTION;
 
-    _subscription->conductor_fields.image_lists_head.next_list = NULL;
-    _subscription->conductor_fields.next_change_number = 0;
-    _subscription->last_image_list_change_number = -1;
+    _subscription->conductor_fields.image_list = NULL;
+    aeron_epoch_participant_init(&_subscription->epoch_participant);
+    aeron_epoch_shared_participant_init(&_subscription->lookup_epoch_participant);
+
+    if (aeron_subscription_alloc_image_list(&_subscription->conductor_fields.image_list, 0) < 0)
+    {
+        return -1;
+    }
 
-    if (aeron_subscription_alloc_image_list(&_subscription->conductor_fields.image_lists_head.next_list, 0) < 0)
+    if (NULL != conductor &&
+        (aeron_epoch_reclaimer_add_participant(&conductor->epoch_reclaimer, &_subscription->epoch_participant) < 0 ||
+        aeron_epoch_reclaimer_add_shared_participant(
+            &conductor->epoch_reclaimer, &_subscription->lookup_epoch_participant) < 0))
     {
+        int errcode = errno;
+
+        aeron_set_err(errcode, "aeron_subscription_create (%d): %s", errcode, strerror(errcode));
         return -1;
     }
 
@@ -66,9 +166,26 @@ int aeron_subscription_create(
     _subscription->on_unavailable_image = on_unavailable_image;
     _subscription->on_unavailable_image_clientd = on_unavailable_image_clientd;
 
+    _subscription->readiness_addr = NULL;
     _subscription->round_robin_index = 0;
+    _subscription->is_readiness_resolved = false;
     _subscription->is_closed = false;
 
+    if (aeron_subscription_inline_receive_init(_subscription) < 0)
+    {
+        if (NULL != _subscription->epoch_participant.reclaimer)
+        {
+            aeron_epoch_reclaimer_remove_shared_participant(
+                _subscription->epoch_participant.reclaimer, &_subscription->lookup_epoch_participant);
+            aeron_epoch_reclaimer_remove_participant(
+                _subscription->epoch_participant.reclaimer, &_subscription->epoch_participant);
+        }
+
+        aeron_free((void *)_subscription->conductor_fields.image_list);
+        aeron_free(_subscription);
+        return -1;
+    }
+
     *subscription = _subscription;
 
     return 0;
@@ -76,16 +193,22 @@ int aeron_subscription_create(
 
 int aeron_subscription_delete(aeron_subscription_t *subscription)
 {
-    volatile aeron_image_list_t *prune_lists_head = &subscription->conductor_fields.image_lists_head;
-
-    while (NULL != prune_lists_head->next_list)
+    if (-1 != subscription->inline_receive.fd)
     {
-        volatile aeron_image_list_t *prune_list = prune_lists_head->next_list;
+        aeron_close_socket(subscription->inline_receive.fd);
+    }
 
-        prune_lists_head->next_list = prune_list->next_list;
-        aeron_free((void *)prune_list);
+    aeron_free(subscription->inline_receive.buffer);
+
+    if (NULL != subscription->epoch_participant.reclaimer)
+    {
+        aeron_epoch_reclaimer_remove_shared_participant(
+            subscription->epoch_participant.reclaimer, &subscription->lookup_epoch_participant);
+        aeron_epoch_reclaimer_remove_participant(
+            subscription->epoch_participant.reclaimer, &subscription->epoch_participant);
     }
 
+    aeron_free((void *)subscription->conductor_fields.image_list);
     aeron_free((void *)subscription->channel);
     aeron_free(subscription);
 
@@ -108,7 +231,7 @@ int aeron_subscription_close(
         if (!is_closed)
         {
             AERON_PUT_ORDERED(subscription->is_closed, true);
-            if (aeron_client_conductor_async_close_subscription(
+            if (NULL != subscription->conductor && aeron_client_conductor_async_close_subscription(
                 subscription->conductor, subscription, on_close_complete, on_close_complete_clientd) < 0)
             {
                 return -1;
@@ -119,6 +242,62 @@ int aeron_subscription_close(
     return 0;
 }
 
+/*
+ * Datagrams are received until the socket is empty or the limit is reached. The driver steers only data frames with a
+ * payload for the stream here, those for an image the subscription does not have yet are dropped and recovered by NAK.
+ */
+void aeron_subscription_inline_receive(aeron_subscription_t *subscription, volatile aeron_image_list_t *image_list)
+{
+    uint8_t *buffer = subscription->inline_receive.buffer;
+    const aeron_data_header_t *header = (const aeron_data_header_t *)buffer;
+    int64_t bytes_received = 0;
+
+    for (int n = 0; n < AERON_SUBSCRIPTION_INLINE_RECEIVE_LIMIT; n++)
+    {
+        struct iovec iov;
+        struct msghdr message;
+
+        iov.iov_base = buffer;
+        iov.iov_len = AERON_MAX_UDP_PAYLOAD_LENGTH;
+        message.msg_name = NULL;
+        message.msg_namelen = 0;
+        message.msg_iov = &iov;
+        message.msg_iovlen = 1;
+        message.msg_control = NULL;
+        message.msg_controllen = 0;
+        message.msg_flags = 0;
+
+        const ssize_t length = recvmsg(subscription->inline_receive.fd, &message, 0);
+        if (length < 0)
+        {
+            break;
+        }
+
+        if (length <= (ssize_t)AERON_DATA_HEADER_LENGTH ||
+            AERON_HDR_TYPE_DATA != header->frame_header.type ||
+            subscription->stream_id != header->stream_id)
+        {
+            continue;
+        }
+
+        for (size_t i = 0, image_count = image_list->length; i < image_count; i++)
+        {
+            aeron_image_t *image = image_list->array[i];
+
+            if (header->session_id == image->session_id)
+            {
+                bytes_received += (int64_t)aeron_image_rebuild_inline(image, buffer, (size_t)length);
+                break;
+            }
+        }
+    }
+
+    if (bytes_received > 0)
+    {
+        aeron_counter_add_ordered(subscription->inline_receive.bytes_received, bytes_received);
+    }
+}
+
 int aeron_subscription_alloc_image_list(volatile aeron_image_list_t **image_list, size_t length)
 {
     aeron_image_list_t *_image_list;
@@ -132,19 +311,22 @@ int aeron_subscription_alloc_image_list(volatile aeron_image_list_t **image_list
         return -1;
     }
 
-    _image_list->change_number = -1;
     _image_list->array = 0 == length ? NULL : (aeron_image_t **)((uint8_t *)_image_list + sizeof(aeron_image_list_t));
     _image_list->length = (uint32_t)length;
-    _image_list->next_list = NULL;
 
     *image_list = _image_list;
 
     return 0;
 }
 
+static void aeron_subscription_release_removed_image(void *clientd, void *item)
+{
+    aeron_image_decr_refcnt((aeron_image_t *)item);
+}
+
 int aeron_client_conductor_subscription_add_image(aeron_subscription_t *subscription, aeron_image_t *image)
 {
-    volatile aeron_image_list_t *current_image_list = subscription->conductor_fields.image_lists_head.next_list;
+    volatile aeron_image_list_t *current_image_list = subscription->conductor_fields.image_list;
     volatile aeron_image_list_t *new_image_list;
     size_t old_length = current_image_list->length;
 
@@ -165,7 +347,7 @@ int aeron_client_conductor_subscription_add_image(aeron_subscription_t *subscrip
 
 int aeron_client_conductor_subscription_remove_image(aeron_subscription_t *subscription, aeron_image_t *image)
 {
-    volatile aeron_image_list_t *current_image_list = subscription->conductor_fields.image_lists_head.next_list;
+    volatile aeron_image_list_t *current_image_list = subscription->conductor_fields.image_list;
     volatile aeron_image_list_t *new_image_list;
     size_t old_length = current_image_list->length;
     int image_index = aeron_subscription_find_image_index(current_image_list, image);
@@ -189,61 +371,65 @@ int aeron_client_conductor_subscription_remove_image(aeron_subscription_t *subsc
         }
     }
 
-    image->removal_change_number = subscription->conductor_fields.next_change_number;
+    if (aeron_client_conductor_subscription_install_new_image_list(subscription, new_image_list) < 0)
+    {
+        return -1;
+    }
 
-    return aeron_client_conductor_subscription_install_new_image_list(subscription, new_image_list);
+    aeron_epoch_reclaimer_t *reclaimer = subscription->epoch_participant.reclaimer;
+    if (NULL != reclaimer)
+    {
+        aeron_epoch_reclaimer_retire(reclaimer, image, aeron_subscription_release_removed_image, NULL);
+    }
+    else
+    {
+        aeron_image_decr_refcnt(image);
+    }
+
+    return 0;
 }
 
 int aeron_client_conductor_subscription_install_new_image_list(
     aeron_subscription_t *subscription, volatile aeron_image_list_t *image_list)
 {
     /*
-     * Called from the client conductor to add/remove images to the image list. A new image list is passed each time.
+     * Called from the client conductor to add/remove images to the image list. A new image list is passed each time
+     * and the old one is retired until no poll can still be using it. A subscription with no reclaimer is not yet
+     * shared with a polling thread, so its old list is freed at once.
      */
-    image_list->change_number = subscription->conductor_fields.next_change_number++;
-    image_list->next_list = subscription->conductor_fields.image_lists_head.next_list;
-
-    AERON_PUT_ORDERED(subscription->conductor_fields.image_lists_head.next_list, image_list);
+    volatile aeron_image_list_t *old_image_list = subscription->conductor_fields.image_list;
+    aeron_epoch_reclaimer_t *reclaimer = subscription->epoch_participant.reclaimer;
 
-    return 0;
-}
+    if (NULL != reclaimer && aeron_epoch_reclaimer_reserve(reclaimer, 2) < 0)
+    {
+        int errcode = errno;
 
-int aeron_client_conductor_subscription_prune_image_lists(aeron_subscription_t *subscription)
-{
-    /*
-     * Called from the client conductor to prune old image lists and free them up. Does not free Images.
-     */
-    volatile aeron_image_list_t *prune_lists_head = &subscription->conductor_fields.image_lists_head;
-    int64_t last_change_number;
-    int pruned_lists_count = 0;
+        aeron_set_err(errcode, "install_new_image_list (%d): %s", errcode, strerror(errcode));
+        aeron_free((void *)image_list);
+        return -1;
+    }
 
-    AERON_GET_VOLATILE(last_change_number, subscription->last_image_list_change_number);
+    AERON_PUT_ORDERED(subscription->conductor_fields.image_list, image_list);
 
-    while (NULL != prune_lists_head->next_list)
+    if (NULL != reclaimer)
     {
-        if (prune_lists_head->next_list->change_number >= last_change_number)
-        {
-            prune_lists_head = prune_lists_head->next_list;
-        }
-        else
-        {
-            volatile aeron_image_list_t *prune_list = prune_lists_head->next_list;
-
-            prune_lists_head->next_list = prune_list->next_list;
-            aeron_free((void *)prune_list);
-            pruned_lists_count++;
-        }
+        aeron_epoch_reclaimer_retire(reclaimer, (void *)old_image_list, aeron_epoch_reclaimer_free_item, NULL);
+    }
+    else
+    {
+        aeron_free((void *)old_image_list);
     }
 
-    return pruned_lists_count;
+    return 0;
 }
 
 bool aeron_subscription_is_connected(aeron_subscription_t *subscription)
 {
     volatile aeron_image_list_t *image_list;
+    aeron_epoch_participant_t *slot;
     bool result = false;
 
-    AERON_GET_VOLATILE(image_list, subscription->conductor_fields.image_lists_head.next_list);
+    image_list = aeron_subscription_enter_image_list_lookup(subscription, &slot);
 
     for (size_t i = 0, length = image_list->length; i < length; i++)
     {
@@ -254,7 +440,7 @@ bool aeron_subscription_is_connected(aeron_subscription_t *subscription)
         }
     }
 
-    aeron_subscription_propose_last_image_change_number(subscription, image_list->change_number);
+    aeron_subscription_exit_image_list_lookup(slot);
 
     return result;
 }
@@ -281,18 +467,22 @@ int aeron_subscription_constants(aeron_subscription_t *subscription, aeron_subsc
 int aeron_subscription_image_count(aeron_subscription_t *subscription)
 {
     volatile aeron_image_list_t *image_list;
+    aeron_epoch_participant_t *slot;
 
-    AERON_GET_VOLATILE(image_list, subscription->conductor_fields.image_lists_head.next_list);
+    image_list = aeron_subscription_enter_image_list_lookup(subscription, &slot);
+    int image_count = (int)image_list->length;
+    aeron_subscription_exit_image_list_lookup(slot);
 
-    return image_list->length;
+    return image_count;
 }
 
 aeron_image_t *aeron_subscription_image_by_session_id(aeron_subscription_t *subscription, int32_t session_id)
 {
     volatile aeron_image_list_t *image_list;
+    aeron_epoch_participant_t *slot;
     aeron_image_t *result = NULL;
 
-    AERON_GET_VOLATILE(image_list, subscription->conductor_fields.image_lists_head.next_list);
+    image_list = aeron_subscription_enter_image_list_lookup(subscription, &slot);
 
     for (size_t i = 0, length = image_list->length; i < length; i++)
     {
@@ -308,7 +498,7 @@ aeron_image_t *aeron_subscription_image_by_session_id(aeron_subscription_t *subs
         aeron_image_incr_refcnt(result);
     }
 
-    aeron_subscription_propose_last_image_change_number(subscription, image_list->change_number);
+    aeron_subscription_exit_image_list_lookup(slot);
 
     return result;
 }
@@ -316,9 +506,10 @@ aeron_image_t *aeron_subscription_image_by_session_id(aeron_subscription_t *subs
 aeron_image_t *aeron_subscription_image_at_index(aeron_subscription_t *subscription, size_t index)
 {
     volatile aeron_image_list_t *image_list;
+    aeron_epoch_participant_t *slot;
     aeron_image_t *result = NULL;
 
-    AERON_GET_VOLATILE(image_list, subscription->conductor_fields.image_lists_head.next_list);
+    image_list = aeron_subscription_enter_image_list_lookup(subscription, &slot);
 
     if (index < image_list->length)
     {
@@ -326,7 +517,7 @@ aeron_image_t *aeron_subscription_image_at_index(aeron_subscription_t *subscript
         aeron_image_incr_refcnt(result);
     }
 
-    aeron_subscription_propose_last_image_change_number(subscription, image_list->change_number);
+    aeron_subscription_exit_image_list_lookup(slot);
 
     return result;
 }
@@ -334,20 +525,32 @@ aeron_image_t *aeron_subscription_image_at_index(aeron_subscription_t *subscript
 void aeron_subscription_for_each_image(
     aeron_subscription_t *subscription, void (*handler)(aeron_image_t *image, void *clientd), void *clientd)
 {
-    volatile aeron_image_list_t *image_list;
+    /*
+     * The image is retained rather than the list held across the handler, so a handler which looks up images again
+     * cannot wait on lookup slots held by handlers on other threads.
+     */
+    for (size_t i = 0; true; i++)
+    {
+        volatile aeron_image_list_t *image_list;
+        aeron_epoch_participant_t *slot;
+        aeron_image_t *image = NULL;
 
-    AERON_GET_VOLATILE(image_list, subscription->conductor_fields.image_lists_head.next_list);
+        image_list = aeron_subscription_enter_image_list_lookup(subscription, &slot);
+        if (i < image_list->length)
+        {
+            image = image_list->array[i];
+            aeron_image_incr_refcnt(image);
+        }
+        aeron_subscription_exit_image_list_lookup(slot);
 
-    for (size_t i = 0, length = image_list->length; i < length; i++)
-    {
-        aeron_image_t *image = image_list->array[i];
+        if (NULL == image)
+        {
+            break;
+        }
 
-        aeron_image_incr_refcnt(image);
-        handler(image_list->array[i], clientd);
+        handler(image, clientd);
         aeron_image_decr_refcnt(image);
     }
-
-    aeron_subscription_propose_last_image_change_number(subscription, image_list->change_number);
 }
 
 int aeron_subscription_image_retain(aeron_subscription_t *subscription, aeron_image_t *image)
@@ -359,13 +562,6 @@ int aeron_subscription_image_retain(aeron_subscription_t *subscription, aeron_im
         return -1;
     }
 
-    /*
-    * Update the subscriptions last image change number so that if the subscription isn't polling or touching
-    * or touched the image list, then at least this will allow the previous image_lists to be reclaimed.
-    */
-    aeron_subscription_propose_last_image_change_number(
-        subscription, aeron_subscription_last_image_list_change_number(subscription));
-
     aeron_image_incr_refcnt(image);
 
     return 0;
@@ -380,13 +576,6 @@ int aeron_subscription_image_release(aeron_subscription_t *subscription, aeron_i
         return -1;
     }
 
-    /*
-     * Update the subscriptions last image change number so that if the subscription isn't polling or touching
-     * or touched the image list, then at least this will allow the previous image_lists to be reclaimed.
-     */
-    aeron_subscription_propose_last_image_change_number(
-        subscription, aeron_subscription_last_image_list_change_number(subscription));
-
     aeron_image_decr_refcnt(image);
 
     return 0;
@@ -422,16 +611,161 @@ int aeron_subscription_poll(
 {
     volatile aeron_image_list_t *image_list;
 
-    AERON_GET_VOLATILE(image_list, subscription->conductor_fields.image_lists_head.next_list);
+    image_list = aeron_subscription_enter_image_list(subscription);
+
+    if (-1 != subscription->inline_receive.fd)
+    {
+        aeron_subscription_inline_receive(subscription, image_list);
+    }
+
+    size_t length = image_list->length;
+    size_t fragments_read = 0;
+    size_t starting_index = subscription->round_robin_index++;
+    if (starting_index >= length)
+    {
+        subscription->round_robin_index = starting_index = 0;
+    }
+
+    for (size_t i = starting_index; i < length && fragments_read < fragment_limit; i++)
+    {
+        fragments_read += (size_t)aeron_image_poll(
+            image_list->array[i], handler, clientd, fragment_limit - fragments_read);
+    }
+
+    for (size_t i = 0; i < starting_index && fragments_read < fragment_limit; i++)
+    {
+        fragments_read += (size_t)aeron_image_poll(
+            image_list->array[i], handler, clientd, fragment_limit - fragments_read);
+    }
+
+    aeron_subscription_exit_image_list(subscription);
+
+    return (int)fragments_read;
+}
+
+static void aeron_subscription_resolve_readiness(aeron_subscription_t *subscription)
+{
+    subscription->is_readiness_resolved = true;
+
+    if (NULL != subscription->conductor)
+    {
+        aeron_counters_reader_t *counters_reader = &subscription->conductor->counters_reader;
+        int32_t counter_id = aeron_counter_heartbeat_timestamp_find_counter_id_by_registration_id(
+            counters_reader, AERON_COUNTER_SUBSCRIPTION_READINESS_TYPE_ID, subscription->registration_id);
+
+        if (AERON_NULL_COUNTER_ID != counter_id)
+        {
+            subscription->readiness_addr = aeron_counters_reader_addr(counters_reader, counter_id);
+        }
+    }
+}
+
+int aeron_subscription_poll_ready(
+    aeron_subscription_t *subscription, aeron_fragment_handler_t handler, void *clientd, size_t fragment_limit)
+{
+    if (!subscription->is_readiness_resolved)
+    {
+        aeron_subscription_resolve_readiness(subscription);
+    }
+
+    /* frames received inline do not pass the Receiver, which is what marks images as ready */
+    if (NULL == subscription->readiness_addr || -1 != subscription->inline_receive.fd)
+    {
+        return aeron_subscription_poll(subscription, handler, clientd, fragment_limit);
+    }
+
+    int64_t ready = aeron_counter_take_bits(subscription->readiness_addr);
+    if (0 == ready)
+    {
+        return 0;
+    }
+
+    volatile aeron_image_list_t *image_list;
+
+    image_list = aeron_subscription_enter_image_list(subscription);
+
+    size_t length = image_list->length;
+    size_t fragments_read = 0;
+    size_t starting_index = subscription->round_robin_index++;
+    if (starting_index >= length)
+    {
+        subscription->round_robin_index = starting_index = 0;
+    }
+
+    for (size_t n = 0; n < length && fragments_read < fragment_limit; n++)
+    {
+        size_t i = starting_index + n < length ? starting_index + n : starting_index + n - length;
+        aeron_image_t *image = image_list->array[i];
+
+        if (0 != (ready & aeron_counter_readiness_bit(image->session_id)))
+        {
+            fragments_read += (size_t)aeron_image_poll(image, handler, clientd, fragment_limit - fragments_read);
+        }
+    }
+
+    aeron_subscription_exit_image_list(subscription);
+
+    if (fragments_read >= fragment_limit)
+    {
+        aeron_counter_set_bits(subscription->readiness_addr, ready);
+    }
+
+    return (int)fragments_read;
+}
+
+int aeron_subscription_weighted_poll(
+    aeron_subscription_t *subscription,
+    aeron_fragment_handler_t handler,
+    void *clientd,
+    aeron_image_poll_weight_func_t weight_func,
+    void *weight_clientd,
+    size_t fragment_limit)
+{
+    if (NULL == subscription || NULL == handler || NULL == weight_func)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_subscription_weighted_poll(NULL): %s", strerror(EINVAL));
+        return -1;
+    }
+
+    volatile aeron_image_list_t *image_list;
+
+    image_list = aeron_subscription_enter_image_list(subscription);
+
+    if (-1 != subscription->inline_receive.fd)
+    {
+        aeron_subscription_inline_receive(subscription, image_list);
+    }
 
     size_t length = image_list->length;
     size_t fragments_read = 0;
+    size_t total_weight = 0;
     size_t starting_index = subscription->round_robin_index++;
     if (starting_index >= length)
     {
         subscription->round_robin_index = starting_index = 0;
     }
 
+    for (size_t i = 0; i < length; i++)
+    {
+        total_weight += weight_func(weight_clientd, image_list->array[i]->session_id);
+    }
+
+    for (size_t j = 0; j < length && fragments_read < fragment_limit && total_weight > 0; j++)
+    {
+        aeron_image_t *image = image_list->array[(starting_index + j) % length];
+        size_t weight = weight_func(weight_clientd, image->session_id);
+
+        if (weight > 0)
+        {
+            size_t share = (size_t)(((double)fragment_limit * (double)weight) / (double)total_weight);
+            size_t remaining = fragment_limit - fragments_read;
+            share = share < 1 ? 1 : share;
+
+            fragments_read += (size_t)aeron_image_poll(image, handler, clientd, share < remaining ? share : remaining);
+        }
+    }
+
     for (size_t i = starting_index; i < length && fragments_read < fragment_limit; i++)
     {
         fragments_read += (size_t)aeron_image_poll(
@@ -444,11 +778,121 @@ int aeron_subscription_poll(
             image_list->array[i], handler, clientd, fragment_limit - fragments_read);
     }
 
-    aeron_subscription_propose_last_image_change_number(subscription, image_list->change_number);
+    aeron_subscription_exit_image_list(subscription);
+
+    return (int)fragments_read;
+}
+
+int aeron_subscription_batch_poll(
+    aeron_subscription_t *subscription, aeron_fragment_t *fragments, size_t fragment_limit)
+{
+    volatile aeron_image_list_t *image_list;
+
+    image_list = aeron_subscription_enter_image_list(subscription);
+
+    if (-1 != subscription->inline_receive.fd)
+    {
+        aeron_subscription_inline_receive(subscription, image_list);
+    }
+
+    size_t length = image_list->length;
+    size_t fragments_read = 0;
+    size_t starting_index = subscription->round_robin_index++;
+    if (starting_index >= length)
+    {
+        subscription->round_robin_index = starting_index = 0;
+    }
+
+    for (size_t i = starting_index; i < length && fragments_read < fragment_limit; i++)
+    {
+        fragments_read += (size_t)aeron_image_batch_poll(
+            image_list->array[i], fragments + fragments_read, fragment_limit - fragments_read);
+    }
+
+    for (size_t i = 0; i < starting_index && fragments_read < fragment_limit; i++)
+    {
+        fragments_read += (size_t)aeron_image_batch_poll(
+            image_list->array[i], fragments + fragments_read, fragment_limit - fragments_read);
+    }
+
+    aeron_subscription_exit_image_list(subscription);
 
     return (int)fragments_read;
 }
 
+int aeron_subscription_wait_for_data(aeron_subscription_t *subscription, int64_t timeout_ns)
+{
+    if (NULL == subscription)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_subscription_wait_for_data(NULL): %s", strerror(EINVAL));
+        return -1;
+    }
+
+    const int64_t deadline_ns = aeron_nano_clock() + timeout_ns;
+    int result = 0;
+
+    do
+    {
+        volatile aeron_image_list_t *image_list;
+        int32_t original, sequence = 0;
+
+        image_list = aeron_subscription_enter_image_list(subscription);
+        size_t length = image_list->length;
+
+        /* the socket does not wake a waiter, so it is only received from once per wait slice */
+        if (-1 != subscription->inline_receive.fd)
+        {
+            aeron_subscription_inline_receive(subscription, image_list);
+        }
+
+        for (size_t i = 0; i < length; i++)
+        {
+            AERON_GET_AND_ADD_INT32(original, image_list->array[i]->metadata->data_waiter_count, 1);
+        }
+
+        if (length > 0)
+        {
+            AERON_GET_VOLATILE(sequence, image_list->array[0]->metadata->data_notification_sequence);
+        }
+
+        for (size_t i = 0; i < length; i++)
+        {
+            if (!aeron_image_is_closed(image_list->array[i]) && aeron_image_is_data_available(image_list->array[i]))
+            {
+                result = 1;
+                break;
+            }
+        }
+
+        const int64_t remaining_ns = deadline_ns - aeron_nano_clock();
+        if (0 == result && remaining_ns > 0)
+        {
+            const int64_t wait_ns = remaining_ns < AERON_LOGBUFFER_DATA_WAIT_SLICE_NS ?
+                remaining_ns : AERON_LOGBUFFER_DATA_WAIT_SLICE_NS;
+
+            if (length > 0)
+            {
+                aeron_logbuffer_wait_for_data_notification(image_list->array[0]->metadata, sequence, wait_ns);
+            }
+            else
+            {
+                aeron_nano_sleep((uint64_t)wait_ns);
+            }
+        }
+
+        for (size_t i = 0; i < length; i++)
+        {
+            AERON_GET_AND_ADD_INT32(original, image_list->array[i]->metadata->data_waiter_count, -1);
+        }
+
+        aeron_subscription_exit_image_list(subscription);
+    }
+    while (0 == result && aeron_nano_clock() < deadline_ns);
+
+    return result;
+}
+
 int aeron_subscription_controlled_poll(
     aeron_subscription_t *subscription,
     aeron_controlled_fragment_handler_t handler,
@@ -457,7 +901,12 @@ int aeron_subscription_controlled_poll(
 {
     volatile aeron_image_list_t *image_list;
 
-    AERON_GET_VOLATILE(image_list, subscription->conductor_fields.image_lists_head.next_list);
+    image_list = aeron_subscription_enter_image_list(subscription);
+
+    if (-1 != subscription->inline_receive.fd)
+    {
+        aeron_subscription_inline_receive(subscription, image_list);
+    }
 
     size_t length = image_list->length;
     size_t fragments_read = 0;
@@ -479,7 +928,7 @@ int aeron_subscription_controlled_poll(
             image_list->array[i], handler, clientd, fragment_limit - fragments_read);
     }
 
-    aeron_subscription_propose_last_image_change_number(subscription, image_list->change_number);
+    aeron_subscription_exit_image_list(subscription);
 
     return (int)fragments_read;
 }
@@ -490,7 +939,12 @@ long aeron_subscription_block_poll(
     volatile aeron_image_list_t *image_list;
     long bytes_consumed = 0;
 
-    AERON_GET_VOLATILE(image_list, subscription->conductor_fields.image_lists_head.next_list);
+    image_list = aeron_subscription_enter_image_list(subscription);
+
+    if (-1 != subscription->inline_receive.fd)
+    {
+        aeron_subscription_inline_receive(subscription, image_list);
+    }
 
     for (size_t i = 0, length = image_list->length; i < length; i++)
     {
@@ -498,7 +952,34 @@ long aeron_subscription_block_poll(
             image_list->array[i], handler, clientd, block_length_limit);
     }
 
-    aeron_subscription_propose_last_image_change_number(subscription, image_list->change_number);
+    aeron_subscription_exit_image_list(subscription);
+
+    return bytes_consumed;
+}
+
+long aeron_subscription_controlled_block_poll(
+    aeron_subscription_t *subscription,
+    aeron_controlled_block_handler_t handler,
+    void *clientd,
+    size_t block_length_limit)
+{
+    volatile aeron_image_list_t *image_list;
+    long bytes_consumed = 0;
+
+    image_list = aeron_subscription_enter_image_list(subscription);
+
+    if (-1 != subscription->inline_receive.fd)
+    {
+        aeron_subscription_inline_receive(subscription, image_list);
+    }
+
+    for (size_t i = 0, length = image_list->length; i < length; i++)
+    {
+        bytes_consumed += aeron_image_controlled_block_poll(
+            image_list->array[i], handler, clientd, block_length_limit);
+    }
+
+    aeron_subscription_exit_image_list(subscription);
 
     return bytes_consumed;
 }
@@ -528,7 +1009,9 @@ int64_t aeron_header_position(aeron_header_t *header)
 }
 
 extern int aeron_subscription_find_image_index(volatile aeron_image_list_t *image_list, aeron_image_t *image);
-extern int64_t aeron_subscription_last_image_list_change_number(aeron_subscription_t *subscription);
-extern void aeron_subscription_propose_last_image_change_number(
-    aeron_subscription_t *subscription, int64_t change_number);
+extern volatile aeron_image_list_t *aeron_subscription_enter_image_list(aeron_subscription_t *subscription);
+extern void aeron_subscription_exit_image_list(aeron_subscription_t *subscription);
+extern volatile aeron_image_list_t *aeron_subscription_enter_image_list_lookup(
+    aeron_subscription_t *subscription, aeron_epoch_participant_t **slot);
+extern void aeron_subscription_exit_image_list_lookup(aeron_epoch_participant_t *slot);
 extern volatile aeron_image_list_t *aeron_client_conductor_subscription_image_list(aeron_subscription_t *subscription);
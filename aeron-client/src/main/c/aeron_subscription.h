@@ -21,12 +21,14 @@
 #include "aeron_agent.h"
 #include "aeron_context.h"
 #include "aeron_client_conductor.h"
+#include "aeron_socket.h"
+#include "concurrent/aeron_epoch_reclaimer.h"
+
+#define AERON_SUBSCRIPTION_INLINE_RECEIVE_LIMIT (16)
 
 typedef struct aeron_image_list_stct
 {
-    int64_t change_number;
     uint32_t length;
-    volatile struct aeron_image_list_stct *next_list;
     aeron_image_t **array;
 }
 aeron_image_list_t;
@@ -42,15 +44,16 @@ typedef struct aeron_subscription_stct
     struct subscription_conductor_fields_stct
     {
         uint8_t pre_fields_padding[AERON_CACHE_LINE_LENGTH];
-        aeron_image_list_t image_lists_head;
-        int64_t next_change_number;
+        volatile aeron_image_list_t *image_list;
         uint8_t post_fields_padding[AERON_CACHE_LINE_LENGTH];
     }
     conductor_fields;
 
     int64_t *channel_status_indicator;
+    int64_t *readiness_addr;
 
-    int64_t last_image_list_change_number;
+    aeron_epoch_participant_t epoch_participant;
+    aeron_epoch_shared_participant_t lookup_epoch_participant;
 
     aeron_on_available_image_t on_available_image;
     void *on_available_image_clientd;
@@ -64,6 +67,19 @@ typedef struct aeron_subscription_stct
     int32_t channel_status_indicator_id;
     size_t round_robin_index;
 
+    /*
+     * Set when the channel has inline-receive=true, the polling thread then receives the stream's data frames on its
+     * own socket in the reuseport group of the endpoint and rebuilds them into the images rather than the Receiver.
+     */
+    struct aeron_subscription_inline_receive_stct
+    {
+        int64_t *bytes_received;
+        aeron_socket_t fd;
+        uint8_t *buffer;
+    }
+    inline_receive;
+
+    bool is_readiness_resolved;
     bool is_closed;
     uint8_t post_fields_padding[AERON_CACHE_LINE_LENGTH];
 }
@@ -85,6 +101,8 @@ int aeron_subscription_create(
 int aeron_subscription_delete(aeron_subscription_t *subscription);
 void aeron_subscription_force_close(aeron_subscription_t *subscription);
 
+void aeron_subscription_inline_receive(aeron_subscription_t *subscription, volatile aeron_image_list_t *image_list);
+
 int aeron_subscription_alloc_image_list(volatile aeron_image_list_t **image_list, size_t length);
 
 int aeron_client_conductor_subscription_add_image(aeron_subscription_t *subscription, aeron_image_t *image);
@@ -92,14 +110,12 @@ int aeron_client_conductor_subscription_remove_image(aeron_subscription_t *subsc
 
 inline volatile aeron_image_list_t *aeron_client_conductor_subscription_image_list(aeron_subscription_t *subscription)
 {
-    return subscription->conductor_fields.image_lists_head.next_list;
+    return subscription->conductor_fields.image_list;
 }
 
 int aeron_client_conductor_subscription_install_new_image_list(
     aeron_subscription_t *subscription, volatile aeron_image_list_t *image_list);
 
-int aeron_client_conductor_subscription_prune_image_lists(aeron_subscription_t *subscription);
-
 inline int aeron_subscription_find_image_index(volatile aeron_image_list_t *image_list, aeron_image_t *image)
 {
     size_t length = (NULL == image_list) ? 0 : image_list->length;
@@ -115,22 +131,44 @@ inline int aeron_subscription_find_image_index(volatile aeron_image_list_t *imag
     return -1;
 }
 
-inline int64_t aeron_subscription_last_image_list_change_number(aeron_subscription_t *subscription)
+/*
+ * Enter the current image list for use by the polling thread. The list, and any images removed from it, are not
+ * reclaimed until the subscription exits it. Entering again from a handler nests, so the list stays held until the
+ * outermost exit. Only the polling thread uses this participant, the image lookups use a participant of their own.
+ */
+inline volatile aeron_image_list_t *aeron_subscription_enter_image_list(aeron_subscription_t *subscription)
 {
-    int64_t last_image_list_change_number;
+    volatile aeron_image_list_t *image_list;
 
-    AERON_GET_VOLATILE(last_image_list_change_number, subscription->last_image_list_change_number);
+    aeron_epoch_participant_enter(&subscription->epoch_participant);
+    AERON_GET_VOLATILE(image_list, subscription->conductor_fields.image_list);
 
-    return last_image_list_change_number;
+    return image_list;
 }
 
-inline void aeron_subscription_propose_last_image_change_number(
-    aeron_subscription_t *subscription, int64_t change_number)
+inline void aeron_subscription_exit_image_list(aeron_subscription_t *subscription)
 {
-    if (change_number > subscription->last_image_list_change_number)
-    {
-        AERON_PUT_ORDERED(subscription->last_image_list_change_number, change_number);
-    }
+    aeron_epoch_participant_exit(&subscription->epoch_participant);
+}
+
+/*
+ * Enter the current image list for an image lookup, which may run on any thread at once as polls and other lookups.
+ * The slot returned is passed to aeron_subscription_exit_image_list_lookup.
+ */
+inline volatile aeron_image_list_t *aeron_subscription_enter_image_list_lookup(
+    aeron_subscription_t *subscription, aeron_epoch_participant_t **slot)
+{
+    volatile aeron_image_list_t *image_list;
+
+    *slot = aeron_epoch_shared_participant_enter(&subscription->lookup_epoch_participant);
+    AERON_GET_VOLATILE(image_list, subscription->conductor_fields.image_list);
+
+    return image_list;
+}
+
+inline void aeron_subscription_exit_image_list_lookup(aeron_epoch_participant_t *slot)
+{
+    aeron_epoch_shared_participant_exit(slot);
 }
 
 #endif //AERON_C_SUBSCRIPTION_H
@@ -0,0 +1,168 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <errno.h>
+
+#include "aeron_subscription_group.h"
+#include "aeron_alloc.h"
+#include "util/aeron_arrayutil.h"
+#include "util/aeron_error.h"
+
+int aeron_subscription_group_create(aeron_subscription_group_t **group)
+{
+    aeron_subscription_group_t *_group;
+
+    if (NULL == group)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_subscription_group_create: %s", strerror(EINVAL));
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&_group, sizeof(aeron_subscription_group_t)) < 0)
+    {
+        aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
+        return -1;
+    }
+
+    _group->entries.array = NULL;
+    _group->entries.length = 0;
+    _group->entries.capacity = 0;
+    _group->total_weight = 0;
+    _group->round_robin_index = 0;
+
+    *group = _group;
+    return 0;
+}
+
+int aeron_subscription_group_delete(aeron_subscription_group_t *group)
+{
+    if (NULL != group)
+    {
+        aeron_free(group->entries.array);
+        aeron_free(group);
+    }
+
+    return 0;
+}
+
+int aeron_subscription_group_add(
+    aeron_subscription_group_t *group, aeron_subscription_t *subscription, size_t weight)
+{
+    if (NULL == group || NULL == subscription)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_subscription_group_add: %s", strerror(EINVAL));
+        return -1;
+    }
+
+    for (size_t i = 0; i < group->entries.length; i++)
+    {
+        if (subscription == group->entries.array[i].subscription)
+        {
+            errno = EINVAL;
+            aeron_set_err(EINVAL, "aeron_subscription_group_add: subscription already in group");
+            return -1;
+        }
+    }
+
+    int ensure_capacity_result = 0;
+    AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, group->entries, aeron_subscription_group_entry_t);
+    if (ensure_capacity_result < 0)
+    {
+        aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
+        return -1;
+    }
+
+    aeron_subscription_group_entry_t *entry = &group->entries.array[group->entries.length++];
+    entry->subscription = subscription;
+    entry->weight = weight;
+    group->total_weight += weight;
+
+    return 0;
+}
+
+int aeron_subscription_group_remove(aeron_subscription_group_t *group, aeron_subscription_t *subscription)
+{
+    if (NULL == group || NULL == subscription)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_subscription_group_remove: %s", strerror(EINVAL));
+        return -1;
+    }
+
+    for (size_t i = 0, last_index = group->entries.length - 1; i < group->entries.length; i++)
+    {
+        if (subscription == group->entries.array[i].subscription)
+        {
+            group->total_weight -= group->entries.array[i].weight;
+            aeron_array_fast_unordered_remove(
+                (uint8_t *)group->entries.array, sizeof(aeron_subscription_group_entry_t), i, last_index);
+            group->entries.length--;
+
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int aeron_subscription_group_poll(
+    aeron_subscription_group_t *group, aeron_fragment_handler_t handler, void *clientd, size_t fragment_limit)
+{
+    if (NULL == group || NULL == handler)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_subscription_group_poll(NULL): %s", strerror(EINVAL));
+        return -1;
+    }
+
+    const size_t length = group->entries.length;
+    size_t fragments_read = 0;
+    size_t starting_index = group->round_robin_index++;
+    if (starting_index >= length)
+    {
+        group->round_robin_index = starting_index = 0;
+    }
+
+    for (size_t j = 0; j < length && fragments_read < fragment_limit && group->total_weight > 0; j++)
+    {
+        aeron_subscription_group_entry_t *entry = &group->entries.array[(starting_index + j) % length];
+
+        if (entry->weight > 0 && !aeron_subscription_is_closed(entry->subscription))
+        {
+            size_t share = (fragment_limit * entry->weight) / group->total_weight;
+            share = share < 1 ? 1 : share;
+            share = share < (fragment_limit - fragments_read) ? share : (fragment_limit - fragments_read);
+
+            fragments_read += (size_t)aeron_subscription_poll_ready(entry->subscription, handler, clientd, share);
+        }
+    }
+
+    for (size_t j = 0; j < length && fragments_read < fragment_limit; j++)
+    {
+        aeron_subscription_group_entry_t *entry = &group->entries.array[(starting_index + j) % length];
+
+        if (!aeron_subscription_is_closed(entry->subscription))
+        {
+            fragments_read += (size_t)aeron_subscription_poll_ready(
+                entry->subscription, handler, clientd, fragment_limit - fragments_read);
+        }
+    }
+
+    return (int)fragments_read;
+}
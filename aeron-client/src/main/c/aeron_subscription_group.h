@@ -0,0 +1,46 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef AERON_C_SUBSCRIPTION_GROUP_H
+#define AERON_C_SUBSCRIPTION_GROUP_H
+
+#include "aeronc.h"
+#include "aeron_subscription.h"
+
+typedef struct aeron_subscription_group_entry_stct
+{
+    aeron_subscription_t *subscription;
+    size_t weight;
+}
+aeron_subscription_group_entry_t;
+
+typedef struct aeron_subscription_group_stct
+{
+    struct aeron_subscription_group_entries_stct
+    {
+        aeron_subscription_group_entry_t *array;
+        size_t length;
+        size_t capacity;
+    }
+    entries;
+
+    size_t total_weight;
+    size_t round_robin_index;
+}
+aeron_subscription_group_t;
+
+#endif //AERON_C_SUBSCRIPTION_GROUP_H
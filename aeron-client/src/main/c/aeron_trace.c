@@ -0,0 +1,161 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "aeron_trace.h"
+#include "aeron_image.h"
+#include "aeron_alloc.h"
+#include "util/aeron_error.h"
+
+int aeron_trace_sampler_create(aeron_trace_sampler_t **sampler, uint32_t sample_interval)
+{
+    aeron_trace_sampler_t *_sampler = NULL;
+
+    if (NULL == sampler || 0 == sample_interval)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_trace_sampler_create: %s", strerror(EINVAL));
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&_sampler, sizeof(aeron_trace_sampler_t)) < 0)
+    {
+        aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
+        return -1;
+    }
+
+    _sampler->sample_interval = sample_interval;
+    _sampler->count = 0;
+    *sampler = _sampler;
+
+    return 0;
+}
+
+int aeron_trace_sampler_delete(aeron_trace_sampler_t *sampler)
+{
+    aeron_free(sampler);
+    return 0;
+}
+
+int64_t aeron_trace_reserved_value_supplier(void *clientd, uint8_t *buffer, size_t frame_length)
+{
+    aeron_trace_sampler_t *sampler = (aeron_trace_sampler_t *)clientd;
+
+    if (++sampler->count < sampler->sample_interval)
+    {
+        return 0;
+    }
+
+    sampler->count = 0;
+
+    return AERON_TRACE_RESERVED_VALUE_TAG | (aeron_send_timestamp_nano_clock() & AERON_TRACE_TIMESTAMP_MASK);
+}
+
+int aeron_trace_recorder_create(aeron_trace_recorder_t **recorder, const char *filename, size_t capacity)
+{
+    aeron_trace_recorder_t *_recorder = NULL;
+
+    if (NULL == recorder || NULL == filename || 0 == capacity)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_trace_recorder_create: %s", strerror(EINVAL));
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&_recorder, sizeof(aeron_trace_recorder_t)) < 0)
+    {
+        aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
+        return -1;
+    }
+
+    _recorder->mapped_file.addr = NULL;
+    _recorder->mapped_file.length = AERON_TRACE_RING_LENGTH(capacity);
+    remove(filename);
+
+    if (aeron_map_new_file(&_recorder->mapped_file, filename, true) < 0)
+    {
+        aeron_set_err(aeron_errcode(), "could not map trace file: %s", aeron_errmsg());
+        aeron_free(_recorder);
+        return -1;
+    }
+
+    if (aeron_trace_ring_init(
+        &_recorder->ring, _recorder->mapped_file.addr, _recorder->mapped_file.length, AERON_TRACE_AGENT_CLIENT) < 0)
+    {
+        aeron_unmap(&_recorder->mapped_file);
+        aeron_free(_recorder);
+        return -1;
+    }
+
+    *recorder = _recorder;
+
+    return 0;
+}
+
+int aeron_trace_recorder_delete(aeron_trace_recorder_t *recorder)
+{
+    if (NULL != recorder)
+    {
+        aeron_unmap(&recorder->mapped_file);
+        aeron_free(recorder);
+    }
+
+    return 0;
+}
+
+void aeron_trace_recorder_record_poll(aeron_trace_recorder_t *recorder, aeron_header_t *header)
+{
+    if (aeron_trace_is_marked(header->frame->reserved_value))
+    {
+        aeron_trace_ring_record(
+            &recorder->ring, AERON_TRACE_EVENT_POLL, aeron_send_timestamp_nano_clock(), header->frame);
+    }
+}
+
+int aeron_trace_file_read(const char *filename, aeron_trace_event_func_t event_func, void *clientd)
+{
+    aeron_mapped_file_t mapped_file = { NULL, 0 };
+
+    if (aeron_map_existing_file(&mapped_file, filename) < 0)
+    {
+        aeron_set_err(aeron_errcode(), "could not map trace file: %s", aeron_errmsg());
+        return -1;
+    }
+
+    const uint8_t *buffer = (const uint8_t *)mapped_file.addr;
+    size_t offset = 0;
+
+    while (offset + sizeof(aeron_trace_ring_descriptor_t) <= mapped_file.length)
+    {
+        const aeron_trace_ring_descriptor_t *descriptor = (const aeron_trace_ring_descriptor_t *)(buffer + offset);
+        const size_t ring_length = AERON_TRACE_RING_LENGTH(descriptor->capacity);
+
+        if (descriptor->capacity <= 0 || offset + ring_length > mapped_file.length)
+        {
+            break;
+        }
+
+        aeron_trace_ring_read(buffer + offset, ring_length, 0, event_func, clientd);
+        offset += ring_length;
+    }
+
+    aeron_unmap(&mapped_file);
+
+    return 0;
+}
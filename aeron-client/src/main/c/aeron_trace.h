@@ -0,0 +1,38 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_C_TRACE_H
+#define AERON_C_TRACE_H
+
+#include "aeronc.h"
+#include "concurrent/aeron_trace_ring.h"
+#include "util/aeron_fileutil.h"
+
+typedef struct aeron_trace_sampler_stct
+{
+    uint32_t sample_interval;
+    uint32_t count;
+}
+aeron_trace_sampler_t;
+
+typedef struct aeron_trace_recorder_stct
+{
+    aeron_mapped_file_t mapped_file;
+    aeron_trace_ring_t ring;
+}
+aeron_trace_recorder_t;
+
+#endif //AERON_C_TRACE_H
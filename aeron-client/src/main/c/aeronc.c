@@ -30,21 +30,28 @@
 #include "util/aeron_fileutil.h"
 #include "aeronc.h"
 #include "aeron_context.h"
+#include "aeron_agent.h"
 #include "util/aeron_error.h"
 #include "aeron_cnc_file_descriptor.h"
 #include "concurrent/aeron_mpsc_rb.h"
 
-int aeron_client_connect_to_driver(aeron_mapped_file_t *cnc_mmap, aeron_context_t *context)
+static void aeron_client_connect_idle(aeron_context_t *context)
+{
+    if (context->driver_connect_spin)
+    {
+        aeron_idle_strategy_busy_spinning_idle(NULL, 0);
+    }
+    else
+    {
+        aeron_micro_sleep(1000);
+    }
+}
+
+static int aeron_client_await_driver(
+    aeron_mapped_file_t *cnc_mmap, aeron_context_t *context, const char *filename, aeron_dir_watcher_t *watcher)
 {
     long long start_ms = context->epoch_clock();
     long long deadline_ms = start_ms + (long long)context->driver_timeout_ms;
-    char filename[AERON_MAX_PATH];
-
-#if defined(_MSC_VER)
-    snprintf(filename, sizeof(filename) - 1, "%s\\" AERON_CNC_FILE, context->aeron_dir);
-#else
-    snprintf(filename, sizeof(filename) - 1, "%s/" AERON_CNC_FILE, context->aeron_dir);
-#endif
 
     while (true)
     {
@@ -56,7 +63,12 @@ int aeron_client_connect_to_driver(aeron_mapped_file_t *cnc_mmap, aeron_context_
                 return -1;
             }
 
-            aeron_micro_sleep(16 * 1000);
+            if (watcher->fd < 0)
+            {
+                aeron_dir_watcher_init(watcher, context->aeron_dir);
+            }
+
+            aeron_dir_watcher_await(watcher, 16);
         }
 
         if (aeron_map_existing_file(cnc_mmap, filename) < 0)
@@ -68,7 +80,7 @@ int aeron_client_connect_to_driver(aeron_mapped_file_t *cnc_mmap, aeron_context_
         if (cnc_mmap->length <= (int64_t)AERON_CNC_VERSION_AND_META_DATA_LENGTH)
         {
             aeron_unmap(cnc_mmap);
-            aeron_micro_sleep(1000);
+            aeron_client_connect_idle(context);
             continue;
         }
 
@@ -84,7 +96,7 @@ int aeron_client_connect_to_driver(aeron_mapped_file_t *cnc_mmap, aeron_context_
                 return -1;
             }
 
-            aeron_micro_sleep(1000);
+            aeron_client_connect_idle(context);
         }
 
         if (aeron_semantic_version_major(AERON_CNC_VERSION) != aeron_semantic_version_major(cnc_version))
@@ -103,7 +115,7 @@ int aeron_client_connect_to_driver(aeron_mapped_file_t *cnc_mmap, aeron_context_
         if (!aeron_cnc_is_file_length_sufficient(cnc_mmap))
         {
             aeron_unmap(cnc_mmap);
-            aeron_micro_sleep(1000);
+            aeron_client_connect_idle(context);
             continue;
         }
 
@@ -126,7 +138,7 @@ int aeron_client_connect_to_driver(aeron_mapped_file_t *cnc_mmap, aeron_context_
                 return -1;
             }
 
-            aeron_micro_sleep(1000);
+            aeron_client_connect_idle(context);
         }
 
         long long now_ms = context->epoch_clock();
@@ -141,7 +153,7 @@ int aeron_client_connect_to_driver(aeron_mapped_file_t *cnc_mmap, aeron_context_
 
             aeron_unmap(cnc_mmap);
 
-            aeron_micro_sleep(100 * 1000);
+            aeron_dir_watcher_await(watcher, 100);
             continue;
         }
 
@@ -150,3 +162,38 @@ int aeron_client_connect_to_driver(aeron_mapped_file_t *cnc_mmap, aeron_context_
 
     return 0;
 }
+
+int aeron_client_connect_to_driver(aeron_mapped_file_t *cnc_mmap, aeron_context_t *context)
+{
+    char filename[AERON_MAX_PATH];
+    aeron_dir_watcher_t watcher;
+
+#if defined(_MSC_VER)
+    snprintf(filename, sizeof(filename) - 1, "%s\\" AERON_CNC_FILE, context->aeron_dir);
+#else
+    snprintf(filename, sizeof(filename) - 1, "%s/" AERON_CNC_FILE, context->aeron_dir);
+#endif
+
+    aeron_dir_watcher_init(&watcher, context->aeron_dir);
+    int result = aeron_client_await_driver(cnc_mmap, context, filename, &watcher);
+    aeron_dir_watcher_close(&watcher);
+
+    if (result < 0)
+    {
+        return -1;
+    }
+
+    if (context->lock_mapped_memory && aeron_lock_mapped_file(cnc_mmap) < 0)
+    {
+        aeron_set_err(aeron_errcode(), "CnC file could not be locked: %s", aeron_errmsg());
+        aeron_unmap(cnc_mmap);
+        return -1;
+    }
+
+    if (context->pre_touch_mapped_memory)
+    {
+        aeron_pre_touch_mapped_memory((uint8_t *)cnc_mmap->addr, cnc_mmap->length, AERON_PAGE_MIN_SIZE);
+    }
+
+    return 0;
+}
@@ -58,10 +58,25 @@ typedef struct aeron_header_values_stct
 aeron_header_values_t;
 #pragma pack(pop)
 
+/**
+ * Descriptor for a message fragment filled in by a batch poll. The buffer and frame point into the term buffer and
+ * are only valid until the next poll of the image or subscription the fragment was read from.
+ */
+typedef struct aeron_fragment_stct
+{
+    const uint8_t *buffer;
+    size_t length;
+    const aeron_header_values_frame_t *frame;
+    int64_t position;
+}
+aeron_fragment_t;
+
 typedef struct aeron_subscription_stct aeron_subscription_t;
 typedef struct aeron_image_stct aeron_image_t;
 typedef struct aeron_counter_stct aeron_counter_t;
+typedef struct aeron_counter_lease_stct aeron_counter_lease_t;
 typedef struct aeron_log_buffer_stct aeron_log_buffer_t;
+typedef struct aeron_local_ipc_stct aeron_local_ipc_t;
 
 typedef struct aeron_counters_reader_stct aeron_counters_reader_t;
 
@@ -69,12 +84,20 @@ typedef struct aeron_client_registering_resource_stct aeron_async_add_publicatio
 typedef struct aeron_client_registering_resource_stct aeron_async_add_exclusive_publication_t;
 typedef struct aeron_client_registering_resource_stct aeron_async_add_subscription_t;
 typedef struct aeron_client_registering_resource_stct aeron_async_add_counter_t;
+typedef struct aeron_client_registering_resource_stct aeron_async_add_counter_lease_t;
 typedef struct aeron_client_registering_resource_stct aeron_async_destination_t;
 
 typedef struct aeron_image_fragment_assembler_stct aeron_image_fragment_assembler_t;
+typedef struct aeron_image_vectored_fragment_assembler_stct aeron_image_vectored_fragment_assembler_t;
 typedef struct aeron_image_controlled_fragment_assembler_stct aeron_image_controlled_fragment_assembler_t;
 typedef struct aeron_fragment_assembler_stct aeron_fragment_assembler_t;
 typedef struct aeron_controlled_fragment_assembler_stct aeron_controlled_fragment_assembler_t;
+typedef struct aeron_conflating_poller_stct aeron_conflating_poller_t;
+typedef struct aeron_subscription_group_stct aeron_subscription_group_t;
+typedef struct aeron_sub_stream_demultiplexer_stct aeron_sub_stream_demultiplexer_t;
+typedef struct aeron_latency_histogram_stct aeron_latency_histogram_t;
+typedef struct aeron_trace_sampler_stct aeron_trace_sampler_t;
+typedef struct aeron_trace_recorder_stct aeron_trace_recorder_t;
 
 /**
  * Environment variables and functions used for setting values of an aeron_context_t.
@@ -106,6 +129,80 @@ uint64_t aeron_context_get_resource_linger_duration_ns(aeron_context_t *context)
 int aeron_context_set_pre_touch_mapped_memory(aeron_context_t *context, bool value);
 bool aeron_context_get_pre_touch_mapped_memory(aeron_context_t *context);
 
+/**
+ * Spin rather than sleep while waiting for a newly created CnC file to be initialised and for the driver's first
+ * heartbeat, shaving the wake-up latency from connecting to a driver that is starting. Waits for the CnC file itself
+ * to appear are woken by directory events where the platform supports them.
+ */
+#define AERON_CLIENT_DRIVER_CONNECT_SPIN_ENV_VAR "AERON_CLIENT_DRIVER_CONNECT_SPIN"
+
+int aeron_context_set_driver_connect_spin(aeron_context_t *context, bool value);
+bool aeron_context_get_driver_connect_spin(aeron_context_t *context);
+
+#define AERON_CLIENT_LOCK_MAPPED_MEMORY_ENV_VAR "AERON_CLIENT_LOCK_MAPPED_MEMORY"
+
+/**
+ * Ask the media driver for a private response buffer so that responses and image notifications for this client are
+ * not read from the shared broadcast buffer. Falls back to the broadcast buffer when the driver does not support it.
+ */
+#define AERON_CLIENT_DIRECTED_RESPONSES_ENV_VAR "AERON_CLIENT_DIRECTED_RESPONSES"
+
+int aeron_context_set_use_directed_responses(aeron_context_t *context, bool value);
+bool aeron_context_get_use_directed_responses(aeron_context_t *context);
+
+/**
+ * Path of the Unix domain socket of the media driver to receive log buffers from as file descriptors rather than
+ * opening the paths given by the driver, so the aeron directory need not be shared with the driver, e.g. across
+ * containers. The driver must have the same socket enabled. Not set by default.
+ */
+#define AERON_LOG_BUFFER_SOCKET_ENV_VAR "AERON_LOG_BUFFER_SOCKET"
+
+int aeron_context_set_log_buffer_socket(aeron_context_t *context, const char *value);
+const char *aeron_context_get_log_buffer_socket(aeron_context_t *context);
+
+/**
+ * List of cpus, e.g. "1,3-5", to pin the client conductor thread to. Not used with the conductor agent invoker.
+ */
+#define AERON_CLIENT_CONDUCTOR_CPU_AFFINITY_ENV_VAR "AERON_CLIENT_CONDUCTOR_CPU_AFFINITY"
+
+int aeron_context_set_conductor_cpu_affinity(aeron_context_t *context, const char *value);
+const char *aeron_context_get_conductor_cpu_affinity(aeron_context_t *context);
+
+/**
+ * SCHED_FIFO priority for the client conductor thread, 0 leaves the thread with the default scheduling policy.
+ */
+#define AERON_CLIENT_CONDUCTOR_FIFO_PRIORITY_ENV_VAR "AERON_CLIENT_CONDUCTOR_FIFO_PRIORITY"
+
+int aeron_context_set_conductor_fifo_priority(aeron_context_t *context, int32_t value);
+int32_t aeron_context_get_conductor_fifo_priority(aeron_context_t *context);
+
+/**
+ * Lock the CnC file and log buffers into memory with mlock as they are mapped, so offers and polls do not take page
+ * faults. Mapping fails if the memory cannot be locked, e.g. because RLIMIT_MEMLOCK is too low.
+ */
+int aeron_context_set_lock_mapped_memory(aeron_context_t *context, bool value);
+bool aeron_context_get_lock_mapped_memory(aeron_context_t *context);
+
+/**
+ * Defer mapping the log buffer of an available image until the image is first polled or queried, so images that
+ * are never read from, e.g. of wildcard subscriptions, cost no mapping, virtual memory or page tables. The first poll
+ * of each image pays for the mapping, and images of the same log are mapped separately.
+ */
+#define AERON_CLIENT_LAZY_IMAGE_MAPPING_ENV_VAR "AERON_CLIENT_LAZY_IMAGE_MAPPING"
+
+int aeron_context_set_lazy_image_mapping(aeron_context_t *context, bool value);
+bool aeron_context_get_lazy_image_mapping(aeron_context_t *context);
+
+/**
+ * Use a nano clock derived from the invariant TSC, calibrated at startup and re-synced against the monotonic clock,
+ * instead of calling clock_gettime. Setting it fails if the cpu has no invariant TSC, the environment variable falls
+ * back to the monotonic clock.
+ */
+#define AERON_CLIENT_TSC_NANO_CLOCK_ENV_VAR "AERON_CLIENT_TSC_NANO_CLOCK"
+
+int aeron_context_set_use_tsc_nano_clock(aeron_context_t *context, bool value);
+bool aeron_context_get_use_tsc_nano_clock(aeron_context_t *context);
+
 /**
  * The error handler to be called when an error occurs.
  */
@@ -481,6 +578,27 @@ int aeron_async_add_counter(
  */
 int aeron_async_add_counter_poll(aeron_counter_t **counter, aeron_async_add_counter_t *async);
 
+/**
+ * Asynchronously lease a block of counters from the media driver. Counters are then allocated and freed within the
+ * lease by the client without a round trip to the driver, see aeron_counter_lease_allocate.
+ *
+ * @param async object to use for polling completion.
+ * @param client to lease the counters for.
+ * @param counter_count number of counters in the lease, at most 256.
+ * @return 0 for success or -1 for an error.
+ */
+int aeron_async_add_counter_lease(
+    aeron_async_add_counter_lease_t **async, aeron_t *client, int32_t counter_count);
+
+/**
+ * Poll the completion of the aeron_async_add_counter_lease call.
+ *
+ * @param lease to set if completed successfully.
+ * @param async to check for completion.
+ * @return 0 for not complete (try again), 1 for completed successfully, or -1 for an error.
+ */
+int aeron_async_add_counter_lease_poll(aeron_counter_lease_t **lease, aeron_async_add_counter_lease_t *async);
+
 typedef struct aeron_on_available_counter_pair_stct
 {
     aeron_on_available_counter_t handler;
@@ -801,6 +919,61 @@ int64_t aeron_publication_offerv(
     aeron_reserved_value_supplier_t reserved_value_supplier,
     void *clientd);
 
+/**
+ * Non-blocking publish of a batch of independent messages, one per vector, with a single claim on the term tail
+ * rather than one per message. Each message must fit within the max payload length and the whole batch within a term.
+ * <p>
+ * If the batch runs past the end of the current term the messages that fit are still published and
+ * AERON_PUBLICATION_ADMIN_ACTION is returned, so the remaining messages from appended_count onwards should be
+ * offered again.
+ *
+ * @param publication to publish on.
+ * @param messages array of vectors, one for each message.
+ * @param count of the number of messages.
+ * @param appended_count set to the index of the first message not published, count when the whole batch was.
+ * @param reserved_value_supplier to use for setting the reserved value field of each message or NULL.
+ * @param clientd to pass to the reserved_value_supplier.
+ * @return the new stream position otherwise a negative error value.
+ */
+int64_t aeron_publication_offer_batch(
+    aeron_publication_t *publication,
+    aeron_iovec_t *messages,
+    size_t count,
+    size_t *appended_count,
+    aeron_reserved_value_supplier_t reserved_value_supplier,
+    void *clientd);
+
+/**
+ * Non-blocking publish of a message through a combining front end for publications offered to by many threads at once.
+ * Rather than every thread contending on the term tail, waiting messages are appended together by whichever thread
+ * holds the combining lock with a single claim on the term tail, as in aeron_publication_offer_batch. The log format
+ * is unchanged. Messages longer than the max payload length, or offered when all combining slots are in use, are
+ * offered directly.
+ * <p>
+ * As messages are appended in batches the returned position is that of the end of the batch the message was appended
+ * in, so may be beyond the end of the message itself.
+ *
+ * @param publication to publish on.
+ * @param buffer to publish.
+ * @param length of the buffer.
+ * @return the new stream position otherwise a negative error value.
+ */
+int64_t aeron_publication_offer_combining(aeron_publication_t *publication, const uint8_t *buffer, size_t length);
+
+/**
+ * Offer a block of pre-formatted message fragments, such as one captured with a block poll, with a single claim on
+ * the term tail. The term_offset, term_id, session_id and stream_id of each frame are rewritten for this publication.
+ * <p>
+ * If the block does not fit in the remainder of the current term then AERON_PUBLICATION_ADMIN_ACTION is returned
+ * and the block should be offered again.
+ *
+ * @param publication to publish on.
+ * @param buffer containing the pre-formatted block of message fragments, beginning with a data frame.
+ * @param length in bytes of the encoded block, a multiple of the frame alignment and no more than the term length.
+ * @return the new stream position otherwise a negative error value.
+ */
+int64_t aeron_publication_offer_block(aeron_publication_t *publication, const uint8_t *buffer, size_t length);
+
 /**
  * Try to claim a range in the publication log into which a message can be written with zero copy semantics.
  * Once the message has been written then aeron_buffer_claim_commit should be called thus making it available.
@@ -831,6 +1004,42 @@ int64_t aeron_publication_try_claim(
     size_t length,
     aeron_buffer_claim_t *buffer_claim);
 
+/**
+ * Try to claim a range in the publication log for a message that may be larger than the max payload length. The
+ * range is split into max payload length sized fragments and one buffer claim is populated for each so the message
+ * can be written directly into the term buffer without an intermediate copy.
+ * <p>
+ * Every claim up to claim_count must then be committed with aeron_buffer_claim_commit, or all of them aborted with
+ * aeron_buffer_claim_abort. Committing some fragments and aborting others will deliver an incomplete message.
+ *
+ * @code
+ * aeron_buffer_claim_t buffer_claims[16];
+ * size_t claim_count;
+ *
+ * if (aeron_publication_try_claim_fragmented(publication, length, buffer_claims, 16, &claim_count) > 0L)
+ * {
+ *     for (size_t i = 0; i < claim_count; i++)
+ *     {
+ *         // work with buffer_claims[i].data directly.
+ *         aeron_buffer_claim_commit(&buffer_claims[i]);
+ *     }
+ * }
+ * @endcode
+ *
+ * @param publication to publish to.
+ * @param length of the message, no more than the max message length.
+ * @param buffer_claims to be populated with one claim per fragment if the claim succeeds.
+ * @param buffer_claims_length of the buffer_claims array, at least length divided by max payload length rounded up.
+ * @param claim_count set to the number of buffer_claims populated.
+ * @return the new stream position otherwise a negative error value.
+ */
+int64_t aeron_publication_try_claim_fragmented(
+    aeron_publication_t *publication,
+    size_t length,
+    aeron_buffer_claim_t *buffer_claims,
+    size_t buffer_claims_length,
+    size_t *claim_count);
+
 /**
  * Get the status of the media channel for this publication.
  * <p>
@@ -1154,6 +1363,26 @@ bool aeron_exclusive_publication_is_connected(aeron_exclusive_publication_t *pub
 typedef void (*aeron_fragment_handler_t)(
     void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header);
 
+/**
+ * Callback for handling a whole message as a vector of the fragments it was sent in, pointing into the term buffer.
+ *
+ * @param clientd passed to the assembler.
+ * @param iov vector of the message fragments in order, only valid for the duration of the callback.
+ * @param iovcnt number of fragments in the vector.
+ * @param header representing the meta data for the last fragment.
+ */
+typedef void (*aeron_vectored_fragment_handler_t)(
+    void *clientd, const aeron_iovec_t *iov, size_t iovcnt, aeron_header_t *header);
+
+/**
+ * Function to give the relative share of a weighted poll's fragment limit for an image.
+ *
+ * @param clientd passed to the poll function.
+ * @param session_id of the image.
+ * @return weight of the image, 0 to only poll it with budget left over by the other images.
+ */
+typedef size_t (*aeron_image_poll_weight_func_t)(void *clientd, int32_t session_id);
+
 typedef enum aeron_controlled_fragment_handler_action_en
 {
     /**
@@ -1209,6 +1438,20 @@ typedef aeron_controlled_fragment_handler_action_t (*aeron_controlled_fragment_h
 typedef void (*aeron_block_handler_t)(
     void *clientd, const uint8_t *buffer, size_t length, int32_t session_id, int32_t term_id);
 
+/**
+ * Callback for handling a block of whole messages being read from an image by a controlled block poll.
+ *
+ * @param clientd passed to the controlled block poll function.
+ * @param buffer containing the block of frames which begins and ends on message boundaries.
+ * @param length of the block in bytes, including any frame headers that is aligned.
+ * @param session_id of the stream containing this block of messages.
+ * @param term_id of the stream containing this block of messages.
+ * @return the number of bytes from the start of the block to consume. This is rounded down to the last whole message
+ * so 0 leaves the position unchanged for the block to be delivered again and length consumes the whole block.
+ */
+typedef size_t (*aeron_controlled_block_handler_t)(
+    void *clientd, const uint8_t *buffer, size_t length, int32_t session_id, int32_t term_id);
+
 /**
  * Get all of the field values from the header. This will do a memcpy into the supplied
  * header_values_t pointer.
@@ -1270,6 +1513,9 @@ aeron_subscription_constants_t;
  * as a series of fragments ordered within a session.
  * <p>
  * To assemble messages that span multiple fragments then use aeron_fragment_assembler_t.
+ * <p>
+ * A subscription is polled by one thread at a time. The image lookups, such as aeron_subscription_image_count, may be
+ * called from any thread, including from within a fragment handler or aeron_subscription_for_each_image.
  *
  * @param subscription to poll.
  * @param handler for handling each message fragment as it is read.
@@ -1279,6 +1525,76 @@ aeron_subscription_constants_t;
 int aeron_subscription_poll(
     aeron_subscription_t *subscription, aeron_fragment_handler_t handler, void *clientd, size_t fragment_limit);
 
+/**
+ * Poll only the images under the subscription which the media driver has marked as having data available.
+ * <p>
+ * The subscription must be added with readiness=true on the channel for the driver to track readiness, otherwise
+ * this behaves the same as aeron_subscription_poll. The driver keeps a bitmap of 64 buckets by session id in a
+ * counter so a subscription with thousands of mostly idle images does not need to scan them all on each poll.
+ * Images which share a bucket with a ready image will be polled too.
+ *
+ * @param subscription to poll.
+ * @param handler for handling each message fragment as it is read.
+ * @param clientd to pass to the handler.
+ * @param fragment_limit number of message fragments to limit when polling across multiple images.
+ * @return the number of fragments received or -1 for error.
+ */
+int aeron_subscription_poll_ready(
+    aeron_subscription_t *subscription, aeron_fragment_handler_t handler, void *clientd, size_t fragment_limit);
+
+/**
+ * Poll the images under the subscription for available message fragments, sharing the fragment limit between
+ * images in proportion to their weights rather than letting the first images polled consume all of it.
+ * <p>
+ * Each image with a non-zero weight is polled for up to its share of the fragment limit, with a minimum of one
+ * fragment. Any limit left over is then given round-robin to all images, as with aeron_subscription_poll, so the
+ * poll still consumes as much as it can. The weight function is called twice for each image on every poll so
+ * should be cheap, e.g. a lookup by session id.
+ *
+ * @param subscription to poll.
+ * @param handler for handling each message fragment as it is read.
+ * @param clientd to pass to the handler.
+ * @param weight_func giving the weight of each image by session id.
+ * @param weight_clientd to pass to the weight function.
+ * @param fragment_limit number of message fragments to limit when polling across multiple images.
+ * @return the number of fragments received or -1 for error.
+ */
+int aeron_subscription_weighted_poll(
+    aeron_subscription_t *subscription,
+    aeron_fragment_handler_t handler,
+    void *clientd,
+    aeron_image_poll_weight_func_t weight_func,
+    void *weight_clientd,
+    size_t fragment_limit);
+
+/**
+ * Poll the images under the subscription for available message fragments and fill in a descriptor for each one
+ * rather than calling a handler, so the fragments can be processed by the caller in its own loop.
+ * <p>
+ * The descriptors are only valid until the next poll of this subscription.
+ *
+ * @param subscription to poll.
+ * @param fragments array of descriptors to fill in for each message fragment read.
+ * @param fragment_limit number of message fragments to read, no more than the length of the fragments array.
+ * @return the number of fragments received or -1 for error.
+ */
+int aeron_subscription_batch_poll(
+    aeron_subscription_t *subscription, aeron_fragment_t *fragments, size_t fragment_limit);
+
+/**
+ * Block until one of the images under the subscription has a message fragment available to poll or the timeout
+ * expires, without spinning.
+ * <p>
+ * Publishers and the media driver wake waiting subscribers through a futex on Linux, other platforms fall back to
+ * sleeping in short slices. Wake-up latency for images other than the first, and for messages published with
+ * try_claim, is bounded by a 1ms slice rather than being immediate.
+ *
+ * @param subscription to wait on.
+ * @param timeout_ns to wait for in nanoseconds.
+ * @return 1 if data is available, 0 if the timeout expired, or -1 for error.
+ */
+int aeron_subscription_wait_for_data(aeron_subscription_t *subscription, int64_t timeout_ns);
+
 /**
  * Poll in a controlled manner the images under the subscription for available message fragments.
  * Control is applied to fragments in the stream. If more fragments can be read on another stream
@@ -1313,6 +1629,22 @@ int aeron_subscription_controlled_poll(
 long aeron_subscription_block_poll(
     aeron_subscription_t *subscription, aeron_block_handler_t handler, void *clientd, size_t block_length_limit);
 
+/**
+ * Poll the images under the subscription for blocks of whole messages which the handler can consume in part.
+ *
+ * @param subscription to poll.
+ * @param handler to receive a block of messages from each image.
+ * @param clientd to pass to the handler.
+ * @param block_length_limit for each image polled.
+ * @return the number of bytes consumed or -1 for error.
+ * @see aeron_image_controlled_block_poll
+ */
+long aeron_subscription_controlled_block_poll(
+    aeron_subscription_t *subscription,
+    aeron_controlled_block_handler_t handler,
+    void *clientd,
+    size_t block_length_limit);
+
 /**
  * Is this subscription connected by having at least one open publication image.
  *
@@ -1585,6 +1917,30 @@ int aeron_image_active_transport_count(aeron_image_t *image);
  */
 int aeron_image_poll(aeron_image_t *image, aeron_fragment_handler_t handler, void *clientd, size_t fragment_limit);
 
+/**
+ * Poll for new messages in a stream and fill in a descriptor for each fragment found beyond the last consumed
+ * position, up to a limited number of fragments, rather than calling a handler for each one.
+ * <p>
+ * The descriptors are only valid until the next poll of this image.
+ *
+ * @param image to poll.
+ * @param fragments array of descriptors to fill in for each message fragment read.
+ * @param fragment_limit for the number of fragments to be consumed, no more than the length of the fragments array.
+ * @return the number of fragments that have been consumed or -1 for error.
+ */
+int aeron_image_batch_poll(aeron_image_t *image, aeron_fragment_t *fragments, size_t fragment_limit);
+
+/**
+ * Block until a message fragment is available to poll from the image or the timeout expires, without spinning.
+ * <p>
+ * See aeron_subscription_wait_for_data for how the waiter is woken.
+ *
+ * @param image to wait on.
+ * @param timeout_ns to wait for in nanoseconds.
+ * @return 1 if data is available, 0 if the timeout expired or the image is closed, or -1 for error.
+ */
+int aeron_image_wait_for_data(aeron_image_t *image, int64_t timeout_ns);
+
 /**
  * Poll for new messages in a stream. If new messages are found beyond the last consumed position then they
  * will be delivered to the handler up to a limited number of fragments as specified.
@@ -1681,6 +2037,26 @@ int64_t aeron_image_controlled_peek(
 int aeron_image_block_poll(
     aeron_image_t *image, aeron_block_handler_t handler, void *clientd, size_t block_length_limit);
 
+/**
+ * Poll for a block of whole messages in a stream, up to a limited number of bytes, and advance the position by as
+ * much of the block as the handler consumes.
+ * <p>
+ * A block always begins and ends on a message boundary so a fragmented message is either in it completely or not at
+ * all. The first message is delivered whole even when it is longer than block_length_limit, once all of its fragments
+ * have arrived. Padding frames are delivered singularly in a block as with aeron_image_block_poll.
+ * <p>
+ * The position is advanced by the bytes the handler returns rounded down to the last whole message, so the next poll
+ * starts on a message boundary.
+ *
+ * @param image to poll.
+ * @param handler to which block is delivered.
+ * @param clientd to pass to the handler.
+ * @param block_length_limit up to which a block may be in length.
+ * @return the number of bytes that have been consumed or -1 for error.
+ */
+int aeron_image_controlled_block_poll(
+    aeron_image_t *image, aeron_controlled_block_handler_t handler, void *clientd, size_t block_length_limit);
+
 bool aeron_image_is_closed(aeron_image_t *image);
 
 /**
@@ -1727,6 +2103,40 @@ int aeron_image_fragment_assembler_delete(aeron_image_fragment_assembler_t *asse
 void aeron_image_fragment_assembler_handler(
     void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header);
 
+/**
+ * Create an image fragment assembler for use with a single image that reassembles without copying. Fragments of a
+ * message lie contiguously in a term, so rather than copying them into a buffer the assembler keeps a vector of their
+ * payloads in the term buffer and delivers it once the last fragment arrives.
+ *
+ * @param assembler to be set when created successfully.
+ * @param delegate to call with each whole message.
+ * @param delegate_clientd to pass to delegate handler.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_image_vectored_fragment_assembler_create(
+    aeron_image_vectored_fragment_assembler_t **assembler,
+    aeron_vectored_fragment_handler_t delegate,
+    void *delegate_clientd);
+
+/**
+ * Delete an image vectored fragment assembler.
+ *
+ * @param assembler to delete.
+ * @return 0 for success or -1 for error.
+ */
+int aeron_image_vectored_fragment_assembler_delete(aeron_image_vectored_fragment_assembler_t *assembler);
+
+/**
+ * Handler function to be passed for handling fragment assembly.
+ *
+ * @param clientd passed in the poll call (must be a aeron_image_vectored_fragment_assembler_t)
+ * @param buffer containing the data.
+ * @param length of the data in bytes.
+ * @param header representing the meta data for the data.
+ */
+void aeron_image_vectored_fragment_assembler_handler(
+    void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header);
+
 /**
  * Create an image controlled fragment assembler for use with a single image.
  *
@@ -1779,8 +2189,40 @@ int aeron_fragment_assembler_create(
  * @param assembler to delete.
  * @return 0 for success or -1 for error.
  */
+/**
+ * Create a fragment assembler for use with a subscription that reassembles messages into a fixed pool of
+ * preallocated buffers rather than allocating a buffer for each session. A buffer is borrowed from the pool when a
+ * session begins a fragmented message and returned once the message has been delivered, so no allocation takes place
+ * after creation.
+ * <p>
+ * Messages longer than max_message_length, or that begin while every buffer is in use, are dropped.
+ *
+ * @param assembler to be set when created successfully.
+ * @param delegate to call on completed
+ * @param delegate_clientd to pass to delegate handler.
+ * @param max_message_length of a reassembled message and so the length of each pooled buffer.
+ * @param max_sessions that can be reassembling a message at the same time and so the number of pooled buffers.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_fragment_assembler_create_pooled(
+    aeron_fragment_assembler_t **assembler,
+    aeron_fragment_handler_t delegate,
+    void *delegate_clientd,
+    size_t max_message_length,
+    size_t max_sessions);
+
 int aeron_fragment_assembler_delete(aeron_fragment_assembler_t *assembler);
 
+/**
+ * Free the buffer held for a session, or return it to the pool for a pooled assembler, when an image goes
+ * unavailable part way through a fragmented message.
+ *
+ * @param assembler holding the session buffer.
+ * @param session_id to have its buffer freed.
+ * @return 0 for success or -1 for error.
+ */
+int aeron_fragment_assembler_delete_session_buffer(aeron_fragment_assembler_t *assembler, int32_t session_id);
+
 /**
  * Handler function to be passed for handling fragment assembly.
  *
@@ -1825,6 +2267,426 @@ int aeron_controlled_fragment_assembler_delete(aeron_controlled_fragment_assembl
 aeron_controlled_fragment_handler_action_t aeron_controlled_fragment_assembler_handler(
     void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header);
 
+/**
+ * Function to extract the conflation key from a message, e.g. the instrument id of a price update.
+ *
+ * @param clientd passed when the conflating poller was created.
+ * @param buffer containing the message.
+ * @param length of the message in bytes.
+ * @param key to be set to the key of the message.
+ * @return true if the message has a key and can be conflated, false to always deliver the message.
+ */
+typedef bool (*aeron_conflation_key_func_t)(void *clientd, const uint8_t *buffer, size_t length, int64_t *key);
+
+/**
+ * Create a conflating poller which delivers only the latest message for each key out of everything that is
+ * available on an image, skipping the stale ones. The available messages are peeked up to the end of the current
+ * term or fragment_limit fragments, the latest message for each key is delivered in stream order and the subscriber
+ * position then jumps past the whole scan.
+ * <p>
+ * Only unfragmented messages are conflated, fragments of larger messages and messages without a key are all
+ * delivered.
+ *
+ * @param poller to be set when created successfully.
+ * @param delegate to which the latest messages are delivered.
+ * @param delegate_clientd to pass to the delegate.
+ * @param key_func to extract the key of each message.
+ * @param key_clientd to pass to the key_func.
+ * @param fragment_limit for the number of fragments scanned by a single poll of an image.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_conflating_poller_create(
+    aeron_conflating_poller_t **poller,
+    aeron_fragment_handler_t delegate,
+    void *delegate_clientd,
+    aeron_conflation_key_func_t key_func,
+    void *key_clientd,
+    size_t fragment_limit);
+
+/**
+ * Delete a conflating poller.
+ *
+ * @param poller to delete.
+ * @return 0 for success or -1 for error.
+ */
+int aeron_conflating_poller_delete(aeron_conflating_poller_t *poller);
+
+/**
+ * Poll an image delivering the latest message for each key from what is available.
+ *
+ * @param poller to use.
+ * @param image to poll.
+ * @return the number of fragments delivered or -1 for error.
+ */
+int aeron_conflating_poller_image_poll(aeron_conflating_poller_t *poller, aeron_image_t *image);
+
+/**
+ * Poll each image of a subscription delivering the latest message for each key from what is available.
+ *
+ * @param poller to use.
+ * @param subscription to poll.
+ * @return the number of fragments delivered or -1 for error.
+ */
+int aeron_conflating_poller_poll(aeron_conflating_poller_t *poller, aeron_subscription_t *subscription);
+
+/**
+ * Create a subscription group which polls a set of subscriptions from a single fragment budget, for threads which
+ * service many subscriptions and would otherwise loop over them calling aeron_subscription_poll on each.
+ * <p>
+ * Subscriptions are polled with aeron_subscription_poll_ready so those with a readiness counter and no data
+ * available are skipped without touching their images. The group is not threadsafe and does not take ownership of
+ * the subscriptions, which should be removed before they are closed.
+ *
+ * @param group to be set when created successfully.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_subscription_group_create(aeron_subscription_group_t **group);
+
+/**
+ * Delete a subscription group. The subscriptions in the group are not closed.
+ *
+ * @param group to delete.
+ * @return 0 for success or -1 for error.
+ */
+int aeron_subscription_group_delete(aeron_subscription_group_t *group);
+
+/**
+ * Add a subscription to a group with a weight for its share of the fragment limit on each poll.
+ *
+ * @param group to add the subscription to.
+ * @param subscription to add.
+ * @param weight of the subscription relative to the others in the group, 0 for it to only get what is left over.
+ * @return 0 for success or -1 for error.
+ */
+int aeron_subscription_group_add(
+    aeron_subscription_group_t *group, aeron_subscription_t *subscription, size_t weight);
+
+/**
+ * Remove a subscription from a group.
+ *
+ * @param group to remove the subscription from.
+ * @param subscription to remove.
+ * @return 1 if removed, 0 if the subscription was not in the group or -1 for error.
+ */
+int aeron_subscription_group_remove(aeron_subscription_group_t *group, aeron_subscription_t *subscription);
+
+/**
+ * Poll the subscriptions in a group for available message fragments, sharing the fragment limit between them in
+ * proportion to their weights. Each subscription with a non-zero weight is polled for up to its share of the limit,
+ * with a minimum of one fragment, and any limit left over is then given round-robin to all subscriptions. When all
+ * weights are equal this is a fair poll across the group.
+ *
+ * @param group to poll.
+ * @param handler for handling each message fragment as it is read.
+ * @param clientd to pass to the handler.
+ * @param fragment_limit number of message fragments to limit when polling across all the subscriptions.
+ * @return the number of fragments received or -1 for error.
+ */
+int aeron_subscription_group_poll(
+    aeron_subscription_group_t *group, aeron_fragment_handler_t handler, void *clientd, size_t fragment_limit);
+
+/*
+ * Sub-stream functions
+ *
+ * Many low rate logical streams can share one publication, and so one log buffer and one session, by tagging each
+ * message with a sub-stream id which subscribers use to filter and demultiplex what they poll. The sub-stream id is
+ * carried in the reserved value of each frame so it cannot be combined with another use of the reserved value, such
+ * as send timestamps.
+ */
+
+/**
+ * Non-blocking publish of a message on a sub-stream of a publication.
+ *
+ * @param publication to publish on.
+ * @param sub_stream_id to tag each frame of the message with.
+ * @param buffer to publish.
+ * @param length of the buffer.
+ * @return the new stream position otherwise a negative error value.
+ */
+int64_t aeron_publication_offer_sub_stream(
+    aeron_publication_t *publication, int64_t sub_stream_id, const uint8_t *buffer, size_t length);
+
+/**
+ * Non-blocking publish of a message on a sub-stream of an exclusive publication.
+ *
+ * @param publication to publish on.
+ * @param sub_stream_id to tag each frame of the message with.
+ * @param buffer to publish.
+ * @param length of the buffer.
+ * @return the new stream position otherwise a negative error value.
+ */
+int64_t aeron_exclusive_publication_offer_sub_stream(
+    aeron_exclusive_publication_t *publication, int64_t sub_stream_id, const uint8_t *buffer, size_t length);
+
+/**
+ * Create a demultiplexer which dispatches the fragments polled from a subscription to a handler per sub-stream id.
+ * Fragments for sub-streams without a handler go to the default handler, or are dropped when it is NULL.
+ * <p>
+ * Use aeron_sub_stream_demultiplexer_handler as the handler for aeron_subscription_poll with the demultiplexer as
+ * clientd. Fragments of a message are contiguous in a stream so a fragment assembler can be added as the handler of
+ * a sub-stream. The demultiplexer is not threadsafe.
+ *
+ * @param demultiplexer to be set when created successfully.
+ * @param default_handler for fragments of sub-streams without a handler or NULL to drop them.
+ * @param default_clientd to pass to the default_handler.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_sub_stream_demultiplexer_create(
+    aeron_sub_stream_demultiplexer_t **demultiplexer, aeron_fragment_handler_t default_handler, void *default_clientd);
+
+/**
+ * Delete a demultiplexer.
+ *
+ * @param demultiplexer to delete.
+ * @return 0 for success or -1 for error.
+ */
+int aeron_sub_stream_demultiplexer_delete(aeron_sub_stream_demultiplexer_t *demultiplexer);
+
+/**
+ * Add, or replace, the handler for a sub-stream.
+ *
+ * @param demultiplexer to add the handler to.
+ * @param sub_stream_id of the sub-stream.
+ * @param handler for fragments of the sub-stream.
+ * @param clientd to pass to the handler.
+ * @return 0 for success or -1 for error.
+ */
+int aeron_sub_stream_demultiplexer_add(
+    aeron_sub_stream_demultiplexer_t *demultiplexer,
+    int64_t sub_stream_id,
+    aeron_fragment_handler_t handler,
+    void *clientd);
+
+/**
+ * Remove the handler for a sub-stream so its fragments go to the default handler.
+ *
+ * @param demultiplexer to remove the handler from.
+ * @param sub_stream_id of the sub-stream.
+ * @return 1 if removed, 0 if the sub-stream had no handler or -1 for error.
+ */
+int aeron_sub_stream_demultiplexer_remove(aeron_sub_stream_demultiplexer_t *demultiplexer, int64_t sub_stream_id);
+
+/**
+ * Handler function to be passed for handling sub-stream demultiplexing.
+ *
+ * @param clientd passed in the poll call (must be a aeron_sub_stream_demultiplexer_t)
+ * @param buffer containing the data.
+ * @param length of the data in bytes.
+ * @param header representing the meta data for the data.
+ */
+void aeron_sub_stream_demultiplexer_handler(
+    void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header);
+
+/*
+ * Send timestamps and latency histogram functions
+ */
+
+/**
+ * Select the clock used for send timestamps, calibrating the invariant TSC clock if the cpu has one. Without a TSC,
+ * or if this is never called, the monotonic clock is used. It should be called once at startup by both the
+ * publishing and subscribing processes, before they start sending or receiving.
+ *
+ * @return 1 if the TSC clock is used, 0 if the monotonic clock is used.
+ */
+int aeron_send_timestamp_clock_init(void);
+
+/**
+ * Read the clock used for send timestamps. Its readings are on the monotonic time line so can be compared between
+ * processes on the same host.
+ *
+ * @return time in nanoseconds.
+ */
+int64_t aeron_send_timestamp_nano_clock(void);
+
+/**
+ * Reserved value supplier which stamps each frame with the send timestamp clock, for use with
+ * aeron_publication_offer, aeron_exclusive_publication_offer and their vectored variants. clientd is not used.
+ *
+ * @param clientd not used.
+ * @param buffer of the frame.
+ * @param frame_length of the frame.
+ * @return the send timestamp in nanoseconds.
+ */
+int64_t aeron_send_timestamp_reserved_value_supplier(void *clientd, uint8_t *buffer, size_t frame_length);
+
+/**
+ * Create a histogram of latencies in nanoseconds. Values are recorded in log-linear buckets so the reported values are
+ * within 12.5% of what was recorded. The histogram is not threadsafe.
+ *
+ * @param histogram to be set when created successfully.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_latency_histogram_create(aeron_latency_histogram_t **histogram);
+
+/**
+ * Delete a latency histogram.
+ *
+ * @param histogram to delete.
+ * @return 0 for success or -1 for error.
+ */
+int aeron_latency_histogram_delete(aeron_latency_histogram_t *histogram);
+
+/**
+ * Clear all recorded values from a latency histogram.
+ *
+ * @param histogram to reset.
+ */
+void aeron_latency_histogram_reset(aeron_latency_histogram_t *histogram);
+
+/**
+ * Record a latency. Negative values, from clocks that are slightly apart, are recorded as 0.
+ *
+ * @param histogram to record into.
+ * @param value_ns latency in nanoseconds.
+ */
+void aeron_latency_histogram_record_value(aeron_latency_histogram_t *histogram, int64_t value_ns);
+
+/**
+ * Record the publish to poll latency of a fragment sent with aeron_send_timestamp_reserved_value_supplier. To be
+ * called from the fragment handler.
+ *
+ * @param histogram to record into.
+ * @param header of the fragment.
+ * @return the latency in nanoseconds.
+ */
+int64_t aeron_latency_histogram_record_header(aeron_latency_histogram_t *histogram, aeron_header_t *header);
+
+/**
+ * Number of values recorded in a latency histogram.
+ *
+ * @param histogram to query.
+ * @return the number of values recorded.
+ */
+int64_t aeron_latency_histogram_count(aeron_latency_histogram_t *histogram);
+
+/**
+ * Largest value recorded in a latency histogram.
+ *
+ * @param histogram to query.
+ * @return the largest value recorded in nanoseconds or 0 if empty.
+ */
+int64_t aeron_latency_histogram_max(aeron_latency_histogram_t *histogram);
+
+/**
+ * Value at a percentile of the recorded values, e.g. 99.0 for the 99th percentile.
+ *
+ * @param histogram to query.
+ * @param percentile between 0.0 and 100.0.
+ * @return the upper bound of the bucket holding the percentile, in nanoseconds, or 0 if empty.
+ */
+int64_t aeron_latency_histogram_value_at_percentile(aeron_latency_histogram_t *histogram, double percentile);
+
+/*
+ * Sampled tracing functions
+ */
+
+/**
+ * A frame is marked for tracing by a reserved value with the tag in its top byte and the low 56 bits of its append
+ * timestamp below. The media driver records the marked frames it sends, receives and rebuilds into the trace rings of
+ * its sender and receiver agents in AERON_TRACE_FILE when the trace ring capacity is set.
+ */
+#define AERON_TRACE_RESERVED_VALUE_TAG_MASK ((int64_t)UINT64_C(0xFF00000000000000))
+#define AERON_TRACE_RESERVED_VALUE_TAG ((int64_t)UINT64_C(0x7A00000000000000))
+#define AERON_TRACE_TIMESTAMP_MASK ((int64_t)UINT64_C(0x00FFFFFFFFFFFFFF))
+
+#define AERON_TRACE_FILE "trace.dat"
+
+#define AERON_TRACE_AGENT_SENDER (1)
+#define AERON_TRACE_AGENT_RECEIVER (2)
+#define AERON_TRACE_AGENT_CLIENT (3)
+
+#define AERON_TRACE_EVENT_SEND (1)
+#define AERON_TRACE_EVENT_RECEIVE (2)
+#define AERON_TRACE_EVENT_REBUILD (3)
+#define AERON_TRACE_EVENT_POLL (4)
+
+/**
+ * A trace record of a marked frame. Timestamps are the low 56 bits of the monotonic clock in nanoseconds, so the time
+ * of a hop is the difference of two timestamps masked with AERON_TRACE_TIMESTAMP_MASK.
+ */
+typedef struct aeron_trace_event_stct
+{
+    int32_t agent_type;
+    int32_t event_type;
+    int64_t timestamp_ns;
+    int64_t append_timestamp_ns;
+    int32_t session_id;
+    int32_t stream_id;
+    int32_t term_id;
+    int32_t term_offset;
+    int32_t length;
+}
+aeron_trace_event_t;
+
+typedef void (*aeron_trace_event_func_t)(void *clientd, const aeron_trace_event_t *event);
+
+/**
+ * Create a sampler which marks one in every sample_interval frames for tracing when used as the clientd of
+ * aeron_trace_reserved_value_supplier. A sampler is not threadsafe so should be used by one publishing thread.
+ *
+ * @param sampler to be set when created successfully.
+ * @param sample_interval number of frames per marked frame, 1 marks every frame.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_trace_sampler_create(aeron_trace_sampler_t **sampler, uint32_t sample_interval);
+
+/**
+ * Delete a trace sampler.
+ *
+ * @param sampler to delete.
+ * @return 0 for success or -1 for error.
+ */
+int aeron_trace_sampler_delete(aeron_trace_sampler_t *sampler);
+
+/**
+ * Reserved value supplier which marks sampled frames for tracing with their append timestamp, taken from the send
+ * timestamp clock, and leaves the reserved value of other frames as 0.
+ *
+ * @param clientd the aeron_trace_sampler_t.
+ * @param buffer of the frame.
+ * @param frame_length of the frame.
+ * @return the reserved value for the frame.
+ */
+int64_t aeron_trace_reserved_value_supplier(void *clientd, uint8_t *buffer, size_t frame_length);
+
+/**
+ * Create a recorder of the poll events of marked frames, in a trace ring of its own mapped from a new file so that it
+ * can be read alongside the driver's trace file. A recorder is not threadsafe so should be used by one polling thread.
+ *
+ * @param recorder to be set when created successfully.
+ * @param filename of the trace file to create, replacing any previous file.
+ * @param capacity number of records to keep, rounded down to a power of two.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_trace_recorder_create(aeron_trace_recorder_t **recorder, const char *filename, size_t capacity);
+
+/**
+ * Delete a trace recorder, leaving its file in place to be read.
+ *
+ * @param recorder to delete.
+ * @return 0 for success or -1 for error.
+ */
+int aeron_trace_recorder_delete(aeron_trace_recorder_t *recorder);
+
+/**
+ * Record the poll of a fragment if its frame is marked for tracing. To be called from the fragment handler.
+ *
+ * @param recorder to record into.
+ * @param header of the fragment.
+ */
+void aeron_trace_recorder_record_poll(aeron_trace_recorder_t *recorder, aeron_header_t *header);
+
+/**
+ * Read the records of every trace ring in a trace file, such as the driver's AERON_TRACE_FILE or the file of a
+ * recorder. Rings keep only their most recent records, so older records will have been overwritten.
+ *
+ * @param filename of the trace file.
+ * @param event_func called for each record.
+ * @param clientd passed to event_func.
+ * @return 0 for success or -1 for error.
+ */
+int aeron_trace_file_read(const char *filename, aeron_trace_event_func_t event_func, void *clientd);
+
 /*
 * Counter functions
 */
@@ -1881,6 +2743,77 @@ int aeron_counter_close(
  */
 bool aeron_counter_is_closed(aeron_counter_t *counter);
 
+/*
+ * Counter lease functions
+ */
+
+/**
+ * Allocate a counter from the lease by writing its type, key and label in place. The driver is told after the fact so
+ * available counter handlers are still called, but the caller does not wait for it. Not thread safe, a lease should
+ * be used from one thread at a time.
+ *
+ * @param lease to allocate the counter from.
+ * @param type_id for the counter.
+ * @param key_buffer for the counter.
+ * @param key_buffer_length for the counter.
+ * @param label_buffer for the counter.
+ * @param label_buffer_length for the counter.
+ * @param constants to fill in with the registration id and counter id of the allocated counter.
+ * @return 0 for success or -1 for an error, including when the lease has no free counters.
+ */
+int aeron_counter_lease_allocate(
+    aeron_counter_lease_t *lease,
+    int32_t type_id,
+    const uint8_t *key_buffer,
+    size_t key_buffer_length,
+    const char *label_buffer,
+    size_t label_buffer_length,
+    aeron_counter_constants_t *constants);
+
+/**
+ * Return a counter allocated from the lease so it can be allocated again. The counter id must not be used after.
+ *
+ * @param lease the counter was allocated from.
+ * @param counter_id of the counter.
+ * @return 0 for success or -1 for an error, including when the counter is not allocated from the lease.
+ */
+int aeron_counter_lease_free(aeron_counter_lease_t *lease, int32_t counter_id);
+
+/**
+ * Return a pointer to the value of a counter allocated from the lease.
+ *
+ * @param lease the counter was allocated from.
+ * @param counter_id of the counter.
+ * @return pointer to the counter value.
+ */
+int64_t *aeron_counter_lease_counter_addr(aeron_counter_lease_t *lease, int32_t counter_id);
+
+/**
+ * Number of counters in the lease that are free to allocate.
+ *
+ * @param lease to check.
+ * @return number of free counters.
+ */
+size_t aeron_counter_lease_available(aeron_counter_lease_t *lease);
+
+/**
+ * Asynchronously close the lease, returning all of its counters to the driver including those still allocated.
+ *
+ * @param lease to close.
+ * @return 0 for success or -1 for error.
+ */
+int aeron_counter_lease_close(
+    aeron_counter_lease_t *lease,
+    aeron_notification_t on_close_complete,
+    void *on_close_complete_clientd);
+
+/**
+ * Check if the lease is closed
+ * @param lease to check
+ * @return true if closed, false otherwise.
+ */
+bool aeron_counter_lease_is_closed(aeron_counter_lease_t *lease);
+
 /**
  * Return full version and build string.
  *
@@ -2052,6 +2985,61 @@ int64_t aeron_async_destination_get_registration_id(aeron_async_destination_t *a
 
 int aeron_context_request_driver_termination(const char *directory, const uint8_t *token_buffer, size_t token_length);
 
+/**
+ * Local IPC for single process deployments that only use aeron:ipc. Publications and subscriptions are created
+ * directly on logs in process memory with no media driver, CnC file or client conductor, and are offered to and
+ * polled with the usual functions over the usual log format.
+ * <p>
+ * The publication limit is advanced by aeron_local_ipc_do_work, which should be called from the duty cycle of the
+ * application. Publications and subscriptions are released by aeron_local_ipc_close rather than closed individually.
+ */
+
+/**
+ * Create a local IPC context with the given term length for each stream.
+ *
+ * @param local_ipc to set to the new context.
+ * @param term_length of the logs of each stream, a power of two between the min and max term length.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_local_ipc_init(aeron_local_ipc_t **local_ipc, size_t term_length);
+
+/**
+ * Add the publication for a stream, the same publication being returned for each call with the same stream id.
+ *
+ * @param publication to set to the publication of the stream.
+ * @param local_ipc to add the publication to.
+ * @param stream_id of the stream.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_local_ipc_add_publication(aeron_publication_t **publication, aeron_local_ipc_t *local_ipc, int32_t stream_id);
+
+/**
+ * Add a subscription to a stream, which joins the stream at the current position of its publication.
+ *
+ * @param subscription to set to the new subscription.
+ * @param local_ipc to add the subscription to.
+ * @param stream_id of the stream.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_local_ipc_add_subscription(
+    aeron_subscription_t **subscription, aeron_local_ipc_t *local_ipc, int32_t stream_id);
+
+/**
+ * Advance the publication limit of each stream from the positions of its subscriptions and clean consumed terms.
+ *
+ * @param local_ipc to do work for.
+ * @return the amount of work done.
+ */
+int aeron_local_ipc_do_work(aeron_local_ipc_t *local_ipc);
+
+/**
+ * Release the context along with all its publications, subscriptions and logs.
+ *
+ * @param local_ipc to close.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_local_ipc_close(aeron_local_ipc_t *local_ipc);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,41 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "collections/aeron_int64_to_ptr_swiss_map.h"
+
+extern uint64_t aeron_int64_to_ptr_swiss_map_hash_key(int64_t key);
+extern int8_t aeron_int64_to_ptr_swiss_map_h2(uint64_t hash);
+extern uint32_t aeron_int64_to_ptr_swiss_map_group_match(const int8_t *group, int8_t value);
+extern uint32_t aeron_int64_to_ptr_swiss_map_group_match_empty_or_deleted(const int8_t *group);
+extern void aeron_int64_to_ptr_swiss_map_set_ctrl(aeron_int64_to_ptr_swiss_map_t *map, size_t index, int8_t value);
+extern int aeron_int64_to_ptr_swiss_map_alloc(
+    aeron_int64_to_ptr_swiss_map_t *map, size_t capacity, int8_t **ctrl, aeron_int64_to_ptr_swiss_map_slot_t **slots);
+
+extern int aeron_int64_to_ptr_swiss_map_init(
+    aeron_int64_to_ptr_swiss_map_t *map, size_t initial_capacity, float load_factor);
+extern void aeron_int64_to_ptr_swiss_map_delete(aeron_int64_to_ptr_swiss_map_t *map);
+extern size_t aeron_int64_to_ptr_swiss_map_find_index(
+    aeron_int64_to_ptr_swiss_map_t *map, int64_t key, uint64_t hash);
+extern size_t aeron_int64_to_ptr_swiss_map_find_free_index(aeron_int64_to_ptr_swiss_map_t *map, uint64_t hash);
+extern int aeron_int64_to_ptr_swiss_map_rehash(aeron_int64_to_ptr_swiss_map_t *map, size_t new_capacity);
+extern int aeron_int64_to_ptr_swiss_map_put(aeron_int64_to_ptr_swiss_map_t *map, const int64_t key, void *value);
+extern void *aeron_int64_to_ptr_swiss_map_get(aeron_int64_to_ptr_swiss_map_t *map, const int64_t key);
+extern void aeron_int64_to_ptr_swiss_map_erase_index(aeron_int64_to_ptr_swiss_map_t *map, size_t index);
+extern void *aeron_int64_to_ptr_swiss_map_remove(aeron_int64_to_ptr_swiss_map_t *map, int64_t key);
+extern void aeron_int64_to_ptr_swiss_map_for_each(
+    aeron_int64_to_ptr_swiss_map_t *map, aeron_int64_to_ptr_swiss_map_for_each_func_t func, void *clientd);
+extern void aeron_int64_to_ptr_swiss_map_remove_if(
+    aeron_int64_to_ptr_swiss_map_t *map, aeron_int64_to_ptr_swiss_map_predicate_func_t func, void *clientd);
@@ -0,0 +1,395 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_INT64_TO_PTR_SWISS_MAP_H
+#define AERON_INT64_TO_PTR_SWISS_MAP_H
+
+#include <errno.h>
+#include <string.h>
+
+#include "util/aeron_platform.h"
+#include "collections/aeron_map.h"
+#include "util/aeron_bitutil.h"
+#include "aeron_alloc.h"
+#include "util/aeron_error.h"
+
+#if defined(AERON_CPU_X64)
+#include <emmintrin.h>
+#endif
+
+/*
+ * Open addressing map from int64_t to non-NULL pointers with the same interface as aeron_int64_to_ptr_hash_map_t.
+ *
+ * Each slot has a control byte holding 7 bits of the key's hash when full, or marking it as empty or deleted. A probe
+ * compares a group of 16 control bytes at once, with SSE2 where available, so only slots whose hash bits match are
+ * compared by key, and the key and value of a slot sit together so a hit costs one cache miss. Keys are mixed before
+ * use so sequential ids, such as session, stream and registration ids, spread evenly. The control bytes of the first
+ * group are mirrored after the last so a group can be loaded from any slot without wrapping.
+ *
+ * Entries do not move on removal so, unlike the linear probing maps, removing while iterating is safe.
+ */
+#define AERON_INT64_TO_PTR_SWISS_MAP_GROUP_WIDTH (16)
+#define AERON_INT64_TO_PTR_SWISS_MAP_CTRL_EMPTY ((int8_t)-128)
+#define AERON_INT64_TO_PTR_SWISS_MAP_CTRL_DELETED ((int8_t)-2)
+#define AERON_INT64_TO_PTR_SWISS_MAP_MAX_LOAD_FACTOR (0.875f)
+
+typedef struct aeron_int64_to_ptr_swiss_map_slot_stct
+{
+    int64_t key;
+    void *value;
+}
+aeron_int64_to_ptr_swiss_map_slot_t;
+
+typedef struct aeron_int64_to_ptr_swiss_map_stct
+{
+    int8_t *ctrl;
+    aeron_int64_to_ptr_swiss_map_slot_t *slots;
+    float load_factor;
+    size_t capacity;
+    size_t size;
+    size_t resize_threshold;
+    size_t growth_left;
+}
+aeron_int64_to_ptr_swiss_map_t;
+
+/* Fibonacci hashing with the well mixed upper half folded into the lower bits used for the slot and control byte */
+inline uint64_t aeron_int64_to_ptr_swiss_map_hash_key(int64_t key)
+{
+    const uint64_t hash = (uint64_t)key * UINT64_C(0x9e3779b97f4a7c15);
+
+    return hash ^ (hash >> 32u);
+}
+
+inline int8_t aeron_int64_to_ptr_swiss_map_h2(uint64_t hash)
+{
+    return (int8_t)(hash & 0x7Fu);
+}
+
+/* bit i of the result is set when control byte i of the group equals value */
+inline uint32_t aeron_int64_to_ptr_swiss_map_group_match(const int8_t *group, int8_t value)
+{
+#if defined(AERON_CPU_X64)
+    const __m128i ctrl = _mm_loadu_si128((const __m128i *)group);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(value)));
+#else
+    uint32_t mask = 0;
+    for (int i = 0; i < AERON_INT64_TO_PTR_SWISS_MAP_GROUP_WIDTH; i++)
+    {
+        mask |= (uint32_t)(group[i] == value) << i;
+    }
+
+    return mask;
+#endif
+}
+
+/* bit i of the result is set when slot i of the group is empty or deleted, i.e. its control byte is negative */
+inline uint32_t aeron_int64_to_ptr_swiss_map_group_match_empty_or_deleted(const int8_t *group)
+{
+#if defined(AERON_CPU_X64)
+    return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)group));
+#else
+    uint32_t mask = 0;
+    for (int i = 0; i < AERON_INT64_TO_PTR_SWISS_MAP_GROUP_WIDTH; i++)
+    {
+        mask |= (uint32_t)(group[i] < 0) << i;
+    }
+
+    return mask;
+#endif
+}
+
+inline void aeron_int64_to_ptr_swiss_map_set_ctrl(aeron_int64_to_ptr_swiss_map_t *map, size_t index, int8_t value)
+{
+    map->ctrl[index] = value;
+    if (index < AERON_INT64_TO_PTR_SWISS_MAP_GROUP_WIDTH)
+    {
+        map->ctrl[map->capacity + index] = value;
+    }
+}
+
+inline int aeron_int64_to_ptr_swiss_map_alloc(
+    aeron_int64_to_ptr_swiss_map_t *map, size_t capacity, int8_t **ctrl, aeron_int64_to_ptr_swiss_map_slot_t **slots)
+{
+    if (aeron_alloc((void **)ctrl, capacity + AERON_INT64_TO_PTR_SWISS_MAP_GROUP_WIDTH) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_alloc((void **)slots, capacity * sizeof(aeron_int64_to_ptr_swiss_map_slot_t)) < 0)
+    {
+        aeron_free(*ctrl);
+        return -1;
+    }
+
+    memset(*ctrl, AERON_INT64_TO_PTR_SWISS_MAP_CTRL_EMPTY, capacity + AERON_INT64_TO_PTR_SWISS_MAP_GROUP_WIDTH);
+
+    return 0;
+}
+
+inline int aeron_int64_to_ptr_swiss_map_init(
+    aeron_int64_to_ptr_swiss_map_t *map, size_t initial_capacity, float load_factor)
+{
+    size_t capacity = (size_t)aeron_find_next_power_of_two((int32_t)initial_capacity);
+    if (capacity < AERON_INT64_TO_PTR_SWISS_MAP_GROUP_WIDTH)
+    {
+        capacity = AERON_INT64_TO_PTR_SWISS_MAP_GROUP_WIDTH;
+    }
+
+    map->load_factor = load_factor < AERON_INT64_TO_PTR_SWISS_MAP_MAX_LOAD_FACTOR ?
+        load_factor : AERON_INT64_TO_PTR_SWISS_MAP_MAX_LOAD_FACTOR;
+    map->resize_threshold = (size_t)(map->load_factor * capacity);
+    map->growth_left = map->resize_threshold;
+    map->ctrl = NULL;
+    map->slots = NULL;
+    map->capacity = capacity;
+    map->size = 0;
+
+    return aeron_int64_to_ptr_swiss_map_alloc(map, capacity, &map->ctrl, &map->slots);
+}
+
+inline void aeron_int64_to_ptr_swiss_map_delete(aeron_int64_to_ptr_swiss_map_t *map)
+{
+    if (NULL != map->ctrl)
+    {
+        aeron_free(map->ctrl);
+    }
+
+    if (NULL != map->slots)
+    {
+        aeron_free(map->slots);
+    }
+}
+
+/*
+ * Probing visits groups starting at triangular multiples of the group width from the home slot, which covers every
+ * slot of a power of two capacity, until a group with an empty slot shows the key cannot be further along.
+ */
+inline size_t aeron_int64_to_ptr_swiss_map_find_index(aeron_int64_to_ptr_swiss_map_t *map, int64_t key, uint64_t hash)
+{
+    const int8_t h2 = aeron_int64_to_ptr_swiss_map_h2(hash);
+    const size_t mask = map->capacity - 1;
+    size_t position = (size_t)(hash >> 7u) & mask;
+    size_t stride = 0;
+
+    while (true)
+    {
+        const int8_t *group = map->ctrl + position;
+        uint32_t matches = aeron_int64_to_ptr_swiss_map_group_match(group, h2);
+
+        while (0 != matches)
+        {
+            const size_t index = (position + (size_t)aeron_number_of_trailing_zeroes((int32_t)matches)) & mask;
+            if (key == map->slots[index].key)
+            {
+                return index;
+            }
+
+            matches &= matches - 1;
+        }
+
+        if (0 != aeron_int64_to_ptr_swiss_map_group_match(group, AERON_INT64_TO_PTR_SWISS_MAP_CTRL_EMPTY) ||
+            stride >= map->capacity)
+        {
+            return SIZE_MAX;
+        }
+
+        stride += AERON_INT64_TO_PTR_SWISS_MAP_GROUP_WIDTH;
+        position = (position + stride) & mask;
+    }
+}
+
+inline size_t aeron_int64_to_ptr_swiss_map_find_free_index(aeron_int64_to_ptr_swiss_map_t *map, uint64_t hash)
+{
+    const size_t mask = map->capacity - 1;
+    size_t position = (size_t)(hash >> 7u) & mask;
+    size_t stride = 0;
+
+    while (true)
+    {
+        const uint32_t free_slots = aeron_int64_to_ptr_swiss_map_group_match_empty_or_deleted(map->ctrl + position);
+        if (0 != free_slots)
+        {
+            return (position + (size_t)aeron_number_of_trailing_zeroes((int32_t)free_slots)) & mask;
+        }
+
+        stride += AERON_INT64_TO_PTR_SWISS_MAP_GROUP_WIDTH;
+        position = (position + stride) & mask;
+    }
+}
+
+inline int aeron_int64_to_ptr_swiss_map_rehash(aeron_int64_to_ptr_swiss_map_t *map, size_t new_capacity)
+{
+    int8_t *old_ctrl = map->ctrl;
+    aeron_int64_to_ptr_swiss_map_slot_t *old_slots = map->slots;
+    const size_t old_capacity = map->capacity;
+    int8_t *new_ctrl;
+    aeron_int64_to_ptr_swiss_map_slot_t *new_slots;
+
+    if (aeron_int64_to_ptr_swiss_map_alloc(map, new_capacity, &new_ctrl, &new_slots) < 0)
+    {
+        return -1;
+    }
+
+    map->ctrl = new_ctrl;
+    map->slots = new_slots;
+    map->capacity = new_capacity;
+    map->resize_threshold = (size_t)(new_capacity * map->load_factor);
+
+    for (size_t i = 0; i < old_capacity; i++)
+    {
+        if (old_ctrl[i] >= 0)
+        {
+            const uint64_t hash = aeron_int64_to_ptr_swiss_map_hash_key(old_slots[i].key);
+            const size_t index = aeron_int64_to_ptr_swiss_map_find_free_index(map, hash);
+
+            aeron_int64_to_ptr_swiss_map_set_ctrl(map, index, aeron_int64_to_ptr_swiss_map_h2(hash));
+            map->slots[index] = old_slots[i];
+        }
+    }
+
+    map->growth_left = map->resize_threshold - map->size;
+
+    aeron_free(old_ctrl);
+    aeron_free(old_slots);
+
+    return 0;
+}
+
+inline int aeron_int64_to_ptr_swiss_map_put(aeron_int64_to_ptr_swiss_map_t *map, const int64_t key, void *value)
+{
+    if (NULL == value)
+    {
+        aeron_set_errno(EINVAL);
+        return -1;
+    }
+
+    const uint64_t hash = aeron_int64_to_ptr_swiss_map_hash_key(key);
+    size_t index = aeron_int64_to_ptr_swiss_map_find_index(map, key, hash);
+    if (SIZE_MAX != index)
+    {
+        map->slots[index].value = value;
+        return 0;
+    }
+
+    if (0 == map->growth_left)
+    {
+        /* reclaim deleted slots in place when they, rather than live entries, have used up the growth */
+        const size_t new_capacity = map->size < (map->resize_threshold / 2) ? map->capacity : map->capacity << 1;
+
+        if (aeron_int64_to_ptr_swiss_map_rehash(map, new_capacity) < 0)
+        {
+            return -1;
+        }
+    }
+
+    index = aeron_int64_to_ptr_swiss_map_find_free_index(map, hash);
+
+    if (AERON_INT64_TO_PTR_SWISS_MAP_CTRL_EMPTY == map->ctrl[index])
+    {
+        --map->growth_left;
+    }
+
+    aeron_int64_to_ptr_swiss_map_set_ctrl(map, index, aeron_int64_to_ptr_swiss_map_h2(hash));
+    map->slots[index].key = key;
+    map->slots[index].value = value;
+    ++map->size;
+
+    return 0;
+}
+
+inline void *aeron_int64_to_ptr_swiss_map_get(aeron_int64_to_ptr_swiss_map_t *map, const int64_t key)
+{
+    const size_t index = aeron_int64_to_ptr_swiss_map_find_index(
+        map, key, aeron_int64_to_ptr_swiss_map_hash_key(key));
+
+    return SIZE_MAX != index ? map->slots[index].value : NULL;
+}
+
+/*
+ * A slot can go back to empty, rather than being marked deleted, when no probe can have passed over it while full.
+ * That holds when the empty slots either side of it are less than a group apart, as every group covering it then also
+ * contains an empty slot which would have ended the probe.
+ */
+inline void aeron_int64_to_ptr_swiss_map_erase_index(aeron_int64_to_ptr_swiss_map_t *map, size_t index)
+{
+    const size_t mask = map->capacity - 1;
+    const size_t index_before = (index - AERON_INT64_TO_PTR_SWISS_MAP_GROUP_WIDTH) & mask;
+    const uint32_t empty_after = aeron_int64_to_ptr_swiss_map_group_match(
+        map->ctrl + index, AERON_INT64_TO_PTR_SWISS_MAP_CTRL_EMPTY);
+    const uint32_t empty_before = aeron_int64_to_ptr_swiss_map_group_match(
+        map->ctrl + index_before, AERON_INT64_TO_PTR_SWISS_MAP_CTRL_EMPTY);
+    const bool was_never_full = 0 != empty_after && 0 != empty_before &&
+        (aeron_number_of_trailing_zeroes((int32_t)empty_after) +
+        (aeron_number_of_leading_zeroes((int32_t)empty_before) - (32 - AERON_INT64_TO_PTR_SWISS_MAP_GROUP_WIDTH))) <
+        AERON_INT64_TO_PTR_SWISS_MAP_GROUP_WIDTH;
+
+    if (was_never_full)
+    {
+        aeron_int64_to_ptr_swiss_map_set_ctrl(map, index, AERON_INT64_TO_PTR_SWISS_MAP_CTRL_EMPTY);
+        ++map->growth_left;
+    }
+    else
+    {
+        aeron_int64_to_ptr_swiss_map_set_ctrl(map, index, AERON_INT64_TO_PTR_SWISS_MAP_CTRL_DELETED);
+    }
+
+    map->slots[index].value = NULL;
+    --map->size;
+}
+
+inline void *aeron_int64_to_ptr_swiss_map_remove(aeron_int64_to_ptr_swiss_map_t *map, int64_t key)
+{
+    const size_t index = aeron_int64_to_ptr_swiss_map_find_index(
+        map, key, aeron_int64_to_ptr_swiss_map_hash_key(key));
+    if (SIZE_MAX == index)
+    {
+        return NULL;
+    }
+
+    void *value = map->slots[index].value;
+    aeron_int64_to_ptr_swiss_map_erase_index(map, index);
+
+    return value;
+}
+
+typedef void (*aeron_int64_to_ptr_swiss_map_for_each_func_t)(void *clientd, int64_t key, void *value);
+typedef bool (*aeron_int64_to_ptr_swiss_map_predicate_func_t)(void *clientd, int64_t key, void *value);
+
+inline void aeron_int64_to_ptr_swiss_map_for_each(
+    aeron_int64_to_ptr_swiss_map_t *map, aeron_int64_to_ptr_swiss_map_for_each_func_t func, void *clientd)
+{
+    for (size_t i = 0; i < map->capacity; i++)
+    {
+        if (map->ctrl[i] >= 0)
+        {
+            func(clientd, map->slots[i].key, map->slots[i].value);
+        }
+    }
+}
+
+inline void aeron_int64_to_ptr_swiss_map_remove_if(
+    aeron_int64_to_ptr_swiss_map_t *map, aeron_int64_to_ptr_swiss_map_predicate_func_t func, void *clientd)
+{
+    for (size_t i = 0; i < map->capacity; i++)
+    {
+        if (map->ctrl[i] >= 0 && func(clientd, map->slots[i].key, map->slots[i].value))
+        {
+            aeron_int64_to_ptr_swiss_map_erase_index(map, i);
+        }
+    }
+}
+
+#endif
@@ -34,6 +34,9 @@
 #define AERON_COMMAND_ADD_RCV_DESTINATION (0x0C)
 #define AERON_COMMAND_REMOVE_RCV_DESTINATION (0x0D)
 #define AERON_COMMAND_TERMINATE_DRIVER (0x0E)
+#define AERON_COMMAND_ADD_DIRECTED_RESPONSES (0x0F)
+#define AERON_COMMAND_ADD_COUNTER_LEASE (0x10)
+#define AERON_COMMAND_COUNTER_LEASE_UPDATE (0x11)
 
 #define AERON_RESPONSE_ON_ERROR (0x0F01)
 #define AERON_RESPONSE_ON_AVAILABLE_IMAGE (0x0F02)
@@ -45,6 +48,7 @@
 #define AERON_RESPONSE_ON_COUNTER_READY (0x0F08)
 #define AERON_RESPONSE_ON_UNAVAILABLE_COUNTER (0x0F09)
 #define AERON_RESPONSE_ON_CLIENT_TIMEOUT (0x0F0A)
+#define AERON_RESPONSE_ON_COUNTER_LEASE_READY (0x0F0B)
 
 /* error codes */
 #define AERON_ERROR_CODE_UNKNOWN_CODE_VALUE (-1)
@@ -167,6 +171,31 @@ typedef struct aeron_counter_update_stct
 }
 aeron_counter_update_t;
 
+typedef struct aeron_counter_lease_command_stct
+{
+    aeron_correlated_command_t correlated;
+    int32_t counter_count;
+}
+aeron_counter_lease_command_t;
+
+/* followed by counter_count int32_t counter ids */
+typedef struct aeron_counter_lease_ready_stct
+{
+    int64_t correlation_id;
+    int32_t counter_count;
+}
+aeron_counter_lease_ready_t;
+
+/* correlation id of the correlated command is the registration id of the lease */
+typedef struct aeron_counter_lease_update_stct
+{
+    aeron_correlated_command_t correlated;
+    int64_t registration_id;
+    int32_t counter_id;
+    int32_t is_allocated;
+}
+aeron_counter_lease_update_t;
+
 typedef struct aeron_client_timeout_stct
 {
     int64_t client_id;
@@ -21,6 +21,8 @@
 
 #if defined(AERON_COMPILER_GCC) && defined(AERON_CPU_X64)
     #include "concurrent/aeron_atomic64_gcc_x86_64.h"
+#elif defined(AERON_COMPILER_GCC) && defined(AERON_CPU_ARM64)
+    #include "concurrent/aeron_atomic64_gcc_aarch64.h"
 #elif defined(AERON_COMPILER_MSVC) && defined(AERON_CPU_X64)
     #include "concurrent/aeron_atomic64_msvc.h"
 #else
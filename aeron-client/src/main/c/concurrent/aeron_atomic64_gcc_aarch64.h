@@ -0,0 +1,102 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef AERON_ATOMIC64_GCC_AARCH64_H
+#define AERON_ATOMIC64_GCC_AARCH64_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * AArch64 is weakly ordered so, unlike x86, volatile gets and ordered puts need real instructions. The GCC atomic
+ * builtins map them directly onto LDAR/STLR rather than a full DMB. When built with LSE (-march=armv8.1-a or later,
+ * see AERON_ENABLE_ARM64_LSE) get and add and compare and swap become single LDADDAL/CASAL instructions, otherwise
+ * GCC 10+ outlines them behind a runtime check for LSE and falls back to LDAXR/STLXR loops on older cores.
+ */
+
+#define AERON_GET_VOLATILE(dst, src) \
+do \
+{ \
+    dst = __atomic_load_n(&(src), __ATOMIC_ACQUIRE); \
+} \
+while (false)
+
+#define AERON_PUT_ORDERED(dst, src) \
+do \
+{ \
+    __atomic_store_n(&(dst), src, __ATOMIC_RELEASE); \
+} \
+while (false)
+
+#define AERON_PUT_VOLATILE(dst, src) \
+do \
+{ \
+    __atomic_store_n(&(dst), src, __ATOMIC_SEQ_CST); \
+} \
+while (false)
+
+#define AERON_GET_AND_ADD_INT64(original, dst, value) \
+do \
+{ \
+    original = __atomic_fetch_add(&(dst), value, __ATOMIC_SEQ_CST); \
+} \
+while (false)
+
+#define AERON_GET_AND_ADD_INT32(original, dst, value) \
+do \
+{ \
+    original = __atomic_fetch_add(&(dst), value, __ATOMIC_SEQ_CST); \
+} \
+while (false)
+
+inline bool aeron_cmpxchg64(volatile int64_t *destination, int64_t expected, int64_t desired)
+{
+    return __atomic_compare_exchange_n(destination, &expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+inline bool aeron_cmpxchgu64(volatile uint64_t *destination, uint64_t expected, uint64_t desired)
+{
+    return __atomic_compare_exchange_n(destination, &expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+inline bool aeron_cmpxchg32(volatile int32_t *destination, int32_t expected, int32_t desired)
+{
+    return __atomic_compare_exchange_n(destination, &expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+/* DMB ISHLD */
+inline void aeron_acquire()
+{
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+}
+
+/* DMB ISH, there is no store-release fence weaker than a full barrier that also orders prior loads */
+inline void aeron_release()
+{
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+
+/*-------------------------------------
+ *  Alignment
+ *-------------------------------------
+ * Note: May not work on local variables.
+ * http://gcc.gnu.org/bugzilla/show_bug.cgi?id=24691
+ */
+#define AERON_DECL_ALIGNED(declaration, amt) declaration __attribute__((aligned(amt)))
+
+#endif //AERON_ATOMIC64_GCC_AARCH64_H
@@ -16,6 +16,7 @@
 
 #include <string.h>
 #include <errno.h>
+#include <inttypes.h>
 #include "concurrent/aeron_broadcast_receiver.h"
 #include "util/aeron_error.h"
 
@@ -96,3 +97,77 @@ int aeron_broadcast_receiver_receive(
 
     return messages_received;
 }
+
+int aeron_broadcast_receiver_receive_batch(
+    volatile aeron_broadcast_receiver_t *receiver, aeron_broadcast_receiver_handler_t handler, void *clientd)
+{
+    int messages_received = 0;
+    int64_t tail;
+    int64_t cursor = receiver->next_record;
+
+    AERON_GET_VOLATILE(tail, receiver->descriptor->tail_counter);
+
+    while (cursor < tail)
+    {
+        if (!aeron_broadcast_receiver_validate_at(receiver, cursor))
+        {
+            receiver->lapped_count++;
+            receiver->next_record = receiver->descriptor->latest_counter;
+            aeron_set_err(EINVAL, "unable to keep up with broadcast");
+            return -1;
+        }
+
+        const size_t record_offset = (uint32_t)cursor & (receiver->capacity - 1);
+        aeron_broadcast_record_descriptor_t *record =
+            (aeron_broadcast_record_descriptor_t *)(receiver->buffer + record_offset);
+        int32_t record_length;
+        int32_t type_id;
+
+        AERON_GET_VOLATILE(record_length, record->length);
+        AERON_GET_VOLATILE(type_id, record->msg_type_id);
+
+        if (record_length < (int32_t)AERON_BROADCAST_RECORD_HEADER_LENGTH ||
+            (size_t)record_length > receiver->capacity - record_offset)
+        {
+            receiver->next_record = receiver->descriptor->latest_counter;
+            aeron_set_err(EINVAL, "invalid broadcast record length: %" PRId32, record_length);
+            return -1;
+        }
+
+        const size_t length = (size_t)record_length - AERON_BROADCAST_RECORD_HEADER_LENGTH;
+
+        receiver->cursor = cursor;
+        receiver->record_offset = record_offset;
+        receiver->next_record = cursor + AERON_ALIGN(record_length, AERON_BROADCAST_RECORD_ALIGNMENT);
+        cursor = receiver->next_record;
+
+        if (AERON_BROADCAST_PADDING_MSG_TYPE_ID == type_id)
+        {
+            continue;
+        }
+
+        if (length > sizeof(receiver->scratch_buffer))
+        {
+            aeron_set_err(EINVAL, "scratch buffer too small");
+            return -1;
+        }
+
+        memcpy(
+            (void *)receiver->scratch_buffer,
+            receiver->buffer + record_offset + AERON_BROADCAST_RECORD_HEADER_LENGTH,
+            length);
+
+        if (!aeron_broadcast_receiver_validate(receiver))
+        {
+            receiver->lapped_count++;
+            receiver->next_record = receiver->descriptor->latest_counter;
+            aeron_set_err(EINVAL, "unable to keep up with broadcast");
+            return -1;
+        }
+
+        handler(type_id, (uint8_t *)receiver->scratch_buffer, length, clientd);
+        messages_received++;
+    }
+
+    return messages_received;
+}
@@ -102,4 +102,12 @@ inline bool aeron_broadcast_receiver_receive_next(volatile aeron_broadcast_recei
 int aeron_broadcast_receiver_receive(
     volatile aeron_broadcast_receiver_t *receiver, aeron_broadcast_receiver_handler_t handler, void *clientd);
 
+/*
+ * Dispatch all records available up to the tail read on entry. Each record is copied to the scratch buffer and
+ * validated before its handler is called, returning -1 if the transmitter laps the receiver or a record length is
+ * out of range.
+ */
+int aeron_broadcast_receiver_receive_batch(
+    volatile aeron_broadcast_receiver_t *receiver, aeron_broadcast_receiver_handler_t handler, void *clientd);
+
 #endif //AERON_BROADCAST_RECEIVER_H
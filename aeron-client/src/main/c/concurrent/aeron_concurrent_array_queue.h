@@ -27,4 +27,7 @@ aeron_queue_offer_result_t;
 
 typedef void (*aeron_queue_drain_func_t)(void *clientd, volatile void *item);
 
+/* longest a producer blocks waiting for space before checking the queue again */
+#define AERON_QUEUE_SPACE_WAIT_SLICE_NS (1000 * 1000LL)
+
 #endif //AERON_CONCURRENT_ARRAY_QUEUE_H
@@ -22,6 +22,118 @@
 #include "concurrent/aeron_counters_manager.h"
 #include "util/aeron_error.h"
 
+static int aeron_counters_free_list_init(aeron_counters_free_list_t *free_list)
+{
+    free_list->head = 0;
+    free_list->size = 0;
+    free_list->capacity = 2;
+
+    return aeron_alloc((void **)&free_list->ids, sizeof(int32_t) * free_list->capacity);
+}
+
+static int aeron_counters_free_list_add(aeron_counters_free_list_t *free_list, int32_t counter_id)
+{
+    if (free_list->size >= free_list->capacity)
+    {
+        size_t new_capacity = free_list->capacity + (free_list->capacity >> 1u);
+        int32_t *new_ids;
+
+        if (aeron_alloc((void **)&new_ids, sizeof(int32_t) * new_capacity) < 0)
+        {
+            return -1;
+        }
+
+        for (size_t i = 0; i < free_list->size; i++)
+        {
+            new_ids[i] = free_list->ids[(free_list->head + i) % free_list->capacity];
+        }
+
+        aeron_free(free_list->ids);
+        free_list->ids = new_ids;
+        free_list->head = 0;
+        free_list->capacity = new_capacity;
+    }
+
+    const size_t tail = (free_list->head + free_list->size) % free_list->capacity;
+    free_list->ids[tail] = counter_id;
+    free_list->size++;
+
+    return 0;
+}
+
+static void aeron_counters_free_list_remove_head(aeron_counters_free_list_t *free_list)
+{
+    free_list->head = (free_list->head + 1) % free_list->capacity;
+    free_list->size--;
+}
+
+int aeron_counters_compact_region_format(uint8_t *buffer, size_t length, size_t values_length, int32_t capacity)
+{
+    if (NULL == buffer || capacity <= 0)
+    {
+        return 0;
+    }
+
+    const size_t records_length = AERON_COUNTERS_COMPACT_HEADER_LENGTH +
+        AERON_COUNTERS_COMPACT_VALUES_LENGTH((size_t)capacity) +
+        ((size_t)capacity * AERON_COUNTERS_COMPACT_METADATA_LENGTH);
+
+    if (length <= records_length || length - records_length > INT32_MAX)
+    {
+        aeron_set_err(EINVAL, "%s:%d: %s", __FILE__, __LINE__, strerror(EINVAL));
+        return -1;
+    }
+
+    aeron_counters_compact_header_t *header = (aeron_counters_compact_header_t *)buffer;
+    header->first_counter_id = (int32_t)(values_length / AERON_COUNTERS_MANAGER_VALUE_LENGTH);
+    header->capacity = capacity;
+    header->labels_length = (int32_t)(length - records_length);
+
+    return 0;
+}
+
+int aeron_counters_compact_region_wrap(aeron_counters_compact_region_t *region, uint8_t *buffer, size_t length)
+{
+    region->values = NULL;
+    region->metadata = NULL;
+    region->labels = NULL;
+    region->first_counter_id = INT32_MAX;
+    region->capacity = 0;
+    region->labels_length = 0;
+
+    if (NULL == buffer || length < AERON_COUNTERS_COMPACT_HEADER_LENGTH)
+    {
+        return 0;
+    }
+
+    aeron_counters_compact_header_t *header = (aeron_counters_compact_header_t *)buffer;
+    if (header->capacity <= 0)
+    {
+        return 0;
+    }
+
+    const size_t values_length = AERON_COUNTERS_COMPACT_VALUES_LENGTH((size_t)header->capacity);
+    const size_t metadata_length = (size_t)header->capacity * AERON_COUNTERS_COMPACT_METADATA_LENGTH;
+
+    if (header->first_counter_id < 0 ||
+        header->labels_length < 0 ||
+        header->capacity > INT32_MAX - header->first_counter_id ||
+        AERON_COUNTERS_COMPACT_HEADER_LENGTH + values_length + metadata_length + (size_t)header->labels_length > length)
+    {
+        aeron_set_err(EINVAL, "%s:%d: %s", __FILE__, __LINE__, strerror(EINVAL));
+        return -1;
+    }
+
+    region->values = buffer + AERON_COUNTERS_COMPACT_HEADER_LENGTH;
+    region->metadata = region->values + values_length;
+    region->labels = region->metadata + metadata_length;
+    region->first_counter_id = header->first_counter_id;
+    region->capacity = header->capacity;
+    region->labels_length = (size_t)header->labels_length;
+
+    return 0;
+}
+
 int aeron_counters_manager_init(
     aeron_counters_manager_t *manager,
     uint8_t *metadata_buffer,
@@ -40,11 +152,19 @@ int aeron_counters_manager_init(
         manager->values = values_buffer;
         manager->values_length = values_length;
         manager->id_high_water_mark = -1;
-        manager->free_list_index = -1;
-        manager->free_list_length = 2;
+        manager->compact_high_water_mark = -1;
+        manager->compact_labels_tail = 0;
         manager->clock_func = clock_func;
         manager->free_to_reuse_timeout_ms = free_to_reuse_timeout_ms;
-        result = aeron_alloc((void **)&manager->free_list, sizeof(int32_t) * manager->free_list_length);
+        aeron_counters_compact_region_wrap(&manager->compact, NULL, 0);
+
+        if ((result = aeron_counters_free_list_init(&manager->free_list)) == 0)
+        {
+            if ((result = aeron_counters_free_list_init(&manager->compact_free_list)) < 0)
+            {
+                aeron_free(manager->free_list.ids);
+            }
+        }
     }
     else
     {
@@ -56,7 +176,82 @@ int aeron_counters_manager_init(
 
 void aeron_counters_manager_close(aeron_counters_manager_t *manager)
 {
-    aeron_free(manager->free_list);
+    aeron_free(manager->free_list.ids);
+    aeron_free(manager->compact_free_list.ids);
+}
+
+int aeron_counters_manager_init_compact(aeron_counters_manager_t *manager, uint8_t *buffer, size_t length)
+{
+    manager->compact_high_water_mark = -1;
+    manager->compact_labels_tail = 0;
+
+    return aeron_counters_compact_region_wrap(&manager->compact, buffer, length);
+}
+
+static inline aeron_compact_counter_metadata_descriptor_t *aeron_counters_compact_metadata(
+    aeron_counters_compact_region_t *region, int32_t counter_id)
+{
+    return (aeron_compact_counter_metadata_descriptor_t *)(
+        region->metadata + AERON_COMPACT_COUNTER_METADATA_OFFSET(region, counter_id));
+}
+
+static int32_t aeron_counters_manager_next_compact_counter_id(aeron_counters_manager_t *manager)
+{
+    aeron_counters_compact_region_t *region = &manager->compact;
+
+    if (manager->compact_free_list.size > 0)
+    {
+        int32_t counter_id = manager->compact_free_list.ids[manager->compact_free_list.head];
+        aeron_compact_counter_metadata_descriptor_t *metadata = aeron_counters_compact_metadata(region, counter_id);
+
+        int64_t deadline;
+        AERON_GET_VOLATILE(deadline, metadata->free_for_reuse_deadline);
+
+        if (manager->clock_func() >= deadline)
+        {
+            aeron_counters_free_list_remove_head(&manager->compact_free_list);
+            AERON_PUT_ORDERED(metadata->registration_id, AERON_COUNTER_REGISTRATION_ID_DEFAULT);
+            aeron_counter_set_ordered(aeron_counters_manager_addr(manager, counter_id), INT64_C(0));
+            return counter_id;
+        }
+    }
+
+    if (manager->compact_high_water_mark + 1 < region->capacity &&
+        manager->compact_labels_tail < region->labels_length)
+    {
+        return region->first_counter_id + ++manager->compact_high_water_mark;
+    }
+
+    return AERON_NULL_COUNTER_ID;
+}
+
+static void aeron_counters_manager_compact_label(
+    aeron_counters_manager_t *manager,
+    aeron_compact_counter_metadata_descriptor_t *metadata,
+    const char *label,
+    size_t label_length)
+{
+    aeron_counters_compact_region_t *region = &manager->compact;
+    size_t label_capacity = (size_t)metadata->label_capacity;
+
+    if (label_length > label_capacity && manager->compact_labels_tail < region->labels_length)
+    {
+        const size_t available = region->labels_length - manager->compact_labels_tail;
+        const size_t new_capacity = label_length < available ? label_length : available;
+
+        if (new_capacity > label_capacity)
+        {
+            metadata->label_offset = (int32_t)manager->compact_labels_tail;
+            metadata->label_capacity = (int32_t)new_capacity;
+            manager->compact_labels_tail += new_capacity;
+            label_capacity = new_capacity;
+        }
+    }
+
+    const size_t length = label_length < label_capacity ? label_length : label_capacity;
+
+    memcpy(region->labels + metadata->label_offset, label, length);
+    AERON_PUT_ORDERED(metadata->label_length, (int32_t)length);
 }
 
 int32_t aeron_counters_manager_allocate(
@@ -101,9 +296,50 @@ int32_t aeron_counters_manager_allocate(
     return counter_id;
 }
 
+int32_t aeron_counters_manager_allocate_compact(
+    aeron_counters_manager_t *manager,
+    int32_t type_id,
+    const uint8_t *key,
+    size_t key_length,
+    const char *label,
+    size_t label_length)
+{
+    const int32_t counter_id = aeron_counters_manager_next_compact_counter_id(manager);
+
+    if (AERON_NULL_COUNTER_ID == counter_id)
+    {
+        return aeron_counters_manager_allocate(manager, type_id, key, key_length, label, label_length);
+    }
+
+    aeron_compact_counter_metadata_descriptor_t *metadata =
+        aeron_counters_compact_metadata(&manager->compact, counter_id);
+
+    metadata->type_id = type_id;
+    metadata->free_for_reuse_deadline = AERON_COUNTER_NOT_FREE_TO_REUSE;
+
+    if (NULL != key && key_length > 0)
+    {
+        memcpy(metadata->key, key, key_length < sizeof(metadata->key) ? key_length : sizeof(metadata->key));
+    }
+
+    aeron_counters_manager_compact_label(manager, metadata, label, label_length);
+    AERON_PUT_ORDERED(metadata->state, AERON_COUNTER_RECORD_ALLOCATED);
+
+    return counter_id;
+}
+
 void aeron_counters_manager_counter_registration_id(
     aeron_counters_manager_t *manager, int32_t counter_id, int64_t registration_id)
 {
+    if (aeron_counters_compact_region_contains(&manager->compact, counter_id))
+    {
+        aeron_compact_counter_metadata_descriptor_t *metadata =
+            aeron_counters_compact_metadata(&manager->compact, counter_id);
+
+        AERON_PUT_ORDERED(metadata->registration_id, registration_id);
+        return;
+    }
+
     aeron_counter_value_descriptor_t *value_descriptor = (aeron_counter_value_descriptor_t *)(
         manager->values + AERON_COUNTER_OFFSET(counter_id));
 
@@ -113,6 +349,13 @@ void aeron_counters_manager_counter_registration_id(
 void aeron_counters_manager_update_label(
     aeron_counters_manager_t *manager, int32_t counter_id, size_t label_length, const char *label)
 {
+    if (aeron_counters_compact_region_contains(&manager->compact, counter_id))
+    {
+        aeron_counters_manager_compact_label(
+            manager, aeron_counters_compact_metadata(&manager->compact, counter_id), label, label_length);
+        return;
+    }
+
     aeron_counter_metadata_descriptor_t *metadata = (aeron_counter_metadata_descriptor_t *)
         (manager->metadata + (counter_id * AERON_COUNTERS_MANAGER_METADATA_LENGTH));
 
@@ -125,6 +368,20 @@ void aeron_counters_manager_update_label(
 void aeron_counters_manager_append_to_label(
     aeron_counters_manager_t *manager, int32_t counter_id, size_t length, const char *value)
 {
+    if (aeron_counters_compact_region_contains(&manager->compact, counter_id))
+    {
+        aeron_compact_counter_metadata_descriptor_t *metadata =
+            aeron_counters_compact_metadata(&manager->compact, counter_id);
+
+        size_t current_length = (size_t)metadata->label_length;
+        size_t available_length = (size_t)metadata->label_capacity - current_length;
+        size_t copy_length = length > available_length ? available_length : length;
+
+        memcpy(manager->compact.labels + metadata->label_offset + current_length, value, copy_length);
+        AERON_PUT_ORDERED(metadata->label_length, ((int32_t)(current_length + copy_length)));
+        return;
+    }
+
     aeron_counter_metadata_descriptor_t *metadata = (aeron_counter_metadata_descriptor_t *)
         (manager->metadata + (counter_id * AERON_COUNTERS_MANAGER_METADATA_LENGTH));
 
@@ -136,32 +393,21 @@ void aeron_counters_manager_append_to_label(
     AERON_PUT_ORDERED(metadata->label_length, ((int32_t)(current_length + copy_length)));
 }
 
-void aeron_counters_manager_remove_free_list_index(aeron_counters_manager_t *manager, int index)
-{
-    for (int i = index; i < manager->free_list_index; i++)
-    {
-        manager->free_list[i] = manager->free_list[i + 1];
-    }
-
-    manager->free_list_index--;
-}
-
 int32_t aeron_counters_manager_next_counter_id(aeron_counters_manager_t *manager)
 {
-    int64_t now_ms = manager->clock_func();
-
-    for (int i = 0; i <= manager->free_list_index; i++)
+    if (manager->free_list.size > 0)
     {
-        int32_t counter_id = manager->free_list[i];
+        int32_t counter_id = manager->free_list.ids[manager->free_list.head];
         aeron_counter_metadata_descriptor_t *metadata = (aeron_counter_metadata_descriptor_t *)
             (manager->metadata + (counter_id * AERON_COUNTERS_MANAGER_METADATA_LENGTH));
 
         int64_t deadline;
         AERON_GET_VOLATILE(deadline, metadata->free_for_reuse_deadline);
 
-        if (now_ms >= deadline)
+        if (manager->clock_func() >= deadline)
         {
-            aeron_counters_manager_remove_free_list_index(manager, i);
+            aeron_counters_free_list_remove_head(&manager->free_list);
+
             aeron_counter_value_descriptor_t *value = (aeron_counter_value_descriptor_t *)
                 (manager->values + (counter_id * AERON_COUNTERS_MANAGER_VALUE_LENGTH));
             AERON_PUT_ORDERED(value->registration_id, AERON_COUNTER_REGISTRATION_ID_DEFAULT);
@@ -175,6 +421,18 @@ int32_t aeron_counters_manager_next_counter_id(aeron_counters_manager_t *manager
 
 int aeron_counters_manager_free(aeron_counters_manager_t *manager, int32_t counter_id)
 {
+    if (aeron_counters_compact_region_contains(&manager->compact, counter_id))
+    {
+        aeron_compact_counter_metadata_descriptor_t *metadata =
+            aeron_counters_compact_metadata(&manager->compact, counter_id);
+
+        AERON_PUT_ORDERED(metadata->state, AERON_COUNTER_RECORD_RECLAIMED);
+        memset(metadata->key, 0, sizeof(metadata->key));
+        metadata->free_for_reuse_deadline = manager->clock_func() + manager->free_to_reuse_timeout_ms;
+
+        return aeron_counters_free_list_add(&manager->compact_free_list, counter_id);
+    }
+
     aeron_counter_metadata_descriptor_t *metadata = (aeron_counter_metadata_descriptor_t *)
         (manager->metadata + (counter_id * AERON_COUNTERS_MANAGER_METADATA_LENGTH));
 
@@ -182,21 +440,7 @@ int aeron_counters_manager_free(aeron_counters_manager_t *manager, int32_t count
     memset(metadata->key, 0, sizeof(metadata->key));
     metadata->free_for_reuse_deadline = manager->clock_func() + manager->free_to_reuse_timeout_ms;
 
-    if ((manager->free_list_index + 1) >= (int32_t)manager->free_list_length)
-    {
-        size_t new_length = manager->free_list_length + (manager->free_list_length >> 1u);
-
-        if (aeron_reallocf((void **)&manager->free_list, sizeof(int32_t) * new_length) < 0)
-        {
-            return -1;
-        }
-
-        manager->free_list_length = new_length;
-    }
-
-    manager->free_list[++manager->free_list_index] = counter_id;
-
-    return 0;
+    return aeron_counters_free_list_add(&manager->free_list, counter_id);
 }
 
 void aeron_counters_reader_foreach_metadata(
@@ -272,15 +516,95 @@ void aeron_counters_reader_foreach_counter(
 
         id++;
     }
+
+    aeron_counters_compact_region_t *region = &counters_reader->compact;
+
+    for (int32_t i = 0; i < region->capacity; i++)
+    {
+        const int32_t counter_id = region->first_counter_id + i;
+        aeron_compact_counter_metadata_descriptor_t *record = aeron_counters_compact_metadata(region, counter_id);
+        int32_t record_state;
+
+        AERON_GET_VOLATILE(record_state, record->state);
+
+        if (AERON_COUNTER_RECORD_UNUSED == record_state)
+        {
+            break;
+        }
+        else if (AERON_COUNTER_RECORD_ALLOCATED == record_state)
+        {
+            int32_t label_length;
+
+            AERON_GET_VOLATILE(label_length, record->label_length);
+
+            func(
+                aeron_counter_get_volatile(aeron_counters_reader_addr(counters_reader, counter_id)),
+                counter_id,
+                (const char *)(region->labels + record->label_offset),
+                (size_t)label_length,
+                clientd);
+        }
+    }
+}
+
+void aeron_counters_reader_foreach_compact_metadata(
+    aeron_counters_compact_region_t *region,
+    aeron_counters_reader_foreach_metadata_func_t func,
+    void *clientd)
+{
+    for (int32_t i = 0; i < region->capacity; i++)
+    {
+        const int32_t counter_id = region->first_counter_id + i;
+        aeron_compact_counter_metadata_descriptor_t *record = aeron_counters_compact_metadata(region, counter_id);
+        int32_t record_state;
+
+        AERON_GET_VOLATILE(record_state, record->state);
+
+        if (AERON_COUNTER_RECORD_UNUSED == record_state)
+        {
+            break;
+        }
+        else if (AERON_COUNTER_RECORD_ALLOCATED == record_state)
+        {
+            int32_t label_length;
+
+            AERON_GET_VOLATILE(label_length, record->label_length);
+
+            func(
+                counter_id,
+                record->type_id,
+                record->key,
+                sizeof(record->key),
+                region->labels + record->label_offset,
+                (size_t)label_length,
+                clientd);
+        }
+    }
+}
+
+int aeron_counters_reader_init_compact(aeron_counters_reader_t *reader, uint8_t *buffer, size_t length)
+{
+    return aeron_counters_compact_region_wrap(&reader->compact, buffer, length);
 }
 
 extern int64_t *aeron_counters_manager_addr(aeron_counters_manager_t *counters_manager, int32_t counter_id);
 
 extern int64_t *aeron_counters_reader_addr(aeron_counters_reader_t *counters_reader, int32_t counter_id);
 
+extern bool aeron_counters_compact_region_contains(aeron_counters_compact_region_t *region, int32_t counter_id);
+
 int aeron_counters_reader_counter_registration_id(
     aeron_counters_reader_t *counters_reader, int32_t counter_id, int64_t *registration_id)
 {
+    if (aeron_counters_compact_region_contains(&counters_reader->compact, counter_id))
+    {
+        aeron_compact_counter_metadata_descriptor_t *metadata =
+            aeron_counters_compact_metadata(&counters_reader->compact, counter_id);
+
+        AERON_GET_VOLATILE(*registration_id, metadata->registration_id);
+        return 0;
+    }
+
     if (counter_id < 0 || counters_reader->max_counter_id <= counter_id)
     {
         return -1;
@@ -296,6 +620,15 @@ int aeron_counters_reader_counter_registration_id(
 
 int aeron_counters_reader_counter_state(aeron_counters_reader_t *counters_reader, int32_t counter_id, int32_t *state)
 {
+    if (aeron_counters_compact_region_contains(&counters_reader->compact, counter_id))
+    {
+        aeron_compact_counter_metadata_descriptor_t *metadata =
+            aeron_counters_compact_metadata(&counters_reader->compact, counter_id);
+
+        AERON_GET_VOLATILE(*state, metadata->state);
+        return 0;
+    }
+
     if (counter_id < 0 || counters_reader->max_counter_id <= counter_id)
     {
         return -1;
@@ -312,6 +645,20 @@ int aeron_counters_reader_counter_state(aeron_counters_reader_t *counters_reader
 int aeron_counters_reader_counter_label(
     aeron_counters_reader_t *counters_reader, int32_t counter_id, char *buffer, size_t buffer_length)
 {
+    if (aeron_counters_compact_region_contains(&counters_reader->compact, counter_id))
+    {
+        aeron_compact_counter_metadata_descriptor_t *metadata =
+            aeron_counters_compact_metadata(&counters_reader->compact, counter_id);
+
+        int32_t label_length;
+        AERON_GET_VOLATILE(label_length, metadata->label_length);
+
+        size_t copy_length = (size_t)label_length < buffer_length ? (size_t)label_length : buffer_length;
+        memcpy(buffer, counters_reader->compact.labels + metadata->label_offset, copy_length);
+
+        return (int)copy_length;
+    }
+
     if (counter_id < 0 || counters_reader->max_counter_id <= counter_id)
     {
         return -1;
@@ -332,6 +679,15 @@ int aeron_counters_reader_counter_label(
 int aeron_counters_reader_free_for_reuse_deadline_ms(
     aeron_counters_reader_t *counters_reader, int32_t counter_id, int64_t *deadline_ms)
 {
+    if (aeron_counters_compact_region_contains(&counters_reader->compact, counter_id))
+    {
+        aeron_compact_counter_metadata_descriptor_t *metadata =
+            aeron_counters_compact_metadata(&counters_reader->compact, counter_id);
+
+        AERON_GET_VOLATILE(*deadline_ms, metadata->free_for_reuse_deadline);
+        return 0;
+    }
+
     if (counter_id < 0 || counters_reader->max_counter_id <= counter_id)
     {
         return -1;
@@ -345,6 +701,48 @@ int aeron_counters_reader_free_for_reuse_deadline_ms(
 }
 
 
+int aeron_counters_reader_aggregated_value(
+    aeron_counters_reader_t *counters_reader, int32_t counter_id, int64_t *value)
+{
+    if ((counter_id < 0 || counters_reader->max_counter_id <= counter_id) &&
+        !aeron_counters_compact_region_contains(&counters_reader->compact, counter_id))
+    {
+        return -1;
+    }
+
+    int64_t aggregated_value = aeron_counter_get_volatile(aeron_counters_reader_addr(counters_reader, counter_id));
+    int32_t id = 0;
+
+    for (size_t i = 0; i < counters_reader->metadata_length; i += AERON_COUNTERS_MANAGER_METADATA_LENGTH)
+    {
+        aeron_counter_metadata_descriptor_t *record = (aeron_counter_metadata_descriptor_t *)(
+            counters_reader->metadata + i);
+        int32_t record_state;
+
+        AERON_GET_VOLATILE(record_state, record->state);
+
+        if (AERON_COUNTER_RECORD_UNUSED == record_state)
+        {
+            break;
+        }
+        else if (AERON_COUNTER_RECORD_ALLOCATED == record_state && AERON_COUNTER_STRIPE_TYPE_ID == record->type_id)
+        {
+            aeron_counter_stripe_key_layout_t *key = (aeron_counter_stripe_key_layout_t *)record->key;
+
+            if (counter_id == key->aggregate_counter_id)
+            {
+                aggregated_value += aeron_counter_get_volatile(aeron_counters_reader_addr(counters_reader, id));
+            }
+        }
+
+        id++;
+    }
+
+    *value = aggregated_value;
+
+    return 0;
+}
+
 extern int aeron_counters_reader_init(
     aeron_counters_reader_t *reader,
     uint8_t *metadata_buffer,
@@ -365,3 +763,7 @@ extern int64_t aeron_counter_ordered_increment(volatile int64_t *addr, int64_t v
 extern int64_t aeron_counter_add_ordered(volatile int64_t *addr, int64_t value);
 
 extern bool aeron_counter_propose_max_ordered(volatile int64_t *addr, int64_t proposed_value);
+extern bool aeron_counter_propose_max_atomic(volatile int64_t *addr, int64_t proposed_value);
+extern int64_t aeron_counter_readiness_bit(int32_t session_id);
+extern void aeron_counter_set_bits(volatile int64_t *addr, int64_t bits);
+extern int64_t aeron_counter_take_bits(volatile int64_t *addr);
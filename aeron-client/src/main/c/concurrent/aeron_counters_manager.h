@@ -50,6 +50,65 @@ aeron_counter_metadata_descriptor_t;
 #define AERON_COUNTERS_METADATA_BUFFER_LENGTH(v) \
 ((v) * (AERON_COUNTERS_MANAGER_METADATA_LENGTH / AERON_COUNTERS_MANAGER_VALUE_LENGTH))
 
+/*
+ * The compact region holds read-mostly counters with a single writer. Values are packed 8 bytes apart rather than
+ * each having two cache lines, and metadata records are one cache line with labels held in a shared table, so a
+ * counter takes a fraction of the space it would in the main region and a scan of the metadata touches far fewer
+ * pages. Compact counter ids carry on from the last id of the main region so readers resolve either by id.
+ *
+ * Layout: header, values, metadata records then the label table. The header describes the rest so readers need only
+ * the buffer.
+ */
+#pragma pack(push)
+#pragma pack(4)
+typedef struct aeron_counters_compact_header_stct
+{
+    int32_t first_counter_id;
+    int32_t capacity;
+    int32_t labels_length;
+}
+aeron_counters_compact_header_t;
+
+typedef struct aeron_compact_counter_metadata_descriptor_stct
+{
+    int32_t state;
+    int32_t type_id;
+    int64_t registration_id;
+    int64_t free_for_reuse_deadline;
+    int32_t label_offset;
+    int32_t label_capacity;
+    int32_t label_length;
+    uint8_t key[AERON_CACHE_LINE_LENGTH - (5 * sizeof(int32_t)) - (2 * sizeof(int64_t))];
+}
+aeron_compact_counter_metadata_descriptor_t;
+#pragma pack(pop)
+
+#define AERON_COUNTERS_COMPACT_HEADER_LENGTH (AERON_CACHE_LINE_LENGTH * 2u)
+#define AERON_COUNTERS_COMPACT_VALUE_LENGTH (sizeof(int64_t))
+#define AERON_COUNTERS_COMPACT_METADATA_LENGTH (sizeof(aeron_compact_counter_metadata_descriptor_t))
+#define AERON_COUNTERS_COMPACT_LABEL_LENGTH_PER_COUNTER (128u)
+
+#define AERON_COUNTERS_COMPACT_VALUES_LENGTH(c) \
+(AERON_ALIGN((c) * AERON_COUNTERS_COMPACT_VALUE_LENGTH, AERON_CACHE_LINE_LENGTH * 2u))
+
+#define AERON_COUNTERS_COMPACT_BUFFER_LENGTH(c) \
+((c) > 0 ? \
+    (AERON_COUNTERS_COMPACT_HEADER_LENGTH + \
+    AERON_COUNTERS_COMPACT_VALUES_LENGTH(c) + \
+    ((c) * AERON_COUNTERS_COMPACT_METADATA_LENGTH) + \
+    ((c) * AERON_COUNTERS_COMPACT_LABEL_LENGTH_PER_COUNTER)) : 0)
+
+typedef struct aeron_counters_compact_region_stct
+{
+    uint8_t *values;
+    uint8_t *metadata;
+    uint8_t *labels;
+    int32_t first_counter_id;
+    int32_t capacity;
+    size_t labels_length;
+}
+aeron_counters_compact_region_t;
+
 #define AERON_COUNTER_RECORD_UNUSED (0)
 #define AERON_COUNTER_RECORD_ALLOCATED (1)
 #define AERON_COUNTER_RECORD_RECLAIMED (-1)
@@ -102,6 +161,77 @@ aeron_counter_metadata_descriptor_t;
 #define AERON_COUNTER_SND_LOCAL_SOCKADDR_NAME "snd-local-sockaddr"
 #define AERON_COUNTER_LOCAL_SOCKADDR_TYPE_ID (14)
 
+#define AERON_COUNTER_RECEIVER_TIMESTAMP_NAME "rcv-ts"
+#define AERON_COUNTER_RECEIVER_TIMESTAMP_TYPE_ID (17)
+
+#define AERON_COUNTER_SENDER_SHARD_BYTES_SENT_NAME "snd-shard-bytes"
+#define AERON_COUNTER_SENDER_SHARD_BYTES_SENT_TYPE_ID (18)
+
+#define AERON_COUNTER_RCV_FIRST_ARRIVALS_NAME "rcv-first-arrivals"
+#define AERON_COUNTER_RCV_DUPLICATE_ARRIVALS_NAME "rcv-duplicate-arrivals"
+#define AERON_COUNTER_RCV_ARRIVAL_LAG_NAME "rcv-arrival-lag-ns"
+#define AERON_COUNTER_RCV_SOCKET_DROPS_NAME "rcv-socket-drops"
+#define AERON_COUNTER_RCV_DESTINATION_TYPE_ID (19)
+
+#define AERON_COUNTER_SENDER_LATENCY_NAME "snd-latency"
+#define AERON_COUNTER_SENDER_LATENCY_TYPE_ID (20)
+
+#define AERON_COUNTER_DELIVERY_LATENCY_NAME "rcv-delivery-latency"
+#define AERON_COUNTER_DELIVERY_LATENCY_TYPE_ID (21)
+
+#define AERON_COUNTER_SENDER_TERM_LENGTH_NAME "snd-term-length-rec"
+#define AERON_COUNTER_SENDER_TERM_LENGTH_TYPE_ID (22)
+
+#define AERON_COUNTER_SUBSCRIPTION_READINESS_NAME "sub-ready"
+#define AERON_COUNTER_SUBSCRIPTION_READINESS_TYPE_ID (23)
+
+#define AERON_COUNTER_PER_IMAGE_TYPE_ID (10)
+
+/* a per writer slot of a counter written by several agents, summed into the counter named in its key by readers */
+#define AERON_COUNTER_STRIPE_TYPE_ID (24)
+
+/* written by an exclusive publisher that sends its own frames, read by the Sender as data already sent */
+#define AERON_COUNTER_SENDER_INLINE_POSITION_NAME "snd-inline-pos"
+#define AERON_COUNTER_SENDER_INLINE_POSITION_TYPE_ID (25)
+
+#define AERON_COUNTER_SENDER_INLINE_ADDRESS_IPV4 (4)
+#define AERON_COUNTER_SENDER_INLINE_ADDRESS_IPV6 (6)
+
+/* held by a client in a block leased from the driver, retyped and relabelled by the client as it allocates and frees */
+#define AERON_COUNTER_CLIENT_LEASE_NAME "client-lease"
+#define AERON_COUNTER_CLIENT_LEASE_TYPE_ID (26)
+#define AERON_COUNTER_CLIENT_LEASE_MAX_LENGTH (256)
+
+#define AERON_COUNTER_SENDER_CPU_TICKS_NAME "snd-cpu-ticks"
+#define AERON_COUNTER_SENDER_CPU_TICKS_TYPE_ID (27)
+
+#define AERON_COUNTER_RECEIVER_CPU_TICKS_NAME "rcv-cpu-ticks"
+#define AERON_COUNTER_RECEIVER_CPU_TICKS_TYPE_ID (28)
+
+/* bytes a subscriber received from the endpoint socket itself and rebuilt into its images, bypassing the Receiver */
+#define AERON_COUNTER_RECEIVER_INLINE_NAME "rcv-inline"
+#define AERON_COUNTER_RECEIVER_INLINE_TYPE_ID (29)
+
+/*
+ * written by a client as it offers to a publication with offer-stats=true, one counter for each metric named in the
+ * key, with the back pressured periods ending in an accepted offer counted in buckets of up to 10us, 100us, 1ms, 10ms
+ * and over 10ms
+ */
+#define AERON_COUNTER_PUBLICATION_OFFER_NAME "pub-offer"
+#define AERON_COUNTER_PUBLICATION_OFFER_TYPE_ID (30)
+
+#define AERON_PUBLICATION_OFFER_METRIC_BACK_PRESSURED (0)
+#define AERON_PUBLICATION_OFFER_METRIC_NOT_CONNECTED (1)
+#define AERON_PUBLICATION_OFFER_METRIC_ADMIN_ACTION (2)
+#define AERON_PUBLICATION_OFFER_METRIC_MAX_POSITION_EXCEEDED (3)
+#define AERON_PUBLICATION_OFFER_METRIC_OFFERED_BYTES (4)
+#define AERON_PUBLICATION_OFFER_METRIC_ACCEPTED_BYTES (5)
+#define AERON_PUBLICATION_OFFER_METRIC_BACK_PRESSURED_NS (6)
+#define AERON_PUBLICATION_OFFER_METRIC_BACK_PRESSURED_BUCKET (7)
+#define AERON_PUBLICATION_OFFER_BACK_PRESSURED_BUCKET_COUNT (5)
+#define AERON_PUBLICATION_OFFER_METRIC_COUNT \
+    (AERON_PUBLICATION_OFFER_METRIC_BACK_PRESSURED_BUCKET + AERON_PUBLICATION_OFFER_BACK_PRESSURED_BUCKET_COUNT)
+
 #pragma pack(push)
 #pragma pack(4)
 typedef struct aeron_stream_position_counter_key_layout_stct
@@ -121,6 +251,20 @@ typedef struct aeron_channel_endpoint_status_key_layout_stct
 }
 aeron_channel_endpoint_status_key_layout_t;
 
+typedef struct aeron_counter_stripe_key_layout_stct
+{
+    int32_t aggregate_counter_id;
+    int32_t writer_id;
+}
+aeron_counter_stripe_key_layout_t;
+
+typedef struct aeron_counter_client_lease_key_layout_stct
+{
+    int64_t registration_id;
+    int64_t client_id;
+}
+aeron_counter_client_lease_key_layout_t;
+
 typedef struct aeron_heartbeat_timestamp_key_layout_stct
 {
     int64_t registration_id;
@@ -135,8 +279,49 @@ typedef struct aeron_local_sockaddr_key_layout_stct
 }
 aeron_local_sockaddr_key_layout_t;
 
+typedef struct aeron_sender_inline_position_key_layout_stct
+{
+    int64_t registration_id;
+    int32_t session_id;
+    int32_t stream_id;
+    int32_t address_type;
+    int32_t port;
+    uint8_t address[16];
+}
+aeron_sender_inline_position_key_layout_t;
+
+typedef struct aeron_receiver_inline_key_layout_stct
+{
+    int64_t registration_id;
+    int32_t stream_id;
+    int32_t address_type;
+    int32_t port;
+    uint8_t address[16];
+}
+aeron_receiver_inline_key_layout_t;
+
+typedef struct aeron_publication_offer_key_layout_stct
+{
+    int64_t registration_id;
+    int32_t session_id;
+    int32_t stream_id;
+    int32_t metric;
+    int32_t channel_length;
+    char channel[sizeof(((aeron_counter_metadata_descriptor_t *)0)->key) - (sizeof(int64_t) + 4 * sizeof(int32_t))];
+}
+aeron_publication_offer_key_layout_t;
+
 #pragma pack(pop)
 
+typedef struct aeron_counters_free_list_stct
+{
+    int32_t *ids;
+    size_t head;
+    size_t size;
+    size_t capacity;
+}
+aeron_counters_free_list_t;
+
 typedef struct aeron_counters_manager_stct
 {
     uint8_t *values;
@@ -145,9 +330,17 @@ typedef struct aeron_counters_manager_stct
     size_t metadata_length;
 
     int32_t id_high_water_mark;
-    int32_t *free_list;
-    int32_t free_list_index;
-    size_t free_list_length;
+
+    /*
+     * Freed ids in the order they were freed. All share the same reuse timeout so the head always has the earliest
+     * deadline and is the only entry allocation needs to check.
+     */
+    aeron_counters_free_list_t free_list;
+
+    aeron_counters_compact_region_t compact;
+    int32_t compact_high_water_mark;
+    size_t compact_labels_tail;
+    aeron_counters_free_list_t compact_free_list;
 
     aeron_clock_func_t clock_func;
     int64_t free_to_reuse_timeout_ms;
@@ -161,6 +354,7 @@ typedef struct aeron_counters_reader_stct
     size_t values_length;
     size_t metadata_length;
     int32_t max_counter_id;
+    aeron_counters_compact_region_t compact;
 }
 aeron_counters_reader_t;
 
@@ -177,6 +371,20 @@ int aeron_counters_manager_init(
 
 void aeron_counters_manager_close(aeron_counters_manager_t *manager);
 
+/*
+ * Format a compact region in the given buffer with its ids following those of a main region of values_length. The
+ * buffer is expected to be zeroed and sized with AERON_COUNTERS_COMPACT_BUFFER_LENGTH.
+ */
+int aeron_counters_compact_region_format(uint8_t *buffer, size_t length, size_t values_length, int32_t capacity);
+
+/*
+ * Wrap a compact region formatted by aeron_counters_compact_region_format. An empty buffer gives a region with no
+ * capacity.
+ */
+int aeron_counters_compact_region_wrap(aeron_counters_compact_region_t *region, uint8_t *buffer, size_t length);
+
+int aeron_counters_manager_init_compact(aeron_counters_manager_t *manager, uint8_t *buffer, size_t length);
+
 int32_t aeron_counters_manager_allocate(
     aeron_counters_manager_t *manager,
     int32_t type_id,
@@ -185,6 +393,18 @@ int32_t aeron_counters_manager_allocate(
     const char *label,
     size_t label_length);
 
+/*
+ * Allocate a counter in the compact region, falling back to the main region when it is full or has no compact region.
+ * Only for counters with a single writer that change infrequently, as neighbouring values share cache lines.
+ */
+int32_t aeron_counters_manager_allocate_compact(
+    aeron_counters_manager_t *manager,
+    int32_t type_id,
+    const uint8_t *key,
+    size_t key_length,
+    const char *label,
+    size_t label_length);
+
 void aeron_counters_manager_counter_registration_id(
     aeron_counters_manager_t *manager, int32_t counter_id, int64_t registration_id);
 
@@ -216,13 +436,35 @@ void aeron_counters_reader_foreach_metadata(
 #define AERON_COUNTER_OFFSET(id) ((id) * AERON_COUNTERS_MANAGER_VALUE_LENGTH)
 #define AERON_COUNTER_METADATA_OFFSET(id) ((id) * AERON_COUNTERS_MANAGER_METADATA_LENGTH)
 
+#define AERON_COMPACT_COUNTER_OFFSET(region, id) \
+(((size_t)((id) - (region)->first_counter_id)) * AERON_COUNTERS_COMPACT_VALUE_LENGTH)
+#define AERON_COMPACT_COUNTER_METADATA_OFFSET(region, id) \
+(((size_t)((id) - (region)->first_counter_id)) * AERON_COUNTERS_COMPACT_METADATA_LENGTH)
+
+inline bool aeron_counters_compact_region_contains(aeron_counters_compact_region_t *region, int32_t counter_id)
+{
+    return counter_id >= region->first_counter_id && counter_id - region->first_counter_id < region->capacity;
+}
+
 inline int64_t *aeron_counters_manager_addr(aeron_counters_manager_t *counters_manager, int32_t counter_id)
 {
+    if (AERON_C_COND_EXPECT(counter_id >= counters_manager->compact.first_counter_id, false))
+    {
+        return (int64_t *)(
+            counters_manager->compact.values + AERON_COMPACT_COUNTER_OFFSET(&counters_manager->compact, counter_id));
+    }
+
     return (int64_t *)(counters_manager->values + AERON_COUNTER_OFFSET(counter_id));
 }
 
 inline int64_t *aeron_counters_reader_addr(aeron_counters_reader_t *counters_reader, int32_t counter_id)
 {
+    if (AERON_C_COND_EXPECT(counter_id >= counters_reader->compact.first_counter_id, false))
+    {
+        return (int64_t *)(
+            counters_reader->compact.values + AERON_COMPACT_COUNTER_OFFSET(&counters_reader->compact, counter_id));
+    }
+
     return (int64_t *)(counters_reader->values + AERON_COUNTER_OFFSET(counter_id));
 }
 
@@ -237,6 +479,13 @@ int aeron_counters_reader_counter_label(
 int aeron_counters_reader_free_for_reuse_deadline_ms(
     aeron_counters_reader_t *counters_reader, int32_t counter_id, int64_t *deadline_ms);
 
+/*
+ * Value of the counter plus that of each AERON_COUNTER_STRIPE_TYPE_ID counter which names it as its aggregate. Walks
+ * the metadata so is intended for monitoring rather than the data path.
+ */
+int aeron_counters_reader_aggregated_value(
+    aeron_counters_reader_t *counters_reader, int32_t counter_id, int64_t *value);
+
 inline int aeron_counters_reader_init(
     aeron_counters_reader_t *reader,
     uint8_t *metadata_buffer,
@@ -249,10 +498,21 @@ inline int aeron_counters_reader_init(
     reader->values = values_buffer;
     reader->values_length = values_length;
     reader->max_counter_id = (int32_t)(values_length / AERON_COUNTERS_MANAGER_VALUE_LENGTH);
+    aeron_counters_compact_region_wrap(&reader->compact, NULL, 0);
 
     return 0;
 }
 
+int aeron_counters_reader_init_compact(aeron_counters_reader_t *reader, uint8_t *buffer, size_t length);
+
+/*
+ * Iterate the metadata of the allocated counters in a compact region, passing the label from the label table.
+ */
+void aeron_counters_reader_foreach_compact_metadata(
+    aeron_counters_compact_region_t *region,
+    aeron_counters_reader_foreach_metadata_func_t func,
+    void *clientd);
+
 inline void aeron_counter_set_ordered(volatile int64_t *addr, int64_t value)
 {
     AERON_PUT_ORDERED(*addr, value);
@@ -305,4 +565,58 @@ inline bool aeron_counter_propose_max_ordered(volatile int64_t *addr, int64_t pr
     return updated;
 }
 
+/*
+ * For a counter with more than one writer, each only ever moving it forward.
+ */
+inline bool aeron_counter_propose_max_atomic(volatile int64_t *addr, int64_t proposed_value)
+{
+    int64_t current;
+    AERON_GET_VOLATILE(current, *addr);
+
+    while (current < proposed_value)
+    {
+        if (aeron_cmpxchg64(addr, current, proposed_value))
+        {
+            return true;
+        }
+
+        AERON_GET_VOLATILE(current, *addr);
+    }
+
+    return false;
+}
+
+/*
+ * A readiness counter is a bitmap of the images of a subscription with data to poll. Images share the 64 bits by
+ * session id, so a set bit means at least one of the images in that bucket may have data.
+ */
+inline int64_t aeron_counter_readiness_bit(int32_t session_id)
+{
+    return (int64_t)(UINT64_C(1) << ((uint32_t)session_id & 63u));
+}
+
+inline void aeron_counter_set_bits(volatile int64_t *addr, int64_t bits)
+{
+    int64_t current;
+    AERON_GET_VOLATILE(current, *addr);
+
+    while ((current & bits) != bits && !aeron_cmpxchg64(addr, current, current | bits))
+    {
+        AERON_GET_VOLATILE(current, *addr);
+    }
+}
+
+inline int64_t aeron_counter_take_bits(volatile int64_t *addr)
+{
+    int64_t current;
+    AERON_GET_VOLATILE(current, *addr);
+
+    while (0 != current && !aeron_cmpxchg64(addr, current, 0))
+    {
+        AERON_GET_VOLATILE(current, *addr);
+    }
+
+    return current;
+}
+
 #endif //AERON_COUNTERS_MANAGER_H
@@ -41,7 +41,7 @@ int aeron_distinct_error_log_init(
         return -1;
     }
 
-    if (aeron_alloc((void **)&log->observation_list, sizeof(aeron_distinct_error_log_observation_list_t)) < 0)
+    if (aeron_distinct_error_log_observation_list_alloc(&log->observation_list, 0) < 0)
     {
         aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
         return -1;
@@ -53,8 +53,6 @@ int aeron_distinct_error_log_init(
     log->linger_resource = linger;
     log->linger_resource_clientd = clientd;
     log->next_offset = 0;
-    log->observation_list->num_observations = 0;
-    log->observation_list->observations = NULL;
     aeron_mutex_init(&log->mutex, NULL);
 
     return 0;
@@ -75,19 +73,47 @@ void aeron_distinct_error_log_close(aeron_distinct_error_log_t *log)
     aeron_mutex_destroy(&log->mutex);
 }
 
+static uint64_t aeron_distinct_error_log_hash(int error_code, const char *description, size_t description_length)
+{
+    return (aeron_fnv_64a_buf((uint8_t *)description, description_length) * 31) + (uint32_t)error_code;
+}
+
+static void aeron_distinct_error_log_index_observation(
+    aeron_distinct_error_log_observation_list_t *list, size_t position)
+{
+    size_t slot = (size_t)list->observations[position].hash_code & list->index_mask;
+
+    while (0 != list->index[slot])
+    {
+        slot = (slot + 1) & list->index_mask;
+    }
+
+    list->index[slot] = (uint32_t)(position + 1);
+}
+
 static aeron_distinct_observation_t *aeron_distinct_error_log_find_observation(
-    aeron_distinct_observation_t *observations,
-    size_t num_observations,
+    aeron_distinct_error_log_observation_list_t *list,
     int error_code,
-    const char *description)
+    const char *description,
+    size_t description_length,
+    uint64_t hash_code)
 {
-    for (size_t i = 0; i < num_observations; i++)
+    size_t slot = (size_t)hash_code & list->index_mask;
+    uint32_t entry;
+
+    while (0 != (entry = list->index[slot]))
     {
-        if (observations[i].error_code == error_code &&
-            strncmp(observations[i].description, description, observations[i].description_length) == 0)
+        aeron_distinct_observation_t *observation = &list->observations[entry - 1];
+
+        if (observation->hash_code == hash_code &&
+            observation->error_code == error_code &&
+            observation->description_length == description_length &&
+            memcmp(observation->description, description, description_length) == 0)
         {
-            return &observations[i];
+            return observation;
         }
+
+        slot = (slot + 1) & list->index_mask;
     }
 
     return NULL;
@@ -95,10 +121,11 @@ static aeron_distinct_observation_t *aeron_distinct_error_log_find_observation(
 
 static aeron_distinct_observation_t *aeron_distinct_error_log_new_observation(
     aeron_distinct_error_log_t *log,
-    size_t existing_num_observations,
     int64_t timestamp,
     int error_code,
     const char *description,
+    size_t description_length,
+    uint64_t hash_code,
     const char *message)
 {
     aeron_distinct_error_log_observation_list_t *list = aeron_distinct_error_log_observation_list_load(log);
@@ -107,13 +134,12 @@ static aeron_distinct_observation_t *aeron_distinct_error_log_new_observation(
     aeron_distinct_observation_t *observation = NULL;
 
     if ((observation = aeron_distinct_error_log_find_observation(
-        observations, existing_num_observations, error_code, description)) == NULL)
+        list, error_code, description, description_length, hash_code)) == NULL)
     {
         char encoded_error[AERON_MAX_PATH];
 
         snprintf(encoded_error, sizeof(encoded_error) - 1, "%d: %s %s", error_code, description, message);
 
-        size_t description_length = strlen(description);
         size_t encoded_error_length = strlen(encoded_error);
         size_t length = AERON_ERROR_LOG_HEADER_LENGTH + encoded_error_length;
         aeron_distinct_error_log_observation_list_t *new_list = NULL;
@@ -141,12 +167,18 @@ static aeron_distinct_observation_t *aeron_distinct_error_log_new_observation(
         strncpy(new_description, description, description_length + 1);
         new_array[0].description_length = description_length;
         new_array[0].offset = offset;
+        new_array[0].hash_code = hash_code;
 
         if (num_observations != 0)
         {
             memcpy(&new_array[1], observations, sizeof(aeron_distinct_observation_t) * num_observations);
         }
 
+        for (size_t i = 0; i <= num_observations; i++)
+        {
+            aeron_distinct_error_log_index_observation(new_list, i);
+        }
+
         aeron_distinct_error_log_observation_list_store(log, new_list);
 
         AERON_PUT_ORDERED(entry->length, (int32_t)length);
@@ -174,16 +206,16 @@ int aeron_distinct_error_log_record(
     aeron_distinct_observation_t *observation = NULL;
     int64_t timestamp = log->clock();
     aeron_distinct_error_log_observation_list_t *list = aeron_distinct_error_log_observation_list_load(log);
-    size_t num_observations = (size_t)list->num_observations;
-    aeron_distinct_observation_t *observations = list->observations;
+    size_t description_length = strlen(description);
+    uint64_t hash_code = aeron_distinct_error_log_hash(error_code, description, description_length);
 
     if ((observation = aeron_distinct_error_log_find_observation(
-        observations, num_observations, error_code, description)) == NULL)
+        list, error_code, description, description_length, hash_code)) == NULL)
     {
         aeron_mutex_lock(&log->mutex);
 
         observation = aeron_distinct_error_log_new_observation(
-            log, num_observations, timestamp, error_code, description, message);
+            log, timestamp, error_code, description, description_length, hash_code, message);
 
         aeron_mutex_unlock(&log->mutex);
 
@@ -203,6 +235,7 @@ int aeron_distinct_error_log_record(
     int32_t dest;
 
     AERON_GET_AND_ADD_INT32(dest, entry->observation_count, 1);
+    (void)dest;
     AERON_PUT_ORDERED(entry->last_observation_timestamp, timestamp);
 
     return 0;
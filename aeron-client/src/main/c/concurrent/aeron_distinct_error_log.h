@@ -47,13 +47,20 @@ typedef struct aeron_distinct_observation_stct
     int error_code;
     size_t offset;
     size_t description_length;
+    uint64_t hash_code;
 }
 aeron_distinct_observation_t;
 
+/*
+ * Copy on write list of observations. Each copy carries an open addressing index over (error code, description), where
+ * a slot holds the position of an observation plus one or 0 when empty, so lookups do not compare every description.
+ */
 typedef struct aeron_distinct_error_log_observation_list_stct
 {
     uint64_t num_observations;
     aeron_distinct_observation_t *observations;
+    size_t index_mask;
+    uint32_t *index;
 }
 aeron_distinct_error_log_observation_list_t;
 
@@ -106,9 +113,15 @@ inline int aeron_distinct_error_log_observation_list_alloc(
     aeron_distinct_error_log_observation_list_t **list, uint64_t num_observations)
 {
     *list = NULL;
+    size_t index_capacity = 2;
+    while (index_capacity < (size_t)num_observations * 2)
+    {
+        index_capacity <<= 1u;
+    }
+
+    size_t observations_length = (size_t)num_observations * sizeof(aeron_distinct_observation_t);
     size_t alloc_length =
-        sizeof(aeron_distinct_error_log_observation_list_t) +
-        ((size_t)num_observations * sizeof(aeron_distinct_observation_t));
+        sizeof(aeron_distinct_error_log_observation_list_t) + observations_length + (index_capacity * sizeof(uint32_t));
 
     int result = aeron_alloc((void **)list, alloc_length);
     if (result >= 0)
@@ -117,6 +130,8 @@ inline int aeron_distinct_error_log_observation_list_alloc(
             (aeron_distinct_observation_t *)
                 ((uint8_t *)*list + sizeof(aeron_distinct_error_log_observation_list_t));
         (*list)->num_observations = num_observations;
+        (*list)->index = (uint32_t *)((uint8_t *)(*list)->observations + observations_length);
+        (*list)->index_mask = index_capacity - 1;
     }
 
     return result;
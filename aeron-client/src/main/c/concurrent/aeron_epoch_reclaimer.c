@@ -0,0 +1,225 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "aeron_alloc.h"
+#include "util/aeron_arrayutil.h"
+#include "concurrent/aeron_epoch_reclaimer.h"
+
+int aeron_epoch_reclaimer_init(aeron_epoch_reclaimer_t *reclaimer)
+{
+    reclaimer->global_epoch = 0;
+    reclaimer->participants.array = NULL;
+    reclaimer->participants.length = 0;
+    reclaimer->participants.capacity = 0;
+    reclaimer->retired.array = NULL;
+    reclaimer->retired.length = 0;
+    reclaimer->retired.capacity = 0;
+
+    return 0;
+}
+
+void aeron_epoch_reclaimer_close(aeron_epoch_reclaimer_t *reclaimer)
+{
+    for (size_t i = 0, length = reclaimer->retired.length; i < length; i++)
+    {
+        aeron_epoch_retired_item_t *retired = &reclaimer->retired.array[i];
+        retired->reclaim_func(retired->clientd, retired->item);
+    }
+
+    for (size_t i = 0, length = reclaimer->participants.length; i < length; i++)
+    {
+        reclaimer->participants.array[i]->reclaimer = NULL;
+    }
+
+    aeron_free(reclaimer->retired.array);
+    aeron_free(reclaimer->participants.array);
+    reclaimer->retired.array = NULL;
+    reclaimer->retired.length = 0;
+    reclaimer->retired.capacity = 0;
+    reclaimer->participants.array = NULL;
+    reclaimer->participants.length = 0;
+    reclaimer->participants.capacity = 0;
+}
+
+void aeron_epoch_participant_init(aeron_epoch_participant_t *participant)
+{
+    participant->epoch = AERON_EPOCH_RECLAIMER_QUIESCENT;
+    participant->reclaimer = NULL;
+    participant->depth = 0;
+}
+
+int aeron_epoch_reclaimer_add_participant(aeron_epoch_reclaimer_t *reclaimer, aeron_epoch_participant_t *participant)
+{
+    int ensure_capacity_result = 0;
+
+    AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, reclaimer->participants, aeron_epoch_participant_t *);
+    if (ensure_capacity_result < 0)
+    {
+        return -1;
+    }
+
+    participant->epoch = AERON_EPOCH_RECLAIMER_QUIESCENT;
+    participant->reclaimer = reclaimer;
+    reclaimer->participants.array[reclaimer->participants.length++] = participant;
+
+    return 0;
+}
+
+void aeron_epoch_reclaimer_remove_participant(
+    aeron_epoch_reclaimer_t *reclaimer, aeron_epoch_participant_t *participant)
+{
+    for (size_t i = 0, length = reclaimer->participants.length; i < length; i++)
+    {
+        if (participant == reclaimer->participants.array[i])
+        {
+            aeron_array_fast_unordered_remove(
+                (uint8_t *)reclaimer->participants.array, sizeof(aeron_epoch_participant_t *), i, length - 1);
+            reclaimer->participants.length--;
+            participant->reclaimer = NULL;
+            break;
+        }
+    }
+}
+
+void aeron_epoch_shared_participant_init(aeron_epoch_shared_participant_t *participant)
+{
+    for (size_t i = 0; i < AERON_EPOCH_SHARED_PARTICIPANT_SLOTS; i++)
+    {
+        aeron_epoch_participant_init(&participant->slots[i]);
+    }
+}
+
+int aeron_epoch_reclaimer_add_shared_participant(
+    aeron_epoch_reclaimer_t *reclaimer, aeron_epoch_shared_participant_t *participant)
+{
+    for (size_t i = 0; i < AERON_EPOCH_SHARED_PARTICIPANT_SLOTS; i++)
+    {
+        if (aeron_epoch_reclaimer_add_participant(reclaimer, &participant->slots[i]) < 0)
+        {
+            aeron_epoch_reclaimer_remove_shared_participant(reclaimer, participant);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+void aeron_epoch_reclaimer_remove_shared_participant(
+    aeron_epoch_reclaimer_t *reclaimer, aeron_epoch_shared_participant_t *participant)
+{
+    for (size_t i = 0; i < AERON_EPOCH_SHARED_PARTICIPANT_SLOTS; i++)
+    {
+        aeron_epoch_reclaimer_remove_participant(reclaimer, &participant->slots[i]);
+    }
+}
+
+int aeron_epoch_reclaimer_reserve(aeron_epoch_reclaimer_t *reclaimer, size_t count)
+{
+    size_t required_capacity = reclaimer->retired.length + count;
+
+    if (required_capacity > reclaimer->retired.capacity)
+    {
+        size_t new_capacity = reclaimer->retired.capacity < 2 ? 2 : reclaimer->retired.capacity;
+        while (new_capacity < required_capacity)
+        {
+            new_capacity += new_capacity >> 1;
+        }
+
+        if (aeron_array_ensure_capacity(
+            (uint8_t **)&reclaimer->retired.array,
+            sizeof(aeron_epoch_retired_item_t),
+            reclaimer->retired.capacity,
+            new_capacity) < 0)
+        {
+            reclaimer->retired.length = 0;
+            reclaimer->retired.capacity = 0;
+            return -1;
+        }
+
+        reclaimer->retired.capacity = new_capacity;
+    }
+
+    return 0;
+}
+
+void aeron_epoch_reclaimer_retire(
+    aeron_epoch_reclaimer_t *reclaimer, void *item, aeron_epoch_reclaimer_reclaim_func_t reclaim_func, void *clientd)
+{
+    aeron_epoch_retired_item_t *retired = &reclaimer->retired.array[reclaimer->retired.length++];
+    const int64_t epoch = reclaimer->global_epoch;
+
+    retired->item = item;
+    retired->reclaim_func = reclaim_func;
+    retired->clientd = clientd;
+    retired->epoch = epoch;
+
+    AERON_PUT_VOLATILE(reclaimer->global_epoch, epoch + 1);
+
+    if (reclaimer->retired.length >= AERON_EPOCH_RECLAIMER_BATCH_SIZE)
+    {
+        aeron_epoch_reclaimer_reclaim(reclaimer);
+    }
+}
+
+int aeron_epoch_reclaimer_reclaim(aeron_epoch_reclaimer_t *reclaimer)
+{
+    if (0 == reclaimer->retired.length)
+    {
+        return 0;
+    }
+
+    int64_t min_epoch = AERON_EPOCH_RECLAIMER_QUIESCENT;
+
+    for (size_t i = 0, length = reclaimer->participants.length; i < length; i++)
+    {
+        int64_t epoch;
+
+        AERON_GET_VOLATILE(epoch, reclaimer->participants.array[i]->epoch);
+        min_epoch = epoch < min_epoch ? epoch : min_epoch;
+    }
+
+    size_t kept = 0;
+    int reclaimed_count = 0;
+
+    for (size_t i = 0, length = reclaimer->retired.length; i < length; i++)
+    {
+        aeron_epoch_retired_item_t *retired = &reclaimer->retired.array[i];
+
+        if (retired->epoch < min_epoch)
+        {
+            retired->reclaim_func(retired->clientd, retired->item);
+            reclaimed_count++;
+        }
+        else
+        {
+            reclaimer->retired.array[kept++] = *retired;
+        }
+    }
+
+    reclaimer->retired.length = kept;
+
+    return reclaimed_count;
+}
+
+void aeron_epoch_reclaimer_free_item(void *clientd, void *item)
+{
+    aeron_free(item);
+}
+
+extern void aeron_epoch_participant_enter(aeron_epoch_participant_t *participant);
+extern void aeron_epoch_participant_exit(aeron_epoch_participant_t *participant);
+extern aeron_epoch_participant_t *aeron_epoch_shared_participant_enter(aeron_epoch_shared_participant_t *participant);
+extern void aeron_epoch_shared_participant_exit(aeron_epoch_participant_t *slot);
@@ -0,0 +1,198 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_EPOCH_RECLAIMER_H
+#define AERON_EPOCH_RECLAIMER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "util/aeron_bitutil.h"
+#include "concurrent/aeron_atomic.h"
+#include "concurrent/aeron_thread.h"
+
+#define AERON_EPOCH_RECLAIMER_QUIESCENT (INT64_MAX)
+#define AERON_EPOCH_RECLAIMER_BATCH_SIZE (32)
+#define AERON_EPOCH_SHARED_PARTICIPANT_SLOTS (4)
+
+typedef void (*aeron_epoch_reclaimer_reclaim_func_t)(void *clientd, void *item);
+
+typedef struct aeron_epoch_reclaimer_stct aeron_epoch_reclaimer_t;
+
+/*
+ * The epoch a reading thread entered its critical section at, on its own cache line as the reclaimer scans it. A
+ * participant is only ever entered by one thread at a time. Entering it again from within its critical section, such
+ * as from a callback, nests and only the outermost exit leaves it.
+ */
+typedef struct aeron_epoch_participant_stct
+{
+    uint8_t pre_fields_padding[AERON_CACHE_LINE_LENGTH];
+    volatile int64_t epoch;
+    aeron_epoch_reclaimer_t *reclaimer;
+    int32_t depth;
+    uint8_t post_fields_padding[AERON_CACHE_LINE_LENGTH];
+}
+aeron_epoch_participant_t;
+
+/*
+ * A participant for readers that may run on any number of threads at once. Each read claims a quiescent slot for its
+ * duration, so concurrent readers never share a slot.
+ */
+typedef struct aeron_epoch_shared_participant_stct
+{
+    aeron_epoch_participant_t slots[AERON_EPOCH_SHARED_PARTICIPANT_SLOTS];
+}
+aeron_epoch_shared_participant_t;
+
+typedef struct aeron_epoch_retired_item_stct
+{
+    void *item;
+    aeron_epoch_reclaimer_reclaim_func_t reclaim_func;
+    void *clientd;
+    int64_t epoch;
+}
+aeron_epoch_retired_item_t;
+
+/*
+ * Epoch based reclamation of items unlinked from structures read concurrently. Readers bracket each use of a
+ * structure by entering and exiting their participant. The owning thread retires items after unlinking them, and
+ * they are reclaimed in batches once every participant has exited or entered at a later epoch, so a reader that is
+ * idle holds nothing back.
+ *
+ * All functions except the enters and exits are called on the owning thread only.
+ */
+struct aeron_epoch_reclaimer_stct
+{
+    uint8_t pre_fields_padding[AERON_CACHE_LINE_LENGTH];
+    volatile int64_t global_epoch;
+    uint8_t post_fields_padding[AERON_CACHE_LINE_LENGTH];
+
+    struct aeron_epoch_reclaimer_participants_stct
+    {
+        aeron_epoch_participant_t **array;
+        size_t length;
+        size_t capacity;
+    }
+    participants;
+
+    struct aeron_epoch_reclaimer_retired_stct
+    {
+        aeron_epoch_retired_item_t *array;
+        size_t length;
+        size_t capacity;
+    }
+    retired;
+};
+
+int aeron_epoch_reclaimer_init(aeron_epoch_reclaimer_t *reclaimer);
+
+/*
+ * Reclaim all retired items whether in use or not, for when no reader can run again.
+ */
+void aeron_epoch_reclaimer_close(aeron_epoch_reclaimer_t *reclaimer);
+
+void aeron_epoch_participant_init(aeron_epoch_participant_t *participant);
+
+int aeron_epoch_reclaimer_add_participant(aeron_epoch_reclaimer_t *reclaimer, aeron_epoch_participant_t *participant);
+
+void aeron_epoch_reclaimer_remove_participant(
+    aeron_epoch_reclaimer_t *reclaimer, aeron_epoch_participant_t *participant);
+
+void aeron_epoch_shared_participant_init(aeron_epoch_shared_participant_t *participant);
+
+int aeron_epoch_reclaimer_add_shared_participant(
+    aeron_epoch_reclaimer_t *reclaimer, aeron_epoch_shared_participant_t *participant);
+
+void aeron_epoch_reclaimer_remove_shared_participant(
+    aeron_epoch_reclaimer_t *reclaimer, aeron_epoch_shared_participant_t *participant);
+
+/*
+ * Ensure the next count retirements will not need to allocate, so they can follow the unlink of an item without
+ * failing.
+ */
+int aeron_epoch_reclaimer_reserve(aeron_epoch_reclaimer_t *reclaimer, size_t count);
+
+/*
+ * Retire an item that has been unlinked so readers can no longer find it. reclaim_func is called with it once no
+ * reader can still hold it, which may be at once. A batch of retired items is reclaimed when it fills.
+ */
+void aeron_epoch_reclaimer_retire(
+    aeron_epoch_reclaimer_t *reclaimer, void *item, aeron_epoch_reclaimer_reclaim_func_t reclaim_func, void *clientd);
+
+/*
+ * Reclaim the retired items no reader can still hold, returning the number reclaimed.
+ */
+int aeron_epoch_reclaimer_reclaim(aeron_epoch_reclaimer_t *reclaimer);
+
+void aeron_epoch_reclaimer_free_item(void *clientd, void *item);
+
+inline void aeron_epoch_participant_enter(aeron_epoch_participant_t *participant)
+{
+    aeron_epoch_reclaimer_t *reclaimer = participant->reclaimer;
+
+    if (0 == participant->depth++ && NULL != reclaimer)
+    {
+        int64_t epoch;
+
+        AERON_GET_VOLATILE(epoch, reclaimer->global_epoch);
+        AERON_PUT_VOLATILE(participant->epoch, epoch);
+    }
+}
+
+inline void aeron_epoch_participant_exit(aeron_epoch_participant_t *participant)
+{
+    if (0 == --participant->depth)
+    {
+        AERON_PUT_ORDERED(participant->epoch, AERON_EPOCH_RECLAIMER_QUIESCENT);
+    }
+}
+
+/*
+ * Claim a slot of a shared participant at the current epoch, waiting while every slot is held by another read. The
+ * slot returned is passed to exit.
+ */
+inline aeron_epoch_participant_t *aeron_epoch_shared_participant_enter(aeron_epoch_shared_participant_t *participant)
+{
+    while (true)
+    {
+        for (size_t i = 0; i < AERON_EPOCH_SHARED_PARTICIPANT_SLOTS; i++)
+        {
+            aeron_epoch_participant_t *slot = &participant->slots[i];
+            aeron_epoch_reclaimer_t *reclaimer = slot->reclaimer;
+            int64_t epoch = 0;
+
+            if (NULL != reclaimer)
+            {
+                AERON_GET_VOLATILE(epoch, reclaimer->global_epoch);
+            }
+
+            if (AERON_EPOCH_RECLAIMER_QUIESCENT == slot->epoch &&
+                aeron_cmpxchg64(&slot->epoch, AERON_EPOCH_RECLAIMER_QUIESCENT, epoch))
+            {
+                return slot;
+            }
+        }
+
+        proc_yield();
+    }
+}
+
+inline void aeron_epoch_shared_participant_exit(aeron_epoch_participant_t *slot)
+{
+    AERON_PUT_ORDERED(slot->epoch, AERON_EPOCH_RECLAIMER_QUIESCENT);
+}
+
+#endif //AERON_EPOCH_RECLAIMER_H
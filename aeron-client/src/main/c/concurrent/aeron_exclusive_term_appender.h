@@ -23,6 +23,7 @@
 #include "aeronc.h"
 #include "util/aeron_fileutil.h"
 #include "util/aeron_error.h"
+#include "util/aeron_memcpy.h"
 
 #define AERON_EXCLUSIVE_TERM_APPENDER_FAILED (-2)
 
@@ -284,10 +285,11 @@ inline int32_t aeron_exclusive_term_appender_append_fragmented_message(
 
             aeron_exclusive_term_appender_header_write(
                 term_buffer, frame_offset, frame_length, term_id, session_id, stream_id);
-            memcpy(
+            aeron_memcpy_bulk(
                 term_buffer->addr + frame_offset + AERON_DATA_HEADER_LENGTH,
                 buffer + (length - remaining),
-                bytes_to_write);
+                bytes_to_write,
+                length);
 
             if (remaining <= max_payload_length)
             {
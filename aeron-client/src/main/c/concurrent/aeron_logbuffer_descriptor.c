@@ -14,9 +14,22 @@
  * limitations under the License.
  */
 
+#if defined(__linux__)
+#define _GNU_SOURCE
+#endif
+
 #include <errno.h>
 #include <inttypes.h>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
 #include "util/aeron_error.h"
+#include "concurrent/aeron_thread.h"
 #include "concurrent/aeron_logbuffer_descriptor.h"
 
 int aeron_logbuffer_check_term_length(uint64_t term_length)
@@ -83,6 +96,39 @@ int aeron_logbuffer_check_page_size(uint64_t page_size)
     return 0;
 }
 
+void aeron_logbuffer_wait_for_data_notification(
+    aeron_logbuffer_metadata_t *log_meta_data, int32_t expected_sequence, int64_t timeout_ns)
+{
+    if (timeout_ns <= 0)
+    {
+        return;
+    }
+
+#if defined(__linux__)
+    struct timespec timeout;
+    timeout.tv_sec = (time_t)(timeout_ns / 1000000000LL);
+    timeout.tv_nsec = (long)(timeout_ns % 1000000000LL);
+
+    syscall(
+        SYS_futex, &log_meta_data->data_notification_sequence, FUTEX_WAIT, expected_sequence, &timeout, NULL, 0);
+#else
+    int32_t sequence;
+    AERON_GET_VOLATILE(sequence, log_meta_data->data_notification_sequence);
+    if (sequence == expected_sequence)
+    {
+        aeron_nano_sleep((uint64_t)timeout_ns);
+    }
+#endif
+}
+
+void aeron_logbuffer_wake_data_waiters(aeron_logbuffer_metadata_t *log_meta_data)
+{
+#if defined(__linux__)
+    syscall(SYS_futex, &log_meta_data->data_notification_sequence, FUTEX_WAKE, INT32_MAX, NULL, NULL, 0);
+#endif
+}
+
+extern void aeron_logbuffer_notify_data(aeron_logbuffer_metadata_t *log_meta_data);
 extern uint64_t aeron_logbuffer_compute_log_length(uint64_t term_length, uint64_t page_size);
 extern int32_t aeron_logbuffer_term_offset(int64_t raw_tail, int32_t term_length);
 extern int32_t aeron_logbuffer_term_id(int64_t raw_tail);
@@ -111,3 +157,5 @@ extern bool aeron_logbuffer_rotate_log(
 extern void aeron_logbuffer_fill_default_header(
     uint8_t *log_meta_data_buffer, int32_t session_id, int32_t stream_id, int32_t initial_term_id);
 extern void aeron_logbuffer_apply_default_header(uint8_t *log_meta_data_buffer, uint8_t *buffer);
+extern int32_t aeron_logbuffer_prefetch_ahead(
+    const uint8_t *term_buffer, int32_t offset, int32_t prefetch_offset, int32_t limit_offset);
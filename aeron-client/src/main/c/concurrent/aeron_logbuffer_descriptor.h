@@ -21,6 +21,7 @@
 #include <string.h>
 #include "protocol/aeron_udp_protocol.h"
 #include "util/aeron_bitutil.h"
+#include "util/aeron_platform.h"
 #include "concurrent/aeron_atomic.h"
 
 #define AERON_LOGBUFFER_PARTITION_COUNT (3)
@@ -32,6 +33,14 @@
 
 #define AERON_MAX_UDP_PAYLOAD_LENGTH (65504)
 
+/*
+ * Cache lines ahead of the current frame that image poll loops prefetch, 0 disables it. Lines not yet written by the
+ * receiver are invalidated again when it writes them, so measure before enabling for a stream.
+ */
+#ifndef AERON_LOGBUFFER_READ_PREFETCH_LINES
+#define AERON_LOGBUFFER_READ_PREFETCH_LINES (0)
+#endif
+
 #pragma pack(push)
 #pragma pack(4)
 typedef struct aeron_logbuffer_metadata_stct
@@ -42,7 +51,9 @@ typedef struct aeron_logbuffer_metadata_stct
     int64_t end_of_stream_position;
     int32_t is_connected;
     int32_t active_transport_count;
-    uint8_t pad2[(2 * AERON_CACHE_LINE_LENGTH) - (sizeof(int64_t) + (2 * sizeof(int32_t)))];
+    int32_t data_notification_sequence;
+    int32_t data_waiter_count;
+    uint8_t pad2[(2 * AERON_CACHE_LINE_LENGTH) - (sizeof(int64_t) + (4 * sizeof(int32_t)))];
     int64_t correlation_id;
     int32_t initial_term_id;
     int32_t default_frame_header_length;
@@ -59,6 +70,8 @@ aeron_logbuffer_metadata_t;
 
 #define AERON_LOGBUFFER_FRAME_ALIGNMENT (32)
 
+#define AERON_LOGBUFFER_DATA_WAIT_SLICE_NS (1000 * 1000LL)
+
 #define AERON_LOGBUFFER_RAWTAIL_VOLATILE(d,m) \
 do \
 { \
@@ -73,6 +86,30 @@ while(false)
 int aeron_logbuffer_check_term_length(uint64_t term_length);
 int aeron_logbuffer_check_page_size(uint64_t page_size);
 
+/*
+ * Block until the data notification sequence moves on from the expected value or the timeout expires. Spurious
+ * returns are possible so callers must re-check for data.
+ */
+void aeron_logbuffer_wait_for_data_notification(
+    aeron_logbuffer_metadata_t *log_meta_data, int32_t expected_sequence, int64_t timeout_ns);
+void aeron_logbuffer_wake_data_waiters(aeron_logbuffer_metadata_t *log_meta_data);
+
+/*
+ * Called by writers after committing to the log. Costs a single volatile read unless a subscriber is waiting.
+ */
+inline void aeron_logbuffer_notify_data(aeron_logbuffer_metadata_t *log_meta_data)
+{
+    int32_t data_waiter_count;
+    AERON_GET_VOLATILE(data_waiter_count, log_meta_data->data_waiter_count);
+
+    if (data_waiter_count > 0)
+    {
+        int32_t original;
+        AERON_GET_AND_ADD_INT32(original, log_meta_data->data_notification_sequence, 1);
+        aeron_logbuffer_wake_data_waiters(log_meta_data);
+    }
+}
+
 inline uint64_t aeron_logbuffer_compute_log_length(uint64_t term_length, uint64_t page_size)
 {
     return AERON_ALIGN(((term_length * AERON_LOGBUFFER_PARTITION_COUNT) + AERON_LOGBUFFER_META_DATA_LENGTH), page_size);
@@ -207,4 +244,20 @@ inline void aeron_logbuffer_apply_default_header(uint8_t *log_meta_data_buffer,
     memcpy(buffer, default_header, (size_t)log_meta_data->default_frame_header_length);
 }
 
+inline int32_t aeron_logbuffer_prefetch_ahead(
+    const uint8_t *term_buffer, int32_t offset, int32_t prefetch_offset, int32_t limit_offset)
+{
+#if AERON_LOGBUFFER_READ_PREFETCH_LINES > 0
+    const int32_t prefetch_limit = offset + (AERON_LOGBUFFER_READ_PREFETCH_LINES * AERON_CACHE_LINE_LENGTH);
+    const int32_t end_offset = prefetch_limit < limit_offset ? prefetch_limit : limit_offset;
+
+    for (; prefetch_offset < end_offset; prefetch_offset += AERON_CACHE_LINE_LENGTH)
+    {
+        AERON_PREFETCH(term_buffer + prefetch_offset);
+    }
+#endif
+
+    return prefetch_offset;
+}
+
 #endif //AERON_LOGBUFFER_DESCRIPTOR_H
@@ -36,6 +36,8 @@ int aeron_mpsc_concurrent_array_queue_init(
     queue->producer.shared_head_cache = 0;
     queue->producer.tail = 0;
     queue->consumer.head = 0;
+    queue->space_notification.sequence = 0;
+    queue->space_notification.waiter_count = 0;
     queue->capacity = length;
     queue->mask = length - 1;
 
@@ -48,10 +50,30 @@ int aeron_mpsc_concurrent_array_queue_close(aeron_mpsc_concurrent_array_queue_t
     return 0;
 }
 
+void aeron_mpsc_concurrent_array_queue_wait_for_space(volatile aeron_mpsc_concurrent_array_queue_t *queue, int64_t timeout_ns)
+{
+    int32_t sequence, original;
+
+    AERON_GET_VOLATILE(sequence, queue->space_notification.sequence);
+    AERON_GET_AND_ADD_INT32(original, queue->space_notification.waiter_count, 1);
+
+    if (aeron_mpsc_concurrent_array_queue_size(queue) >= queue->capacity)
+    {
+        aeron_wait_on_address(&queue->space_notification.sequence, sequence, timeout_ns);
+    }
+
+    AERON_GET_AND_ADD_INT32(original, queue->space_notification.waiter_count, -1);
+}
+
 extern aeron_queue_offer_result_t aeron_mpsc_concurrent_array_queue_offer(
     volatile aeron_mpsc_concurrent_array_queue_t *queue,
     void *element);
 
+extern uint64_t aeron_mpsc_concurrent_array_queue_offer_bulk(
+    volatile aeron_mpsc_concurrent_array_queue_t *queue, void **elements, uint64_t length);
+
+extern void aeron_mpsc_concurrent_array_queue_notify_space(volatile aeron_mpsc_concurrent_array_queue_t *queue);
+
 extern uint64_t aeron_mpsc_concurrent_array_queue_drain(
     volatile aeron_mpsc_concurrent_array_queue_t *queue,
     aeron_queue_drain_func_t func,
@@ -19,6 +19,7 @@
 #include "util/aeron_bitutil.h"
 #include "aeron_atomic.h"
 #include "aeron_concurrent_array_queue.h"
+#include "aeron_thread.h"
 
 typedef struct aeron_mpsc_concurrent_array_queue_stct
 {
@@ -39,6 +40,14 @@ typedef struct aeron_mpsc_concurrent_array_queue_stct
     }
     consumer;
 
+    struct
+    {
+        int32_t sequence;
+        int32_t waiter_count;
+        int8_t padding[AERON_CACHE_LINE_LENGTH - (2 * sizeof(int32_t))];
+    }
+    space_notification;
+
     uint64_t capacity;
     uint64_t mask;
     volatile void **buffer;
@@ -87,6 +96,76 @@ inline aeron_queue_offer_result_t aeron_mpsc_concurrent_array_queue_offer(
     return AERON_OFFER_SUCCESS;
 }
 
+/*
+ * Offer up to length elements, stopping at the first NULL, returning how many were added. The slots are claimed
+ * together so the elements stay contiguous with respect to other producers.
+ */
+inline uint64_t aeron_mpsc_concurrent_array_queue_offer_bulk(
+    volatile aeron_mpsc_concurrent_array_queue_t *queue, void **elements, uint64_t length)
+{
+    uint64_t count = 0;
+    while (count < length && NULL != elements[count])
+    {
+        count++;
+    }
+
+    if (0 == count)
+    {
+        return 0;
+    }
+
+    uint64_t current_head;
+    AERON_GET_VOLATILE(current_head, queue->producer.shared_head_cache);
+    uint64_t current_tail;
+    uint64_t claimed;
+
+    do
+    {
+        AERON_GET_VOLATILE(current_tail, queue->producer.tail);
+        int64_t available = (int64_t)(current_head + queue->capacity - current_tail);
+
+        if (available < (int64_t)count)
+        {
+            AERON_GET_VOLATILE(current_head, queue->consumer.head);
+            AERON_PUT_ORDERED(queue->producer.shared_head_cache, current_head);
+            available = (int64_t)(current_head + queue->capacity - current_tail);
+
+            if (available <= 0)
+            {
+                return 0;
+            }
+        }
+
+        claimed = available < (int64_t)count ? (uint64_t)available : count;
+    }
+    while (!aeron_cmpxchgu64(&queue->producer.tail, current_tail, current_tail + claimed));
+
+    for (uint64_t i = 0; i < claimed; i++)
+    {
+        AERON_PUT_ORDERED(queue->buffer[(current_tail + i) & queue->mask], elements[i]);
+    }
+
+    return claimed;
+}
+
+inline void aeron_mpsc_concurrent_array_queue_notify_space(volatile aeron_mpsc_concurrent_array_queue_t *queue)
+{
+    int32_t waiter_count;
+    AERON_GET_VOLATILE(waiter_count, queue->space_notification.waiter_count);
+
+    if (waiter_count > 0)
+    {
+        int32_t original;
+        AERON_GET_AND_ADD_INT32(original, queue->space_notification.sequence, 1);
+        aeron_wake_by_address_all(&queue->space_notification.sequence);
+    }
+}
+
+/*
+ * Block a producer that found the queue full until the consumer drains it or timeout_ns passes.
+ */
+void aeron_mpsc_concurrent_array_queue_wait_for_space(volatile aeron_mpsc_concurrent_array_queue_t *queue, int64_t timeout_ns);
+
 inline uint64_t aeron_mpsc_concurrent_array_queue_drain(
     volatile aeron_mpsc_concurrent_array_queue_t *queue,
     aeron_queue_drain_func_t func,
@@ -114,6 +193,11 @@ inline uint64_t aeron_mpsc_concurrent_array_queue_drain(
         func(clientd, item);
     }
 
+    if (next_sequence != current_head)
+    {
+        aeron_mpsc_concurrent_array_queue_notify_space(queue);
+    }
+
     return next_sequence - current_head;
 }
 
@@ -142,6 +142,61 @@ aeron_rb_write_result_t aeron_mpsc_rb_write(
     return result;
 }
 
+int32_t aeron_mpsc_rb_try_claim(volatile aeron_mpsc_rb_t *ring_buffer, int32_t msg_type_id, size_t length)
+{
+    const size_t record_length = length + AERON_RB_RECORD_HEADER_LENGTH;
+    const size_t required_capacity = AERON_ALIGN(record_length, AERON_RB_ALIGNMENT);
+
+    if (length > ring_buffer->max_message_length || AERON_RB_INVALID_MSG_TYPE_ID(msg_type_id))
+    {
+        return AERON_RB_ERROR;
+    }
+
+    int32_t record_index = aeron_mpsc_rb_claim_capacity(ring_buffer, required_capacity);
+
+    if (-1 == record_index)
+    {
+        return AERON_RB_FULL;
+    }
+
+    aeron_rb_record_descriptor_t *record_header = (aeron_rb_record_descriptor_t *)(ring_buffer->buffer + record_index);
+    record_header->msg_type_id = msg_type_id;
+    AERON_PUT_ORDERED(record_header->length, -(int32_t)record_length);
+
+    return (int32_t)AERON_RB_MESSAGE_OFFSET(record_index);
+}
+
+aeron_rb_write_result_t aeron_mpsc_rb_commit(volatile aeron_mpsc_rb_t *ring_buffer, int32_t index)
+{
+    aeron_rb_record_descriptor_t *record_header = aeron_rb_claimed_record_header(
+        ring_buffer->buffer, ring_buffer->capacity, index);
+
+    if (NULL == record_header)
+    {
+        return AERON_RB_ERROR;
+    }
+
+    AERON_PUT_ORDERED(record_header->length, -record_header->length);
+
+    return AERON_RB_SUCCESS;
+}
+
+aeron_rb_write_result_t aeron_mpsc_rb_abort(volatile aeron_mpsc_rb_t *ring_buffer, int32_t index)
+{
+    aeron_rb_record_descriptor_t *record_header = aeron_rb_claimed_record_header(
+        ring_buffer->buffer, ring_buffer->capacity, index);
+
+    if (NULL == record_header)
+    {
+        return AERON_RB_ERROR;
+    }
+
+    record_header->msg_type_id = AERON_RB_PADDING_MSG_TYPE_ID;
+    AERON_PUT_ORDERED(record_header->length, -record_header->length);
+
+    return AERON_RB_SUCCESS;
+}
+
 size_t aeron_mpsc_rb_read(
     volatile aeron_mpsc_rb_t *ring_buffer,
     aeron_rb_handler_t handler,
@@ -293,3 +348,4 @@ bool aeron_mpsc_rb_unblock(volatile aeron_mpsc_rb_t *ring_buffer)
 
 extern int64_t aeron_mpsc_rb_consumer_position(volatile aeron_mpsc_rb_t *ring_buffer);
 extern int64_t aeron_mpsc_rb_producer_position(volatile aeron_mpsc_rb_t *ring_buffer);
+extern aeron_rb_record_descriptor_t *aeron_rb_claimed_record_header(uint8_t *buffer, size_t capacity, int32_t index);
@@ -36,6 +36,17 @@ aeron_rb_write_result_t aeron_mpsc_rb_write(
     const void *msg,
     size_t length);
 
+/*
+ * Claim space for a message of length bytes so it can be encoded in place at ring_buffer->buffer + index, where index
+ * is the return value. The consumer is blocked on the record until it is published with aeron_mpsc_rb_commit or
+ * discarded with aeron_mpsc_rb_abort. Returns AERON_RB_FULL or AERON_RB_ERROR when no space is claimed.
+ */
+int32_t aeron_mpsc_rb_try_claim(volatile aeron_mpsc_rb_t *ring_buffer, int32_t msg_type_id, size_t length);
+
+aeron_rb_write_result_t aeron_mpsc_rb_commit(volatile aeron_mpsc_rb_t *ring_buffer, int32_t index);
+
+aeron_rb_write_result_t aeron_mpsc_rb_abort(volatile aeron_mpsc_rb_t *ring_buffer, int32_t index);
+
 size_t aeron_mpsc_rb_read(
     volatile aeron_mpsc_rb_t *ring_buffer,
     aeron_rb_handler_t handler,
@@ -70,4 +70,21 @@ typedef void (*aeron_rb_handler_t)(int32_t, const void *, size_t, void *);
 
 #define AERON_RB_IS_CAPACITY_VALID(capacity) AERON_IS_POWER_OF_TWO(capacity)
 
+/*
+ * Header of a record claimed at message index but not yet committed or aborted, or NULL if there is none.
+ */
+inline aeron_rb_record_descriptor_t *aeron_rb_claimed_record_header(uint8_t *buffer, size_t capacity, int32_t index)
+{
+    const int64_t record_index = (int64_t)index - (int64_t)AERON_RB_RECORD_HEADER_LENGTH;
+
+    if (record_index < 0 || record_index > (int64_t)(capacity - AERON_RB_RECORD_HEADER_LENGTH))
+    {
+        return NULL;
+    }
+
+    aeron_rb_record_descriptor_t *record_header = (aeron_rb_record_descriptor_t *)(buffer + record_index);
+
+    return record_header->length < 0 ? record_header : NULL;
+}
+
 #endif //AERON_RB_H
@@ -19,6 +19,7 @@
 #include "util/aeron_bitutil.h"
 #include "aeron_atomic.h"
 #include "aeron_concurrent_array_queue.h"
+#include "aeron_thread.h"
 
 typedef struct aeron_spsc_concurrent_array_queue_stct
 {
@@ -38,6 +39,14 @@ typedef struct aeron_spsc_concurrent_array_queue_stct
     }
     consumer;
 
+    struct
+    {
+        int32_t sequence;
+        int32_t waiter_count;
+        int8_t padding[AERON_CACHE_LINE_LENGTH - (2 * sizeof(int32_t))];
+    }
+    space_notification;
+
     uint64_t capacity;
     uint64_t mask;
     volatile void **buffer;
@@ -99,6 +108,56 @@ inline volatile void *aeron_spsc_concurrent_array_queue_poll(volatile aeron_spsc
     return item;
 }
 
+/*
+ * Offer up to length elements, stopping at the first NULL, returning how many were added. Each becomes visible to
+ * the consumer in order as it is stored.
+ */
+inline uint64_t aeron_spsc_concurrent_array_queue_offer_bulk(
+    volatile aeron_spsc_concurrent_array_queue_t *queue, void **elements, uint64_t length)
+{
+    uint64_t current_tail = queue->producer.tail;
+    uint64_t available = queue->producer.head_cache + queue->capacity - current_tail;
+
+    if (available < length)
+    {
+        uint64_t current_head;
+        AERON_GET_VOLATILE(current_head, queue->consumer.head);
+        queue->producer.head_cache = current_head;
+        available = current_head + queue->capacity - current_tail;
+    }
+
+    uint64_t count = 0;
+    const uint64_t limit = available < length ? available : length;
+
+    while (count < limit && NULL != elements[count])
+    {
+        AERON_PUT_ORDERED(queue->buffer[(current_tail + count) & queue->mask], elements[count]);
+        count++;
+    }
+
+    AERON_PUT_ORDERED(queue->producer.tail, current_tail + count);
+
+    return count;
+}
+
+inline void aeron_spsc_concurrent_array_queue_notify_space(volatile aeron_spsc_concurrent_array_queue_t *queue)
+{
+    int32_t waiter_count;
+    AERON_GET_VOLATILE(waiter_count, queue->space_notification.waiter_count);
+
+    if (waiter_count > 0)
+    {
+        int32_t original;
+        AERON_GET_AND_ADD_INT32(original, queue->space_notification.sequence, 1);
+        aeron_wake_by_address_all(&queue->space_notification.sequence);
+    }
+}
+
+/*
+ * Block a producer that found the queue full until the consumer drains it or timeout_ns passes.
+ */
+void aeron_spsc_concurrent_array_queue_wait_for_space(volatile aeron_spsc_concurrent_array_queue_t *queue, int64_t timeout_ns);
+
 inline uint64_t aeron_spsc_concurrent_array_queue_drain(
     volatile aeron_spsc_concurrent_array_queue_t *queue,
     aeron_queue_drain_func_t func,
@@ -126,6 +185,11 @@ inline uint64_t aeron_spsc_concurrent_array_queue_drain(
         func(clientd, item);
     }
 
+    if (next_sequence != current_head)
+    {
+        aeron_spsc_concurrent_array_queue_notify_space(queue);
+    }
+
     return next_sequence - current_head;
 }
 
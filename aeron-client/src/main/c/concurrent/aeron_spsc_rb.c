@@ -46,20 +46,9 @@ aeron_rb_write_result_t aeron_spsc_rb_write(
     return aeron_spsc_rb_writev(ring_buffer, msg_type_id, vec, 1);
 }
 
-aeron_rb_write_result_t aeron_spsc_rb_writev(
-    volatile aeron_spsc_rb_t *ring_buffer,
-    int32_t msg_type_id,
-    const struct iovec* iov,
-    int iovcnt)
+inline static int32_t aeron_spsc_rb_claim_capacity(
+    volatile aeron_spsc_rb_t *ring_buffer, size_t aligned_record_length, int64_t *new_tail)
 {
-    size_t length = 0;
-    for (int i = 0; i < iovcnt; i++)
-    {
-        length += iov[i].iov_len;
-    }
-
-    const size_t record_length = length + AERON_RB_RECORD_HEADER_LENGTH;
-    const size_t aligned_record_length = AERON_ALIGN(record_length, AERON_RB_ALIGNMENT);
     const size_t required_capacity = aligned_record_length + AERON_RB_RECORD_HEADER_LENGTH;
     const size_t mask = ring_buffer->capacity - 1;
 
@@ -70,12 +59,6 @@ aeron_rb_write_result_t aeron_spsc_rb_writev(
     size_t padding = 0;
     size_t record_index = (size_t)tail & mask;
     const size_t to_buffer_end_length = ring_buffer->capacity - record_index;
-    aeron_rb_record_descriptor_t *record_header = NULL, *next_header = NULL;
-
-    if (length > ring_buffer->max_message_length || AERON_RB_INVALID_MSG_TYPE_ID(msg_type_id))
-    {
-        return AERON_RB_ERROR;
-    }
 
     if ((int32_t)required_capacity > available_capacity)
     {
@@ -83,7 +66,7 @@ aeron_rb_write_result_t aeron_spsc_rb_writev(
 
         if (required_capacity > (ring_buffer->capacity - (size_t)(tail - head)))
         {
-            return AERON_RB_FULL;
+            return -1;
         }
 
         ring_buffer->descriptor->head_cache_position = head;
@@ -100,7 +83,7 @@ aeron_rb_write_result_t aeron_spsc_rb_writev(
 
             if (required_capacity > head_index)
             {
-                return AERON_RB_FULL;
+                return -1;
             }
 
             AERON_PUT_ORDERED(ring_buffer->descriptor->head_cache_position, head);
@@ -111,8 +94,9 @@ aeron_rb_write_result_t aeron_spsc_rb_writev(
 
     if (0 != padding)
     {
-        record_header = (aeron_rb_record_descriptor_t *)(ring_buffer->buffer + record_index);
-        next_header = (aeron_rb_record_descriptor_t *)ring_buffer->buffer;
+        aeron_rb_record_descriptor_t *record_header =
+            (aeron_rb_record_descriptor_t *)(ring_buffer->buffer + record_index);
+        aeron_rb_record_descriptor_t *next_header = (aeron_rb_record_descriptor_t *)ring_buffer->buffer;
 
         next_header->length = 0;
         record_header->msg_type_id = AERON_RB_PADDING_MSG_TYPE_ID;
@@ -120,8 +104,44 @@ aeron_rb_write_result_t aeron_spsc_rb_writev(
         record_index = 0;
     }
 
-    record_header = (aeron_rb_record_descriptor_t *)(ring_buffer->buffer + record_index);
-    next_header = (aeron_rb_record_descriptor_t *)(ring_buffer->buffer + record_index + aligned_record_length);
+    aeron_rb_record_descriptor_t *next_header =
+        (aeron_rb_record_descriptor_t *)(ring_buffer->buffer + record_index + aligned_record_length);
+    next_header->length = 0;
+
+    *new_tail = tail + (int64_t)aligned_record_length + (int64_t)padding;
+
+    return (int32_t)record_index;
+}
+
+aeron_rb_write_result_t aeron_spsc_rb_writev(
+    volatile aeron_spsc_rb_t *ring_buffer,
+    int32_t msg_type_id,
+    const struct iovec* iov,
+    int iovcnt)
+{
+    size_t length = 0;
+    for (int i = 0; i < iovcnt; i++)
+    {
+        length += iov[i].iov_len;
+    }
+
+    const size_t record_length = length + AERON_RB_RECORD_HEADER_LENGTH;
+    const size_t aligned_record_length = AERON_ALIGN(record_length, AERON_RB_ALIGNMENT);
+    int64_t new_tail = 0;
+
+    if (length > ring_buffer->max_message_length || AERON_RB_INVALID_MSG_TYPE_ID(msg_type_id))
+    {
+        return AERON_RB_ERROR;
+    }
+
+    int32_t record_index = aeron_spsc_rb_claim_capacity(ring_buffer, aligned_record_length, &new_tail);
+
+    if (-1 == record_index)
+    {
+        return AERON_RB_FULL;
+    }
+
+    aeron_rb_record_descriptor_t *record_header = (aeron_rb_record_descriptor_t *)(ring_buffer->buffer + record_index);
 
     size_t current_vector_offset = 0;
     for (int i = 0; i < iovcnt; i++)
@@ -131,14 +151,69 @@ aeron_rb_write_result_t aeron_spsc_rb_writev(
         current_vector_offset += iov[i].iov_len;
     }
 
-    next_header->length = 0;
     record_header->msg_type_id = msg_type_id;
     AERON_PUT_ORDERED(record_header->length, (int32_t)record_length);
-    AERON_PUT_ORDERED(ring_buffer->descriptor->tail_position, tail + aligned_record_length + padding);
+    AERON_PUT_ORDERED(ring_buffer->descriptor->tail_position, new_tail);
+
+    return AERON_RB_SUCCESS;
+}
+
+int32_t aeron_spsc_rb_try_claim(volatile aeron_spsc_rb_t *ring_buffer, int32_t msg_type_id, size_t length)
+{
+    const size_t record_length = length + AERON_RB_RECORD_HEADER_LENGTH;
+    const size_t aligned_record_length = AERON_ALIGN(record_length, AERON_RB_ALIGNMENT);
+    int64_t new_tail = 0;
+
+    if (length > ring_buffer->max_message_length || AERON_RB_INVALID_MSG_TYPE_ID(msg_type_id))
+    {
+        return AERON_RB_ERROR;
+    }
+
+    int32_t record_index = aeron_spsc_rb_claim_capacity(ring_buffer, aligned_record_length, &new_tail);
+
+    if (-1 == record_index)
+    {
+        return AERON_RB_FULL;
+    }
+
+    aeron_rb_record_descriptor_t *record_header = (aeron_rb_record_descriptor_t *)(ring_buffer->buffer + record_index);
+    record_header->msg_type_id = msg_type_id;
+    AERON_PUT_ORDERED(record_header->length, -(int32_t)record_length);
+    AERON_PUT_ORDERED(ring_buffer->descriptor->tail_position, new_tail);
+
+    return (int32_t)AERON_RB_MESSAGE_OFFSET(record_index);
+}
+
+aeron_rb_write_result_t aeron_spsc_rb_commit(volatile aeron_spsc_rb_t *ring_buffer, int32_t index)
+{
+    aeron_rb_record_descriptor_t *record_header = aeron_rb_claimed_record_header(
+        ring_buffer->buffer, ring_buffer->capacity, index);
+
+    if (NULL == record_header)
+    {
+        return AERON_RB_ERROR;
+    }
+
+    AERON_PUT_ORDERED(record_header->length, -record_header->length);
 
     return AERON_RB_SUCCESS;
 }
 
+aeron_rb_write_result_t aeron_spsc_rb_abort(volatile aeron_spsc_rb_t *ring_buffer, int32_t index)
+{
+    aeron_rb_record_descriptor_t *record_header = aeron_rb_claimed_record_header(
+        ring_buffer->buffer, ring_buffer->capacity, index);
+
+    if (NULL == record_header)
+    {
+        return AERON_RB_ERROR;
+    }
+
+    record_header->msg_type_id = AERON_RB_PADDING_MSG_TYPE_ID;
+    AERON_PUT_ORDERED(record_header->length, -record_header->length);
+
+    return AERON_RB_SUCCESS;
+}
 
 size_t aeron_spsc_rb_read(
     volatile aeron_spsc_rb_t *ring_buffer,
@@ -46,6 +46,16 @@ extern int32_t aeron_term_appender_claim(
     int32_t session_id,
     int32_t stream_id);
 
+extern int32_t aeron_term_appender_claim_fragmented(
+    aeron_mapped_buffer_t *term_buffer,
+    volatile int64_t *term_tail_counter,
+    size_t length,
+    size_t max_payload_length,
+    aeron_buffer_claim_t *buffer_claims,
+    int32_t active_term_id,
+    int32_t session_id,
+    int32_t stream_id);
+
 extern int32_t aeron_term_appender_append_unfragmented_message(
     aeron_mapped_buffer_t *term_buffer,
     volatile int64_t *term_tail_counter,
@@ -69,6 +79,28 @@ extern int32_t aeron_term_appender_append_unfragmented_messagev(
     int32_t session_id,
     int32_t stream_id);
 
+extern int32_t aeron_term_appender_append_unfragmented_batch(
+    aeron_mapped_buffer_t *term_buffer,
+    volatile int64_t *term_tail_counter,
+    aeron_iovec_t *messages,
+    size_t count,
+    size_t batch_length,
+    size_t *appended_count,
+    aeron_reserved_value_supplier_t reserved_value_supplier,
+    void *clientd,
+    int32_t active_term_id,
+    int32_t session_id,
+    int32_t stream_id);
+
+extern int32_t aeron_term_appender_append_block(
+    aeron_mapped_buffer_t *term_buffer,
+    volatile int64_t *term_tail_counter,
+    const uint8_t *buffer,
+    size_t length,
+    int32_t active_term_id,
+    int32_t session_id,
+    int32_t stream_id);
+
 extern int32_t aeron_term_appender_append_fragmented_message(
     aeron_mapped_buffer_t *term_buffer,
     volatile int64_t *term_tail_counter,
@@ -23,6 +23,7 @@
 #include "aeronc.h"
 #include "util/aeron_fileutil.h"
 #include "util/aeron_error.h"
+#include "util/aeron_memcpy.h"
 
 #define AERON_TERM_APPENDER_FAILED (-2)
 
@@ -134,6 +135,80 @@ inline int32_t aeron_term_appender_claim(
     return (int32_t)resulting_offset;
 }
 
+/*
+ * Claim the frames for a message that is fragmented over max payload length sized frames, filling in one buffer claim
+ * per fragment. Each fragment must then be committed, or all of them aborted, to make the range available.
+ */
+inline int32_t aeron_term_appender_claim_fragmented(
+    aeron_mapped_buffer_t *term_buffer,
+    volatile int64_t *term_tail_counter,
+    size_t length,
+    size_t max_payload_length,
+    aeron_buffer_claim_t *buffer_claims,
+    int32_t active_term_id,
+    int32_t session_id,
+    int32_t stream_id)
+{
+    const size_t num_max_payloads = length / max_payload_length;
+    const size_t remaining_payload = length % max_payload_length;
+    const size_t last_frame_length = (remaining_payload > 0) ?
+        AERON_ALIGN(remaining_payload + AERON_DATA_HEADER_LENGTH, AERON_LOGBUFFER_FRAME_ALIGNMENT) : 0;
+    const size_t required_length =
+        (num_max_payloads * (max_payload_length + AERON_DATA_HEADER_LENGTH)) + last_frame_length;
+    const int64_t raw_tail = aeron_term_appender_get_and_add_raw_tail(term_tail_counter, required_length);
+    const int64_t term_offset = raw_tail & 0xFFFFFFFF;
+    const int32_t term_id = aeron_logbuffer_term_id(raw_tail);
+    const int32_t term_length = (int32_t)term_buffer->length;
+
+    if (aeron_term_appender_check_term(active_term_id, term_id) < 0)
+    {
+        return -1;
+    }
+
+    int64_t resulting_offset = term_offset + required_length;
+    if (resulting_offset > term_length)
+    {
+        resulting_offset = aeron_term_appender_handle_end_of_log_condition(
+            term_buffer, (int32_t)term_offset, term_length, term_id, session_id, stream_id);
+    }
+    else
+    {
+        uint8_t flags = AERON_DATA_HEADER_BEGIN_FLAG;
+        size_t remaining = length;
+        int32_t frame_offset = (int32_t)term_offset;
+        aeron_buffer_claim_t *buffer_claim = buffer_claims;
+
+        do
+        {
+            size_t bytes_to_write = remaining < max_payload_length ? remaining : max_payload_length;
+            size_t frame_length = bytes_to_write + AERON_DATA_HEADER_LENGTH;
+            size_t aligned_length = AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+
+            aeron_term_appender_header_write(term_buffer, frame_offset, frame_length, term_id, session_id, stream_id);
+
+            if (remaining <= max_payload_length)
+            {
+                flags |= AERON_DATA_HEADER_END_FLAG;
+            }
+
+            aeron_data_header_t *data_header = (aeron_data_header_t *)(term_buffer->addr + frame_offset);
+            data_header->frame_header.flags = flags;
+
+            buffer_claim->frame_header = term_buffer->addr + frame_offset;
+            buffer_claim->data = buffer_claim->frame_header + AERON_DATA_HEADER_LENGTH;
+            buffer_claim->length = bytes_to_write;
+
+            flags = 0;
+            frame_offset += (int32_t)aligned_length;
+            remaining -= bytes_to_write;
+            buffer_claim++;
+        }
+        while (remaining > 0);
+    }
+
+    return (int32_t)resulting_offset;
+}
+
 inline int32_t aeron_term_appender_append_unfragmented_message(
     aeron_mapped_buffer_t *term_buffer,
     volatile int64_t *term_tail_counter,
@@ -241,6 +316,134 @@ inline int32_t aeron_term_appender_append_unfragmented_messagev(
     return (int32_t)resulting_offset;
 }
 
+/*
+ * Append a batch of messages, one per iovec and each within the max payload length, with a single add to the term
+ * tail. If the batch runs past the end of the term the messages that fit are still committed, the rest of the term is
+ * padded and appended_count gives the index of the first message not appended.
+ */
+inline int32_t aeron_term_appender_append_unfragmented_batch(
+    aeron_mapped_buffer_t *term_buffer,
+    volatile int64_t *term_tail_counter,
+    aeron_iovec_t *messages,
+    size_t count,
+    size_t batch_length,
+    size_t *appended_count,
+    aeron_reserved_value_supplier_t reserved_value_supplier,
+    void *clientd,
+    int32_t active_term_id,
+    int32_t session_id,
+    int32_t stream_id)
+{
+    const int64_t raw_tail = aeron_term_appender_get_and_add_raw_tail(term_tail_counter, batch_length);
+    const int64_t term_offset = raw_tail & 0xFFFFFFFF;
+    const int32_t term_id = aeron_logbuffer_term_id(raw_tail);
+    const int32_t term_length = (int32_t)term_buffer->length;
+    int64_t frame_offset = term_offset;
+    size_t i = 0;
+
+    *appended_count = 0;
+
+    if (aeron_term_appender_check_term(active_term_id, term_id) < 0)
+    {
+        return -1;
+    }
+
+    for (; i < count; i++)
+    {
+        const size_t frame_length = messages[i].iov_len + AERON_DATA_HEADER_LENGTH;
+        const int64_t aligned_frame_length = AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+
+        if (frame_offset + aligned_frame_length > term_length)
+        {
+            break;
+        }
+
+        aeron_term_appender_header_write(
+            term_buffer, (int32_t)frame_offset, frame_length, term_id, session_id, stream_id);
+        memcpy(term_buffer->addr + frame_offset + AERON_DATA_HEADER_LENGTH, messages[i].iov_base, messages[i].iov_len);
+
+        aeron_data_header_t *data_header = (aeron_data_header_t *)(term_buffer->addr + frame_offset);
+
+        if (NULL != reserved_value_supplier)
+        {
+            data_header->reserved_value = reserved_value_supplier(
+                clientd, term_buffer->addr + frame_offset, frame_length);
+        }
+
+        AERON_PUT_ORDERED(data_header->frame_header.frame_length, (int32_t)frame_length);
+        frame_offset += aligned_frame_length;
+    }
+
+    *appended_count = i;
+
+    if (i < count)
+    {
+        return aeron_term_appender_handle_end_of_log_condition(
+            term_buffer, (int32_t)frame_offset, term_length, term_id, session_id, stream_id);
+    }
+
+    return (int32_t)frame_offset;
+}
+
+/*
+ * Append a block of pre-formatted frames, such as one captured with block poll, with a single add to the term tail.
+ * The frames are copied as is with their term_offset, term_id, session_id and stream_id rewritten for the claimed
+ * position, and the block is made visible by committing the length of its first frame last.
+ */
+inline int32_t aeron_term_appender_append_block(
+    aeron_mapped_buffer_t *term_buffer,
+    volatile int64_t *term_tail_counter,
+    const uint8_t *buffer,
+    size_t length,
+    int32_t active_term_id,
+    int32_t session_id,
+    int32_t stream_id)
+{
+    const int64_t raw_tail = aeron_term_appender_get_and_add_raw_tail(term_tail_counter, length);
+    const int64_t term_offset = raw_tail & 0xFFFFFFFF;
+    const int32_t term_id = aeron_logbuffer_term_id(raw_tail);
+    const int32_t term_length = (int32_t)term_buffer->length;
+    int64_t resulting_offset = term_offset + (int64_t)length;
+
+    if (aeron_term_appender_check_term(active_term_id, term_id) < 0)
+    {
+        return -1;
+    }
+
+    if (resulting_offset > term_length)
+    {
+        resulting_offset = aeron_term_appender_handle_end_of_log_condition(
+            term_buffer, (int32_t)term_offset, term_length, term_id, session_id, stream_id);
+    }
+    else
+    {
+        aeron_data_header_t *first_frame = (aeron_data_header_t *)(term_buffer->addr + term_offset);
+        const int32_t length_of_first_frame = ((aeron_frame_header_t *)buffer)->frame_length;
+        size_t block_offset = 0;
+
+        AERON_PUT_ORDERED(first_frame->frame_header.frame_length, -length_of_first_frame);
+        memcpy(
+            term_buffer->addr + term_offset + sizeof(int32_t), buffer + sizeof(int32_t), length - sizeof(int32_t));
+
+        while (block_offset < length)
+        {
+            aeron_data_header_t *data_header = (aeron_data_header_t *)(term_buffer->addr + term_offset + block_offset);
+            const int32_t frame_length = block_offset == 0 ?
+                length_of_first_frame : data_header->frame_header.frame_length;
+
+            data_header->term_offset = (int32_t)(term_offset + block_offset);
+            data_header->term_id = term_id;
+            data_header->session_id = session_id;
+            data_header->stream_id = stream_id;
+            block_offset += AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+        }
+
+        AERON_PUT_ORDERED(first_frame->frame_header.frame_length, length_of_first_frame);
+    }
+
+    return (int32_t)resulting_offset;
+}
+
 inline int32_t aeron_term_appender_append_fragmented_message(
     aeron_mapped_buffer_t *term_buffer,
     volatile int64_t *term_tail_counter,
@@ -288,10 +491,11 @@ inline int32_t aeron_term_appender_append_fragmented_message(
             size_t aligned_length = AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
 
             aeron_term_appender_header_write(term_buffer, frame_offset, frame_length, term_id, session_id, stream_id);
-            memcpy(
+            aeron_memcpy_bulk(
                 term_buffer->addr + frame_offset + AERON_DATA_HEADER_LENGTH,
                 buffer + (length - remaining),
-                bytes_to_write);
+                bytes_to_write,
+                length);
 
             if (remaining <= max_payload_length)
             {
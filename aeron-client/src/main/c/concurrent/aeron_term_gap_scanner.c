@@ -16,6 +16,8 @@
 
 #include "concurrent/aeron_term_gap_scanner.h"
 
+extern int aeron_term_gap_scanner_batch_mismatch(const uint8_t *buffer, size_t stride, int32_t expected);
+
 extern int32_t aeron_term_gap_scanner_scan_for_gap(
     const uint8_t *buffer,
     int32_t term_id,
@@ -21,9 +21,42 @@
 #include "util/aeron_bitutil.h"
 #include "aeron_logbuffer_descriptor.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 typedef void (*aeron_term_gap_scanner_on_gap_detected_func_t)(void *clientd, int32_t term_id, int32_t term_offset, size_t length);
 
 #define AERON_ALIGNED_HEADER_LENGTH (AERON_ALIGN(AERON_DATA_HEADER_LENGTH, AERON_LOGBUFFER_FRAME_ALIGNMENT))
+#define AERON_TERM_GAP_SCANNER_BATCH_FRAMES (4)
+
+/*
+ * Read the frame length words of AERON_TERM_GAP_SCANNER_BATCH_FRAMES slots at a fixed stride with independent loads
+ * and return the index of the first that differs from expected, or AERON_TERM_GAP_SCANNER_BATCH_FRAMES if all match.
+ */
+inline int aeron_term_gap_scanner_batch_mismatch(const uint8_t *buffer, size_t stride, int32_t expected)
+{
+    int mismatch_mask;
+
+#if defined(__AVX2__)
+    const __m128i offsets = _mm_set_epi32((int)(stride * 3), (int)(stride * 2), (int)stride, 0);
+    const __m128i lengths = _mm_i32gather_epi32((const int *)buffer, offsets, 1);
+    const __m128i matched = _mm_cmpeq_epi32(lengths, _mm_set1_epi32(expected));
+
+    mismatch_mask = ~_mm_movemask_ps(_mm_castsi128_ps(matched)) & 0xF;
+#else
+    const int32_t l0 = *(volatile int32_t *)(buffer);
+    const int32_t l1 = *(volatile int32_t *)(buffer + stride);
+    const int32_t l2 = *(volatile int32_t *)(buffer + (stride * 2));
+    const int32_t l3 = *(volatile int32_t *)(buffer + (stride * 3));
+
+    mismatch_mask = (l0 != expected) | ((l1 != expected) << 1) | ((l2 != expected) << 2) | ((l3 != expected) << 3);
+#endif
+
+    aeron_acquire();
+
+    return 0 == mismatch_mask ? AERON_TERM_GAP_SCANNER_BATCH_FRAMES : aeron_number_of_trailing_zeroes(mismatch_mask);
+}
 
 inline int32_t aeron_term_gap_scanner_scan_for_gap(
     const uint8_t *buffer,
@@ -46,7 +79,16 @@ inline int32_t aeron_term_gap_scanner_scan_for_gap(
             break;
         }
 
-        offset += AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+        const int32_t aligned_frame_length = AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+        const int32_t batch_length = aligned_frame_length * AERON_TERM_GAP_SCANNER_BATCH_FRAMES;
+        offset += aligned_frame_length;
+
+        while (offset <= limit_offset - batch_length &&
+            AERON_TERM_GAP_SCANNER_BATCH_FRAMES == aeron_term_gap_scanner_batch_mismatch(
+                buffer + offset, (size_t)aligned_frame_length, frame_length))
+        {
+            offset += batch_length;
+        }
     }
     while (offset < limit_offset);
 
@@ -54,6 +96,19 @@ inline int32_t aeron_term_gap_scanner_scan_for_gap(
     if (offset < limit_offset)
     {
         const int32_t limit = limit_offset - AERON_ALIGNED_HEADER_LENGTH;
+        const int32_t batch_length = AERON_LOGBUFFER_FRAME_ALIGNMENT * AERON_TERM_GAP_SCANNER_BATCH_FRAMES;
+        while (offset <= limit - batch_length)
+        {
+            const int index = aeron_term_gap_scanner_batch_mismatch(
+                buffer + offset + AERON_LOGBUFFER_FRAME_ALIGNMENT, AERON_LOGBUFFER_FRAME_ALIGNMENT, 0);
+
+            offset += AERON_LOGBUFFER_FRAME_ALIGNMENT * index;
+            if (AERON_TERM_GAP_SCANNER_BATCH_FRAMES != index)
+            {
+                break;
+            }
+        }
+
         while (offset < limit)
         {
             offset += AERON_LOGBUFFER_FRAME_ALIGNMENT;
@@ -17,3 +17,5 @@
 #include "concurrent/aeron_term_rebuilder.h"
 
 extern void aeron_term_rebuilder_insert(uint8_t *dest, const uint8_t *src, size_t length);
+
+extern void aeron_term_rebuilder_insert_header(uint8_t *dest, const uint8_t *header);
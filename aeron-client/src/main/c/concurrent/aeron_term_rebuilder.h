@@ -48,4 +48,24 @@ inline void aeron_term_rebuilder_insert(uint8_t *dest, const uint8_t *src, size_
     }
 }
 
+/*
+ * Insert a frame whose bytes following the header have already been received in place at dest, writing the header
+ * last so the frame becomes visible only once complete.
+ */
+inline void aeron_term_rebuilder_insert_header(uint8_t *dest, const uint8_t *header)
+{
+    aeron_data_header_t *hdr_dest = (aeron_data_header_t *)dest;
+    aeron_data_header_as_longs_t *dest_hdr_as_longs = (aeron_data_header_as_longs_t *)dest;
+    aeron_data_header_as_longs_t *src_hdr_as_longs = (aeron_data_header_as_longs_t *)header;
+
+    if (0 == hdr_dest->frame_header.frame_length)
+    {
+        dest_hdr_as_longs->hdr[3] = src_hdr_as_longs->hdr[3];
+        dest_hdr_as_longs->hdr[2] = src_hdr_as_longs->hdr[2];
+        dest_hdr_as_longs->hdr[1] = src_hdr_as_longs->hdr[1];
+
+        AERON_PUT_ORDERED(dest_hdr_as_longs->hdr[0], src_hdr_as_longs->hdr[0]);
+    }
+}
+
 #endif //AERON_TERM_REBUILDER_H
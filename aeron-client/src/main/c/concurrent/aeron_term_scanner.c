@@ -16,5 +16,7 @@
 
 #include "concurrent/aeron_term_scanner.h"
 
+extern bool aeron_term_scanner_is_batch_available(const uint8_t *buffer, size_t stride, uint64_t expected);
+
 extern size_t aeron_term_scanner_scan_for_availability(
     const uint8_t *buffer, size_t term_length_left, size_t max_length, size_t *padding);
@@ -22,6 +22,48 @@
 #include "util/aeron_bitutil.h"
 #include "aeron_logbuffer_descriptor.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#define AERON_TERM_SCANNER_BATCH_FRAMES (4)
+#define AERON_TERM_SCANNER_HEADER_MASK (0xFFFF0000FFFFFFFFULL)
+
+/*
+ * Check the next AERON_TERM_SCANNER_BATCH_FRAMES frames at a fixed stride carry the same length and type as the
+ * expected header word, ignoring version and flags. Offsets are predicted from the previous frame so the header loads
+ * are independent rather than each depending on the length read before it.
+ */
+inline bool aeron_term_scanner_is_batch_available(const uint8_t *buffer, size_t stride, uint64_t expected)
+{
+    bool result;
+
+#if defined(__AVX2__)
+    const __m256i offsets = _mm256_set_epi64x(
+        (long long)(stride * 3), (long long)(stride * 2), (long long)stride, 0);
+    const __m256i words = _mm256_i64gather_epi64((const long long *)buffer, offsets, 1);
+    const __m256i masked = _mm256_and_si256(words, _mm256_set1_epi64x((long long)AERON_TERM_SCANNER_HEADER_MASK));
+    const __m256i matched = _mm256_cmpeq_epi64(masked, _mm256_set1_epi64x((long long)expected));
+
+    result = -1 == _mm256_movemask_epi8(matched);
+#else
+    const uint64_t w0 = *(volatile uint64_t *)(buffer);
+    const uint64_t w1 = *(volatile uint64_t *)(buffer + stride);
+    const uint64_t w2 = *(volatile uint64_t *)(buffer + (stride * 2));
+    const uint64_t w3 = *(volatile uint64_t *)(buffer + (stride * 3));
+
+    result = 0 == (
+        ((w0 & AERON_TERM_SCANNER_HEADER_MASK) ^ expected) |
+        ((w1 & AERON_TERM_SCANNER_HEADER_MASK) ^ expected) |
+        ((w2 & AERON_TERM_SCANNER_HEADER_MASK) ^ expected) |
+        ((w3 & AERON_TERM_SCANNER_HEADER_MASK) ^ expected));
+#endif
+
+    aeron_acquire();
+
+    return result;
+}
+
 inline size_t aeron_term_scanner_scan_for_availability(
     const uint8_t *buffer, size_t term_length_left, size_t max_length, size_t *padding)
 {
@@ -56,6 +98,19 @@ inline size_t aeron_term_scanner_scan_for_availability(
             *padding = 0;
             break;
         }
+
+        if (0 == *padding)
+        {
+            const size_t batch_length = (size_t)aligned_frame_length * AERON_TERM_SCANNER_BATCH_FRAMES;
+            const uint64_t expected =
+                ((uint64_t)(uint16_t)frame_header->type << 48u) | (uint64_t)(uint32_t)frame_length;
+
+            while (available + batch_length <= limit &&
+                aeron_term_scanner_is_batch_available(buffer + available, (size_t)aligned_frame_length, expected))
+            {
+                available += batch_length;
+            }
+        }
     }
     while (0 == *padding && available < limit);
 
@@ -21,8 +21,16 @@
 
 #include "aeron_alloc.h"
 #include "concurrent/aeron_thread.h"
+#include "concurrent/aeron_atomic.h"
+#include <errno.h>
+#include <stdlib.h>
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
 #if !defined(_WIN32)
 #include <unistd.h>
+#include <sched.h>
 #else
 #include <windows.h>
 
@@ -70,6 +78,36 @@ void aeron_nano_sleep(uint64_t nanoseconds)
 #endif
 }
 
+void aeron_wait_on_address(volatile int32_t *addr, int32_t expected, int64_t timeout_ns)
+{
+    if (timeout_ns <= 0)
+    {
+        return;
+    }
+
+#if defined(__linux__)
+    struct timespec timeout;
+    timeout.tv_sec = (time_t)(timeout_ns / SECOND_AS_NANOSECONDS);
+    timeout.tv_nsec = (long)(timeout_ns % SECOND_AS_NANOSECONDS);
+
+    syscall(SYS_futex, (int32_t *)addr, FUTEX_WAIT_PRIVATE, expected, &timeout, NULL, 0);
+#else
+    int32_t value;
+    AERON_GET_VOLATILE(value, *addr);
+    if (value == expected)
+    {
+        aeron_nano_sleep((uint64_t)timeout_ns);
+    }
+#endif
+}
+
+void aeron_wake_by_address_all(volatile int32_t *addr)
+{
+#if defined(__linux__)
+    syscall(SYS_futex, (int32_t *)addr, FUTEX_WAKE_PRIVATE, INT32_MAX, NULL, NULL, 0);
+#endif
+}
+
 void aeron_micro_sleep(size_t microseconds)
 {
 #ifdef _WIN32
@@ -90,6 +128,84 @@ void aeron_thread_set_name(const char *role_name)
 #endif
 }
 
+int aeron_thread_attr_set_affinity(pthread_attr_t *attr, const char *cpu_list)
+{
+#if defined(__linux__)
+    cpu_set_t cpu_set;
+    const char *ptr = cpu_list;
+
+    CPU_ZERO(&cpu_set);
+
+    while ('\0' != *ptr)
+    {
+        char *end_ptr = NULL;
+        long first = strtol(ptr, &end_ptr, 10);
+        long last = first;
+
+        if (end_ptr == ptr)
+        {
+            return EINVAL;
+        }
+
+        ptr = end_ptr;
+        if ('-' == *ptr)
+        {
+            last = strtol(++ptr, &end_ptr, 10);
+            if (end_ptr == ptr)
+            {
+                return EINVAL;
+            }
+            ptr = end_ptr;
+        }
+
+        if (first < 0 || last < first || last >= CPU_SETSIZE)
+        {
+            return EINVAL;
+        }
+
+        for (long cpu = first; cpu <= last; cpu++)
+        {
+            CPU_SET((int)cpu, &cpu_set);
+        }
+
+        if (',' == *ptr && '\0' != *(ptr + 1))
+        {
+            ptr++;
+        }
+        else if ('\0' != *ptr)
+        {
+            return EINVAL;
+        }
+    }
+
+    if (0 == CPU_COUNT(&cpu_set))
+    {
+        return EINVAL;
+    }
+
+    return pthread_attr_setaffinity_np(attr, sizeof(cpu_set), &cpu_set);
+#else
+    return ENOTSUP;
+#endif
+}
+
+int aeron_thread_attr_set_fifo_priority(pthread_attr_t *attr, int32_t priority)
+{
+    struct sched_param param;
+    int result;
+
+    param.sched_priority = priority;
+
+    if ((result = pthread_attr_setinheritsched(attr, PTHREAD_EXPLICIT_SCHED)) != 0 ||
+        (result = pthread_attr_setschedpolicy(attr, SCHED_FIFO)) != 0 ||
+        (result = pthread_attr_setschedparam(attr, &param)) != 0)
+    {
+        return result;
+    }
+
+    return 0;
+}
+
 #elif defined(AERON_COMPILER_MSVC)
 
 static BOOL WINAPI aeron_thread_once_callback(PINIT_ONCE init_once, void (*callback)(void), void **context)
@@ -268,13 +384,43 @@ int sched_yield(void)
     return 0;
 }
 
+int aeron_thread_attr_set_affinity(pthread_attr_t *attr, const char *cpu_list)
+{
+    return ENOTSUP;
+}
+
+int aeron_thread_attr_set_fifo_priority(pthread_attr_t *attr, int32_t priority)
+{
+    return ENOTSUP;
+}
+
 #else
 #error Unsupported platform!
 #endif
 
  // sched
 
-#if defined(AERON_COMPILER_GCC)
+#if defined(AERON_COMPILER_GCC) && defined(AERON_CPU_ARM64)
+
+#include <sched.h>
+
+void proc_yield()
+{
+    __asm__ volatile("yield" : : : "memory");
+}
+
+bool proc_has_timed_pause(void)
+{
+    return true;
+}
+
+/* WFE until the next event, which the kernel event stream bounds, as there is no timed wait to honour tsc_cycles */
+void proc_timed_pause(uint64_t tsc_cycles)
+{
+    __asm__ volatile("wfe" : : : "memory");
+}
+
+#elif defined(AERON_COMPILER_GCC)
 
 #include <sched.h>
 
@@ -283,8 +429,54 @@ void proc_yield()
     __asm__ volatile("pause\n": : : "memory");
 }
 
+bool proc_has_timed_pause(void)
+{
+    static int has_waitpkg = -1;
+
+    if (has_waitpkg < 0)
+    {
+        uint32_t eax = 7, ebx, ecx = 0, edx;
+
+        __asm__ volatile("cpuid" : "+a"(eax), "=b"(ebx), "+c"(ecx), "=d"(edx));
+        has_waitpkg = (ecx >> 5) & 1;
+    }
+
+    return 1 == has_waitpkg;
+}
+
+void proc_timed_pause(uint64_t tsc_cycles)
+{
+    if (proc_has_timed_pause())
+    {
+        uint32_t lo, hi;
+
+        __asm__ volatile("rdtsc" : "=a"(lo), "=d"(hi));
+        uint64_t deadline = (((uint64_t)hi << 32) | lo) + tsc_cycles;
+
+        /* tpause %ecx, encoded directly so the build does not need -mwaitpkg; ecx = 1 selects C0.1 */
+        __asm__ volatile(".byte 0x66, 0x0f, 0xae, 0xf1"
+            :
+            : "c"(1), "a"((uint32_t)deadline), "d"((uint32_t)(deadline >> 32))
+            : "memory", "cc");
+    }
+    else
+    {
+        proc_yield();
+    }
+}
+
 #elif defined(AERON_COMPILER_MSVC)
 
+bool proc_has_timed_pause(void)
+{
+    return false;
+}
+
+void proc_timed_pause(uint64_t tsc_cycles)
+{
+    _mm_pause();
+}
+
 #else
 #error Unsupported platform!
 #endif
@@ -18,6 +18,7 @@
 #define AERON_THREAD_H
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <stddef.h>
 
 #include "util/aeron_platform.h"
@@ -27,6 +28,13 @@ void aeron_thread_set_name(const char *role_name);
 void aeron_nano_sleep(uint64_t nanoseconds);
 void aeron_micro_sleep(size_t microseconds);
 
+/*
+ * Block until woken or timeout_ns passes, provided *addr still holds expected. Without a wait on address for the
+ * platform this sleeps for the timeout instead, so callers must recheck their condition.
+ */
+void aeron_wait_on_address(volatile int32_t *addr, int32_t expected, int64_t timeout_ns);
+void aeron_wake_by_address_all(volatile int32_t *addr);
+
 #if defined(AERON_COMPILER_GCC)
 
 #include <pthread.h>
@@ -91,6 +99,17 @@ void* aeron_thread_get_specific(pthread_key_t key);
 #error Unsupported platform!
 #endif
 
+/*
+ * Pin threads created with the attributes to a list of cpus such as "1,3-5". Returns 0 or an error number as the
+ * pthread functions do, ENOTSUP where the platform cannot pin threads.
+ */
+int aeron_thread_attr_set_affinity(pthread_attr_t *attr, const char *cpu_list);
+
+/*
+ * Run threads created with the attributes under SCHED_FIFO at the given priority. Returns 0 or an error number.
+ */
+int aeron_thread_attr_set_fifo_priority(pthread_attr_t *attr, int32_t priority);
+
 // sched
 
 #if defined(AERON_COMPILER_GCC)
@@ -106,4 +125,16 @@ int sched_yield(void);
 #error Unsupported platform!
 #endif
 
+/*
+ * Does the cpu support TPAUSE (WAITPKG) for low power timed waits, or WFE on ARM.
+ */
+bool proc_has_timed_pause(void);
+
+/*
+ * Wait for up to the given number of TSC cycles in the C0.1 power state with TPAUSE, or a single pause when not
+ * supported. The OS may cap the wait and interrupts end it early. On ARM this is a WFE bounded by the kernel event
+ * stream rather than by tsc_cycles.
+ */
+void proc_timed_pause(uint64_t tsc_cycles);
+
 #endif //AERON_THREAD_H
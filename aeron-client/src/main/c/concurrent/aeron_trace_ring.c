@@ -0,0 +1,136 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "concurrent/aeron_trace_ring.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+#include "util/aeron_error.h"
+
+int aeron_trace_ring_init(aeron_trace_ring_t *ring, void *buffer, size_t length, int32_t agent_type)
+{
+    if (length < AERON_TRACE_RING_LENGTH(1))
+    {
+        aeron_set_err(EINVAL, "trace ring length too short for a record: %" PRIu64, (uint64_t)length);
+        return -1;
+    }
+
+    size_t capacity = (length - sizeof(aeron_trace_ring_descriptor_t)) / sizeof(aeron_trace_ring_record_t);
+    if (capacity > INT32_MAX)
+    {
+        capacity = INT32_MAX;
+    }
+
+    capacity = (size_t)1 << (31 - aeron_number_of_leading_zeroes((int32_t)capacity));
+
+    ring->descriptor = (aeron_trace_ring_descriptor_t *)buffer;
+    ring->records = (aeron_trace_ring_record_t *)((uint8_t *)buffer + sizeof(aeron_trace_ring_descriptor_t));
+    ring->mask = (int64_t)capacity - 1;
+
+    ring->descriptor->agent_type = agent_type;
+    ring->descriptor->capacity = (int32_t)capacity;
+    AERON_PUT_ORDERED(ring->descriptor->write_index, 0);
+
+    return 0;
+}
+
+void aeron_trace_ring_record_frames(
+    aeron_trace_ring_t *ring, int32_t event_type, int64_t timestamp_ns, const uint8_t *buffer, size_t length)
+{
+    size_t offset = 0;
+
+    while (offset + AERON_DATA_HEADER_LENGTH <= length)
+    {
+        const aeron_data_header_t *frame = (const aeron_data_header_t *)(buffer + offset);
+        const int32_t frame_length = frame->frame_header.frame_length;
+
+        if (frame_length <= 0)
+        {
+            break;
+        }
+
+        if (AERON_HDR_TYPE_DATA == frame->frame_header.type && aeron_trace_is_marked(frame->reserved_value))
+        {
+            aeron_trace_ring_record(ring, event_type, timestamp_ns, frame);
+        }
+
+        offset += AERON_ALIGN((size_t)frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    }
+}
+
+int64_t aeron_trace_ring_read(
+    const uint8_t *buffer,
+    size_t length,
+    int64_t from_index,
+    aeron_trace_event_func_t event_func,
+    void *clientd)
+{
+    const aeron_trace_ring_descriptor_t *descriptor = (const aeron_trace_ring_descriptor_t *)buffer;
+    const aeron_trace_ring_record_t *records =
+        (const aeron_trace_ring_record_t *)(buffer + sizeof(aeron_trace_ring_descriptor_t));
+    const int64_t capacity = descriptor->capacity;
+
+    if (length < AERON_TRACE_RING_LENGTH(capacity) || capacity <= 0)
+    {
+        return from_index;
+    }
+
+    int64_t write_index;
+    AERON_GET_VOLATILE(write_index, descriptor->write_index);
+
+    int64_t index = write_index - from_index > capacity ? write_index - capacity : from_index;
+    for (; index < write_index; index++)
+    {
+        const aeron_trace_ring_record_t *record = &records[index & (capacity - 1)];
+        aeron_trace_event_t event;
+        int64_t sequence;
+
+        AERON_GET_VOLATILE(sequence, record->sequence);
+        if (sequence != index + 1)
+        {
+            continue;
+        }
+
+        event.agent_type = descriptor->agent_type;
+        event.event_type = record->event_type;
+        event.timestamp_ns = record->timestamp_ns;
+        event.append_timestamp_ns = record->append_timestamp_ns;
+        event.session_id = record->session_id;
+        event.stream_id = record->stream_id;
+        event.term_id = record->term_id;
+        event.term_offset = record->term_offset;
+        event.length = record->length;
+
+        aeron_acquire();
+        AERON_GET_VOLATILE(sequence, record->sequence);
+        if (sequence == index + 1)
+        {
+            event_func(clientd, &event);
+        }
+    }
+
+    return write_index;
+}
+
+extern bool aeron_trace_is_marked(int64_t reserved_value);
+
+extern void aeron_trace_ring_record(
+    aeron_trace_ring_t *ring,
+    int32_t event_type,
+    int64_t timestamp_ns,
+    const aeron_data_header_t *frame);
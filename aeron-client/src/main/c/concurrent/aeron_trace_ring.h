@@ -0,0 +1,126 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_TRACE_RING_H
+#define AERON_TRACE_RING_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "aeronc.h"
+#include "protocol/aeron_udp_protocol.h"
+#include "concurrent/aeron_atomic.h"
+#include "util/aeron_bitutil.h"
+
+/*
+ * A trace ring holds the most recent trace records of one agent. It has a single writer which overwrites the oldest
+ * records rather than waiting on readers, so a tool can read it from another process at any time. Each record carries
+ * a sequence which is cleared while the record is written, and readers discard records whose sequence changes while
+ * they copy them.
+ */
+#pragma pack(push)
+#pragma pack(4)
+typedef struct aeron_trace_ring_descriptor_stct
+{
+    int32_t agent_type;
+    int32_t capacity;
+    uint8_t pad1[(2 * AERON_CACHE_LINE_LENGTH) - (2 * sizeof(int32_t))];
+    volatile int64_t write_index;
+    uint8_t pad2[(2 * AERON_CACHE_LINE_LENGTH) - sizeof(int64_t)];
+}
+aeron_trace_ring_descriptor_t;
+
+typedef struct aeron_trace_ring_record_stct
+{
+    volatile int64_t sequence;
+    int64_t timestamp_ns;
+    int64_t append_timestamp_ns;
+    int32_t event_type;
+    int32_t session_id;
+    int32_t stream_id;
+    int32_t term_id;
+    int32_t term_offset;
+    int32_t length;
+}
+aeron_trace_ring_record_t;
+#pragma pack(pop)
+
+#define AERON_TRACE_RING_LENGTH(capacity) \
+    (sizeof(aeron_trace_ring_descriptor_t) + ((size_t)(capacity) * sizeof(aeron_trace_ring_record_t)))
+
+typedef struct aeron_trace_ring_stct
+{
+    aeron_trace_ring_descriptor_t *descriptor;
+    aeron_trace_ring_record_t *records;
+    int64_t mask;
+}
+aeron_trace_ring_t;
+
+/*
+ * Initialise a ring over a buffer, rounding the number of records that fit down to a power of two.
+ */
+int aeron_trace_ring_init(aeron_trace_ring_t *ring, void *buffer, size_t length, int32_t agent_type);
+
+inline bool aeron_trace_is_marked(int64_t reserved_value)
+{
+    return (reserved_value & AERON_TRACE_RESERVED_VALUE_TAG_MASK) == AERON_TRACE_RESERVED_VALUE_TAG;
+}
+
+inline void aeron_trace_ring_record(
+    aeron_trace_ring_t *ring,
+    int32_t event_type,
+    int64_t timestamp_ns,
+    const aeron_data_header_t *frame)
+{
+    const int64_t index = ring->descriptor->write_index;
+    aeron_trace_ring_record_t *record = &ring->records[index & ring->mask];
+
+    record->sequence = 0;
+    aeron_release();
+
+    record->timestamp_ns = timestamp_ns & AERON_TRACE_TIMESTAMP_MASK;
+    record->append_timestamp_ns = frame->reserved_value & AERON_TRACE_TIMESTAMP_MASK;
+    record->event_type = event_type;
+    record->session_id = frame->session_id;
+    record->stream_id = frame->stream_id;
+    record->term_id = frame->term_id;
+    record->term_offset = frame->term_offset;
+    record->length = frame->frame_header.frame_length;
+
+    AERON_PUT_ORDERED(record->sequence, index + 1);
+    AERON_PUT_ORDERED(ring->descriptor->write_index, index + 1);
+}
+
+/*
+ * Record an event for each marked data frame in a buffer of one or more frames, such as a datagram or a block of a
+ * term. Unmarked frames cost a read of their header only.
+ */
+void aeron_trace_ring_record_frames(
+    aeron_trace_ring_t *ring, int32_t event_type, int64_t timestamp_ns, const uint8_t *buffer, size_t length);
+
+/*
+ * Read the records of a ring written since from_index, or all that remain if it has since wrapped, and return the
+ * index to read from next time.
+ */
+int64_t aeron_trace_ring_read(
+    const uint8_t *buffer,
+    size_t length,
+    int64_t from_index,
+    aeron_trace_event_func_t event_func,
+    void *clientd);
+
+#endif //AERON_TRACE_RING_H
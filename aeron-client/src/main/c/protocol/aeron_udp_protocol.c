@@ -18,6 +18,8 @@
 #include <string.h>
 
 #include "util/aeron_bitutil.h"
+#include "util/aeron_crc32c.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
 #include "aeron_udp_protocol.h"
 
 int aeron_udp_protocol_group_tag(aeron_status_message_header_t *sm, int64_t *group_tag)
@@ -95,3 +97,57 @@ int aeron_res_header_entry_length(void *res, size_t remaining)
     return result;
 }
 
+
+uint32_t aeron_data_frame_checksum(const uint8_t *frame, size_t frame_length)
+{
+    uint32_t crc = aeron_crc32c(0, frame, offsetof(aeron_data_header_t, reserved_value));
+
+    return aeron_crc32c(crc, frame + AERON_DATA_HEADER_LENGTH, frame_length - AERON_DATA_HEADER_LENGTH);
+}
+
+void aeron_data_frames_apply_checksum(uint8_t *buffer, size_t length)
+{
+    size_t offset = 0;
+
+    while (offset + AERON_DATA_HEADER_LENGTH <= length)
+    {
+        aeron_data_header_t *data_header = (aeron_data_header_t *)(buffer + offset);
+        const int32_t frame_length = data_header->frame_header.frame_length;
+
+        if (AERON_HDR_TYPE_DATA != data_header->frame_header.type ||
+            frame_length < (int32_t)AERON_DATA_HEADER_LENGTH ||
+            (size_t)frame_length > length - offset)
+        {
+            break;
+        }
+
+        data_header->reserved_value = (int64_t)aeron_data_frame_checksum(buffer + offset, (size_t)frame_length);
+        offset += (size_t)AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    }
+}
+
+bool aeron_data_frames_verify_checksum(const uint8_t *buffer, size_t length)
+{
+    size_t offset = 0;
+
+    while (offset + AERON_DATA_HEADER_LENGTH <= length)
+    {
+        const aeron_data_header_t *data_header = (const aeron_data_header_t *)(buffer + offset);
+        const int32_t frame_length = data_header->frame_header.frame_length;
+
+        if (AERON_HDR_TYPE_DATA != data_header->frame_header.type || frame_length < (int32_t)AERON_DATA_HEADER_LENGTH)
+        {
+            break;
+        }
+
+        if ((size_t)frame_length > length - offset ||
+            data_header->reserved_value != (int64_t)aeron_data_frame_checksum(buffer + offset, (size_t)frame_length))
+        {
+            return false;
+        }
+
+        offset += (size_t)AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    }
+
+    return true;
+}
@@ -19,6 +19,7 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 
 #pragma pack(push)
 #pragma pack(4)
@@ -201,4 +202,14 @@ size_t aeron_res_header_entry_length_ipv6(aeron_resolution_header_ipv6_t *header
 
 int aeron_res_header_entry_length(void *res, size_t remaining);
 
+/*
+ * CRC32C of a data frame over its header up to the reserved value and its payload. Carried in the reserved value
+ * when a channel has checksums enabled.
+ */
+uint32_t aeron_data_frame_checksum(const uint8_t *frame, size_t frame_length);
+
+void aeron_data_frames_apply_checksum(uint8_t *buffer, size_t length);
+
+bool aeron_data_frames_verify_checksum(const uint8_t *buffer, size_t length);
+
 #endif //AERON_UDP_PROTOCOL_H
@@ -19,4 +19,5 @@
 extern int aeron_number_of_trailing_zeroes(int32_t value);
 extern int aeron_number_of_trailing_zeroes_u64(uint64_t value);
 extern int aeron_number_of_leading_zeroes(int32_t value);
+extern int aeron_number_of_leading_zeroes_u64(uint64_t value);
 extern int32_t aeron_find_next_power_of_two(int32_t value);
@@ -128,6 +128,32 @@ inline int aeron_number_of_leading_zeroes(int32_t value)
 #endif
 }
 
+inline int aeron_number_of_leading_zeroes_u64(uint64_t value)
+{
+#if defined(__GNUC__)
+    if (0 == value)
+    {
+        return 64;
+    }
+
+    return __builtin_clzll(value);
+#elif defined(_MSC_VER) && defined(AERON_CPU_X64)
+    unsigned long r;
+
+    if (_BitScanReverse64(&r, (__int64)value))
+    {
+        return 63 - (int)r;
+    }
+
+    return 64;
+#else
+    int upper_lzc = aeron_number_of_leading_zeroes((int32_t)((value >> 32u) & UINT64_C(0xFFFFFFFF)));
+    int lower_lzc = aeron_number_of_leading_zeroes((int32_t)(value & UINT64_C(0xFFFFFFFF)));
+
+    return upper_lzc == 32 ? upper_lzc + lower_lzc : upper_lzc;
+#endif
+}
+
 inline int32_t aeron_find_next_power_of_two(int32_t value)
 {
     value--;
@@ -20,6 +20,7 @@
 #endif
 
 #include <time.h>
+#include <stdbool.h>
 #include "aeron_alloc.h"
 #include "util/aeron_bitutil.h"
 #include "util/aeron_clock.h"
@@ -162,3 +163,197 @@ void aeron_clock_cache_free(aeron_clock_cache_t *cached_time)
 {
     aeron_free((void *)cached_time);
 }
+
+#define AERON_TSC_CLOCK_MULT_SHIFT (32)
+
+typedef struct aeron_tsc_clock_stct
+{
+    volatile int64_t version;
+    volatile int32_t resync_lock;
+    bool is_calibrated;
+    uint64_t tsc_base;
+    int64_t ns_base;
+    uint64_t mult;
+    uint64_t resync_tsc;
+    uint64_t calibration_tsc;
+    int64_t calibration_ns;
+}
+aeron_tsc_clock_t;
+
+static aeron_tsc_clock_t aeron_tsc_clock = { 0 };
+
+#if defined(AERON_COMPILER_MSVC)
+
+#include <intrin.h>
+
+static bool aeron_tsc_is_invariant(void)
+{
+    int regs[4];
+
+    __cpuid(regs, 0x80000000);
+    if ((unsigned int)regs[0] < 0x80000007)
+    {
+        return false;
+    }
+
+    __cpuid(regs, 0x80000007);
+    return 0 != ((regs[3] >> 8) & 1);
+}
+
+static inline uint64_t aeron_tsc_read(void)
+{
+    return __rdtsc();
+}
+
+#elif defined(__aarch64__)
+
+static bool aeron_tsc_is_invariant(void)
+{
+    return true;
+}
+
+static inline uint64_t aeron_tsc_read(void)
+{
+    uint64_t value;
+    __asm__ volatile("isb; mrs %0, cntvct_el0" : "=r"(value) : : "memory");
+    return value;
+}
+
+#else
+
+static bool aeron_tsc_is_invariant(void)
+{
+    uint32_t eax = 0x80000000, ebx, ecx = 0, edx;
+
+    __asm__ volatile("cpuid" : "+a"(eax), "=b"(ebx), "+c"(ecx), "=d"(edx));
+    if (eax < 0x80000007)
+    {
+        return false;
+    }
+
+    eax = 0x80000007;
+    ecx = 0;
+    __asm__ volatile("cpuid" : "+a"(eax), "=b"(ebx), "+c"(ecx), "=d"(edx));
+    return 0 != ((edx >> 8) & 1);
+}
+
+static inline uint64_t aeron_tsc_read(void)
+{
+    uint32_t lo, hi;
+    __asm__ volatile("rdtsc" : "=a"(lo), "=d"(hi));
+    return ((uint64_t)hi << 32) | lo;
+}
+
+#endif
+
+static inline int64_t aeron_tsc_to_ns(uint64_t tsc, uint64_t tsc_base, int64_t ns_base, uint64_t mult)
+{
+    uint64_t delta = tsc > tsc_base ? tsc - tsc_base : 0;
+    uint64_t ns = ((delta >> AERON_TSC_CLOCK_MULT_SHIFT) * mult) +
+        (((delta & 0xFFFFFFFFULL) * mult) >> AERON_TSC_CLOCK_MULT_SHIFT);
+
+    return ns_base + (int64_t)ns;
+}
+
+static uint64_t aeron_tsc_mult(uint64_t tsc_span, int64_t ns_span)
+{
+    return (uint64_t)(((double)ns_span / (double)tsc_span) * (double)(1ULL << AERON_TSC_CLOCK_MULT_SHIFT));
+}
+
+static uint64_t aeron_tsc_resync_tsc(uint64_t tsc_base, uint64_t mult)
+{
+    return tsc_base + (uint64_t)(
+        ((double)AERON_TSC_CLOCK_RESYNC_INTERVAL_NS * (double)(1ULL << AERON_TSC_CLOCK_MULT_SHIFT)) / (double)mult);
+}
+
+int aeron_tsc_clock_init(void)
+{
+    if (aeron_tsc_clock.is_calibrated)
+    {
+        return 0;
+    }
+
+    if (!aeron_tsc_is_invariant())
+    {
+        return -1;
+    }
+
+    int64_t start_ns = aeron_nano_clock();
+    uint64_t start_tsc = aeron_tsc_read();
+    int64_t now_ns;
+
+    do
+    {
+        now_ns = aeron_nano_clock();
+    }
+    while (now_ns - start_ns < AERON_TSC_CLOCK_CALIBRATION_NS);
+
+    uint64_t now_tsc = aeron_tsc_read();
+    if (now_tsc <= start_tsc)
+    {
+        return -1;
+    }
+
+    aeron_tsc_clock.calibration_tsc = start_tsc;
+    aeron_tsc_clock.calibration_ns = start_ns;
+    aeron_tsc_clock.tsc_base = now_tsc;
+    aeron_tsc_clock.ns_base = now_ns;
+    aeron_tsc_clock.mult = aeron_tsc_mult(now_tsc - start_tsc, now_ns - start_ns);
+    aeron_tsc_clock.resync_tsc = aeron_tsc_resync_tsc(now_tsc, aeron_tsc_clock.mult);
+    AERON_PUT_ORDERED(aeron_tsc_clock.is_calibrated, true);
+
+    return 0;
+}
+
+static void aeron_tsc_clock_resync(void)
+{
+    if (!aeron_cmpxchg32(&aeron_tsc_clock.resync_lock, 0, 1))
+    {
+        return;
+    }
+
+    int64_t monotonic_ns = aeron_nano_clock();
+    uint64_t tsc = aeron_tsc_read();
+    int64_t estimate_ns = aeron_tsc_to_ns(
+        tsc, aeron_tsc_clock.tsc_base, aeron_tsc_clock.ns_base, aeron_tsc_clock.mult);
+    uint64_t mult = aeron_tsc_mult(tsc - aeron_tsc_clock.calibration_tsc, monotonic_ns - aeron_tsc_clock.calibration_ns);
+    int64_t version = aeron_tsc_clock.version;
+
+    AERON_PUT_ORDERED(aeron_tsc_clock.version, version + 1);
+    aeron_tsc_clock.tsc_base = tsc;
+    aeron_tsc_clock.ns_base = monotonic_ns > estimate_ns ? monotonic_ns : estimate_ns;
+    aeron_tsc_clock.mult = mult;
+    aeron_tsc_clock.resync_tsc = aeron_tsc_resync_tsc(tsc, mult);
+    AERON_PUT_ORDERED(aeron_tsc_clock.version, version + 2);
+
+    AERON_PUT_ORDERED(aeron_tsc_clock.resync_lock, 0);
+}
+
+int64_t aeron_tsc_nano_clock(void)
+{
+    int64_t version_before, version_after, ns;
+    uint64_t tsc, resync_tsc;
+
+    do
+    {
+        AERON_GET_VOLATILE(version_before, aeron_tsc_clock.version);
+        tsc = aeron_tsc_read();
+        ns = aeron_tsc_to_ns(tsc, aeron_tsc_clock.tsc_base, aeron_tsc_clock.ns_base, aeron_tsc_clock.mult);
+        resync_tsc = aeron_tsc_clock.resync_tsc;
+        aeron_acquire();
+        AERON_GET_VOLATILE(version_after, aeron_tsc_clock.version);
+    }
+    while (version_before != version_after || 0 != (version_before & 1));
+
+    if (tsc >= resync_tsc)
+    {
+        aeron_tsc_clock_resync();
+    }
+
+    return ns;
+}
+
+uint64_t aeron_tsc_ticks(void)
+{
+    return aeron_tsc_read();
+}
@@ -60,4 +60,32 @@ int aeron_clock_cache_alloc(aeron_clock_cache_t **cached_time);
  */
 void aeron_clock_cache_free(aeron_clock_cache_t *cached_time);
 
+#define AERON_TSC_CLOCK_CALIBRATION_NS (10 * 1000 * 1000LL)
+#define AERON_TSC_CLOCK_RESYNC_INTERVAL_NS (1000 * 1000 * 1000LL)
+
+/**
+ * Calibrate the TSC nano clock against the monotonic clock. Takes AERON_TSC_CLOCK_CALIBRATION_NS on first call and
+ * is a no-op after a successful calibration.
+ *
+ * @return 0 on success or -1 if the cpu has no invariant TSC.
+ */
+int aeron_tsc_clock_init(void);
+
+/**
+ * Nano clock derived from the invariant TSC (rdtsc on x86, cntvct on ARM) which avoids the cost of clock_gettime.
+ * It is re-synced against the monotonic clock every AERON_TSC_CLOCK_RESYNC_INTERVAL_NS without going backwards.
+ * aeron_tsc_clock_init must have succeeded before use.
+ *
+ * @return time in nanoseconds on the monotonic time line.
+ */
+int64_t aeron_tsc_nano_clock(void);
+
+/**
+ * Raw read of the TSC (the virtual counter on ARM) for timing short sections of code. The ticks are not calibrated
+ * so are only meaningful as deltas compared with other deltas taken on the same machine.
+ *
+ * @return current tick count.
+ */
+uint64_t aeron_tsc_ticks(void);
+
 #endif //AERON_AERON_CLOCK_H
@@ -0,0 +1,29 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_CRC32C_H
+#define AERON_CRC32C_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * CRC32C (Castagnoli) of a buffer continuing from a previous crc, start with 0. Uses the SSE4.2 or ARMv8 CRC
+ * instructions when the CPU has them and a table driven fallback otherwise.
+ */
+uint32_t aeron_crc32c(uint32_t crc, const uint8_t *buffer, size_t length);
+
+#endif //AERON_CRC32C_H
@@ -0,0 +1,340 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _GNU_SOURCE
+#endif
+
+#include <errno.h>
+#include <string.h>
+#include <stdio.h>
+#include <inttypes.h>
+
+#include "util/aeron_platform.h"
+#include "util/aeron_error.h"
+#include "util/aeron_fd_transfer.h"
+
+#if defined(AERON_COMPILER_MSVC)
+
+int aeron_fd_transfer_server_init(aeron_fd_transfer_server_t *server, const char *socket_path, const char *root_dir)
+{
+    server->listen_fd = -1;
+    aeron_set_err(EINVAL, "%s", "log buffer descriptor transfer not supported");
+    return -1;
+}
+
+int aeron_fd_transfer_server_poll(aeron_fd_transfer_server_t *server)
+{
+    return 0;
+}
+
+void aeron_fd_transfer_server_close(aeron_fd_transfer_server_t *server)
+{
+}
+
+int aeron_fd_transfer_request(const char *socket_path, const char *path, int64_t timeout_ms)
+{
+    aeron_set_err(EINVAL, "%s", "log buffer descriptor transfer not supported");
+    return -1;
+}
+
+#else
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#if !defined(MSG_NOSIGNAL)
+#define MSG_NOSIGNAL (0)
+#endif
+
+static int aeron_fd_transfer_address(struct sockaddr_un *address, const char *socket_path)
+{
+    memset(address, 0, sizeof(struct sockaddr_un));
+    address->sun_family = AF_UNIX;
+
+    if (strlen(socket_path) >= sizeof(address->sun_path))
+    {
+        aeron_set_err(EINVAL, "socket path too long: %s", socket_path);
+        return -1;
+    }
+
+    strncpy(address->sun_path, socket_path, sizeof(address->sun_path) - 1);
+    return 0;
+}
+
+int aeron_fd_transfer_server_init(aeron_fd_transfer_server_t *server, const char *socket_path, const char *root_dir)
+{
+    struct sockaddr_un address;
+
+    server->listen_fd = -1;
+    server->socket_path = socket_path;
+    server->root_dir = root_dir;
+    snprintf(server->memfd_prefix, sizeof(server->memfd_prefix), "/proc/%" PRId64 "/fd/", (int64_t)getpid());
+
+    for (size_t i = 0; i < AERON_FD_TRANSFER_MAX_PENDING_CONNECTIONS; i++)
+    {
+        server->connections[i].fd = -1;
+        server->connections[i].length = 0;
+    }
+
+    if (aeron_fd_transfer_address(&address, socket_path) < 0)
+    {
+        return -1;
+    }
+
+    if ((server->listen_fd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0)
+    {
+        aeron_set_err_from_last_err_code("socket(AF_UNIX) for %s", socket_path);
+        return -1;
+    }
+
+    unlink(socket_path);
+
+    if (bind(server->listen_fd, (struct sockaddr *)&address, sizeof(address)) < 0 ||
+        listen(server->listen_fd, AERON_FD_TRANSFER_MAX_PENDING_CONNECTIONS) < 0 ||
+        fcntl(server->listen_fd, F_SETFL, fcntl(server->listen_fd, F_GETFL, 0) | O_NONBLOCK) < 0)
+    {
+        aeron_set_err_from_last_err_code("could not listen on %s", socket_path);
+        close(server->listen_fd);
+        server->listen_fd = -1;
+        return -1;
+    }
+
+    return 0;
+}
+
+static bool aeron_fd_transfer_server_is_permitted(aeron_fd_transfer_server_t *server, const char *path)
+{
+    const size_t root_dir_length = strlen(server->root_dir);
+
+    if (NULL != strstr(path, ".."))
+    {
+        return false;
+    }
+
+    if (0 == strncmp(path, server->root_dir, root_dir_length) && '/' == path[root_dir_length])
+    {
+        return true;
+    }
+
+    return 0 == strncmp(path, server->memfd_prefix, strlen(server->memfd_prefix));
+}
+
+static void aeron_fd_transfer_server_respond(
+    aeron_fd_transfer_server_t *server, aeron_fd_transfer_connection_t *connection)
+{
+    int32_t status = AERON_FD_TRANSFER_RESPONSE_ERROR;
+    int log_fd = -1;
+    struct msghdr message;
+    struct iovec iov;
+    char control[CMSG_SPACE(sizeof(int))];
+
+    if (aeron_fd_transfer_server_is_permitted(server, connection->path))
+    {
+        log_fd = open(connection->path, O_RDWR);
+    }
+
+    memset(&message, 0, sizeof(message));
+    iov.iov_base = &status;
+    iov.iov_len = sizeof(status);
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+
+    if (log_fd >= 0)
+    {
+        status = AERON_FD_TRANSFER_RESPONSE_OK;
+        memset(control, 0, sizeof(control));
+        message.msg_control = control;
+        message.msg_controllen = sizeof(control);
+
+        struct cmsghdr *cmsg = CMSG_FIRSTHDR(&message);
+        cmsg->cmsg_level = SOL_SOCKET;
+        cmsg->cmsg_type = SCM_RIGHTS;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+        memcpy(CMSG_DATA(cmsg), &log_fd, sizeof(int));
+    }
+
+    sendmsg(connection->fd, &message, MSG_NOSIGNAL);
+
+    if (log_fd >= 0)
+    {
+        close(log_fd);
+    }
+
+    close(connection->fd);
+    connection->fd = -1;
+    connection->length = 0;
+}
+
+int aeron_fd_transfer_server_poll(aeron_fd_transfer_server_t *server)
+{
+    int work_count = 0;
+
+    if (server->listen_fd < 0)
+    {
+        return 0;
+    }
+
+    for (size_t i = 0; i < AERON_FD_TRANSFER_MAX_PENDING_CONNECTIONS; i++)
+    {
+        aeron_fd_transfer_connection_t *connection = &server->connections[i];
+
+        if (connection->fd < 0)
+        {
+            int fd = accept(server->listen_fd, NULL, NULL);
+            if (fd < 0)
+            {
+                continue;
+            }
+
+            fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+            connection->fd = fd;
+            connection->length = 0;
+            work_count++;
+        }
+
+        ssize_t bytes = recv(
+            connection->fd, connection->path + connection->length, sizeof(connection->path) - connection->length, 0);
+
+        if (bytes > 0)
+        {
+            connection->length += (size_t)bytes;
+            work_count++;
+
+            if ('\0' == connection->path[connection->length - 1])
+            {
+                aeron_fd_transfer_server_respond(server, connection);
+            }
+            else if (connection->length >= sizeof(connection->path))
+            {
+                close(connection->fd);
+                connection->fd = -1;
+            }
+        }
+        else if (0 == bytes || (EAGAIN != errno && EWOULDBLOCK != errno))
+        {
+            close(connection->fd);
+            connection->fd = -1;
+        }
+    }
+
+    return work_count;
+}
+
+void aeron_fd_transfer_server_close(aeron_fd_transfer_server_t *server)
+{
+    if (server->listen_fd < 0)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < AERON_FD_TRANSFER_MAX_PENDING_CONNECTIONS; i++)
+    {
+        if (server->connections[i].fd >= 0)
+        {
+            close(server->connections[i].fd);
+            server->connections[i].fd = -1;
+        }
+    }
+
+    close(server->listen_fd);
+    unlink(server->socket_path);
+    server->listen_fd = -1;
+}
+
+int aeron_fd_transfer_request(const char *socket_path, const char *path, int64_t timeout_ms)
+{
+    struct sockaddr_un address;
+    struct timeval timeout;
+    struct msghdr message;
+    struct iovec iov;
+    char control[CMSG_SPACE(sizeof(int))];
+    int32_t status = AERON_FD_TRANSFER_RESPONSE_ERROR;
+    int fd, log_fd = -1;
+
+    if (aeron_fd_transfer_address(&address, socket_path) < 0)
+    {
+        return -1;
+    }
+
+    if ((fd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0)
+    {
+        aeron_set_err_from_last_err_code("socket(AF_UNIX) for %s", socket_path);
+        return -1;
+    }
+
+    timeout.tv_sec = (time_t)(timeout_ms / 1000);
+    timeout.tv_usec = (suseconds_t)((timeout_ms % 1000) * 1000);
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+    if (connect(fd, (struct sockaddr *)&address, sizeof(address)) < 0)
+    {
+        aeron_set_err_from_last_err_code("could not connect to %s", socket_path);
+        close(fd);
+        return -1;
+    }
+
+    if (send(fd, path, strlen(path) + 1, MSG_NOSIGNAL) < 0)
+    {
+        aeron_set_err_from_last_err_code("could not request %s from %s", path, socket_path);
+        close(fd);
+        return -1;
+    }
+
+    memset(&message, 0, sizeof(message));
+    memset(control, 0, sizeof(control));
+    iov.iov_base = &status;
+    iov.iov_len = sizeof(status);
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+
+    if (recvmsg(fd, &message, 0) < (ssize_t)sizeof(status))
+    {
+        aeron_set_err_from_last_err_code("no response for %s from %s", path, socket_path);
+        close(fd);
+        return -1;
+    }
+
+    close(fd);
+
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&message);
+    if (NULL != cmsg && SOL_SOCKET == cmsg->cmsg_level && SCM_RIGHTS == cmsg->cmsg_type)
+    {
+        memcpy(&log_fd, CMSG_DATA(cmsg), sizeof(int));
+    }
+
+    if (AERON_FD_TRANSFER_RESPONSE_OK != status || log_fd < 0)
+    {
+        if (log_fd >= 0)
+        {
+            close(log_fd);
+        }
+
+        aeron_set_err(EPERM, "log buffer %s refused by %s", path, socket_path);
+        return -1;
+    }
+
+    return log_fd;
+}
+
+#endif
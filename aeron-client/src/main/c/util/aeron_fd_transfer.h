@@ -0,0 +1,73 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_FD_TRANSFER_H
+#define AERON_FD_TRANSFER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "aeron_common.h"
+
+#define AERON_FD_TRANSFER_MAX_PENDING_CONNECTIONS (16)
+#define AERON_FD_TRANSFER_RESPONSE_OK (0)
+#define AERON_FD_TRANSFER_RESPONSE_ERROR (-1)
+
+/*
+ * Log buffers handed to clients as open file descriptors over a Unix domain socket rather than as paths, so a client
+ * in another container can map a log without sharing the filesystem the driver created it in. A client connects,
+ * sends the NUL terminated log file path it was given by the driver and receives an int32 status with the descriptor
+ * attached as SCM_RIGHTS when the status is AERON_FD_TRANSFER_RESPONSE_OK.
+ */
+typedef struct aeron_fd_transfer_connection_stct
+{
+    int fd;
+    size_t length;
+    char path[AERON_MAX_PATH];
+}
+aeron_fd_transfer_connection_t;
+
+typedef struct aeron_fd_transfer_server_stct
+{
+    int listen_fd;
+    const char *socket_path;
+    const char *root_dir;
+    char memfd_prefix[64];
+    aeron_fd_transfer_connection_t connections[AERON_FD_TRANSFER_MAX_PENDING_CONNECTIONS];
+}
+aeron_fd_transfer_server_t;
+
+/*
+ * Bind a non-blocking server at socket_path that only hands out descriptors for logs below root_dir or for the memfd
+ * logs of this process. Any stale socket file at socket_path is removed first.
+ */
+int aeron_fd_transfer_server_init(aeron_fd_transfer_server_t *server, const char *socket_path, const char *root_dir);
+
+/*
+ * Accept new connections and answer any complete requests without blocking, returning the amount of work done.
+ */
+int aeron_fd_transfer_server_poll(aeron_fd_transfer_server_t *server);
+
+void aeron_fd_transfer_server_close(aeron_fd_transfer_server_t *server);
+
+/*
+ * Request a descriptor for the log at path from the server at socket_path, waiting up to timeout_ms for the response.
+ * Returns the received descriptor, owned by the caller, or -1 with the error set.
+ */
+int aeron_fd_transfer_request(const char *socket_path, const char *path, int64_t timeout_ms);
+
+#endif //AERON_FD_TRANSFER_H
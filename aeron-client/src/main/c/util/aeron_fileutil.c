@@ -24,10 +24,12 @@
 #include <fcntl.h>
 #include <string.h>
 #include <stdlib.h>
+#include <errno.h>
 
 #include "aeron_platform.h"
 #include "aeron_error.h"
 #include "aeron_fileutil.h"
+#include "concurrent/aeron_thread.h"
 
 #if defined(AERON_COMPILER_MSVC)
 
@@ -87,6 +89,29 @@ int aeron_unmap(aeron_mapped_file_t *mapped_file)
     return 0;
 }
 
+int aeron_advise_huge_pages(aeron_mapped_file_t *mapped_file)
+{
+    aeron_set_err(EINVAL, "%s", "transparent huge pages not supported");
+    return -1;
+}
+
+int aeron_bind_numa_node(aeron_mapped_file_t *mapped_file, int32_t numa_node)
+{
+    aeron_set_err(EINVAL, "%s", "numa binding not supported");
+    return -1;
+}
+
+int aeron_lock_mapped_file(aeron_mapped_file_t *mapped_file)
+{
+    if (!VirtualLock(mapped_file->addr, mapped_file->length))
+    {
+        aeron_set_err_from_last_err_code("VirtualLock");
+        return -1;
+    }
+
+    return 0;
+}
+
 int aeron_ftruncate(int fd, off_t length)
 {
     HANDLE hfile = (HANDLE)_get_osfhandle(fd);
@@ -184,8 +209,22 @@ int aeron_is_directory(const char *path)
 
 #else
 #include <unistd.h>
+#include <inttypes.h>
 #include <sys/mman.h>
 #include <sys/statvfs.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <sys/inotify.h>
+#include <poll.h>
+#include <linux/mempolicy.h>
+#ifndef MFD_CLOEXEC
+#define MFD_CLOEXEC (0x0001U)
+#endif
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__NetBSD__)
+#include <sys/event.h>
+#include <time.h>
+#define AERON_DIR_WATCHER_KQUEUE
+#endif
 #include <ftw.h>
 #include <stdio.h>
 
@@ -207,6 +246,96 @@ int aeron_unmap(aeron_mapped_file_t *mapped_file)
     return 0;
 }
 
+int aeron_advise_huge_pages(aeron_mapped_file_t *mapped_file)
+{
+#if defined(MADV_HUGEPAGE)
+    if (madvise(mapped_file->addr, mapped_file->length, MADV_HUGEPAGE) < 0)
+    {
+        aeron_set_err_from_last_err_code("madvise(MADV_HUGEPAGE)");
+        return -1;
+    }
+
+    return 0;
+#else
+    aeron_set_err(EINVAL, "%s", "transparent huge pages not supported");
+    return -1;
+#endif
+}
+
+int aeron_lock_mapped_file(aeron_mapped_file_t *mapped_file)
+{
+    if (mlock(mapped_file->addr, mapped_file->length) < 0)
+    {
+        aeron_set_err_from_last_err_code("mlock(length=%" PRIu64 ")", (uint64_t)mapped_file->length);
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * Prefer the node for the pages of the mapping and move any already faulted in. The syscall is used directly so the
+ * driver does not take a dependency on libnuma.
+ */
+int aeron_bind_numa_node(aeron_mapped_file_t *mapped_file, int32_t numa_node)
+{
+#if defined(__linux__) && defined(SYS_mbind)
+    unsigned long node_mask[AERON_NUMA_NODE_MAX / (8 * sizeof(unsigned long))] = { 0 };
+    const size_t bits_per_word = 8 * sizeof(unsigned long);
+
+    if (numa_node < 0 || numa_node >= AERON_NUMA_NODE_MAX)
+    {
+        aeron_set_err(EINVAL, "numa node must be >= 0 and < %d: %" PRId32, AERON_NUMA_NODE_MAX, numa_node);
+        return -1;
+    }
+
+    node_mask[(size_t)numa_node / bits_per_word] |= 1UL << ((size_t)numa_node % bits_per_word);
+
+    if (syscall(
+        SYS_mbind,
+        mapped_file->addr,
+        mapped_file->length,
+        MPOL_PREFERRED,
+        node_mask,
+        (unsigned long)AERON_NUMA_NODE_MAX + 1,
+        MPOL_MF_MOVE) < 0)
+    {
+        aeron_set_err_from_last_err_code("mbind(node=%" PRId32 ")", numa_node);
+        return -1;
+    }
+
+    return 0;
+#else
+    aeron_set_err(EINVAL, "%s", "numa binding not supported");
+    return -1;
+#endif
+}
+
+/*
+ * Anonymous memory for a log, reachable by clients through the procfs link of the descriptor the driver holds open so
+ * no file is created in the aeron directory.
+ */
+int aeron_memfd_log_location(char *dst, size_t length, int64_t correlation_id)
+{
+#if defined(__linux__) && defined(SYS_memfd_create)
+    char name[64];
+    int fd;
+
+    snprintf(name, sizeof(name), "aeron-log-%" PRId64, correlation_id);
+
+    if ((fd = (int)syscall(SYS_memfd_create, name, MFD_CLOEXEC)) < 0)
+    {
+        aeron_set_err_from_last_err_code("memfd_create(%s)", name);
+        return -1;
+    }
+
+    return snprintf(dst, length, AERON_MEMFD_LOG_PATH_FORMAT, (int64_t)getpid(), fd);
+#else
+    aeron_set_err(EINVAL, "%s", "memfd log buffers not supported");
+    return -1;
+#endif
+}
+
 static int unlink_func(const char *path, const struct stat *sb, int type_flag, struct FTW *ftw)
 {
     if (remove(path) != 0)
@@ -339,6 +468,87 @@ uint64_t aeron_usable_fs_space_disabled(const char *path)
     return UINT64_MAX;
 }
 
+void aeron_dir_watcher_init(aeron_dir_watcher_t *watcher, const char *path)
+{
+    watcher->fd = -1;
+    watcher->dir_fd = -1;
+
+#if defined(__linux__)
+    if ((watcher->fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC)) >= 0)
+    {
+        const uint32_t mask = IN_CREATE | IN_MODIFY | IN_CLOSE_WRITE | IN_MOVED_TO | IN_ATTRIB;
+
+        if (inotify_add_watch(watcher->fd, path, mask) < 0)
+        {
+            close(watcher->fd);
+            watcher->fd = -1;
+        }
+    }
+#elif defined(AERON_DIR_WATCHER_KQUEUE)
+    if ((watcher->dir_fd = open(path, O_RDONLY)) >= 0)
+    {
+        struct kevent change;
+
+        EV_SET(&change, watcher->dir_fd, EVFILT_VNODE, EV_ADD | EV_CLEAR, NOTE_WRITE | NOTE_EXTEND, 0, NULL);
+        if ((watcher->fd = kqueue()) < 0 || kevent(watcher->fd, &change, 1, NULL, 0, NULL) < 0)
+        {
+            aeron_dir_watcher_close(watcher);
+        }
+    }
+#endif
+}
+
+void aeron_dir_watcher_await(aeron_dir_watcher_t *watcher, int64_t timeout_ms)
+{
+#if defined(__linux__)
+    if (watcher->fd >= 0)
+    {
+        struct pollfd pfd = { .fd = watcher->fd, .events = POLLIN, .revents = 0 };
+        char buffer[4096];
+
+        if (poll(&pfd, 1, (int)timeout_ms) >= 0)
+        {
+            while (read(watcher->fd, buffer, sizeof(buffer)) > 0)
+            {
+            }
+
+            return;
+        }
+    }
+#elif defined(AERON_DIR_WATCHER_KQUEUE)
+    if (watcher->fd >= 0)
+    {
+        struct kevent event;
+        struct timespec timeout = { .tv_sec = timeout_ms / 1000, .tv_nsec = (timeout_ms % 1000) * 1000000 };
+
+        if (kevent(watcher->fd, NULL, 0, &event, 1, &timeout) >= 0)
+        {
+            return;
+        }
+    }
+#endif
+
+    aeron_micro_sleep((size_t)timeout_ms * 1000);
+}
+
+void aeron_dir_watcher_close(aeron_dir_watcher_t *watcher)
+{
+#if !defined(_MSC_VER)
+    if (watcher->fd >= 0)
+    {
+        close(watcher->fd);
+    }
+
+    if (watcher->dir_fd >= 0)
+    {
+        close(watcher->dir_fd);
+    }
+#endif
+
+    watcher->fd = -1;
+    watcher->dir_fd = -1;
+}
+
 int aeron_ipc_publication_location(
     char *dst,
     size_t length,
@@ -375,6 +585,18 @@ int aeron_publication_image_location(
         aeron_dir, correlation_id);
 }
 
+int aeron_client_responses_location(
+    char *dst,
+    size_t length,
+    const char *aeron_dir,
+    int64_t client_id)
+{
+    return snprintf(
+        dst, length,
+        "%s/" AERON_CLIENTS_DIR "/%" PRId64 ".responses",
+        aeron_dir, client_id);
+}
+
 size_t aeron_temp_filename(char *filename, size_t length)
 {
 #if !defined(_MSC_VER)
@@ -403,17 +625,42 @@ size_t aeron_temp_filename(char *filename, size_t length)
 #endif
 }
 
+static int aeron_memfd_log_fd(const char *path)
+{
+#if defined(__linux__)
+    int64_t pid;
+    int fd, consumed = 0;
+
+    if (NULL != path &&
+        2 == sscanf(path, "/proc/%" SCNd64 "/fd/%d%n", &pid, &fd, &consumed) &&
+        '\0' == path[consumed] &&
+        (int64_t)getpid() == pid)
+    {
+        return fd;
+    }
+#endif
+
+    return -1;
+}
+
 int aeron_map_raw_log(
     aeron_mapped_raw_log_t *mapped_raw_log,
     const char *path,
     bool use_sparse_files,
+    bool use_huge_pages,
+    int32_t numa_node,
     uint64_t term_length,
     uint64_t page_size)
 {
     int result = -1;
     uint64_t log_length = aeron_logbuffer_compute_log_length(term_length, page_size);
 
-    int fd = open(path, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
+    const int memfd = aeron_memfd_log_fd(path);
+
+    /* the memfd itself stays open for clients to reach it, the mapping takes a duplicate */
+    int fd = memfd >= 0 ?
+        dup(memfd) :
+        open(path, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
     if (fd >= 0)
     {
         if (aeron_ftruncate(fd, (off_t)log_length) >= 0)
@@ -427,6 +674,19 @@ int aeron_map_raw_log(
                 return -1;
             }
 
+            /* advise before pre-touching so the pages are faulted in huge rather than collapsed later */
+            if (use_huge_pages && aeron_advise_huge_pages(&mapped_raw_log->mapped_file) < 0)
+            {
+                aeron_unmap(&mapped_raw_log->mapped_file);
+                return -1;
+            }
+
+            if (AERON_NUMA_NODE_NONE != numa_node && aeron_bind_numa_node(&mapped_raw_log->mapped_file, numa_node) < 0)
+            {
+                aeron_unmap(&mapped_raw_log->mapped_file);
+                return -1;
+            }
+
             if (!use_sparse_files)
             {
                 aeron_touch_pages(mapped_raw_log->mapped_file.addr, (size_t)log_length, (size_t)page_size);
@@ -458,74 +718,81 @@ int aeron_map_raw_log(
     return result;
 }
 
+void aeron_pre_touch_mapped_memory(uint8_t *addr, size_t length, size_t page_size)
+{
+    volatile int32_t value = 0;
+
+    for (size_t offset = 0; offset < length; offset += page_size)
+    {
+        aeron_cmpxchg32((volatile int32_t *)(addr + offset), value, value);
+    }
+}
+
 int aeron_map_existing_log(aeron_mapped_raw_log_t *mapped_raw_log, const char *path, bool pre_touch)
 {
-    struct stat sb;
-    int fd, result = -1;
+    int fd;
 
-    if ((fd = open(path, O_RDWR)) >= 0)
+    if ((fd = open(path, O_RDWR)) < 0)
     {
-        if (fstat(fd, &sb) == 0)
-        {
-            mapped_raw_log->mapped_file.length = (size_t)sb.st_size;
+        aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
+        return -1;
+    }
 
-            if (aeron_mmap(&mapped_raw_log->mapped_file, fd, 0) < 0)
-            {
-                aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
-            }
-        }
-        else
-        {
-            aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
-        }
+    return aeron_map_existing_log_fd(mapped_raw_log, fd, pre_touch);
+}
 
-        mapped_raw_log->log_meta_data.addr =
-            (uint8_t *)mapped_raw_log->mapped_file.addr +
-            (mapped_raw_log->mapped_file.length - AERON_LOGBUFFER_META_DATA_LENGTH);
-        mapped_raw_log->log_meta_data.length = AERON_LOGBUFFER_META_DATA_LENGTH;
+int aeron_map_existing_log_fd(aeron_mapped_raw_log_t *mapped_raw_log, int fd, bool pre_touch)
+{
+    struct stat sb;
 
-        aeron_logbuffer_metadata_t *log_meta_data = (aeron_logbuffer_metadata_t *)mapped_raw_log->log_meta_data.addr;
-        size_t term_length = (size_t)log_meta_data->term_length;
-        size_t page_size = (size_t)log_meta_data->page_size;
+    if (fstat(fd, &sb) != 0)
+    {
+        aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
+        close(fd);
+        return -1;
+    }
 
-        if (aeron_logbuffer_check_term_length(term_length) < 0 ||
-            aeron_logbuffer_check_page_size(page_size) < 0)
-        {
-            aeron_unmap(&mapped_raw_log->mapped_file);
-            return -1;
-        }
+    mapped_raw_log->mapped_file.length = (size_t)sb.st_size;
 
-        mapped_raw_log->term_length = term_length;
+    if (aeron_mmap(&mapped_raw_log->mapped_file, fd, 0) < 0)
+    {
+        aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
+        return -1;
+    }
 
-        for (size_t i = 0; i < AERON_LOGBUFFER_PARTITION_COUNT; i++)
-        {
-            mapped_raw_log->term_buffers[i].addr = (uint8_t *)mapped_raw_log->mapped_file.addr + (i * term_length);
-            mapped_raw_log->term_buffers[i].length = term_length;
-        }
+    mapped_raw_log->log_meta_data.addr =
+        (uint8_t *)mapped_raw_log->mapped_file.addr +
+        (mapped_raw_log->mapped_file.length - AERON_LOGBUFFER_META_DATA_LENGTH);
+    mapped_raw_log->log_meta_data.length = AERON_LOGBUFFER_META_DATA_LENGTH;
 
-        if (pre_touch)
-        {
-            volatile int32_t value = 0;
+    aeron_logbuffer_metadata_t *log_meta_data = (aeron_logbuffer_metadata_t *)mapped_raw_log->log_meta_data.addr;
+    size_t term_length = (size_t)log_meta_data->term_length;
+    size_t page_size = (size_t)log_meta_data->page_size;
 
-            for (size_t i = 0; i < AERON_LOGBUFFER_PARTITION_COUNT; i++)
-            {
-                uint8_t *base_addr = mapped_raw_log->term_buffers[i].addr;
+    if (aeron_logbuffer_check_term_length(term_length) < 0 ||
+        aeron_logbuffer_check_page_size(page_size) < 0)
+    {
+        aeron_unmap(&mapped_raw_log->mapped_file);
+        return -1;
+    }
 
-                for (size_t offset = 0; offset < term_length; offset += page_size)
-                {
-                    aeron_cmpxchg32((volatile int32_t *)(base_addr + offset), value, value);
-                }
-            }
-        }
+    mapped_raw_log->term_length = term_length;
 
-        result = 0;
+    for (size_t i = 0; i < AERON_LOGBUFFER_PARTITION_COUNT; i++)
+    {
+        mapped_raw_log->term_buffers[i].addr = (uint8_t *)mapped_raw_log->mapped_file.addr + (i * term_length);
+        mapped_raw_log->term_buffers[i].length = term_length;
     }
-    else
+
+    if (pre_touch)
     {
-        aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
+        for (size_t i = 0; i < AERON_LOGBUFFER_PARTITION_COUNT; i++)
+        {
+            aeron_pre_touch_mapped_memory(mapped_raw_log->term_buffers[i].addr, term_length, page_size);
+        }
     }
 
-    return result;
+    return 0;
 }
 
 int aeron_map_raw_log_close(aeron_mapped_raw_log_t *mapped_raw_log, const char *filename)
@@ -539,7 +806,13 @@ int aeron_map_raw_log_close(aeron_mapped_raw_log_t *mapped_raw_log, const char *
             return -1;
         }
 
-        if (NULL != filename && remove(filename) < 0)
+        const int memfd = aeron_memfd_log_fd(filename);
+
+        if (memfd >= 0)
+        {
+            close(memfd);
+        }
+        else if (NULL != filename && remove(filename) < 0)
         {
             aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
             return -1;
@@ -43,6 +43,23 @@ int aeron_delete_directory(const char* directory);
 int aeron_map_new_file(aeron_mapped_file_t *mapped_file, const char *path, bool fill_with_zeroes);
 int aeron_map_existing_file(aeron_mapped_file_t *mapped_file, const char *path);
 int aeron_unmap(aeron_mapped_file_t *mapped_file);
+int aeron_advise_huge_pages(aeron_mapped_file_t *mapped_file);
+
+#define AERON_NUMA_NODE_NONE (-1)
+#define AERON_NUMA_NODE_MAX (1024)
+
+int aeron_bind_numa_node(aeron_mapped_file_t *mapped_file, int32_t numa_node);
+
+/*
+ * Lock the pages of a mapping into memory, faulting them in, so later accesses do not take a page fault.
+ */
+int aeron_lock_mapped_file(aeron_mapped_file_t *mapped_file);
+
+/*
+ * Fault in each page of memory shared with another process. Pages are touched with a compare and swap of zero so a
+ * value written concurrently by the other side is never lost.
+ */
+void aeron_pre_touch_mapped_memory(uint8_t *addr, size_t length, size_t page_size);
 
 #if defined(AERON_COMPILER_GCC)
 #include <unistd.h>
@@ -71,6 +88,22 @@ int64_t aeron_file_length(const char *path);
 uint64_t aeron_usable_fs_space(const char *path);
 uint64_t aeron_usable_fs_space_disabled(const char *path);
 
+/*
+ * Wakes a waiter when entries in a directory are created, written or renamed, using inotify on Linux and kqueue on
+ * macOS and the BSDs. Where neither is available, or the directory cannot be watched, awaiting simply sleeps for the
+ * timeout. Writes made through a shared mapping are not reported, so anything signalled that way must still be polled.
+ */
+typedef struct aeron_dir_watcher_stct
+{
+    int fd;
+    int dir_fd;
+}
+aeron_dir_watcher_t;
+
+void aeron_dir_watcher_init(aeron_dir_watcher_t *watcher, const char *path);
+void aeron_dir_watcher_await(aeron_dir_watcher_t *watcher, int64_t timeout_ms);
+void aeron_dir_watcher_close(aeron_dir_watcher_t *watcher);
+
 #define AERON_LOG_META_DATA_SECTION_INDEX (AERON_LOGBUFFER_PARTITION_COUNT)
 
 typedef struct aeron_mapped_raw_log_stct
@@ -84,6 +117,8 @@ aeron_mapped_raw_log_t;
 
 #define AERON_PUBLICATIONS_DIR "publications"
 #define AERON_IMAGES_DIR "images"
+#define AERON_CLIENTS_DIR "clients"
+#define AERON_MEMFD_LOG_PATH_FORMAT "/proc/%" PRId64 "/fd/%d"
 
 int aeron_ipc_publication_location(
     char *dst,
@@ -103,15 +138,26 @@ int aeron_publication_image_location(
     const char *aeron_dir,
     int64_t correlation_id);
 
+int aeron_client_responses_location(
+    char *dst,
+    size_t length,
+    const char *aeron_dir,
+    int64_t client_id);
+
+int aeron_memfd_log_location(char *dst, size_t length, int64_t correlation_id);
+
 size_t aeron_temp_filename(char *filename, size_t length);
 
-typedef int (*aeron_map_raw_log_func_t)(aeron_mapped_raw_log_t *, const char *, bool, uint64_t, uint64_t);
+typedef int (*aeron_map_raw_log_func_t)(
+    aeron_mapped_raw_log_t *, const char *, bool, bool, int32_t, uint64_t, uint64_t);
 typedef int (*aeron_map_raw_log_close_func_t)(aeron_mapped_raw_log_t *, const char *filename);
 
 int aeron_map_raw_log(
     aeron_mapped_raw_log_t *mapped_raw_log,
     const char *path,
     bool use_sparse_files,
+    bool use_huge_pages,
+    int32_t numa_node,
     uint64_t term_length,
     uint64_t page_size);
 
@@ -120,6 +166,11 @@ int aeron_map_existing_log(
     const char *path,
     bool pre_touch);
 
+/*
+ * Map an existing log from an open descriptor, such as one received from the driver, which is closed once mapped.
+ */
+int aeron_map_existing_log_fd(aeron_mapped_raw_log_t *mapped_raw_log, int fd, bool pre_touch);
+
 int aeron_map_raw_log_close(aeron_mapped_raw_log_t *mapped_raw_log, const char *filename);
 
 #endif //AERON_FILEUTIL_H
@@ -0,0 +1,143 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <stdint.h>
+#include <string.h>
+
+#include "util/aeron_platform.h"
+#include "util/aeron_memcpy.h"
+
+#if defined(AERON_CPU_X64)
+#include <emmintrin.h>
+#define AERON_MEMCPY_X64_SSE2
+#if defined(AERON_COMPILER_GCC)
+#include <immintrin.h>
+#define AERON_MEMCPY_X64_AVX2
+#endif
+#endif
+
+extern void aeron_memcpy_bulk(void *dst, const void *src, size_t length, size_t total_length);
+
+typedef void (*aeron_memcpy_func_t)(uint8_t *dst, const uint8_t *src, size_t length);
+
+#if defined(AERON_MEMCPY_X64_SSE2)
+static void aeron_memcpy_non_temporal_sse2(uint8_t *dst, const uint8_t *src, size_t length)
+{
+    size_t head = (16 - ((uintptr_t)dst & 15u)) & 15u;
+    head = head > length ? length : head;
+
+    memcpy(dst, src, head);
+    dst += head;
+    src += head;
+    length -= head;
+
+    for (; length >= 64; length -= 64, dst += 64, src += 64)
+    {
+        const __m128i v0 = _mm_loadu_si128((const __m128i *)src);
+        const __m128i v1 = _mm_loadu_si128((const __m128i *)(src + 16));
+        const __m128i v2 = _mm_loadu_si128((const __m128i *)(src + 32));
+        const __m128i v3 = _mm_loadu_si128((const __m128i *)(src + 48));
+        _mm_stream_si128((__m128i *)dst, v0);
+        _mm_stream_si128((__m128i *)(dst + 16), v1);
+        _mm_stream_si128((__m128i *)(dst + 32), v2);
+        _mm_stream_si128((__m128i *)(dst + 48), v3);
+    }
+
+    for (; length >= 16; length -= 16, dst += 16, src += 16)
+    {
+        _mm_stream_si128((__m128i *)dst, _mm_loadu_si128((const __m128i *)src));
+    }
+
+    memcpy(dst, src, length);
+
+    /* streaming stores are weakly ordered so must be fenced before the copy is released */
+    _mm_sfence();
+}
+#endif
+
+#if defined(AERON_MEMCPY_X64_AVX2)
+__attribute__((target("avx2")))
+static void aeron_memcpy_non_temporal_avx2(uint8_t *dst, const uint8_t *src, size_t length)
+{
+    size_t head = (32 - ((uintptr_t)dst & 31u)) & 31u;
+    head = head > length ? length : head;
+
+    memcpy(dst, src, head);
+    dst += head;
+    src += head;
+    length -= head;
+
+    for (; length >= 128; length -= 128, dst += 128, src += 128)
+    {
+        const __m256i v0 = _mm256_loadu_si256((const __m256i *)src);
+        const __m256i v1 = _mm256_loadu_si256((const __m256i *)(src + 32));
+        const __m256i v2 = _mm256_loadu_si256((const __m256i *)(src + 64));
+        const __m256i v3 = _mm256_loadu_si256((const __m256i *)(src + 96));
+        _mm256_stream_si256((__m256i *)dst, v0);
+        _mm256_stream_si256((__m256i *)(dst + 32), v1);
+        _mm256_stream_si256((__m256i *)(dst + 64), v2);
+        _mm256_stream_si256((__m256i *)(dst + 96), v3);
+    }
+
+    for (; length >= 32; length -= 32, dst += 32, src += 32)
+    {
+        _mm256_stream_si256((__m256i *)dst, _mm256_loadu_si256((const __m256i *)src));
+    }
+
+    memcpy(dst, src, length);
+
+    _mm_sfence();
+}
+#endif
+
+#if !defined(AERON_MEMCPY_X64_SSE2)
+static void aeron_memcpy_non_temporal_generic(uint8_t *dst, const uint8_t *src, size_t length)
+{
+    memcpy(dst, src, length);
+}
+#endif
+
+static aeron_memcpy_func_t aeron_memcpy_non_temporal_func = NULL;
+
+static aeron_memcpy_func_t aeron_memcpy_non_temporal_select(void)
+{
+#if defined(AERON_MEMCPY_X64_AVX2)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return aeron_memcpy_non_temporal_avx2;
+    }
+#endif
+
+#if defined(AERON_MEMCPY_X64_SSE2)
+    return aeron_memcpy_non_temporal_sse2;
+#else
+    return aeron_memcpy_non_temporal_generic;
+#endif
+}
+
+void aeron_memcpy_non_temporal(void *dst, const void *src, size_t length)
+{
+    aeron_memcpy_func_t func = aeron_memcpy_non_temporal_func;
+    if (NULL == func)
+    {
+        func = aeron_memcpy_non_temporal_select();
+        aeron_memcpy_non_temporal_func = func;
+    }
+
+    func((uint8_t *)dst, (const uint8_t *)src, length);
+}
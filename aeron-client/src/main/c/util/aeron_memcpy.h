@@ -0,0 +1,52 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef AERON_MEMCPY_H
+#define AERON_MEMCPY_H
+
+#include <stddef.h>
+#include <string.h>
+
+/*
+ * Copies at or above this length are larger than a typical L2 cache so use non-temporal stores rather than
+ * evicting the working set with data that will not be read again by the writing CPU.
+ */
+#define AERON_MEMCPY_NON_TEMPORAL_THRESHOLD (512 * 1024)
+
+/*
+ * Copy with non-temporal stores, using AVX2 when the CPU supports it and SSE2 otherwise on x64, and memcpy on other
+ * platforms. Stores are fenced before returning so the copy is visible before any following ordered store.
+ */
+void aeron_memcpy_non_temporal(void *dst, const void *src, size_t length);
+
+/*
+ * Copy a region which is part of a larger bulk transfer of total_length bytes, streaming it past the cache when the
+ * transfer as a whole would not fit in L2.
+ */
+inline void aeron_memcpy_bulk(void *dst, const void *src, size_t length, size_t total_length)
+{
+    if (total_length >= AERON_MEMCPY_NON_TEMPORAL_THRESHOLD)
+    {
+        aeron_memcpy_non_temporal(dst, src, length);
+    }
+    else
+    {
+        memcpy(dst, src, length);
+    }
+}
+
+#endif //AERON_MEMCPY_H
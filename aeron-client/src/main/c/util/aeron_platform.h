@@ -40,10 +40,22 @@
 
     #if defined(__x86_64__)
         #define AERON_CPU_X64 1
+    #elif defined(__aarch64__)
+        #define AERON_CPU_ARM64 1
     #endif
 
 #else
     #error Unsupported compiler!
 #endif
 
+/*
+ * Hint that the cache line holding addr will be read soon, keeping it in all cache levels.
+ */
+#if defined(AERON_COMPILER_MSVC)
+    #include <xmmintrin.h>
+    #define AERON_PREFETCH(addr) _mm_prefetch((const char *)(addr), _MM_HINT_T0)
+#else
+    #define AERON_PREFETCH(addr) __builtin_prefetch((addr), 0, 3)
+#endif
+
 #endif
@@ -0,0 +1,147 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+
+#include "util/aeron_slab_allocator.h"
+
+static inline size_t aeron_slab_allocator_size_class(size_t size)
+{
+    return (0 == size ? 0 : (size - 1) / AERON_SLAB_ALLOCATOR_SLOT_ALIGNMENT);
+}
+
+static inline size_t aeron_slab_allocator_slot_length(size_t size_class)
+{
+    return (size_class + 1) * AERON_SLAB_ALLOCATOR_SLOT_ALIGNMENT;
+}
+
+int aeron_slab_allocator_init(aeron_slab_allocator_t *slab_allocator)
+{
+    slab_allocator->allocator.alloc_func = aeron_slab_allocator_alloc;
+    slab_allocator->allocator.free_func = aeron_slab_allocator_free;
+    slab_allocator->allocator.state = slab_allocator;
+
+    for (size_t i = 0; i < AERON_SLAB_ALLOCATOR_SIZE_CLASS_COUNT; i++)
+    {
+        slab_allocator->free_lists[i] = NULL;
+    }
+
+    slab_allocator->chunks = NULL;
+    slab_allocator->chunk_count = 0;
+    slab_allocator->slots_in_use = 0;
+
+    return 0;
+}
+
+void aeron_slab_allocator_close(aeron_slab_allocator_t *slab_allocator)
+{
+    aeron_slab_chunk_t *chunk = slab_allocator->chunks;
+
+    while (NULL != chunk)
+    {
+        aeron_slab_chunk_t *next = chunk->next;
+        aeron_free(chunk->raw);
+        chunk = next;
+    }
+
+    for (size_t i = 0; i < AERON_SLAB_ALLOCATOR_SIZE_CLASS_COUNT; i++)
+    {
+        slab_allocator->free_lists[i] = NULL;
+    }
+
+    slab_allocator->chunks = NULL;
+    slab_allocator->chunk_count = 0;
+    slab_allocator->slots_in_use = 0;
+}
+
+static int aeron_slab_allocator_add_chunk(aeron_slab_allocator_t *slab_allocator, size_t size_class)
+{
+    void *raw = NULL;
+    size_t offset = 0;
+
+    if (aeron_alloc_aligned(&raw, &offset, AERON_SLAB_ALLOCATOR_CHUNK_LENGTH, AERON_SLAB_ALLOCATOR_SLOT_ALIGNMENT) < 0)
+    {
+        return -1;
+    }
+
+    uint8_t *base = (uint8_t *)raw + offset;
+    aeron_slab_chunk_t *chunk = (aeron_slab_chunk_t *)base;
+    chunk->raw = raw;
+    chunk->next = slab_allocator->chunks;
+    slab_allocator->chunks = chunk;
+    slab_allocator->chunk_count++;
+
+    /* The first slot holds the chunk header. */
+    const size_t slot_length = aeron_slab_allocator_slot_length(size_class);
+    const size_t slot_count =
+        (AERON_SLAB_ALLOCATOR_CHUNK_LENGTH - AERON_SLAB_ALLOCATOR_SLOT_ALIGNMENT) / slot_length;
+    void *free_list = slab_allocator->free_lists[size_class];
+
+    for (size_t i = slot_count; i > 0; i--)
+    {
+        void **slot = (void **)(base + AERON_SLAB_ALLOCATOR_SLOT_ALIGNMENT + ((i - 1) * slot_length));
+        *slot = free_list;
+        free_list = slot;
+    }
+
+    slab_allocator->free_lists[size_class] = free_list;
+
+    return 0;
+}
+
+int aeron_slab_allocator_alloc(void *state, void **ptr, size_t size)
+{
+    aeron_slab_allocator_t *slab_allocator = (aeron_slab_allocator_t *)state;
+
+    if (size > AERON_SLAB_ALLOCATOR_MAX_SLOT_LENGTH)
+    {
+        return aeron_alloc(ptr, size);
+    }
+
+    const size_t size_class = aeron_slab_allocator_size_class(size);
+
+    if (NULL == slab_allocator->free_lists[size_class] && aeron_slab_allocator_add_chunk(slab_allocator, size_class) < 0)
+    {
+        return -1;
+    }
+
+    void **slot = (void **)slab_allocator->free_lists[size_class];
+    slab_allocator->free_lists[size_class] = *slot;
+    slab_allocator->slots_in_use++;
+
+    memset(slot, 0, aeron_slab_allocator_slot_length(size_class));
+    *ptr = slot;
+
+    return 0;
+}
+
+void aeron_slab_allocator_free(void *state, void *ptr, size_t size)
+{
+    aeron_slab_allocator_t *slab_allocator = (aeron_slab_allocator_t *)state;
+
+    if (size > AERON_SLAB_ALLOCATOR_MAX_SLOT_LENGTH)
+    {
+        aeron_free(ptr);
+        return;
+    }
+
+    const size_t size_class = aeron_slab_allocator_size_class(size);
+    void **slot = (void **)ptr;
+
+    *slot = slab_allocator->free_lists[size_class];
+    slab_allocator->free_lists[size_class] = slot;
+    slab_allocator->slots_in_use--;
+}
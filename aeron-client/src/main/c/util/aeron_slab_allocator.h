@@ -0,0 +1,66 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_SLAB_ALLOCATOR_H
+#define AERON_SLAB_ALLOCATOR_H
+
+#include <stddef.h>
+
+#include "aeron_alloc.h"
+#include "util/aeron_bitutil.h"
+
+#define AERON_SLAB_ALLOCATOR_SLOT_ALIGNMENT (AERON_CACHE_LINE_LENGTH)
+#define AERON_SLAB_ALLOCATOR_MAX_SLOT_LENGTH (4096)
+#define AERON_SLAB_ALLOCATOR_SIZE_CLASS_COUNT (AERON_SLAB_ALLOCATOR_MAX_SLOT_LENGTH / AERON_SLAB_ALLOCATOR_SLOT_ALIGNMENT)
+#define AERON_SLAB_ALLOCATOR_CHUNK_LENGTH (64 * 1024)
+
+typedef struct aeron_slab_chunk_stct
+{
+    struct aeron_slab_chunk_stct *next;
+    void *raw;
+}
+aeron_slab_chunk_t;
+
+/*
+ * Arena of slabs for resources owned by a single agent. Sizes are rounded up to a cache line and each size class
+ * carves its slots from 64KB chunks, so slots are cache line aligned and resources of a kind sit together. Freed slots
+ * go back on the free list of their class and chunks are only returned to the system on close. Sizes over
+ * AERON_SLAB_ALLOCATOR_MAX_SLOT_LENGTH go to the system allocator.
+ *
+ * Not thread safe, all calls must be made by the owning agent.
+ */
+typedef struct aeron_slab_allocator_stct
+{
+    aeron_allocator_t allocator;
+    void *free_lists[AERON_SLAB_ALLOCATOR_SIZE_CLASS_COUNT];
+    aeron_slab_chunk_t *chunks;
+    size_t chunk_count;
+    size_t slots_in_use;
+}
+aeron_slab_allocator_t;
+
+int aeron_slab_allocator_init(aeron_slab_allocator_t *slab_allocator);
+
+/*
+ * Return all chunks to the system. Any slots still in use are freed with them.
+ */
+void aeron_slab_allocator_close(aeron_slab_allocator_t *slab_allocator);
+
+int aeron_slab_allocator_alloc(void *state, void **ptr, size_t size);
+
+void aeron_slab_allocator_free(void *state, void *ptr, size_t size);
+
+#endif //AERON_SLAB_ALLOCATOR_H
@@ -17,14 +17,15 @@
 #define _DISABLE_EXTENDED_ALIGNED_STORAGE
 
 #include "Aeron.h"
+#include "util/DirectoryWatcher.h"
 
 namespace aeron
 {
 
 static const std::chrono::duration<long, std::milli> IDLE_SLEEP_MS(4);
-static const std::chrono::duration<long, std::milli> IDLE_SLEEP_MS_1(1);
-static const std::chrono::duration<long, std::milli> IDLE_SLEEP_MS_16(16);
-static const std::chrono::duration<long, std::milli> IDLE_SLEEP_MS_100(100);
+static const std::chrono::milliseconds IDLE_SLEEP_MS_1(1);
+static const std::chrono::milliseconds IDLE_SLEEP_MS_16(16);
+static const std::chrono::milliseconds IDLE_SLEEP_MS_100(100);
 
 static const char *AGENT_NAME = "client-conductor";
 
@@ -37,6 +38,7 @@ Aeron::Aeron(Context &context) :
     m_toClientsAtomicBuffer(CncFileDescriptor::createToClientsBuffer(m_cncBuffer)),
     m_countersMetadataBuffer(CncFileDescriptor::createCounterMetadataBuffer(m_cncBuffer)),
     m_countersValueBuffer(CncFileDescriptor::createCounterValuesBuffer(m_cncBuffer)),
+    m_countersCompactBuffer(CncFileDescriptor::createCounterCompactBuffer(m_cncBuffer)),
     m_toDriverRingBuffer(m_toDriverAtomicBuffer),
     m_driverProxy(m_toDriverRingBuffer),
     m_toClientsBroadcastReceiver(m_toClientsAtomicBuffer),
@@ -47,6 +49,7 @@ Aeron::Aeron(Context &context) :
         m_toClientsCopyReceiver,
         m_countersMetadataBuffer,
         m_countersValueBuffer,
+        m_countersCompactBuffer,
         m_context.m_onNewPublicationHandler,
         m_context.m_onNewExclusivePublicationHandler,
         m_context.m_onNewSubscriptionHandler,
@@ -57,7 +60,8 @@ Aeron::Aeron(Context &context) :
         m_context.m_mediaDriverTimeout,
         m_context.m_resourceLingerTimeout,
         CncFileDescriptor::clientLivenessTimeout(m_cncBuffer),
-        m_context.m_preTouchMappedMemory),
+        m_context.m_preTouchMappedMemory,
+        m_context.m_lockMappedMemory),
     m_idleStrategy(IDLE_SLEEP_MS),
     m_conductorRunner(m_conductor, m_idleStrategy, m_context.m_exceptionHandler, AGENT_NAME),
     m_conductorInvoker(m_conductor, m_context.m_exceptionHandler)
@@ -68,6 +72,7 @@ Aeron::Aeron(Context &context) :
     }
     else
     {
+        m_conductorRunner.threadConfig(m_context.m_conductorCpuAffinity, m_context.m_conductorFifoPriority);
         m_conductorRunner.start();
     }
 }
@@ -92,6 +97,18 @@ MemoryMappedFile::ptr_t Aeron::mapCncFile(Context &context)
     const long long deadlineMs = currentTimeMillis() + context.m_mediaDriverTimeout;
     const std::string &filename = context.cncFileName();
     MemoryMappedFile::ptr_t cncBuffer;
+    util::DirectoryWatcher watcher(context.m_dirName);
+    const auto idle = [&context]()
+    {
+        if (context.m_driverConnectSpin)
+        {
+            aeron::concurrent::atomic::cpu_pause();
+        }
+        else
+        {
+            std::this_thread::sleep_for(IDLE_SLEEP_MS_1);
+        }
+    };
 
     while (true)
     {
@@ -102,14 +119,15 @@ MemoryMappedFile::ptr_t Aeron::mapCncFile(Context &context)
                 throw DriverTimeoutException("CnC file not created: " + filename, SOURCEINFO);
             }
 
-            std::this_thread::sleep_for(IDLE_SLEEP_MS_16);
+            watcher.retry();
+            watcher.await(IDLE_SLEEP_MS_16);
         }
 
         cncBuffer = MemoryMappedFile::mapExisting(filename.c_str());
         if (cncBuffer->getMemorySize() <= static_cast<size_t>(minLength))
         {
             cncBuffer = nullptr;
-            std::this_thread::sleep_for(IDLE_SLEEP_MS_1);
+            idle();
             continue;
         }
 
@@ -122,7 +140,7 @@ MemoryMappedFile::ptr_t Aeron::mapCncFile(Context &context)
                     "CnC file is created but not initialised: " + filename, SOURCEINFO);
             }
 
-            std::this_thread::sleep_for(IDLE_SLEEP_MS_1);
+            idle();
         }
 
         if (semanticVersionMajor(cncVersion) != semanticVersionMajor(CncFileDescriptor::CNC_VERSION))
@@ -136,7 +154,7 @@ MemoryMappedFile::ptr_t Aeron::mapCncFile(Context &context)
         if (!CncFileDescriptor::isCncFileLengthSufficient(cncBuffer))
         {
             cncBuffer = nullptr;
-            std::this_thread::sleep_for(IDLE_SLEEP_MS_1);
+            idle();
             continue;
         }
 
@@ -150,7 +168,7 @@ MemoryMappedFile::ptr_t Aeron::mapCncFile(Context &context)
                 throw DriverTimeoutException(std::string("no driver heartbeat detected"), SOURCEINFO);
             }
 
-            std::this_thread::sleep_for(IDLE_SLEEP_MS_1);
+            idle();
         }
 
         const long long timeMs = currentTimeMillis();
@@ -162,13 +180,30 @@ MemoryMappedFile::ptr_t Aeron::mapCncFile(Context &context)
             }
 
             cncBuffer = nullptr;
-            std::this_thread::sleep_for(IDLE_SLEEP_MS_100);
+            watcher.await(IDLE_SLEEP_MS_100);
             continue;
         }
 
         break;
     }
 
+    if (context.m_lockMappedMemory)
+    {
+        cncBuffer->lock();
+    }
+
+    if (context.m_preTouchMappedMemory)
+    {
+        AtomicBuffer buffer(cncBuffer->getMemoryPtr(), cncBuffer->getMemorySize());
+        const auto pageSize = static_cast<util::index_t>(MemoryMappedFile::getPageSize());
+        volatile std::int32_t value = 0;
+
+        for (util::index_t offset = 0; offset < buffer.capacity(); offset += pageSize)
+        {
+            buffer.compareAndSetInt32(offset, value, value);
+        }
+    }
+
     return cncBuffer;
 }
 
@@ -452,6 +452,7 @@ private:
     AtomicBuffer m_toClientsAtomicBuffer;
     AtomicBuffer m_countersMetadataBuffer;
     AtomicBuffer m_countersValueBuffer;
+    AtomicBuffer m_countersCompactBuffer;
 
     ManyToOneRingBuffer m_toDriverRingBuffer;
     DriverProxy m_driverProxy;
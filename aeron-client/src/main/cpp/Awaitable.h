@@ -0,0 +1,311 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef AERON_AWAITABLE_H
+#define AERON_AWAITABLE_H
+
+#if defined(__has_include)
+#if __has_include(<coroutine>) && defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+#define AERON_HAS_COROUTINES 1
+#endif
+#endif
+
+#if defined(AERON_HAS_COROUTINES)
+
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <vector>
+
+#include "Aeron.h"
+
+namespace aeron
+{
+
+class AwaitScheduler;
+
+/// @cond HIDDEN_SYMBOLS
+class PendingAwait
+{
+    friend class AwaitScheduler;
+
+public:
+    virtual ~PendingAwait() = default;
+
+protected:
+    virtual bool tryComplete() = 0;
+
+    std::coroutine_handle<> m_handle;
+    AwaitScheduler *m_scheduler = nullptr;
+};
+/// @endcond
+
+/**
+ * Resumes coroutines suspended on a PollAwaitable once the operation they are waiting on completes. Intended to be
+ * driven from a single threaded event loop, optionally together with the client conductor via an AgentInvoker, so
+ * that many registrations can be in flight without a hand written polling state machine for each.
+ * <p>
+ * This class is not threadsafe and poll must not be called reentrantly from a resumed coroutine.
+ */
+class AwaitScheduler
+{
+public:
+    AwaitScheduler() = default;
+
+    AwaitScheduler(const AwaitScheduler &) = delete;
+
+    AwaitScheduler &operator=(const AwaitScheduler &) = delete;
+
+    /**
+     * Check each suspended operation for completion and resume the coroutines of those which have completed.
+     *
+     * @return the number of coroutines resumed.
+     */
+    int poll()
+    {
+        m_ready.clear();
+
+        for (std::size_t i = 0; i < m_pending.size();)
+        {
+            PendingAwait *pending = m_pending[i];
+
+            if (pending->tryComplete())
+            {
+                m_pending[i] = m_pending.back();
+                m_pending.pop_back();
+                pending->m_scheduler = nullptr;
+                m_ready.push_back(pending->m_handle);
+            }
+            else
+            {
+                i++;
+            }
+        }
+
+        for (std::coroutine_handle<> handle : m_ready)
+        {
+            handle.resume();
+        }
+
+        return static_cast<int>(m_ready.size());
+    }
+
+    /**
+     * Invoke the agent, e.g. the client conductor when Context::useConductorAgentInvoker is set, then check each
+     * suspended operation for completion.
+     *
+     * @param invoker for the agent to be invoked.
+     * @return the work count of the agent plus the number of coroutines resumed.
+     */
+    template<typename Agent>
+    int poll(AgentInvoker<Agent> &invoker)
+    {
+        const int workCount = invoker.invoke();
+
+        return workCount + poll();
+    }
+
+    /**
+     * Number of operations with a coroutine suspended waiting on them.
+     *
+     * @return number of operations with a coroutine suspended waiting on them.
+     */
+    std::size_t pendingCount() const
+    {
+        return m_pending.size();
+    }
+
+    /// @cond HIDDEN_SYMBOLS
+    void add(PendingAwait *pending)
+    {
+        pending->m_scheduler = this;
+        m_pending.push_back(pending);
+    }
+
+    void remove(PendingAwait *pending)
+    {
+        for (std::size_t i = 0, size = m_pending.size(); i < size; i++)
+        {
+            if (m_pending[i] == pending)
+            {
+                m_pending[i] = m_pending.back();
+                m_pending.pop_back();
+                pending->m_scheduler = nullptr;
+                break;
+            }
+        }
+    }
+    /// @endcond
+
+private:
+    std::vector<PendingAwait *> m_pending;
+    std::vector<std::coroutine_handle<>> m_ready;
+};
+
+/**
+ * Awaitable which completes when a poll function returns a non-null result, such as Aeron::findPublication or
+ * AeronArchive::AsyncConnect::poll, or throws. The exception is rethrown to the awaiting coroutine.
+ * <p>
+ * The poll function is called once when awaited and then on each AwaitScheduler::poll until it completes.
+ *
+ * @tparam T result of the poll function, which must be testable as a bool, e.g. a std::shared_ptr.
+ */
+template<typename T>
+class PollAwaitable : public PendingAwait
+{
+public:
+    PollAwaitable(AwaitScheduler &scheduler, std::function<T()> poller) :
+        m_awaitScheduler(scheduler), m_poller(std::move(poller))
+    {
+    }
+
+    PollAwaitable(const PollAwaitable &) = delete;
+
+    PollAwaitable &operator=(const PollAwaitable &) = delete;
+
+    ~PollAwaitable() override
+    {
+        if (nullptr != PendingAwait::m_scheduler)
+        {
+            PendingAwait::m_scheduler->remove(this);
+        }
+    }
+
+    bool await_ready()
+    {
+        return tryComplete();
+    }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        m_handle = handle;
+        m_awaitScheduler.add(this);
+    }
+
+    T await_resume()
+    {
+        if (m_exception)
+        {
+            std::rethrow_exception(m_exception);
+        }
+
+        return std::move(m_result);
+    }
+
+protected:
+    bool tryComplete() override
+    {
+        try
+        {
+            m_result = m_poller();
+        }
+        catch (...)
+        {
+            m_exception = std::current_exception();
+            return true;
+        }
+
+        return static_cast<bool>(m_result);
+    }
+
+private:
+    AwaitScheduler &m_awaitScheduler;
+    std::function<T()> m_poller;
+    T m_result{};
+    std::exception_ptr m_exception;
+};
+
+/**
+ * Add a Publication and await it being ready for use.
+ *
+ * @param scheduler to resume the awaiting coroutine.
+ * @param aeron     client to add the Publication with.
+ * @param channel   for sending the messages known to the media layer.
+ * @param streamId  within the channel scope.
+ * @return awaitable for the Publication.
+ */
+inline PollAwaitable<std::shared_ptr<Publication>> asyncAddPublication(
+    AwaitScheduler &scheduler, Aeron &aeron, const std::string &channel, std::int32_t streamId)
+{
+    const std::int64_t registrationId = aeron.addPublication(channel, streamId);
+
+    return { scheduler, [&aeron, registrationId]() { return aeron.findPublication(registrationId); } };
+}
+
+/**
+ * Add an ExclusivePublication and await it being ready for use.
+ *
+ * @param scheduler to resume the awaiting coroutine.
+ * @param aeron     client to add the ExclusivePublication with.
+ * @param channel   for sending the messages known to the media layer.
+ * @param streamId  within the channel scope.
+ * @return awaitable for the ExclusivePublication.
+ */
+inline PollAwaitable<std::shared_ptr<ExclusivePublication>> asyncAddExclusivePublication(
+    AwaitScheduler &scheduler, Aeron &aeron, const std::string &channel, std::int32_t streamId)
+{
+    const std::int64_t registrationId = aeron.addExclusivePublication(channel, streamId);
+
+    return { scheduler, [&aeron, registrationId]() { return aeron.findExclusivePublication(registrationId); } };
+}
+
+/**
+ * Add a Subscription and await it being ready for use.
+ *
+ * @param scheduler to resume the awaiting coroutine.
+ * @param aeron     client to add the Subscription with.
+ * @param channel   for receiving the messages known to the media layer.
+ * @param streamId  within the channel scope.
+ * @return awaitable for the Subscription.
+ */
+inline PollAwaitable<std::shared_ptr<Subscription>> asyncAddSubscription(
+    AwaitScheduler &scheduler, Aeron &aeron, const std::string &channel, std::int32_t streamId)
+{
+    const std::int64_t registrationId = aeron.addSubscription(channel, streamId);
+
+    return { scheduler, [&aeron, registrationId]() { return aeron.findSubscription(registrationId); } };
+}
+
+/**
+ * Allocate a Counter and await it being ready for use.
+ *
+ * @param scheduler  to resume the awaiting coroutine.
+ * @param aeron      client to allocate the Counter with.
+ * @param typeId     for the counter.
+ * @param keyBuffer  containing the optional key for the counter.
+ * @param keyLength  of the key in the keyBuffer.
+ * @param label      for the counter.
+ * @return awaitable for the Counter.
+ */
+inline PollAwaitable<std::shared_ptr<Counter>> asyncAddCounter(
+    AwaitScheduler &scheduler,
+    Aeron &aeron,
+    std::int32_t typeId,
+    const std::uint8_t *keyBuffer,
+    std::size_t keyLength,
+    const std::string &label)
+{
+    const std::int64_t registrationId = aeron.addCounter(typeId, keyBuffer, keyLength, label);
+
+    return { scheduler, [&aeron, registrationId]() { return aeron.findCounter(registrationId); } };
+}
+
+}
+
+#endif
+
+#endif
@@ -36,6 +36,11 @@ static ExceptionCategory getCategory(std::int32_t errorCode)
         ExceptionCategory::EXCEPTION_CATEGORY_WARN : ExceptionCategory::EXCEPTION_CATEGORY_ERROR;
 }
 
+static void deleteImageArray(void *item)
+{
+    delete[] static_cast<Image::array_t>(item);
+}
+
 ClientConductor::~ClientConductor()
 {
     std::for_each(m_lingeringImageLists.begin(), m_lingeringImageLists.end(),
@@ -80,6 +85,7 @@ std::int64_t ClientConductor::addPublication(const std::string &channel, std::in
     ensureOpen();
 
     std::int64_t registrationId = m_driverProxy.addPublication(channel, streamId);
+    trackPendingRegistration(registrationId, m_epochClock());
 
     m_publicationByRegistrationId.insert(std::pair<std::int64_t, PublicationStateDefn>(
         registrationId,
@@ -90,6 +96,11 @@ std::int64_t ClientConductor::addPublication(const std::string &channel, std::in
 
 std::shared_ptr<Publication> ClientConductor::findPublication(std::int64_t registrationId)
 {
+    if (isAwaitingMediaDriver(registrationId))
+    {
+        return std::shared_ptr<Publication>();
+    }
+
     std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     ensureNotReentrant();
     ensureOpen();
@@ -110,6 +121,7 @@ std::shared_ptr<Publication> ClientConductor::findPublication(std::int64_t regis
             case RegistrationStatus::AWAITING_MEDIA_DRIVER:
                 if (m_epochClock() > (state.m_timeOfRegistrationMs + m_driverTimeoutMs))
                 {
+                    clearPendingRegistration(registrationId);
                     throw DriverTimeoutException(
                         "no response from driver in " + std::to_string(m_driverTimeoutMs) + " ms", SOURCEINFO);
                 }
@@ -170,6 +182,7 @@ std::int64_t ClientConductor::addExclusivePublication(const std::string &channel
     ensureOpen();
 
     std::int64_t registrationId = m_driverProxy.addExclusivePublication(channel, streamId);
+    trackPendingRegistration(registrationId, m_epochClock());
 
     m_exclusivePublicationByRegistrationId.insert(std::pair<std::int64_t, ExclusivePublicationStateDefn>(
         registrationId,
@@ -180,6 +193,11 @@ std::int64_t ClientConductor::addExclusivePublication(const std::string &channel
 
 std::shared_ptr<ExclusivePublication> ClientConductor::findExclusivePublication(std::int64_t registrationId)
 {
+    if (isAwaitingMediaDriver(registrationId))
+    {
+        return std::shared_ptr<ExclusivePublication>();
+    }
+
     std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     ensureNotReentrant();
     ensureOpen();
@@ -200,6 +218,7 @@ std::shared_ptr<ExclusivePublication> ClientConductor::findExclusivePublication(
             case RegistrationStatus::AWAITING_MEDIA_DRIVER:
                 if (m_epochClock() > (state.m_timeOfRegistrationMs + m_driverTimeoutMs))
                 {
+                    clearPendingRegistration(registrationId);
                     throw DriverTimeoutException(
                         "no response from driver in " + std::to_string(m_driverTimeoutMs) + " ms", SOURCEINFO);
                 }
@@ -263,6 +282,7 @@ std::int64_t ClientConductor::addSubscription(
     ensureOpen();
 
     std::int64_t registrationId = m_driverProxy.addSubscription(channel, streamId);
+    trackPendingRegistration(registrationId, m_epochClock());
 
     m_subscriptionByRegistrationId.insert(std::pair<std::int64_t, SubscriptionStateDefn>(
         registrationId,
@@ -274,6 +294,11 @@ std::int64_t ClientConductor::addSubscription(
 
 std::shared_ptr<Subscription> ClientConductor::findSubscription(std::int64_t registrationId)
 {
+    if (isAwaitingMediaDriver(registrationId))
+    {
+        return std::shared_ptr<Subscription>();
+    }
+
     std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     ensureNotReentrant();
     ensureOpen();
@@ -296,6 +321,7 @@ std::shared_ptr<Subscription> ClientConductor::findSubscription(std::int64_t reg
     {
         if (m_epochClock() > (state.m_timeOfRegistrationMs + m_driverTimeoutMs))
         {
+            clearPendingRegistration(registrationId);
             throw DriverTimeoutException(
                 "no response from driver in " + std::to_string(m_driverTimeoutMs) + " ms", SOURCEINFO);
         }
@@ -341,6 +367,12 @@ void ClientConductor::releaseSubscription(std::int64_t registrationId, Image::ar
     }
 }
 
+void ClientConductor::removeEpochParticipant(EpochReclaimer::Participant &participant)
+{
+    std::lock_guard<std::recursive_mutex> lock(m_adminLock);
+    m_epochReclaimer.removeParticipant(participant);
+}
+
 std::int64_t ClientConductor::addCounter(
     std::int32_t typeId, const std::uint8_t *keyBuffer, std::size_t keyLength, const std::string &label)
 {
@@ -360,6 +392,7 @@ std::int64_t ClientConductor::addCounter(
     }
 
     std::int64_t registrationId = m_driverProxy.addCounter(typeId, keyBuffer, keyLength, label);
+    trackPendingRegistration(registrationId, m_epochClock());
 
     m_counterByRegistrationId.insert(std::pair<std::int64_t, CounterStateDefn>(
         registrationId, CounterStateDefn(registrationId, m_epochClock())));
@@ -369,6 +402,11 @@ std::int64_t ClientConductor::addCounter(
 
 std::shared_ptr<Counter> ClientConductor::findCounter(std::int64_t registrationId)
 {
+    if (isAwaitingMediaDriver(registrationId))
+    {
+        return std::shared_ptr<Counter>();
+    }
+
     std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     ensureNotReentrant();
     ensureOpen();
@@ -391,6 +429,7 @@ std::shared_ptr<Counter> ClientConductor::findCounter(std::int64_t registrationI
     {
         if (m_epochClock() > (state.m_timeOfRegistrationMs + m_driverTimeoutMs))
         {
+            clearPendingRegistration(registrationId);
             throw DriverTimeoutException(
                 "no response from driver in " + std::to_string(m_driverTimeoutMs) + " ms", SOURCEINFO);
         }
@@ -431,6 +470,7 @@ std::int64_t ClientConductor::addDestination(
     ensureOpen();
 
     std::int64_t correlationId = m_driverProxy.addDestination(publicationRegistrationId, endpointChannel);
+    trackPendingRegistration(correlationId, m_epochClock());
 
     m_destinationStateByCorrelationId.insert(std::pair<std::int64_t, DestinationStateDefn>(
         correlationId,
@@ -448,6 +488,7 @@ std::int64_t ClientConductor::removeDestination(
     ensureOpen();
 
     std::int64_t correlationId = m_driverProxy.removeDestination(publicationRegistrationId, endpointChannel);
+    trackPendingRegistration(correlationId, m_epochClock());
 
     m_destinationStateByCorrelationId.insert(std::pair<std::int64_t, DestinationStateDefn>(
         correlationId,
@@ -465,6 +506,7 @@ std::int64_t ClientConductor::addRcvDestination(
     ensureOpen();
 
     std::int64_t correlationId = m_driverProxy.addRcvDestination(subscriptionRegistrationId, endpointChannel);
+    trackPendingRegistration(correlationId, m_epochClock());
 
     m_destinationStateByCorrelationId.insert(std::pair<std::int64_t, DestinationStateDefn>(
         correlationId,
@@ -482,6 +524,7 @@ std::int64_t ClientConductor::removeRcvDestination(
     ensureOpen();
 
     std::int64_t correlationId = m_driverProxy.removeRcvDestination(subscriptionRegistrationId, endpointChannel);
+    trackPendingRegistration(correlationId, m_epochClock());
 
     m_destinationStateByCorrelationId.insert(std::pair<std::int64_t, DestinationStateDefn>(
         correlationId,
@@ -492,6 +535,11 @@ std::int64_t ClientConductor::removeRcvDestination(
 
 bool ClientConductor::findDestinationResponse(std::int64_t correlationId)
 {
+    if (isAwaitingMediaDriver(correlationId))
+    {
+        return false;
+    }
+
     std::lock_guard<std::recursive_mutex> lock(m_adminLock);
     ensureNotReentrant();
     ensureOpen();
@@ -512,6 +560,7 @@ bool ClientConductor::findDestinationResponse(std::int64_t correlationId)
             if (m_epochClock() > (state.m_timeOfRegistrationMs + m_driverTimeoutMs))
             {
                 m_destinationStateByCorrelationId.erase(it);
+                clearPendingRegistration(correlationId);
                 throw DriverTimeoutException(
                     "no response from driver in " + std::to_string(m_driverTimeoutMs) + " ms", SOURCEINFO);
             }
@@ -686,6 +735,8 @@ void ClientConductor::onNewPublication(
     std::int32_t channelStatusIndicatorId,
     const std::string &logFileName)
 {
+    clearPendingRegistration(registrationId);
+
     auto it = m_publicationByRegistrationId.find(registrationId);
     if (it != m_publicationByRegistrationId.end())
     {
@@ -714,6 +765,8 @@ void ClientConductor::onNewExclusivePublication(
 {
     assert(registrationId == originalRegistrationId);
 
+    clearPendingRegistration(registrationId);
+
     auto it = m_exclusivePublicationByRegistrationId.find(registrationId);
     if (it != m_exclusivePublicationByRegistrationId.end())
     {
@@ -732,6 +785,8 @@ void ClientConductor::onNewExclusivePublication(
 
 void ClientConductor::onSubscriptionReady(std::int64_t registrationId, std::int32_t channelStatusId)
 {
+    clearPendingRegistration(registrationId);
+
     auto it = m_subscriptionByRegistrationId.find(registrationId);
     if (it != m_subscriptionByRegistrationId.end() && it->second.m_status == RegistrationStatus::AWAITING_MEDIA_DRIVER)
     {
@@ -741,6 +796,7 @@ void ClientConductor::onSubscriptionReady(std::int64_t registrationId, std::int3
         state.m_subscriptionCache = std::make_shared<Subscription>(
             *this, state.m_registrationId, state.m_channel, state.m_streamId, channelStatusId);
         state.m_subscription = std::weak_ptr<Subscription>(state.m_subscriptionCache);
+        m_epochReclaimer.addParticipant(state.m_subscriptionCache->epochParticipant());
 
         CallbackGuard callbackGuard(m_isInCallback);
         m_onNewSubscriptionHandler(state.m_channel, state.m_streamId, registrationId);
@@ -749,6 +805,8 @@ void ClientConductor::onSubscriptionReady(std::int64_t registrationId, std::int3
 
 void ClientConductor::onAvailableCounter(std::int64_t registrationId, std::int32_t counterId)
 {
+    clearPendingRegistration(registrationId);
+
     auto it = m_counterByRegistrationId.find(registrationId);
     if (it != m_counterByRegistrationId.end() && it->second.m_status == RegistrationStatus::AWAITING_MEDIA_DRIVER)
     {
@@ -779,6 +837,8 @@ void ClientConductor::onUnavailableCounter(std::int64_t registrationId, std::int
 
 void ClientConductor::onOperationSuccess(std::int64_t correlationId)
 {
+    clearPendingRegistration(correlationId);
+
     auto it = m_destinationStateByCorrelationId.find(correlationId);
     if (it != m_destinationStateByCorrelationId.end() &&
         it->second.m_status == RegistrationStatus::AWAITING_MEDIA_DRIVER)
@@ -865,6 +925,8 @@ void ClientConductor::onChannelEndpointErrorResponse(std::int32_t channelStatusI
 void ClientConductor::onErrorResponse(
     std::int64_t offendingCommandCorrelationId, std::int32_t errorCode, const std::string &errorMessage)
 {
+    clearPendingRegistration(offendingCommandCorrelationId);
+
     auto subIt = m_subscriptionByRegistrationId.find(offendingCommandCorrelationId);
     if (subIt != m_subscriptionByRegistrationId.end())
     {
@@ -1105,7 +1167,7 @@ void ClientConductor::onCheckManagedResources(long long nowMs)
         {
             if ((nowMs - m_resourceLingerTimeoutMs) > entry.m_timeOfLastStateChangeMs)
             {
-                delete[] entry.m_imageArray;
+                m_epochReclaimer.retire(entry.m_imageArray, deleteImageArray);
                 entry.m_imageArray = nullptr;
 
                 return true;
@@ -1115,6 +1177,7 @@ void ClientConductor::onCheckManagedResources(long long nowMs)
         });
 
     m_lingeringImageLists.erase(arrayIt, m_lingeringImageLists.end());
+    m_epochReclaimer.reclaim();
 }
 
 void ClientConductor::lingerResource(long long nowMs, Image::array_t imageArray)
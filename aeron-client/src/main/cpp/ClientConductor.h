@@ -58,6 +58,7 @@ public:
         CopyBroadcastReceiver &broadcastReceiver,
         AtomicBuffer &counterMetadataBuffer,
         AtomicBuffer &counterValuesBuffer,
+        AtomicBuffer &counterCompactBuffer,
         const on_new_publication_t &newPublicationHandler,
         const on_new_publication_t &newExclusivePublicationHandler,
         const on_new_subscription_t &newSubscriptionHandler,
@@ -68,10 +69,11 @@ public:
         long driverTimeoutMs,
         long resourceLingerTimeoutMs,
         long long interServiceTimeoutNs,
-        bool preTouchMappedMemory) :
+        bool preTouchMappedMemory,
+        bool lockMappedMemory) :
         m_driverProxy(driverProxy),
         m_driverListenerAdapter(broadcastReceiver, *this),
-        m_countersReader(counterMetadataBuffer, counterValuesBuffer),
+        m_countersReader(counterMetadataBuffer, counterValuesBuffer, counterCompactBuffer),
         m_counterValuesBuffer(counterValuesBuffer),
         m_onNewPublicationHandler(newPublicationHandler),
         m_onNewExclusivePublicationHandler(newExclusivePublicationHandler),
@@ -82,6 +84,7 @@ public:
         m_resourceLingerTimeoutMs(resourceLingerTimeoutMs),
         m_interServiceTimeoutMs(static_cast<long>(interServiceTimeoutNs / 1000000)),
         m_preTouchMappedMemory(preTouchMappedMemory),
+        m_lockMappedMemory(lockMappedMemory),
         m_driverActive(true),
         m_isClosed(false),
         m_timeOfLastDoWorkMs(m_epochClock()),
@@ -126,6 +129,8 @@ public:
 
     void releaseSubscription(std::int64_t registrationId, Image::array_t imageArray, std::size_t length);
 
+    void removeEpochParticipant(EpochReclaimer::Participant &participant);
+
     std::int64_t addCounter(
         std::int32_t typeId,
         const std::uint8_t *keyBuffer,
@@ -249,6 +254,18 @@ private:
         AWAITING_MEDIA_DRIVER, REGISTERED_MEDIA_DRIVER, ERRORED_MEDIA_DRIVER
     };
 
+    static const std::size_t PENDING_REGISTRATION_SLOTS = 1024;
+
+    /*
+     * Registrations awaiting a response from the media driver, readable without the admin lock so callers polling
+     * the find methods don't contend with the conductor. Slots are only written under the admin lock.
+     */
+    struct PendingRegistrationSlot
+    {
+        std::atomic<std::int64_t> m_registrationId{ NULL_VALUE };
+        std::atomic<long long> m_deadlineMs{ 0 };
+    };
+
     struct PublicationStateDefn
     {
         std::string m_errorMessage;
@@ -390,6 +407,8 @@ private:
         }
     };
 
+    EpochReclaimer m_epochReclaimer;
+
     std::unordered_map<std::int64_t, PublicationStateDefn> m_publicationByRegistrationId;
     std::unordered_map<std::int64_t, ExclusivePublicationStateDefn> m_exclusivePublicationByRegistrationId;
     std::unordered_map<std::int64_t, SubscriptionStateDefn> m_subscriptionByRegistrationId;
@@ -419,10 +438,12 @@ private:
     long m_resourceLingerTimeoutMs;
     long m_interServiceTimeoutMs;
     bool m_preTouchMappedMemory;
+    bool m_lockMappedMemory;
     bool m_isInCallback = false;
     std::atomic<bool> m_driverActive;
     std::atomic<bool> m_isClosed;
     std::recursive_mutex m_adminLock;
+    PendingRegistrationSlot m_pendingRegistrations[PENDING_REGISTRATION_SLOTS];
     std::unique_ptr<AtomicCounter> m_heartbeatTimestamp;
 
     long long m_timeOfLastDoWorkMs;
@@ -431,6 +452,41 @@ private:
 
     char m_padding[util::BitUtil::CACHE_LINE_LENGTH];
 
+    inline PendingRegistrationSlot &pendingRegistrationSlot(std::int64_t registrationId)
+    {
+        return m_pendingRegistrations[static_cast<std::size_t>(registrationId) & (PENDING_REGISTRATION_SLOTS - 1)];
+    }
+
+    inline void trackPendingRegistration(std::int64_t registrationId, long long nowMs)
+    {
+        PendingRegistrationSlot &slot = pendingRegistrationSlot(registrationId);
+
+        if (NULL_VALUE == slot.m_registrationId.load(std::memory_order_relaxed))
+        {
+            slot.m_deadlineMs.store(nowMs + m_driverTimeoutMs, std::memory_order_relaxed);
+            slot.m_registrationId.store(registrationId, std::memory_order_release);
+        }
+    }
+
+    inline void clearPendingRegistration(std::int64_t registrationId)
+    {
+        PendingRegistrationSlot &slot = pendingRegistrationSlot(registrationId);
+
+        if (registrationId == slot.m_registrationId.load(std::memory_order_relaxed))
+        {
+            slot.m_registrationId.store(NULL_VALUE, std::memory_order_release);
+        }
+    }
+
+    inline bool isAwaitingMediaDriver(std::int64_t registrationId)
+    {
+        PendingRegistrationSlot &slot = pendingRegistrationSlot(registrationId);
+
+        return registrationId == slot.m_registrationId.load(std::memory_order_acquire) &&
+            m_epochClock() <= slot.m_deadlineMs.load(std::memory_order_relaxed) &&
+            !isClosed();
+    }
+
     inline int onHeartbeatCheckTimeouts()
     {
         const long long nowMs = m_epochClock();
@@ -535,7 +591,7 @@ private:
         if (it == m_logBuffersByRegistrationId.end())
         {
             auto touch = m_preTouchMappedMemory && channel.find(std::string("sparse=true")) == std::string::npos;
-            auto logBuffers = std::make_shared<LogBuffers>(logFilename.c_str(), touch);
+            auto logBuffers = std::make_shared<LogBuffers>(logFilename.c_str(), touch, m_lockMappedMemory);
             m_logBuffersByRegistrationId.insert(std::pair<std::int64_t, LogBuffersDefn>(
                 registrationId, LogBuffersDefn(logBuffers)));
 
@@ -46,6 +46,8 @@ using namespace aeron::concurrent;
 *  +-----------------------------+
 *  |          Error Log          |
 *  +-----------------------------+
+*  |  Counters Compact Buffer    |
+*  +-----------------------------+
 * </pre>
 * <p>
 * Meta Data Layout {@link #CNC_VERSION}
@@ -74,6 +76,8 @@ using namespace aeron::concurrent;
 *  |                         Driver PID                            |
 *  |                                                               |
 *  +---------------------------------------------------------------+
+*  |               Counters Compact buffer length                  |
+*  +---------------------------------------------------------------+
 * </pre>
 */
 namespace CncFileDescriptor
@@ -95,6 +99,7 @@ struct MetaDataDefn
     std::int64_t clientLivenessTimeout;
     std::int64_t startTimestamp;
     std::int64_t pid;
+    std::int32_t counterCompactBufferLength;
 };
 #pragma pack(pop)
 
@@ -166,6 +171,28 @@ inline static AtomicBuffer createErrorLogBuffer(MemoryMappedFile::ptr_t cncFile)
     return AtomicBuffer(basePtr, metaData.errorLogBufferLength);
 }
 
+inline static AtomicBuffer createCounterCompactBuffer(MemoryMappedFile::ptr_t cncFile)
+{
+    AtomicBuffer metaDataBuffer(cncFile->getMemoryPtr(), convertSizeToIndex(cncFile->getMemorySize()));
+    const MetaDataDefn &metaData = metaDataBuffer.overlayStruct<MetaDataDefn>();
+    std::uint8_t *basePtr =
+        cncFile->getMemoryPtr() +
+        META_DATA_LENGTH +
+        metaData.toDriverBufferLength +
+        metaData.toClientsBufferLength +
+        metaData.counterMetadataBufferLength +
+        metaData.counterValuesBufferLength +
+        metaData.errorLogBufferLength;
+    const std::size_t length = static_cast<std::size_t>(metaData.counterCompactBufferLength);
+
+    if (0 == length || static_cast<std::size_t>(basePtr - cncFile->getMemoryPtr()) + length > cncFile->getMemorySize())
+    {
+        return AtomicBuffer();
+    }
+
+    return AtomicBuffer(basePtr, length);
+}
+
 inline static std::int64_t clientLivenessTimeout(MemoryMappedFile::ptr_t cncFile)
 {
     AtomicBuffer metaDataBuffer(cncFile->getMemoryPtr(), convertSizeToIndex(cncFile->getMemorySize()));
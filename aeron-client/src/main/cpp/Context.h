@@ -411,6 +411,57 @@ public:
         return *this;
     }
 
+    /**
+     * Set whether to spin rather than sleep while waiting for a newly created CnC file to be initialised and for the
+     * driver's first heartbeat, shaving the wake-up latency from connecting to a driver that is starting.
+     *
+     * @param driverConnectSpin true to spin while connecting otherwise false.
+     * @return reference to this Context instance
+     */
+    inline this_t &driverConnectSpin(bool driverConnectSpin)
+    {
+        m_driverConnectSpin = driverConnectSpin;
+        return *this;
+    }
+
+    /**
+     * Set whether the CnC file and log buffers should be locked into memory with mlock as they are mapped so offers
+     * and polls do not take page faults. Mapping fails with an IOException if the memory cannot be locked.
+     *
+     * @param lockMappedMemory true to lock memory otherwise false.
+     * @return reference to this Context instance
+     */
+    inline this_t &lockMappedMemory(bool lockMappedMemory)
+    {
+        m_lockMappedMemory = lockMappedMemory;
+        return *this;
+    }
+
+    /**
+     * Set the cpus, e.g. "1,3-5", the conductor agent thread is pinned to when not using the agent invoker. Starting
+     * the client fails if the affinity cannot be applied. Only supported on Linux.
+     *
+     * @param conductorCpuAffinity list of cpus or empty to leave the thread unpinned.
+     * @return reference to this Context instance
+     */
+    inline this_t &conductorCpuAffinity(const std::string &conductorCpuAffinity)
+    {
+        m_conductorCpuAffinity = conductorCpuAffinity;
+        return *this;
+    }
+
+    /**
+     * Set the SCHED_FIFO priority for the conductor agent thread when not using the agent invoker.
+     *
+     * @param conductorFifoPriority priority or 0 to keep the default scheduling policy.
+     * @return reference to this Context instance
+     */
+    inline this_t &conductorFifoPriority(int conductorFifoPriority)
+    {
+        m_conductorFifoPriority = conductorFifoPriority;
+        return *this;
+    }
+
     static bool requestDriverTermination(
         const std::string &directory, const std::uint8_t *tokenBuffer, std::size_t tokenLength);
 
@@ -432,6 +483,10 @@ private:
     bool m_useConductorAgentInvoker = false;
     bool m_isOnNewExclusivePublicationHandlerSet = false;
     bool m_preTouchMappedMemory = false;
+    bool m_lockMappedMemory = false;
+    bool m_driverConnectSpin = false;
+    std::string m_conductorCpuAffinity;
+    int m_conductorFifoPriority = 0;
 };
 
 }
@@ -17,6 +17,8 @@
 #define AERON_CONTROLLEDFRAGMENTASSEMBLER_H
 
 #include <unordered_map>
+#include <type_traits>
+#include <utility>
 #include "BufferBuilder.h"
 
 namespace aeron
@@ -36,8 +38,16 @@ static const std::size_t DEFAULT_CONTROLLED_FRAGMENT_ASSEMBLY_BUFFER_LENGTH = 40
  * Session based buffers will be allocated and grown as necessary based on the length of messages to be assembled.
  * When sessions go inactive see {@link on_unavailable_image_t}, it is possible to free the buffer by calling
  * {@link #deleteSessionBuffer(std::int32_t)}.
+ * <p>
+ * The delegate type is a template parameter so a lambda or functor can be called directly. Passing the assembler
+ * itself to Subscription::controlledPoll or Image::controlledPoll, rather than the result of {@link #handler()},
+ * then avoids any std::function indirection between the term reader, the assembler, and the delegate.
+ *
+ * @tparam Delegate type of the callable onto which whole messages are forwarded.
+ * @see ControlledFragmentAssembler for the std::function based variant.
  */
-class ControlledFragmentAssembler
+template<typename Delegate>
+class ControlledFragmentAssemblerT
 {
 public:
 
@@ -47,8 +57,8 @@ public:
      * @param delegate            onto which whole messages are forwarded.
      * @param initialBufferLength to be used for each session.
      */
-    explicit ControlledFragmentAssembler(
-        const controlled_poll_fragment_handler_t &delegate,
+    explicit ControlledFragmentAssemblerT(
+        const Delegate &delegate,
         size_t initialBufferLength = DEFAULT_CONTROLLED_FRAGMENT_ASSEMBLY_BUFFER_LENGTH) :
         m_initialBufferLength(initialBufferLength),
         m_delegate(delegate)
@@ -69,6 +79,22 @@ public:
         };
     }
 
+    /**
+     * Reassemble a fragment and forward whole messages to the delegate. Allows the assembler to be passed directly
+     * to Subscription::controlledPoll and Image::controlledPoll.
+     *
+     * @param buffer containing the data.
+     * @param offset at which the data begins.
+     * @param length of the data in bytes.
+     * @param header representing the meta data for the data.
+     * @return action to be taken by the poll.
+     */
+    inline ControlledPollAction operator()(
+        AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
+    {
+        return onFragment(buffer, offset, length, header);
+    }
+
     /**
      * Free an existing session buffer to reduce memory pressure when an Image goes inactive or no more
      * large messages are expected.
@@ -82,10 +108,10 @@ public:
 
 private:
     const std::size_t m_initialBufferLength;
-    controlled_poll_fragment_handler_t m_delegate;
+    Delegate m_delegate;
     std::unordered_map<std::int32_t, BufferBuilder> m_builderBySessionIdMap;
 
-    ControlledPollAction onFragment(AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
+    inline ControlledPollAction onFragment(AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
     {
         const std::uint8_t flags = header.flags();
         ControlledPollAction action = ControlledPollAction::CONTINUE;
@@ -142,5 +168,25 @@ private:
     }
 };
 
+/**
+ * ControlledFragmentAssemblerT forwarding to a controlled_poll_fragment_handler_t.
+ */
+typedef ControlledFragmentAssemblerT<controlled_poll_fragment_handler_t> ControlledFragmentAssembler;
+
+/**
+ * Create a ControlledFragmentAssemblerT for the type of the delegate so it can be called without type erasure.
+ *
+ * @param delegate            onto which whole messages are forwarded.
+ * @param initialBufferLength to be used for each session.
+ * @return assembler forwarding to the delegate.
+ */
+template<typename Delegate>
+inline ControlledFragmentAssemblerT<typename std::decay<Delegate>::type> makeControlledFragmentAssembler(
+    Delegate &&delegate, size_t initialBufferLength = DEFAULT_CONTROLLED_FRAGMENT_ASSEMBLY_BUFFER_LENGTH)
+{
+    return ControlledFragmentAssemblerT<typename std::decay<Delegate>::type>(
+        std::forward<Delegate>(delegate), initialBufferLength);
+}
+
 }
 #endif
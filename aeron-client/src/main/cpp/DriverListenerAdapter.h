@@ -47,7 +47,7 @@ public:
 
     int receiveMessages()
     {
-        return m_broadcastReceiver.receive(
+        return m_broadcastReceiver.receiveBatch(
             [&](std::int32_t msgTypeId, AtomicBuffer &buffer, util::index_t offset, util::index_t length)
             {
                 switch (msgTypeId)
@@ -65,6 +65,20 @@ ExclusivePublication::ExclusivePublication(
     m_termOffset = LogBufferDescriptor::termOffset(rawTail, m_logBuffers->atomicBuffer(0).capacity());
     m_termBeginPosition = LogBufferDescriptor::computeTermBeginPosition(
         m_termId, m_positionBitsToShift, m_initialTermId);
+
+    m_inlineSender = std::unique_ptr<InlineSender>(new InlineSender(
+        m_conductor.countersReader(), m_channel, m_registrationId, LogBufferDescriptor::mtuLength(m_logMetaDataBuffer)));
+    if (!m_inlineSender->isEnabled())
+    {
+        m_inlineSender.reset();
+    }
+
+    m_offerStats = std::unique_ptr<OfferStats>(new OfferStats(
+        m_conductor.countersReader(), m_channel, m_registrationId));
+    if (!m_offerStats->isEnabled())
+    {
+        m_offerStats.reset();
+    }
 }
 
 ExclusivePublication::~ExclusivePublication()
@@ -22,6 +22,8 @@
 #include <string>
 
 #include "Publication.h"
+#include "InlineSender.h"
+#include "OfferStats.h"
 #include "concurrent/logbuffer/ExclusiveTermAppender.h"
 
 namespace aeron
@@ -338,57 +340,14 @@ public:
      * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
      * {@link #ADMIN_ACTION} or {@link #CLOSED}.
      */
+    template<typename ReservedValueSupplier>
     inline std::int64_t offer(
         const concurrent::AtomicBuffer &buffer,
         util::index_t offset,
         util::index_t length,
-        const on_reserved_value_supplier_t &reservedValueSupplier)
+        const ReservedValueSupplier &reservedValueSupplier)
     {
-        std::int64_t newPosition = PUBLICATION_CLOSED;
-
-        if (!isClosed())
-        {
-            const std::int64_t limit = m_publicationLimit.getVolatile();
-            ExclusiveTermAppender *termAppender = m_appenders[m_activePartitionIndex].get();
-            const std::int64_t position = m_termBeginPosition + m_termOffset;
-
-            if (position < limit)
-            {
-                std::int32_t result;
-                if (length <= m_maxPayloadLength)
-                {
-                    result = termAppender->appendUnfragmentedMessage(
-                        m_termId,
-                        m_termOffset,
-                        m_headerWriter,
-                        buffer,
-                        offset,
-                        length,
-                        reservedValueSupplier);
-                }
-                else
-                {
-                    checkMaxMessageLength(length);
-                    result = termAppender->appendFragmentedMessage(
-                        m_termId,
-                        m_termOffset,
-                        m_headerWriter,
-                        buffer,
-                        offset,
-                        length,
-                        m_maxPayloadLength,
-                        reservedValueSupplier);
-                }
-
-                newPosition = ExclusivePublication::newPosition(result);
-            }
-            else
-            {
-                newPosition = ExclusivePublication::backPressureStatus(position, length);
-            }
-        }
-
-        return newPosition;
+        return offerMessage<true>(buffer, offset, length, reservedValueSupplier);
     }
 
     /**
@@ -402,7 +361,25 @@ public:
      */
     inline std::int64_t offer(const concurrent::AtomicBuffer &buffer, util::index_t offset, util::index_t length)
     {
-        return offer(buffer, offset, length, DEFAULT_RESERVED_VALUE_SUPPLIER);
+        return offer(buffer, offset, length, NoReservedValueSupplier());
+    }
+
+    /**
+     * Non-blocking publish of a message whose length is known at compile time and which has no reserved value, so
+     * the frame length, alignment and reserved value are resolved by the compiler. Intended for fixed size messages
+     * which fit within the MTU.
+     *
+     * @tparam Length in bytes of the encoded message.
+     * @param buffer containing message.
+     * @param offset offset in the buffer at which the encoded message begins.
+     * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
+     * {@link #ADMIN_ACTION} or {@link #CLOSED}.
+     */
+    template<util::index_t Length>
+    inline std::int64_t offerFixed(const concurrent::AtomicBuffer &buffer, util::index_t offset)
+    {
+        static_assert(Length >= 0, "message length must not be negative");
+        return offer(buffer, offset, Length, NoReservedValueSupplier());
     }
 
     /**
@@ -416,6 +393,48 @@ public:
         return offer(buffer, 0, buffer.capacity());
     }
 
+    /**
+     * Non-blocking publish of a buffer containing a message which reports a message longer than the max message
+     * length with a return code, as the C API does, rather than an exception. The offer path then has no exception
+     * handling, for callers that handle errors by status code in their hot path.
+     *
+     * @param buffer containing message.
+     * @param offset offset in the buffer at which the encoded message begins.
+     * @param length in bytes of the encoded message.
+     * @param reservedValueSupplier for the frame, which must not throw.
+     * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
+     * {@link #ADMIN_ACTION}, {@link #CLOSED}, {@link #MAX_POSITION_EXCEEDED} or {@link #PUBLICATION_ERROR}.
+     */
+    template<typename ReservedValueSupplier>
+    inline std::int64_t offer(
+        const concurrent::AtomicBuffer &buffer,
+        util::index_t offset,
+        util::index_t length,
+        const ReservedValueSupplier &reservedValueSupplier,
+        const std::nothrow_t &) noexcept
+    {
+        return offerMessage<false>(buffer, offset, length, reservedValueSupplier);
+    }
+
+    /**
+     * Non-blocking publish of a buffer containing a message which reports errors with a return code rather than an
+     * exception.
+     *
+     * @param buffer containing message.
+     * @param offset offset in the buffer at which the encoded message begins.
+     * @param length in bytes of the encoded message.
+     * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
+     * {@link #ADMIN_ACTION}, {@link #CLOSED}, {@link #MAX_POSITION_EXCEEDED} or {@link #PUBLICATION_ERROR}.
+     */
+    inline std::int64_t offer(
+        const concurrent::AtomicBuffer &buffer,
+        util::index_t offset,
+        util::index_t length,
+        const std::nothrow_t &nothrow) noexcept
+    {
+        return offer(buffer, offset, length, NoReservedValueSupplier(), nothrow);
+    }
+
     /**
      * Non-blocking publish of buffers containing a message.
      *
@@ -487,7 +506,7 @@ public:
             }
         }
 
-        return newPosition;
+        return recordOffer(length, newPosition);
     }
 
     /**
@@ -579,7 +598,7 @@ public:
             }
         }
 
-        return newPosition;
+        return recordOffer(length, newPosition);
     }
 
     /**
@@ -604,6 +623,68 @@ public:
     /// @endcond
 
 private:
+    template<bool ThrowOnError, typename ReservedValueSupplier>
+    inline std::int64_t offerMessage(
+        const concurrent::AtomicBuffer &buffer,
+        util::index_t offset,
+        util::index_t length,
+        const ReservedValueSupplier &reservedValueSupplier) noexcept(!ThrowOnError)
+    {
+        std::int64_t newPosition = PUBLICATION_CLOSED;
+
+        if (!isClosed())
+        {
+            const std::int64_t limit = m_publicationLimit.getVolatile();
+            ExclusiveTermAppender *termAppender = m_appenders[m_activePartitionIndex].get();
+            const std::int64_t position = m_termBeginPosition + m_termOffset;
+
+            if (position < limit)
+            {
+                std::int32_t result;
+                if (AERON_COND_EXPECT((length <= m_maxPayloadLength), true))
+                {
+                    result = termAppender->appendUnfragmentedMessage(
+                        m_termId,
+                        m_termOffset,
+                        m_headerWriter,
+                        buffer,
+                        offset,
+                        length,
+                        reservedValueSupplier);
+                }
+                else
+                {
+                    if (ThrowOnError)
+                    {
+                        checkMaxMessageLength(length);
+                    }
+                    else if (length > m_maxMessageLength)
+                    {
+                        return PUBLICATION_ERROR;
+                    }
+
+                    result = termAppender->appendFragmentedMessage(
+                        m_termId,
+                        m_termOffset,
+                        m_headerWriter,
+                        buffer,
+                        offset,
+                        length,
+                        m_maxPayloadLength,
+                        reservedValueSupplier);
+                }
+
+                newPosition = ExclusivePublication::newPosition(result);
+            }
+            else
+            {
+                newPosition = ExclusivePublication::backPressureStatus(position, length);
+            }
+        }
+
+        return recordOffer(length, newPosition);
+    }
+
     ClientConductor &m_conductor;
     AtomicBuffer &m_logMetaDataBuffer;
 
@@ -629,14 +710,33 @@ private:
     std::shared_ptr<LogBuffers> m_logBuffers;
     std::unique_ptr<ExclusiveTermAppender> m_appenders[3];
     HeaderWriter m_headerWriter;
+    std::unique_ptr<InlineSender> m_inlineSender;
+    std::unique_ptr<OfferStats> m_offerStats;
+
+    inline std::int64_t recordOffer(util::index_t length, std::int64_t result) noexcept
+    {
+        if (nullptr != m_offerStats)
+        {
+            m_offerStats->record(length, result);
+        }
+
+        return result;
+    }
 
     inline std::int64_t newPosition(const std::int32_t resultingOffset)
     {
         if (resultingOffset > 0)
         {
+            LogBufferDescriptor::notifyData(m_logMetaDataBuffer);
             m_termOffset = resultingOffset;
 
-            return m_termBeginPosition + resultingOffset;
+            const std::int64_t position = m_termBeginPosition + resultingOffset;
+            if (nullptr != m_inlineSender)
+            {
+                m_inlineSender->send(*m_logBuffers, position);
+            }
+
+            return position;
         }
 
         const std::int32_t termLength = termBufferLength();
@@ -18,6 +18,9 @@
 #define AERON_FRAGMENT_ASSEMBLER_H
 
 #include <unordered_map>
+#include <vector>
+#include <type_traits>
+#include <utility>
 #include "BufferBuilder.h"
 
 namespace aeron
@@ -37,8 +40,19 @@ static const std::size_t DEFAULT_FRAGMENT_ASSEMBLY_BUFFER_LENGTH = 4096;
  * Session based buffers will be allocated and grown as necessary based on the length of messages to be assembled.
  * When sessions go inactive see {@link on_unavailable_image_t}, it is possible to free the buffer by calling
  * {@link #deleteSessionBuffer(std::int32_t)}.
+ * <p>
+ * Alternatively a fixed pool of buffers can be preallocated up front. Sessions then borrow a buffer when a fragmented
+ * message begins and return it once the message is delivered so no allocation takes place while polling.
+ * <p>
+ * The delegate type is a template parameter so a lambda or functor can be called directly. Passing the assembler
+ * itself to Subscription::poll or Image::poll, rather than the result of {@link #handler()}, then avoids any
+ * std::function indirection between the term reader, the assembler, and the delegate.
+ *
+ * @tparam Delegate type of the callable onto which whole messages are forwarded.
+ * @see FragmentAssembler for the std::function based variant.
  */
-class FragmentAssembler
+template<typename Delegate>
+class FragmentAssemblerT
 {
 public:
 
@@ -48,12 +62,35 @@ public:
      * @param delegate            onto which whole messages are forwarded.
      * @param initialBufferLength to be used for each session.
      */
-    explicit FragmentAssembler(
-        const fragment_handler_t &delegate, size_t initialBufferLength = DEFAULT_FRAGMENT_ASSEMBLY_BUFFER_LENGTH) :
+    explicit FragmentAssemblerT(
+        const Delegate &delegate, size_t initialBufferLength = DEFAULT_FRAGMENT_ASSEMBLY_BUFFER_LENGTH) :
         m_initialBufferLength(initialBufferLength), m_delegate(delegate)
     {
     }
 
+    /**
+     * Construct an adapter to reassembly message fragments into a fixed pool of preallocated buffers and delegate on
+     * only whole messages. Messages longer than maxMessageLength, or that begin while every buffer is in use, are
+     * dropped.
+     *
+     * @param delegate         onto which whole messages are forwarded.
+     * @param maxMessageLength of a reassembled message and so the length of each pooled buffer.
+     * @param maxSessions      that can be reassembling a message at the same time and so the number of buffers.
+     */
+    FragmentAssemblerT(const Delegate &delegate, std::size_t maxMessageLength, std::size_t maxSessions) :
+        m_initialBufferLength(0), m_maxMessageLength(maxMessageLength), m_delegate(delegate)
+    {
+        m_pool.reserve(maxSessions);
+        m_freeBuilders.reserve(maxSessions);
+        m_activeBuilders.reserve(maxSessions);
+
+        for (std::size_t i = 0; i < maxSessions; i++)
+        {
+            m_pool.emplace_back(static_cast<std::uint32_t>(maxMessageLength + DataFrameHeader::LENGTH));
+            m_freeBuilders.push_back(&m_pool.back());
+        }
+    }
+
     /**
      * Compose a fragment_handler_t that calls the this FragmentAssembler instance for reassembly. Suitable for
      * passing to Subscription::poll(fragment_handler_t, int).
@@ -62,12 +99,41 @@ public:
      */
     fragment_handler_t handler()
     {
+        if (!m_pool.empty())
+        {
+            return [this](AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
+            {
+                this->onPooledFragment(buffer, offset, length, header);
+            };
+        }
+
         return [this](AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
         {
             this->onFragment(buffer, offset, length, header);
         };
     }
 
+    /**
+     * Reassemble a fragment and forward whole messages to the delegate. Allows the assembler to be passed directly
+     * to Subscription::poll and Image::poll.
+     *
+     * @param buffer containing the data.
+     * @param offset at which the data begins.
+     * @param length of the data in bytes.
+     * @param header representing the meta data for the data.
+     */
+    inline void operator()(AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
+    {
+        if (m_pool.empty())
+        {
+            onFragment(buffer, offset, length, header);
+        }
+        else
+        {
+            onPooledFragment(buffer, offset, length, header);
+        }
+    }
+
     /**
      * Free an existing session buffer to reduce memory pressure when an Image goes inactive or no more
      * large messages are expected.
@@ -77,12 +143,97 @@ public:
     void deleteSessionBuffer(std::int32_t sessionId)
     {
         m_builderBySessionIdMap.erase(sessionId);
+        releasePooledBuilder(sessionId);
     }
 
 private:
     const std::size_t m_initialBufferLength;
-    fragment_handler_t m_delegate;
+    const std::size_t m_maxMessageLength = 0;
+    Delegate m_delegate;
     std::unordered_map<std::int32_t, BufferBuilder> m_builderBySessionIdMap;
+    std::vector<BufferBuilder> m_pool;
+    std::vector<BufferBuilder *> m_freeBuilders;
+    std::vector<std::pair<std::int32_t, BufferBuilder *>> m_activeBuilders;
+
+    inline BufferBuilder *findPooledBuilder(std::int32_t sessionId)
+    {
+        for (auto &entry : m_activeBuilders)
+        {
+            if (entry.first == sessionId)
+            {
+                return entry.second;
+            }
+        }
+
+        return nullptr;
+    }
+
+    inline void releasePooledBuilder(std::int32_t sessionId)
+    {
+        for (std::size_t i = 0, size = m_activeBuilders.size(); i < size; i++)
+        {
+            if (m_activeBuilders[i].first == sessionId)
+            {
+                m_freeBuilders.push_back(m_activeBuilders[i].second);
+                m_activeBuilders[i] = m_activeBuilders.back();
+                m_activeBuilders.pop_back();
+                break;
+            }
+        }
+    }
+
+    inline void onPooledFragment(AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
+    {
+        const std::uint8_t flags = header.flags();
+
+        if ((flags & FrameDescriptor::UNFRAGMENTED) == FrameDescriptor::UNFRAGMENTED)
+        {
+            m_delegate(buffer, offset, length, header);
+            return;
+        }
+
+        const std::int32_t sessionId = header.sessionId();
+        BufferBuilder *builder = findPooledBuilder(sessionId);
+
+        if ((flags & FrameDescriptor::BEGIN_FRAG) == FrameDescriptor::BEGIN_FRAG)
+        {
+            if (nullptr == builder)
+            {
+                if (m_freeBuilders.empty())
+                {
+                    return;
+                }
+
+                builder = m_freeBuilders.back();
+                m_freeBuilders.pop_back();
+                m_activeBuilders.emplace_back(sessionId, builder);
+            }
+
+            builder->reset();
+        }
+        else if (nullptr == builder || builder->limit() == DataFrameHeader::LENGTH)
+        {
+            return;
+        }
+
+        if (builder->limit() + static_cast<std::size_t>(length) > m_maxMessageLength + DataFrameHeader::LENGTH)
+        {
+            releasePooledBuilder(sessionId);
+            return;
+        }
+
+        builder->append(buffer, offset, length, header);
+
+        if ((flags & FrameDescriptor::END_FRAG) == FrameDescriptor::END_FRAG)
+        {
+            const util::index_t msgLength = builder->limit() - DataFrameHeader::LENGTH;
+            AtomicBuffer msgBuffer(builder->buffer(), builder->limit());
+
+            m_delegate(msgBuffer, DataFrameHeader::LENGTH, msgLength, header);
+
+            releasePooledBuilder(sessionId);
+        }
+    }
 
     inline void onFragment(AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
     {
@@ -130,6 +281,26 @@ private:
     }
 };
 
+/**
+ * FragmentAssemblerT forwarding to a fragment_handler_t.
+ */
+typedef FragmentAssemblerT<fragment_handler_t> FragmentAssembler;
+
+/**
+ * Create a FragmentAssemblerT for the type of the delegate so it can be called without type erasure.
+ *
+ * @param delegate            onto which whole messages are forwarded.
+ * @param initialBufferLength to be used for each session.
+ * @return assembler forwarding to the delegate.
+ */
+template<typename Delegate>
+inline FragmentAssemblerT<typename std::decay<Delegate>::type> makeFragmentAssembler(
+    Delegate &&delegate, size_t initialBufferLength = DEFAULT_FRAGMENT_ASSEMBLY_BUFFER_LENGTH)
+{
+    return FragmentAssemblerT<typename std::decay<Delegate>::type>(
+        std::forward<Delegate>(delegate), initialBufferLength);
+}
+
 }
 
 #endif
@@ -79,6 +79,18 @@ typedef std::function<ControlledPollAction(
     util::index_t length,
     Header &header)> controlled_poll_fragment_handler_t;
 
+/**
+ * Descriptor for a message fragment filled in by a batch poll. The buffer and frame point into the term buffer and
+ * are only valid until the next poll of the Image or Subscription the fragment was read from.
+ */
+struct Fragment
+{
+    const std::uint8_t *buffer;
+    util::index_t length;
+    const DataFrameHeader::DataFrameHeaderDefn *frame;
+    std::int64_t position;
+};
+
 /**
  * Represents a replicated publication {@link Image} from a publisher to a {@link Subscription}.
  * Each {@link Image} identifies a source publisher by session id.
@@ -419,6 +431,63 @@ public:
         return outcome.fragmentsRead;
     }
 
+    /**
+     * Poll for new messages in a stream and fill in a Fragment for each one found beyond the last consumed position,
+     * up to a limited number of fragments, rather than calling a handler for each one.
+     *
+     * @param fragments     to fill in for each message fragment read.
+     * @param fragmentLimit for the number of fragments to be consumed, no more than the length of fragments.
+     * @return the number of fragments that have been consumed.
+     */
+    inline int batchPoll(Fragment *fragments, int fragmentLimit)
+    {
+        if (isClosed())
+        {
+            return 0;
+        }
+
+        int fragmentsRead = 0;
+        const std::int64_t initialPosition = m_subscriberPosition.get();
+        const auto initialOffset = static_cast<std::int32_t>(initialPosition & m_termLengthMask);
+        const int index = LogBufferDescriptor::indexByPosition(initialPosition, m_positionBitsToShift);
+        assert(index >= 0 && index < LogBufferDescriptor::PARTITION_COUNT);
+        AtomicBuffer &termBuffer = m_termBuffers[index];
+        const std::int32_t capacity = termBuffer.capacity();
+        std::int32_t offset = initialOffset;
+        std::int32_t prefetchOffset = initialOffset;
+
+        while (fragmentsRead < fragmentLimit && offset < capacity)
+        {
+            prefetchOffset = LogBufferDescriptor::prefetchAhead(termBuffer, offset, prefetchOffset, capacity);
+            const std::int32_t length = FrameDescriptor::frameLengthVolatile(termBuffer, offset);
+            if (length <= 0)
+            {
+                break;
+            }
+
+            const std::int32_t frameOffset = offset;
+            offset += util::BitUtil::align(length, FrameDescriptor::FRAME_ALIGNMENT);
+
+            if (!FrameDescriptor::isPaddingFrame(termBuffer, frameOffset))
+            {
+                Fragment &fragment = fragments[fragmentsRead++];
+
+                fragment.buffer = termBuffer.buffer() + frameOffset + DataFrameHeader::LENGTH;
+                fragment.length = length - DataFrameHeader::LENGTH;
+                fragment.frame = &termBuffer.overlayStruct<DataFrameHeader::DataFrameHeaderDefn>(frameOffset);
+                fragment.position = initialPosition + (offset - initialOffset);
+            }
+        }
+
+        const std::int64_t resultingPosition = initialPosition + (offset - initialOffset);
+        if (resultingPosition > initialPosition)
+        {
+            m_subscriberPosition.setOrdered(resultingPosition);
+        }
+
+        return fragmentsRead;
+    }
+
     /**
      * Poll for new messages in a stream. If new messages are found beyond the last consumed position then they
      * will be delivered via the fragment_handler_t up to a limited number of fragments as specified or the
@@ -446,46 +515,48 @@ public:
         assert(index >= 0 && index < LogBufferDescriptor::PARTITION_COUNT);
         AtomicBuffer &termBuffer = m_termBuffers[index];
         std::int32_t offset = initialOffset;
+        std::int32_t prefetchOffset = initialOffset;
         const std::int64_t capacity = termBuffer.capacity();
         const std::int32_t limitOffset =
             static_cast<std::int32_t>(std::min(capacity, limitPosition - initialPosition + offset));
 
         m_header.buffer(termBuffer);
 
-        try
-        {
-            while (fragmentsRead < fragmentLimit && offset < limitOffset)
+        util::invokeGuarded(
+            [&]()
             {
-                const std::int32_t length = FrameDescriptor::frameLengthVolatile(termBuffer, offset);
-                if (length <= 0)
+                while (fragmentsRead < fragmentLimit && offset < limitOffset)
                 {
-                    break;
+                    prefetchOffset = LogBufferDescriptor::prefetchAhead(
+                        termBuffer, offset, prefetchOffset, limitOffset);
+                    const std::int32_t length = FrameDescriptor::frameLengthVolatile(termBuffer, offset);
+                    if (length <= 0)
+                    {
+                        break;
+                    }
+
+                    const std::int32_t frameOffset = offset;
+                    const std::int32_t alignedLength = util::BitUtil::align(length, FrameDescriptor::FRAME_ALIGNMENT);
+                    offset += alignedLength;
+
+                    if (FrameDescriptor::isPaddingFrame(termBuffer, frameOffset))
+                    {
+                        continue;
+                    }
+
+                    m_header.offset(frameOffset);
+
+                    fragmentHandler(
+                        termBuffer,
+                        frameOffset + DataFrameHeader::LENGTH,
+                        length - DataFrameHeader::LENGTH,
+                        m_header);
+
+                    ++fragmentsRead;
                 }
-
-                const std::int32_t frameOffset = offset;
-                const std::int32_t alignedLength = util::BitUtil::align(length, FrameDescriptor::FRAME_ALIGNMENT);
-                offset += alignedLength;
-
-                if (FrameDescriptor::isPaddingFrame(termBuffer, frameOffset))
-                {
-                    continue;
-                }
-
-                m_header.offset(frameOffset);
-
-                fragmentHandler(
-                    termBuffer,
-                    frameOffset + DataFrameHeader::LENGTH,
-                    length - DataFrameHeader::LENGTH,
-                    m_header);
-
-                ++fragmentsRead;
-            }
-        }
-        catch (const std::exception &ex)
-        {
-            m_exceptionHandler(ex);
-        }
+            },
+            m_exceptionHandler,
+            IsNoexceptFragmentHandler<F>());
 
         const std::int64_t resultingPosition = initialPosition + (offset - initialOffset);
         if (resultingPosition > initialPosition)
@@ -523,61 +594,62 @@ public:
         assert(index >= 0 && index < LogBufferDescriptor::PARTITION_COUNT);
         AtomicBuffer &termBuffer = m_termBuffers[index];
         std::int32_t offset = initialOffset;
+        std::int32_t prefetchOffset = initialOffset;
         const util::index_t capacity = termBuffer.capacity();
 
         m_header.buffer(termBuffer);
 
-        try
-        {
-            while (fragmentsRead < fragmentLimit && offset < capacity)
+        util::invokeGuarded(
+            [&]()
             {
-                const std::int32_t length = FrameDescriptor::frameLengthVolatile(termBuffer, offset);
-                if (length <= 0)
+                while (fragmentsRead < fragmentLimit && offset < capacity)
                 {
-                    break;
+                    prefetchOffset = LogBufferDescriptor::prefetchAhead(termBuffer, offset, prefetchOffset, capacity);
+                    const std::int32_t length = FrameDescriptor::frameLengthVolatile(termBuffer, offset);
+                    if (length <= 0)
+                    {
+                        break;
+                    }
+
+                    const std::int32_t frameOffset = offset;
+                    const std::int32_t alignedLength = util::BitUtil::align(length, FrameDescriptor::FRAME_ALIGNMENT);
+                    offset += alignedLength;
+
+                    if (FrameDescriptor::isPaddingFrame(termBuffer, frameOffset))
+                    {
+                        continue;
+                    }
+
+                    m_header.offset(frameOffset);
+
+                    const ControlledPollAction action = fragmentHandler(
+                        termBuffer,
+                        frameOffset + DataFrameHeader::LENGTH,
+                        length - DataFrameHeader::LENGTH,
+                        m_header);
+
+                    if (ControlledPollAction::ABORT == action)
+                    {
+                        offset -= alignedLength;
+                        break;
+                    }
+
+                    ++fragmentsRead;
+
+                    if (ControlledPollAction::BREAK == action)
+                    {
+                        break;
+                    }
+                    else if (ControlledPollAction::COMMIT == action)
+                    {
+                        initialPosition += (offset - initialOffset);
+                        initialOffset = offset;
+                        m_subscriberPosition.setOrdered(initialPosition);
+                    }
                 }
-
-                const std::int32_t frameOffset = offset;
-                const std::int32_t alignedLength = util::BitUtil::align(length, FrameDescriptor::FRAME_ALIGNMENT);
-                offset += alignedLength;
-
-                if (FrameDescriptor::isPaddingFrame(termBuffer, frameOffset))
-                {
-                    continue;
-                }
-
-                m_header.offset(frameOffset);
-
-                const ControlledPollAction action = fragmentHandler(
-                    termBuffer,
-                    frameOffset + DataFrameHeader::LENGTH,
-                    length - DataFrameHeader::LENGTH,
-                    m_header);
-
-                if (ControlledPollAction::ABORT == action)
-                {
-                    offset -= alignedLength;
-                    break;
-                }
-
-                ++fragmentsRead;
-
-                if (ControlledPollAction::BREAK == action)
-                {
-                    break;
-                }
-                else if (ControlledPollAction::COMMIT == action)
-                {
-                    initialPosition += (offset - initialOffset);
-                    initialOffset = offset;
-                    m_subscriberPosition.setOrdered(initialPosition);
-                }
-            }
-        }
-        catch (const std::exception &ex)
-        {
-            m_exceptionHandler(ex);
-        }
+            },
+            m_exceptionHandler,
+            IsNoexceptFragmentHandler<F>());
 
         const std::int64_t resultingPosition = initialPosition + (offset - initialOffset);
         if (resultingPosition > initialPosition)
@@ -616,63 +688,65 @@ public:
         assert(index >= 0 && index < LogBufferDescriptor::PARTITION_COUNT);
         AtomicBuffer &termBuffer = m_termBuffers[index];
         std::int32_t offset = initialOffset;
+        std::int32_t prefetchOffset = initialOffset;
         const std::int64_t capacity = termBuffer.capacity();
         const std::int32_t limitOffset =
             static_cast<std::int32_t>(std::min(capacity, (limitPosition - initialPosition) + offset));
 
         m_header.buffer(termBuffer);
 
-        try
-        {
-            while (fragmentsRead < fragmentLimit && offset < limitOffset)
+        util::invokeGuarded(
+            [&]()
             {
-                const std::int32_t length = FrameDescriptor::frameLengthVolatile(termBuffer, offset);
-                if (length <= 0)
-                {
-                    break;
-                }
-
-                const std::int32_t frameOffset = offset;
-                const std::int32_t alignedLength = util::BitUtil::align(length, FrameDescriptor::FRAME_ALIGNMENT);
-                offset += alignedLength;
-
-                if (FrameDescriptor::isPaddingFrame(termBuffer, frameOffset))
-                {
-                    continue;
-                }
-
-                m_header.offset(frameOffset);
-
-                const ControlledPollAction action = fragmentHandler(
-                    termBuffer,
-                    frameOffset + DataFrameHeader::LENGTH,
-                    length - DataFrameHeader::LENGTH,
-                    m_header);
-
-                if (ControlledPollAction::ABORT == action)
+                while (fragmentsRead < fragmentLimit && offset < limitOffset)
                 {
-                    offset -= alignedLength;
-                    break;
+                    prefetchOffset = LogBufferDescriptor::prefetchAhead(
+                        termBuffer, offset, prefetchOffset, limitOffset);
+                    const std::int32_t length = FrameDescriptor::frameLengthVolatile(termBuffer, offset);
+                    if (length <= 0)
+                    {
+                        break;
+                    }
+
+                    const std::int32_t frameOffset = offset;
+                    const std::int32_t alignedLength = util::BitUtil::align(length, FrameDescriptor::FRAME_ALIGNMENT);
+                    offset += alignedLength;
+
+                    if (FrameDescriptor::isPaddingFrame(termBuffer, frameOffset))
+                    {
+                        continue;
+                    }
+
+                    m_header.offset(frameOffset);
+
+                    const ControlledPollAction action = fragmentHandler(
+                        termBuffer,
+                        frameOffset + DataFrameHeader::LENGTH,
+                        length - DataFrameHeader::LENGTH,
+                        m_header);
+
+                    if (ControlledPollAction::ABORT == action)
+                    {
+                        offset -= alignedLength;
+                        break;
+                    }
+
+                    ++fragmentsRead;
+
+                    if (ControlledPollAction::BREAK == action)
+                    {
+                        break;
+                    }
+                    else if (ControlledPollAction::COMMIT == action)
+                    {
+                        initialPosition += (offset - initialOffset);
+                        initialOffset = offset;
+                        m_subscriberPosition.setOrdered(initialPosition);
+                    }
                 }
-
-                ++fragmentsRead;
-
-                if (ControlledPollAction::BREAK == action)
-                {
-                    break;
-                }
-                else if (ControlledPollAction::COMMIT == action)
-                {
-                    initialPosition += (offset - initialOffset);
-                    initialOffset = offset;
-                    m_subscriberPosition.setOrdered(initialPosition);
-                }
-            }
-        }
-        catch (const std::exception &ex)
-        {
-            m_exceptionHandler(ex);
-        }
+            },
+            m_exceptionHandler,
+            IsNoexceptFragmentHandler<F>());
 
         const std::int64_t resultingPosition = initialPosition + (offset - initialOffset);
         if (resultingPosition > initialPosition)
@@ -723,59 +797,58 @@ public:
 
         m_header.buffer(termBuffer);
 
-        try
-        {
-            while (offset < limitOffset)
+        util::invokeGuarded(
+            [&]()
             {
-                const std::int32_t length = FrameDescriptor::frameLengthVolatile(termBuffer, offset);
-                if (length <= 0)
+                while (offset < limitOffset)
                 {
-                    break;
-                }
-
-                const std::int32_t frameOffset = offset;
-                const std::int32_t alignedLength = util::BitUtil::align(length, FrameDescriptor::FRAME_ALIGNMENT);
-                offset += alignedLength;
+                    const std::int32_t length = FrameDescriptor::frameLengthVolatile(termBuffer, offset);
+                    if (length <= 0)
+                    {
+                        break;
+                    }
+
+                    const std::int32_t frameOffset = offset;
+                    const std::int32_t alignedLength = util::BitUtil::align(length, FrameDescriptor::FRAME_ALIGNMENT);
+                    offset += alignedLength;
+
+                    if (FrameDescriptor::isPaddingFrame(termBuffer, frameOffset))
+                    {
+                        position += (offset - initialOffset);
+                        initialOffset = offset;
+                        resultingPosition = position;
+                        continue;
+                    }
+
+                    m_header.offset(frameOffset);
+
+                    const ControlledPollAction action = fragmentHandler(
+                        termBuffer,
+                        frameOffset + DataFrameHeader::LENGTH,
+                        length - DataFrameHeader::LENGTH,
+                        m_header);
+
+                    if (ControlledPollAction::ABORT == action)
+                    {
+                        break;
+                    }
 
-                if (FrameDescriptor::isPaddingFrame(termBuffer, frameOffset))
-                {
                     position += (offset - initialOffset);
                     initialOffset = offset;
-                    resultingPosition = position;
-                    continue;
-                }
-
-                m_header.offset(frameOffset);
 
-                const ControlledPollAction action = fragmentHandler(
-                    termBuffer,
-                    frameOffset + DataFrameHeader::LENGTH,
-                    length - DataFrameHeader::LENGTH,
-                    m_header);
+                    if (m_header.flags() & FrameDescriptor::END_FRAG)
+                    {
+                        resultingPosition = position;
+                    }
 
-                if (ControlledPollAction::ABORT == action)
-                {
-                    break;
+                    if (ControlledPollAction::BREAK == action)
+                    {
+                        break;
+                    }
                 }
-
-                position += (offset - initialOffset);
-                initialOffset = offset;
-
-                if (m_header.flags() & FrameDescriptor::END_FRAG)
-                {
-                    resultingPosition = position;
-                }
-
-                if (ControlledPollAction::BREAK == action)
-                {
-                    break;
-                }
-            }
-        }
-        catch (const std::exception &ex)
-        {
-            m_exceptionHandler(ex);
-        }
+            },
+            m_exceptionHandler,
+            IsNoexceptFragmentHandler<F>());
 
         return resultingPosition;
     }
@@ -816,15 +889,14 @@ public:
 
         if (resultingOffset > termOffset)
         {
-            try
-            {
-                const std::int32_t termId = termBuffer.getInt32(termOffset + DataFrameHeader::TERM_ID_FIELD_OFFSET);
-                blockHandler(termBuffer, termOffset, length, m_sessionId, termId);
-            }
-            catch (const std::exception &ex)
-            {
-                m_exceptionHandler(ex);
-            }
+            util::invokeGuarded(
+                [&]()
+                {
+                    const std::int32_t termId = termBuffer.getInt32(termOffset + DataFrameHeader::TERM_ID_FIELD_OFFSET);
+                    blockHandler(termBuffer, termOffset, length, m_sessionId, termId);
+                },
+                m_exceptionHandler,
+                IsNoexceptBlockHandler<F>());
 
             m_subscriberPosition.setOrdered(position + length);
         }
@@ -832,6 +904,66 @@ public:
         return length;
     }
 
+    /**
+     * Poll for a block of whole messages in a stream, up to a limited number of bytes, and advance the position by
+     * as much of the block as the handler consumes.
+     *
+     * A block always begins and ends on a message boundary so a fragmented message is either in it completely or not
+     * at all. The first message is delivered whole even when it is longer than blockLengthLimit, once all of its
+     * fragments have arrived. Padding frames are delivered singularly in a block as with blockPoll.
+     *
+     * The position is advanced by the bytes the handler returns rounded down to the last whole message, so the next
+     * poll starts on a message boundary.
+     *
+     * @param blockHandler     to which block is delivered.
+     * @param blockLengthLimit up to which a block may be in length.
+     * @return the number of bytes that have been consumed.
+     *
+     * @see controlled_block_handler_t
+     */
+    template<typename F>
+    inline int controlledBlockPoll(F &&blockHandler, int blockLengthLimit)
+    {
+        if (isClosed())
+        {
+            return 0;
+        }
+
+        const std::int64_t position = m_subscriberPosition.get();
+        const auto termOffset = static_cast<std::int32_t>(position & m_termLengthMask);
+        const int index = LogBufferDescriptor::indexByPosition(position, m_positionBitsToShift);
+        assert(index >= 0 && index < LogBufferDescriptor::PARTITION_COUNT);
+        AtomicBuffer &termBuffer = m_termBuffers[index];
+        const std::int32_t limitOffset = std::min(termOffset + blockLengthLimit, termBuffer.capacity());
+        const std::int32_t blockEndOffset = TermBlockScanner::scanMessages(termBuffer, termOffset, limitOffset, true);
+        const std::int32_t length = blockEndOffset - termOffset;
+        std::int32_t committedLength = 0;
+
+        if (blockEndOffset > termOffset)
+        {
+            util::invokeGuarded(
+                [&]()
+                {
+                    const std::int32_t termId = termBuffer.getInt32(termOffset + DataFrameHeader::TERM_ID_FIELD_OFFSET);
+                    const std::int32_t consumed = blockHandler(termBuffer, termOffset, length, m_sessionId, termId);
+
+                    committedLength = consumed < length ?
+                        TermBlockScanner::scanMessages(
+                            termBuffer, termOffset, termOffset + consumed, false) - termOffset :
+                        length;
+                },
+                m_exceptionHandler,
+                IsNoexceptBlockHandler<F>());
+
+            if (committedLength > 0)
+            {
+                m_subscriberPosition.setOrdered(position + committedLength);
+            }
+        }
+
+        return committedLength;
+    }
+
     std::shared_ptr<LogBuffers> logBuffers()
     {
         return m_logBuffers;
@@ -17,6 +17,7 @@
 #ifndef AERON_IMAGE_FRAGMENT_ASSEMBLER_H
 #define AERON_IMAGE_FRAGMENT_ASSEMBLER_H
 
+#include <vector>
 #include "BufferBuilder.h"
 
 namespace aeron
@@ -108,6 +109,102 @@ private:
     }
 };
 
+/**
+ * Callback for handling a whole message as the fragments it was sent in, each wrapping its payload in the term buffer.
+ *
+ * @param fragments of the message in order, only valid for the duration of the callback.
+ * @param header    representing the meta data for the last fragment.
+ */
+typedef std::function<void(const std::vector<AtomicBuffer> &fragments, Header &header)> vectored_fragment_handler_t;
+
+/**
+ * A handler that reassembles fragmented messages from a single Image without copying them.
+ * <p>
+ * The fragments of a message lie contiguously in a term, so rather than copying them into a buffer the assembler
+ * keeps a view of each payload in the term buffer and delegates them together once the last fragment arrives.
+ * Unfragmented messages are delegated as a single fragment.
+ * <p>
+ * The Header passed to the delegate on assembling a message will be that of the last fragment.
+ * <p>
+ * This handler is not session aware and must only be used when polling a single Image.
+ */
+class ImageVectoredFragmentAssembler
+{
+public:
+
+    /**
+     * Construct an adapter to reassembly message fragments and delegate on only whole messages.
+     *
+     * @param delegate onto which whole messages are forwarded.
+     */
+    explicit ImageVectoredFragmentAssembler(const vectored_fragment_handler_t &delegate) :
+        m_delegate(delegate)
+    {
+    }
+
+    /**
+     * Compose a fragment_handler_t that calls the ImageVectoredFragmentAssembler instance for reassembly. Suitable
+     * for passing to Image::poll(fragment_handler_t, int).
+     *
+     * @return fragment_handler_t composed with the ImageVectoredFragmentAssembler instance
+     */
+    fragment_handler_t handler()
+    {
+        return [this](AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
+        {
+            this->onFragment(buffer, offset, length, header);
+        };
+    }
+
+private:
+    vectored_fragment_handler_t m_delegate;
+    std::vector<AtomicBuffer> m_fragments;
+    const std::uint8_t *m_nextFragment = nullptr;
+
+    inline void append(AtomicBuffer &buffer, util::index_t offset, util::index_t length)
+    {
+        std::uint8_t *fragment = buffer.buffer() + offset;
+
+        m_fragments.emplace_back(fragment, static_cast<std::size_t>(length));
+        m_nextFragment = fragment + util::BitUtil::align(
+            length + DataFrameHeader::LENGTH, FrameDescriptor::FRAME_ALIGNMENT);
+    }
+
+    inline void onFragment(AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
+    {
+        std::uint8_t flags = header.flags();
+
+        if ((flags & FrameDescriptor::UNFRAGMENTED) == FrameDescriptor::UNFRAGMENTED)
+        {
+            m_fragments.clear();
+            m_fragments.emplace_back(buffer.buffer() + offset, static_cast<std::size_t>(length));
+            m_delegate(m_fragments, header);
+            m_fragments.clear();
+        }
+        else if ((flags & FrameDescriptor::BEGIN_FRAG) == FrameDescriptor::BEGIN_FRAG)
+        {
+            m_fragments.clear();
+            append(buffer, offset, length);
+        }
+        else if (!m_fragments.empty())
+        {
+            if (buffer.buffer() + offset != m_nextFragment)
+            {
+                m_fragments.clear();
+                return;
+            }
+
+            append(buffer, offset, length);
+
+            if ((flags & FrameDescriptor::END_FRAG) == FrameDescriptor::END_FRAG)
+            {
+                m_delegate(m_fragments, header);
+                m_fragments.clear();
+            }
+        }
+    }
+};
+
 }
 
 #endif
@@ -0,0 +1,190 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#endif
+
+#include <algorithm>
+#include <cstring>
+
+#include "InlineSender.h"
+#include "concurrent/logbuffer/TermScanner.h"
+
+namespace aeron
+{
+
+using namespace aeron::concurrent::logbuffer;
+
+
+static const std::int32_t SENDER_LIMIT_TYPE_ID = 9;
+static const std::int32_t SENDER_INLINE_POSITION_TYPE_ID = 25;
+static const util::index_t ADDRESS_TYPE_OFFSET = 16;
+static const util::index_t PORT_OFFSET = 20;
+static const util::index_t ADDRESS_OFFSET = 24;
+static const std::int32_t ADDRESS_TYPE_IPV6 = 6;
+static const char INLINE_SEND_PARAM[] = "inline-send=true";
+
+InlineSender::InlineSender(
+    const CountersReader &countersReader,
+    const std::string &channel,
+    std::int64_t registrationId,
+    std::int32_t mtuLength) :
+    m_valuesBuffer(countersReader.valuesBuffer()),
+    m_mtuLength(mtuLength)
+{
+#if !defined(_WIN32)
+    if (std::string::npos == channel.find(INLINE_SEND_PARAM))
+    {
+        return;
+    }
+
+    std::int32_t positionCounterId = CountersReader::NULL_COUNTER_ID;
+    std::int32_t senderLimitCounterId = CountersReader::NULL_COUNTER_ID;
+    std::int32_t addressType = 0;
+    std::int32_t port = 0;
+    std::uint8_t address[16] = {};
+
+    countersReader.forEach(
+        [&](std::int32_t counterId, std::int32_t typeId, const AtomicBuffer &keyBuffer, const std::string &label)
+        {
+            if (registrationId != keyBuffer.getInt64(0))
+            {
+                return;
+            }
+
+            if (SENDER_INLINE_POSITION_TYPE_ID == typeId)
+            {
+                positionCounterId = counterId;
+                addressType = keyBuffer.getInt32(ADDRESS_TYPE_OFFSET);
+                port = keyBuffer.getInt32(PORT_OFFSET);
+                keyBuffer.getBytes(ADDRESS_OFFSET, address, sizeof(address));
+            }
+            else if (SENDER_LIMIT_TYPE_ID == typeId)
+            {
+                senderLimitCounterId = counterId;
+            }
+        });
+
+    if (CountersReader::NULL_COUNTER_ID == positionCounterId || CountersReader::NULL_COUNTER_ID == senderLimitCounterId)
+    {
+        return;
+    }
+
+    int family;
+    if (ADDRESS_TYPE_IPV6 == addressType)
+    {
+        auto *in6Addr = reinterpret_cast<sockaddr_in6 *>(m_address);
+        in6Addr->sin6_family = AF_INET6;
+        in6Addr->sin6_port = htons(static_cast<std::uint16_t>(port));
+        std::memcpy(&in6Addr->sin6_addr, address, sizeof(in6Addr->sin6_addr));
+        m_addressLength = sizeof(sockaddr_in6);
+        family = AF_INET6;
+    }
+    else
+    {
+        auto *inAddr = reinterpret_cast<sockaddr_in *>(m_address);
+        inAddr->sin_family = AF_INET;
+        inAddr->sin_port = htons(static_cast<std::uint16_t>(port));
+        std::memcpy(&inAddr->sin_addr, address, sizeof(inAddr->sin_addr));
+        m_addressLength = sizeof(sockaddr_in);
+        family = AF_INET;
+    }
+
+    const int fd = ::socket(family, SOCK_DGRAM, 0);
+    if (fd < 0)
+    {
+        throw util::IOException("could not open inline send socket for " + channel, SOURCEINFO);
+    }
+
+    const int flags = ::fcntl(fd, F_GETFL, 0);
+    if (flags < 0 || ::fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0)
+    {
+        ::close(fd);
+        throw util::IOException("could not make inline send socket non-blocking for " + channel, SOURCEINFO);
+    }
+
+    m_socket = fd;
+    m_positionOffset = CountersReader::counterOffset(positionCounterId);
+    m_senderLimitOffset = CountersReader::counterOffset(senderLimitCounterId);
+#endif
+}
+
+InlineSender::~InlineSender()
+{
+#if !defined(_WIN32)
+    if (-1 != m_socket)
+    {
+        ::close(static_cast<int>(m_socket));
+    }
+#endif
+}
+
+void InlineSender::send(LogBuffers &logBuffers, std::int64_t producerPosition) noexcept
+{
+#if !defined(_WIN32)
+    const std::int64_t startPosition = m_valuesBuffer.getInt64Volatile(m_positionOffset);
+    const std::int64_t senderLimit = m_valuesBuffer.getInt64Volatile(m_senderLimitOffset);
+    const std::int64_t limit = std::min(producerPosition, senderLimit);
+    const std::int32_t termLength = logBuffers.atomicBuffer(0).capacity();
+    const std::int32_t positionBitsToShift = util::BitUtil::numberOfTrailingZeroes(termLength);
+    std::int64_t position = startPosition;
+
+    while (position < limit)
+    {
+        const int index = LogBufferDescriptor::indexByPosition(position, positionBitsToShift);
+        const std::int32_t termOffset = static_cast<std::int32_t>(position) & (termLength - 1);
+        AtomicBuffer &termBuffer = logBuffers.atomicBuffer(index);
+        const std::int32_t window = static_cast<std::int32_t>(std::min<std::int64_t>(limit - position, m_mtuLength));
+
+        const std::int64_t outcome = TermScanner::scanForAvailability(termBuffer, termOffset, window);
+        const std::int32_t available = TermScanner::available(outcome);
+        const std::int32_t padding = TermScanner::padding(outcome);
+
+        if (available > 0)
+        {
+            if (::sendto(
+                static_cast<int>(m_socket),
+                termBuffer.buffer() + termOffset,
+                static_cast<std::size_t>(available),
+                0,
+                reinterpret_cast<const sockaddr *>(m_address),
+                static_cast<socklen_t>(m_addressLength)) < 0)
+            {
+                break;
+            }
+        }
+        else if (0 == padding)
+        {
+            break;
+        }
+
+        position += available + padding;
+    }
+
+    std::int64_t current = startPosition;
+    while (current < position && !m_valuesBuffer.compareAndSetInt64(m_positionOffset, current, position))
+    {
+        current = m_valuesBuffer.getInt64Volatile(m_positionOffset);
+    }
+#endif
+}
+
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef AERON_INLINESENDER_H
+#define AERON_INLINESENDER_H
+
+#include <string>
+
+#include "LogBuffers.h"
+#include "concurrent/CountersReader.h"
+
+namespace aeron
+{
+
+using namespace aeron::concurrent;
+
+/**
+ * Sends the frames an {@link ExclusivePublication} appends from the publishing thread when its channel has
+ * inline-send=true, rather than leaving them for the Sender in the media driver. The driver resolves the endpoint
+ * into the key of a snd-inline-pos counter which holds the highest position sent by either of them. Not supported
+ * on Windows, where the Sender sends the frames once its grace period is over.
+ */
+class InlineSender
+{
+public:
+    InlineSender(
+        const CountersReader &countersReader,
+        const std::string &channel,
+        std::int64_t registrationId,
+        std::int32_t mtuLength);
+
+    ~InlineSender();
+
+    InlineSender(const InlineSender &) = delete;
+    InlineSender &operator=(const InlineSender &) = delete;
+
+    inline bool isEnabled() const
+    {
+        return -1 != m_socket;
+    }
+
+    /**
+     * Send the frames between the highest position sent and the producer position, bounded by the sender limit.
+     *
+     * @param logBuffers         of the publication.
+     * @param producerPosition   up to which frames have been appended.
+     */
+    void send(LogBuffers &logBuffers, std::int64_t producerPosition) noexcept;
+
+private:
+    AtomicBuffer m_valuesBuffer;
+    util::index_t m_positionOffset = 0;
+    util::index_t m_senderLimitOffset = 0;
+    std::int64_t m_socket = -1;
+    std::int32_t m_mtuLength;
+    std::uint32_t m_addressLength = 0;
+    alignas(8) std::uint8_t m_address[128] = {};
+};
+
+}
+
+#endif
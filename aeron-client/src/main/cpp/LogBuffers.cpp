@@ -22,12 +22,17 @@ namespace aeron
 using namespace aeron::util;
 using namespace aeron::concurrent::logbuffer;
 
-LogBuffers::LogBuffers(const char *filename, bool preTouch)
+LogBuffers::LogBuffers(const char *filename, bool preTouch, bool lockMemory)
 {
     const std::int64_t logLength = MemoryMappedFile::getFileSize(filename);
 
     m_memoryMappedFiles = MemoryMappedFile::mapExisting(filename);
 
+    if (lockMemory)
+    {
+        m_memoryMappedFiles->lock();
+    }
+
     std::uint8_t *basePtr = m_memoryMappedFiles->getMemoryPtr();
 
     m_buffers[LogBufferDescriptor::LOG_META_DATA_SECTION_INDEX]
@@ -34,7 +34,7 @@ using namespace aeron::concurrent::logbuffer;
 class CLIENT_EXPORT LogBuffers
 {
 public:
-    explicit LogBuffers(const char *filename, bool preTouch);
+    explicit LogBuffers(const char *filename, bool preTouch, bool lockMemory = false);
 
     LogBuffers(std::uint8_t *address, std::int64_t logLength, std::int32_t termLength);
 
@@ -0,0 +1,147 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "OfferStats.h"
+#include "Publication.h"
+#include "concurrent/LatencyHistogram.h"
+
+namespace aeron
+{
+
+static const std::int32_t PUBLICATION_OFFER_TYPE_ID = 30;
+static const util::index_t METRIC_OFFSET = 16;
+static const char OFFER_STATS_PARAM[] = "offer-stats=true";
+
+static const int METRIC_BACK_PRESSURED = 0;
+static const int METRIC_NOT_CONNECTED = 1;
+static const int METRIC_ADMIN_ACTION = 2;
+static const int METRIC_MAX_POSITION_EXCEEDED = 3;
+static const int METRIC_OFFERED_BYTES = 4;
+static const int METRIC_ACCEPTED_BYTES = 5;
+static const int METRIC_BACK_PRESSURED_NS = 6;
+static const int METRIC_BACK_PRESSURED_BUCKET = 7;
+static const std::int64_t BACK_PRESSURED_BUCKET_LIMITS_NS[] = { 10000, 100000, 1000000, 10000000 };
+static const int BACK_PRESSURED_BUCKET_LIMIT_COUNT =
+    sizeof(BACK_PRESSURED_BUCKET_LIMITS_NS) / sizeof(BACK_PRESSURED_BUCKET_LIMITS_NS[0]);
+
+OfferStats::OfferStats(
+    const CountersReader &countersReader, const std::string &channel, std::int64_t registrationId) :
+    m_valuesBuffer(countersReader.valuesBuffer())
+{
+    if (std::string::npos == channel.find(OFFER_STATS_PARAM))
+    {
+        return;
+    }
+
+    std::int32_t counterIds[METRIC_COUNT];
+    for (int i = 0; i < METRIC_COUNT; i++)
+    {
+        counterIds[i] = CountersReader::NULL_COUNTER_ID;
+    }
+
+    countersReader.forEach(
+        [&](std::int32_t counterId, std::int32_t typeId, const AtomicBuffer &keyBuffer, const std::string &label)
+        {
+            if (PUBLICATION_OFFER_TYPE_ID == typeId && registrationId == keyBuffer.getInt64(0))
+            {
+                const std::int32_t metric = keyBuffer.getInt32(METRIC_OFFSET);
+                if (metric >= 0 && metric < METRIC_COUNT)
+                {
+                    counterIds[metric] = counterId;
+                }
+            }
+        });
+
+    for (int i = 0; i < METRIC_COUNT; i++)
+    {
+        if (CountersReader::NULL_COUNTER_ID == counterIds[i])
+        {
+            return;
+        }
+
+        m_offsets[i] = CountersReader::counterOffset(counterIds[i]);
+    }
+
+    m_isEnabled = true;
+}
+
+void OfferStats::record(std::int64_t length, std::int64_t result) noexcept
+{
+    m_valuesBuffer.getAndAddInt64(m_offsets[METRIC_OFFERED_BYTES], length);
+    const std::int64_t sinceNs = m_backPressuredSinceNs.load(std::memory_order_acquire);
+
+    if (result > 0)
+    {
+        m_valuesBuffer.getAndAddInt64(m_offsets[METRIC_ACCEPTED_BYTES], length);
+        if (0 != sinceNs)
+        {
+            endBackPressure(sinceNs);
+        }
+
+        return;
+    }
+
+    switch (result)
+    {
+        case BACK_PRESSURED:
+        {
+            m_valuesBuffer.getAndAddInt64(m_offsets[METRIC_BACK_PRESSURED], 1);
+            if (0 == sinceNs)
+            {
+                std::int64_t expected = 0;
+                m_backPressuredSinceNs.compare_exchange_strong(expected, sendTimestampNanoClock());
+            }
+            break;
+        }
+
+        case NOT_CONNECTED:
+            m_valuesBuffer.getAndAddInt64(m_offsets[METRIC_NOT_CONNECTED], 1);
+            break;
+
+        case ADMIN_ACTION:
+            m_valuesBuffer.getAndAddInt64(m_offsets[METRIC_ADMIN_ACTION], 1);
+            break;
+
+        case MAX_POSITION_EXCEEDED:
+            m_valuesBuffer.getAndAddInt64(m_offsets[METRIC_MAX_POSITION_EXCEEDED], 1);
+            break;
+
+        default:
+            break;
+    }
+}
+
+void OfferStats::endBackPressure(std::int64_t sinceNs) noexcept
+{
+    std::int64_t expected = sinceNs;
+    if (!m_backPressuredSinceNs.compare_exchange_strong(expected, 0))
+    {
+        return;
+    }
+
+    const std::int64_t durationNs = sendTimestampNanoClock() - sinceNs;
+    int bucket = 0;
+    while (bucket < BACK_PRESSURED_BUCKET_LIMIT_COUNT && durationNs > BACK_PRESSURED_BUCKET_LIMITS_NS[bucket])
+    {
+        bucket++;
+    }
+
+    m_valuesBuffer.getAndAddInt64(m_offsets[METRIC_BACK_PRESSURED_NS], durationNs);
+    m_valuesBuffer.getAndAddInt64(m_offsets[METRIC_BACK_PRESSURED_BUCKET + bucket], 1);
+}
+
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef AERON_OFFERSTATS_H
+#define AERON_OFFERSTATS_H
+
+#include <atomic>
+#include <string>
+
+#include "concurrent/CountersReader.h"
+
+namespace aeron
+{
+
+using namespace aeron::concurrent;
+
+/**
+ * Records the results of offers and claims on a publication into the pub-offer counters the media driver allocates
+ * for it when its channel has offer-stats=true. A back pressured period runs from the first back pressured result to
+ * the next accepted one and is added to the total time back pressured and to one of the duration buckets. The
+ * counters are shared by all publications with the same registration id, so they are updated atomically.
+ */
+class OfferStats
+{
+public:
+    OfferStats(const CountersReader &countersReader, const std::string &channel, std::int64_t registrationId);
+
+    OfferStats(const OfferStats &) = delete;
+    OfferStats &operator=(const OfferStats &) = delete;
+
+    inline bool isEnabled() const
+    {
+        return m_isEnabled;
+    }
+
+    /**
+     * Record the result of an offer or claim.
+     *
+     * @param length of the message offered.
+     * @param result of the offer, a new position or one of the publication result codes.
+     */
+    void record(std::int64_t length, std::int64_t result) noexcept;
+
+private:
+    static const int METRIC_COUNT = 12;
+
+    AtomicBuffer m_valuesBuffer;
+    util::index_t m_offsets[METRIC_COUNT] = {};
+    std::atomic<std::int64_t> m_backPressuredSinceNs = { 0 };
+    bool m_isEnabled = false;
+
+    void endBackPressure(std::int64_t sinceNs) noexcept;
+};
+
+}
+
+#endif
@@ -61,6 +61,13 @@ Publication::Publication(
             m_logBuffers->atomicBuffer(LogBufferDescriptor::LOG_META_DATA_SECTION_INDEX),
             i));
     }
+
+    m_offerStats = std::unique_ptr<OfferStats>(new OfferStats(
+        m_conductor.countersReader(), m_channel, m_registrationId));
+    if (!m_offerStats->isEnabled())
+    {
+        m_offerStats.reset();
+    }
 }
 
 Publication::~Publication()
@@ -19,13 +19,16 @@
 
 #include <array>
 #include <memory>
+#include <new>
 #include <string>
+#include <vector>
 
 #include "concurrent/logbuffer/BufferClaim.h"
 #include "concurrent/logbuffer/TermAppender.h"
 #include "concurrent/status/UnsafeBufferPosition.h"
 #include "concurrent/status/StatusIndicatorReader.h"
 #include "LogBuffers.h"
+#include "OfferStats.h"
 #include "util/Export.h"
 
 namespace aeron
@@ -40,6 +43,7 @@ static const std::int64_t BACK_PRESSURED = -2;
 static const std::int64_t ADMIN_ACTION = -3;
 static const std::int64_t PUBLICATION_CLOSED = -4;
 static const std::int64_t MAX_POSITION_EXCEEDED = -5;
+static const std::int64_t PUBLICATION_ERROR = -6;
 
 /**
  * @example BasicPublisher.cpp
@@ -332,55 +336,14 @@ public:
      * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
      * {@link #ADMIN_ACTION} or {@link #CLOSED}.
      */
+    template<typename ReservedValueSupplier>
     inline std::int64_t offer(
         const concurrent::AtomicBuffer &buffer,
         util::index_t offset,
         util::index_t length,
-        const on_reserved_value_supplier_t &reservedValueSupplier)
+        const ReservedValueSupplier &reservedValueSupplier)
     {
-        std::int64_t newPosition = PUBLICATION_CLOSED;
-
-        if (!isClosed())
-        {
-            const std::int64_t limit = m_publicationLimit.getVolatile();
-            const std::int32_t termCount = LogBufferDescriptor::activeTermCount(m_logMetaDataBuffer);
-            TermAppender *termAppender = m_appenders[LogBufferDescriptor::indexByTermCount(termCount)].get();
-            const std::int64_t rawTail = termAppender->rawTailVolatile();
-            const std::int64_t termOffset = rawTail & 0xFFFFFFFF;
-            const std::int32_t termId = LogBufferDescriptor::termId(rawTail);
-            const std::int64_t position = LogBufferDescriptor::computeTermBeginPosition(
-                termId, m_positionBitsToShift, m_initialTermId) + termOffset;
-
-            if (termCount != (termId - m_initialTermId))
-            {
-                return ADMIN_ACTION;
-            }
-
-            if (position < limit)
-            {
-                std::int32_t resultingOffset;
-                if (length <= m_maxPayloadLength)
-                {
-                    resultingOffset = termAppender->appendUnfragmentedMessage(
-                        m_headerWriter, buffer, offset, length, reservedValueSupplier, termId);
-                }
-                else
-                {
-                    checkMaxMessageLength(length);
-                    resultingOffset = termAppender->appendFragmentedMessage(
-                        m_headerWriter, buffer, offset, length, m_maxPayloadLength, reservedValueSupplier, termId);
-                }
-
-                newPosition = Publication::newPosition(
-                    termCount, static_cast<std::int32_t>(termOffset), termId, position, resultingOffset);
-            }
-            else
-            {
-                newPosition = Publication::backPressureStatus(position, length);
-            }
-        }
-
-        return newPosition;
+        return offerMessage<true>(buffer, offset, length, reservedValueSupplier);
     }
 
     /**
@@ -394,7 +357,25 @@ public:
      */
     inline std::int64_t offer(const concurrent::AtomicBuffer &buffer, util::index_t offset, util::index_t length)
     {
-        return offer(buffer, offset, length, DEFAULT_RESERVED_VALUE_SUPPLIER);
+        return offer(buffer, offset, length, NoReservedValueSupplier());
+    }
+
+    /**
+     * Non-blocking publish of a message whose length is known at compile time and which has no reserved value, so
+     * the frame length, alignment and reserved value are resolved by the compiler. Intended for fixed size messages
+     * which fit within the MTU.
+     *
+     * @tparam Length in bytes of the encoded message.
+     * @param buffer containing message.
+     * @param offset offset in the buffer at which the encoded message begins.
+     * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
+     * {@link #ADMIN_ACTION} or {@link #CLOSED}.
+     */
+    template<util::index_t Length>
+    inline std::int64_t offerFixed(const concurrent::AtomicBuffer &buffer, util::index_t offset)
+    {
+        static_assert(Length >= 0, "message length must not be negative");
+        return offer(buffer, offset, Length, NoReservedValueSupplier());
     }
 
     /**
@@ -408,6 +389,48 @@ public:
         return offer(buffer, 0, buffer.capacity());
     }
 
+    /**
+     * Non-blocking publish of a buffer containing a message which reports a message longer than the max message
+     * length with a return code, as the C API does, rather than an exception. The offer path then has no exception
+     * handling, for callers that handle errors by status code in their hot path.
+     *
+     * @param buffer containing message.
+     * @param offset offset in the buffer at which the encoded message begins.
+     * @param length in bytes of the encoded message.
+     * @param reservedValueSupplier for the frame, which must not throw.
+     * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
+     * {@link #ADMIN_ACTION}, {@link #CLOSED}, {@link #MAX_POSITION_EXCEEDED} or {@link #PUBLICATION_ERROR}.
+     */
+    template<typename ReservedValueSupplier>
+    inline std::int64_t offer(
+        const concurrent::AtomicBuffer &buffer,
+        util::index_t offset,
+        util::index_t length,
+        const ReservedValueSupplier &reservedValueSupplier,
+        const std::nothrow_t &) noexcept
+    {
+        return offerMessage<false>(buffer, offset, length, reservedValueSupplier);
+    }
+
+    /**
+     * Non-blocking publish of a buffer containing a message which reports errors with a return code rather than an
+     * exception.
+     *
+     * @param buffer containing message.
+     * @param offset offset in the buffer at which the encoded message begins.
+     * @param length in bytes of the encoded message.
+     * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
+     * {@link #ADMIN_ACTION}, {@link #CLOSED}, {@link #MAX_POSITION_EXCEEDED} or {@link #PUBLICATION_ERROR}.
+     */
+    inline std::int64_t offer(
+        const concurrent::AtomicBuffer &buffer,
+        util::index_t offset,
+        util::index_t length,
+        const std::nothrow_t &nothrow) noexcept
+    {
+        return offer(buffer, offset, length, NoReservedValueSupplier(), nothrow);
+    }
+
     /**
      * Non-blocking publish of buffers containing a message.
      *
@@ -452,7 +475,7 @@ public:
 
             if (termCount != (termId - m_initialTermId))
             {
-                return ADMIN_ACTION;
+                return recordOffer(length, ADMIN_ACTION);
             }
 
             if (position < limit)
@@ -479,7 +502,7 @@ public:
             }
         }
 
-        return newPosition;
+        return recordOffer(length, newPosition);
     }
 
     /**
@@ -515,6 +538,141 @@ public:
         return offer(buffers.begin(), buffers.end(), reservedValueSupplier);
     }
 
+    /**
+     * Non-blocking publish of a batch of independent messages, one per buffer, with a single claim on the term tail
+     * rather than one per message. Each message must fit within the max payload length and the whole batch within a
+     * term.
+     * <p>
+     * If the batch runs past the end of the current term the messages that fit are still published and
+     * {@link #ADMIN_ACTION} is returned, so the remaining messages from appendedCount onwards should be offered again.
+     *
+     * @param startBuffer of the first message.
+     * @param lastBuffer after the last message.
+     * @param appendedCount set to the index of the first message not published, the batch size when all were.
+     * @param reservedValueSupplier for each frame.
+     * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
+     * {@link #ADMIN_ACTION} or {@link #CLOSED}.
+     * @throws IllegalArgumentException if a message is greater than max payload length or the batch is longer than
+     * a term.
+     */
+    template<class BufferIterator>
+    std::int64_t offerBatch(
+        BufferIterator startBuffer,
+        BufferIterator lastBuffer,
+        std::size_t &appendedCount,
+        const on_reserved_value_supplier_t &reservedValueSupplier = DEFAULT_RESERVED_VALUE_SUPPLIER)
+    {
+        std::int64_t batchLength = 0;
+        for (BufferIterator it = startBuffer; it != lastBuffer; ++it)
+        {
+            checkPayloadLength(it->capacity());
+            batchLength += util::BitUtil::align(
+                it->capacity() + DataFrameHeader::LENGTH, FrameDescriptor::FRAME_ALIGNMENT);
+        }
+
+        if (batchLength > termBufferLength())
+        {
+            throw util::IllegalArgumentException(
+                "batch exceeds termBufferLength of " + std::to_string(termBufferLength()) +
+                ", length=" + std::to_string(batchLength), SOURCEINFO);
+        }
+
+        appendedCount = 0;
+        std::int64_t newPosition = PUBLICATION_CLOSED;
+
+        if (!isClosed())
+        {
+            const std::int64_t limit = m_publicationLimit.getVolatile();
+            const std::int32_t termCount = LogBufferDescriptor::activeTermCount(m_logMetaDataBuffer);
+            TermAppender *termAppender = m_appenders[LogBufferDescriptor::indexByTermCount(termCount)].get();
+            const std::int64_t rawTail = termAppender->rawTailVolatile();
+            const std::int64_t termOffset = rawTail & 0xFFFFFFFF;
+            const std::int32_t termId = LogBufferDescriptor::termId(rawTail);
+            const std::int64_t position = LogBufferDescriptor::computeTermBeginPosition(
+                termId, m_positionBitsToShift, m_initialTermId) + termOffset;
+
+            if (termCount != (termId - m_initialTermId))
+            {
+                return ADMIN_ACTION;
+            }
+
+            if (position < limit)
+            {
+                const std::int32_t resultingOffset = termAppender->appendUnfragmentedBatch(
+                    m_headerWriter,
+                    startBuffer,
+                    lastBuffer,
+                    static_cast<util::index_t>(batchLength),
+                    appendedCount,
+                    reservedValueSupplier,
+                    termId);
+
+                newPosition = Publication::newPosition(
+                    termCount, static_cast<std::int32_t>(termOffset), termId, position, resultingOffset);
+            }
+            else
+            {
+                newPosition = Publication::backPressureStatus(position, static_cast<std::int32_t>(batchLength));
+            }
+        }
+
+        return newPosition;
+    }
+
+    /**
+     * Offer a block of pre-formatted message fragments, such as one captured with a block poll, with a single claim
+     * on the term tail. The term offset, term id, session id and stream id of each frame are rewritten for this
+     * publication.
+     * <p>
+     * If the block does not fit in the remainder of the current term then {@link #ADMIN_ACTION} is returned and the
+     * block should be offered again.
+     *
+     * @param buffer containing the pre-formatted block of message fragments, beginning with a data frame.
+     * @param offset offset in the buffer at which the first fragment begins.
+     * @param length in bytes of the encoded block.
+     * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
+     * {@link #ADMIN_ACTION} or {@link #CLOSED}.
+     * @throws IllegalArgumentException if the block is not a whole number of frames or is longer than a term.
+     */
+    std::int64_t offerBlock(const concurrent::AtomicBuffer &buffer, util::index_t offset, util::index_t length)
+    {
+        checkBlock(buffer, offset, length);
+
+        std::int64_t newPosition = PUBLICATION_CLOSED;
+
+        if (!isClosed())
+        {
+            const std::int64_t limit = m_publicationLimit.getVolatile();
+            const std::int32_t termCount = LogBufferDescriptor::activeTermCount(m_logMetaDataBuffer);
+            TermAppender *termAppender = m_appenders[LogBufferDescriptor::indexByTermCount(termCount)].get();
+            const std::int64_t rawTail = termAppender->rawTailVolatile();
+            const std::int64_t termOffset = rawTail & 0xFFFFFFFF;
+            const std::int32_t termId = LogBufferDescriptor::termId(rawTail);
+            const std::int64_t position = LogBufferDescriptor::computeTermBeginPosition(
+                termId, m_positionBitsToShift, m_initialTermId) + termOffset;
+
+            if (termCount != (termId - m_initialTermId))
+            {
+                return ADMIN_ACTION;
+            }
+
+            if (position < limit)
+            {
+                const std::int32_t resultingOffset = termAppender->appendBlock(
+                    m_headerWriter, buffer, offset, length, m_sessionId, m_streamId, termId);
+
+                newPosition = Publication::newPosition(
+                    termCount, static_cast<std::int32_t>(termOffset), termId, position, resultingOffset);
+            }
+            else
+            {
+                newPosition = Publication::backPressureStatus(position, length);
+            }
+        }
+
+        return newPosition;
+    }
+
     /**
      * Try to claim a range in the publication log into which a message can be written with zero copy semantics.
      * Once the message has been written then {@link BufferClaim#commit()} should be called thus making it available.
@@ -565,7 +723,7 @@ public:
 
             if (termCount != (termId - m_initialTermId))
             {
-                return ADMIN_ACTION;
+                return recordOffer(length, ADMIN_ACTION);
             }
 
             if (position < limit)
@@ -580,6 +738,86 @@ public:
             }
         }
 
+        return recordOffer(length, newPosition);
+    }
+
+    /**
+     * Try to claim a range in the publication log for a message that may be larger than the max payload length. The
+     * range is split into max payload length sized fragments and one BufferClaim is wrapped for each so the message
+     * can be written directly into the term buffer without an intermediate copy.
+     * <p>
+     * Every claim must then be committed, or all of them aborted. Committing some fragments and aborting others will
+     * deliver an incomplete message.
+     *
+     * @code
+     *     std::vector<BufferClaim> bufferClaims; // Can be stored and reused to avoid allocation
+     *
+     *     if (publication->tryClaimFragmented(messageLength, bufferClaims) > 0)
+     *     {
+     *         for (BufferClaim &bufferClaim : bufferClaims)
+     *         {
+     *             // Work with bufferClaim.buffer() directly from bufferClaim.offset()
+     *             bufferClaim.commit();
+     *         }
+     *     }
+     * @endcode
+     *
+     * @param length       of the message to claim, in bytes.
+     * @param bufferClaims resized to the number of fragments and populated if the claim succeeds.
+     * @return The new stream position, otherwise {@link #NOT_CONNECTED}, {@link #BACK_PRESSURED},
+     * {@link #ADMIN_ACTION} or {@link #CLOSED}.
+     * @throws IllegalArgumentException if the length is greater than max message length.
+     * @see BufferClaim::commit
+     */
+    std::int64_t tryClaimFragmented(
+        util::index_t length, std::vector<concurrent::logbuffer::BufferClaim> &bufferClaims)
+    {
+        checkMaxMessageLength(length);
+
+        const std::size_t fragmentCount = length <= m_maxPayloadLength ?
+            1 : static_cast<std::size_t>((length + m_maxPayloadLength - 1) / m_maxPayloadLength);
+        bufferClaims.resize(fragmentCount);
+
+        std::int64_t newPosition = PUBLICATION_CLOSED;
+
+        if (!isClosed())
+        {
+            const std::int64_t limit = m_publicationLimit.getVolatile();
+            const std::int32_t termCount = LogBufferDescriptor::activeTermCount(m_logMetaDataBuffer);
+            TermAppender *termAppender = m_appenders[LogBufferDescriptor::indexByTermCount(termCount)].get();
+            const std::int64_t rawTail = termAppender->rawTailVolatile();
+            const std::int64_t termOffset = rawTail & 0xFFFFFFFF;
+            const std::int32_t termId = LogBufferDescriptor::termId(rawTail);
+            const std::int64_t position = LogBufferDescriptor::computeTermBeginPosition(
+                termId, m_positionBitsToShift, m_initialTermId) + termOffset;
+
+            if (termCount != (termId - m_initialTermId))
+            {
+                return ADMIN_ACTION;
+            }
+
+            if (position < limit)
+            {
+                std::int32_t resultingOffset;
+                if (1 == fragmentCount)
+                {
+                    resultingOffset = termAppender->claim(m_headerWriter, length, bufferClaims[0], termId);
+                }
+                else
+                {
+                    resultingOffset = termAppender->claimFragmented(
+                        m_headerWriter, length, m_maxPayloadLength, bufferClaims.begin(), termId);
+                }
+
+                newPosition = Publication::newPosition(
+                    termCount, static_cast<std::int32_t>(termOffset), termId, position, resultingOffset);
+            }
+            else
+            {
+                newPosition = Publication::backPressureStatus(position, length);
+            }
+        }
+
         return newPosition;
     }
 
@@ -628,6 +866,66 @@ public:
     /// @endcond
 
 private:
+    template<bool ThrowOnError, typename ReservedValueSupplier>
+    inline std::int64_t offerMessage(
+        const concurrent::AtomicBuffer &buffer,
+        util::index_t offset,
+        util::index_t length,
+        const ReservedValueSupplier &reservedValueSupplier) noexcept(!ThrowOnError)
+    {
+        std::int64_t newPosition = PUBLICATION_CLOSED;
+
+        if (!isClosed())
+        {
+            const std::int64_t limit = m_publicationLimit.getVolatile();
+            const std::int32_t termCount = LogBufferDescriptor::activeTermCount(m_logMetaDataBuffer);
+            TermAppender *termAppender = m_appenders[LogBufferDescriptor::indexByTermCount(termCount)].get();
+            const std::int64_t rawTail = termAppender->rawTailVolatile();
+            const std::int64_t termOffset = rawTail & 0xFFFFFFFF;
+            const std::int32_t termId = LogBufferDescriptor::termId(rawTail);
+            const std::int64_t position = LogBufferDescriptor::computeTermBeginPosition(
+                termId, m_positionBitsToShift, m_initialTermId) + termOffset;
+
+            if (termCount != (termId - m_initialTermId))
+            {
+                return recordOffer(length, ADMIN_ACTION);
+            }
+
+            if (position < limit)
+            {
+                std::int32_t resultingOffset;
+                if (AERON_COND_EXPECT((length <= m_maxPayloadLength), true))
+                {
+                    resultingOffset = termAppender->appendUnfragmentedMessage(
+                        m_headerWriter, buffer, offset, length, reservedValueSupplier, termId);
+                }
+                else
+                {
+                    if (ThrowOnError)
+                    {
+                        checkMaxMessageLength(length);
+                    }
+                    else if (length > m_maxMessageLength)
+                    {
+                        return PUBLICATION_ERROR;
+                    }
+
+                    resultingOffset = termAppender->appendFragmentedMessage(
+                        m_headerWriter, buffer, offset, length, m_maxPayloadLength, reservedValueSupplier, termId);
+                }
+
+                newPosition = Publication::newPosition(
+                    termCount, static_cast<std::int32_t>(termOffset), termId, position, resultingOffset);
+            }
+            else
+            {
+                newPosition = Publication::backPressureStatus(position, length);
+            }
+        }
+
+        return recordOffer(length, newPosition);
+    }
+
     ClientConductor &m_conductor;
     AtomicBuffer &m_logMetaDataBuffer;
     const std::string m_channel;
@@ -647,6 +945,17 @@ private:
     std::shared_ptr<LogBuffers> m_logBuffers;
     std::unique_ptr<TermAppender> m_appenders[3];
     HeaderWriter m_headerWriter;
+    std::unique_ptr<OfferStats> m_offerStats;
+
+    inline std::int64_t recordOffer(util::index_t length, std::int64_t result) noexcept
+    {
+        if (nullptr != m_offerStats)
+        {
+            m_offerStats->record(length, result);
+        }
+
+        return result;
+    }
 
     inline std::int64_t newPosition(
         std::int32_t termCount,
@@ -657,6 +966,7 @@ private:
     {
         if (resultingOffset > 0)
         {
+            LogBufferDescriptor::notifyData(m_logMetaDataBuffer);
             return (position - termOffset) + resultingOffset;
         }
 
@@ -704,6 +1014,36 @@ private:
                 ", length=" + std::to_string(length), SOURCEINFO);
         }
     }
+
+    inline void checkBlock(const concurrent::AtomicBuffer &buffer, util::index_t offset, util::index_t length) const
+    {
+        if (length < DataFrameHeader::LENGTH || length > termBufferLength() ||
+            0 != (length & (FrameDescriptor::FRAME_ALIGNMENT - 1)))
+        {
+            throw util::IllegalArgumentException(
+                "invalid block length " + std::to_string(length) +
+                ", termBufferLength=" + std::to_string(termBufferLength()), SOURCEINFO);
+        }
+
+        for (util::index_t blockOffset = 0; blockOffset < length;)
+        {
+            const std::int32_t frameLength = buffer.getInt32(offset + blockOffset);
+            const std::uint16_t frameType = buffer.getUInt16(offset + blockOffset + DataFrameHeader::TYPE_FIELD_OFFSET);
+            const bool isValidType = DataFrameHeader::HDR_TYPE_DATA == frameType ||
+                (0 != blockOffset && DataFrameHeader::HDR_TYPE_PAD == frameType);
+
+            if (frameLength < DataFrameHeader::LENGTH || !isValidType ||
+                blockOffset + util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT) > length)
+            {
+                throw util::IllegalArgumentException(
+                    "improperly formatted block: frameLength=" + std::to_string(frameLength) +
+                    " frameType=" + std::to_string(frameType) + " at offset=" + std::to_string(blockOffset) +
+                    " of length=" + std::to_string(length), SOURCEINFO);
+            }
+
+            blockOffset += util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+        }
+    }
 };
 
 }
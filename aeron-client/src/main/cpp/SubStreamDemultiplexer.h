@@ -0,0 +1,147 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_SUB_STREAM_DEMULTIPLEXER_H
+#define AERON_SUB_STREAM_DEMULTIPLEXER_H
+
+#include <unordered_map>
+#include <utility>
+
+#include "concurrent/logbuffer/TermReader.h"
+
+namespace aeron
+{
+
+using namespace aeron::concurrent;
+using namespace aeron::concurrent::logbuffer;
+
+/**
+ * Reserved value supplier which tags each frame of a message with a sub-stream id, so many low rate logical streams
+ * can share one {@link Publication} and be told apart by a {@link SubStreamDemultiplexer} on the subscriber side.
+ * <p>
+ * The sub-stream id is carried in the reserved value of the frame so it cannot be combined with another use of the
+ * reserved value, such as send timestamps.
+ */
+class SubStreamReservedValueSupplier
+{
+public:
+    explicit SubStreamReservedValueSupplier(std::int64_t subStreamId) : m_subStreamId(subStreamId)
+    {
+    }
+
+    inline std::int64_t operator()(AtomicBuffer &termBuffer, util::index_t termOffset, util::index_t length) const
+    {
+        return m_subStreamId;
+    }
+
+private:
+    std::int64_t m_subStreamId;
+};
+
+/**
+ * A handler which dispatches fragments to a handler per sub-stream id, as set by
+ * {@link SubStreamReservedValueSupplier}. Fragments of sub-streams without a handler go to the default handler, or
+ * are dropped if there is none.
+ * <p>
+ * Fragments of a message are contiguous in a stream so a {@link FragmentAssembler} can be added as the handler of a
+ * sub-stream. This class is not threadsafe.
+ */
+class SubStreamDemultiplexer
+{
+public:
+    explicit SubStreamDemultiplexer(fragment_handler_t defaultHandler = nullptr) :
+        m_defaultHandler(std::move(defaultHandler))
+    {
+    }
+
+    /**
+     * Add, or replace, the handler for a sub-stream.
+     *
+     * @param subStreamId of the sub-stream.
+     * @param handler     for fragments of the sub-stream.
+     */
+    void add(std::int64_t subStreamId, fragment_handler_t handler)
+    {
+        m_handlerBySubStreamId[subStreamId] = std::move(handler);
+        m_lastHandler = nullptr;
+    }
+
+    /**
+     * Remove the handler for a sub-stream so its fragments go to the default handler.
+     *
+     * @param subStreamId of the sub-stream.
+     * @return true if removed or false if the sub-stream had no handler.
+     */
+    bool remove(std::int64_t subStreamId)
+    {
+        m_lastHandler = nullptr;
+        return m_handlerBySubStreamId.erase(subStreamId) > 0;
+    }
+
+    /**
+     * Get a fragment_handler_t which dispatches to the handler for the sub-stream of each fragment.
+     *
+     * @return fragment_handler_t for the demultiplexer.
+     */
+    fragment_handler_t handler()
+    {
+        return [this](AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
+        {
+            this->onFragment(buffer, offset, length, header);
+        };
+    }
+
+    inline void operator()(AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
+    {
+        onFragment(buffer, offset, length, header);
+    }
+
+private:
+    std::unordered_map<std::int64_t, fragment_handler_t> m_handlerBySubStreamId;
+    fragment_handler_t m_defaultHandler;
+    fragment_handler_t *m_lastHandler = nullptr;
+    std::int64_t m_lastSubStreamId = 0;
+
+    inline void onFragment(AtomicBuffer &buffer, util::index_t offset, util::index_t length, Header &header)
+    {
+        const std::int64_t subStreamId = header.reservedValue();
+        fragment_handler_t *handler = m_lastHandler;
+
+        if (nullptr == handler || subStreamId != m_lastSubStreamId)
+        {
+            auto it = m_handlerBySubStreamId.find(subStreamId);
+            if (it == m_handlerBySubStreamId.end())
+            {
+                handler = &m_defaultHandler;
+            }
+            else
+            {
+                handler = &it->second;
+                m_lastHandler = handler;
+                m_lastSubStreamId = subStreamId;
+            }
+        }
+
+        if (*handler)
+        {
+            (*handler)(buffer, offset, length, header);
+        }
+    }
+};
+
+}
+
+#endif //AERON_SUB_STREAM_DEMULTIPLEXER_H
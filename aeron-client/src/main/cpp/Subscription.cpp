@@ -34,6 +34,7 @@ Subscription::Subscription(
     m_streamId(streamId),
     m_registrationId(registrationId),
     m_imageArray(),
+    m_imageBySessionId(std::make_shared<const image_by_session_id_t>()),
     m_isClosed(false)
 {
     static_cast<void>(m_paddingBefore);
@@ -44,6 +45,7 @@ Subscription::~Subscription()
 {
     auto imageArrayPair = m_imageArray.load();
 
+    m_conductor.removeEpochParticipant(m_epochParticipant);
     m_conductor.releaseSubscription(m_registrationId, imageArrayPair.first, imageArrayPair.second);
 }
 
@@ -20,7 +20,10 @@
 #include <cstdint>
 #include <memory>
 #include <iterator>
+#include <algorithm>
+#include <unordered_map>
 #include "concurrent/AtomicArrayUpdater.h"
+#include "concurrent/EpochReclaimer.h"
 #include "concurrent/status/StatusIndicatorReader.h"
 #include "Image.h"
 #include "util/Export.h"
@@ -32,6 +35,97 @@ using namespace aeron::concurrent::logbuffer;
 
 class ClientConductor;
 
+/**
+ * View of the array of {@link Image}s of a Subscription at a point in time, taken without allocating.
+ * <p>
+ * The view remains valid after the Subscription's images change for the resource linger timeout of the client,
+ * the same guarantee given to images being polled, so it should be used and discarded rather than retained.
+ */
+class ImageArrayView
+{
+public:
+    ImageArrayView(Image::array_t array, std::size_t length) : m_array(array), m_length(length)
+    {
+    }
+
+    inline const std::shared_ptr<Image> *begin() const
+    {
+        return m_array;
+    }
+
+    inline const std::shared_ptr<Image> *end() const
+    {
+        return m_array + m_length;
+    }
+
+    inline std::size_t size() const
+    {
+        return m_length;
+    }
+
+    inline const std::shared_ptr<Image> &operator[](std::size_t index) const
+    {
+        return m_array[index];
+    }
+
+private:
+    Image::array_t m_array;
+    std::size_t m_length;
+};
+
+/**
+ * Non-owning handle to an {@link Image} of a Subscription which avoids the reference count traffic of
+ * std::shared_ptr on poll and inspection paths.
+ * <p>
+ * The handle records the change number of the Subscription's image list when it was taken. The Image is
+ * guaranteed to be valid while Subscription::imageListChangeNumber() returns the same value, and for the resource
+ * linger timeout of the client after it changes. A handle should be used and discarded, or checked with
+ * Subscription::isCurrent before reuse, and never retained across image list changes.
+ */
+class ImageView
+{
+public:
+    ImageView() = default;
+
+    ImageView(Image *image, std::int64_t changeNumber) : m_image(image), m_changeNumber(changeNumber)
+    {
+    }
+
+    inline Image *get() const
+    {
+        return m_image;
+    }
+
+    inline Image *operator->() const
+    {
+        return m_image;
+    }
+
+    inline Image &operator*() const
+    {
+        return *m_image;
+    }
+
+    inline explicit operator bool() const
+    {
+        return nullptr != m_image;
+    }
+
+    /**
+     * Change number of the Subscription's image list at the time the handle was taken.
+     *
+     * @return change number of the image list at the time the handle was taken.
+     */
+    inline std::int64_t changeNumber() const
+    {
+        return m_changeNumber;
+    }
+
+private:
+    Image *m_image = nullptr;
+    std::int64_t m_changeNumber = -1;
+};
+
 /**
  * Aeron Subscriber API for receiving messages from publishers on a given channel and streamId pair.
  * Subscribers are created via an {@link Aeron} object, and received messages are delivered
@@ -194,6 +288,7 @@ public:
     template<typename F>
     inline int poll(F &&fragmentHandler, int fragmentLimit)
     {
+        EpochReclaimer::Guard epochGuard(m_epochParticipant);
         auto imageArrayPair = m_imageArray.load();
         auto imageArray = imageArrayPair.first;
         const std::size_t length = imageArrayPair.second;
@@ -218,6 +313,101 @@ public:
         return fragmentsRead;
     }
 
+    /**
+     * Poll the {@link Image}s under the subscription for available message fragments, sharing the fragment limit
+     * between Images in proportion to their weights rather than letting the first Images polled consume all of it.
+     * <p>
+     * Each Image with a non-zero weight is polled for up to its share of the fragment limit, with a minimum of one
+     * fragment. Any limit left over is then given round-robin to all Images as with {@link #poll}.
+     *
+     * @param fragmentHandler callback for handling each message fragment as it is read.
+     * @param weightFunc      giving the weight of an Image from its session id, called twice per Image per poll.
+     * @param fragmentLimit   number of message fragments to limit for the poll across multiple Image s.
+     * @return the number of fragments received.
+     */
+    template<typename F, typename W>
+    inline int weightedPoll(F &&fragmentHandler, W &&weightFunc, int fragmentLimit)
+    {
+        EpochReclaimer::Guard epochGuard(m_epochParticipant);
+        auto imageArrayPair = m_imageArray.load();
+        auto imageArray = imageArrayPair.first;
+        const std::size_t length = imageArrayPair.second;
+        int fragmentsRead = 0;
+        std::int64_t totalWeight = 0;
+
+        std::size_t startingIndex = m_roundRobinIndex++;
+        if (startingIndex >= length)
+        {
+            m_roundRobinIndex = startingIndex = 0;
+        }
+
+        for (std::size_t i = 0; i < length; i++)
+        {
+            totalWeight += weightFunc(imageArray[i]->sessionId());
+        }
+
+        for (std::size_t j = 0; j < length && fragmentsRead < fragmentLimit && totalWeight > 0; j++)
+        {
+            auto &image = imageArray[(startingIndex + j) % length];
+            const std::int64_t weight = weightFunc(image->sessionId());
+
+            if (weight > 0)
+            {
+                const int share = std::max(1, static_cast<int>((fragmentLimit * weight) / totalWeight));
+                fragmentsRead += image->poll(fragmentHandler, std::min(share, fragmentLimit - fragmentsRead));
+            }
+        }
+
+        for (std::size_t i = startingIndex; i < length && fragmentsRead < fragmentLimit; i++)
+        {
+            fragmentsRead += imageArray[i]->poll(fragmentHandler, fragmentLimit - fragmentsRead);
+        }
+
+        for (std::size_t i = 0; i < startingIndex && fragmentsRead < fragmentLimit; i++)
+        {
+            fragmentsRead += imageArray[i]->poll(fragmentHandler, fragmentLimit - fragmentsRead);
+        }
+
+        return fragmentsRead;
+    }
+
+    /**
+     * Poll the {@link Image}s under the subscription for available message fragments and fill in a Fragment for each
+     * one rather than calling a handler, so they can be processed by the caller in its own loop.
+     * <p>
+     * The fragments are only valid until the next poll of this subscription.
+     *
+     * @param fragments     to fill in for each message fragment read.
+     * @param fragmentLimit number of message fragments to read, no more than the length of fragments.
+     * @return the number of fragments received.
+     */
+    inline int batchPoll(Fragment *fragments, int fragmentLimit)
+    {
+        EpochReclaimer::Guard epochGuard(m_epochParticipant);
+        auto imageArrayPair = m_imageArray.load();
+        auto imageArray = imageArrayPair.first;
+        const std::size_t length = imageArrayPair.second;
+        int fragmentsRead = 0;
+
+        std::size_t startingIndex = m_roundRobinIndex++;
+        if (startingIndex >= length)
+        {
+            m_roundRobinIndex = startingIndex = 0;
+        }
+
+        for (std::size_t i = startingIndex; i < length && fragmentsRead < fragmentLimit; i++)
+        {
+            fragmentsRead += imageArray[i]->batchPoll(fragments + fragmentsRead, fragmentLimit - fragmentsRead);
+        }
+
+        for (std::size_t i = 0; i < startingIndex && fragmentsRead < fragmentLimit; i++)
+        {
+            fragmentsRead += imageArray[i]->batchPoll(fragments + fragmentsRead, fragmentLimit - fragmentsRead);
+        }
+
+        return fragmentsRead;
+    }
+
     /**
      * Poll in a controlled manner the Image s under the subscription for available message fragments.
      * Control is applied to fragments in the stream. If more fragments can be read on another stream
@@ -236,6 +426,7 @@ public:
     template<typename F>
     inline int controlledPoll(F &&fragmentHandler, int fragmentLimit)
     {
+        EpochReclaimer::Guard epochGuard(m_epochParticipant);
         auto imageArrayPair = m_imageArray.load();
         auto imageArray = imageArrayPair.first;
         const std::size_t length = imageArrayPair.second;
@@ -270,6 +461,7 @@ public:
     template<typename F>
     inline long blockPoll(F &&blockHandler, int blockLengthLimit)
     {
+        EpochReclaimer::Guard epochGuard(m_epochParticipant);
         auto imageArrayPair = m_imageArray.load();
         auto imageArray = imageArrayPair.first;
         const std::size_t length = imageArrayPair.second;
@@ -283,6 +475,31 @@ public:
         return bytesConsumed;
     }
 
+    /**
+     * Poll the Image s under the subscription for blocks of whole messages which the handler can consume in part.
+     *
+     * @param blockHandler     to receive a block of messages from each Image.
+     * @param blockLengthLimit for each individual block.
+     * @return the number of bytes consumed.
+     * @see Image::controlledBlockPoll
+     */
+    template<typename F>
+    inline long controlledBlockPoll(F &&blockHandler, int blockLengthLimit)
+    {
+        EpochReclaimer::Guard epochGuard(m_epochParticipant);
+        auto imageArrayPair = m_imageArray.load();
+        auto imageArray = imageArrayPair.first;
+        const std::size_t length = imageArrayPair.second;
+        long bytesConsumed = 0;
+
+        for (std::size_t i = 0; i < length; i++)
+        {
+            bytesConsumed += imageArray[i]->controlledBlockPoll(blockHandler, blockLengthLimit);
+        }
+
+        return bytesConsumed;
+    }
+
     /**
      * Is the subscription connected by having at least one open image available.
      *
@@ -326,21 +543,10 @@ public:
      */
     inline std::shared_ptr<Image> imageBySessionId(std::int32_t sessionId) const
     {
-        auto imageArrayPair = m_imageArray.load();
-        auto imageArray = imageArrayPair.first;
-        const std::size_t length = imageArrayPair.second;
-        int index = -1;
-
-        for (std::size_t i = 0; i < length; i++)
-        {
-            if (imageArray[i]->sessionId() == sessionId)
-            {
-                index = static_cast<int>(i);
-                break;
-            }
-        }
+        std::shared_ptr<const image_by_session_id_t> imageBySessionId = std::atomic_load(&m_imageBySessionId);
+        auto it = imageBySessionId->find(sessionId);
 
-        return index != -1 ? imageArray[index] : std::shared_ptr<Image>();
+        return it != imageBySessionId->end() ? it->second : std::shared_ptr<Image>();
     }
 
     /**
@@ -357,6 +563,69 @@ public:
         return m_imageArray.load().first[index];
     }
 
+    /**
+     * Return a non-owning {@link ImageView} of the {@link Image} at the given index without touching its reference
+     * count.
+     *
+     * @param index in the array.
+     * @return view of the image at given index or an empty view if out of range.
+     * @see ImageView for how long the view remains valid.
+     */
+    inline ImageView imageViewByIndex(size_t index) const
+    {
+        const std::int64_t changeNumber = m_imageArray.changeNumber();
+        auto imageArrayPair = m_imageArray.load();
+
+        return index < imageArrayPair.second ?
+            ImageView(imageArrayPair.first[index].get(), changeNumber) : ImageView();
+    }
+
+    /**
+     * Return a non-owning {@link ImageView} of the {@link Image} associated with the given sessionId without touching
+     * its reference count.
+     *
+     * @param sessionId associated with the Image.
+     * @return view of the Image associated with the given sessionId or an empty view if no Image exists.
+     * @see ImageView for how long the view remains valid.
+     */
+    inline ImageView imageViewBySessionId(std::int32_t sessionId) const
+    {
+        const std::int64_t changeNumber = m_imageArray.changeNumber();
+        auto imageArrayPair = m_imageArray.load();
+
+        for (std::size_t i = 0, length = imageArrayPair.second; i < length; i++)
+        {
+            Image *image = imageArrayPair.first[i].get();
+            if (image->sessionId() == sessionId)
+            {
+                return { image, changeNumber };
+            }
+        }
+
+        return {};
+    }
+
+    /**
+     * Change number of the image list which is incremented each time an {@link Image} is added or removed.
+     *
+     * @return change number of the image list.
+     */
+    inline std::int64_t imageListChangeNumber() const
+    {
+        return m_imageArray.changeNumber();
+    }
+
+    /**
+     * Has the image list remained unchanged since the given {@link ImageView} was taken.
+     *
+     * @param imageView to check.
+     * @return true if the image list has not changed since the view was taken.
+     */
+    inline bool isCurrent(const ImageView &imageView) const
+    {
+        return imageView.changeNumber() == m_imageArray.changeNumber();
+    }
+
     /**
      * Get the image at the given index from the images array.
      *
@@ -395,6 +664,19 @@ public:
         return result;
     }
 
+    /**
+     * Get a view of the current array of {@link Image}s that match this subscription without allocating or copying.
+     *
+     * @return view of the current array of {@link Image}s.
+     * @see ImageArrayView for how long the view remains valid.
+     */
+    inline ImageArrayView imageArrayView() const
+    {
+        auto imageArrayPair = m_imageArray.load();
+
+        return { imageArrayPair.first, imageArrayPair.second };
+    }
+
     /**
      * Get a std::vector of active std::shared_ptr of {@link Image}s that match this subscription.
      *
@@ -450,6 +732,11 @@ public:
     }
 
     /// @cond HIDDEN_SYMBOLS
+    inline EpochReclaimer::Participant &epochParticipant()
+    {
+        return m_epochParticipant;
+    }
+
     bool hasImage(std::int64_t correlationId) const
     {
         auto imageArrayPair = m_imageArray.load();
@@ -471,7 +758,10 @@ public:
 
     Image::array_t addImage(std::shared_ptr<Image> image)
     {
-        return m_imageArray.addElement(std::move(image)).first;
+        Image::array_t oldArray = m_imageArray.addElement(std::move(image)).first;
+        updateImageBySessionId();
+
+        return oldArray;
     }
 
     std::pair<Image::array_t, std::size_t> removeImage(std::int64_t correlationId)
@@ -488,6 +778,11 @@ public:
                 return false;
             });
 
+        if (nullptr != result.first)
+        {
+            updateImageBySessionId();
+        }
+
         return result;
     }
 
@@ -497,6 +792,7 @@ public:
         {
             std::pair<Image::array_t, std::size_t> imageArrayPair = m_imageArray.load();
             m_imageArray.store(new std::shared_ptr<Image>[0], 0);
+            std::atomic_store(&m_imageBySessionId, std::make_shared<const image_by_session_id_t>());
 
             return imageArrayPair;
         }
@@ -508,6 +804,8 @@ public:
     /// @endcond
 
 private:
+    typedef std::unordered_map<std::int32_t, std::shared_ptr<Image>> image_by_session_id_t;
+
     ClientConductor &m_conductor;
     const std::string m_channel;
     std::int32_t m_channelStatusId;
@@ -516,8 +814,23 @@ private:
     char m_paddingBefore[util::BitUtil::CACHE_LINE_LENGTH]{};
     std::size_t m_roundRobinIndex = 0;
     AtomicArrayUpdater<std::shared_ptr<Image>> m_imageArray;
+    std::shared_ptr<const image_by_session_id_t> m_imageBySessionId;
     std::atomic<bool> m_isClosed;
     char m_paddingAfter[util::BitUtil::CACHE_LINE_LENGTH]{};
+    EpochReclaimer::Participant m_epochParticipant;
+
+    void updateImageBySessionId()
+    {
+        auto imageArrayPair = m_imageArray.load();
+        std::shared_ptr<image_by_session_id_t> imageBySessionId = std::make_shared<image_by_session_id_t>();
+
+        for (std::size_t i = 0; i < imageArrayPair.second; i++)
+        {
+            imageBySessionId->emplace(imageArrayPair.first[i]->sessionId(), imageArrayPair.first[i]);
+        }
+
+        std::atomic_store(&m_imageBySessionId, std::shared_ptr<const image_by_session_id_t>(imageBySessionId));
+    }
 };
 
 }
@@ -0,0 +1,156 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef AERON_SUBSCRIPTION_GROUP_H
+#define AERON_SUBSCRIPTION_GROUP_H
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "Subscription.h"
+
+namespace aeron
+{
+
+/**
+ * Polls a set of {@link Subscription}s from a single fragment budget, for threads which service many subscriptions
+ * and would otherwise loop over them calling {@link Subscription#poll} on each.
+ * <p>
+ * Each subscription has a weight for its share of the fragment limit on a poll. With equal weights the poll is fair
+ * across the group and a subscription with a weight of 0 only gets what is left over by the others.
+ * <p>
+ * This class is not threadsafe. Closed subscriptions are skipped but stay in the group until removed.
+ */
+class SubscriptionGroup
+{
+public:
+    SubscriptionGroup() = default;
+
+    /**
+     * Add a subscription to the group.
+     *
+     * @param subscription to add.
+     * @param weight       of the subscription relative to the others in the group.
+     * @return true if added or false if the subscription is already in the group.
+     */
+    bool add(std::shared_ptr<Subscription> subscription, std::int64_t weight = 1)
+    {
+        for (auto &entry : m_entries)
+        {
+            if (entry.subscription == subscription)
+            {
+                return false;
+            }
+        }
+
+        m_totalWeight += weight;
+        m_entries.push_back({ std::move(subscription), weight });
+
+        return true;
+    }
+
+    /**
+     * Remove a subscription from the group.
+     *
+     * @param subscription to remove.
+     * @return true if removed or false if the subscription was not in the group.
+     */
+    bool remove(const std::shared_ptr<Subscription> &subscription)
+    {
+        for (auto it = m_entries.begin(); it != m_entries.end(); ++it)
+        {
+            if (it->subscription == subscription)
+            {
+                m_totalWeight -= it->weight;
+                m_entries.erase(it);
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    inline std::size_t size() const
+    {
+        return m_entries.size();
+    }
+
+    /**
+     * Poll the subscriptions in the group for available message fragments, sharing the fragment limit between them
+     * in proportion to their weights.
+     * <p>
+     * Each subscription with a non-zero weight is polled for up to its share of the fragment limit, with a minimum of
+     * one fragment. Any limit left over is then given round-robin to all subscriptions.
+     *
+     * @param fragmentHandler callback for handling each message fragment as it is read.
+     * @param fragmentLimit   number of message fragments to limit for the poll across all the subscriptions.
+     * @return the number of fragments received.
+     */
+    template<typename F>
+    inline int poll(F &&fragmentHandler, int fragmentLimit)
+    {
+        const std::size_t length = m_entries.size();
+        int fragmentsRead = 0;
+
+        std::size_t startingIndex = m_roundRobinIndex++;
+        if (startingIndex >= length)
+        {
+            m_roundRobinIndex = startingIndex = 0;
+        }
+
+        for (std::size_t j = 0; j < length && fragmentsRead < fragmentLimit && m_totalWeight > 0; j++)
+        {
+            Entry &entry = m_entries[(startingIndex + j) % length];
+
+            if (entry.weight > 0 && !entry.subscription->isClosed())
+            {
+                const int share = std::max(1, static_cast<int>((fragmentLimit * entry.weight) / m_totalWeight));
+                fragmentsRead += entry.subscription->poll(
+                    fragmentHandler, std::min(share, fragmentLimit - fragmentsRead));
+            }
+        }
+
+        for (std::size_t j = 0; j < length && fragmentsRead < fragmentLimit; j++)
+        {
+            Entry &entry = m_entries[(startingIndex + j) % length];
+
+            if (!entry.subscription->isClosed())
+            {
+                fragmentsRead += entry.subscription->poll(fragmentHandler, fragmentLimit - fragmentsRead);
+            }
+        }
+
+        return fragmentsRead;
+    }
+
+private:
+    struct Entry
+    {
+        std::shared_ptr<Subscription> subscription;
+        std::int64_t weight;
+    };
+
+    std::vector<Entry> m_entries;
+    std::int64_t m_totalWeight = 0;
+    std::size_t m_roundRobinIndex = 0;
+};
+
+}
+
+#endif //AERON_SUBSCRIPTION_GROUP_H
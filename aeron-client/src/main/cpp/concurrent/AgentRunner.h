@@ -27,6 +27,9 @@
 
 #if !defined(AERON_COMPILER_MSVC)
 #include <pthread.h>
+#include <sched.h>
+#include <cstring>
+#include <cstdlib>
 #endif
 
 namespace aeron {
@@ -103,10 +106,23 @@ public:
         return m_isClosed;
     }
 
+    /**
+     * Set the cpus, e.g. "1,3-5", and the SCHED_FIFO priority for the thread running the agent. Must be called before
+     * start. Affinity is only supported on Linux.
+     *
+     * @param cpuAffinity  list of cpus to pin the thread to or empty to leave it unpinned.
+     * @param fifoPriority SCHED_FIFO priority for the thread or 0 to keep the default scheduling policy.
+     */
+    inline void threadConfig(const std::string &cpuAffinity, int fifoPriority)
+    {
+        m_cpuAffinity = cpuAffinity;
+        m_fifoPriority = fifoPriority;
+    }
+
     /**
      * Start the Agent running. Start may be called only once and is invalid after close has been called.
      *
-     * Will spawn a std::thread.
+     * Will spawn a std::thread and throw if the cpu affinity or scheduling policy cannot be applied to it.
      */
     inline void start()
     {
@@ -132,6 +148,16 @@ public:
 #endif
                 run();
             });
+
+        try
+        {
+            applyThreadConfig();
+        }
+        catch (...)
+        {
+            close();
+            throw;
+        }
     }
 
     /**
@@ -199,6 +225,80 @@ public:
     }
 
 private:
+    inline void applyThreadConfig()
+    {
+        if (!m_cpuAffinity.empty())
+        {
+#if defined(__linux__)
+            cpu_set_t cpuSet;
+            CPU_ZERO(&cpuSet);
+
+            const char *cursor = m_cpuAffinity.c_str();
+            bool isValid = true;
+            while (isValid)
+            {
+                char *end = nullptr;
+                long first = std::strtol(cursor, &end, 10);
+                long last = first;
+                isValid = end != cursor;
+
+                if (isValid && '-' == *end)
+                {
+                    cursor = end + 1;
+                    last = std::strtol(cursor, &end, 10);
+                    isValid = end != cursor;
+                }
+
+                isValid = isValid && first >= 0 && last >= first && last < CPU_SETSIZE;
+                for (long cpu = first; isValid && cpu <= last; cpu++)
+                {
+                    CPU_SET(static_cast<int>(cpu), &cpuSet);
+                }
+
+                if (!isValid || '\0' == *end)
+                {
+                    break;
+                }
+
+                isValid = ',' == *end;
+                cursor = end + 1;
+            }
+
+            if (!isValid)
+            {
+                throw util::IllegalArgumentException("invalid cpu affinity: " + m_cpuAffinity, SOURCEINFO);
+            }
+
+            int result = pthread_setaffinity_np(m_thread.native_handle(), sizeof(cpuSet), &cpuSet);
+            if (0 != result)
+            {
+                throw util::IllegalStateException(
+                    "could not set cpu affinity " + m_cpuAffinity + ": " + std::strerror(result), SOURCEINFO);
+            }
+#else
+            throw util::IllegalStateException("cpu affinity not supported on this platform", SOURCEINFO);
+#endif
+        }
+
+        if (0 != m_fifoPriority)
+        {
+#if !defined(AERON_COMPILER_MSVC)
+            sched_param param = {};
+            param.sched_priority = m_fifoPriority;
+
+            int result = pthread_setschedparam(m_thread.native_handle(), SCHED_FIFO, &param);
+            if (0 != result)
+            {
+                throw util::IllegalStateException(
+                    "could not set SCHED_FIFO priority " + std::to_string(m_fifoPriority) + ": " +
+                    std::strerror(result), SOURCEINFO);
+            }
+#else
+            throw util::IllegalStateException("SCHED_FIFO not supported on this platform", SOURCEINFO);
+#endif
+        }
+    }
+
     Agent &m_agent;
     IdleStrategy &m_idleStrategy;
     util::exception_handler_t &m_exceptionHandler;
@@ -207,6 +307,8 @@ private:
     std::atomic<bool> m_isClosed;
     std::thread m_thread;
     const std::string m_name;
+    std::string m_cpuAffinity;
+    int m_fifoPriority = 0;
 };
 
 }}
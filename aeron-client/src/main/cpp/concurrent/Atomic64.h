@@ -21,6 +21,8 @@
 #if defined(AERON_COMPILER_GCC)
     #if defined(AERON_CPU_X64)
         #include "concurrent/atomic/Atomic64_gcc_x86_64.h"
+    #elif defined(AERON_CPU_ARM64)
+        #include "concurrent/atomic/Atomic64_gcc_aarch64.h"
     #else
         #include "concurrent/atomic/Atomic64_gcc_cpp11.h"
     #endif
@@ -93,6 +93,11 @@ public:
         while (true);
     }
 
+    inline std::int64_t changeNumber() const
+    {
+        return m_endChange.load(std::memory_order_acquire);
+    }
+
     inline void store(E *array, std::size_t length)
     {
         std::int64_t changeNumber = m_beginChange + 1;
@@ -0,0 +1,284 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef AERON_COUNTERS_INDEX_H
+#define AERON_COUNTERS_INDEX_H
+
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include "CountersReader.h"
+
+namespace aeron { namespace concurrent {
+
+/**
+ * Client side index over the counters in a {@link CountersReader} by type id and by registration id, so that lookups
+ * do not scan the metadata of every counter.
+ * <p>
+ * Hits are validated against the counters buffers before being returned so a counter which has since been freed or
+ * reused is never returned. A miss refreshes the index, which reads only the state, type id and registration id of
+ * each allocated counter and updates the entries that have changed, then retries.
+ * <p>
+ * This class is not threadsafe.
+ */
+class CountersIndex
+{
+public:
+    explicit CountersIndex(const CountersReader &countersReader) : m_countersReader(countersReader)
+    {
+    }
+
+    /**
+     * Bring the index up to date with the counters buffers.
+     */
+    void refresh()
+    {
+        const std::int32_t maxCounterId = m_countersReader.maxCounterId();
+        std::int32_t id = 0;
+
+        for (; id < maxCounterId; id++)
+        {
+            const std::int32_t state = m_countersReader.getCounterState(id);
+            if (CountersReader::RECORD_UNUSED == state)
+            {
+                break;
+            }
+
+            Entry entry;
+            if (CountersReader::RECORD_ALLOCATED == state)
+            {
+                entry.typeId = m_countersReader.getCounterTypeId(id);
+                entry.registrationId = m_countersReader.getCounterRegistrationId(id);
+            }
+
+            if (id >= static_cast<std::int32_t>(m_entries.size()))
+            {
+                m_entries.emplace_back();
+            }
+
+            Entry &current = m_entries[static_cast<std::size_t>(id)];
+            if (current.typeId != entry.typeId || current.registrationId != entry.registrationId)
+            {
+                removeEntry(id, current);
+                current = entry;
+                addEntry(id, current);
+            }
+        }
+
+        for (std::size_t i = static_cast<std::size_t>(id); i < m_entries.size(); i++)
+        {
+            removeEntry(static_cast<std::int32_t>(i), m_entries[i]);
+        }
+
+        m_entries.resize(static_cast<std::size_t>(id));
+    }
+
+    /**
+     * Find the allocated counter with the given registration id.
+     *
+     * @param registrationId of the counter.
+     * @return the counter id if found otherwise CountersReader::NULL_COUNTER_ID.
+     */
+    std::int32_t findByRegistrationId(std::int64_t registrationId)
+    {
+        std::int32_t counterId = lookupByRegistrationId(registrationId);
+        if (CountersReader::NULL_COUNTER_ID == counterId)
+        {
+            refresh();
+            counterId = lookupByRegistrationId(registrationId);
+        }
+
+        return counterId;
+    }
+
+    /**
+     * Find the first allocated counter of a type which matches a predicate on its key.
+     *
+     * @param typeId    of the counter.
+     * @param predicate callable as bool(std::int32_t counterId, const AtomicBuffer &keyBuffer).
+     * @return the counter id if found otherwise CountersReader::NULL_COUNTER_ID.
+     */
+    template<typename P>
+    std::int32_t findByTypeId(std::int32_t typeId, P &&predicate)
+    {
+        std::int32_t counterId = lookupByTypeId(typeId, predicate);
+        if (CountersReader::NULL_COUNTER_ID == counterId)
+        {
+            refresh();
+            counterId = lookupByTypeId(typeId, predicate);
+        }
+
+        return counterId;
+    }
+
+    /**
+     * Find the first allocated counter of a type whose key starts with the given bytes.
+     *
+     * @param typeId    of the counter.
+     * @param key       bytes the key of the counter starts with.
+     * @param keyLength of the given key bytes.
+     * @return the counter id if found otherwise CountersReader::NULL_COUNTER_ID.
+     */
+    std::int32_t findByTypeIdAndKey(std::int32_t typeId, const std::uint8_t *key, std::size_t keyLength)
+    {
+        return findByTypeId(
+            typeId,
+            [&](std::int32_t, const AtomicBuffer &keyBuffer)
+            {
+                return keyLength <= static_cast<std::size_t>(keyBuffer.capacity()) &&
+                    0 == std::memcmp(keyBuffer.buffer(), key, keyLength);
+            });
+    }
+
+    /**
+     * Call a function for each allocated counter of a type as known at the last refresh, in no particular order.
+     *
+     * @param typeId of the counters.
+     * @param func   callable as void(std::int32_t counterId).
+     */
+    template<typename F>
+    void forEachByTypeId(std::int32_t typeId, F &&func) const
+    {
+        auto it = m_idsByTypeId.find(typeId);
+        if (it != m_idsByTypeId.end())
+        {
+            for (const std::int32_t counterId : it->second)
+            {
+                if (isCurrent(counterId, typeId))
+                {
+                    func(counterId);
+                }
+            }
+        }
+    }
+
+    inline const CountersReader &countersReader() const
+    {
+        return m_countersReader;
+    }
+
+private:
+    struct Entry
+    {
+        std::int32_t typeId = NULL_TYPE_ID;
+        std::int64_t registrationId = CountersReader::DEFAULT_REGISTRATION_ID;
+    };
+
+    static const std::int32_t NULL_TYPE_ID = -1;
+
+    CountersReader m_countersReader;
+    std::vector<Entry> m_entries;
+    std::unordered_map<std::int32_t, std::vector<std::int32_t>> m_idsByTypeId;
+    std::unordered_map<std::int64_t, std::int32_t> m_idByRegistrationId;
+
+    inline bool isCurrent(std::int32_t counterId, std::int32_t typeId) const
+    {
+        const Entry &entry = m_entries[static_cast<std::size_t>(counterId)];
+
+        return m_countersReader.getCounterState(counterId) == CountersReader::RECORD_ALLOCATED &&
+            m_countersReader.getCounterTypeId(counterId) == typeId &&
+            m_countersReader.getCounterRegistrationId(counterId) == entry.registrationId;
+    }
+
+    std::int32_t lookupByRegistrationId(std::int64_t registrationId) const
+    {
+        auto it = m_idByRegistrationId.find(registrationId);
+        if (it != m_idByRegistrationId.end())
+        {
+            const std::int32_t counterId = it->second;
+            if (isCurrent(counterId, m_entries[static_cast<std::size_t>(counterId)].typeId))
+            {
+                return counterId;
+            }
+        }
+
+        return CountersReader::NULL_COUNTER_ID;
+    }
+
+    template<typename P>
+    std::int32_t lookupByTypeId(std::int32_t typeId, P &predicate) const
+    {
+        auto it = m_idsByTypeId.find(typeId);
+        if (it != m_idsByTypeId.end())
+        {
+            AtomicBuffer metadataBuffer = m_countersReader.metaDataBuffer();
+
+            for (const std::int32_t counterId : it->second)
+            {
+                const AtomicBuffer keyBuffer(
+                    metadataBuffer.buffer() + CountersReader::metadataOffset(counterId) + CountersReader::KEY_OFFSET,
+                    CountersReader::MAX_KEY_LENGTH);
+
+                if (isCurrent(counterId, typeId) && predicate(counterId, keyBuffer))
+                {
+                    return counterId;
+                }
+            }
+        }
+
+        return CountersReader::NULL_COUNTER_ID;
+    }
+
+    void addEntry(std::int32_t counterId, const Entry &entry)
+    {
+        if (NULL_TYPE_ID == entry.typeId)
+        {
+            return;
+        }
+
+        m_idsByTypeId[entry.typeId].push_back(counterId);
+
+        if (CountersReader::DEFAULT_REGISTRATION_ID != entry.registrationId)
+        {
+            m_idByRegistrationId[entry.registrationId] = counterId;
+        }
+    }
+
+    void removeEntry(std::int32_t counterId, const Entry &entry)
+    {
+        if (NULL_TYPE_ID == entry.typeId)
+        {
+            return;
+        }
+
+        auto it = m_idsByTypeId.find(entry.typeId);
+        if (it != m_idsByTypeId.end())
+        {
+            std::vector<std::int32_t> &ids = it->second;
+            for (std::size_t i = 0; i < ids.size(); i++)
+            {
+                if (ids[i] == counterId)
+                {
+                    ids[i] = ids.back();
+                    ids.pop_back();
+                    break;
+                }
+            }
+        }
+
+        auto regIt = m_idByRegistrationId.find(entry.registrationId);
+        if (regIt != m_idByRegistrationId.end() && regIt->second == counterId)
+        {
+            m_idByRegistrationId.erase(regIt);
+        }
+    }
+};
+
+}}
+
+#endif //AERON_COUNTERS_INDEX_H
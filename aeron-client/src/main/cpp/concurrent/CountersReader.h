@@ -73,6 +73,24 @@ namespace aeron { namespace concurrent {
  * ...                                                              |
  *  +---------------------------------------------------------------+
  * </pre>
+ *
+ * <b>Compact Region</b>
+ * <p>
+ * Read-mostly counters with a single writer may be held in an optional compact region with 8 byte values and 64 byte
+ * metadata records whose labels are in a shared label table. Compact counter ids follow on from those of the values
+ * buffer and the accessors below resolve either.
+ * <pre>
+ *  +---------------------------------------------------------------+
+ *  |  Header: first counter id, capacity, label table length      ...
+ *  +---------------------------------------------------------------+
+ *  |           Counter values, 8 bytes each, to capacity          ...
+ *  +---------------------------------------------------------------+
+ *  |  Records: state, type id, registration id, free-for-reuse    ...
+ *  |  deadline, label offset, capacity and length, 28 byte key    ...
+ *  +---------------------------------------------------------------+
+ *  |                         Label table                          ...
+ *  +---------------------------------------------------------------+
+ * </pre>
  */
 
 typedef std::function<void(std::int32_t, std::int32_t, const AtomicBuffer&, const std::string&)> on_counters_metadata_t;
@@ -87,6 +105,30 @@ public:
     {
     }
 
+    inline CountersReader(
+        const AtomicBuffer &metadataBuffer, const AtomicBuffer &valuesBuffer, const AtomicBuffer &compactBuffer) :
+        CountersReader(metadataBuffer, valuesBuffer)
+    {
+        if (compactBuffer.capacity() >= COMPACT_HEADER_LENGTH)
+        {
+            const auto &header = compactBuffer.overlayStruct<CompactHeaderDefn>(0);
+
+            if (header.capacity > 0)
+            {
+                const util::index_t valuesLength = util::BitUtil::align<util::index_t>(
+                    header.capacity * COMPACT_COUNTER_LENGTH, 2 * util::BitUtil::CACHE_LINE_LENGTH);
+                const util::index_t metadataLength = header.capacity * COMPACT_METADATA_LENGTH;
+
+                m_compactValuesBuffer.wrap(compactBuffer.buffer() + COMPACT_HEADER_LENGTH, valuesLength);
+                m_compactMetadataBuffer.wrap(m_compactValuesBuffer.buffer() + valuesLength, metadataLength);
+                m_compactLabelsBuffer.wrap(
+                    m_compactMetadataBuffer.buffer() + metadataLength, static_cast<std::size_t>(header.labelsLength));
+                m_compactFirstCounterId = header.firstCounterId;
+                m_compactCapacity = header.capacity;
+            }
+        }
+    }
+
     template <typename F>
     void forEach(F &&onCountersMetadata) const
     {
@@ -111,6 +153,26 @@ public:
 
             id++;
         }
+
+        for (std::int32_t i = 0; i < m_compactCapacity; i++)
+        {
+            const util::index_t offset = i * COMPACT_METADATA_LENGTH;
+            std::int32_t recordStatus = m_compactMetadataBuffer.getInt32Volatile(offset);
+
+            if (RECORD_UNUSED == recordStatus)
+            {
+                break;
+            }
+            else if (RECORD_ALLOCATED == recordStatus)
+            {
+                const auto &record = m_compactMetadataBuffer.overlayStruct<CompactCounterMetaDataDefn>(offset);
+                const AtomicBuffer keyBuffer(
+                    m_compactMetadataBuffer.buffer() + offset + COMPACT_KEY_OFFSET,
+                    sizeof(CompactCounterMetaDataDefn::key));
+
+                onCountersMetadata(m_compactFirstCounterId + i, record.typeId, keyBuffer, compactLabel(offset));
+            }
+        }
     }
 
     inline std::int32_t maxCounterId() const
@@ -122,13 +184,55 @@ public:
     {
         validateCounterId(id);
 
+        if (isCompactCounter(id))
+        {
+            return m_compactValuesBuffer.getInt64Volatile(compactCounterOffset(id));
+        }
+
         return m_valuesBuffer.getInt64Volatile(counterOffset(id));
     }
 
+    /**
+     * Get the value of a counter plus that of each STRIPE_TYPE_ID counter which names it as its aggregate. This walks
+     * the metadata so is intended for monitoring rather than the data path.
+     *
+     * @param id of the counter.
+     * @return the aggregated value.
+     */
+    inline std::int64_t getCounterAggregatedValue(std::int32_t id) const
+    {
+        std::int64_t value = getCounterValue(id);
+
+        for (util::index_t i = 0, capacity = m_metadataBuffer.capacity(), counterId = 0;
+            i < capacity;
+            i += METADATA_LENGTH, counterId++)
+        {
+            std::int32_t recordStatus = m_metadataBuffer.getInt32Volatile(i);
+
+            if (RECORD_UNUSED == recordStatus)
+            {
+                break;
+            }
+            else if (RECORD_ALLOCATED == recordStatus &&
+                STRIPE_TYPE_ID == m_metadataBuffer.getInt32(i + TYPE_ID_OFFSET) &&
+                id == m_metadataBuffer.getInt32(i + KEY_OFFSET))
+            {
+                value += m_valuesBuffer.getInt64Volatile(counterOffset(counterId));
+            }
+        }
+
+        return value;
+    }
+
     inline std::int64_t getCounterRegistrationId(std::int32_t id) const
     {
         validateCounterId(id);
 
+        if (isCompactCounter(id))
+        {
+            return m_compactMetadataBuffer.getInt64Volatile(compactMetadataOffset(id) + COMPACT_REGISTRATION_ID_OFFSET);
+        }
+
         return m_valuesBuffer.getInt64Volatile(counterOffset(id) + REGISTRATION_ID_OFFSET);
     }
 
@@ -136,6 +240,11 @@ public:
     {
         validateCounterId(id);
 
+        if (isCompactCounter(id))
+        {
+            return m_compactMetadataBuffer.getInt32Volatile(compactMetadataOffset(id));
+        }
+
         return m_metadataBuffer.getInt32Volatile(metadataOffset(id));
     }
 
@@ -143,6 +252,11 @@ public:
     {
         validateCounterId(id);
 
+        if (isCompactCounter(id))
+        {
+            return m_compactMetadataBuffer.getInt32Volatile(compactMetadataOffset(id) + COMPACT_TYPE_ID_OFFSET);
+        }
+
         return m_metadataBuffer.getInt32Volatile(metadataOffset(id) + TYPE_ID_OFFSET);
     }
 
@@ -150,6 +264,12 @@ public:
     {
         validateCounterId(id);
 
+        if (isCompactCounter(id))
+        {
+            return m_compactMetadataBuffer.getInt64Volatile(
+                compactMetadataOffset(id) + COMPACT_FREE_FOR_REUSE_DEADLINE_OFFSET);
+        }
+
         return m_metadataBuffer.getInt64Volatile(metadataOffset(id) + FREE_FOR_REUSE_DEADLINE_OFFSET);
     }
 
@@ -157,6 +277,11 @@ public:
     {
         validateCounterId(id);
 
+        if (isCompactCounter(id))
+        {
+            return compactLabel(compactMetadataOffset(id));
+        }
+
         return m_metadataBuffer.getString(metadataOffset(id) + LABEL_LENGTH_OFFSET);
     }
 
@@ -180,6 +305,22 @@ public:
         return m_metadataBuffer;
     }
 
+    /**
+     * Is the counter id one in the compact region.
+     *
+     * @param id of the counter.
+     * @return true if the counter is held in the compact region.
+     */
+    inline bool isCompactCounter(std::int32_t id) const
+    {
+        return id >= m_compactFirstCounterId && id - m_compactFirstCounterId < m_compactCapacity;
+    }
+
+    inline std::int32_t compactCapacity() const
+    {
+        return m_compactCapacity;
+    }
+
 #pragma pack(push)
 #pragma pack(4)
     struct CounterValueDefn
@@ -198,10 +339,32 @@ public:
         std::int32_t labelLength;
         std::int8_t label[(6 * util::BitUtil::CACHE_LINE_LENGTH) - sizeof(std::int32_t)];
     };
+
+    struct CompactHeaderDefn
+    {
+        std::int32_t firstCounterId;
+        std::int32_t capacity;
+        std::int32_t labelsLength;
+    };
+
+    struct CompactCounterMetaDataDefn
+    {
+        std::int32_t state;
+        std::int32_t typeId;
+        std::int64_t registrationId;
+        std::int64_t freeToReuseDeadline;
+        std::int32_t labelOffset;
+        std::int32_t labelCapacity;
+        std::int32_t labelLength;
+        std::int8_t key[util::BitUtil::CACHE_LINE_LENGTH - (5 * sizeof(std::int32_t)) - (2 * sizeof(std::int64_t))];
+    };
 #pragma pack(pop)
 
     static const std::int32_t NULL_COUNTER_ID = -1;
 
+    /// Type id of a per writer slot of a counter written by several agents, keyed by the id of that counter.
+    static const std::int32_t STRIPE_TYPE_ID = 24;
+
     static const std::int32_t RECORD_UNUSED = 0;
     static const std::int32_t RECORD_ALLOCATED = 1;
     static const std::int32_t RECORD_RECLAIMED = -1;
@@ -221,14 +384,49 @@ public:
     static const std::int32_t MAX_LABEL_LENGTH = sizeof(CounterMetaDataDefn::label);
     static const std::int32_t MAX_KEY_LENGTH = sizeof(CounterMetaDataDefn::key);
 
+    static const util::index_t COMPACT_HEADER_LENGTH = 2 * util::BitUtil::CACHE_LINE_LENGTH;
+    static const util::index_t COMPACT_COUNTER_LENGTH = sizeof(std::int64_t);
+    static const util::index_t COMPACT_METADATA_LENGTH = sizeof(CompactCounterMetaDataDefn);
+    static const util::index_t COMPACT_TYPE_ID_OFFSET = offsetof(CompactCounterMetaDataDefn, typeId);
+    static const util::index_t COMPACT_REGISTRATION_ID_OFFSET = offsetof(CompactCounterMetaDataDefn, registrationId);
+    static const util::index_t COMPACT_FREE_FOR_REUSE_DEADLINE_OFFSET =
+        offsetof(CompactCounterMetaDataDefn, freeToReuseDeadline);
+    static const util::index_t COMPACT_LABEL_OFFSET_OFFSET = offsetof(CompactCounterMetaDataDefn, labelOffset);
+    static const util::index_t COMPACT_LABEL_LENGTH_OFFSET = offsetof(CompactCounterMetaDataDefn, labelLength);
+    static const util::index_t COMPACT_KEY_OFFSET = offsetof(CompactCounterMetaDataDefn, key);
+
 protected:
     AtomicBuffer m_metadataBuffer;
     AtomicBuffer m_valuesBuffer;
     const std::int32_t m_maxCounterId;
+    AtomicBuffer m_compactValuesBuffer;
+    AtomicBuffer m_compactMetadataBuffer;
+    AtomicBuffer m_compactLabelsBuffer;
+    std::int32_t m_compactFirstCounterId = INT32_MAX;
+    std::int32_t m_compactCapacity = 0;
+
+    inline util::index_t compactCounterOffset(std::int32_t counterId) const
+    {
+        return (counterId - m_compactFirstCounterId) * COMPACT_COUNTER_LENGTH;
+    }
+
+    inline util::index_t compactMetadataOffset(std::int32_t counterId) const
+    {
+        return (counterId - m_compactFirstCounterId) * COMPACT_METADATA_LENGTH;
+    }
+
+    inline std::string compactLabel(util::index_t metadataOffset) const
+    {
+        const std::int32_t labelLength =
+            m_compactMetadataBuffer.getInt32Volatile(metadataOffset + COMPACT_LABEL_LENGTH_OFFSET);
+        const std::int32_t labelOffset = m_compactMetadataBuffer.getInt32(metadataOffset + COMPACT_LABEL_OFFSET_OFFSET);
+
+        return m_compactLabelsBuffer.getStringWithoutLength(labelOffset, static_cast<std::size_t>(labelLength));
+    }
 
     void validateCounterId(std::int32_t counterId) const
     {
-        if (counterId < 0 || counterId > m_maxCounterId)
+        if ((counterId < 0 || counterId > m_maxCounterId) && !isCompactCounter(counterId))
         {
             throw util::IllegalArgumentException(
                 "counter id " + std::to_string(counterId) +
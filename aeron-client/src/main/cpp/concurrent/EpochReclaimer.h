@@ -0,0 +1,255 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_EPOCH_RECLAIMER_H
+#define AERON_EPOCH_RECLAIMER_H
+
+#include <cstdint>
+#include <atomic>
+#include <vector>
+#include <algorithm>
+
+#include "util/BitUtil.h"
+
+namespace aeron { namespace concurrent {
+
+/**
+ * Epoch based reclamation of items unlinked from structures read concurrently, as used by the C client for image
+ * lists. Readers bracket each use of a structure by entering and exiting their Participant. The owning thread
+ * retires items after unlinking them, and they are reclaimed in batches once every Participant has exited or entered
+ * at a later epoch, so a reader that is idle holds nothing back.
+ * <p>
+ * All methods other than Participant::enter and Participant::exit must be called by the owning thread, or under its
+ * lock.
+ */
+class EpochReclaimer
+{
+public:
+    typedef void (*reclaim_t)(void *item);
+
+    static constexpr std::int64_t QUIESCENT = INT64_MAX;
+    static constexpr std::size_t BATCH_SIZE = 32;
+
+    /**
+     * Epoch a reading thread entered its critical section at, on its own cache line as the reclaimer scans it.
+     * A Participant is only ever entered by one thread at a time. Entering it again from within its critical section,
+     * such as from a handler, nests and only the outermost exit leaves it.
+     */
+    class Participant
+    {
+    public:
+        Participant()
+        {
+            static_cast<void>(m_paddingBefore);
+            static_cast<void>(m_paddingAfter);
+        }
+
+        Participant(const Participant &) = delete;
+        Participant &operator=(const Participant &) = delete;
+
+        inline void enter()
+        {
+            if (0 != m_depth++)
+            {
+                return;
+            }
+
+            const EpochReclaimer *reclaimer = m_reclaimer.load(std::memory_order_acquire);
+
+            if (nullptr != reclaimer)
+            {
+                m_epoch.store(reclaimer->m_globalEpoch.load(std::memory_order_acquire), std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+        }
+
+        inline void exit()
+        {
+            if (0 == --m_depth)
+            {
+                m_epoch.store(QUIESCENT, std::memory_order_release);
+            }
+        }
+
+    private:
+        friend class EpochReclaimer;
+
+        char m_paddingBefore[util::BitUtil::CACHE_LINE_LENGTH]{};
+        std::atomic<std::int64_t> m_epoch = { QUIESCENT };
+        std::atomic<EpochReclaimer *> m_reclaimer = { nullptr };
+        std::int32_t m_depth = 0;
+        char m_paddingAfter[util::BitUtil::CACHE_LINE_LENGTH]{};
+    };
+
+    /**
+     * Enters a Participant for the lifetime of the guard, so it exits even if the reader throws.
+     */
+    class Guard
+    {
+    public:
+        explicit Guard(Participant &participant) : m_participant(participant)
+        {
+            m_participant.enter();
+        }
+
+        ~Guard()
+        {
+            m_participant.exit();
+        }
+
+        Guard(const Guard &) = delete;
+        Guard &operator=(const Guard &) = delete;
+
+    private:
+        Participant &m_participant;
+    };
+
+    EpochReclaimer()
+    {
+        static_cast<void>(m_paddingBefore);
+        static_cast<void>(m_paddingAfter);
+    }
+
+    EpochReclaimer(const EpochReclaimer &) = delete;
+    EpochReclaimer &operator=(const EpochReclaimer &) = delete;
+
+    ~EpochReclaimer()
+    {
+        close();
+    }
+
+    /**
+     * Reclaim all retired items whether in use or not, for when no reader can run again.
+     */
+    void close()
+    {
+        for (auto &retired : m_retired)
+        {
+            retired.m_reclaim(retired.m_item);
+        }
+
+        for (auto participant : m_participants)
+        {
+            participant->m_reclaimer.store(nullptr, std::memory_order_release);
+        }
+
+        m_retired.clear();
+        m_participants.clear();
+    }
+
+    void addParticipant(Participant &participant)
+    {
+        participant.m_epoch.store(QUIESCENT, std::memory_order_relaxed);
+        m_participants.push_back(&participant);
+        participant.m_reclaimer.store(this, std::memory_order_release);
+    }
+
+    void removeParticipant(Participant &participant)
+    {
+        auto it = std::find(m_participants.begin(), m_participants.end(), &participant);
+        if (it != m_participants.end())
+        {
+            *it = m_participants.back();
+            m_participants.pop_back();
+            participant.m_reclaimer.store(nullptr, std::memory_order_release);
+        }
+    }
+
+    /**
+     * Retire an item that has been unlinked so readers can no longer find it. The reclaim function is called with it
+     * once no reader can still hold it, which may be at once. A batch of retired items is reclaimed when it fills.
+     *
+     * @param item        unlinked from the structure being read.
+     * @param reclaimFunc to free the item.
+     */
+    void retire(void *item, reclaim_t reclaimFunc)
+    {
+        const std::int64_t epoch = m_globalEpoch.load(std::memory_order_relaxed);
+
+        m_retired.push_back({ item, reclaimFunc, epoch });
+        m_globalEpoch.store(epoch + 1, std::memory_order_release);
+
+        if (m_retired.size() >= BATCH_SIZE)
+        {
+            reclaim();
+        }
+    }
+
+    /**
+     * Reclaim the retired items no reader can still hold.
+     *
+     * @return the number of items reclaimed.
+     */
+    int reclaim()
+    {
+        if (m_retired.empty())
+        {
+            return 0;
+        }
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        std::int64_t minEpoch = QUIESCENT;
+        for (auto participant : m_participants)
+        {
+            minEpoch = std::min(minEpoch, participant->m_epoch.load(std::memory_order_acquire));
+        }
+
+        std::size_t kept = 0;
+        int reclaimedCount = 0;
+        for (std::size_t i = 0, length = m_retired.size(); i < length; i++)
+        {
+            RetiredItem &retired = m_retired[i];
+
+            if (retired.m_epoch < minEpoch)
+            {
+                retired.m_reclaim(retired.m_item);
+                reclaimedCount++;
+            }
+            else
+            {
+                m_retired[kept++] = retired;
+            }
+        }
+
+        m_retired.resize(kept);
+
+        return reclaimedCount;
+    }
+
+    inline std::size_t retiredCount() const
+    {
+        return m_retired.size();
+    }
+
+private:
+    struct RetiredItem
+    {
+        void *m_item;
+        reclaim_t m_reclaim;
+        std::int64_t m_epoch;
+    };
+
+    char m_paddingBefore[util::BitUtil::CACHE_LINE_LENGTH]{};
+    std::atomic<std::int64_t> m_globalEpoch = { 0 };
+    char m_paddingAfter[util::BitUtil::CACHE_LINE_LENGTH]{};
+    std::vector<Participant *> m_participants;
+    std::vector<RetiredItem> m_retired;
+};
+
+}}
+
+#endif //AERON_EPOCH_RECLAIMER_H
@@ -0,0 +1,206 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef AERON_LATENCY_HISTOGRAM_H
+#define AERON_LATENCY_HISTOGRAM_H
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+#include "concurrent/AtomicBuffer.h"
+#include "concurrent/logbuffer/FrameDescriptor.h"
+#include "concurrent/logbuffer/LogBufferDescriptor.h"
+#include "concurrent/logbuffer/Header.h"
+
+namespace aeron { namespace concurrent {
+
+/**
+ * Clock used for send timestamps. It reads the monotonic clock so timestamps can be compared with those of the C
+ * client's send timestamp clock in other processes on the same host.
+ *
+ * @return time in nanoseconds.
+ */
+inline std::int64_t sendTimestampNanoClock()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * Reserved value supplier which stamps each frame with {@link #sendTimestampNanoClock} for use with
+ * Publication::offer and ExclusivePublication::offer, so the latency to the subscriber can be recorded with
+ * {@link LatencyHistogram#recordHeader}.
+ */
+struct SendTimestampReservedValueSupplier
+{
+    inline std::int64_t operator()(AtomicBuffer &, util::index_t, util::index_t) const
+    {
+        return sendTimestampNanoClock();
+    }
+};
+
+/**
+ * Histogram of latencies in nanoseconds with log-linear buckets, matching aeron_latency_histogram_t in the C client.
+ * Values below 8ns have a bucket each and above that each power of two is split into 8 sub-buckets, so reported values
+ * are within 12.5% of what was recorded.
+ * <p>
+ * This class is not threadsafe.
+ */
+class LatencyHistogram
+{
+public:
+    static constexpr int SUB_BUCKET_BITS = 3;
+    static constexpr int SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+    static constexpr int BUCKET_COUNT = (63 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+    LatencyHistogram()
+    {
+        reset();
+    }
+
+    inline void reset()
+    {
+        m_counts.fill(0);
+        m_totalCount = 0;
+        m_maxValue = 0;
+    }
+
+    /**
+     * Record a latency. Negative values, from clocks that are slightly apart, are recorded as 0.
+     *
+     * @param valueNs latency in nanoseconds.
+     */
+    inline void recordValue(std::int64_t valueNs)
+    {
+        const std::int64_t value = valueNs < 0 ? 0 : valueNs;
+
+        m_counts[bucketIndex(value)]++;
+        m_totalCount++;
+
+        if (value > m_maxValue)
+        {
+            m_maxValue = value;
+        }
+    }
+
+    /**
+     * Record the publish to poll latency of a fragment sent with {@link SendTimestampReservedValueSupplier}. To be
+     * called from the fragment handler.
+     *
+     * @param header of the fragment.
+     * @return the latency in nanoseconds.
+     */
+    inline std::int64_t recordHeader(const logbuffer::Header &header)
+    {
+        const std::int64_t latencyNs = sendTimestampNanoClock() - header.reservedValue();
+        recordValue(latencyNs);
+
+        return latencyNs;
+    }
+
+    inline std::int64_t count() const
+    {
+        return m_totalCount;
+    }
+
+    inline std::int64_t maxValue() const
+    {
+        return m_maxValue;
+    }
+
+    /**
+     * Value at a percentile of the recorded values, e.g. 99.0 for the 99th percentile.
+     *
+     * @param percentile between 0.0 and 100.0.
+     * @return the upper bound of the bucket holding the percentile, in nanoseconds, or 0 if empty.
+     */
+    std::int64_t valueAtPercentile(double percentile) const
+    {
+        if (0 == m_totalCount)
+        {
+            return 0;
+        }
+
+        const double clamped = percentile < 0.0 ? 0.0 : (percentile > 100.0 ? 100.0 : percentile);
+        std::int64_t targetCount = static_cast<std::int64_t>((clamped / 100.0) * static_cast<double>(m_totalCount) + 0.5);
+        targetCount = targetCount < 1 ? 1 : targetCount;
+
+        std::int64_t count = 0;
+        for (int i = 0; i < BUCKET_COUNT; i++)
+        {
+            count += m_counts[i];
+            if (count >= targetCount)
+            {
+                const std::int64_t upperBound = bucketUpperBound(i);
+                return upperBound < m_maxValue ? upperBound : m_maxValue;
+            }
+        }
+
+        return m_maxValue;
+    }
+
+private:
+    std::array<std::int64_t, BUCKET_COUNT> m_counts;
+    std::int64_t m_totalCount = 0;
+    std::int64_t m_maxValue = 0;
+
+    static inline int highestBit(std::uint64_t value)
+    {
+#if defined(__GNUC__)
+        return 63 - __builtin_clzll(value);
+#else
+        int bit = 0;
+        while (value >>= 1)
+        {
+            bit++;
+        }
+
+        return bit;
+#endif
+    }
+
+    static inline int bucketIndex(std::int64_t value)
+    {
+        if (value < SUB_BUCKET_COUNT)
+        {
+            return static_cast<int>(value);
+        }
+
+        const int shift = highestBit(static_cast<std::uint64_t>(value)) - SUB_BUCKET_BITS;
+        const int subBucket = static_cast<int>((value >> shift) & (SUB_BUCKET_COUNT - 1));
+
+        return ((shift + 1) * SUB_BUCKET_COUNT) + subBucket;
+    }
+
+    static inline std::int64_t bucketUpperBound(int index)
+    {
+        if (index < SUB_BUCKET_COUNT)
+        {
+            return index;
+        }
+
+        const int shift = (index / SUB_BUCKET_COUNT) - 1;
+        const std::uint64_t lowerBound = static_cast<std::uint64_t>(SUB_BUCKET_COUNT + (index % SUB_BUCKET_COUNT)) << shift;
+
+        return static_cast<std::int64_t>(lowerBound + (UINT64_C(1) << shift) - 1);
+    }
+};
+
+}}
+
+#endif //AERON_LATENCY_HISTOGRAM_H
@@ -0,0 +1,76 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_TPAUSE_IDLE_STRATEGY_H
+#define AERON_TPAUSE_IDLE_STRATEGY_H
+
+#include "Atomic64.h"
+
+namespace aeron { namespace concurrent {
+
+/**
+ * Spins with pause for a number of idle cycles then waits in a low power state with TPAUSE, or WFE on ARM, for a
+ * bounded number of TSC cycles per idle. Wake-up latency stays close to busy spinning while leaving the core and its
+ * hyperthread sibling mostly idle. Falls back to busy spinning when the cpu has no low power wait.
+ */
+class TPauseIdleStrategy
+{
+public:
+    explicit TPauseIdleStrategy(std::uint64_t maxSpins = 100, std::uint64_t waitCycles = 10000) :
+        m_maxSpins(maxSpins),
+        m_waitCycles(waitCycles)
+    {
+    }
+
+    inline void idle(int workCount)
+    {
+        if (workCount > 0)
+        {
+            reset();
+        }
+        else
+        {
+            idle();
+        }
+    }
+
+    inline void reset()
+    {
+        m_spins = 0;
+    }
+
+    inline void idle()
+    {
+        if (m_spins < m_maxSpins)
+        {
+            m_spins++;
+            atomic::cpu_pause();
+        }
+        else
+        {
+            atomic::cpu_timed_pause(m_waitCycles);
+        }
+    }
+
+private:
+    std::uint64_t m_maxSpins;
+    std::uint64_t m_waitCycles;
+    std::uint64_t m_spins = 0;
+};
+
+}}
+
+#endif //AERON_TPAUSE_IDLE_STRATEGY_H
@@ -0,0 +1,167 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef AERON_CONCURRENT_ATOMIC64_GCC_AARCH64_H
+#define AERON_CONCURRENT_ATOMIC64_GCC_AARCH64_H
+
+#include <cstdint>
+#include <atomic>
+
+// AArch64 is weakly ordered so volatile gets and ordered puts map onto LDAR/STLR rather than a full DMB. When built
+// with LSE (-march=armv8.1-a or later, see AERON_ENABLE_ARM64_LSE) getAndAdd and cmpxchg become single LDADDAL/CASAL
+// instructions, otherwise GCC 10+ outlines them behind a runtime check for LSE.
+// See: https://gcc.gnu.org/onlinedocs/gcc/_005f_005fatomic-Builtins.html
+
+namespace aeron { namespace concurrent { namespace atomic {
+
+inline void thread_fence()
+{
+    std::atomic_thread_fence(std::memory_order_acq_rel);
+}
+
+inline void fence()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+/**
+* DMB ISHLD, which unlike a full barrier does not wait for prior stores.
+*/
+inline void acquire()
+{
+    std::atomic_thread_fence(std::memory_order_acquire);
+}
+
+inline void release()
+{
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+/**
+* A more jitter friendly alternate to thread:yield in spin waits.
+*/
+inline void cpu_pause()
+{
+    asm volatile("yield" ::: "memory");
+}
+
+inline bool cpu_has_timed_pause()
+{
+    return true;
+}
+
+/**
+* Wait with WFE until the next event, which the kernel event stream bounds. tscCycles is ignored as there is no
+* timed wait.
+*/
+inline void cpu_timed_pause(std::uint64_t tscCycles)
+{
+    asm volatile("wfe" ::: "memory");
+}
+
+inline std::int32_t getInt32Volatile(volatile std::int32_t *source)
+{
+    return __atomic_load_n(source, __ATOMIC_ACQUIRE);
+}
+
+inline void putInt32Volatile(volatile std::int32_t *address, std::int32_t value)
+{
+    __atomic_store_n(address, value, __ATOMIC_SEQ_CST);
+}
+
+inline void putInt32Ordered(volatile std::int32_t *address, std::int32_t value)
+{
+    __atomic_store_n(address, value, __ATOMIC_RELEASE);
+}
+
+inline void putInt32Atomic(volatile std::int32_t *address, std::int32_t value)
+{
+    __atomic_store_n(address, value, __ATOMIC_SEQ_CST);
+}
+
+inline std::int64_t getInt64Volatile(volatile std::int64_t *source)
+{
+    return __atomic_load_n(source, __ATOMIC_ACQUIRE);
+}
+
+template<typename T>
+inline volatile T *getValueVolatile(volatile T **source)
+{
+    return __atomic_load_n(source, __ATOMIC_ACQUIRE);
+}
+
+inline void putInt64Volatile(volatile std::int64_t *address, std::int64_t value)
+{
+    __atomic_store_n(address, value, __ATOMIC_SEQ_CST);
+}
+
+template<typename T>
+inline void putValueVolatile(volatile T *address, T value)
+{
+    static_assert(sizeof(T) <= 8, "Requires size <= 8 bytes");
+
+    __atomic_store_n(address, value, __ATOMIC_SEQ_CST);
+}
+
+inline void putInt64Ordered(volatile std::int64_t *address, std::int64_t value)
+{
+    __atomic_store_n(address, value, __ATOMIC_RELEASE);
+}
+
+template<typename T>
+inline void putValueOrdered(volatile T **address, volatile T *value)
+{
+    __atomic_store_n(address, value, __ATOMIC_RELEASE);
+}
+
+inline void putInt64Atomic(volatile std::int64_t *address, std::int64_t value)
+{
+    __atomic_store_n(address, value, __ATOMIC_SEQ_CST);
+}
+
+inline std::int64_t getAndAddInt64(volatile std::int64_t *address, std::int64_t value)
+{
+    return __atomic_fetch_add(address, value, __ATOMIC_SEQ_CST);
+}
+
+inline std::int32_t getAndAddInt32(volatile std::int32_t *address, std::int32_t value)
+{
+    return __atomic_fetch_add(address, value, __ATOMIC_SEQ_CST);
+}
+
+inline std::int32_t cmpxchg(volatile std::int32_t *destination, std::int32_t expected, std::int32_t desired)
+{
+    __atomic_compare_exchange_n(destination, &expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+
+    return expected;
+}
+
+inline std::int64_t cmpxchg(volatile std::int64_t *destination, std::int64_t expected, std::int64_t desired)
+{
+    __atomic_compare_exchange_n(destination, &expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+
+    return expected;
+}
+
+//-------------------------------------
+//  Alignment
+//-------------------------------------
+// Note: May not work on local variables.
+// http://gcc.gnu.org/bugzilla/show_bug.cgi?id=24691
+#define AERON_DECL_ALIGNED(declaration, amt) declaration __attribute__((aligned(amt)))
+
+}}}
+
+#endif
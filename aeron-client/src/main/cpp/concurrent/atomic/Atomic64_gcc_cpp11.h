@@ -20,7 +20,7 @@
 #include <thread>
 
 // Implement all operations using C++11 standard library atomics and GCC intrinsics.
-// Not as fast as the x64 specializations, but allows Aeron to work on other platforms (e.g. ARM).
+// Not as fast as the x64 and AArch64 specializations, but allows Aeron to work on other platforms.
 // See: https://gcc.gnu.org/onlinedocs/gcc/_005f_005fatomic-Builtins.html
 
 namespace aeron { namespace concurrent { namespace atomic {
@@ -50,6 +50,16 @@ inline void cpu_pause()
     std::this_thread::yield();
 }
 
+inline bool cpu_has_timed_pause()
+{
+    return false;
+}
+
+inline void cpu_timed_pause(std::uint64_t tscCycles)
+{
+    std::this_thread::yield();
+}
+
 inline std::int32_t getInt32Volatile(volatile std::int32_t *source)
 {
     std::int32_t sequence = *reinterpret_cast<volatile std::int32_t *>(source);
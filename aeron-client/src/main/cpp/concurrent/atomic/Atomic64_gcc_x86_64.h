@@ -49,6 +49,44 @@ inline void cpu_pause()
     asm volatile("pause\n" ::: "memory");
 }
 
+/**
+* Does the cpu support TPAUSE (WAITPKG) for low power timed waits.
+*/
+inline bool cpu_has_timed_pause()
+{
+    static const bool hasWaitPkg = []()
+    {
+        std::uint32_t eax = 7, ebx, ecx = 0, edx;
+        asm volatile("cpuid" : "+a"(eax), "=b"(ebx), "+c"(ecx), "=d"(edx));
+        return 0 != ((ecx >> 5) & 1);
+    }();
+
+    return hasWaitPkg;
+}
+
+/**
+* Wait for up to tscCycles in the C0.1 power state with TPAUSE, or a single pause when not supported.
+*/
+inline void cpu_timed_pause(std::uint64_t tscCycles)
+{
+    if (cpu_has_timed_pause())
+    {
+        std::uint32_t lo, hi;
+        asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+        const std::uint64_t deadline = ((static_cast<std::uint64_t>(hi) << 32) | lo) + tscCycles;
+
+        // tpause %ecx, encoded directly so the build does not need -mwaitpkg
+        asm volatile(".byte 0x66, 0x0f, 0xae, 0xf1"
+            :
+            : "c"(1), "a"(static_cast<std::uint32_t>(deadline)), "d"(static_cast<std::uint32_t>(deadline >> 32))
+            : "memory", "cc");
+    }
+    else
+    {
+        cpu_pause();
+    }
+}
+
 inline std::int32_t getInt32Volatile(volatile std::int32_t *source)
 {
     std::int32_t sequence = *reinterpret_cast<volatile std::int32_t *>(source);
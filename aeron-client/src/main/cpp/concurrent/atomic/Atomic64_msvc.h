@@ -52,6 +52,16 @@ inline void cpu_pause()
     _mm_pause();
 }
 
+inline bool cpu_has_timed_pause()
+{
+    return false;
+}
+
+inline void cpu_timed_pause(std::uint64_t tscCycles)
+{
+    _mm_pause();
+}
+
 inline std::int32_t getInt32Volatile(volatile std::int32_t *source)
 {
     std::int32_t sequence = *reinterpret_cast<volatile std::int32_t *>(source);
@@ -111,6 +111,65 @@ public:
         return isAvailable;
     }
 
+    /**
+     * Dispatch the records available up to the tail read on entry in place. The handler is called with the record's
+     * type id, the underlying broadcast buffer, and the offset and length of the message.
+     *
+     * Each record is checked for lapping and for a valid length before it is dispatched, and the cursor is left on
+     * the record being dispatched so the handler can copy the message out and then call validate(). If the
+     * transmitter has lapped the receiver then the lapped count is incremented and the batch stops.
+     *
+     * @param handler to be called for each record.
+     * @return the number of records dispatched.
+     * @throws util::IllegalStateException if a record length is out of range.
+     */
+    template<typename Handler>
+    int receiveBatch(Handler &&handler)
+    {
+        const std::int64_t tail = m_buffer.getInt64Volatile(m_tailCounterIndex);
+        int recordsReceived = 0;
+
+        while (m_nextRecord < tail)
+        {
+            const std::int64_t cursor = m_nextRecord;
+
+            if (!validate(cursor))
+            {
+                m_lappedCount += 1;
+                m_nextRecord = m_buffer.getInt64(m_latestCounterIndex);
+                break;
+            }
+
+            const auto recordOffset = static_cast<util::index_t>(cursor & m_mask);
+            const std::int32_t recordLength = m_buffer.getInt32Volatile(RecordDescriptor::lengthOffset(recordOffset));
+
+            if (recordLength < RecordDescriptor::HEADER_LENGTH || recordLength > m_capacity - recordOffset)
+            {
+                m_nextRecord = m_buffer.getInt64(m_latestCounterIndex);
+                throw util::IllegalStateException(
+                    "invalid broadcast record length " + std::to_string(recordLength), SOURCEINFO);
+            }
+
+            const std::int32_t msgTypeId = m_buffer.getInt32(RecordDescriptor::typeOffset(recordOffset));
+
+            m_cursor = cursor;
+            m_recordOffset = recordOffset;
+            m_nextRecord = cursor + util::BitUtil::align(recordLength, RecordDescriptor::RECORD_ALIGNMENT);
+
+            if (RecordDescriptor::PADDING_MSG_TYPE_ID != msgTypeId)
+            {
+                handler(
+                    msgTypeId,
+                    m_buffer,
+                    RecordDescriptor::msgOffset(recordOffset),
+                    recordLength - RecordDescriptor::HEADER_LENGTH);
+                ++recordsReceived;
+            }
+        }
+
+        return recordsReceived;
+    }
+
     inline bool validate() const
     {
         atomic::acquire();
@@ -33,6 +33,7 @@ class CopyBroadcastReceiver
 {
 public:
     explicit CopyBroadcastReceiver(BroadcastReceiver &receiver) :
+        m_scratch(),
         m_receiver(receiver),
         m_scratchBuffer(m_scratch)
     {
@@ -74,6 +75,47 @@ public:
         return messagesReceived;
     }
 
+    /**
+     * Receive all available records as a batch, reading the tail once. Each record is copied into the scratch
+     * buffer and validated before the handler is called, as for receive(), and an exception is thrown if the
+     * transmitter laps the receiver.
+     *
+     * @param handler to be called for each record.
+     * @return the number of records dispatched.
+     */
+    template<typename Handler>
+    int receiveBatch(Handler &&handler)
+    {
+        const long lastSeenLappedCount = m_receiver.lappedCount();
+
+        const int messagesReceived = m_receiver.receiveBatch(
+            [&](std::int32_t msgTypeId, AtomicBuffer &buffer, util::index_t offset, util::index_t length)
+            {
+                if (length > m_scratchBuffer.capacity())
+                {
+                    throw util::IllegalStateException(
+                        "buffer required size " + std::to_string(length) +
+                        " but only has " + std::to_string(m_scratchBuffer.capacity()), SOURCEINFO);
+                }
+
+                m_scratchBuffer.putBytes(0, buffer, offset, length);
+
+                if (!m_receiver.validate())
+                {
+                    throw util::IllegalStateException("unable to keep up with broadcast buffer", SOURCEINFO);
+                }
+
+                handler(msgTypeId, m_scratchBuffer, 0, length);
+            });
+
+        if (lastSeenLappedCount != m_receiver.lappedCount())
+        {
+            throw util::IllegalArgumentException("unable to keep up with broadcast buffer", SOURCEINFO);
+        }
+
+        return messagesReceived;
+    }
+
 private:
     AERON_DECL_ALIGNED(scratch_buffer_t m_scratch, 16);
     BroadcastReceiver &m_receiver;
@@ -79,6 +79,7 @@ public:
         return resultingOffset;
     }
 
+    template<typename ReservedValueSupplier>
     inline std::int32_t appendUnfragmentedMessage(
         std::int32_t termId,
         std::int32_t termOffset,
@@ -86,7 +87,7 @@ public:
         const AtomicBuffer& srcBuffer,
         util::index_t srcOffset,
         util::index_t length,
-        const on_reserved_value_supplier_t& reservedValueSupplier)
+        const ReservedValueSupplier &reservedValueSupplier)
     {
         const util::index_t frameLength = length + DataFrameHeader::LENGTH;
         const util::index_t alignedLength = util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
@@ -105,7 +106,8 @@ public:
             header.write(m_termBuffer, termOffset, frameLength, termId);
             m_termBuffer.putBytes(termOffset + DataFrameHeader::LENGTH, srcBuffer, srcOffset, length);
 
-            const std::int64_t reservedValue = reservedValueSupplier(m_termBuffer, termOffset, frameLength);
+            const std::int64_t reservedValue = supplyReservedValue(
+                reservedValueSupplier, m_termBuffer, termOffset, frameLength);
             m_termBuffer.putInt64(termOffset + DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET, reservedValue);
 
             FrameDescriptor::frameLengthOrdered(m_termBuffer, termOffset, frameLength);
@@ -156,6 +158,7 @@ public:
         return resultingOffset;
     }
 
+    template<typename ReservedValueSupplier>
     std::int32_t appendFragmentedMessage(
         std::int32_t termId,
         std::int32_t termOffset,
@@ -164,7 +167,7 @@ public:
         util::index_t srcOffset,
         util::index_t length,
         util::index_t maxPayloadLength,
-        const on_reserved_value_supplier_t& reservedValueSupplier)
+        const ReservedValueSupplier &reservedValueSupplier)
     {
         const int numMaxPayloads = length / maxPayloadLength;
         const util::index_t remainingPayload = length % maxPayloadLength;
@@ -208,7 +211,8 @@ public:
 
                 FrameDescriptor::frameFlags(m_termBuffer, offset, flags);
 
-                const std::int64_t reservedValue = reservedValueSupplier(m_termBuffer, offset, frameLength);
+                const std::int64_t reservedValue = supplyReservedValue(
+                    reservedValueSupplier, m_termBuffer, offset, frameLength);
                 m_termBuffer.putInt64(offset + DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET, reservedValue);
 
                 FrameDescriptor::frameLengthOrdered(m_termBuffer, offset, frameLength);
@@ -17,10 +17,27 @@
 #ifndef AERON_CONCURRENT_LOGBUFFER_DESCRIPTOR_H
 #define AERON_CONCURRENT_LOGBUFFER_DESCRIPTOR_H
 
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+
 #include "util/BitUtil.h"
+#include "util/Platform.h"
 #include "FrameDescriptor.h"
 #include "DataFrameHeader.h"
 
+/*
+ * Cache lines ahead of the current frame that Image poll loops prefetch, 0 disables it. Lines not yet written by the
+ * receiver are invalidated again when it writes them, so measure before enabling for a stream.
+ */
+#ifndef AERON_LOGBUFFER_READ_PREFETCH_LINES
+#define AERON_LOGBUFFER_READ_PREFETCH_LINES (0)
+#endif
+
 namespace aeron { namespace concurrent { namespace logbuffer {
 
 namespace LogBufferDescriptor {
@@ -84,6 +101,10 @@ const util::index_t LOG_META_DATA_SECTION_INDEX = PARTITION_COUNT;
  *  +---------------------------------------------------------------+
  *  |                    Active Transport Count                     |
  *  +---------------------------------------------------------------+
+ *  |                  Data Notification Sequence                   |
+ *  +---------------------------------------------------------------+
+ *  |                       Data Waiter Count                       |
+ *  +---------------------------------------------------------------+
  *  |                      Cache Line Padding                      ...
  * ...                                                              |
  *  +---------------------------------------------------------------+
@@ -121,7 +142,9 @@ struct LogMetaDataDefn
     std::int64_t endOfStreamPosition;
     std::int32_t isConnected;
     std::int32_t activeTransportCount;
-    std::int8_t pad2[(2 * util::BitUtil::CACHE_LINE_LENGTH) - (sizeof(std::int64_t) + (2 * sizeof(std::int32_t)))];
+    std::int32_t dataNotificationSequence;
+    std::int32_t dataWaiterCount;
+    std::int8_t pad2[(2 * util::BitUtil::CACHE_LINE_LENGTH) - (sizeof(std::int64_t) + (4 * sizeof(std::int32_t)))];
     std::int64_t correlationId;
     std::int32_t initialTermId;
     std::int32_t defaultFrameHeaderLength;
@@ -138,6 +161,9 @@ const util::index_t LOG_ACTIVE_TERM_COUNT_OFFSET = (util::index_t)offsetof(LogMe
 const util::index_t LOG_END_OF_STREAM_POSITION_OFFSET = (util::index_t)offsetof(LogMetaDataDefn, endOfStreamPosition);
 const util::index_t LOG_IS_CONNECTED_OFFSET = (util::index_t)offsetof(LogMetaDataDefn, isConnected);
 const util::index_t LOG_ACTIVE_TRANSPORT_COUNT = (util::index_t)offsetof(LogMetaDataDefn, activeTransportCount);
+const util::index_t LOG_DATA_NOTIFICATION_SEQUENCE_OFFSET =
+    (util::index_t)offsetof(LogMetaDataDefn, dataNotificationSequence);
+const util::index_t LOG_DATA_WAITER_COUNT_OFFSET = (util::index_t)offsetof(LogMetaDataDefn, dataWaiterCount);
 const util::index_t LOG_INITIAL_TERM_ID_OFFSET = (util::index_t)offsetof(LogMetaDataDefn, initialTermId);
 const util::index_t LOG_DEFAULT_FRAME_HEADER_LENGTH_OFFSET =
     (util::index_t)offsetof(LogMetaDataDefn, defaultFrameHeaderLength);
@@ -269,6 +295,28 @@ inline void endOfStreamPosition(AtomicBuffer &logMetaDataBuffer, std::int64_t po
     logMetaDataBuffer.putInt64Ordered(LOG_END_OF_STREAM_POSITION_OFFSET, position);
 }
 
+/*
+ * Wake subscribers blocked waiting for data after a message has been committed to the log. Costs a single volatile
+ * read unless a subscriber is waiting.
+ */
+inline void notifyData(AtomicBuffer &logMetaDataBuffer) noexcept
+{
+    if (logMetaDataBuffer.getInt32Volatile(LOG_DATA_WAITER_COUNT_OFFSET) > 0)
+    {
+        logMetaDataBuffer.getAndAddInt32(LOG_DATA_NOTIFICATION_SEQUENCE_OFFSET, 1);
+#if defined(__linux__)
+        ::syscall(
+            SYS_futex,
+            logMetaDataBuffer.buffer() + LOG_DATA_NOTIFICATION_SEQUENCE_OFFSET,
+            FUTEX_WAKE,
+            INT32_MAX,
+            nullptr,
+            nullptr,
+            0);
+#endif
+    }
+}
+
 inline int indexByTerm(std::int32_t initialTermId, std::int32_t activeTermId) noexcept
 {
     return (activeTermId - initialTermId) % PARTITION_COUNT;
@@ -370,6 +418,23 @@ inline void initializeTailWithTermId(AtomicBuffer &logMetaDataBuffer, int partit
     logMetaDataBuffer.putInt64(TERM_TAIL_COUNTER_OFFSET + (partitionIndex * sizeof(std::int64_t)), rawTail);
 }
 
+inline std::int32_t prefetchAhead(
+    AtomicBuffer &termBuffer, std::int32_t offset, std::int32_t prefetchOffset, std::int32_t limitOffset)
+{
+#if AERON_LOGBUFFER_READ_PREFETCH_LINES > 0
+    const std::int32_t prefetchLimit = offset +
+        static_cast<std::int32_t>(AERON_LOGBUFFER_READ_PREFETCH_LINES * util::BitUtil::CACHE_LINE_LENGTH);
+    const std::int32_t endOffset = std::min(prefetchLimit, limitOffset);
+
+    for (; prefetchOffset < endOffset; prefetchOffset += static_cast<std::int32_t>(util::BitUtil::CACHE_LINE_LENGTH))
+    {
+        AERON_PREFETCH(termBuffer.buffer() + prefetchOffset);
+    }
+#endif
+
+    return prefetchOffset;
+}
+
 }
 
 }}}
@@ -46,6 +46,29 @@ typedef std::function<std::int64_t(
 static const on_reserved_value_supplier_t DEFAULT_RESERVED_VALUE_SUPPLIER =
     [](AtomicBuffer&, util::index_t, util::index_t) -> std::int64_t { return 0; };
 
+/**
+ * Supplier for appends that do not set a reserved value. The appenders are templated on the supplier type so this
+ * resolves to a reserved value of zero at compile time, without the indirect call through a std::function.
+ */
+struct NoReservedValueSupplier
+{
+};
+
+template<typename ReservedValueSupplier>
+inline std::int64_t supplyReservedValue(
+    const ReservedValueSupplier &reservedValueSupplier,
+    AtomicBuffer &termBuffer,
+    util::index_t termOffset,
+    util::index_t length)
+{
+    return reservedValueSupplier(termBuffer, termOffset, length);
+}
+
+inline std::int64_t supplyReservedValue(const NoReservedValueSupplier &, AtomicBuffer &, util::index_t, util::index_t)
+{
+    return 0;
+}
+
 class TermAppender
 {
 public:
@@ -103,12 +126,77 @@ public:
         return static_cast<std::int32_t>(resultingOffset);
     }
 
+    /*
+     * Claim the frames for a message that is fragmented over max payload length sized frames, wrapping one buffer
+     * claim per fragment. Each fragment must then be committed, or all of them aborted, to make the range available.
+     */
+    template <class BufferClaimIterator> std::int32_t claimFragmented(
+        const HeaderWriter &header,
+        util::index_t length,
+        util::index_t maxPayloadLength,
+        BufferClaimIterator bufferClaimIt,
+        std::int32_t activeTermId)
+    {
+        const int numMaxPayloads = length / maxPayloadLength;
+        const util::index_t remainingPayload = length % maxPayloadLength;
+        const util::index_t lastFrameLength = (remainingPayload > 0) ?
+            util::BitUtil::align(remainingPayload + DataFrameHeader::LENGTH, FrameDescriptor::FRAME_ALIGNMENT) : 0;
+        const util::index_t requiredLength =
+            (numMaxPayloads * (maxPayloadLength + DataFrameHeader::LENGTH)) + lastFrameLength;
+        const std::int64_t rawTail = getAndAddRawTail(requiredLength);
+        const std::int64_t termOffset = rawTail & 0xFFFFFFFF;
+        const std::int32_t termId = LogBufferDescriptor::termId(rawTail);
+
+        const std::int32_t termLength = m_termBuffer.capacity();
+
+        checkTerm(activeTermId, termId);
+
+        std::int64_t resultingOffset = termOffset + requiredLength;
+        if (resultingOffset > termLength)
+        {
+            resultingOffset = handleEndOfLogCondition(m_termBuffer, termOffset, header, termLength, termId);
+        }
+        else
+        {
+            std::uint8_t flags = FrameDescriptor::BEGIN_FRAG;
+            util::index_t remaining = length;
+            auto frameOffset = static_cast<std::int32_t>(termOffset);
+
+            do
+            {
+                const util::index_t bytesToWrite = std::min(remaining, maxPayloadLength);
+                const util::index_t frameLength = bytesToWrite + DataFrameHeader::LENGTH;
+                const util::index_t alignedLength =
+                    util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+
+                header.write(m_termBuffer, frameOffset, frameLength, termId);
+
+                if (remaining <= maxPayloadLength)
+                {
+                    flags |= FrameDescriptor::END_FRAG;
+                }
+
+                FrameDescriptor::frameFlags(m_termBuffer, frameOffset, flags);
+                bufferClaimIt->wrap(m_termBuffer, frameOffset, frameLength);
+
+                flags = 0;
+                frameOffset += alignedLength;
+                remaining -= bytesToWrite;
+                ++bufferClaimIt;
+            }
+            while (remaining > 0);
+        }
+
+        return static_cast<std::int32_t>(resultingOffset);
+    }
+
+    template<typename ReservedValueSupplier>
     inline std::int32_t appendUnfragmentedMessage(
         const HeaderWriter &header,
         const AtomicBuffer &srcBuffer,
         util::index_t srcOffset,
         util::index_t length,
-        const on_reserved_value_supplier_t &reservedValueSupplier,
+        const ReservedValueSupplier &reservedValueSupplier,
         std::int32_t activeTermId)
     {
         const util::index_t frameLength = length + DataFrameHeader::LENGTH;
@@ -132,7 +220,8 @@ public:
             header.write(m_termBuffer, frameOffset, frameLength, termId);
             m_termBuffer.putBytes(frameOffset + DataFrameHeader::LENGTH, srcBuffer, srcOffset, length);
 
-            const std::int64_t reservedValue = reservedValueSupplier(m_termBuffer, frameOffset, frameLength);
+            const std::int64_t reservedValue = supplyReservedValue(
+                reservedValueSupplier, m_termBuffer, frameOffset, frameLength);
             m_termBuffer.putInt64(frameOffset + DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET, reservedValue);
 
             FrameDescriptor::frameLengthOrdered(m_termBuffer, frameOffset, frameLength);
@@ -186,13 +275,122 @@ public:
         return static_cast<std::int32_t>(resultingOffset);
     }
 
+    /*
+     * Append a batch of messages, one per buffer and each within the max payload length, with a single add to the
+     * term tail. If the batch runs past the end of the term the messages that fit are still committed, the rest of
+     * the term is padded and appendedCount gives the index of the first message not appended.
+     */
+    template <class BufferIterator> std::int32_t appendUnfragmentedBatch(
+        const HeaderWriter &header,
+        BufferIterator startBuffer,
+        BufferIterator lastBuffer,
+        util::index_t batchLength,
+        std::size_t &appendedCount,
+        const on_reserved_value_supplier_t &reservedValueSupplier,
+        std::int32_t activeTermId)
+    {
+        const std::int64_t rawTail = getAndAddRawTail(batchLength);
+        const std::int64_t termOffset = rawTail & 0xFFFFFFFF;
+        const std::int32_t termId = LogBufferDescriptor::termId(rawTail);
+
+        const std::int32_t termLength = m_termBuffer.capacity();
+
+        appendedCount = 0;
+        checkTerm(activeTermId, termId);
+
+        std::int64_t frameOffset = termOffset;
+        for (BufferIterator it = startBuffer; it != lastBuffer; ++it)
+        {
+            const util::index_t frameLength = it->capacity() + DataFrameHeader::LENGTH;
+            const util::index_t alignedLength = util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+
+            if (frameOffset + alignedLength > termLength)
+            {
+                return handleEndOfLogCondition(m_termBuffer, frameOffset, header, termLength, termId);
+            }
+
+            const auto offset = static_cast<std::int32_t>(frameOffset);
+            header.write(m_termBuffer, offset, frameLength, termId);
+            m_termBuffer.putBytes(offset + DataFrameHeader::LENGTH, *it, 0, it->capacity());
+
+            const std::int64_t reservedValue = reservedValueSupplier(m_termBuffer, offset, frameLength);
+            m_termBuffer.putInt64(offset + DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET, reservedValue);
+
+            FrameDescriptor::frameLengthOrdered(m_termBuffer, offset, frameLength);
+
+            frameOffset += alignedLength;
+            appendedCount++;
+        }
+
+        return static_cast<std::int32_t>(frameOffset);
+    }
+
+    /*
+     * Append a block of pre-formatted frames with a single add to the term tail. The frames are copied as is with
+     * their term offset, term id, session id and stream id rewritten for the claimed position, and the block is made
+     * visible by committing the length of its first frame last.
+     */
+    std::int32_t appendBlock(
+        const HeaderWriter &header,
+        const AtomicBuffer &srcBuffer,
+        util::index_t srcOffset,
+        util::index_t length,
+        std::int32_t sessionId,
+        std::int32_t streamId,
+        std::int32_t activeTermId)
+    {
+        const std::int64_t rawTail = getAndAddRawTail(length);
+        const std::int64_t termOffset = rawTail & 0xFFFFFFFF;
+        const std::int32_t termId = LogBufferDescriptor::termId(rawTail);
+
+        const std::int32_t termLength = m_termBuffer.capacity();
+
+        checkTerm(activeTermId, termId);
+
+        std::int64_t resultingOffset = termOffset + length;
+        if (resultingOffset > termLength)
+        {
+            resultingOffset = handleEndOfLogCondition(m_termBuffer, termOffset, header, termLength, termId);
+        }
+        else
+        {
+            const auto offset = static_cast<std::int32_t>(termOffset);
+            const std::int32_t lengthOfFirstFrame = srcBuffer.getInt32(srcOffset);
+
+            FrameDescriptor::frameLengthOrdered(m_termBuffer, offset, -lengthOfFirstFrame);
+            m_termBuffer.putBytes(
+                offset + DataFrameHeader::VERSION_FIELD_OFFSET,
+                srcBuffer,
+                srcOffset + DataFrameHeader::VERSION_FIELD_OFFSET,
+                length - DataFrameHeader::VERSION_FIELD_OFFSET);
+
+            for (util::index_t blockOffset = 0; blockOffset < length;)
+            {
+                const std::int32_t frameOffset = offset + blockOffset;
+                const std::int32_t frameLength = 0 == blockOffset ?
+                    lengthOfFirstFrame : m_termBuffer.getInt32(frameOffset);
+
+                m_termBuffer.putInt32(frameOffset + DataFrameHeader::TERM_OFFSET_FIELD_OFFSET, frameOffset);
+                m_termBuffer.putInt32(frameOffset + DataFrameHeader::SESSION_ID_FIELD_OFFSET, sessionId);
+                m_termBuffer.putInt32(frameOffset + DataFrameHeader::STREAM_ID_FIELD_OFFSET, streamId);
+                m_termBuffer.putInt32(frameOffset + DataFrameHeader::TERM_ID_FIELD_OFFSET, termId);
+                blockOffset += util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+            }
+
+            FrameDescriptor::frameLengthOrdered(m_termBuffer, offset, lengthOfFirstFrame);
+        }
+
+        return static_cast<std::int32_t>(resultingOffset);
+    }
+
+    template<typename ReservedValueSupplier>
     std::int32_t appendFragmentedMessage(
         const HeaderWriter &header,
         const AtomicBuffer &srcBuffer,
         util::index_t srcOffset,
         util::index_t length,
         util::index_t maxPayloadLength,
-        const on_reserved_value_supplier_t &reservedValueSupplier,
+        const ReservedValueSupplier &reservedValueSupplier,
         std::int32_t activeTermId)
     {
         const int numMaxPayloads = length / maxPayloadLength;
@@ -241,7 +439,8 @@ public:
 
                 FrameDescriptor::frameFlags(m_termBuffer, frameOffset, flags);
 
-                const std::int64_t reservedValue = reservedValueSupplier(m_termBuffer, frameOffset, frameLength);
+                const std::int64_t reservedValue = supplyReservedValue(
+                    reservedValueSupplier, m_termBuffer, frameOffset, frameLength);
                 m_termBuffer.putInt64(frameOffset + DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET, reservedValue);
 
                 FrameDescriptor::frameLengthOrdered(m_termBuffer, frameOffset, frameLength);
@@ -19,6 +19,7 @@
 
 #include <functional>
 #include "concurrent/AtomicBuffer.h"
+#include "util/Exceptions.h"
 #include "LogBufferDescriptor.h"
 #include "Header.h"
 
@@ -40,6 +41,30 @@ typedef std::function<void(
     std::int32_t sessionId,
     std::int32_t termId)> block_handler_t;
 
+/**
+ * Callback for handling a block of whole messages being read from a log by a controlled block poll.
+ *
+ * @param buffer    containing the block of frames which begins and ends on message boundaries.
+ * @param offset    at which the block begins.
+ * @param length    of the block in bytes.
+ * @param sessionId of the stream containing this block of messages.
+ * @param termId    of the stream containing this block of messages.
+ * @return the number of bytes from the start of the block to consume, rounded down to the last whole message.
+ */
+typedef std::function<std::int32_t(
+    concurrent::AtomicBuffer &buffer,
+    util::index_t offset,
+    util::index_t length,
+    std::int32_t sessionId,
+    std::int32_t termId)> controlled_block_handler_t;
+
+/**
+ * True when a block handler is declared noexcept, so polls calling it need no exception handling.
+ */
+template<typename F>
+using IsNoexceptBlockHandler = util::IsNoexceptCallable<
+    F, concurrent::AtomicBuffer &, util::index_t, util::index_t, std::int32_t, std::int32_t>;
+
 namespace TermBlockScanner {
 
 inline std::int32_t scan(const AtomicBuffer &termBuffer, const std::int32_t termOffset, const std::int32_t limitOffset)
@@ -77,6 +102,64 @@ inline std::int32_t scan(const AtomicBuffer &termBuffer, const std::int32_t term
     return offset;
 }
 
+/**
+ * Scan from termOffset to the end of the last whole message which fits before limitOffset. A padding frame at
+ * termOffset is a block on its own. If extendFirstMessage is set then the first message is completed even when it
+ * crosses the limit, which is safe as the fragments of a message never span a term.
+ */
+inline std::int32_t scanMessages(
+    const AtomicBuffer &termBuffer,
+    const std::int32_t termOffset,
+    const std::int32_t limitOffset,
+    const bool extendFirstMessage)
+{
+    const std::int32_t capacity = termBuffer.capacity();
+    std::int32_t offset = termOffset;
+    std::int32_t blockEndOffset = termOffset;
+
+    while (offset < capacity)
+    {
+        const std::int32_t frameLength = FrameDescriptor::frameLengthVolatile(termBuffer, offset);
+        if (frameLength <= 0)
+        {
+            break;
+        }
+
+        const std::int32_t alignedFrameLength = util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+        const bool isOverLimit = offset + alignedFrameLength > limitOffset;
+
+        if (FrameDescriptor::isPaddingFrame(termBuffer, offset))
+        {
+            if (termOffset == offset && (extendFirstMessage || !isOverLimit))
+            {
+                blockEndOffset = offset + alignedFrameLength;
+            }
+
+            break;
+        }
+
+        if (isOverLimit && (termOffset < blockEndOffset || !extendFirstMessage))
+        {
+            break;
+        }
+
+        const std::uint8_t flags = termBuffer.getUInt8(FrameDescriptor::flagsOffset(offset));
+        offset += alignedFrameLength;
+
+        if (flags & FrameDescriptor::END_FRAG)
+        {
+            blockEndOffset = offset;
+
+            if (offset >= limitOffset)
+            {
+                break;
+            }
+        }
+    }
+
+    return blockEndOffset;
+}
+
 }
 
 }}}
@@ -24,6 +24,26 @@ namespace aeron { namespace concurrent { namespace logbuffer {
 
 namespace TermGapScanner {
 
+static const std::int32_t BATCH_FRAMES = 4;
+
+/**
+ * Read the frame length words of BATCH_FRAMES slots at a fixed stride with independent loads and return the index
+ * of the first that differs from expected, or BATCH_FRAMES if all match.
+ */
+inline std::int32_t batchMismatch(
+    AtomicBuffer &termBuffer, util::index_t offset, std::int32_t stride, std::int32_t expected)
+{
+    const std::int32_t l0 = termBuffer.getInt32Volatile(offset);
+    const std::int32_t l1 = termBuffer.getInt32Volatile(offset + stride);
+    const std::int32_t l2 = termBuffer.getInt32Volatile(offset + (stride * 2));
+    const std::int32_t l3 = termBuffer.getInt32Volatile(offset + (stride * 3));
+
+    const std::int32_t mismatchMask =
+        (l0 != expected) | ((l1 != expected) << 1) | ((l2 != expected) << 2) | ((l3 != expected) << 3);
+
+    return 0 == mismatchMask ? BATCH_FRAMES : util::BitUtil::numberOfTrailingZeroes(mismatchMask);
+}
+
 inline std::int32_t scanForGap(
     AtomicBuffer &termBuffer,
     std::int32_t termId,
@@ -39,7 +59,15 @@ inline std::int32_t scanForGap(
             break;
         }
 
-        rebuildOffset += util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+        const std::int32_t alignedFrameLength = util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+        const std::int32_t batchLength = alignedFrameLength * BATCH_FRAMES;
+        rebuildOffset += alignedFrameLength;
+
+        while (rebuildOffset <= hwmOffset - batchLength &&
+            BATCH_FRAMES == batchMismatch(termBuffer, rebuildOffset, alignedFrameLength, frameLength))
+        {
+            rebuildOffset += batchLength;
+        }
     }
     while (rebuildOffset < hwmOffset);
 
@@ -47,6 +75,19 @@ inline std::int32_t scanForGap(
     if (rebuildOffset < hwmOffset)
     {
         const std::int32_t limit = hwmOffset - FrameDescriptor::ALIGNED_HEADER_LENGTH;
+        const std::int32_t batchLength = FrameDescriptor::FRAME_ALIGNMENT * BATCH_FRAMES;
+
+        while (rebuildOffset <= limit - batchLength)
+        {
+            const std::int32_t index = batchMismatch(
+                termBuffer, rebuildOffset + FrameDescriptor::FRAME_ALIGNMENT, FrameDescriptor::FRAME_ALIGNMENT, 0);
+
+            rebuildOffset += FrameDescriptor::FRAME_ALIGNMENT * index;
+            if (BATCH_FRAMES != index)
+            {
+                break;
+            }
+        }
 
         while (rebuildOffset < limit)
         {
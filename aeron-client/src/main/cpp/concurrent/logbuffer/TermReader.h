@@ -20,6 +20,7 @@
 #include <functional>
 #include "LogBufferDescriptor.h"
 #include "Header.h"
+#include "util/Exceptions.h"
 
 namespace aeron { namespace concurrent { namespace logbuffer {
 
@@ -40,6 +41,13 @@ typedef std::function<void(
     util::index_t length,
     Header& header)> fragment_handler_t;
 
+/**
+ * True when a fragment handler is declared noexcept, so polls calling it need no exception handling.
+ */
+template<typename F>
+using IsNoexceptFragmentHandler = util::IsNoexceptCallable<
+    F, concurrent::AtomicBuffer &, util::index_t, util::index_t, Header &>;
+
 
 namespace TermReader {
 
@@ -62,37 +70,38 @@ inline void read(
     outcome.fragmentsRead = 0;
     outcome.offset = termOffset;
     const util::index_t capacity = termBuffer.capacity();
+    std::int32_t prefetchOffset = termOffset;
 
-    try
-    {
-        while (outcome.fragmentsRead < fragmentsLimit && termOffset < capacity)
+    util::invokeGuarded(
+        [&]()
         {
-            const std::int32_t frameLength = FrameDescriptor::frameLengthVolatile(termBuffer, termOffset);
-            if (frameLength <= 0)
-            {
-                break;
-            }
-
-            const std::int32_t fragmentOffset = termOffset;
-            termOffset += util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
-
-            if (!FrameDescriptor::isPaddingFrame(termBuffer, fragmentOffset))
+            while (outcome.fragmentsRead < fragmentsLimit && termOffset < capacity)
             {
-                header.buffer(termBuffer);
-                header.offset(fragmentOffset);
-                handler(
-                    termBuffer,
-                    fragmentOffset + DataFrameHeader::LENGTH,
-                    frameLength - DataFrameHeader::LENGTH, header);
-
-                ++outcome.fragmentsRead;
+                prefetchOffset = LogBufferDescriptor::prefetchAhead(termBuffer, termOffset, prefetchOffset, capacity);
+                const std::int32_t frameLength = FrameDescriptor::frameLengthVolatile(termBuffer, termOffset);
+                if (frameLength <= 0)
+                {
+                    break;
+                }
+
+                const std::int32_t fragmentOffset = termOffset;
+                termOffset += util::BitUtil::align(frameLength, FrameDescriptor::FRAME_ALIGNMENT);
+
+                if (!FrameDescriptor::isPaddingFrame(termBuffer, fragmentOffset))
+                {
+                    header.buffer(termBuffer);
+                    header.offset(fragmentOffset);
+                    handler(
+                        termBuffer,
+                        fragmentOffset + DataFrameHeader::LENGTH,
+                        frameLength - DataFrameHeader::LENGTH, header);
+
+                    ++outcome.fragmentsRead;
+                }
             }
-        }
-    }
-    catch (const std::exception &ex)
-    {
-        exceptionHandler(ex);
-    }
+        },
+        exceptionHandler,
+        IsNoexceptFragmentHandler<F>());
 
     outcome.offset = termOffset;
 }
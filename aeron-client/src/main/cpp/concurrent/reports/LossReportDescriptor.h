@@ -46,6 +46,15 @@ namespace aeron { namespace concurrent { namespace reports {
  *  +---------------------------------------------------------------+
  *  |                           Stream ID                           |
  *  +---------------------------------------------------------------+
+ *  |                 Repair Counts by Repair Type                 ...
+ * ...                                                              |
+ *  +---------------------------------------------------------------+
+ *  |                    Gap Length Histogram                      ...
+ * ...                                                              |
+ *  +---------------------------------------------------------------+
+ *  |                    Repair Time Histogram                     ...
+ * ...                                                              |
+ *  +---------------------------------------------------------------+
  *  |                 Channel encoded in US-ASCII                  ...
  * ...                                                              |
  *  +---------------------------------------------------------------+
@@ -57,6 +66,23 @@ namespace aeron { namespace concurrent { namespace reports {
 namespace LossReportDescriptor
 {
 
+/**
+ * Bucket i of the gap length histogram counts gaps of [32 << i, 64 << i) bytes and bucket i of the repair time
+ * histogram repairs taking [8 << i, 16 << i) microseconds, the first buckets also taking anything shorter and the last
+ * anything longer.
+ */
+static const std::size_t HISTOGRAM_BUCKETS = 16;
+static const int GAP_LENGTH_BUCKET_SHIFT = 5;
+static const int REPAIR_TIME_US_BUCKET_SHIFT = 3;
+
+enum RepairType : std::size_t
+{
+    RETRANSMIT = 0,
+    UNSOLICITED = 1,
+    TIMEOUT = 2,
+    REPAIR_TYPE_COUNT = 3
+};
+
 #pragma pack(push)
 #pragma pack(4)
 struct LossReportEntryDefn
@@ -67,10 +93,13 @@ struct LossReportEntryDefn
     std::int64_t lastObservationTimestamp;
     std::int32_t sessionId;
     std::int32_t streamId;
+    std::int64_t repairCounts[REPAIR_TYPE_COUNT];
+    std::int64_t gapLengthHistogram[HISTOGRAM_BUCKETS];
+    std::int64_t repairTimeHistogram[HISTOGRAM_BUCKETS];
 };
 #pragma pack(pop)
 
-static const util::index_t ENTRY_ALIGNMENT = sizeof(util::BitUtil::CACHE_LINE_LENGTH);
+static const util::index_t ENTRY_ALIGNMENT = util::BitUtil::CACHE_LINE_LENGTH;
 static const util::index_t OBSERVATION_COUNT_OFFSET =
     static_cast<util::index_t>(offsetof(LossReportEntryDefn, observationCount));
 static const util::index_t CHANNEL_OFFSET = sizeof(LossReportEntryDefn);
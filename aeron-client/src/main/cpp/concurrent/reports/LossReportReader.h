@@ -35,14 +35,20 @@ typedef std::function<void(
     const std::string &channel,
     const std::string &source)> loss_report_consumer_t;
 
+typedef std::function<void(
+    const LossReportDescriptor::LossReportEntryDefn &entry,
+    const std::string &channel,
+    const std::string &source)> loss_report_entry_consumer_t;
+
 /**
- * Read a LossReport contained in the buffer. This can be done concurrently.
+ * Read a LossReport contained in the buffer, including the repair counts and histograms of each entry. This can be
+ * done concurrently so the counts and histograms of an entry may be updated as they are read.
  *
  * @param buffer        containing the loss report.
  * @param entryConsumer to be called to accept each entry in the report.
  * @return the number of entries read.
  */
-inline static int read(AtomicBuffer &buffer, const loss_report_consumer_t &consumer)
+inline static int readEntries(AtomicBuffer &buffer, const loss_report_entry_consumer_t &consumer)
 {
     int recordsRead = 0;
     util::index_t offset = 0;
@@ -67,15 +73,7 @@ inline static int read(AtomicBuffer &buffer, const loss_report_consumer_t &consu
 
         auto &record = buffer.overlayStruct<LossReportDescriptor::LossReportEntryDefn>(offset);
 
-        consumer(
-            observationCount,
-            record.totalBytesLost,
-            record.firstObservationTimestamp,
-            record.lastObservationTimestamp,
-            record.sessionId,
-            record.streamId,
-            channel,
-            source);
+        consumer(record, channel, source);
 
         const util::index_t recordLength =
             LossReportDescriptor::CHANNEL_OFFSET +
@@ -89,6 +87,31 @@ inline static int read(AtomicBuffer &buffer, const loss_report_consumer_t &consu
     return recordsRead;
 }
 
+/**
+ * Read a LossReport contained in the buffer. This can be done concurrently.
+ *
+ * @param buffer        containing the loss report.
+ * @param entryConsumer to be called to accept each entry in the report.
+ * @return the number of entries read.
+ */
+inline static int read(AtomicBuffer &buffer, const loss_report_consumer_t &consumer)
+{
+    return readEntries(
+        buffer,
+        [&](const LossReportDescriptor::LossReportEntryDefn &entry, const std::string &channel, const std::string &source)
+        {
+            consumer(
+                entry.observationCount,
+                entry.totalBytesLost,
+                entry.firstObservationTimestamp,
+                entry.lastObservationTimestamp,
+                entry.sessionId,
+                entry.streamId,
+                channel,
+                source);
+        });
+}
+
 }}}}
 
 #endif //AERON_LOSS_REPORT_READER_H
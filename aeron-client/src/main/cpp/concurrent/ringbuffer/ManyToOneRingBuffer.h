@@ -78,6 +78,61 @@ public:
         return isSuccessful;
     }
 
+    /**
+     * Claim space for a message of the given length so it can be encoded in place. The returned index is the offset
+     * in the underlying buffer at which the message is to be written, after which it must be published with
+     * commit(util::index_t) or discarded with abort(util::index_t). Until then the consumer is blocked on the record.
+     *
+     * @param msgTypeId type of the message.
+     * @param length    of the message to be encoded.
+     * @return index at which to encode the message or INSUFFICIENT_CAPACITY if the ring buffer is full.
+     */
+    util::index_t tryClaim(std::int32_t msgTypeId, util::index_t length)
+    {
+        RecordDescriptor::checkMsgTypeId(msgTypeId);
+        checkMsgLength(length);
+
+        const util::index_t recordLength = length + RecordDescriptor::HEADER_LENGTH;
+        const util::index_t requiredCapacity = util::BitUtil::align(recordLength, RecordDescriptor::ALIGNMENT);
+        const util::index_t recordIndex = claimCapacity(requiredCapacity);
+
+        if (INSUFFICIENT_CAPACITY == recordIndex)
+        {
+            return INSUFFICIENT_CAPACITY;
+        }
+
+        m_buffer.putInt64Ordered(recordIndex, RecordDescriptor::makeHeader(-recordLength, msgTypeId));
+
+        return RecordDescriptor::encodedMsgOffset(recordIndex);
+    }
+
+    /**
+     * Publish a message previously claimed with tryClaim(std::int32_t, util::index_t).
+     *
+     * @param index returned by tryClaim.
+     */
+    void commit(util::index_t index)
+    {
+        const util::index_t recordIndex = computeRecordIndex(index);
+        const std::int32_t recordLength = verifyClaimedSpaceNotReleased(recordIndex);
+
+        m_buffer.putInt32Ordered(RecordDescriptor::lengthOffset(recordIndex), -recordLength);
+    }
+
+    /**
+     * Discard a message previously claimed with tryClaim(std::int32_t, util::index_t) by turning it into padding.
+     *
+     * @param index returned by tryClaim.
+     */
+    void abort(util::index_t index)
+    {
+        const util::index_t recordIndex = computeRecordIndex(index);
+        const std::int32_t recordLength = verifyClaimedSpaceNotReleased(recordIndex);
+
+        m_buffer.putInt32(RecordDescriptor::typeOffset(recordIndex), RecordDescriptor::PADDING_MSG_TYPE_ID);
+        m_buffer.putInt32Ordered(RecordDescriptor::lengthOffset(recordIndex), -recordLength);
+    }
+
     int read(const handler_t &handler, int messageCountLimit)
     {
         const std::int64_t head = m_buffer.getInt64(m_headPositionIndex);
@@ -239,10 +294,9 @@ public:
         return unblocked;
     }
 
-private:
-
     static const util::index_t INSUFFICIENT_CAPACITY = -2;
 
+private:
     concurrent::AtomicBuffer &m_buffer;
     util::index_t m_capacity;
     util::index_t m_maxMsgLength;
@@ -324,6 +378,32 @@ private:
         }
     }
 
+    inline util::index_t computeRecordIndex(util::index_t index) const
+    {
+        const util::index_t recordIndex = index - RecordDescriptor::HEADER_LENGTH;
+        if (recordIndex < 0 || recordIndex > (m_capacity - RecordDescriptor::HEADER_LENGTH))
+        {
+            throw util::IllegalArgumentException("invalid message index " + std::to_string(index), SOURCEINFO);
+        }
+
+        return recordIndex;
+    }
+
+    inline std::int32_t verifyClaimedSpaceNotReleased(util::index_t recordIndex) const
+    {
+        const std::int32_t recordLength = m_buffer.getInt32(RecordDescriptor::lengthOffset(recordIndex));
+        if (recordLength < 0)
+        {
+            return recordLength;
+        }
+
+        throw util::IllegalStateException(
+            "claimed space previously " +
+            std::string(RecordDescriptor::PADDING_MSG_TYPE_ID ==
+                m_buffer.getInt32(RecordDescriptor::typeOffset(recordIndex)) ? "aborted" : "committed"),
+            SOURCEINFO);
+    }
+
     inline static bool scanBackToConfirmStillZeroed(const AtomicBuffer& buffer, std::int32_t from, std::int32_t limit)
     {
         std::int32_t i = from - RecordDescriptor::ALIGNMENT;
@@ -61,60 +61,78 @@ public:
 
         const util::index_t recordLength = length + RecordDescriptor::HEADER_LENGTH;
         const util::index_t requiredCapacity = util::BitUtil::align(recordLength, RecordDescriptor::ALIGNMENT);
-        const util::index_t mask = m_capacity - 1;
-
-        std::int64_t head = m_buffer.getInt64(m_headCachePositionIndex);
-        std::int64_t tail = m_buffer.getInt64(m_tailPositionIndex);
-        const util::index_t availableCapacity = m_capacity - (util::index_t)(tail - head);
+        std::int64_t tail;
+        util::index_t padding;
+        const util::index_t recordIndex = claimCapacity(requiredCapacity, tail, padding);
 
-        if (requiredCapacity > availableCapacity)
+        if (INSUFFICIENT_CAPACITY == recordIndex)
         {
-            head = m_buffer.getInt64Volatile(m_headPositionIndex);
-
-            if (requiredCapacity > (m_capacity - (util::index_t)(tail - head)))
-            {
-                return false;
-            }
-
-            m_buffer.putInt64(m_headCachePositionIndex, head);
+            return false;
         }
 
-        util::index_t padding = 0;
-        auto recordIndex = static_cast<util::index_t>(tail & mask);
-        const util::index_t toBufferEndLength = m_capacity - recordIndex;
-
-        if (requiredCapacity > toBufferEndLength)
-        {
-            auto headIndex = static_cast<std::int32_t>(head & mask);
-
-            if (requiredCapacity > headIndex)
-            {
-                head = m_buffer.getInt64Volatile(m_headPositionIndex);
-                headIndex = static_cast<std::int32_t>(head & mask);
+        m_buffer.putBytes(RecordDescriptor::encodedMsgOffset(recordIndex), srcBuffer, srcIndex, length);
+        m_buffer.putInt64Ordered(recordIndex, RecordDescriptor::makeHeader(recordLength, msgTypeId));
+        m_buffer.putInt64Ordered(m_tailPositionIndex, tail + requiredCapacity + padding);
 
-                if (requiredCapacity > headIndex)
-                {
-                    return false;
-                }
+        return true;
+    }
 
-                m_buffer.putInt64Ordered(m_headCachePositionIndex, head);
-            }
+    /**
+     * Claim space for a message of the given length so it can be encoded in place. The returned index is the offset
+     * in the underlying buffer at which the message is to be written, after which it must be published with
+     * commit(util::index_t) or discarded with abort(util::index_t). Until then the consumer is blocked on the record.
+     *
+     * @param msgTypeId type of the message.
+     * @param length    of the message to be encoded.
+     * @return index at which to encode the message or INSUFFICIENT_CAPACITY if the ring buffer is full.
+     */
+    util::index_t tryClaim(std::int32_t msgTypeId, util::index_t length)
+    {
+        RecordDescriptor::checkMsgTypeId(msgTypeId);
+        checkMsgLength(length);
 
-            padding = toBufferEndLength;
-        }
+        const util::index_t recordLength = length + RecordDescriptor::HEADER_LENGTH;
+        const util::index_t requiredCapacity = util::BitUtil::align(recordLength, RecordDescriptor::ALIGNMENT);
+        std::int64_t tail;
+        util::index_t padding;
+        const util::index_t recordIndex = claimCapacity(requiredCapacity, tail, padding);
 
-        if (0 != padding)
+        if (INSUFFICIENT_CAPACITY == recordIndex)
         {
-            m_buffer.putInt64Ordered(
-                recordIndex, RecordDescriptor::makeHeader(padding, RecordDescriptor::PADDING_MSG_TYPE_ID));
-            recordIndex = 0;
+            return INSUFFICIENT_CAPACITY;
         }
 
-        m_buffer.putBytes(RecordDescriptor::encodedMsgOffset(recordIndex), srcBuffer, srcIndex, length);
-        m_buffer.putInt64Ordered(recordIndex, RecordDescriptor::makeHeader(recordLength, msgTypeId));
+        m_buffer.putInt64Ordered(recordIndex, RecordDescriptor::makeHeader(-recordLength, msgTypeId));
         m_buffer.putInt64Ordered(m_tailPositionIndex, tail + requiredCapacity + padding);
 
-        return true;
+        return RecordDescriptor::encodedMsgOffset(recordIndex);
+    }
+
+    /**
+     * Publish a message previously claimed with tryClaim(std::int32_t, util::index_t).
+     *
+     * @param index returned by tryClaim.
+     */
+    void commit(util::index_t index)
+    {
+        const util::index_t recordIndex = computeRecordIndex(index);
+        const std::int32_t recordLength = verifyClaimedSpaceNotReleased(recordIndex);
+
+        m_buffer.putInt32Ordered(RecordDescriptor::lengthOffset(recordIndex), -recordLength);
+    }
+
+    /**
+     * Discard a message previously claimed with tryClaim(std::int32_t, util::index_t) by turning it into padding.
+     *
+     * @param index returned by tryClaim.
+     */
+    void abort(util::index_t index)
+    {
+        const util::index_t recordIndex = computeRecordIndex(index);
+        const std::int32_t recordLength = verifyClaimedSpaceNotReleased(recordIndex);
+
+        m_buffer.putInt32(RecordDescriptor::typeOffset(recordIndex), RecordDescriptor::PADDING_MSG_TYPE_ID);
+        m_buffer.putInt32Ordered(RecordDescriptor::lengthOffset(recordIndex), -recordLength);
     }
 
     int read(const handler_t &handler, int messageCountLimit)
@@ -232,6 +250,8 @@ public:
         return false;
     }
 
+    static const util::index_t INSUFFICIENT_CAPACITY = -2;
+
 private:
     concurrent::AtomicBuffer &m_buffer;
     util::index_t m_capacity;
@@ -242,6 +262,59 @@ private:
     util::index_t m_correlationIdCounterIndex;
     util::index_t m_consumerHeartbeatIndex;
 
+    util::index_t claimCapacity(util::index_t requiredCapacity, std::int64_t &tail, util::index_t &padding)
+    {
+        const util::index_t mask = m_capacity - 1;
+        std::int64_t head = m_buffer.getInt64(m_headCachePositionIndex);
+        tail = m_buffer.getInt64(m_tailPositionIndex);
+        const util::index_t availableCapacity = m_capacity - (util::index_t)(tail - head);
+
+        if (requiredCapacity > availableCapacity)
+        {
+            head = m_buffer.getInt64Volatile(m_headPositionIndex);
+
+            if (requiredCapacity > (m_capacity - (util::index_t)(tail - head)))
+            {
+                return INSUFFICIENT_CAPACITY;
+            }
+
+            m_buffer.putInt64(m_headCachePositionIndex, head);
+        }
+
+        padding = 0;
+        auto recordIndex = static_cast<util::index_t>(tail & mask);
+        const util::index_t toBufferEndLength = m_capacity - recordIndex;
+
+        if (requiredCapacity > toBufferEndLength)
+        {
+            auto headIndex = static_cast<std::int32_t>(head & mask);
+
+            if (requiredCapacity > headIndex)
+            {
+                head = m_buffer.getInt64Volatile(m_headPositionIndex);
+                headIndex = static_cast<std::int32_t>(head & mask);
+
+                if (requiredCapacity > headIndex)
+                {
+                    return INSUFFICIENT_CAPACITY;
+                }
+
+                m_buffer.putInt64Ordered(m_headCachePositionIndex, head);
+            }
+
+            padding = toBufferEndLength;
+        }
+
+        if (0 != padding)
+        {
+            m_buffer.putInt64Ordered(
+                recordIndex, RecordDescriptor::makeHeader(padding, RecordDescriptor::PADDING_MSG_TYPE_ID));
+            recordIndex = 0;
+        }
+
+        return recordIndex;
+    }
+
     inline void checkMsgLength(util::index_t length) const
     {
         if (length > m_maxMsgLength)
@@ -252,6 +325,32 @@ private:
                 SOURCEINFO);
         }
     }
+
+    inline util::index_t computeRecordIndex(util::index_t index) const
+    {
+        const util::index_t recordIndex = index - RecordDescriptor::HEADER_LENGTH;
+        if (recordIndex < 0 || recordIndex > (m_capacity - RecordDescriptor::HEADER_LENGTH))
+        {
+            throw util::IllegalArgumentException("invalid message index " + std::to_string(index), SOURCEINFO);
+        }
+
+        return recordIndex;
+    }
+
+    inline std::int32_t verifyClaimedSpaceNotReleased(util::index_t recordIndex) const
+    {
+        const std::int32_t recordLength = m_buffer.getInt32(RecordDescriptor::lengthOffset(recordIndex));
+        if (recordLength < 0)
+        {
+            return recordLength;
+        }
+
+        throw util::IllegalStateException(
+            "claimed space previously " +
+            std::string(RecordDescriptor::PADDING_MSG_TYPE_ID ==
+                m_buffer.getInt32(RecordDescriptor::typeOffset(recordIndex)) ? "aborted" : "committed"),
+            SOURCEINFO);
+    }
 };
 
 }}}
@@ -0,0 +1,136 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+    #include <sys/inotify.h>
+    #include <poll.h>
+    #include <unistd.h>
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__NetBSD__)
+    #include <sys/types.h>
+    #include <sys/event.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+    #define AERON_DIRECTORY_WATCHER_KQUEUE
+#endif
+
+#include <thread>
+#include <cstdint>
+
+#include "DirectoryWatcher.h"
+
+namespace aeron { namespace util
+{
+
+DirectoryWatcher::DirectoryWatcher(const std::string &path) : m_path(path)
+{
+    init();
+}
+
+DirectoryWatcher::~DirectoryWatcher()
+{
+    close();
+}
+
+void DirectoryWatcher::retry()
+{
+    if (m_fd < 0)
+    {
+        init();
+    }
+}
+
+void DirectoryWatcher::init()
+{
+#if defined(__linux__)
+    if ((m_fd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC)) >= 0)
+    {
+        const std::uint32_t mask = IN_CREATE | IN_MODIFY | IN_CLOSE_WRITE | IN_MOVED_TO | IN_ATTRIB;
+
+        if (::inotify_add_watch(m_fd, m_path.c_str(), mask) < 0)
+        {
+            close();
+        }
+    }
+#elif defined(AERON_DIRECTORY_WATCHER_KQUEUE)
+    if ((m_dirFd = ::open(m_path.c_str(), O_RDONLY)) >= 0)
+    {
+        struct kevent change;
+
+        EV_SET(&change, m_dirFd, EVFILT_VNODE, EV_ADD | EV_CLEAR, NOTE_WRITE | NOTE_EXTEND, 0, nullptr);
+        if ((m_fd = ::kqueue()) < 0 || ::kevent(m_fd, &change, 1, nullptr, 0, nullptr) < 0)
+        {
+            close();
+        }
+    }
+#endif
+}
+
+void DirectoryWatcher::await(std::chrono::milliseconds timeout)
+{
+#if defined(__linux__)
+    if (m_fd >= 0)
+    {
+        struct pollfd pfd = {};
+        pfd.fd = m_fd;
+        pfd.events = POLLIN;
+        char buffer[4096];
+
+        if (::poll(&pfd, 1, static_cast<int>(timeout.count())) >= 0)
+        {
+            while (::read(m_fd, buffer, sizeof(buffer)) > 0)
+            {
+            }
+
+            return;
+        }
+    }
+#elif defined(AERON_DIRECTORY_WATCHER_KQUEUE)
+    if (m_fd >= 0)
+    {
+        struct kevent event;
+        struct timespec ts;
+        ts.tv_sec = static_cast<time_t>(timeout.count() / 1000);
+        ts.tv_nsec = static_cast<long>((timeout.count() % 1000) * 1000000);
+
+        if (::kevent(m_fd, nullptr, 0, &event, 1, &ts) >= 0)
+        {
+            return;
+        }
+    }
+#endif
+
+    std::this_thread::sleep_for(timeout);
+}
+
+void DirectoryWatcher::close()
+{
+#if defined(__linux__) || defined(AERON_DIRECTORY_WATCHER_KQUEUE)
+    if (m_fd >= 0)
+    {
+        ::close(m_fd);
+    }
+
+    if (m_dirFd >= 0)
+    {
+        ::close(m_dirFd);
+    }
+#endif
+
+    m_fd = -1;
+    m_dirFd = -1;
+}
+
+}}
@@ -0,0 +1,66 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_UTIL_DIRECTORY_WATCHER_H
+#define AERON_UTIL_DIRECTORY_WATCHER_H
+
+#include <string>
+#include <chrono>
+
+#include "util/Export.h"
+
+namespace aeron { namespace util
+{
+
+/**
+ * Wakes a waiter when entries in a directory are created, written or renamed, using inotify on Linux and kqueue on
+ * macOS and the BSDs. Where neither is available, or the directory cannot be watched, awaiting simply sleeps for the
+ * timeout. Writes made through a shared mapping are not reported, so anything signalled that way must still be polled.
+ */
+class CLIENT_EXPORT DirectoryWatcher
+{
+public:
+    explicit DirectoryWatcher(const std::string &path);
+
+    ~DirectoryWatcher();
+
+    DirectoryWatcher(const DirectoryWatcher &) = delete;
+    DirectoryWatcher &operator=(const DirectoryWatcher &) = delete;
+
+    /**
+     * Start watching the directory if it could not be watched before, e.g. because it did not yet exist.
+     */
+    void retry();
+
+    /**
+     * Block until an event is reported for the directory or the timeout expires.
+     *
+     * @param timeout to wait for an event.
+     */
+    void await(std::chrono::milliseconds timeout);
+
+private:
+    void init();
+    void close();
+
+    std::string m_path;
+    int m_fd = -1;
+    int m_dirFd = -1;
+};
+
+}}
+
+#endif
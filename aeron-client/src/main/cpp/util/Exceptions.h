@@ -20,6 +20,8 @@
 #include <string>
 #include <stdexcept>
 #include <functional>
+#include <type_traits>
+#include <utility>
 #include "MacroUtil.h"
 
 namespace aeron { namespace util
@@ -58,6 +60,53 @@ static constexpr const char *past_prefix(const char * const prefix, const char *
  */
 typedef std::function<void(const std::exception &exception)> exception_handler_t;
 
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+    #define AERON_CPP_EXCEPTIONS_ENABLED 1
+#else
+    #define AERON_CPP_EXCEPTIONS_ENABLED 0
+#endif
+
+/**
+ * True when calling F with Args is declared noexcept, e.g. a lambda or functor marked noexcept, but never for a
+ * std::function.
+ */
+template<typename F, typename... Args>
+struct IsNoexceptCallable :
+    std::integral_constant<bool, noexcept(std::declval<F &>()(std::declval<Args>()...))>
+{
+};
+
+/**
+ * Run body without catching, as it calls only handlers declared noexcept, so no landing pad is generated.
+ */
+template<typename B>
+inline void invokeGuarded(B &&body, const exception_handler_t &, std::true_type)
+{
+    body();
+}
+
+/**
+ * Run body and pass any exception it throws to exceptionHandler. When the build has exceptions disabled the body is
+ * simply run.
+ */
+template<typename B>
+inline void invokeGuarded(B &&body, const exception_handler_t &exceptionHandler, std::false_type)
+{
+#if AERON_CPP_EXCEPTIONS_ENABLED
+    try
+    {
+        body();
+    }
+    catch (const std::exception &ex)
+    {
+        exceptionHandler(ex);
+    }
+#else
+    (void)exceptionHandler;
+    body();
+#endif
+}
+
 enum class ExceptionCategory : std::int64_t
 {
     EXCEPTION_CATEGORY_FATAL = 0,
@@ -29,6 +29,7 @@
 
 #include <string>
 #include <cstring>
+#include <cerrno>
 
 #include "MemoryMappedFile.h"
 #include "Exceptions.h"
@@ -256,6 +257,14 @@ MemoryMappedFile::MemoryMappedFile(FileHandle fd, std::size_t offset, std::size_
     }
 }
 
+void MemoryMappedFile::lock()
+{
+    if (!::VirtualLock(m_memory, m_memorySize))
+    {
+        throw IOException(std::string("failed to lock memory: ") + toString(GetLastError()), SOURCEINFO);
+    }
+}
+
 void MemoryMappedFile::cleanUp()
 {
     if (m_memory)
@@ -342,6 +351,14 @@ MemoryMappedFile::~MemoryMappedFile()
     }
 }
 
+void MemoryMappedFile::lock()
+{
+    if (::mlock(m_memory, m_memorySize) < 0)
+    {
+        throw IOException(std::string("failed to lock memory: ") + std::strerror(errno), SOURCEINFO);
+    }
+}
+
 std::uint8_t *MemoryMappedFile::doMapping(std::size_t length, FileHandle fd, std::size_t offset, bool readOnly)
 {
     void *memory = ::mmap(
@@ -55,6 +55,13 @@ public:
     std::uint8_t *getMemoryPtr() const;
     std::size_t getMemorySize() const;
 
+    /**
+     * Lock the pages of the mapping into memory, faulting them in, so later accesses do not take a page fault.
+     *
+     * @throws IOException if the pages could not be locked, e.g. because RLIMIT_MEMLOCK is too low.
+     */
+    void lock();
+
     MemoryMappedFile(MemoryMappedFile const &) = delete;
     MemoryMappedFile& operator=(MemoryMappedFile const &) = delete;
 
@@ -0,0 +1,181 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef AERON_UTIL_MEMORY_UTIL_H
+#define AERON_UTIL_MEMORY_UTIL_H
+
+#include <cstdint>
+#include <cstring>
+
+#include "util/Platform.h"
+
+#if defined(AERON_CPU_X64)
+#include <emmintrin.h>
+#define AERON_MEMORY_UTIL_X64_SSE2
+#if defined(AERON_COMPILER_GCC)
+#include <immintrin.h>
+#define AERON_MEMORY_UTIL_X64_AVX2
+#endif
+#endif
+
+namespace aeron { namespace util
+{
+
+/**
+ * Bulk memory copy functions
+ */
+namespace MemoryUtil
+{
+/**
+ * Copies at or above this length are larger than a typical L2 cache so use non-temporal stores rather than evicting
+ * the working set with data that will not be read again by the writing CPU.
+ */
+static const std::size_t NON_TEMPORAL_COPY_THRESHOLD = 512 * 1024;
+
+typedef void (*copy_func_t)(std::uint8_t *dst, const std::uint8_t *src, std::size_t length);
+
+#if defined(AERON_MEMORY_UTIL_X64_SSE2)
+inline void nonTemporalCopySse2(std::uint8_t *dst, const std::uint8_t *src, std::size_t length)
+{
+    std::size_t head = (16 - (reinterpret_cast<std::uintptr_t>(dst) & 15u)) & 15u;
+    head = head > length ? length : head;
+
+    ::memcpy(dst, src, head);
+    dst += head;
+    src += head;
+    length -= head;
+
+    for (; length >= 64; length -= 64, dst += 64, src += 64)
+    {
+        const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 16));
+        const __m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 32));
+        const __m128i v3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 48));
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dst), v0);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dst + 16), v1);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dst + 32), v2);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dst + 48), v3);
+    }
+
+    for (; length >= 16; length -= 16, dst += 16, src += 16)
+    {
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dst), _mm_loadu_si128(reinterpret_cast<const __m128i *>(src)));
+    }
+
+    ::memcpy(dst, src, length);
+
+    // streaming stores are weakly ordered so must be fenced before the copy is released
+    _mm_sfence();
+}
+#endif
+
+#if defined(AERON_MEMORY_UTIL_X64_AVX2)
+__attribute__((target("avx2")))
+inline void nonTemporalCopyAvx2(std::uint8_t *dst, const std::uint8_t *src, std::size_t length)
+{
+    std::size_t head = (32 - (reinterpret_cast<std::uintptr_t>(dst) & 31u)) & 31u;
+    head = head > length ? length : head;
+
+    ::memcpy(dst, src, head);
+    dst += head;
+    src += head;
+    length -= head;
+
+    for (; length >= 128; length -= 128, dst += 128, src += 128)
+    {
+        const __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src));
+        const __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + 32));
+        const __m256i v2 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + 64));
+        const __m256i v3 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + 96));
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dst), v0);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dst + 32), v1);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dst + 64), v2);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dst + 96), v3);
+    }
+
+    for (; length >= 32; length -= 32, dst += 32, src += 32)
+    {
+        _mm256_stream_si256(
+            reinterpret_cast<__m256i *>(dst), _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src)));
+    }
+
+    ::memcpy(dst, src, length);
+
+    _mm_sfence();
+}
+#endif
+
+inline void nonTemporalCopyGeneric(std::uint8_t *dst, const std::uint8_t *src, std::size_t length)
+{
+    ::memcpy(dst, src, length);
+}
+
+inline copy_func_t selectNonTemporalCopy()
+{
+#if defined(AERON_MEMORY_UTIL_X64_AVX2)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return nonTemporalCopyAvx2;
+    }
+#endif
+
+#if defined(AERON_MEMORY_UTIL_X64_SSE2)
+    return nonTemporalCopySse2;
+#else
+    return nonTemporalCopyGeneric;
+#endif
+}
+
+/**
+ * Copy with non-temporal stores using the widest kernel the CPU supports, selected on first use. Stores are fenced
+ * before returning so the copy is visible before any following ordered store.
+ *
+ * @param dst to copy to.
+ * @param src to copy from.
+ * @param length in bytes to copy.
+ */
+inline void nonTemporalCopy(void *dst, const void *src, std::size_t length)
+{
+    static const copy_func_t copyFunc = selectNonTemporalCopy();
+    copyFunc(static_cast<std::uint8_t *>(dst), static_cast<const std::uint8_t *>(src), length);
+}
+
+/**
+ * Copy using memcpy, or non-temporal stores when the copy is too large to be usefully retained in cache.
+ *
+ * @param dst to copy to.
+ * @param src to copy from.
+ * @param length in bytes to copy.
+ */
+inline void bulkCopy(void *dst, const void *src, std::size_t length)
+{
+    if (length >= NON_TEMPORAL_COPY_THRESHOLD)
+    {
+        nonTemporalCopy(dst, src, length);
+    }
+    else
+    {
+        ::memcpy(dst, src, length);
+    }
+}
+
+}
+
+}}
+
+#endif //AERON_UTIL_MEMORY_UTIL_H
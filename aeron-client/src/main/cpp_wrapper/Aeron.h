@@ -0,0 +1,281 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_WRAPPER_AERON_H
+#define AERON_WRAPPER_AERON_H
+
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "Context.h"
+#include "Publication.h"
+#include "ExclusivePublication.h"
+#include "Subscription.h"
+
+namespace aeron { namespace wrapper
+{
+
+/**
+ * Handle to an in flight asynchronous add of a resource which is polled for completion.
+ *
+ * @tparam R resource wrapper type created on completion.
+ * @tparam C C client type of the resource.
+ * @tparam A C client type of the async add.
+ * @tparam Poll C client function to poll the async add for completion.
+ */
+template<typename R, typename C, typename A, int (*Poll)(C **, A *)>
+class AsyncAdd
+{
+public:
+    AsyncAdd(A *async, std::shared_ptr<Aeron> aeron) : m_async(async), m_aeron(std::move(aeron))
+    {
+    }
+
+    AsyncAdd(const AsyncAdd &) = delete;
+    AsyncAdd &operator=(const AsyncAdd &) = delete;
+
+    /**
+     * Poll for completion of the add. The async add is complete once a resource is returned or an exception thrown,
+     * after which it must not be polled again.
+     *
+     * @return the resource once added or nullptr if the add has not yet completed.
+     */
+    inline std::shared_ptr<R> poll()
+    {
+        C *resource = nullptr;
+        const int result = Poll(&resource, m_async);
+
+        if (result < 0)
+        {
+            m_async = nullptr;
+            throwLastError();
+        }
+
+        if (0 == result)
+        {
+            return nullptr;
+        }
+
+        m_async = nullptr;
+
+        return std::make_shared<R>(resource, m_aeron);
+    }
+
+private:
+    A *m_async;
+    std::shared_ptr<Aeron> m_aeron;
+};
+
+typedef AsyncAdd<Publication, aeron_publication_t, aeron_async_add_publication_t, aeron_async_add_publication_poll>
+    AsyncAddPublication;
+
+typedef AsyncAdd<
+    ExclusivePublication,
+    aeron_exclusive_publication_t,
+    aeron_async_add_exclusive_publication_t,
+    aeron_async_add_exclusive_publication_poll> AsyncAddExclusivePublication;
+
+typedef AsyncAdd<Subscription, aeron_subscription_t, aeron_async_add_subscription_t, aeron_async_add_subscription_poll>
+    AsyncAddSubscription;
+
+/**
+ * Header only C++ API layered over the C client in aeronc.h.
+ * <p>
+ * Resources created by the client hold a reference to it so that it is closed only once they have all been released.
+ * Calls on the data path forward inline to the C client and perform no allocation.
+ */
+class Aeron : public std::enable_shared_from_this<Aeron>
+{
+public:
+    Aeron(const Aeron &) = delete;
+    Aeron &operator=(const Aeron &) = delete;
+
+    ~Aeron()
+    {
+        aeron_close(m_aeron);
+    }
+
+    /**
+     * Create a client connected to the media driver using the given context.
+     *
+     * @param context to configure the client which is consumed by the client.
+     * @return the connected client.
+     */
+    static std::shared_ptr<Aeron> connect(Context &context)
+    {
+        return std::shared_ptr<Aeron>(new Aeron(std::move(context)));
+    }
+
+    /**
+     * Create a client connected to the media driver using a default context.
+     *
+     * @return the connected client.
+     */
+    static std::shared_ptr<Aeron> connect()
+    {
+        Context context;
+        return connect(context);
+    }
+
+    inline std::int64_t clientId() const
+    {
+        return aeron_client_id(m_aeron);
+    }
+
+    inline bool isClosed() const
+    {
+        return aeron_is_closed(m_aeron);
+    }
+
+    /**
+     * Run the client conductor duty cycle once when the context was set to use the conductor agent invoker.
+     *
+     * @return the work count of the duty cycle.
+     */
+    inline int doWork()
+    {
+        return aeron_main_do_work(m_aeron);
+    }
+
+    inline std::shared_ptr<AsyncAddPublication> asyncAddPublication(const std::string &channel, std::int32_t streamId)
+    {
+        aeron_async_add_publication_t *async = nullptr;
+        if (aeron_async_add_publication(&async, m_aeron, channel.c_str(), streamId) < 0)
+        {
+            throwLastError();
+        }
+
+        return std::make_shared<AsyncAddPublication>(async, shared_from_this());
+    }
+
+    inline std::shared_ptr<AsyncAddExclusivePublication> asyncAddExclusivePublication(
+        const std::string &channel, std::int32_t streamId)
+    {
+        aeron_async_add_exclusive_publication_t *async = nullptr;
+        if (aeron_async_add_exclusive_publication(&async, m_aeron, channel.c_str(), streamId) < 0)
+        {
+            throwLastError();
+        }
+
+        return std::make_shared<AsyncAddExclusivePublication>(async, shared_from_this());
+    }
+
+    inline std::shared_ptr<AsyncAddSubscription> asyncAddSubscription(const std::string &channel, std::int32_t streamId)
+    {
+        aeron_async_add_subscription_t *async = nullptr;
+        if (aeron_async_add_subscription(
+            &async, m_aeron, channel.c_str(), streamId, nullptr, nullptr, nullptr, nullptr) < 0)
+        {
+            throwLastError();
+        }
+
+        return std::make_shared<AsyncAddSubscription>(async, shared_from_this());
+    }
+
+    /**
+     * Add a publication and wait for the media driver to complete the registration.
+     *
+     * @param channel for the publication.
+     * @param streamId within the channel.
+     * @return the added publication.
+     */
+    inline std::shared_ptr<Publication> addPublication(const std::string &channel, std::int32_t streamId)
+    {
+        return awaitAdd(asyncAddPublication(channel, streamId));
+    }
+
+    /**
+     * Add an exclusive publication and wait for the media driver to complete the registration.
+     *
+     * @param channel for the publication.
+     * @param streamId within the channel.
+     * @return the added exclusive publication.
+     */
+    inline std::shared_ptr<ExclusivePublication> addExclusivePublication(
+        const std::string &channel, std::int32_t streamId)
+    {
+        return awaitAdd(asyncAddExclusivePublication(channel, streamId));
+    }
+
+    /**
+     * Add a subscription and wait for the media driver to complete the registration.
+     *
+     * @param channel for the subscription.
+     * @param streamId within the channel.
+     * @return the added subscription.
+     */
+    inline std::shared_ptr<Subscription> addSubscription(const std::string &channel, std::int32_t streamId)
+    {
+        return awaitAdd(asyncAddSubscription(channel, streamId));
+    }
+
+    /**
+     * Underlying C client for functions not exposed by this wrapper.
+     *
+     * @return the underlying C client.
+     */
+    inline aeron_t *aeron() const
+    {
+        return m_aeron;
+    }
+
+private:
+    Context m_context;
+    aeron_t *m_aeron = nullptr;
+
+    explicit Aeron(Context &&context) : m_context(std::move(context))
+    {
+        if (aeron_init(&m_aeron, m_context.context()) < 0)
+        {
+            throwLastError();
+        }
+
+        if (aeron_start(m_aeron) < 0)
+        {
+            ClientException exception(aeron_errcode(), aeron_errmsg());
+            aeron_close(m_aeron);
+            throw exception;
+        }
+    }
+
+    template<typename A>
+    inline auto awaitAdd(std::shared_ptr<A> async) -> decltype(async->poll())
+    {
+        const bool useConductorAgentInvoker = aeron_context_get_use_conductor_agent_invoker(m_context.context());
+        auto resource = async->poll();
+
+        while (!resource)
+        {
+            if (useConductorAgentInvoker)
+            {
+                doWork();
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+
+            resource = async->poll();
+        }
+
+        return resource;
+    }
+};
+
+}}
+
+#endif //AERON_WRAPPER_AERON_H
@@ -0,0 +1,135 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_WRAPPER_CONTEXT_H
+#define AERON_WRAPPER_CONTEXT_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "Exceptions.h"
+
+namespace aeron { namespace wrapper
+{
+
+/**
+ * Callback for errors raised by the client conductor.
+ */
+typedef std::function<void(int errcode, const char *message)> error_handler_t;
+
+/**
+ * Owning handle to an aeron_context_t used to configure an {@link Aeron} client.
+ * <p>
+ * A Context is moved into the client when connecting and must not be reused.
+ */
+class Context
+{
+public:
+    Context()
+    {
+        if (aeron_context_init(&m_context) < 0)
+        {
+            throwLastError();
+        }
+    }
+
+    Context(Context &&other) noexcept :
+        m_context(other.m_context),
+        m_errorHandler(std::move(other.m_errorHandler))
+    {
+        other.m_context = nullptr;
+    }
+
+    Context(const Context &) = delete;
+    Context &operator=(const Context &) = delete;
+    Context &operator=(Context &&) = delete;
+
+    ~Context()
+    {
+        if (nullptr != m_context)
+        {
+            aeron_context_close(m_context);
+        }
+    }
+
+    inline Context &aeronDir(const std::string &dir)
+    {
+        checkResult(aeron_context_set_dir(m_context, dir.c_str()));
+        return *this;
+    }
+
+    inline std::string aeronDir() const
+    {
+        return aeron_context_get_dir(m_context);
+    }
+
+    inline Context &driverTimeoutMs(std::uint64_t timeoutMs)
+    {
+        checkResult(aeron_context_set_driver_timeout_ms(m_context, timeoutMs));
+        return *this;
+    }
+
+    inline std::uint64_t driverTimeoutMs() const
+    {
+        return aeron_context_get_driver_timeout_ms(m_context);
+    }
+
+    inline Context &useConductorAgentInvoker(bool useConductorAgentInvoker)
+    {
+        checkResult(aeron_context_set_use_conductor_agent_invoker(m_context, useConductorAgentInvoker));
+        return *this;
+    }
+
+    inline Context &errorHandler(const error_handler_t &handler)
+    {
+        m_errorHandler.reset(new error_handler_t(handler));
+        checkResult(aeron_context_set_error_handler(m_context, errorHandlerTrampoline, m_errorHandler.get()));
+        return *this;
+    }
+
+    /**
+     * Underlying C context for settings not exposed by this wrapper.
+     *
+     * @return the underlying C context.
+     */
+    inline aeron_context_t *context() const
+    {
+        return m_context;
+    }
+
+private:
+    aeron_context_t *m_context = nullptr;
+    std::unique_ptr<error_handler_t> m_errorHandler;
+
+    static inline void checkResult(int result)
+    {
+        if (result < 0)
+        {
+            throwLastError();
+        }
+    }
+
+    static void errorHandlerTrampoline(void *clientd, int errcode, const char *message)
+    {
+        (*static_cast<error_handler_t *>(clientd))(errcode, message);
+    }
+};
+
+}}
+
+#endif //AERON_WRAPPER_CONTEXT_H
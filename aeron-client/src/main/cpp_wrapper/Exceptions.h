@@ -0,0 +1,58 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_WRAPPER_EXCEPTIONS_H
+#define AERON_WRAPPER_EXCEPTIONS_H
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include "aeronc.h"
+
+namespace aeron { namespace wrapper
+{
+
+/**
+ * Exception raised when a call into the C client fails, carrying the error code and message recorded by it.
+ */
+class ClientException : public std::runtime_error
+{
+public:
+    ClientException(int errcode, const std::string &message) : std::runtime_error(message), m_errcode(errcode)
+    {
+    }
+
+    inline int errcode() const
+    {
+        return m_errcode;
+    }
+
+private:
+    int m_errcode;
+};
+
+/**
+ * Throw a ClientException for the last error recorded by the C client on this thread.
+ */
+[[noreturn]] inline void throwLastError()
+{
+    throw ClientException(aeron_errcode(), aeron_errmsg());
+}
+
+}}
+
+#endif //AERON_WRAPPER_EXCEPTIONS_H
@@ -0,0 +1,174 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_WRAPPER_PUBLICATION_H
+#define AERON_WRAPPER_PUBLICATION_H
+
+#include <memory>
+#include <string>
+
+#include "Exceptions.h"
+
+namespace aeron { namespace wrapper
+{
+
+class Aeron;
+
+/**
+ * Owning handle to an aeron_publication_t with inline forwarding of the offer and claim paths.
+ * <p>
+ * The handle keeps its {@link Aeron} client open and closes the publication when destroyed.
+ */
+class Publication
+{
+public:
+    Publication(aeron_publication_t *publication, std::shared_ptr<Aeron> aeron) :
+        m_publication(publication),
+        m_aeron(std::move(aeron))
+    {
+        if (aeron_publication_constants(m_publication, &m_constants) < 0)
+        {
+            throwLastError();
+        }
+    }
+
+    Publication(const Publication &) = delete;
+    Publication &operator=(const Publication &) = delete;
+
+    ~Publication()
+    {
+        aeron_publication_close(m_publication, nullptr, nullptr);
+    }
+
+    inline const std::string channel() const
+    {
+        return m_constants.channel;
+    }
+
+    inline std::int32_t streamId() const
+    {
+        return m_constants.stream_id;
+    }
+
+    inline std::int32_t sessionId() const
+    {
+        return m_constants.session_id;
+    }
+
+    inline std::int64_t registrationId() const
+    {
+        return m_constants.registration_id;
+    }
+
+    inline std::size_t maxPayloadLength() const
+    {
+        return m_constants.max_payload_length;
+    }
+
+    inline bool isConnected() const
+    {
+        return aeron_publication_is_connected(m_publication);
+    }
+
+    inline bool isClosed() const
+    {
+        return aeron_publication_is_closed(m_publication);
+    }
+
+    inline std::int64_t position() const
+    {
+        return aeron_publication_position(m_publication);
+    }
+
+    inline std::int64_t positionLimit() const
+    {
+        return aeron_publication_position_limit(m_publication);
+    }
+
+    inline std::int64_t channelStatus() const
+    {
+        return aeron_publication_channel_status(m_publication);
+    }
+
+    /**
+     * Non-blocking publish of a buffer containing a message.
+     *
+     * @param buffer containing message.
+     * @param length of the message in bytes.
+     * @return The new stream position, otherwise a negative error value such as AERON_PUBLICATION_BACK_PRESSURED.
+     */
+    inline std::int64_t offer(const std::uint8_t *buffer, std::size_t length)
+    {
+        return aeron_publication_offer(m_publication, buffer, length, nullptr, nullptr);
+    }
+
+    /**
+     * Non-blocking publish of a buffer containing a message with the reserved value taken from a supplier.
+     *
+     * @param buffer containing message.
+     * @param length of the message in bytes.
+     * @param supplier callable as int64_t(uint8_t *frameBuffer, size_t frameLength).
+     * @return The new stream position, otherwise a negative error value such as AERON_PUBLICATION_BACK_PRESSURED.
+     */
+    template<typename S>
+    inline std::int64_t offer(const std::uint8_t *buffer, std::size_t length, S &&supplier)
+    {
+        return aeron_publication_offer(
+            m_publication,
+            buffer,
+            length,
+            reservedValueSupplierTrampoline<typename std::remove_reference<S>::type>,
+            (void *)std::addressof(supplier));
+    }
+
+    /**
+     * Try to claim a range in the publication log into which a message can be written with zero copy semantics.
+     * The claim must be completed with aeron_buffer_claim_commit or aeron_buffer_claim_abort.
+     *
+     * @param length of the range to claim in bytes.
+     * @param bufferClaim to be populated if the claim succeeds.
+     * @return The new stream position, otherwise a negative error value such as AERON_PUBLICATION_BACK_PRESSURED.
+     */
+    inline std::int64_t tryClaim(std::size_t length, aeron_buffer_claim_t &bufferClaim)
+    {
+        return aeron_publication_try_claim(m_publication, length, &bufferClaim);
+    }
+
+    /**
+     * Underlying C publication for functions not exposed by this wrapper.
+     *
+     * @return the underlying C publication.
+     */
+    inline aeron_publication_t *publication() const
+    {
+        return m_publication;
+    }
+
+private:
+    aeron_publication_t *m_publication;
+    std::shared_ptr<Aeron> m_aeron;
+    aeron_publication_constants_t m_constants = {};
+
+    template<typename S>
+    static std::int64_t reservedValueSupplierTrampoline(void *clientd, std::uint8_t *buffer, std::size_t frameLength)
+    {
+        return (*static_cast<S *>(clientd))(buffer, frameLength);
+    }
+};
+
+}}
+
+#endif //AERON_WRAPPER_PUBLICATION_H
@@ -0,0 +1,179 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_WRAPPER_SUBSCRIPTION_H
+#define AERON_WRAPPER_SUBSCRIPTION_H
+
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "Exceptions.h"
+
+namespace aeron { namespace wrapper
+{
+
+class Aeron;
+
+/**
+ * Owning handle to an aeron_subscription_t with inline forwarding of the poll paths.
+ * <p>
+ * Handlers are passed to the C client through a trampoline instantiated for their type, so lambdas are called
+ * directly without the allocation or indirection of std::function. Fragment handlers are callable as
+ * void(const uint8_t *buffer, size_t length, aeron_header_t *header) and controlled fragment handlers return an
+ * aeron_controlled_fragment_handler_action_t.
+ * <p>
+ * The handle keeps its {@link Aeron} client open and closes the subscription when destroyed. Subscriptions are not
+ * threadsafe and should not be shared between subscribers.
+ */
+class Subscription
+{
+public:
+    Subscription(aeron_subscription_t *subscription, std::shared_ptr<Aeron> aeron) :
+        m_subscription(subscription),
+        m_aeron(std::move(aeron))
+    {
+        if (aeron_subscription_constants(m_subscription, &m_constants) < 0)
+        {
+            throwLastError();
+        }
+    }
+
+    Subscription(const Subscription &) = delete;
+    Subscription &operator=(const Subscription &) = delete;
+
+    ~Subscription()
+    {
+        aeron_subscription_close(m_subscription, nullptr, nullptr);
+    }
+
+    inline const std::string channel() const
+    {
+        return m_constants.channel;
+    }
+
+    inline std::int32_t streamId() const
+    {
+        return m_constants.stream_id;
+    }
+
+    inline std::int64_t registrationId() const
+    {
+        return m_constants.registration_id;
+    }
+
+    inline bool isConnected() const
+    {
+        return aeron_subscription_is_connected(m_subscription);
+    }
+
+    inline bool isClosed() const
+    {
+        return aeron_subscription_is_closed(m_subscription);
+    }
+
+    inline int imageCount() const
+    {
+        return aeron_subscription_image_count(m_subscription);
+    }
+
+    inline std::int64_t channelStatus() const
+    {
+        return aeron_subscription_channel_status(m_subscription);
+    }
+
+    /**
+     * Poll the images under the subscription for available message fragments.
+     *
+     * @param handler callable as void(const uint8_t *buffer, size_t length, aeron_header_t *header).
+     * @param fragmentLimit number of message fragments to limit when polling across multiple images.
+     * @return the number of fragments received.
+     */
+    template<typename F>
+    inline int poll(F &&handler, int fragmentLimit)
+    {
+        const int fragments = aeron_subscription_poll(
+            m_subscription,
+            fragmentHandlerTrampoline<typename std::remove_reference<F>::type>,
+            (void *)std::addressof(handler),
+            static_cast<std::size_t>(fragmentLimit));
+
+        if (fragments < 0)
+        {
+            throwLastError();
+        }
+
+        return fragments;
+    }
+
+    /**
+     * Poll the images under the subscription for available message fragments with control over the stream position.
+     *
+     * @param handler callable as aeron_controlled_fragment_handler_action_t(
+     *                const uint8_t *buffer, size_t length, aeron_header_t *header).
+     * @param fragmentLimit number of message fragments to limit when polling across multiple images.
+     * @return the number of fragments received.
+     */
+    template<typename F>
+    inline int controlledPoll(F &&handler, int fragmentLimit)
+    {
+        const int fragments = aeron_subscription_controlled_poll(
+            m_subscription,
+            controlledFragmentHandlerTrampoline<typename std::remove_reference<F>::type>,
+            (void *)std::addressof(handler),
+            static_cast<std::size_t>(fragmentLimit));
+
+        if (fragments < 0)
+        {
+            throwLastError();
+        }
+
+        return fragments;
+    }
+
+    /**
+     * Underlying C subscription for functions not exposed by this wrapper.
+     *
+     * @return the underlying C subscription.
+     */
+    inline aeron_subscription_t *subscription() const
+    {
+        return m_subscription;
+    }
+
+private:
+    aeron_subscription_t *m_subscription;
+    std::shared_ptr<Aeron> m_aeron;
+    aeron_subscription_constants_t m_constants = {};
+
+    template<typename F>
+    static void fragmentHandlerTrampoline(
+        void *clientd, const std::uint8_t *buffer, std::size_t length, aeron_header_t *header)
+    {
+        (*static_cast<F *>(clientd))(buffer, length, header);
+    }
+
+    template<typename F>
+    static aeron_controlled_fragment_handler_action_t controlledFragmentHandlerTrampoline(
+        void *clientd, const std::uint8_t *buffer, std::size_t length, aeron_header_t *header)
+    {
+        return (*static_cast<F *>(clientd))(buffer, length, header);
+    }
+};
+
+}}
+
+#endif //AERON_WRAPPER_SUBSCRIPTION_H
@@ -18,6 +18,7 @@
 #include <cstdint>
 #include <thread>
 #include <functional>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -626,6 +627,69 @@ TEST_F(ClientConductorTest, shouldAddPublicationAndHandleOnNewPublication)
     doWork();
 }
 
+TEST_F(ClientConductorTest, shouldAppendMessagesOfConcurrentThreadsThroughCombiningOffer)
+{
+    const int thread_count = 4;
+    const int messages_per_thread = 200;
+    aeron_async_add_publication_t *async = nullptr;
+    aeron_publication_t *publication = nullptr;
+
+    ASSERT_EQ(aeron_client_conductor_async_add_publication(&async, &m_conductor, PUB_URI, STREAM_ID), 0);
+    doWork();
+
+    transmitOnPublicationReady(async, m_logFileName, false);
+    createLogFile(m_logFileName);
+    doWork();
+
+    ASSERT_GT(aeron_async_add_publication_poll(&publication, async), 0) << aeron_errmsg();
+    publication->max_payload_length = 1376;
+    *publication->position_limit = INT64_MAX;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; t++)
+    {
+        threads.emplace_back([=]()
+        {
+            for (int i = 0; i < messages_per_thread; i++)
+            {
+                const int32_t value = (t * messages_per_thread) + i;
+                while (aeron_publication_offer_combining(
+                    publication, reinterpret_cast<const uint8_t *>(&value), sizeof(value)) < 0)
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    const size_t aligned_frame_length = AERON_ALIGN(
+        AERON_DATA_HEADER_LENGTH + sizeof(int32_t), AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    std::vector<bool> seen(thread_count * messages_per_thread, false);
+    aeron_mapped_buffer_t *term_buffer = &publication->log_buffer->mapped_raw_log.term_buffers[0];
+
+    for (size_t offset = 0; offset < seen.size() * aligned_frame_length; offset += aligned_frame_length)
+    {
+        auto header = reinterpret_cast<aeron_data_header_t *>(term_buffer->addr + offset);
+        ASSERT_EQ(header->frame_header.frame_length, (int32_t)(AERON_DATA_HEADER_LENGTH + sizeof(int32_t)));
+        ASSERT_EQ(header->term_offset, (int32_t)offset);
+
+        int32_t value;
+        memcpy(&value, term_buffer->addr + offset + AERON_DATA_HEADER_LENGTH, sizeof(value));
+        ASSERT_FALSE(seen[value]);
+        seen[value] = true;
+    }
+
+    EXPECT_EQ(aeron_publication_position(publication), (int64_t)(seen.size() * aligned_frame_length));
+
+    ASSERT_EQ(aeron_publication_close(publication, nullptr, nullptr), 0);
+    doWork();
+}
+
 TEST_F(ClientConductorTest, shouldAddExclusivePublicationAndHandleOnNewPublication)
 {
     aeron_async_add_exclusive_publication_t *async = nullptr;
@@ -23,6 +23,7 @@ extern "C"
 {
 #include "aeronc.h"
 #include "aeron_image.h"
+#include "aeron_fragment_assembler.h"
 }
 
 #define STREAM_ID (10);
@@ -222,3 +223,92 @@ TEST_F(CFragmentAssemblerTest, shouldNotReassembleIfMissingBegin)
     handle_fragment(handler, msgLength);
     EXPECT_FALSE(called);
 }
+
+TEST_F(CFragmentAssemblerTest, shouldReassembleIntoPooledBuffer)
+{
+    size_t msgLength = MTU_LENGTH - AERON_DATA_HEADER_LENGTH;
+    int calls = 0;
+    auto handler = [&](const uint8_t *buffer, size_t length, aeron_header_t *header)
+    {
+        calls++;
+        EXPECT_EQ(length, msgLength * 2);
+        verifyPayload(buffer, length);
+    };
+
+    aeron_fragment_assembler_delete(m_assembler);
+    ASSERT_EQ(0, aeron_fragment_assembler_create_pooled(&m_assembler, fragment_handler, this, 2 * msgLength, 1));
+
+    for (int i = 0; i < 2; i++)
+    {
+        fillFrame(AERON_DATA_HEADER_BEGIN_FLAG, 0, msgLength, 0);
+        handle_fragment(handler, msgLength);
+        EXPECT_EQ(m_assembler->pool.free_count, 0u);
+
+        fillFrame(AERON_DATA_HEADER_END_FLAG, 0, msgLength, msgLength % 256);
+        handle_fragment(handler, msgLength);
+        EXPECT_EQ(calls, i + 1);
+        EXPECT_EQ(m_assembler->pool.free_count, 1u);
+    }
+}
+
+TEST_F(CFragmentAssemblerTest, shouldDropMessageLongerThanPooledBuffer)
+{
+    size_t msgLength = MTU_LENGTH - AERON_DATA_HEADER_LENGTH;
+    bool called = false;
+    auto handler = [&](const uint8_t *buffer, size_t length, aeron_header_t *header)
+    {
+        called = true;
+    };
+
+    aeron_fragment_assembler_delete(m_assembler);
+    ASSERT_EQ(0, aeron_fragment_assembler_create_pooled(&m_assembler, fragment_handler, this, 2 * msgLength, 1));
+
+    fillFrame(AERON_DATA_HEADER_BEGIN_FLAG, 0, msgLength, 0);
+    handle_fragment(handler, msgLength);
+
+    fillFrame(0, 0, msgLength, msgLength % 256);
+    handle_fragment(handler, msgLength);
+
+    fillFrame(0, 0, msgLength, (msgLength * 2) % 256);
+    handle_fragment(handler, msgLength);
+    EXPECT_EQ(m_assembler->pool.free_count, 1u);
+
+    fillFrame(AERON_DATA_HEADER_END_FLAG, 0, msgLength, (msgLength * 3) % 256);
+    handle_fragment(handler, msgLength);
+    EXPECT_FALSE(called);
+}
+
+static void vectored_fragment_handler(void *clientd, const aeron_iovec_t *iov, size_t iovcnt, aeron_header_t *header)
+{
+    auto *lengths = static_cast<std::vector<size_t> *>(clientd);
+
+    for (size_t i = 0; i < iovcnt; i++)
+    {
+        lengths->push_back(iov[i].iov_len);
+    }
+}
+
+TEST_F(CFragmentAssemblerTest, shouldReassembleFromTwoFragmentsWithoutCopy)
+{
+    size_t msgLength = MTU_LENGTH - AERON_DATA_HEADER_LENGTH;
+    aeron_image_vectored_fragment_assembler_t *assembler = nullptr;
+    std::vector<size_t> lengths;
+
+    ASSERT_EQ(0, aeron_image_vectored_fragment_assembler_create(&assembler, vectored_fragment_handler, &lengths));
+
+    fillFrame(AERON_DATA_HEADER_BEGIN_FLAG, 0, msgLength, 0);
+    m_header.frame = (aeron_data_header_t *)m_fragment.data();
+    aeron_image_vectored_fragment_assembler_handler(
+        assembler, m_fragment.data() + AERON_DATA_HEADER_LENGTH, msgLength, &m_header);
+    EXPECT_TRUE(lengths.empty());
+
+    fillFrame(AERON_DATA_HEADER_END_FLAG, MTU_LENGTH, msgLength, msgLength % 256);
+    m_header.frame = (aeron_data_header_t *)(m_fragment.data() + MTU_LENGTH);
+    aeron_image_vectored_fragment_assembler_handler(
+        assembler, m_fragment.data() + MTU_LENGTH + AERON_DATA_HEADER_LENGTH, msgLength, &m_header);
+    ASSERT_EQ(lengths.size(), 2u);
+    EXPECT_EQ(lengths[0], msgLength);
+    EXPECT_EQ(lengths[1], msgLength);
+
+    aeron_image_vectored_fragment_assembler_delete(assembler);
+}
@@ -18,6 +18,8 @@
 #include <functional>
 #include <string>
 #include <limits>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -26,6 +28,7 @@
 extern "C"
 {
 #include "aeron_image.h"
+#include "aeron_conflating_poller.h"
 #include "concurrent/aeron_term_appender.h"
 }
 
@@ -75,6 +78,7 @@ public:
             nullptr,
             nullptr,
             log_buffer,
+            nullptr,
             SUBSCRIBER_POSITION_ID,
             &m_sub_pos,
             m_correlationId,
@@ -98,12 +102,13 @@ public:
         return m_correlationId++;
     }
 
-    void appendMessage(int64_t position, size_t length)
+    void appendMessage(int64_t position, size_t length, int64_t key = 0)
     {
         aeron_logbuffer_metadata_t *metadata =
             (aeron_logbuffer_metadata_t *)m_image->log_buffer->mapped_raw_log.log_meta_data.addr;
         const size_t index = aeron_logbuffer_index_by_position(position, m_position_bits_to_shift);
-        uint8_t buffer[1024];
+        uint8_t buffer[1024] = {};
+        memcpy(buffer, &key, sizeof(key));
         int32_t term_id = aeron_logbuffer_compute_term_id_from_position(
             position, m_position_bits_to_shift, m_initial_term_id);
         int32_t tail_offset = (int32_t)position & (m_term_length - 1);
@@ -122,6 +127,31 @@ public:
             STREAM_ID);
     }
 
+    void appendFragmentedMessage(int64_t position, size_t length, size_t max_payload_length)
+    {
+        aeron_logbuffer_metadata_t *metadata =
+            (aeron_logbuffer_metadata_t *)m_image->log_buffer->mapped_raw_log.log_meta_data.addr;
+        const size_t index = aeron_logbuffer_index_by_position(position, m_position_bits_to_shift);
+        uint8_t buffer[1024] = {};
+        int32_t term_id = aeron_logbuffer_compute_term_id_from_position(
+            position, m_position_bits_to_shift, m_initial_term_id);
+        int32_t tail_offset = (int32_t)position & (m_term_length - 1);
+
+        metadata->term_tail_counters[index] = static_cast<int64_t>(term_id) << 32 | tail_offset;
+
+        aeron_term_appender_append_fragmented_message(
+            &m_image->log_buffer->mapped_raw_log.term_buffers[index],
+            &metadata->term_tail_counters[index],
+            buffer,
+            length,
+            max_payload_length,
+            nullptr,
+            nullptr,
+            term_id,
+            SESSION_ID,
+            STREAM_ID);
+    }
+
     static void fragment_handler(void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header)
     {
         auto image = reinterpret_cast<ImageTest *>(clientd);
@@ -145,6 +175,14 @@ public:
         return AERON_ACTION_CONTINUE;
     }
 
+    static size_t controlled_block_handler(
+        void *clientd, const uint8_t *buffer, size_t length, int32_t session_id, int32_t term_id)
+    {
+        auto image = reinterpret_cast<ImageTest *>(clientd);
+
+        return image->m_controlled_block_handler(buffer, length, session_id, term_id);
+    }
+
     template<typename F>
     int imagePoll(F &&handler, size_t fragment_limit)
     {
@@ -174,6 +212,13 @@ public:
             m_image, controlled_fragment_handler, this, max_position, fragment_limit);
     }
 
+    template<typename F>
+    int imageControlledBlockPoll(F &&handler, size_t block_length_limit)
+    {
+        m_controlled_block_handler = handler;
+        return aeron_image_controlled_block_poll(m_image, controlled_block_handler, this, block_length_limit);
+    }
+
     const uint8_t *termBuffer(size_t index)
     {
         return m_image->log_buffer->mapped_raw_log.term_buffers[index].addr;
@@ -191,6 +236,7 @@ protected:
     std::function<void(const uint8_t *, size_t, aeron_header_t *)> m_handler = nullptr;
     std::function<aeron_controlled_fragment_handler_action_t(const uint8_t *, size_t, aeron_header_t *)>
         m_controlled_handler = nullptr;
+    std::function<size_t(const uint8_t *, size_t, int32_t, int32_t)> m_controlled_block_handler = nullptr;
 
     aeron_image_t *m_image = nullptr;
     std::string m_filename;
@@ -217,6 +263,178 @@ TEST_F(ImageTest, shouldReadFirstMessage)
     EXPECT_EQ(m_sub_pos, alignedMessageLength);
 }
 
+TEST_F(ImageTest, shouldMapLazyImageOnFirstPoll)
+{
+    const size_t messageLength = 120;
+    const int64_t alignedMessageLength =
+        AERON_ALIGN(messageLength + AERON_DATA_HEADER_LENGTH, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    aeron_client_conductor_t conductor = {};
+    aeron_image_t *lazy_image = nullptr;
+    int64_t lazy_sub_pos = 0;
+    size_t fragments = 0;
+
+    createImage();
+    appendMessage(m_sub_pos, messageLength);
+
+    ASSERT_EQ(aeron_image_create(
+        &lazy_image,
+        nullptr,
+        &conductor,
+        nullptr,
+        m_filename.c_str(),
+        SUBSCRIBER_POSITION_ID,
+        &lazy_sub_pos,
+        m_correlationId,
+        (int32_t)m_correlationId,
+        "none",
+        strlen("none")), 0) << aeron_errmsg();
+    EXPECT_EQ(lazy_image->log_buffer, nullptr);
+
+    m_handler = [&](const uint8_t *buffer, size_t length, aeron_header_t *header)
+    {
+        EXPECT_EQ(length, messageLength);
+        fragments++;
+    };
+
+    EXPECT_EQ(aeron_image_poll(lazy_image, fragment_handler, this, std::numeric_limits<size_t>::max()), 1);
+    EXPECT_NE(lazy_image->log_buffer, nullptr);
+    EXPECT_EQ(fragments, 1u);
+    EXPECT_EQ(lazy_sub_pos, alignedMessageLength);
+
+    aeron_image_delete(lazy_image);
+}
+
+TEST_F(ImageTest, shouldBatchPollMessagesIntoDescriptors)
+{
+    const size_t messageLength = 120;
+    const int64_t alignedMessageLength =
+        AERON_ALIGN(messageLength + AERON_DATA_HEADER_LENGTH, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    aeron_fragment_t fragments[4];
+
+    createImage();
+
+    appendMessage(m_sub_pos, messageLength);
+    appendMessage(m_sub_pos + alignedMessageLength, messageLength);
+    appendMessage(m_sub_pos + (2 * alignedMessageLength), messageLength);
+
+    EXPECT_EQ(aeron_image_batch_poll(m_image, fragments, 2), 2);
+    EXPECT_EQ(m_sub_pos, 2 * alignedMessageLength);
+
+    for (int i = 0; i < 2; i++)
+    {
+        EXPECT_EQ(fragments[i].buffer, termBuffer(0) + (i * alignedMessageLength) + AERON_DATA_HEADER_LENGTH);
+        EXPECT_EQ(fragments[i].length, messageLength);
+        EXPECT_EQ(fragments[i].frame->type, AERON_HDR_TYPE_DATA);
+        EXPECT_EQ(fragments[i].frame->session_id, SESSION_ID);
+        EXPECT_EQ(fragments[i].frame->term_offset, i * alignedMessageLength);
+        EXPECT_EQ(fragments[i].position, (i + 1) * alignedMessageLength);
+    }
+
+    EXPECT_EQ(aeron_image_batch_poll(m_image, fragments, 4), 1);
+    EXPECT_EQ(fragments[0].position, 3 * alignedMessageLength);
+    EXPECT_EQ(m_sub_pos, 3 * alignedMessageLength);
+}
+
+TEST_F(ImageTest, shouldEndControlledBlockOnMessageBoundary)
+{
+    const size_t messageLength = 120;
+    const size_t maxPayloadLength = 128;
+    const int32_t alignedMessageLength =
+        AERON_ALIGN(messageLength + AERON_DATA_HEADER_LENGTH, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    const int32_t alignedFragmentLength =
+        AERON_ALIGN(maxPayloadLength + AERON_DATA_HEADER_LENGTH, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+
+    createImage();
+
+    appendMessage(m_sub_pos, messageLength);
+    appendFragmentedMessage(m_sub_pos + alignedMessageLength, 2 * maxPayloadLength, maxPayloadLength);
+
+    auto handler = [&](const uint8_t *buffer, size_t length, int32_t session_id, int32_t term_id) -> size_t
+    {
+        EXPECT_EQ(session_id, m_image->session_id);
+        EXPECT_EQ(term_id, m_initial_term_id);
+        return length;
+    };
+
+    EXPECT_EQ(imageControlledBlockPoll(handler, alignedMessageLength + alignedFragmentLength), alignedMessageLength);
+    EXPECT_EQ(m_sub_pos, alignedMessageLength);
+
+    EXPECT_EQ(imageControlledBlockPoll(handler, alignedFragmentLength), 2 * alignedFragmentLength);
+    EXPECT_EQ(m_sub_pos, alignedMessageLength + (2 * alignedFragmentLength));
+}
+
+TEST_F(ImageTest, shouldCommitPartOfControlledBlockOnMessageBoundary)
+{
+    const size_t messageLength = 120;
+    const int32_t alignedMessageLength =
+        AERON_ALIGN(messageLength + AERON_DATA_HEADER_LENGTH, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    size_t blockLength = 0;
+
+    createImage();
+
+    appendMessage(m_sub_pos, messageLength);
+    appendMessage(m_sub_pos + alignedMessageLength, messageLength);
+
+    auto partialHandler = [&](const uint8_t *buffer, size_t length, int32_t session_id, int32_t term_id) -> size_t
+    {
+        blockLength = length;
+        return alignedMessageLength + 32;
+    };
+
+    EXPECT_EQ(imageControlledBlockPoll(partialHandler, m_term_length), alignedMessageLength);
+    EXPECT_EQ(blockLength, (size_t)(2 * alignedMessageLength));
+    EXPECT_EQ(m_sub_pos, alignedMessageLength);
+
+    auto abortHandler = [&](const uint8_t *buffer, size_t length, int32_t session_id, int32_t term_id) -> size_t
+    {
+        EXPECT_EQ(buffer, termBuffer(0) + alignedMessageLength);
+        return 0;
+    };
+
+    EXPECT_EQ(imageControlledBlockPoll(abortHandler, m_term_length), 0);
+    EXPECT_EQ(m_sub_pos, alignedMessageLength);
+}
+
+TEST_F(ImageTest, shouldTimeoutWaitingForDataWhenNoneAvailable)
+{
+    createImage();
+
+    EXPECT_EQ(aeron_image_wait_for_data(m_image, 2 * 1000 * 1000), 0);
+    EXPECT_EQ(m_image->metadata->data_waiter_count, 0);
+}
+
+TEST_F(ImageTest, shouldReturnImmediatelyWhenDataAlreadyAvailable)
+{
+    createImage();
+
+    appendMessage(m_sub_pos, 120);
+
+    EXPECT_EQ(aeron_image_wait_for_data(m_image, INT64_MAX / 2), 1);
+}
+
+TEST_F(ImageTest, shouldWakeWaiterWhenDataIsNotified)
+{
+    createImage();
+
+    std::thread publisher(
+        [&]()
+        {
+            int32_t data_waiter_count = 0;
+            while (0 == data_waiter_count)
+            {
+                AERON_GET_VOLATILE(data_waiter_count, m_image->metadata->data_waiter_count);
+                std::this_thread::yield();
+            }
+
+            appendMessage(m_sub_pos, 120);
+            aeron_logbuffer_notify_data(m_image->metadata);
+        });
+
+    EXPECT_EQ(aeron_image_wait_for_data(m_image, 10LL * 1000 * 1000 * 1000), 1);
+    publisher.join();
+    EXPECT_EQ(m_image->metadata->data_waiter_count, 0);
+}
+
 TEST_F(ImageTest, shouldNotReadPastTail)
 {
     createImage();
@@ -824,3 +1042,73 @@ TEST_F(ImageTest, shouldPollFragmentsToBoundedFragmentHandlerWithMaxPositionAbov
     EXPECT_EQ(imageBoundedPoll(handler, maxPosition, std::numeric_limits<size_t>::max()), 1);
     EXPECT_EQ(m_sub_pos, m_term_length);
 }
+
+static bool conflationKey(void *clientd, const uint8_t *buffer, size_t length, int64_t *key)
+{
+    memcpy(key, buffer, sizeof(*key));
+    return true;
+}
+
+static void collectKeys(void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header)
+{
+    int64_t key;
+    memcpy(&key, buffer, sizeof(key));
+    static_cast<std::vector<int64_t> *>(clientd)->push_back(key);
+}
+
+TEST_F(ImageTest, shouldDeliverOnlyLatestMessagePerKeyWhenConflating)
+{
+    const size_t messageLength = 120;
+    const int64_t alignedMessageLength =
+        AERON_ALIGN(messageLength + AERON_DATA_HEADER_LENGTH, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    const int64_t keys[] = { 1, 2, 1, 3, 2, 1 };
+    std::vector<int64_t> delivered;
+    aeron_conflating_poller_t *poller = nullptr;
+
+    createImage();
+
+    for (size_t i = 0; i < sizeof(keys) / sizeof(keys[0]); i++)
+    {
+        appendMessage((int64_t)i * alignedMessageLength, messageLength, keys[i]);
+    }
+
+    ASSERT_EQ(0, aeron_conflating_poller_create(&poller, collectKeys, &delivered, conflationKey, nullptr, 16));
+
+    EXPECT_EQ(3, aeron_conflating_poller_image_poll(poller, m_image));
+    EXPECT_EQ(std::vector<int64_t>({ 3, 2, 1 }), delivered);
+    EXPECT_EQ(m_sub_pos, 6 * alignedMessageLength);
+
+    delivered.clear();
+    EXPECT_EQ(0, aeron_conflating_poller_image_poll(poller, m_image));
+    EXPECT_TRUE(delivered.empty());
+
+    aeron_conflating_poller_delete(poller);
+}
+
+TEST_F(ImageTest, shouldLimitConflationScanToFragmentLimit)
+{
+    const size_t messageLength = 120;
+    const int64_t alignedMessageLength =
+        AERON_ALIGN(messageLength + AERON_DATA_HEADER_LENGTH, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    const int64_t keys[] = { 1, 1, 2, 1 };
+    std::vector<int64_t> delivered;
+    aeron_conflating_poller_t *poller = nullptr;
+
+    createImage();
+
+    for (size_t i = 0; i < sizeof(keys) / sizeof(keys[0]); i++)
+    {
+        appendMessage((int64_t)i * alignedMessageLength, messageLength, keys[i]);
+    }
+
+    ASSERT_EQ(0, aeron_conflating_poller_create(&poller, collectKeys, &delivered, conflationKey, nullptr, 3));
+
+    EXPECT_EQ(2, aeron_conflating_poller_image_poll(poller, m_image));
+    EXPECT_EQ(std::vector<int64_t>({ 1, 2 }), delivered);
+    EXPECT_EQ(m_sub_pos, 3 * alignedMessageLength);
+
+    EXPECT_EQ(1, aeron_conflating_poller_image_poll(poller, m_image));
+    EXPECT_EQ(m_sub_pos, 4 * alignedMessageLength);
+
+    aeron_conflating_poller_delete(poller);
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "aeronc.h"
+#include "aeron_image.h"
+#include "aeron_latency_histogram.h"
+}
+
+class LatencyHistogramTest : public testing::Test
+{
+public:
+    void SetUp() override
+    {
+        ASSERT_EQ(aeron_latency_histogram_create(&m_histogram), 0);
+    }
+
+    void TearDown() override
+    {
+        aeron_latency_histogram_delete(m_histogram);
+    }
+
+protected:
+    aeron_latency_histogram_t *m_histogram = nullptr;
+};
+
+TEST_F(LatencyHistogramTest, shouldReportPercentilesWithinBucketPrecision)
+{
+    for (int64_t i = 1; i <= 1000; i++)
+    {
+        aeron_latency_histogram_record_value(m_histogram, i * 1000);
+    }
+
+    EXPECT_EQ(aeron_latency_histogram_count(m_histogram), 1000);
+    EXPECT_EQ(aeron_latency_histogram_max(m_histogram), 1000 * 1000);
+
+    const int64_t p50 = aeron_latency_histogram_value_at_percentile(m_histogram, 50.0);
+    EXPECT_GE(p50, 500 * 1000);
+    EXPECT_LE(p50, (int64_t)(500 * 1000 * 1.125));
+
+    const int64_t p99 = aeron_latency_histogram_value_at_percentile(m_histogram, 99.0);
+    EXPECT_GE(p99, 990 * 1000);
+    EXPECT_LE(p99, 1000 * 1000);
+
+    EXPECT_EQ(aeron_latency_histogram_value_at_percentile(m_histogram, 100.0), 1000 * 1000);
+}
+
+TEST_F(LatencyHistogramTest, shouldRecordSmallAndNegativeValuesExactly)
+{
+    aeron_latency_histogram_record_value(m_histogram, -5);
+    aeron_latency_histogram_record_value(m_histogram, 3);
+
+    EXPECT_EQ(aeron_latency_histogram_value_at_percentile(m_histogram, 50.0), 0);
+    EXPECT_EQ(aeron_latency_histogram_value_at_percentile(m_histogram, 100.0), 3);
+
+    aeron_latency_histogram_reset(m_histogram);
+    EXPECT_EQ(aeron_latency_histogram_count(m_histogram), 0);
+    EXPECT_EQ(aeron_latency_histogram_value_at_percentile(m_histogram, 99.0), 0);
+}
+
+TEST_F(LatencyHistogramTest, shouldRecordLatencyFromSendTimestamp)
+{
+    aeron_send_timestamp_clock_init();
+
+    aeron_data_header_t frame = {};
+    aeron_header_t header = { &frame, 0, 0 };
+
+    frame.reserved_value = aeron_send_timestamp_reserved_value_supplier(nullptr, nullptr, 0);
+    const int64_t before_ns = aeron_send_timestamp_nano_clock();
+    const int64_t latency_ns = aeron_latency_histogram_record_header(m_histogram, &header);
+
+    EXPECT_GE(latency_ns, before_ns - frame.reserved_value);
+    EXPECT_EQ(aeron_latency_histogram_count(m_histogram), 1);
+}
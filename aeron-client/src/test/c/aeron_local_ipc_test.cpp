@@ -0,0 +1,114 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "aeronc.h"
+#include "aeron_local_ipc.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+}
+
+#define STREAM_ID (1001)
+#define TERM_LENGTH (AERON_LOGBUFFER_TERM_MIN_LENGTH)
+
+class LocalIpcTest : public testing::Test
+{
+public:
+    LocalIpcTest()
+    {
+        if (aeron_local_ipc_init(&m_local_ipc, TERM_LENGTH) < 0)
+        {
+            throw std::runtime_error("could not init local ipc: " + std::string(aeron_errmsg()));
+        }
+    }
+
+    ~LocalIpcTest() override
+    {
+        aeron_local_ipc_close(m_local_ipc);
+    }
+
+    static void onFragment(void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header)
+    {
+        auto received = static_cast<std::vector<int64_t> *>(clientd);
+        int64_t value;
+
+        memcpy(&value, buffer, sizeof(value));
+        received->push_back(value);
+    }
+
+protected:
+    aeron_local_ipc_t *m_local_ipc = nullptr;
+};
+
+TEST_F(LocalIpcTest, shouldNotPublishWithoutSubscription)
+{
+    aeron_publication_t *publication = nullptr;
+    const int64_t value = 1;
+
+    ASSERT_EQ(0, aeron_local_ipc_add_publication(&publication, m_local_ipc, STREAM_ID)) << aeron_errmsg();
+    aeron_local_ipc_do_work(m_local_ipc);
+
+    EXPECT_EQ(AERON_PUBLICATION_NOT_CONNECTED, aeron_publication_offer(
+        publication, reinterpret_cast<const uint8_t *>(&value), sizeof(value), nullptr, nullptr));
+}
+
+TEST_F(LocalIpcTest, shouldExchangeMessagesOverManyTermsWithoutDriver)
+{
+    aeron_publication_t *publication = nullptr;
+    aeron_subscription_t *subscription = nullptr;
+    std::vector<int64_t> received;
+    const int64_t message_count = (TERM_LENGTH / 64) * 5;
+    int64_t next_value = 0;
+
+    ASSERT_EQ(0, aeron_local_ipc_add_publication(&publication, m_local_ipc, STREAM_ID)) << aeron_errmsg();
+    ASSERT_EQ(0, aeron_local_ipc_add_subscription(&subscription, m_local_ipc, STREAM_ID)) << aeron_errmsg();
+
+    EXPECT_EQ(AERON_PUBLICATION_BACK_PRESSURED, aeron_publication_offer(
+        publication, reinterpret_cast<const uint8_t *>(&next_value), sizeof(next_value), nullptr, nullptr));
+
+    while (static_cast<int64_t>(received.size()) < message_count)
+    {
+        aeron_local_ipc_do_work(m_local_ipc);
+
+        while (next_value < message_count)
+        {
+            const int64_t result = aeron_publication_offer(
+                publication, reinterpret_cast<const uint8_t *>(&next_value), sizeof(next_value), nullptr, nullptr);
+
+            if (result < 0)
+            {
+                ASSERT_TRUE(AERON_PUBLICATION_BACK_PRESSURED == result || AERON_PUBLICATION_ADMIN_ACTION == result);
+                break;
+            }
+
+            next_value++;
+        }
+
+        aeron_subscription_poll(subscription, onFragment, &received, 100);
+    }
+
+    for (int64_t i = 0; i < message_count; i++)
+    {
+        ASSERT_EQ(i, received[i]);
+    }
+
+    EXPECT_EQ(aeron_publication_position(publication), message_count * 64);
+}
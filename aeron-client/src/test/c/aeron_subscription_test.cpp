@@ -17,6 +17,8 @@
 #include <exception>
 #include <functional>
 #include <string>
+#include <thread>
+#include <atomic>
 
 #include <gtest/gtest.h>
 
@@ -25,7 +27,10 @@
 extern "C"
 {
 #include "aeron_subscription.h"
+#include "aeron_subscription_group.h"
+#include "aeron_sub_stream_demultiplexer.h"
 #include "aeron_image.h"
+#include "concurrent/aeron_term_appender.h"
 }
 
 #define FILE_PAGE_SIZE (4 * 1024)
@@ -46,6 +51,13 @@ public:
         m_conductor(nullptr),
         m_subscription(createSubscription(m_conductor, &m_channel_status))
     {
+        aeron_epoch_reclaimer_init(&m_reclaimer);
+        if (aeron_epoch_reclaimer_add_participant(&m_reclaimer, &m_subscription->epoch_participant) < 0 ||
+            aeron_epoch_reclaimer_add_shared_participant(
+                &m_reclaimer, &m_subscription->lookup_epoch_participant) < 0)
+        {
+            throw std::runtime_error("could not add participant: " + std::string(aeron_errmsg()));
+        }
     }
 
     ~SubscriptionTest() override
@@ -55,6 +67,8 @@ public:
             aeron_subscription_delete(m_subscription);
         }
 
+        aeron_epoch_reclaimer_close(&m_reclaimer);
+
         std::for_each(m_filenames.begin(), m_filenames.end(),
             [&](std::string &filename)
             {
@@ -103,6 +117,7 @@ public:
             nullptr,
             m_conductor,
             log_buffer,
+            nullptr,
             SUBSCRIBER_POSITION_ID,
             sub_pos,
             m_correlationId,
@@ -119,6 +134,70 @@ public:
         return m_correlationId++;
     }
 
+    static void appendMessages(aeron_image_t *image, size_t count)
+    {
+        aeron_logbuffer_metadata_t *metadata =
+            (aeron_logbuffer_metadata_t *)image->log_buffer->mapped_raw_log.log_meta_data.addr;
+        uint8_t buffer[64] = { 0 };
+
+        for (size_t i = 0; i < count; i++)
+        {
+            aeron_term_appender_append_unfragmented_message(
+                &image->log_buffer->mapped_raw_log.term_buffers[0],
+                &metadata->term_tail_counters[0],
+                buffer,
+                sizeof(buffer),
+                nullptr,
+                nullptr,
+                metadata->initial_term_id,
+                image->session_id,
+                STREAM_ID);
+        }
+    }
+
+    static int64_t sub_stream_reserved_value_supplier(void *clientd, uint8_t *buffer, size_t frame_length)
+    {
+        return *static_cast<int64_t *>(clientd);
+    }
+
+    static void appendSubStreamMessage(aeron_image_t *image, int64_t sub_stream_id)
+    {
+        aeron_logbuffer_metadata_t *metadata =
+            (aeron_logbuffer_metadata_t *)image->log_buffer->mapped_raw_log.log_meta_data.addr;
+        uint8_t buffer[64] = { 0 };
+
+        aeron_term_appender_append_unfragmented_message(
+            &image->log_buffer->mapped_raw_log.term_buffers[0],
+            &metadata->term_tail_counters[0],
+            buffer,
+            sizeof(buffer),
+            sub_stream_reserved_value_supplier,
+            &sub_stream_id,
+            metadata->initial_term_id,
+            image->session_id,
+            STREAM_ID);
+    }
+
+    static void count_by_sub_stream_fragment_handler(
+        void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header)
+    {
+        auto counts = static_cast<std::map<int64_t, size_t> *>(clientd);
+        (*counts)[header->frame->reserved_value]++;
+    }
+
+    static void count_by_session_fragment_handler(
+        void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header)
+    {
+        auto counts = static_cast<std::map<int32_t, size_t> *>(clientd);
+        (*counts)[header->frame->session_id]++;
+    }
+
+    static size_t session_weight(void *clientd, int32_t session_id)
+    {
+        auto weights = static_cast<std::map<int32_t, size_t> *>(clientd);
+        return (*weights)[session_id];
+    }
+
     static void null_fragment_handler(void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header)
     {
     }
@@ -126,6 +205,7 @@ public:
 protected:
     aeron_client_conductor_t *m_conductor = nullptr;
     aeron_subscription_t *m_subscription = nullptr;
+    aeron_epoch_reclaimer_t m_reclaimer = {};
     int64_t m_channel_status = AERON_COUNTER_CHANNEL_ENDPOINT_STATUS_ACTIVE;
     int64_t m_sub_pos = 0;
 
@@ -150,27 +230,112 @@ TEST_F(SubscriptionTest, shouldAddAndRemoveImageWithoutPoll)
     ASSERT_EQ(aeron_client_conductor_subscription_remove_image(m_subscription, image), 0);
     EXPECT_EQ(aeron_subscription_image_count(m_subscription), 0);
 
-    EXPECT_EQ(aeron_client_conductor_subscription_prune_image_lists(m_subscription), 0);
-    EXPECT_TRUE(
-        aeron_image_is_in_use_by_subscription(image, aeron_subscription_last_image_list_change_number(m_subscription)));
+    EXPECT_EQ(aeron_epoch_reclaimer_reclaim(&m_reclaimer), 3);
+    EXPECT_EQ(aeron_image_refcnt_volatile(image), 0);
 
     aeron_log_buffer_delete(image->log_buffer);
     aeron_image_delete(image);
 }
 
-TEST_F(SubscriptionTest, shouldAddAndRemoveImageWithPollAfter)
+TEST_F(SubscriptionTest, shouldNotReclaimImageRemovedDuringPoll)
 {
     int64_t image_id = createImage(&m_sub_pos);
     aeron_image_t *image = m_imageMap.find(image_id)->second;
 
     ASSERT_EQ(aeron_client_conductor_subscription_add_image(m_subscription, image), 0);
+
+    volatile aeron_image_list_t *image_list = aeron_subscription_enter_image_list(m_subscription);
     ASSERT_EQ(aeron_client_conductor_subscription_remove_image(m_subscription, image), 0);
-    ASSERT_EQ(aeron_subscription_poll(m_subscription, null_fragment_handler, this, 1), 0);
 
-    EXPECT_EQ(aeron_subscription_image_count(m_subscription), 0);
-    EXPECT_EQ(aeron_client_conductor_subscription_prune_image_lists(m_subscription), 2);
-    EXPECT_FALSE(
-        aeron_image_is_in_use_by_subscription(image, aeron_subscription_last_image_list_change_number(m_subscription)));
+    EXPECT_EQ(aeron_epoch_reclaimer_reclaim(&m_reclaimer), 1);
+    EXPECT_EQ(image_list->length, 1u);
+    EXPECT_EQ(image_list->array[0], image);
+    EXPECT_EQ(aeron_image_refcnt_volatile(image), 1);
+
+    aeron_subscription_exit_image_list(m_subscription);
+
+    EXPECT_EQ(aeron_epoch_reclaimer_reclaim(&m_reclaimer), 2);
+    EXPECT_EQ(aeron_image_refcnt_volatile(image), 0);
+
+    aeron_log_buffer_delete(image->log_buffer);
+    aeron_image_delete(image);
+}
+
+TEST_F(SubscriptionTest, shouldNotReclaimImageRemovedDuringPollWhenHandlerCountsImages)
+{
+    int64_t image_id = createImage(&m_sub_pos);
+    aeron_image_t *image = m_imageMap.find(image_id)->second;
+
+    ASSERT_EQ(aeron_client_conductor_subscription_add_image(m_subscription, image), 0);
+    aeron_epoch_reclaimer_reclaim(&m_reclaimer);
+    appendMessages(image, 1);
+
+    struct handler_state_stct
+    {
+        aeron_subscription_t *subscription;
+        aeron_image_t *image;
+        aeron_epoch_reclaimer_t *reclaimer;
+        int image_count;
+        int reclaimed;
+    }
+    state = { m_subscription, image, &m_reclaimer, -1, -1 };
+
+    auto handler = [](void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header)
+    {
+        auto *state = static_cast<handler_state_stct *>(clientd);
+
+        state->image_count = aeron_subscription_image_count(state->subscription);
+        aeron_client_conductor_subscription_remove_image(state->subscription, state->image);
+        state->reclaimed = aeron_epoch_reclaimer_reclaim(state->reclaimer);
+    };
+
+    EXPECT_EQ(aeron_subscription_poll(m_subscription, handler, &state, 10), 1);
+    EXPECT_EQ(state.image_count, 1);
+    EXPECT_EQ(state.reclaimed, 0);
+    EXPECT_EQ(aeron_image_refcnt_volatile(image), 1);
+
+    EXPECT_EQ(aeron_epoch_reclaimer_reclaim(&m_reclaimer), 2);
+    EXPECT_EQ(aeron_image_refcnt_volatile(image), 0);
+
+    aeron_log_buffer_delete(image->log_buffer);
+    aeron_image_delete(image);
+}
+
+TEST_F(SubscriptionTest, shouldKeepImageListHeldByPollWhileAnotherThreadLooksUpImages)
+{
+    int64_t image_id = createImage(&m_sub_pos);
+    aeron_image_t *image = m_imageMap.find(image_id)->second;
+
+    ASSERT_EQ(aeron_client_conductor_subscription_add_image(m_subscription, image), 0);
+    aeron_epoch_reclaimer_reclaim(&m_reclaimer);
+
+    aeron_subscription_enter_image_list(m_subscription);
+    const int64_t poll_epoch = m_subscription->epoch_participant.epoch;
+
+    std::atomic<int> lookups_done(0);
+    std::thread lookup_thread(
+        [&]()
+        {
+            for (int i = 0; i < 1000; i++)
+            {
+                aeron_subscription_image_count(m_subscription);
+                aeron_subscription_is_connected(m_subscription);
+            }
+            lookups_done = 1;
+        });
+    lookup_thread.join();
+
+    ASSERT_EQ(lookups_done, 1);
+    EXPECT_EQ(m_subscription->epoch_participant.epoch, poll_epoch);
+    EXPECT_EQ(m_subscription->epoch_participant.depth, 1);
+
+    ASSERT_EQ(aeron_client_conductor_subscription_remove_image(m_subscription, image), 0);
+    EXPECT_EQ(aeron_epoch_reclaimer_reclaim(&m_reclaimer), 0);
+    EXPECT_EQ(aeron_image_refcnt_volatile(image), 1);
+
+    aeron_subscription_exit_image_list(m_subscription);
+    EXPECT_EQ(aeron_epoch_reclaimer_reclaim(&m_reclaimer), 2);
+    EXPECT_EQ(aeron_image_refcnt_volatile(image), 0);
 
     aeron_log_buffer_delete(image->log_buffer);
     aeron_image_delete(image);
@@ -186,17 +351,192 @@ TEST_F(SubscriptionTest, shouldAddAndRemoveImageWithPollBetween)
     ASSERT_EQ(aeron_client_conductor_subscription_remove_image(m_subscription, image), 0);
 
     EXPECT_EQ(aeron_subscription_image_count(m_subscription), 0);
-    EXPECT_EQ(aeron_client_conductor_subscription_prune_image_lists(m_subscription), 1);
-    EXPECT_TRUE(
-        aeron_image_is_in_use_by_subscription(image, aeron_subscription_last_image_list_change_number(m_subscription)));
+    EXPECT_EQ(aeron_epoch_reclaimer_reclaim(&m_reclaimer), 3);
+    EXPECT_EQ(aeron_image_refcnt_volatile(image), 0);
 
     aeron_log_buffer_delete(image->log_buffer);
     aeron_image_delete(image);
 }
 
+TEST_F(SubscriptionTest, shouldShareFragmentLimitByImageWeight)
+{
+    int64_t sub_pos_a = 0, sub_pos_b = 0;
+    aeron_image_t *image_a = m_imageMap.find(createImage(&sub_pos_a))->second;
+    aeron_image_t *image_b = m_imageMap.find(createImage(&sub_pos_b))->second;
+    std::map<int32_t, size_t> weights = { { image_a->session_id, 1 }, { image_b->session_id, 9 } };
+    std::map<int32_t, size_t> counts;
+
+    ASSERT_EQ(aeron_client_conductor_subscription_add_image(m_subscription, image_a), 0);
+    ASSERT_EQ(aeron_client_conductor_subscription_add_image(m_subscription, image_b), 0);
+
+    appendMessages(image_a, 20);
+    appendMessages(image_b, 20);
+
+    ASSERT_EQ(aeron_subscription_weighted_poll(
+        m_subscription, count_by_session_fragment_handler, &counts, session_weight, &weights, 10), 10);
+    EXPECT_EQ(counts[image_a->session_id], 1u);
+    EXPECT_EQ(counts[image_b->session_id], 9u);
+
+    counts.clear();
+    weights[image_b->session_id] = 0;
+
+    ASSERT_EQ(aeron_subscription_weighted_poll(
+        m_subscription, count_by_session_fragment_handler, &counts, session_weight, &weights, 10), 10);
+    EXPECT_EQ(counts[image_a->session_id], 10u);
+    EXPECT_EQ(counts[image_b->session_id], 0u);
+
+    counts.clear();
+
+    ASSERT_EQ(aeron_subscription_weighted_poll(
+        m_subscription, count_by_session_fragment_handler, &counts, session_weight, &weights, 30), 20);
+    EXPECT_EQ(counts[image_a->session_id], 9u);
+    EXPECT_EQ(counts[image_b->session_id], 11u);
+
+    ASSERT_EQ(aeron_client_conductor_subscription_remove_image(m_subscription, image_a), 0);
+    ASSERT_EQ(aeron_client_conductor_subscription_remove_image(m_subscription, image_b), 0);
+    aeron_epoch_reclaimer_reclaim(&m_reclaimer);
+
+    aeron_log_buffer_delete(image_a->log_buffer);
+    aeron_image_delete(image_a);
+    aeron_log_buffer_delete(image_b->log_buffer);
+    aeron_image_delete(image_b);
+}
+
+TEST_F(SubscriptionTest, shouldPollOnlyImagesMarkedReady)
+{
+    int64_t sub_pos_a = 0, sub_pos_b = 0;
+    int64_t readiness = 0;
+    aeron_image_t *image_a = m_imageMap.find(createImage(&sub_pos_a))->second;
+    aeron_image_t *image_b = m_imageMap.find(createImage(&sub_pos_b))->second;
+    std::map<int32_t, size_t> counts;
+
+    ASSERT_EQ(aeron_client_conductor_subscription_add_image(m_subscription, image_a), 0);
+    ASSERT_EQ(aeron_client_conductor_subscription_add_image(m_subscription, image_b), 0);
+    m_subscription->readiness_addr = &readiness;
+    m_subscription->is_readiness_resolved = true;
+
+    appendMessages(image_a, 5);
+    appendMessages(image_b, 5);
+
+    EXPECT_EQ(aeron_subscription_poll_ready(m_subscription, count_by_session_fragment_handler, &counts, 10), 0);
+
+    aeron_counter_set_bits(&readiness, aeron_counter_readiness_bit(image_b->session_id));
+    EXPECT_EQ(aeron_subscription_poll_ready(m_subscription, count_by_session_fragment_handler, &counts, 10), 5);
+    EXPECT_EQ(counts[image_a->session_id], 0u);
+    EXPECT_EQ(counts[image_b->session_id], 5u);
+    EXPECT_EQ(readiness, 0);
+
+    aeron_counter_set_bits(&readiness, aeron_counter_readiness_bit(image_a->session_id));
+    EXPECT_EQ(aeron_subscription_poll_ready(m_subscription, count_by_session_fragment_handler, &counts, 3), 3);
+    EXPECT_EQ(readiness, aeron_counter_readiness_bit(image_a->session_id));
+    EXPECT_EQ(aeron_subscription_poll_ready(m_subscription, count_by_session_fragment_handler, &counts, 10), 2);
+    EXPECT_EQ(counts[image_a->session_id], 5u);
+
+    ASSERT_EQ(aeron_client_conductor_subscription_remove_image(m_subscription, image_a), 0);
+    ASSERT_EQ(aeron_client_conductor_subscription_remove_image(m_subscription, image_b), 0);
+    aeron_epoch_reclaimer_reclaim(&m_reclaimer);
+
+    aeron_log_buffer_delete(image_a->log_buffer);
+    aeron_image_delete(image_a);
+    aeron_log_buffer_delete(image_b->log_buffer);
+    aeron_image_delete(image_b);
+}
+
+TEST_F(SubscriptionTest, shouldShareFragmentLimitAcrossSubscriptionGroupByWeight)
+{
+    int64_t channel_status = AERON_COUNTER_CHANNEL_ENDPOINT_STATUS_ACTIVE;
+    int64_t sub_pos_a = 0, sub_pos_b = 0;
+    aeron_subscription_t *subscription_b = createSubscription(m_conductor, &channel_status);
+    aeron_subscription_group_t *group = nullptr;
+    std::map<int32_t, size_t> counts;
+
+    ASSERT_EQ(aeron_epoch_reclaimer_add_participant(&m_reclaimer, &subscription_b->epoch_participant), 0);
+
+    aeron_image_t *image_a = m_imageMap.find(createImage(&sub_pos_a))->second;
+    aeron_image_t *image_b = m_imageMap.find(createImage(&sub_pos_b))->second;
+    ASSERT_EQ(aeron_client_conductor_subscription_add_image(m_subscription, image_a), 0);
+    ASSERT_EQ(aeron_client_conductor_subscription_add_image(subscription_b, image_b), 0);
+
+    appendMessages(image_a, 20);
+    appendMessages(image_b, 20);
+
+    ASSERT_EQ(aeron_subscription_group_create(&group), 0);
+    ASSERT_EQ(aeron_subscription_group_add(group, m_subscription, 1), 0);
+    ASSERT_EQ(aeron_subscription_group_add(group, subscription_b, 3), 0);
+    EXPECT_EQ(aeron_subscription_group_add(group, subscription_b, 1), -1);
+
+    ASSERT_EQ(aeron_subscription_group_poll(group, count_by_session_fragment_handler, &counts, 8), 8);
+    EXPECT_EQ(counts[image_a->session_id], 2u);
+    EXPECT_EQ(counts[image_b->session_id], 6u);
+
+    counts.clear();
+    EXPECT_EQ(aeron_subscription_group_remove(group, subscription_b), 1);
+    EXPECT_EQ(aeron_subscription_group_remove(group, subscription_b), 0);
+
+    ASSERT_EQ(aeron_subscription_group_poll(group, count_by_session_fragment_handler, &counts, 30), 18);
+    EXPECT_EQ(counts[image_a->session_id], 18u);
+    EXPECT_EQ(counts[image_b->session_id], 0u);
+
+    EXPECT_EQ(aeron_subscription_group_delete(group), 0);
+
+    ASSERT_EQ(aeron_client_conductor_subscription_remove_image(m_subscription, image_a), 0);
+    ASSERT_EQ(aeron_client_conductor_subscription_remove_image(subscription_b, image_b), 0);
+    aeron_epoch_reclaimer_reclaim(&m_reclaimer);
+
+    aeron_log_buffer_delete(image_a->log_buffer);
+    aeron_image_delete(image_a);
+    aeron_log_buffer_delete(image_b->log_buffer);
+    aeron_image_delete(image_b);
+    aeron_subscription_delete(subscription_b);
+}
+
 TEST_F(SubscriptionTest, shouldFetchConstants)
 {
     aeron_subscription_constants_t constants;
     ASSERT_EQ(0, aeron_subscription_constants(m_subscription, &constants));
     ASSERT_NE(0, constants.channel_status_indicator_id);
 }
+
+TEST_F(SubscriptionTest, shouldDemultiplexSubStreamsOfOneImage)
+{
+    int64_t sub_pos = 0;
+    aeron_image_t *image = m_imageMap.find(createImage(&sub_pos))->second;
+    aeron_sub_stream_demultiplexer_t *demultiplexer = nullptr;
+    std::map<int64_t, size_t> counts_a, counts_b, default_counts;
+
+    ASSERT_EQ(aeron_client_conductor_subscription_add_image(m_subscription, image), 0);
+
+    const int64_t sub_stream_ids[] = { 1, 1, 2, 3, 1, 2, 2, 3 };
+    for (int64_t sub_stream_id : sub_stream_ids)
+    {
+        appendSubStreamMessage(image, sub_stream_id);
+    }
+
+    ASSERT_EQ(aeron_sub_stream_demultiplexer_create(&demultiplexer, nullptr, nullptr), 0);
+    ASSERT_EQ(aeron_sub_stream_demultiplexer_add(demultiplexer, 1, count_by_sub_stream_fragment_handler, &counts_a), 0);
+    ASSERT_EQ(aeron_sub_stream_demultiplexer_add(demultiplexer, 2, count_by_sub_stream_fragment_handler, &counts_b), 0);
+
+    EXPECT_EQ(aeron_subscription_poll(m_subscription, aeron_sub_stream_demultiplexer_handler, demultiplexer, 4), 4);
+    EXPECT_EQ(counts_a[1], 2u);
+    EXPECT_EQ(counts_b[2], 1u);
+
+    EXPECT_EQ(aeron_sub_stream_demultiplexer_remove(demultiplexer, 1), 1);
+    EXPECT_EQ(aeron_sub_stream_demultiplexer_remove(demultiplexer, 1), 0);
+    demultiplexer->default_handler.handler = count_by_sub_stream_fragment_handler;
+    demultiplexer->default_handler.clientd = &default_counts;
+
+    EXPECT_EQ(aeron_subscription_poll(m_subscription, aeron_sub_stream_demultiplexer_handler, demultiplexer, 10), 4);
+    EXPECT_EQ(counts_a.size(), 1u);
+    EXPECT_EQ(counts_a[1], 2u);
+    EXPECT_EQ(counts_b[2], 3u);
+    EXPECT_EQ(default_counts[1], 1u);
+    EXPECT_EQ(default_counts[3], 1u);
+
+    EXPECT_EQ(aeron_sub_stream_demultiplexer_delete(demultiplexer), 0);
+
+    ASSERT_EQ(aeron_client_conductor_subscription_remove_image(m_subscription, image), 0);
+    aeron_epoch_reclaimer_reclaim(&m_reclaimer);
+
+    aeron_log_buffer_delete(image->log_buffer);
+    aeron_image_delete(image);
+}
@@ -16,6 +16,7 @@
 
 #include <array>
 #include <cstdint>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -264,3 +265,173 @@ TEST_F(BroadcastReceiverTest, shouldDealWithRecordBecomingInvalidDueToOverwrite)
 
     EXPECT_FALSE(aeron_broadcast_receiver_validate(&receiver));
 }
+
+static void count_batch_records(int32_t type_id, uint8_t *buffer, size_t length, void *clientd)
+{
+    auto *received = static_cast<std::vector<std::pair<int32_t, uint8_t>> *>(clientd);
+    received->emplace_back(type_id, buffer[0]);
+}
+
+TEST_F(BroadcastReceiverTest, shouldReceiveBatchOfMessages)
+{
+    aeron_broadcast_receiver_t receiver;
+    size_t length = 8;
+    size_t record_length = length + AERON_BROADCAST_RECORD_HEADER_LENGTH;
+    size_t aligned_record_length = AERON_ALIGN(record_length, AERON_BROADCAST_RECORD_ALIGNMENT);
+    size_t tail = aligned_record_length * 3;
+    std::vector<std::pair<int32_t, uint8_t>> received;
+
+    ASSERT_EQ(aeron_broadcast_receiver_init(&receiver, m_buffer.data(), m_buffer.size()), 0);
+
+    receiver.descriptor->tail_counter = tail;
+    receiver.descriptor->tail_intent_counter = tail;
+
+    for (size_t i = 0; i < 3; i++)
+    {
+        aeron_broadcast_record_descriptor_t *record =
+            (aeron_broadcast_record_descriptor_t *)(m_buffer.data() + (i * aligned_record_length));
+
+        record->length = (std::int32_t)record_length;
+        record->msg_type_id = (std::int32_t)(MSG_TYPE_ID + i);
+        m_buffer[(i * aligned_record_length) + AERON_BROADCAST_RECORD_HEADER_LENGTH] = (uint8_t)i;
+    }
+
+    EXPECT_EQ(aeron_broadcast_receiver_receive_batch(&receiver, count_batch_records, &received), 3);
+    ASSERT_EQ(received.size(), 3u);
+
+    for (size_t i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(received[i].first, (std::int32_t)(MSG_TYPE_ID + i));
+        EXPECT_EQ(received[i].second, (uint8_t)i);
+    }
+
+    EXPECT_EQ(receiver.next_record, (int64_t)tail);
+    EXPECT_EQ(aeron_broadcast_receiver_receive_batch(&receiver, count_batch_records, &received), 0);
+}
+
+TEST_F(BroadcastReceiverTest, shouldReceiveBatchAcrossPaddingRecord)
+{
+    aeron_broadcast_receiver_t receiver;
+    size_t length = 120;
+    size_t record_length = length + AERON_BROADCAST_RECORD_HEADER_LENGTH;
+    size_t aligned_record_length = AERON_ALIGN(record_length, AERON_BROADCAST_RECORD_ALIGNMENT);
+    size_t catchup_tail = (CAPACITY * 2) - AERON_BROADCAST_RECORD_HEADER_LENGTH;
+    size_t post_padding_tail = catchup_tail + AERON_BROADCAST_RECORD_HEADER_LENGTH + aligned_record_length;
+    size_t latest_record = catchup_tail - aligned_record_length;
+    std::vector<std::pair<int32_t, uint8_t>> received;
+
+    ASSERT_EQ(aeron_broadcast_receiver_init(&receiver, m_buffer.data(), m_buffer.size()), 0);
+
+    receiver.descriptor->tail_counter = post_padding_tail;
+    receiver.descriptor->tail_intent_counter = post_padding_tail;
+    receiver.descriptor->latest_counter = latest_record;
+    receiver.next_record = (int64_t)latest_record;
+
+    aeron_broadcast_record_descriptor_t *record =
+        (aeron_broadcast_record_descriptor_t *)(m_buffer.data() + (latest_record & (CAPACITY - 1)));
+    record->length = (std::int32_t)record_length;
+    record->msg_type_id = MSG_TYPE_ID;
+
+    record = (aeron_broadcast_record_descriptor_t *)(m_buffer.data() + (catchup_tail & (CAPACITY - 1)));
+    record->length = AERON_BROADCAST_RECORD_HEADER_LENGTH;
+    record->msg_type_id = AERON_BROADCAST_PADDING_MSG_TYPE_ID;
+
+    record = (aeron_broadcast_record_descriptor_t *)(m_buffer.data());
+    record->length = (std::int32_t)record_length;
+    record->msg_type_id = MSG_TYPE_ID;
+    m_buffer[AERON_BROADCAST_RECORD_HEADER_LENGTH] = 7;
+
+    EXPECT_EQ(aeron_broadcast_receiver_receive_batch(&receiver, count_batch_records, &received), 2);
+    ASSERT_EQ(received.size(), 2u);
+    EXPECT_EQ(received[1].second, 7);
+    EXPECT_EQ(receiver.next_record, (int64_t)post_padding_tail);
+}
+
+struct overwrite_during_batch_state
+{
+    aeron_broadcast_receiver_t *receiver;
+    int dispatched;
+};
+
+static void overwrite_during_batch(int32_t type_id, uint8_t *buffer, size_t length, void *clientd)
+{
+    auto *state = static_cast<overwrite_during_batch_state *>(clientd);
+    state->receiver->descriptor->tail_intent_counter += CAPACITY;
+    state->dispatched++;
+}
+
+TEST_F(BroadcastReceiverTest, shouldNotDispatchRestOfBatchWhenOverwrittenDuringDispatch)
+{
+    aeron_broadcast_receiver_t receiver;
+    size_t length = 8;
+    size_t record_length = length + AERON_BROADCAST_RECORD_HEADER_LENGTH;
+    size_t aligned_record_length = AERON_ALIGN(record_length, AERON_BROADCAST_RECORD_ALIGNMENT);
+    size_t tail = aligned_record_length * 2;
+
+    ASSERT_EQ(aeron_broadcast_receiver_init(&receiver, m_buffer.data(), m_buffer.size()), 0);
+
+    receiver.descriptor->tail_counter = tail;
+    receiver.descriptor->tail_intent_counter = tail;
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        aeron_broadcast_record_descriptor_t *record =
+            (aeron_broadcast_record_descriptor_t *)(m_buffer.data() + (i * aligned_record_length));
+
+        record->length = (std::int32_t)record_length;
+        record->msg_type_id = MSG_TYPE_ID;
+    }
+
+    overwrite_during_batch_state state = { &receiver, 0 };
+
+    EXPECT_EQ(aeron_broadcast_receiver_receive_batch(&receiver, overwrite_during_batch, &state), -1);
+    EXPECT_EQ(state.dispatched, 1);
+    EXPECT_GT(receiver.lapped_count, 0);
+}
+
+TEST_F(BroadcastReceiverTest, shouldErrorReceiveBatchOnInvalidRecordLength)
+{
+    aeron_broadcast_receiver_t receiver;
+    size_t length = 8;
+    size_t record_length = length + AERON_BROADCAST_RECORD_HEADER_LENGTH;
+    size_t aligned_record_length = AERON_ALIGN(record_length, AERON_BROADCAST_RECORD_ALIGNMENT);
+    size_t tail = aligned_record_length;
+    std::vector<std::pair<int32_t, uint8_t>> received;
+
+    ASSERT_EQ(aeron_broadcast_receiver_init(&receiver, m_buffer.data(), m_buffer.size()), 0);
+
+    receiver.descriptor->tail_counter = tail;
+    receiver.descriptor->tail_intent_counter = tail;
+
+    aeron_broadcast_record_descriptor_t *record = (aeron_broadcast_record_descriptor_t *)(m_buffer.data());
+    record->length = 0;
+    record->msg_type_id = MSG_TYPE_ID;
+
+    EXPECT_EQ(aeron_broadcast_receiver_receive_batch(&receiver, count_batch_records, &received), -1);
+
+    record->length = (std::int32_t)(CAPACITY + 1);
+
+    EXPECT_EQ(aeron_broadcast_receiver_receive_batch(&receiver, count_batch_records, &received), -1);
+    EXPECT_TRUE(received.empty());
+}
+
+TEST_F(BroadcastReceiverTest, shouldErrorReceiveBatchWhenLapped)
+{
+    aeron_broadcast_receiver_t receiver;
+    size_t length = 8;
+    size_t record_length = length + AERON_BROADCAST_RECORD_HEADER_LENGTH;
+    size_t aligned_record_length = AERON_ALIGN(record_length, AERON_BROADCAST_RECORD_ALIGNMENT);
+    size_t tail = CAPACITY * 3 + aligned_record_length;
+    std::vector<std::pair<int32_t, uint8_t>> received;
+
+    ASSERT_EQ(aeron_broadcast_receiver_init(&receiver, m_buffer.data(), m_buffer.size()), 0);
+
+    receiver.descriptor->tail_counter = tail;
+    receiver.descriptor->tail_intent_counter = tail;
+    receiver.descriptor->latest_counter = tail - aligned_record_length;
+
+    EXPECT_EQ(aeron_broadcast_receiver_receive_batch(&receiver, count_batch_records, &received), -1);
+    EXPECT_TRUE(received.empty());
+    EXPECT_GT(receiver.lapped_count, 0);
+    EXPECT_EQ(receiver.next_record, (int64_t)(tail - aligned_record_length));
+}
@@ -16,6 +16,7 @@
 
 #include <array>
 #include <cstdint>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -177,4 +178,70 @@ TEST_F(CountersTest, shouldResetValueAndRegistrationIdIfReused)
     aeron_counters_manager_counter_registration_id(&m_manager, id_two, expected_registration_id_two);
     EXPECT_EQ(0, aeron_counters_reader_counter_registration_id(&m_reader, id_two, &registration_id_two));
     EXPECT_EQ(expected_registration_id_two, registration_id_two);
-}
\ No newline at end of file
+}
+TEST_F(CountersTest, shouldSumStripesIntoAggregatedValue)
+{
+    int32_t aggregate_id = aeron_counters_manager_allocate(&m_manager, 0, nullptr, 0, nullptr, 0);
+    int32_t other_id = aeron_counters_manager_allocate(&m_manager, 0, nullptr, 0, nullptr, 0);
+    aeron_counter_stripe_key_layout_t key = { aggregate_id, 1 };
+    int32_t stripe_id = aeron_counters_manager_allocate(
+        &m_manager, AERON_COUNTER_STRIPE_TYPE_ID, (const uint8_t *)&key, sizeof(key), nullptr, 0);
+    key.writer_id = 2;
+    int32_t other_stripe_id = aeron_counters_manager_allocate(
+        &m_manager, AERON_COUNTER_STRIPE_TYPE_ID, (const uint8_t *)&key, sizeof(key), nullptr, 0);
+
+    aeron_counter_set_ordered(aeron_counters_manager_addr(&m_manager, aggregate_id), 1);
+    aeron_counter_set_ordered(aeron_counters_manager_addr(&m_manager, other_id), 10);
+    aeron_counter_set_ordered(aeron_counters_manager_addr(&m_manager, stripe_id), 100);
+    aeron_counter_set_ordered(aeron_counters_manager_addr(&m_manager, other_stripe_id), 1000);
+
+    int64_t value = 0;
+    EXPECT_EQ(0, aeron_counters_reader_aggregated_value(&m_reader, aggregate_id, &value));
+    EXPECT_EQ(1101, value);
+    EXPECT_EQ(0, aeron_counters_reader_aggregated_value(&m_reader, other_id, &value));
+    EXPECT_EQ(10, value);
+
+    aeron_counters_manager_free(&m_manager, other_stripe_id);
+    EXPECT_EQ(0, aeron_counters_reader_aggregated_value(&m_reader, aggregate_id, &value));
+    EXPECT_EQ(101, value);
+}
+
+TEST_F(CountersTest, shouldAllocateAndReadCompactCounters)
+{
+    const int32_t compactCapacity = 2;
+    std::vector<std::uint8_t> compactBuffer(AERON_COUNTERS_COMPACT_BUFFER_LENGTH(compactCapacity), 0);
+    const char *label = "compact label";
+    const int64_t registrationId = 777;
+
+    ASSERT_EQ(0, aeron_counters_compact_region_format(
+        compactBuffer.data(), compactBuffer.size(), m_valuesBuffer.size(), compactCapacity));
+    ASSERT_EQ(0, aeron_counters_manager_init_compact(&m_manager, compactBuffer.data(), compactBuffer.size()));
+    ASSERT_EQ(0, aeron_counters_reader_init_compact(&m_reader, compactBuffer.data(), compactBuffer.size()));
+
+    int32_t id = aeron_counters_manager_allocate_compact(&m_manager, 1234, nullptr, 0, label, strlen(label));
+    EXPECT_EQ(m_reader.max_counter_id, id);
+
+    aeron_counters_manager_counter_registration_id(&m_manager, id, registrationId);
+    aeron_counter_set_ordered(aeron_counters_manager_addr(&m_manager, id), 42);
+
+    int32_t state;
+    int64_t readRegistrationId;
+    char buffer[AERON_COUNTERS_MANAGER_METADATA_LENGTH] = {};
+
+    EXPECT_EQ(42, aeron_counter_get_volatile(aeron_counters_reader_addr(&m_reader, id)));
+    EXPECT_EQ(0, aeron_counters_reader_counter_state(&m_reader, id, &state));
+    EXPECT_EQ(AERON_COUNTER_RECORD_ALLOCATED, state);
+    EXPECT_EQ(0, aeron_counters_reader_counter_registration_id(&m_reader, id, &readRegistrationId));
+    EXPECT_EQ(registrationId, readRegistrationId);
+    EXPECT_EQ(
+        (int32_t)strlen(label),
+        aeron_counters_reader_counter_label(&m_reader, id, buffer, sizeof(buffer)));
+    EXPECT_STREQ(label, buffer);
+
+    EXPECT_EQ(id + 1, aeron_counters_manager_allocate_compact(&m_manager, 1234, nullptr, 0, label, strlen(label)));
+    EXPECT_EQ(0, aeron_counters_manager_allocate_compact(&m_manager, 1234, nullptr, 0, label, strlen(label)));
+
+    aeron_counters_manager_free(&m_manager, id);
+    EXPECT_EQ(0, aeron_counters_reader_counter_state(&m_reader, id, &state));
+    EXPECT_EQ(AERON_COUNTER_RECORD_RECLAIMED, state);
+}
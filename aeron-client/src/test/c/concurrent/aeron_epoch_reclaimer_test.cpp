@@ -0,0 +1,178 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "concurrent/aeron_epoch_reclaimer.h"
+}
+
+class EpochReclaimerTest : public testing::Test
+{
+public:
+    void SetUp() override
+    {
+        ASSERT_EQ(0, aeron_epoch_reclaimer_init(&m_reclaimer));
+        aeron_epoch_participant_init(&m_participant_a);
+        aeron_epoch_participant_init(&m_participant_b);
+        ASSERT_EQ(0, aeron_epoch_reclaimer_add_participant(&m_reclaimer, &m_participant_a));
+        ASSERT_EQ(0, aeron_epoch_reclaimer_add_participant(&m_reclaimer, &m_participant_b));
+    }
+
+    void TearDown() override
+    {
+        aeron_epoch_reclaimer_close(&m_reclaimer);
+    }
+
+    void retire(int *item)
+    {
+        ASSERT_EQ(0, aeron_epoch_reclaimer_reserve(&m_reclaimer, 1));
+        aeron_epoch_reclaimer_retire(&m_reclaimer, item, EpochReclaimerTest::onReclaim, this);
+    }
+
+    static void onReclaim(void *clientd, void *item)
+    {
+        static_cast<EpochReclaimerTest *>(clientd)->m_reclaimed.push_back(static_cast<int *>(item));
+    }
+
+protected:
+    aeron_epoch_reclaimer_t m_reclaimer = {};
+    aeron_epoch_participant_t m_participant_a = {};
+    aeron_epoch_participant_t m_participant_b = {};
+    std::vector<int *> m_reclaimed;
+    int m_items[4] = { 0, 1, 2, 3 };
+};
+
+TEST_F(EpochReclaimerTest, shouldReclaimImmediatelyWhenNoParticipantIsEntered)
+{
+    retire(&m_items[0]);
+    retire(&m_items[1]);
+
+    EXPECT_EQ(2, aeron_epoch_reclaimer_reclaim(&m_reclaimer));
+    ASSERT_EQ(2u, m_reclaimed.size());
+    EXPECT_EQ(0, aeron_epoch_reclaimer_reclaim(&m_reclaimer));
+}
+
+TEST_F(EpochReclaimerTest, shouldHoldItemsRetiredAfterParticipantEntered)
+{
+    retire(&m_items[0]);
+    aeron_epoch_participant_enter(&m_participant_a);
+    retire(&m_items[1]);
+    retire(&m_items[2]);
+
+    EXPECT_EQ(1, aeron_epoch_reclaimer_reclaim(&m_reclaimer));
+    ASSERT_EQ(1u, m_reclaimed.size());
+    EXPECT_EQ(&m_items[0], m_reclaimed[0]);
+
+    aeron_epoch_participant_enter(&m_participant_b);
+    retire(&m_items[3]);
+    aeron_epoch_participant_exit(&m_participant_a);
+
+    EXPECT_EQ(2, aeron_epoch_reclaimer_reclaim(&m_reclaimer));
+    EXPECT_EQ(3u, m_reclaimed.size());
+
+    aeron_epoch_participant_exit(&m_participant_b);
+
+    EXPECT_EQ(1, aeron_epoch_reclaimer_reclaim(&m_reclaimer));
+    EXPECT_EQ(4u, m_reclaimed.size());
+}
+
+TEST_F(EpochReclaimerTest, shouldIgnoreRemovedParticipant)
+{
+    aeron_epoch_participant_enter(&m_participant_a);
+    retire(&m_items[0]);
+
+    EXPECT_EQ(0, aeron_epoch_reclaimer_reclaim(&m_reclaimer));
+
+    aeron_epoch_reclaimer_remove_participant(&m_reclaimer, &m_participant_a);
+
+    EXPECT_EQ(nullptr, m_participant_a.reclaimer);
+    EXPECT_EQ(1, aeron_epoch_reclaimer_reclaim(&m_reclaimer));
+}
+
+TEST_F(EpochReclaimerTest, shouldReclaimInBatchesOnRetire)
+{
+    std::vector<int> items(AERON_EPOCH_RECLAIMER_BATCH_SIZE);
+
+    for (size_t i = 0; i < items.size(); i++)
+    {
+        retire(&items[i]);
+    }
+
+    EXPECT_EQ(items.size(), m_reclaimed.size());
+    EXPECT_EQ(0u, m_reclaimer.retired.length);
+}
+
+TEST_F(EpochReclaimerTest, shouldReclaimAllOnClose)
+{
+    aeron_epoch_participant_enter(&m_participant_a);
+    retire(&m_items[0]);
+    retire(&m_items[1]);
+
+    aeron_epoch_reclaimer_close(&m_reclaimer);
+
+    EXPECT_EQ(2u, m_reclaimed.size());
+    EXPECT_EQ(nullptr, m_participant_a.reclaimer);
+    EXPECT_EQ(nullptr, m_participant_b.reclaimer);
+}
+
+TEST_F(EpochReclaimerTest, shouldNeverReclaimItemInUseByConcurrentReader)
+{
+    const int iterations = 100000;
+    std::atomic<int *> shared(new int(0));
+    std::atomic<bool> running(true);
+    std::atomic<int> reclaimed_count(0);
+
+    std::thread reader(
+        [&]()
+        {
+            while (running)
+            {
+                aeron_epoch_participant_enter(&m_participant_a);
+                int *value = shared.load(std::memory_order_acquire);
+                EXPECT_GE(*value, 0);
+                aeron_epoch_participant_exit(&m_participant_a);
+            }
+        });
+
+    auto free_int = [](void *clientd, void *item)
+    {
+        int *value = static_cast<int *>(item);
+        *value = -1;
+        delete value;
+        static_cast<std::atomic<int> *>(clientd)->fetch_add(1);
+    };
+
+    for (int i = 1; i <= iterations; i++)
+    {
+        int *old_value = shared.exchange(new int(i), std::memory_order_acq_rel);
+        ASSERT_EQ(0, aeron_epoch_reclaimer_reserve(&m_reclaimer, 1));
+        aeron_epoch_reclaimer_retire(&m_reclaimer, old_value, free_int, &reclaimed_count);
+    }
+
+    running = false;
+    reader.join();
+
+    aeron_epoch_reclaimer_reclaim(&m_reclaimer);
+    EXPECT_EQ(iterations, reclaimed_count.load());
+
+    delete shared.load();
+}
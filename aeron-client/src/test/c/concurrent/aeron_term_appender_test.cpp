@@ -190,6 +190,156 @@ TEST_F(CTermAppenderTest, shouldPadLogWhenAppendingWithInsufficientRemainingCapa
     EXPECT_EQ(data_header->frame_header.type, AERON_HDR_TYPE_PAD);
 }
 
+TEST_F(CTermAppenderTest, shouldAppendBatchWithSingleTailClaim)
+{
+    uint8_t msgBuffer[SRC_BUFFER_CAPACITY] = {};
+    aeron_iovec_t messages[3] = { { msgBuffer, 20 }, { msgBuffer, 100 }, { msgBuffer, 0 } };
+    size_t batchLength = 0;
+    size_t appendedCount = 0;
+    int32_t tail = 0;
+
+    for (auto &message : messages)
+    {
+        batchLength += AERON_ALIGN(message.iov_len + AERON_DATA_HEADER_LENGTH, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    }
+
+    *m_term_tail_counter = packRawTail(TERM_ID, tail);
+
+    const int32_t resultingOffset = aeron_term_appender_append_unfragmented_batch(
+        &m_term_buffer,
+        m_term_tail_counter,
+        messages,
+        3,
+        batchLength,
+        &appendedCount,
+        reserved_value_supplier,
+        nullptr,
+        TERM_ID,
+        SESSION_ID,
+        STREAM_ID);
+
+    EXPECT_EQ(resultingOffset, (int32_t)batchLength);
+    EXPECT_EQ(appendedCount, 3u);
+    EXPECT_EQ(*m_term_tail_counter, packRawTail(TERM_ID, tail + (int32_t)batchLength));
+
+    for (auto &message : messages)
+    {
+        aeron_data_header_t *data_header = (aeron_data_header_t *)(m_logBuffer.data() + tail);
+
+        EXPECT_EQ(data_header->frame_header.frame_length, (int32_t)(message.iov_len + AERON_DATA_HEADER_LENGTH));
+        EXPECT_EQ(data_header->term_offset, tail);
+        EXPECT_EQ(data_header->reserved_value, RESERVED_VALUE);
+        tail += AERON_ALIGN(message.iov_len + AERON_DATA_HEADER_LENGTH, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    }
+}
+
+TEST_F(CTermAppenderTest, shouldAppendPartOfBatchThatFitsAndPadRestOfTerm)
+{
+    uint8_t msgBuffer[SRC_BUFFER_CAPACITY] = {};
+    aeron_iovec_t messages[2] = { { msgBuffer, 32 }, { msgBuffer, 120 } };
+    const int32_t firstFrameLength = 32 + AERON_DATA_HEADER_LENGTH;
+    const size_t batchLength = firstFrameLength +
+        AERON_ALIGN(120 + AERON_DATA_HEADER_LENGTH, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    const int32_t tailValue = TERM_BUFFER_CAPACITY - (2 * firstFrameLength);
+    size_t appendedCount = 0;
+
+    *m_term_tail_counter = packRawTail(TERM_ID, tailValue);
+
+    const int32_t resultingOffset = aeron_term_appender_append_unfragmented_batch(
+        &m_term_buffer,
+        m_term_tail_counter,
+        messages,
+        2,
+        batchLength,
+        &appendedCount,
+        reserved_value_supplier,
+        nullptr,
+        TERM_ID,
+        SESSION_ID,
+        STREAM_ID);
+
+    EXPECT_EQ(resultingOffset, AERON_TERM_APPENDER_FAILED);
+    EXPECT_EQ(appendedCount, 1u);
+    EXPECT_EQ(*m_term_tail_counter, packRawTail(TERM_ID, tailValue + (int32_t)batchLength));
+
+    aeron_data_header_t *data_header = (aeron_data_header_t *)(m_logBuffer.data() + tailValue);
+    EXPECT_EQ(data_header->frame_header.frame_length, firstFrameLength);
+    EXPECT_EQ(data_header->frame_header.type, AERON_HDR_TYPE_DATA);
+
+    data_header = (aeron_data_header_t *)(m_logBuffer.data() + tailValue + firstFrameLength);
+    EXPECT_EQ(data_header->frame_header.frame_length, firstFrameLength);
+    EXPECT_EQ(data_header->frame_header.type, AERON_HDR_TYPE_PAD);
+}
+
+TEST_F(CTermAppenderTest, shouldAppendBlockAndRewriteFrameHeaders)
+{
+    uint8_t block[256] = {};
+    const int32_t firstFrameLength = AERON_DATA_HEADER_LENGTH + 40;
+    const int32_t firstAlignedLength = AERON_ALIGN(firstFrameLength, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    const int32_t secondFrameLength = AERON_DATA_HEADER_LENGTH + 8;
+    const size_t blockLength = firstAlignedLength + AERON_ALIGN(secondFrameLength, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    const int32_t tail = 128;
+
+    aeron_data_header_t *src_header = (aeron_data_header_t *)block;
+    src_header->frame_header.frame_length = firstFrameLength;
+    src_header->frame_header.type = AERON_HDR_TYPE_DATA;
+    src_header->frame_header.flags = AERON_DATA_HEADER_BEGIN_FLAG;
+    src_header->session_id = SESSION_ID + 1;
+    src_header->stream_id = STREAM_ID + 1;
+    src_header->term_id = TERM_ID + 7;
+    src_header = (aeron_data_header_t *)(block + firstAlignedLength);
+    src_header->frame_header.frame_length = secondFrameLength;
+    src_header->frame_header.type = AERON_HDR_TYPE_DATA;
+    src_header->frame_header.flags = AERON_DATA_HEADER_END_FLAG;
+    src_header->term_offset = firstAlignedLength;
+
+    *m_term_tail_counter = packRawTail(TERM_ID, tail);
+
+    const int32_t resultingOffset = aeron_term_appender_append_block(
+        &m_term_buffer, m_term_tail_counter, block, blockLength, TERM_ID, SESSION_ID, STREAM_ID);
+
+    EXPECT_EQ(resultingOffset, tail + (int32_t)blockLength);
+    EXPECT_EQ(*m_term_tail_counter, packRawTail(TERM_ID, tail + (int32_t)blockLength));
+
+    aeron_data_header_t *data_header = (aeron_data_header_t *)(m_logBuffer.data() + tail);
+    EXPECT_EQ(data_header->frame_header.frame_length, firstFrameLength);
+    EXPECT_EQ(data_header->frame_header.flags, AERON_DATA_HEADER_BEGIN_FLAG);
+    EXPECT_EQ(data_header->term_offset, tail);
+    EXPECT_EQ(data_header->term_id, TERM_ID);
+    EXPECT_EQ(data_header->session_id, SESSION_ID);
+    EXPECT_EQ(data_header->stream_id, STREAM_ID);
+
+    data_header = (aeron_data_header_t *)(m_logBuffer.data() + tail + firstAlignedLength);
+    EXPECT_EQ(data_header->frame_header.frame_length, secondFrameLength);
+    EXPECT_EQ(data_header->frame_header.flags, AERON_DATA_HEADER_END_FLAG);
+    EXPECT_EQ(data_header->term_offset, tail + firstAlignedLength);
+    EXPECT_EQ(data_header->term_id, TERM_ID);
+    EXPECT_EQ(data_header->session_id, SESSION_ID);
+    EXPECT_EQ(data_header->stream_id, STREAM_ID);
+}
+
+TEST_F(CTermAppenderTest, shouldPadLogWhenAppendingBlockWithInsufficientRemainingCapacity)
+{
+    uint8_t block[128] = {};
+    const int32_t tailValue = TERM_BUFFER_CAPACITY - 64;
+
+    aeron_data_header_t *src_header = (aeron_data_header_t *)block;
+    src_header->frame_header.frame_length = sizeof(block);
+    src_header->frame_header.type = AERON_HDR_TYPE_DATA;
+
+    *m_term_tail_counter = packRawTail(TERM_ID, tailValue);
+
+    const int32_t resultingOffset = aeron_term_appender_append_block(
+        &m_term_buffer, m_term_tail_counter, block, sizeof(block), TERM_ID, SESSION_ID, STREAM_ID);
+
+    EXPECT_EQ(resultingOffset, AERON_TERM_APPENDER_FAILED);
+    EXPECT_EQ(*m_term_tail_counter, packRawTail(TERM_ID, tailValue + (int32_t)sizeof(block)));
+
+    aeron_data_header_t *data_header = (aeron_data_header_t *)(m_logBuffer.data() + tailValue);
+    EXPECT_EQ(data_header->frame_header.frame_length, 64);
+    EXPECT_EQ(data_header->frame_header.type, AERON_HDR_TYPE_PAD);
+}
+
 TEST_F(CTermAppenderTest, shouldFragmentMessageOverTwoFrames)
 {
     uint8_t msgBuffer[SRC_BUFFER_CAPACITY];
@@ -263,6 +413,61 @@ TEST_F(CTermAppenderTest, shouldClaimRegionForZeroCopyEncoding)
     EXPECT_EQ(data_header->frame_header.frame_length, frameLength);
 }
 
+TEST_F(CTermAppenderTest, shouldClaimFragmentedRegionForZeroCopyEncoding)
+{
+    const int32_t msgLength = (2 * MAX_PAYLOAD_LENGTH) + 1;
+    const int32_t lastFrameLength = 1 + AERON_DATA_HEADER_LENGTH;
+    const int32_t requiredCapacity =
+        (2 * MAX_FRAME_LENGTH) + AERON_ALIGN(lastFrameLength, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    int32_t tail = 0;
+    aeron_buffer_claim_t buffer_claims[3];
+    aeron_data_header_t *data_header;
+
+    *m_term_tail_counter = packRawTail(TERM_ID, tail);
+
+    const int32_t resultingOffset = aeron_term_appender_claim_fragmented(
+        &m_term_buffer,
+        m_term_tail_counter,
+        msgLength,
+        MAX_PAYLOAD_LENGTH,
+        buffer_claims,
+        TERM_ID,
+        SESSION_ID,
+        STREAM_ID);
+
+    EXPECT_EQ(resultingOffset, requiredCapacity);
+    EXPECT_EQ(*m_term_tail_counter, packRawTail(TERM_ID, tail + requiredCapacity));
+
+    EXPECT_EQ(buffer_claims[0].data, m_logBuffer.data() + AERON_DATA_HEADER_LENGTH);
+    EXPECT_EQ(buffer_claims[0].length, (size_t)MAX_PAYLOAD_LENGTH);
+    EXPECT_EQ(buffer_claims[1].data, m_logBuffer.data() + MAX_FRAME_LENGTH + AERON_DATA_HEADER_LENGTH);
+    EXPECT_EQ(buffer_claims[1].length, (size_t)MAX_PAYLOAD_LENGTH);
+    EXPECT_EQ(buffer_claims[2].data, m_logBuffer.data() + (2 * MAX_FRAME_LENGTH) + AERON_DATA_HEADER_LENGTH);
+    EXPECT_EQ(buffer_claims[2].length, 1u);
+
+    data_header = (aeron_data_header_t *)m_logBuffer.data();
+    EXPECT_EQ(data_header->frame_header.frame_length, -MAX_FRAME_LENGTH);
+    EXPECT_EQ(data_header->frame_header.flags, AERON_DATA_HEADER_BEGIN_FLAG);
+
+    data_header = (aeron_data_header_t *)(m_logBuffer.data() + MAX_FRAME_LENGTH);
+    EXPECT_EQ(data_header->frame_header.flags, 0);
+    EXPECT_EQ(data_header->term_offset, MAX_FRAME_LENGTH);
+
+    data_header = (aeron_data_header_t *)(m_logBuffer.data() + (2 * MAX_FRAME_LENGTH));
+    EXPECT_EQ(data_header->frame_header.frame_length, -lastFrameLength);
+    EXPECT_EQ(data_header->frame_header.flags, AERON_DATA_HEADER_END_FLAG);
+
+    for (auto &buffer_claim : buffer_claims)
+    {
+        EXPECT_EQ(aeron_buffer_claim_commit(&buffer_claim), 0);
+    }
+
+    data_header = (aeron_data_header_t *)m_logBuffer.data();
+    EXPECT_EQ(data_header->frame_header.frame_length, MAX_FRAME_LENGTH);
+    data_header = (aeron_data_header_t *)(m_logBuffer.data() + (2 * MAX_FRAME_LENGTH));
+    EXPECT_EQ(data_header->frame_header.frame_length, lastFrameLength);
+}
+
 TEST_F(CTermAppenderTest, shouldAppendUnfragmentedFromVectorsToEmptyLog)
 {
     uint8_t bufferOne[64], bufferTwo[256];
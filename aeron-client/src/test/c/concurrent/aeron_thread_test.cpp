@@ -0,0 +1,63 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "concurrent/aeron_thread.h"
+}
+
+class ThreadTest : public testing::Test
+{
+public:
+    void SetUp() override
+    {
+        ASSERT_EQ(0, aeron_thread_attr_init(&m_attr));
+    }
+
+    void TearDown() override
+    {
+        pthread_attr_destroy(&m_attr);
+    }
+
+protected:
+    pthread_attr_t m_attr = {};
+};
+
+#if defined(__linux__)
+TEST_F(ThreadTest, shouldSetAffinityFromCpuList)
+{
+    ASSERT_EQ(0, aeron_thread_attr_set_affinity(&m_attr, "0,2-3"));
+
+    cpu_set_t cpu_set;
+    ASSERT_EQ(0, pthread_attr_getaffinity_np(&m_attr, sizeof(cpu_set), &cpu_set));
+    EXPECT_EQ(3, CPU_COUNT(&cpu_set));
+    EXPECT_TRUE(CPU_ISSET(0, &cpu_set));
+    EXPECT_FALSE(CPU_ISSET(1, &cpu_set));
+    EXPECT_TRUE(CPU_ISSET(2, &cpu_set));
+    EXPECT_TRUE(CPU_ISSET(3, &cpu_set));
+}
+
+TEST_F(ThreadTest, shouldRejectInvalidCpuLists)
+{
+    EXPECT_EQ(EINVAL, aeron_thread_attr_set_affinity(&m_attr, ""));
+    EXPECT_EQ(EINVAL, aeron_thread_attr_set_affinity(&m_attr, "1,"));
+    EXPECT_EQ(EINVAL, aeron_thread_attr_set_affinity(&m_attr, "3-1"));
+    EXPECT_EQ(EINVAL, aeron_thread_attr_set_affinity(&m_attr, "a"));
+    EXPECT_EQ(EINVAL, aeron_thread_attr_set_affinity(&m_attr, "-1"));
+}
+#endif
@@ -0,0 +1,160 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "aeronc.h"
+#include "concurrent/aeron_trace_ring.h"
+}
+
+#define CAPACITY (8)
+#define FRAME_LENGTH (64)
+
+class TraceRingTest : public testing::Test
+{
+public:
+    TraceRingTest()
+    {
+        m_buffer.resize(AERON_TRACE_RING_LENGTH(CAPACITY));
+        m_frames.resize(FRAME_LENGTH * 4);
+    }
+
+    void SetUp() override
+    {
+        ASSERT_EQ(aeron_trace_ring_init(&m_ring, m_buffer.data(), m_buffer.size(), AERON_TRACE_AGENT_SENDER), 0);
+    }
+
+    aeron_data_header_t *frameAt(int index, int64_t reserved_value)
+    {
+        auto *frame = reinterpret_cast<aeron_data_header_t *>(m_frames.data() + (index * FRAME_LENGTH));
+
+        frame->frame_header.frame_length = FRAME_LENGTH;
+        frame->frame_header.type = AERON_HDR_TYPE_DATA;
+        frame->session_id = 7;
+        frame->stream_id = 1001;
+        frame->term_id = 3;
+        frame->term_offset = index * FRAME_LENGTH;
+        frame->reserved_value = reserved_value;
+
+        return frame;
+    }
+
+    int64_t read(int64_t from_index)
+    {
+        m_events.clear();
+
+        return aeron_trace_ring_read(
+            m_buffer.data(),
+            m_buffer.size(),
+            from_index,
+            [](void *clientd, const aeron_trace_event_t *event)
+            {
+                static_cast<std::vector<aeron_trace_event_t> *>(clientd)->push_back(*event);
+            },
+            &m_events);
+    }
+
+protected:
+    std::vector<uint8_t> m_buffer;
+    std::vector<uint8_t> m_frames;
+    std::vector<aeron_trace_event_t> m_events;
+    aeron_trace_ring_t m_ring = {};
+};
+
+TEST_F(TraceRingTest, shouldMarkEveryNthFrame)
+{
+    aeron_trace_sampler_t *sampler = nullptr;
+    ASSERT_EQ(aeron_trace_sampler_create(&sampler, 3), 0);
+
+    int marked = 0;
+    for (int i = 0; i < 9; i++)
+    {
+        const int64_t reserved_value = aeron_trace_reserved_value_supplier(sampler, nullptr, FRAME_LENGTH);
+        if (aeron_trace_is_marked(reserved_value))
+        {
+            marked++;
+            EXPECT_EQ(2, i % 3);
+        }
+        else
+        {
+            EXPECT_EQ(0, reserved_value);
+        }
+    }
+
+    EXPECT_EQ(3, marked);
+    aeron_trace_sampler_delete(sampler);
+}
+
+TEST_F(TraceRingTest, shouldRecordOnlyMarkedDataFrames)
+{
+    const int64_t append_ns = 123456789;
+
+    frameAt(0, 0);
+    frameAt(1, AERON_TRACE_RESERVED_VALUE_TAG | append_ns);
+    frameAt(2, 42);
+    frameAt(3, AERON_TRACE_RESERVED_VALUE_TAG | (append_ns + 1));
+
+    aeron_trace_ring_record_frames(&m_ring, AERON_TRACE_EVENT_SEND, append_ns + 100, m_frames.data(), m_frames.size());
+
+    EXPECT_EQ(read(0), 2);
+    ASSERT_EQ(m_events.size(), 2u);
+
+    EXPECT_EQ(m_events[0].agent_type, AERON_TRACE_AGENT_SENDER);
+    EXPECT_EQ(m_events[0].event_type, AERON_TRACE_EVENT_SEND);
+    EXPECT_EQ(m_events[0].timestamp_ns, append_ns + 100);
+    EXPECT_EQ(m_events[0].append_timestamp_ns, append_ns);
+    EXPECT_EQ(m_events[0].session_id, 7);
+    EXPECT_EQ(m_events[0].stream_id, 1001);
+    EXPECT_EQ(m_events[0].term_id, 3);
+    EXPECT_EQ(m_events[0].term_offset, FRAME_LENGTH);
+    EXPECT_EQ(m_events[0].length, FRAME_LENGTH);
+
+    EXPECT_EQ(m_events[1].term_offset, 3 * FRAME_LENGTH);
+    EXPECT_EQ(m_events[1].append_timestamp_ns, append_ns + 1);
+}
+
+TEST_F(TraceRingTest, shouldReadOnlyNewRecords)
+{
+    const aeron_data_header_t *frame = frameAt(0, AERON_TRACE_RESERVED_VALUE_TAG | 1);
+
+    aeron_trace_ring_record(&m_ring, AERON_TRACE_EVENT_SEND, 10, frame);
+    const int64_t next_index = read(0);
+    EXPECT_EQ(m_events.size(), 1u);
+
+    aeron_trace_ring_record(&m_ring, AERON_TRACE_EVENT_SEND, 20, frame);
+    EXPECT_EQ(read(next_index), 2);
+    ASSERT_EQ(m_events.size(), 1u);
+    EXPECT_EQ(m_events[0].timestamp_ns, 20);
+}
+
+TEST_F(TraceRingTest, shouldKeepMostRecentRecordsWhenWrapped)
+{
+    const aeron_data_header_t *frame = frameAt(0, AERON_TRACE_RESERVED_VALUE_TAG | 1);
+
+    for (int64_t i = 0; i < CAPACITY + 3; i++)
+    {
+        aeron_trace_ring_record(&m_ring, AERON_TRACE_EVENT_RECEIVE, i, frame);
+    }
+
+    EXPECT_EQ(read(0), CAPACITY + 3);
+    ASSERT_EQ(m_events.size(), (size_t)CAPACITY);
+    EXPECT_EQ(m_events.front().timestamp_ns, 3);
+    EXPECT_EQ(m_events.back().timestamp_ns, CAPACITY + 2);
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cstdint>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "util/aeron_slab_allocator.h"
+}
+
+class SlabAllocatorTest : public testing::Test
+{
+public:
+    void SetUp() override
+    {
+        ASSERT_EQ(0, aeron_slab_allocator_init(&m_slab_allocator));
+        m_allocator = &m_slab_allocator.allocator;
+    }
+
+    void TearDown() override
+    {
+        aeron_slab_allocator_close(&m_slab_allocator);
+    }
+
+protected:
+    aeron_slab_allocator_t m_slab_allocator = {};
+    aeron_allocator_t *m_allocator = nullptr;
+};
+
+TEST_F(SlabAllocatorTest, shouldAllocateZeroedCacheLineAlignedSlots)
+{
+    uint8_t *ptr = nullptr;
+
+    ASSERT_EQ(0, aeron_allocator_alloc(m_allocator, (void **)&ptr, 100));
+    EXPECT_EQ(0u, (uintptr_t)ptr & (AERON_SLAB_ALLOCATOR_SLOT_ALIGNMENT - 1));
+    EXPECT_EQ(1u, m_slab_allocator.chunk_count);
+    EXPECT_EQ(1u, m_slab_allocator.slots_in_use);
+
+    for (size_t i = 0; i < 100; i++)
+    {
+        ASSERT_EQ(0, ptr[i]);
+    }
+
+    memset(ptr, 0xFF, 100);
+    aeron_allocator_free(m_allocator, ptr, 100);
+    EXPECT_EQ(0u, m_slab_allocator.slots_in_use);
+
+    uint8_t *reused = nullptr;
+    ASSERT_EQ(0, aeron_allocator_alloc(m_allocator, (void **)&reused, 128));
+    EXPECT_EQ(ptr, reused);
+
+    for (size_t i = 0; i < 128; i++)
+    {
+        ASSERT_EQ(0, reused[i]);
+    }
+
+    aeron_allocator_free(m_allocator, reused, 128);
+}
+
+TEST_F(SlabAllocatorTest, shouldKeepSizeClassesInSeparateChunks)
+{
+    void *small = nullptr;
+    void *large = nullptr;
+
+    ASSERT_EQ(0, aeron_allocator_alloc(m_allocator, &small, 64));
+    ASSERT_EQ(0, aeron_allocator_alloc(m_allocator, &large, 65));
+    EXPECT_EQ(2u, m_slab_allocator.chunk_count);
+
+    aeron_allocator_free(m_allocator, small, 64);
+    aeron_allocator_free(m_allocator, large, 65);
+}
+
+TEST_F(SlabAllocatorTest, shouldAddChunkWhenSizeClassIsExhausted)
+{
+    const size_t length = AERON_SLAB_ALLOCATOR_MAX_SLOT_LENGTH;
+    const size_t slots_per_chunk =
+        (AERON_SLAB_ALLOCATOR_CHUNK_LENGTH - AERON_SLAB_ALLOCATOR_SLOT_ALIGNMENT) / length;
+    void *slots[64] = {};
+
+    ASSERT_LT(slots_per_chunk, 64u);
+
+    for (size_t i = 0; i <= slots_per_chunk; i++)
+    {
+        ASSERT_EQ(0, aeron_allocator_alloc(m_allocator, &slots[i], length));
+    }
+
+    EXPECT_EQ(2u, m_slab_allocator.chunk_count);
+    EXPECT_EQ(slots_per_chunk + 1, m_slab_allocator.slots_in_use);
+
+    for (size_t i = 0; i <= slots_per_chunk; i++)
+    {
+        aeron_allocator_free(m_allocator, slots[i], length);
+    }
+
+    EXPECT_EQ(0u, m_slab_allocator.slots_in_use);
+}
+
+TEST_F(SlabAllocatorTest, shouldUseSystemAllocatorOverMaxSlotLength)
+{
+    void *ptr = nullptr;
+
+    ASSERT_EQ(0, aeron_allocator_alloc(m_allocator, &ptr, AERON_SLAB_ALLOCATOR_MAX_SLOT_LENGTH + 1));
+    EXPECT_EQ(0u, m_slab_allocator.chunk_count);
+    EXPECT_EQ(0u, m_slab_allocator.slots_in_use);
+
+    aeron_allocator_free(m_allocator, ptr, AERON_SLAB_ALLOCATOR_MAX_SLOT_LENGTH + 1);
+}
+
+TEST(AllocatorTest, shouldUseSystemAllocatorWhenNull)
+{
+    void *ptr = nullptr;
+
+    ASSERT_EQ(0, aeron_allocator_alloc(nullptr, &ptr, 32));
+    ASSERT_NE(nullptr, ptr);
+    aeron_allocator_free(nullptr, ptr, 32);
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "aeronc.h"
+#include "util/aeron_clock.h"
+#include "concurrent/aeron_thread.h"
+}
+
+class TscClockTest : public testing::Test
+{
+public:
+    void SetUp() override
+    {
+        if (aeron_tsc_clock_init() < 0)
+        {
+            GTEST_SKIP() << "invariant TSC not available";
+        }
+    }
+};
+
+TEST_F(TscClockTest, shouldTrackMonotonicClock)
+{
+    const int64_t tolerance_ns = 1000 * 1000;
+
+    for (int i = 0; i < 10; i++)
+    {
+        int64_t before_ns = aeron_nano_clock();
+        int64_t tsc_ns = aeron_tsc_nano_clock();
+        int64_t after_ns = aeron_nano_clock();
+
+        EXPECT_GE(tsc_ns, before_ns - tolerance_ns);
+        EXPECT_LE(tsc_ns, after_ns + tolerance_ns);
+
+        aeron_nano_sleep(1000 * 1000);
+    }
+}
+
+TEST_F(TscClockTest, shouldNotGoBackwards)
+{
+    int64_t last_ns = aeron_tsc_nano_clock();
+
+    for (int i = 0; i < 1000000; i++)
+    {
+        int64_t now_ns = aeron_tsc_nano_clock();
+        ASSERT_GE(now_ns, last_ns);
+        last_ns = now_ns;
+    }
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include "Awaitable.h"
+
+#if defined(AERON_HAS_COROUTINES)
+
+using namespace aeron;
+
+namespace
+{
+
+struct DetachedTask
+{
+    struct promise_type
+    {
+        DetachedTask get_return_object()
+        {
+            return {};
+        }
+
+        std::suspend_never initial_suspend()
+        {
+            return {};
+        }
+
+        std::suspend_never final_suspend() noexcept
+        {
+            return {};
+        }
+
+        void return_void()
+        {
+        }
+
+        void unhandled_exception()
+        {
+            std::terminate();
+        }
+    };
+};
+
+DetachedTask awaitValue(AwaitScheduler &scheduler, int &polls, int readyAfter, std::shared_ptr<int> &result)
+{
+    result = co_await PollAwaitable<std::shared_ptr<int>>(
+        scheduler,
+        [&polls, readyAfter]()
+        {
+            return ++polls >= readyAfter ? std::make_shared<int>(polls) : std::shared_ptr<int>();
+        });
+}
+
+DetachedTask awaitException(AwaitScheduler &scheduler, std::string &message)
+{
+    try
+    {
+        co_await PollAwaitable<std::shared_ptr<int>>(
+            scheduler,
+            []() -> std::shared_ptr<int>
+            {
+                throw std::runtime_error("registration failed");
+            });
+    }
+    catch (const std::runtime_error &ex)
+    {
+        message = ex.what();
+    }
+}
+
+}
+
+TEST(AwaitableTest, shouldResumeCoroutineWhenPollCompletes)
+{
+    AwaitScheduler scheduler;
+    int polls = 0;
+    std::shared_ptr<int> result;
+
+    awaitValue(scheduler, polls, 3, result);
+    EXPECT_EQ(scheduler.pendingCount(), 1u);
+    EXPECT_FALSE(result);
+
+    EXPECT_EQ(scheduler.poll(), 0);
+    EXPECT_FALSE(result);
+
+    EXPECT_EQ(scheduler.poll(), 1);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(*result, 3);
+    EXPECT_EQ(scheduler.pendingCount(), 0u);
+}
+
+TEST(AwaitableTest, shouldNotSuspendWhenAlreadyComplete)
+{
+    AwaitScheduler scheduler;
+    int polls = 0;
+    std::shared_ptr<int> result;
+
+    awaitValue(scheduler, polls, 1, result);
+    EXPECT_EQ(scheduler.pendingCount(), 0u);
+    ASSERT_TRUE(result);
+}
+
+TEST(AwaitableTest, shouldRethrowExceptionFromPollInCoroutine)
+{
+    AwaitScheduler scheduler;
+    std::string message;
+
+    awaitException(scheduler, message);
+    EXPECT_EQ(scheduler.pendingCount(), 0u);
+    EXPECT_EQ(message, "registration failed");
+}
+
+#else
+
+TEST(AwaitableTest, shouldRequireCoroutineSupport)
+{
+    GTEST_SKIP() << "C++20 coroutines are not available";
+}
+
+#endif
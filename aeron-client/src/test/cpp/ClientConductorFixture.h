@@ -51,6 +51,7 @@ static const long RESOURCE_LINGER_TIMEOUT_MS = 5 * 1000;
 static const long long INTER_SERVICE_TIMEOUT_NS = 5 * 1000 * 1000 * 1000LL;
 static const long INTER_SERVICE_TIMEOUT_MS = INTER_SERVICE_TIMEOUT_NS / 1000000L;
 static const bool PRE_TOUCH_MAPPED_MEMORY = false;
+static const bool LOCK_MAPPED_MEMORY = false;
 
 typedef std::array<std::uint8_t, MANY_TO_ONE_RING_BUFFER_LENGTH> many_to_one_ring_buffer_t;
 typedef std::array<std::uint8_t, BROADCAST_BUFFER_LENGTH> broadcast_buffer_t;
@@ -90,6 +91,7 @@ public:
             m_copyBroadcastReceiver,
             m_counterMetadataBuffer,
             m_counterValuesBuffer,
+            m_counterCompactBuffer,
             std::bind(&testing::NiceMock<MockClientConductorHandlers>::onNewPub, &m_handlers, _1, _2, _3, _4),
             std::bind(&testing::NiceMock<MockClientConductorHandlers>::onNewPub, &m_handlers, _1, _2, _3, _4),
             std::bind(&testing::NiceMock<MockClientConductorHandlers>::onNewSub, &m_handlers, _1, _2, _3),
@@ -100,7 +102,8 @@ public:
             DRIVER_TIMEOUT_MS,
             RESOURCE_LINGER_TIMEOUT_MS,
             INTER_SERVICE_TIMEOUT_NS,
-            PRE_TOUCH_MAPPED_MEMORY),
+            PRE_TOUCH_MAPPED_MEMORY,
+            LOCK_MAPPED_MEMORY),
         m_errorHandler(defaultErrorHandler),
         m_onAvailableImageHandler(std::bind(&testing::NiceMock<MockClientConductorHandlers>::onNewImage, &m_handlers, _1)),
         m_onUnavailableImageHandler(std::bind(&testing::NiceMock<MockClientConductorHandlers>::onInactive, &m_handlers, _1)),
@@ -134,6 +137,7 @@ protected:
     AtomicBuffer m_toClientsBuffer;
     AtomicBuffer m_counterMetadataBuffer;
     AtomicBuffer m_counterValuesBuffer;
+    AtomicBuffer m_counterCompactBuffer;
 
     ManyToOneRingBuffer m_manyToOneRingBuffer;
     BroadcastReceiver m_broadcastReceiver;
@@ -930,6 +930,61 @@ TEST_F(ClientConductorTest, shouldRemoveImageOnInterServiceTimeout)
     EXPECT_TRUE(image == nullptr);
 }
 
+TEST_F(ClientConductorTest, shouldIndexImagesBySessionIdAndViewWithoutCopy)
+{
+    std::int64_t id = m_conductor.addSubscription(
+        CHANNEL, STREAM_ID, m_onAvailableImageHandler, m_onUnavailableImageHandler);
+    std::int64_t correlationId = id + 1;
+
+    m_conductor.onSubscriptionReady(id, CHANNEL_STATUS_INDICATOR_ID);
+
+    std::shared_ptr<Subscription> sub = m_conductor.findSubscription(id);
+
+    ASSERT_TRUE(sub != nullptr);
+    EXPECT_EQ(sub->imageArrayView().size(), 0u);
+
+    m_conductor.onAvailableImage(correlationId, SESSION_ID, 1, id, m_logFileName, SOURCE_IDENTITY);
+
+    ImageArrayView view = sub->imageArrayView();
+    ASSERT_EQ(view.size(), 1u);
+    EXPECT_EQ(view[0]->correlationId(), correlationId);
+    EXPECT_EQ(sub->imageBySessionId(SESSION_ID), view[0]);
+    EXPECT_TRUE(sub->imageBySessionId(SESSION_ID + 1) == nullptr);
+
+    m_conductor.onUnavailableImage(correlationId, id);
+
+    EXPECT_EQ(sub->imageArrayView().size(), 0u);
+    EXPECT_TRUE(sub->imageBySessionId(SESSION_ID) == nullptr);
+}
+
+TEST_F(ClientConductorTest, shouldInvalidateImageViewWhenImageListChanges)
+{
+    std::int64_t id = m_conductor.addSubscription(
+        CHANNEL, STREAM_ID, m_onAvailableImageHandler, m_onUnavailableImageHandler);
+    std::int64_t correlationId = id + 1;
+
+    m_conductor.onSubscriptionReady(id, CHANNEL_STATUS_INDICATOR_ID);
+
+    std::shared_ptr<Subscription> sub = m_conductor.findSubscription(id);
+
+    ASSERT_TRUE(sub != nullptr);
+    EXPECT_FALSE(sub->imageViewByIndex(0));
+
+    m_conductor.onAvailableImage(correlationId, SESSION_ID, 1, id, m_logFileName, SOURCE_IDENTITY);
+
+    ImageView view = sub->imageViewBySessionId(SESSION_ID);
+    ASSERT_TRUE(view);
+    EXPECT_EQ(view->correlationId(), correlationId);
+    EXPECT_EQ(view.get(), sub->imageViewByIndex(0).get());
+    EXPECT_FALSE(sub->imageViewBySessionId(SESSION_ID + 1));
+    EXPECT_TRUE(sub->isCurrent(view));
+
+    m_conductor.onUnavailableImage(correlationId, id);
+
+    EXPECT_FALSE(sub->isCurrent(view));
+    EXPECT_FALSE(sub->imageViewBySessionId(SESSION_ID));
+}
+
 TEST_F(ClientConductorTest, shouldReturnNullForUnknownCounter)
 {
     std::shared_ptr<Counter> counter = m_conductor.findCounter(100);
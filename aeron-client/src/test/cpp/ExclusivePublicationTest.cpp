@@ -174,6 +174,31 @@ TEST_F(ExclusivePublicationTest, shouldOfferAMessageUponConstruction)
     EXPECT_EQ(m_publication->position(), expectedPosition);
 }
 
+TEST_F(ExclusivePublicationTest, shouldOfferFixedLengthMessageAndMessageWithReservedValue)
+{
+    createPub();
+    const std::int32_t messageLength = 64;
+    const std::int64_t frameLength = messageLength + DataFrameHeader::LENGTH;
+    const std::int64_t reservedValue = 0x7F7F7F7F;
+    const int activeIndex = LogBufferDescriptor::indexByTerm(TERM_ID_1, TERM_ID_1);
+    m_publicationLimit.set(4 * frameLength);
+
+    EXPECT_EQ(m_publication->offerFixed<messageLength>(m_srcBuffer, 0), frameLength);
+    EXPECT_EQ(
+        m_publication->offer(
+            m_srcBuffer,
+            0,
+            messageLength,
+            [&](AtomicBuffer &, util::index_t, util::index_t) { return reservedValue; }),
+        2 * frameLength);
+
+    EXPECT_EQ(m_termBuffers[activeIndex].getInt32(0), frameLength);
+    EXPECT_EQ(m_termBuffers[activeIndex].getInt64(DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET), 0);
+    EXPECT_EQ(
+        m_termBuffers[activeIndex].getInt64(frameLength + DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET),
+        reservedValue);
+}
+
 TEST_F(ExclusivePublicationTest, shouldFailToOfferAMessageWhenLimited)
 {
     createPub();
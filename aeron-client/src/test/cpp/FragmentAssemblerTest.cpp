@@ -18,6 +18,8 @@
 
 #include <array>
 #include "FragmentAssembler.h"
+#include "ControlledFragmentAssembler.h"
+#include "ImageFragmentAssembler.h"
 
 using namespace aeron::util;
 using namespace aeron;
@@ -152,6 +154,58 @@ TEST_F(FragmentAssemblerTest, shouldReassembleFromTwoFragments)
     ASSERT_TRUE(called);
 }
 
+TEST_F(FragmentAssemblerTest, shouldReassembleFromTwoFragmentsWithTemplatedDelegate)
+{
+    util::index_t msgLength = MTU_LENGTH - DataFrameHeader::LENGTH;
+    int called = 0;
+    auto handler = [&](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+    {
+        called++;
+        EXPECT_EQ(offset, DataFrameHeader::LENGTH);
+        EXPECT_EQ(length, msgLength * 2);
+        EXPECT_EQ(header.flags(), FrameDescriptor::END_FRAG);
+        verifyPayload(buffer, offset, length);
+    };
+
+    auto adapter = makeFragmentAssembler(handler);
+
+    fillFrame(FrameDescriptor::BEGIN_FRAG, 0, msgLength, 0);
+    m_header.offset(0);
+    adapter(m_buffer, 0 + DataFrameHeader::LENGTH, msgLength, m_header);
+    ASSERT_EQ(called, 0);
+
+    m_header.offset(MTU_LENGTH);
+    fillFrame(FrameDescriptor::END_FRAG, MTU_LENGTH, msgLength, msgLength % 256);
+    adapter(m_buffer, MTU_LENGTH + DataFrameHeader::LENGTH, msgLength, m_header);
+    ASSERT_EQ(called, 1);
+}
+
+TEST_F(FragmentAssemblerTest, shouldRetainFragmentsWhenTemplatedControlledDelegateAborts)
+{
+    util::index_t msgLength = MTU_LENGTH - DataFrameHeader::LENGTH;
+    int called = 0;
+    auto handler = [&](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+    {
+        EXPECT_EQ(length, msgLength * 2);
+        verifyPayload(buffer, offset, length);
+        return ++called == 1 ? ControlledPollAction::ABORT : ControlledPollAction::CONTINUE;
+    };
+
+    auto adapter = makeControlledFragmentAssembler(handler);
+
+    fillFrame(FrameDescriptor::BEGIN_FRAG, 0, msgLength, 0);
+    m_header.offset(0);
+    EXPECT_EQ(adapter(m_buffer, 0 + DataFrameHeader::LENGTH, msgLength, m_header), ControlledPollAction::CONTINUE);
+
+    m_header.offset(MTU_LENGTH);
+    fillFrame(FrameDescriptor::END_FRAG, MTU_LENGTH, msgLength, msgLength % 256);
+    EXPECT_EQ(
+        adapter(m_buffer, MTU_LENGTH + DataFrameHeader::LENGTH, msgLength, m_header), ControlledPollAction::ABORT);
+    EXPECT_EQ(
+        adapter(m_buffer, MTU_LENGTH + DataFrameHeader::LENGTH, msgLength, m_header), ControlledPollAction::CONTINUE);
+    ASSERT_EQ(called, 2);
+}
+
 TEST_F(FragmentAssemblerTest, shouldReassembleFromThreeFragments)
 {
     util::index_t msgLength = MTU_LENGTH - DataFrameHeader::LENGTH;
@@ -233,3 +287,108 @@ TEST_F(FragmentAssemblerTest, shouldNotReassembleIfMissingBegin)
     adapter.handler()(m_buffer, (MTU_LENGTH * 2) + DataFrameHeader::LENGTH, msgLength, m_header);
     ASSERT_FALSE(called);
 }
+
+TEST_F(FragmentAssemblerTest, shouldReassembleIntoPooledBuffer)
+{
+    util::index_t msgLength = MTU_LENGTH - DataFrameHeader::LENGTH;
+    int calls = 0;
+    auto handler = [&](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+    {
+        calls++;
+        EXPECT_EQ(offset, DataFrameHeader::LENGTH);
+        EXPECT_EQ(length, msgLength * 2);
+        EXPECT_EQ(header.sessionId(), SESSION_ID);
+        verifyPayload(buffer, offset, length);
+    };
+
+    FragmentAssembler adapter(handler, static_cast<std::size_t>(msgLength * 2), 1);
+
+    for (int i = 0; i < 2; i++)
+    {
+        fillFrame(FrameDescriptor::BEGIN_FRAG, 0, msgLength, 0);
+        m_header.offset(0);
+        adapter.handler()(m_buffer, 0 + DataFrameHeader::LENGTH, msgLength, m_header);
+        ASSERT_EQ(calls, i);
+
+        m_header.offset(MTU_LENGTH);
+        fillFrame(FrameDescriptor::END_FRAG, MTU_LENGTH, msgLength, msgLength % 256);
+        adapter.handler()(m_buffer, MTU_LENGTH + DataFrameHeader::LENGTH, msgLength, m_header);
+        ASSERT_EQ(calls, i + 1);
+    }
+}
+
+TEST_F(FragmentAssemblerTest, shouldDropMessageLongerThanPooledBuffer)
+{
+    util::index_t msgLength = MTU_LENGTH - DataFrameHeader::LENGTH;
+    bool called = false;
+    auto handler = [&](AtomicBuffer& buffer, util::index_t offset, util::index_t length, Header& header)
+    {
+        called = true;
+    };
+
+    FragmentAssembler adapter(handler, static_cast<std::size_t>(msgLength), 1);
+
+    fillFrame(FrameDescriptor::BEGIN_FRAG, 0, msgLength, 0);
+    m_header.offset(0);
+    adapter.handler()(m_buffer, 0 + DataFrameHeader::LENGTH, msgLength, m_header);
+
+    m_header.offset(MTU_LENGTH);
+    fillFrame(FrameDescriptor::END_FRAG, MTU_LENGTH, msgLength, msgLength % 256);
+    adapter.handler()(m_buffer, MTU_LENGTH + DataFrameHeader::LENGTH, msgLength, m_header);
+    ASSERT_FALSE(called);
+}
+
+TEST_F(FragmentAssemblerTest, shouldReassembleFromThreeFragmentsWithoutCopy)
+{
+    util::index_t msgLength = MTU_LENGTH - DataFrameHeader::LENGTH;
+    bool called = false;
+    auto handler = [&](const std::vector<AtomicBuffer> &fragments, Header &header)
+    {
+        called = true;
+        ASSERT_EQ(fragments.size(), 3u);
+        for (std::size_t i = 0; i < fragments.size(); i++)
+        {
+            EXPECT_EQ(fragments[i].buffer(), m_buffer.buffer() + (i * MTU_LENGTH) + DataFrameHeader::LENGTH);
+            EXPECT_EQ(fragments[i].capacity(), msgLength);
+        }
+        EXPECT_EQ(header.flags(), FrameDescriptor::END_FRAG);
+    };
+
+    ImageVectoredFragmentAssembler adapter(handler);
+
+    fillFrame(FrameDescriptor::BEGIN_FRAG, 0, msgLength, 0);
+    m_header.offset(0);
+    adapter.handler()(m_buffer, DataFrameHeader::LENGTH, msgLength, m_header);
+    ASSERT_FALSE(called);
+
+    fillFrame(0, MTU_LENGTH, msgLength, msgLength % 256);
+    m_header.offset(MTU_LENGTH);
+    adapter.handler()(m_buffer, MTU_LENGTH + DataFrameHeader::LENGTH, msgLength, m_header);
+    ASSERT_FALSE(called);
+
+    fillFrame(FrameDescriptor::END_FRAG, 2 * MTU_LENGTH, msgLength, (msgLength * 2) % 256);
+    m_header.offset(2 * MTU_LENGTH);
+    adapter.handler()(m_buffer, (2 * MTU_LENGTH) + DataFrameHeader::LENGTH, msgLength, m_header);
+    ASSERT_TRUE(called);
+}
+
+TEST_F(FragmentAssemblerTest, shouldNotReassembleWithoutCopyIfFragmentsAreNotContiguous)
+{
+    util::index_t msgLength = MTU_LENGTH - DataFrameHeader::LENGTH;
+    bool called = false;
+    auto handler = [&](const std::vector<AtomicBuffer> &fragments, Header &header)
+    {
+        called = true;
+    };
+
+    ImageVectoredFragmentAssembler adapter(handler);
+
+    fillFrame(FrameDescriptor::BEGIN_FRAG, 0, msgLength, 0);
+    m_header.offset(0);
+    adapter.handler()(m_buffer, DataFrameHeader::LENGTH, msgLength, m_header);
+
+    fillFrame(FrameDescriptor::END_FRAG, 2 * MTU_LENGTH, msgLength, msgLength % 256);
+    m_header.offset(2 * MTU_LENGTH);
+    adapter.handler()(m_buffer, (2 * MTU_LENGTH) + DataFrameHeader::LENGTH, msgLength, m_header);
+    ASSERT_FALSE(called);
+}
@@ -210,6 +210,33 @@ TEST_F(ImageTest, shouldReportCorrectPositionOnReception)
     EXPECT_EQ(image.position(), initialPosition + ALIGNED_FRAME_LENGTH);
 }
 
+TEST_F(ImageTest, shouldBatchPollFragmentsIntoDescriptors)
+{
+    const std::int64_t initialPosition = 0;
+    Fragment fragments[3];
+
+    m_subscriberPosition.set(initialPosition);
+    Image image(
+        SESSION_ID, CORRELATION_ID, SUBSCRIPTION_REGISTRATION_ID,
+        SOURCE_IDENTITY, m_subscriberPosition, m_logBuffers, exceptionHandler);
+
+    insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(0));
+    insertDataFrame(INITIAL_TERM_ID, offsetOfFrame(1));
+
+    const int fragmentsRead = image.batchPoll(fragments, 3);
+    EXPECT_EQ(fragmentsRead, 2);
+    EXPECT_EQ(m_subscriberPosition.get(), initialPosition + (2 * ALIGNED_FRAME_LENGTH));
+
+    for (int i = 0; i < fragmentsRead; i++)
+    {
+        EXPECT_EQ(fragments[i].buffer, m_termBuffers[0].buffer() + offsetOfFrame(i) + DataFrameHeader::LENGTH);
+        EXPECT_EQ(fragments[i].length, static_cast<index_t>(DATA.size()));
+        EXPECT_EQ(fragments[i].frame->sessionId, SESSION_ID);
+        EXPECT_EQ(fragments[i].frame->termOffset, offsetOfFrame(i));
+        EXPECT_EQ(fragments[i].position, initialPosition + ((i + 1) * ALIGNED_FRAME_LENGTH));
+    }
+}
+
 TEST_F(ImageTest, shouldReportCorrectPositionOnReceptionWithNonZeroPositionInInitialTermId)
 {
     const std::int32_t messageIndex = 5;
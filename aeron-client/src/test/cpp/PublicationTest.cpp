@@ -165,6 +165,30 @@ TEST_F(PublicationTest, shouldOfferAMessageUponConstruction)
     EXPECT_EQ(m_publication->position(), expectedPosition);
 }
 
+TEST_F(PublicationTest, shouldOfferFixedLengthMessageAndMessageWithReservedValue)
+{
+    const std::int32_t messageLength = 64;
+    const std::int64_t frameLength = messageLength + DataFrameHeader::LENGTH;
+    const std::int64_t reservedValue = 0x7F7F7F7F;
+    const int activeIndex = LogBufferDescriptor::indexByTerm(TERM_ID_1, TERM_ID_1);
+    m_publicationLimit.set(4 * frameLength);
+
+    EXPECT_EQ(m_publication->offerFixed<messageLength>(m_srcBuffer, 0), frameLength);
+    EXPECT_EQ(
+        m_publication->offer(
+            m_srcBuffer,
+            0,
+            messageLength,
+            [&](AtomicBuffer &, util::index_t, util::index_t) { return reservedValue; }),
+        2 * frameLength);
+
+    EXPECT_EQ(m_termBuffers[activeIndex].getInt32(0), frameLength);
+    EXPECT_EQ(m_termBuffers[activeIndex].getInt64(DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET), 0);
+    EXPECT_EQ(
+        m_termBuffers[activeIndex].getInt64(frameLength + DataFrameHeader::RESERVED_VALUE_FIELD_OFFSET),
+        reservedValue);
+}
+
 TEST_F(PublicationTest, shouldFailToOfferAMessageWhenLimited)
 {
     m_publicationLimit.set(0);
@@ -172,6 +196,19 @@ TEST_F(PublicationTest, shouldFailToOfferAMessageWhenLimited)
     EXPECT_EQ(m_publication->offer(m_srcBuffer), NOT_CONNECTED);
 }
 
+TEST_F(PublicationTest, shouldReturnErrorInsteadOfThrowingForNothrowOfferOfTooLongMessage)
+{
+    const util::index_t length = m_publication->maxMessageLength() + 1;
+    std::vector<std::uint8_t> message(static_cast<std::size_t>(length));
+    AtomicBuffer messageBuffer(message.data(), message.size());
+    m_publicationLimit.set(2 * length);
+
+    EXPECT_THROW(m_publication->offer(messageBuffer, 0, length), util::IllegalArgumentException);
+    EXPECT_EQ(m_publication->offer(messageBuffer, 0, length, std::nothrow), PUBLICATION_ERROR);
+    EXPECT_EQ(m_publication->offer(m_srcBuffer, 0, m_srcBuffer.capacity(), std::nothrow),
+        m_srcBuffer.capacity() + DataFrameHeader::LENGTH);
+}
+
 TEST_F(PublicationTest, shouldFailToOfferWhenAppendFails)
 {
     const int activeIndex = LogBufferDescriptor::indexByTerm(TERM_ID_1, TERM_ID_1);
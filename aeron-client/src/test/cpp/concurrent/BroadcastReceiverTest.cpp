@@ -15,6 +15,7 @@
  */
 
 #include <array>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -303,3 +304,116 @@ TEST_F(BroadcastReceiverTest, shouldDealWithRecordBecomingInvalidDueToOverwrite)
     EXPECT_EQ(m_broadcastReceiver->length(), length);
     EXPECT_FALSE(m_broadcastReceiver->validate());
 }
+
+TEST_F(BroadcastReceiverTest, shouldReceiveBatchOfMessagesValidatingEachRecord)
+{
+    const std::int32_t length = 8;
+    const std::int32_t recordLength = length + RecordDescriptor::HEADER_LENGTH;
+    const std::int32_t alignedRecordLength = util::BitUtil::align(recordLength, RecordDescriptor::RECORD_ALIGNMENT);
+    const std::int64_t tail = alignedRecordLength * 2;
+    const std::int32_t recordOffsetOne = 0;
+    const std::int32_t recordOffsetTwo = alignedRecordLength;
+
+    EXPECT_CALL(m_mockBuffer, getInt64Volatile(TAIL_COUNTER_INDEX))
+        .Times(1)
+        .WillOnce(testing::Return(tail));
+    EXPECT_CALL(m_mockBuffer, getInt64Volatile(TAIL_INTENT_COUNTER_INDEX))
+        .Times(3)
+        .WillRepeatedly(testing::Return(tail));
+    EXPECT_CALL(m_mockBuffer, getInt64(LATEST_COUNTER_INDEX))
+        .Times(0);
+
+    EXPECT_CALL(m_mockBuffer, getInt32Volatile(RecordDescriptor::lengthOffset(recordOffsetOne)))
+        .Times(1)
+        .WillOnce(testing::Return(recordLength));
+    EXPECT_CALL(m_mockBuffer, getInt32(RecordDescriptor::typeOffset(recordOffsetOne)))
+        .Times(1)
+        .WillOnce(testing::Return(MSG_TYPE_ID));
+    EXPECT_CALL(m_mockBuffer, getInt32Volatile(RecordDescriptor::lengthOffset(recordOffsetTwo)))
+        .Times(1)
+        .WillOnce(testing::Return(recordLength));
+    EXPECT_CALL(m_mockBuffer, getInt32(RecordDescriptor::typeOffset(recordOffsetTwo)))
+        .Times(1)
+        .WillOnce(testing::Return(MSG_TYPE_ID));
+
+    std::vector<util::index_t> offsets;
+    const int received = m_broadcastReceiver->receiveBatch(
+        [&](std::int32_t msgTypeId, AtomicBuffer &buffer, util::index_t offset, util::index_t msgLength)
+        {
+            EXPECT_EQ(msgTypeId, MSG_TYPE_ID);
+            EXPECT_EQ(&buffer, &m_mockBuffer);
+            EXPECT_EQ(msgLength, length);
+            offsets.push_back(offset);
+        });
+
+    EXPECT_EQ(received, 2);
+    ASSERT_EQ(offsets.size(), 2u);
+    EXPECT_EQ(offsets[0], RecordDescriptor::msgOffset(recordOffsetOne));
+    EXPECT_EQ(offsets[1], RecordDescriptor::msgOffset(recordOffsetTwo));
+    EXPECT_TRUE(m_broadcastReceiver->validate());
+}
+
+TEST_F(BroadcastReceiverTest, shouldStopBatchWhenLappedBetweenRecords)
+{
+    const std::int32_t length = 8;
+    const std::int32_t recordLength = length + RecordDescriptor::HEADER_LENGTH;
+    const std::int32_t alignedRecordLength = util::BitUtil::align(recordLength, RecordDescriptor::RECORD_ALIGNMENT);
+    const std::int64_t tail = alignedRecordLength * 2;
+    const std::int64_t latestRecord = CAPACITY * 2;
+    const std::int32_t recordOffsetOne = 0;
+
+    EXPECT_CALL(m_mockBuffer, getInt64Volatile(TAIL_COUNTER_INDEX))
+        .Times(1)
+        .WillOnce(testing::Return(tail));
+    EXPECT_CALL(m_mockBuffer, getInt64Volatile(TAIL_INTENT_COUNTER_INDEX))
+        .Times(2)
+        .WillOnce(testing::Return(tail))
+        .WillOnce(testing::Return(tail + CAPACITY));
+    EXPECT_CALL(m_mockBuffer, getInt64(LATEST_COUNTER_INDEX))
+        .Times(1)
+        .WillOnce(testing::Return(latestRecord));
+    EXPECT_CALL(m_mockBuffer, getInt32Volatile(RecordDescriptor::lengthOffset(recordOffsetOne)))
+        .Times(1)
+        .WillOnce(testing::Return(recordLength));
+    EXPECT_CALL(m_mockBuffer, getInt32(RecordDescriptor::typeOffset(recordOffsetOne)))
+        .Times(1)
+        .WillOnce(testing::Return(MSG_TYPE_ID));
+
+    int dispatched = 0;
+    const int received = m_broadcastReceiver->receiveBatch(
+        [&](std::int32_t msgTypeId, AtomicBuffer &buffer, util::index_t offset, util::index_t msgLength)
+        {
+            ++dispatched;
+        });
+
+    EXPECT_EQ(received, 1);
+    EXPECT_EQ(dispatched, 1);
+    EXPECT_EQ(m_broadcastReceiver->lappedCount(), 1);
+}
+
+TEST_F(BroadcastReceiverTest, shouldThrowOnInvalidRecordLengthInBatch)
+{
+    const std::int64_t tail = RecordDescriptor::RECORD_ALIGNMENT;
+    const std::int32_t recordOffset = 0;
+
+    EXPECT_CALL(m_mockBuffer, getInt64Volatile(TAIL_COUNTER_INDEX))
+        .Times(1)
+        .WillOnce(testing::Return(tail));
+    EXPECT_CALL(m_mockBuffer, getInt64Volatile(TAIL_INTENT_COUNTER_INDEX))
+        .Times(1)
+        .WillOnce(testing::Return(tail));
+    EXPECT_CALL(m_mockBuffer, getInt64(LATEST_COUNTER_INDEX))
+        .Times(1)
+        .WillOnce(testing::Return(0));
+    EXPECT_CALL(m_mockBuffer, getInt32Volatile(RecordDescriptor::lengthOffset(recordOffset)))
+        .Times(1)
+        .WillOnce(testing::Return(0));
+
+    EXPECT_THROW(
+        m_broadcastReceiver->receiveBatch(
+            [&](std::int32_t msgTypeId, AtomicBuffer &buffer, util::index_t offset, util::index_t msgLength)
+            {
+                FAIL() << "handler must not be called for an invalid record";
+            }),
+        util::IllegalStateException);
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "concurrent/AtomicBuffer.h"
+#include "concurrent/CountersIndex.h"
+#include "concurrent/CountersManager.h"
+
+using namespace aeron::concurrent;
+
+#define TYPE_ID (101)
+#define OTHER_TYPE_ID (102)
+
+static constexpr std::int32_t NULL_COUNTER_ID = CountersReader::NULL_COUNTER_ID;
+
+class CountersIndexTest : public testing::Test
+{
+public:
+    CountersIndexTest() :
+        m_countersManager(
+            AtomicBuffer(&m_metadataBuffer[0], m_metadataBuffer.size()),
+            AtomicBuffer(&m_valuesBuffer[0], m_valuesBuffer.size())),
+        m_countersIndex(CountersReader(
+            AtomicBuffer(&m_metadataBuffer[0], m_metadataBuffer.size()),
+            AtomicBuffer(&m_valuesBuffer[0], m_valuesBuffer.size())))
+    {
+        m_metadataBuffer.fill(0);
+        m_valuesBuffer.fill(0);
+    }
+
+    std::int32_t allocate(std::int32_t typeId, std::int64_t key, std::int64_t registrationId)
+    {
+        const std::int32_t counterId = m_countersManager.allocate(
+            typeId, reinterpret_cast<const std::uint8_t *>(&key), sizeof(key), "counter");
+        m_countersManager.setCounterRegistrationId(counterId, registrationId);
+
+        return counterId;
+    }
+
+protected:
+    static const std::int32_t NUM_COUNTERS = 8;
+
+    std::array<std::uint8_t, NUM_COUNTERS * CountersReader::METADATA_LENGTH> m_metadataBuffer;
+    std::array<std::uint8_t, NUM_COUNTERS * CountersReader::COUNTER_LENGTH> m_valuesBuffer;
+    CountersManager m_countersManager;
+    CountersIndex m_countersIndex;
+};
+
+TEST_F(CountersIndexTest, shouldFindCountersByTypeIdKeyAndRegistrationId)
+{
+    const std::int64_t key = 7;
+    allocate(OTHER_TYPE_ID, key, 10);
+    const std::int32_t counterId = allocate(TYPE_ID, key, 11);
+
+    EXPECT_EQ(counterId, m_countersIndex.findByTypeIdAndKey(
+        TYPE_ID, reinterpret_cast<const std::uint8_t *>(&key), sizeof(key)));
+    EXPECT_EQ(counterId, m_countersIndex.findByRegistrationId(11));
+    EXPECT_EQ(NULL_COUNTER_ID, m_countersIndex.findByRegistrationId(12));
+
+    const std::int64_t otherKey = 8;
+    EXPECT_EQ(NULL_COUNTER_ID, m_countersIndex.findByTypeIdAndKey(
+        TYPE_ID, reinterpret_cast<const std::uint8_t *>(&otherKey), sizeof(otherKey)));
+}
+
+TEST_F(CountersIndexTest, shouldIterateCountersOfTypeKnownAtLastRefresh)
+{
+    const std::int32_t counterId1 = allocate(TYPE_ID, 1, 30);
+    allocate(OTHER_TYPE_ID, 2, 31);
+    const std::int32_t counterId3 = allocate(TYPE_ID, 3, 32);
+
+    std::vector<std::int32_t> ids;
+    const auto collect = [&](std::int32_t counterId) { ids.push_back(counterId); };
+
+    m_countersIndex.forEachByTypeId(TYPE_ID, collect);
+    EXPECT_TRUE(ids.empty());
+
+    m_countersIndex.refresh();
+    m_countersIndex.forEachByTypeId(TYPE_ID, collect);
+    std::sort(ids.begin(), ids.end());
+    EXPECT_EQ(std::vector<std::int32_t>({ counterId1, counterId3 }), ids);
+
+    m_countersManager.free(counterId1);
+    ids.clear();
+    m_countersIndex.forEachByTypeId(TYPE_ID, collect);
+    EXPECT_EQ(std::vector<std::int32_t>({ counterId3 }), ids);
+}
+
+TEST_F(CountersIndexTest, shouldNotReturnFreedCounterAndShouldFindReusedCounter)
+{
+    const std::int32_t counterId = allocate(TYPE_ID, 1, 20);
+    ASSERT_EQ(counterId, m_countersIndex.findByRegistrationId(20));
+
+    m_countersManager.free(counterId);
+    EXPECT_EQ(NULL_COUNTER_ID, m_countersIndex.findByRegistrationId(20));
+
+    const std::int32_t reusedCounterId = allocate(OTHER_TYPE_ID, 2, 21);
+    ASSERT_EQ(counterId, reusedCounterId);
+    EXPECT_EQ(NULL_COUNTER_ID, m_countersIndex.findByRegistrationId(20));
+    EXPECT_EQ(reusedCounterId, m_countersIndex.findByRegistrationId(21));
+    EXPECT_EQ(reusedCounterId, m_countersIndex.findByTypeId(
+        OTHER_TYPE_ID,
+        [](std::int32_t, const AtomicBuffer &keyBuffer)
+        {
+            return keyBuffer.getInt64(0) == 2;
+        }));
+    EXPECT_EQ(NULL_COUNTER_ID, m_countersIndex.findByTypeId(
+        TYPE_ID,
+        [](std::int32_t, const AtomicBuffer &)
+        {
+            return true;
+        }));
+}
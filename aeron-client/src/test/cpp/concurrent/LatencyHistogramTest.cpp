@@ -0,0 +1,56 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include "concurrent/LatencyHistogram.h"
+
+using namespace aeron::concurrent;
+
+TEST(LatencyHistogramTest, shouldReportPercentilesWithinBucketPrecision)
+{
+    LatencyHistogram histogram;
+
+    for (std::int64_t i = 1; i <= 1000; i++)
+    {
+        histogram.recordValue(i * 1000);
+    }
+
+    EXPECT_EQ(histogram.count(), 1000);
+    EXPECT_EQ(histogram.maxValue(), 1000 * 1000);
+
+    const std::int64_t p50 = histogram.valueAtPercentile(50.0);
+    EXPECT_GE(p50, 500 * 1000);
+    EXPECT_LE(p50, static_cast<std::int64_t>(500 * 1000 * 1.125));
+    EXPECT_EQ(histogram.valueAtPercentile(100.0), 1000 * 1000);
+
+    histogram.reset();
+    EXPECT_EQ(histogram.count(), 0);
+    EXPECT_EQ(histogram.valueAtPercentile(99.0), 0);
+}
+
+TEST(LatencyHistogramTest, shouldStampSendTimestampFromMonotonicClock)
+{
+    AtomicBuffer buffer;
+    SendTimestampReservedValueSupplier supplier;
+
+    const std::int64_t beforeNs = sendTimestampNanoClock();
+    const std::int64_t timestampNs = supplier(buffer, 0, 0);
+
+    EXPECT_GE(timestampNs, beforeNs);
+    EXPECT_LE(timestampNs, sendTimestampNanoClock());
+}
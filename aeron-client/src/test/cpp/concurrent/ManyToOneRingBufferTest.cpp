@@ -382,6 +382,86 @@ TEST_F(ManyToOneRingBufferTest, shouldCopeWithExceptionFromHandler)
     }
 }
 
+TEST_F(ManyToOneRingBufferTest, shouldClaimCommitAndReadMessageEncodedInPlace)
+{
+    util::index_t length = 12;
+    util::index_t recordLength = length + RecordDescriptor::HEADER_LENGTH;
+
+    const util::index_t index = m_ringBuffer.tryClaim(MSG_TYPE_ID, length);
+    ASSERT_EQ(index, RecordDescriptor::HEADER_LENGTH);
+    EXPECT_EQ(m_ab.getInt32(RecordDescriptor::lengthOffset(0)), -recordLength);
+    EXPECT_EQ(m_ab.getInt32(RecordDescriptor::typeOffset(0)), MSG_TYPE_ID);
+
+    m_ab.putInt64(index, 42);
+    m_ab.putInt32(index + 8, 7);
+
+    int timesCalled = 0;
+    auto handler =
+        [&](std::int32_t msgTypeId, concurrent::AtomicBuffer &buffer, util::index_t offset, util::index_t msgLength)
+        {
+            EXPECT_EQ(msgTypeId, MSG_TYPE_ID);
+            EXPECT_EQ(msgLength, length);
+            EXPECT_EQ(buffer.getInt64(offset), 42);
+            EXPECT_EQ(buffer.getInt32(offset + 8), 7);
+            timesCalled++;
+        };
+
+    EXPECT_EQ(m_ringBuffer.read(handler), 0);
+
+    m_ringBuffer.commit(index);
+
+    EXPECT_EQ(m_ringBuffer.read(handler), 1);
+    EXPECT_EQ(timesCalled, 1);
+}
+
+TEST_F(ManyToOneRingBufferTest, shouldSkipAbortedClaim)
+{
+    util::index_t length = 12;
+    util::index_t alignedRecordLength = util::BitUtil::align(
+        length + RecordDescriptor::HEADER_LENGTH, RecordDescriptor::ALIGNMENT);
+
+    const util::index_t index = m_ringBuffer.tryClaim(MSG_TYPE_ID, length);
+    ASSERT_GT(index, 0);
+
+    m_ringBuffer.abort(index);
+    EXPECT_EQ(m_ab.getInt32(RecordDescriptor::typeOffset(0)), RecordDescriptor::PADDING_MSG_TYPE_ID);
+
+    int timesCalled = 0;
+    const int messagesRead = m_ringBuffer.read(
+        [&](std::int32_t, concurrent::AtomicBuffer &, util::index_t, util::index_t)
+        {
+            timesCalled++;
+        });
+
+    EXPECT_EQ(messagesRead, 0);
+    EXPECT_EQ(timesCalled, 0);
+    EXPECT_EQ(m_ab.getInt64(HEAD_COUNTER_INDEX), alignedRecordLength);
+}
+
+TEST_F(ManyToOneRingBufferTest, shouldThrowOnCommitOrAbortOfUnclaimedSpace)
+{
+    const util::index_t index = m_ringBuffer.tryClaim(MSG_TYPE_ID, 8);
+    ASSERT_GT(index, 0);
+
+    ASSERT_THROW(m_ringBuffer.commit(0), util::IllegalArgumentException);
+    ASSERT_THROW(m_ringBuffer.commit(CAPACITY + 8), util::IllegalArgumentException);
+
+    m_ringBuffer.commit(index);
+
+    ASSERT_THROW(m_ringBuffer.commit(index), util::IllegalStateException);
+    ASSERT_THROW(m_ringBuffer.abort(index), util::IllegalStateException);
+}
+
+TEST_F(ManyToOneRingBufferTest, shouldRejectClaimWhenBufferFull)
+{
+    const util::index_t insufficientCapacity = ManyToOneRingBuffer::INSUFFICIENT_CAPACITY;
+
+    m_ab.putInt64(HEAD_COUNTER_INDEX, 0);
+    m_ab.putInt64(TAIL_COUNTER_INDEX, CAPACITY);
+
+    EXPECT_EQ(m_ringBuffer.tryClaim(MSG_TYPE_ID, 8), insufficientCapacity);
+}
+
 TEST_F(ManyToOneRingBufferTest, shouldNotUnblockWhenEmpty)
 {
     util::index_t tail = RecordDescriptor::ALIGNMENT * 4;
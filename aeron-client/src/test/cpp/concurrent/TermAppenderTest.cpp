@@ -284,3 +284,42 @@ TEST_F(TermAppenderTest, shouldClaimRegionForZeroCopyEncoding)
 
     bufferClaim.commit();
 }
+
+TEST_F(TermAppenderTest, shouldAppendBatchWithSingleTailClaim)
+{
+    const util::index_t firstLength = 20;
+    const util::index_t secondLength = 100;
+    std::array<AtomicBuffer, 2> messages = { AtomicBuffer(m_srcBuffer.data(), firstLength),
+        AtomicBuffer(m_srcBuffer.data(), secondLength) };
+    const util::index_t firstFrameLength = DataFrameHeader::LENGTH + firstLength;
+    const util::index_t secondFrameLength = DataFrameHeader::LENGTH + secondLength;
+    const util::index_t firstAlignedLength = util::BitUtil::align(firstFrameLength, FrameDescriptor::FRAME_ALIGNMENT);
+    const util::index_t batchLength =
+        firstAlignedLength + util::BitUtil::align(secondFrameLength, FrameDescriptor::FRAME_ALIGNMENT);
+    util::index_t tail = 0;
+    std::size_t appendedCount = 0;
+    testing::Sequence sequence;
+
+    EXPECT_CALL(m_metaDataBuffer, getAndAddInt64(TERM_TAIL_OFFSET, batchLength))
+        .Times(1)
+        .InSequence(sequence)
+        .WillOnce(testing::Return(packRawTail(TERM_ID, tail)));
+
+    EXPECT_CALL(m_termBuffer, putInt32Ordered(FrameDescriptor::lengthOffset(tail), -firstFrameLength))
+        .Times(1)
+        .InSequence(sequence);
+    EXPECT_CALL(m_termBuffer, putInt32Ordered(FrameDescriptor::lengthOffset(tail), firstFrameLength))
+        .Times(1)
+        .InSequence(sequence);
+    EXPECT_CALL(m_termBuffer, putInt32Ordered(FrameDescriptor::lengthOffset(firstAlignedLength), -secondFrameLength))
+        .Times(1)
+        .InSequence(sequence);
+    EXPECT_CALL(m_termBuffer, putInt32Ordered(FrameDescriptor::lengthOffset(firstAlignedLength), secondFrameLength))
+        .Times(1)
+        .InSequence(sequence);
+
+    const std::int32_t resultingOffset = m_termAppender.appendUnfragmentedBatch(
+        m_headerWriter, messages.begin(), messages.end(), batchLength, appendedCount, reservedValueSupplier, TERM_ID);
+    EXPECT_EQ(resultingOffset, batchLength);
+    EXPECT_EQ(appendedCount, 2u);
+}
@@ -229,3 +229,52 @@ TEST_F(TermBlockScannerTest, shouldReadBlockOfOneMessageThenPadding)
     const std::int32_t offsetTwo = TermBlockScanner::scan(m_log, offsetOne, limitOffset);
     EXPECT_EQ(offsetTwo, alignedMessageLength * 2);
 }
+
+TEST_F(TermBlockScannerTest, shouldEndMessageScanBeforeIncompleteFragmentedMessage)
+{
+    const std::int32_t offset = 0;
+    const std::int32_t limitOffset = m_log.capacity();
+    const std::int32_t messageLength = 50;
+    const std::int32_t alignedMessageLength = util::BitUtil::align(messageLength, FrameDescriptor::FRAME_ALIGNMENT);
+
+    m_logBuffer[FrameDescriptor::flagsOffset(offset)] = FrameDescriptor::UNFRAGMENTED;
+    m_logBuffer[FrameDescriptor::flagsOffset(alignedMessageLength)] = FrameDescriptor::BEGIN_FRAG;
+
+    EXPECT_CALL(m_log, getInt32Volatile(FrameDescriptor::lengthOffset(offset)))
+        .WillOnce(testing::Return(messageLength));
+    EXPECT_CALL(m_log, getUInt16(FrameDescriptor::typeOffset(offset)))
+        .WillOnce(testing::Return(DataFrameHeader::HDR_TYPE_DATA));
+    EXPECT_CALL(m_log, getInt32Volatile(FrameDescriptor::lengthOffset(alignedMessageLength)))
+        .WillOnce(testing::Return(messageLength));
+    EXPECT_CALL(m_log, getUInt16(FrameDescriptor::typeOffset(alignedMessageLength)))
+        .WillOnce(testing::Return(DataFrameHeader::HDR_TYPE_DATA));
+    EXPECT_CALL(m_log, getInt32Volatile(FrameDescriptor::lengthOffset(alignedMessageLength * 2)))
+        .WillOnce(testing::Return(0));
+
+    const std::int32_t newOffset = TermBlockScanner::scanMessages(m_log, offset, limitOffset, true);
+
+    EXPECT_EQ(newOffset, alignedMessageLength);
+}
+
+TEST_F(TermBlockScannerTest, shouldExtendMessageScanPastLimitToCompleteFirstMessage)
+{
+    const std::int32_t offset = 0;
+    const std::int32_t messageLength = 50;
+    const std::int32_t alignedMessageLength = util::BitUtil::align(messageLength, FrameDescriptor::FRAME_ALIGNMENT);
+    const std::int32_t limitOffset = alignedMessageLength;
+
+    m_logBuffer[FrameDescriptor::flagsOffset(offset)] = FrameDescriptor::BEGIN_FRAG;
+    m_logBuffer[FrameDescriptor::flagsOffset(alignedMessageLength)] = FrameDescriptor::END_FRAG;
+
+    EXPECT_CALL(m_log, getInt32Volatile(FrameDescriptor::lengthOffset(offset)))
+        .WillRepeatedly(testing::Return(messageLength));
+    EXPECT_CALL(m_log, getUInt16(FrameDescriptor::typeOffset(offset)))
+        .WillRepeatedly(testing::Return(DataFrameHeader::HDR_TYPE_DATA));
+    EXPECT_CALL(m_log, getInt32Volatile(FrameDescriptor::lengthOffset(alignedMessageLength)))
+        .WillRepeatedly(testing::Return(messageLength));
+    EXPECT_CALL(m_log, getUInt16(FrameDescriptor::typeOffset(alignedMessageLength)))
+        .WillRepeatedly(testing::Return(DataFrameHeader::HDR_TYPE_DATA));
+
+    EXPECT_EQ(TermBlockScanner::scanMessages(m_log, offset, limitOffset, true), alignedMessageLength * 2);
+    EXPECT_EQ(TermBlockScanner::scanMessages(m_log, offset, limitOffset, false), offset);
+}
@@ -154,3 +154,34 @@ TEST_F(TermGapScannerTest, shouldReportNoGapWhenHwmIsInPadding)
 
     EXPECT_FALSE(called);
 }
+
+TEST_F(TermGapScannerTest, shouldReportGapAfterRunOfEqualFrames)
+{
+    bool called = false;
+    const std::int32_t frameLength = FrameDescriptor::ALIGNED_HEADER_LENGTH * 2;
+    const std::int32_t frameCount = 9;
+    const std::int32_t gapBegin = frameLength * frameCount;
+    const std::int32_t gapLength = FrameDescriptor::ALIGNED_HEADER_LENGTH * 13;
+    const std::int32_t highWaterMark = gapBegin + gapLength + FrameDescriptor::ALIGNED_HEADER_LENGTH;
+
+    EXPECT_CALL(m_termBuffer, getInt32Volatile(testing::_)).WillRepeatedly(testing::Return(0));
+    for (std::int32_t i = 0; i < frameCount; i++)
+    {
+        EXPECT_CALL(m_termBuffer, getInt32Volatile(i * frameLength)).WillRepeatedly(testing::Return(frameLength));
+    }
+    EXPECT_CALL(m_termBuffer, getInt32Volatile(gapBegin + gapLength))
+        .WillRepeatedly(testing::Return(DataFrameHeader::LENGTH));
+
+    auto f =
+        [&](std::int32_t termId, AtomicBuffer &buffer, std::int32_t offset, std::int32_t length)
+        {
+            EXPECT_EQ(TERM_ID, termId);
+            EXPECT_EQ(gapBegin, offset);
+            EXPECT_EQ(gapLength, length);
+            called = true;
+        };
+
+    EXPECT_EQ(gapBegin, TermGapScanner::scanForGap(m_termBuffer, TERM_ID, 0, highWaterMark, f));
+
+    EXPECT_TRUE(called);
+}
@@ -15,10 +15,12 @@
  */
 
 #include <cstdint>
+#include <vector>
 
 #include "util/ScopeUtils.h"
 #include "util/StringUtil.h"
 #include "util/BitUtil.h"
+#include "util/MemoryUtil.h"
 #include "TestUtils.h"
 
 #include <gtest/gtest.h>
@@ -105,6 +107,28 @@ TEST(utilTests, numberOfTrailingZeroes)
     EXPECT_EQ(BitUtil::numberOfTrailingZeroes<std::uint32_t>(0x00000001), 0);
 }
 
+TEST(utilTests, nonTemporalCopyShouldMatchSourceForUnalignedOffsetsAndLengths)
+{
+    std::vector<std::uint8_t> src(4096 + 64);
+    for (std::size_t i = 0; i < src.size(); i++)
+    {
+        src[i] = static_cast<std::uint8_t>(i * 7);
+    }
+
+    for (std::size_t offset = 0; offset < 33; offset += 3)
+    {
+        for (std::size_t length : { 0, 1, 15, 31, 127, 129, 4000 })
+        {
+            std::vector<std::uint8_t> dst(src.size(), 0);
+
+            MemoryUtil::nonTemporalCopy(dst.data() + offset, src.data() + 1, length);
+
+            EXPECT_EQ(0, ::memcmp(dst.data() + offset, src.data() + 1, length)) << offset << ":" << length;
+            EXPECT_EQ(0u, dst[offset + length]);
+        }
+    }
+}
+
 void throwIllegalArgumentException()
 {
     aeron::test::throwIllegalArgumentException();
@@ -0,0 +1,126 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "EmbeddedMediaDriver.h"
+#include "Aeron.h"
+
+using namespace aeron::wrapper;
+
+#define IPC_CHANNEL "aeron:ipc"
+#define STREAM_ID (1001)
+
+class WrapperSystemTest : public testing::Test
+{
+public:
+    WrapperSystemTest()
+    {
+        m_driver.start();
+    }
+
+    ~WrapperSystemTest() override
+    {
+        m_driver.stop();
+    }
+
+    template<typename P>
+    static void awaitConnected(P &publication)
+    {
+        while (!publication->isConnected())
+        {
+            std::this_thread::yield();
+        }
+    }
+
+protected:
+    aeron::EmbeddedMediaDriver m_driver;
+};
+
+TEST_F(WrapperSystemTest, shouldOfferAndPollWithLambdaHandler)
+{
+    std::shared_ptr<Aeron> aeron = Aeron::connect();
+    std::shared_ptr<Subscription> subscription = aeron->addSubscription(IPC_CHANNEL, STREAM_ID);
+    std::shared_ptr<Publication> publication = aeron->addPublication(IPC_CHANNEL, STREAM_ID);
+
+    EXPECT_EQ(publication->streamId(), STREAM_ID);
+    EXPECT_EQ(subscription->channel(), IPC_CHANNEL);
+    awaitConnected(publication);
+
+    const char message[] = "hello wrapper";
+    while (publication->offer(reinterpret_cast<const std::uint8_t *>(message), sizeof(message)) < 0)
+    {
+        std::this_thread::yield();
+    }
+
+    std::string received;
+    auto handler =
+        [&](const std::uint8_t *buffer, std::size_t length, aeron_header_t *header)
+        {
+            received.assign(reinterpret_cast<const char *>(buffer), length - 1);
+        };
+
+    while (0 == subscription->poll(handler, 10))
+    {
+        std::this_thread::yield();
+    }
+
+    EXPECT_EQ(received, message);
+}
+
+TEST_F(WrapperSystemTest, shouldClaimAndRetainFragmentsOnAbort)
+{
+    std::shared_ptr<Aeron> aeron = Aeron::connect();
+    std::shared_ptr<Subscription> subscription = aeron->addSubscription(IPC_CHANNEL, STREAM_ID);
+    std::shared_ptr<ExclusivePublication> publication = aeron->addExclusivePublication(IPC_CHANNEL, STREAM_ID);
+
+    awaitConnected(publication);
+
+    const std::int64_t value = 42;
+    aeron_buffer_claim_t bufferClaim;
+    while (publication->tryClaim(sizeof(value), bufferClaim) < 0)
+    {
+        std::this_thread::yield();
+    }
+
+    std::memcpy(bufferClaim.data, &value, sizeof(value));
+    ASSERT_EQ(aeron_buffer_claim_commit(&bufferClaim), 0);
+
+    int aborts = 0;
+    std::int64_t received = 0;
+    auto handler =
+        [&](const std::uint8_t *buffer, std::size_t length, aeron_header_t *header)
+        {
+            if (0 == aborts++)
+            {
+                return AERON_ACTION_ABORT;
+            }
+
+            std::memcpy(&received, buffer, sizeof(received));
+            return AERON_ACTION_CONTINUE;
+        };
+
+    while (0 == subscription->controlledPoll(handler, 10))
+    {
+        std::this_thread::yield();
+    }
+
+    EXPECT_EQ(aborts, 2);
+    EXPECT_EQ(received, value);
+}
@@ -0,0 +1,342 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "EmbeddedMediaDriver.h"
+
+extern "C"
+{
+#include "aeronc.h"
+}
+
+/*
+ * Measures how the latency of driver commands grows with the number of resources the conductor already holds. Each
+ * benchmark starts an embedded driver, adds the number of background resources given by its argument and then
+ * repeatedly adds and removes one more, timing from the add until the client sees the driver's response. The p50 and
+ * p99 of that latency are reported as counters next to the resource count.
+ *
+ * The client runs in invoker mode on the benchmark thread so the time is the driver's, not a hand off to a client
+ * conductor thread.
+ */
+
+#define IPC_CHANNEL "aeron:ipc?term-length=64k"
+#define MEASURED_STREAM_ID (1)
+#define BACKGROUND_STREAM_ID_BASE (1000)
+#define ITERATIONS (2000)
+
+using namespace aeron;
+
+class ConductorBenchmarkDriver : public EmbeddedMediaDriver
+{
+protected:
+    void configure(aeron_driver_context_t *context) override
+    {
+        aeron_driver_context_set_shared_idle_strategy(context, "yield");
+        aeron_driver_context_set_ipc_term_buffer_length(context, 64 * 1024);
+        aeron_driver_context_set_publication_linger_timeout_ns(context, 1000 * 1000LL);
+        aeron_driver_context_set_timer_interval_ns(context, 10 * 1000 * 1000LL);
+        aeron_driver_context_set_counters_buffer_length(context, 4 * 1024 * 1024);
+    }
+};
+
+class ConductorFixture : public benchmark::Fixture
+{
+public:
+    void SetUp(const ::benchmark::State &state) override
+    {
+        m_latencies.clear();
+        m_latencies.reserve(ITERATIONS);
+        m_driver.reset(new ConductorBenchmarkDriver());
+        m_driver->start();
+        m_client = connect(&m_context);
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        for (aeron_publication_t *publication : m_publications)
+        {
+            aeron_publication_close(publication, nullptr, nullptr);
+        }
+        m_publications.clear();
+
+        for (aeron_subscription_t *subscription : m_subscriptions)
+        {
+            aeron_subscription_close(subscription, nullptr, nullptr);
+        }
+        m_subscriptions.clear();
+
+        for (aeron_counter_t *counter : m_counters)
+        {
+            aeron_counter_close(counter, nullptr, nullptr);
+        }
+        m_counters.clear();
+
+        for (size_t i = 0; i < m_clients.size(); i++)
+        {
+            aeron_close(m_clients[i]);
+            aeron_context_close(m_clientContexts[i]);
+        }
+        m_clients.clear();
+        m_clientContexts.clear();
+
+        aeron_close(m_client);
+        aeron_context_close(m_context);
+        m_driver->stop();
+        m_driver.reset();
+    }
+
+    static aeron_t *connect(aeron_context_t **context)
+    {
+        aeron_t *client = nullptr;
+
+        if (aeron_context_init(context) < 0 ||
+            aeron_context_set_use_conductor_agent_invoker(*context, true) < 0 ||
+            aeron_init(&client, *context) < 0 ||
+            aeron_start(client) < 0)
+        {
+            throw std::runtime_error(aeron_errmsg());
+        }
+
+        return client;
+    }
+
+    /*
+     * Yield when there is no work so the driver thread is not starved on machines with few cores.
+     */
+    static void idle(aeron_t *client)
+    {
+        if (0 == aeron_main_do_work(client))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    template<typename R, typename A>
+    static R *await(aeron_t *client, A *async, int (*poll)(R **, A *))
+    {
+        R *resource = nullptr;
+        int result;
+
+        while (0 == (result = poll(&resource, async)))
+        {
+            idle(client);
+        }
+
+        if (result < 0)
+        {
+            throw std::runtime_error(aeron_errmsg());
+        }
+
+        return resource;
+    }
+
+    aeron_publication_t *addPublication(aeron_t *client, int32_t stream_id)
+    {
+        aeron_async_add_publication_t *async = nullptr;
+
+        if (aeron_async_add_publication(&async, client, IPC_CHANNEL, stream_id) < 0)
+        {
+            throw std::runtime_error(aeron_errmsg());
+        }
+
+        return await(client, async, aeron_async_add_publication_poll);
+    }
+
+    aeron_subscription_t *addSubscription(aeron_t *client, int32_t stream_id)
+    {
+        aeron_async_add_subscription_t *async = nullptr;
+
+        if (aeron_async_add_subscription(
+            &async, client, IPC_CHANNEL, stream_id, nullptr, nullptr, nullptr, nullptr) < 0)
+        {
+            throw std::runtime_error(aeron_errmsg());
+        }
+
+        return await(client, async, aeron_async_add_subscription_poll);
+    }
+
+    aeron_counter_t *addCounter(aeron_t *client)
+    {
+        aeron_async_add_counter_t *async = nullptr;
+        const char label[] = "benchmark counter";
+
+        if (aeron_async_add_counter(&async, client, 1001, nullptr, 0, label, sizeof(label) - 1) < 0)
+        {
+            throw std::runtime_error(aeron_errmsg());
+        }
+
+        return await(client, async, aeron_async_add_counter_poll);
+    }
+
+    void keepBackgroundClientsAlive()
+    {
+        for (aeron_t *client : m_clients)
+        {
+            aeron_main_do_work(client);
+        }
+    }
+
+    template<typename F>
+    void measure(benchmark::State &state, F &&operation)
+    {
+        for (auto _ : state)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            operation();
+            const auto end = std::chrono::steady_clock::now();
+
+            m_latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+
+            if (0 == (m_latencies.size() & 63))
+            {
+                keepBackgroundClientsAlive();
+            }
+        }
+
+        std::sort(m_latencies.begin(), m_latencies.end());
+        state.counters["resources"] = static_cast<double>(state.range(0));
+        state.counters["p50_ns"] = static_cast<double>(m_latencies[m_latencies.size() / 2]);
+        state.counters["p99_ns"] = static_cast<double>(m_latencies[(m_latencies.size() * 99) / 100]);
+    }
+
+protected:
+    std::unique_ptr<ConductorBenchmarkDriver> m_driver;
+    aeron_context_t *m_context = nullptr;
+    aeron_t *m_client = nullptr;
+    std::vector<aeron_publication_t *> m_publications;
+    std::vector<aeron_subscription_t *> m_subscriptions;
+    std::vector<aeron_counter_t *> m_counters;
+    std::vector<aeron_context_t *> m_clientContexts;
+    std::vector<aeron_t *> m_clients;
+    std::vector<std::int64_t> m_latencies;
+};
+
+BENCHMARK_DEFINE_F(ConductorFixture, AddRemovePublication)(benchmark::State &state)
+{
+    for (int64_t i = 0; i < state.range(0); i++)
+    {
+        m_publications.push_back(addPublication(m_client, BACKGROUND_STREAM_ID_BASE + (int32_t)i));
+    }
+
+    measure(state, [&]()
+    {
+        aeron_publication_close(addPublication(m_client, MEASURED_STREAM_ID), nullptr, nullptr);
+    });
+}
+
+BENCHMARK_REGISTER_F(ConductorFixture, AddRemovePublication)
+    ->RangeMultiplier(4)->Range(1, 1024)->Iterations(ITERATIONS)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_DEFINE_F(ConductorFixture, AddRemoveSubscription)(benchmark::State &state)
+{
+    for (int64_t i = 0; i < state.range(0); i++)
+    {
+        m_subscriptions.push_back(addSubscription(m_client, BACKGROUND_STREAM_ID_BASE + (int32_t)i));
+    }
+
+    measure(state, [&]()
+    {
+        aeron_subscription_close(addSubscription(m_client, MEASURED_STREAM_ID), nullptr, nullptr);
+    });
+}
+
+BENCHMARK_REGISTER_F(ConductorFixture, AddRemoveSubscription)
+    ->RangeMultiplier(4)->Range(1, 4096)->Iterations(ITERATIONS)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_DEFINE_F(ConductorFixture, AddRemoveCounter)(benchmark::State &state)
+{
+    for (int64_t i = 0; i < state.range(0); i++)
+    {
+        m_counters.push_back(addCounter(m_client));
+    }
+
+    measure(state, [&]()
+    {
+        aeron_counter_close(addCounter(m_client), nullptr, nullptr);
+    });
+}
+
+BENCHMARK_REGISTER_F(ConductorFixture, AddRemoveCounter)
+    ->RangeMultiplier(4)->Range(1, 4096)->Iterations(ITERATIONS)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+/*
+ * Adds and removes a subscription to a stream that already has a publication, so each iteration links the
+ * subscription and creates an image, with the argument giving the number of other publication and subscription pairs
+ * which already have images.
+ */
+BENCHMARK_DEFINE_F(ConductorFixture, ImageChurn)(benchmark::State &state)
+{
+    for (int64_t i = 0; i < state.range(0); i++)
+    {
+        const int32_t stream_id = BACKGROUND_STREAM_ID_BASE + (int32_t)i;
+        m_publications.push_back(addPublication(m_client, stream_id));
+        m_subscriptions.push_back(addSubscription(m_client, stream_id));
+    }
+
+    m_publications.push_back(addPublication(m_client, MEASURED_STREAM_ID));
+
+    measure(state, [&]()
+    {
+        aeron_subscription_t *subscription = addSubscription(m_client, MEASURED_STREAM_ID);
+
+        while (0 == aeron_subscription_image_count(subscription))
+        {
+            idle(m_client);
+        }
+
+        aeron_subscription_close(subscription, nullptr, nullptr);
+    });
+}
+
+BENCHMARK_REGISTER_F(ConductorFixture, ImageChurn)
+    ->RangeMultiplier(4)->Range(1, 256)->Iterations(ITERATIONS)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+/*
+ * Adds and removes a counter from one client while the argument gives the number of other connected clients, each
+ * holding a counter, which the conductor has to service for keepalives and timeouts.
+ */
+BENCHMARK_DEFINE_F(ConductorFixture, ManyClients)(benchmark::State &state)
+{
+    for (int64_t i = 0; i < state.range(0); i++)
+    {
+        aeron_context_t *context = nullptr;
+        aeron_t *client = connect(&context);
+
+        m_clientContexts.push_back(context);
+        m_clients.push_back(client);
+        m_counters.push_back(addCounter(client));
+    }
+
+    measure(state, [&]()
+    {
+        aeron_counter_close(addCounter(m_client), nullptr, nullptr);
+    });
+}
+
+BENCHMARK_REGISTER_F(ConductorFixture, ManyClients)
+    ->RangeMultiplier(4)->Range(1, 256)->Iterations(ITERATIONS)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,175 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+#include <errno.h>
+
+#include "aeron_alloc.h"
+#include "aeron_async_name_resolver.h"
+#include "util/aeron_error.h"
+#include "util/aeron_strutil.h"
+
+int aeron_async_name_resolver_init(aeron_async_name_resolver_t *async_resolver, aeron_driver_context_t *context)
+{
+    if (aeron_default_name_resolver_supplier(&async_resolver->resolver, NULL, context) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_spsc_concurrent_array_queue_init(
+        &async_resolver->request_queue, AERON_ASYNC_NAME_RESOLVER_QUEUE_CAPACITY) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_spsc_concurrent_array_queue_init(
+        &async_resolver->completion_queue, AERON_ASYNC_NAME_RESOLVER_QUEUE_CAPACITY) < 0)
+    {
+        aeron_spsc_concurrent_array_queue_close(&async_resolver->request_queue);
+        return -1;
+    }
+
+    async_resolver->pending_completion = NULL;
+    async_resolver->idle_sleep_ns = AERON_ASYNC_NAME_RESOLVER_IDLE_SLEEP_NS;
+
+    return 0;
+}
+
+int aeron_async_name_resolver_offer(
+    aeron_async_name_resolver_t *async_resolver,
+    const char *endpoint_name,
+    const char *uri_param_name,
+    bool is_control,
+    void *endpoint,
+    void *destination,
+    struct sockaddr_storage *existing_addr)
+{
+    aeron_async_name_resolution_t *resolution = NULL;
+
+    if (strlen(endpoint_name) >= sizeof(resolution->name))
+    {
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&resolution, sizeof(aeron_async_name_resolution_t)) < 0)
+    {
+        return -1;
+    }
+
+    strncpy(resolution->name, endpoint_name, sizeof(resolution->name) - 1);
+    resolution->uri_param_name = uri_param_name;
+    resolution->endpoint_name = endpoint_name;
+    resolution->endpoint = endpoint;
+    resolution->destination = destination;
+    resolution->is_control = is_control;
+    memcpy(&resolution->existing_addr, existing_addr, sizeof(resolution->existing_addr));
+    resolution->result = 0;
+    resolution->errcode = 0;
+
+    if (AERON_OFFER_SUCCESS != aeron_spsc_concurrent_array_queue_offer(&async_resolver->request_queue, resolution))
+    {
+        aeron_free(resolution);
+        return -1;
+    }
+
+    return 0;
+}
+
+int aeron_async_name_resolver_poll(
+    aeron_async_name_resolver_t *async_resolver,
+    aeron_async_name_resolver_completion_func_t handler,
+    void *clientd,
+    size_t limit)
+{
+    int work_count = 0;
+    aeron_async_name_resolution_t *resolution;
+
+    while ((size_t)work_count < limit &&
+        NULL != (resolution = (aeron_async_name_resolution_t *)aeron_spsc_concurrent_array_queue_poll(
+            &async_resolver->completion_queue)))
+    {
+        handler(clientd, resolution);
+        aeron_free(resolution);
+        work_count++;
+    }
+
+    return work_count;
+}
+
+int aeron_async_name_resolver_do_work(void *clientd)
+{
+    aeron_async_name_resolver_t *async_resolver = (aeron_async_name_resolver_t *)clientd;
+    aeron_async_name_resolution_t *resolution = async_resolver->pending_completion;
+
+    if (NULL == resolution)
+    {
+        resolution = (aeron_async_name_resolution_t *)aeron_spsc_concurrent_array_queue_poll(
+            &async_resolver->request_queue);
+
+        if (NULL == resolution)
+        {
+            return 0;
+        }
+
+        memset(&resolution->resolved_addr, 0, sizeof(resolution->resolved_addr));
+        resolution->result = aeron_name_resolver_resolve_host_and_port(
+            &async_resolver->resolver,
+            resolution->name,
+            resolution->uri_param_name,
+            true,
+            &resolution->resolved_addr);
+
+        if (resolution->result < 0)
+        {
+            resolution->errcode = aeron_errcode();
+            strncpy(resolution->errmsg, aeron_errmsg(), sizeof(resolution->errmsg) - 1);
+            resolution->errmsg[sizeof(resolution->errmsg) - 1] = '\0';
+        }
+    }
+
+    /* the conductor may be behind on completions, hold on to the result rather than resolving it again */
+    if (AERON_OFFER_SUCCESS != aeron_spsc_concurrent_array_queue_offer(&async_resolver->completion_queue, resolution))
+    {
+        async_resolver->pending_completion = resolution;
+        return 0;
+    }
+
+    async_resolver->pending_completion = NULL;
+
+    return 1;
+}
+
+static void aeron_async_name_resolver_free_resolution(void *clientd, volatile void *item)
+{
+    aeron_free((void *)item);
+}
+
+void aeron_async_name_resolver_on_close(void *clientd)
+{
+    aeron_async_name_resolver_t *async_resolver = (aeron_async_name_resolver_t *)clientd;
+
+    aeron_free(async_resolver->pending_completion);
+    async_resolver->pending_completion = NULL;
+
+    aeron_spsc_concurrent_array_queue_drain_all(
+        &async_resolver->request_queue, aeron_async_name_resolver_free_resolution, NULL);
+    aeron_spsc_concurrent_array_queue_drain_all(
+        &async_resolver->completion_queue, aeron_async_name_resolver_free_resolution, NULL);
+    aeron_spsc_concurrent_array_queue_close(&async_resolver->request_queue);
+    aeron_spsc_concurrent_array_queue_close(&async_resolver->completion_queue);
+
+    async_resolver->resolver.close_func(&async_resolver->resolver);
+}
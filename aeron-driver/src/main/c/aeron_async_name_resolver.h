@@ -0,0 +1,90 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_ASYNC_NAME_RESOLVER_H
+#define AERON_ASYNC_NAME_RESOLVER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "aeron_socket.h"
+#include "aeron_name_resolver.h"
+#include "concurrent/aeron_spsc_concurrent_array_queue.h"
+
+#define AERON_ASYNC_NAME_RESOLVER_QUEUE_CAPACITY (256)
+#define AERON_ASYNC_NAME_RESOLVER_IDLE_SLEEP_NS (1000 * 1000LL)
+
+typedef struct aeron_async_name_resolution_stct
+{
+    char name[AERON_MAX_HOSTNAME_LEN];
+    const char *uri_param_name;
+    const char *endpoint_name;
+    void *endpoint;
+    void *destination;
+    bool is_control;
+    struct sockaddr_storage existing_addr;
+    struct sockaddr_storage resolved_addr;
+    int result;
+    int errcode;
+    char errmsg[AERON_MAX_PATH];
+}
+aeron_async_name_resolution_t;
+
+/*
+ * Re-resolves endpoint and control names on a background agent so a slow lookup does not stall the conductor. Only
+ * the default resolver is used as it holds no state, resolutions are handed back to the conductor through the
+ * completion queue with the original endpoint and destination for it to validate before applying.
+ */
+typedef struct aeron_async_name_resolver_stct
+{
+    aeron_name_resolver_t resolver;
+    aeron_spsc_concurrent_array_queue_t request_queue;
+    aeron_spsc_concurrent_array_queue_t completion_queue;
+    aeron_async_name_resolution_t *pending_completion;
+    uint64_t idle_sleep_ns;
+}
+aeron_async_name_resolver_t;
+
+int aeron_async_name_resolver_init(aeron_async_name_resolver_t *async_resolver, aeron_driver_context_t *context);
+
+/*
+ * Queue a re-resolution, returns -1 if it could not be queued and the caller should resolve synchronously.
+ */
+int aeron_async_name_resolver_offer(
+    aeron_async_name_resolver_t *async_resolver,
+    const char *endpoint_name,
+    const char *uri_param_name,
+    bool is_control,
+    void *endpoint,
+    void *destination,
+    struct sockaddr_storage *existing_addr);
+
+typedef void (*aeron_async_name_resolver_completion_func_t)(void *clientd, aeron_async_name_resolution_t *resolution);
+
+/*
+ * Drain completed resolutions on the conductor. The resolution is freed once the handler returns.
+ */
+int aeron_async_name_resolver_poll(
+    aeron_async_name_resolver_t *async_resolver,
+    aeron_async_name_resolver_completion_func_t handler,
+    void *clientd,
+    size_t limit);
+
+int aeron_async_name_resolver_do_work(void *clientd);
+
+void aeron_async_name_resolver_on_close(void *clientd);
+
+#endif //AERON_ASYNC_NAME_RESOLVER_H
@@ -20,11 +20,15 @@
 #endif
 
 #include <errno.h>
+#include <math.h>
+#include <string.h>
 #include "util/aeron_error.h"
 #include "util/aeron_dlopen.h"
+#include "uri/aeron_uri.h"
 #include "aeron_congestion_control.h"
 #include "aeron_alloc.h"
 #include "aeron_driver_context.h"
+#include "aeron_position.h"
 
 aeron_congestion_control_strategy_supplier_func_t aeron_congestion_control_strategy_supplier_load(
     const char *strategy_name)
@@ -132,3 +136,710 @@ int aeron_static_window_congestion_control_strategy_supplier(
 
     return 0;
 }
+
+int aeron_congestion_control_default_strategy_supplier(
+    aeron_congestion_control_strategy_t **strategy,
+    size_t channel_length,
+    const char *channel,
+    int32_t stream_id,
+    int32_t session_id,
+    int64_t registration_id,
+    int32_t term_length,
+    int32_t sender_mtu_length,
+    struct sockaddr_storage *control_address,
+    struct sockaddr_storage *src_address,
+    aeron_driver_context_t *context,
+    aeron_counters_manager_t *counters_manager)
+{
+    aeron_uri_t channel_uri;
+    aeron_congestion_control_strategy_supplier_func_t supplier_func = NULL;
+
+    if (aeron_uri_parse(channel_length, channel, &channel_uri) < 0)
+    {
+        return -1;
+    }
+
+    const char *cc_str = AERON_URI_UDP == channel_uri.type ?
+        aeron_uri_find_param_value(&channel_uri.params.udp.additional_params, AERON_URI_CC_KEY) : NULL;
+
+    if (NULL == cc_str || 0 == strcmp(cc_str, AERON_STATICWINDOWCONGESTIONCONTROL_CC_PARAM_VALUE))
+    {
+        supplier_func = aeron_static_window_congestion_control_strategy_supplier;
+    }
+    else if (0 == strcmp(cc_str, AERON_CUBICCONGESTIONCONTROL_CC_PARAM_VALUE))
+    {
+        supplier_func = aeron_cubic_congestion_control_strategy_supplier;
+    }
+    else if (0 == strcmp(cc_str, AERON_BBRCONGESTIONCONTROL_CC_PARAM_VALUE))
+    {
+        supplier_func = aeron_bbr_congestion_control_strategy_supplier;
+    }
+    else
+    {
+        aeron_set_err(EINVAL, "unsupported congestion control : cc=%s", cc_str);
+    }
+
+    aeron_uri_close(&channel_uri);
+
+    if (NULL == supplier_func)
+    {
+        return -1;
+    }
+
+    return supplier_func(
+        strategy,
+        channel_length,
+        channel,
+        stream_id,
+        session_id,
+        registration_id,
+        term_length,
+        sender_mtu_length,
+        control_address,
+        src_address,
+        context,
+        counters_manager);
+}
+
+#define AERON_CUBICCONGESTIONCONTROL_RTT_MEASUREMENT_TIMEOUT_NS (10 * 1000 * 1000LL)
+#define AERON_CUBICCONGESTIONCONTROL_SECOND_IN_NS (1000 * 1000 * 1000LL)
+#define AERON_CUBICCONGESTIONCONTROL_RTT_MAX_TIMEOUT_NS (AERON_CUBICCONGESTIONCONTROL_SECOND_IN_NS)
+#define AERON_CUBICCONGESTIONCONTROL_MAX_OUTSTANDING_RTT_MEASUREMENTS (1)
+
+#define AERON_CUBICCONGESTIONCONTROL_C (0.4)
+#define AERON_CUBICCONGESTIONCONTROL_B (0.2)
+
+typedef struct aeron_cubic_congestion_control_strategy_state_stct
+{
+    bool measure_rtt;
+    bool tcp_mode;
+    int32_t min_window;
+    int32_t mtu;
+    int32_t max_cwnd;
+    int32_t cwnd;
+    int32_t w_max;
+    int32_t outstanding_rtt_measurements;
+    int64_t last_loss_timestamp_ns;
+    int64_t last_update_timestamp_ns;
+    int64_t last_rtt_timestamp_ns;
+    int64_t window_update_timeout_ns;
+    int64_t rtt_ns;
+    double k;
+    aeron_atomic_counter_t rtt_indicator;
+    aeron_atomic_counter_t window_indicator;
+    aeron_counters_manager_t *counters_manager;
+}
+aeron_cubic_congestion_control_strategy_state_t;
+
+bool aeron_cubic_congestion_control_strategy_should_measure_rtt(void *state, int64_t now_ns)
+{
+    aeron_cubic_congestion_control_strategy_state_t *cubic_state =
+        (aeron_cubic_congestion_control_strategy_state_t *)state;
+
+    if (!cubic_state->measure_rtt)
+    {
+        return false;
+    }
+
+    /*
+     * There is no callback for a measurement being sent, so one is counted as outstanding when requested. A lost
+     * reply is given up on after the max timeout so measurement does not stop.
+     */
+    const bool max_timeout_expired =
+        (cubic_state->last_rtt_timestamp_ns + AERON_CUBICCONGESTIONCONTROL_RTT_MAX_TIMEOUT_NS) - now_ns < 0;
+    const bool measurement_timeout_expired =
+        (cubic_state->last_rtt_timestamp_ns + AERON_CUBICCONGESTIONCONTROL_RTT_MEASUREMENT_TIMEOUT_NS) - now_ns < 0;
+
+    if (max_timeout_expired ||
+        (cubic_state->outstanding_rtt_measurements < AERON_CUBICCONGESTIONCONTROL_MAX_OUTSTANDING_RTT_MEASUREMENTS &&
+        measurement_timeout_expired))
+    {
+        cubic_state->last_rtt_timestamp_ns = now_ns;
+        cubic_state->outstanding_rtt_measurements = 1;
+        return true;
+    }
+
+    return false;
+}
+
+void aeron_cubic_congestion_control_strategy_on_rttm(
+    void *state, int64_t now_ns, int64_t rtt_ns, struct sockaddr_storage *source_address)
+{
+    aeron_cubic_congestion_control_strategy_state_t *cubic_state =
+        (aeron_cubic_congestion_control_strategy_state_t *)state;
+
+    cubic_state->outstanding_rtt_measurements = 0;
+    cubic_state->last_rtt_timestamp_ns = now_ns;
+    cubic_state->rtt_ns = rtt_ns;
+    aeron_counter_set_ordered(cubic_state->rtt_indicator.value_addr, rtt_ns);
+}
+
+int32_t aeron_cubic_congestion_control_strategy_on_track_rebuild(
+    void *state,
+    bool *should_force_sm,
+    int64_t now_ns,
+    int64_t new_consumption_position,
+    int64_t last_sm_position,
+    int64_t hwm_position,
+    int64_t starting_rebuild_position,
+    int64_t ending_rebuild_position,
+    bool loss_occurred)
+{
+    aeron_cubic_congestion_control_strategy_state_t *cubic_state =
+        (aeron_cubic_congestion_control_strategy_state_t *)state;
+
+    *should_force_sm = false;
+
+    if (loss_occurred)
+    {
+        cubic_state->w_max = cubic_state->cwnd;
+        cubic_state->k = cbrt(
+            (double)cubic_state->w_max * AERON_CUBICCONGESTIONCONTROL_B / AERON_CUBICCONGESTIONCONTROL_C);
+        const int32_t cwnd = (int32_t)(cubic_state->cwnd * (1.0 - AERON_CUBICCONGESTIONCONTROL_B));
+        cubic_state->cwnd = cwnd > 1 ? cwnd : 1;
+        cubic_state->last_loss_timestamp_ns = now_ns;
+        *should_force_sm = true;
+    }
+    else if (cubic_state->cwnd < cubic_state->max_cwnd &&
+        (cubic_state->last_update_timestamp_ns + cubic_state->window_update_timeout_ns) - now_ns < 0)
+    {
+        // W_cubic = C(T - K)^3 + w_max
+        const double duration_since_decrease =
+            (double)(now_ns - cubic_state->last_loss_timestamp_ns) / (double)AERON_CUBICCONGESTIONCONTROL_SECOND_IN_NS;
+        const double diff_to_k = duration_since_decrease - cubic_state->k;
+        const double increase = AERON_CUBICCONGESTIONCONTROL_C * diff_to_k * diff_to_k * diff_to_k;
+        const int32_t cwnd = cubic_state->w_max + (int32_t)increase;
+
+        cubic_state->cwnd = cwnd < cubic_state->max_cwnd ? cwnd : cubic_state->max_cwnd;
+
+        // if using TCP mode, then check to see if we are in the TCP region
+        if (cubic_state->tcp_mode && cubic_state->cwnd < cubic_state->w_max)
+        {
+            // W_tcp(t) = w_max * (1 - B) + 3 * B / (2 - B) * t / RTT
+            const double rtt_in_seconds =
+                (double)cubic_state->rtt_ns / (double)AERON_CUBICCONGESTIONCONTROL_SECOND_IN_NS;
+            const double w_tcp =
+                (double)cubic_state->w_max * (1.0 - AERON_CUBICCONGESTIONCONTROL_B) +
+                ((3.0 * AERON_CUBICCONGESTIONCONTROL_B / (2.0 - AERON_CUBICCONGESTIONCONTROL_B)) *
+                (duration_since_decrease / rtt_in_seconds));
+
+            cubic_state->cwnd = cubic_state->cwnd > (int32_t)w_tcp ? cubic_state->cwnd : (int32_t)w_tcp;
+        }
+
+        cubic_state->last_update_timestamp_ns = now_ns;
+    }
+
+    const int32_t window = cubic_state->cwnd * cubic_state->mtu;
+    aeron_counter_set_ordered(cubic_state->window_indicator.value_addr, window);
+
+    return window;
+}
+
+int32_t aeron_cubic_congestion_control_strategy_initial_window_length(void *state)
+{
+    return ((aeron_cubic_congestion_control_strategy_state_t *)state)->min_window;
+}
+
+int aeron_cubic_congestion_control_strategy_fini(aeron_congestion_control_strategy_t *strategy)
+{
+    aeron_cubic_congestion_control_strategy_state_t *state = strategy->state;
+
+    if (NULL != state)
+    {
+        aeron_counters_manager_free(state->counters_manager, state->rtt_indicator.counter_id);
+        aeron_counters_manager_free(state->counters_manager, state->window_indicator.counter_id);
+    }
+
+    aeron_free(strategy->state);
+    aeron_free(strategy);
+
+    return 0;
+}
+
+int aeron_cubic_congestion_control_strategy_supplier(
+    aeron_congestion_control_strategy_t **strategy,
+    size_t channel_length,
+    const char *channel,
+    int32_t stream_id,
+    int32_t session_id,
+    int64_t registration_id,
+    int32_t term_length,
+    int32_t sender_mtu_length,
+    struct sockaddr_storage *control_address,
+    struct sockaddr_storage *src_address,
+    aeron_driver_context_t *context,
+    aeron_counters_manager_t *counters_manager)
+{
+    aeron_congestion_control_strategy_t *_strategy;
+
+    if (aeron_alloc((void **)&_strategy, sizeof(aeron_congestion_control_strategy_t)) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_alloc(&_strategy->state, sizeof(aeron_cubic_congestion_control_strategy_state_t)) < 0)
+    {
+        aeron_free(_strategy);
+        return -1;
+    }
+
+    _strategy->should_measure_rtt = aeron_cubic_congestion_control_strategy_should_measure_rtt;
+    _strategy->on_rttm = aeron_cubic_congestion_control_strategy_on_rttm;
+    _strategy->on_track_rebuild = aeron_cubic_congestion_control_strategy_on_track_rebuild;
+    _strategy->initial_window_length = aeron_cubic_congestion_control_strategy_initial_window_length;
+    _strategy->fini = aeron_cubic_congestion_control_strategy_fini;
+
+    aeron_cubic_congestion_control_strategy_state_t *state = _strategy->state;
+    const int32_t initial_window_length = (int32_t)context->initial_window_length;
+    const int32_t max_window_for_term = term_length / 2;
+    const int32_t max_window =
+        max_window_for_term < initial_window_length ? max_window_for_term : initial_window_length;
+
+    state->measure_rtt = context->cubic_congestion_control.measure_rtt;
+    state->tcp_mode = context->cubic_congestion_control.tcp_mode;
+    state->mtu = sender_mtu_length;
+    state->min_window = sender_mtu_length;
+    state->max_cwnd = max_window / sender_mtu_length;
+    state->cwnd = 1;
+    // initially set w_max to max window and act in the TCP and concave region initially
+    state->w_max = state->max_cwnd;
+    state->k = cbrt((double)state->w_max * AERON_CUBICCONGESTIONCONTROL_B / AERON_CUBICCONGESTIONCONTROL_C);
+
+    // determine interval for adjustment based on heuristic of MTU, max window, and/or RTT estimate
+    state->rtt_ns = (int64_t)context->cubic_congestion_control.initial_rtt_ns;
+    state->window_update_timeout_ns = state->rtt_ns;
+    state->outstanding_rtt_measurements = 0;
+    state->last_rtt_timestamp_ns = 0;
+    state->counters_manager = counters_manager;
+
+    state->rtt_indicator.counter_id = aeron_stream_counter_allocate(
+        counters_manager,
+        AERON_CUBICCONGESTIONCONTROL_RTT_INDICATOR_NAME,
+        AERON_COUNTER_PER_IMAGE_TYPE_ID,
+        registration_id,
+        session_id,
+        stream_id,
+        channel_length,
+        channel,
+        "");
+    if (state->rtt_indicator.counter_id < 0)
+    {
+        aeron_free(_strategy->state);
+        aeron_free(_strategy);
+        return -1;
+    }
+
+    state->window_indicator.counter_id = aeron_stream_counter_allocate(
+        counters_manager,
+        AERON_CUBICCONGESTIONCONTROL_WINDOW_INDICATOR_NAME,
+        AERON_COUNTER_PER_IMAGE_TYPE_ID,
+        registration_id,
+        session_id,
+        stream_id,
+        channel_length,
+        channel,
+        "");
+    if (state->window_indicator.counter_id < 0)
+    {
+        aeron_counters_manager_free(counters_manager, state->rtt_indicator.counter_id);
+        aeron_free(_strategy->state);
+        aeron_free(_strategy);
+        return -1;
+    }
+
+    state->rtt_indicator.value_addr = aeron_counters_manager_addr(counters_manager, state->rtt_indicator.counter_id);
+    state->window_indicator.value_addr = aeron_counters_manager_addr(
+        counters_manager, state->window_indicator.counter_id);
+
+    aeron_counter_set_ordered(state->rtt_indicator.value_addr, 0);
+    aeron_counter_set_ordered(state->window_indicator.value_addr, state->min_window);
+
+    state->last_loss_timestamp_ns = aeron_clock_cached_nano_time(context->cached_clock);
+    state->last_update_timestamp_ns = state->last_loss_timestamp_ns;
+
+    *strategy = _strategy;
+
+    return 0;
+}
+
+#define AERON_BBRCONGESTIONCONTROL_STARTUP_GAIN (2.885)
+#define AERON_BBRCONGESTIONCONTROL_WINDOW_GAIN (2.0)
+#define AERON_BBRCONGESTIONCONTROL_FULL_BW_THRESHOLD (1.25)
+#define AERON_BBRCONGESTIONCONTROL_FULL_BW_ROUNDS (3)
+#define AERON_BBRCONGESTIONCONTROL_BW_FILTER_ROUNDS (10)
+#define AERON_BBRCONGESTIONCONTROL_MIN_RTT_WINDOW_NS (10 * 1000 * 1000 * 1000LL)
+#define AERON_BBRCONGESTIONCONTROL_PROBE_RTT_DURATION_NS (200 * 1000 * 1000LL)
+#define AERON_BBRCONGESTIONCONTROL_DEFAULT_ROUND_NS (10 * 1000 * 1000LL)
+#define AERON_BBRCONGESTIONCONTROL_MIN_ROUND_NS (1000 * 1000LL)
+#define AERON_BBRCONGESTIONCONTROL_RTT_MEASUREMENT_INTERVAL_NS (10 * 1000 * 1000LL)
+#define AERON_BBRCONGESTIONCONTROL_RTT_MAX_TIMEOUT_NS (1000 * 1000 * 1000LL)
+#define AERON_BBRCONGESTIONCONTROL_MIN_WINDOW_MTUS (4)
+#define AERON_BBRCONGESTIONCONTROL_INITIAL_WINDOW_MTUS (16)
+
+typedef enum aeron_bbr_congestion_control_mode_en
+{
+    AERON_BBRCONGESTIONCONTROL_MODE_STARTUP,
+    AERON_BBRCONGESTIONCONTROL_MODE_PROBE_BW,
+    AERON_BBRCONGESTIONCONTROL_MODE_PROBE_RTT
+}
+aeron_bbr_congestion_control_mode_t;
+
+typedef struct aeron_bbr_congestion_control_strategy_state_stct
+{
+    aeron_bbr_congestion_control_mode_t mode;
+    bool full_bw_reached;
+    bool has_round_start;
+    bool rtt_outstanding;
+    int32_t mtu;
+    int32_t min_window;
+    int32_t max_window;
+    int32_t window;
+    int32_t full_bw_count;
+    int64_t full_bw;
+    int64_t max_bw;
+    int64_t bw_samples[AERON_BBRCONGESTIONCONTROL_BW_FILTER_ROUNDS];
+    int64_t round_count;
+    int64_t round_start_ns;
+    int64_t round_start_position;
+    int64_t min_rtt_ns;
+    int64_t min_rtt_timestamp_ns;
+    int64_t probe_rtt_min_ns;
+    int64_t probe_rtt_done_ns;
+    int64_t last_rtt_request_ns;
+    aeron_atomic_counter_t rtt_indicator;
+    aeron_atomic_counter_t bw_indicator;
+    aeron_atomic_counter_t window_indicator;
+    aeron_counters_manager_t *counters_manager;
+}
+aeron_bbr_congestion_control_strategy_state_t;
+
+bool aeron_bbr_congestion_control_strategy_should_measure_rtt(void *state, int64_t now_ns)
+{
+    aeron_bbr_congestion_control_strategy_state_t *bbr_state = (aeron_bbr_congestion_control_strategy_state_t *)state;
+    const int64_t timeout_ns = bbr_state->rtt_outstanding ?
+        AERON_BBRCONGESTIONCONTROL_RTT_MAX_TIMEOUT_NS : AERON_BBRCONGESTIONCONTROL_RTT_MEASUREMENT_INTERVAL_NS;
+
+    if ((bbr_state->last_rtt_request_ns + timeout_ns) - now_ns < 0)
+    {
+        bbr_state->last_rtt_request_ns = now_ns;
+        bbr_state->rtt_outstanding = true;
+        return true;
+    }
+
+    return false;
+}
+
+void aeron_bbr_congestion_control_strategy_on_rttm(
+    void *state, int64_t now_ns, int64_t rtt_ns, struct sockaddr_storage *source_address)
+{
+    aeron_bbr_congestion_control_strategy_state_t *bbr_state = (aeron_bbr_congestion_control_strategy_state_t *)state;
+
+    bbr_state->rtt_outstanding = false;
+    bbr_state->last_rtt_request_ns = now_ns;
+
+    if (rtt_ns <= 0)
+    {
+        return;
+    }
+
+    if (AERON_BBRCONGESTIONCONTROL_MODE_PROBE_RTT == bbr_state->mode)
+    {
+        bbr_state->probe_rtt_min_ns = rtt_ns < bbr_state->probe_rtt_min_ns ? rtt_ns : bbr_state->probe_rtt_min_ns;
+    }
+    else if (rtt_ns <= bbr_state->min_rtt_ns)
+    {
+        bbr_state->min_rtt_ns = rtt_ns;
+        bbr_state->min_rtt_timestamp_ns = now_ns;
+        aeron_counter_set_ordered(bbr_state->rtt_indicator.value_addr, rtt_ns);
+    }
+}
+
+static void aeron_bbr_congestion_control_strategy_on_round(
+    aeron_bbr_congestion_control_strategy_state_t *state, int64_t bw, bool *should_force_sm)
+{
+    state->round_count++;
+
+    /* Rounds without data are app limited rather than a measure of the path and are left out of the filter. */
+    if (bw > 0)
+    {
+        state->bw_samples[state->round_count % AERON_BBRCONGESTIONCONTROL_BW_FILTER_ROUNDS] = bw;
+    }
+
+    int64_t max_bw = 0;
+    for (size_t i = 0; i < AERON_BBRCONGESTIONCONTROL_BW_FILTER_ROUNDS; i++)
+    {
+        max_bw = state->bw_samples[i] > max_bw ? state->bw_samples[i] : max_bw;
+    }
+    state->max_bw = max_bw;
+    aeron_counter_set_ordered(state->bw_indicator.value_addr, max_bw);
+
+    if (!state->full_bw_reached && bw > 0)
+    {
+        if ((double)max_bw >= (double)state->full_bw * AERON_BBRCONGESTIONCONTROL_FULL_BW_THRESHOLD)
+        {
+            state->full_bw = max_bw;
+            state->full_bw_count = 0;
+        }
+        else if (++state->full_bw_count >= AERON_BBRCONGESTIONCONTROL_FULL_BW_ROUNDS)
+        {
+            state->full_bw_reached = true;
+            if (AERON_BBRCONGESTIONCONTROL_MODE_STARTUP == state->mode)
+            {
+                state->mode = AERON_BBRCONGESTIONCONTROL_MODE_PROBE_BW;
+                *should_force_sm = true;
+            }
+        }
+    }
+}
+
+int32_t aeron_bbr_congestion_control_strategy_on_track_rebuild(
+    void *state,
+    bool *should_force_sm,
+    int64_t now_ns,
+    int64_t new_consumption_position,
+    int64_t last_sm_position,
+    int64_t hwm_position,
+    int64_t starting_rebuild_position,
+    int64_t ending_rebuild_position,
+    bool loss_occurred)
+{
+    aeron_bbr_congestion_control_strategy_state_t *bbr_state = (aeron_bbr_congestion_control_strategy_state_t *)state;
+    const bool has_min_rtt = INT64_MAX != bbr_state->min_rtt_ns;
+
+    *should_force_sm = false;
+
+    if (!bbr_state->has_round_start)
+    {
+        bbr_state->has_round_start = true;
+        bbr_state->round_start_ns = now_ns;
+        bbr_state->round_start_position = hwm_position;
+    }
+
+    int64_t round_ns = has_min_rtt ? bbr_state->min_rtt_ns : AERON_BBRCONGESTIONCONTROL_DEFAULT_ROUND_NS;
+    round_ns = round_ns < AERON_BBRCONGESTIONCONTROL_MIN_ROUND_NS ? AERON_BBRCONGESTIONCONTROL_MIN_ROUND_NS : round_ns;
+
+    const int64_t elapsed_ns = now_ns - bbr_state->round_start_ns;
+    if (elapsed_ns >= round_ns)
+    {
+        const int64_t delivered = hwm_position - bbr_state->round_start_position;
+        const int64_t bw = delivered > 0 ? (int64_t)(((double)delivered * 1e9) / (double)elapsed_ns) : 0;
+
+        aeron_bbr_congestion_control_strategy_on_round(bbr_state, bw, should_force_sm);
+        bbr_state->round_start_ns = now_ns;
+        bbr_state->round_start_position = hwm_position;
+    }
+
+    if (AERON_BBRCONGESTIONCONTROL_MODE_PROBE_RTT == bbr_state->mode)
+    {
+        if (now_ns - bbr_state->probe_rtt_done_ns >= 0)
+        {
+            if (INT64_MAX != bbr_state->probe_rtt_min_ns)
+            {
+                bbr_state->min_rtt_ns = bbr_state->probe_rtt_min_ns;
+                aeron_counter_set_ordered(bbr_state->rtt_indicator.value_addr, bbr_state->min_rtt_ns);
+            }
+            bbr_state->min_rtt_timestamp_ns = now_ns;
+            bbr_state->mode = bbr_state->full_bw_reached ?
+                AERON_BBRCONGESTIONCONTROL_MODE_PROBE_BW : AERON_BBRCONGESTIONCONTROL_MODE_STARTUP;
+            *should_force_sm = true;
+        }
+    }
+    else if (has_min_rtt && now_ns - bbr_state->min_rtt_timestamp_ns > AERON_BBRCONGESTIONCONTROL_MIN_RTT_WINDOW_NS)
+    {
+        const int64_t probe_rtt_ns = bbr_state->min_rtt_ns > AERON_BBRCONGESTIONCONTROL_PROBE_RTT_DURATION_NS ?
+            bbr_state->min_rtt_ns : AERON_BBRCONGESTIONCONTROL_PROBE_RTT_DURATION_NS;
+
+        bbr_state->mode = AERON_BBRCONGESTIONCONTROL_MODE_PROBE_RTT;
+        bbr_state->probe_rtt_min_ns = INT64_MAX;
+        bbr_state->probe_rtt_done_ns = now_ns + probe_rtt_ns;
+        *should_force_sm = true;
+    }
+
+    int64_t window = bbr_state->window;
+    if (AERON_BBRCONGESTIONCONTROL_MODE_PROBE_RTT == bbr_state->mode)
+    {
+        window = bbr_state->min_window;
+    }
+    else if (has_min_rtt && bbr_state->max_bw > 0)
+    {
+        const double bdp = ((double)bbr_state->max_bw * (double)bbr_state->min_rtt_ns) / 1e9;
+
+        if (AERON_BBRCONGESTIONCONTROL_MODE_STARTUP == bbr_state->mode)
+        {
+            const int64_t startup_window = (int64_t)(bdp * AERON_BBRCONGESTIONCONTROL_STARTUP_GAIN);
+            window = startup_window > window ? startup_window : window;
+        }
+        else
+        {
+            window = (int64_t)(bdp * AERON_BBRCONGESTIONCONTROL_WINDOW_GAIN);
+        }
+    }
+
+    window = window < bbr_state->min_window ? bbr_state->min_window : window;
+    window = window > bbr_state->max_window ? bbr_state->max_window : window;
+
+    if (window != bbr_state->window)
+    {
+        bbr_state->window = (int32_t)window;
+        aeron_counter_set_ordered(bbr_state->window_indicator.value_addr, window);
+    }
+
+    return bbr_state->window;
+}
+
+int32_t aeron_bbr_congestion_control_strategy_initial_window_length(void *state)
+{
+    return ((aeron_bbr_congestion_control_strategy_state_t *)state)->window;
+}
+
+int aeron_bbr_congestion_control_strategy_fini(aeron_congestion_control_strategy_t *strategy)
+{
+    aeron_bbr_congestion_control_strategy_state_t *state = strategy->state;
+
+    if (NULL != state)
+    {
+        aeron_counters_manager_free(state->counters_manager, state->rtt_indicator.counter_id);
+        aeron_counters_manager_free(state->counters_manager, state->bw_indicator.counter_id);
+        aeron_counters_manager_free(state->counters_manager, state->window_indicator.counter_id);
+    }
+
+    aeron_free(strategy->state);
+    aeron_free(strategy);
+
+    return 0;
+}
+
+static int32_t aeron_bbr_congestion_control_indicator_allocate(
+    aeron_counters_manager_t *counters_manager,
+    const char *name,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    size_t channel_length,
+    const char *channel,
+    aeron_atomic_counter_t *indicator)
+{
+    indicator->counter_id = aeron_stream_counter_allocate(
+        counters_manager,
+        name,
+        AERON_COUNTER_PER_IMAGE_TYPE_ID,
+        registration_id,
+        session_id,
+        stream_id,
+        channel_length,
+        channel,
+        "");
+
+    if (indicator->counter_id >= 0)
+    {
+        indicator->value_addr = aeron_counters_manager_addr(counters_manager, indicator->counter_id);
+    }
+
+    return indicator->counter_id;
+}
+
+int aeron_bbr_congestion_control_strategy_supplier(
+    aeron_congestion_control_strategy_t **strategy,
+    size_t channel_length,
+    const char *channel,
+    int32_t stream_id,
+    int32_t session_id,
+    int64_t registration_id,
+    int32_t term_length,
+    int32_t sender_mtu_length,
+    struct sockaddr_storage *control_address,
+    struct sockaddr_storage *src_address,
+    aeron_driver_context_t *context,
+    aeron_counters_manager_t *counters_manager)
+{
+    aeron_congestion_control_strategy_t *_strategy;
+
+    if (aeron_alloc((void **)&_strategy, sizeof(aeron_congestion_control_strategy_t)) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_alloc(&_strategy->state, sizeof(aeron_bbr_congestion_control_strategy_state_t)) < 0)
+    {
+        aeron_free(_strategy);
+        return -1;
+    }
+
+    _strategy->should_measure_rtt = aeron_bbr_congestion_control_strategy_should_measure_rtt;
+    _strategy->on_rttm = aeron_bbr_congestion_control_strategy_on_rttm;
+    _strategy->on_track_rebuild = aeron_bbr_congestion_control_strategy_on_track_rebuild;
+    _strategy->initial_window_length = aeron_bbr_congestion_control_strategy_initial_window_length;
+    _strategy->fini = aeron_bbr_congestion_control_strategy_fini;
+
+    aeron_bbr_congestion_control_strategy_state_t *state = _strategy->state;
+    const int32_t initial_window_length = (int32_t)context->initial_window_length;
+    const int32_t max_window_for_term = term_length / 2;
+    const int32_t max_window =
+        max_window_for_term < initial_window_length ? max_window_for_term : initial_window_length;
+    const int32_t min_window = AERON_BBRCONGESTIONCONTROL_MIN_WINDOW_MTUS * sender_mtu_length;
+    const int32_t window = AERON_BBRCONGESTIONCONTROL_INITIAL_WINDOW_MTUS * sender_mtu_length;
+
+    state->mode = AERON_BBRCONGESTIONCONTROL_MODE_STARTUP;
+    state->mtu = sender_mtu_length;
+    state->max_window = max_window;
+    state->min_window = min_window < max_window ? min_window : max_window;
+    state->window = window < max_window ? window : max_window;
+    state->min_rtt_ns = INT64_MAX;
+    state->probe_rtt_min_ns = INT64_MAX;
+    state->last_rtt_request_ns = aeron_clock_cached_nano_time(context->cached_clock) -
+        AERON_BBRCONGESTIONCONTROL_RTT_MAX_TIMEOUT_NS;
+    state->min_rtt_timestamp_ns = state->last_rtt_request_ns;
+    state->counters_manager = counters_manager;
+    state->rtt_indicator.counter_id = AERON_NULL_COUNTER_ID;
+    state->bw_indicator.counter_id = AERON_NULL_COUNTER_ID;
+    state->window_indicator.counter_id = AERON_NULL_COUNTER_ID;
+
+    if (aeron_bbr_congestion_control_indicator_allocate(
+        counters_manager,
+        AERON_BBRCONGESTIONCONTROL_RTT_INDICATOR_NAME,
+        registration_id,
+        session_id,
+        stream_id,
+        channel_length,
+        channel,
+        &state->rtt_indicator) < 0 ||
+        aeron_bbr_congestion_control_indicator_allocate(
+        counters_manager,
+        AERON_BBRCONGESTIONCONTROL_BW_INDICATOR_NAME,
+        registration_id,
+        session_id,
+        stream_id,
+        channel_length,
+        channel,
+        &state->bw_indicator) < 0 ||
+        aeron_bbr_congestion_control_indicator_allocate(
+        counters_manager,
+        AERON_BBRCONGESTIONCONTROL_WINDOW_INDICATOR_NAME,
+        registration_id,
+        session_id,
+        stream_id,
+        channel_length,
+        channel,
+        &state->window_indicator) < 0)
+    {
+        if (AERON_NULL_COUNTER_ID != state->rtt_indicator.counter_id)
+        {
+            aeron_counters_manager_free(counters_manager, state->rtt_indicator.counter_id);
+        }
+
+        if (AERON_NULL_COUNTER_ID != state->bw_indicator.counter_id)
+        {
+            aeron_counters_manager_free(counters_manager, state->bw_indicator.counter_id);
+        }
+
+        aeron_free(_strategy->state);
+        aeron_free(_strategy);
+        return -1;
+    }
+
+    aeron_counter_set_ordered(state->window_indicator.value_addr, state->window);
+
+    *strategy = _strategy;
+
+    return 0;
+}
@@ -56,9 +56,37 @@ typedef struct aeron_congestion_control_strategy_stct
 }
     aeron_congestion_control_strategy_t;
 
+#define AERON_STATICWINDOWCONGESTIONCONTROL_CC_PARAM_VALUE "static"
+#define AERON_CUBICCONGESTIONCONTROL_CC_PARAM_VALUE "cubic"
+#define AERON_BBRCONGESTIONCONTROL_CC_PARAM_VALUE "bbr"
+
+#define AERON_CUBICCONGESTIONCONTROL_RTT_INDICATOR_NAME "rcv-cc-cubic-rtt"
+#define AERON_CUBICCONGESTIONCONTROL_WINDOW_INDICATOR_NAME "rcv-cc-cubic-wnd"
+
+#define AERON_BBRCONGESTIONCONTROL_RTT_INDICATOR_NAME "rcv-cc-bbr-rtt"
+#define AERON_BBRCONGESTIONCONTROL_BW_INDICATOR_NAME "rcv-cc-bbr-bw"
+#define AERON_BBRCONGESTIONCONTROL_WINDOW_INDICATOR_NAME "rcv-cc-bbr-wnd"
+
 aeron_congestion_control_strategy_supplier_func_t aeron_congestion_control_strategy_supplier_load(
     const char *strategy_name);
 
+/**
+ * Supplier that selects the strategy by the cc param of the channel, defaulting to the static window strategy.
+ */
+int aeron_congestion_control_default_strategy_supplier(
+    aeron_congestion_control_strategy_t **strategy,
+    size_t channel_length,
+    const char *channel,
+    int32_t stream_id,
+    int32_t session_id,
+    int64_t registration_id,
+    int32_t term_length,
+    int32_t sender_mtu_length,
+    struct sockaddr_storage *control_address,
+    struct sockaddr_storage *src_address,
+    aeron_driver_context_t *context,
+    aeron_counters_manager_t *counters_manager);
+
 int aeron_static_window_congestion_control_strategy_supplier(
     aeron_congestion_control_strategy_t **strategy,
     size_t channel_length,
@@ -73,4 +101,57 @@ int aeron_static_window_congestion_control_strategy_supplier(
     aeron_driver_context_t *context,
     aeron_counters_manager_t *counters_manager);
 
+/**
+ * CUBIC congestion control manipulation of the receiver window length.
+ * <p>
+ * https://tools.ietf.org/id/draft-rhee-tcpm-cubic-02.txt and https://dl.acm.org/doi/10.1145/1400097.1400105
+ * <p>
+ * W_cubic = C(T - K)^3 + w_max
+ * <p>
+ * K = cbrt(w_max * B / C)
+ * w_max = window size before reduction
+ * T = time since last decrease
+ * <p>
+ * C = scaling constant (default 0.4)
+ * B = multiplicative decrease (default 0.2)
+ */
+int aeron_cubic_congestion_control_strategy_supplier(
+    aeron_congestion_control_strategy_t **strategy,
+    size_t channel_length,
+    const char *channel,
+    int32_t stream_id,
+    int32_t session_id,
+    int64_t registration_id,
+    int32_t term_length,
+    int32_t sender_mtu_length,
+    struct sockaddr_storage *control_address,
+    struct sockaddr_storage *src_address,
+    aeron_driver_context_t *context,
+    aeron_counters_manager_t *counters_manager);
+
+/**
+ * BBR style model based manipulation of the receiver window length.
+ * <p>
+ * https://tools.ietf.org/id/draft-cardwell-iccrg-bbr-congestion-control-00.txt
+ * <p>
+ * The bottleneck bandwidth is the max over the last 10 rounds of the rate the high water mark advances, with a round
+ * lasting one min RTT. The min RTT is taken from RTT measurements over a 10s window. The window is the bandwidth-delay
+ * product times a gain: 2/ln(2) in startup until the bandwidth stops growing by 25% for 3 rounds, then 2 so the sender
+ * can reveal more bandwidth. When the min RTT has not been refreshed for 10s the window drops to 4 MTUs for 200ms to
+ * drain the path queue and measure it again. Loss does not reduce the window.
+ */
+int aeron_bbr_congestion_control_strategy_supplier(
+    aeron_congestion_control_strategy_t **strategy,
+    size_t channel_length,
+    const char *channel,
+    int32_t stream_id,
+    int32_t session_id,
+    int64_t registration_id,
+    int32_t term_length,
+    int32_t sender_mtu_length,
+    struct sockaddr_storage *control_address,
+    struct sockaddr_storage *src_address,
+    aeron_driver_context_t *context,
+    aeron_counters_manager_t *counters_manager);
+
 #endif //AERON_CONGESTION_CONTROL_H
@@ -14,30 +14,53 @@
  * limitations under the License.
  */
 
+#include <string.h>
 #include <inttypes.h>
 #include "util/aeron_error.h"
+#include "util/aeron_math.h"
 #include "aeron_publication_image.h"
 #include "aeron_driver_receiver.h"
 
+static inline size_t aeron_data_packet_dispatcher_image_cache_index(int32_t stream_id, int32_t session_id)
+{
+    return (size_t)(((uint32_t)stream_id * 31u) ^ (uint32_t)session_id) &
+        (AERON_DATA_PACKET_DISPATCHER_IMAGE_CACHE_LENGTH - 1);
+}
+
+static void aeron_data_packet_dispatcher_image_cache_clear(aeron_data_packet_dispatcher_t *dispatcher)
+{
+    memset(dispatcher->image_cache, 0, sizeof(dispatcher->image_cache));
+}
+
+static inline struct aeron_data_packet_dispatcher_setup_cache_entry_stct *aeron_data_packet_dispatcher_setup_cache_entry(
+    aeron_data_packet_dispatcher_t *dispatcher, int32_t stream_id, int32_t session_id)
+{
+    return &dispatcher->setup_cache[
+        aeron_data_packet_dispatcher_image_cache_index(stream_id, session_id) &
+        (AERON_DATA_PACKET_DISPATCHER_SETUP_CACHE_LENGTH - 1)];
+}
+
 int aeron_data_packet_dispatcher_init(
     aeron_data_packet_dispatcher_t *dispatcher,
     aeron_driver_conductor_proxy_t *conductor_proxy,
     aeron_driver_receiver_t *receiver)
 {
-    if (aeron_int64_to_ptr_hash_map_init(
+    if (aeron_int64_to_ptr_swiss_map_init(
         &dispatcher->ignored_sessions_map, 16, AERON_MAP_DEFAULT_LOAD_FACTOR) < 0)
     {
         aeron_set_err_from_last_err_code("could not init ignored_session_map");
         return -1;
     }
 
-    if (aeron_int64_to_ptr_hash_map_init(
+    if (aeron_int64_to_ptr_swiss_map_init(
         &dispatcher->session_by_stream_id_map, 16, AERON_MAP_DEFAULT_LOAD_FACTOR) < 0)
     {
         aeron_set_err_from_last_err_code("could not init session_by_stream_id_map");
         return -1;
     }
 
+    aeron_data_packet_dispatcher_image_cache_clear(dispatcher);
+    memset(dispatcher->setup_cache, 0, sizeof(dispatcher->setup_cache));
     dispatcher->conductor_proxy = conductor_proxy;
     dispatcher->receiver = receiver;
     return 0;
@@ -55,7 +78,7 @@ static int aeron_data_packet_dispatcher_stream_interest_init(
         return -1;
     }
 
-    if (aeron_int64_to_ptr_hash_map_init(
+    if (aeron_int64_to_ptr_swiss_map_init(
         &stream_interest->subscribed_sessions, 16, AERON_MAP_DEFAULT_LOAD_FACTOR) < 0)
     {
         aeron_set_err_from_last_err_code("could not init subscribed_sessions");
@@ -69,7 +92,7 @@ static int aeron_data_packet_dispatcher_stream_interest_close(
     aeron_data_packet_dispatcher_stream_interest_t *stream_interest)
 {
     aeron_int64_to_tagged_ptr_hash_map_delete(&stream_interest->image_by_session_id_map);
-    aeron_int64_to_ptr_hash_map_delete(&stream_interest->subscribed_sessions);
+    aeron_int64_to_ptr_swiss_map_delete(&stream_interest->subscribed_sessions);
     return 0;
 }
 
@@ -88,10 +111,10 @@ static void aeron_data_packet_dispatcher_delete_stream_interest(void *clientd, i
 
 int aeron_data_packet_dispatcher_close(aeron_data_packet_dispatcher_t *dispatcher)
 {
-    aeron_int64_to_ptr_hash_map_for_each(
+    aeron_int64_to_ptr_swiss_map_for_each(
         &dispatcher->session_by_stream_id_map, aeron_data_packet_dispatcher_delete_stream_interest, dispatcher);
-    aeron_int64_to_ptr_hash_map_delete(&dispatcher->ignored_sessions_map);
-    aeron_int64_to_ptr_hash_map_delete(&dispatcher->session_by_stream_id_map);
+    aeron_int64_to_ptr_swiss_map_delete(&dispatcher->ignored_sessions_map);
+    aeron_int64_to_ptr_swiss_map_delete(&dispatcher->session_by_stream_id_map);
 
     return 0;
 }
@@ -101,7 +124,7 @@ bool aeron_data_packet_dispatcher_stream_interest_for_session(
     int32_t session_id)
 {
     return stream_interest->is_all_sessions ||
-        NULL != aeron_int64_to_ptr_hash_map_get(&stream_interest->subscribed_sessions, session_id);
+        NULL != aeron_int64_to_ptr_swiss_map_get(&stream_interest->subscribed_sessions, session_id);
 }
 
 bool aeron_data_packet_dispatcher_match_tombstone(void *clientd, int64_t key, uint32_t tag, void *value)
@@ -113,18 +136,18 @@ bool aeron_data_packet_dispatcher_match_no_subscription(void *clientd, int64_t k
 {
     aeron_data_packet_dispatcher_stream_interest_t *stream_interest = clientd;
 
-    return NULL == aeron_int64_to_ptr_hash_map_get(&stream_interest->subscribed_sessions, key);
+    return NULL == aeron_int64_to_ptr_swiss_map_get(&stream_interest->subscribed_sessions, key);
 }
 
 int aeron_data_packet_dispatcher_add_subscription(aeron_data_packet_dispatcher_t *dispatcher, int32_t stream_id)
 {
     aeron_data_packet_dispatcher_stream_interest_t *stream_interest;
 
-    if ((stream_interest = aeron_int64_to_ptr_hash_map_get(&dispatcher->session_by_stream_id_map, stream_id)) == NULL)
+    if ((stream_interest = aeron_int64_to_ptr_swiss_map_get(&dispatcher->session_by_stream_id_map, stream_id)) == NULL)
     {
         if (aeron_alloc((void **)&stream_interest, sizeof(aeron_data_packet_dispatcher_stream_interest_t)) < 0 ||
             aeron_data_packet_dispatcher_stream_interest_init(stream_interest, true) < 0 ||
-            aeron_int64_to_ptr_hash_map_put(&dispatcher->session_by_stream_id_map, stream_id, stream_interest) < 0)
+            aeron_int64_to_ptr_swiss_map_put(&dispatcher->session_by_stream_id_map, stream_id, stream_interest) < 0)
         {
             aeron_set_err_from_last_err_code("could not aeron_data_packet_dispatcher_add_subscription");
             return -1;
@@ -146,18 +169,18 @@ int aeron_data_packet_dispatcher_add_subscription_by_session(
 {
     aeron_data_packet_dispatcher_stream_interest_t *stream_interest;
 
-    if ((stream_interest = aeron_int64_to_ptr_hash_map_get(&dispatcher->session_by_stream_id_map, stream_id)) == NULL)
+    if ((stream_interest = aeron_int64_to_ptr_swiss_map_get(&dispatcher->session_by_stream_id_map, stream_id)) == NULL)
     {
         if (aeron_alloc((void **)&stream_interest, sizeof(aeron_data_packet_dispatcher_stream_interest_t)) < 0 ||
             aeron_data_packet_dispatcher_stream_interest_init(stream_interest, false) < 0 ||
-            aeron_int64_to_ptr_hash_map_put(&dispatcher->session_by_stream_id_map, stream_id, stream_interest) < 0)
+            aeron_int64_to_ptr_swiss_map_put(&dispatcher->session_by_stream_id_map, stream_id, stream_interest) < 0)
         {
             aeron_set_err_from_last_err_code("could not aeron_data_packet_dispatcher_add_subscription_by_session");
             return -1;
         }
     }
 
-    if (aeron_int64_to_ptr_hash_map_put(
+    if (aeron_int64_to_ptr_swiss_map_put(
         &stream_interest->subscribed_sessions, session_id, &dispatcher->tokens.subscribed) < 0)
     {
         aeron_set_err_from_last_err_code("could not aeron_data_packet_dispatcher_add_subscription_by_session");
@@ -178,12 +201,13 @@ int aeron_data_packet_dispatcher_remove_subscription(aeron_data_packet_dispatche
 {
     aeron_data_packet_dispatcher_stream_interest_t *stream_interest;
 
-    if ((stream_interest = aeron_int64_to_ptr_hash_map_get(&dispatcher->session_by_stream_id_map, stream_id)) == NULL)
+    if ((stream_interest = aeron_int64_to_ptr_swiss_map_get(&dispatcher->session_by_stream_id_map, stream_id)) == NULL)
     {
         aeron_set_err(-1, "No subscription for stream: %" PRIi32, stream_id);
         return -1;
     }
 
+    aeron_data_packet_dispatcher_image_cache_clear(dispatcher);
     aeron_int64_to_tagged_ptr_hash_map_remove_if(
         &stream_interest->image_by_session_id_map, aeron_data_packet_dispatcher_match_no_subscription, stream_interest);
 
@@ -191,7 +215,7 @@ int aeron_data_packet_dispatcher_remove_subscription(aeron_data_packet_dispatche
 
     if (0 == stream_interest->image_by_session_id_map.size)
     {
-        aeron_int64_to_ptr_hash_map_remove(&dispatcher->session_by_stream_id_map, stream_id);
+        aeron_int64_to_ptr_swiss_map_remove(&dispatcher->session_by_stream_id_map, stream_id);
         aeron_data_packet_dispatcher_stream_interest_delete(stream_interest);
     }
 
@@ -203,22 +227,23 @@ int aeron_data_packet_dispatcher_remove_subscription_by_session(
 {
     aeron_data_packet_dispatcher_stream_interest_t *stream_interest;
 
-    if ((stream_interest = aeron_int64_to_ptr_hash_map_get(&dispatcher->session_by_stream_id_map, stream_id)) == NULL)
+    if ((stream_interest = aeron_int64_to_ptr_swiss_map_get(&dispatcher->session_by_stream_id_map, stream_id)) == NULL)
     {
         aeron_set_err(-1, "No subscription for stream: %" PRIi32, stream_id);
         return -1;
     }
 
+    aeron_data_packet_dispatcher_image_cache_clear(dispatcher);
     if (!stream_interest->is_all_sessions)
     {
         aeron_int64_to_tagged_ptr_hash_map_remove(&stream_interest->image_by_session_id_map, session_id, NULL, NULL);
     }
 
-    aeron_int64_to_ptr_hash_map_remove(&stream_interest->subscribed_sessions, session_id);
+    aeron_int64_to_ptr_swiss_map_remove(&stream_interest->subscribed_sessions, session_id);
 
     if (!stream_interest->is_all_sessions && 0 == stream_interest->subscribed_sessions.size)
     {
-        aeron_int64_to_ptr_hash_map_remove(&dispatcher->session_by_stream_id_map, stream_id);
+        aeron_int64_to_ptr_swiss_map_remove(&dispatcher->session_by_stream_id_map, stream_id);
         aeron_data_packet_dispatcher_stream_interest_delete(stream_interest);
     }
 
@@ -229,10 +254,11 @@ int aeron_data_packet_dispatcher_add_publication_image(
     aeron_data_packet_dispatcher_t *dispatcher, aeron_publication_image_t *image)
 {
     aeron_data_packet_dispatcher_stream_interest_t *stream_interest =
-        aeron_int64_to_ptr_hash_map_get(&dispatcher->session_by_stream_id_map, image->stream_id);
+        aeron_int64_to_ptr_swiss_map_get(&dispatcher->session_by_stream_id_map, image->stream_id);
 
     if (NULL != stream_interest)
     {
+        aeron_data_packet_dispatcher_image_cache_clear(dispatcher);
         if (aeron_int64_to_tagged_ptr_hash_map_put(
             &stream_interest->image_by_session_id_map, image->session_id, AERON_DATA_PACKET_DISPATCHER_IMAGE_ACTIVE, image) < 0)
         {
@@ -248,7 +274,7 @@ int aeron_data_packet_dispatcher_remove_publication_image(
     aeron_data_packet_dispatcher_t *dispatcher, aeron_publication_image_t *image)
 {
     aeron_data_packet_dispatcher_stream_interest_t *stream_interest =
-        aeron_int64_to_ptr_hash_map_get(&dispatcher->session_by_stream_id_map, image->stream_id);
+        aeron_int64_to_ptr_swiss_map_get(&dispatcher->session_by_stream_id_map, image->stream_id);
 
     if (NULL != stream_interest)
     {
@@ -259,6 +285,7 @@ int aeron_data_packet_dispatcher_remove_publication_image(
         if (NULL != mapped_image &&
             image->conductor_fields.managed_resource.registration_id == mapped_image->conductor_fields.managed_resource.registration_id)
         {
+            aeron_data_packet_dispatcher_image_cache_clear(dispatcher);
             if (aeron_int64_to_tagged_ptr_hash_map_put(
                 &stream_interest->image_by_session_id_map, image->session_id, AERON_DATA_PACKET_DISPATCHER_IMAGE_COOL_DOWN, NULL) < 0)
             {
@@ -275,7 +302,7 @@ bool aeron_data_packet_dispatcher_has_interest_in(
     aeron_data_packet_dispatcher_t *dispatcher, int32_t stream_id, int32_t session_id)
 {
     aeron_data_packet_dispatcher_stream_interest_t *stream_interest =
-        aeron_int64_to_ptr_hash_map_get(&dispatcher->session_by_stream_id_map, stream_id);
+        aeron_int64_to_ptr_swiss_map_get(&dispatcher->session_by_stream_id_map, stream_id);
 
     if (NULL == stream_interest)
     {
@@ -312,6 +339,56 @@ static void aeron_data_packet_dispatcher_mark_as_no_interest_to_prevent_repeated
         image_by_session_id_map, session_id, AERON_DATA_PACKET_DISPATCHER_IMAGE_NO_INTEREST, NULL);
 }
 
+/*
+ * A publication whose setup was seen before on this endpoint can have its image created straight from its first data
+ * frame, taking the active term and offset from the frame and the rest from the cached setup, rather than waiting a
+ * round trip for a SETUP frame to be elicited. Frames that do not fit the cached parameters fall back to eliciting one.
+ */
+static bool aeron_data_packet_dispatcher_try_fast_join(
+    aeron_data_packet_dispatcher_t *dispatcher,
+    aeron_data_packet_dispatcher_stream_interest_t *stream_interest,
+    aeron_receive_channel_endpoint_t *endpoint,
+    aeron_receive_destination_t *destination,
+    aeron_data_header_t *header,
+    size_t length,
+    struct sockaddr_storage *addr,
+    int *result)
+{
+    if (NULL == dispatcher->receiver || !dispatcher->receiver->context->fast_join_enabled)
+    {
+        return false;
+    }
+
+    struct aeron_data_packet_dispatcher_setup_cache_entry_stct *entry =
+        aeron_data_packet_dispatcher_setup_cache_entry(dispatcher, header->stream_id, header->session_id);
+
+    if (0 == entry->term_length ||
+        header->stream_id != entry->stream_id ||
+        header->session_id != entry->session_id ||
+        aeron_sub_wrap_i32(header->term_id, entry->initial_term_id) < 0 ||
+        header->term_offset < 0 ||
+        (int64_t)header->term_offset + (int64_t)length > (int64_t)entry->term_length)
+    {
+        return false;
+    }
+
+    aeron_setup_header_t setup_header;
+    memset(&setup_header, 0, sizeof(setup_header));
+    setup_header.frame_header.type = AERON_HDR_TYPE_SETUP;
+    setup_header.session_id = header->session_id;
+    setup_header.stream_id = header->stream_id;
+    setup_header.initial_term_id = entry->initial_term_id;
+    setup_header.active_term_id = header->term_id;
+    setup_header.term_offset = header->term_offset;
+    setup_header.term_length = entry->term_length;
+    setup_header.mtu = entry->mtu;
+
+    *result = aeron_data_packet_dispatcher_create_publication(
+        dispatcher, endpoint, destination, &setup_header, addr, stream_interest);
+
+    return true;
+}
+
 int aeron_data_packet_dispatcher_on_data(
     aeron_data_packet_dispatcher_t *dispatcher,
     aeron_receive_channel_endpoint_t *endpoint,
@@ -321,8 +398,19 @@ int aeron_data_packet_dispatcher_on_data(
     size_t length,
     struct sockaddr_storage *addr)
 {
+    struct aeron_data_packet_dispatcher_image_cache_entry_stct *cache_entry =
+        &dispatcher->image_cache[aeron_data_packet_dispatcher_image_cache_index(header->stream_id, header->session_id)];
+
+    if (NULL != cache_entry->image &&
+        header->stream_id == cache_entry->stream_id &&
+        header->session_id == cache_entry->session_id)
+    {
+        return aeron_publication_image_insert_packet(
+            cache_entry->image, destination, header->term_id, header->term_offset, buffer, length, addr);
+    }
+
     aeron_data_packet_dispatcher_stream_interest_t *stream_interest =
-        aeron_int64_to_ptr_hash_map_get(&dispatcher->session_by_stream_id_map, header->stream_id);
+        aeron_int64_to_ptr_swiss_map_get(&dispatcher->session_by_stream_id_map, header->stream_id);
 
     if (NULL != stream_interest)
     {
@@ -332,6 +420,10 @@ int aeron_data_packet_dispatcher_on_data(
 
         if (NULL != image)
         {
+            cache_entry->stream_id = header->stream_id;
+            cache_entry->session_id = header->session_id;
+            cache_entry->image = image;
+
             return aeron_publication_image_insert_packet(
                 image, destination, header->term_id, header->term_offset, buffer, length, addr);
         }
@@ -339,6 +431,13 @@ int aeron_data_packet_dispatcher_on_data(
         {
             if (aeron_data_packet_dispatcher_stream_interest_for_session(stream_interest, header->session_id))
             {
+                int result = 0;
+                if (aeron_data_packet_dispatcher_try_fast_join(
+                    dispatcher, stream_interest, endpoint, destination, header, length, addr, &result))
+                {
+                    return result < 0 ? result : 0;
+                }
+
                 return aeron_data_packet_dispatcher_elicit_setup_from_source(
                     dispatcher, stream_interest, endpoint, destination, addr, header->stream_id, header->session_id);
             }
@@ -371,6 +470,14 @@ int aeron_data_packet_dispatcher_create_publication(
         return -1;
     }
 
+    struct aeron_data_packet_dispatcher_setup_cache_entry_stct *entry =
+        aeron_data_packet_dispatcher_setup_cache_entry(dispatcher, header->stream_id, header->session_id);
+    entry->stream_id = header->stream_id;
+    entry->session_id = header->session_id;
+    entry->initial_term_id = header->initial_term_id;
+    entry->term_length = header->term_length;
+    entry->mtu = header->mtu;
+
     struct sockaddr_storage *control_addr = endpoint->conductor_fields.udp_channel->is_multicast ?
         &endpoint->conductor_fields.udp_channel->remote_control : addr;
 
@@ -401,7 +508,7 @@ int aeron_data_packet_dispatcher_on_setup(
     struct sockaddr_storage *addr)
 {
     aeron_data_packet_dispatcher_stream_interest_t *stream_interest =
-        aeron_int64_to_ptr_hash_map_get(&dispatcher->session_by_stream_id_map, header->stream_id);
+        aeron_int64_to_ptr_swiss_map_get(&dispatcher->session_by_stream_id_map, header->stream_id);
 
     if (NULL != stream_interest)
     {
@@ -417,7 +524,8 @@ int aeron_data_packet_dispatcher_on_setup(
                 if (destination->conductor_fields.udp_channel->is_multicast &&
                     destination->conductor_fields.udp_channel->multicast_ttl < header->ttl)
                 {
-                    aeron_counter_ordered_increment(endpoint->possible_ttl_asymmetry_counter, 1);
+                    aeron_system_counter_add(
+                        endpoint->possible_ttl_asymmetry_counter, 1, endpoint->has_shared_counters);
                 }
 
                 if (aeron_data_packet_dispatcher_create_publication(
@@ -462,7 +570,7 @@ int aeron_data_packet_dispatcher_on_rttm(
     struct sockaddr_storage *addr)
 {
     aeron_data_packet_dispatcher_stream_interest_t *stream_interest =
-        aeron_int64_to_ptr_hash_map_get(&dispatcher->session_by_stream_id_map, header->stream_id);
+        aeron_int64_to_ptr_swiss_map_get(&dispatcher->session_by_stream_id_map, header->stream_id);
 
     if (NULL != stream_interest)
     {
@@ -476,7 +584,7 @@ int aeron_data_packet_dispatcher_on_rttm(
                 struct sockaddr_storage *control_addr = endpoint->conductor_fields.udp_channel->is_multicast ?
                     &endpoint->conductor_fields.udp_channel->remote_control : addr;
 
-                return aeron_receive_channel_endpoint_send_rttm(
+                return aeron_receive_channel_endpoint_queue_rttm(
                     endpoint, control_addr, header->stream_id, header->session_id, header->echo_timestamp, 0, false);
             }
             else
@@ -18,7 +18,7 @@
 #define AERON_DATA_PACKET_DISPATCHER_H
 
 #include "aeron_socket.h"
-#include "collections/aeron_int64_to_ptr_hash_map.h"
+#include "collections/aeron_int64_to_ptr_swiss_map.h"
 #include "collections/aeron_int64_to_tagged_ptr_hash_map.h"
 #include "aeron_driver_conductor_proxy.h"
 #include "media/aeron_receive_destination.h"
@@ -29,6 +29,9 @@
 #define AERON_DATA_PACKET_DISPATCHER_IMAGE_COOL_DOWN UINT32_C(4)
 #define AERON_DATA_PACKET_DISPATCHER_IMAGE_NO_INTEREST UINT32_C(5)
 
+#define AERON_DATA_PACKET_DISPATCHER_IMAGE_CACHE_LENGTH (16)
+#define AERON_DATA_PACKET_DISPATCHER_SETUP_CACHE_LENGTH (16)
+
 typedef struct aeron_publication_image_stct aeron_publication_image_t;
 typedef struct aeron_receive_channel_endpoint_stct aeron_receive_channel_endpoint_t;
 typedef struct aeron_receive_destination_stct aeron_receive_destination_t;
@@ -36,8 +39,28 @@ typedef struct aeron_driver_receiver_stct aeron_driver_receiver_t;
 
 typedef struct aeron_data_packet_dispatcher_stct
 {
-    aeron_int64_to_ptr_hash_map_t ignored_sessions_map;
-    aeron_int64_to_ptr_hash_map_t session_by_stream_id_map;
+    aeron_int64_to_ptr_swiss_map_t ignored_sessions_map;
+    aeron_int64_to_ptr_swiss_map_t session_by_stream_id_map;
+
+    /* direct-mapped cache of active images by (stream id, session id) so hot sessions skip both map lookups */
+    struct aeron_data_packet_dispatcher_image_cache_entry_stct
+    {
+        int32_t stream_id;
+        int32_t session_id;
+        aeron_publication_image_t *image;
+    }
+    image_cache[AERON_DATA_PACKET_DISPATCHER_IMAGE_CACHE_LENGTH];
+
+    /* direct-mapped cache of the setup parameters of publications seen on this endpoint for fast join */
+    struct aeron_data_packet_dispatcher_setup_cache_entry_stct
+    {
+        int32_t stream_id;
+        int32_t session_id;
+        int32_t initial_term_id;
+        int32_t term_length;
+        int32_t mtu;
+    }
+    setup_cache[AERON_DATA_PACKET_DISPATCHER_SETUP_CACHE_LENGTH];
 
     /* tombstones for PENDING_SETUP_FRAME, INIT_IN_PROGRESS, and ON_COOL_DOWN */
     struct aeron_data_packet_dispatcher_tokens_stct
@@ -61,7 +84,7 @@ typedef struct aeron_data_packet_dispatcher_stream_interest_stct
 {
     bool is_all_sessions;
     aeron_int64_to_tagged_ptr_hash_map_t image_by_session_id_map;
-    aeron_int64_to_ptr_hash_map_t subscribed_sessions;
+    aeron_int64_to_ptr_swiss_map_t subscribed_sessions;
 }
 aeron_data_packet_dispatcher_stream_interest_t;
 
@@ -98,6 +121,14 @@ int aeron_data_packet_dispatcher_on_setup(
     size_t length,
     struct sockaddr_storage *addr);
 
+int aeron_data_packet_dispatcher_create_publication(
+    aeron_data_packet_dispatcher_t *dispatcher,
+    aeron_receive_channel_endpoint_t *endpoint,
+    aeron_receive_destination_t *destination,
+    aeron_setup_header_t *header,
+    struct sockaddr_storage *addr,
+    aeron_data_packet_dispatcher_stream_interest_t *stream_interest);
+
 int aeron_data_packet_dispatcher_on_rttm(
     aeron_data_packet_dispatcher_t *dispatcher,
     aeron_receive_channel_endpoint_t *endpoint,
@@ -123,7 +154,7 @@ inline int aeron_data_packet_dispatcher_remove_with_state(
     uint32_t image_state)
 {
     aeron_data_packet_dispatcher_stream_interest_t *stream_interest =
-        (aeron_data_packet_dispatcher_stream_interest_t *)aeron_int64_to_ptr_hash_map_get(
+        (aeron_data_packet_dispatcher_stream_interest_t *)aeron_int64_to_ptr_swiss_map_get(
             &dispatcher->session_by_stream_id_map, stream_id);
 
     if (NULL != stream_interest)
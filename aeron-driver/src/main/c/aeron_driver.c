@@ -42,6 +42,7 @@
 #include "util/aeron_strutil.h"
 #include "util/aeron_fileutil.h"
 #include "aeron_driver.h"
+#include "aeron_position.h"
 #include "aeron_socket.h"
 #include "util/aeron_dlopen.h"
 
@@ -172,6 +173,19 @@ int aeron_report_existing_errors(aeron_mapped_file_t *cnc_map, const char *aeron
     return result;
 }
 
+static void aeron_driver_delete_or_set_aside_dir(aeron_driver_context_t *context)
+{
+    if (context->log_buffer_pool_warm_restart &&
+        context->log_buffer_pool_capacity > 0 &&
+        !context->term_buffer_memfd &&
+        aeron_log_buffer_pool_set_aside_dir(context->aeron_dir) > 0)
+    {
+        return;
+    }
+
+    aeron_delete_directory(context->aeron_dir);
+}
+
 int aeron_driver_ensure_dir_is_recreated(aeron_driver_context_t *context)
 {
     char buffer[AERON_MAX_PATH];
@@ -189,7 +203,7 @@ int aeron_driver_ensure_dir_is_recreated(aeron_driver_context_t *context)
 
         if (context->dirs_delete_on_start)
         {
-            aeron_delete_directory(context->aeron_dir);
+            aeron_driver_delete_or_set_aside_dir(context);
         }
         else
         {
@@ -220,7 +234,7 @@ int aeron_driver_ensure_dir_is_recreated(aeron_driver_context_t *context)
             }
 
             aeron_unmap(&cnc_mmap);
-            aeron_delete_directory(context->aeron_dir);
+            aeron_driver_delete_or_set_aside_dir(context);
         }
     }
 
@@ -244,6 +258,13 @@ int aeron_driver_ensure_dir_is_recreated(aeron_driver_context_t *context)
         return -1;
     }
 
+    snprintf(buffer, sizeof(buffer) - 1, "%s/%s", dirname, AERON_CLIENTS_DIR);
+    if (aeron_mkdir(buffer, S_IRWXU | S_IRWXG | S_IRWXO) != 0)
+    {
+        aeron_set_err_from_last_err_code("mkdir %s", buffer);
+        return -1;
+    }
+
     return 0;
 }
 
@@ -259,12 +280,15 @@ void aeron_driver_fill_cnc_metadata(aeron_driver_context_t *context)
     metadata->client_liveness_timeout = (int64_t)context->client_liveness_timeout_ns;
     metadata->start_timestamp = context->epoch_clock();
     metadata->pid = getpid();
+    metadata->counter_compact_buffer_length =
+        (int32_t)AERON_COUNTERS_COMPACT_BUFFER_LENGTH((size_t)context->counters_compact_capacity);
 
     context->to_driver_buffer = aeron_cnc_to_driver_buffer(metadata);
     context->to_clients_buffer = aeron_cnc_to_clients_buffer(metadata);
     context->counters_values_buffer = aeron_cnc_counters_values_buffer(metadata);
     context->counters_metadata_buffer = aeron_cnc_counters_metadata_buffer(metadata);
     context->error_buffer = aeron_cnc_error_log_buffer(metadata);
+    context->counters_compact_buffer = aeron_cnc_counters_compact_buffer(metadata);
 }
 
 int aeron_driver_create_cnc_file(aeron_driver_t *driver)
@@ -283,6 +307,13 @@ int aeron_driver_create_cnc_file(aeron_driver_t *driver)
         return -1;
     }
 
+    if (AERON_NUMA_NODE_NONE != driver->context->cnc_numa_node &&
+        aeron_bind_numa_node(&driver->context->cnc_map, driver->context->cnc_numa_node) < 0)
+    {
+        aeron_set_err(aeron_errcode(), "could not bind CnC file to numa node: %s", aeron_errmsg());
+        return -1;
+    }
+
     aeron_driver_fill_cnc_metadata(driver->context);
 
     return 0;
@@ -307,6 +338,63 @@ int aeron_driver_create_loss_report_file(aeron_driver_t *driver)
     return 0;
 }
 
+/*
+ * The trace file holds a ring for each sender shard followed by a ring for each receiver shard, each written only by
+ * the agent that owns it.
+ */
+int aeron_driver_create_trace_file(aeron_driver_t *driver)
+{
+    aeron_driver_context_t *context = driver->context;
+    char buffer[AERON_MAX_PATH];
+
+    if (0 == context->trace_ring_capacity)
+    {
+        return 0;
+    }
+
+    const size_t ring_length = AERON_TRACE_RING_LENGTH(
+        aeron_find_next_power_of_two((int32_t)context->trace_ring_capacity));
+
+    context->trace_file.addr = NULL;
+    context->trace_file.length = (context->sender_shard_count + context->receiver_shard_count) * ring_length;
+
+    snprintf(buffer, sizeof(buffer) - 1, "%s/%s", context->aeron_dir, AERON_TRACE_FILE);
+
+    if (aeron_map_new_file(&context->trace_file, buffer, true) < 0)
+    {
+        aeron_set_err(aeron_errcode(), "could not map trace file: %s", aeron_errmsg());
+        return -1;
+    }
+
+    uint8_t *ring_buffer = (uint8_t *)context->trace_file.addr;
+
+    for (size_t i = 0; i < context->sender_shard_count; i++, ring_buffer += ring_length)
+    {
+        if (aeron_trace_ring_init(
+            &driver->sender_shard_proxies[i]->sender->trace_ring,
+            ring_buffer,
+            ring_length,
+            AERON_TRACE_AGENT_SENDER) < 0)
+        {
+            return -1;
+        }
+    }
+
+    for (size_t i = 0; i < context->receiver_shard_count; i++, ring_buffer += ring_length)
+    {
+        if (aeron_trace_ring_init(
+            &driver->receiver_shard_proxies[i]->receiver->trace_ring,
+            ring_buffer,
+            ring_length,
+            AERON_TRACE_AGENT_RECEIVER) < 0)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
 int aeron_driver_validate_sufficient_socket_buffer_lengths(aeron_driver_t *driver)
 {
     int result = -1;
@@ -459,6 +547,196 @@ int aeron_driver_validate_page_size(aeron_driver_t *driver)
     return 0;
 }
 
+int aeron_driver_validate_io_vector_capacities(aeron_driver_t *driver)
+{
+    aeron_driver_context_t *context = driver->context;
+
+    if (context->network_publication_max_messages_per_send < 1 ||
+        context->network_publication_max_messages_per_send > AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND_MAX)
+    {
+        aeron_set_err(
+            EINVAL,
+            "network publication max messages per send must be between 1 and %d: value=%" PRIu64,
+            AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND_MAX,
+            (uint64_t)context->network_publication_max_messages_per_send);
+        return -1;
+    }
+
+    if (context->receiver_io_vector_capacity < 1 ||
+        context->receiver_io_vector_capacity > AERON_DRIVER_RECEIVER_IO_VECTOR_CAPACITY_MAX)
+    {
+        aeron_set_err(
+            EINVAL,
+            "receiver io vector capacity must be between 1 and %d: value=%" PRIu64,
+            AERON_DRIVER_RECEIVER_IO_VECTOR_CAPACITY_MAX,
+            (uint64_t)context->receiver_io_vector_capacity);
+        return -1;
+    }
+
+    if (context->sender_io_vector_capacity < 1 ||
+        context->sender_io_vector_capacity > AERON_DRIVER_SENDER_IO_VECTOR_CAPACITY_MAX)
+    {
+        aeron_set_err(
+            EINVAL,
+            "sender io vector capacity must be between 1 and %d: value=%" PRIu64,
+            AERON_DRIVER_SENDER_IO_VECTOR_CAPACITY_MAX,
+            (uint64_t)context->sender_io_vector_capacity);
+        return -1;
+    }
+
+    return 0;
+}
+
+int aeron_driver_validate_shard_counts(aeron_driver_t *driver)
+{
+    aeron_driver_context_t *context = driver->context;
+
+    if (context->sender_shard_count < 1 || context->sender_shard_count > AERON_DRIVER_SENDER_SHARD_COUNT_MAX)
+    {
+        aeron_set_err(
+            EINVAL,
+            "sender shard count must be between 1 and %d: value=%" PRIu64,
+            AERON_DRIVER_SENDER_SHARD_COUNT_MAX,
+            (uint64_t)context->sender_shard_count);
+        return -1;
+    }
+
+    if (context->sender_shard_count > 1 && AERON_THREADING_MODE_DEDICATED != context->threading_mode)
+    {
+        aeron_set_err(
+            EINVAL,
+            "sender shard count greater than 1 requires DEDICATED threading mode: value=%" PRIu64,
+            (uint64_t)context->sender_shard_count);
+        return -1;
+    }
+
+    if (context->receiver_shard_count < 1 || context->receiver_shard_count > AERON_DRIVER_RECEIVER_SHARD_COUNT_MAX)
+    {
+        aeron_set_err(
+            EINVAL,
+            "receiver shard count must be between 1 and %d: value=%" PRIu64,
+            AERON_DRIVER_RECEIVER_SHARD_COUNT_MAX,
+            (uint64_t)context->receiver_shard_count);
+        return -1;
+    }
+
+    if (context->receiver_shard_count > 1 && AERON_THREADING_MODE_DEDICATED != context->threading_mode)
+    {
+        aeron_set_err(
+            EINVAL,
+            "receiver shard count greater than 1 requires DEDICATED threading mode: value=%" PRIu64,
+            (uint64_t)context->receiver_shard_count);
+        return -1;
+    }
+
+    return 0;
+}
+
+int aeron_driver_sender_shards_init(aeron_driver_t *driver)
+{
+    aeron_driver_context_t *context = driver->context;
+    const size_t shard_count = context->sender_shard_count;
+
+    driver->sender_shard_proxies[0] = &driver->sender.sender_proxy;
+
+    if (shard_count > 1 &&
+        aeron_alloc((void **)&driver->sender_shards, sizeof(aeron_driver_sender_shard_t) * (shard_count - 1)) < 0)
+    {
+        aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
+        return -1;
+    }
+
+    for (size_t i = 1; i < shard_count; i++)
+    {
+        aeron_driver_sender_shard_t *shard = &driver->sender_shards[i - 1];
+
+        shard->runner.state = AERON_AGENT_STATE_UNUSED;
+        shard->runner.role_name = NULL;
+        shard->runner.on_close = NULL;
+
+        if (aeron_spsc_concurrent_array_queue_init(&shard->command_queue, AERON_COMMAND_QUEUE_CAPACITY) < 0)
+        {
+            return -1;
+        }
+
+        if (aeron_driver_sender_init(
+            &shard->sender, context, &driver->conductor.system_counters, &driver->conductor.error_log) < 0)
+        {
+            return -1;
+        }
+
+        shard->sender.sender_proxy.command_queue = &shard->command_queue;
+        driver->sender_shard_proxies[i] = &shard->sender.sender_proxy;
+        driver->sender_shards_length++;
+    }
+
+    if (shard_count > 1)
+    {
+        for (size_t i = 0; i < shard_count; i++)
+        {
+            int32_t counter_id = aeron_counter_sender_shard_bytes_sent_allocate(
+                &driver->conductor.counters_manager, (int32_t)i);
+
+            if (counter_id < 0)
+            {
+                return -1;
+            }
+
+            driver->sender_shard_proxies[i]->sender->shard_bytes_sent_counter = aeron_counters_manager_addr(
+                &driver->conductor.counters_manager, counter_id);
+        }
+    }
+
+    context->sender_shard_proxies = driver->sender_shard_proxies;
+    context->sender_shard_proxies_length = shard_count;
+
+    return 0;
+}
+
+int aeron_driver_receiver_shards_init(aeron_driver_t *driver)
+{
+    aeron_driver_context_t *context = driver->context;
+    const size_t shard_count = context->receiver_shard_count;
+
+    driver->receiver_shard_proxies[0] = &driver->receiver.receiver_proxy;
+
+    if (shard_count > 1 &&
+        aeron_alloc((void **)&driver->receiver_shards, sizeof(aeron_driver_receiver_shard_t) * (shard_count - 1)) < 0)
+    {
+        aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
+        return -1;
+    }
+
+    for (size_t i = 1; i < shard_count; i++)
+    {
+        aeron_driver_receiver_shard_t *shard = &driver->receiver_shards[i - 1];
+
+        shard->runner.state = AERON_AGENT_STATE_UNUSED;
+        shard->runner.role_name = NULL;
+        shard->runner.on_close = NULL;
+
+        if (aeron_spsc_concurrent_array_queue_init(&shard->command_queue, AERON_COMMAND_QUEUE_CAPACITY) < 0)
+        {
+            return -1;
+        }
+
+        if (aeron_driver_receiver_init(
+            &shard->receiver, context, &driver->conductor.system_counters, &driver->conductor.error_log) < 0)
+        {
+            return -1;
+        }
+
+        shard->receiver.receiver_proxy.command_queue = &shard->command_queue;
+        driver->receiver_shard_proxies[i] = &shard->receiver.receiver_proxy;
+        driver->receiver_shards_length++;
+    }
+
+    context->receiver_shard_proxies = driver->receiver_shard_proxies;
+    context->receiver_shard_proxies_length = shard_count;
+
+    return 0;
+}
+
 void aeron_driver_context_print_configuration(aeron_driver_context_t *context)
 {
     FILE *fpout = stdout;
@@ -476,17 +754,35 @@ void aeron_driver_context_print_configuration(aeron_driver_context_t *context)
     fprintf(fpout, "\n    dirs_delete_on_shutdown=%d", context->dirs_delete_on_shutdown);
     fprintf(fpout, "\n    warn_if_dirs_exists=%d", context->warn_if_dirs_exist);
     fprintf(fpout, "\n    term_buffer_sparse_file=%d", context->term_buffer_sparse_file);
+    fprintf(fpout, "\n    term_buffer_huge_pages=%d", context->term_buffer_huge_pages);
+    fprintf(fpout, "\n    term_buffer_numa_node=%" PRId32, context->term_buffer_numa_node);
+    fprintf(fpout, "\n    cnc_numa_node=%" PRId32, context->cnc_numa_node);
+    fprintf(fpout, "\n    term_buffer_pre_fault_async=%d", context->term_buffer_pre_fault_async);
+    fprintf(fpout, "\n    conductor_housekeeping_async=%d", context->conductor_housekeeping_async);
+    fprintf(fpout, "\n    log_buffer_pool_capacity=%" PRIu64, (uint64_t)context->log_buffer_pool_capacity);
+    fprintf(fpout, "\n    log_buffer_pool_warm_restart=%d", context->log_buffer_pool_warm_restart);
+    fprintf(fpout, "\n    log_buffer_memory_budget=%" PRIu64, context->log_buffer_memory_budget);
+    fprintf(fpout, "\n    term_buffer_memfd=%d", context->term_buffer_memfd);
+    fprintf(fpout, "\n    log_buffer_socket_path=%s",
+        NULL != context->log_buffer_socket_path ? context->log_buffer_socket_path : "");
+    fprintf(fpout, "\n    term_buffer_clean_mode=%d", context->term_buffer_clean_mode);
     fprintf(fpout, "\n    perform_storage_checks=%d", context->perform_storage_checks);
     fprintf(fpout, "\n    spies_simulate_connection=%d", context->spies_simulate_connection);
+    fprintf(fpout, "\n    network_short_circuit_enabled=%d", context->network_short_circuit_enabled);
+    fprintf(fpout, "\n    client_directed_responses_enabled=%d", context->client_directed_responses_enabled);
     fprintf(fpout, "\n    reliable_stream=%d", context->reliable_stream);
     fprintf(fpout, "\n    tether_subscriptions=%d", context->tether_subscriptions);
     fprintf(fpout, "\n    rejoin_stream=%d", context->rejoin_stream);
     fprintf(fpout, "\n    receiver_group_consideration=%d", context->receiver_group_consideration);
     fprintf(fpout, "\n    to_driver_buffer_length=%" PRIu64, (uint64_t)context->to_driver_buffer_length);
     fprintf(fpout, "\n    to_clients_buffer_length=%" PRIu64, (uint64_t)context->to_clients_buffer_length);
+    fprintf(fpout, "\n    client_directed_responses_buffer_length=%" PRIu64,
+        (uint64_t)context->client_directed_responses_buffer_length);
     fprintf(fpout, "\n    counters_values_buffer_length=%" PRIu64, (uint64_t)context->counters_values_buffer_length);
+    fprintf(fpout, "\n    counters_compact_capacity=%" PRId32, context->counters_compact_capacity);
     fprintf(fpout, "\n    error_buffer_length=%" PRIu64, (uint64_t)context->error_buffer_length);
     fprintf(fpout, "\n    timer_interval_ns=%" PRIu64, context->timer_interval_ns);
+    fprintf(fpout, "\n    shared_conductor_budget_ns=%" PRIu64, context->shared_conductor_budget_ns);
     fprintf(fpout, "\n    client_liveness_timeout_ns=%" PRIu64, context->client_liveness_timeout_ns);
     fprintf(fpout, "\n    image_liveness_timeout_ns=%" PRIu64, context->image_liveness_timeout_ns);
     fprintf(fpout, "\n    publication_unblock_timeout_ns=%" PRIu64, context->publication_unblock_timeout_ns);
@@ -496,26 +792,64 @@ void aeron_driver_context_print_configuration(aeron_driver_context_t *context)
     fprintf(fpout, "\n    untethered_resting_timeout_ns=%" PRIu64, context->untethered_resting_timeout_ns);
     fprintf(fpout, "\n    retransmit_unicast_delay_ns=%" PRIu64, context->retransmit_unicast_delay_ns);
     fprintf(fpout, "\n    retransmit_unicast_linger_ns=%" PRIu64, context->retransmit_unicast_linger_ns);
+    fprintf(fpout, "\n    retransmit_budget_rate=%" PRIu64, context->retransmit_budget_rate);
+    fprintf(fpout, "\n    sender_retransmit_budget_rate=%" PRIu64, context->sender_retransmit_budget_rate);
+    fprintf(fpout, "\n    retransmit_unicast_repair_threshold=%" PRIu64,
+        (uint64_t)context->retransmit_unicast_repair_threshold);
     fprintf(fpout, "\n    nak_unicast_delay_ns=%" PRIu64, context->nak_unicast_delay_ns);
     fprintf(fpout, "\n    nak_multicast_max_backoff_ns=%" PRIu64, context->nak_multicast_max_backoff_ns);
     fprintf(fpout, "\n    nak_multicast_group_size=%" PRIu64, (uint64_t)context->nak_multicast_group_size);
+    fprintf(fpout, "\n    nak_max_gaps=%" PRIu64, (uint64_t)context->nak_max_gaps);
+    fprintf(fpout, "\n    nak_rtt_adaptive=%d", context->nak_rtt_adaptive);
     fprintf(fpout, "\n    status_message_timeout_ns=%" PRIu64, context->status_message_timeout_ns);
+    fprintf(fpout, "\n    status_message_batching=%d", context->status_message_batching);
+    fprintf(fpout, "\n    status_message_packing=%d", context->status_message_packing);
+    fprintf(fpout, "\n    control_message_batching=%d", context->control_message_batching);
+    fprintf(fpout, "\n    status_message_adaptive=%d", context->status_message_adaptive);
+    fprintf(fpout, "\n    image_rate_limit=%" PRIu64, context->image_rate_limit);
     fprintf(fpout, "\n    counter_free_to_reuse_ns=%" PRIu64, context->counter_free_to_reuse_ns);
     fprintf(fpout, "\n    term_buffer_length=%" PRIu64, (uint64_t)context->term_buffer_length);
     fprintf(fpout, "\n    ipc_term_buffer_length=%" PRIu64, (uint64_t)context->ipc_term_buffer_length);
     fprintf(fpout, "\n    publication_window_length=%" PRIu64, (uint64_t)context->publication_window_length);
     fprintf(fpout, "\n    ipc_publication_window_length=%" PRIu64, (uint64_t)context->ipc_publication_window_length);
+    fprintf(fpout, "\n    ipc_publication_eager_limit_enabled=%d", context->ipc_publication_eager_limit_enabled);
     fprintf(fpout, "\n    initial_window_length=%" PRIu64, (uint64_t)context->initial_window_length);
     fprintf(fpout, "\n    socket_sndbuf=%" PRIu64, (uint64_t)context->socket_sndbuf);
     fprintf(fpout, "\n    socket_rcvbuf=%" PRIu64, (uint64_t)context->socket_rcvbuf);
     fprintf(fpout, "\n    multicast_ttl=%" PRIu8, context->multicast_ttl);
+    fprintf(fpout, "\n    socket_dscp=%" PRIu8, context->socket_dscp);
+    fprintf(fpout, "\n    socket_gso_enabled=%d", context->socket_gso_enabled);
+    fprintf(fpout, "\n    socket_gro_enabled=%d", context->socket_gro_enabled);
+    fprintf(fpout, "\n    socket_stream_filter_enabled=%d", context->socket_stream_filter_enabled);
+    fprintf(fpout, "\n    socket_busy_poll_us=%" PRIu32, context->socket_busy_poll_us);
+    fprintf(fpout, "\n    socket_prefer_busy_poll=%d", context->socket_prefer_busy_poll);
+    fprintf(fpout, "\n    socket_rx_timestamping_enabled=%d", context->socket_rx_timestamping_enabled);
+    fprintf(fpout, "\n    socket_buffer_auto_enabled=%d", context->socket_buffer_auto_enabled);
+    fprintf(fpout, "\n    pmtu_discovery_enabled=%d", context->pmtu_discovery_enabled);
+    fprintf(fpout, "\n    receiver_zero_copy_enabled=%d", context->receiver_zero_copy_enabled);
+    fprintf(fpout, "\n    redundant_path_enabled=%d", context->redundant_path_enabled);
+    fprintf(fpout, "\n    fast_join_enabled=%d", context->fast_join_enabled);
+    fprintf(fpout, "\n    stream_latency_counters_enabled=%d", context->stream_latency_counters_enabled);
+    fprintf(fpout, "\n    stream_cpu_counters_enabled=%d", context->stream_cpu_counters_enabled);
+    fprintf(fpout, "\n    udp_transport_poller_iteration_threshold=%" PRIu64,
+        (uint64_t)context->udp_transport_poller_iteration_threshold);
     fprintf(fpout, "\n    mtu_length=%" PRIu64, (uint64_t)context->mtu_length);
     fprintf(fpout, "\n    ipc_mtu_length=%" PRIu64, (uint64_t)context->ipc_mtu_length);
     fprintf(fpout, "\n    file_page_size=%" PRIu64, (uint64_t)context->file_page_size);
     fprintf(fpout, "\n    publication_reserved_session_id_low=%" PRId32, context->publication_reserved_session_id_low);
     fprintf(fpout, "\n    publication_reserved_session_id_high=%" PRId32, context->publication_reserved_session_id_high);
     fprintf(fpout, "\n    loss_report_length=%" PRIu64, (uint64_t)context->loss_report_length);
+    fprintf(fpout, "\n    trace_ring_capacity=%" PRIu64, (uint64_t)context->trace_ring_capacity);
     fprintf(fpout, "\n    send_to_sm_poll_ratio=%" PRIu64, (uint64_t)context->send_to_sm_poll_ratio);
+    fprintf(fpout, "\n    network_publication_max_messages_per_send=%" PRIu64,
+        (uint64_t)context->network_publication_max_messages_per_send);
+    fprintf(fpout, "\n    network_publication_heartbeat_backoff_enabled=%d",
+        context->network_publication_heartbeat_backoff_enabled);
+    fprintf(fpout, "\n    network_publication_send_coalescing=%d", context->network_publication_send_coalescing);
+    fprintf(fpout, "\n    receiver_io_vector_capacity=%" PRIu64, (uint64_t)context->receiver_io_vector_capacity);
+    fprintf(fpout, "\n    sender_io_vector_capacity=%" PRIu64, (uint64_t)context->sender_io_vector_capacity);
+    fprintf(fpout, "\n    receiver_shard_count=%" PRIu64, (uint64_t)context->receiver_shard_count);
+    fprintf(fpout, "\n    sender_shard_count=%" PRIu64, (uint64_t)context->sender_shard_count);
 
 #if defined(AERON_COMPILER_GCC)
 #pragma GCC diagnostic push
@@ -577,6 +911,10 @@ void aeron_driver_context_print_configuration(aeron_driver_context_t *context)
     fprintf(fpout, "\n    flow_control.group_tag=%" PRId64, context->flow_control.group_tag);
     fprintf(fpout, "\n    flow_control.group_min_size=%" PRId32, context->flow_control.group_min_size);
     fprintf(fpout, "\n    flow_control_receiver_timeout_ns=%" PRIu64, context->flow_control.receiver_timeout_ns);
+    fprintf(fpout, "\n    cubic_congestion_control.measure_rtt=%d", context->cubic_congestion_control.measure_rtt);
+    fprintf(fpout, "\n    cubic_congestion_control.initial_rtt_ns=%" PRIu64,
+        context->cubic_congestion_control.initial_rtt_ns);
+    fprintf(fpout, "\n    cubic_congestion_control.tcp_mode=%d", context->cubic_congestion_control.tcp_mode);
     fprintf(fpout, "\n    congestion_control_supplier_func=%p%s",
         (void *)context->congestion_control_supplier_func,
         aeron_dlinfo((const void *)context->congestion_control_supplier_func, buffer, sizeof(buffer)));
@@ -603,6 +941,26 @@ void aeron_driver_context_print_configuration(aeron_driver_context_t *context)
     fprintf(fpout, "\n    resolver_bootstrap_neighbor=%s",
         (void *)context->resolver_bootstrap_neighbor ? context->resolver_bootstrap_neighbor : "");
     fprintf(fpout, "\n    re_resolution_check_interval_ns=%" PRIu64, context->re_resolution_check_interval_ns);
+    fprintf(fpout, "\n    re_resolution_async=%d", context->re_resolution_async);
+    fprintf(fpout, "\n    metrics_http_endpoint=%s",
+        (void *)context->metrics_http_endpoint ? context->metrics_http_endpoint : "");
+    fprintf(fpout, "\n    recorder_channel=%s",
+        NULL != context->recorder_channel ? context->recorder_channel : "");
+    fprintf(fpout, "\n    recorder_stream_id=%" PRId32, context->recorder_stream_id);
+    fprintf(fpout, "\n    recorder_dir=%s", context->recorder_dir);
+    fprintf(fpout, "\n    recorder_segment_length=%" PRIu64, (uint64_t)context->recorder_segment_length);
+    fprintf(fpout, "\n    conductor_cycle_threshold_ns=%" PRIu64, context->conductor_cycle_threshold_ns);
+    fprintf(fpout, "\n    sender_cycle_threshold_ns=%" PRIu64, context->sender_cycle_threshold_ns);
+    fprintf(fpout, "\n    receiver_cycle_threshold_ns=%" PRIu64, context->receiver_cycle_threshold_ns);
+    fprintf(fpout, "\n    conductor_cpu_affinity=%s",
+        NULL != context->conductor_cpu_affinity ? context->conductor_cpu_affinity : "");
+    fprintf(fpout, "\n    sender_cpu_affinity=%s",
+        NULL != context->sender_cpu_affinity ? context->sender_cpu_affinity : "");
+    fprintf(fpout, "\n    receiver_cpu_affinity=%s",
+        NULL != context->receiver_cpu_affinity ? context->receiver_cpu_affinity : "");
+    fprintf(fpout, "\n    conductor_fifo_priority=%" PRId32, context->conductor_fifo_priority);
+    fprintf(fpout, "\n    sender_fifo_priority=%" PRId32, context->sender_fifo_priority);
+    fprintf(fpout, "\n    receiver_fifo_priority=%" PRId32, context->receiver_fifo_priority);
 
     const aeron_udp_channel_transport_bindings_t *bindings = context->udp_channel_transport_bindings;
     while (NULL != bindings)
@@ -655,9 +1013,39 @@ int aeron_driver_shared_do_work(void *clientd)
     aeron_driver_t *driver = (aeron_driver_t *)clientd;
     int sum = 0;
 
-    sum += aeron_driver_conductor_do_work(&driver->conductor);
-    sum += aeron_driver_sender_do_work(&driver->sender);
-    sum += aeron_driver_receiver_do_work(&driver->receiver);
+    if (0 == driver->context->shared_conductor_budget_ns)
+    {
+        sum += aeron_duty_cycle_tracker_do_work(
+            &driver->conductor_duty_cycle_tracker, aeron_driver_conductor_do_work, &driver->conductor);
+        sum += aeron_duty_cycle_tracker_do_work(
+            &driver->sender_duty_cycle_tracker, aeron_driver_sender_do_work, &driver->sender);
+        sum += aeron_duty_cycle_tracker_do_work(
+            &driver->receiver_duty_cycle_tracker, aeron_driver_receiver_do_work, &driver->receiver);
+
+        return sum;
+    }
+
+    /* the data path goes first and the conductor is deferred while it is busy, up to the budget */
+    sum += aeron_duty_cycle_tracker_do_work(
+        &driver->sender_duty_cycle_tracker, aeron_driver_sender_do_work, &driver->sender);
+    sum += aeron_duty_cycle_tracker_do_work(
+        &driver->receiver_duty_cycle_tracker, aeron_driver_receiver_do_work, &driver->receiver);
+
+    const int64_t now_ns = driver->context->nano_clock();
+
+    if (0 == sum ||
+        now_ns - driver->time_of_last_shared_conductor_work_ns >= (int64_t)driver->context->shared_conductor_budget_ns ||
+        aeron_driver_conductor_has_pending_commands(&driver->conductor))
+    {
+        sum += aeron_duty_cycle_tracker_do_work(
+            &driver->conductor_duty_cycle_tracker, aeron_driver_conductor_do_work, &driver->conductor);
+        driver->time_of_last_shared_conductor_work_ns = now_ns;
+    }
+    else
+    {
+        /* the sender and receiver read the cached clock which the conductor would otherwise keep up to date */
+        aeron_driver_conductor_update_clocks(&driver->conductor, now_ns);
+    }
 
     return sum;
 }
@@ -676,8 +1064,10 @@ int aeron_driver_shared_network_do_work(void *clientd)
     aeron_driver_t *driver = (aeron_driver_t *)clientd;
     int sum = 0;
 
-    sum += aeron_driver_sender_do_work(&driver->sender);
-    sum += aeron_driver_receiver_do_work(&driver->receiver);
+    sum += aeron_duty_cycle_tracker_do_work(
+        &driver->sender_duty_cycle_tracker, aeron_driver_sender_do_work, &driver->sender);
+    sum += aeron_duty_cycle_tracker_do_work(
+        &driver->receiver_duty_cycle_tracker, aeron_driver_receiver_do_work, &driver->receiver);
 
     return sum;
 }
@@ -713,6 +1103,7 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
     }
 
     _driver->context = context;
+    _driver->time_of_last_shared_conductor_work_ns = 0;
 
     for (int i = 0; i < AERON_AGENT_RUNNER_MAX; i++)
     {
@@ -721,6 +1112,26 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
         _driver->runners[i].on_close = NULL;
     }
 
+    _driver->sender_shards = NULL;
+    _driver->sender_shards_length = 0;
+    _driver->receiver_shards = NULL;
+    _driver->receiver_shards_length = 0;
+    _driver->log_buffer_pre_faulter_runner.state = AERON_AGENT_STATE_UNUSED;
+    _driver->log_buffer_pre_faulter_runner.role_name = NULL;
+    _driver->log_buffer_pre_faulter_runner.on_close = NULL;
+    _driver->housekeeper_runner.state = AERON_AGENT_STATE_UNUSED;
+    _driver->housekeeper_runner.role_name = NULL;
+    _driver->housekeeper_runner.on_close = NULL;
+    _driver->async_name_resolver_runner.state = AERON_AGENT_STATE_UNUSED;
+    _driver->async_name_resolver_runner.role_name = NULL;
+    _driver->async_name_resolver_runner.on_close = NULL;
+    _driver->metrics_agent_runner.state = AERON_AGENT_STATE_UNUSED;
+    _driver->metrics_agent_runner.role_name = NULL;
+    _driver->metrics_agent_runner.on_close = NULL;
+    _driver->recorder_runner.state = AERON_AGENT_STATE_UNUSED;
+    _driver->recorder_runner.role_name = NULL;
+    _driver->recorder_runner.on_close = NULL;
+
     if (aeron_logbuffer_check_term_length(_driver->context->term_buffer_length) < 0 ||
         aeron_logbuffer_check_term_length(_driver->context->ipc_term_buffer_length) < 0)
     {
@@ -738,6 +1149,16 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
         goto error;
     }
 
+    if (aeron_driver_validate_io_vector_capacities(_driver) < 0)
+    {
+        goto error;
+    }
+
+    if (aeron_driver_validate_shard_counts(_driver) < 0)
+    {
+        goto error;
+    }
+
     if (aeron_driver_validate_sufficient_socket_buffer_lengths(_driver) < 0)
     {
         goto error;
@@ -778,6 +1199,11 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
 
     _driver->context->sender_proxy = &_driver->sender.sender_proxy;
 
+    if (aeron_driver_sender_shards_init(_driver) < 0)
+    {
+        goto error;
+    }
+
     if (aeron_driver_receiver_init(
         &_driver->receiver, context, &_driver->conductor.system_counters, &_driver->conductor.error_log) < 0)
     {
@@ -786,6 +1212,173 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
 
     _driver->context->receiver_proxy = &_driver->receiver.receiver_proxy;
 
+    if (aeron_driver_receiver_shards_init(_driver) < 0)
+    {
+        goto error;
+    }
+
+    if (aeron_driver_create_trace_file(_driver) < 0)
+    {
+        goto error;
+    }
+
+    aeron_duty_cycle_tracker_init(
+        &_driver->conductor_duty_cycle_tracker,
+        &_driver->conductor.system_counters,
+        AERON_SYSTEM_COUNTER_CONDUCTOR_MAX_CYCLE_TIME,
+        context->conductor_cycle_threshold_ns,
+        &_driver->conductor.error_log,
+        "conductor");
+    aeron_duty_cycle_tracker_init(
+        &_driver->sender_duty_cycle_tracker,
+        &_driver->conductor.system_counters,
+        AERON_SYSTEM_COUNTER_SENDER_MAX_CYCLE_TIME,
+        context->sender_cycle_threshold_ns,
+        &_driver->conductor.error_log,
+        "sender");
+    aeron_duty_cycle_tracker_init(
+        &_driver->receiver_duty_cycle_tracker,
+        &_driver->conductor.system_counters,
+        AERON_SYSTEM_COUNTER_RECEIVER_MAX_CYCLE_TIME,
+        context->receiver_cycle_threshold_ns,
+        &_driver->conductor.error_log,
+        "receiver");
+
+    if (context->term_buffer_pre_fault_async)
+    {
+        if (aeron_log_buffer_pre_faulter_init(&_driver->log_buffer_pre_faulter, &_driver->conductor.error_log) < 0)
+        {
+            goto error;
+        }
+
+        if (aeron_agent_init(
+            &_driver->log_buffer_pre_faulter_runner,
+            "log-buffer-pre-faulter",
+            &_driver->log_buffer_pre_faulter,
+            _driver->context->agent_on_start_func,
+            _driver->context->agent_on_start_state,
+            aeron_log_buffer_pre_faulter_do_work,
+            aeron_log_buffer_pre_faulter_on_close,
+            aeron_idle_strategy_sleeping_idle,
+            &_driver->log_buffer_pre_faulter.idle_sleep_ns) < 0)
+        {
+            goto error;
+        }
+
+        context->log_buffer_pre_faulter = &_driver->log_buffer_pre_faulter;
+    }
+
+    if (context->conductor_housekeeping_async)
+    {
+        if (aeron_driver_housekeeper_init(&_driver->housekeeper, &_driver->conductor.error_log) < 0)
+        {
+            goto error;
+        }
+
+        if (aeron_agent_init(
+            &_driver->housekeeper_runner,
+            "conductor-housekeeper",
+            &_driver->housekeeper,
+            _driver->context->agent_on_start_func,
+            _driver->context->agent_on_start_state,
+            aeron_driver_housekeeper_do_work,
+            aeron_driver_housekeeper_on_close,
+            aeron_idle_strategy_sleeping_idle,
+            &_driver->housekeeper.idle_sleep_ns) < 0)
+        {
+            goto error;
+        }
+
+        context->housekeeper = &_driver->housekeeper;
+    }
+
+    if (context->re_resolution_async && aeron_default_name_resolver_supplier == context->name_resolver_supplier_func)
+    {
+        if (aeron_async_name_resolver_init(&_driver->async_name_resolver, context) < 0)
+        {
+            goto error;
+        }
+
+        if (aeron_agent_init(
+            &_driver->async_name_resolver_runner,
+            "async-name-resolver",
+            &_driver->async_name_resolver,
+            _driver->context->agent_on_start_func,
+            _driver->context->agent_on_start_state,
+            aeron_async_name_resolver_do_work,
+            aeron_async_name_resolver_on_close,
+            aeron_idle_strategy_sleeping_idle,
+            &_driver->async_name_resolver.idle_sleep_ns) < 0)
+        {
+            goto error;
+        }
+
+        context->async_name_resolver = &_driver->async_name_resolver;
+    }
+
+    if (NULL != context->metrics_http_endpoint)
+    {
+        if (aeron_driver_metrics_agent_init(
+            &_driver->metrics_agent,
+            context->metrics_http_endpoint,
+            context->counters_metadata_buffer,
+            AERON_COUNTERS_METADATA_BUFFER_LENGTH(context->counters_values_buffer_length),
+            context->counters_values_buffer,
+            context->counters_values_buffer_length,
+            context->loss_report.addr,
+            context->loss_report.length,
+            &_driver->conductor.error_log) < 0)
+        {
+            goto error;
+        }
+
+        if (aeron_agent_init(
+            &_driver->metrics_agent_runner,
+            "metrics-http",
+            &_driver->metrics_agent,
+            _driver->context->agent_on_start_func,
+            _driver->context->agent_on_start_state,
+            aeron_driver_metrics_agent_do_work,
+            aeron_driver_metrics_agent_on_close,
+            aeron_idle_strategy_sleeping_idle,
+            &_driver->metrics_agent.idle_sleep_ns) < 0)
+        {
+            aeron_driver_metrics_agent_on_close(&_driver->metrics_agent);
+            goto error;
+        }
+    }
+
+    if (NULL != context->recorder_channel)
+    {
+        if (aeron_driver_recorder_init(
+            &_driver->recorder,
+            context->aeron_dir,
+            context->recorder_channel,
+            context->recorder_stream_id,
+            context->recorder_dir,
+            context->recorder_segment_length,
+            &_driver->conductor.error_log) < 0)
+        {
+            aeron_driver_recorder_on_close(&_driver->recorder);
+            goto error;
+        }
+
+        if (aeron_agent_init(
+            &_driver->recorder_runner,
+            "recorder",
+            &_driver->recorder,
+            _driver->context->agent_on_start_func,
+            _driver->context->agent_on_start_state,
+            aeron_driver_recorder_do_work,
+            aeron_driver_recorder_on_close,
+            aeron_idle_strategy_sleeping_idle,
+            &_driver->recorder.idle_sleep_ns) < 0)
+        {
+            aeron_driver_recorder_on_close(&_driver->recorder);
+            goto error;
+        }
+    }
+
     aeron_mpsc_rb_consumer_heartbeat_time(&_driver->conductor.to_driver_commands, aeron_epoch_clock());
     aeron_cnc_version_signal_cnc_ready((aeron_cnc_metadata_t *)context->cnc_map.addr, AERON_CNC_VERSION);
 
@@ -831,6 +1424,11 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
             {
                 goto error;
             }
+
+            aeron_agent_set_thread_config(
+                &_driver->runners[AERON_AGENT_RUNNER_SHARED],
+                _driver->context->conductor_cpu_affinity,
+                _driver->context->conductor_fifo_priority);
             break;
 
         case AERON_THREADING_MODE_SHARED_NETWORK:
@@ -848,6 +1446,16 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
                 goto error;
             }
 
+            aeron_agent_set_duty_cycle_func(
+                &_driver->runners[AERON_AGENT_RUNNER_CONDUCTOR],
+                aeron_duty_cycle_tracker_update,
+                &_driver->conductor_duty_cycle_tracker);
+
+            aeron_agent_set_thread_config(
+                &_driver->runners[AERON_AGENT_RUNNER_CONDUCTOR],
+                _driver->context->conductor_cpu_affinity,
+                _driver->context->conductor_fifo_priority);
+
             if (aeron_agent_init(
                 &_driver->runners[AERON_AGENT_RUNNER_SHARED_NETWORK],
                 "[sender, receiver]",
@@ -861,6 +1469,11 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
             {
                 goto error;
             }
+
+            aeron_agent_set_thread_config(
+                &_driver->runners[AERON_AGENT_RUNNER_SHARED_NETWORK],
+                _driver->context->sender_cpu_affinity,
+                _driver->context->sender_fifo_priority);
             break;
 
         case AERON_THREADING_MODE_DEDICATED:
@@ -879,6 +1492,16 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
                 goto error;
             }
 
+            aeron_agent_set_duty_cycle_func(
+                &_driver->runners[AERON_AGENT_RUNNER_CONDUCTOR],
+                aeron_duty_cycle_tracker_update,
+                &_driver->conductor_duty_cycle_tracker);
+
+            aeron_agent_set_thread_config(
+                &_driver->runners[AERON_AGENT_RUNNER_CONDUCTOR],
+                _driver->context->conductor_cpu_affinity,
+                _driver->context->conductor_fifo_priority);
+
             if (aeron_agent_init(
                 &_driver->runners[AERON_AGENT_RUNNER_SENDER],
                 "sender",
@@ -893,6 +1516,43 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
                 goto error;
             }
 
+            aeron_agent_set_duty_cycle_func(
+                &_driver->runners[AERON_AGENT_RUNNER_SENDER],
+                aeron_duty_cycle_tracker_update,
+                &_driver->sender_duty_cycle_tracker);
+
+            aeron_agent_set_thread_config(
+                &_driver->runners[AERON_AGENT_RUNNER_SENDER],
+                _driver->context->sender_cpu_affinity,
+                _driver->context->sender_fifo_priority);
+
+            for (size_t i = 0; i < _driver->sender_shards_length; i++)
+            {
+                aeron_driver_sender_shard_t *shard = &_driver->sender_shards[i];
+                char role_name[32];
+
+                snprintf(role_name, sizeof(role_name), "sender-%" PRIu64, (uint64_t)(i + 1));
+
+                if (aeron_agent_init(
+                    &shard->runner,
+                    role_name,
+                    &shard->sender,
+                    _driver->context->agent_on_start_func,
+                    _driver->context->agent_on_start_state,
+                    aeron_driver_sender_do_work,
+                    aeron_driver_sender_on_close,
+                    _driver->context->sender_idle_strategy_func,
+                    _driver->context->sender_idle_strategy_state) < 0)
+                {
+                    goto error;
+                }
+
+                aeron_agent_set_duty_cycle_func(
+                    &shard->runner, aeron_duty_cycle_tracker_update, &_driver->sender_duty_cycle_tracker);
+                aeron_agent_set_thread_config(
+                    &shard->runner, _driver->context->sender_cpu_affinity, _driver->context->sender_fifo_priority);
+            }
+
             if (aeron_agent_init(
                 &_driver->runners[AERON_AGENT_RUNNER_RECEIVER],
                 "receiver",
@@ -906,6 +1566,43 @@ int aeron_driver_init(aeron_driver_t **driver, aeron_driver_context_t *context)
             {
                 goto error;
             }
+
+            aeron_agent_set_duty_cycle_func(
+                &_driver->runners[AERON_AGENT_RUNNER_RECEIVER],
+                aeron_duty_cycle_tracker_update,
+                &_driver->receiver_duty_cycle_tracker);
+
+            aeron_agent_set_thread_config(
+                &_driver->runners[AERON_AGENT_RUNNER_RECEIVER],
+                _driver->context->receiver_cpu_affinity,
+                _driver->context->receiver_fifo_priority);
+
+            for (size_t i = 0; i < _driver->receiver_shards_length; i++)
+            {
+                aeron_driver_receiver_shard_t *shard = &_driver->receiver_shards[i];
+                char role_name[32];
+
+                snprintf(role_name, sizeof(role_name), "receiver-%" PRIu64, (uint64_t)(i + 1));
+
+                if (aeron_agent_init(
+                    &shard->runner,
+                    role_name,
+                    &shard->receiver,
+                    _driver->context->agent_on_start_func,
+                    _driver->context->agent_on_start_state,
+                    aeron_driver_receiver_do_work,
+                    aeron_driver_receiver_on_close,
+                    _driver->context->receiver_idle_strategy_func,
+                    _driver->context->receiver_idle_strategy_state) < 0)
+                {
+                    goto error;
+                }
+
+                aeron_agent_set_duty_cycle_func(
+                    &shard->runner, aeron_duty_cycle_tracker_update, &_driver->receiver_duty_cycle_tracker);
+                aeron_agent_set_thread_config(
+                    &shard->runner, _driver->context->receiver_cpu_affinity, _driver->context->receiver_fifo_priority);
+            }
             break;
     }
 
@@ -966,6 +1663,68 @@ int aeron_driver_start(aeron_driver_t *driver, bool manual_main_loop)
         }
     }
 
+    for (size_t i = 0; i < driver->sender_shards_length; i++)
+    {
+        if (driver->sender_shards[i].runner.state == AERON_AGENT_STATE_INITED)
+        {
+            if (aeron_agent_start(&driver->sender_shards[i].runner) < 0)
+            {
+                return -1;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < driver->receiver_shards_length; i++)
+    {
+        if (driver->receiver_shards[i].runner.state == AERON_AGENT_STATE_INITED)
+        {
+            if (aeron_agent_start(&driver->receiver_shards[i].runner) < 0)
+            {
+                return -1;
+            }
+        }
+    }
+
+    if (driver->log_buffer_pre_faulter_runner.state == AERON_AGENT_STATE_INITED)
+    {
+        if (aeron_agent_start(&driver->log_buffer_pre_faulter_runner) < 0)
+        {
+            return -1;
+        }
+    }
+
+    if (driver->housekeeper_runner.state == AERON_AGENT_STATE_INITED)
+    {
+        if (aeron_agent_start(&driver->housekeeper_runner) < 0)
+        {
+            return -1;
+        }
+    }
+
+    if (driver->async_name_resolver_runner.state == AERON_AGENT_STATE_INITED)
+    {
+        if (aeron_agent_start(&driver->async_name_resolver_runner) < 0)
+        {
+            return -1;
+        }
+    }
+
+    if (driver->metrics_agent_runner.state == AERON_AGENT_STATE_INITED)
+    {
+        if (aeron_agent_start(&driver->metrics_agent_runner) < 0)
+        {
+            return -1;
+        }
+    }
+
+    if (driver->recorder_runner.state == AERON_AGENT_STATE_INITED)
+    {
+        if (aeron_agent_start(&driver->recorder_runner) < 0)
+        {
+            return -1;
+        }
+    }
+
     return 0;
 }
 
@@ -1010,6 +1769,47 @@ int aeron_driver_close(aeron_driver_t *driver)
         }
     }
 
+    for (size_t i = 0; i < driver->sender_shards_length; i++)
+    {
+        if (aeron_agent_stop(&driver->sender_shards[i].runner) < 0)
+        {
+            return -1;
+        }
+    }
+
+    for (size_t i = 0; i < driver->receiver_shards_length; i++)
+    {
+        if (aeron_agent_stop(&driver->receiver_shards[i].runner) < 0)
+        {
+            return -1;
+        }
+    }
+
+    if (aeron_agent_stop(&driver->log_buffer_pre_faulter_runner) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_agent_stop(&driver->housekeeper_runner) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_agent_stop(&driver->async_name_resolver_runner) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_agent_stop(&driver->metrics_agent_runner) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_agent_stop(&driver->recorder_runner) < 0)
+    {
+        return -1;
+    }
+
     for (int i = 0; i < AERON_AGENT_RUNNER_MAX; i++)
     {
         if (aeron_agent_close(&driver->runners[i]) < 0)
@@ -1018,6 +1818,55 @@ int aeron_driver_close(aeron_driver_t *driver)
         }
     }
 
+    for (size_t i = 0; i < driver->sender_shards_length; i++)
+    {
+        if (aeron_agent_close(&driver->sender_shards[i].runner) < 0)
+        {
+            return -1;
+        }
+
+        aeron_spsc_concurrent_array_queue_close(&driver->sender_shards[i].command_queue);
+    }
+
+    aeron_free(driver->sender_shards);
+
+    for (size_t i = 0; i < driver->receiver_shards_length; i++)
+    {
+        if (aeron_agent_close(&driver->receiver_shards[i].runner) < 0)
+        {
+            return -1;
+        }
+
+        aeron_spsc_concurrent_array_queue_close(&driver->receiver_shards[i].command_queue);
+    }
+
+    aeron_free(driver->receiver_shards);
+
+    if (aeron_agent_close(&driver->log_buffer_pre_faulter_runner) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_agent_close(&driver->housekeeper_runner) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_agent_close(&driver->async_name_resolver_runner) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_agent_close(&driver->metrics_agent_runner) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_agent_close(&driver->recorder_runner) < 0)
+    {
+        return -1;
+    }
+
     if (driver->context->dirs_delete_on_shutdown)
     {
         aeron_delete_directory(driver->context->aeron_dir);
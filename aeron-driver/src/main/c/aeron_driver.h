@@ -22,6 +22,12 @@
 #include "aeron_driver_conductor.h"
 #include "aeron_driver_sender.h"
 #include "aeron_driver_receiver.h"
+#include "aeron_log_buffer_pre_faulter.h"
+#include "aeron_driver_housekeeper.h"
+#include "aeron_async_name_resolver.h"
+#include "aeron_driver_metrics_agent.h"
+#include "aeron_driver_recorder.h"
+#include "aeron_duty_cycle_tracker.h"
 
 #define AERON_AGENT_RUNNER_CONDUCTOR 0
 #define AERON_AGENT_RUNNER_SENDER 1
@@ -30,6 +36,22 @@
 #define AERON_AGENT_RUNNER_SHARED 0
 #define AERON_AGENT_RUNNER_MAX 3
 
+typedef struct aeron_driver_sender_shard_stct
+{
+    aeron_driver_sender_t sender;
+    aeron_spsc_concurrent_array_queue_t command_queue;
+    aeron_agent_runner_t runner;
+}
+aeron_driver_sender_shard_t;
+
+typedef struct aeron_driver_receiver_shard_stct
+{
+    aeron_driver_receiver_t receiver;
+    aeron_spsc_concurrent_array_queue_t command_queue;
+    aeron_agent_runner_t runner;
+}
+aeron_driver_receiver_shard_t;
+
 typedef struct aeron_driver_stct
 {
     aeron_driver_context_t *context;
@@ -37,6 +59,26 @@ typedef struct aeron_driver_stct
     aeron_driver_sender_t sender;
     aeron_driver_receiver_t receiver;
     aeron_agent_runner_t runners[AERON_AGENT_RUNNER_MAX];
+    aeron_driver_sender_shard_t *sender_shards;
+    size_t sender_shards_length;
+    aeron_driver_sender_proxy_t *sender_shard_proxies[AERON_DRIVER_SENDER_SHARD_COUNT_MAX];
+    aeron_driver_receiver_shard_t *receiver_shards;
+    size_t receiver_shards_length;
+    aeron_driver_receiver_proxy_t *receiver_shard_proxies[AERON_DRIVER_RECEIVER_SHARD_COUNT_MAX];
+    aeron_log_buffer_pre_faulter_t log_buffer_pre_faulter;
+    aeron_agent_runner_t log_buffer_pre_faulter_runner;
+    aeron_driver_housekeeper_t housekeeper;
+    aeron_agent_runner_t housekeeper_runner;
+    aeron_async_name_resolver_t async_name_resolver;
+    aeron_agent_runner_t async_name_resolver_runner;
+    aeron_driver_metrics_agent_t metrics_agent;
+    aeron_agent_runner_t metrics_agent_runner;
+    aeron_driver_recorder_t recorder;
+    aeron_agent_runner_t recorder_runner;
+    aeron_duty_cycle_tracker_t conductor_duty_cycle_tracker;
+    aeron_duty_cycle_tracker_t sender_duty_cycle_tracker;
+    aeron_duty_cycle_tracker_t receiver_duty_cycle_tracker;
+    int64_t time_of_last_shared_conductor_work_ns;
 }
 aeron_driver_t;
 
@@ -59,10 +59,14 @@ aeron_subscription_tether_state_t;
 typedef struct aeron_tetherable_position_stct
 {
     bool is_tether;
+    bool is_observer;
+    bool is_short_circuit;
     aeron_subscription_tether_state_t state;
     int32_t counter_id;
     int64_t *value_addr;
+    int64_t *readiness_addr;
     int64_t subscription_registration_id;
+    int64_t subscription_client_id;
     int64_t time_of_last_update_ns;
 }
 aeron_tetherable_position_t;
@@ -86,6 +90,7 @@ typedef struct aeron_subscribable_stct
     size_t length;
     size_t capacity;
     aeron_tetherable_position_t *array;
+    uint64_t change_number;
     void (*add_position_hook_func)(void *clientd, int64_t *value_addr);
     void (*remove_position_hook_func)(void *clientd, int64_t *value_addr);
     void *clientd;
@@ -113,6 +118,7 @@ struct aeron_feedback_delay_generator_state_stct
 
     struct optimal_delay_stct
     {
+        double lambda;
         double rand_max;
         double base_x;
         double constant_t;
@@ -126,6 +132,8 @@ struct aeron_feedback_delay_generator_state_stct
 
 void aeron_driver_subscribable_remove_position(aeron_subscribable_t *subscribable, int32_t counter_id);
 
+void aeron_driver_subscribable_mark_ready(aeron_subscribable_t *subscribable, int32_t session_id, int64_t position);
+
 inline void aeron_driver_subscribable_null_hook(void *clientd, int64_t *value_addr)
 {
 }
@@ -26,6 +26,9 @@
 #include "aeron_driver_sender.h"
 #include "aeron_driver_receiver.h"
 #include "collections/aeron_bit_set.h"
+#include "aeron_async_name_resolver.h"
+#include "aeron_driver_housekeeper.h"
+#include "aeron_driver_tracepoints.h"
 
 #define STATIC_BIT_SET_U64_LEN (512)
 
@@ -82,7 +85,46 @@ static inline bool aeron_driver_conductor_has_network_subscription_interest(
     return false;
 }
 
-static inline bool aeron_driver_conductor_is_oldest_subscription_sparse(
+static inline bool aeron_driver_conductor_is_short_circuit_channel(
+    aeron_driver_conductor_t *conductor,
+    const aeron_receive_channel_endpoint_t *endpoint,
+    const aeron_network_publication_t *publication)
+{
+    const aeron_udp_channel_t *receive_channel = endpoint->conductor_fields.udp_channel;
+    const aeron_udp_channel_t *send_channel = publication->endpoint->conductor_fields.udp_channel;
+
+    return conductor->context->network_short_circuit_enabled &&
+        NULL != receive_channel &&
+        NULL != send_channel &&
+        aeron_udp_channel_equals(receive_channel, send_channel);
+}
+
+/*
+ * A session published on this driver to the channel of the endpoint is already read from its publication log by the
+ * local subscriptions, so the receiver must not build a second image of it.
+ */
+static inline bool aeron_driver_conductor_has_short_circuit_publication(
+    aeron_driver_conductor_t *conductor,
+    const aeron_receive_channel_endpoint_t *endpoint,
+    int32_t stream_id,
+    int32_t session_id)
+{
+    for (size_t i = 0, length = conductor->network_publications.length; i < length; i++)
+    {
+        aeron_network_publication_t *publication = conductor->network_publications.array[i].publication;
+
+        if (stream_id == publication->stream_id &&
+            session_id == publication->session_id &&
+            aeron_driver_conductor_is_short_circuit_channel(conductor, endpoint, publication))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static inline aeron_subscription_link_t *aeron_driver_conductor_oldest_subscription(
     aeron_driver_conductor_t *conductor,
     const aeron_receive_channel_endpoint_t *endpoint,
     int32_t stream_id,
@@ -90,7 +132,7 @@ static inline bool aeron_driver_conductor_is_oldest_subscription_sparse(
     int64_t highest_id)
 {
     int64_t registration_id = highest_id;
-    bool is_sparse = conductor->context->term_buffer_sparse_file;
+    aeron_subscription_link_t *oldest_link = NULL;
 
     for (size_t i = 0, length = conductor->network_subscriptions.length; i < length; i++)
     {
@@ -100,19 +142,30 @@ static inline bool aeron_driver_conductor_is_oldest_subscription_sparse(
             link->registration_id < registration_id)
         {
             registration_id = link->registration_id;
-            is_sparse = link->is_sparse;
+            oldest_link = link;
         }
     }
 
-    return is_sparse;
+    return oldest_link;
 }
 
 static bool aeron_driver_conductor_has_clashing_subscription(
     aeron_driver_conductor_t *conductor,
-    const aeron_receive_channel_endpoint_t *endpoint,
+    aeron_receive_channel_endpoint_t *endpoint,
     int32_t stream_id,
     aeron_uri_subscription_params_t *params)
 {
+    // The endpoint reference counts index existing subscriptions by stream and session, so no count means no clash.
+    int64_t existing_count = params->has_session_id ?
+        aeron_int64_counter_map_get(
+            &endpoint->stream_and_session_id_to_refcnt_map, aeron_map_compound_key(stream_id, params->session_id)) :
+        aeron_int64_counter_map_get(&endpoint->stream_id_to_refcnt_map, stream_id);
+
+    if (0 == existing_count)
+    {
+        return false;
+    }
+
     for (size_t i = 0, length = conductor->network_subscriptions.length; i < length; i++)
     {
         aeron_subscription_link_t *link = &conductor->network_subscriptions.array[i];
@@ -141,8 +194,63 @@ static bool aeron_driver_conductor_has_clashing_subscription(
     return false;
 }
 
+/*
+ * An inline subscriber rebuilds into the image log against its own position alone, so it must be the only
+ * subscription to the stream, and its socket is steered the data of just one stream per endpoint.
+ */
+static bool aeron_driver_conductor_has_clashing_inline_receive(
+    aeron_driver_conductor_t *conductor,
+    aeron_receive_channel_endpoint_t *endpoint,
+    int32_t stream_id,
+    aeron_uri_subscription_params_t *params)
+{
+    if (endpoint->conductor_fields.has_inline_receive_stream &&
+        (params->is_inline_receive || stream_id == endpoint->conductor_fields.inline_receive_stream_id))
+    {
+        aeron_set_err(
+            EINVAL,
+            "endpoint has an exclusive %s=true subscription to stream %" PRId32,
+            AERON_URI_INLINE_RECEIVE_KEY,
+            endpoint->conductor_fields.inline_receive_stream_id);
+        return true;
+    }
+
+    if (params->is_inline_receive)
+    {
+        aeron_receive_destination_t *destination = endpoint->destinations.array[0].destination;
+
+        if (!destination->transport.reuse_port || destination->fanout_transports_length > 0)
+        {
+            aeron_set_err(
+                EINVAL, "param: %s=true requires an endpoint bound with it, not by other subscriptions",
+                AERON_URI_INLINE_RECEIVE_KEY);
+            return true;
+        }
+
+        for (size_t i = 0, length = conductor->network_subscriptions.length; i < length; i++)
+        {
+            aeron_subscription_link_t *link = &conductor->network_subscriptions.array[i];
+
+            if (endpoint == link->endpoint && stream_id == link->stream_id)
+            {
+                aeron_set_err(
+                    EINVAL, "param: %s=true requires an exclusive subscription to stream %" PRId32,
+                    AERON_URI_INLINE_RECEIVE_KEY, stream_id);
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
 int aeron_driver_conductor_init(aeron_driver_conductor_t *conductor, aeron_driver_context_t *context)
 {
+    if (aeron_slab_allocator_init(&conductor->resource_allocator) < 0)
+    {
+        return -1;
+    }
+
     if (aeron_mpsc_rb_init(
         &conductor->to_driver_commands, context->to_driver_buffer, context->to_driver_buffer_length) < 0)
     {
@@ -177,11 +285,29 @@ int aeron_driver_conductor_init(aeron_driver_conductor_t *conductor, aeron_drive
         return -1;
     }
 
+    const size_t compact_length = AERON_COUNTERS_COMPACT_BUFFER_LENGTH((size_t)context->counters_compact_capacity);
+
+    if (aeron_counters_compact_region_format(
+        context->counters_compact_buffer,
+        compact_length,
+        context->counters_values_buffer_length,
+        context->counters_compact_capacity) < 0 ||
+        aeron_counters_manager_init_compact(
+            &conductor->counters_manager, context->counters_compact_buffer, compact_length) < 0)
+    {
+        return -1;
+    }
+
     if (aeron_system_counters_init(&conductor->system_counters, &conductor->counters_manager) < 0)
     {
         return -1;
     }
 
+    if (aeron_driver_tuning_init(&conductor->tuning, &conductor->counters_manager, context) < 0)
+    {
+        return -1;
+    }
+
     if (aeron_distinct_error_log_init(
         &conductor->error_log,
         context->error_buffer,
@@ -205,6 +331,18 @@ int aeron_driver_conductor_init(aeron_driver_conductor_t *conductor, aeron_drive
         return -1;
     }
 
+    if (aeron_int64_to_tagged_ptr_hash_map_init(
+        &conductor->client_index_by_id, 64, AERON_MAP_DEFAULT_LOAD_FACTOR) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_int64_to_tagged_ptr_hash_map_init(
+        &conductor->subscription_index_by_registration_id, 64, AERON_MAP_DEFAULT_LOAD_FACTOR) < 0)
+    {
+        return -1;
+    }
+
     if (aeron_loss_reporter_init(&conductor->loss_reporter, context->loss_report.addr, context->loss_report.length) < 0)
     {
         return -1;
@@ -237,6 +375,10 @@ int aeron_driver_conductor_init(aeron_driver_conductor_t *conductor, aeron_drive
     conductor->network_publications.has_reached_end_of_life = aeron_network_publication_entry_has_reached_end_of_life;
     conductor->network_publications.delete_func = aeron_network_publication_entry_delete;
 
+    conductor->term_length_recommendations.array = NULL;
+    conductor->term_length_recommendations.length = 0;
+    conductor->term_length_recommendations.capacity = 0;
+
     conductor->send_channel_endpoints.array = NULL;
     conductor->send_channel_endpoints.length = 0;
     conductor->send_channel_endpoints.capacity = 0;
@@ -277,6 +419,13 @@ int aeron_driver_conductor_init(aeron_driver_conductor_t *conductor, aeron_drive
     conductor->spy_subscriptions.length = 0;
     conductor->spy_subscriptions.capacity = 0;
 
+    conductor->channel_cache.length = 0;
+
+    conductor->parked_destinations.array = NULL;
+    conductor->parked_destinations.length = 0;
+    conductor->parked_destinations.capacity = 0;
+    conductor->async_name_resolutions_in_flight = 0;
+
     conductor->errors_counter = aeron_counters_manager_addr(&conductor->counters_manager, AERON_SYSTEM_COUNTER_ERRORS);
     conductor->unblocked_commands_counter = aeron_counters_manager_addr(
         &conductor->counters_manager, AERON_SYSTEM_COUNTER_UNBLOCKED_COMMANDS);
@@ -286,6 +435,8 @@ int aeron_driver_conductor_init(aeron_driver_conductor_t *conductor, aeron_drive
     int64_t now_ns = context->nano_clock();
 
     conductor->clock_update_deadline_ns = 0;
+    conductor->clients_deadline_ms = INT64_MAX;
+    conductor->lingering_resources_deadline_ns = INT64_MAX;
     conductor->time_of_last_timeout_check_ns = now_ns;
     conductor->time_of_last_to_driver_position_change_ns = now_ns;
     conductor->next_session_id = aeron_randomised_int32();
@@ -299,6 +450,14 @@ int aeron_driver_conductor_init(aeron_driver_conductor_t *conductor, aeron_drive
         return -1;
     }
 
+    conductor->log_fd_server.listen_fd = -1;
+    if (NULL != context->log_buffer_socket_path && aeron_fd_transfer_server_init(
+        &conductor->log_fd_server, context->log_buffer_socket_path, context->aeron_dir) < 0)
+    {
+        aeron_set_err(-1, "Failed to start log buffer socket: %s", aeron_errmsg());
+        return -1;
+    }
+
     char local_hostname[AERON_MAX_HOSTNAME_LEN];
     if (gethostname(local_hostname, AERON_MAX_HOSTNAME_LEN) < 0)
     {
@@ -315,6 +474,23 @@ int aeron_driver_conductor_init(aeron_driver_conductor_t *conductor, aeron_drive
             &conductor->counters_manager, AERON_SYSTEM_COUNTER_RESOLUTION_CHANGES, (size_t)label_length, label);
     }
 
+    if (context->log_buffer_pool_capacity > 0 && !context->term_buffer_memfd)
+    {
+        if (aeron_log_buffer_pool_init(
+            &conductor->log_buffer_pool, context->aeron_dir, context->log_buffer_pool_capacity) < 0)
+        {
+            return -1;
+        }
+
+        if (context->log_buffer_pool_warm_restart)
+        {
+            conductor->log_buffer_pool.retain_on_close = true;
+            aeron_log_buffer_pool_adopt_set_aside_dir(&conductor->log_buffer_pool, context->aeron_dir);
+        }
+
+        context->log_buffer_pool = &conductor->log_buffer_pool;
+    }
+
     conductor->context = context;
 
     return 0;
@@ -322,18 +498,48 @@ int aeron_driver_conductor_init(aeron_driver_conductor_t *conductor, aeron_drive
 
 int aeron_driver_conductor_find_client(aeron_driver_conductor_t *conductor, int64_t client_id)
 {
-    int index = -1;
+    uint32_t index;
 
-    for (int i = (int)conductor->clients.length - 1; i >= 0; i--)
+    if (aeron_int64_to_tagged_ptr_hash_map_get(&conductor->client_index_by_id, client_id, &index, NULL))
     {
-        if (client_id == conductor->clients.array[i].client_id)
-        {
-            index = i;
-            break;
-        }
+        return (int)index;
+    }
+
+    return -1;
+}
+
+static void aeron_driver_conductor_reindex_clients(aeron_driver_conductor_t *conductor)
+{
+    for (size_t i = 0, length = conductor->clients.length; i < length; i++)
+    {
+        // Removed clients have already dropped their key so this only updates existing keys and cannot fail.
+        aeron_int64_to_tagged_ptr_hash_map_put(
+            &conductor->client_index_by_id, conductor->clients.array[i].client_id, (int32_t)i, NULL);
     }
+}
+
+/*
+ * Subscription links are held by value in arrays that are compacted by moving the last element into the removed slot,
+ * so the index by registration id records the owning list and position and has to follow that move.
+ */
+static int aeron_driver_conductor_subscription_index_add(
+    aeron_driver_conductor_t *conductor, void *list, aeron_subscription_link_t *link, size_t index)
+{
+    return aeron_int64_to_tagged_ptr_hash_map_put(
+        &conductor->subscription_index_by_registration_id, link->registration_id, (int32_t)index, list);
+}
 
-    return index;
+static void aeron_driver_conductor_subscription_index_remove(
+    aeron_driver_conductor_t *conductor, void *list, aeron_subscription_link_t *array, size_t index, size_t last_index)
+{
+    aeron_int64_to_tagged_ptr_hash_map_remove(
+        &conductor->subscription_index_by_registration_id, array[index].registration_id, NULL, NULL);
+
+    if (index != last_index)
+    {
+        aeron_int64_to_tagged_ptr_hash_map_put(
+            &conductor->subscription_index_by_registration_id, array[last_index].registration_id, (int32_t)index, list);
+    }
 }
 
 aeron_client_t *aeron_driver_conductor_get_or_add_client(aeron_driver_conductor_t *conductor, int64_t client_id)
@@ -367,17 +573,29 @@ aeron_client_t *aeron_driver_conductor_get_or_add_client(aeron_driver_conductor_
 
                 client->heartbeat_timestamp.counter_id = client_heartbeat.counter_id;
                 client->heartbeat_timestamp.value_addr = client_heartbeat.value_addr;
+                client->has_directed_responses = false;
+                client->directed_responses_map.addr = NULL;
+                client->directed_responses_map.length = 0;
                 const int64_t now_ms = aeron_clock_cached_epoch_time(conductor->context->cached_clock);
                 aeron_counter_set_ordered(client->heartbeat_timestamp.value_addr, now_ms);
 
                 client->client_liveness_timeout_ms = conductor->context->client_liveness_timeout_ns < 1000000 ?
                     1 : conductor->context->client_liveness_timeout_ns / 1000000;
+                conductor->clients_deadline_ms = AERON_MIN(
+                    conductor->clients_deadline_ms, now_ms + client->client_liveness_timeout_ms);
                 client->publication_links.array = NULL;
                 client->publication_links.length = 0;
                 client->publication_links.capacity = 0;
                 client->counter_links.array = NULL;
                 client->counter_links.length = 0;
                 client->counter_links.capacity = 0;
+                if (aeron_int64_to_tagged_ptr_hash_map_put(
+                    &conductor->client_index_by_id, client_id, index, NULL) < 0)
+                {
+                    aeron_counters_manager_free(&conductor->counters_manager, client_heartbeat.counter_id);
+                    return NULL;
+                }
+
                 conductor->clients.length++;
 
                 aeron_driver_conductor_on_counter_ready(conductor, client_id, client_heartbeat.counter_id);
@@ -485,7 +703,7 @@ int aeron_confirm_publication_match(
         return -1;
     }
 
-    if (params->term_length != (size_t)logbuffer_metadata->term_length)
+    if (!params->is_term_length_auto && params->term_length != (size_t)logbuffer_metadata->term_length)
     {
         aeron_set_err(
             EINVAL,
@@ -503,6 +721,13 @@ void aeron_driver_conductor_unlink_from_endpoint(aeron_driver_conductor_t *condu
     aeron_receive_channel_endpoint_t *endpoint = link->endpoint;
 
     link->endpoint = NULL;
+    if (AERON_NULL_COUNTER_ID != link->inline_receive_counter_id)
+    {
+        aeron_counters_manager_free(&conductor->counters_manager, link->inline_receive_counter_id);
+        link->inline_receive_counter_id = AERON_NULL_COUNTER_ID;
+        endpoint->conductor_fields.has_inline_receive_stream = false;
+    }
+
     if (link->has_session_id)
     {
         aeron_receive_channel_endpoint_decref_to_stream_and_session(
@@ -516,11 +741,39 @@ void aeron_driver_conductor_unlink_from_endpoint(aeron_driver_conductor_t *condu
     aeron_driver_conductor_unlink_all_subscribable(conductor, link);
 }
 
+static void aeron_client_close_directed_responses(aeron_driver_conductor_t *conductor, aeron_client_t *client)
+{
+    if (client->has_directed_responses)
+    {
+        char path[AERON_MAX_PATH];
+
+        aeron_client_responses_location(path, sizeof(path), conductor->context->aeron_dir, client->client_id);
+        aeron_driver_housekeeper_close_file(conductor->context->housekeeper, &client->directed_responses_map, path);
+        client->has_directed_responses = false;
+    }
+}
+
+static void aeron_driver_conductor_unlink_offer_counters(
+    aeron_driver_conductor_t *conductor, aeron_publication_link_t *link)
+{
+    for (int i = 0; i < AERON_PUBLICATION_OFFER_METRIC_COUNT; i++)
+    {
+        if (AERON_NULL_COUNTER_ID != link->offer_counter_ids[i])
+        {
+            aeron_counters_manager_free(&conductor->counters_manager, link->offer_counter_ids[i]);
+            link->offer_counter_ids[i] = AERON_NULL_COUNTER_ID;
+        }
+    }
+}
+
 void aeron_client_delete(aeron_driver_conductor_t *conductor, aeron_client_t *client)
 {
+    aeron_int64_to_tagged_ptr_hash_map_remove(&conductor->client_index_by_id, client->client_id, NULL, NULL);
+
     for (size_t i = 0; i < client->publication_links.length; i++)
     {
         aeron_driver_managed_resource_t *resource = client->publication_links.array[i].resource;
+        aeron_driver_conductor_unlink_offer_counters(conductor, &client->publication_links.array[i]);
         resource->decref(resource->clientd);
     }
 
@@ -538,6 +791,8 @@ void aeron_client_delete(aeron_driver_conductor_t *conductor, aeron_client_t *cl
         {
             aeron_driver_conductor_unlink_all_subscribable(conductor, link);
 
+            aeron_driver_conductor_subscription_index_remove(
+                conductor, &conductor->ipc_subscriptions, conductor->ipc_subscriptions.array, i, last_index);
             aeron_array_fast_unordered_remove(
                 (uint8_t *)conductor->ipc_subscriptions.array, sizeof(aeron_subscription_link_t), i, last_index);
             conductor->ipc_subscriptions.length--;
@@ -553,6 +808,8 @@ void aeron_client_delete(aeron_driver_conductor_t *conductor, aeron_client_t *cl
         {
             aeron_driver_conductor_unlink_from_endpoint(conductor, link);
 
+            aeron_driver_conductor_subscription_index_remove(
+                conductor, &conductor->network_subscriptions, conductor->network_subscriptions.array, i, last_index);
             aeron_array_fast_unordered_remove(
                 (uint8_t *)conductor->network_subscriptions.array, sizeof(aeron_subscription_link_t), i, last_index);
             conductor->network_subscriptions.length--;
@@ -570,6 +827,8 @@ void aeron_client_delete(aeron_driver_conductor_t *conductor, aeron_client_t *cl
             link->spy_channel = NULL;
             aeron_driver_conductor_unlink_all_subscribable(conductor, link);
 
+            aeron_driver_conductor_subscription_index_remove(
+                conductor, &conductor->spy_subscriptions, conductor->spy_subscriptions.array, i, last_index);
             aeron_array_fast_unordered_remove(
                 (uint8_t *)conductor->spy_subscriptions.array, sizeof(aeron_subscription_link_t), i, last_index);
             conductor->spy_subscriptions.length--;
@@ -579,6 +838,8 @@ void aeron_client_delete(aeron_driver_conductor_t *conductor, aeron_client_t *cl
 
     aeron_counters_manager_free(&conductor->counters_manager, client->heartbeat_timestamp.counter_id);
 
+    aeron_client_close_directed_responses(conductor, client);
+
     aeron_free(client->publication_links.array);
     client->publication_links.array = NULL;
     client->publication_links.length = 0;
@@ -596,6 +857,7 @@ void aeron_client_delete(aeron_driver_conductor_t *conductor, aeron_client_t *cl
 
 void aeron_driver_conductor_on_available_image(
     aeron_driver_conductor_t *conductor,
+    int64_t client_id,
     int64_t correlation_id,
     int32_t stream_id,
     int32_t session_id,
@@ -637,7 +899,8 @@ void aeron_driver_conductor_on_available_image(
     ptr += sizeof(int32_t);
     memcpy(ptr, source_identity, source_identity_length);
 
-    aeron_driver_conductor_client_transmit(conductor, AERON_RESPONSE_ON_AVAILABLE_IMAGE, response, response_length);
+    aeron_driver_conductor_client_transmit_directed(
+        conductor, client_id, AERON_RESPONSE_ON_AVAILABLE_IMAGE, response, response_length);
 }
 
 void aeron_ipc_publication_entry_on_time_event(
@@ -677,17 +940,81 @@ bool aeron_network_publication_entry_has_reached_end_of_life(
     return aeron_network_publication_has_sender_released(entry->publication);
 }
 
+static aeron_term_length_recommendation_entry_t *aeron_driver_conductor_find_term_length_recommendation(
+    aeron_driver_conductor_t *conductor, const char *channel, int32_t stream_id)
+{
+    for (size_t i = 0, length = conductor->term_length_recommendations.length; i < length; i++)
+    {
+        aeron_term_length_recommendation_entry_t *entry = &conductor->term_length_recommendations.array[i];
+
+        if (stream_id == entry->stream_id && 0 == strcmp(channel, entry->channel))
+        {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+static void aeron_driver_conductor_record_term_length_recommendation(
+    aeron_driver_conductor_t *conductor, aeron_network_publication_t *publication)
+{
+    const int32_t term_length = (int32_t)aeron_counter_get(publication->snd_term_length_counter.value_addr);
+    const char *channel = publication->endpoint->conductor_fields.udp_channel->canonical_form;
+
+    if (term_length <= 0)
+    {
+        return;
+    }
+
+    aeron_term_length_recommendation_entry_t *entry = aeron_driver_conductor_find_term_length_recommendation(
+        conductor, channel, publication->stream_id);
+
+    if (NULL == entry)
+    {
+        int ensure_capacity_result = 0;
+        char *channel_copy = NULL;
+        const size_t channel_length = strlen(channel);
+
+        AERON_ARRAY_ENSURE_CAPACITY(
+            ensure_capacity_result, conductor->term_length_recommendations, aeron_term_length_recommendation_entry_t);
+
+        if (ensure_capacity_result < 0 || aeron_alloc((void **)&channel_copy, channel_length + 1) < 0)
+        {
+            return;
+        }
+
+        memcpy(channel_copy, channel, channel_length);
+        entry = &conductor->term_length_recommendations.array[conductor->term_length_recommendations.length++];
+        entry->channel = channel_copy;
+        entry->stream_id = publication->stream_id;
+    }
+
+    entry->term_length = term_length;
+}
+
 void aeron_network_publication_entry_delete(
     aeron_driver_conductor_t *conductor, aeron_network_publication_entry_t *entry)
 {
     aeron_send_channel_endpoint_t *endpoint = entry->publication->endpoint;
 
+    aeron_driver_conductor_record_term_length_recommendation(conductor, entry->publication);
+
     for (size_t i = 0, size = conductor->spy_subscriptions.length; i < size; i++)
     {
         aeron_subscription_link_t *link = &conductor->spy_subscriptions.array[i];
         aeron_driver_conductor_unlink_subscribable(link, &entry->publication->conductor_fields.subscribable);
     }
 
+    if (conductor->context->network_short_circuit_enabled)
+    {
+        for (size_t i = 0, size = conductor->network_subscriptions.length; i < size; i++)
+        {
+            aeron_subscription_link_t *link = &conductor->network_subscriptions.array[i];
+            aeron_driver_conductor_unlink_subscribable(link, &entry->publication->conductor_fields.subscribable);
+        }
+    }
+
     aeron_network_publication_close(&conductor->counters_manager, entry->publication);
     entry->publication = NULL;
 
@@ -702,16 +1029,21 @@ void aeron_network_publication_entry_delete(
     }
 }
 
-void aeron_driver_conductor_cleanup_spies(aeron_driver_conductor_t *conductor, aeron_network_publication_t *publication)
+static void aeron_driver_conductor_cleanup_spy_links(
+    aeron_driver_conductor_t *conductor,
+    aeron_network_publication_t *publication,
+    aeron_subscription_link_t *links,
+    size_t length)
 {
-    for (size_t i = 0, size = conductor->spy_subscriptions.length; i < size; i++)
+    for (size_t i = 0; i < length; i++)
     {
-        aeron_subscription_link_t *link = &conductor->spy_subscriptions.array[i];
+        aeron_subscription_link_t *link = &links[i];
 
         if (aeron_driver_conductor_is_subscribable_linked(link, &publication->conductor_fields.subscribable))
         {
             aeron_driver_conductor_on_unavailable_image(
                 conductor,
+                link->client_id,
                 publication->conductor_fields.managed_resource.registration_id,
                 link->registration_id,
                 link->stream_id,
@@ -723,10 +1055,22 @@ void aeron_driver_conductor_cleanup_spies(aeron_driver_conductor_t *conductor, a
     }
 }
 
+void aeron_driver_conductor_cleanup_spies(aeron_driver_conductor_t *conductor, aeron_network_publication_t *publication)
+{
+    aeron_driver_conductor_cleanup_spy_links(
+        conductor, publication, conductor->spy_subscriptions.array, conductor->spy_subscriptions.length);
+
+    if (conductor->context->network_short_circuit_enabled)
+    {
+        aeron_driver_conductor_cleanup_spy_links(
+            conductor, publication, conductor->network_subscriptions.array, conductor->network_subscriptions.length);
+    }
+}
+
 void aeron_driver_conductor_cleanup_network_publication(
     aeron_driver_conductor_t *conductor, aeron_network_publication_t *publication)
 {
-    aeron_driver_sender_proxy_on_remove_publication(conductor->context->sender_proxy, publication);
+    aeron_driver_sender_proxy_on_remove_publication(publication->endpoint->sender_proxy, publication);
 }
 
 void aeron_send_channel_endpoint_entry_on_time_event(
@@ -738,7 +1082,8 @@ void aeron_send_channel_endpoint_entry_on_time_event(
 bool aeron_send_channel_endpoint_entry_has_reached_end_of_life(
     aeron_driver_conductor_t *conductor, aeron_send_channel_endpoint_entry_t *entry)
 {
-    return aeron_send_channel_endpoint_has_sender_released(entry->endpoint);
+    return 0 == conductor->async_name_resolutions_in_flight &&
+        aeron_send_channel_endpoint_has_sender_released(entry->endpoint);
 }
 
 void aeron_send_channel_endpoint_entry_delete(
@@ -756,7 +1101,8 @@ void aeron_receive_channel_endpoint_entry_on_time_event(
 bool aeron_receive_channel_endpoint_entry_has_reached_end_of_life(
     aeron_driver_conductor_t *conductor, aeron_receive_channel_endpoint_entry_t *entry)
 {
-    return aeron_receive_channel_endpoint_has_receiver_released(entry->endpoint);
+    return 0 == conductor->async_name_resolutions_in_flight &&
+        aeron_receive_channel_endpoint_has_receiver_released(entry->endpoint);
 }
 
 void aeron_receive_channel_endpoint_entry_delete(
@@ -837,6 +1183,7 @@ void aeron_driver_conductor_image_transition_to_linger(
 
                 aeron_driver_conductor_on_unavailable_image(
                     conductor,
+                    link->client_id,
                     image->conductor_fields.managed_resource.registration_id,
                     link->registration_id,
                     image->stream_id,
@@ -848,7 +1195,7 @@ void aeron_driver_conductor_image_transition_to_linger(
         if (rejoin)
         {
             aeron_driver_receiver_proxy_on_remove_cool_down(
-                conductor->context->receiver_proxy, image->endpoint, image->session_id, image->stream_id);
+                image->endpoint->receiver_proxy, image->endpoint, image->session_id, image->stream_id);
         }
     }
 }
@@ -867,11 +1214,52 @@ for (int last_index = (int)l.length - 1, i = last_index; i >= 0; i--) \
     } \
 }
 
+/*
+ * Clients and lingering resources only change state when a deadline passes, so they are swept once the earliest
+ * deadline seen on the previous sweep has been reached. Heartbeats only ever move a client deadline later, and anything
+ * that brings a deadline forward lowers the earliest deadline directly.
+ */
+static int64_t aeron_driver_conductor_earliest_client_deadline_ms(aeron_driver_conductor_t *conductor)
+{
+    int64_t deadline_ms = INT64_MAX;
+
+    for (size_t i = 0, length = conductor->clients.length; i < length; i++)
+    {
+        aeron_client_t *client = &conductor->clients.array[i];
+        int64_t timestamp_ms = aeron_counter_get_volatile(client->heartbeat_timestamp.value_addr);
+        deadline_ms = AERON_MIN(deadline_ms, timestamp_ms + client->client_liveness_timeout_ms);
+    }
+
+    return deadline_ms;
+}
+
+static int64_t aeron_driver_conductor_earliest_linger_deadline_ns(aeron_driver_conductor_t *conductor)
+{
+    int64_t deadline_ns = INT64_MAX;
+
+    for (size_t i = 0, length = conductor->lingering_resources.length; i < length; i++)
+    {
+        deadline_ns = AERON_MIN(deadline_ns, conductor->lingering_resources.array[i].timeout_ns);
+    }
+
+    return deadline_ns;
+}
+
 void aeron_driver_conductor_on_check_managed_resources(
     aeron_driver_conductor_t *conductor, int64_t now_ns, int64_t now_ms)
 {
-    AERON_DRIVER_CONDUCTOR_CHECK_MANAGED_RESOURCE(
-        conductor, conductor->clients, aeron_client_t, now_ns, now_ms);
+    if (now_ms > conductor->clients_deadline_ms)
+    {
+        const size_t clients_length = conductor->clients.length;
+        AERON_DRIVER_CONDUCTOR_CHECK_MANAGED_RESOURCE(
+            conductor, conductor->clients, aeron_client_t, now_ns, now_ms);
+        if (clients_length != conductor->clients.length)
+        {
+            aeron_driver_conductor_reindex_clients(conductor);
+        }
+        conductor->clients_deadline_ms = aeron_driver_conductor_earliest_client_deadline_ms(conductor);
+    }
+
     AERON_DRIVER_CONDUCTOR_CHECK_MANAGED_RESOURCE(
         conductor, conductor->ipc_publications, aeron_ipc_publication_entry_t, now_ns, now_ms);
     AERON_DRIVER_CONDUCTOR_CHECK_MANAGED_RESOURCE(
@@ -882,43 +1270,126 @@ void aeron_driver_conductor_on_check_managed_resources(
         conductor, conductor->receive_channel_endpoints, aeron_receive_channel_endpoint_entry_t, now_ns, now_ms);
     AERON_DRIVER_CONDUCTOR_CHECK_MANAGED_RESOURCE(
         conductor, conductor->publication_images, aeron_publication_image_entry_t, now_ns, now_ms);
-    AERON_DRIVER_CONDUCTOR_CHECK_MANAGED_RESOURCE(
-        conductor, conductor->lingering_resources, aeron_linger_resource_entry_t, now_ns, now_ms);
+
+    if (now_ns > conductor->lingering_resources_deadline_ns)
+    {
+        AERON_DRIVER_CONDUCTOR_CHECK_MANAGED_RESOURCE(
+            conductor, conductor->lingering_resources, aeron_linger_resource_entry_t, now_ns, now_ms);
+        conductor->lingering_resources_deadline_ns = aeron_driver_conductor_earliest_linger_deadline_ns(conductor);
+    }
+
+    aeron_driver_conductor_log_buffer_memory(conductor);
 }
 
-aeron_ipc_publication_t *aeron_driver_conductor_get_or_add_ipc_publication(
-    aeron_driver_conductor_t *conductor,
-    aeron_client_t *client,
-    aeron_uri_publication_params_t *params,
-    int64_t registration_id,
-    int32_t stream_id,
-    size_t uri_length,
-    const char *uri,
-    bool is_exclusive)
+uint64_t aeron_driver_conductor_log_buffer_memory(aeron_driver_conductor_t *conductor)
 {
-    aeron_ipc_publication_t *publication = NULL;
+    uint64_t mapped_length = 0;
 
-    uint64_t bits[STATIC_BIT_SET_U64_LEN];
-    aeron_bit_set_t session_id_offsets;
-    aeron_bit_set_stack_init(
-        conductor->ipc_publications.length + 1, bits, STATIC_BIT_SET_U64_LEN, false, &session_id_offsets);
-    assert(conductor->ipc_publications.length < session_id_offsets.bit_set_length);
+    for (size_t i = 0, length = conductor->ipc_publications.length; i < length; i++)
+    {
+        mapped_length += conductor->ipc_publications.array[i].publication->mapped_raw_log.mapped_file.length;
+    }
 
-    bool is_session_id_in_use = false;
+    for (size_t i = 0, length = conductor->network_publications.length; i < length; i++)
+    {
+        mapped_length += conductor->network_publications.array[i].publication->mapped_raw_log.mapped_file.length;
+    }
 
-    for (size_t i = 0; i < conductor->ipc_publications.length; i++)
+    for (size_t i = 0, length = conductor->publication_images.length; i < length; i++)
     {
-        aeron_ipc_publication_t *pub_entry = conductor->ipc_publications.array[i].publication;
+        mapped_length += conductor->publication_images.array[i].image->mapped_raw_log.mapped_file.length;
+    }
 
-        if (stream_id == pub_entry->stream_id)
-        {
-            if (AERON_IPC_PUBLICATION_STATE_ACTIVE == pub_entry->conductor_fields.state &&
-                NULL == publication && !is_exclusive && !pub_entry->is_exclusive)
-            {
-                publication = pub_entry;
-            }
+    if (NULL != conductor->context->log_buffer_pool)
+    {
+        mapped_length += aeron_log_buffer_pool_mapped_length(conductor->context->log_buffer_pool);
+    }
 
-            if (AERON_IPC_PUBLICATION_STATE_ACTIVE == pub_entry->conductor_fields.state ||
+    aeron_counter_set_ordered(
+        aeron_system_counter_addr(&conductor->system_counters, AERON_SYSTEM_COUNTER_LOG_BUFFER_MEMORY),
+        (int64_t)mapped_length);
+
+    return mapped_length;
+}
+
+int aeron_driver_conductor_reserve_log_buffer_memory(aeron_driver_conductor_t *conductor, uint64_t term_length)
+{
+    const uint64_t budget = conductor->context->log_buffer_memory_budget;
+
+    if (0 == budget)
+    {
+        return 0;
+    }
+
+    const uint64_t log_length = aeron_logbuffer_compute_log_length(term_length, conductor->context->file_page_size);
+    uint64_t mapped_length = aeron_driver_conductor_log_buffer_memory(conductor);
+
+    if (mapped_length + log_length > budget && NULL != conductor->context->log_buffer_pool)
+    {
+        const size_t evicted_length = aeron_log_buffer_pool_evict(
+            conductor->context->log_buffer_pool, (size_t)(mapped_length + log_length - budget));
+
+        if (evicted_length > 0)
+        {
+            aeron_counter_increment(
+                aeron_system_counter_addr(&conductor->system_counters, AERON_SYSTEM_COUNTER_LOG_BUFFER_BUDGET_EVICTIONS),
+                1);
+            mapped_length = aeron_driver_conductor_log_buffer_memory(conductor);
+        }
+    }
+
+    if (mapped_length + log_length > budget)
+    {
+        aeron_counter_increment(
+            aeron_system_counter_addr(&conductor->system_counters, AERON_SYSTEM_COUNTER_LOG_BUFFER_BUDGET_REJECTIONS),
+            1);
+        aeron_set_err(
+            ENOSPC,
+            "log buffer of %" PRIu64 " bytes for term-length=%" PRIu64 " exceeds memory budget: mapped=%" PRIu64
+            " budget=%" PRIu64,
+            log_length,
+            term_length,
+            mapped_length,
+            budget);
+        return -1;
+    }
+
+    return 0;
+}
+
+aeron_ipc_publication_t *aeron_driver_conductor_get_or_add_ipc_publication(
+    aeron_driver_conductor_t *conductor,
+    aeron_client_t *client,
+    aeron_uri_publication_params_t *params,
+    int64_t registration_id,
+    int32_t stream_id,
+    size_t uri_length,
+    const char *uri,
+    bool is_exclusive)
+{
+    aeron_ipc_publication_t *publication = NULL;
+
+    uint64_t bits[STATIC_BIT_SET_U64_LEN];
+    aeron_bit_set_t session_id_offsets;
+    aeron_bit_set_stack_init(
+        conductor->ipc_publications.length + 1, bits, STATIC_BIT_SET_U64_LEN, false, &session_id_offsets);
+    assert(conductor->ipc_publications.length < session_id_offsets.bit_set_length);
+
+    bool is_session_id_in_use = false;
+
+    for (size_t i = 0; i < conductor->ipc_publications.length; i++)
+    {
+        aeron_ipc_publication_t *pub_entry = conductor->ipc_publications.array[i].publication;
+
+        if (stream_id == pub_entry->stream_id)
+        {
+            if (AERON_IPC_PUBLICATION_STATE_ACTIVE == pub_entry->conductor_fields.state &&
+                NULL == publication && !is_exclusive && !pub_entry->is_exclusive)
+            {
+                publication = pub_entry;
+            }
+
+            if (AERON_IPC_PUBLICATION_STATE_ACTIVE == pub_entry->conductor_fields.state ||
                 AERON_IPC_PUBLICATION_STATE_DRAINING == pub_entry->conductor_fields.state)
             {
                 if (params->has_session_id && pub_entry->session_id == params->session_id)
@@ -967,6 +1438,11 @@ aeron_ipc_publication_t *aeron_driver_conductor_get_or_add_ipc_publication(
     {
         if (NULL == publication)
         {
+            if (aeron_driver_conductor_reserve_log_buffer_memory(conductor, params->term_length) < 0)
+            {
+                return NULL;
+            }
+
             AERON_ARRAY_ENSURE_CAPACITY(
                 ensure_capacity_result, conductor->ipc_publications, aeron_ipc_publication_entry_t);
 
@@ -1012,6 +1488,7 @@ aeron_ipc_publication_t *aeron_driver_conductor_get_or_add_ipc_publication(
                 if (aeron_ipc_publication_create(
                         &publication,
                         conductor->context,
+                        &conductor->resource_allocator.allocator,
                         session_id,
                         stream_id,
                         registration_id,
@@ -1138,6 +1615,11 @@ aeron_network_publication_t *aeron_driver_conductor_get_or_add_network_publicati
     {
         if (NULL == publication)
         {
+            if (aeron_driver_conductor_reserve_log_buffer_memory(conductor, params->term_length) < 0)
+            {
+                return NULL;
+            }
+
             AERON_ARRAY_ENSURE_CAPACITY(
                 ensure_capacity_result, conductor->network_publications, aeron_network_publication_entry_t);
 
@@ -1169,6 +1651,7 @@ aeron_network_publication_t *aeron_driver_conductor_get_or_add_network_publicati
                 aeron_position_t snd_pos_position;
                 aeron_position_t snd_lmt_position;
                 aeron_atomic_counter_t snd_bpe_counter;
+                aeron_atomic_counter_t snd_term_length_counter;
 
                 pub_pos_position.counter_id = aeron_counter_publisher_position_allocate(
                     &conductor->counters_manager, registration_id, session_id, stream_id, uri_length, uri);
@@ -1180,10 +1663,12 @@ aeron_network_publication_t *aeron_driver_conductor_get_or_add_network_publicati
                     &conductor->counters_manager, registration_id, session_id, stream_id, uri_length, uri);
                 snd_bpe_counter.counter_id = aeron_counter_sender_bpe_allocate(
                     &conductor->counters_manager, registration_id, session_id, stream_id, uri_length, uri);
+                snd_term_length_counter.counter_id = aeron_counter_sender_term_length_allocate(
+                    &conductor->counters_manager, registration_id, session_id, stream_id, uri_length, uri);
 
                 if (pub_pos_position.counter_id < 0 || pub_lmt_position.counter_id < 0 ||
                     snd_pos_position.counter_id < 0 || snd_lmt_position.counter_id < 0 ||
-                    snd_bpe_counter.counter_id < 0)
+                    snd_bpe_counter.counter_id < 0 || snd_term_length_counter.counter_id < 0)
                 {
                     return NULL;
                 }
@@ -1198,6 +1683,71 @@ aeron_network_publication_t *aeron_driver_conductor_get_or_add_network_publicati
                 &conductor->counters_manager, snd_lmt_position.counter_id);
                 snd_bpe_counter.value_addr = aeron_counters_manager_addr(
                 &conductor->counters_manager, snd_bpe_counter.counter_id);
+                snd_term_length_counter.value_addr = aeron_counters_manager_addr(
+                &conductor->counters_manager, snd_term_length_counter.counter_id);
+
+                aeron_position_t snd_inline_position;
+                aeron_position_t *snd_inline_position_ptr = NULL;
+
+                if (params->is_inline_send)
+                {
+                    snd_inline_position.counter_id = aeron_counter_sender_inline_position_allocate(
+                        &conductor->counters_manager,
+                        registration_id,
+                        session_id,
+                        stream_id,
+                        &endpoint->conductor_fields.udp_channel->remote_data);
+                    if (snd_inline_position.counter_id < 0)
+                    {
+                        return NULL;
+                    }
+
+                    snd_inline_position.value_addr = aeron_counters_manager_addr(
+                        &conductor->counters_manager, snd_inline_position.counter_id);
+                    snd_inline_position_ptr = &snd_inline_position;
+                }
+
+                aeron_stream_latency_histogram_t snd_latency_histogram;
+                aeron_stream_latency_histogram_t *snd_latency_histogram_ptr = NULL;
+
+                if (conductor->context->stream_latency_counters_enabled)
+                {
+                    if (aeron_stream_latency_histogram_allocate(
+                        &snd_latency_histogram,
+                        &conductor->counters_manager,
+                        AERON_COUNTER_SENDER_LATENCY_NAME,
+                        AERON_COUNTER_SENDER_LATENCY_TYPE_ID,
+                        registration_id,
+                        session_id,
+                        stream_id,
+                        uri_length,
+                        uri) < 0)
+                    {
+                        return NULL;
+                    }
+
+                    snd_latency_histogram_ptr = &snd_latency_histogram;
+                }
+
+                aeron_stream_cpu_counters_t snd_cpu_counters;
+                aeron_stream_cpu_counters_t *snd_cpu_counters_ptr = NULL;
+
+                if (conductor->context->stream_cpu_counters_enabled)
+                {
+                    if (aeron_stream_cpu_counters_allocate_sender(
+                        &snd_cpu_counters,
+                        &conductor->counters_manager,
+                        registration_id,
+                        session_id,
+                        stream_id,
+                        uri_length,
+                        uri) < 0)
+                    {
+                        return NULL;
+                    }
+
+                    snd_cpu_counters_ptr = &snd_cpu_counters;
+                }
 
                 if (params->has_position)
                 {
@@ -1211,6 +1761,10 @@ aeron_network_publication_t *aeron_driver_conductor_get_or_add_network_publicati
                     aeron_counter_set_ordered(pub_lmt_position.value_addr, position);
                     aeron_counter_set_ordered(snd_pos_position.value_addr, position);
                     aeron_counter_set_ordered(snd_lmt_position.value_addr, position);
+                    if (NULL != snd_inline_position_ptr)
+                    {
+                        aeron_counter_set_ordered(snd_inline_position.value_addr, position);
+                    }
                 }
 
                 if (pub_lmt_position.counter_id >= 0 &&
@@ -1218,6 +1772,7 @@ aeron_network_publication_t *aeron_driver_conductor_get_or_add_network_publicati
                         &publication,
                         endpoint,
                         conductor->context,
+                        &conductor->resource_allocator.allocator,
                         registration_id,
                         session_id,
                         stream_id,
@@ -1227,6 +1782,10 @@ aeron_network_publication_t *aeron_driver_conductor_get_or_add_network_publicati
                         &snd_pos_position,
                         &snd_lmt_position,
                         &snd_bpe_counter,
+                        &snd_term_length_counter,
+                        snd_latency_histogram_ptr,
+                        snd_cpu_counters_ptr,
+                        snd_inline_position_ptr,
                         flow_control_strategy,
                         params,
                         is_exclusive,
@@ -1234,7 +1793,7 @@ aeron_network_publication_t *aeron_driver_conductor_get_or_add_network_publicati
                 {
                     endpoint->conductor_fields.managed_resource.incref(
                         endpoint->conductor_fields.managed_resource.clientd);
-                    aeron_driver_sender_proxy_on_add_publication(conductor->context->sender_proxy, publication);
+                    aeron_driver_sender_proxy_on_add_publication(endpoint->sender_proxy, publication);
 
                     aeron_publication_link_t *link = &client->publication_links.array[client->publication_links.length];
 
@@ -1328,6 +1887,39 @@ int aeron_driver_conductor_update_and_check_ats_status(
     return 0;
 }
 
+aeron_driver_sender_proxy_t *aeron_driver_conductor_least_loaded_sender_proxy(aeron_driver_conductor_t *conductor)
+{
+    aeron_driver_context_t *context = conductor->context;
+    aeron_driver_sender_proxy_t *sender_proxy = context->sender_proxy;
+
+    if (context->sender_shard_proxies_length > 1)
+    {
+        size_t min_publication_count = SIZE_MAX;
+
+        for (size_t i = 0; i < context->sender_shard_proxies_length; i++)
+        {
+            aeron_driver_sender_proxy_t *shard_proxy = context->sender_shard_proxies[i];
+            size_t publication_count = 0;
+
+            for (size_t j = 0, length = conductor->network_publications.length; j < length; j++)
+            {
+                if (shard_proxy == conductor->network_publications.array[j].publication->endpoint->sender_proxy)
+                {
+                    publication_count++;
+                }
+            }
+
+            if (publication_count < min_publication_count)
+            {
+                min_publication_count = publication_count;
+                sender_proxy = shard_proxy;
+            }
+        }
+    }
+
+    return sender_proxy;
+}
+
 aeron_send_channel_endpoint_t *aeron_driver_conductor_get_or_add_send_channel_endpoint(
     aeron_driver_conductor_t *conductor, aeron_udp_channel_t *channel)
 {
@@ -1363,6 +1955,12 @@ aeron_send_channel_endpoint_t *aeron_driver_conductor_get_or_add_send_channel_en
         return NULL;
     }
 
+    if (NULL != endpoint && endpoint->conductor_fields.udp_channel == channel)
+    {
+        // The channel cache shared the endpoint's own channel, so release the reference taken for this command.
+        aeron_udp_channel_delete(channel);
+    }
+
     if (NULL == endpoint)
     {
         int ensure_capacity_result = 0;
@@ -1376,7 +1974,12 @@ aeron_send_channel_endpoint_t *aeron_driver_conductor_get_or_add_send_channel_en
         }
 
         if (aeron_send_channel_endpoint_create(
-            &endpoint, channel, conductor->context, &conductor->counters_manager) < 0)
+            &endpoint,
+            channel,
+            aeron_driver_conductor_least_loaded_sender_proxy(conductor),
+            conductor->context,
+            &conductor->resource_allocator.allocator,
+            &conductor->counters_manager) < 0)
         {
             return NULL;
         }
@@ -1391,7 +1994,7 @@ aeron_send_channel_endpoint_t *aeron_driver_conductor_get_or_add_send_channel_en
             return NULL;
         }
 
-        aeron_driver_sender_proxy_on_add_endpoint(conductor->context->sender_proxy, endpoint);
+        aeron_driver_sender_proxy_on_add_endpoint(endpoint->sender_proxy, endpoint);
         conductor->send_channel_endpoints.array[conductor->send_channel_endpoints.length++].endpoint = endpoint;
 
         aeron_counter_set_ordered(
@@ -1401,6 +2004,39 @@ aeron_send_channel_endpoint_t *aeron_driver_conductor_get_or_add_send_channel_en
     return endpoint;
 }
 
+aeron_driver_receiver_proxy_t *aeron_driver_conductor_least_loaded_receiver_proxy(aeron_driver_conductor_t *conductor)
+{
+    aeron_driver_context_t *context = conductor->context;
+    aeron_driver_receiver_proxy_t *receiver_proxy = context->receiver_proxy;
+
+    if (context->receiver_shard_proxies_length > 1)
+    {
+        size_t min_endpoint_count = SIZE_MAX;
+
+        for (size_t i = 0; i < context->receiver_shard_proxies_length; i++)
+        {
+            aeron_driver_receiver_proxy_t *shard_proxy = context->receiver_shard_proxies[i];
+            size_t endpoint_count = 0;
+
+            for (size_t j = 0, length = conductor->receive_channel_endpoints.length; j < length; j++)
+            {
+                if (shard_proxy == conductor->receive_channel_endpoints.array[j].endpoint->receiver_proxy)
+                {
+                    endpoint_count++;
+                }
+            }
+
+            if (endpoint_count < min_endpoint_count)
+            {
+                min_endpoint_count = endpoint_count;
+                receiver_proxy = shard_proxy;
+            }
+        }
+    }
+
+    return receiver_proxy;
+}
+
 aeron_receive_channel_endpoint_t *aeron_driver_conductor_get_or_add_receive_channel_endpoint(
     aeron_driver_conductor_t *conductor, aeron_udp_channel_t *channel)
 {
@@ -1435,6 +2071,12 @@ aeron_receive_channel_endpoint_t *aeron_driver_conductor_get_or_add_receive_chan
         return NULL;
     }
 
+    if (NULL != endpoint && endpoint->conductor_fields.udp_channel == channel)
+    {
+        // The channel cache shared the endpoint's own channel, so release the reference taken for this command.
+        aeron_udp_channel_delete(channel);
+    }
+
     if (NULL == endpoint)
     {
         aeron_atomic_counter_t status_indicator;
@@ -1480,6 +2122,7 @@ aeron_receive_channel_endpoint_t *aeron_driver_conductor_get_or_add_receive_chan
             destination,
             &status_indicator,
             &conductor->system_counters,
+            aeron_driver_conductor_least_loaded_receiver_proxy(conductor),
             conductor->context) < 0)
         {
             aeron_receive_destination_delete(destination, &conductor->counters_manager);
@@ -1526,8 +2169,28 @@ void aeron_driver_conductor_client_transmit(
     aeron_broadcast_transmitter_transmit(&conductor->to_clients, msg_type_id, msg, length);
 }
 
+void aeron_driver_conductor_client_transmit_directed(
+    aeron_driver_conductor_t *conductor, int64_t client_id, int32_t msg_type_id, const void *msg, size_t length)
+{
+    aeron_broadcast_transmitter_t *transmitter = &conductor->to_clients;
+
+    if (conductor->context->client_directed_responses_enabled)
+    {
+        int index = aeron_driver_conductor_find_client(conductor, client_id);
+
+        if (index >= 0 && conductor->clients.array[index].has_directed_responses)
+        {
+            transmitter = &conductor->clients.array[index].directed_responses;
+        }
+    }
+
+    conductor->context->to_client_interceptor_func(conductor, msg_type_id, msg, length);
+    aeron_broadcast_transmitter_transmit(transmitter, msg_type_id, msg, length);
+}
+
 void aeron_driver_conductor_on_error(
     aeron_driver_conductor_t *conductor,
+    int64_t client_id,
     int32_t error_code,
     const char *message,
     size_t length,
@@ -1541,12 +2204,13 @@ void aeron_driver_conductor_on_error(
     response->error_message_length = (int32_t)length;
     memcpy(response_buffer + sizeof(aeron_error_response_t), message, length);
 
-    aeron_driver_conductor_client_transmit(
-        conductor, AERON_RESPONSE_ON_ERROR, response, sizeof(aeron_error_response_t) + length);
+    aeron_driver_conductor_client_transmit_directed(
+        conductor, client_id, AERON_RESPONSE_ON_ERROR, response, sizeof(aeron_error_response_t) + length);
 }
 
 void aeron_driver_conductor_on_publication_ready(
     aeron_driver_conductor_t *conductor,
+    int64_t client_id,
     int64_t registration_id,
     int64_t original_registration_id,
     int32_t stream_id,
@@ -1569,15 +2233,19 @@ void aeron_driver_conductor_on_publication_ready(
     response->log_file_length = (int32_t)log_file_name_length;
     memcpy(response_buffer + sizeof(aeron_publication_buffers_ready_t), log_file_name, log_file_name_length);
 
-    aeron_driver_conductor_client_transmit(
+    aeron_driver_conductor_client_transmit_directed(
         conductor,
+        client_id,
         is_exclusive ? AERON_RESPONSE_ON_EXCLUSIVE_PUBLICATION_READY : AERON_RESPONSE_ON_PUBLICATION_READY,
         response,
         sizeof(aeron_publication_buffers_ready_t) + log_file_name_length);
 }
 
 void aeron_driver_conductor_on_subscription_ready(
-    aeron_driver_conductor_t *conductor, int64_t registration_id, int32_t channel_status_indicator_id)
+    aeron_driver_conductor_t *conductor,
+    int64_t client_id,
+    int64_t registration_id,
+    int32_t channel_status_indicator_id)
 {
     char response_buffer[sizeof(aeron_correlated_command_t)];
     aeron_subscription_ready_t *response = (aeron_subscription_ready_t *)response_buffer;
@@ -1585,8 +2253,8 @@ void aeron_driver_conductor_on_subscription_ready(
     response->correlation_id = registration_id;
     response->channel_status_indicator_id = channel_status_indicator_id;
 
-    aeron_driver_conductor_client_transmit(
-        conductor, AERON_RESPONSE_ON_SUBSCRIPTION_READY, response, sizeof(aeron_subscription_ready_t));
+    aeron_driver_conductor_client_transmit_directed(
+        conductor, client_id, AERON_RESPONSE_ON_SUBSCRIPTION_READY, response, sizeof(aeron_subscription_ready_t));
 }
 
 void aeron_driver_conductor_on_counter_ready(
@@ -1615,15 +2283,16 @@ void aeron_driver_conductor_on_unavailable_counter(
         conductor, AERON_RESPONSE_ON_UNAVAILABLE_COUNTER, response, sizeof(aeron_counter_update_t));
 }
 
-void aeron_driver_conductor_on_operation_succeeded(aeron_driver_conductor_t *conductor, int64_t correlation_id)
+void aeron_driver_conductor_on_operation_succeeded(
+    aeron_driver_conductor_t *conductor, int64_t client_id, int64_t correlation_id)
 {
     char response_buffer[sizeof(aeron_correlated_command_t)];
     aeron_operation_succeeded_t *response = (aeron_operation_succeeded_t *)response_buffer;
 
     response->correlation_id = correlation_id;
 
-    aeron_driver_conductor_client_transmit(
-        conductor, AERON_RESPONSE_ON_OPERATION_SUCCESS, response, sizeof(aeron_operation_succeeded_t));
+    aeron_driver_conductor_client_transmit_directed(
+        conductor, client_id, AERON_RESPONSE_ON_OPERATION_SUCCESS, response, sizeof(aeron_operation_succeeded_t));
 }
 
 void aeron_driver_conductor_on_client_timeout(aeron_driver_conductor_t *conductor, int64_t client_id)
@@ -1639,6 +2308,7 @@ void aeron_driver_conductor_on_client_timeout(aeron_driver_conductor_t *conducto
 
 void aeron_driver_conductor_on_unavailable_image(
     aeron_driver_conductor_t *conductor,
+    int64_t client_id,
     int64_t correlation_id,
     int64_t subscription_registration_id,
     int32_t stream_id,
@@ -1654,8 +2324,12 @@ void aeron_driver_conductor_on_unavailable_image(
     response->channel_length = (int32_t)channel_length;
     memcpy(response_buffer + sizeof(aeron_image_message_t), channel, channel_length);
 
-    aeron_driver_conductor_client_transmit(
-        conductor, AERON_RESPONSE_ON_UNAVAILABLE_IMAGE, response, sizeof(aeron_image_message_t) + channel_length);
+    aeron_driver_conductor_client_transmit_directed(
+        conductor,
+        client_id,
+        AERON_RESPONSE_ON_UNAVAILABLE_IMAGE,
+        response,
+        sizeof(aeron_image_message_t) + channel_length);
 }
 
 void aeron_driver_conductor_error(
@@ -1666,12 +2340,86 @@ void aeron_driver_conductor_error(
     aeron_set_err(0, "%s", "no error");
 }
 
+static void aeron_driver_conductor_clear_channel_cache(aeron_driver_conductor_t *conductor)
+{
+    for (size_t i = 0, length = conductor->channel_cache.length; i < length; i++)
+    {
+        aeron_udp_channel_delete(conductor->channel_cache.array[i].channel);
+        conductor->channel_cache.array[i].channel = NULL;
+    }
+
+    conductor->channel_cache.length = 0;
+}
+
+static void aeron_driver_conductor_channel_cache_push_front(
+    aeron_driver_conductor_t *conductor, aeron_udp_channel_t *channel, int64_t time_of_parse_ns, size_t length)
+{
+    aeron_driver_conductor_channel_cache_entry_t *array = conductor->channel_cache.array;
+
+    memmove(&array[1], &array[0], length * sizeof(aeron_driver_conductor_channel_cache_entry_t));
+    array[0].channel = channel;
+    array[0].time_of_parse_ns = time_of_parse_ns;
+}
+
+/*
+ * Parse a UDP channel, sharing the channel parsed for an identical URI by an earlier command so that repeated
+ * commands for the same channel only parse, resolve names and interfaces, and canonicalise once. Entries are kept in
+ * LRU order and expire after the re-resolution check interval so a changed name resolution is picked up.
+ */
+static int aeron_driver_conductor_parse_udp_channel(
+    aeron_driver_conductor_t *conductor, size_t uri_length, const char *uri, aeron_udp_channel_t **channel)
+{
+    const int64_t now_ns = aeron_clock_cached_nano_time(conductor->context->cached_clock);
+    aeron_driver_conductor_channel_cache_entry_t *array = conductor->channel_cache.array;
+
+    for (size_t i = 0, length = conductor->channel_cache.length; i < length; i++)
+    {
+        aeron_udp_channel_t *cached = array[i].channel;
+        if (cached->uri_length == uri_length && 0 == memcmp(cached->original_uri, uri, uri_length))
+        {
+            if (now_ns - array[i].time_of_parse_ns > (int64_t)conductor->context->re_resolution_check_interval_ns)
+            {
+                aeron_udp_channel_delete(cached);
+                memmove(&array[i], &array[i + 1], (length - i - 1) * sizeof(aeron_driver_conductor_channel_cache_entry_t));
+                conductor->channel_cache.length--;
+                break;
+            }
+
+            aeron_driver_conductor_channel_cache_push_front(conductor, cached, array[i].time_of_parse_ns, i);
+            *channel = aeron_udp_channel_incref(cached);
+
+            return 0;
+        }
+    }
+
+    if (aeron_udp_channel_parse(uri_length, uri, &conductor->name_resolver, channel) < 0)
+    {
+        return -1;
+    }
+
+    if (uri_length == (*channel)->uri_length && !(*channel)->has_generated_canonical_suffix)
+    {
+        if (AERON_DRIVER_CONDUCTOR_CHANNEL_CACHE_CAPACITY == conductor->channel_cache.length)
+        {
+            aeron_udp_channel_delete(array[--conductor->channel_cache.length].channel);
+        }
+
+        aeron_driver_conductor_channel_cache_push_front(
+            conductor, aeron_udp_channel_incref(*channel), now_ns, conductor->channel_cache.length++);
+    }
+
+    return 0;
+}
+
 void aeron_driver_conductor_on_command(int32_t msg_type_id, const void *message, size_t length, void *clientd)
 {
     aeron_driver_conductor_t *conductor = (aeron_driver_conductor_t *)clientd;
     int64_t correlation_id = 0;
+    int64_t client_id = -1;
     int result = 0;
 
+    AERON_DRIVER_TRACEPOINT2(conductor_command_start, msg_type_id, length);
+
     conductor->context->to_driver_interceptor_func(msg_type_id, message, length, clientd);
 
     char error_message[AERON_MAX_PATH] = "\0";
@@ -1689,6 +2437,7 @@ void aeron_driver_conductor_on_command(int32_t msg_type_id, const void *message,
             }
 
             correlation_id = command->correlated.correlation_id;
+            client_id = command->correlated.client_id;
             const char *channel = (const char *)message + sizeof(aeron_publication_command_t);
 
             if (strncmp(channel, AERON_IPC_CHANNEL, AERON_IPC_CHANNEL_LEN) == 0)
@@ -1713,6 +2462,7 @@ void aeron_driver_conductor_on_command(int32_t msg_type_id, const void *message,
             }
 
             correlation_id = command->correlated.correlation_id;
+            client_id = command->correlated.client_id;
             const char *channel = (const char *)message + sizeof(aeron_publication_command_t);
 
             if (strncmp(channel, AERON_IPC_CHANNEL, AERON_IPC_CHANNEL_LEN) == 0)
@@ -1736,6 +2486,7 @@ void aeron_driver_conductor_on_command(int32_t msg_type_id, const void *message,
             }
 
             correlation_id = command->correlated.correlation_id;
+            client_id = command->correlated.client_id;
 
             result = aeron_driver_conductor_on_remove_publication(conductor, command);
             break;
@@ -1752,6 +2503,7 @@ void aeron_driver_conductor_on_command(int32_t msg_type_id, const void *message,
             }
 
             correlation_id = command->correlated.correlation_id;
+            client_id = command->correlated.client_id;
             const char *channel = (const char *)message + sizeof(aeron_subscription_command_t);
 
             if (strncmp(channel, AERON_IPC_CHANNEL, AERON_IPC_CHANNEL_LEN) == 0)
@@ -1779,6 +2531,7 @@ void aeron_driver_conductor_on_command(int32_t msg_type_id, const void *message,
             }
 
             correlation_id = command->correlated.correlation_id;
+            client_id = command->correlated.client_id;
 
             result = aeron_driver_conductor_on_remove_subscription(conductor, command);
             break;
@@ -1808,6 +2561,7 @@ void aeron_driver_conductor_on_command(int32_t msg_type_id, const void *message,
             }
 
             correlation_id = command->correlated.correlation_id;
+            client_id = command->correlated.client_id;
 
             result = aeron_driver_conductor_on_add_destination(conductor, command);
             break;
@@ -1824,6 +2578,7 @@ void aeron_driver_conductor_on_command(int32_t msg_type_id, const void *message,
             }
 
             correlation_id = command->correlated.correlation_id;
+            client_id = command->correlated.client_id;
 
             result = aeron_driver_conductor_on_remove_destination(conductor, command);
             break;
@@ -1840,6 +2595,7 @@ void aeron_driver_conductor_on_command(int32_t msg_type_id, const void *message,
             }
 
             correlation_id = command->correlated.correlation_id;
+            client_id = command->correlated.client_id;
 
             result = aeron_driver_conductor_on_add_receive_destination(conductor, command);
             break;
@@ -1856,6 +2612,7 @@ void aeron_driver_conductor_on_command(int32_t msg_type_id, const void *message,
             }
 
             correlation_id = command->correlated.correlation_id;
+            client_id = command->correlated.client_id;
 
             result = aeron_driver_conductor_on_remove_receive_destination(conductor, command);
             break;
@@ -1871,6 +2628,7 @@ void aeron_driver_conductor_on_command(int32_t msg_type_id, const void *message,
             }
 
             correlation_id = command->correlated.correlation_id;
+            client_id = command->correlated.client_id;
 
             result = aeron_driver_conductor_on_add_counter(conductor, command);
             break;
@@ -1886,11 +2644,44 @@ void aeron_driver_conductor_on_command(int32_t msg_type_id, const void *message,
             }
 
             correlation_id = command->correlated.correlation_id;
+            client_id = command->correlated.client_id;
 
             result = aeron_driver_conductor_on_remove_counter(conductor, command);
             break;
         }
 
+        case AERON_COMMAND_ADD_COUNTER_LEASE:
+        {
+            aeron_counter_lease_command_t *command = (aeron_counter_lease_command_t *)message;
+
+            if (length < sizeof(aeron_counter_lease_command_t))
+            {
+                goto malformed_command;
+            }
+
+            correlation_id = command->correlated.correlation_id;
+            client_id = command->correlated.client_id;
+
+            result = aeron_driver_conductor_on_add_counter_lease(conductor, command);
+            break;
+        }
+
+        case AERON_COMMAND_COUNTER_LEASE_UPDATE:
+        {
+            aeron_counter_lease_update_t *command = (aeron_counter_lease_update_t *)message;
+
+            if (length < sizeof(aeron_counter_lease_update_t))
+            {
+                goto malformed_command;
+            }
+
+            correlation_id = command->correlated.correlation_id;
+            client_id = command->correlated.client_id;
+
+            result = aeron_driver_conductor_on_counter_lease_update(conductor, command);
+            break;
+        }
+
         case AERON_COMMAND_CLIENT_CLOSE:
         {
             aeron_correlated_command_t *command = (aeron_correlated_command_t *)message;
@@ -1904,6 +2695,22 @@ void aeron_driver_conductor_on_command(int32_t msg_type_id, const void *message,
             break;
         }
 
+        case AERON_COMMAND_ADD_DIRECTED_RESPONSES:
+        {
+            aeron_correlated_command_t *command = (aeron_correlated_command_t *)message;
+
+            if (length < sizeof(aeron_correlated_command_t))
+            {
+                goto malformed_command;
+            }
+
+            correlation_id = command->correlation_id;
+            client_id = command->client_id;
+
+            result = aeron_driver_conductor_on_add_directed_responses(conductor, command);
+            break;
+        }
+
         case AERON_COMMAND_TERMINATE_DRIVER:
         {
             aeron_terminate_driver_command_t *command = (aeron_terminate_driver_command_t *)message;
@@ -1932,15 +2739,18 @@ void aeron_driver_conductor_on_command(int32_t msg_type_id, const void *message,
         const char *error_description = os_errno > 0 ? strerror(os_errno) : aeron_error_code_str(code);
 
         AERON_FORMAT_BUFFER(error_message, "(%d) %s: %s", os_errno, error_description, aeron_errmsg());
-        aeron_driver_conductor_on_error(conductor, code, error_message, strlen(error_message), correlation_id);
+        aeron_driver_conductor_on_error(
+            conductor, client_id, code, error_message, strlen(error_message), correlation_id);
         aeron_driver_conductor_error(conductor, code, error_description, error_message);
     }
 
+    AERON_DRIVER_TRACEPOINT1(conductor_command_end, msg_type_id);
     return;
 
 malformed_command:
     AERON_FORMAT_BUFFER(error_message, "command=%d too short: length=%" PRIu32, msg_type_id, (uint32_t)length);
     aeron_driver_conductor_error(conductor, AERON_ERROR_CODE_MALFORMED_COMMAND, "command too short", error_message);
+    AERON_DRIVER_TRACEPOINT1(conductor_command_end, msg_type_id);
 }
 
 void aeron_driver_conductor_on_command_queue(void *clientd, volatile void *item)
@@ -1972,6 +2782,162 @@ void aeron_driver_conductor_on_check_for_blocked_driver_commands(aeron_driver_co
     }
 }
 
+static bool aeron_driver_conductor_park_destination(
+    aeron_driver_conductor_t *conductor,
+    aeron_uri_t *send_uri,
+    aeron_receive_destination_t *receive_destination,
+    aeron_udp_channel_t *receive_channel)
+{
+    if (0 == conductor->async_name_resolutions_in_flight)
+    {
+        return false;
+    }
+
+    int ensure_capacity_result = 0;
+    AERON_ARRAY_ENSURE_CAPACITY(
+        ensure_capacity_result, conductor->parked_destinations, aeron_driver_conductor_parked_destination_t);
+
+    if (ensure_capacity_result < 0)
+    {
+        return false;
+    }
+
+    aeron_driver_conductor_parked_destination_t *parked =
+        &conductor->parked_destinations.array[conductor->parked_destinations.length++];
+    parked->send_uri = send_uri;
+    parked->receive_destination = receive_destination;
+    parked->receive_channel = receive_channel;
+
+    return true;
+}
+
+static void aeron_driver_conductor_release_parked_destinations(aeron_driver_conductor_t *conductor)
+{
+    if (0 < conductor->async_name_resolutions_in_flight)
+    {
+        return;
+    }
+
+    for (size_t i = 0, length = conductor->parked_destinations.length; i < length; i++)
+    {
+        aeron_driver_conductor_parked_destination_t *parked = &conductor->parked_destinations.array[i];
+
+        if (NULL != parked->send_uri)
+        {
+            aeron_uri_close(parked->send_uri);
+            aeron_free(parked->send_uri);
+        }
+        else
+        {
+            aeron_udp_channel_delete(parked->receive_channel);
+            aeron_receive_destination_delete(parked->receive_destination, &conductor->counters_manager);
+        }
+    }
+
+    conductor->parked_destinations.length = 0;
+}
+
+static bool aeron_driver_conductor_is_resolution_target_live(
+    aeron_driver_conductor_t *conductor, aeron_async_name_resolution_t *resolution)
+{
+    for (size_t i = 0, length = conductor->parked_destinations.length; i < length; i++)
+    {
+        aeron_driver_conductor_parked_destination_t *parked = &conductor->parked_destinations.array[i];
+
+        if ((NULL != parked->send_uri && parked->send_uri->params.udp.endpoint == resolution->endpoint_name) ||
+            (NULL != parked->receive_destination && parked->receive_destination == resolution->destination))
+        {
+            return false;
+        }
+    }
+
+    if (resolution->is_control)
+    {
+        for (size_t i = 0, length = conductor->receive_channel_endpoints.length; i < length; i++)
+        {
+            aeron_receive_channel_endpoint_t *endpoint = conductor->receive_channel_endpoints.array[i].endpoint;
+
+            if (endpoint == resolution->endpoint)
+            {
+                return AERON_RECEIVE_CHANNEL_ENDPOINT_STATUS_ACTIVE == endpoint->conductor_fields.status;
+            }
+        }
+    }
+    else
+    {
+        for (size_t i = 0, length = conductor->send_channel_endpoints.length; i < length; i++)
+        {
+            aeron_send_channel_endpoint_t *endpoint = conductor->send_channel_endpoints.array[i].endpoint;
+
+            if (endpoint == resolution->endpoint)
+            {
+                return AERON_SEND_CHANNEL_ENDPOINT_STATUS_ACTIVE == endpoint->conductor_fields.status;
+            }
+        }
+    }
+
+    return false;
+}
+
+static void aeron_driver_conductor_on_async_name_resolution(void *clientd, aeron_async_name_resolution_t *resolution)
+{
+    aeron_driver_conductor_t *conductor = (aeron_driver_conductor_t *)clientd;
+
+    conductor->async_name_resolutions_in_flight--;
+
+    if (resolution->result < 0)
+    {
+        aeron_driver_conductor_error(conductor, AERON_ERROR_CODE_UNKNOWN_HOST, resolution->errmsg, "");
+        return;
+    }
+
+    if (0 == memcmp(&resolution->resolved_addr, &resolution->existing_addr, sizeof(struct sockaddr_storage)) ||
+        !aeron_driver_conductor_is_resolution_target_live(conductor, resolution))
+    {
+        return;
+    }
+
+    if (resolution->is_control)
+    {
+        aeron_receive_channel_endpoint_t *endpoint = resolution->endpoint;
+        aeron_driver_receiver_proxy_on_resolution_change(
+            endpoint->receiver_proxy,
+            resolution->endpoint_name,
+            endpoint,
+            resolution->destination,
+            &resolution->resolved_addr);
+    }
+    else
+    {
+        aeron_send_channel_endpoint_t *endpoint = resolution->endpoint;
+        aeron_driver_sender_proxy_on_resolution_change(
+            endpoint->sender_proxy, resolution->endpoint_name, endpoint, &resolution->resolved_addr);
+    }
+}
+
+static bool aeron_driver_conductor_offer_async_name_resolution(
+    aeron_driver_conductor_t *conductor, aeron_command_re_resolve_t *cmd, const char *uri_param_name, bool is_control)
+{
+    aeron_async_name_resolver_t *async_resolver = conductor->context->async_name_resolver;
+
+    if (NULL == async_resolver ||
+        aeron_async_name_resolver_offer(
+            async_resolver,
+            cmd->endpoint_name,
+            uri_param_name,
+            is_control,
+            cmd->endpoint,
+            cmd->destination,
+            &cmd->existing_addr) < 0)
+    {
+        return false;
+    }
+
+    conductor->async_name_resolutions_in_flight++;
+
+    return true;
+}
+
 void aeron_driver_conductor_update_clocks(aeron_driver_conductor_t *conductor, int64_t now_ns)
 {
     if (conductor->clock_update_deadline_ns - now_ns <= 0)
@@ -1981,6 +2947,44 @@ void aeron_driver_conductor_update_clocks(aeron_driver_conductor_t *conductor, i
     }
 }
 
+void aeron_driver_conductor_on_tuning_change(void *clientd, aeron_driver_tuning_param_t param, int64_t value)
+{
+    aeron_driver_conductor_t *conductor = (aeron_driver_conductor_t *)clientd;
+    aeron_driver_context_t *context = conductor->context;
+
+    switch (param)
+    {
+        case AERON_DRIVER_TUNING_STATUS_MESSAGE_TIMEOUT_NS:
+            context->status_message_timeout_ns = (uint64_t)value;
+            aeron_driver_sender_proxy_on_tuning_change(context->sender_proxy, param, value);
+            break;
+
+        case AERON_DRIVER_TUNING_NAK_UNICAST_DELAY_NS:
+            /* loss detection runs on the conductor, so the delay generator it reads is only written here */
+            aeron_feedback_delay_state_set_delay(&context->unicast_delay_feedback_generator, value);
+            break;
+
+        case AERON_DRIVER_TUNING_RETRANSMIT_UNICAST_LINGER_NS:
+            context->retransmit_unicast_linger_ns = (uint64_t)value;
+            break;
+
+        case AERON_DRIVER_TUNING_SEND_TO_SM_POLL_RATIO:
+            aeron_driver_sender_proxy_on_tuning_change(context->sender_proxy, param, value);
+            break;
+
+        case AERON_DRIVER_TUNING_UNTETHERED_WINDOW_LIMIT_TIMEOUT_NS:
+            context->untethered_window_limit_timeout_ns = (uint64_t)value;
+            break;
+
+        case AERON_DRIVER_TUNING_UNTETHERED_RESTING_TIMEOUT_NS:
+            context->untethered_resting_timeout_ns = (uint64_t)value;
+            break;
+
+        default:
+            break;
+    }
+}
+
 int aeron_driver_conductor_do_work(void *clientd)
 {
     aeron_driver_conductor_t *conductor = (aeron_driver_conductor_t *)clientd;
@@ -1990,34 +2994,71 @@ int aeron_driver_conductor_do_work(void *clientd)
     const int64_t now_ms = aeron_clock_cached_epoch_time(conductor->context->cached_clock);
 
     work_count += (int)aeron_mpsc_rb_read(
-        &conductor->to_driver_commands, aeron_driver_conductor_on_command, conductor, 10);
+        &conductor->to_driver_commands,
+        aeron_driver_conductor_on_command,
+        conductor,
+        AERON_DRIVER_CONDUCTOR_COMMAND_BATCH_LIMIT);
     work_count += (int)aeron_mpsc_concurrent_array_queue_drain(
         conductor->conductor_proxy.command_queue, aeron_driver_conductor_on_command_queue, conductor, 10);
     work_count += conductor->name_resolver.do_work_func(&conductor->name_resolver, now_ms);
+    work_count += aeron_fd_transfer_server_poll(&conductor->log_fd_server);
+
+    if (0 < conductor->async_name_resolutions_in_flight)
+    {
+        work_count += aeron_async_name_resolver_poll(
+            conductor->context->async_name_resolver,
+            aeron_driver_conductor_on_async_name_resolution,
+            conductor,
+            AERON_DRIVER_CONDUCTOR_COMMAND_BATCH_LIMIT);
+        aeron_driver_conductor_release_parked_destinations(conductor);
+    }
 
     if (now_ns >= (conductor->time_of_last_timeout_check_ns + (int64_t)conductor->context->timer_interval_ns))
     {
         aeron_mpsc_rb_consumer_heartbeat_time(&conductor->to_driver_commands, now_ms);
         aeron_driver_conductor_on_check_managed_resources(conductor, now_ns, now_ms);
         aeron_driver_conductor_on_check_for_blocked_driver_commands(conductor, now_ns);
+        aeron_driver_tuning_poll(&conductor->tuning, aeron_driver_conductor_on_tuning_change, conductor);
         conductor->time_of_last_timeout_check_ns = now_ns;
         work_count++;
     }
 
     for (size_t i = 0, length = conductor->ipc_publications.length; i < length; i++)
     {
-        work_count += aeron_ipc_publication_update_pub_lmt(conductor->ipc_publications.array[i].publication);
+        aeron_ipc_publication_t *publication = conductor->ipc_publications.array[i].publication;
+
+        work_count += aeron_ipc_publication_update_pub_lmt(publication);
+        aeron_driver_subscribable_mark_ready(
+            &publication->conductor_fields.subscribable,
+            publication->session_id,
+            aeron_ipc_publication_producer_position(publication));
     }
 
     for (size_t i = 0, length = conductor->network_publications.length; i < length; i++)
     {
-        work_count += aeron_network_publication_update_pub_lmt(conductor->network_publications.array[i].publication);
+        aeron_network_publication_t *publication = conductor->network_publications.array[i].publication;
+
+        work_count += aeron_network_publication_update_pub_lmt(publication);
+        aeron_driver_subscribable_mark_ready(
+            &publication->conductor_fields.subscribable,
+            publication->session_id,
+            aeron_network_publication_producer_position(publication));
     }
 
     for (size_t i = 0, length = conductor->publication_images.length; i < length; i++)
     {
-        aeron_publication_image_track_rebuild(
-            conductor->publication_images.array[i].image, now_ns, conductor->context->status_message_timeout_ns);
+        aeron_publication_image_t *image = conductor->publication_images.array[i].image;
+
+        aeron_publication_image_track_rebuild(image, now_ns, conductor->context->status_message_timeout_ns);
+        aeron_driver_subscribable_mark_ready(
+            &image->conductor_fields.subscribable,
+            image->session_id,
+            aeron_counter_get_volatile(image->rcv_pos_position.value_addr));
+    }
+
+    if (NULL != conductor->context->log_buffer_pool)
+    {
+        work_count += aeron_log_buffer_pool_do_work(conductor->context->log_buffer_pool);
     }
 
     return work_count;
@@ -2028,9 +3069,11 @@ void aeron_driver_conductor_on_close(void *clientd)
     aeron_driver_conductor_t *conductor = (aeron_driver_conductor_t *)clientd;
 
     conductor->name_resolver.close_func(&conductor->name_resolver);
+    aeron_fd_transfer_server_close(&conductor->log_fd_server);
 
     for (size_t i = 0, length = conductor->clients.length; i < length; i++)
     {
+        aeron_client_close_directed_responses(conductor, &conductor->clients.array[i]);
         aeron_free(conductor->clients.array[i].publication_links.array);
         aeron_free(conductor->clients.array[i].counter_links.array);
     }
@@ -2049,6 +3092,12 @@ void aeron_driver_conductor_on_close(void *clientd)
     }
     aeron_free(conductor->network_publications.array);
 
+    for (size_t i = 0, length = conductor->term_length_recommendations.length; i < length; i++)
+    {
+        aeron_free(conductor->term_length_recommendations.array[i].channel);
+    }
+    aeron_free(conductor->term_length_recommendations.array);
+
     for (size_t i = 0, length = conductor->ipc_subscriptions.length; i < length; i++)
     {
         aeron_free(conductor->ipc_subscriptions.array[i].subscribable_list.array);
@@ -2082,18 +3131,32 @@ void aeron_driver_conductor_on_close(void *clientd)
     }
     aeron_free(conductor->receive_channel_endpoints.array);
 
+    conductor->async_name_resolutions_in_flight = 0;
+    aeron_driver_conductor_release_parked_destinations(conductor);
+    aeron_free(conductor->parked_destinations.array);
+
     for (size_t i = 0, length = conductor->publication_images.length; i < length; i++)
     {
         aeron_publication_image_close(&conductor->counters_manager, conductor->publication_images.array[i].image);
     }
     aeron_free(conductor->publication_images.array);
+    aeron_slab_allocator_close(&conductor->resource_allocator);
+
+    if (&conductor->log_buffer_pool == conductor->context->log_buffer_pool)
+    {
+        aeron_log_buffer_pool_close(&conductor->log_buffer_pool);
+        conductor->context->log_buffer_pool = NULL;
+    }
 
     aeron_system_counters_close(&conductor->system_counters);
     aeron_counters_manager_close(&conductor->counters_manager);
     aeron_distinct_error_log_close(&conductor->error_log);
 
+    aeron_driver_conductor_clear_channel_cache(conductor);
     aeron_str_to_ptr_hash_map_delete(&conductor->send_channel_endpoint_by_channel_map);
     aeron_str_to_ptr_hash_map_delete(&conductor->receive_channel_endpoint_by_channel_map);
+    aeron_int64_to_tagged_ptr_hash_map_delete(&conductor->client_index_by_id);
+    aeron_int64_to_tagged_ptr_hash_map_delete(&conductor->subscription_index_by_registration_id);
 }
 
 int aeron_driver_subscribable_add_position(
@@ -2111,13 +3174,21 @@ int aeron_driver_subscribable_add_position(
     {
         aeron_tetherable_position_t *entry = &subscribable->array[subscribable->length];
         entry->is_tether = link->is_tether;
+        entry->is_observer = link->is_observer;
+        entry->is_short_circuit = NULL != link->endpoint;
         entry->state = AERON_SUBSCRIPTION_TETHER_ACTIVE;
         entry->counter_id = counter_id;
         entry->value_addr = value_addr;
+        entry->readiness_addr = link->readiness_addr;
         entry->subscription_registration_id = link->registration_id;
+        entry->subscription_client_id = link->client_id;
         entry->time_of_last_update_ns = now_ns;
-        subscribable->add_position_hook_func(subscribable->clientd, value_addr);
+        if (!entry->is_observer)
+        {
+            subscribable->add_position_hook_func(subscribable->clientd, value_addr);
+        }
         subscribable->length++;
+        subscribable->change_number++;
         result = 0;
     }
 
@@ -2135,12 +3206,46 @@ void aeron_driver_subscribable_remove_position(aeron_subscribable_t *subscribabl
             aeron_array_fast_unordered_remove(
                 (uint8_t *)subscribable->array, sizeof(aeron_tetherable_position_t), i, last_index);
             subscribable->length--;
+            subscribable->change_number++;
 
             break;
         }
     }
 }
 
+void aeron_driver_subscribable_mark_ready(aeron_subscribable_t *subscribable, int32_t session_id, int64_t position)
+{
+    for (size_t i = 0, length = subscribable->length; i < length; i++)
+    {
+        aeron_tetherable_position_t *tetherable_position = &subscribable->array[i];
+
+        if (NULL != tetherable_position->readiness_addr &&
+            position > aeron_counter_get_volatile(tetherable_position->value_addr))
+        {
+            aeron_counter_set_bits(tetherable_position->readiness_addr, aeron_counter_readiness_bit(session_id));
+        }
+    }
+}
+
+/*
+ * A subscription which joins with history starts at the earliest term still intact in the publication log, so it can
+ * catch up on recent data from the log instead of replaying it from an archive.
+ */
+static inline int64_t aeron_driver_conductor_ipc_join_position(
+    aeron_subscription_link_t *link, aeron_ipc_publication_t *publication)
+{
+    return link->is_join_history ?
+        aeron_ipc_publication_history_position(publication) : aeron_ipc_publication_joining_position(publication);
+}
+
+static inline int64_t aeron_driver_conductor_spy_join_position(
+    aeron_subscription_link_t *link, aeron_network_publication_t *publication)
+{
+    return link->is_join_history ?
+        aeron_network_publication_history_position(publication) :
+        aeron_network_publication_consumer_position(publication);
+}
+
 int aeron_driver_conductor_link_subscribable(
     aeron_driver_conductor_t *conductor,
     aeron_subscription_link_t *link,
@@ -2187,6 +3292,7 @@ int aeron_driver_conductor_link_subscribable(
 
                 aeron_driver_conductor_on_available_image(
                     conductor,
+                    link->client_id,
                     original_registration_id,
                     stream_id,
                     session_id,
@@ -2205,6 +3311,40 @@ int aeron_driver_conductor_link_subscribable(
     return result;
 }
 
+/*
+ * Link a network subscription to a network publication on this driver and channel as a spy is linked, so it reads the
+ * publication log directly instead of an image rebuilt from the loopback datagrams.
+ */
+static int aeron_driver_conductor_link_short_circuit(
+    aeron_driver_conductor_t *conductor,
+    aeron_subscription_link_t *link,
+    aeron_network_publication_t *publication,
+    int64_t now_ns)
+{
+    if (link->stream_id != publication->stream_id ||
+        (link->has_session_id && link->session_id != publication->session_id) ||
+        AERON_NETWORK_PUBLICATION_STATE_ACTIVE != publication->conductor_fields.state ||
+        !aeron_driver_conductor_is_short_circuit_channel(conductor, link->endpoint, publication) ||
+        aeron_driver_conductor_is_subscribable_linked(link, &publication->conductor_fields.subscribable))
+    {
+        return 0;
+    }
+
+    return aeron_driver_conductor_link_subscribable(
+        conductor,
+        link,
+        &publication->conductor_fields.subscribable,
+        publication->conductor_fields.managed_resource.registration_id,
+        publication->session_id,
+        publication->stream_id,
+        aeron_driver_conductor_spy_join_position(link, publication),
+        now_ns,
+        AERON_IPC_CHANNEL_LEN,
+        AERON_IPC_CHANNEL,
+        publication->log_file_name_length,
+        publication->log_file_name);
+}
+
 void aeron_driver_conductor_unlink_subscribable(aeron_subscription_link_t *link, aeron_subscribable_t *subscribable)
 {
     for (int last_index = (int32_t)link->subscribable_list.length - 1, i = last_index; i >= 0; i--)
@@ -2234,6 +3374,123 @@ void aeron_driver_conductor_unlink_all_subscribable(
     link->subscribable_list.array = NULL;
     link->subscribable_list.length = 0;
     link->subscribable_list.capacity = 0;
+
+    if (AERON_NULL_COUNTER_ID != link->readiness_counter_id)
+    {
+        aeron_counters_manager_free(&conductor->counters_manager, link->readiness_counter_id);
+        link->readiness_counter_id = AERON_NULL_COUNTER_ID;
+        link->readiness_addr = NULL;
+    }
+}
+
+static int aeron_driver_conductor_link_readiness(
+    aeron_driver_conductor_t *conductor, aeron_subscription_link_t *link, bool is_readiness_tracked)
+{
+    link->readiness_counter_id = AERON_NULL_COUNTER_ID;
+    link->readiness_addr = NULL;
+
+    if (!is_readiness_tracked)
+    {
+        return 0;
+    }
+
+    int32_t counter_id = aeron_counter_subscription_readiness_allocate(
+        &conductor->counters_manager, link->registration_id, link->stream_id, link->channel_length, link->channel);
+
+    if (counter_id < 0)
+    {
+        return -1;
+    }
+
+    link->readiness_counter_id = counter_id;
+    link->readiness_addr = aeron_counters_manager_addr(&conductor->counters_manager, counter_id);
+
+    return 0;
+}
+
+static int aeron_driver_conductor_link_inline_receive(
+    aeron_driver_conductor_t *conductor, aeron_subscription_link_t *link, bool is_inline_receive)
+{
+    link->inline_receive_counter_id = AERON_NULL_COUNTER_ID;
+
+    if (!is_inline_receive)
+    {
+        return 0;
+    }
+
+    aeron_receive_channel_endpoint_t *endpoint = link->endpoint;
+    aeron_receive_destination_t *destination = endpoint->destinations.array[0].destination;
+    struct sockaddr_storage bind_addr;
+    socklen_t bind_addr_len = sizeof(bind_addr);
+
+    if (getsockname(destination->transport.fd, (struct sockaddr *)&bind_addr, &bind_addr_len) < 0)
+    {
+        aeron_set_err_from_last_err_code("getsockname");
+        return -1;
+    }
+
+    if (aeron_udp_channel_transport_steer_reuseport_by_stream_id(&destination->transport, link->stream_id) < 0)
+    {
+        return -1;
+    }
+
+    int32_t counter_id = aeron_counter_receiver_inline_allocate(
+        &conductor->counters_manager, link->registration_id, link->stream_id, &bind_addr);
+
+    if (counter_id < 0)
+    {
+        return -1;
+    }
+
+    link->inline_receive_counter_id = counter_id;
+    endpoint->conductor_fields.has_inline_receive_stream = true;
+    endpoint->conductor_fields.inline_receive_stream_id = link->stream_id;
+
+    return 0;
+}
+
+/*
+ * The counters belong to the link rather than the publication, so each client publication of a shared one counts only
+ * its own offers. The client resolves them by registration id when it creates the publication.
+ */
+static int aeron_driver_conductor_link_offer_counters(
+    aeron_driver_conductor_t *conductor,
+    aeron_client_t *client,
+    aeron_uri_publication_params_t *params,
+    int32_t session_id,
+    int32_t stream_id,
+    size_t uri_length,
+    const char *uri)
+{
+    aeron_publication_link_t *link = &client->publication_links.array[client->publication_links.length - 1];
+
+    for (int i = 0; i < AERON_PUBLICATION_OFFER_METRIC_COUNT; i++)
+    {
+        link->offer_counter_ids[i] = AERON_NULL_COUNTER_ID;
+    }
+
+    if (!params->is_offer_stats)
+    {
+        return 0;
+    }
+
+    for (int i = 0; i < AERON_PUBLICATION_OFFER_METRIC_COUNT; i++)
+    {
+        int32_t counter_id = aeron_counter_publication_offer_allocate(
+            &conductor->counters_manager, link->registration_id, session_id, stream_id, i, uri_length, uri);
+
+        if (counter_id < 0)
+        {
+            aeron_driver_conductor_unlink_offer_counters(conductor, link);
+            link->resource->decref(link->resource->clientd);
+            client->publication_links.length--;
+            return -1;
+        }
+
+        link->offer_counter_ids[i] = counter_id;
+    }
+
+    return 0;
 }
 
 int aeron_driver_conductor_on_add_ipc_publication(
@@ -2255,7 +3512,9 @@ int aeron_driver_conductor_on_add_ipc_publication(
 
     if ((client = aeron_driver_conductor_get_or_add_client(conductor, command->correlated.client_id)) == NULL ||
         (publication = aeron_driver_conductor_get_or_add_ipc_publication(
-            conductor, client, &params, correlation_id, command->stream_id, uri_length, uri, is_exclusive)) == NULL)
+            conductor, client, &params, correlation_id, command->stream_id, uri_length, uri, is_exclusive)) == NULL ||
+        aeron_driver_conductor_link_offer_counters(
+            conductor, client, &params, publication->session_id, publication->stream_id, uri_length, uri) < 0)
     {
         goto error_cleanup;
     }
@@ -2264,6 +3523,7 @@ int aeron_driver_conductor_on_add_ipc_publication(
 
     aeron_driver_conductor_on_publication_ready(
         conductor,
+        command->correlated.client_id,
         command->correlated.correlation_id,
         publication->conductor_fields.managed_resource.registration_id,
         publication->stream_id,
@@ -2291,7 +3551,7 @@ int aeron_driver_conductor_on_add_ipc_publication(
                 publication->conductor_fields.managed_resource.registration_id,
                 publication->session_id,
                 publication->stream_id,
-                aeron_ipc_publication_joining_position(publication),
+                aeron_driver_conductor_ipc_join_position(subscription_link, publication),
                 now_ns,
                 AERON_IPC_CHANNEL_LEN,
                 AERON_IPC_CHANNEL,
@@ -2325,13 +3585,22 @@ int aeron_driver_conductor_on_add_network_publication(
     aeron_uri_publication_params_t params;
     int64_t tag_id;
 
-    if (aeron_udp_channel_parse(uri_length, uri, &conductor->name_resolver, &udp_channel) < 0 ||
+    if (aeron_driver_conductor_parse_udp_channel(conductor, uri_length, uri, &udp_channel) < 0 ||
         aeron_uri_publication_params(&udp_channel->uri, &params, conductor, is_exclusive) < 0)
     {
         aeron_udp_channel_delete(udp_channel);
         return -1;
     }
 
+    if (params.is_inline_send &&
+        (udp_channel->is_multicast || !udp_channel->has_explicit_endpoint || udp_channel->has_explicit_control))
+    {
+        aeron_set_err(
+            EINVAL, "param: %s requires a unicast endpoint without a control address", AERON_URI_INLINE_SEND_KEY);
+        aeron_udp_channel_delete(udp_channel);
+        return -1;
+    }
+
     if ((client = aeron_driver_conductor_get_or_add_client(conductor, command->correlated.client_id)) == NULL)
     {
         aeron_udp_channel_delete(udp_channel);
@@ -2360,6 +3629,23 @@ int aeron_driver_conductor_on_add_network_publication(
         return -1;
     }
 
+    if (params.is_term_length_auto && !params.has_position)
+    {
+        aeron_term_length_recommendation_entry_t *recommendation = aeron_driver_conductor_find_term_length_recommendation(
+            conductor, endpoint_udp_channel->canonical_form, command->stream_id);
+
+        if (NULL != recommendation)
+        {
+            params.term_length = (size_t)recommendation->term_length;
+        }
+    }
+
+    if (conductor->context->socket_buffer_auto_enabled && aeron_udp_channel_transport_ensure_so_sndbuf(
+        &endpoint->transport, params.mtu_length * conductor->context->network_publication_max_messages_per_send) < 0)
+    {
+        return -1;
+    }
+
     publication = aeron_driver_conductor_get_or_add_network_publication(
         conductor,
         client,
@@ -2371,7 +3657,9 @@ int aeron_driver_conductor_on_add_network_publication(
         command->stream_id,
         is_exclusive);
 
-    if (publication == NULL)
+    if (publication == NULL ||
+        aeron_driver_conductor_link_offer_counters(
+            conductor, client, &params, publication->session_id, publication->stream_id, uri_length, uri) < 0)
     {
         return -1;
     }
@@ -2380,6 +3668,7 @@ int aeron_driver_conductor_on_add_network_publication(
 
     aeron_driver_conductor_on_publication_ready(
         conductor,
+        command->correlated.client_id,
         correlation_id,
         publication->conductor_fields.managed_resource.registration_id,
         publication->stream_id,
@@ -2399,7 +3688,7 @@ int aeron_driver_conductor_on_add_network_publication(
             subscription_link->spy_channel->tag_id == tag_id : false;
 
         if (command->stream_id == subscription_link->stream_id &&
-            (0 == strncmp(
+            (subscription_link->spy_channel == endpoint_udp_channel || 0 == strncmp(
                 subscription_link->spy_channel->canonical_form,
                 endpoint_udp_channel->canonical_form,
                 subscription_link->spy_channel->canonical_length) || is_same_channel_tag) &&
@@ -2413,7 +3702,7 @@ int aeron_driver_conductor_on_add_network_publication(
                 publication->conductor_fields.managed_resource.registration_id,
                 publication->session_id,
                 publication->stream_id,
-                aeron_network_publication_consumer_position(publication),
+                aeron_driver_conductor_spy_join_position(subscription_link, publication),
                 now_ns,
                 AERON_IPC_CHANNEL_LEN,
                 AERON_IPC_CHANNEL,
@@ -2425,6 +3714,16 @@ int aeron_driver_conductor_on_add_network_publication(
         }
     }
 
+    for (size_t i = 0; i < conductor->network_subscriptions.length; i++)
+    {
+        aeron_subscription_link_t *subscription_link = &conductor->network_subscriptions.array[i];
+
+        if (aeron_driver_conductor_link_short_circuit(conductor, subscription_link, publication, now_ns) < 0)
+        {
+            return -1;
+        }
+    }
+
     return 0;
 }
 
@@ -2442,13 +3741,15 @@ int aeron_driver_conductor_on_remove_publication(aeron_driver_conductor_t *condu
 
             if (command->registration_id == client->publication_links.array[i].registration_id)
             {
+                aeron_driver_conductor_unlink_offer_counters(conductor, &client->publication_links.array[i]);
                 resource->decref(resource->clientd);
 
                 aeron_array_fast_unordered_remove(
                     (uint8_t *)client->publication_links.array, sizeof(aeron_publication_link_t), i, last_index);
                 client->publication_links.length--;
 
-                aeron_driver_conductor_on_operation_succeeded(conductor, command->correlated.correlation_id);
+                aeron_driver_conductor_on_operation_succeeded(
+                    conductor, command->correlated.client_id, command->correlated.correlation_id);
                 return 0;
             }
         }
@@ -2502,13 +3803,29 @@ int aeron_driver_conductor_on_add_ipc_subscription(
     link->is_rejoin = true;
     link->group = AERON_INFER;
     link->is_sparse = params.is_sparse;
+    link->is_huge_pages = params.is_huge_pages;
+    link->numa_node = params.numa_node;
     link->is_tether = params.is_tether;
+    link->is_observer = false;
+    link->is_join_history = params.is_join_history;
     link->subscribable_list.length = 0;
     link->subscribable_list.capacity = 0;
     link->subscribable_list.array = NULL;
 
+    if (aeron_driver_conductor_link_readiness(conductor, link, params.is_readiness_tracked) < 0 ||
+        aeron_driver_conductor_subscription_index_add(
+            conductor, &conductor->ipc_subscriptions, link, conductor->ipc_subscriptions.length - 1) < 0)
+    {
+        aeron_driver_conductor_unlink_all_subscribable(conductor, link);
+        conductor->ipc_subscriptions.length--;
+        return -1;
+    }
+
     aeron_driver_conductor_on_subscription_ready(
-        conductor, command->correlated.correlation_id, AERON_CHANNEL_STATUS_INDICATOR_NOT_ALLOCATED);
+        conductor,
+        command->correlated.client_id,
+        command->correlated.correlation_id,
+        AERON_CHANNEL_STATUS_INDICATOR_NOT_ALLOCATED);
 
     int64_t now_ns = aeron_clock_cached_nano_time(conductor->context->cached_clock);
 
@@ -2528,7 +3845,7 @@ int aeron_driver_conductor_on_add_ipc_subscription(
                 publication->conductor_fields.managed_resource.registration_id,
                 publication->session_id,
                 publication->stream_id,
-                aeron_ipc_publication_joining_position(publication),
+                aeron_driver_conductor_ipc_join_position(link, publication),
                 now_ns,
                 AERON_IPC_CHANNEL_LEN,
                 AERON_IPC_CHANNEL,
@@ -2556,8 +3873,8 @@ int aeron_driver_conductor_on_add_spy_subscription(
     const char *uri = (const char *)command + sizeof(aeron_subscription_command_t) + strlen(AERON_SPY_PREFIX);
     aeron_uri_subscription_params_t params;
 
-    if (aeron_udp_channel_parse(
-        command->channel_length - strlen(AERON_SPY_PREFIX), uri, &conductor->name_resolver, &udp_channel) < 0 ||
+    if (aeron_driver_conductor_parse_udp_channel(
+        conductor, command->channel_length - strlen(AERON_SPY_PREFIX), uri, &udp_channel) < 0 ||
         aeron_uri_subscription_params(&udp_channel->uri, &params, conductor) < 0)
     {
         return -1;
@@ -2594,15 +3911,33 @@ int aeron_driver_conductor_on_add_spy_subscription(
     link->registration_id = command->correlated.correlation_id;
     link->is_reliable = params.is_reliable;
     link->is_sparse = params.is_sparse;
+    link->is_huge_pages = params.is_huge_pages;
+    link->numa_node = params.numa_node;
     link->is_tether = params.is_tether;
+    link->is_observer = params.is_observer;
     link->is_rejoin = params.is_rejoin;
+    link->is_join_history = params.is_join_history;
     link->group = AERON_INFER;
     link->subscribable_list.length = 0;
     link->subscribable_list.capacity = 0;
     link->subscribable_list.array = NULL;
 
+    if (aeron_driver_conductor_link_readiness(conductor, link, params.is_readiness_tracked) < 0 ||
+        aeron_driver_conductor_subscription_index_add(
+            conductor, &conductor->spy_subscriptions, link, conductor->spy_subscriptions.length - 1) < 0)
+    {
+        aeron_driver_conductor_unlink_all_subscribable(conductor, link);
+        aeron_udp_channel_delete(link->spy_channel);
+        link->spy_channel = NULL;
+        conductor->spy_subscriptions.length--;
+        return -1;
+    }
+
     aeron_driver_conductor_on_subscription_ready(
-        conductor, command->correlated.correlation_id, AERON_CHANNEL_STATUS_INDICATOR_NOT_ALLOCATED);
+        conductor,
+        command->correlated.client_id,
+        command->correlated.correlation_id,
+        AERON_CHANNEL_STATUS_INDICATOR_NOT_ALLOCATED);
 
     int64_t now_ns = aeron_clock_cached_nano_time(conductor->context->cached_clock);
 
@@ -2622,7 +3957,7 @@ int aeron_driver_conductor_on_add_spy_subscription(
                 publication->conductor_fields.managed_resource.registration_id,
                 publication->session_id,
                 publication->stream_id,
-                aeron_network_publication_consumer_position(publication),
+                aeron_driver_conductor_spy_join_position(link, publication),
                 now_ns,
                 AERON_IPC_CHANNEL_LEN,
                 AERON_IPC_CHANNEL,
@@ -2646,13 +3981,36 @@ int aeron_driver_conductor_on_add_network_subscription(
     const char *uri = (const char *)command + sizeof(aeron_subscription_command_t);
     aeron_uri_subscription_params_t params;
 
-    if (aeron_udp_channel_parse(uri_length, uri, &conductor->name_resolver, &udp_channel) < 0 ||
+    if (aeron_driver_conductor_parse_udp_channel(conductor, uri_length, uri, &udp_channel) < 0 ||
         aeron_uri_subscription_params(&udp_channel->uri, &params, conductor) < 0)
     {
         aeron_udp_channel_delete(udp_channel);
         return -1;
     }
 
+    if (params.is_join_history)
+    {
+        aeron_set_err(
+            -AERON_ERROR_CODE_INVALID_CHANNEL,
+            "param: %s is only supported on IPC subscriptions and spies",
+            AERON_URI_JOIN_HISTORY_KEY);
+        aeron_udp_channel_delete(udp_channel);
+        return -1;
+    }
+
+    if (params.is_inline_receive &&
+        (udp_channel->is_multicast || !udp_channel->has_explicit_endpoint || udp_channel->has_explicit_control ||
+        udp_channel->is_checksum_enabled ||
+        NULL != aeron_uri_find_param_value(&udp_channel->uri.params.udp.additional_params, AERON_URI_FANOUT_KEY)))
+    {
+        aeron_set_err(
+            EINVAL,
+            "param: %s requires a unicast endpoint without a control address, checksums or fan-out",
+            AERON_URI_INLINE_RECEIVE_KEY);
+        aeron_udp_channel_delete(udp_channel);
+        return -1;
+    }
+
     if (aeron_driver_conductor_get_or_add_client(conductor, command->correlated.client_id) == NULL)
     {
         aeron_udp_channel_delete(udp_channel);
@@ -2672,7 +4030,8 @@ int aeron_driver_conductor_on_add_network_subscription(
     }
     udp_channel = NULL;
 
-    if (aeron_driver_conductor_has_clashing_subscription(conductor, endpoint, command->stream_id, &params))
+    if (aeron_driver_conductor_has_clashing_subscription(conductor, endpoint, command->stream_id, &params) ||
+        aeron_driver_conductor_has_clashing_inline_receive(conductor, endpoint, command->stream_id, &params))
     {
         return -1;
     }
@@ -2719,15 +4078,33 @@ int aeron_driver_conductor_on_add_network_subscription(
         link->registration_id = command->correlated.correlation_id;
         link->is_reliable = params.is_reliable;
         link->is_sparse = params.is_sparse;
+        link->is_huge_pages = params.is_huge_pages;
+        link->numa_node = params.numa_node;
         link->is_tether = params.is_tether;
+        link->is_observer = false;
         link->is_rejoin = params.is_rejoin;
+        link->is_join_history = params.is_join_history;
         link->group = params.group;
         link->subscribable_list.length = 0;
         link->subscribable_list.capacity = 0;
         link->subscribable_list.array = NULL;
+        link->inline_receive_counter_id = AERON_NULL_COUNTER_ID;
+
+        if (aeron_driver_conductor_link_readiness(conductor, link, params.is_readiness_tracked) < 0 ||
+            aeron_driver_conductor_link_inline_receive(conductor, link, params.is_inline_receive) < 0 ||
+            aeron_driver_conductor_subscription_index_add(
+                conductor, &conductor->network_subscriptions, link, conductor->network_subscriptions.length - 1) < 0)
+        {
+            aeron_driver_conductor_unlink_from_endpoint(conductor, link);
+            conductor->network_subscriptions.length--;
+            return -1;
+        }
 
         aeron_driver_conductor_on_subscription_ready(
-            conductor, command->correlated.correlation_id, endpoint->channel_status.counter_id);
+            conductor,
+            command->correlated.client_id,
+            command->correlated.correlation_id,
+            endpoint->channel_status.counter_id);
 
         int64_t now_ns = aeron_clock_cached_nano_time(conductor->context->cached_clock);
 
@@ -2738,6 +4115,11 @@ int aeron_driver_conductor_on_add_network_subscription(
             if (endpoint == image->endpoint && command->stream_id == image->stream_id &&
                 aeron_publication_image_is_accepting_subscriptions(image))
             {
+                if (params.is_inline_receive)
+                {
+                    aeron_publication_image_enable_inline_receive(image);
+                }
+
                 char source_identity[AERON_MAX_PATH];
                 size_t source_identity_length = aeron_format_source_identity(
                     source_identity, sizeof(source_identity), &image->source_address);
@@ -2761,6 +4143,16 @@ int aeron_driver_conductor_on_add_network_subscription(
             }
         }
 
+        for (size_t i = 0, length = conductor->network_publications.length; i < length; i++)
+        {
+            aeron_network_publication_t *publication = conductor->network_publications.array[i].publication;
+
+            if (aeron_driver_conductor_link_short_circuit(conductor, link, publication, now_ns) < 0)
+            {
+                return -1;
+            }
+        }
+
         return 0;
     }
 
@@ -2770,57 +4162,59 @@ int aeron_driver_conductor_on_add_network_subscription(
 int aeron_driver_conductor_on_remove_subscription(
     aeron_driver_conductor_t *conductor, aeron_remove_command_t *command)
 {
-    for (size_t i = 0, size = conductor->ipc_subscriptions.length, last_index = size - 1; i < size; i++)
+    uint32_t tag;
+    void *list;
+
+    if (aeron_int64_to_tagged_ptr_hash_map_get(
+        &conductor->subscription_index_by_registration_id, command->registration_id, &tag, &list))
     {
-        aeron_subscription_link_t *link = &conductor->ipc_subscriptions.array[i];
+        size_t i = tag;
 
-        if (command->registration_id == link->registration_id)
+        if (&conductor->ipc_subscriptions == list)
         {
+            size_t last_index = conductor->ipc_subscriptions.length - 1;
+            aeron_subscription_link_t *link = &conductor->ipc_subscriptions.array[i];
+
             aeron_driver_conductor_unlink_all_subscribable(conductor, link);
 
+            aeron_driver_conductor_subscription_index_remove(
+                conductor, list, conductor->ipc_subscriptions.array, i, last_index);
             aeron_array_fast_unordered_remove(
                 (uint8_t *)conductor->ipc_subscriptions.array, sizeof(aeron_subscription_link_t), i, last_index);
             conductor->ipc_subscriptions.length--;
-
-            aeron_driver_conductor_on_operation_succeeded(conductor, command->correlated.correlation_id);
-            return 0;
         }
-    }
-
-    for (size_t i = 0, size = conductor->network_subscriptions.length, last_index = size - 1; i < size; i++)
-    {
-        aeron_subscription_link_t *link = &conductor->network_subscriptions.array[i];
-
-        if (command->registration_id == link->registration_id)
+        else if (&conductor->network_subscriptions == list)
         {
+            size_t last_index = conductor->network_subscriptions.length - 1;
+            aeron_subscription_link_t *link = &conductor->network_subscriptions.array[i];
+
             aeron_driver_conductor_unlink_from_endpoint(conductor, link);
 
+            aeron_driver_conductor_subscription_index_remove(
+                conductor, list, conductor->network_subscriptions.array, i, last_index);
             aeron_array_fast_unordered_remove(
                 (uint8_t *)conductor->network_subscriptions.array, sizeof(aeron_subscription_link_t), i, last_index);
             conductor->network_subscriptions.length--;
-
-            aeron_driver_conductor_on_operation_succeeded(conductor, command->correlated.correlation_id);
-            return 0;
         }
-    }
-
-    for (size_t i = 0, size = conductor->spy_subscriptions.length, last_index = size - 1; i < size; i++)
-    {
-        aeron_subscription_link_t *link = &conductor->spy_subscriptions.array[i];
-
-        if (command->registration_id == link->registration_id)
+        else
         {
+            size_t last_index = conductor->spy_subscriptions.length - 1;
+            aeron_subscription_link_t *link = &conductor->spy_subscriptions.array[i];
+
             aeron_driver_conductor_unlink_all_subscribable(conductor, link);
 
             aeron_udp_channel_delete(link->spy_channel);
             link->spy_channel = NULL;
+            aeron_driver_conductor_subscription_index_remove(
+                conductor, list, conductor->spy_subscriptions.array, i, last_index);
             aeron_array_fast_unordered_remove(
                 (uint8_t *)conductor->spy_subscriptions.array, sizeof(aeron_subscription_link_t), i, last_index);
             conductor->spy_subscriptions.length--;
-
-            aeron_driver_conductor_on_operation_succeeded(conductor, command->correlated.correlation_id);
-            return 0;
         }
+
+        aeron_driver_conductor_on_operation_succeeded(
+            conductor, command->correlated.client_id, command->correlated.correlation_id);
+        return 0;
     }
 
     aeron_set_err(
@@ -2832,6 +4226,10 @@ int aeron_driver_conductor_on_remove_subscription(
     return -1;
 }
 
+/*
+ * Current clients heartbeat by writing their client-heartbeat counter directly, which the timer sweep reads, so this
+ * command only arrives from clients which predate the counter.
+ */
 int aeron_driver_conductor_on_client_keepalive(aeron_driver_conductor_t *conductor, int64_t client_id)
 {
     int index;
@@ -2904,9 +4302,9 @@ int aeron_driver_conductor_on_add_destination(aeron_driver_conductor_t *conducto
             goto error_cleanup;
         }
 
-        aeron_driver_sender_proxy_on_add_destination(
-            conductor->context->sender_proxy, endpoint, uri, &destination_addr);
-        aeron_driver_conductor_on_operation_succeeded(conductor, command->correlated.correlation_id);
+        aeron_driver_sender_proxy_on_add_destination(endpoint->sender_proxy, endpoint, uri, &destination_addr);
+        aeron_driver_conductor_on_operation_succeeded(
+            conductor, command->correlated.client_id, command->correlated.correlation_id);
 
         return 0;
 
@@ -2978,8 +4376,9 @@ int aeron_driver_conductor_on_remove_destination(
             goto error_cleanup;
         }
 
-        aeron_driver_sender_proxy_on_remove_destination(conductor->context->sender_proxy, endpoint, &destination_addr);
-        aeron_driver_conductor_on_operation_succeeded(conductor, command->correlated.correlation_id);
+        aeron_driver_sender_proxy_on_remove_destination(endpoint->sender_proxy, endpoint, &destination_addr);
+        aeron_driver_conductor_on_operation_succeeded(
+            conductor, command->correlated.client_id, command->correlated.correlation_id);
 
         aeron_uri_close(&uri_params);
         return 0;
@@ -3058,8 +4457,9 @@ int aeron_driver_conductor_on_add_receive_destination(
         return -1;
     }
 
-    aeron_driver_receiver_proxy_on_add_destination(conductor->context->receiver_proxy, endpoint, destination);
-    aeron_driver_conductor_on_operation_succeeded(conductor, command->correlated.correlation_id);
+    aeron_driver_receiver_proxy_on_add_destination(endpoint->receiver_proxy, endpoint, destination);
+    aeron_driver_conductor_on_operation_succeeded(
+        conductor, command->correlated.client_id, command->correlated.correlation_id);
 
     return 0;
 }
@@ -3100,9 +4500,10 @@ int aeron_driver_conductor_on_remove_receive_destination(
         return -1;
     }
 
-    aeron_driver_receiver_proxy_on_remove_destination(conductor->context->receiver_proxy, endpoint, udp_channel);
+    aeron_driver_receiver_proxy_on_remove_destination(endpoint->receiver_proxy, endpoint, udp_channel);
 
-    aeron_driver_conductor_on_operation_succeeded(conductor, command->correlated.correlation_id);
+    aeron_driver_conductor_on_operation_succeeded(
+        conductor, command->correlated.client_id, command->correlated.correlation_id);
     return 0;
 }
 
@@ -3111,8 +4512,14 @@ void aeron_driver_conductor_on_delete_receive_destination(void *clientd, void *i
     aeron_driver_conductor_t *conductor = (aeron_driver_conductor_t *)clientd;
     aeron_command_delete_destination_t *command = (aeron_command_delete_destination_t *)item;
 
-    aeron_udp_channel_delete((aeron_udp_channel_t *)command->channel);
-    aeron_receive_destination_delete((aeron_receive_destination_t *)command->destination, &conductor->counters_manager);
+    aeron_udp_channel_t *channel = (aeron_udp_channel_t *)command->channel;
+    aeron_receive_destination_t *destination = (aeron_receive_destination_t *)command->destination;
+
+    if (!aeron_driver_conductor_park_destination(conductor, NULL, destination, channel))
+    {
+        aeron_udp_channel_delete(channel);
+        aeron_receive_destination_delete(destination, &conductor->counters_manager);
+    }
 
     aeron_driver_receiver_proxy_on_delete_cmd(conductor->context->receiver_proxy, (aeron_command_base_t *)command);
 }
@@ -3123,8 +4530,11 @@ void aeron_driver_conductor_on_delete_send_destination(void *clientd, void *cmd)
     aeron_command_base_t *command = (aeron_command_base_t *)cmd;
     aeron_uri_t *uri = (aeron_uri_t *)command->item;
 
-    aeron_uri_close(uri);
-    aeron_free(uri);
+    if (!aeron_driver_conductor_park_destination(conductor, uri, NULL, NULL))
+    {
+        aeron_uri_close(uri);
+        aeron_free(uri);
+    }
 
     aeron_driver_sender_proxy_on_delete_cmd(conductor->context->sender_proxy, command);
 }
@@ -3164,6 +4574,7 @@ int aeron_driver_conductor_on_add_counter(aeron_driver_conductor_t *conductor, a
 
             link->registration_id = command->correlated.correlation_id;
             link->counter_id = counter_id;
+            link->is_leased = false;
 
             aeron_driver_conductor_on_counter_ready(conductor, command->correlated.correlation_id, counter_id);
             return 0;
@@ -3173,6 +4584,23 @@ int aeron_driver_conductor_on_add_counter(aeron_driver_conductor_t *conductor, a
     return -1;
 }
 
+static void aeron_driver_conductor_on_unavailable_leased_counter(
+    aeron_driver_conductor_t *conductor, int32_t counter_id)
+{
+    aeron_counter_metadata_descriptor_t *metadata = (aeron_counter_metadata_descriptor_t *)(
+        conductor->counters_manager.metadata + AERON_COUNTER_METADATA_OFFSET(counter_id));
+    int32_t type_id;
+
+    AERON_GET_VOLATILE(type_id, metadata->type_id);
+    if (AERON_COUNTER_CLIENT_LEASE_TYPE_ID != type_id)
+    {
+        aeron_counter_value_descriptor_t *value = (aeron_counter_value_descriptor_t *)(
+            conductor->counters_manager.values + AERON_COUNTER_OFFSET(counter_id));
+
+        aeron_driver_conductor_on_unavailable_counter(conductor, value->registration_id, counter_id);
+    }
+}
+
 int aeron_driver_conductor_on_remove_counter(aeron_driver_conductor_t *conductor, aeron_remove_command_t *command)
 {
     int index;
@@ -3180,25 +4608,51 @@ int aeron_driver_conductor_on_remove_counter(aeron_driver_conductor_t *conductor
     if ((index = aeron_driver_conductor_find_client(conductor, command->correlated.client_id)) >= 0)
     {
         aeron_client_t *client = &conductor->clients.array[index];
+        bool is_found = false;
 
-        for (size_t i = 0, size = client->counter_links.length, last_index = size - 1; i < size; i++)
+        for (int last_index = (int)client->counter_links.length - 1, i = last_index; i >= 0; i--)
         {
             aeron_counter_link_t *link = &client->counter_links.array[i];
 
             if (command->registration_id == link->registration_id)
             {
-                aeron_driver_conductor_on_operation_succeeded(conductor, command->correlated.correlation_id);
-                aeron_driver_conductor_on_unavailable_counter(conductor, link->registration_id, link->counter_id);
+                const bool is_leased = link->is_leased;
+
+                if (!is_found)
+                {
+                    aeron_driver_conductor_on_operation_succeeded(
+                        conductor, command->correlated.client_id, command->correlated.correlation_id);
+                    is_found = true;
+                }
+
+                if (is_leased)
+                {
+                    aeron_driver_conductor_on_unavailable_leased_counter(conductor, link->counter_id);
+                }
+                else
+                {
+                    aeron_driver_conductor_on_unavailable_counter(
+                        conductor, link->registration_id, link->counter_id);
+                }
 
                 aeron_counters_manager_free(&conductor->counters_manager, link->counter_id);
 
                 aeron_array_fast_unordered_remove(
                     (uint8_t *)client->counter_links.array, sizeof(aeron_counter_link_t), i, last_index);
                 client->counter_links.length--;
+                last_index--;
 
-                return 0;
+                if (!is_leased)
+                {
+                    break;
+                }
             }
         }
+
+        if (is_found)
+        {
+            return 0;
+        }
     }
 
     aeron_set_err(
@@ -3210,6 +4664,138 @@ int aeron_driver_conductor_on_remove_counter(aeron_driver_conductor_t *conductor
     return -1;
 }
 
+int aeron_driver_conductor_on_add_counter_lease(
+    aeron_driver_conductor_t *conductor, aeron_counter_lease_command_t *command)
+{
+    aeron_client_t *client = NULL;
+    const int32_t counter_count = command->counter_count;
+
+    if (counter_count <= 0 || counter_count > AERON_COUNTER_CLIENT_LEASE_MAX_LENGTH)
+    {
+        aeron_set_err(
+            EINVAL,
+            "counter lease length must be between 1 and %d: %" PRId32,
+            AERON_COUNTER_CLIENT_LEASE_MAX_LENGTH,
+            counter_count);
+        return -1;
+    }
+
+    if ((client = aeron_driver_conductor_get_or_add_client(conductor, command->correlated.client_id)) == NULL)
+    {
+        return -1;
+    }
+
+    char response_buffer[
+        sizeof(aeron_counter_lease_ready_t) + (AERON_COUNTER_CLIENT_LEASE_MAX_LENGTH * sizeof(int32_t))];
+    aeron_counter_lease_ready_t *response = (aeron_counter_lease_ready_t *)response_buffer;
+    int32_t *counter_ids = (int32_t *)(response_buffer + sizeof(aeron_counter_lease_ready_t));
+    aeron_counter_client_lease_key_layout_t key =
+        {
+            .registration_id = command->correlated.correlation_id,
+            .client_id = command->correlated.client_id
+        };
+    char label[AERON_MAX_PATH];
+    int label_length = snprintf(
+        label,
+        sizeof(label),
+        "%s: client-id=%" PRId64 " lease=%" PRId64,
+        AERON_COUNTER_CLIENT_LEASE_NAME,
+        key.client_id,
+        key.registration_id);
+    int32_t allocated = 0;
+
+    for (; allocated < counter_count; allocated++)
+    {
+        int ensure_capacity_result = 0;
+        AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, client->counter_links, aeron_counter_link_t);
+        if (ensure_capacity_result < 0)
+        {
+            goto error;
+        }
+
+        const int32_t counter_id = aeron_counters_manager_allocate(
+            &conductor->counters_manager,
+            AERON_COUNTER_CLIENT_LEASE_TYPE_ID,
+            (const uint8_t *)&key,
+            sizeof(key),
+            label,
+            (size_t)label_length);
+        if (counter_id < 0)
+        {
+            goto error;
+        }
+
+        aeron_counter_link_t *link = &client->counter_links.array[client->counter_links.length++];
+        link->registration_id = key.registration_id;
+        link->counter_id = counter_id;
+        link->is_leased = true;
+        counter_ids[allocated] = counter_id;
+    }
+
+    response->correlation_id = key.registration_id;
+    response->counter_count = counter_count;
+
+    aeron_driver_conductor_client_transmit_directed(
+        conductor,
+        command->correlated.client_id,
+        AERON_RESPONSE_ON_COUNTER_LEASE_READY,
+        response,
+        sizeof(aeron_counter_lease_ready_t) + ((size_t)counter_count * sizeof(int32_t)));
+
+    return 0;
+
+error:
+    for (int32_t i = 0; i < allocated; i++)
+    {
+        aeron_counters_manager_free(&conductor->counters_manager, counter_ids[i]);
+    }
+    client->counter_links.length -= (size_t)allocated;
+
+    return -1;
+}
+
+int aeron_driver_conductor_on_counter_lease_update(
+    aeron_driver_conductor_t *conductor, aeron_counter_lease_update_t *command)
+{
+    int index;
+
+    if ((index = aeron_driver_conductor_find_client(conductor, command->correlated.client_id)) >= 0)
+    {
+        aeron_client_t *client = &conductor->clients.array[index];
+
+        for (size_t i = 0, length = client->counter_links.length; i < length; i++)
+        {
+            aeron_counter_link_t *link = &client->counter_links.array[i];
+
+            if (link->is_leased &&
+                command->correlated.correlation_id == link->registration_id &&
+                command->counter_id == link->counter_id)
+            {
+                if (command->is_allocated)
+                {
+                    aeron_driver_conductor_on_counter_ready(conductor, command->registration_id, command->counter_id);
+                }
+                else
+                {
+                    aeron_driver_conductor_on_unavailable_counter(
+                        conductor, command->registration_id, command->counter_id);
+                }
+
+                return 0;
+            }
+        }
+    }
+
+    aeron_set_err(
+        -AERON_ERROR_CODE_UNKNOWN_COUNTER,
+        "unknown leased counter client_id=%" PRId64 ", lease=%" PRId64 ", counter_id=%" PRId32,
+        command->correlated.client_id,
+        command->correlated.correlation_id,
+        command->counter_id);
+
+    return -1;
+}
+
 int aeron_driver_conductor_on_client_close(aeron_driver_conductor_t *conductor, aeron_correlated_command_t *command)
 {
     int index;
@@ -3220,8 +4806,54 @@ int aeron_driver_conductor_on_client_close(aeron_driver_conductor_t *conductor,
 
         client->closed_by_command = true;
         aeron_counter_set_ordered(client->heartbeat_timestamp.value_addr, 0);
+        conductor->clients_deadline_ms = AERON_MIN(conductor->clients_deadline_ms, client->client_liveness_timeout_ms);
+    }
+
+    return 0;
+}
+
+int aeron_driver_conductor_on_add_directed_responses(
+    aeron_driver_conductor_t *conductor, aeron_correlated_command_t *command)
+{
+    aeron_client_t *client = NULL;
+
+    if (!conductor->context->client_directed_responses_enabled)
+    {
+        aeron_set_err(EINVAL, "%s", "directed responses are not enabled on the media driver");
+        return -1;
+    }
+
+    if ((client = aeron_driver_conductor_get_or_add_client(conductor, command->client_id)) == NULL)
+    {
+        return -1;
+    }
+
+    if (!client->has_directed_responses)
+    {
+        char path[AERON_MAX_PATH];
+        aeron_client_responses_location(path, sizeof(path), conductor->context->aeron_dir, command->client_id);
+
+        client->directed_responses_map.length = conductor->context->client_directed_responses_buffer_length;
+        if (aeron_map_new_file(&client->directed_responses_map, path, true) < 0)
+        {
+            return -1;
+        }
+
+        if (aeron_broadcast_transmitter_init(
+            &client->directed_responses,
+            client->directed_responses_map.addr,
+            client->directed_responses_map.length) < 0)
+        {
+            aeron_unmap(&client->directed_responses_map);
+            remove(path);
+            return -1;
+        }
     }
 
+    /* the client only starts reading its own buffer once it has seen this response, so the first one is broadcast */
+    aeron_driver_conductor_on_operation_succeeded(conductor, command->client_id, command->correlation_id);
+    client->has_directed_responses = true;
+
     return 0;
 }
 
@@ -3253,20 +4885,41 @@ void aeron_driver_conductor_on_create_publication_image(void *clientd, void *ite
     aeron_command_create_publication_image_t *command = (aeron_command_create_publication_image_t *)item;
     aeron_receive_channel_endpoint_t *endpoint = command->endpoint;
     aeron_receive_destination_t *destination = command->destination;
+    size_t window_max_length = conductor->context->initial_window_length;
+
+    if (conductor->context->socket_buffer_auto_enabled)
+    {
+        const size_t term_window_length = (size_t)command->term_length / 2;
+
+        window_max_length = term_window_length < window_max_length ? term_window_length : window_max_length;
+        if (aeron_receive_channel_endpoint_ensure_so_rcvbuf(endpoint, window_max_length) < 0)
+        {
+            aeron_driver_conductor_error(conductor, aeron_errcode(), aeron_errmsg(), aeron_errmsg());
+            return;
+        }
+    }
 
     if (aeron_receiver_channel_endpoint_validate_sender_mtu_length(
-        endpoint, (size_t)command->mtu_length, conductor->context->initial_window_length) < 0)
+        endpoint, (size_t)command->mtu_length, window_max_length) < 0)
     {
         aeron_driver_conductor_error(conductor, aeron_errcode(), aeron_errmsg(), aeron_errmsg());
         return;
     }
 
     if (!aeron_driver_conductor_has_network_subscription_interest(
+        conductor, endpoint, command->stream_id, command->session_id) ||
+        aeron_driver_conductor_has_short_circuit_publication(
         conductor, endpoint, command->stream_id, command->session_id))
     {
         return;
     }
 
+    if (aeron_driver_conductor_reserve_log_buffer_memory(conductor, (uint64_t)command->term_length) < 0)
+    {
+        aeron_driver_conductor_error(conductor, aeron_errcode(), aeron_errmsg(), aeron_errmsg());
+        return;
+    }
+
     int ensure_capacity_result = 0;
     AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, conductor->publication_images, aeron_publication_image_entry_t);
     if (ensure_capacity_result < 0)
@@ -3318,18 +4971,86 @@ void aeron_driver_conductor_on_create_publication_image(void *clientd, void *ite
     rcv_hwm_position.value_addr = aeron_counters_manager_addr(&conductor->counters_manager, rcv_hwm_position.counter_id);
     rcv_pos_position.value_addr = aeron_counters_manager_addr(&conductor->counters_manager, rcv_pos_position.counter_id);
 
+    aeron_atomic_counter_t rcv_timestamp_counter;
+    aeron_atomic_counter_t *rcv_timestamp_counter_ptr = NULL;
+
+    if (conductor->context->socket_rx_timestamping_enabled)
+    {
+        rcv_timestamp_counter.counter_id = aeron_counter_receiver_timestamp_allocate(
+            &conductor->counters_manager, registration_id, command->session_id, command->stream_id, uri_length, uri);
+
+        if (rcv_timestamp_counter.counter_id < 0)
+        {
+            return;
+        }
+
+        rcv_timestamp_counter.value_addr = aeron_counters_manager_addr(
+            &conductor->counters_manager, rcv_timestamp_counter.counter_id);
+        rcv_timestamp_counter_ptr = &rcv_timestamp_counter;
+    }
+
+    aeron_stream_latency_histogram_t delivery_latency_histogram;
+    aeron_stream_latency_histogram_t *delivery_latency_histogram_ptr = NULL;
+
+    if (conductor->context->stream_latency_counters_enabled)
+    {
+        if (aeron_stream_latency_histogram_allocate(
+            &delivery_latency_histogram,
+            &conductor->counters_manager,
+            AERON_COUNTER_DELIVERY_LATENCY_NAME,
+            AERON_COUNTER_DELIVERY_LATENCY_TYPE_ID,
+            registration_id,
+            command->session_id,
+            command->stream_id,
+            uri_length,
+            uri) < 0)
+        {
+            return;
+        }
+
+        delivery_latency_histogram_ptr = &delivery_latency_histogram;
+    }
+
+    aeron_stream_cpu_counters_t rcv_cpu_counters;
+    aeron_stream_cpu_counters_t *rcv_cpu_counters_ptr = NULL;
+
+    if (conductor->context->stream_cpu_counters_enabled)
+    {
+        if (aeron_stream_cpu_counters_allocate_receiver(
+            &rcv_cpu_counters,
+            &conductor->counters_manager,
+            registration_id,
+            command->session_id,
+            command->stream_id,
+            uri_length,
+            uri) < 0)
+        {
+            return;
+        }
+
+        rcv_cpu_counters_ptr = &rcv_cpu_counters;
+    }
+
     bool is_reliable = conductor->network_subscriptions.array[0].is_reliable;
     aeron_inferable_boolean_t group_subscription = conductor->network_subscriptions.array[0].group;
     bool treat_as_multicast =
         AERON_INFER == group_subscription ?
         endpoint->conductor_fields.udp_channel->is_multicast : AERON_FORCE_TRUE == group_subscription;
 
+    aeron_subscription_link_t *oldest_link = aeron_driver_conductor_oldest_subscription(
+        conductor, endpoint, command->stream_id, command->session_id, registration_id);
+    bool is_sparse = NULL != oldest_link ? oldest_link->is_sparse : conductor->context->term_buffer_sparse_file;
+    bool is_huge_pages = NULL != oldest_link ?
+        oldest_link->is_huge_pages : conductor->context->term_buffer_huge_pages;
+    int32_t numa_node = NULL != oldest_link ? oldest_link->numa_node : conductor->context->term_buffer_numa_node;
+
     aeron_publication_image_t *image = NULL;
     if (aeron_publication_image_create(
         &image,
         endpoint,
         destination,
         conductor->context,
+        &conductor->resource_allocator.allocator,
         registration_id,
         command->session_id,
         command->stream_id,
@@ -3338,6 +5059,9 @@ void aeron_driver_conductor_on_create_publication_image(void *clientd, void *ite
         command->term_offset,
         &rcv_hwm_position,
         &rcv_pos_position,
+        rcv_timestamp_counter_ptr,
+        delivery_latency_histogram_ptr,
+        rcv_cpu_counters_ptr,
         congestion_control,
         &command->control_address,
         &command->src_address,
@@ -3345,8 +5069,9 @@ void aeron_driver_conductor_on_create_publication_image(void *clientd, void *ite
         command->mtu_length,
         &conductor->loss_reporter,
         is_reliable,
-        aeron_driver_conductor_is_oldest_subscription_sparse(
-            conductor, endpoint, command->stream_id, command->session_id, registration_id),
+        is_sparse,
+        is_huge_pages,
+        numa_node,
         treat_as_multicast,
         &conductor->system_counters) < 0)
     {
@@ -3356,6 +5081,12 @@ void aeron_driver_conductor_on_create_publication_image(void *clientd, void *ite
     conductor->publication_images.array[conductor->publication_images.length++].image = image;
     int64_t now_ns = aeron_clock_cached_nano_time(conductor->context->cached_clock);
 
+    if (endpoint->conductor_fields.has_inline_receive_stream &&
+        command->stream_id == endpoint->conductor_fields.inline_receive_stream_id)
+    {
+        aeron_publication_image_enable_inline_receive(image);
+    }
+
     for (size_t i = 0, length = conductor->network_subscriptions.length; i < length; i++)
     {
         char source_identity[AERON_MAX_PATH];
@@ -3387,8 +5118,8 @@ void aeron_driver_conductor_on_create_publication_image(void *clientd, void *ite
         }
     }
 
-    aeron_driver_receiver_proxy_on_add_publication_image(conductor->context->receiver_proxy, endpoint, image);
-    aeron_driver_receiver_proxy_on_delete_cmd(conductor->context->receiver_proxy, item);
+    aeron_driver_receiver_proxy_on_add_publication_image(endpoint->receiver_proxy, endpoint, image);
+    aeron_driver_receiver_proxy_on_delete_cmd(endpoint->receiver_proxy, item);
 }
 
 void aeron_driver_conductor_on_linger_buffer(void *clientd, void *item)
@@ -3407,6 +5138,8 @@ void aeron_driver_conductor_on_linger_buffer(void *clientd, void *item)
         entry->has_reached_end_of_life = false;
         entry->timeout_ns = aeron_clock_cached_nano_time(conductor->context->cached_clock) +
             AERON_DRIVER_CONDUCTOR_LINGER_RESOURCE_TIMEOUT_NS;
+        conductor->lingering_resources_deadline_ns = AERON_MIN(
+            conductor->lingering_resources_deadline_ns, entry->timeout_ns);
     }
 
     if (AERON_THREADING_MODE_IS_SHARED_OR_INVOKER(conductor->context->threading_mode))
@@ -3420,9 +5153,16 @@ void aeron_driver_conductor_on_re_resolve_endpoint(void *clientd, void *item)
 {
     aeron_driver_conductor_t *conductor = clientd;
     aeron_command_re_resolve_t *cmd = item;
+    aeron_send_channel_endpoint_t *endpoint = cmd->endpoint;
     struct sockaddr_storage resolved_addr;
     memset(&resolved_addr, 0, sizeof(resolved_addr));
 
+    if (aeron_driver_conductor_offer_async_name_resolution(conductor, cmd, AERON_UDP_CHANNEL_ENDPOINT_KEY, false))
+    {
+        aeron_driver_sender_proxy_on_delete_cmd(endpoint->sender_proxy, item);
+        return;
+    }
+
     if (aeron_name_resolver_resolve_host_and_port(
         &conductor->name_resolver, cmd->endpoint_name, AERON_UDP_CHANNEL_ENDPOINT_KEY, true, &resolved_addr) < 0)
     {
@@ -3433,19 +5173,26 @@ void aeron_driver_conductor_on_re_resolve_endpoint(void *clientd, void *item)
     if (0 != memcmp(&resolved_addr, &cmd->existing_addr, sizeof(struct sockaddr_storage)))
     {
         aeron_driver_sender_proxy_on_resolution_change(
-            conductor->context->sender_proxy, cmd->endpoint_name, cmd->endpoint, &resolved_addr);
+            endpoint->sender_proxy, cmd->endpoint_name, endpoint, &resolved_addr);
     }
 
-    aeron_driver_sender_proxy_on_delete_cmd(conductor->context->sender_proxy, item);
+    aeron_driver_sender_proxy_on_delete_cmd(endpoint->sender_proxy, item);
 }
 
 void aeron_driver_conductor_on_re_resolve_control(void *clientd, void *item)
 {
     aeron_driver_conductor_t *conductor = clientd;
     aeron_command_re_resolve_t *cmd = item;
+    aeron_receive_channel_endpoint_t *endpoint = cmd->endpoint;
     struct sockaddr_storage resolved_addr;
     memset(&resolved_addr, 0, sizeof(resolved_addr));
 
+    if (aeron_driver_conductor_offer_async_name_resolution(conductor, cmd, AERON_UDP_CHANNEL_CONTROL_KEY, true))
+    {
+        aeron_driver_receiver_proxy_on_delete_cmd(endpoint->receiver_proxy, item);
+        return;
+    }
+
     if (aeron_name_resolver_resolve_host_and_port(
         &conductor->name_resolver, cmd->endpoint_name, AERON_UDP_CHANNEL_CONTROL_KEY, true, &resolved_addr) < 0)
     {
@@ -3456,10 +5203,10 @@ void aeron_driver_conductor_on_re_resolve_control(void *clientd, void *item)
     if (0 != memcmp(&resolved_addr, &cmd->existing_addr, sizeof(struct sockaddr_storage)))
     {
         aeron_driver_receiver_proxy_on_resolution_change(
-            conductor->context->receiver_proxy, cmd->endpoint_name, cmd->endpoint, cmd->destination, &resolved_addr);
+            endpoint->receiver_proxy, cmd->endpoint_name, endpoint, cmd->destination, &resolved_addr);
     }
 
-    aeron_driver_receiver_proxy_on_delete_cmd(conductor->context->receiver_proxy, item);
+    aeron_driver_receiver_proxy_on_delete_cmd(endpoint->receiver_proxy, item);
 }
 
 void aeron_driver_conductor_on_receive_endpoint_removed(void *clientd, void *item)
@@ -3481,7 +5228,7 @@ void aeron_driver_conductor_on_receive_endpoint_removed(void *clientd, void *ite
         aeron_receive_channel_endpoint_receiver_release(endpoint);
     }
 
-    aeron_driver_receiver_proxy_on_delete_cmd(conductor->context->receiver_proxy, cmd);
+    aeron_driver_receiver_proxy_on_delete_cmd(endpoint->receiver_proxy, cmd);
 }
 
 extern void aeron_driver_subscribable_null_hook(void *clientd, int64_t *value_addr);
@@ -3516,6 +5263,8 @@ extern size_t aeron_driver_conductor_num_active_spy_subscriptions(
 
 extern size_t aeron_driver_conductor_num_images(aeron_driver_conductor_t *conductor);
 
+extern bool aeron_driver_conductor_has_pending_commands(aeron_driver_conductor_t *conductor);
+
 extern aeron_ipc_publication_t *aeron_driver_conductor_find_ipc_publication(
     aeron_driver_conductor_t *conductor, int64_t id);
 
@@ -3532,6 +5281,7 @@ extern void aeron_driver_init_subscription_channel(size_t uri_length, const char
 
 extern void aeron_driver_conductor_on_available_image(
     aeron_driver_conductor_t *conductor,
+    int64_t client_id,
     int64_t correlation_id,
     int32_t stream_id,
     int32_t session_id,
@@ -3544,6 +5294,7 @@ extern void aeron_driver_conductor_on_available_image(
 
 extern void aeron_driver_conductor_on_unavailable_image(
     aeron_driver_conductor_t *conductor,
+    int64_t client_id,
     int64_t correlation_id,
     int64_t subscription_registration_id,
     int32_t stream_id,
@@ -27,19 +27,39 @@
 #include "aeron_system_counters.h"
 #include "aeron_ipc_publication.h"
 #include "collections/aeron_str_to_ptr_hash_map.h"
+#include "collections/aeron_int64_to_tagged_ptr_hash_map.h"
 #include "media/aeron_send_channel_endpoint.h"
 #include "media/aeron_receive_channel_endpoint.h"
 #include "aeron_driver_conductor_proxy.h"
 #include "aeron_publication_image.h"
 #include "reports/aeron_loss_reporter.h"
+#include "aeron_log_buffer_pool.h"
+#include "util/aeron_fd_transfer.h"
+#include "util/aeron_slab_allocator.h"
+#include "aeron_driver_tuning.h"
 
 #define AERON_DRIVER_CONDUCTOR_LINGER_RESOURCE_TIMEOUT_NS (5 * 1000 * 1000 * 1000LL)
 #define AERON_DRIVER_CONDUCTOR_CLOCK_UPDATE_DURATION_NS (1000 * 1000LL)
+#define AERON_DRIVER_CONDUCTOR_COMMAND_BATCH_LIMIT (64)
+#define AERON_DRIVER_CONDUCTOR_CHANNEL_CACHE_CAPACITY (64)
+
+/*
+ * A send destination URI or a receive destination whose release is held back while asynchronous name resolutions
+ * that may refer to it are in flight.
+ */
+typedef struct aeron_driver_conductor_parked_destination_stct
+{
+    aeron_uri_t *send_uri;
+    aeron_receive_destination_t *receive_destination;
+    aeron_udp_channel_t *receive_channel;
+}
+aeron_driver_conductor_parked_destination_t;
 
 typedef struct aeron_publication_link_stct
 {
     aeron_driver_managed_resource_t *resource;
     int64_t registration_id;
+    int32_t offer_counter_ids[AERON_PUBLICATION_OFFER_METRIC_COUNT];
 }
 aeron_publication_link_t;
 
@@ -47,6 +67,7 @@ typedef struct aeron_counter_link_stct
 {
     int32_t counter_id;
     int64_t registration_id;
+    bool is_leased;
 }
 aeron_counter_link_t;
 
@@ -59,6 +80,10 @@ typedef struct aeron_client_stct
 
     aeron_atomic_counter_t heartbeat_timestamp;
 
+    bool has_directed_responses;
+    aeron_mapped_file_t directed_responses_map;
+    aeron_broadcast_transmitter_t directed_responses;
+
     struct publication_link_stct
     {
         size_t length;
@@ -88,9 +113,13 @@ typedef struct aeron_subscription_link_stct
 {
     char channel[AERON_MAX_PATH];
     bool is_tether;
+    bool is_observer;
     bool is_sparse;
+    bool is_huge_pages;
+    int32_t numa_node;
     bool is_reliable;
     bool is_rejoin;
+    bool is_join_history;
     bool has_session_id;
     aeron_inferable_boolean_t group;
     int32_t stream_id;
@@ -98,6 +127,9 @@ typedef struct aeron_subscription_link_stct
     int32_t channel_length;
     int64_t registration_id;
     int64_t client_id;
+    int32_t readiness_counter_id;
+    int64_t *readiness_addr;
+    int32_t inline_receive_counter_id;
 
     aeron_receive_channel_endpoint_t *endpoint;
     aeron_udp_channel_t *spy_channel;
@@ -124,6 +156,14 @@ typedef struct aeron_network_publication_entry_stct
 }
 aeron_network_publication_entry_t;
 
+typedef struct aeron_term_length_recommendation_entry_stct
+{
+    char *channel;
+    int32_t stream_id;
+    int32_t term_length;
+}
+aeron_term_length_recommendation_entry_t;
+
 typedef struct aeron_send_channel_endpoint_entry_stct
 {
     aeron_send_channel_endpoint_t *endpoint;
@@ -150,6 +190,13 @@ typedef struct aeron_linger_resource_entry_stct
 }
 aeron_linger_resource_entry_t;
 
+typedef struct aeron_driver_conductor_channel_cache_entry_stct
+{
+    aeron_udp_channel_t *channel;
+    int64_t time_of_parse_ns;
+}
+aeron_driver_conductor_channel_cache_entry_t;
+
 typedef struct aeron_driver_conductor_stct aeron_driver_conductor_t;
 
 typedef struct aeron_driver_conductor_stct
@@ -163,9 +210,15 @@ typedef struct aeron_driver_conductor_stct
     aeron_driver_conductor_proxy_t conductor_proxy;
     aeron_loss_reporter_t loss_reporter;
     aeron_name_resolver_t name_resolver;
+    aeron_log_buffer_pool_t log_buffer_pool;
+    aeron_fd_transfer_server_t log_fd_server;
+    aeron_slab_allocator_t resource_allocator;
+    aeron_driver_tuning_t tuning;
 
     aeron_str_to_ptr_hash_map_t send_channel_endpoint_by_channel_map;
     aeron_str_to_ptr_hash_map_t receive_channel_endpoint_by_channel_map;
+    aeron_int64_to_tagged_ptr_hash_map_t client_index_by_id;
+    aeron_int64_to_tagged_ptr_hash_map_t subscription_index_by_registration_id;
 
     struct client_stct
     {
@@ -224,6 +277,15 @@ typedef struct aeron_driver_conductor_stct
     }
     network_publications;
 
+    /* last recommendation of each closed network publication, applied when one with term-length=auto is re-created */
+    struct term_length_recommendations_stct
+    {
+        size_t length;
+        size_t capacity;
+        aeron_term_length_recommendation_entry_t *array;
+    }
+    term_length_recommendations;
+
     struct send_channel_endpoint_stct
     {
         aeron_send_channel_endpoint_entry_t *array;
@@ -268,11 +330,31 @@ typedef struct aeron_driver_conductor_stct
     }
     lingering_resources;
 
+    /* parsed channels by URI, most recently used first, each entry holding a reference to its channel */
+    struct aeron_driver_conductor_channel_cache_stct
+    {
+        size_t length;
+        aeron_driver_conductor_channel_cache_entry_t array[AERON_DRIVER_CONDUCTOR_CHANNEL_CACHE_CAPACITY];
+    }
+    channel_cache;
+
+    struct aeron_driver_conductor_parked_destinations_stct
+    {
+        size_t length;
+        size_t capacity;
+        aeron_driver_conductor_parked_destination_t *array;
+    }
+    parked_destinations;
+
+    size_t async_name_resolutions_in_flight;
+
     int64_t *errors_counter;
     int64_t *unblocked_commands_counter;
     int64_t *client_timeouts_counter;
 
     int64_t clock_update_deadline_ns;
+    int64_t clients_deadline_ms;
+    int64_t lingering_resources_deadline_ns;
 
     int32_t next_session_id;
     int32_t publication_reserved_session_id_low;
@@ -355,8 +437,20 @@ void aeron_driver_conductor_client_transmit(
     const void *message,
     size_t length);
 
+/*
+ * Transmit a response that concerns a single client. It goes to the client's directed response buffer when it has
+ * requested one, otherwise it is broadcast to all clients.
+ */
+void aeron_driver_conductor_client_transmit_directed(
+    aeron_driver_conductor_t *conductor,
+    int64_t client_id,
+    int32_t msg_type_id,
+    const void *message,
+    size_t length);
+
 void aeron_driver_conductor_on_available_image(
     aeron_driver_conductor_t *conductor,
+    int64_t client_id,
     int64_t correlation_id,
     int32_t stream_id,
     int32_t session_id,
@@ -369,6 +463,7 @@ void aeron_driver_conductor_on_available_image(
 
 void aeron_driver_conductor_on_unavailable_image(
     aeron_driver_conductor_t *conductor,
+    int64_t client_id,
     int64_t correlation_id,
     int64_t subscription_registration_id,
     int32_t stream_id,
@@ -391,10 +486,18 @@ void aeron_driver_conductor_cleanup_network_publication(
 
 void aeron_driver_conductor_on_command(int32_t msg_type_id, const void *message, size_t length, void *clientd);
 
+void aeron_driver_conductor_on_tuning_change(void *clientd, aeron_driver_tuning_param_t param, int64_t value);
+
 int aeron_driver_conductor_do_work(void *clientd);
 
+void aeron_driver_conductor_update_clocks(aeron_driver_conductor_t *conductor, int64_t now_ns);
+
 void aeron_driver_conductor_on_close(void *clientd);
 
+uint64_t aeron_driver_conductor_log_buffer_memory(aeron_driver_conductor_t *conductor);
+
+int aeron_driver_conductor_reserve_log_buffer_memory(aeron_driver_conductor_t *conductor, uint64_t term_length);
+
 int aeron_driver_conductor_link_subscribable(
     aeron_driver_conductor_t *conductor,
     aeron_subscription_link_t *link,
@@ -457,8 +560,17 @@ int aeron_driver_conductor_on_add_counter(aeron_driver_conductor_t *conductor, a
 
 int aeron_driver_conductor_on_remove_counter(aeron_driver_conductor_t *conductor, aeron_remove_command_t *command);
 
+int aeron_driver_conductor_on_add_counter_lease(
+    aeron_driver_conductor_t *conductor, aeron_counter_lease_command_t *command);
+
+int aeron_driver_conductor_on_counter_lease_update(
+    aeron_driver_conductor_t *conductor, aeron_counter_lease_update_t *command);
+
 int aeron_driver_conductor_on_client_close(aeron_driver_conductor_t *conductor, aeron_correlated_command_t *command);
 
+int aeron_driver_conductor_on_add_directed_responses(
+    aeron_driver_conductor_t *conductor, aeron_correlated_command_t *command);
+
 int aeron_driver_conductor_on_terminate_driver(
     aeron_driver_conductor_t *conductor, aeron_terminate_driver_command_t *command);
 
@@ -478,6 +590,10 @@ aeron_send_channel_endpoint_t *aeron_driver_conductor_find_send_channel_endpoint
 aeron_receive_channel_endpoint_t *aeron_driver_conductor_find_receive_channel_endpoint_by_tag(
     aeron_driver_conductor_t *conductor, int64_t channel_tag_id);
 
+aeron_driver_sender_proxy_t *aeron_driver_conductor_least_loaded_sender_proxy(aeron_driver_conductor_t *conductor);
+
+aeron_driver_receiver_proxy_t *aeron_driver_conductor_least_loaded_receiver_proxy(aeron_driver_conductor_t *conductor);
+
 
 inline bool aeron_driver_conductor_is_subscribable_linked(
     aeron_subscription_link_t *link, aeron_subscribable_t *subscribable)
@@ -543,6 +659,14 @@ inline size_t aeron_driver_conductor_num_images(aeron_driver_conductor_t *conduc
     return conductor->publication_images.length;
 }
 
+inline bool aeron_driver_conductor_has_pending_commands(aeron_driver_conductor_t *conductor)
+{
+    return
+        aeron_mpsc_rb_producer_position(&conductor->to_driver_commands) !=
+        aeron_mpsc_rb_consumer_position(&conductor->to_driver_commands) ||
+        aeron_mpsc_concurrent_array_queue_size(conductor->conductor_proxy.command_queue) > 0;
+}
+
 inline size_t aeron_driver_conductor_num_active_ipc_subscriptions(
     aeron_driver_conductor_t *conductor, int32_t stream_id)
 {
@@ -24,7 +24,24 @@ void aeron_driver_conductor_proxy_offer(aeron_driver_conductor_proxy_t *conducto
     while (aeron_mpsc_concurrent_array_queue_offer(conductor_proxy->command_queue, cmd) != AERON_OFFER_SUCCESS)
     {
         aeron_counter_ordered_increment(conductor_proxy->fail_counter, 1);
-        sched_yield();
+        aeron_mpsc_concurrent_array_queue_wait_for_space(conductor_proxy->command_queue, AERON_QUEUE_SPACE_WAIT_SLICE_NS);
+    }
+}
+
+void aeron_driver_conductor_proxy_offer_bulk(aeron_driver_conductor_proxy_t *conductor_proxy, aeron_command_base_t **cmds, size_t length)
+{
+    size_t offered = 0;
+
+    while (offered < length)
+    {
+        offered += (size_t)aeron_mpsc_concurrent_array_queue_offer_bulk(
+            conductor_proxy->command_queue, (void **)(cmds + offered), length - offered);
+
+        if (offered < length)
+        {
+            aeron_counter_ordered_increment(conductor_proxy->fail_counter, 1);
+            aeron_mpsc_concurrent_array_queue_wait_for_space(conductor_proxy->command_queue, AERON_QUEUE_SPACE_WAIT_SLICE_NS);
+        }
     }
 }
 
@@ -30,6 +30,13 @@ typedef struct aeron_driver_conductor_proxy_stct
 }
 aeron_driver_conductor_proxy_t;
 
+/*
+ * Offer commands built by the caller in one pass, blocking while the queue is full rather than spinning. Only for
+ * threading modes where the conductor runs on its own thread.
+ */
+void aeron_driver_conductor_proxy_offer_bulk(
+    aeron_driver_conductor_proxy_t *conductor_proxy, aeron_command_base_t **cmds, size_t length);
+
 void aeron_driver_conductor_proxy_on_delete_cmd(
     aeron_driver_conductor_proxy_t *conductor_proxy, aeron_command_base_t *cmd);
 
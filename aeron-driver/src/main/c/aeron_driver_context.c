@@ -38,6 +38,8 @@
 #include "aeron_driver.h"
 #include "aeron_alloc.h"
 #include "aeron_termination_validator.h"
+#include "aeron_loss_detector.h"
+#include "aeron_retransmit_handler.h"
 #include "agent/aeron_driver_agent.h"
 #include "util/aeron_dlopen.h"
 
@@ -205,6 +207,34 @@ aeron_threading_mode_t aeron_config_parse_threading_mode(const char *threading_m
     return result;
 }
 
+aeron_term_buffer_clean_mode_t aeron_config_parse_term_buffer_clean_mode(
+    const char *clean_mode, aeron_term_buffer_clean_mode_t def)
+{
+    aeron_term_buffer_clean_mode_t result = def;
+
+    if (NULL != clean_mode)
+    {
+        if (strncmp(clean_mode, "MEMSET", sizeof("MEMSET")) == 0)
+        {
+            result = AERON_TERM_BUFFER_CLEAN_MODE_MEMSET;
+        }
+        else if (strncmp(clean_mode, "NON_TEMPORAL", sizeof("NON_TEMPORAL")) == 0)
+        {
+            result = AERON_TERM_BUFFER_CLEAN_MODE_NON_TEMPORAL;
+        }
+        else if (strncmp(clean_mode, "PUNCH_HOLE", sizeof("PUNCH_HOLE")) == 0)
+        {
+            result = AERON_TERM_BUFFER_CLEAN_MODE_PUNCH_HOLE;
+        }
+        else
+        {
+            aeron_config_prop_warning(AERON_TERM_BUFFER_CLEAN_MODE_ENV_VAR, clean_mode);
+        }
+    }
+
+    return result;
+}
+
 aeron_inferable_boolean_t aeron_config_parse_inferable_boolean(
     const char *inferable_boolean, aeron_inferable_boolean_t def)
 {
@@ -248,39 +278,83 @@ static void aeron_driver_conductor_to_client_interceptor_null(
 #define AERON_DIR_DELETE_ON_SHUTDOWN_DEFAULT false
 #define AERON_TO_CONDUCTOR_BUFFER_LENGTH_DEFAULT (1024 * 1024 + AERON_RB_TRAILER_LENGTH)
 #define AERON_TO_CLIENTS_BUFFER_LENGTH_DEFAULT (1024 * 1024 + AERON_BROADCAST_BUFFER_TRAILER_LENGTH)
+#define AERON_CLIENT_DIRECTED_RESPONSES_BUFFER_LENGTH_DEFAULT (256 * 1024 + AERON_BROADCAST_BUFFER_TRAILER_LENGTH)
 #define AERON_COUNTERS_VALUES_BUFFER_LENGTH_DEFAULT (1024 * 1024)
+#define AERON_COUNTERS_COMPACT_CAPACITY_DEFAULT (0)
+#define AERON_COUNTERS_COMPACT_CAPACITY_MAX (4 * 1024 * 1024)
 #define AERON_ERROR_BUFFER_LENGTH_DEFAULT (1024 * 1024)
 #define AERON_CLIENT_LIVENESS_TIMEOUT_NS_DEFAULT (5 * 1000 * 1000 * 1000LL)
 #define AERON_TERM_BUFFER_LENGTH_DEFAULT (16 * 1024 * 1024)
 #define AERON_IPC_TERM_BUFFER_LENGTH_DEFAULT (64 * 1024 * 1024)
 #define AERON_TERM_BUFFER_SPARSE_FILE_DEFAULT (false)
+#define AERON_TERM_BUFFER_HUGE_PAGES_DEFAULT (false)
+#define AERON_TERM_BUFFER_NUMA_NODE_DEFAULT (AERON_NUMA_NODE_NONE)
+#define AERON_CNC_NUMA_NODE_DEFAULT (AERON_NUMA_NODE_NONE)
+#define AERON_TERM_BUFFER_PRE_FAULT_ASYNC_DEFAULT (false)
+#define AERON_CONDUCTOR_HOUSEKEEPING_ASYNC_DEFAULT (false)
+#define AERON_LOG_BUFFER_POOL_CAPACITY_DEFAULT (0)
+#define AERON_LOG_BUFFER_POOL_WARM_RESTART_DEFAULT (false)
+#define AERON_LOG_BUFFER_MEMORY_BUDGET_DEFAULT (UINT64_C(0))
+#define AERON_TERM_BUFFER_MEMFD_DEFAULT (false)
+#define AERON_TERM_BUFFER_CLEAN_MODE_DEFAULT (AERON_TERM_BUFFER_CLEAN_MODE_MEMSET)
 #define AERON_PERFORM_STORAGE_CHECKS_DEFAULT (true)
 #define AERON_SPIES_SIMULATE_CONNECTION_DEFAULT (false)
+#define AERON_NETWORK_SHORT_CIRCUIT_ENABLED_DEFAULT (false)
+#define AERON_CLIENT_DIRECTED_RESPONSES_ENABLED_DEFAULT (false)
 #define AERON_FILE_PAGE_SIZE_DEFAULT (4 * 1024)
 #define AERON_MTU_LENGTH_DEFAULT (1408)
 #define AERON_IPC_MTU_LENGTH_DEFAULT (1408)
 #define AERON_IPC_PUBLICATION_TERM_WINDOW_LENGTH_DEFAULT (0)
+#define AERON_IPC_PUBLICATION_EAGER_LIMIT_ENABLED_DEFAULT (false)
 #define AERON_PUBLICATION_TERM_WINDOW_LENGTH_DEFAULT (0)
 #define AERON_PUBLICATION_LINGER_TIMEOUT_NS_DEFAULT (5 * 1000 * 1000 * 1000LL)
 #define AERON_SOCKET_SO_RCVBUF_DEFAULT (128 * 1024)
 #define AERON_SOCKET_SO_SNDBUF_DEFAULT (0)
 #define AERON_SOCKET_MULTICAST_TTL_DEFAULT (0)
+#define AERON_SOCKET_DSCP_DEFAULT (0)
+#define AERON_SOCKET_GSO_ENABLED_DEFAULT (false)
+#define AERON_SOCKET_GRO_ENABLED_DEFAULT (false)
+#define AERON_SOCKET_STREAM_FILTER_ENABLED_DEFAULT (false)
+#define AERON_SOCKET_BUSY_POLL_US_DEFAULT (0)
+#define AERON_SOCKET_PREFER_BUSY_POLL_DEFAULT (false)
+#define AERON_SOCKET_RX_TIMESTAMPING_ENABLED_DEFAULT (false)
+#define AERON_SOCKET_BUFFER_AUTO_ENABLED_DEFAULT (false)
+#define AERON_PMTU_DISCOVERY_ENABLED_DEFAULT (false)
+#define AERON_RECEIVER_ZERO_COPY_ENABLED_DEFAULT (false)
+#define AERON_RCV_REDUNDANT_PATH_ENABLED_DEFAULT (false)
+#define AERON_RCV_FAST_JOIN_ENABLED_DEFAULT (false)
+#define AERON_STREAM_LATENCY_COUNTERS_ENABLED_DEFAULT (false)
+#define AERON_STREAM_CPU_COUNTERS_ENABLED_DEFAULT (false)
+#define AERON_UDP_TRANSPORT_POLLER_ITERATION_THRESHOLD_DEFAULT (5)
 #define AERON_RECEIVER_GROUP_TAG_IS_PRESENT_DEFAULT false
 #define AERON_RECEIVER_GROUP_TAG_VALUE_DEFAULT (-1)
 #define AERON_FLOW_CONTROL_GROUP_TAG_DEFAULT (-1)
 #define AERON_FLOW_CONTROL_GROUP_MIN_SIZE_DEFAULT (0)
 #define AERON_FLOW_CONTROL_RECEIVER_TIMEOUT_NS_DEFAULT (2 * 1000 * 1000 * 1000LL)
+#define AERON_CUBICCONGESTIONCONTROL_MEASURERTT_DEFAULT (false)
+#define AERON_CUBICCONGESTIONCONTROL_INITIALRTT_NS_DEFAULT (100 * 1000LL)
+#define AERON_CUBICCONGESTIONCONTROL_TCPMODE_DEFAULT (false)
 #define AERON_SEND_TO_STATUS_POLL_RATIO_DEFAULT (4)
+#define AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND_DEFAULT (2)
+#define AERON_NETWORK_PUBLICATION_SEND_COALESCING_DEFAULT (false)
+#define AERON_NETWORK_PUBLICATION_HEARTBEAT_BACKOFF_ENABLED_DEFAULT (false)
+#define AERON_RECEIVER_IO_VECTOR_CAPACITY_DEFAULT (2)
+#define AERON_SENDER_IO_VECTOR_CAPACITY_DEFAULT (2)
+#define AERON_RECEIVER_SHARD_COUNT_DEFAULT (1)
+#define AERON_SENDER_SHARD_COUNT_DEFAULT (1)
 #define AERON_RCV_STATUS_MESSAGE_TIMEOUT_NS_DEFAULT (200 * 1000 * 1000LL)
 #define AERON_MULTICAST_FLOWCONTROL_SUPPLIER_DEFAULT ("aeron_max_multicast_flow_control_strategy_supplier")
 #define AERON_UNICAST_FLOWCONTROL_SUPPLIER_DEFAULT ("aeron_unicast_flow_control_strategy_supplier")
-#define AERON_CONGESTIONCONTROL_SUPPLIER_DEFAULT ("aeron_static_window_congestion_control_strategy_supplier")
+#define AERON_CONGESTIONCONTROL_SUPPLIER_DEFAULT ("aeron_congestion_control_default_strategy_supplier")
 #define AERON_IMAGE_LIVENESS_TIMEOUT_NS_DEFAULT (10 * 1000 * 1000 * 1000LL)
 #define AERON_RCV_INITIAL_WINDOW_LENGTH_DEFAULT (128 * 1024)
 #define AERON_LOSS_REPORT_BUFFER_LENGTH_DEFAULT (1024 * 1024)
+#define AERON_TRACE_RING_CAPACITY_DEFAULT (0)
+#define AERON_TRACE_RING_CAPACITY_MAX (1 << 24)
 #define AERON_PUBLICATION_UNBLOCK_TIMEOUT_NS_DEFAULT (10 * 1000 * 1000 * 1000LL)
 #define AERON_PUBLICATION_CONNECTION_TIMEOUT_NS_DEFAULT (5 * 1000 * 1000 * 1000LL)
 #define AERON_TIMER_INTERVAL_NS_DEFAULT (1 * 1000 * 1000 * 1000LL)
+#define AERON_SHARED_CONDUCTOR_BUDGET_NS_DEFAULT (0)
 #define AERON_IDLE_STRATEGY_BACKOFF_DEFAULT "aeron_idle_strategy_backoff"
 #define AERON_COUNTERS_FREE_TO_REUSE_TIMEOUT_NS_DEFAULT (1 * 1000 * 1000 * 1000LL)
 #define AERON_PRINT_CONFIGURATION_DEFAULT (false)
@@ -291,7 +365,18 @@ static void aeron_driver_conductor_to_client_interceptor_null(
 #define AERON_DRIVER_TIMEOUT_MS_DEFAULT (10 * 1000)
 #define AERON_RETRANSMIT_UNICAST_DELAY_NS_DEFAULT (0)
 #define AERON_RETRANSMIT_UNICAST_LINGER_NS_DEFAULT (60 * 1000 * 1000LL)
+#define AERON_RETRANSMIT_BUDGET_RATE_DEFAULT (0)
+#define AERON_SENDER_RETRANSMIT_BUDGET_RATE_DEFAULT (0)
+#define AERON_RETRANSMIT_UNICAST_REPAIR_THRESHOLD_DEFAULT (0)
 #define AERON_NAK_MULTICAST_GROUP_SIZE_DEFAULT (10)
+#define AERON_NAK_MAX_GAPS_DEFAULT (1)
+#define AERON_NAK_RTT_ADAPTIVE_DEFAULT (false)
+#define AERON_RCV_STATUS_MESSAGE_BATCHING_DEFAULT (false)
+#define AERON_RCV_STATUS_MESSAGE_PACKING_DEFAULT (false)
+#define AERON_RCV_CONTROL_MESSAGE_BATCHING_DEFAULT (false)
+#define AERON_RCV_STATUS_MESSAGE_ADAPTIVE_DEFAULT (false)
+#define AERON_RCV_IMAGE_RATE_LIMIT_DEFAULT (0)
+#define AERON_RCV_IMAGE_RATE_LIMIT_MAX (100 * 1000 * 1000 * 1000LL)
 #define AERON_NAK_MULTICAST_MAX_BACKOFF_NS_DEFAULT (60 * 1000 * 1000LL)
 #define AERON_NAK_UNICAST_DELAY_NS_DEFAULT (60 * 1000 * 1000LL)
 #define AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_MEDIA_DEFAULT ("default")
@@ -301,6 +386,15 @@ static void aeron_driver_conductor_to_client_interceptor_null(
 #define AERON_PUBLICATION_RESERVED_SESSION_ID_LOW_DEFAULT (-1)
 #define AERON_PUBLICATION_RESERVED_SESSION_ID_HIGH_DEFAULT (10000)
 #define AERON_DRIVER_RERESOLUTION_CHECK_INTERVAL_NS_DEFAULT (1 * 1000 * 1000 * 1000LL)
+#define AERON_DRIVER_RERESOLUTION_ASYNC_DEFAULT (false)
+#define AERON_DRIVER_RECORDER_STREAM_ID_DEFAULT (INT32_C(0))
+#define AERON_DRIVER_RECORDER_DIR_DEFAULT ("aeron-recordings")
+#define AERON_DRIVER_RECORDER_SEGMENT_LENGTH_DEFAULT (128 * 1024 * 1024LL)
+#define AERON_DRIVER_RECORDER_SEGMENT_LENGTH_MAX (1024 * 1024 * 1024LL)
+#define AERON_DRIVER_CONDUCTOR_CYCLE_THRESHOLD_NS_DEFAULT (1000 * 1000 * 1000LL)
+#define AERON_DRIVER_SENDER_CYCLE_THRESHOLD_NS_DEFAULT (1000 * 1000 * 1000LL)
+#define AERON_DRIVER_RECEIVER_CYCLE_THRESHOLD_NS_DEFAULT (1000 * 1000 * 1000LL)
+#define AERON_AGENT_FIFO_PRIORITY_DEFAULT (0)
 
 int aeron_driver_context_init(aeron_driver_context_t **context)
 {
@@ -320,10 +414,19 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
 
     _context->cnc_map.addr = NULL;
     _context->loss_report.addr = NULL;
+    _context->trace_file.addr = NULL;
     _context->aeron_dir = NULL;
     _context->conductor_proxy = NULL;
     _context->sender_proxy = NULL;
+    _context->log_buffer_pre_faulter = NULL;
+    _context->housekeeper = NULL;
+    _context->async_name_resolver = NULL;
+    _context->log_buffer_pool = NULL;
+    _context->sender_shard_proxies = NULL;
+    _context->sender_shard_proxies_length = 0;
     _context->receiver_proxy = NULL;
+    _context->receiver_shard_proxies = NULL;
+    _context->receiver_shard_proxies_length = 0;
     _context->counters_manager = NULL;
     _context->error_log = NULL;
     _context->udp_channel_outgoing_interceptor_bindings = NULL;
@@ -389,8 +492,21 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
     _context->dirs_delete_on_shutdown = AERON_DIR_DELETE_ON_SHUTDOWN_DEFAULT;
     _context->warn_if_dirs_exist = AERON_DIR_WARN_IF_EXISTS_DEFAULT;
     _context->term_buffer_sparse_file = AERON_TERM_BUFFER_SPARSE_FILE_DEFAULT;
+    _context->term_buffer_huge_pages = AERON_TERM_BUFFER_HUGE_PAGES_DEFAULT;
+    _context->term_buffer_numa_node = AERON_TERM_BUFFER_NUMA_NODE_DEFAULT;
+    _context->cnc_numa_node = AERON_CNC_NUMA_NODE_DEFAULT;
+    _context->term_buffer_pre_fault_async = AERON_TERM_BUFFER_PRE_FAULT_ASYNC_DEFAULT;
+    _context->conductor_housekeeping_async = AERON_CONDUCTOR_HOUSEKEEPING_ASYNC_DEFAULT;
+    _context->log_buffer_pool_capacity = AERON_LOG_BUFFER_POOL_CAPACITY_DEFAULT;
+    _context->log_buffer_pool_warm_restart = AERON_LOG_BUFFER_POOL_WARM_RESTART_DEFAULT;
+    _context->log_buffer_memory_budget = AERON_LOG_BUFFER_MEMORY_BUDGET_DEFAULT;
+    _context->term_buffer_memfd = AERON_TERM_BUFFER_MEMFD_DEFAULT;
+    _context->log_buffer_socket_path = NULL;
+    _context->term_buffer_clean_mode = AERON_TERM_BUFFER_CLEAN_MODE_DEFAULT;
     _context->perform_storage_checks = AERON_PERFORM_STORAGE_CHECKS_DEFAULT;
     _context->spies_simulate_connection = AERON_SPIES_SIMULATE_CONNECTION_DEFAULT;
+    _context->network_short_circuit_enabled = AERON_NETWORK_SHORT_CIRCUIT_ENABLED_DEFAULT;
+    _context->client_directed_responses_enabled = AERON_CLIENT_DIRECTED_RESPONSES_ENABLED_DEFAULT;
     _context->print_configuration_on_start = AERON_PRINT_CONFIGURATION_DEFAULT;
     _context->reliable_stream = AERON_RELIABLE_STREAM_DEFAULT;
     _context->tether_subscriptions = AERON_TETHER_SUBSCRIPTIONS_DEFAULT;
@@ -399,30 +515,60 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
     _context->driver_timeout_ms = AERON_DRIVER_TIMEOUT_MS_DEFAULT;
     _context->to_driver_buffer_length = AERON_TO_CONDUCTOR_BUFFER_LENGTH_DEFAULT;
     _context->to_clients_buffer_length = AERON_TO_CLIENTS_BUFFER_LENGTH_DEFAULT;
+    _context->client_directed_responses_buffer_length = AERON_CLIENT_DIRECTED_RESPONSES_BUFFER_LENGTH_DEFAULT;
     _context->counters_values_buffer_length = AERON_COUNTERS_VALUES_BUFFER_LENGTH_DEFAULT;
+    _context->counters_compact_capacity = AERON_COUNTERS_COMPACT_CAPACITY_DEFAULT;
     _context->error_buffer_length = AERON_ERROR_BUFFER_LENGTH_DEFAULT;
     _context->client_liveness_timeout_ns = AERON_CLIENT_LIVENESS_TIMEOUT_NS_DEFAULT;
     _context->timer_interval_ns = AERON_TIMER_INTERVAL_NS_DEFAULT;
+    _context->shared_conductor_budget_ns = AERON_SHARED_CONDUCTOR_BUDGET_NS_DEFAULT;
     _context->term_buffer_length = AERON_TERM_BUFFER_LENGTH_DEFAULT;
     _context->ipc_term_buffer_length = AERON_IPC_TERM_BUFFER_LENGTH_DEFAULT;
     _context->mtu_length = AERON_MTU_LENGTH_DEFAULT;
     _context->ipc_mtu_length = AERON_IPC_MTU_LENGTH_DEFAULT;
     _context->ipc_publication_window_length = AERON_IPC_PUBLICATION_TERM_WINDOW_LENGTH_DEFAULT;
+    _context->ipc_publication_eager_limit_enabled = AERON_IPC_PUBLICATION_EAGER_LIMIT_ENABLED_DEFAULT;
     _context->publication_window_length = AERON_PUBLICATION_TERM_WINDOW_LENGTH_DEFAULT;
     _context->publication_linger_timeout_ns = AERON_PUBLICATION_LINGER_TIMEOUT_NS_DEFAULT;
     _context->socket_rcvbuf = AERON_SOCKET_SO_RCVBUF_DEFAULT;
     _context->socket_sndbuf = AERON_SOCKET_SO_SNDBUF_DEFAULT;
     _context->multicast_ttl = AERON_SOCKET_MULTICAST_TTL_DEFAULT;
+    _context->socket_dscp = AERON_SOCKET_DSCP_DEFAULT;
+    _context->socket_gso_enabled = AERON_SOCKET_GSO_ENABLED_DEFAULT;
+    _context->socket_gro_enabled = AERON_SOCKET_GRO_ENABLED_DEFAULT;
+    _context->socket_stream_filter_enabled = AERON_SOCKET_STREAM_FILTER_ENABLED_DEFAULT;
+    _context->socket_busy_poll_us = AERON_SOCKET_BUSY_POLL_US_DEFAULT;
+    _context->socket_prefer_busy_poll = AERON_SOCKET_PREFER_BUSY_POLL_DEFAULT;
+    _context->socket_rx_timestamping_enabled = AERON_SOCKET_RX_TIMESTAMPING_ENABLED_DEFAULT;
+    _context->socket_buffer_auto_enabled = AERON_SOCKET_BUFFER_AUTO_ENABLED_DEFAULT;
+    _context->pmtu_discovery_enabled = AERON_PMTU_DISCOVERY_ENABLED_DEFAULT;
+    _context->receiver_zero_copy_enabled = AERON_RECEIVER_ZERO_COPY_ENABLED_DEFAULT;
+    _context->redundant_path_enabled = AERON_RCV_REDUNDANT_PATH_ENABLED_DEFAULT;
+    _context->fast_join_enabled = AERON_RCV_FAST_JOIN_ENABLED_DEFAULT;
+    _context->stream_latency_counters_enabled = AERON_STREAM_LATENCY_COUNTERS_ENABLED_DEFAULT;
+    _context->stream_cpu_counters_enabled = AERON_STREAM_CPU_COUNTERS_ENABLED_DEFAULT;
+    _context->udp_transport_poller_iteration_threshold = AERON_UDP_TRANSPORT_POLLER_ITERATION_THRESHOLD_DEFAULT;
     _context->receiver_group_tag.is_present = AERON_RECEIVER_GROUP_TAG_IS_PRESENT_DEFAULT;
     _context->receiver_group_tag.value = AERON_RECEIVER_GROUP_TAG_VALUE_DEFAULT;
     _context->flow_control.group_tag = AERON_FLOW_CONTROL_GROUP_TAG_DEFAULT;
     _context->flow_control.group_min_size = AERON_FLOW_CONTROL_GROUP_MIN_SIZE_DEFAULT;
     _context->flow_control.receiver_timeout_ns = AERON_FLOW_CONTROL_RECEIVER_TIMEOUT_NS_DEFAULT;
+    _context->cubic_congestion_control.measure_rtt = AERON_CUBICCONGESTIONCONTROL_MEASURERTT_DEFAULT;
+    _context->cubic_congestion_control.initial_rtt_ns = AERON_CUBICCONGESTIONCONTROL_INITIALRTT_NS_DEFAULT;
+    _context->cubic_congestion_control.tcp_mode = AERON_CUBICCONGESTIONCONTROL_TCPMODE_DEFAULT;
     _context->send_to_sm_poll_ratio = AERON_SEND_TO_STATUS_POLL_RATIO_DEFAULT;
+    _context->network_publication_max_messages_per_send = AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND_DEFAULT;
+    _context->network_publication_send_coalescing = AERON_NETWORK_PUBLICATION_SEND_COALESCING_DEFAULT;
+    _context->network_publication_heartbeat_backoff_enabled = AERON_NETWORK_PUBLICATION_HEARTBEAT_BACKOFF_ENABLED_DEFAULT;
+    _context->receiver_io_vector_capacity = AERON_RECEIVER_IO_VECTOR_CAPACITY_DEFAULT;
+    _context->sender_io_vector_capacity = AERON_SENDER_IO_VECTOR_CAPACITY_DEFAULT;
+    _context->receiver_shard_count = AERON_RECEIVER_SHARD_COUNT_DEFAULT;
+    _context->sender_shard_count = AERON_SENDER_SHARD_COUNT_DEFAULT;
     _context->status_message_timeout_ns = AERON_RCV_STATUS_MESSAGE_TIMEOUT_NS_DEFAULT;
     _context->image_liveness_timeout_ns = AERON_IMAGE_LIVENESS_TIMEOUT_NS_DEFAULT;
     _context->initial_window_length = AERON_RCV_INITIAL_WINDOW_LENGTH_DEFAULT;
     _context->loss_report_length = AERON_LOSS_REPORT_BUFFER_LENGTH_DEFAULT;
+    _context->trace_ring_capacity = AERON_TRACE_RING_CAPACITY_DEFAULT;
     _context->file_page_size = AERON_FILE_PAGE_SIZE_DEFAULT;
     _context->publication_unblock_timeout_ns = AERON_PUBLICATION_UNBLOCK_TIMEOUT_NS_DEFAULT;
     _context->publication_connection_timeout_ns = AERON_PUBLICATION_CONNECTION_TIMEOUT_NS_DEFAULT;
@@ -431,7 +577,17 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
     _context->untethered_resting_timeout_ns = AERON_UNTETHERED_RESTING_TIMEOUT_NS_DEFAULT;
     _context->retransmit_unicast_delay_ns = AERON_RETRANSMIT_UNICAST_DELAY_NS_DEFAULT;
     _context->retransmit_unicast_linger_ns = AERON_RETRANSMIT_UNICAST_LINGER_NS_DEFAULT;
+    _context->retransmit_budget_rate = AERON_RETRANSMIT_BUDGET_RATE_DEFAULT;
+    _context->sender_retransmit_budget_rate = AERON_SENDER_RETRANSMIT_BUDGET_RATE_DEFAULT;
+    _context->retransmit_unicast_repair_threshold = AERON_RETRANSMIT_UNICAST_REPAIR_THRESHOLD_DEFAULT;
     _context->nak_multicast_group_size = AERON_NAK_MULTICAST_GROUP_SIZE_DEFAULT;
+    _context->nak_max_gaps = AERON_NAK_MAX_GAPS_DEFAULT;
+    _context->nak_rtt_adaptive = AERON_NAK_RTT_ADAPTIVE_DEFAULT;
+    _context->status_message_batching = AERON_RCV_STATUS_MESSAGE_BATCHING_DEFAULT;
+    _context->status_message_packing = AERON_RCV_STATUS_MESSAGE_PACKING_DEFAULT;
+    _context->control_message_batching = AERON_RCV_CONTROL_MESSAGE_BATCHING_DEFAULT;
+    _context->status_message_adaptive = AERON_RCV_STATUS_MESSAGE_ADAPTIVE_DEFAULT;
+    _context->image_rate_limit = AERON_RCV_IMAGE_RATE_LIMIT_DEFAULT;
     _context->nak_multicast_max_backoff_ns = AERON_NAK_MULTICAST_MAX_BACKOFF_NS_DEFAULT;
     _context->nak_unicast_delay_ns = AERON_NAK_UNICAST_DELAY_NS_DEFAULT;
     _context->publication_reserved_session_id_low = AERON_PUBLICATION_RESERVED_SESSION_ID_LOW_DEFAULT;
@@ -440,7 +596,22 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
     _context->resolver_interface = NULL;
     _context->resolver_bootstrap_neighbor = NULL;
     _context->name_resolver_init_args = NULL;
+    _context->metrics_http_endpoint = NULL;
+    _context->recorder_channel = NULL;
+    _context->recorder_stream_id = AERON_DRIVER_RECORDER_STREAM_ID_DEFAULT;
+    _context->recorder_dir = AERON_DRIVER_RECORDER_DIR_DEFAULT;
+    _context->recorder_segment_length = AERON_DRIVER_RECORDER_SEGMENT_LENGTH_DEFAULT;
     _context->re_resolution_check_interval_ns = AERON_DRIVER_RERESOLUTION_CHECK_INTERVAL_NS_DEFAULT;
+    _context->re_resolution_async = AERON_DRIVER_RERESOLUTION_ASYNC_DEFAULT;
+    _context->conductor_cycle_threshold_ns = AERON_DRIVER_CONDUCTOR_CYCLE_THRESHOLD_NS_DEFAULT;
+    _context->sender_cycle_threshold_ns = AERON_DRIVER_SENDER_CYCLE_THRESHOLD_NS_DEFAULT;
+    _context->receiver_cycle_threshold_ns = AERON_DRIVER_RECEIVER_CYCLE_THRESHOLD_NS_DEFAULT;
+    _context->conductor_cpu_affinity = NULL;
+    _context->sender_cpu_affinity = NULL;
+    _context->receiver_cpu_affinity = NULL;
+    _context->conductor_fifo_priority = AERON_AGENT_FIFO_PRIORITY_DEFAULT;
+    _context->sender_fifo_priority = AERON_AGENT_FIFO_PRIORITY_DEFAULT;
+    _context->receiver_fifo_priority = AERON_AGENT_FIFO_PRIORITY_DEFAULT;
 
     char *value = NULL;
 
@@ -501,6 +672,27 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
     _context->resolver_interface = getenv(AERON_DRIVER_RESOLVER_INTERFACE_ENV_VAR);
     _context->resolver_bootstrap_neighbor = getenv(AERON_DRIVER_RESOLVER_BOOTSTRAP_NEIGHBOR_ENV_VAR);
     _context->name_resolver_init_args = getenv(AERON_NAME_RESOLVER_INIT_ARGS_ENV_VAR);
+    _context->metrics_http_endpoint = getenv(AERON_DRIVER_METRICS_HTTP_ENDPOINT_ENV_VAR);
+    _context->recorder_channel = getenv(AERON_DRIVER_RECORDER_CHANNEL_ENV_VAR);
+
+    _context->recorder_stream_id = aeron_config_parse_int32(
+        AERON_DRIVER_RECORDER_STREAM_ID_ENV_VAR,
+        getenv(AERON_DRIVER_RECORDER_STREAM_ID_ENV_VAR),
+        _context->recorder_stream_id,
+        INT32_MIN,
+        INT32_MAX);
+
+    if ((value = getenv(AERON_DRIVER_RECORDER_DIR_ENV_VAR)))
+    {
+        _context->recorder_dir = value;
+    }
+
+    _context->recorder_segment_length = (size_t)aeron_config_parse_size64(
+        AERON_DRIVER_RECORDER_SEGMENT_LENGTH_ENV_VAR,
+        getenv(AERON_DRIVER_RECORDER_SEGMENT_LENGTH_ENV_VAR),
+        _context->recorder_segment_length,
+        AERON_LOGBUFFER_TERM_MIN_LENGTH,
+        AERON_DRIVER_RECORDER_SEGMENT_LENGTH_MAX);
 
     _context->dirs_delete_on_start = aeron_parse_bool(
         getenv(AERON_DIR_DELETE_ON_START_ENV_VAR), _context->dirs_delete_on_start);
@@ -514,12 +706,65 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
     _context->term_buffer_sparse_file = aeron_parse_bool(
         getenv(AERON_TERM_BUFFER_SPARSE_FILE_ENV_VAR), _context->term_buffer_sparse_file);
 
+    _context->term_buffer_huge_pages = aeron_parse_bool(
+        getenv(AERON_TERM_BUFFER_HUGE_PAGES_ENV_VAR), _context->term_buffer_huge_pages);
+
+    _context->term_buffer_numa_node = aeron_config_parse_int32(
+        AERON_TERM_BUFFER_NUMA_NODE_ENV_VAR,
+        getenv(AERON_TERM_BUFFER_NUMA_NODE_ENV_VAR),
+        _context->term_buffer_numa_node,
+        AERON_NUMA_NODE_NONE,
+        AERON_NUMA_NODE_MAX - 1);
+
+    _context->cnc_numa_node = aeron_config_parse_int32(
+        AERON_CNC_NUMA_NODE_ENV_VAR,
+        getenv(AERON_CNC_NUMA_NODE_ENV_VAR),
+        _context->cnc_numa_node,
+        AERON_NUMA_NODE_NONE,
+        AERON_NUMA_NODE_MAX - 1);
+
+    _context->term_buffer_pre_fault_async = aeron_parse_bool(
+        getenv(AERON_TERM_BUFFER_PRE_FAULT_ASYNC_ENV_VAR), _context->term_buffer_pre_fault_async);
+
+    _context->conductor_housekeeping_async = aeron_parse_bool(
+        getenv(AERON_CONDUCTOR_HOUSEKEEPING_ASYNC_ENV_VAR), _context->conductor_housekeeping_async);
+
+    _context->log_buffer_pool_capacity = (size_t)aeron_config_parse_uint64(
+        AERON_LOG_BUFFER_POOL_CAPACITY_ENV_VAR,
+        getenv(AERON_LOG_BUFFER_POOL_CAPACITY_ENV_VAR),
+        _context->log_buffer_pool_capacity,
+        0,
+        AERON_LOG_BUFFER_POOL_CAPACITY_MAX);
+
+    _context->log_buffer_pool_warm_restart = aeron_parse_bool(
+        getenv(AERON_LOG_BUFFER_POOL_WARM_RESTART_ENV_VAR), _context->log_buffer_pool_warm_restart);
+
+    _context->log_buffer_memory_budget = aeron_config_parse_size64(
+        AERON_LOG_BUFFER_MEMORY_BUDGET_ENV_VAR,
+        getenv(AERON_LOG_BUFFER_MEMORY_BUDGET_ENV_VAR),
+        _context->log_buffer_memory_budget,
+        0,
+        INT64_MAX);
+
+    _context->term_buffer_memfd = aeron_parse_bool(
+        getenv(AERON_TERM_BUFFER_MEMFD_ENV_VAR), _context->term_buffer_memfd);
+    _context->log_buffer_socket_path = getenv(AERON_LOG_BUFFER_SOCKET_ENV_VAR);
+
+    _context->term_buffer_clean_mode = aeron_config_parse_term_buffer_clean_mode(
+        getenv(AERON_TERM_BUFFER_CLEAN_MODE_ENV_VAR), _context->term_buffer_clean_mode);
+
     _context->perform_storage_checks = aeron_parse_bool(
         getenv(AERON_PERFORM_STORAGE_CHECKS_ENV_VAR), _context->perform_storage_checks);
 
     _context->spies_simulate_connection = aeron_parse_bool(
         getenv(AERON_SPIES_SIMULATE_CONNECTION_ENV_VAR), _context->spies_simulate_connection);
 
+    _context->network_short_circuit_enabled = aeron_parse_bool(
+        getenv(AERON_NETWORK_SHORT_CIRCUIT_ENABLED_ENV_VAR), _context->network_short_circuit_enabled);
+
+    _context->client_directed_responses_enabled = aeron_parse_bool(
+        getenv(AERON_CLIENT_DIRECTED_RESPONSES_ENABLED_ENV_VAR), _context->client_directed_responses_enabled);
+
     _context->print_configuration_on_start = aeron_parse_bool(
         getenv(AERON_PRINT_CONFIGURATION_ON_START_ENV_VAR), _context->print_configuration_on_start);
 
@@ -532,6 +777,45 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
     _context->rejoin_stream = aeron_parse_bool(
         getenv(AERON_REJOIN_STREAM_ENV_VAR), _context->rejoin_stream);
 
+    _context->socket_gso_enabled = aeron_parse_bool(
+        getenv(AERON_SOCKET_GSO_ENABLED_ENV_VAR), _context->socket_gso_enabled);
+
+    _context->socket_gro_enabled = aeron_parse_bool(
+        getenv(AERON_SOCKET_GRO_ENABLED_ENV_VAR), _context->socket_gro_enabled);
+
+    _context->socket_stream_filter_enabled = aeron_parse_bool(
+        getenv(AERON_SOCKET_STREAM_FILTER_ENABLED_ENV_VAR), _context->socket_stream_filter_enabled);
+
+    _context->socket_prefer_busy_poll = aeron_parse_bool(
+        getenv(AERON_SOCKET_PREFER_BUSY_POLL_ENV_VAR), _context->socket_prefer_busy_poll);
+
+    _context->socket_rx_timestamping_enabled = aeron_parse_bool(
+        getenv(AERON_SOCKET_RX_TIMESTAMPING_ENABLED_ENV_VAR), _context->socket_rx_timestamping_enabled);
+
+    _context->socket_buffer_auto_enabled = aeron_parse_bool(
+        getenv(AERON_SOCKET_BUFFER_AUTO_ENABLED_ENV_VAR), _context->socket_buffer_auto_enabled);
+
+    _context->pmtu_discovery_enabled = aeron_parse_bool(
+        getenv(AERON_PMTU_DISCOVERY_ENABLED_ENV_VAR), _context->pmtu_discovery_enabled);
+
+    _context->receiver_zero_copy_enabled = aeron_parse_bool(
+        getenv(AERON_RECEIVER_ZERO_COPY_ENABLED_ENV_VAR), _context->receiver_zero_copy_enabled);
+
+    _context->redundant_path_enabled = aeron_parse_bool(
+        getenv(AERON_RCV_REDUNDANT_PATH_ENABLED_ENV_VAR), _context->redundant_path_enabled);
+
+    _context->fast_join_enabled = aeron_parse_bool(
+        getenv(AERON_RCV_FAST_JOIN_ENABLED_ENV_VAR), _context->fast_join_enabled);
+
+    _context->stream_latency_counters_enabled = aeron_parse_bool(
+        getenv(AERON_STREAM_LATENCY_COUNTERS_ENABLED_ENV_VAR), _context->stream_latency_counters_enabled);
+
+    _context->stream_cpu_counters_enabled = aeron_parse_bool(
+        getenv(AERON_STREAM_CPU_COUNTERS_ENABLED_ENV_VAR), _context->stream_cpu_counters_enabled);
+
+    _context->ipc_publication_eager_limit_enabled = aeron_parse_bool(
+        getenv(AERON_IPC_PUBLICATION_EAGER_LIMIT_ENABLED_ENV_VAR), _context->ipc_publication_eager_limit_enabled);
+
     _context->to_driver_buffer_length = aeron_config_parse_size64(
         AERON_TO_CONDUCTOR_BUFFER_LENGTH_ENV_VAR,
         getenv(AERON_TO_CONDUCTOR_BUFFER_LENGTH_ENV_VAR),
@@ -546,6 +830,13 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
         1024 + AERON_BROADCAST_BUFFER_TRAILER_LENGTH,
         INT32_MAX);
 
+    _context->client_directed_responses_buffer_length = aeron_config_parse_size64(
+        AERON_CLIENT_DIRECTED_RESPONSES_BUFFER_LENGTH_ENV_VAR,
+        getenv(AERON_CLIENT_DIRECTED_RESPONSES_BUFFER_LENGTH_ENV_VAR),
+        _context->client_directed_responses_buffer_length,
+        1024 + AERON_BROADCAST_BUFFER_TRAILER_LENGTH,
+        INT32_MAX);
+
     _context->counters_values_buffer_length = aeron_config_parse_size64(
         AERON_COUNTERS_VALUES_BUFFER_LENGTH_ENV_VAR,
         getenv(AERON_COUNTERS_VALUES_BUFFER_LENGTH_ENV_VAR),
@@ -553,6 +844,13 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
         1024,
         INT32_MAX);
 
+    _context->counters_compact_capacity = aeron_config_parse_int32(
+        AERON_COUNTERS_COMPACT_CAPACITY_ENV_VAR,
+        getenv(AERON_COUNTERS_COMPACT_CAPACITY_ENV_VAR),
+        _context->counters_compact_capacity,
+        0,
+        AERON_COUNTERS_COMPACT_CAPACITY_MAX);
+
     _context->error_buffer_length = aeron_config_parse_size64(
         AERON_ERROR_BUFFER_LENGTH_ENV_VAR,
         getenv(AERON_ERROR_BUFFER_LENGTH_ENV_VAR),
@@ -637,6 +935,13 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
         0,
         255);
 
+    _context->socket_dscp = (uint8_t)aeron_config_parse_uint64(
+        AERON_SOCKET_DSCP_ENV_VAR,
+        getenv(AERON_SOCKET_DSCP_ENV_VAR),
+        _context->socket_dscp,
+        0,
+        63);
+
     _context->send_to_sm_poll_ratio = (uint8_t)aeron_config_parse_uint64(
         AERON_SEND_TO_STATUS_POLL_RATIO_ENV_VAR,
         getenv(AERON_SEND_TO_STATUS_POLL_RATIO_ENV_VAR),
@@ -644,6 +949,63 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
         1,
         INT32_MAX);
 
+    _context->socket_busy_poll_us = aeron_config_parse_uint32(
+        AERON_SOCKET_BUSY_POLL_US_ENV_VAR,
+        getenv(AERON_SOCKET_BUSY_POLL_US_ENV_VAR),
+        (int32_t)_context->socket_busy_poll_us,
+        0,
+        INT32_MAX);
+
+    _context->udp_transport_poller_iteration_threshold = aeron_config_parse_uint64(
+        AERON_UDP_TRANSPORT_POLLER_ITERATION_THRESHOLD_ENV_VAR,
+        getenv(AERON_UDP_TRANSPORT_POLLER_ITERATION_THRESHOLD_ENV_VAR),
+        _context->udp_transport_poller_iteration_threshold,
+        0,
+        INT32_MAX);
+
+    _context->network_publication_max_messages_per_send = aeron_config_parse_uint64(
+        AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND_ENV_VAR,
+        getenv(AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND_ENV_VAR),
+        _context->network_publication_max_messages_per_send,
+        1,
+        AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND_MAX);
+
+    _context->network_publication_heartbeat_backoff_enabled = aeron_parse_bool(
+        getenv(AERON_NETWORK_PUBLICATION_HEARTBEAT_BACKOFF_ENABLED_ENV_VAR),
+        _context->network_publication_heartbeat_backoff_enabled);
+
+    _context->network_publication_send_coalescing = aeron_parse_bool(
+        getenv(AERON_NETWORK_PUBLICATION_SEND_COALESCING_ENV_VAR),
+        _context->network_publication_send_coalescing);
+
+    _context->receiver_io_vector_capacity = aeron_config_parse_uint64(
+        AERON_RECEIVER_IO_VECTOR_CAPACITY_ENV_VAR,
+        getenv(AERON_RECEIVER_IO_VECTOR_CAPACITY_ENV_VAR),
+        _context->receiver_io_vector_capacity,
+        1,
+        AERON_DRIVER_RECEIVER_IO_VECTOR_CAPACITY_MAX);
+
+    _context->sender_io_vector_capacity = aeron_config_parse_uint64(
+        AERON_SENDER_IO_VECTOR_CAPACITY_ENV_VAR,
+        getenv(AERON_SENDER_IO_VECTOR_CAPACITY_ENV_VAR),
+        _context->sender_io_vector_capacity,
+        1,
+        AERON_DRIVER_SENDER_IO_VECTOR_CAPACITY_MAX);
+
+    _context->receiver_shard_count = aeron_config_parse_uint64(
+        AERON_RECEIVER_SHARD_COUNT_ENV_VAR,
+        getenv(AERON_RECEIVER_SHARD_COUNT_ENV_VAR),
+        _context->receiver_shard_count,
+        1,
+        AERON_DRIVER_RECEIVER_SHARD_COUNT_MAX);
+
+    _context->sender_shard_count = aeron_config_parse_uint64(
+        AERON_SENDER_SHARD_COUNT_ENV_VAR,
+        getenv(AERON_SENDER_SHARD_COUNT_ENV_VAR),
+        _context->sender_shard_count,
+        1,
+        AERON_DRIVER_SENDER_SHARD_COUNT_MAX);
+
     _context->driver_timeout_ms = aeron_config_parse_uint64(
         AERON_DRIVER_TIMEOUT_ENV_VAR,
         getenv(AERON_DRIVER_TIMEOUT_ENV_VAR),
@@ -679,6 +1041,13 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
         1024,
         INT32_MAX);
 
+    _context->trace_ring_capacity = aeron_config_parse_size64(
+        AERON_TRACE_RING_CAPACITY_ENV_VAR,
+        getenv(AERON_TRACE_RING_CAPACITY_ENV_VAR),
+        _context->trace_ring_capacity,
+        0,
+        AERON_TRACE_RING_CAPACITY_MAX);
+
     _context->file_page_size = aeron_config_parse_size64(
         AERON_FILE_PAGE_SIZE_ENV_VAR,
         getenv(AERON_FILE_PAGE_SIZE_ENV_VAR),
@@ -707,6 +1076,13 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
         1000,
         INT64_MAX);
 
+    _context->shared_conductor_budget_ns = aeron_config_parse_duration_ns(
+        AERON_SHARED_CONDUCTOR_BUDGET_ENV_VAR,
+        getenv(AERON_SHARED_CONDUCTOR_BUDGET_ENV_VAR),
+        _context->shared_conductor_budget_ns,
+        0,
+        INT64_MAX);
+
     _context->counter_free_to_reuse_ns = aeron_config_parse_duration_ns(
         AERON_COUNTERS_FREE_TO_REUSE_TIMEOUT_ENV_VAR,
         getenv(AERON_COUNTERS_FREE_TO_REUSE_TIMEOUT_ENV_VAR),
@@ -742,6 +1118,27 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
         1000,
         INT64_MAX);
 
+    _context->retransmit_budget_rate = aeron_config_parse_size64(
+        AERON_RETRANSMIT_BUDGET_RATE_ENV_VAR,
+        getenv(AERON_RETRANSMIT_BUDGET_RATE_ENV_VAR),
+        _context->retransmit_budget_rate,
+        0,
+        AERON_RETRANSMIT_BUDGET_MAX_RATE);
+
+    _context->sender_retransmit_budget_rate = aeron_config_parse_size64(
+        AERON_SENDER_RETRANSMIT_BUDGET_RATE_ENV_VAR,
+        getenv(AERON_SENDER_RETRANSMIT_BUDGET_RATE_ENV_VAR),
+        _context->sender_retransmit_budget_rate,
+        0,
+        AERON_RETRANSMIT_BUDGET_MAX_RATE);
+
+    _context->retransmit_unicast_repair_threshold = (size_t)aeron_config_parse_uint64(
+        AERON_RETRANSMIT_UNICAST_REPAIR_THRESHOLD_ENV_VAR,
+        getenv(AERON_RETRANSMIT_UNICAST_REPAIR_THRESHOLD_ENV_VAR),
+        _context->retransmit_unicast_repair_threshold,
+        0,
+        AERON_RETRANSMIT_HANDLER_MAX_UNICAST_REPAIR_ADDRS);
+
     _context->nak_multicast_group_size = (size_t)aeron_config_parse_uint64(
         AERON_NAK_MULTICAST_GROUP_SIZE_ENV_VAR,
         getenv(AERON_NAK_MULTICAST_GROUP_SIZE_ENV_VAR),
@@ -749,6 +1146,34 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
         1,
         INT32_MAX);
 
+    _context->nak_max_gaps = (size_t)aeron_config_parse_uint64(
+        AERON_NAK_MAX_GAPS_ENV_VAR,
+        getenv(AERON_NAK_MAX_GAPS_ENV_VAR),
+        _context->nak_max_gaps,
+        1,
+        AERON_LOSS_DETECTOR_MAX_GAPS);
+
+    _context->nak_rtt_adaptive = aeron_parse_bool(getenv(AERON_NAK_RTT_ADAPTIVE_ENV_VAR), _context->nak_rtt_adaptive);
+
+    _context->status_message_batching = aeron_parse_bool(
+        getenv(AERON_RCV_STATUS_MESSAGE_BATCHING_ENV_VAR), _context->status_message_batching);
+
+    _context->status_message_packing = aeron_parse_bool(
+        getenv(AERON_RCV_STATUS_MESSAGE_PACKING_ENV_VAR), _context->status_message_packing);
+
+    _context->control_message_batching = aeron_parse_bool(
+        getenv(AERON_RCV_CONTROL_MESSAGE_BATCHING_ENV_VAR), _context->control_message_batching);
+
+    _context->status_message_adaptive = aeron_parse_bool(
+        getenv(AERON_RCV_STATUS_MESSAGE_ADAPTIVE_ENV_VAR), _context->status_message_adaptive);
+
+    _context->image_rate_limit = aeron_config_parse_size64(
+        AERON_RCV_IMAGE_RATE_LIMIT_ENV_VAR,
+        getenv(AERON_RCV_IMAGE_RATE_LIMIT_ENV_VAR),
+        _context->image_rate_limit,
+        0,
+        AERON_RCV_IMAGE_RATE_LIMIT_MAX);
+
     _context->nak_multicast_max_backoff_ns = aeron_config_parse_duration_ns(
         AERON_NAK_MULTICAST_MAX_BACKOFF_ENV_VAR,
         getenv(AERON_NAK_MULTICAST_MAX_BACKOFF_ENV_VAR),
@@ -810,6 +1235,19 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
         0,
         INT64_MAX);
 
+    _context->cubic_congestion_control.measure_rtt = aeron_parse_bool(
+        getenv(AERON_CUBICCONGESTIONCONTROL_MEASURERTT_ENV_VAR), _context->cubic_congestion_control.measure_rtt);
+
+    _context->cubic_congestion_control.initial_rtt_ns = aeron_config_parse_duration_ns(
+        AERON_CUBICCONGESTIONCONTROL_INITIALRTT_ENV_VAR,
+        getenv(AERON_CUBICCONGESTIONCONTROL_INITIALRTT_ENV_VAR),
+        _context->cubic_congestion_control.initial_rtt_ns,
+        1,
+        INT64_MAX);
+
+    _context->cubic_congestion_control.tcp_mode = aeron_parse_bool(
+        getenv(AERON_CUBICCONGESTIONCONTROL_TCPMODE_ENV_VAR), _context->cubic_congestion_control.tcp_mode);
+
     _context->re_resolution_check_interval_ns = aeron_config_parse_duration_ns(
         AERON_DRIVER_RERESOLUTION_CHECK_INTERVAL_ENV_VAR,
         getenv(AERON_DRIVER_RERESOLUTION_CHECK_INTERVAL_ENV_VAR),
@@ -817,14 +1255,72 @@ int aeron_driver_context_init(aeron_driver_context_t **context)
         0,
         INT64_MAX);
 
+    _context->re_resolution_async = aeron_parse_bool(
+        getenv(AERON_DRIVER_RERESOLUTION_ASYNC_ENV_VAR), _context->re_resolution_async);
+
+    _context->conductor_cycle_threshold_ns = aeron_config_parse_duration_ns(
+        AERON_DRIVER_CONDUCTOR_CYCLE_THRESHOLD_ENV_VAR,
+        getenv(AERON_DRIVER_CONDUCTOR_CYCLE_THRESHOLD_ENV_VAR),
+        _context->conductor_cycle_threshold_ns,
+        1,
+        INT64_MAX);
+
+    _context->sender_cycle_threshold_ns = aeron_config_parse_duration_ns(
+        AERON_DRIVER_SENDER_CYCLE_THRESHOLD_ENV_VAR,
+        getenv(AERON_DRIVER_SENDER_CYCLE_THRESHOLD_ENV_VAR),
+        _context->sender_cycle_threshold_ns,
+        1,
+        INT64_MAX);
+
+    _context->receiver_cycle_threshold_ns = aeron_config_parse_duration_ns(
+        AERON_DRIVER_RECEIVER_CYCLE_THRESHOLD_ENV_VAR,
+        getenv(AERON_DRIVER_RECEIVER_CYCLE_THRESHOLD_ENV_VAR),
+        _context->receiver_cycle_threshold_ns,
+        1,
+        INT64_MAX);
+
+    _context->conductor_cpu_affinity = getenv(AERON_CONDUCTOR_CPU_AFFINITY_ENV_VAR);
+
+    _context->sender_cpu_affinity = getenv(AERON_SENDER_CPU_AFFINITY_ENV_VAR);
+
+    _context->receiver_cpu_affinity = getenv(AERON_RECEIVER_CPU_AFFINITY_ENV_VAR);
+
+    _context->conductor_fifo_priority = aeron_config_parse_int32(
+        AERON_CONDUCTOR_FIFO_PRIORITY_ENV_VAR,
+        getenv(AERON_CONDUCTOR_FIFO_PRIORITY_ENV_VAR),
+        _context->conductor_fifo_priority,
+        0,
+        INT32_MAX);
+
+    _context->sender_fifo_priority = aeron_config_parse_int32(
+        AERON_SENDER_FIFO_PRIORITY_ENV_VAR,
+        getenv(AERON_SENDER_FIFO_PRIORITY_ENV_VAR),
+        _context->sender_fifo_priority,
+        0,
+        INT32_MAX);
+
+    _context->receiver_fifo_priority = aeron_config_parse_int32(
+        AERON_RECEIVER_FIFO_PRIORITY_ENV_VAR,
+        getenv(AERON_RECEIVER_FIFO_PRIORITY_ENV_VAR),
+        _context->receiver_fifo_priority,
+        0,
+        INT32_MAX);
+
     _context->to_driver_buffer = NULL;
     _context->to_clients_buffer = NULL;
     _context->counters_values_buffer = NULL;
     _context->counters_metadata_buffer = NULL;
+    _context->counters_compact_buffer = NULL;
     _context->error_buffer = NULL;
 
     _context->nano_clock = aeron_nano_clock;
     _context->epoch_clock = aeron_epoch_clock;
+
+    if (aeron_parse_bool(getenv(AERON_DRIVER_TSC_NANO_CLOCK_ENV_VAR), false) && aeron_tsc_clock_init() == 0)
+    {
+        _context->nano_clock = aeron_tsc_nano_clock;
+    }
+
     if (aeron_clock_cache_alloc(&_context->cached_clock) < 0)
     {
         return -1;
@@ -1032,6 +1528,7 @@ int aeron_driver_context_close(aeron_driver_context_t *context)
 
     aeron_unmap(&context->cnc_map);
     aeron_unmap(&context->loss_report);
+    aeron_unmap(&context->trace_file);
 
     aeron_free((void *)context->aeron_dir);
     aeron_free(context->conductor_idle_strategy_state);
@@ -1175,7 +1672,8 @@ size_t aeron_cnc_length(aeron_driver_context_t *context)
         context->to_clients_buffer_length +
         AERON_COUNTERS_METADATA_BUFFER_LENGTH(context->counters_values_buffer_length) +
         context->counters_values_buffer_length +
-        context->error_buffer_length,
+        context->error_buffer_length +
+        AERON_COUNTERS_COMPACT_BUFFER_LENGTH((size_t)context->counters_compact_capacity),
         context->file_page_size);
 }
 
@@ -1286,6 +1784,34 @@ size_t aeron_driver_context_get_to_clients_buffer_length(aeron_driver_context_t
     return NULL != context ? context->to_clients_buffer_length : AERON_TO_CLIENTS_BUFFER_LENGTH_DEFAULT;
 }
 
+int aeron_driver_context_set_client_directed_responses_enabled(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->client_directed_responses_enabled = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_client_directed_responses_enabled(aeron_driver_context_t *context)
+{
+    return NULL != context ?
+        context->client_directed_responses_enabled : AERON_CLIENT_DIRECTED_RESPONSES_ENABLED_DEFAULT;
+}
+
+int aeron_driver_context_set_client_directed_responses_buffer_length(aeron_driver_context_t *context, size_t length)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->client_directed_responses_buffer_length = length;
+    return 0;
+}
+
+size_t aeron_driver_context_get_client_directed_responses_buffer_length(aeron_driver_context_t *context)
+{
+    return NULL != context ?
+        context->client_directed_responses_buffer_length : AERON_CLIENT_DIRECTED_RESPONSES_BUFFER_LENGTH_DEFAULT;
+}
+
 int aeron_driver_context_set_counters_buffer_length(aeron_driver_context_t *context, size_t length)
 {
     AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
@@ -1299,6 +1825,19 @@ size_t aeron_driver_context_get_counters_buffer_length(aeron_driver_context_t *c
     return NULL != context ? context->counters_values_buffer_length : AERON_COUNTERS_VALUES_BUFFER_LENGTH_DEFAULT;
 }
 
+int aeron_driver_context_set_counters_compact_capacity(aeron_driver_context_t *context, int32_t capacity)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->counters_compact_capacity = capacity;
+    return 0;
+}
+
+int32_t aeron_driver_context_get_counters_compact_capacity(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->counters_compact_capacity : AERON_COUNTERS_COMPACT_CAPACITY_DEFAULT;
+}
+
 int aeron_driver_context_set_error_buffer_length(aeron_driver_context_t *context, size_t length)
 {
     AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
@@ -1364,222 +1903,780 @@ bool aeron_driver_context_get_term_buffer_sparse_file(aeron_driver_context_t *co
     return NULL != context ? context->term_buffer_sparse_file : AERON_TERM_BUFFER_SPARSE_FILE_DEFAULT;
 }
 
-int aeron_driver_context_set_perform_storage_checks(aeron_driver_context_t *context, bool value)
+int aeron_driver_context_set_term_buffer_huge_pages(aeron_driver_context_t *context, bool value)
 {
     AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
 
-    context->perform_storage_checks = value;
+    context->term_buffer_huge_pages = value;
     return 0;
 }
 
-bool aeron_driver_context_get_perform_storage_checks(aeron_driver_context_t *context)
+bool aeron_driver_context_get_term_buffer_huge_pages(aeron_driver_context_t *context)
 {
-    return NULL != context ? context->perform_storage_checks : AERON_PERFORM_STORAGE_CHECKS_DEFAULT;
+    return NULL != context ? context->term_buffer_huge_pages : AERON_TERM_BUFFER_HUGE_PAGES_DEFAULT;
 }
 
-int aeron_driver_context_set_spies_simulate_connection(aeron_driver_context_t *context, bool value)
+int aeron_driver_context_set_term_buffer_numa_node(aeron_driver_context_t *context, int32_t value)
 {
     AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
 
-    context->spies_simulate_connection = value;
+    if (value < AERON_NUMA_NODE_NONE || value >= AERON_NUMA_NODE_MAX)
+    {
+        aeron_set_err(EINVAL, "term buffer numa node must be >= -1 and < %d: %" PRId32, AERON_NUMA_NODE_MAX, value);
+        return -1;
+    }
+
+    context->term_buffer_numa_node = value;
     return 0;
 }
 
-bool aeron_driver_context_get_spies_simulate_connection(aeron_driver_context_t *context)
+int32_t aeron_driver_context_get_term_buffer_numa_node(aeron_driver_context_t *context)
 {
-    return NULL != context ? context->spies_simulate_connection : AERON_SPIES_SIMULATE_CONNECTION_DEFAULT;
+    return NULL != context ? context->term_buffer_numa_node : AERON_TERM_BUFFER_NUMA_NODE_DEFAULT;
 }
 
-int aeron_driver_context_set_file_page_size(aeron_driver_context_t *context, size_t value)
+int aeron_driver_context_set_cnc_numa_node(aeron_driver_context_t *context, int32_t value)
 {
     AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
 
-    context->file_page_size = value;
+    if (value < AERON_NUMA_NODE_NONE || value >= AERON_NUMA_NODE_MAX)
+    {
+        aeron_set_err(EINVAL, "CnC numa node must be >= -1 and < %d: %" PRId32, AERON_NUMA_NODE_MAX, value);
+        return -1;
+    }
+
+    context->cnc_numa_node = value;
     return 0;
 }
 
-size_t aeron_driver_context_get_file_page_size(aeron_driver_context_t *context)
+int32_t aeron_driver_context_get_cnc_numa_node(aeron_driver_context_t *context)
 {
-    return NULL != context ? context->file_page_size : AERON_FILE_PAGE_SIZE_DEFAULT;
+    return NULL != context ? context->cnc_numa_node : AERON_CNC_NUMA_NODE_DEFAULT;
 }
 
-int aeron_driver_context_set_mtu_length(aeron_driver_context_t *context, size_t value)
+int aeron_driver_context_set_term_buffer_pre_fault_async(aeron_driver_context_t *context, bool value)
 {
     AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
 
-    context->mtu_length = value;
+    context->term_buffer_pre_fault_async = value;
     return 0;
 }
 
-size_t aeron_driver_context_get_mtu_length(aeron_driver_context_t *context)
+bool aeron_driver_context_get_term_buffer_pre_fault_async(aeron_driver_context_t *context)
 {
-    return NULL != context ? context->mtu_length : AERON_MTU_LENGTH_DEFAULT;
+    return NULL != context ? context->term_buffer_pre_fault_async : AERON_TERM_BUFFER_PRE_FAULT_ASYNC_DEFAULT;
 }
 
-int aeron_driver_context_set_ipc_mtu_length(aeron_driver_context_t *context, size_t value)
+int aeron_driver_context_set_conductor_housekeeping_async(aeron_driver_context_t *context, bool value)
 {
     AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
 
-    context->ipc_mtu_length = value;
+    context->conductor_housekeeping_async = value;
     return 0;
 }
 
-size_t aeron_driver_context_get_ipc_mtu_length(aeron_driver_context_t *context)
+bool aeron_driver_context_get_conductor_housekeeping_async(aeron_driver_context_t *context)
 {
-    return NULL != context ? context->ipc_mtu_length : AERON_IPC_MTU_LENGTH_DEFAULT;
+    return NULL != context ? context->conductor_housekeeping_async : AERON_CONDUCTOR_HOUSEKEEPING_ASYNC_DEFAULT;
 }
 
-int aeron_driver_context_set_ipc_publication_term_window_length(aeron_driver_context_t *context, size_t value)
+int aeron_driver_context_set_log_buffer_pool_capacity(aeron_driver_context_t *context, size_t value)
 {
     AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
 
-    context->ipc_publication_window_length = value;
+    if (value > AERON_LOG_BUFFER_POOL_CAPACITY_MAX)
+    {
+        aeron_set_err(
+            EINVAL,
+            "log buffer pool capacity must be <= %d: %" PRIu64,
+            AERON_LOG_BUFFER_POOL_CAPACITY_MAX,
+            (uint64_t)value);
+        return -1;
+    }
+
+    context->log_buffer_pool_capacity = value;
     return 0;
 }
 
-size_t aeron_driver_context_get_ipc_publication_term_window_length(aeron_driver_context_t *context)
+size_t aeron_driver_context_get_log_buffer_pool_capacity(aeron_driver_context_t *context)
 {
-    return NULL != context ? context->ipc_publication_window_length : AERON_IPC_PUBLICATION_TERM_WINDOW_LENGTH_DEFAULT;
+    return NULL != context ? context->log_buffer_pool_capacity : AERON_LOG_BUFFER_POOL_CAPACITY_DEFAULT;
 }
 
-int aeron_driver_context_set_publication_term_window_length(aeron_driver_context_t *context, size_t value)
+int aeron_driver_context_set_log_buffer_pool_warm_restart(aeron_driver_context_t *context, bool value)
 {
     AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
 
-    context->publication_window_length = value;
+    context->log_buffer_pool_warm_restart = value;
     return 0;
 }
 
-size_t aeron_driver_context_get_publication_term_window_length(aeron_driver_context_t *context)
+bool aeron_driver_context_get_log_buffer_pool_warm_restart(aeron_driver_context_t *context)
 {
-    return NULL != context ? context->publication_window_length : AERON_PUBLICATION_TERM_WINDOW_LENGTH_DEFAULT;
+    return NULL != context ?
+        context->log_buffer_pool_warm_restart : AERON_LOG_BUFFER_POOL_WARM_RESTART_DEFAULT;
 }
 
-int aeron_driver_context_set_publication_linger_timeout_ns(aeron_driver_context_t *context, uint64_t value)
+int aeron_driver_context_set_log_buffer_memory_budget(aeron_driver_context_t *context, uint64_t value)
 {
     AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
 
-    context->publication_linger_timeout_ns = value;
+    context->log_buffer_memory_budget = value;
     return 0;
 }
 
-uint64_t aeron_driver_context_get_publication_linger_timeout_ns(aeron_driver_context_t *context)
+uint64_t aeron_driver_context_get_log_buffer_memory_budget(aeron_driver_context_t *context)
 {
-    return NULL != context ? context->publication_linger_timeout_ns : AERON_PUBLICATION_LINGER_TIMEOUT_NS_DEFAULT;
+    return NULL != context ? context->log_buffer_memory_budget : AERON_LOG_BUFFER_MEMORY_BUDGET_DEFAULT;
 }
 
-int aeron_driver_context_set_socket_so_rcvbuf(aeron_driver_context_t *context, size_t value)
+int aeron_driver_context_set_term_buffer_memfd(aeron_driver_context_t *context, bool value)
 {
     AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
 
-    context->socket_rcvbuf = value;
+    context->term_buffer_memfd = value;
     return 0;
 }
 
-size_t aeron_driver_context_get_socket_so_rcvbuf(aeron_driver_context_t *context)
+bool aeron_driver_context_get_term_buffer_memfd(aeron_driver_context_t *context)
 {
-    return NULL != context ? context->socket_rcvbuf : AERON_SOCKET_SO_RCVBUF_DEFAULT;
+    return NULL != context ? context->term_buffer_memfd : AERON_TERM_BUFFER_MEMFD_DEFAULT;
 }
 
-int aeron_driver_context_set_socket_so_sndbuf(aeron_driver_context_t *context, size_t value)
+int aeron_driver_context_set_log_buffer_socket(aeron_driver_context_t *context, const char *value)
 {
     AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
 
-    context->socket_sndbuf = value;
+    context->log_buffer_socket_path = value;
     return 0;
 }
 
-size_t aeron_driver_context_get_socket_so_sndbuf(aeron_driver_context_t *context)
+const char *aeron_driver_context_get_log_buffer_socket(aeron_driver_context_t *context)
 {
-    return NULL != context ? context->socket_sndbuf : AERON_SOCKET_SO_SNDBUF_DEFAULT;
+    return NULL != context ? context->log_buffer_socket_path : NULL;
 }
 
-int aeron_driver_context_set_socket_multicast_ttl(aeron_driver_context_t *context, uint8_t value)
+int aeron_driver_context_set_term_buffer_clean_mode(
+    aeron_driver_context_t *context, aeron_term_buffer_clean_mode_t mode)
 {
     AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
 
-    context->multicast_ttl = value;
+    context->term_buffer_clean_mode = mode;
     return 0;
 }
 
-uint8_t aeron_driver_context_get_socket_multicast_ttl(aeron_driver_context_t *context)
+aeron_term_buffer_clean_mode_t aeron_driver_context_get_term_buffer_clean_mode(aeron_driver_context_t *context)
 {
-    return NULL != context ? context->multicast_ttl : AERON_SOCKET_MULTICAST_TTL_DEFAULT;
+    return NULL != context ? context->term_buffer_clean_mode : AERON_TERM_BUFFER_CLEAN_MODE_DEFAULT;
 }
 
-int aeron_driver_context_set_send_to_status_poll_ratio(aeron_driver_context_t *context, size_t value)
+int aeron_driver_context_set_perform_storage_checks(aeron_driver_context_t *context, bool value)
 {
     AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
 
-    context->send_to_sm_poll_ratio = value;
+    context->perform_storage_checks = value;
     return 0;
 }
 
-size_t aeron_driver_context_get_send_to_status_poll_ratio(aeron_driver_context_t *context)
+bool aeron_driver_context_get_perform_storage_checks(aeron_driver_context_t *context)
 {
-    return NULL != context ? context->send_to_sm_poll_ratio : AERON_SEND_TO_STATUS_POLL_RATIO_DEFAULT;
+    return NULL != context ? context->perform_storage_checks : AERON_PERFORM_STORAGE_CHECKS_DEFAULT;
 }
 
-int aeron_driver_context_set_rcv_status_message_timeout_ns(aeron_driver_context_t *context, uint64_t value)
+int aeron_driver_context_set_spies_simulate_connection(aeron_driver_context_t *context, bool value)
 {
     AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
 
-    context->status_message_timeout_ns = value;
+    context->spies_simulate_connection = value;
     return 0;
 }
 
-uint64_t aeron_driver_context_get_rcv_status_message_timeout_ns(aeron_driver_context_t *context)
+bool aeron_driver_context_get_spies_simulate_connection(aeron_driver_context_t *context)
 {
-    return NULL != context ? context->status_message_timeout_ns : AERON_RCV_STATUS_MESSAGE_TIMEOUT_NS_DEFAULT;
+    return NULL != context ? context->spies_simulate_connection : AERON_SPIES_SIMULATE_CONNECTION_DEFAULT;
 }
 
-int aeron_driver_context_set_multicast_flowcontrol_supplier(
-    aeron_driver_context_t *context, aeron_flow_control_strategy_supplier_func_t value)
+int aeron_driver_context_set_network_short_circuit_enabled(aeron_driver_context_t *context, bool value)
 {
     AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
-    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, value);
 
-    context->multicast_flow_control_supplier_func = value;
+    context->network_short_circuit_enabled = value;
     return 0;
 }
 
-aeron_flow_control_strategy_supplier_func_t aeron_driver_context_get_multicast_flowcontrol_supplier(
-    aeron_driver_context_t *context)
+bool aeron_driver_context_get_network_short_circuit_enabled(aeron_driver_context_t *context)
 {
-    return NULL != context ?
-        context->multicast_flow_control_supplier_func :
-        aeron_flow_control_strategy_supplier_load(AERON_MULTICAST_FLOWCONTROL_SUPPLIER_DEFAULT);
+    return NULL != context ? context->network_short_circuit_enabled : AERON_NETWORK_SHORT_CIRCUIT_ENABLED_DEFAULT;
 }
 
-int aeron_driver_context_set_unicast_flowcontrol_supplier(
-    aeron_driver_context_t *context, aeron_flow_control_strategy_supplier_func_t value)
+int aeron_driver_context_set_file_page_size(aeron_driver_context_t *context, size_t value)
 {
     AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
-    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, value);
 
-    context->unicast_flow_control_supplier_func = value;
+    context->file_page_size = value;
     return 0;
 }
 
-aeron_flow_control_strategy_supplier_func_t aeron_driver_context_get_unicast_flowcontrol_supplier(
-    aeron_driver_context_t *context)
+size_t aeron_driver_context_get_file_page_size(aeron_driver_context_t *context)
 {
-    return NULL != context ?
-        context->unicast_flow_control_supplier_func :
-        aeron_flow_control_strategy_supplier_load(AERON_UNICAST_FLOWCONTROL_SUPPLIER_DEFAULT);
+    return NULL != context ? context->file_page_size : AERON_FILE_PAGE_SIZE_DEFAULT;
 }
 
-int aeron_driver_context_set_image_liveness_timeout_ns(aeron_driver_context_t *context, uint64_t value)
+int aeron_driver_context_set_mtu_length(aeron_driver_context_t *context, size_t value)
 {
     AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
 
-    context->image_liveness_timeout_ns = value;
+    context->mtu_length = value;
     return 0;
 }
 
-uint64_t aeron_driver_context_get_image_liveness_timeout_ns(aeron_driver_context_t *context)
+size_t aeron_driver_context_get_mtu_length(aeron_driver_context_t *context)
 {
-    return NULL != context ? context->image_liveness_timeout_ns : AERON_IMAGE_LIVENESS_TIMEOUT_NS_DEFAULT;
+    return NULL != context ? context->mtu_length : AERON_MTU_LENGTH_DEFAULT;
+}
+
+int aeron_driver_context_set_ipc_mtu_length(aeron_driver_context_t *context, size_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->ipc_mtu_length = value;
+    return 0;
+}
+
+size_t aeron_driver_context_get_ipc_mtu_length(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->ipc_mtu_length : AERON_IPC_MTU_LENGTH_DEFAULT;
+}
+
+int aeron_driver_context_set_ipc_publication_term_window_length(aeron_driver_context_t *context, size_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->ipc_publication_window_length = value;
+    return 0;
+}
+
+size_t aeron_driver_context_get_ipc_publication_term_window_length(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->ipc_publication_window_length : AERON_IPC_PUBLICATION_TERM_WINDOW_LENGTH_DEFAULT;
+}
+
+int aeron_driver_context_set_ipc_publication_eager_limit_enabled(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->ipc_publication_eager_limit_enabled = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_ipc_publication_eager_limit_enabled(aeron_driver_context_t *context)
+{
+    return NULL != context ?
+        context->ipc_publication_eager_limit_enabled : AERON_IPC_PUBLICATION_EAGER_LIMIT_ENABLED_DEFAULT;
+}
+
+int aeron_driver_context_set_publication_term_window_length(aeron_driver_context_t *context, size_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->publication_window_length = value;
+    return 0;
+}
+
+size_t aeron_driver_context_get_publication_term_window_length(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->publication_window_length : AERON_PUBLICATION_TERM_WINDOW_LENGTH_DEFAULT;
+}
+
+int aeron_driver_context_set_publication_linger_timeout_ns(aeron_driver_context_t *context, uint64_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->publication_linger_timeout_ns = value;
+    return 0;
+}
+
+uint64_t aeron_driver_context_get_publication_linger_timeout_ns(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->publication_linger_timeout_ns : AERON_PUBLICATION_LINGER_TIMEOUT_NS_DEFAULT;
+}
+
+int aeron_driver_context_set_socket_so_rcvbuf(aeron_driver_context_t *context, size_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->socket_rcvbuf = value;
+    return 0;
+}
+
+size_t aeron_driver_context_get_socket_so_rcvbuf(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->socket_rcvbuf : AERON_SOCKET_SO_RCVBUF_DEFAULT;
+}
+
+int aeron_driver_context_set_socket_so_sndbuf(aeron_driver_context_t *context, size_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->socket_sndbuf = value;
+    return 0;
+}
+
+size_t aeron_driver_context_get_socket_so_sndbuf(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->socket_sndbuf : AERON_SOCKET_SO_SNDBUF_DEFAULT;
+}
+
+int aeron_driver_context_set_socket_gso_enabled(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->socket_gso_enabled = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_socket_gso_enabled(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->socket_gso_enabled : AERON_SOCKET_GSO_ENABLED_DEFAULT;
+}
+
+int aeron_driver_context_set_socket_gro_enabled(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->socket_gro_enabled = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_socket_gro_enabled(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->socket_gro_enabled : AERON_SOCKET_GRO_ENABLED_DEFAULT;
+}
+
+int aeron_driver_context_set_socket_stream_filter_enabled(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->socket_stream_filter_enabled = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_socket_stream_filter_enabled(aeron_driver_context_t *context)
+{
+    return NULL != context ?
+        context->socket_stream_filter_enabled : AERON_SOCKET_STREAM_FILTER_ENABLED_DEFAULT;
+}
+
+int aeron_driver_context_set_socket_multicast_ttl(aeron_driver_context_t *context, uint8_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->multicast_ttl = value;
+    return 0;
+}
+
+uint8_t aeron_driver_context_get_socket_multicast_ttl(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->multicast_ttl : AERON_SOCKET_MULTICAST_TTL_DEFAULT;
+}
+
+int aeron_driver_context_set_socket_dscp(aeron_driver_context_t *context, uint8_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->socket_dscp = value;
+    return 0;
+}
+
+uint8_t aeron_driver_context_get_socket_dscp(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->socket_dscp : AERON_SOCKET_DSCP_DEFAULT;
+}
+
+int aeron_driver_context_set_send_to_status_poll_ratio(aeron_driver_context_t *context, size_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->send_to_sm_poll_ratio = value;
+    return 0;
+}
+
+size_t aeron_driver_context_get_send_to_status_poll_ratio(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->send_to_sm_poll_ratio : AERON_SEND_TO_STATUS_POLL_RATIO_DEFAULT;
+}
+
+int aeron_driver_context_set_network_publication_max_messages_per_send(aeron_driver_context_t *context, size_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->network_publication_max_messages_per_send = value;
+    return 0;
+}
+
+size_t aeron_driver_context_get_network_publication_max_messages_per_send(aeron_driver_context_t *context)
+{
+    return NULL != context ?
+        context->network_publication_max_messages_per_send : AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND_DEFAULT;
+}
+
+int aeron_driver_context_set_network_publication_send_coalescing(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->network_publication_send_coalescing = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_network_publication_send_coalescing(aeron_driver_context_t *context)
+{
+    return NULL != context ?
+        context->network_publication_send_coalescing : AERON_NETWORK_PUBLICATION_SEND_COALESCING_DEFAULT;
+}
+
+int aeron_driver_context_set_network_publication_heartbeat_backoff_enabled(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->network_publication_heartbeat_backoff_enabled = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_network_publication_heartbeat_backoff_enabled(aeron_driver_context_t *context)
+{
+    return NULL != context ?
+        context->network_publication_heartbeat_backoff_enabled :
+        AERON_NETWORK_PUBLICATION_HEARTBEAT_BACKOFF_ENABLED_DEFAULT;
+}
+
+int aeron_driver_context_set_receiver_io_vector_capacity(aeron_driver_context_t *context, size_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->receiver_io_vector_capacity = value;
+    return 0;
+}
+
+size_t aeron_driver_context_get_receiver_io_vector_capacity(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->receiver_io_vector_capacity : AERON_RECEIVER_IO_VECTOR_CAPACITY_DEFAULT;
+}
+
+int aeron_driver_context_set_sender_io_vector_capacity(aeron_driver_context_t *context, size_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->sender_io_vector_capacity = value;
+    return 0;
+}
+
+size_t aeron_driver_context_get_sender_io_vector_capacity(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->sender_io_vector_capacity : AERON_SENDER_IO_VECTOR_CAPACITY_DEFAULT;
+}
+
+int aeron_driver_context_set_receiver_shard_count(aeron_driver_context_t *context, size_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->receiver_shard_count = value;
+    return 0;
+}
+
+size_t aeron_driver_context_get_receiver_shard_count(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->receiver_shard_count : AERON_RECEIVER_SHARD_COUNT_DEFAULT;
+}
+
+int aeron_driver_context_set_sender_shard_count(aeron_driver_context_t *context, size_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->sender_shard_count = value;
+    return 0;
+}
+
+size_t aeron_driver_context_get_sender_shard_count(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->sender_shard_count : AERON_SENDER_SHARD_COUNT_DEFAULT;
+}
+
+int aeron_driver_context_set_socket_busy_poll_us(aeron_driver_context_t *context, uint32_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->socket_busy_poll_us = value;
+    return 0;
+}
+
+uint32_t aeron_driver_context_get_socket_busy_poll_us(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->socket_busy_poll_us : AERON_SOCKET_BUSY_POLL_US_DEFAULT;
+}
+
+int aeron_driver_context_set_socket_prefer_busy_poll(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->socket_prefer_busy_poll = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_socket_prefer_busy_poll(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->socket_prefer_busy_poll : AERON_SOCKET_PREFER_BUSY_POLL_DEFAULT;
+}
+
+int aeron_driver_context_set_socket_rx_timestamping_enabled(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->socket_rx_timestamping_enabled = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_socket_rx_timestamping_enabled(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->socket_rx_timestamping_enabled : AERON_SOCKET_RX_TIMESTAMPING_ENABLED_DEFAULT;
+}
+
+int aeron_driver_context_set_socket_buffer_auto_enabled(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->socket_buffer_auto_enabled = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_socket_buffer_auto_enabled(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->socket_buffer_auto_enabled : AERON_SOCKET_BUFFER_AUTO_ENABLED_DEFAULT;
+}
+
+int aeron_driver_context_set_pmtu_discovery_enabled(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->pmtu_discovery_enabled = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_pmtu_discovery_enabled(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->pmtu_discovery_enabled : AERON_PMTU_DISCOVERY_ENABLED_DEFAULT;
+}
+
+int aeron_driver_context_set_receiver_zero_copy_enabled(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->receiver_zero_copy_enabled = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_receiver_zero_copy_enabled(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->receiver_zero_copy_enabled : AERON_RECEIVER_ZERO_COPY_ENABLED_DEFAULT;
+}
+
+int aeron_driver_context_set_rcv_redundant_path_enabled(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->redundant_path_enabled = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_rcv_redundant_path_enabled(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->redundant_path_enabled : AERON_RCV_REDUNDANT_PATH_ENABLED_DEFAULT;
+}
+
+int aeron_driver_context_set_rcv_fast_join_enabled(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->fast_join_enabled = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_rcv_fast_join_enabled(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->fast_join_enabled : AERON_RCV_FAST_JOIN_ENABLED_DEFAULT;
+}
+
+int aeron_driver_context_set_stream_latency_counters_enabled(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->stream_latency_counters_enabled = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_stream_latency_counters_enabled(aeron_driver_context_t *context)
+{
+    return NULL != context ?
+        context->stream_latency_counters_enabled : AERON_STREAM_LATENCY_COUNTERS_ENABLED_DEFAULT;
+}
+
+int aeron_driver_context_set_stream_cpu_counters_enabled(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->stream_cpu_counters_enabled = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_stream_cpu_counters_enabled(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->stream_cpu_counters_enabled : AERON_STREAM_CPU_COUNTERS_ENABLED_DEFAULT;
+}
+
+int aeron_driver_context_set_udp_transport_poller_iteration_threshold(aeron_driver_context_t *context, size_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->udp_transport_poller_iteration_threshold = value;
+    return 0;
+}
+
+size_t aeron_driver_context_get_udp_transport_poller_iteration_threshold(aeron_driver_context_t *context)
+{
+    return NULL != context ?
+        context->udp_transport_poller_iteration_threshold : AERON_UDP_TRANSPORT_POLLER_ITERATION_THRESHOLD_DEFAULT;
+}
+
+int aeron_driver_context_set_rcv_status_message_timeout_ns(aeron_driver_context_t *context, uint64_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->status_message_timeout_ns = value;
+    return 0;
+}
+
+uint64_t aeron_driver_context_get_rcv_status_message_timeout_ns(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->status_message_timeout_ns : AERON_RCV_STATUS_MESSAGE_TIMEOUT_NS_DEFAULT;
+}
+
+int aeron_driver_context_set_rcv_status_message_batching(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->status_message_batching = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_rcv_status_message_batching(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->status_message_batching : AERON_RCV_STATUS_MESSAGE_BATCHING_DEFAULT;
+}
+
+int aeron_driver_context_set_rcv_status_message_packing(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->status_message_packing = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_rcv_status_message_packing(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->status_message_packing : AERON_RCV_STATUS_MESSAGE_PACKING_DEFAULT;
+}
+
+int aeron_driver_context_set_rcv_control_message_batching(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->control_message_batching = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_rcv_control_message_batching(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->control_message_batching : AERON_RCV_CONTROL_MESSAGE_BATCHING_DEFAULT;
+}
+
+int aeron_driver_context_set_rcv_status_message_adaptive(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->status_message_adaptive = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_rcv_status_message_adaptive(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->status_message_adaptive : AERON_RCV_STATUS_MESSAGE_ADAPTIVE_DEFAULT;
+}
+
+int aeron_driver_context_set_rcv_image_rate_limit(aeron_driver_context_t *context, uint64_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    if (value > AERON_RCV_IMAGE_RATE_LIMIT_MAX)
+    {
+        aeron_set_err(EINVAL, "image rate limit must be <= %" PRIu64, (uint64_t)AERON_RCV_IMAGE_RATE_LIMIT_MAX);
+        return -1;
+    }
+
+    context->image_rate_limit = value;
+    return 0;
+}
+
+uint64_t aeron_driver_context_get_rcv_image_rate_limit(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->image_rate_limit : AERON_RCV_IMAGE_RATE_LIMIT_DEFAULT;
+}
+
+int aeron_driver_context_set_multicast_flowcontrol_supplier(
+    aeron_driver_context_t *context, aeron_flow_control_strategy_supplier_func_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, value);
+
+    context->multicast_flow_control_supplier_func = value;
+    return 0;
+}
+
+aeron_flow_control_strategy_supplier_func_t aeron_driver_context_get_multicast_flowcontrol_supplier(
+    aeron_driver_context_t *context)
+{
+    return NULL != context ?
+        context->multicast_flow_control_supplier_func :
+        aeron_flow_control_strategy_supplier_load(AERON_MULTICAST_FLOWCONTROL_SUPPLIER_DEFAULT);
+}
+
+int aeron_driver_context_set_unicast_flowcontrol_supplier(
+    aeron_driver_context_t *context, aeron_flow_control_strategy_supplier_func_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, value);
+
+    context->unicast_flow_control_supplier_func = value;
+    return 0;
+}
+
+aeron_flow_control_strategy_supplier_func_t aeron_driver_context_get_unicast_flowcontrol_supplier(
+    aeron_driver_context_t *context)
+{
+    return NULL != context ?
+        context->unicast_flow_control_supplier_func :
+        aeron_flow_control_strategy_supplier_load(AERON_UNICAST_FLOWCONTROL_SUPPLIER_DEFAULT);
+}
+
+int aeron_driver_context_set_image_liveness_timeout_ns(aeron_driver_context_t *context, uint64_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->image_liveness_timeout_ns = value;
+    return 0;
+}
+
+uint64_t aeron_driver_context_get_image_liveness_timeout_ns(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->image_liveness_timeout_ns : AERON_IMAGE_LIVENESS_TIMEOUT_NS_DEFAULT;
 }
 
 int aeron_driver_context_set_rcv_initial_window_length(aeron_driver_context_t *context, size_t value)
@@ -1608,21 +2705,34 @@ int aeron_driver_context_set_congestioncontrol_supplier(
 aeron_congestion_control_strategy_supplier_func_t aeron_driver_context_get_congestioncontrol_supplier(
     aeron_driver_context_t *context)
 {
-    return NULL != context ? context->congestion_control_supplier_func :
-    aeron_congestion_control_strategy_supplier_load(AERON_CONGESTIONCONTROL_SUPPLIER_DEFAULT);
+    return NULL != context ? context->congestion_control_supplier_func :
+    aeron_congestion_control_strategy_supplier_load(AERON_CONGESTIONCONTROL_SUPPLIER_DEFAULT);
+}
+
+int aeron_driver_context_set_loss_report_buffer_length(aeron_driver_context_t *context, size_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->loss_report_length = value;
+    return 0;
+}
+
+size_t aeron_driver_context_get_loss_report_buffer_length(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->loss_report_length : AERON_LOSS_REPORT_BUFFER_LENGTH_DEFAULT;
 }
 
-int aeron_driver_context_set_loss_report_buffer_length(aeron_driver_context_t *context, size_t value)
+int aeron_driver_context_set_trace_ring_capacity(aeron_driver_context_t *context, size_t value)
 {
     AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
 
-    context->loss_report_length = value;
+    context->trace_ring_capacity = value;
     return 0;
 }
 
-size_t aeron_driver_context_get_loss_report_buffer_length(aeron_driver_context_t *context)
+size_t aeron_driver_context_get_trace_ring_capacity(aeron_driver_context_t *context)
 {
-    return NULL != context ? context->loss_report_length : AERON_LOSS_REPORT_BUFFER_LENGTH_DEFAULT;
+    return NULL != context ? context->trace_ring_capacity : AERON_TRACE_RING_CAPACITY_DEFAULT;
 }
 
 int aeron_driver_context_set_publication_unblock_timeout_ns(aeron_driver_context_t *context, uint64_t value)
@@ -1665,6 +2775,19 @@ uint64_t aeron_driver_context_get_timer_interval_ns(aeron_driver_context_t *cont
     return NULL != context ? context->timer_interval_ns : AERON_TIMER_INTERVAL_NS_DEFAULT;
 }
 
+int aeron_driver_context_set_shared_conductor_budget_ns(aeron_driver_context_t *context, uint64_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->shared_conductor_budget_ns = value;
+    return 0;
+}
+
+uint64_t aeron_driver_context_get_shared_conductor_budget_ns(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->shared_conductor_budget_ns : AERON_SHARED_CONDUCTOR_BUDGET_NS_DEFAULT;
+}
+
 int aeron_driver_context_set_sender_idle_strategy(aeron_driver_context_t *context, const char *value)
 {
     AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
@@ -1946,6 +3069,48 @@ int32_t aeron_driver_context_get_flow_control_group_min_size(aeron_driver_contex
         AERON_FLOW_CONTROL_GROUP_MIN_SIZE_DEFAULT;
 }
 
+int aeron_driver_context_set_cubic_congestion_control_measure_rtt(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->cubic_congestion_control.measure_rtt = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_cubic_congestion_control_measure_rtt(aeron_driver_context_t *context)
+{
+    return NULL != context ?
+        context->cubic_congestion_control.measure_rtt : AERON_CUBICCONGESTIONCONTROL_MEASURERTT_DEFAULT;
+}
+
+int aeron_driver_context_set_cubic_congestion_control_initial_rtt_ns(aeron_driver_context_t *context, uint64_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->cubic_congestion_control.initial_rtt_ns = value;
+    return 0;
+}
+
+uint64_t aeron_driver_context_get_cubic_congestion_control_initial_rtt_ns(aeron_driver_context_t *context)
+{
+    return NULL != context ?
+        context->cubic_congestion_control.initial_rtt_ns : AERON_CUBICCONGESTIONCONTROL_INITIALRTT_NS_DEFAULT;
+}
+
+int aeron_driver_context_set_cubic_congestion_control_tcp_mode(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->cubic_congestion_control.tcp_mode = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_cubic_congestion_control_tcp_mode(aeron_driver_context_t *context)
+{
+    return NULL != context ?
+        context->cubic_congestion_control.tcp_mode : AERON_CUBICCONGESTIONCONTROL_TCPMODE_DEFAULT;
+}
+
 int aeron_driver_context_set_receiver_group_tag(aeron_driver_context_t *context, bool is_present, int64_t value)
 {
     AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
@@ -2111,6 +3276,68 @@ uint64_t aeron_driver_context_get_retransmit_unicast_linger_ns(aeron_driver_cont
     return NULL != context ? context->retransmit_unicast_linger_ns : AERON_RETRANSMIT_UNICAST_LINGER_NS_DEFAULT;
 }
 
+int aeron_driver_context_set_retransmit_budget_rate(aeron_driver_context_t *context, uint64_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    if (value > AERON_RETRANSMIT_BUDGET_MAX_RATE)
+    {
+        aeron_set_err(EINVAL, "retransmit budget rate must be <= %" PRIu64, (uint64_t)AERON_RETRANSMIT_BUDGET_MAX_RATE);
+        return -1;
+    }
+
+    context->retransmit_budget_rate = value;
+    return 0;
+}
+
+uint64_t aeron_driver_context_get_retransmit_budget_rate(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->retransmit_budget_rate : AERON_RETRANSMIT_BUDGET_RATE_DEFAULT;
+}
+
+int aeron_driver_context_set_sender_retransmit_budget_rate(aeron_driver_context_t *context, uint64_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    if (value > AERON_RETRANSMIT_BUDGET_MAX_RATE)
+    {
+        aeron_set_err(
+            EINVAL, "sender retransmit budget rate must be <= %" PRIu64, (uint64_t)AERON_RETRANSMIT_BUDGET_MAX_RATE);
+        return -1;
+    }
+
+    context->sender_retransmit_budget_rate = value;
+    return 0;
+}
+
+uint64_t aeron_driver_context_get_sender_retransmit_budget_rate(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->sender_retransmit_budget_rate : AERON_SENDER_RETRANSMIT_BUDGET_RATE_DEFAULT;
+}
+
+int aeron_driver_context_set_retransmit_unicast_repair_threshold(aeron_driver_context_t *context, size_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    if (value > AERON_RETRANSMIT_HANDLER_MAX_UNICAST_REPAIR_ADDRS)
+    {
+        aeron_set_err(
+            EINVAL,
+            "retransmit unicast repair threshold must be <= %d",
+            AERON_RETRANSMIT_HANDLER_MAX_UNICAST_REPAIR_ADDRS);
+        return -1;
+    }
+
+    context->retransmit_unicast_repair_threshold = value;
+    return 0;
+}
+
+size_t aeron_driver_context_get_retransmit_unicast_repair_threshold(aeron_driver_context_t *context)
+{
+    return NULL != context ?
+        context->retransmit_unicast_repair_threshold : AERON_RETRANSMIT_UNICAST_REPAIR_THRESHOLD_DEFAULT;
+}
+
 int aeron_driver_context_set_nak_multicast_group_size(aeron_driver_context_t *context, size_t value)
 {
     AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
@@ -2124,6 +3351,32 @@ size_t aeron_driver_context_get_nak_multicast_group_size(aeron_driver_context_t
     return NULL != context ? context->nak_multicast_group_size : AERON_NAK_MULTICAST_GROUP_SIZE_DEFAULT;
 }
 
+int aeron_driver_context_set_nak_max_gaps(aeron_driver_context_t *context, size_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->nak_max_gaps = value;
+    return 0;
+}
+
+size_t aeron_driver_context_get_nak_max_gaps(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->nak_max_gaps : AERON_NAK_MAX_GAPS_DEFAULT;
+}
+
+int aeron_driver_context_set_nak_rtt_adaptive(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->nak_rtt_adaptive = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_nak_rtt_adaptive(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->nak_rtt_adaptive : AERON_NAK_RTT_ADAPTIVE_DEFAULT;
+}
+
 int aeron_driver_context_set_nak_multicast_max_backoff_ns(aeron_driver_context_t *context, uint64_t value)
 {
     AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
@@ -2321,6 +3574,72 @@ const char *aeron_driver_context_get_name_resolver_init_args(aeron_driver_contex
     return NULL != context ? context->name_resolver_init_args : NULL;
 }
 
+int aeron_driver_context_set_metrics_http_endpoint(aeron_driver_context_t *context, const char *value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->metrics_http_endpoint = value;
+    return 0;
+}
+
+const char *aeron_driver_context_get_metrics_http_endpoint(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->metrics_http_endpoint : NULL;
+}
+
+int aeron_driver_context_set_recorder_channel(aeron_driver_context_t *context, const char *value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->recorder_channel = value;
+    return 0;
+}
+
+const char *aeron_driver_context_get_recorder_channel(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->recorder_channel : NULL;
+}
+
+int aeron_driver_context_set_recorder_stream_id(aeron_driver_context_t *context, int32_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->recorder_stream_id = value;
+    return 0;
+}
+
+int32_t aeron_driver_context_get_recorder_stream_id(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->recorder_stream_id : AERON_DRIVER_RECORDER_STREAM_ID_DEFAULT;
+}
+
+int aeron_driver_context_set_recorder_dir(aeron_driver_context_t *context, const char *value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, value);
+
+    context->recorder_dir = value;
+    return 0;
+}
+
+const char *aeron_driver_context_get_recorder_dir(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->recorder_dir : AERON_DRIVER_RECORDER_DIR_DEFAULT;
+}
+
+int aeron_driver_context_set_recorder_segment_length(aeron_driver_context_t *context, size_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->recorder_segment_length = value;
+    return 0;
+}
+
+size_t aeron_driver_context_get_recorder_segment_length(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->recorder_segment_length : AERON_DRIVER_RECORDER_SEGMENT_LENGTH_DEFAULT;
+}
+
 int aeron_driver_context_set_re_resolution_check_interval_ns(aeron_driver_context_t *context, uint64_t value)
 {
     AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
@@ -2334,3 +3653,152 @@ uint64_t aeron_driver_context_get_re_resolution_check_interval_ns(aeron_driver_c
     return NULL != context ?
         context->re_resolution_check_interval_ns : AERON_DRIVER_RERESOLUTION_CHECK_INTERVAL_NS_DEFAULT;
 }
+
+int aeron_driver_context_set_re_resolution_async(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->re_resolution_async = value;
+    return 0;
+}
+
+bool aeron_driver_context_get_re_resolution_async(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->re_resolution_async : AERON_DRIVER_RERESOLUTION_ASYNC_DEFAULT;
+}
+
+int aeron_driver_context_set_conductor_cycle_threshold_ns(aeron_driver_context_t *context, uint64_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->conductor_cycle_threshold_ns = value;
+    return 0;
+}
+
+uint64_t aeron_driver_context_get_conductor_cycle_threshold_ns(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->conductor_cycle_threshold_ns : AERON_DRIVER_CONDUCTOR_CYCLE_THRESHOLD_NS_DEFAULT;
+}
+
+int aeron_driver_context_set_sender_cycle_threshold_ns(aeron_driver_context_t *context, uint64_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->sender_cycle_threshold_ns = value;
+    return 0;
+}
+
+uint64_t aeron_driver_context_get_sender_cycle_threshold_ns(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->sender_cycle_threshold_ns : AERON_DRIVER_SENDER_CYCLE_THRESHOLD_NS_DEFAULT;
+}
+
+int aeron_driver_context_set_receiver_cycle_threshold_ns(aeron_driver_context_t *context, uint64_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->receiver_cycle_threshold_ns = value;
+    return 0;
+}
+
+uint64_t aeron_driver_context_get_receiver_cycle_threshold_ns(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->receiver_cycle_threshold_ns : AERON_DRIVER_RECEIVER_CYCLE_THRESHOLD_NS_DEFAULT;
+}
+
+int aeron_driver_context_set_conductor_cpu_affinity(aeron_driver_context_t *context, const char *value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->conductor_cpu_affinity = value;
+    return 0;
+}
+
+const char *aeron_driver_context_get_conductor_cpu_affinity(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->conductor_cpu_affinity : NULL;
+}
+
+int aeron_driver_context_set_sender_cpu_affinity(aeron_driver_context_t *context, const char *value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->sender_cpu_affinity = value;
+    return 0;
+}
+
+const char *aeron_driver_context_get_sender_cpu_affinity(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->sender_cpu_affinity : NULL;
+}
+
+int aeron_driver_context_set_receiver_cpu_affinity(aeron_driver_context_t *context, const char *value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->receiver_cpu_affinity = value;
+    return 0;
+}
+
+const char *aeron_driver_context_get_receiver_cpu_affinity(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->receiver_cpu_affinity : NULL;
+}
+
+int aeron_driver_context_set_conductor_fifo_priority(aeron_driver_context_t *context, int32_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->conductor_fifo_priority = value;
+    return 0;
+}
+
+int32_t aeron_driver_context_get_conductor_fifo_priority(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->conductor_fifo_priority : AERON_AGENT_FIFO_PRIORITY_DEFAULT;
+}
+
+int aeron_driver_context_set_sender_fifo_priority(aeron_driver_context_t *context, int32_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->sender_fifo_priority = value;
+    return 0;
+}
+
+int32_t aeron_driver_context_get_sender_fifo_priority(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->sender_fifo_priority : AERON_AGENT_FIFO_PRIORITY_DEFAULT;
+}
+
+int aeron_driver_context_set_receiver_fifo_priority(aeron_driver_context_t *context, int32_t value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    context->receiver_fifo_priority = value;
+    return 0;
+}
+
+int32_t aeron_driver_context_get_receiver_fifo_priority(aeron_driver_context_t *context)
+{
+    return NULL != context ? context->receiver_fifo_priority : AERON_AGENT_FIFO_PRIORITY_DEFAULT;
+}
+
+int aeron_driver_context_set_use_tsc_nano_clock(aeron_driver_context_t *context, bool value)
+{
+    AERON_DRIVER_CONTEXT_SET_CHECK_ARG_AND_RETURN(-1, context);
+
+    if (value && aeron_tsc_clock_init() < 0)
+    {
+        aeron_set_err(ENOTSUP, "%s", "cpu has no invariant TSC");
+        return -1;
+    }
+
+    context->nano_clock = value ? aeron_tsc_nano_clock : aeron_nano_clock;
+    return 0;
+}
+
+bool aeron_driver_context_get_use_tsc_nano_clock(aeron_driver_context_t *context)
+{
+    return NULL != context && aeron_tsc_nano_clock == context->nano_clock;
+}
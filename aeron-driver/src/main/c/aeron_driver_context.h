@@ -36,12 +36,14 @@
 
 #define AERON_COMMAND_QUEUE_CAPACITY (256)
 
-#define AERON_DRIVER_SENDER_NUM_RECV_BUFFERS (2)
+#define AERON_DRIVER_SENDER_IO_VECTOR_CAPACITY_MAX (256)
+#define AERON_DRIVER_SENDER_SHARD_COUNT_MAX (16)
 
-#define AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND (2)
+#define AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND_MAX (64)
 
-#define AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS (2)
+#define AERON_DRIVER_RECEIVER_IO_VECTOR_CAPACITY_MAX (256)
 #define AERON_DRIVER_RECEIVER_MAX_UDP_PACKET_LENGTH (64 * 1024)
+#define AERON_DRIVER_RECEIVER_SHARD_COUNT_MAX (16)
 
 typedef struct aeron_driver_conductor_stct aeron_driver_conductor_t;
 
@@ -49,6 +51,10 @@ typedef struct aeron_driver_conductor_proxy_stct aeron_driver_conductor_proxy_t;
 typedef struct aeron_driver_sender_proxy_stct aeron_driver_sender_proxy_t;
 typedef struct aeron_driver_receiver_proxy_stct aeron_driver_receiver_proxy_t;
 typedef struct aeron_dl_loaded_libs_state_stct aeron_dl_loaded_libs_state_t;
+typedef struct aeron_log_buffer_pre_faulter_stct aeron_log_buffer_pre_faulter_t;
+typedef struct aeron_driver_housekeeper_stct aeron_driver_housekeeper_t;
+typedef struct aeron_async_name_resolver_stct aeron_async_name_resolver_t;
+typedef struct aeron_log_buffer_pool_stct aeron_log_buffer_pool_t;
 
 typedef aeron_rb_handler_t aeron_driver_conductor_to_driver_interceptor_func_t;
 typedef void (*aeron_driver_conductor_to_client_interceptor_func_t)(
@@ -72,12 +78,38 @@ typedef struct aeron_driver_context_stct
     bool dirs_delete_on_shutdown;                           /* aeron.dir.delete.on.shutdown = false */
     bool warn_if_dirs_exist;                                /* aeron.dir.warn.if.exists = false */
     bool term_buffer_sparse_file;                           /* aeron.term.buffer.sparse.file = false */
+    bool term_buffer_huge_pages;                            /* aeron.term.buffer.huge.pages = false */
+    int32_t term_buffer_numa_node;                          /* aeron.term.buffer.numa.node = -1 */
+    int32_t cnc_numa_node;                                  /* aeron.cnc.numa.node = -1 */
+    bool term_buffer_pre_fault_async;                       /* aeron.term.buffer.pre.fault.async = false */
+    bool conductor_housekeeping_async;                      /* aeron.conductor.housekeeping.async = false */
+    size_t log_buffer_pool_capacity;                        /* aeron.log.buffer.pool.capacity = 0 */
+    bool log_buffer_pool_warm_restart;                      /* aeron.log.buffer.pool.warm.restart = false */
+    uint64_t log_buffer_memory_budget;                      /* aeron.log.buffer.memory.budget = 0 */
+    bool term_buffer_memfd;                                 /* aeron.term.buffer.memfd = false */
+    const char *log_buffer_socket_path;                     /* aeron.log.buffer.socket = NULL */
+    aeron_term_buffer_clean_mode_t term_buffer_clean_mode;  /* aeron.term.buffer.clean.mode = MEMSET */
     bool perform_storage_checks;                            /* aeron.perform.storage.checks = true */
     bool spies_simulate_connection;                         /* aeron.spies.simulate.connection = false */
+    bool network_short_circuit_enabled;                     /* aeron.network.short.circuit.enabled = false */
+    bool client_directed_responses_enabled;                 /* aeron.client.directed.responses.enabled = false */
     bool print_configuration_on_start;                      /* aeron.print.configuration = false */
     bool reliable_stream;                                   /* aeron.reliable.stream = true */
     bool tether_subscriptions;                              /* aeron.tether.subscriptions = true */
     bool rejoin_stream;                                     /* aeron.rejoin.stream = true */
+    bool socket_gso_enabled;                                /* aeron.socket.gso.enabled = false */
+    bool socket_gro_enabled;                                /* aeron.socket.gro.enabled = false */
+    bool socket_stream_filter_enabled;                      /* aeron.socket.stream.filter.enabled = false */
+    bool socket_prefer_busy_poll;                           /* aeron.socket.prefer.busy.poll = false */
+    bool socket_rx_timestamping_enabled;                    /* aeron.socket.rx.timestamping.enabled = false */
+    bool socket_buffer_auto_enabled;                        /* aeron.socket.buffer.auto.enabled = false */
+    bool pmtu_discovery_enabled;                            /* aeron.pmtu.discovery.enabled = false */
+    bool receiver_zero_copy_enabled;                        /* aeron.receiver.zero.copy.enabled = false */
+    bool redundant_path_enabled;                            /* aeron.rcv.redundant.path.enabled = false */
+    bool fast_join_enabled;                                 /* aeron.rcv.fast.join.enabled = false */
+    bool stream_latency_counters_enabled;                   /* aeron.stream.latency.counters.enabled = false */
+    bool stream_cpu_counters_enabled;                       /* aeron.stream.cpu.counters.enabled = false */
+    bool ipc_publication_eager_limit_enabled;               /* aeron.ipc.publication.eager.limit.enabled = false */
     bool ats_enabled;
     uint64_t driver_timeout_ms;                             /* aeron.driver.timeout = 10s */
     uint64_t client_liveness_timeout_ns;                    /* aeron.client.liveness.timeout = 5s */
@@ -87,17 +119,33 @@ typedef struct aeron_driver_context_stct
     uint64_t publication_unblock_timeout_ns;                /* aeron.publication.unblock.timeout = 10s */
     uint64_t publication_connection_timeout_ns;             /* aeron.publication.connection.timeout = 5s */
     uint64_t timer_interval_ns;                             /* aeron.timer.interval = 1s */
+    uint64_t shared_conductor_budget_ns;                    /* aeron.shared.conductor.budget = 0 */
     uint64_t counter_free_to_reuse_ns;                      /* aeron.counters.free.to.reuse.timeout = 1s */
     uint64_t untethered_window_limit_timeout_ns;            /* aeron.untethered.window.limit.timeout = 5s */
     uint64_t untethered_resting_timeout_ns;                 /* aeron.untethered.resting.timeout = 10s */
     uint64_t retransmit_unicast_delay_ns;                   /* aeron.retransmit.unicast.delay = 0 */
     uint64_t retransmit_unicast_linger_ns;                  /* aeron.retransmit.unicast.linger = 60ms */
+    uint64_t retransmit_budget_rate;                        /* aeron.retransmit.budget.rate = 0 */
+    uint64_t sender_retransmit_budget_rate;                 /* aeron.sender.retransmit.budget.rate = 0 */
+    size_t retransmit_unicast_repair_threshold;             /* aeron.retransmit.unicast.repair.threshold = 0 */
     uint64_t nak_unicast_delay_ns;                          /* aeron.nak.unicast.delay = 60ms */
     uint64_t nak_multicast_max_backoff_ns;                  /* aeron.nak.multicast.max.backoff = 60ms */
     uint64_t re_resolution_check_interval_ns;               /* aeron.driver.reresolution.check.interval = 1s */
+    bool re_resolution_async;                               /* aeron.driver.reresolution.async = false */
+    uint64_t conductor_cycle_threshold_ns;                  /* aeron.driver.conductor.cycle.threshold = 1s */
+    uint64_t sender_cycle_threshold_ns;                     /* aeron.driver.sender.cycle.threshold = 1s */
+    uint64_t receiver_cycle_threshold_ns;                   /* aeron.driver.receiver.cycle.threshold = 1s */
+    const char *conductor_cpu_affinity;                     /* aeron.conductor.cpu.affinity = NULL */
+    const char *sender_cpu_affinity;                        /* aeron.sender.cpu.affinity = NULL */
+    const char *receiver_cpu_affinity;                      /* aeron.receiver.cpu.affinity = NULL */
+    int32_t conductor_fifo_priority;                        /* aeron.conductor.fifo.priority = 0 */
+    int32_t sender_fifo_priority;                           /* aeron.sender.fifo.priority = 0 */
+    int32_t receiver_fifo_priority;                         /* aeron.receiver.fifo.priority = 0 */
     size_t to_driver_buffer_length;                         /* aeron.conductor.buffer.length = 1MB + trailer*/
     size_t to_clients_buffer_length;                        /* aeron.clients.buffer.length = 1MB + trailer */
+    size_t client_directed_responses_buffer_length;         /* aeron.client.directed.responses.buffer.length = 256KB */
     size_t counters_values_buffer_length;                   /* aeron.counters.buffer.length = 1MB */
+    int32_t counters_compact_capacity;                      /* aeron.counters.compact.capacity = 0 */
     size_t error_buffer_length;                             /* aeron.error.buffer.length = 1MB */
     size_t term_buffer_length;                              /* aeron.term.buffer.length = 16MB */
     size_t ipc_term_buffer_length;                          /* aeron.ipc.term.buffer.length = 64MB */
@@ -108,13 +156,31 @@ typedef struct aeron_driver_context_stct
     size_t socket_rcvbuf;                                   /* aeron.socket.so_rcvbuf = 128 * 1024 */
     size_t socket_sndbuf;                                   /* aeron.socket.so_sndbuf = 0 */
     size_t send_to_sm_poll_ratio;                           /* aeron.send.to.status.poll.ratio = 4 */
+    size_t network_publication_max_messages_per_send;      /* aeron.network.publication.max.messages.per.send = 2 */
+    bool network_publication_heartbeat_backoff_enabled;     /* aeron.network.publication.heartbeat.backoff.enabled = false */
+    bool network_publication_send_coalescing;               /* aeron.network.publication.send.coalescing = false */
+    size_t receiver_io_vector_capacity;                     /* aeron.receiver.io.vector.capacity = 2 */
+    size_t sender_io_vector_capacity;                       /* aeron.sender.io.vector.capacity = 2 */
+    size_t receiver_shard_count;                            /* aeron.receiver.shard.count = 1 */
+    size_t sender_shard_count;                              /* aeron.sender.shard.count = 1 */
+    size_t udp_transport_poller_iteration_threshold;        /* aeron.udp.transport.poller.iteration.threshold = 5 */
     size_t initial_window_length;                           /* aeron.rcv.initial.window.length = 128KB */
     size_t loss_report_length;                              /* aeron.loss.report.buffer.length = 1MB */
+    size_t trace_ring_capacity;                             /* aeron.trace.ring.capacity = 0 */
     size_t file_page_size;                                  /* aeron.file.page.size = 4KB */
     size_t nak_multicast_group_size;                        /* aeron.nak.multicast.group.size = 10 */
+    size_t nak_max_gaps;                                    /* aeron.nak.max.gaps = 1 */
+    bool nak_rtt_adaptive;                                  /* aeron.nak.rtt.adaptive = false */
+    bool status_message_batching;                           /* aeron.rcv.status.message.batching = false */
+    bool status_message_packing;                            /* aeron.rcv.status.message.packing = false */
+    bool control_message_batching;                          /* aeron.rcv.control.message.batching = false */
+    bool status_message_adaptive;                           /* aeron.rcv.status.message.adaptive = false */
+    uint64_t image_rate_limit;                              /* aeron.rcv.image.rate.limit = 0 */
     int32_t publication_reserved_session_id_low;            /* aeron.publication.reserved.session.id.low = -1 */
     int32_t publication_reserved_session_id_high;           /* aeron.publication.reserved.session.id.high = 10000 */
     uint8_t multicast_ttl;                                  /* aeron.socket.multicast.ttl = 0 */
+    uint8_t socket_dscp;                                    /* aeron.socket.dscp = 0 */
+    uint32_t socket_busy_poll_us;                           /* aeron.socket.busy.poll.us = 0 */
 
     struct                                                  /* aeron.receiver.receiver.tag = <unset> */
     {
@@ -129,14 +195,23 @@ typedef struct aeron_driver_context_stct
         int64_t group_tag;                                  /* aeron.flow.control.gtag = -1 */
     }
     flow_control;
+    struct
+    {
+        bool measure_rtt;                                   /* aeron.CubicCongestionControl.measureRtt = false */
+        uint64_t initial_rtt_ns;                            /* aeron.CubicCongestionControl.initialRtt = 100us */
+        bool tcp_mode;                                      /* aeron.CubicCongestionControl.tcpMode = false */
+    }
+    cubic_congestion_control;
 
     aeron_mapped_file_t cnc_map;
     aeron_mapped_file_t loss_report;
+    aeron_mapped_file_t trace_file;
 
     uint8_t *to_driver_buffer;
     uint8_t *to_clients_buffer;
     uint8_t *counters_values_buffer;
     uint8_t *counters_metadata_buffer;
+    uint8_t *counters_compact_buffer;
     uint8_t *error_buffer;
 
     aeron_clock_func_t nano_clock;
@@ -186,7 +261,15 @@ typedef struct aeron_driver_context_stct
 
     aeron_driver_conductor_proxy_t *conductor_proxy;
     aeron_driver_sender_proxy_t *sender_proxy;
+    aeron_log_buffer_pre_faulter_t *log_buffer_pre_faulter;
+    aeron_driver_housekeeper_t *housekeeper;
+    aeron_async_name_resolver_t *async_name_resolver;
+    aeron_log_buffer_pool_t *log_buffer_pool;
+    aeron_driver_sender_proxy_t **sender_shard_proxies;
+    size_t sender_shard_proxies_length;
     aeron_driver_receiver_proxy_t *receiver_proxy;
+    aeron_driver_receiver_proxy_t **receiver_shard_proxies;
+    size_t receiver_shard_proxies_length;
 
     aeron_counters_manager_t *counters_manager;
     aeron_system_counters_t *system_counters;
@@ -217,6 +300,11 @@ typedef struct aeron_driver_context_stct
     const char *resolver_bootstrap_neighbor;
     aeron_name_resolver_supplier_func_t name_resolver_supplier_func;
     const char *name_resolver_init_args;
+    const char *metrics_http_endpoint;
+    const char *recorder_channel;
+    int32_t recorder_stream_id;
+    const char *recorder_dir;
+    size_t recorder_segment_length;
 
     aeron_dl_loaded_libs_state_t *dynamic_libs;
     aeron_driver_context_bindings_clientd_entry_t *bindings_clientd_entries;
@@ -0,0 +1,128 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "aeron_windows.h"
+#include "aeron_alloc.h"
+#include "aeron_driver_housekeeper.h"
+#include "command/aeron_control_protocol.h"
+#include "concurrent/aeron_atomic.h"
+#include "util/aeron_error.h"
+
+int aeron_driver_housekeeper_init(aeron_driver_housekeeper_t *housekeeper, aeron_distinct_error_log_t *error_log)
+{
+    if (aeron_spsc_concurrent_array_queue_init(&housekeeper->task_queue, AERON_DRIVER_HOUSEKEEPER_QUEUE_CAPACITY) < 0)
+    {
+        return -1;
+    }
+
+    housekeeper->error_log = error_log;
+    housekeeper->idle_sleep_ns = AERON_DRIVER_HOUSEKEEPER_IDLE_SLEEP_NS;
+    housekeeper->completed_count = 0;
+
+    return 0;
+}
+
+static void aeron_driver_housekeeper_record_error(aeron_driver_housekeeper_t *housekeeper)
+{
+    if (NULL != housekeeper && NULL != housekeeper->error_log)
+    {
+        aeron_distinct_error_log_record(housekeeper->error_log, AERON_ERROR_CODE_GENERIC_ERROR, aeron_errmsg(), "");
+    }
+}
+
+void aeron_driver_housekeeper_close_log(
+    aeron_driver_housekeeper_t *housekeeper,
+    aeron_map_raw_log_close_func_t close_func,
+    aeron_mapped_raw_log_t *mapped_raw_log,
+    const char *path)
+{
+    aeron_driver_housekeeper_task_t *task = NULL;
+
+    if (NULL != housekeeper && NULL != mapped_raw_log->mapped_file.addr &&
+        aeron_alloc((void **)&task, sizeof(aeron_driver_housekeeper_task_t)) == 0)
+    {
+        if (NULL == path || NULL != (task->path = aeron_strndup(path, AERON_MAX_PATH)))
+        {
+            task->mapped_raw_log = *mapped_raw_log;
+            task->close_func = close_func;
+
+            if (AERON_OFFER_SUCCESS == aeron_spsc_concurrent_array_queue_offer(&housekeeper->task_queue, task))
+            {
+                mapped_raw_log->mapped_file.addr = NULL;
+                return;
+            }
+
+            aeron_free(task->path);
+        }
+
+        aeron_free(task);
+    }
+
+    if (close_func(mapped_raw_log, path) < 0)
+    {
+        aeron_driver_housekeeper_record_error(housekeeper);
+    }
+}
+
+void aeron_driver_housekeeper_close_file(
+    aeron_driver_housekeeper_t *housekeeper, aeron_mapped_file_t *mapped_file, const char *path)
+{
+    aeron_mapped_raw_log_t mapped_raw_log;
+
+    memset(&mapped_raw_log, 0, sizeof(mapped_raw_log));
+    mapped_raw_log.mapped_file = *mapped_file;
+    aeron_driver_housekeeper_close_log(housekeeper, aeron_map_raw_log_close, &mapped_raw_log, path);
+    mapped_file->addr = NULL;
+}
+
+static void aeron_driver_housekeeper_on_task(void *clientd, volatile void *item)
+{
+    aeron_driver_housekeeper_t *housekeeper = (aeron_driver_housekeeper_t *)clientd;
+    aeron_driver_housekeeper_task_t *task = (aeron_driver_housekeeper_task_t *)item;
+
+    if (task->close_func(&task->mapped_raw_log, task->path) < 0)
+    {
+        aeron_driver_housekeeper_record_error(housekeeper);
+    }
+
+    AERON_PUT_ORDERED(housekeeper->completed_count, housekeeper->completed_count + 1);
+
+    aeron_free(task->path);
+    aeron_free(task);
+}
+
+int aeron_driver_housekeeper_do_work(void *clientd)
+{
+    aeron_driver_housekeeper_t *housekeeper = (aeron_driver_housekeeper_t *)clientd;
+
+    return (int)aeron_spsc_concurrent_array_queue_drain(
+        &housekeeper->task_queue,
+        aeron_driver_housekeeper_on_task,
+        housekeeper,
+        AERON_DRIVER_HOUSEKEEPER_TASK_BATCH_LIMIT);
+}
+
+void aeron_driver_housekeeper_on_close(void *clientd)
+{
+    aeron_driver_housekeeper_t *housekeeper = (aeron_driver_housekeeper_t *)clientd;
+
+    /* files must not outlive the driver, so finish rather than drop what is queued */
+    aeron_spsc_concurrent_array_queue_drain_all(&housekeeper->task_queue, aeron_driver_housekeeper_on_task, housekeeper);
+    aeron_spsc_concurrent_array_queue_close(&housekeeper->task_queue);
+}
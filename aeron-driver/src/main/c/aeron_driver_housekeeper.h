@@ -0,0 +1,74 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_DRIVER_HOUSEKEEPER_H
+#define AERON_DRIVER_HOUSEKEEPER_H
+
+#include <stdint.h>
+
+#include "util/aeron_fileutil.h"
+#include "concurrent/aeron_spsc_concurrent_array_queue.h"
+#include "concurrent/aeron_distinct_error_log.h"
+
+#define AERON_DRIVER_HOUSEKEEPER_QUEUE_CAPACITY (1024)
+#define AERON_DRIVER_HOUSEKEEPER_IDLE_SLEEP_NS (1000 * 1000LL)
+#define AERON_DRIVER_HOUSEKEEPER_TASK_BATCH_LIMIT (16)
+
+typedef struct aeron_driver_housekeeper_task_stct
+{
+    aeron_mapped_raw_log_t mapped_raw_log;
+    aeron_map_raw_log_close_func_t close_func;
+    char *path;
+}
+aeron_driver_housekeeper_task_t;
+
+/*
+ * Unmaps and deletes the files of resources the conductor has finished with on a background agent, so releasing a
+ * large log at the end of its linger does not stall the commands queued behind it. The conductor hands over the
+ * mapping and path and forgets them; tasks still queued at shutdown are completed when the agent is closed.
+ */
+typedef struct aeron_driver_housekeeper_stct
+{
+    aeron_spsc_concurrent_array_queue_t task_queue;
+    aeron_distinct_error_log_t *error_log;
+    uint64_t idle_sleep_ns;
+    volatile int64_t completed_count;
+}
+aeron_driver_housekeeper_t;
+
+int aeron_driver_housekeeper_init(aeron_driver_housekeeper_t *housekeeper, aeron_distinct_error_log_t *error_log);
+
+/*
+ * Close a mapped log and delete its file with close_func, on the housekeeper when there is one and on the caller's
+ * thread when housekeeper is NULL or its queue is full. The caller's mapping is cleared either way.
+ */
+void aeron_driver_housekeeper_close_log(
+    aeron_driver_housekeeper_t *housekeeper,
+    aeron_map_raw_log_close_func_t close_func,
+    aeron_mapped_raw_log_t *mapped_raw_log,
+    const char *path);
+
+/*
+ * Unmap a mapped file and delete it, as aeron_driver_housekeeper_close_log.
+ */
+void aeron_driver_housekeeper_close_file(
+    aeron_driver_housekeeper_t *housekeeper, aeron_mapped_file_t *mapped_file, const char *path);
+
+int aeron_driver_housekeeper_do_work(void *clientd);
+
+void aeron_driver_housekeeper_on_close(void *clientd);
+
+#endif //AERON_DRIVER_HOUSEKEEPER_H
@@ -0,0 +1,658 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _GNU_SOURCE
+#endif
+
+#include <errno.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "aeron_windows.h"
+#include "aeron_alloc.h"
+#include "aeronc.h"
+#include "aeron_driver_metrics_agent.h"
+#include "command/aeron_control_protocol.h"
+#include "concurrent/aeron_atomic.h"
+#include "concurrent/aeron_counters_manager.h"
+#include "reports/aeron_loss_reporter.h"
+#include "util/aeron_error.h"
+#include "util/aeron_netutil.h"
+
+#if !defined(_MSC_VER)
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+#if !defined(MSG_NOSIGNAL)
+#define MSG_NOSIGNAL (0)
+#endif
+
+#define AERON_DRIVER_METRICS_AGENT_RESPONSE_INITIAL_CAPACITY (64 * 1024)
+#define AERON_DRIVER_METRICS_AGENT_LISTEN_BACKLOG (8)
+
+static const char *aeron_driver_metrics_agent_repair_names[AERON_LOSS_REPORTER_REPAIR_TYPE_COUNT] =
+    {
+        "retransmit",
+        "unsolicited",
+        "timeout"
+    };
+
+int aeron_driver_metrics_agent_init(
+    aeron_driver_metrics_agent_t *agent,
+    const char *endpoint,
+    uint8_t *counters_metadata,
+    size_t counters_metadata_length,
+    uint8_t *counters_values,
+    size_t counters_values_length,
+    uint8_t *loss_report,
+    size_t loss_report_length,
+    aeron_distinct_error_log_t *error_log)
+{
+    struct sockaddr_storage addr;
+    size_t prefixlen = 0;
+    int reuse_addr = 1;
+
+    agent->listen_fd = -1;
+    agent->counters_metadata = counters_metadata;
+    agent->counters_metadata_length = counters_metadata_length;
+    agent->counters_values = counters_values;
+    agent->counters_values_length = counters_values_length;
+    agent->loss_report = loss_report;
+    agent->loss_report_length = loss_report_length;
+    agent->error_log = error_log;
+    agent->idle_sleep_ns = AERON_DRIVER_METRICS_AGENT_IDLE_SLEEP_NS;
+    agent->response = NULL;
+    agent->response_length = 0;
+    agent->response_capacity = 0;
+
+    if (aeron_alloc((void **)&agent->response, AERON_DRIVER_METRICS_AGENT_RESPONSE_INITIAL_CAPACITY) < 0)
+    {
+        return -1;
+    }
+    agent->response_capacity = AERON_DRIVER_METRICS_AGENT_RESPONSE_INITIAL_CAPACITY;
+
+    if (NULL == endpoint)
+    {
+        return 0;
+    }
+
+    if (aeron_interface_parse_and_resolve(endpoint, &addr, &prefixlen) < 0)
+    {
+        aeron_set_err(aeron_errcode(), "invalid metrics HTTP endpoint %s: %s", endpoint, aeron_errmsg());
+        goto error;
+    }
+
+    if ((agent->listen_fd = aeron_socket(addr.ss_family, SOCK_STREAM, 0)) < 0)
+    {
+        goto error;
+    }
+
+    if (aeron_setsockopt(agent->listen_fd, SOL_SOCKET, SO_REUSEADDR, &reuse_addr, sizeof(reuse_addr)) < 0)
+    {
+        goto error;
+    }
+
+    if (bind(agent->listen_fd, (struct sockaddr *)&addr, (socklen_t)AERON_ADDR_LEN(&addr)) < 0 ||
+        listen(agent->listen_fd, AERON_DRIVER_METRICS_AGENT_LISTEN_BACKLOG) < 0)
+    {
+        aeron_set_err_from_last_err_code("could not listen for metrics HTTP requests on %s", endpoint);
+        goto error;
+    }
+
+    if (set_socket_non_blocking(agent->listen_fd) < 0)
+    {
+        goto error;
+    }
+
+    return 0;
+
+error:
+    aeron_driver_metrics_agent_on_close(agent);
+    return -1;
+}
+
+static int aeron_driver_metrics_agent_ensure_capacity(aeron_driver_metrics_agent_t *agent, size_t required)
+{
+    if (agent->response_length + required <= agent->response_capacity)
+    {
+        return 0;
+    }
+
+    size_t new_capacity = 0 == agent->response_capacity ?
+        AERON_DRIVER_METRICS_AGENT_RESPONSE_INITIAL_CAPACITY : agent->response_capacity;
+    while (agent->response_length + required > new_capacity)
+    {
+        new_capacity *= 2;
+    }
+
+    if (aeron_reallocf((void **)&agent->response, new_capacity) < 0)
+    {
+        agent->response_capacity = 0;
+        agent->response_length = 0;
+        return -1;
+    }
+
+    agent->response_capacity = new_capacity;
+    return 0;
+}
+
+static int aeron_driver_metrics_agent_append(aeron_driver_metrics_agent_t *agent, const char *format, ...)
+{
+    va_list args;
+
+    va_start(args, format);
+    int length = vsnprintf(NULL, 0, format, args);
+    va_end(args);
+
+    if (length < 0 || aeron_driver_metrics_agent_ensure_capacity(agent, (size_t)length + 1) < 0)
+    {
+        return -1;
+    }
+
+    va_start(args, format);
+    vsnprintf(agent->response + agent->response_length, (size_t)length + 1, format, args);
+    va_end(args);
+
+    agent->response_length += (size_t)length;
+    return 0;
+}
+
+/* label values escape backslash, double quote and line feed, and drop any other control characters */
+static int aeron_driver_metrics_agent_append_label_value(
+    aeron_driver_metrics_agent_t *agent, const char *value, size_t length)
+{
+    if (aeron_driver_metrics_agent_ensure_capacity(agent, (2 * length) + 1) < 0)
+    {
+        return -1;
+    }
+
+    char *dst = agent->response + agent->response_length;
+    for (size_t i = 0; i < length; i++)
+    {
+        const char c = value[i];
+
+        if ('\\' == c || '"' == c)
+        {
+            *dst++ = '\\';
+            *dst++ = c;
+        }
+        else if ('\n' == c)
+        {
+            *dst++ = '\\';
+            *dst++ = 'n';
+        }
+        else if ((unsigned char)c >= 0x20)
+        {
+            *dst++ = c;
+        }
+    }
+
+    agent->response_length = (size_t)(dst - agent->response);
+    return 0;
+}
+
+typedef enum aeron_driver_metrics_agent_loss_family_enum
+{
+    AERON_DRIVER_METRICS_AGENT_LOSS_OBSERVATIONS = 0,
+    AERON_DRIVER_METRICS_AGENT_LOSS_BYTES = 1,
+    AERON_DRIVER_METRICS_AGENT_LOSS_REPAIRS = 2,
+    AERON_DRIVER_METRICS_AGENT_LOSS_GAP_LENGTH = 3,
+    AERON_DRIVER_METRICS_AGENT_LOSS_REPAIR_TIME = 4
+}
+aeron_driver_metrics_agent_loss_family_t;
+
+#define AERON_DRIVER_METRICS_AGENT_LOSS_FAMILY_COUNT (5)
+
+static const char *aeron_driver_metrics_agent_loss_family_types[AERON_DRIVER_METRICS_AGENT_LOSS_FAMILY_COUNT] =
+    {
+        "# TYPE aeron_loss_observations_total counter\n",
+        "# TYPE aeron_loss_bytes_total counter\n",
+        "# TYPE aeron_loss_repairs_total counter\n",
+        "# TYPE aeron_loss_gap_length_bytes histogram\n",
+        "# TYPE aeron_loss_repair_time_us histogram\n"
+    };
+
+typedef struct aeron_driver_metrics_agent_render_state_stct
+{
+    aeron_driver_metrics_agent_t *agent;
+    aeron_driver_metrics_agent_loss_family_t loss_family;
+    int result;
+}
+aeron_driver_metrics_agent_render_state_t;
+
+static void aeron_driver_metrics_agent_render_counter(
+    int32_t id,
+    int32_t type_id,
+    const uint8_t *key,
+    size_t key_length,
+    const uint8_t *label,
+    size_t label_length,
+    void *clientd)
+{
+    aeron_driver_metrics_agent_render_state_t *state = (aeron_driver_metrics_agent_render_state_t *)clientd;
+    aeron_driver_metrics_agent_t *agent = state->agent;
+    const size_t value_offset = (size_t)AERON_COUNTER_OFFSET(id);
+    int64_t value;
+
+    if (state->result < 0 || value_offset + sizeof(int64_t) > agent->counters_values_length)
+    {
+        return;
+    }
+
+    AERON_GET_VOLATILE(value, *(int64_t *)(agent->counters_values + value_offset));
+
+    if (aeron_driver_metrics_agent_append(agent, "aeron_counter{id=\"%" PRId32 "\",type_id=\"%" PRId32 "\",label=\"",
+        id, type_id) < 0 ||
+        aeron_driver_metrics_agent_append_label_value(agent, (const char *)label, label_length) < 0 ||
+        aeron_driver_metrics_agent_append(agent, "\"} %" PRId64 "\n", value) < 0)
+    {
+        state->result = -1;
+    }
+}
+
+static int aeron_driver_metrics_agent_append_loss_labels(
+    aeron_driver_metrics_agent_t *agent,
+    const aeron_loss_reporter_entry_t *entry,
+    const char *channel,
+    int32_t channel_length,
+    const char *source,
+    int32_t source_length)
+{
+    if (aeron_driver_metrics_agent_append(agent, "{session_id=\"%" PRId32 "\",stream_id=\"%" PRId32 "\",channel=\"",
+        entry->session_id, entry->stream_id) < 0 ||
+        aeron_driver_metrics_agent_append_label_value(agent, channel, (size_t)channel_length) < 0 ||
+        aeron_driver_metrics_agent_append(agent, "\",source=\"") < 0 ||
+        aeron_driver_metrics_agent_append_label_value(agent, source, (size_t)source_length) < 0 ||
+        aeron_driver_metrics_agent_append(agent, "\"") < 0)
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * Bucket i of a loss report histogram holds values below 2 << (shift + i), apart from the last which is unbounded, so
+ * the cumulative Prometheus buckets use that bound less one as the values are integral.
+ */
+static int aeron_driver_metrics_agent_append_loss_histogram(
+    aeron_driver_metrics_agent_t *agent,
+    const char *name,
+    const int64_t *histogram,
+    int shift,
+    const aeron_loss_reporter_entry_t *entry,
+    const char *channel,
+    int32_t channel_length,
+    const char *source,
+    int32_t source_length)
+{
+    int64_t cumulative = 0;
+
+    for (int i = 0; i < AERON_LOSS_REPORTER_HISTOGRAM_BUCKETS; i++)
+    {
+        int64_t count;
+        AERON_GET_VOLATILE(count, histogram[i]);
+        cumulative += count;
+
+        if (aeron_driver_metrics_agent_append(agent, "%s_bucket", name) < 0 ||
+            aeron_driver_metrics_agent_append_loss_labels(
+                agent, entry, channel, channel_length, source, source_length) < 0)
+        {
+            return -1;
+        }
+
+        int result = i < AERON_LOSS_REPORTER_HISTOGRAM_BUCKETS - 1 ?
+            aeron_driver_metrics_agent_append(
+                agent, ",le=\"%" PRId64 "\"} %" PRId64 "\n", (INT64_C(2) << (shift + i)) - 1, cumulative) :
+            aeron_driver_metrics_agent_append(agent, ",le=\"+Inf\"} %" PRId64 "\n", cumulative);
+
+        if (result < 0)
+        {
+            return -1;
+        }
+    }
+
+    if (aeron_driver_metrics_agent_append(agent, "%s_count", name) < 0 ||
+        aeron_driver_metrics_agent_append_loss_labels(
+            agent, entry, channel, channel_length, source, source_length) < 0 ||
+        aeron_driver_metrics_agent_append(agent, "} %" PRId64 "\n", cumulative) < 0)
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+static int aeron_driver_metrics_agent_append_loss_total(
+    aeron_driver_metrics_agent_t *agent,
+    const char *name,
+    const volatile int64_t *total,
+    const aeron_loss_reporter_entry_t *entry,
+    const char *channel,
+    int32_t channel_length,
+    const char *source,
+    int32_t source_length)
+{
+    int64_t value;
+    AERON_GET_VOLATILE(value, *total);
+
+    if (aeron_driver_metrics_agent_append(agent, "%s", name) < 0 ||
+        aeron_driver_metrics_agent_append_loss_labels(
+            agent, entry, channel, channel_length, source, source_length) < 0 ||
+        aeron_driver_metrics_agent_append(agent, "} %" PRId64 "\n", value) < 0)
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+static int aeron_driver_metrics_agent_append_loss_repairs(
+    aeron_driver_metrics_agent_t *agent,
+    const aeron_loss_reporter_entry_t *entry,
+    const char *channel,
+    int32_t channel_length,
+    const char *source,
+    int32_t source_length)
+{
+    for (int i = 0; i < AERON_LOSS_REPORTER_REPAIR_TYPE_COUNT; i++)
+    {
+        int64_t repair_count;
+        AERON_GET_VOLATILE(repair_count, entry->repair_counts[i]);
+
+        if (aeron_driver_metrics_agent_append(agent, "aeron_loss_repairs_total") < 0 ||
+            aeron_driver_metrics_agent_append_loss_labels(
+                agent, entry, channel, channel_length, source, source_length) < 0 ||
+            aeron_driver_metrics_agent_append(
+                agent, ",repair=\"%s\"} %" PRId64 "\n", aeron_driver_metrics_agent_repair_names[i], repair_count) < 0)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+static void aeron_driver_metrics_agent_render_loss_entry(
+    void *clientd,
+    const aeron_loss_reporter_entry_t *entry,
+    const char *channel,
+    int32_t channel_length,
+    const char *source,
+    int32_t source_length)
+{
+    aeron_driver_metrics_agent_render_state_t *state = (aeron_driver_metrics_agent_render_state_t *)clientd;
+    aeron_driver_metrics_agent_t *agent = state->agent;
+
+    if (state->result < 0)
+    {
+        return;
+    }
+
+    switch (state->loss_family)
+    {
+        case AERON_DRIVER_METRICS_AGENT_LOSS_OBSERVATIONS:
+            state->result = aeron_driver_metrics_agent_append_loss_total(
+                agent,
+                "aeron_loss_observations_total",
+                &entry->observation_count,
+                entry,
+                channel,
+                channel_length,
+                source,
+                source_length);
+            break;
+
+        case AERON_DRIVER_METRICS_AGENT_LOSS_BYTES:
+            state->result = aeron_driver_metrics_agent_append_loss_total(
+                agent,
+                "aeron_loss_bytes_total",
+                &entry->total_bytes_lost,
+                entry,
+                channel,
+                channel_length,
+                source,
+                source_length);
+            break;
+
+        case AERON_DRIVER_METRICS_AGENT_LOSS_REPAIRS:
+            state->result = aeron_driver_metrics_agent_append_loss_repairs(
+                agent, entry, channel, channel_length, source, source_length);
+            break;
+
+        case AERON_DRIVER_METRICS_AGENT_LOSS_GAP_LENGTH:
+            state->result = aeron_driver_metrics_agent_append_loss_histogram(
+                agent,
+                "aeron_loss_gap_length_bytes",
+                entry->gap_length_histogram,
+                AERON_LOSS_REPORTER_GAP_LENGTH_BUCKET_SHIFT,
+                entry,
+                channel,
+                channel_length,
+                source,
+                source_length);
+            break;
+
+        case AERON_DRIVER_METRICS_AGENT_LOSS_REPAIR_TIME:
+            state->result = aeron_driver_metrics_agent_append_loss_histogram(
+                agent,
+                "aeron_loss_repair_time_us",
+                entry->repair_time_histogram,
+                AERON_LOSS_REPORTER_REPAIR_TIME_US_BUCKET_SHIFT,
+                entry,
+                channel,
+                channel_length,
+                source,
+                source_length);
+            break;
+    }
+}
+
+int aeron_driver_metrics_agent_render(aeron_driver_metrics_agent_t *agent)
+{
+    aeron_driver_metrics_agent_render_state_t state = { agent, AERON_DRIVER_METRICS_AGENT_LOSS_OBSERVATIONS, 0 };
+
+    agent->response_length = 0;
+
+    if (aeron_driver_metrics_agent_append(agent, "# TYPE aeron_counter gauge\n") < 0)
+    {
+        return -1;
+    }
+
+    aeron_counters_reader_foreach_metadata(
+        agent->counters_metadata, agent->counters_metadata_length, aeron_driver_metrics_agent_render_counter, &state);
+
+    if (state.result < 0)
+    {
+        return -1;
+    }
+
+    /* samples of a metric family must be contiguous so the loss report is read once for each */
+    for (int i = 0; NULL != agent->loss_report && i < AERON_DRIVER_METRICS_AGENT_LOSS_FAMILY_COUNT; i++)
+    {
+        if (aeron_driver_metrics_agent_append(agent, "%s", aeron_driver_metrics_agent_loss_family_types[i]) < 0)
+        {
+            return -1;
+        }
+
+        state.loss_family = (aeron_driver_metrics_agent_loss_family_t)i;
+        aeron_loss_reporter_read_full(
+            agent->loss_report, agent->loss_report_length, aeron_driver_metrics_agent_render_loss_entry, &state);
+
+        if (state.result < 0)
+        {
+            return -1;
+        }
+    }
+
+    return state.result;
+}
+
+static int aeron_driver_metrics_agent_wait(aeron_socket_t fd, short events, int64_t deadline_ms)
+{
+    struct pollfd pollfd;
+    const int64_t timeout_ms = deadline_ms - aeron_epoch_clock();
+
+    if (timeout_ms <= 0)
+    {
+        return -1;
+    }
+
+    pollfd.fd = fd;
+    pollfd.events = events;
+    pollfd.revents = 0;
+
+    return poll(&pollfd, 1, (int)timeout_ms) > 0 ? 0 : -1;
+}
+
+static int aeron_driver_metrics_agent_send(
+    aeron_socket_t fd, const char *buffer, size_t length, int64_t deadline_ms)
+{
+    size_t offset = 0;
+
+    while (offset < length)
+    {
+        if (aeron_driver_metrics_agent_wait(fd, POLLOUT, deadline_ms) < 0)
+        {
+            return -1;
+        }
+
+        const ssize_t sent = send(fd, buffer + offset, (int)(length - offset), MSG_NOSIGNAL);
+        if (sent < 0)
+        {
+            return -1;
+        }
+
+        offset += (size_t)sent;
+    }
+
+    return 0;
+}
+
+static void aeron_driver_metrics_agent_handle(aeron_driver_metrics_agent_t *agent, aeron_socket_t fd)
+{
+    const int64_t deadline_ms = aeron_epoch_clock() + AERON_DRIVER_METRICS_AGENT_REQUEST_TIMEOUT_MS;
+    size_t request_length = 0;
+    const char *status = "404 Not Found";
+    char header[256];
+
+    if (set_socket_non_blocking(fd) < 0)
+    {
+        return;
+    }
+
+    /* only the request line matters, the rest of the request is read so closing does not reset the connection */
+    while (request_length < sizeof(agent->request) - 1)
+    {
+        if (aeron_driver_metrics_agent_wait(fd, POLLIN, deadline_ms) < 0)
+        {
+            return;
+        }
+
+        const ssize_t received = recv(
+            fd, agent->request + request_length, (int)(sizeof(agent->request) - 1 - request_length), 0);
+        if (received <= 0)
+        {
+            return;
+        }
+
+        request_length += (size_t)received;
+        agent->request[request_length] = '\0';
+
+        if (NULL != strstr(agent->request, "\r\n\r\n"))
+        {
+            break;
+        }
+    }
+
+    agent->response_length = 0;
+
+    if (0 != strncmp(agent->request, "GET ", 4))
+    {
+        status = "405 Method Not Allowed";
+    }
+    else if (0 == strncmp(agent->request + 4, "/metrics", 8) &&
+        (' ' == agent->request[12] || '?' == agent->request[12]))
+    {
+        if (aeron_driver_metrics_agent_render(agent) < 0)
+        {
+            aeron_distinct_error_log_record(agent->error_log, AERON_ERROR_CODE_GENERIC_ERROR, aeron_errmsg(), "");
+            status = "500 Internal Server Error";
+            agent->response_length = 0;
+        }
+        else
+        {
+            status = "200 OK";
+        }
+    }
+
+    int header_length = snprintf(
+        header,
+        sizeof(header),
+        "HTTP/1.1 %s\r\n"
+        "Content-Type: text/plain; version=0.0.4\r\n"
+        "Content-Length: %" PRIu64 "\r\n"
+        "Connection: close\r\n"
+        "\r\n",
+        status,
+        (uint64_t)agent->response_length);
+
+    if (aeron_driver_metrics_agent_send(fd, header, (size_t)header_length, deadline_ms) == 0)
+    {
+        aeron_driver_metrics_agent_send(fd, agent->response, agent->response_length, deadline_ms);
+    }
+}
+
+int aeron_driver_metrics_agent_do_work(void *clientd)
+{
+    aeron_driver_metrics_agent_t *agent = (aeron_driver_metrics_agent_t *)clientd;
+    int work_count = 0;
+
+    if (agent->listen_fd < 0)
+    {
+        return 0;
+    }
+
+    aeron_socket_t fd;
+    while ((fd = accept(agent->listen_fd, NULL, NULL)) >= 0)
+    {
+        aeron_driver_metrics_agent_handle(agent, fd);
+        aeron_close_socket(fd);
+        work_count++;
+    }
+
+    return work_count;
+}
+
+void aeron_driver_metrics_agent_on_close(void *clientd)
+{
+    aeron_driver_metrics_agent_t *agent = (aeron_driver_metrics_agent_t *)clientd;
+
+    if (agent->listen_fd >= 0)
+    {
+        aeron_close_socket(agent->listen_fd);
+        agent->listen_fd = -1;
+    }
+
+    aeron_free(agent->response);
+    agent->response = NULL;
+    agent->response_capacity = 0;
+    agent->response_length = 0;
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_DRIVER_METRICS_AGENT_H
+#define AERON_DRIVER_METRICS_AGENT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "aeron_socket.h"
+#include "concurrent/aeron_distinct_error_log.h"
+
+#define AERON_DRIVER_METRICS_AGENT_IDLE_SLEEP_NS (10 * 1000 * 1000LL)
+#define AERON_DRIVER_METRICS_AGENT_REQUEST_TIMEOUT_MS (1000)
+#define AERON_DRIVER_METRICS_AGENT_REQUEST_MAX_LENGTH (4096)
+
+/*
+ * Serves the counters and loss report in the Prometheus text format on GET /metrics. Both are read directly from the
+ * CnC and loss report files on the agent's own thread, like AeronStat and LossStat do, so a scrape never touches the
+ * conductor. Requests are handled one at a time as a scraper is expected to be the only client.
+ */
+typedef struct aeron_driver_metrics_agent_stct
+{
+    aeron_socket_t listen_fd;
+    uint8_t *counters_metadata;
+    size_t counters_metadata_length;
+    uint8_t *counters_values;
+    size_t counters_values_length;
+    uint8_t *loss_report;
+    size_t loss_report_length;
+    aeron_distinct_error_log_t *error_log;
+    uint64_t idle_sleep_ns;
+    char *response;
+    size_t response_length;
+    size_t response_capacity;
+    char request[AERON_DRIVER_METRICS_AGENT_REQUEST_MAX_LENGTH];
+}
+aeron_driver_metrics_agent_t;
+
+/*
+ * Bind the listening socket to endpoint, given as host:port in the form of the interface URI parameter.
+ */
+int aeron_driver_metrics_agent_init(
+    aeron_driver_metrics_agent_t *agent,
+    const char *endpoint,
+    uint8_t *counters_metadata,
+    size_t counters_metadata_length,
+    uint8_t *counters_values,
+    size_t counters_values_length,
+    uint8_t *loss_report,
+    size_t loss_report_length,
+    aeron_distinct_error_log_t *error_log);
+
+/*
+ * Render the current metrics into the agent's response buffer.
+ */
+int aeron_driver_metrics_agent_render(aeron_driver_metrics_agent_t *agent);
+
+int aeron_driver_metrics_agent_do_work(void *clientd);
+
+void aeron_driver_metrics_agent_on_close(void *clientd);
+
+#endif //AERON_DRIVER_METRICS_AGENT_H
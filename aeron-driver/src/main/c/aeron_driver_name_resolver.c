@@ -53,6 +53,10 @@ struct mmsghdr
 #define AERON_NAME_RESOLVER_DRIVER_DUTY_CYCLE_MS (10)
 #define AERON_NAME_RESOLVER_DRIVER_NUM_RECV_BUFFERS (1)
 
+// Bytes of neighbour resolutions that may be sent per duty cycle, summed over all neighbours. The periodic full
+// resolution set is spread over as many duty cycles as this requires rather than being sent in a single burst.
+#define AERON_NAME_RESOLVER_DRIVER_NEIGHBOUR_RESOLUTION_BUDGET_BYTES (64 * 1024)
+
 typedef struct aeron_driver_name_resolver_neighbor_stct
 {
     aeron_name_resolver_cache_addr_t cache_addr;
@@ -92,6 +96,9 @@ typedef struct aeron_driver_name_resolver_stct
     int64_t time_of_last_bootstrap_neighbor_resolve_ms;
     int64_t self_resolutions_deadline_ms;
     int64_t neighbor_resolutions_deadline_ms;
+    size_t neighbor_resolutions_cursor;
+    bool is_neighbor_resolutions_sweep_active;
+    size_t delta_length;
 
     int64_t now_ms;
 
@@ -105,6 +112,7 @@ typedef struct aeron_driver_name_resolver_stct
 
     struct sockaddr_storage received_address;
     uint8_t buffer[AERON_MAX_UDP_PAYLOAD_LENGTH + AERON_CACHE_LINE_LENGTH];
+    uint8_t delta_buffer[AERON_MAX_UDP_PAYLOAD_LENGTH + AERON_CACHE_LINE_LENGTH];
 }
 aeron_driver_name_resolver_t;
 
@@ -437,6 +445,21 @@ static int aeron_driver_name_resolver_add_neighbor(
     return 0;
 }
 
+static int aeron_driver_name_resolver_append_delta(
+    aeron_driver_name_resolver_t *resolver,
+    aeron_name_resolver_cache_addr_t *cache_addr,
+    const char *name,
+    size_t name_length,
+    int32_t age_in_ms);
+
+static bool aeron_driver_name_resolver_cache_addr_equals(
+    aeron_name_resolver_cache_addr_t *a, aeron_name_resolver_cache_addr_t *b)
+{
+    return a->res_type == b->res_type &&
+        a->port == b->port &&
+        0 == memcmp(a->address, b->address, aeron_res_header_address_length(a->res_type));
+}
+
 static int aeron_driver_name_resolver_on_resolution_entry(
     aeron_driver_name_resolver_t *resolver,
     const aeron_resolution_header_t *resolution_header,
@@ -456,6 +479,11 @@ static int aeron_driver_name_resolver_on_resolution_entry(
 
     int64_t time_of_last_activity_ms = now_ms - resolution_header->age_in_ms;
 
+    aeron_name_resolver_cache_entry_t *cache_entry;
+    const bool is_changed = aeron_name_resolver_cache_lookup_by_name(
+        &resolver->cache, name, name_length, cache_addr->res_type, &cache_entry) < 0 ||
+        !aeron_driver_name_resolver_cache_addr_equals(&cache_entry->cache_addr, cache_addr);
+
     if (aeron_name_resolver_cache_add_or_update(
         &resolver->cache,
         name,
@@ -467,6 +495,13 @@ static int aeron_driver_name_resolver_on_resolution_entry(
         return -1;
     }
 
+    if (is_changed &&
+        aeron_driver_name_resolver_append_delta(
+            resolver, cache_addr, name, name_length, resolution_header->age_in_ms) < 0)
+    {
+        return -1;
+    }
+
     if (aeron_driver_name_resolver_add_neighbor(resolver, cache_addr, is_self, time_of_last_activity_ms) < 0)
     {
         return -1;
@@ -787,8 +822,111 @@ static int aeron_driver_name_resolver_send_self_resolutions(aeron_driver_name_re
     return send_work;
 }
 
+static int aeron_driver_name_resolver_send_to_neighbors(
+    aeron_driver_name_resolver_t *resolver, aeron_frame_header_t *frame_header, size_t frame_length)
+{
+    int work_count = 0;
+
+    // TODO: Optimise with sendmmsg
+    for (size_t k = 0; k < resolver->neighbors.length; k++)
+    {
+        aeron_driver_name_resolver_neighbor_t *neighbor = &resolver->neighbors.array[k];
+
+        if (aeron_driver_name_resolver_do_send(resolver, frame_header, frame_length, &neighbor->socket_addr) < 0)
+        {
+            aeron_set_err_from_last_err_code("Neighbor resolutions: %s", aeron_errmsg());
+            aeron_distinct_error_log_record(
+                resolver->error_log, AERON_ERROR_CODE_GENERIC_ERROR, aeron_errmsg(), "");
+        }
+        else
+        {
+            work_count++;
+        }
+    }
+
+    return work_count;
+}
+
+static int aeron_driver_name_resolver_flush_delta(aeron_driver_name_resolver_t *resolver)
+{
+    if (0 == resolver->delta_length)
+    {
+        return 0;
+    }
+
+    uint8_t *aligned_buffer = (uint8_t *)AERON_ALIGN((uintptr_t)resolver->delta_buffer, AERON_CACHE_LINE_LENGTH);
+    aeron_frame_header_t *frame_header = (aeron_frame_header_t *)aligned_buffer;
+    const size_t frame_length = sizeof(aeron_frame_header_t) + resolver->delta_length;
+
+    frame_header->type = AERON_HDR_TYPE_RES;
+    frame_header->flags = UINT8_C(0);
+    frame_header->version = AERON_FRAME_HEADER_VERSION;
+    frame_header->frame_length = (int32_t)frame_length;
+
+    resolver->delta_length = 0;
+
+    return aeron_driver_name_resolver_send_to_neighbors(resolver, frame_header, frame_length);
+}
+
+static int aeron_driver_name_resolver_append_delta(
+    aeron_driver_name_resolver_t *resolver,
+    aeron_name_resolver_cache_addr_t *cache_addr,
+    const char *name,
+    size_t name_length,
+    int32_t age_in_ms)
+{
+    uint8_t *aligned_buffer = (uint8_t *)AERON_ALIGN((uintptr_t)resolver->delta_buffer, AERON_CACHE_LINE_LENGTH);
+    size_t entry_offset = sizeof(aeron_frame_header_t) + resolver->delta_length;
+    aeron_resolution_header_t *resolution_header = (aeron_resolution_header_t *)&aligned_buffer[entry_offset];
+
+    int entry_length = aeron_driver_name_resolver_set_resolution_header(
+        resolution_header, AERON_MAX_UDP_PAYLOAD_LENGTH - entry_offset, 0, cache_addr, name, name_length);
+
+    if (0 == entry_length)
+    {
+        aeron_driver_name_resolver_flush_delta(resolver);
+
+        entry_offset = sizeof(aeron_frame_header_t);
+        resolution_header = (aeron_resolution_header_t *)&aligned_buffer[entry_offset];
+        entry_length = aeron_driver_name_resolver_set_resolution_header(
+            resolution_header, AERON_MAX_UDP_PAYLOAD_LENGTH - entry_offset, 0, cache_addr, name, name_length);
+    }
+
+    if (entry_length <= 0)
+    {
+        aeron_set_err(EINVAL, "Unable to add resolution delta: res_type=%d", cache_addr->res_type);
+        return -1;
+    }
+
+    resolution_header->age_in_ms = age_in_ms;
+    resolver->delta_length += (size_t)entry_length;
+
+    return 0;
+}
+
 static int aeron_driver_name_resolver_send_neighbor_resolutions(aeron_driver_name_resolver_t *resolver, int64_t now_ms)
 {
+    int64_t budget = AERON_NAME_RESOLVER_DRIVER_NEIGHBOUR_RESOLUTION_BUDGET_BYTES;
+    int work_count = 0;
+
+    if (0 != resolver->delta_length)
+    {
+        budget -= (int64_t)((sizeof(aeron_frame_header_t) + resolver->delta_length) * resolver->neighbors.length);
+        work_count += aeron_driver_name_resolver_flush_delta(resolver);
+    }
+
+    if (!resolver->is_neighbor_resolutions_sweep_active)
+    {
+        if (now_ms < resolver->neighbor_resolutions_deadline_ms)
+        {
+            return work_count;
+        }
+
+        resolver->is_neighbor_resolutions_sweep_active = true;
+        resolver->neighbor_resolutions_cursor = 0;
+        resolver->neighbor_resolutions_deadline_ms = now_ms + resolver->neighbor_resolution_interval_ms;
+    }
+
     uint8_t *aligned_buffer = (uint8_t *)AERON_ALIGN((uintptr_t)resolver->buffer, AERON_CACHE_LINE_LENGTH);
 
     aeron_frame_header_t *frame_header = (aeron_frame_header_t *)aligned_buffer;
@@ -796,12 +934,13 @@ static int aeron_driver_name_resolver_send_neighbor_resolutions(aeron_driver_nam
     frame_header->flags = UINT8_C(0);
     frame_header->version = AERON_FRAME_HEADER_VERSION;
 
-    size_t i;
-    size_t j;
-    int work_count = 0;
-    for (i = 0; i < resolver->cache.entries.length;)
+    // Entries timed out during a sweep are swapped from the end of the cache, so one may be skipped until the next
+    // sweep. That is well within the cache timeout, and any entry that changes is sent as a delta regardless.
+    size_t i = resolver->neighbor_resolutions_cursor;
+    while (0 < resolver->neighbors.length && 0 < budget && i < resolver->cache.entries.length)
     {
         size_t entry_offset = sizeof(aeron_frame_header_t);
+        size_t j;
 
         for (j = i; j < resolver->cache.entries.length;)
         {
@@ -831,26 +970,18 @@ static int aeron_driver_name_resolver_send_neighbor_resolutions(aeron_driver_nam
 
         frame_header->frame_length = (int32_t)entry_offset;
 
-        // TODO: Optimise with sendmmsg
-        for (size_t k = 0; k < resolver->neighbors.length; k++)
-        {
-            aeron_driver_name_resolver_neighbor_t *neighbor = &resolver->neighbors.array[k];
-
-            if (aeron_driver_name_resolver_do_send(resolver, frame_header, entry_offset, &neighbor->socket_addr) < 0)
-            {
-                aeron_set_err_from_last_err_code("Neighbor resolutions: %s", aeron_errmsg());
-                aeron_distinct_error_log_record(
-                    resolver->error_log, AERON_ERROR_CODE_GENERIC_ERROR, aeron_errmsg(), "");
-            }
-            else
-            {
-                work_count++;
-            }
-        }
+        work_count += aeron_driver_name_resolver_send_to_neighbors(resolver, frame_header, entry_offset);
+        budget -= (int64_t)(entry_offset * resolver->neighbors.length);
 
         i = j;
     }
 
+    resolver->neighbor_resolutions_cursor = i;
+    if (0 == resolver->neighbors.length || resolver->cache.entries.length <= i)
+    {
+        resolver->is_neighbor_resolutions_sweep_active = false;
+    }
+
     return work_count;
 }
 
@@ -864,7 +995,7 @@ static int aeron_driver_name_resolver_timeout_neighbors(aeron_driver_name_resolv
         if ((entry->time_of_last_activity_ms + resolver->neighbor_timeout_ms) <= now_ms)
         {
             aeron_array_fast_unordered_remove(
-                (uint8_t *)resolver->neighbors.array, sizeof(aeron_name_resolver_cache_entry_t), i, last_index);
+                (uint8_t *)resolver->neighbors.array, sizeof(aeron_driver_name_resolver_neighbor_t), i, last_index);
             resolver->neighbors.length--;
             last_index--;
             num_removed++;
@@ -1010,13 +1141,7 @@ int aeron_driver_name_resolver_do_work(aeron_name_resolver_t *resolver, int64_t
             driver_resolver->self_resolutions_deadline_ms = now_ms + driver_resolver->self_resolution_interval_ms;
         }
 
-        if (driver_resolver->neighbor_resolutions_deadline_ms <= now_ms)
-        {
-            work_count += aeron_driver_name_resolver_send_neighbor_resolutions(driver_resolver, now_ms);
-
-            driver_resolver->neighbor_resolutions_deadline_ms =
-                now_ms + driver_resolver->neighbor_resolution_interval_ms;
-        }
+        work_count += aeron_driver_name_resolver_send_neighbor_resolutions(driver_resolver, now_ms);
 
         driver_resolver->time_of_last_work_ms = now_ms;
     }
@@ -22,8 +22,19 @@
 #include <stdio.h>
 #include "util/aeron_arrayutil.h"
 #include "media/aeron_receive_channel_endpoint.h"
+#include "media/aeron_receive_destination.h"
 #include "aeron_driver_receiver.h"
 
+#ifdef _MSC_VER
+#define _Static_assert static_assert
+#endif
+
+_Static_assert(
+    offsetof(aeron_driver_receiver_t, poller) >=
+        offsetof(aeron_driver_receiver_t, attention_queue) + sizeof(aeron_spsc_concurrent_array_queue_t) +
+        (2 * AERON_CACHE_LINE_LENGTH),
+    "receiver fields of aeron_driver_receiver_t must not share a cache line with the proxy and attention queue");
+
 #if !defined(HAVE_STRUCT_MMSGHDR)
 struct mmsghdr
 {
@@ -44,7 +55,23 @@ int aeron_driver_receiver_init(
         return -1;
     }
 
-    for (size_t i = 0; i < AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS; i++)
+    const size_t count = context->receiver_io_vector_capacity;
+    receiver->recv_buffers.count = count;
+    receiver->recv_buffers.control_length =
+        context->socket_gro_enabled || context->socket_rx_timestamping_enabled || context->socket_buffer_auto_enabled ?
+        AERON_UDP_CHANNEL_TRANSPORT_CONTROL_LENGTH : 0;
+
+    if (aeron_alloc((void **)&receiver->recv_buffers.buffers, sizeof(uint8_t *) * count) < 0 ||
+        aeron_alloc((void **)&receiver->recv_buffers.iov, sizeof(struct iovec) * count) < 0 ||
+        aeron_alloc((void **)&receiver->recv_buffers.addrs, sizeof(struct sockaddr_storage) * count) < 0 ||
+        aeron_alloc((void **)&receiver->recv_buffers.controls, AERON_UDP_CHANNEL_TRANSPORT_CONTROL_LENGTH * count) < 0 ||
+        aeron_alloc((void **)&receiver->recv_buffers.mmsghdrs, sizeof(struct mmsghdr) * count) < 0)
+    {
+        aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
+        return -1;
+    }
+
+    for (size_t i = 0; i < count; i++)
     {
         size_t offset = 0;
         if (aeron_alloc_aligned(
@@ -59,6 +86,13 @@ int aeron_driver_receiver_init(
 
         receiver->recv_buffers.iov[i].iov_base = receiver->recv_buffers.buffers[i] + offset;
         receiver->recv_buffers.iov[i].iov_len = AERON_DRIVER_RECEIVER_MAX_UDP_PACKET_LENGTH;
+
+        struct mmsghdr *mmsghdr = &receiver->recv_buffers.mmsghdrs[i];
+        mmsghdr->msg_hdr.msg_name = &receiver->recv_buffers.addrs[i];
+        mmsghdr->msg_hdr.msg_iov = &receiver->recv_buffers.iov[i];
+        mmsghdr->msg_hdr.msg_iovlen = 1;
+        mmsghdr->msg_hdr.msg_control = receiver->recv_buffers.control_length > 0 ?
+            receiver->recv_buffers.controls + (i * AERON_UDP_CHANNEL_TRANSPORT_CONTROL_LENGTH) : NULL;
     }
 
     if (aeron_udp_channel_data_paths_init(
@@ -73,10 +107,31 @@ int aeron_driver_receiver_init(
         return -1;
     }
 
+    receiver->trace_ring.descriptor = NULL;
+    receiver->trace_ring.records = NULL;
+    receiver->trace_ring.mask = 0;
     receiver->images.array = NULL;
     receiver->images.length = 0;
     receiver->images.capacity = 0;
 
+    if (aeron_spsc_concurrent_array_queue_init(
+        &receiver->attention_queue, AERON_DRIVER_RECEIVER_ATTENTION_QUEUE_CAPACITY) < 0)
+    {
+        return -1;
+    }
+
+    receiver->image_scan_deadline_ns = 0;
+    receiver->has_queued_control_frames = false;
+    receiver->receive_batch = NULL;
+    receiver->is_zero_copy_enabled =
+        context->receiver_zero_copy_enabled &&
+        !context->socket_gro_enabled &&
+        !context->socket_rx_timestamping_enabled &&
+        NULL == context->udp_channel_incoming_interceptor_bindings &&
+        aeron_udp_channel_transport_recvmmsg == context->udp_channel_transport_bindings->recvmmsg_func;
+
+    receiver->has_shared_counters = context->receiver_shard_count > 1;
+
     receiver->pending_setups.array = NULL;
     receiver->pending_setups.length = 0;
     receiver->pending_setups.capacity = 0;
@@ -92,12 +147,14 @@ int aeron_driver_receiver_init(
     receiver->receiver_proxy.threading_mode = context->threading_mode;
     receiver->receiver_proxy.receiver = receiver;
 
-    receiver->errors_counter = aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_ERRORS);
-    receiver->invalid_frames_counter = aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_INVALID_PACKETS);
+    receiver->errors_counter = aeron_system_counter_writer_addr(
+        system_counters, AERON_SYSTEM_COUNTER_ERRORS, AERON_SYSTEM_COUNTER_WRITER_RECEIVER);
+    receiver->invalid_frames_counter = aeron_system_counter_writer_addr(
+        system_counters, AERON_SYSTEM_COUNTER_INVALID_PACKETS, AERON_SYSTEM_COUNTER_WRITER_RECEIVER);
     receiver->total_bytes_received_counter =  aeron_system_counter_addr(
         system_counters, AERON_SYSTEM_COUNTER_BYTES_RECEIVED);
-    receiver->resolution_changes_counter = aeron_system_counter_addr(
-        system_counters, AERON_SYSTEM_COUNTER_RESOLUTION_CHANGES);
+    receiver->resolution_changes_counter = aeron_system_counter_writer_addr(
+        system_counters, AERON_SYSTEM_COUNTER_RESOLUTION_CHANGES, AERON_SYSTEM_COUNTER_WRITER_RECEIVER);
 
     receiver->re_resolution_deadline_ns =
         aeron_clock_cached_nano_time(context->cached_clock) + context->re_resolution_check_interval_ns;
@@ -105,6 +162,70 @@ int aeron_driver_receiver_init(
     return 0;
 }
 
+static int aeron_driver_receiver_image_do_work(
+    aeron_driver_receiver_t *receiver, aeron_publication_image_t *image, int64_t now_ns, bool is_scan)
+{
+    int work_count = 0;
+
+    aeron_cmpxchg32(&image->needs_attention, 1, 0);
+
+    int send_sm_result = aeron_publication_image_send_pending_status_message(image);
+    if (send_sm_result < 0)
+    {
+        AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver send SM: %s", aeron_errmsg());
+    }
+    else if (send_sm_result > 0)
+    {
+        receiver->has_queued_control_frames = true;
+        work_count += send_sm_result;
+    }
+
+    int send_nak_result = aeron_publication_image_send_pending_loss(image);
+    if (send_nak_result < 0)
+    {
+        AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver send NAK: %s", aeron_errmsg());
+    }
+    else if (send_nak_result > 0)
+    {
+        receiver->has_queued_control_frames = true;
+    }
+
+    work_count += send_nak_result < 0 ? 0 : send_nak_result;
+
+    if (is_scan)
+    {
+        if (image->is_inline_receive)
+        {
+            aeron_publication_image_track_inline_receive(image, now_ns);
+        }
+
+        int initiate_rttm_result = aeron_publication_image_initiate_rttm(image, now_ns);
+        if (initiate_rttm_result < 0)
+        {
+            AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver send RTTM: %s", aeron_errmsg());
+        }
+        else if (initiate_rttm_result > 0)
+        {
+            receiver->has_queued_control_frames = true;
+        }
+
+        work_count += initiate_rttm_result < 0 ? 0 : initiate_rttm_result;
+    }
+
+    return work_count;
+}
+
+static void aeron_driver_receiver_on_image_attention(void *clientd, volatile void *item)
+{
+    aeron_driver_receiver_t *receiver = (aeron_driver_receiver_t *)clientd;
+
+    aeron_driver_receiver_image_do_work(
+        receiver,
+        (aeron_publication_image_t *)item,
+        aeron_clock_cached_nano_time(receiver->context->cached_clock),
+        false);
+}
+
 void aeron_driver_receiver_on_command(void *clientd, volatile void *item)
 {
     aeron_driver_receiver_t *receiver = (aeron_driver_receiver_t *)clientd;
@@ -119,9 +240,130 @@ void aeron_driver_receiver_on_command(void *clientd, volatile void *item)
     }
 }
 
+static bool aeron_driver_receiver_is_in_place_frame(
+    aeron_publication_image_t *image, const aeron_data_header_t *header, int64_t position, size_t length)
+{
+    return length >= AERON_DATA_HEADER_LENGTH &&
+        AERON_FRAME_HEADER_VERSION == header->frame_header.version &&
+        (AERON_HDR_TYPE_DATA == header->frame_header.type || AERON_HDR_TYPE_PAD == header->frame_header.type) &&
+        image->session_id == header->session_id &&
+        image->stream_id == header->stream_id &&
+        aeron_logbuffer_compute_position(
+            header->term_id, header->term_offset, image->position_bits_to_shift, image->initial_term_id) == position;
+}
+
+/*
+ * With a single active image on a single transport and no gaps to fill, the next data frame can only usefully land at
+ * the high water mark, so the payload is received straight into the term there and only the header is written after.
+ * Anything else is gathered back into the receive buffer, the term cleared and dispatched as usual.
+ */
+static void aeron_driver_receiver_zero_copy_recv(aeron_driver_receiver_t *receiver, int64_t *bytes_received)
+{
+    if (1 != receiver->images.length)
+    {
+        return;
+    }
+
+    aeron_publication_image_t *image = receiver->images.array[0].image;
+    aeron_receive_channel_endpoint_t *endpoint = image->endpoint;
+
+    if (NULL == endpoint ||
+        AERON_PUBLICATION_IMAGE_STATE_ACTIVE != image->conductor_fields.state ||
+        endpoint->is_checksum_enabled ||
+        1 != endpoint->destinations.length)
+    {
+        return;
+    }
+
+    aeron_receive_destination_t *destination = endpoint->destinations.array[0].destination;
+    aeron_udp_channel_transport_t *transport = &destination->transport;
+    uint8_t *buffer = receiver->recv_buffers.iov[0].iov_base;
+    struct sockaddr_storage *addr = &receiver->recv_buffers.addrs[0];
+
+    if (0 != destination->fanout_transports_length || transport->destination_clientd != destination)
+    {
+        return;
+    }
+
+    for (size_t i = 0, count = receiver->recv_buffers.count; i < count; i++)
+    {
+        const int64_t position = aeron_publication_image_in_order_position(image);
+        if (position < 0)
+        {
+            break;
+        }
+
+        const int32_t term_offset = (int32_t)(position & image->term_length_mask);
+        const size_t index = aeron_logbuffer_index_by_position(position, image->position_bits_to_shift);
+        uint8_t *frame = image->mapped_raw_log.term_buffers[index].addr + term_offset;
+        const size_t term_remaining = (size_t)(image->term_length - term_offset) - AERON_DATA_HEADER_LENGTH;
+        const size_t max_payload_length = AERON_DRIVER_RECEIVER_MAX_UDP_PACKET_LENGTH - AERON_DATA_HEADER_LENGTH;
+        const size_t in_place_length = term_remaining < max_payload_length ? term_remaining : max_payload_length;
+
+        if (0 != ((aeron_frame_header_t *)frame)->frame_length)
+        {
+            break;
+        }
+
+        struct iovec iov[3];
+        iov[0].iov_base = buffer;
+        iov[0].iov_len = AERON_DATA_HEADER_LENGTH;
+        iov[1].iov_base = frame + AERON_DATA_HEADER_LENGTH;
+        iov[1].iov_len = in_place_length;
+        iov[2].iov_base = buffer + AERON_DATA_HEADER_LENGTH + in_place_length;
+        iov[2].iov_len = max_payload_length - in_place_length;
+
+        struct msghdr msghdr;
+        memset(&msghdr, 0, sizeof(msghdr));
+        msghdr.msg_name = addr;
+        msghdr.msg_namelen = sizeof(struct sockaddr_storage);
+        msghdr.msg_iov = iov;
+        msghdr.msg_iovlen = 0 == iov[2].iov_len ? 2 : 3;
+
+        size_t length = 0;
+        int result = aeron_udp_channel_transport_recv_scattered(transport, &msghdr, &length);
+        if (result <= 0)
+        {
+            if (result < 0)
+            {
+                AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver zero copy recv: %s", aeron_errmsg());
+            }
+            break;
+        }
+
+        const size_t payload_length = length > AERON_DATA_HEADER_LENGTH ? length - AERON_DATA_HEADER_LENGTH : 0;
+        const size_t received_in_place = payload_length < in_place_length ? payload_length : in_place_length;
+        const aeron_data_header_t *header = (aeron_data_header_t *)buffer;
+
+        if (payload_length <= in_place_length && aeron_driver_receiver_is_in_place_frame(image, header, position, length))
+        {
+            *bytes_received += (int64_t)length;
+            transport->recv_timestamp_ns = 0;
+            aeron_receive_destination_update_last_activity_ns(
+                destination, aeron_clock_cached_nano_time(receiver->context->cached_clock));
+
+            aeron_publication_image_insert_packet_in_place(image, destination, buffer, length, addr);
+
+            if (received_in_place > 0 && 0 == ((aeron_frame_header_t *)frame)->frame_length)
+            {
+                memset(frame + AERON_DATA_HEADER_LENGTH, 0, received_in_place);
+            }
+        }
+        else
+        {
+            memcpy(buffer + AERON_DATA_HEADER_LENGTH, frame + AERON_DATA_HEADER_LENGTH, received_in_place);
+            memset(frame + AERON_DATA_HEADER_LENGTH, 0, received_in_place);
+
+            msghdr.msg_controllen = 0;
+            aeron_udp_channel_transport_dispatch(
+                transport, &msghdr, buffer, length, addr, bytes_received, receiver->data_paths.recv_func, receiver);
+            break;
+        }
+    }
+}
+
 int aeron_driver_receiver_do_work(void *clientd)
 {
-    struct mmsghdr mmsghdr[AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS];
     aeron_driver_receiver_t *receiver = (aeron_driver_receiver_t *)clientd;
     int64_t bytes_received = 0;
     int work_count = 0;
@@ -129,22 +371,26 @@ int aeron_driver_receiver_do_work(void *clientd)
     work_count += (int)aeron_spsc_concurrent_array_queue_drain(
         receiver->receiver_proxy.command_queue, aeron_driver_receiver_on_command, receiver, 10);
 
-    for (size_t i = 0; i < AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS; i++)
+    if (receiver->is_zero_copy_enabled)
+    {
+        aeron_driver_receiver_zero_copy_recv(receiver, &bytes_received);
+    }
+
+    struct mmsghdr *mmsghdr = receiver->recv_buffers.mmsghdrs;
+    const size_t controllen = receiver->recv_buffers.control_length;
+
+    for (size_t i = 0, count = receiver->recv_buffers.count; i < count; i++)
     {
-        mmsghdr[i].msg_hdr.msg_name = &receiver->recv_buffers.addrs[i];
         mmsghdr[i].msg_hdr.msg_namelen = sizeof(receiver->recv_buffers.addrs[i]);
-        mmsghdr[i].msg_hdr.msg_iov = &receiver->recv_buffers.iov[i];
-        mmsghdr[i].msg_hdr.msg_iovlen = 1;
         mmsghdr[i].msg_hdr.msg_flags = 0;
-        mmsghdr[i].msg_hdr.msg_control = NULL;
-        mmsghdr[i].msg_hdr.msg_controllen = 0;
+        mmsghdr[i].msg_hdr.msg_controllen = controllen;
         mmsghdr[i].msg_len = 0;
     }
 
     int poll_result = receiver->poller_poll_func(
         &receiver->poller,
         mmsghdr,
-        AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS,
+        receiver->recv_buffers.count,
         &bytes_received,
         receiver->data_paths.recv_func,
         receiver->recvmmsg_func,
@@ -155,39 +401,57 @@ int aeron_driver_receiver_do_work(void *clientd)
         AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver poller_poll: %s", aeron_errmsg());
     }
 
+    aeron_publication_image_t *batched_image = receiver->receive_batch;
+    receiver->receive_batch = NULL;
+
+    while (NULL != batched_image)
+    {
+        aeron_publication_image_t *next_image = batched_image->next_in_receive_batch;
+        aeron_publication_image_flush_receive_batch(batched_image);
+        batched_image = next_image;
+    }
+
     work_count += bytes_received > 0 ? (int)bytes_received : 0;
 
-    aeron_counter_add_ordered(receiver->total_bytes_received_counter, bytes_received);
+    if (bytes_received > 0)
+    {
+        aeron_system_counter_add(
+            receiver->total_bytes_received_counter, bytes_received, receiver->has_shared_counters);
+    }
+
+    work_count += aeron_udp_channel_data_paths_do_work(&receiver->data_paths);
 
     int64_t now_ns = aeron_clock_cached_nano_time(receiver->context->cached_clock);
 
-    for (size_t i = 0, length = receiver->images.length; i < length; i++)
+    aeron_spsc_concurrent_array_queue_drain_all(
+        &receiver->attention_queue, aeron_driver_receiver_on_image_attention, receiver);
+
+    if (now_ns >= receiver->image_scan_deadline_ns)
     {
-        aeron_publication_image_t *image = receiver->images.array[i].image;
+        receiver->image_scan_deadline_ns = now_ns + AERON_DRIVER_RECEIVER_IMAGE_SCAN_INTERVAL_NS;
 
-        int send_sm_result = aeron_publication_image_send_pending_status_message(image);
-        if (send_sm_result < 0)
+        for (size_t i = 0, length = receiver->images.length; i < length; i++)
         {
-            AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver send SM: %s", aeron_errmsg());
+            work_count += aeron_driver_receiver_image_do_work(receiver, receiver->images.array[i].image, now_ns, true);
         }
+    }
 
-        work_count += send_sm_result < 0 ? 0 : send_sm_result;
+    if (receiver->has_queued_control_frames)
+    {
+        receiver->has_queued_control_frames = false;
 
-        int send_nak_result = aeron_publication_image_send_pending_loss(image);
-        if (send_nak_result < 0)
+        for (size_t i = 0, length = receiver->images.length; i < length; i++)
         {
-            AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver send NAK: %s", aeron_errmsg());
-        }
+            aeron_receive_channel_endpoint_t *endpoint = receiver->images.array[i].image->endpoint;
 
-        work_count += send_nak_result < 0 ? 0 : send_nak_result;
-
-        int initiate_rttm_result = aeron_publication_image_initiate_rttm(image, now_ns);
-        if (send_nak_result < 0)
-        {
-            AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver send RTTM: %s", aeron_errmsg());
+            if (NULL != endpoint && endpoint->control_batch.length > 0)
+            {
+                if (aeron_receive_channel_endpoint_flush_control_frames(endpoint) < 0)
+                {
+                    AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver flush control frames: %s", aeron_errmsg());
+                }
+            }
         }
-
-        work_count += initiate_rttm_result < 0 ? 0 : initiate_rttm_result;
     }
 
     for (int last_index = (int)receiver->pending_setups.length - 1, i = last_index; i >= 0; i--)
@@ -247,12 +511,19 @@ void aeron_driver_receiver_on_close(void *clientd)
 {
     aeron_driver_receiver_t *receiver = (aeron_driver_receiver_t *)clientd;
 
-    for (size_t i = 0; i < AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS; i++)
+    for (size_t i = 0; i < receiver->recv_buffers.count; i++)
     {
         aeron_free(receiver->recv_buffers.buffers[i]);
     }
 
+    aeron_free(receiver->recv_buffers.buffers);
+    aeron_free(receiver->recv_buffers.iov);
+    aeron_free(receiver->recv_buffers.addrs);
+    aeron_free(receiver->recv_buffers.controls);
+    aeron_free(receiver->recv_buffers.mmsghdrs);
+
     aeron_free(receiver->images.array);
+    aeron_spsc_concurrent_array_queue_close(&receiver->attention_queue);
     aeron_free(receiver->pending_setups.array);
     aeron_udp_channel_data_paths_delete(&receiver->data_paths);
 
@@ -364,25 +635,36 @@ void aeron_driver_receiver_on_add_destination(void *clientd, void *item)
         return;
     }
 
-    if (aeron_udp_channel_interceptors_transport_notifications(
-        destination->data_paths,
-        &destination->transport,
-        destination->conductor_fields.udp_channel,
-        &endpoint->dispatcher,
-        AERON_UDP_CHANNEL_INTERCEPTOR_ADD_NOTIFICATION) < 0)
+    for (size_t i = 0, count = aeron_receive_destination_transport_count(destination); i < count; i++)
     {
-        AERON_DRIVER_RECEIVER_ERROR(
-            receiver, "on_add_destination, interceptors transport notifications: %s", aeron_errmsg());
-    }
+        aeron_udp_channel_transport_t *transport = aeron_receive_destination_transport(destination, i);
 
-    if (endpoint->transport_bindings->poller_add_func(&receiver->poller, &destination->transport) < 0)
-    {
-        AERON_DRIVER_RECEIVER_ERROR(receiver, "on_add_destination, add to poller: %s", aeron_errmsg());
+        if (aeron_udp_channel_interceptors_transport_notifications(
+            destination->data_paths,
+            transport,
+            destination->conductor_fields.udp_channel,
+            &endpoint->dispatcher,
+            AERON_UDP_CHANNEL_INTERCEPTOR_ADD_NOTIFICATION) < 0)
+        {
+            AERON_DRIVER_RECEIVER_ERROR(
+                receiver, "on_add_destination, interceptors transport notifications: %s", aeron_errmsg());
+        }
 
-        // Clean up earlier steps...
-        aeron_receive_channel_endpoint_remove_destination(endpoint, destination->conductor_fields.udp_channel, NULL);
+        if (endpoint->transport_bindings->poller_add_func(&receiver->poller, transport) < 0)
+        {
+            AERON_DRIVER_RECEIVER_ERROR(receiver, "on_add_destination, add to poller: %s", aeron_errmsg());
 
-        return;
+            // Clean up earlier steps...
+            for (size_t j = 0; j < i; j++)
+            {
+                endpoint->transport_bindings->poller_remove_func(
+                    &receiver->poller, aeron_receive_destination_transport(destination, j));
+            }
+            aeron_receive_channel_endpoint_remove_destination(
+                endpoint, destination->conductor_fields.udp_channel, NULL);
+
+            return;
+        }
     }
 
     if (destination->conductor_fields.udp_channel->has_explicit_control)
@@ -393,8 +675,12 @@ void aeron_driver_receiver_on_add_destination(void *clientd, void *item)
 
             // Clean up earlier steps...
             aeron_receive_channel_endpoint_remove_destination(endpoint, destination->conductor_fields.udp_channel, NULL);
-            endpoint->transport_bindings->poller_remove_func(&receiver->poller, &destination->transport);
-            endpoint->transport_bindings->close_func(&destination->transport);
+            for (size_t i = 0, count = aeron_receive_destination_transport_count(destination); i < count; i++)
+            {
+                aeron_udp_channel_transport_t *transport = aeron_receive_destination_transport(destination, i);
+                endpoint->transport_bindings->poller_remove_func(&receiver->poller, transport);
+                endpoint->transport_bindings->close_func(transport);
+            }
 
             return;
         }
@@ -420,19 +706,24 @@ void aeron_driver_receiver_on_remove_destination(void *clientd, void *item)
 
     if (0 < aeron_receive_channel_endpoint_remove_destination(endpoint, channel, &destination) && NULL != destination)
     {
-        if (aeron_udp_channel_interceptors_transport_notifications(
-            destination->data_paths,
-            &destination->transport,
-            destination->conductor_fields.udp_channel,
-            &endpoint->dispatcher,
-            AERON_UDP_CHANNEL_INTERCEPTOR_REMOVE_NOTIFICATION) < 0)
+        for (size_t i = 0, count = aeron_receive_destination_transport_count(destination); i < count; i++)
         {
-            AERON_DRIVER_RECEIVER_ERROR(
-                receiver, "on_add_destination, interceptors transport notifications: %s", aeron_errmsg());
-        }
+            aeron_udp_channel_transport_t *transport = aeron_receive_destination_transport(destination, i);
+
+            if (aeron_udp_channel_interceptors_transport_notifications(
+                destination->data_paths,
+                transport,
+                destination->conductor_fields.udp_channel,
+                &endpoint->dispatcher,
+                AERON_UDP_CHANNEL_INTERCEPTOR_REMOVE_NOTIFICATION) < 0)
+            {
+                AERON_DRIVER_RECEIVER_ERROR(
+                    receiver, "on_add_destination, interceptors transport notifications: %s", aeron_errmsg());
+            }
 
-        endpoint->transport_bindings->poller_remove_func(&receiver->poller, &destination->transport);
-        endpoint->transport_bindings->close_func(&destination->transport);
+            endpoint->transport_bindings->poller_remove_func(&receiver->poller, transport);
+            endpoint->transport_bindings->close_func(transport);
+        }
 
         for (size_t i = 0, len = receiver->images.length; i < len; i++)
         {
@@ -463,6 +754,12 @@ void aeron_driver_receiver_on_add_publication_image(void *clientd, void *item)
     }
 
     receiver->images.array[receiver->images.length++].image = cmd->image;
+    ((aeron_publication_image_t *)cmd->image)->receive_batch = &receiver->receive_batch;
+
+    if (NULL != receiver->trace_ring.descriptor)
+    {
+        ((aeron_publication_image_t *)cmd->image)->trace_ring = &receiver->trace_ring;
+    }
 }
 
 void aeron_driver_receiver_on_remove_publication_image(void *clientd, void *item)
@@ -476,6 +773,10 @@ void aeron_driver_receiver_on_remove_publication_image(void *clientd, void *item
         AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver on_remove_publication_image: %s", aeron_errmsg());
     }
 
+    /* no further attention is requested once an image is removed, so clear any still queued for it */
+    aeron_spsc_concurrent_array_queue_drain_all(
+        &receiver->attention_queue, aeron_driver_receiver_on_image_attention, receiver);
+
     for (size_t i = 0, size = receiver->images.length, last_index = size - 1; i < size; i++)
     {
         if (cmd->image == receiver->images.array[i].image)
@@ -518,7 +819,7 @@ void aeron_driver_receiver_on_resolution_change(void *clientd, void *item)
             pending_setup->is_periodic)
         {
             memcpy(&pending_setup->control_addr, &cmd->new_addr, sizeof(pending_setup->control_addr));
-            aeron_counter_add_ordered(receiver->resolution_changes_counter, 1);
+            aeron_system_counter_add(receiver->resolution_changes_counter, 1, receiver->has_shared_counters);
         }
     }
 
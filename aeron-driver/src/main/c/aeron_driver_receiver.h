@@ -23,8 +23,12 @@
 #include "aeron_driver_receiver_proxy.h"
 #include "aeron_system_counters.h"
 #include "media/aeron_udp_channel.h"
+#include "concurrent/aeron_spsc_concurrent_array_queue.h"
+#include "concurrent/aeron_trace_ring.h"
 
 #define AERON_DRIVER_RECEIVER_PENDING_SETUP_TIMEOUT_NS (1000 * 1000 * 1000LL)
+#define AERON_DRIVER_RECEIVER_ATTENTION_QUEUE_CAPACITY (4 * 1024)
+#define AERON_DRIVER_RECEIVER_IMAGE_SCAN_INTERVAL_NS (1000 * 1000LL)
 
 typedef struct aeron_driver_receiver_image_entry_stct
 {
@@ -46,14 +50,25 @@ aeron_driver_receiver_pending_setup_entry_t;
 
 typedef struct aeron_driver_receiver_stct
 {
+    /* read by the conductor to hand commands to the receiver, the rest is only touched on the receiver thread */
     aeron_driver_receiver_proxy_t receiver_proxy;
+
+    /* images the conductor has scheduled an SM or NAK for, so idle images are only visited by the periodic scan */
+    aeron_spsc_concurrent_array_queue_t attention_queue;
+
+    uint8_t receiver_proxy_padding[2 * AERON_CACHE_LINE_LENGTH];
+
     aeron_udp_transport_poller_t poller;
 
     struct aeron_driver_receiver_buffers_stct
     {
-        uint8_t *buffers[AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS];
-        struct iovec iov[AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS];
-        struct sockaddr_storage addrs[AERON_DRIVER_RECEIVER_NUM_RECV_BUFFERS];
+        size_t count;
+        size_t control_length;
+        uint8_t **buffers;
+        struct iovec *iov;
+        struct sockaddr_storage *addrs;
+        uint8_t *controls;
+        struct mmsghdr *mmsghdrs;
     }
     recv_buffers;
 
@@ -65,6 +80,16 @@ typedef struct aeron_driver_receiver_stct
     }
     images;
 
+    int64_t image_scan_deadline_ns;
+    bool has_queued_control_frames;
+
+    /* images with in order frames from the current receive batch whose hwm is published once the batch is dispatched */
+    aeron_publication_image_t *receive_batch;
+
+    /* receive straight into the term of a single in order image when nothing needs to see the datagram first */
+    bool is_zero_copy_enabled;
+    bool has_shared_counters;
+
     struct aeron_driver_receiver_pending_setups_stct
     {
         aeron_driver_receiver_pending_setup_entry_t *array;
@@ -74,6 +99,7 @@ typedef struct aeron_driver_receiver_stct
     pending_setups;
 
     aeron_udp_channel_data_paths_t data_paths;
+    aeron_trace_ring_t trace_ring;
 
     aeron_driver_context_t *context;
     aeron_udp_transport_poller_poll_func_t poller_poll_func;
@@ -85,6 +111,8 @@ typedef struct aeron_driver_receiver_stct
     int64_t *invalid_frames_counter;
     int64_t *total_bytes_received_counter;
     int64_t *resolution_changes_counter;
+
+    uint8_t padding[2 * AERON_CACHE_LINE_LENGTH];
 }
 aeron_driver_receiver_t;
 
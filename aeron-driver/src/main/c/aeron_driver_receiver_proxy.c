@@ -24,7 +24,24 @@ void aeron_driver_receiver_proxy_offer(aeron_driver_receiver_proxy_t *receiver_p
     while (aeron_spsc_concurrent_array_queue_offer(receiver_proxy->command_queue, cmd) != AERON_OFFER_SUCCESS)
     {
         aeron_counter_ordered_increment(receiver_proxy->fail_counter, 1);
-        sched_yield();
+        aeron_spsc_concurrent_array_queue_wait_for_space(receiver_proxy->command_queue, AERON_QUEUE_SPACE_WAIT_SLICE_NS);
+    }
+}
+
+void aeron_driver_receiver_proxy_offer_bulk(aeron_driver_receiver_proxy_t *receiver_proxy, aeron_command_base_t **cmds, size_t length)
+{
+    size_t offered = 0;
+
+    while (offered < length)
+    {
+        offered += (size_t)aeron_spsc_concurrent_array_queue_offer_bulk(
+            receiver_proxy->command_queue, (void **)(cmds + offered), length - offered);
+
+        if (offered < length)
+        {
+            aeron_counter_ordered_increment(receiver_proxy->fail_counter, 1);
+            aeron_spsc_concurrent_array_queue_wait_for_space(receiver_proxy->command_queue, AERON_QUEUE_SPACE_WAIT_SLICE_NS);
+        }
     }
 }
 
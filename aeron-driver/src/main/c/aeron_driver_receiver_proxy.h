@@ -33,6 +33,13 @@ typedef struct aeron_driver_receiver_proxy_stct
 }
 aeron_driver_receiver_proxy_t;
 
+/*
+ * Offer commands built by the caller in one pass, blocking while the queue is full rather than spinning. Only for
+ * threading modes where the receiver runs on its own thread.
+ */
+void aeron_driver_receiver_proxy_offer_bulk(
+    aeron_driver_receiver_proxy_t *receiver_proxy, aeron_command_base_t **cmds, size_t length);
+
 void aeron_driver_receiver_proxy_on_delete_cmd(
     aeron_driver_receiver_proxy_t *receiver_proxy, aeron_command_base_t *cmd);
 
@@ -146,5 +153,4 @@ void aeron_driver_receiver_proxy_on_resolution_change(
     void *destination,
     struct sockaddr_storage *new_addr);
 
-
 #endif //AERON_DRIVER_RECEIVER_PROXY_H
@@ -0,0 +1,514 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _GNU_SOURCE
+#endif
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "aeron_windows.h"
+#include "aeron_alloc.h"
+#include "aeron_driver_recorder.h"
+#include "command/aeron_control_protocol.h"
+#include "protocol/aeron_udp_protocol.h"
+#include "util/aeron_arrayutil.h"
+#include "util/aeron_bitutil.h"
+#include "util/aeron_error.h"
+#include "util/aeron_fileutil.h"
+
+#if !defined(_MSC_VER)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#endif
+
+#if !defined(_MSC_VER)
+static int aeron_driver_recorder_write_fully(int fd, const void *buffer, size_t length, int64_t offset)
+{
+    const uint8_t *remaining = (const uint8_t *)buffer;
+
+    while (length > 0)
+    {
+        ssize_t result = pwrite(fd, remaining, length, (off_t)offset);
+        if (result < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+
+            return -1;
+        }
+
+        remaining += result;
+        length -= (size_t)result;
+        offset += result;
+    }
+
+    return 0;
+}
+#endif
+
+static void aeron_driver_recorder_record_error(aeron_driver_recorder_t *recorder)
+{
+    aeron_distinct_error_log_record(recorder->error_log, AERON_ERROR_CODE_GENERIC_ERROR, aeron_errmsg(), "");
+}
+
+static void aeron_driver_recorder_on_client_error(void *clientd, int errcode, const char *message)
+{
+    aeron_driver_recorder_t *recorder = (aeron_driver_recorder_t *)clientd;
+
+    aeron_distinct_error_log_record(recorder->error_log, errcode, message, "");
+}
+
+int aeron_driver_recorder_init(
+    aeron_driver_recorder_t *recorder,
+    const char *aeron_dir,
+    const char *channel,
+    int32_t stream_id,
+    const char *recorder_dir,
+    size_t segment_length,
+    aeron_distinct_error_log_t *error_log)
+{
+    recorder->aeron_dir = aeron_dir;
+    recorder->channel = channel;
+    recorder->stream_id = stream_id;
+    recorder->recorder_dir = recorder_dir;
+    recorder->segment_length = segment_length;
+    recorder->client_context = NULL;
+    recorder->client = NULL;
+    recorder->async_add_subscription = NULL;
+    recorder->subscription = NULL;
+    recorder->is_subscription_failed = false;
+    recorder->catalog_fd = -1;
+    recorder->next_recording_id = 0;
+    recorder->recordings.array = NULL;
+    recorder->recordings.length = 0;
+    recorder->recordings.capacity = 0;
+    recorder->error_log = error_log;
+    recorder->idle_sleep_ns = AERON_DRIVER_RECORDER_IDLE_SLEEP_NS;
+
+#if defined(_MSC_VER)
+    aeron_set_err(EINVAL, "%s", "recorder is not supported on this platform");
+    return -1;
+#else
+    if (!AERON_IS_POWER_OF_TWO(segment_length))
+    {
+        aeron_set_err(EINVAL, "recorder segment length not a power of 2: %" PRIu64, (uint64_t)segment_length);
+        return -1;
+    }
+
+    if (strlen(channel) >= AERON_DRIVER_RECORDER_CHANNEL_MAX_LENGTH)
+    {
+        aeron_set_err(EINVAL, "recorder channel too long: %s", channel);
+        return -1;
+    }
+
+    if (aeron_mkdir(recorder_dir, S_IRWXU | S_IRWXG | S_IRWXO) != 0 && EEXIST != errno)
+    {
+        aeron_set_err_from_last_err_code("mkdir %s", recorder_dir);
+        return -1;
+    }
+
+    char path[AERON_MAX_PATH];
+    snprintf(path, sizeof(path) - 1, "%s/%s", recorder_dir, AERON_DRIVER_RECORDER_CATALOG_FILE);
+
+    if ((recorder->catalog_fd = open(path, O_RDWR | O_CREAT, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH)) < 0)
+    {
+        aeron_set_err_from_last_err_code("open %s", path);
+        return -1;
+    }
+
+    struct stat catalog_stat;
+    if (fstat(recorder->catalog_fd, &catalog_stat) < 0)
+    {
+        aeron_set_err_from_last_err_code("fstat %s", path);
+        close(recorder->catalog_fd);
+        recorder->catalog_fd = -1;
+        return -1;
+    }
+
+    recorder->next_recording_id = (int64_t)(
+        (catalog_stat.st_size + AERON_DRIVER_RECORDER_CATALOG_ENTRY_LENGTH - 1) /
+        AERON_DRIVER_RECORDER_CATALOG_ENTRY_LENGTH);
+
+    return 0;
+#endif
+}
+
+#if !defined(_MSC_VER)
+static int aeron_driver_recorder_write_catalog_entry(
+    aeron_driver_recorder_t *recorder, const aeron_driver_recorder_catalog_entry_t *entry)
+{
+    if (aeron_driver_recorder_write_fully(
+        recorder->catalog_fd,
+        entry,
+        sizeof(aeron_driver_recorder_catalog_entry_t),
+        entry->recording_id * AERON_DRIVER_RECORDER_CATALOG_ENTRY_LENGTH) < 0)
+    {
+        aeron_set_err_from_last_err_code("recorder write catalog entry %" PRId64, entry->recording_id);
+        return -1;
+    }
+
+    return 0;
+}
+
+static void aeron_driver_recorder_stop_recording(aeron_driver_recording_t *recording)
+{
+    aeron_driver_recorder_t *recorder = recording->recorder;
+    int64_t stop[2] = { aeron_epoch_clock(), recording->position };
+
+    if (recording->segment_fd >= 0)
+    {
+        close(recording->segment_fd);
+        recording->segment_fd = -1;
+    }
+
+    if (aeron_driver_recorder_write_fully(
+        recorder->catalog_fd,
+        stop,
+        sizeof(stop),
+        (recording->recording_id * AERON_DRIVER_RECORDER_CATALOG_ENTRY_LENGTH) +
+            (int64_t)offsetof(aeron_driver_recorder_catalog_entry_t, stop_timestamp)) < 0)
+    {
+        aeron_set_err_from_last_err_code("recorder stop recording %" PRId64, recording->recording_id);
+        aeron_driver_recorder_record_error(recorder);
+    }
+}
+
+static int aeron_driver_recorder_open_segment(aeron_driver_recording_t *recording, int64_t segment_base_position)
+{
+    aeron_driver_recorder_t *recorder = recording->recorder;
+    char path[AERON_MAX_PATH];
+
+    if (recording->segment_fd >= 0)
+    {
+        close(recording->segment_fd);
+        recording->segment_fd = -1;
+    }
+
+    snprintf(path, sizeof(path) - 1, "%s/%" PRId64 "-%" PRId64 "%s",
+        recorder->recorder_dir, recording->recording_id, segment_base_position, AERON_DRIVER_RECORDER_SEGMENT_FILE_SUFFIX);
+
+    if ((recording->segment_fd = open(path, O_RDWR | O_CREAT, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH)) < 0)
+    {
+        aeron_set_err_from_last_err_code("open %s", path);
+        return -1;
+    }
+
+    recording->segment_base_position = segment_base_position;
+
+    return 0;
+}
+
+static void aeron_driver_recorder_on_block(
+    void *clientd, const uint8_t *buffer, size_t length, int32_t session_id, int32_t term_id)
+{
+    aeron_driver_recording_t *recording = (aeron_driver_recording_t *)clientd;
+    const int64_t position = recording->position;
+    const aeron_frame_header_t *frame_header = (const aeron_frame_header_t *)buffer;
+
+    recording->position = position + (int64_t)length;
+
+    if (recording->is_failed)
+    {
+        return;
+    }
+
+    /* a block never straddles a segment as a segment is a whole number of terms */
+    const int64_t segment_length = (int64_t)recording->recorder->segment_length;
+    const int64_t segment_base_position = recording->start_term_base_position +
+        ((position - recording->start_term_base_position) & ~(segment_length - 1));
+
+    if (recording->segment_fd < 0 || segment_base_position != recording->segment_base_position)
+    {
+        if (aeron_driver_recorder_open_segment(recording, segment_base_position) < 0)
+        {
+            goto error;
+        }
+    }
+
+    /* only the header of padding is kept, as the archive does, which leaves the rest of the range sparse */
+    const size_t write_length = AERON_HDR_TYPE_PAD == frame_header->type ? AERON_DATA_HEADER_LENGTH : length;
+
+    if (aeron_driver_recorder_write_fully(
+        recording->segment_fd, buffer, write_length, position - segment_base_position) < 0)
+    {
+        aeron_set_err_from_last_err_code("recorder write recording %" PRId64, recording->recording_id);
+        goto error;
+    }
+
+    return;
+
+error:
+    aeron_driver_recorder_record_error(recording->recorder);
+    recording->position = position;
+    recording->is_failed = true;
+    aeron_driver_recorder_stop_recording(recording);
+}
+
+static void aeron_driver_recorder_on_available_image(
+    void *clientd, aeron_subscription_t *subscription, aeron_image_t *image)
+{
+    aeron_driver_recorder_t *recorder = (aeron_driver_recorder_t *)clientd;
+    aeron_image_constants_t constants;
+    aeron_driver_recorder_catalog_entry_t entry;
+    int ensure_capacity_result = 0;
+
+    if (aeron_image_constants(image, &constants) < 0)
+    {
+        goto error;
+    }
+
+    if (constants.term_buffer_length > recorder->segment_length)
+    {
+        aeron_set_err(
+            EINVAL,
+            "recorder segment length %" PRIu64 " less than term length %" PRIu64 " of session %" PRId32,
+            (uint64_t)recorder->segment_length,
+            (uint64_t)constants.term_buffer_length,
+            constants.session_id);
+        goto error;
+    }
+
+    AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, recorder->recordings, aeron_driver_recording_t)
+    if (ensure_capacity_result < 0)
+    {
+        goto error;
+    }
+
+    memset(&entry, 0, sizeof(entry));
+    entry.recording_id = recorder->next_recording_id;
+    entry.start_timestamp = aeron_epoch_clock();
+    entry.stop_timestamp = AERON_NULL_VALUE;
+    entry.start_position = constants.join_position;
+    entry.stop_position = AERON_NULL_VALUE;
+    entry.initial_term_id = constants.initial_term_id;
+    entry.segment_file_length = (int32_t)recorder->segment_length;
+    entry.term_buffer_length = (int32_t)constants.term_buffer_length;
+    entry.mtu_length = (int32_t)constants.mtu_length;
+    entry.session_id = constants.session_id;
+    entry.stream_id = recorder->stream_id;
+    strncpy(entry.channel, recorder->channel, sizeof(entry.channel) - 1);
+    strncpy(entry.source_identity, constants.source_identity, sizeof(entry.source_identity) - 1);
+
+    if (aeron_driver_recorder_write_catalog_entry(recorder, &entry) < 0)
+    {
+        goto error;
+    }
+
+    aeron_driver_recording_t *recording = &recorder->recordings.array[recorder->recordings.length++];
+    recording->recorder = recorder;
+    recording->image = image;
+    recording->recording_id = recorder->next_recording_id++;
+    recording->position = constants.join_position;
+    recording->start_term_base_position =
+        constants.join_position - (constants.join_position & ((int64_t)constants.term_buffer_length - 1));
+    recording->segment_base_position = AERON_NULL_VALUE;
+    recording->block_length_limit = constants.term_buffer_length < AERON_DRIVER_RECORDER_BLOCK_LENGTH_MAX ?
+        constants.term_buffer_length : AERON_DRIVER_RECORDER_BLOCK_LENGTH_MAX;
+    recording->segment_fd = -1;
+    recording->is_failed = false;
+
+    return;
+
+error:
+    aeron_driver_recorder_record_error(recorder);
+}
+
+static void aeron_driver_recorder_on_unavailable_image(
+    void *clientd, aeron_subscription_t *subscription, aeron_image_t *image)
+{
+    aeron_driver_recorder_t *recorder = (aeron_driver_recorder_t *)clientd;
+
+    for (size_t i = 0, length = recorder->recordings.length; i < length; i++)
+    {
+        aeron_driver_recording_t *recording = &recorder->recordings.array[i];
+
+        if (image == recording->image)
+        {
+            if (!recording->is_failed)
+            {
+                aeron_driver_recorder_stop_recording(recording);
+            }
+
+            aeron_array_fast_unordered_remove(
+                (uint8_t *)recorder->recordings.array, sizeof(aeron_driver_recording_t), i, length - 1);
+            recorder->recordings.length--;
+            break;
+        }
+    }
+}
+
+static int aeron_driver_recorder_connect(aeron_driver_recorder_t *recorder)
+{
+    if (aeron_context_init(&recorder->client_context) < 0 ||
+        aeron_context_set_dir(recorder->client_context, recorder->aeron_dir) < 0 ||
+        aeron_context_set_use_conductor_agent_invoker(recorder->client_context, true) < 0 ||
+        aeron_context_set_error_handler(
+            recorder->client_context, aeron_driver_recorder_on_client_error, recorder) < 0)
+    {
+        goto error;
+    }
+
+    if (aeron_init(&recorder->client, recorder->client_context) < 0)
+    {
+        recorder->client = NULL;
+        goto error;
+    }
+
+    if (aeron_start(recorder->client) < 0)
+    {
+        goto error;
+    }
+
+    return 0;
+
+error:
+    aeron_close(recorder->client);
+    recorder->client = NULL;
+    aeron_context_close(recorder->client_context);
+    recorder->client_context = NULL;
+
+    return -1;
+}
+
+int aeron_driver_recorder_do_work(void *clientd)
+{
+    aeron_driver_recorder_t *recorder = (aeron_driver_recorder_t *)clientd;
+    int work_count = 0;
+
+    if (NULL == recorder->client)
+    {
+        if (aeron_driver_recorder_connect(recorder) < 0)
+        {
+            aeron_driver_recorder_record_error(recorder);
+            return 0;
+        }
+
+        work_count++;
+    }
+
+    const int client_work_count = aeron_main_do_work(recorder->client);
+    if (client_work_count < 0)
+    {
+        aeron_driver_recorder_record_error(recorder);
+    }
+    else
+    {
+        work_count += client_work_count;
+    }
+
+    if (NULL == recorder->subscription && !recorder->is_subscription_failed)
+    {
+        if (NULL == recorder->async_add_subscription)
+        {
+            if (aeron_async_add_subscription(
+                &recorder->async_add_subscription,
+                recorder->client,
+                recorder->channel,
+                recorder->stream_id,
+                aeron_driver_recorder_on_available_image,
+                recorder,
+                aeron_driver_recorder_on_unavailable_image,
+                recorder) < 0)
+            {
+                recorder->async_add_subscription = NULL;
+                aeron_driver_recorder_record_error(recorder);
+                return work_count;
+            }
+
+            work_count++;
+        }
+
+        const int poll_result = aeron_async_add_subscription_poll(
+            &recorder->subscription, recorder->async_add_subscription);
+        if (poll_result < 0)
+        {
+            /* a timeout is retried while a channel rejected by the driver would be rejected again */
+            recorder->is_subscription_failed = ETIMEDOUT != aeron_errcode();
+            recorder->async_add_subscription = NULL;
+            aeron_driver_recorder_record_error(recorder);
+        }
+        else if (poll_result > 0)
+        {
+            recorder->async_add_subscription = NULL;
+            work_count++;
+        }
+    }
+
+    for (size_t i = 0; i < recorder->recordings.length; i++)
+    {
+        aeron_driver_recording_t *recording = &recorder->recordings.array[i];
+        const int bytes_polled = aeron_image_block_poll(
+            recording->image, aeron_driver_recorder_on_block, recording, recording->block_length_limit);
+
+        if (bytes_polled < 0)
+        {
+            aeron_driver_recorder_record_error(recorder);
+        }
+        else
+        {
+            work_count += bytes_polled > 0 ? 1 : 0;
+        }
+    }
+
+    return work_count;
+}
+
+void aeron_driver_recorder_on_close(void *clientd)
+{
+    aeron_driver_recorder_t *recorder = (aeron_driver_recorder_t *)clientd;
+
+    for (size_t i = 0; i < recorder->recordings.length; i++)
+    {
+        if (!recorder->recordings.array[i].is_failed)
+        {
+            aeron_driver_recorder_stop_recording(&recorder->recordings.array[i]);
+        }
+    }
+
+    recorder->recordings.length = 0;
+
+    aeron_close(recorder->client);
+    recorder->client = NULL;
+    aeron_context_close(recorder->client_context);
+    recorder->client_context = NULL;
+
+    if (recorder->catalog_fd >= 0)
+    {
+        close(recorder->catalog_fd);
+        recorder->catalog_fd = -1;
+    }
+
+    aeron_free(recorder->recordings.array);
+    recorder->recordings.array = NULL;
+    recorder->recordings.capacity = 0;
+}
+#else
+int aeron_driver_recorder_do_work(void *clientd)
+{
+    return 0;
+}
+
+void aeron_driver_recorder_on_close(void *clientd)
+{
+}
+#endif
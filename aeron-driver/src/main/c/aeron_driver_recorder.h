@@ -0,0 +1,125 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_DRIVER_RECORDER_H
+#define AERON_DRIVER_RECORDER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "aeronc.h"
+#include "concurrent/aeron_distinct_error_log.h"
+
+#define AERON_DRIVER_RECORDER_IDLE_SLEEP_NS (100 * 1000LL)
+#define AERON_DRIVER_RECORDER_BLOCK_LENGTH_MAX (16 * 1024 * 1024)
+#define AERON_DRIVER_RECORDER_CATALOG_FILE "recorder-catalog.dat"
+#define AERON_DRIVER_RECORDER_CATALOG_ENTRY_LENGTH (1024)
+#define AERON_DRIVER_RECORDER_CHANNEL_MAX_LENGTH (512)
+#define AERON_DRIVER_RECORDER_SOURCE_IDENTITY_MAX_LENGTH (256)
+#define AERON_DRIVER_RECORDER_SEGMENT_FILE_SUFFIX ".rec"
+
+/*
+ * Catalog entries are fixed length and indexed by recording id. The stop position stays at AERON_NULL_VALUE while
+ * a recording is active so an entry left that way was not stopped cleanly and its segment files hold the data. The
+ * stop timestamp and position are adjacent so stopping a recording updates them with a single write.
+ */
+#pragma pack(push)
+#pragma pack(4)
+typedef struct aeron_driver_recorder_catalog_entry_stct
+{
+    int64_t recording_id;
+    int64_t start_timestamp;
+    int64_t start_position;
+    int64_t stop_timestamp;
+    int64_t stop_position;
+    int32_t initial_term_id;
+    int32_t segment_file_length;
+    int32_t term_buffer_length;
+    int32_t mtu_length;
+    int32_t session_id;
+    int32_t stream_id;
+    char channel[AERON_DRIVER_RECORDER_CHANNEL_MAX_LENGTH];
+    char source_identity[AERON_DRIVER_RECORDER_SOURCE_IDENTITY_MAX_LENGTH];
+}
+aeron_driver_recorder_catalog_entry_t;
+#pragma pack(pop)
+
+typedef struct aeron_driver_recorder_stct aeron_driver_recorder_t;
+
+typedef struct aeron_driver_recording_stct
+{
+    aeron_driver_recorder_t *recorder;
+    aeron_image_t *image;
+    int64_t recording_id;
+    int64_t position;
+    int64_t start_term_base_position;
+    int64_t segment_base_position;
+    size_t block_length_limit;
+    int segment_fd;
+    bool is_failed;
+}
+aeron_driver_recording_t;
+
+/*
+ * Records the images of a channel and stream to segment files from within the driver so a C deployment can record
+ * without an archive process. The agent embeds a client driven by its own duty cycle and subscribes like any other,
+ * so a spy channel records local publications and a recording gates the publisher as a subscriber would. Blocks of
+ * frames are written at their stream position into segment files named and laid out as the archive does.
+ */
+struct aeron_driver_recorder_stct
+{
+    const char *aeron_dir;
+    const char *channel;
+    int32_t stream_id;
+    const char *recorder_dir;
+    size_t segment_length;
+    aeron_context_t *client_context;
+    aeron_t *client;
+    aeron_async_add_subscription_t *async_add_subscription;
+    aeron_subscription_t *subscription;
+    bool is_subscription_failed;
+    int catalog_fd;
+    int64_t next_recording_id;
+    struct recordings_stct
+    {
+        aeron_driver_recording_t *array;
+        size_t length;
+        size_t capacity;
+    }
+    recordings;
+    aeron_distinct_error_log_t *error_log;
+    uint64_t idle_sleep_ns;
+};
+
+/*
+ * Create the recorder directory and open the catalog. Connecting to the driver is left to the first duty cycle as the
+ * driver is not ready for clients until it has started.
+ */
+int aeron_driver_recorder_init(
+    aeron_driver_recorder_t *recorder,
+    const char *aeron_dir,
+    const char *channel,
+    int32_t stream_id,
+    const char *recorder_dir,
+    size_t segment_length,
+    aeron_distinct_error_log_t *error_log);
+
+int aeron_driver_recorder_do_work(void *clientd);
+
+void aeron_driver_recorder_on_close(void *clientd);
+
+#endif //AERON_DRIVER_RECORDER_H
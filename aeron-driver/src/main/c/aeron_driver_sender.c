@@ -34,6 +34,16 @@ struct mmsghdr
 #include "media/aeron_send_channel_endpoint.h"
 #include "aeron_driver_sender.h"
 
+#ifdef _MSC_VER
+#define _Static_assert static_assert
+#endif
+
+_Static_assert(
+    offsetof(aeron_driver_sender_t, poller) >=
+        offsetof(aeron_driver_sender_t, sender_proxy) + sizeof(aeron_driver_sender_proxy_t) +
+        (2 * AERON_CACHE_LINE_LENGTH),
+    "sender fields of aeron_driver_sender_t must not share a cache line with the sender proxy");
+
 int aeron_driver_sender_init(
     aeron_driver_sender_t *sender,
     aeron_driver_context_t *context,
@@ -46,7 +56,19 @@ int aeron_driver_sender_init(
         return -1;
     }
 
-    for (size_t i = 0; i < AERON_DRIVER_SENDER_NUM_RECV_BUFFERS; i++)
+    const size_t count = context->sender_io_vector_capacity;
+    sender->recv_buffers.count = count;
+
+    if (aeron_alloc((void **)&sender->recv_buffers.buffers, sizeof(uint8_t *) * count) < 0 ||
+        aeron_alloc((void **)&sender->recv_buffers.iov, sizeof(struct iovec) * count) < 0 ||
+        aeron_alloc((void **)&sender->recv_buffers.addrs, sizeof(struct sockaddr_storage) * count) < 0 ||
+        aeron_alloc((void **)&sender->recv_buffers.mmsghdrs, sizeof(struct mmsghdr) * count) < 0)
+    {
+        aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
+        return -1;
+    }
+
+    for (size_t i = 0; i < count; i++)
     {
         size_t offset = 0;
         if (aeron_alloc_aligned(
@@ -61,6 +83,12 @@ int aeron_driver_sender_init(
 
         sender->recv_buffers.iov[i].iov_base = sender->recv_buffers.buffers[i] + offset;
         sender->recv_buffers.iov[i].iov_len = (uint32_t)context->mtu_length;
+
+        struct mmsghdr *mmsghdr = &sender->recv_buffers.mmsghdrs[i];
+        mmsghdr->msg_hdr.msg_name = &sender->recv_buffers.addrs[i];
+        mmsghdr->msg_hdr.msg_iov = &sender->recv_buffers.iov[i];
+        mmsghdr->msg_hdr.msg_iovlen = 1;
+        mmsghdr->msg_hdr.msg_control = NULL;
     }
 
     if (aeron_udp_channel_data_paths_init(
@@ -75,6 +103,9 @@ int aeron_driver_sender_init(
         return -1;
     }
 
+    sender->trace_ring.descriptor = NULL;
+    sender->trace_ring.records = NULL;
+    sender->trace_ring.mask = 0;
     sender->context = context;
     sender->poller_poll_func = context->udp_channel_transport_bindings->poller_poll_func;
     sender->recvmmsg_func = context->udp_channel_transport_bindings->recvmmsg_func;
@@ -89,23 +120,40 @@ int aeron_driver_sender_init(
     sender->network_publications.length = 0;
     sender->network_publications.capacity = 0;
 
+    sender->heartbeat_endpoints.array = NULL;
+    sender->heartbeat_endpoints.length = 0;
+    sender->heartbeat_endpoints.capacity = 0;
+
+    sender->data_endpoints.array = NULL;
+    sender->data_endpoints.length = 0;
+    sender->data_endpoints.capacity = 0;
+
     sender->round_robin_index = 0;
+    sender->weighted_publication_count = 0;
     sender->duty_cycle_counter = 0;
     sender->duty_cycle_ratio = context->send_to_sm_poll_ratio;
+    aeron_retransmit_budget_init(&sender->retransmit_budget, context->sender_retransmit_budget_rate);
     sender->status_message_read_timeout_ns = context->status_message_timeout_ns / 2;
     sender->control_poll_timeout_ns = 0;
     sender->total_bytes_sent_counter =
         aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_BYTES_SENT);
+    sender->shard_bytes_sent_counter = NULL;
+    sender->short_sends_counter =
+        aeron_system_counter_writer_addr(
+            system_counters, AERON_SYSTEM_COUNTER_SHORT_SENDS, AERON_SYSTEM_COUNTER_WRITER_SENDER);
     sender->errors_counter =
-        aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_ERRORS);
+        aeron_system_counter_writer_addr(
+            system_counters, AERON_SYSTEM_COUNTER_ERRORS, AERON_SYSTEM_COUNTER_WRITER_SENDER);
     sender->invalid_frames_counter =
-        aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_INVALID_PACKETS);
+        aeron_system_counter_writer_addr(
+            system_counters, AERON_SYSTEM_COUNTER_INVALID_PACKETS, AERON_SYSTEM_COUNTER_WRITER_SENDER);
     sender->status_messages_received_counter =
         aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_STATUS_MESSAGES_RECEIVED);
     sender->nak_messages_received_counter =
         aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_NAK_MESSAGES_RECEIVED);
     sender->resolution_changes_counter =
-        aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_RESOLUTION_CHANGES);
+        aeron_system_counter_writer_addr(
+            system_counters, AERON_SYSTEM_COUNTER_RESOLUTION_CHANGES, AERON_SYSTEM_COUNTER_WRITER_SENDER);
 
     sender->re_resolution_deadline_ns =
         aeron_clock_cached_nano_time(context->cached_clock) + context->re_resolution_check_interval_ns;
@@ -144,16 +192,12 @@ int aeron_driver_sender_do_work(void *clientd)
         ++sender->duty_cycle_counter >= sender->duty_cycle_ratio ||
         now_ns > sender->control_poll_timeout_ns)
     {
-        struct mmsghdr mmsghdr[AERON_DRIVER_SENDER_NUM_RECV_BUFFERS];
+        struct mmsghdr *mmsghdr = sender->recv_buffers.mmsghdrs;
 
-        for (size_t i = 0; i < AERON_DRIVER_SENDER_NUM_RECV_BUFFERS; i++)
+        for (size_t i = 0, count = sender->recv_buffers.count; i < count; i++)
         {
-            mmsghdr[i].msg_hdr.msg_name = &sender->recv_buffers.addrs[i];
             mmsghdr[i].msg_hdr.msg_namelen = sizeof(sender->recv_buffers.addrs[i]);
-            mmsghdr[i].msg_hdr.msg_iov = &sender->recv_buffers.iov[i];
-            mmsghdr[i].msg_hdr.msg_iovlen = 1;
             mmsghdr[i].msg_hdr.msg_flags = 0;
-            mmsghdr[i].msg_hdr.msg_control = NULL;
             mmsghdr[i].msg_hdr.msg_controllen = 0;
             mmsghdr[i].msg_len = 0;
         }
@@ -161,7 +205,7 @@ int aeron_driver_sender_do_work(void *clientd)
         poll_result = sender->poller_poll_func(
             &sender->poller,
             mmsghdr,
-            AERON_DRIVER_SENDER_NUM_RECV_BUFFERS,
+            sender->recv_buffers.count,
             &bytes_received,
             sender->data_paths.recv_func,
             sender->recvmmsg_func,
@@ -186,6 +230,8 @@ int aeron_driver_sender_do_work(void *clientd)
         sender->control_poll_timeout_ns = now_ns + sender->status_message_read_timeout_ns;
     }
 
+    work_count += aeron_udp_channel_data_paths_do_work(&sender->data_paths);
+
     return work_count + bytes_sent;
 }
 
@@ -193,15 +239,22 @@ void aeron_driver_sender_on_close(void *clientd)
 {
     aeron_driver_sender_t *sender = (aeron_driver_sender_t *)clientd;
 
-    for (size_t i = 0; i < AERON_DRIVER_SENDER_NUM_RECV_BUFFERS; i++)
+    for (size_t i = 0; i < sender->recv_buffers.count; i++)
     {
         aeron_free(sender->recv_buffers.buffers[i]);
     }
 
+    aeron_free(sender->recv_buffers.buffers);
+    aeron_free(sender->recv_buffers.iov);
+    aeron_free(sender->recv_buffers.addrs);
+    aeron_free(sender->recv_buffers.mmsghdrs);
+
     aeron_udp_channel_data_paths_delete(&sender->data_paths);
 
     sender->context->udp_channel_transport_bindings->poller_close_func(&sender->poller);
     aeron_free(sender->network_publications.array);
+    aeron_free(sender->heartbeat_endpoints.array);
+    aeron_free(sender->data_endpoints.array);
 }
 
 void aeron_driver_sender_on_add_endpoint(void *clientd, void *command)
@@ -269,7 +322,25 @@ void aeron_driver_sender_on_add_publication(void *clientd, void *command)
         return;
     }
 
-    sender->network_publications.array[sender->network_publications.length++].publication = publication;
+    aeron_driver_sender_network_publication_entry_t *entry =
+        &sender->network_publications.array[sender->network_publications.length++];
+    entry->publication = publication;
+    entry->deficit = 0;
+    if (publication->send_weight > 0)
+    {
+        sender->weighted_publication_count++;
+    }
+
+    if (0 != sender->retransmit_budget.rate_bytes_per_sec)
+    {
+        publication->retransmit_handler.sender_budget = &sender->retransmit_budget;
+    }
+
+    if (NULL != sender->trace_ring.descriptor)
+    {
+        publication->trace_ring = &sender->trace_ring;
+    }
+
     if (aeron_send_channel_endpoint_add_publication(publication->endpoint, publication) < 0)
     {
         AERON_DRIVER_SENDER_ERROR(sender, "sender on_add_publication add_publication: %s", aeron_errmsg());
@@ -294,6 +365,11 @@ void aeron_driver_sender_on_remove_publication(void *clientd, void *command)
     {
         if (publication == sender->network_publications.array[i].publication)
         {
+            if (publication->send_weight > 0)
+            {
+                sender->weighted_publication_count--;
+            }
+
             aeron_array_fast_unordered_remove(
                 (uint8_t *)sender->network_publications.array,
                 sizeof(aeron_driver_sender_network_publication_entry_t),
@@ -355,7 +431,84 @@ void aeron_driver_sender_on_resolution_change(void *clientd, void *command)
 
     aeron_send_channel_endpoint_resolution_change(
         endpoint, resolution_change->endpoint_name, &resolution_change->new_addr);
-    aeron_counter_add_ordered(sender->resolution_changes_counter, 1);
+    aeron_counter_increment(sender->resolution_changes_counter, 1);
+}
+
+void aeron_driver_sender_on_tuning_change(void *clientd, void *command)
+{
+    aeron_driver_sender_t *sender = clientd;
+    aeron_command_tuning_change_t *tuning_change = (aeron_command_tuning_change_t *)command;
+
+    switch (tuning_change->param)
+    {
+        case AERON_DRIVER_TUNING_STATUS_MESSAGE_TIMEOUT_NS:
+            sender->status_message_read_timeout_ns = tuning_change->value / 2;
+            break;
+
+        case AERON_DRIVER_TUNING_SEND_TO_SM_POLL_RATIO:
+            sender->duty_cycle_ratio = (size_t)tuning_change->value;
+            break;
+
+        default:
+            break;
+    }
+}
+
+static int aeron_driver_sender_send_publication(
+    aeron_driver_sender_t *sender, aeron_network_publication_t *publication, int64_t now_ns)
+{
+    int result = aeron_network_publication_send(publication, now_ns);
+    if (result < 0)
+    {
+        AERON_DRIVER_SENDER_ERROR(sender, "sender do_send: %s", aeron_errmsg());
+        return 0;
+    }
+
+    return result;
+}
+
+/*
+ * Deficit round robin on bytes: each pass credits the publication its quantum and lets it send until the credit is
+ * spent or it runs out of data or window. Credit is only carried while the publication stays backlogged so an idle
+ * or flow controlled publication cannot bank a burst.
+ */
+static int aeron_driver_sender_send_weighted_publication(
+    aeron_driver_sender_t *sender, aeron_driver_sender_network_publication_entry_t *entry, int64_t now_ns)
+{
+    aeron_network_publication_t *publication = entry->publication;
+    const int64_t initial_snd_pos = aeron_counter_get(publication->snd_pos_position.value_addr);
+    int64_t snd_pos = initial_snd_pos;
+    int bytes_sent = 0;
+
+    entry->deficit += publication->send_quantum;
+
+    while (entry->deficit > 0)
+    {
+        publication->send_budget = entry->deficit;
+        bytes_sent += aeron_driver_sender_send_publication(sender, publication, now_ns);
+
+        const int64_t new_snd_pos = aeron_counter_get(publication->snd_pos_position.value_addr);
+        if (new_snd_pos <= snd_pos)
+        {
+            break;
+        }
+
+        entry->deficit -= new_snd_pos - snd_pos;
+        snd_pos = new_snd_pos;
+    }
+
+    publication->send_budget = INT64_MAX;
+
+    if (snd_pos == initial_snd_pos)
+    {
+        entry->deficit = 0;
+    }
+    else if (entry->deficit > publication->send_quantum)
+    {
+        entry->deficit = publication->send_quantum;
+    }
+
+    return bytes_sent;
 }
 
 int aeron_driver_sender_do_send(aeron_driver_sender_t *sender, int64_t now_ns)
@@ -370,33 +523,96 @@ int aeron_driver_sender_do_send(aeron_driver_sender_t *sender, int64_t now_ns)
         sender->round_robin_index = starting_index = 0;
     }
 
-    for (size_t i = starting_index; i < length; i++)
+    if (0 == sender->weighted_publication_count)
     {
-        int result = aeron_network_publication_send(publications[i].publication, now_ns);
-        if (result < 0)
+        for (size_t i = starting_index; i < length; i++)
         {
-            AERON_DRIVER_SENDER_ERROR(sender, "sender do_send: %s", aeron_errmsg());
+            bytes_sent += aeron_driver_sender_send_publication(sender, publications[i].publication, now_ns);
         }
-        else
+
+        for (size_t i = 0; i < starting_index; i++)
         {
-            bytes_sent += result;
+            bytes_sent += aeron_driver_sender_send_publication(sender, publications[i].publication, now_ns);
         }
     }
+    else
+    {
+        for (size_t i = starting_index; i < length; i++)
+        {
+            bytes_sent += aeron_driver_sender_send_weighted_publication(sender, &publications[i], now_ns);
+        }
 
-    for (size_t i = 0; i < starting_index; i++)
+        for (size_t i = 0; i < starting_index; i++)
+        {
+            bytes_sent += aeron_driver_sender_send_weighted_publication(sender, &publications[i], now_ns);
+        }
+    }
+
+    for (size_t i = 0, data_endpoints_length = sender->data_endpoints.length; i < data_endpoints_length; i++)
     {
-        int result = aeron_network_publication_send(publications[i].publication, now_ns);
+        if (aeron_send_channel_endpoint_flush_data(sender->data_endpoints.array[i], sender->short_sends_counter) < 0)
+        {
+            AERON_DRIVER_SENDER_ERROR(sender, "sender do_send data: %s", aeron_errmsg());
+        }
+    }
+    sender->data_endpoints.length = 0;
+
+    for (size_t i = 0, heartbeat_endpoints_length = sender->heartbeat_endpoints.length;
+        i < heartbeat_endpoints_length;
+        i++)
+    {
+        int result = aeron_send_channel_endpoint_flush_heartbeats(
+            sender->heartbeat_endpoints.array[i], sender->short_sends_counter);
         if (result < 0)
         {
-            AERON_DRIVER_SENDER_ERROR(sender, "sender do_send: %s", aeron_errmsg());
+            AERON_DRIVER_SENDER_ERROR(sender, "sender do_send heartbeats: %s", aeron_errmsg());
         }
         else
         {
             bytes_sent += result;
         }
     }
+    sender->heartbeat_endpoints.length = 0;
+
+    if (bytes_sent > 0)
+    {
+        aeron_counter_increment(sender->total_bytes_sent_counter, bytes_sent);
 
-    aeron_counter_add_ordered(sender->total_bytes_sent_counter, bytes_sent);
+        if (NULL != sender->shard_bytes_sent_counter)
+        {
+            aeron_counter_add_ordered(sender->shard_bytes_sent_counter, bytes_sent);
+        }
+    }
 
     return bytes_sent;
 }
+
+int aeron_driver_sender_add_heartbeat_endpoint(aeron_driver_sender_t *sender, aeron_send_channel_endpoint_t *endpoint)
+{
+    int ensure_capacity_result = 0;
+    AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, sender->heartbeat_endpoints, aeron_send_channel_endpoint_t *);
+
+    if (ensure_capacity_result < 0)
+    {
+        return -1;
+    }
+
+    sender->heartbeat_endpoints.array[sender->heartbeat_endpoints.length++] = endpoint;
+
+    return 0;
+}
+
+int aeron_driver_sender_add_data_endpoint(aeron_driver_sender_t *sender, aeron_send_channel_endpoint_t *endpoint)
+{
+    int ensure_capacity_result = 0;
+    AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, sender->data_endpoints, aeron_send_channel_endpoint_t *);
+
+    if (ensure_capacity_result < 0)
+    {
+        return -1;
+    }
+
+    sender->data_endpoints.array[sender->data_endpoints.length++] = endpoint;
+
+    return 0;
+}
@@ -24,16 +24,22 @@
 #include "media/aeron_udp_transport_poller.h"
 #include "aeron_network_publication.h"
 #include "concurrent/aeron_distinct_error_log.h"
+#include "concurrent/aeron_trace_ring.h"
 
 typedef struct aeron_driver_sender_network_publication_entry_stct
 {
     aeron_network_publication_t *publication;
+    int64_t deficit;
 }
 aeron_driver_sender_network_publication_entry_t;
 
 typedef struct aeron_driver_sender_stct
 {
+    /* read by the conductor to hand commands to the sender, the rest is only touched on the sender thread */
     aeron_driver_sender_proxy_t sender_proxy;
+
+    uint8_t sender_proxy_padding[2 * AERON_CACHE_LINE_LENGTH];
+
     aeron_udp_transport_poller_t poller;
 
     struct aeron_driver_sender_network_publications_stct
@@ -44,17 +50,38 @@ typedef struct aeron_driver_sender_stct
     }
     network_publications;
 
+    struct aeron_driver_sender_heartbeat_endpoints_stct
+    {
+        aeron_send_channel_endpoint_t **array;
+        size_t length;
+        size_t capacity;
+    }
+    heartbeat_endpoints;
+
+    struct aeron_driver_sender_data_endpoints_stct
+    {
+        aeron_send_channel_endpoint_t **array;
+        size_t length;
+        size_t capacity;
+    }
+    data_endpoints;
+
     struct aeron_driver_sender_buffers_stct
     {
-        uint8_t *buffers[AERON_DRIVER_SENDER_NUM_RECV_BUFFERS];
-        struct iovec iov[AERON_DRIVER_SENDER_NUM_RECV_BUFFERS];
-        struct sockaddr_storage addrs[AERON_DRIVER_SENDER_NUM_RECV_BUFFERS];
+        size_t count;
+        uint8_t **buffers;
+        struct iovec *iov;
+        struct sockaddr_storage *addrs;
+        struct mmsghdr *mmsghdrs;
     }
     recv_buffers;
 
     aeron_udp_channel_data_paths_t data_paths;
+    aeron_trace_ring_t trace_ring;
 
     int64_t *total_bytes_sent_counter;
+    int64_t *shard_bytes_sent_counter;
+    int64_t *short_sends_counter;
     int64_t *errors_counter;
     int64_t *invalid_frames_counter;
     int64_t *status_messages_received_counter;
@@ -69,10 +96,12 @@ typedef struct aeron_driver_sender_stct
     int64_t control_poll_timeout_ns;
     int64_t re_resolution_deadline_ns;
     size_t round_robin_index;
+    size_t weighted_publication_count;
     size_t duty_cycle_counter;
     size_t duty_cycle_ratio;
+    aeron_retransmit_budget_t retransmit_budget;
 
-    uint8_t padding[AERON_CACHE_LINE_LENGTH];
+    uint8_t padding[2 * AERON_CACHE_LINE_LENGTH];
 }
 aeron_driver_sender_t;
 
@@ -104,7 +133,15 @@ void aeron_driver_sender_on_remove_publication(void *clientd, void *command);
 void aeron_driver_sender_on_add_destination(void *clientd, void *command);
 void aeron_driver_sender_on_remove_destination(void *clientd, void *command);
 void aeron_driver_sender_on_resolution_change(void *clientd, void *command);
+void aeron_driver_sender_on_tuning_change(void *clientd, void *command);
 
 int aeron_driver_sender_do_send(aeron_driver_sender_t *sender, int64_t now_ns);
 
+/*
+ * Have the heartbeats queued on the endpoint sent at the end of the current send pass.
+ */
+int aeron_driver_sender_add_heartbeat_endpoint(aeron_driver_sender_t *sender, aeron_send_channel_endpoint_t *endpoint);
+
+int aeron_driver_sender_add_data_endpoint(aeron_driver_sender_t *sender, aeron_send_channel_endpoint_t *endpoint);
+
 #endif //AERON_DRIVER_SENDER_H
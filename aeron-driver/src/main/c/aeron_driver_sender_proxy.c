@@ -22,7 +22,24 @@ void aeron_driver_sender_proxy_offer(aeron_driver_sender_proxy_t *sender_proxy,
     while (aeron_spsc_concurrent_array_queue_offer(sender_proxy->command_queue, cmd) != AERON_OFFER_SUCCESS)
     {
         aeron_counter_ordered_increment(sender_proxy->fail_counter, 1);
-        sched_yield();
+        aeron_spsc_concurrent_array_queue_wait_for_space(sender_proxy->command_queue, AERON_QUEUE_SPACE_WAIT_SLICE_NS);
+    }
+}
+
+void aeron_driver_sender_proxy_offer_bulk(aeron_driver_sender_proxy_t *sender_proxy, aeron_command_base_t **cmds, size_t length)
+{
+    size_t offered = 0;
+
+    while (offered < length)
+    {
+        offered += (size_t)aeron_spsc_concurrent_array_queue_offer_bulk(
+            sender_proxy->command_queue, (void **)(cmds + offered), length - offered);
+
+        if (offered < length)
+        {
+            aeron_counter_ordered_increment(sender_proxy->fail_counter, 1);
+            aeron_spsc_concurrent_array_queue_wait_for_space(sender_proxy->command_queue, AERON_QUEUE_SPACE_WAIT_SLICE_NS);
+        }
     }
 }
 
@@ -271,3 +288,35 @@ void aeron_driver_sender_proxy_on_delete_cmd(
     }
 }
 
+void aeron_driver_sender_proxy_on_tuning_change(
+    aeron_driver_sender_proxy_t *sender_proxy, aeron_driver_tuning_param_t param, int64_t value)
+{
+    if (AERON_THREADING_MODE_IS_SHARED_OR_INVOKER(sender_proxy->threading_mode))
+    {
+        aeron_command_tuning_change_t cmd =
+            {
+                .base = { .func = aeron_driver_sender_on_tuning_change, .item = NULL },
+                .param = param,
+                .value = value
+            };
+
+        aeron_driver_sender_on_tuning_change(sender_proxy->sender, &cmd);
+    }
+    else
+    {
+        aeron_command_tuning_change_t *cmd;
+
+        if (aeron_alloc((void **)&cmd, sizeof(aeron_command_tuning_change_t)) < 0)
+        {
+            aeron_counter_ordered_increment(sender_proxy->fail_counter, 1);
+            return;
+        }
+
+        cmd->base.func = aeron_driver_sender_on_tuning_change;
+        cmd->base.item = NULL;
+        cmd->param = param;
+        cmd->value = value;
+
+        aeron_driver_sender_proxy_offer(sender_proxy, cmd);
+    }
+}
@@ -18,6 +18,7 @@
 #define AERON_DRIVER_SENDER_PROXY_H
 
 #include "aeron_driver_context.h"
+#include "aeron_driver_tuning.h"
 
 typedef struct aeron_driver_sender_stct aeron_driver_sender_t;
 typedef struct aeron_send_channel_endpoint_stct aeron_send_channel_endpoint_t;
@@ -32,6 +33,13 @@ typedef struct aeron_driver_sender_proxy_stct
 }
 aeron_driver_sender_proxy_t;
 
+/*
+ * Offer commands built by the caller in one pass, blocking while the queue is full rather than spinning. Only for
+ * threading modes where the sender runs on its own thread.
+ */
+void aeron_driver_sender_proxy_offer_bulk(
+    aeron_driver_sender_proxy_t *sender_proxy, aeron_command_base_t **cmds, size_t length);
+
 void aeron_driver_sender_proxy_on_add_endpoint(
     aeron_driver_sender_proxy_t *sender_proxy, aeron_send_channel_endpoint_t *endpoint);
 
@@ -77,6 +85,9 @@ void aeron_driver_sender_proxy_on_add_destination(
 void aeron_driver_sender_proxy_on_remove_destination(
     aeron_driver_sender_proxy_t *sender_proxy, aeron_send_channel_endpoint_t *endpoint, struct sockaddr_storage *addr);
 
+void aeron_driver_sender_proxy_on_tuning_change(
+    aeron_driver_sender_proxy_t *sender_proxy, aeron_driver_tuning_param_t param, int64_t value);
+
 void aeron_driver_sender_proxy_on_delete_cmd(
     aeron_driver_sender_proxy_t *sender_proxy, aeron_command_base_t *cmd);
 
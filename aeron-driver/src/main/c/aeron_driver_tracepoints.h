@@ -0,0 +1,59 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_DRIVER_TRACEPOINTS_H
+#define AERON_DRIVER_TRACEPOINTS_H
+
+/*
+ * Statically defined tracepoints (USDT) in provider "aeron" on the driver hot paths. Each is a single nop until a
+ * tracer such as bpftrace attaches, so they are compiled in whenever <sys/sdt.h> is available. Probes and arguments:
+ *
+ *   publication_send_data     session_id, stream_id, position, bytes_sent, vlen
+ *   publication_resend        session_id, stream_id, term_id, term_offset, length
+ *   image_insert_packet       session_id, stream_id, term_id, term_offset, length
+ *   image_gap_detected        session_id, stream_id, term_id, term_offset, length
+ *   sm_send                   session_id, stream_id, term_id, term_offset, receiver_window, flags
+ *   nak_send                  session_id, stream_id, term_id, term_offset, length
+ *   conductor_command_start   msg_type_id, length
+ *   conductor_command_end     msg_type_id
+ *
+ * e.g. bpftrace -e 'usdt:/path/to/aeronmd:aeron:image_gap_detected { @gaps[arg1] = count(); }'
+ */
+#if defined(HAVE_SYS_SDT_H) && defined(__linux__)
+
+#include <sys/sdt.h>
+
+#define AERON_DRIVER_TRACEPOINT0(name) DTRACE_PROBE(aeron, name)
+#define AERON_DRIVER_TRACEPOINT1(name, a1) DTRACE_PROBE1(aeron, name, a1)
+#define AERON_DRIVER_TRACEPOINT2(name, a1, a2) DTRACE_PROBE2(aeron, name, a1, a2)
+#define AERON_DRIVER_TRACEPOINT3(name, a1, a2, a3) DTRACE_PROBE3(aeron, name, a1, a2, a3)
+#define AERON_DRIVER_TRACEPOINT4(name, a1, a2, a3, a4) DTRACE_PROBE4(aeron, name, a1, a2, a3, a4)
+#define AERON_DRIVER_TRACEPOINT5(name, a1, a2, a3, a4, a5) DTRACE_PROBE5(aeron, name, a1, a2, a3, a4, a5)
+#define AERON_DRIVER_TRACEPOINT6(name, a1, a2, a3, a4, a5, a6) DTRACE_PROBE6(aeron, name, a1, a2, a3, a4, a5, a6)
+
+#else
+
+#define AERON_DRIVER_TRACEPOINT0(name) do {} while (0)
+#define AERON_DRIVER_TRACEPOINT1(name, a1) do {} while (0)
+#define AERON_DRIVER_TRACEPOINT2(name, a1, a2) do {} while (0)
+#define AERON_DRIVER_TRACEPOINT3(name, a1, a2, a3) do {} while (0)
+#define AERON_DRIVER_TRACEPOINT4(name, a1, a2, a3, a4) do {} while (0)
+#define AERON_DRIVER_TRACEPOINT5(name, a1, a2, a3, a4, a5) do {} while (0)
+#define AERON_DRIVER_TRACEPOINT6(name, a1, a2, a3, a4, a5, a6) do {} while (0)
+
+#endif
+
+#endif //AERON_DRIVER_TRACEPOINTS_H
@@ -0,0 +1,103 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <inttypes.h>
+
+#include "aeron_driver_context.h"
+#include "aeron_driver_tuning.h"
+
+typedef struct aeron_driver_tuning_param_definition_stct
+{
+    const char *name;
+    int64_t min_value;
+    int64_t max_value;
+}
+aeron_driver_tuning_param_definition_t;
+
+static const aeron_driver_tuning_param_definition_t aeron_driver_tuning_params[AERON_DRIVER_TUNING_PARAM_COUNT] =
+    {
+        { "status_message_timeout_ns", INT64_C(1000), INT64_MAX },
+        { "nak_unicast_delay_ns", INT64_C(1), INT64_MAX },
+        { "retransmit_unicast_linger_ns", INT64_C(0), INT64_MAX },
+        { "send_to_sm_poll_ratio", INT64_C(1), INT32_MAX },
+        { "untethered_window_limit_timeout_ns", INT64_C(1000), INT64_MAX },
+        { "untethered_resting_timeout_ns", INT64_C(1000), INT64_MAX }
+    };
+
+int aeron_driver_tuning_init(
+    aeron_driver_tuning_t *tuning, aeron_counters_manager_t *counters_manager, aeron_driver_context_t *context)
+{
+    tuning->values[AERON_DRIVER_TUNING_STATUS_MESSAGE_TIMEOUT_NS] = (int64_t)context->status_message_timeout_ns;
+    tuning->values[AERON_DRIVER_TUNING_NAK_UNICAST_DELAY_NS] = (int64_t)context->nak_unicast_delay_ns;
+    tuning->values[AERON_DRIVER_TUNING_RETRANSMIT_UNICAST_LINGER_NS] = (int64_t)context->retransmit_unicast_linger_ns;
+    tuning->values[AERON_DRIVER_TUNING_SEND_TO_SM_POLL_RATIO] = (int64_t)context->send_to_sm_poll_ratio;
+    tuning->values[AERON_DRIVER_TUNING_UNTETHERED_WINDOW_LIMIT_TIMEOUT_NS] =
+        (int64_t)context->untethered_window_limit_timeout_ns;
+    tuning->values[AERON_DRIVER_TUNING_UNTETHERED_RESTING_TIMEOUT_NS] =
+        (int64_t)context->untethered_resting_timeout_ns;
+
+    for (int i = 0; i < AERON_DRIVER_TUNING_PARAM_COUNT; i++)
+    {
+        char label[128];
+        int label_length = snprintf(label, sizeof(label), "Driver tuning: %s", aeron_driver_tuning_params[i].name);
+
+        int32_t counter_id = aeron_counters_manager_allocate(
+            counters_manager, AERON_COUNTER_DRIVER_TUNING_TYPE_ID, NULL, 0, label, (size_t)label_length);
+        if (counter_id < 0)
+        {
+            return -1;
+        }
+
+        tuning->counter_ids[i] = counter_id;
+        tuning->counter_addrs[i] = aeron_counters_manager_addr(counters_manager, counter_id);
+        aeron_counter_set_ordered(tuning->counter_addrs[i], tuning->values[i]);
+    }
+
+    return 0;
+}
+
+int aeron_driver_tuning_poll(aeron_driver_tuning_t *tuning, aeron_driver_tuning_change_func_t on_change, void *clientd)
+{
+    int changed = 0;
+
+    for (int i = 0; i < AERON_DRIVER_TUNING_PARAM_COUNT; i++)
+    {
+        int64_t value = aeron_counter_get_volatile(tuning->counter_addrs[i]);
+
+        if (value == tuning->values[i])
+        {
+            continue;
+        }
+
+        const aeron_driver_tuning_param_definition_t *definition = &aeron_driver_tuning_params[i];
+        if (value < definition->min_value || value > definition->max_value)
+        {
+            aeron_counter_set_ordered(tuning->counter_addrs[i], tuning->values[i]);
+            continue;
+        }
+
+        tuning->values[i] = value;
+        on_change(clientd, (aeron_driver_tuning_param_t)i, value);
+        changed++;
+    }
+
+    return changed;
+}
+
+const char *aeron_driver_tuning_param_name(aeron_driver_tuning_param_t param)
+{
+    return param < AERON_DRIVER_TUNING_PARAM_COUNT ? aeron_driver_tuning_params[param].name : "unknown";
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_DRIVER_TUNING_H
+#define AERON_DRIVER_TUNING_H
+
+#include "aeron_driver_common.h"
+#include "concurrent/aeron_counters_manager.h"
+
+#define AERON_COUNTER_DRIVER_TUNING_TYPE_ID (22)
+
+typedef struct aeron_driver_context_stct aeron_driver_context_t;
+
+/*
+ * Driver parameters that may be changed while the driver is running by writing to their counter in the CnC file.
+ * The conductor picks up a change on its next timer check and hands it to the agent that owns the value.
+ */
+typedef enum aeron_driver_tuning_param_en
+{
+    AERON_DRIVER_TUNING_STATUS_MESSAGE_TIMEOUT_NS = 0,
+    AERON_DRIVER_TUNING_NAK_UNICAST_DELAY_NS = 1,
+    AERON_DRIVER_TUNING_RETRANSMIT_UNICAST_LINGER_NS = 2,
+    AERON_DRIVER_TUNING_SEND_TO_SM_POLL_RATIO = 3,
+    AERON_DRIVER_TUNING_UNTETHERED_WINDOW_LIMIT_TIMEOUT_NS = 4,
+    AERON_DRIVER_TUNING_UNTETHERED_RESTING_TIMEOUT_NS = 5,
+    AERON_DRIVER_TUNING_PARAM_COUNT = 6
+}
+aeron_driver_tuning_param_t;
+
+typedef struct aeron_driver_tuning_stct
+{
+    int32_t counter_ids[AERON_DRIVER_TUNING_PARAM_COUNT];
+    int64_t *counter_addrs[AERON_DRIVER_TUNING_PARAM_COUNT];
+    int64_t values[AERON_DRIVER_TUNING_PARAM_COUNT];
+}
+aeron_driver_tuning_t;
+
+typedef struct aeron_command_tuning_change_stct
+{
+    aeron_command_base_t base;
+    aeron_driver_tuning_param_t param;
+    int64_t value;
+}
+aeron_command_tuning_change_t;
+
+typedef void (*aeron_driver_tuning_change_func_t)(void *clientd, aeron_driver_tuning_param_t param, int64_t value);
+
+int aeron_driver_tuning_init(
+    aeron_driver_tuning_t *tuning, aeron_counters_manager_t *counters_manager, aeron_driver_context_t *context);
+
+/*
+ * Check each tuning counter for a new value. Valid changes are passed to on_change. Out of range values are
+ * rejected by restoring the counter to the value in force. Returns the number of counters that changed.
+ */
+int aeron_driver_tuning_poll(aeron_driver_tuning_t *tuning, aeron_driver_tuning_change_func_t on_change, void *clientd);
+
+const char *aeron_driver_tuning_param_name(aeron_driver_tuning_param_t param);
+
+#endif //AERON_DRIVER_TUNING_H
@@ -0,0 +1,102 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <errno.h>
+#include <inttypes.h>
+
+#include "aeronmd.h"
+#include "aeron_duty_cycle_tracker.h"
+
+static const int64_t aeron_duty_cycle_tracker_bucket_limits_ns[AERON_DUTY_CYCLE_TRACKER_BUCKET_COUNT - 1] =
+    {
+        10 * 1000LL,
+        100 * 1000LL,
+        1000 * 1000LL,
+        10 * 1000 * 1000LL
+    };
+
+void aeron_duty_cycle_tracker_init(
+    aeron_duty_cycle_tracker_t *tracker,
+    aeron_system_counters_t *system_counters,
+    aeron_system_counter_enum_t max_cycle_time_counter,
+    uint64_t cycle_time_threshold_ns,
+    aeron_distinct_error_log_t *error_log,
+    const char *agent_name)
+{
+    tracker->max_cycle_time_counter = aeron_system_counter_addr(system_counters, max_cycle_time_counter);
+    tracker->threshold_exceeded_counter = aeron_system_counter_addr(
+        system_counters, (aeron_system_counter_enum_t)(max_cycle_time_counter + 1));
+
+    for (int i = 0; i < AERON_DUTY_CYCLE_TRACKER_BUCKET_COUNT; i++)
+    {
+        tracker->cycle_time_counters[i] = aeron_system_counter_addr(
+            system_counters, (aeron_system_counter_enum_t)(max_cycle_time_counter + 2 + i));
+    }
+
+    tracker->cycle_time_threshold_ns = (int64_t)cycle_time_threshold_ns;
+    tracker->error_log = error_log;
+    tracker->agent_name = agent_name;
+}
+
+void aeron_duty_cycle_tracker_update(void *state, int64_t cycle_time_ns)
+{
+    aeron_duty_cycle_tracker_t *tracker = (aeron_duty_cycle_tracker_t *)state;
+    int bucket = 0;
+
+    while (bucket < AERON_DUTY_CYCLE_TRACKER_BUCKET_COUNT - 1 &&
+        cycle_time_ns > aeron_duty_cycle_tracker_bucket_limits_ns[bucket])
+    {
+        bucket++;
+    }
+
+    aeron_counter_increment(tracker->cycle_time_counters[bucket], 1);
+
+    int64_t max_cycle_time_ns;
+    do
+    {
+        max_cycle_time_ns = aeron_counter_get_volatile(tracker->max_cycle_time_counter);
+    }
+    while (cycle_time_ns > max_cycle_time_ns &&
+        !aeron_cmpxchg64(tracker->max_cycle_time_counter, max_cycle_time_ns, cycle_time_ns));
+
+    if (cycle_time_ns > tracker->cycle_time_threshold_ns)
+    {
+        char message[128];
+
+        aeron_counter_increment(tracker->threshold_exceeded_counter, 1);
+
+        snprintf(
+            message,
+            sizeof(message),
+            "%s cycle time %" PRId64 "ns exceeded threshold %" PRId64 "ns",
+            tracker->agent_name,
+            cycle_time_ns,
+            tracker->cycle_time_threshold_ns);
+        aeron_distinct_error_log_record(tracker->error_log, ETIMEDOUT, "work cycle exceeded threshold", message);
+    }
+}
+
+int aeron_duty_cycle_tracker_do_work(
+    aeron_duty_cycle_tracker_t *tracker, int (*do_work)(void *), void *agent_state)
+{
+    int64_t start_ns = aeron_nano_clock();
+    int work_count = do_work(agent_state);
+
+    aeron_duty_cycle_tracker_update(tracker, aeron_nano_clock() - start_ns);
+
+    return work_count;
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_DUTY_CYCLE_TRACKER_H
+#define AERON_DUTY_CYCLE_TRACKER_H
+
+#include <stdint.h>
+
+#include "aeron_system_counters.h"
+#include "concurrent/aeron_distinct_error_log.h"
+
+#define AERON_DUTY_CYCLE_TRACKER_BUCKET_COUNT (5)
+
+/*
+ * Records the time taken by each work cycle of an agent in its system counters: the max cycle time, a coarse
+ * histogram of cycle times and a count of cycles over the threshold, which are also recorded in the error log so a
+ * stall can be attributed to the conductor, sender or receiver after the fact. Counters are updated atomically as
+ * sender and receiver shards share the tracker of their agent.
+ */
+typedef struct aeron_duty_cycle_tracker_stct
+{
+    int64_t *max_cycle_time_counter;
+    int64_t *threshold_exceeded_counter;
+    int64_t *cycle_time_counters[AERON_DUTY_CYCLE_TRACKER_BUCKET_COUNT];
+    int64_t cycle_time_threshold_ns;
+    aeron_distinct_error_log_t *error_log;
+    const char *agent_name;
+}
+aeron_duty_cycle_tracker_t;
+
+/*
+ * The counters for an agent are expected to follow max_cycle_time_counter in the order of the tracker fields.
+ */
+void aeron_duty_cycle_tracker_init(
+    aeron_duty_cycle_tracker_t *tracker,
+    aeron_system_counters_t *system_counters,
+    aeron_system_counter_enum_t max_cycle_time_counter,
+    uint64_t cycle_time_threshold_ns,
+    aeron_distinct_error_log_t *error_log,
+    const char *agent_name);
+
+void aeron_duty_cycle_tracker_update(void *state, int64_t cycle_time_ns);
+
+/*
+ * Run and measure a work cycle for an agent sharing a thread with other agents.
+ */
+int aeron_duty_cycle_tracker_do_work(
+    aeron_duty_cycle_tracker_t *tracker, int (*do_work)(void *), void *agent_state);
+
+#endif //AERON_DUTY_CYCLE_TRACKER_H
@@ -0,0 +1,135 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <errno.h>
+#include <string.h>
+#include "util/aeron_error.h"
+#include "aeron_alloc.h"
+#include "aeron_embedded_invoker.h"
+
+int aeron_embedded_invoker_init(
+    aeron_embedded_invoker_t **invoker, aeron_driver_context_t *driver_context, aeron_context_t *client_context)
+{
+    aeron_embedded_invoker_t *_invoker = NULL;
+
+    if (NULL == invoker || NULL == driver_context || NULL == client_context)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_embedded_invoker_init: %s", strerror(EINVAL));
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&_invoker, sizeof(aeron_embedded_invoker_t)) < 0)
+    {
+        aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
+        return -1;
+    }
+
+    _invoker->driver = NULL;
+    _invoker->client = NULL;
+
+    aeron_driver_context_set_threading_mode(driver_context, AERON_THREADING_MODE_INVOKER);
+    aeron_context_set_use_conductor_agent_invoker(client_context, true);
+
+    if (aeron_driver_init(&_invoker->driver, driver_context) < 0 || aeron_driver_start(_invoker->driver, true) < 0)
+    {
+        goto error;
+    }
+
+    /* the driver heartbeats the CnC file during init so the client can connect before the first duty cycle */
+    aeron_context_set_dir(client_context, aeron_driver_context_get_dir(driver_context));
+
+    if (aeron_init(&_invoker->client, client_context) < 0 || aeron_start(_invoker->client) < 0)
+    {
+        goto error;
+    }
+
+    *invoker = _invoker;
+    return 0;
+
+    error:
+    aeron_close(_invoker->client);
+    if (NULL != _invoker->driver)
+    {
+        aeron_driver_close(_invoker->driver);
+    }
+    aeron_free(_invoker);
+
+    return -1;
+}
+
+int aeron_embedded_invoker_do_work(
+    aeron_embedded_invoker_t *invoker, aeron_embedded_invoker_work_func_t app_work, void *clientd)
+{
+    int work_count = 0;
+    int result;
+
+    if (NULL == invoker)
+    {
+        errno = EINVAL;
+        aeron_set_err(EINVAL, "aeron_embedded_invoker_do_work: %s", strerror(EINVAL));
+        return -1;
+    }
+
+    if ((result = aeron_driver_main_do_work(invoker->driver)) < 0)
+    {
+        return -1;
+    }
+    work_count += result;
+
+    if ((result = aeron_main_do_work(invoker->client)) < 0)
+    {
+        return -1;
+    }
+    work_count += result;
+
+    if (NULL != app_work)
+    {
+        work_count += app_work(clientd);
+    }
+
+    return work_count;
+}
+
+void aeron_embedded_invoker_idle(aeron_embedded_invoker_t *invoker, int work_count)
+{
+    if (NULL != invoker)
+    {
+        aeron_driver_main_idle_strategy(invoker->driver, work_count);
+    }
+}
+
+int aeron_embedded_invoker_close(aeron_embedded_invoker_t *invoker)
+{
+    int result = 0;
+
+    if (NULL != invoker)
+    {
+        if (aeron_close(invoker->client) < 0)
+        {
+            result = -1;
+        }
+
+        if (aeron_driver_close(invoker->driver) < 0)
+        {
+            result = -1;
+        }
+
+        aeron_free(invoker);
+    }
+
+    return result;
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef AERON_EMBEDDED_INVOKER_H
+#define AERON_EMBEDDED_INVOKER_H
+
+#include "aeronmd.h"
+#include "aeronc.h"
+
+/**
+ * Application work run at the end of each embedded invoker duty cycle.
+ *
+ * @param clientd passed to aeron_embedded_invoker_do_work.
+ * @return amount of work done.
+ */
+typedef int (*aeron_embedded_invoker_work_func_t)(void *clientd);
+
+typedef struct aeron_embedded_invoker_stct
+{
+    aeron_driver_t *driver;
+    aeron_t *client;
+}
+aeron_embedded_invoker_t;
+
+/**
+ * Create a media driver and a client which are both driven from the caller's thread. The driver context is switched
+ * to AERON_THREADING_MODE_INVOKER and the client context to use the conductor agent invoker and the driver directory.
+ *
+ * Both contexts remain owned by the caller and must be closed after aeron_embedded_invoker_close.
+ *
+ * @param invoker to create and initialise.
+ * @param driver_context to create the driver with.
+ * @param client_context to create the client with.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_embedded_invoker_init(
+    aeron_embedded_invoker_t **invoker, aeron_driver_context_t *driver_context, aeron_context_t *client_context);
+
+/**
+ * Run one duty cycle in order: driver conductor, sender and receiver, then the client conductor, then the
+ * application work if given. Publications, subscriptions and counters of the client may only be used from this thread.
+ *
+ * @param invoker to run the duty cycle of.
+ * @param app_work to run after the driver and client, may be NULL.
+ * @param clientd for app_work.
+ * @return amount of work done or -1 for error.
+ */
+int aeron_embedded_invoker_do_work(
+    aeron_embedded_invoker_t *invoker, aeron_embedded_invoker_work_func_t app_work, void *clientd);
+
+/**
+ * Idle with the driver shared idle strategy.
+ *
+ * @param invoker to idle.
+ * @param work_count returned from aeron_embedded_invoker_do_work.
+ */
+void aeron_embedded_invoker_idle(aeron_embedded_invoker_t *invoker, int work_count);
+
+/**
+ * Close the client and then the driver and delete the invoker.
+ *
+ * @param invoker to close.
+ * @return 0 for success and -1 for error.
+ */
+int aeron_embedded_invoker_close(aeron_embedded_invoker_t *invoker);
+
+#endif //AERON_EMBEDDED_INVOKER_H
@@ -136,7 +136,8 @@ aeron_flow_control_strategy_supplier_func_table_entry_t aeron_flow_control_strat
     { AERON_UNICAST_MAX_FLOW_CONTROL_STRATEGY_NAME, aeron_unicast_flow_control_strategy_supplier },
     { AERON_MULTICAST_MAX_FLOW_CONTROL_STRATEGY_NAME, aeron_max_multicast_flow_control_strategy_supplier },
     { AERON_MULTICAST_MIN_FLOW_CONTROL_STRATEGY_NAME, aeron_min_flow_control_strategy_supplier },
-    { AERON_MULTICAST_TAGGED_FLOW_CONTROL_STRATEGY_NAME, aeron_tagged_flow_control_strategy_supplier }
+    { AERON_MULTICAST_TAGGED_FLOW_CONTROL_STRATEGY_NAME, aeron_tagged_flow_control_strategy_supplier },
+    { AERON_MULTICAST_QUORUM_FLOW_CONTROL_STRATEGY_NAME, aeron_quorum_flow_control_strategy_supplier }
 };
 
 aeron_flow_control_strategy_supplier_func_t aeron_flow_control_strategy_supplier_by_name(const char *name)
@@ -212,6 +213,11 @@ int aeron_default_multicast_flow_control_strategy_supplier(
             {
                 flow_control_strategy_supplier_func = aeron_tagged_flow_control_strategy_supplier;
             }
+            else if (strlen(AERON_QUORUM_FLOW_CONTROL_STRATEGY_NAME) == strategy_name_length &&
+                0 == strncmp(AERON_QUORUM_FLOW_CONTROL_STRATEGY_NAME, strategy_name, strategy_name_length))
+            {
+                flow_control_strategy_supplier_func = aeron_quorum_flow_control_strategy_supplier;
+            }
             else
             {
                 aeron_set_err(
@@ -256,6 +262,11 @@ int aeron_flow_control_parse_tagged_options(
     flow_control_options->group_tag.value = -1;
     flow_control_options->group_min_size.is_present = false;
     flow_control_options->group_min_size.value = 0;
+    flow_control_options->quorum.is_present = false;
+    flow_control_options->quorum.is_percentile = false;
+    flow_control_options->quorum.value = 0;
+    flow_control_options->max_lag.is_present = false;
+    flow_control_options->max_lag.value = 0;
 
     char number_buffer[AERON_FLOW_CONTROL_NUMBER_BUFFER_LEN];
 
@@ -293,7 +304,8 @@ int aeron_flow_control_parse_tagged_options(
             flow_control_options->strategy_name_length = current_option_length;
         }
         else if (current_option_length > 2 &&
-            ('g' == current_option[0] || 't' == current_option[0]) &&
+            ('g' == current_option[0] || 't' == current_option[0] ||
+            'q' == current_option[0] || 'l' == current_option[0]) &&
             ':' == current_option[1])
         {
             const size_t value_length = current_option_length - 2;
@@ -384,6 +396,53 @@ int aeron_flow_control_parse_tagged_options(
                     return -EINVAL;
                 }
             }
+            else if ('q' == current_option[0])
+            {
+                char *end_ptr = "";
+                errno = 0;
+
+                const long quorum = strtol(number_buffer, &end_ptr, 10);
+                const bool is_percentile = '%' == *end_ptr && '\0' == *(end_ptr + 1);
+
+                if (0 == errno &&
+                    number_buffer != end_ptr &&
+                    ('\0' == *end_ptr || is_percentile) &&
+                    1 <= quorum && quorum <= (is_percentile ? 100 : INT32_MAX))
+                {
+                    flow_control_options->quorum.is_present = true;
+                    flow_control_options->quorum.is_percentile = is_percentile;
+                    flow_control_options->quorum.value = (int32_t)quorum;
+                }
+                else
+                {
+                    aeron_set_err(
+                        -EINVAL,
+                        "Flow control options - invalid quorum, field: %.*s, options: %.*s",
+                        (int)current_option_length, current_option,
+                        (int)options_length, options);
+
+                    return -EINVAL;
+                }
+            }
+            else if ('l' == current_option[0])
+            {
+                uint64_t max_lag;
+                if (0 <= aeron_parse_size64(number_buffer, &max_lag))
+                {
+                    flow_control_options->max_lag.is_present = true;
+                    flow_control_options->max_lag.value = max_lag;
+                }
+                else
+                {
+                    aeron_set_err(
+                        -EINVAL,
+                        "Flow control options - invalid max lag, field: %.*s, options: %.*s",
+                        (int)current_option_length, current_option,
+                        (int)options_length, options);
+
+                    return -EINVAL;
+                }
+            }
         }
         else
         {
@@ -24,6 +24,7 @@
 #define AERON_MAX_FLOW_CONTROL_STRATEGY_NAME "max"
 #define AERON_MIN_FLOW_CONTROL_STRATEGY_NAME "min"
 #define AERON_TAGGED_FLOW_CONTROL_STRATEGY_NAME "tagged"
+#define AERON_QUORUM_FLOW_CONTROL_STRATEGY_NAME "quorum"
 
 typedef int64_t (*aeron_flow_control_strategy_on_idle_func_t)(
     void *state,
@@ -80,6 +81,19 @@ typedef struct aeron_flow_control_tagged_options_stct
         int32_t value;
     }
     group_min_size;
+    struct
+    {
+        bool is_present;
+        bool is_percentile;
+        int32_t value;
+    }
+    quorum;
+    struct
+    {
+        bool is_present;
+        uint64_t value;
+    }
+    max_lag;
 }
 aeron_flow_control_tagged_options_t;
 
@@ -121,6 +135,15 @@ int aeron_tagged_flow_control_strategy_supplier(
     int32_t initial_term_id,
     size_t term_buffer_capacity);
 
+int aeron_quorum_flow_control_strategy_supplier(
+    aeron_flow_control_strategy_t **strategy,
+    aeron_driver_context_t *context,
+    const aeron_udp_channel_t *channel,
+    int32_t stream_id,
+    int64_t registration_id,
+    int32_t initial_term_id,
+    size_t term_buffer_capacity);
+
 int aeron_tagged_flow_control_strategy_to_string(
     aeron_flow_control_strategy_t *strategy,
     char *buffer,
@@ -22,10 +22,13 @@
 #include "aeron_ipc_publication.h"
 #include "aeron_alloc.h"
 #include "aeron_driver_conductor.h"
+#include "aeron_log_buffer_pre_faulter.h"
+#include "aeron_driver_housekeeper.h"
 
 int aeron_ipc_publication_create(
     aeron_ipc_publication_t **publication,
     aeron_driver_context_t *context,
+    aeron_allocator_t *allocator,
     int32_t session_id,
     int32_t stream_id,
     int64_t registration_id,
@@ -45,7 +48,7 @@ int aeron_ipc_publication_create(
 
     *publication = NULL;
 
-    if (usable_fs_space < log_length)
+    if (!context->term_buffer_memfd && usable_fs_space < log_length)
     {
         aeron_set_err(
             ENOSPC,
@@ -53,29 +56,57 @@ int aeron_ipc_publication_create(
         return -1;
     }
 
-    if (aeron_alloc((void **)&_pub, sizeof(aeron_ipc_publication_t)) < 0)
+    if (context->term_buffer_memfd && (path_length = aeron_memfd_log_location(path, sizeof(path), registration_id)) < 0)
+    {
+        aeron_set_err(aeron_errcode(), "could not create memfd for IPC log: %s", aeron_errmsg());
+        return -1;
+    }
+
+    if (aeron_allocator_alloc(allocator, (void **)&_pub, sizeof(aeron_ipc_publication_t)) < 0)
     {
         aeron_set_err(ENOMEM, "%s", "Could not allocate IPC publication");
         return -1;
     }
 
+    _pub->conductor_fields.allocator = allocator;
     _pub->log_file_name = NULL;
-    if (aeron_alloc((void **)(&_pub->log_file_name), (size_t)path_length + 1) < 0)
+    if (aeron_allocator_alloc(allocator, (void **)(&_pub->log_file_name), (size_t)path_length + 1) < 0)
     {
-        aeron_free(_pub);
+        aeron_allocator_free(allocator, _pub, sizeof(aeron_ipc_publication_t));
         aeron_set_err(ENOMEM, "%s", "Could not allocate IPC publication log_file_name");
         return -1;
     }
 
-    if (context->map_raw_log_func(
-        &_pub->mapped_raw_log, path, params->is_sparse, params->term_length, context->file_page_size) < 0)
+    _pub->log_buffer_pool = !params->is_sparse && !params->is_huge_pages &&
+        AERON_NUMA_NODE_NONE == params->numa_node ? context->log_buffer_pool : NULL;
+    _pub->housekeeper = context->housekeeper;
+    const bool is_pooled = NULL != _pub->log_buffer_pool && aeron_log_buffer_pool_acquire(
+        _pub->log_buffer_pool, &_pub->mapped_raw_log, path, params->term_length, context->file_page_size) > 0;
+    const bool is_pre_faulted_async = !is_pooled && !params->is_sparse && NULL != context->log_buffer_pre_faulter;
+
+    if (!is_pooled && context->map_raw_log_func(
+        &_pub->mapped_raw_log,
+        path,
+        params->is_sparse || is_pre_faulted_async,
+        params->is_huge_pages,
+        params->numa_node,
+        params->term_length,
+        context->file_page_size) < 0)
     {
-        aeron_free(_pub->log_file_name);
-        aeron_free(_pub);
+        aeron_allocator_free(allocator, _pub->log_file_name, (size_t)path_length + 1);
+        aeron_allocator_free(allocator, _pub, sizeof(aeron_ipc_publication_t));
         aeron_set_err(aeron_errcode(), "error mapping IPC raw log %s: %s", path, aeron_errmsg());
         return -1;
     }
+
+    if (is_pre_faulted_async)
+    {
+        aeron_log_buffer_pre_faulter_offer(
+            context->log_buffer_pre_faulter, path, context->file_page_size, params->is_huge_pages, params->numa_node);
+    }
+
     _pub->map_raw_log_close_func = context->map_raw_log_close_func;
+    aeron_term_cleaner_init(&_pub->term_cleaner, context->term_buffer_clean_mode, context->file_page_size);
     _pub->untethered_subscription_state_change_func = context->untethered_subscription_state_change_func;
 
     strncpy(_pub->log_file_name, path, (size_t)path_length);
@@ -126,10 +157,13 @@ int aeron_ipc_publication_create(
 
     _pub->conductor_fields.subscribable.array = NULL;
     _pub->conductor_fields.subscribable.length = 0;
+    _pub->conductor_fields.subscribable.change_number = 0;
     _pub->conductor_fields.subscribable.capacity = 0;
     _pub->conductor_fields.subscribable.add_position_hook_func = aeron_ipc_publication_add_subscriber_hook;
     _pub->conductor_fields.subscribable.remove_position_hook_func = aeron_ipc_publication_remove_subscriber_hook;
     _pub->conductor_fields.subscribable.clientd = _pub;
+    aeron_min_position_tracker_init(&_pub->conductor_fields.min_position_tracker, false);
+    aeron_untethered_tracker_init(&_pub->conductor_fields.untethered_tracker);
     _pub->conductor_fields.managed_resource.registration_id = registration_id;
     _pub->conductor_fields.managed_resource.clientd = _pub;
     _pub->conductor_fields.managed_resource.incref = aeron_ipc_publication_incref;
@@ -149,9 +183,10 @@ int aeron_ipc_publication_create(
     _pub->position_bits_to_shift = (size_t)aeron_number_of_trailing_zeroes((int32_t)params->term_length);
     _pub->term_window_length = (int64_t)aeron_producer_window_length(
         context->ipc_publication_window_length, params->term_length);
-    _pub->trip_gain = _pub->term_window_length / 8;
+    _pub->trip_gain = context->ipc_publication_eager_limit_enabled ? 0 : _pub->term_window_length / 8;
     _pub->unblock_timeout_ns = (int64_t)context->publication_unblock_timeout_ns;
     _pub->is_exclusive = is_exclusive;
+    _pub->retain_history = params->retain_history;
 
     _pub->conductor_fields.consumer_position = aeron_ipc_publication_producer_position(_pub);
     _pub->conductor_fields.last_consumer_position = _pub->conductor_fields.consumer_position;
@@ -177,54 +212,85 @@ void aeron_ipc_publication_close(aeron_counters_manager_t *counters_manager, aer
         aeron_counters_manager_free(counters_manager, subscribable->array[i].counter_id);
     }
     aeron_free(subscribable->array);
+    aeron_min_position_tracker_close(&publication->conductor_fields.min_position_tracker);
+    aeron_untethered_tracker_close(&publication->conductor_fields.untethered_tracker);
 
     if (NULL != publication)
     {
-        publication->map_raw_log_close_func(&publication->mapped_raw_log, publication->log_file_name);
-        aeron_free(publication->log_file_name);
-    }
+        if (NULL == publication->log_buffer_pool || aeron_log_buffer_pool_release(
+            publication->log_buffer_pool, &publication->mapped_raw_log, publication->log_file_name) <= 0)
+        {
+            aeron_driver_housekeeper_close_log(
+                publication->housekeeper,
+                publication->map_raw_log_close_func,
+                &publication->mapped_raw_log,
+                publication->log_file_name);
+        }
 
-    aeron_free(publication);
+        aeron_allocator_t *allocator = publication->conductor_fields.allocator;
+        aeron_allocator_free(allocator, publication->log_file_name, publication->log_file_name_length + 1);
+        aeron_allocator_free(allocator, publication, sizeof(aeron_ipc_publication_t));
+    }
 }
 
-int aeron_ipc_publication_update_pub_lmt(aeron_ipc_publication_t *publication)
+/*
+ * Retaining history cleans a term behind the slowest subscriber, as a network publication does, so late joiners can
+ * start from the log. A producer may fill the term its limit falls in, so the cleaning must reach that far in full
+ * rather than stopping at a term end, or subscribers catching the producer could read stale frames ahead of it.
+ */
+static inline void aeron_ipc_publication_clean_to(aeron_ipc_publication_t *publication, int64_t position)
 {
-    int work_count = 0;
-    int64_t min_sub_pos = INT64_MAX;
-    int64_t max_sub_pos = publication->conductor_fields.consumer_position;
-
-    for (size_t i = 0, length = publication->conductor_fields.subscribable.length; i < length; i++)
+    if (publication->retain_history)
     {
-        aeron_tetherable_position_t *tetherable_position = &publication->conductor_fields.subscribable.array[i];
+        const int64_t clean_limit = position - (int64_t)publication->mapped_raw_log.term_length;
 
-        if (AERON_SUBSCRIPTION_TETHER_RESTING != tetherable_position->state)
+        while (publication->conductor_fields.clean_position < clean_limit)
         {
-            int64_t position = aeron_counter_get_volatile(tetherable_position->value_addr);
-
-            min_sub_pos = position < min_sub_pos ? position : min_sub_pos;
-            max_sub_pos = position > max_sub_pos ? position : max_sub_pos;
+            aeron_ipc_publication_clean_buffer(publication, clean_limit);
         }
     }
+    else
+    {
+        aeron_ipc_publication_clean_buffer(publication, position);
+    }
+}
+
+int aeron_ipc_publication_update_pub_lmt(aeron_ipc_publication_t *publication)
+{
+    int work_count = 0;
 
     if (publication->conductor_fields.subscribable.length > 0)
     {
-        int64_t proposed_limit = min_sub_pos + publication->term_window_length;
-        if (proposed_limit > publication->conductor_fields.trip_limit)
+        if (0 == publication->trip_gain)
         {
-            aeron_ipc_publication_clean_buffer(publication, min_sub_pos);
-            aeron_counter_set_ordered(publication->pub_lmt_position.value_addr, proposed_limit);
-            publication->conductor_fields.trip_limit = proposed_limit + publication->trip_gain;
-
-            work_count += 1;
+            aeron_min_position_tracker_invalidate(&publication->conductor_fields.min_position_tracker);
         }
 
-        publication->conductor_fields.consumer_position = max_sub_pos;
+        int64_t min_sub_pos = aeron_min_position_tracker_min(
+            &publication->conductor_fields.min_position_tracker,
+            &publication->conductor_fields.subscribable,
+            publication->conductor_fields.trip_limit - publication->term_window_length + 1);
+
+        if (INT64_MAX != min_sub_pos)
+        {
+            int64_t proposed_limit = min_sub_pos + publication->term_window_length;
+            if (proposed_limit > publication->conductor_fields.trip_limit)
+            {
+                aeron_ipc_publication_clean_to(publication, min_sub_pos);
+                aeron_counter_set_ordered(publication->pub_lmt_position.value_addr, proposed_limit);
+                publication->conductor_fields.trip_limit = proposed_limit + publication->trip_gain;
+
+                work_count += 1;
+            }
+        }
     }
-    else if (*publication->pub_lmt_position.value_addr > max_sub_pos)
+    else if (*publication->pub_lmt_position.value_addr > publication->conductor_fields.consumer_position)
     {
-        aeron_counter_set_ordered(publication->pub_lmt_position.value_addr, max_sub_pos);
-        publication->conductor_fields.trip_limit = max_sub_pos;
-        aeron_ipc_publication_clean_buffer(publication, max_sub_pos);
+        int64_t consumer_position = publication->conductor_fields.consumer_position;
+
+        aeron_counter_set_ordered(publication->pub_lmt_position.value_addr, consumer_position);
+        publication->conductor_fields.trip_limit = consumer_position;
+        aeron_ipc_publication_clean_to(publication, consumer_position);
     }
 
     return work_count;
@@ -242,13 +308,8 @@ void aeron_ipc_publication_clean_buffer(aeron_ipc_publication_t *publication, in
         size_t bytes_left_in_term = term_length - term_offset;
         size_t length = bytes_to_clean < bytes_left_in_term ? bytes_to_clean : bytes_left_in_term;
 
-        memset(
-            publication->mapped_raw_log.term_buffers[dirty_index].addr + term_offset + sizeof(int64_t),
-            0,
-            length - sizeof(int64_t));
-
-        uint64_t *ptr = (uint64_t *)(publication->mapped_raw_log.term_buffers[dirty_index].addr + term_offset);
-        AERON_PUT_ORDERED(*ptr, (uint64_t)0);
+        aeron_term_cleaner_clean(
+            &publication->term_cleaner, publication->mapped_raw_log.term_buffers[dirty_index].addr, term_offset, length);
 
         publication->conductor_fields.clean_position = clean_position + length;
     }
@@ -261,6 +322,13 @@ void aeron_ipc_publication_check_untethered_subscriptions(
     int64_t term_window_length = publication->term_window_length;
     int64_t untethered_window_limit = (consumer_position - term_window_length) + (term_window_length / 8);
 
+    aeron_untethered_tracker_t *untethered_tracker = &publication->conductor_fields.untethered_tracker;
+    if (aeron_untethered_tracker_is_ahead(
+        untethered_tracker, &publication->conductor_fields.subscribable, untethered_window_limit, now_ns))
+    {
+        return;
+    }
+
     for (size_t i = 0, length = publication->conductor_fields.subscribable.length; i < length; i++)
     {
         aeron_tetherable_position_t *tetherable_position = &publication->conductor_fields.subscribable.array[i];
@@ -281,10 +349,12 @@ void aeron_ipc_publication_check_untethered_subscriptions(
                     {
                         tetherable_position->time_of_last_update_ns = now_ns;
                     }
-                    else if (now_ns > (tetherable_position->time_of_last_update_ns + window_limit_timeout_ns))
+                    else if (now_ns > (aeron_untethered_tracker_time_of_last_update_ns(
+                        untethered_tracker, tetherable_position) + window_limit_timeout_ns))
                     {
                         aeron_driver_conductor_on_unavailable_image(
                             conductor,
+                            tetherable_position->subscription_client_id,
                             publication->conductor_fields.managed_resource.registration_id,
                             tetherable_position->subscription_registration_id,
                             publication->stream_id,
@@ -318,6 +388,7 @@ void aeron_ipc_publication_check_untethered_subscriptions(
                         aeron_counter_set_ordered(tetherable_position->value_addr, consumer_position);
                         aeron_driver_conductor_on_available_image(
                             conductor,
+                            tetherable_position->subscription_client_id,
                             publication->conductor_fields.managed_resource.registration_id,
                             publication->stream_id,
                             publication->session_id,
@@ -339,6 +410,8 @@ void aeron_ipc_publication_check_untethered_subscriptions(
             }
         }
     }
+
+    aeron_untethered_tracker_on_full_check(untethered_tracker, &publication->conductor_fields.subscribable);
 }
 
 void aeron_ipc_publication_on_time_event(
@@ -350,7 +423,9 @@ void aeron_ipc_publication_on_time_event(
     switch (publication->conductor_fields.state)
     {
         case AERON_IPC_PUBLICATION_STATE_ACTIVE:
+            aeron_ipc_publication_update_consumer_position(publication);
             aeron_ipc_publication_check_untethered_subscriptions(conductor, publication, now_ns);
+            aeron_min_position_tracker_invalidate(&publication->conductor_fields.min_position_tracker);
             if (!publication->is_exclusive)
             {
                 aeron_ipc_publication_check_for_blocked_publisher(publication, producer_position, now_ns);
@@ -371,6 +446,7 @@ void aeron_ipc_publication_on_time_event(
                     {
                         aeron_driver_conductor_on_unavailable_image(
                             conductor,
+                            link->client_id,
                             publication->conductor_fields.managed_resource.registration_id,
                             link->registration_id,
                             publication->stream_id,
@@ -382,7 +458,7 @@ void aeron_ipc_publication_on_time_event(
             else if (aeron_logbuffer_unblocker_unblock(
                 publication->mapped_raw_log.term_buffers,
                 publication->log_meta_data,
-                publication->conductor_fields.consumer_position))
+                aeron_ipc_publication_update_consumer_position(publication)))
             {
                 aeron_counter_ordered_increment(publication->unblocked_publications_counter, 1);
             }
@@ -458,8 +534,12 @@ extern bool aeron_ipc_publication_is_possibly_blocked(
 
 extern int64_t aeron_ipc_publication_producer_position(aeron_ipc_publication_t *publication);
 
+extern int64_t aeron_ipc_publication_update_consumer_position(aeron_ipc_publication_t *publication);
+
 extern int64_t aeron_ipc_publication_joining_position(aeron_ipc_publication_t *publication);
 
+extern int64_t aeron_ipc_publication_history_position(aeron_ipc_publication_t *publication);
+
 extern bool aeron_ipc_publication_has_reached_end_of_life(aeron_ipc_publication_t *publication);
 
 extern bool aeron_ipc_publication_is_drained(aeron_ipc_publication_t *publication);
@@ -22,8 +22,11 @@
 #include "uri/aeron_uri.h"
 #include "aeron_driver_context.h"
 #include "util/aeron_fileutil.h"
+#include "concurrent/aeron_term_cleaner.h"
 #include "concurrent/aeron_counters_manager.h"
 #include "aeron_system_counters.h"
+#include "aeron_min_position_tracker.h"
+#include "aeron_alloc.h"
 
 typedef enum aeron_ipc_publication_state_enum
 {
@@ -47,11 +50,14 @@ typedef struct aeron_ipc_publication_stct
         int32_t refcnt;
         aeron_driver_managed_resource_t managed_resource;
         aeron_subscribable_t subscribable;
+        aeron_min_position_tracker_t min_position_tracker;
+        aeron_untethered_tracker_t untethered_tracker;
         int64_t trip_limit;
         int64_t clean_position;
         int64_t consumer_position;
         int64_t last_consumer_position;
         int64_t time_of_last_consumer_position_change_ns;
+        aeron_allocator_t *allocator;
     }
     conductor_fields;
 
@@ -66,7 +72,11 @@ typedef struct aeron_ipc_publication_stct
     size_t log_file_name_length;
     size_t position_bits_to_shift;
     bool is_exclusive;
+    bool retain_history;
     aeron_map_raw_log_close_func_t map_raw_log_close_func;
+    aeron_log_buffer_pool_t *log_buffer_pool;
+    aeron_driver_housekeeper_t *housekeeper;
+    aeron_term_cleaner_t term_cleaner;
     aeron_untethered_subscription_state_change_func_t untethered_subscription_state_change_func;
 
     int64_t *unblocked_publications_counter;
@@ -76,6 +86,7 @@ aeron_ipc_publication_t;
 int aeron_ipc_publication_create(
     aeron_ipc_publication_t **publication,
     aeron_driver_context_t *context,
+    aeron_allocator_t *allocator,
     int32_t session_id,
     int32_t stream_id,
     int64_t registration_id,
@@ -105,6 +116,7 @@ void aeron_ipc_publication_check_for_blocked_publisher(
 inline void aeron_ipc_publication_add_subscriber_hook(void *clientd, int64_t *value_addr)
 {
     aeron_ipc_publication_t *publication = (aeron_ipc_publication_t *)clientd;
+    aeron_min_position_tracker_invalidate(&publication->conductor_fields.min_position_tracker);
     AERON_PUT_ORDERED(publication->log_meta_data->is_connected, 1);
 }
 
@@ -113,6 +125,8 @@ inline void aeron_ipc_publication_remove_subscriber_hook(void *clientd, int64_t
     aeron_ipc_publication_t *publication = (aeron_ipc_publication_t *)clientd;
     int64_t position = aeron_counter_get_volatile(value_addr);
 
+    aeron_min_position_tracker_invalidate(&publication->conductor_fields.min_position_tracker);
+
     publication->conductor_fields.consumer_position = position > publication->conductor_fields.consumer_position ?
         position : publication->conductor_fields.consumer_position;
 
@@ -151,9 +165,46 @@ inline int64_t aeron_ipc_publication_producer_position(aeron_ipc_publication_t *
         publication->initial_term_id);
 }
 
+/*
+ * The furthest position of the subscribers, which is only refreshed when needed rather than every duty cycle.
+ */
+inline int64_t aeron_ipc_publication_update_consumer_position(aeron_ipc_publication_t *publication)
+{
+    int64_t consumer_position = publication->conductor_fields.consumer_position;
+
+    for (size_t i = 0, length = publication->conductor_fields.subscribable.length; i < length; i++)
+    {
+        aeron_tetherable_position_t *tetherable_position = &publication->conductor_fields.subscribable.array[i];
+
+        if (AERON_SUBSCRIPTION_TETHER_RESTING != tetherable_position->state)
+        {
+            int64_t position = aeron_counter_get_volatile(tetherable_position->value_addr);
+            consumer_position = position > consumer_position ? position : consumer_position;
+        }
+    }
+
+    publication->conductor_fields.consumer_position = consumer_position;
+
+    return consumer_position;
+}
+
 inline int64_t aeron_ipc_publication_joining_position(aeron_ipc_publication_t *publication)
 {
-    return publication->conductor_fields.consumer_position;
+    return aeron_ipc_publication_update_consumer_position(publication);
+}
+
+/*
+ * The earliest term start still intact in the log, or the joining position if that is earlier, for a subscription
+ * which joins with the history the log retains rather than at the joining position.
+ */
+inline int64_t aeron_ipc_publication_history_position(aeron_ipc_publication_t *publication)
+{
+    const int64_t joining_position = aeron_ipc_publication_joining_position(publication);
+    const int64_t term_length = (int64_t)publication->mapped_raw_log.term_length;
+    const int64_t history_position =
+        (publication->conductor_fields.clean_position + (term_length - 1)) & ~(term_length - 1);
+
+    return history_position < joining_position ? history_position : joining_position;
 }
 
 inline bool aeron_ipc_publication_has_reached_end_of_life(aeron_ipc_publication_t *publication)
@@ -0,0 +1,358 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include <sys/stat.h>
+#if !defined(_MSC_VER)
+#include <dirent.h>
+#endif
+
+#include "aeron_windows.h"
+#include "aeron_alloc.h"
+#include "aeron_log_buffer_pool.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+#include "util/aeron_arrayutil.h"
+#include "util/aeron_error.h"
+
+int aeron_log_buffer_pool_init(aeron_log_buffer_pool_t *pool, const char *aeron_dir, size_t capacity)
+{
+    char dir[AERON_MAX_PATH];
+
+    snprintf(dir, sizeof(dir) - 1, "%s/%s", aeron_dir, AERON_LOG_BUFFER_POOL_DIR);
+    if (aeron_mkdir(dir, S_IRWXU | S_IRWXG | S_IRWXO) != 0 && EEXIST != errno)
+    {
+        aeron_set_err_from_last_err_code("mkdir %s", dir);
+        return -1;
+    }
+
+    if (NULL == (pool->dir = aeron_strndup(dir, AERON_MAX_PATH)))
+    {
+        aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&pool->entries.array, capacity * sizeof(aeron_log_buffer_pool_entry_t)) < 0)
+    {
+        aeron_free(pool->dir);
+        return -1;
+    }
+
+    pool->entries.length = 0;
+    pool->entries.capacity = capacity;
+    pool->next_file_id = 0;
+    pool->retain_on_close = false;
+
+    return 0;
+}
+
+int aeron_log_buffer_pool_acquire(
+    aeron_log_buffer_pool_t *pool,
+    aeron_mapped_raw_log_t *mapped_raw_log,
+    const char *path,
+    uint64_t term_length,
+    uint64_t page_size)
+{
+    const size_t log_length = (size_t)aeron_logbuffer_compute_log_length(term_length, page_size);
+
+    for (size_t i = 0, length = pool->entries.length; i < length; i++)
+    {
+        aeron_log_buffer_pool_entry_t *entry = &pool->entries.array[i];
+        const size_t entry_length = entry->mapped_raw_log.mapped_file.length;
+
+        if (entry_length == log_length &&
+            entry->cleaned_length == entry_length &&
+            entry->mapped_raw_log.term_length == (size_t)term_length)
+        {
+            if (rename(entry->path, path) < 0)
+            {
+                return 0;
+            }
+
+            *mapped_raw_log = entry->mapped_raw_log;
+            aeron_free(entry->path);
+            aeron_array_fast_unordered_remove(
+                (uint8_t *)pool->entries.array, sizeof(aeron_log_buffer_pool_entry_t), i, length - 1);
+            pool->entries.length--;
+
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int aeron_log_buffer_pool_release(
+    aeron_log_buffer_pool_t *pool,
+    aeron_mapped_raw_log_t *mapped_raw_log,
+    const char *path)
+{
+    char pool_path[AERON_MAX_PATH];
+    char *entry_path;
+
+    if (pool->entries.length >= pool->entries.capacity || NULL == mapped_raw_log->mapped_file.addr)
+    {
+        return 0;
+    }
+
+    snprintf(pool_path, sizeof(pool_path) - 1, "%s/%" PRId64 ".logbuffer", pool->dir, pool->next_file_id);
+
+    if (NULL == (entry_path = aeron_strndup(pool_path, AERON_MAX_PATH)))
+    {
+        return 0;
+    }
+
+    if (rename(path, pool_path) < 0)
+    {
+        aeron_free(entry_path);
+        return 0;
+    }
+
+    aeron_log_buffer_pool_entry_t *entry = &pool->entries.array[pool->entries.length++];
+    entry->mapped_raw_log = *mapped_raw_log;
+    entry->path = entry_path;
+    entry->cleaned_length = 0;
+    pool->next_file_id++;
+
+    mapped_raw_log->mapped_file.addr = NULL;
+
+    return 1;
+}
+
+int aeron_log_buffer_pool_do_work(aeron_log_buffer_pool_t *pool)
+{
+    for (size_t i = 0, length = pool->entries.length; i < length; i++)
+    {
+        aeron_log_buffer_pool_entry_t *entry = &pool->entries.array[i];
+        const size_t remaining = entry->mapped_raw_log.mapped_file.length - entry->cleaned_length;
+
+        if (remaining > 0)
+        {
+            const size_t chunk_length = remaining < AERON_LOG_BUFFER_POOL_CLEAN_CHUNK_LENGTH ?
+                remaining : AERON_LOG_BUFFER_POOL_CLEAN_CHUNK_LENGTH;
+            aeron_logbuffer_metadata_t *log_meta_data =
+                (aeron_logbuffer_metadata_t *)entry->mapped_raw_log.log_meta_data.addr;
+            const int32_t term_length = log_meta_data->term_length;
+            const int32_t page_size = log_meta_data->page_size;
+
+            memset((uint8_t *)entry->mapped_raw_log.mapped_file.addr + entry->cleaned_length, 0, chunk_length);
+            entry->cleaned_length += chunk_length;
+
+            // Keep the geometry so a clean log left behind by a warm restart can still be adopted.
+            log_meta_data->term_length = term_length;
+            log_meta_data->page_size = page_size;
+
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+size_t aeron_log_buffer_pool_mapped_length(aeron_log_buffer_pool_t *pool)
+{
+    size_t mapped_length = 0;
+
+    for (size_t i = 0, length = pool->entries.length; i < length; i++)
+    {
+        mapped_length += pool->entries.array[i].mapped_raw_log.mapped_file.length;
+    }
+
+    return mapped_length;
+}
+
+size_t aeron_log_buffer_pool_evict(aeron_log_buffer_pool_t *pool, size_t length)
+{
+    size_t freed_length = 0;
+
+    while (freed_length < length && pool->entries.length > 0)
+    {
+        aeron_log_buffer_pool_entry_t *entry = &pool->entries.array[--pool->entries.length];
+
+        freed_length += entry->mapped_raw_log.mapped_file.length;
+        aeron_map_raw_log_close(&entry->mapped_raw_log, entry->path);
+        aeron_free(entry->path);
+    }
+
+    return freed_length;
+}
+
+void aeron_log_buffer_pool_close(aeron_log_buffer_pool_t *pool)
+{
+    for (size_t i = 0, length = pool->entries.length; i < length; i++)
+    {
+        aeron_log_buffer_pool_entry_t *entry = &pool->entries.array[i];
+
+        if (pool->retain_on_close)
+        {
+            aeron_unmap(&entry->mapped_raw_log.mapped_file);
+        }
+        else
+        {
+            aeron_map_raw_log_close(&entry->mapped_raw_log, entry->path);
+        }
+        aeron_free(entry->path);
+    }
+
+    aeron_free(pool->entries.array);
+    aeron_free(pool->dir);
+    pool->entries.array = NULL;
+    pool->entries.length = 0;
+    pool->dir = NULL;
+}
+
+int aeron_log_buffer_pool_set_aside_dir(const char *aeron_dir)
+{
+    char warm_dir[AERON_MAX_PATH];
+
+    snprintf(warm_dir, sizeof(warm_dir) - 1, "%s%s", aeron_dir, AERON_LOG_BUFFER_POOL_WARM_DIR_SUFFIX);
+    if (aeron_is_directory(warm_dir))
+    {
+        aeron_delete_directory(warm_dir);
+    }
+
+    return rename(aeron_dir, warm_dir) < 0 ? 0 : 1;
+}
+
+static int aeron_log_buffer_pool_adopt_file(aeron_log_buffer_pool_t *pool, const char *path)
+{
+    aeron_mapped_raw_log_t mapped_raw_log;
+    char pool_path[AERON_MAX_PATH];
+    char *entry_path;
+
+    memset(&mapped_raw_log, 0, sizeof(mapped_raw_log));
+    if (aeron_map_existing_file(&mapped_raw_log.mapped_file, path) < 0)
+    {
+        return 0;
+    }
+
+    const size_t log_length = mapped_raw_log.mapped_file.length;
+    if (log_length < AERON_LOGBUFFER_META_DATA_LENGTH)
+    {
+        aeron_unmap(&mapped_raw_log.mapped_file);
+        return 0;
+    }
+
+    uint8_t *addr = (uint8_t *)mapped_raw_log.mapped_file.addr;
+    aeron_logbuffer_metadata_t *log_meta_data =
+        (aeron_logbuffer_metadata_t *)(addr + (log_length - AERON_LOGBUFFER_META_DATA_LENGTH));
+    const int32_t term_length = log_meta_data->term_length;
+    const int32_t page_size = log_meta_data->page_size;
+
+    if (term_length <= 0 || page_size <= 0 ||
+        log_length != (size_t)aeron_logbuffer_compute_log_length((uint64_t)term_length, (uint64_t)page_size))
+    {
+        aeron_unmap(&mapped_raw_log.mapped_file);
+        return 0;
+    }
+
+    snprintf(pool_path, sizeof(pool_path) - 1, "%s/%" PRId64 ".logbuffer", pool->dir, pool->next_file_id);
+    if (NULL == (entry_path = aeron_strndup(pool_path, AERON_MAX_PATH)))
+    {
+        aeron_unmap(&mapped_raw_log.mapped_file);
+        return 0;
+    }
+
+    if (rename(path, pool_path) < 0)
+    {
+        aeron_free(entry_path);
+        aeron_unmap(&mapped_raw_log.mapped_file);
+        return 0;
+    }
+
+    for (size_t i = 0; i < AERON_LOGBUFFER_PARTITION_COUNT; i++)
+    {
+        mapped_raw_log.term_buffers[i].addr = addr + (i * (size_t)term_length);
+        mapped_raw_log.term_buffers[i].length = (size_t)term_length;
+    }
+
+    mapped_raw_log.log_meta_data.addr = (uint8_t *)log_meta_data;
+    mapped_raw_log.log_meta_data.length = AERON_LOGBUFFER_META_DATA_LENGTH;
+    mapped_raw_log.term_length = (size_t)term_length;
+
+    aeron_log_buffer_pool_entry_t *entry = &pool->entries.array[pool->entries.length++];
+    entry->mapped_raw_log = mapped_raw_log;
+    entry->path = entry_path;
+    entry->cleaned_length = 0;
+    pool->next_file_id++;
+
+    return 1;
+}
+
+static int aeron_log_buffer_pool_adopt_dir(aeron_log_buffer_pool_t *pool, const char *dir)
+{
+    int adopted = 0;
+#if !defined(_MSC_VER)
+    const char *suffix = ".logbuffer";
+    const size_t suffix_length = strlen(suffix);
+    DIR *dirp = opendir(dir);
+    struct dirent *dirent;
+
+    if (NULL == dirp)
+    {
+        return 0;
+    }
+
+    while (pool->entries.length < pool->entries.capacity && NULL != (dirent = readdir(dirp)))
+    {
+        const size_t name_length = strlen(dirent->d_name);
+        char path[AERON_MAX_PATH];
+
+        if (name_length <= suffix_length || 0 != strcmp(dirent->d_name + (name_length - suffix_length), suffix))
+        {
+            continue;
+        }
+
+        if (snprintf(path, sizeof(path), "%s/%s", dir, dirent->d_name) >= (int)sizeof(path))
+        {
+            continue;
+        }
+
+        adopted += aeron_log_buffer_pool_adopt_file(pool, path);
+    }
+
+    closedir(dirp);
+#endif
+    return adopted;
+}
+
+int aeron_log_buffer_pool_adopt_set_aside_dir(aeron_log_buffer_pool_t *pool, const char *aeron_dir)
+{
+    const char *sub_dirs[] = { AERON_LOG_BUFFER_POOL_DIR, AERON_PUBLICATIONS_DIR, AERON_IMAGES_DIR };
+    char warm_dir[AERON_MAX_PATH];
+    char dir[AERON_MAX_PATH];
+    int adopted = 0;
+
+    snprintf(warm_dir, sizeof(warm_dir) - 1, "%s%s", aeron_dir, AERON_LOG_BUFFER_POOL_WARM_DIR_SUFFIX);
+    if (!aeron_is_directory(warm_dir))
+    {
+        return 0;
+    }
+
+    for (size_t i = 0; i < sizeof(sub_dirs) / sizeof(sub_dirs[0]); i++)
+    {
+        if (snprintf(dir, sizeof(dir), "%s/%s", warm_dir, sub_dirs[i]) < (int)sizeof(dir))
+        {
+            adopted += aeron_log_buffer_pool_adopt_dir(pool, dir);
+        }
+    }
+
+    aeron_delete_directory(warm_dir);
+
+    return adopted;
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_LOG_BUFFER_POOL_H
+#define AERON_LOG_BUFFER_POOL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "util/aeron_fileutil.h"
+
+#define AERON_LOG_BUFFER_POOL_DIR "pool"
+#define AERON_LOG_BUFFER_POOL_CAPACITY_MAX (1024)
+#define AERON_LOG_BUFFER_POOL_CLEAN_CHUNK_LENGTH (256 * 1024)
+#define AERON_LOG_BUFFER_POOL_WARM_DIR_SUFFIX "-warm"
+
+typedef struct aeron_log_buffer_pool_entry_stct
+{
+    aeron_mapped_raw_log_t mapped_raw_log;
+    char *path;
+    size_t cleaned_length;
+}
+aeron_log_buffer_pool_entry_t;
+
+/*
+ * Log files released at the end of their linger are renamed into the pool directory and kept mapped rather than
+ * deleted. They are zeroed a chunk per conductor duty cycle and, once clean, renamed to the location of the next
+ * log of the same term length and page size instead of creating, truncating and pre-faulting a new file. Only
+ * non-sparse logs with default page placement are pooled.
+ */
+typedef struct aeron_log_buffer_pool_stct
+{
+    struct aeron_log_buffer_pool_entries_stct
+    {
+        aeron_log_buffer_pool_entry_t *array;
+        size_t length;
+        size_t capacity;
+    }
+    entries;
+
+    char *dir;
+    int64_t next_file_id;
+    bool retain_on_close;
+}
+aeron_log_buffer_pool_t;
+
+int aeron_log_buffer_pool_init(aeron_log_buffer_pool_t *pool, const char *aeron_dir, size_t capacity);
+
+/*
+ * Returns 1 if a clean pooled log was moved to path, 0 if none matched and the caller should create the log.
+ */
+int aeron_log_buffer_pool_acquire(
+    aeron_log_buffer_pool_t *pool,
+    aeron_mapped_raw_log_t *mapped_raw_log,
+    const char *path,
+    uint64_t term_length,
+    uint64_t page_size);
+
+/*
+ * Returns 1 if the log was taken by the pool, 0 if the pool is full or the log could not be moved and the caller
+ * should close it.
+ */
+int aeron_log_buffer_pool_release(
+    aeron_log_buffer_pool_t *pool,
+    aeron_mapped_raw_log_t *mapped_raw_log,
+    const char *path);
+
+int aeron_log_buffer_pool_do_work(aeron_log_buffer_pool_t *pool);
+
+/*
+ * Total length of the logs held by the pool.
+ */
+size_t aeron_log_buffer_pool_mapped_length(aeron_log_buffer_pool_t *pool);
+
+/*
+ * Delete pooled logs, most recently released first, until at least length bytes have been freed or the pool is
+ * empty. Returns the number of bytes freed.
+ */
+size_t aeron_log_buffer_pool_evict(aeron_log_buffer_pool_t *pool, size_t length);
+
+/*
+ * Move an inactive aeron directory aside to <aeron_dir>-warm so its log buffers can be adopted once the new pool
+ * exists. Returns 1 if the directory was moved, 0 if it was not and the caller should delete it.
+ */
+int aeron_log_buffer_pool_set_aside_dir(const char *aeron_dir);
+
+/*
+ * Adopt the log buffers in the publications, images and pool directories set aside for aeron_dir, up to the pool
+ * capacity, then delete what is left. Adopted logs are cleaned by do_work before reuse. Returns the number adopted.
+ */
+int aeron_log_buffer_pool_adopt_set_aside_dir(aeron_log_buffer_pool_t *pool, const char *aeron_dir);
+
+void aeron_log_buffer_pool_close(aeron_log_buffer_pool_t *pool);
+
+#endif //AERON_LOG_BUFFER_POOL_H
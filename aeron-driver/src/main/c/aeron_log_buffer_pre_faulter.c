@@ -0,0 +1,152 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <errno.h>
+
+#include "aeron_windows.h"
+#include "aeron_alloc.h"
+#include "aeron_log_buffer_pre_faulter.h"
+#include "command/aeron_control_protocol.h"
+#include "concurrent/aeron_atomic.h"
+#include "util/aeron_error.h"
+#include "util/aeron_fileutil.h"
+
+int aeron_log_buffer_pre_faulter_init(
+    aeron_log_buffer_pre_faulter_t *pre_faulter, aeron_distinct_error_log_t *error_log)
+{
+    if (aeron_spsc_concurrent_array_queue_init(
+        &pre_faulter->task_queue, AERON_LOG_BUFFER_PRE_FAULTER_QUEUE_CAPACITY) < 0)
+    {
+        return -1;
+    }
+
+    pre_faulter->error_log = error_log;
+    pre_faulter->idle_sleep_ns = AERON_LOG_BUFFER_PRE_FAULTER_IDLE_SLEEP_NS;
+    pre_faulter->pre_faulted_count = 0;
+
+    return 0;
+}
+
+int aeron_log_buffer_pre_fault(const char *path, size_t page_size, bool use_huge_pages, int32_t numa_node)
+{
+    aeron_mapped_file_t mapped_file = { NULL, 0 };
+
+    if (aeron_map_existing_file(&mapped_file, path) < 0)
+    {
+        if (ENOENT == aeron_errcode())
+        {
+            /* log was closed and deleted before it was reached */
+            return 0;
+        }
+
+        aeron_set_err(aeron_errcode(), "could not map log buffer %s for pre-faulting: %s", path, aeron_errmsg());
+        return -1;
+    }
+
+    if ((use_huge_pages && aeron_advise_huge_pages(&mapped_file) < 0) ||
+        (AERON_NUMA_NODE_NONE != numa_node && aeron_bind_numa_node(&mapped_file, numa_node) < 0))
+    {
+        aeron_unmap(&mapped_file);
+        return -1;
+    }
+
+    /* an atomic add of zero takes a write fault without racing a client that may already be appending */
+    for (size_t i = 0; i < mapped_file.length; i += page_size)
+    {
+        int64_t original;
+        volatile int64_t *first_page_word = (volatile int64_t *)((uint8_t *)mapped_file.addr + i);
+        AERON_GET_AND_ADD_INT64(original, *first_page_word, 0);
+        (void)original;
+    }
+
+    return aeron_unmap(&mapped_file);
+}
+
+void aeron_log_buffer_pre_faulter_offer(
+    aeron_log_buffer_pre_faulter_t *pre_faulter,
+    const char *path,
+    size_t page_size,
+    bool use_huge_pages,
+    int32_t numa_node)
+{
+    aeron_log_buffer_pre_fault_task_t *task = NULL;
+
+    if (aeron_alloc((void **)&task, sizeof(aeron_log_buffer_pre_fault_task_t)) == 0)
+    {
+        if (NULL != (task->path = aeron_strndup(path, AERON_MAX_PATH)))
+        {
+            task->page_size = page_size;
+            task->use_huge_pages = use_huge_pages;
+            task->numa_node = numa_node;
+
+            if (AERON_OFFER_SUCCESS == aeron_spsc_concurrent_array_queue_offer(&pre_faulter->task_queue, task))
+            {
+                return;
+            }
+
+            aeron_free(task->path);
+        }
+
+        aeron_free(task);
+    }
+
+    if (aeron_log_buffer_pre_fault(path, page_size, use_huge_pages, numa_node) < 0)
+    {
+        aeron_distinct_error_log_record(pre_faulter->error_log, AERON_ERROR_CODE_GENERIC_ERROR, aeron_errmsg(), "");
+    }
+}
+
+static void aeron_log_buffer_pre_faulter_on_task(void *clientd, volatile void *item)
+{
+    aeron_log_buffer_pre_faulter_t *pre_faulter = (aeron_log_buffer_pre_faulter_t *)clientd;
+    aeron_log_buffer_pre_fault_task_t *task = (aeron_log_buffer_pre_fault_task_t *)item;
+
+    if (aeron_log_buffer_pre_fault(task->path, task->page_size, task->use_huge_pages, task->numa_node) < 0)
+    {
+        aeron_distinct_error_log_record(pre_faulter->error_log, AERON_ERROR_CODE_GENERIC_ERROR, aeron_errmsg(), "");
+    }
+
+    AERON_PUT_ORDERED(pre_faulter->pre_faulted_count, pre_faulter->pre_faulted_count + 1);
+
+    aeron_free(task->path);
+    aeron_free(task);
+}
+
+int aeron_log_buffer_pre_faulter_do_work(void *clientd)
+{
+    aeron_log_buffer_pre_faulter_t *pre_faulter = (aeron_log_buffer_pre_faulter_t *)clientd;
+
+    /* one log at a time, each may be large */
+    return (int)aeron_spsc_concurrent_array_queue_drain(
+        &pre_faulter->task_queue, aeron_log_buffer_pre_faulter_on_task, pre_faulter, 1);
+}
+
+static void aeron_log_buffer_pre_faulter_free_task(void *clientd, volatile void *item)
+{
+    aeron_log_buffer_pre_fault_task_t *task = (aeron_log_buffer_pre_fault_task_t *)item;
+
+    aeron_free(task->path);
+    aeron_free(task);
+}
+
+void aeron_log_buffer_pre_faulter_on_close(void *clientd)
+{
+    aeron_log_buffer_pre_faulter_t *pre_faulter = (aeron_log_buffer_pre_faulter_t *)clientd;
+
+    aeron_spsc_concurrent_array_queue_drain_all(
+        &pre_faulter->task_queue, aeron_log_buffer_pre_faulter_free_task, NULL);
+    aeron_spsc_concurrent_array_queue_close(&pre_faulter->task_queue);
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_LOG_BUFFER_PRE_FAULTER_H
+#define AERON_LOG_BUFFER_PRE_FAULTER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "concurrent/aeron_spsc_concurrent_array_queue.h"
+#include "concurrent/aeron_distinct_error_log.h"
+
+#define AERON_LOG_BUFFER_PRE_FAULTER_QUEUE_CAPACITY (256)
+#define AERON_LOG_BUFFER_PRE_FAULTER_IDLE_SLEEP_NS (1000 * 1000LL)
+
+typedef struct aeron_log_buffer_pre_fault_task_stct
+{
+    char *path;
+    size_t page_size;
+    bool use_huge_pages;
+    int32_t numa_node;
+}
+aeron_log_buffer_pre_fault_task_t;
+
+/*
+ * Faults in the pages of newly created log buffers on a background agent so the conductor only pays for creating
+ * and truncating the file. The log is mapped independently by the agent so a log closed by the conductor in the
+ * meantime stays valid until the task completes, and pages are touched without altering their contents as clients
+ * may already be writing to them.
+ */
+typedef struct aeron_log_buffer_pre_faulter_stct
+{
+    aeron_spsc_concurrent_array_queue_t task_queue;
+    aeron_distinct_error_log_t *error_log;
+    uint64_t idle_sleep_ns;
+    volatile int64_t pre_faulted_count;
+}
+aeron_log_buffer_pre_faulter_t;
+
+int aeron_log_buffer_pre_faulter_init(
+    aeron_log_buffer_pre_faulter_t *pre_faulter, aeron_distinct_error_log_t *error_log);
+
+/*
+ * Queue a log for pre-faulting, falling back to pre-faulting on the caller's thread when the queue is full.
+ */
+void aeron_log_buffer_pre_faulter_offer(
+    aeron_log_buffer_pre_faulter_t *pre_faulter,
+    const char *path,
+    size_t page_size,
+    bool use_huge_pages,
+    int32_t numa_node);
+
+int aeron_log_buffer_pre_fault(const char *path, size_t page_size, bool use_huge_pages, int32_t numa_node);
+
+int aeron_log_buffer_pre_faulter_do_work(void *clientd);
+
+void aeron_log_buffer_pre_faulter_on_close(void *clientd);
+
+#endif //AERON_LOG_BUFFER_PRE_FAULTER_H
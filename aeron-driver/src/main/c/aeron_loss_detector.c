@@ -36,10 +36,44 @@ int aeron_loss_detector_init(
     detector->active_gap.term_offset = -1;
     detector->scanned_gap.term_offset = -1;
     detector->feedback_delay_state = feedback_delay_state;
+    detector->max_gaps = 1;
 
     return 0;
 }
 
+/*
+ * Gaps beyond the first ride along with its NAK so bursty loss with several holes is repaired in one round trip, the
+ * first gap's timer paces them all as they become the first gap in turn.
+ */
+static void aeron_loss_detector_scan_for_further_gaps(
+    aeron_loss_detector_t *detector, const uint8_t *buffer, int32_t term_id, int32_t limit_offset)
+{
+    int32_t offset = detector->active_gap.term_offset + (int32_t)detector->active_gap.length;
+
+    for (size_t i = 1; i < detector->max_gaps && offset < limit_offset; i++)
+    {
+        detector->scanned_gap.term_offset = -1;
+
+        const int32_t gap_offset = aeron_term_gap_scanner_scan_for_gap(
+            buffer, term_id, offset, limit_offset, aeron_loss_detector_on_gap, detector);
+
+        if (gap_offset >= limit_offset || detector->scanned_gap.term_offset != gap_offset)
+        {
+            break;
+        }
+
+        detector->on_gap_detected(
+            detector->on_gap_detected_clientd,
+            detector->scanned_gap.term_id,
+            detector->scanned_gap.term_offset,
+            detector->scanned_gap.length);
+
+        offset = gap_offset + (int32_t)detector->scanned_gap.length;
+    }
+
+    detector->scanned_gap = detector->active_gap;
+}
+
 int32_t aeron_loss_detector_scan(
     aeron_loss_detector_t *detector,
     bool *loss_found,
@@ -80,7 +114,10 @@ int32_t aeron_loss_detector_scan(
                 *loss_found = true;
             }
 
-            aeron_loss_detector_check_timer_expiry(detector, now_ns);
+            if (aeron_loss_detector_check_timer_expiry(detector, now_ns) && detector->max_gaps > 1)
+            {
+                aeron_loss_detector_scan_for_further_gaps(detector, buffer, rebuild_term_id, limit_offset);
+            }
         }
     }
 
@@ -95,15 +132,9 @@ int aeron_feedback_delay_state_init(
     bool should_immediate_feedback)
 {
     static bool is_seeded = false;
-    double lambda = log((double)multicast_group_size) + 1;
-    double max_backoff_T = (double)delay_ns;
 
-    state->static_delay.delay_ns = delay_ns;
-
-    state->optimal_delay.rand_max = lambda / max_backoff_T;
-    state->optimal_delay.base_x = lambda / (max_backoff_T * (exp(lambda) - 1));
-    state->optimal_delay.constant_t = max_backoff_T / lambda;
-    state->optimal_delay.factor_t = (exp(lambda) - 1) * (max_backoff_T / lambda);
+    state->optimal_delay.lambda = log((double)multicast_group_size) + 1;
+    aeron_feedback_delay_state_set_delay(state, delay_ns);
 
     if (!is_seeded)
     {
@@ -116,6 +147,19 @@ int aeron_feedback_delay_state_init(
     return 0;
 }
 
+void aeron_feedback_delay_state_set_delay(aeron_feedback_delay_generator_state_t *state, int64_t delay_ns)
+{
+    const double lambda = state->optimal_delay.lambda;
+    const double max_backoff_T = (double)delay_ns;
+
+    state->static_delay.delay_ns = delay_ns;
+
+    state->optimal_delay.rand_max = lambda / max_backoff_T;
+    state->optimal_delay.base_x = lambda / (max_backoff_T * (exp(lambda) - 1));
+    state->optimal_delay.constant_t = max_backoff_T / lambda;
+    state->optimal_delay.factor_t = (exp(lambda) - 1) * (max_backoff_T / lambda);
+}
+
 int64_t aeron_loss_detector_nak_multicast_delay_generator(aeron_feedback_delay_generator_state_t *state)
 {
     const double x = (aeron_drand48() * state->optimal_delay.rand_max) + state->optimal_delay.base_x;
@@ -124,7 +168,8 @@ int64_t aeron_loss_detector_nak_multicast_delay_generator(aeron_feedback_delay_g
 }
 
 extern int64_t aeron_loss_detector_nak_unicast_delay_generator(aeron_feedback_delay_generator_state_t *state);
+extern int64_t aeron_loss_detector_nak_rtt_delay_ns(int64_t rtt_ns);
 extern void aeron_loss_detector_on_gap(void *clientd, int32_t term_id, int32_t term_offset, size_t length);
 extern bool aeron_loss_detector_gaps_match(aeron_loss_detector_t *detector);
 extern void aeron_loss_detector_activate_gap(aeron_loss_detector_t *detector, int64_t now_ns);
-extern void aeron_loss_detector_check_timer_expiry(aeron_loss_detector_t *detector, int64_t now_ns);
+extern bool aeron_loss_detector_check_timer_expiry(aeron_loss_detector_t *detector, int64_t now_ns);
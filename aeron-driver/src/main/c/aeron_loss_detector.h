@@ -30,6 +30,7 @@ typedef struct aeron_loss_detector_gap_stct
 aeron_loss_detector_gap_t;
 
 #define AERON_LOSS_DETECTOR_TIMER_INACTIVE (-1)
+#define AERON_LOSS_DETECTOR_MAX_GAPS (16)
 
 typedef struct aeron_loss_detector_stct
 {
@@ -39,6 +40,7 @@ typedef struct aeron_loss_detector_stct
     aeron_loss_detector_gap_t scanned_gap;
     aeron_loss_detector_gap_t active_gap;
     int64_t expiry_ns;
+    size_t max_gaps;
 }
 aeron_loss_detector_t;
 
@@ -76,8 +78,34 @@ int aeron_feedback_delay_state_init(
     size_t multicast_group_size,
     bool should_immediate_feedback);
 
+/*
+ * Sets the unicast delay or the multicast max backoff of an initialised state, keeping the multicast group size
+ * and feedback mode it was initialised with.
+ */
+void aeron_feedback_delay_state_set_delay(aeron_feedback_delay_generator_state_t *state, int64_t delay_ns);
+
 int64_t aeron_loss_detector_nak_multicast_delay_generator(aeron_feedback_delay_generator_state_t *state);
 
+#define AERON_LOSS_DETECTOR_NAK_RTT_MULTIPLIER (2)
+#define AERON_LOSS_DETECTOR_NAK_RTT_MIN_DELAY_NS (100 * 1000LL)
+#define AERON_LOSS_DETECTOR_NAK_RTT_MAX_DELAY_NS (1000 * 1000 * 1000LL)
+
+/*
+ * A retransmit can not arrive sooner than one RTT after the NAK for it, so an RTT adaptive delay gives the
+ * retransmit time to land before NAKing again, or before a multicast receiver gives up on suppression.
+ */
+inline int64_t aeron_loss_detector_nak_rtt_delay_ns(int64_t rtt_ns)
+{
+    const int64_t delay_ns = rtt_ns * AERON_LOSS_DETECTOR_NAK_RTT_MULTIPLIER;
+
+    if (delay_ns < AERON_LOSS_DETECTOR_NAK_RTT_MIN_DELAY_NS)
+    {
+        return AERON_LOSS_DETECTOR_NAK_RTT_MIN_DELAY_NS;
+    }
+
+    return delay_ns > AERON_LOSS_DETECTOR_NAK_RTT_MAX_DELAY_NS ? AERON_LOSS_DETECTOR_NAK_RTT_MAX_DELAY_NS : delay_ns;
+}
+
 inline void aeron_loss_detector_on_gap(void *clientd, int32_t term_id, int32_t term_offset, size_t length)
 {
     aeron_loss_detector_t *detector = (aeron_loss_detector_t *)clientd;
@@ -109,7 +137,7 @@ inline void aeron_loss_detector_activate_gap(aeron_loss_detector_t *detector, in
     }
 }
 
-inline void aeron_loss_detector_check_timer_expiry(aeron_loss_detector_t *detector, int64_t now_ns)
+inline bool aeron_loss_detector_check_timer_expiry(aeron_loss_detector_t *detector, int64_t now_ns)
 {
     if (now_ns >= detector->expiry_ns)
     {
@@ -119,7 +147,11 @@ inline void aeron_loss_detector_check_timer_expiry(aeron_loss_detector_t *detect
             detector->active_gap.term_offset,
             detector->active_gap.length);
         detector->expiry_ns = now_ns + detector->feedback_delay_state->delay_generator(detector->feedback_delay_state);
+
+        return true;
     }
+
+    return false;
 }
 
 #endif //AERON_LOSS_DETECTOR_H
@@ -24,11 +24,16 @@
 #include "protocol/aeron_udp_protocol.h"
 #include "concurrent/aeron_logbuffer_descriptor.h"
 #include "util/aeron_arrayutil.h"
+#include "collections/aeron_int64_counter_map.h"
 #include "aeron_flow_control.h"
 #include "aeron_alloc.h"
 #include "aeron_driver_context.h"
 #include "media/aeron_udp_channel.h"
 
+#define AERON_MIN_FLOW_CONTROL_POSITION_HEAP (0)
+#define AERON_MIN_FLOW_CONTROL_TIMEOUT_HEAP (1)
+#define AERON_MIN_FLOW_CONTROL_HEAP_COUNT (2)
+
 typedef struct aeron_min_flow_control_strategy_receiver_stct
 {
     uint8_t padding_before[AERON_CACHE_LINE_LENGTH];
@@ -36,10 +41,16 @@ typedef struct aeron_min_flow_control_strategy_receiver_stct
     int64_t last_position_plus_window;
     int64_t time_of_last_status_message_ns;
     int64_t receiver_id;
+    int32_t heap_index[AERON_MIN_FLOW_CONTROL_HEAP_COUNT];
     uint8_t padding_after[AERON_CACHE_LINE_LENGTH];
 }
 aeron_min_flow_control_strategy_receiver_t;
 
+/*
+ * Receivers are indexed by receiver id and ordered by two binary heaps of receiver indices, one on position plus
+ * window for the minimum and one on the time of the last status message for timeouts. A status message and each
+ * timeout then cost O(log receivers) rather than a walk of every receiver.
+ */
 typedef struct aeron_min_flow_control_strategy_state_stct
 {
     struct receiver_stct
@@ -50,6 +61,10 @@ typedef struct aeron_min_flow_control_strategy_state_stct
     }
     receivers;
 
+    int32_t *heaps[AERON_MIN_FLOW_CONTROL_HEAP_COUNT];
+    size_t heap_capacity;
+    aeron_int64_counter_map_t receiver_index_by_id;
+
     int64_t receiver_timeout_ns;
     int32_t group_min_size;
     int64_t group_tag;
@@ -69,6 +84,220 @@ size_t aeron_min_flow_control_strategy_state_get_length(aeron_min_flow_control_s
     return length;
 }
 
+static inline int64_t aeron_min_flow_control_strategy_heap_key(
+    aeron_min_flow_control_strategy_state_t *state, int heap, int32_t receiver_index)
+{
+    aeron_min_flow_control_strategy_receiver_t *receiver = &state->receivers.array[receiver_index];
+
+    return AERON_MIN_FLOW_CONTROL_POSITION_HEAP == heap ?
+        receiver->last_position_plus_window : receiver->time_of_last_status_message_ns;
+}
+
+static inline void aeron_min_flow_control_strategy_heap_set(
+    aeron_min_flow_control_strategy_state_t *state, int heap, size_t heap_index, int32_t receiver_index)
+{
+    state->heaps[heap][heap_index] = receiver_index;
+    state->receivers.array[receiver_index].heap_index[heap] = (int32_t)heap_index;
+}
+
+static void aeron_min_flow_control_strategy_heap_sift_up(
+    aeron_min_flow_control_strategy_state_t *state, int heap, size_t heap_index)
+{
+    const int32_t receiver_index = state->heaps[heap][heap_index];
+    const int64_t key = aeron_min_flow_control_strategy_heap_key(state, heap, receiver_index);
+
+    while (heap_index > 0)
+    {
+        const size_t parent_index = (heap_index - 1) / 2;
+        const int32_t parent = state->heaps[heap][parent_index];
+
+        if (aeron_min_flow_control_strategy_heap_key(state, heap, parent) <= key)
+        {
+            break;
+        }
+
+        aeron_min_flow_control_strategy_heap_set(state, heap, heap_index, parent);
+        heap_index = parent_index;
+    }
+
+    aeron_min_flow_control_strategy_heap_set(state, heap, heap_index, receiver_index);
+}
+
+static void aeron_min_flow_control_strategy_heap_sift_down(
+    aeron_min_flow_control_strategy_state_t *state, int heap, size_t heap_index, size_t length)
+{
+    const int32_t receiver_index = state->heaps[heap][heap_index];
+    const int64_t key = aeron_min_flow_control_strategy_heap_key(state, heap, receiver_index);
+
+    while (true)
+    {
+        size_t child_index = (2 * heap_index) + 1;
+        if (child_index >= length)
+        {
+            break;
+        }
+
+        int64_t child_key = aeron_min_flow_control_strategy_heap_key(state, heap, state->heaps[heap][child_index]);
+        if (child_index + 1 < length)
+        {
+            const int64_t right_key = aeron_min_flow_control_strategy_heap_key(
+                state, heap, state->heaps[heap][child_index + 1]);
+
+            if (right_key < child_key)
+            {
+                child_index++;
+                child_key = right_key;
+            }
+        }
+
+        if (key <= child_key)
+        {
+            break;
+        }
+
+        aeron_min_flow_control_strategy_heap_set(state, heap, heap_index, state->heaps[heap][child_index]);
+        heap_index = child_index;
+    }
+
+    aeron_min_flow_control_strategy_heap_set(state, heap, heap_index, receiver_index);
+}
+
+static inline void aeron_min_flow_control_strategy_heap_fix(
+    aeron_min_flow_control_strategy_state_t *state, int heap, size_t heap_index, size_t length)
+{
+    const int32_t receiver_index = state->heaps[heap][heap_index];
+
+    aeron_min_flow_control_strategy_heap_sift_up(state, heap, heap_index);
+    aeron_min_flow_control_strategy_heap_sift_down(
+        state, heap, (size_t)state->receivers.array[receiver_index].heap_index[heap], length);
+}
+
+static inline void aeron_min_flow_control_strategy_receiver_updated(
+    aeron_min_flow_control_strategy_state_t *state, int32_t receiver_index)
+{
+    aeron_min_flow_control_strategy_receiver_t *receiver = &state->receivers.array[receiver_index];
+
+    for (int heap = 0; heap < AERON_MIN_FLOW_CONTROL_HEAP_COUNT; heap++)
+    {
+        aeron_min_flow_control_strategy_heap_fix(
+            state, heap, (size_t)receiver->heap_index[heap], state->receivers.length);
+    }
+}
+
+static int aeron_min_flow_control_strategy_ensure_capacity(aeron_min_flow_control_strategy_state_t *state)
+{
+    int ensure_capacity_result = 0;
+    AERON_ARRAY_ENSURE_CAPACITY(
+        ensure_capacity_result,
+        state->receivers,
+        aeron_min_flow_control_strategy_receiver_t);
+
+    if (ensure_capacity_result < 0)
+    {
+        return -1;
+    }
+
+    if (state->heap_capacity < state->receivers.capacity)
+    {
+        for (int heap = 0; heap < AERON_MIN_FLOW_CONTROL_HEAP_COUNT; heap++)
+        {
+            if (aeron_array_ensure_capacity(
+                (uint8_t **)&state->heaps[heap], sizeof(int32_t), state->heap_capacity, state->receivers.capacity) < 0)
+            {
+                return -1;
+            }
+        }
+
+        state->heap_capacity = state->receivers.capacity;
+    }
+
+    return 0;
+}
+
+static int aeron_min_flow_control_strategy_add_receiver(
+    aeron_min_flow_control_strategy_state_t *state,
+    int64_t receiver_id,
+    int64_t position,
+    int64_t window_length,
+    int64_t now_ns)
+{
+    if (aeron_min_flow_control_strategy_ensure_capacity(state) < 0)
+    {
+        return -1;
+    }
+
+    const size_t receivers_length = state->receivers.length;
+    if (aeron_int64_counter_map_put(&state->receiver_index_by_id, receiver_id, (int64_t)receivers_length, NULL) < 0)
+    {
+        return -1;
+    }
+
+    aeron_min_flow_control_strategy_receiver_t *receiver = &state->receivers.array[receivers_length];
+    receiver->last_position = position;
+    receiver->last_position_plus_window = position + window_length;
+    receiver->time_of_last_status_message_ns = now_ns;
+    receiver->receiver_id = receiver_id;
+
+    aeron_min_flow_control_strategy_state_set_length(state, receivers_length + 1);
+
+    for (int heap = 0; heap < AERON_MIN_FLOW_CONTROL_HEAP_COUNT; heap++)
+    {
+        aeron_min_flow_control_strategy_heap_set(state, heap, receivers_length, (int32_t)receivers_length);
+        aeron_min_flow_control_strategy_heap_sift_up(state, heap, receivers_length);
+    }
+
+    return 0;
+}
+
+static void aeron_min_flow_control_strategy_remove_receiver(
+    aeron_min_flow_control_strategy_state_t *state, int32_t receiver_index)
+{
+    const size_t last_index = state->receivers.length - 1;
+    aeron_min_flow_control_strategy_receiver_t *receiver = &state->receivers.array[receiver_index];
+
+    for (int heap = 0; heap < AERON_MIN_FLOW_CONTROL_HEAP_COUNT; heap++)
+    {
+        const size_t heap_index = (size_t)receiver->heap_index[heap];
+
+        if (heap_index != last_index)
+        {
+            aeron_min_flow_control_strategy_heap_set(state, heap, heap_index, state->heaps[heap][last_index]);
+            aeron_min_flow_control_strategy_heap_fix(state, heap, heap_index, last_index);
+        }
+    }
+
+    aeron_int64_counter_map_remove(&state->receiver_index_by_id, receiver->receiver_id);
+
+    if ((size_t)receiver_index != last_index)
+    {
+        aeron_array_fast_unordered_remove(
+            (uint8_t *)state->receivers.array,
+            sizeof(aeron_min_flow_control_strategy_receiver_t),
+            (size_t)receiver_index,
+            last_index);
+
+        aeron_min_flow_control_strategy_receiver_t *moved = &state->receivers.array[receiver_index];
+        for (int heap = 0; heap < AERON_MIN_FLOW_CONTROL_HEAP_COUNT; heap++)
+        {
+            state->heaps[heap][moved->heap_index[heap]] = receiver_index;
+        }
+
+        aeron_int64_counter_map_put(&state->receiver_index_by_id, moved->receiver_id, receiver_index, NULL);
+    }
+
+    aeron_min_flow_control_strategy_state_set_length(state, last_index);
+}
+
+static inline int64_t aeron_min_flow_control_strategy_min_position(aeron_min_flow_control_strategy_state_t *state)
+{
+    if (0 == state->receivers.length)
+    {
+        return INT64_MAX;
+    }
+
+    return state->receivers.array[state->heaps[AERON_MIN_FLOW_CONTROL_POSITION_HEAP][0]].last_position_plus_window;
+}
+
 int64_t aeron_min_flow_control_strategy_on_idle(
     void *state,
     int64_t now_ns,
@@ -77,31 +306,22 @@ int64_t aeron_min_flow_control_strategy_on_idle(
     bool is_end_of_stream)
 {
     aeron_min_flow_control_strategy_state_t *strategy_state = (aeron_min_flow_control_strategy_state_t *)state;
-    int64_t min_limit_position = INT64_MAX;
 
-    for (int last_index = (int)strategy_state->receivers.length - 1, i = last_index; i >= 0; i--)
+    while (strategy_state->receivers.length > 0)
     {
-        aeron_min_flow_control_strategy_receiver_t *receiver = &strategy_state->receivers.array[i];
+        const int32_t oldest_index = strategy_state->heaps[AERON_MIN_FLOW_CONTROL_TIMEOUT_HEAP][0];
+        aeron_min_flow_control_strategy_receiver_t *oldest = &strategy_state->receivers.array[oldest_index];
 
-        if ((receiver->time_of_last_status_message_ns + strategy_state->receiver_timeout_ns) - now_ns < 0)
-        {
-            aeron_array_fast_unordered_remove(
-                (uint8_t *)strategy_state->receivers.array,
-                sizeof(aeron_min_flow_control_strategy_receiver_t),
-                (size_t)i,
-                (size_t)last_index);
-            last_index--;
-            aeron_min_flow_control_strategy_state_set_length(strategy_state, strategy_state->receivers.length - 1);
-        }
-        else
+        if ((oldest->time_of_last_status_message_ns + strategy_state->receiver_timeout_ns) - now_ns >= 0)
         {
-            min_limit_position = receiver->last_position_plus_window < min_limit_position ?
-                receiver->last_position_plus_window : min_limit_position;
+            break;
         }
+
+        aeron_min_flow_control_strategy_remove_receiver(strategy_state, oldest_index);
     }
 
     return strategy_state->receivers.length < (size_t)strategy_state->group_min_size ||
-        strategy_state->receivers.length == 0 ? snd_lmt : min_limit_position;
+        strategy_state->receivers.length == 0 ? snd_lmt : aeron_min_flow_control_strategy_min_position(strategy_state);
 }
 
 int64_t aeron_min_flow_control_strategy_process_sm(
@@ -122,53 +342,28 @@ int64_t aeron_min_flow_control_strategy_process_sm(
     const int64_t receiver_id = status_message_header->receiver_id;
     int64_t position_plus_window = position + window_length;
 
-    bool is_existing = false;
-    int64_t min_position = INT64_MAX;
-
-    for (size_t i = 0; i < strategy_state->receivers.length; i++)
-    {
-        aeron_min_flow_control_strategy_receiver_t *receiver =
-            &strategy_state->receivers.array[i];
-
-        if (matches_tag && receiver_id == receiver->receiver_id)
-        {
-            receiver->last_position = position > receiver->last_position ? position : receiver->last_position;
-            receiver->last_position_plus_window = position + window_length;
-            receiver->time_of_last_status_message_ns = now_ns;
-            is_existing = true;
-        }
-
-        min_position = receiver->last_position_plus_window < min_position ?
-            receiver->last_position_plus_window : min_position;
-    }
-
-    if (matches_tag && !is_existing)
+    if (matches_tag)
     {
-        int ensure_capacity_result = 0;
-        AERON_ARRAY_ENSURE_CAPACITY(
-            ensure_capacity_result,
-            strategy_state->receivers,
-            aeron_min_flow_control_strategy_receiver_t);
+        const int64_t receiver_index = aeron_int64_counter_map_get(&strategy_state->receiver_index_by_id, receiver_id);
 
-        if (ensure_capacity_result >= 0)
+        if (receiver_index >= 0)
         {
-            const size_t receivers_length = strategy_state->receivers.length;
-            aeron_min_flow_control_strategy_receiver_t *receiver = &strategy_state->receivers.array[receivers_length];
-            aeron_min_flow_control_strategy_state_set_length(strategy_state, receivers_length + 1);
+            aeron_min_flow_control_strategy_receiver_t *receiver = &strategy_state->receivers.array[receiver_index];
 
-            receiver->last_position = position;
+            receiver->last_position = position > receiver->last_position ? position : receiver->last_position;
             receiver->last_position_plus_window = position + window_length;
             receiver->time_of_last_status_message_ns = now_ns;
-            receiver->receiver_id = receiver_id;
-
-            min_position = (position + window_length) < min_position ? (position + window_length) : min_position;
+            aeron_min_flow_control_strategy_receiver_updated(strategy_state, (int32_t)receiver_index);
         }
         else
         {
-            min_position = 0 == strategy_state->receivers.length ? snd_lmt : min_position;
+            aeron_min_flow_control_strategy_add_receiver(strategy_state, receiver_id, position, window_length, now_ns);
         }
     }
 
+    const int64_t min_position = 0 == strategy_state->receivers.length ?
+        snd_lmt : aeron_min_flow_control_strategy_min_position(strategy_state);
+
     if (strategy_state->receivers.length < (size_t)strategy_state->group_min_size)
     {
         return snd_lmt;
@@ -245,6 +440,11 @@ int aeron_min_flow_control_strategy_fini(aeron_flow_control_strategy_t *strategy
         (aeron_min_flow_control_strategy_state_t *)strategy->state;
 
     aeron_free(strategy_state->receivers.array);
+    for (int heap = 0; heap < AERON_MIN_FLOW_CONTROL_HEAP_COUNT; heap++)
+    {
+        aeron_free(strategy_state->heaps[heap]);
+    }
+    aeron_int64_counter_map_delete(&strategy_state->receiver_index_by_id);
     aeron_free(strategy->state);
     aeron_free(strategy);
 
@@ -298,6 +498,19 @@ int aeron_tagged_flow_control_strategy_supplier_init(
     state->receivers.capacity = 0;
     aeron_min_flow_control_strategy_state_set_length(state, 0);
 
+    for (int heap = 0; heap < AERON_MIN_FLOW_CONTROL_HEAP_COUNT; heap++)
+    {
+        state->heaps[heap] = NULL;
+    }
+    state->heap_capacity = 0;
+
+    if (aeron_int64_counter_map_init(&state->receiver_index_by_id, -1, 16, AERON_MAP_DEFAULT_LOAD_FACTOR) < 0)
+    {
+        aeron_free(_strategy->state);
+        aeron_free(_strategy);
+        return -1;
+    }
+
     state->receiver_timeout_ns = options.timeout_ns.is_present ?
         options.timeout_ns.value : context->flow_control.receiver_timeout_ns;
     state->group_min_size = options.group_min_size.is_present ?
@@ -0,0 +1,231 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "aeron_alloc.h"
+#include "concurrent/aeron_counters_manager.h"
+#include "aeron_min_position_tracker.h"
+
+void aeron_min_position_tracker_init(aeron_min_position_tracker_t *tracker, bool exclude_observers)
+{
+    tracker->value_addrs = NULL;
+    tracker->positions = NULL;
+    tracker->refreshed_epochs = NULL;
+    tracker->winners = NULL;
+    tracker->leaf_count = 0;
+    tracker->capacity = 0;
+    tracker->epoch = 0;
+    tracker->exclude_observers = exclude_observers;
+    tracker->exclude_tethered = false;
+    tracker->is_stale = true;
+}
+
+void aeron_min_position_tracker_close(aeron_min_position_tracker_t *tracker)
+{
+    aeron_free(tracker->value_addrs);
+    aeron_free(tracker->positions);
+    aeron_free(tracker->refreshed_epochs);
+    aeron_free(tracker->winners);
+    tracker->value_addrs = NULL;
+    tracker->positions = NULL;
+    tracker->refreshed_epochs = NULL;
+    tracker->winners = NULL;
+    tracker->capacity = 0;
+    tracker->is_stale = true;
+}
+
+inline static uint32_t aeron_min_position_tracker_winner(aeron_min_position_tracker_t *tracker, size_t node)
+{
+    return node >= tracker->leaf_count ? (uint32_t)(node - tracker->leaf_count) : tracker->winners[node];
+}
+
+inline static void aeron_min_position_tracker_play(aeron_min_position_tracker_t *tracker, size_t node)
+{
+    uint32_t left = aeron_min_position_tracker_winner(tracker, node << 1);
+    uint32_t right = aeron_min_position_tracker_winner(tracker, (node << 1) + 1);
+
+    tracker->winners[node] = tracker->positions[left] <= tracker->positions[right] ? left : right;
+}
+
+static int aeron_min_position_tracker_rebuild(aeron_min_position_tracker_t *tracker, aeron_subscribable_t *subscribable)
+{
+    size_t leaf_count = 2;
+    while (leaf_count < subscribable->length)
+    {
+        leaf_count <<= 1;
+    }
+
+    if (leaf_count > tracker->capacity)
+    {
+        if (aeron_reallocf((void **)&tracker->value_addrs, leaf_count * sizeof(int64_t *)) < 0 ||
+            aeron_reallocf((void **)&tracker->positions, leaf_count * sizeof(int64_t)) < 0 ||
+            aeron_reallocf((void **)&tracker->refreshed_epochs, leaf_count * sizeof(uint64_t)) < 0 ||
+            aeron_reallocf((void **)&tracker->winners, leaf_count * sizeof(uint32_t)) < 0)
+        {
+            aeron_min_position_tracker_close(tracker);
+            return -1;
+        }
+
+        tracker->capacity = leaf_count;
+    }
+
+    tracker->leaf_count = leaf_count;
+
+    for (size_t i = 0; i < leaf_count; i++)
+    {
+        aeron_tetherable_position_t *tetherable_position = i < subscribable->length ? &subscribable->array[i] : NULL;
+
+        if (NULL != tetherable_position &&
+            AERON_SUBSCRIPTION_TETHER_RESTING != tetherable_position->state &&
+            !(tracker->exclude_observers && tetherable_position->is_observer) &&
+            !(tracker->exclude_tethered && tetherable_position->is_tether))
+        {
+            tracker->value_addrs[i] = tetherable_position->value_addr;
+            tracker->positions[i] = aeron_counter_get_volatile(tetherable_position->value_addr);
+        }
+        else
+        {
+            tracker->value_addrs[i] = NULL;
+            tracker->positions[i] = INT64_MAX;
+        }
+
+        tracker->refreshed_epochs[i] = tracker->epoch + 1;
+    }
+
+    for (size_t node = leaf_count - 1; node > 0; node--)
+    {
+        aeron_min_position_tracker_play(tracker, node);
+    }
+
+    tracker->is_stale = false;
+
+    return 0;
+}
+
+static int64_t aeron_min_position_tracker_scan(aeron_min_position_tracker_t *tracker, aeron_subscribable_t *subscribable)
+{
+    int64_t min_position = INT64_MAX;
+
+    for (size_t i = 0, length = subscribable->length; i < length; i++)
+    {
+        aeron_tetherable_position_t *tetherable_position = &subscribable->array[i];
+
+        if (AERON_SUBSCRIPTION_TETHER_RESTING != tetherable_position->state &&
+            !(tracker->exclude_observers && tetherable_position->is_observer) &&
+            !(tracker->exclude_tethered && tetherable_position->is_tether))
+        {
+            int64_t position = aeron_counter_get_volatile(tetherable_position->value_addr);
+            min_position = position < min_position ? position : min_position;
+        }
+    }
+
+    return min_position;
+}
+
+int64_t aeron_min_position_tracker_min(
+    aeron_min_position_tracker_t *tracker, aeron_subscribable_t *subscribable, int64_t target)
+{
+    if (tracker->is_stale && aeron_min_position_tracker_rebuild(tracker, subscribable) < 0)
+    {
+        return aeron_min_position_tracker_scan(tracker, subscribable);
+    }
+
+    const uint64_t epoch = ++tracker->epoch;
+
+    while (true)
+    {
+        const uint32_t leaf = tracker->winners[1];
+        const int64_t position = tracker->positions[leaf];
+
+        if (position >= target || epoch == tracker->refreshed_epochs[leaf])
+        {
+            return position;
+        }
+
+        tracker->positions[leaf] = aeron_counter_get_volatile(tracker->value_addrs[leaf]);
+        tracker->refreshed_epochs[leaf] = epoch;
+
+        for (size_t node = (leaf + tracker->leaf_count) >> 1; node > 0; node >>= 1)
+        {
+            aeron_min_position_tracker_play(tracker, node);
+        }
+    }
+}
+
+void aeron_untethered_tracker_init(aeron_untethered_tracker_t *tracker)
+{
+    aeron_min_position_tracker_init(&tracker->position_tracker, false);
+    tracker->position_tracker.exclude_tethered = true;
+    tracker->subscribable_change_number = 0;
+    tracker->untethered_count = 0;
+    tracker->time_of_last_all_ahead_ns = INT64_MIN;
+    tracker->has_inactive = false;
+}
+
+void aeron_untethered_tracker_close(aeron_untethered_tracker_t *tracker)
+{
+    aeron_min_position_tracker_close(&tracker->position_tracker);
+}
+
+bool aeron_untethered_tracker_has_untethered(aeron_untethered_tracker_t *tracker, aeron_subscribable_t *subscribable)
+{
+    if (tracker->subscribable_change_number != subscribable->change_number)
+    {
+        size_t untethered_count = 0;
+        for (size_t i = 0, length = subscribable->length; i < length; i++)
+        {
+            untethered_count += subscribable->array[i].is_tether ? 0 : 1;
+        }
+
+        tracker->untethered_count = untethered_count;
+        tracker->subscribable_change_number = subscribable->change_number;
+        aeron_min_position_tracker_invalidate(&tracker->position_tracker);
+    }
+
+    return tracker->untethered_count > 0;
+}
+
+bool aeron_untethered_tracker_is_ahead(
+    aeron_untethered_tracker_t *tracker, aeron_subscribable_t *subscribable, int64_t untethered_window_limit, int64_t now_ns)
+{
+    if (aeron_untethered_tracker_has_untethered(tracker, subscribable) &&
+        (tracker->has_inactive || aeron_min_position_tracker_min(
+            &tracker->position_tracker, subscribable, untethered_window_limit + 1) <= untethered_window_limit))
+    {
+        return false;
+    }
+
+    tracker->time_of_last_all_ahead_ns = now_ns;
+
+    return true;
+}
+
+void aeron_untethered_tracker_on_full_check(aeron_untethered_tracker_t *tracker, aeron_subscribable_t *subscribable)
+{
+    bool has_inactive = false;
+    for (size_t i = 0, length = subscribable->length; i < length; i++)
+    {
+        aeron_tetherable_position_t *tetherable_position = &subscribable->array[i];
+        has_inactive |= !tetherable_position->is_tether &&
+            AERON_SUBSCRIPTION_TETHER_ACTIVE != tetherable_position->state;
+    }
+
+    tracker->has_inactive = has_inactive;
+    aeron_min_position_tracker_invalidate(&tracker->position_tracker);
+}
+
+extern void aeron_min_position_tracker_invalidate(aeron_min_position_tracker_t *tracker);
+extern int64_t aeron_untethered_tracker_time_of_last_update_ns(
+    aeron_untethered_tracker_t *tracker, aeron_tetherable_position_t *tetherable_position);
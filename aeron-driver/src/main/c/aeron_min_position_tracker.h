@@ -0,0 +1,107 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_MIN_POSITION_TRACKER_H
+#define AERON_MIN_POSITION_TRACKER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "aeron_driver_common.h"
+
+/*
+ * Tracks the minimum position of the subscribers of a subscribable with a tournament tree over cached positions.
+ * Positions only move forward, so a cached position is a lower bound and the root is a lower bound on the minimum.
+ * A query only re-reads the counters of subscribers at the root while it is below the target, each costing O(log n),
+ * so a publication with hundreds of subscribers touches a handful of their cache lines per duty cycle rather than all
+ * of them. Resting subscribers, and observers when excluded, are tracked as INT64_MAX.
+ *
+ * The tree is rebuilt from the subscribable, reading every position, after it has been invalidated, which must be
+ * done whenever a position is added or removed or the tether state of one changes.
+ */
+typedef struct aeron_min_position_tracker_stct
+{
+    int64_t **value_addrs;
+    int64_t *positions;
+    uint64_t *refreshed_epochs;
+    uint32_t *winners;
+    size_t leaf_count;
+    size_t capacity;
+    uint64_t epoch;
+    bool exclude_observers;
+    bool exclude_tethered;
+    bool is_stale;
+}
+aeron_min_position_tracker_t;
+
+void aeron_min_position_tracker_init(aeron_min_position_tracker_t *tracker, bool exclude_observers);
+
+void aeron_min_position_tracker_close(aeron_min_position_tracker_t *tracker);
+
+/*
+ * Returns the minimum position if it is below target, otherwise a lower bound on it that is at least target. Pass
+ * INT64_MAX as the target for the exact minimum. INT64_MAX is returned when no subscriber is tracked.
+ */
+int64_t aeron_min_position_tracker_min(
+    aeron_min_position_tracker_t *tracker, aeron_subscribable_t *subscribable, int64_t target);
+
+inline void aeron_min_position_tracker_invalidate(aeron_min_position_tracker_t *tracker)
+{
+    tracker->is_stale = true;
+}
+
+/*
+ * Lets the untethered subscription check of a subscribable skip the walk over its subscribers while every untethered
+ * subscriber is active and beyond the window limit, which a tracker over only the untethered positions answers by
+ * re-reading the few that may be behind. The time they were last all found ahead stands in for the time of last
+ * update of each of them, so only a subscriber that falls behind or changes tether state costs a full check.
+ */
+typedef struct aeron_untethered_tracker_stct
+{
+    aeron_min_position_tracker_t position_tracker;
+    uint64_t subscribable_change_number;
+    size_t untethered_count;
+    int64_t time_of_last_all_ahead_ns;
+    bool has_inactive;
+}
+aeron_untethered_tracker_t;
+
+void aeron_untethered_tracker_init(aeron_untethered_tracker_t *tracker);
+
+void aeron_untethered_tracker_close(aeron_untethered_tracker_t *tracker);
+
+bool aeron_untethered_tracker_has_untethered(aeron_untethered_tracker_t *tracker, aeron_subscribable_t *subscribable);
+
+/*
+ * Returns true, recording now_ns, when no full check is needed as every untethered subscriber is active and beyond
+ * the untethered window limit.
+ */
+bool aeron_untethered_tracker_is_ahead(
+    aeron_untethered_tracker_t *tracker, aeron_subscribable_t *subscribable, int64_t untethered_window_limit, int64_t now_ns);
+
+/*
+ * Must be called after a full check as it may have changed the tether state of subscribers.
+ */
+void aeron_untethered_tracker_on_full_check(aeron_untethered_tracker_t *tracker, aeron_subscribable_t *subscribable);
+
+inline int64_t aeron_untethered_tracker_time_of_last_update_ns(
+    aeron_untethered_tracker_t *tracker, aeron_tetherable_position_t *tetherable_position)
+{
+    return tetherable_position->time_of_last_update_ns > tracker->time_of_last_all_ahead_ns ?
+        tetherable_position->time_of_last_update_ns : tracker->time_of_last_all_ahead_ns;
+}
+
+#endif //AERON_MIN_POSITION_TRACKER_H
@@ -19,8 +19,12 @@
 
 #include "concurrent/aeron_counters_manager.h"
 #include "util/aeron_arrayutil.h"
+#include "util/aeron_strutil.h"
 #include "aeron_name_resolver_cache.h"
 
+#define AERON_NAME_RESOLVER_CACHE_INDEX_MIN_CAPACITY (16)
+#define AERON_NAME_RESOLVER_CACHE_INDEX_EMPTY (-1)
+
 int aeron_name_resolver_cache_init(aeron_name_resolver_cache_t *cache, int64_t timeout_ms)
 {
     memset(cache, 0, sizeof(aeron_name_resolver_cache_t));
@@ -38,29 +42,229 @@ int aeron_name_resolver_cache_close(aeron_name_resolver_cache_t *cache)
         }
 
         aeron_free((void *)cache->entries.array);
+        aeron_free(cache->index.slots);
+        aeron_free(cache->timeout_heap.array);
+    }
+
+    return 0;
+}
+
+static inline uint64_t aeron_name_resolver_cache_hash(const char *name, size_t name_length, int8_t res_type)
+{
+    // Continue FNV-1a over the res_type byte so the same name resolves to separate IPv4 and IPv6 entries.
+    uint64_t hash = aeron_fnv_64a_buf((uint8_t *)name, name_length);
+    hash ^= (uint64_t)(uint8_t)res_type;
+    hash *= UINT64_C(0x100000001b3);
+
+    return hash;
+}
+
+static inline size_t aeron_name_resolver_cache_index_home(aeron_name_resolver_cache_t *cache, uint64_t hash)
+{
+    return (size_t)(hash ^ (hash >> 32)) & (cache->index.capacity - 1);
+}
+
+static void aeron_name_resolver_cache_index_insert(aeron_name_resolver_cache_t *cache, int32_t position)
+{
+    size_t mask = cache->index.capacity - 1;
+    size_t slot = aeron_name_resolver_cache_index_home(cache, cache->entries.array[position].name_hash);
+
+    while (AERON_NAME_RESOLVER_CACHE_INDEX_EMPTY != cache->index.slots[slot])
+    {
+        slot = (slot + 1) & mask;
+    }
+
+    cache->index.slots[slot] = position;
+}
+
+static int aeron_name_resolver_cache_index_ensure_capacity(aeron_name_resolver_cache_t *cache, size_t required)
+{
+    if (required * 2 <= cache->index.capacity)
+    {
+        return 0;
+    }
+
+    size_t new_capacity = 0 == cache->index.capacity ?
+        AERON_NAME_RESOLVER_CACHE_INDEX_MIN_CAPACITY : cache->index.capacity * 2;
+    int32_t *new_slots;
+
+    if (aeron_alloc((void **)&new_slots, new_capacity * sizeof(int32_t)) < 0)
+    {
+        aeron_set_err_from_last_err_code("Failed to allocate name resolver cache index - %s:%d", __FILE__, __LINE__);
+        return -1;
+    }
+
+    for (size_t i = 0; i < new_capacity; i++)
+    {
+        new_slots[i] = AERON_NAME_RESOLVER_CACHE_INDEX_EMPTY;
+    }
+
+    aeron_free(cache->index.slots);
+    cache->index.slots = new_slots;
+    cache->index.capacity = new_capacity;
+
+    for (size_t i = 0; i < cache->entries.length; i++)
+    {
+        aeron_name_resolver_cache_index_insert(cache, (int32_t)i);
     }
 
     return 0;
 }
 
+static size_t aeron_name_resolver_cache_index_slot_of(aeron_name_resolver_cache_t *cache, int32_t position)
+{
+    size_t mask = cache->index.capacity - 1;
+    size_t slot = aeron_name_resolver_cache_index_home(cache, cache->entries.array[position].name_hash);
+
+    while (position != cache->index.slots[slot])
+    {
+        slot = (slot + 1) & mask;
+    }
+
+    return slot;
+}
+
+static void aeron_name_resolver_cache_index_remove_slot(aeron_name_resolver_cache_t *cache, size_t hole)
+{
+    size_t mask = cache->index.capacity - 1;
+    size_t slot = (hole + 1) & mask;
+
+    // Backward shift deletion keeps linear probe chains intact without tombstones.
+    while (AERON_NAME_RESOLVER_CACHE_INDEX_EMPTY != cache->index.slots[slot])
+    {
+        int32_t position = cache->index.slots[slot];
+        size_t home = aeron_name_resolver_cache_index_home(cache, cache->entries.array[position].name_hash);
+
+        if (((slot - home) & mask) >= ((slot - hole) & mask))
+        {
+            cache->index.slots[hole] = position;
+            hole = slot;
+        }
+
+        slot = (slot + 1) & mask;
+    }
+
+    cache->index.slots[hole] = AERON_NAME_RESOLVER_CACHE_INDEX_EMPTY;
+}
+
+static inline int64_t aeron_name_resolver_cache_heap_deadline(aeron_name_resolver_cache_t *cache, size_t heap_index)
+{
+    return cache->entries.array[cache->timeout_heap.array[heap_index]].deadline_ms;
+}
+
+static inline void aeron_name_resolver_cache_heap_set(
+    aeron_name_resolver_cache_t *cache, size_t heap_index, int32_t position)
+{
+    cache->timeout_heap.array[heap_index] = position;
+    cache->entries.array[position].timeout_heap_index = heap_index;
+}
+
+static void aeron_name_resolver_cache_heap_sift(aeron_name_resolver_cache_t *cache, size_t heap_index)
+{
+    int32_t position = cache->timeout_heap.array[heap_index];
+    int64_t deadline_ms = cache->entries.array[position].deadline_ms;
+
+    while (heap_index > 0)
+    {
+        size_t parent = (heap_index - 1) / 2;
+        if (aeron_name_resolver_cache_heap_deadline(cache, parent) <= deadline_ms)
+        {
+            break;
+        }
+
+        aeron_name_resolver_cache_heap_set(cache, heap_index, cache->timeout_heap.array[parent]);
+        heap_index = parent;
+    }
+
+    size_t length = cache->timeout_heap.length;
+    while (true)
+    {
+        size_t child = (2 * heap_index) + 1;
+        if (child >= length)
+        {
+            break;
+        }
+
+        if (child + 1 < length &&
+            aeron_name_resolver_cache_heap_deadline(cache, child + 1) <
+            aeron_name_resolver_cache_heap_deadline(cache, child))
+        {
+            child++;
+        }
+
+        if (deadline_ms <= aeron_name_resolver_cache_heap_deadline(cache, child))
+        {
+            break;
+        }
+
+        aeron_name_resolver_cache_heap_set(cache, heap_index, cache->timeout_heap.array[child]);
+        heap_index = child;
+    }
+
+    aeron_name_resolver_cache_heap_set(cache, heap_index, position);
+}
+
+static void aeron_name_resolver_cache_remove(aeron_name_resolver_cache_t *cache, int32_t position)
+{
+    aeron_name_resolver_cache_entry_t *entry = &cache->entries.array[position];
+    size_t heap_index = entry->timeout_heap_index;
+    size_t last_heap_index = cache->timeout_heap.length - 1;
+
+    aeron_name_resolver_cache_index_remove_slot(cache, aeron_name_resolver_cache_index_slot_of(cache, position));
+
+    cache->timeout_heap.length--;
+    if (heap_index != last_heap_index)
+    {
+        aeron_name_resolver_cache_heap_set(cache, heap_index, cache->timeout_heap.array[last_heap_index]);
+        aeron_name_resolver_cache_heap_sift(cache, heap_index);
+    }
+
+    aeron_free((void *)entry->name);
+
+    int32_t last_position = (int32_t)cache->entries.length - 1;
+    if (position != last_position)
+    {
+        size_t slot = aeron_name_resolver_cache_index_slot_of(cache, last_position);
+
+        memcpy(entry, &cache->entries.array[last_position], sizeof(aeron_name_resolver_cache_entry_t));
+        cache->index.slots[slot] = position;
+        cache->timeout_heap.array[entry->timeout_heap_index] = position;
+    }
+
+    cache->entries.length--;
+}
+
 int aeron_name_resolver_cache_find_index_by_name_and_type(
     aeron_name_resolver_cache_t *cache,
     const char *name,
     size_t name_length,
     int8_t res_type)
 {
-    for (size_t i = 0; i < cache->entries.length; i++)
+    if (0 == cache->index.capacity)
     {
-        aeron_name_resolver_cache_entry_t *entry = &cache->entries.array[i];
+        return -1;
+    }
+
+    uint64_t hash = aeron_name_resolver_cache_hash(name, name_length, res_type);
+    size_t mask = cache->index.capacity - 1;
+    size_t slot = aeron_name_resolver_cache_index_home(cache, hash);
+    int32_t position;
+
+    while (AERON_NAME_RESOLVER_CACHE_INDEX_EMPTY != (position = cache->index.slots[slot]))
+    {
+        aeron_name_resolver_cache_entry_t *entry = &cache->entries.array[position];
 
-        if (res_type == entry->cache_addr.res_type &&
+        if (hash == entry->name_hash &&
+            res_type == entry->cache_addr.res_type &&
             name_length == entry->name_length &&
             0 == strncmp(name, entry->name, name_length))
         {
-            return (int)i;
+            return position;
         }
+
+        slot = (slot + 1) & mask;
     }
-    
+
     return -1;
 }
 
@@ -89,6 +293,21 @@ int aeron_name_resolver_cache_add_or_update(
             return -1;
         }
 
+        AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, cache->timeout_heap, int32_t)
+
+        if (ensure_capacity_result < 0)
+        {
+            aeron_set_err_from_last_err_code(
+                "Failed to allocate timeout heap (%" PRIu32 ",%" PRIu32 ") - %s:%d",
+                (uint32_t)cache->timeout_heap.length, (uint32_t)cache->timeout_heap.capacity, __FILE__, __LINE__);
+            return -1;
+        }
+
+        if (aeron_name_resolver_cache_index_ensure_capacity(cache, cache->entries.length + 1) < 0)
+        {
+            return -1;
+        }
+
         entry = &cache->entries.array[cache->entries.length];
 
         if (aeron_alloc((void **)&entry->name, name_length + 1) < 0) // NULL terminate, just to be safe.
@@ -99,9 +318,13 @@ int aeron_name_resolver_cache_add_or_update(
 
         strncpy((char *)entry->name, name, name_length);
         entry->name_length = name_length;
+        entry->name_hash = aeron_name_resolver_cache_hash(name, name_length, cache_addr->res_type);
         num_updated = 1;
 
+        index = (int)cache->entries.length;
         cache->entries.length++;
+        aeron_name_resolver_cache_index_insert(cache, index);
+        aeron_name_resolver_cache_heap_set(cache, cache->timeout_heap.length++, index);
 
         aeron_counter_set_ordered(cache_entries_counter, cache->entries.length);
     }
@@ -114,6 +337,7 @@ int aeron_name_resolver_cache_add_or_update(
     memcpy(&entry->cache_addr, cache_addr, sizeof(entry->cache_addr));
     entry->time_of_last_activity_ms = time_of_last_activity_ms;
     entry->deadline_ms = time_of_last_activity_ms + cache->timeout_ms;
+    aeron_name_resolver_cache_heap_sift(cache, entry->timeout_heap_index);
 
     return num_updated;
 }
@@ -141,19 +365,10 @@ int aeron_name_resolver_cache_timeout_old_entries(
     int64_t *cache_entries_counter)
 {
     int num_removed = 0;
-    for (int last_index = (int)cache->entries.length - 1, i = last_index; i >= 0; i--)
+    while (0 < cache->timeout_heap.length && aeron_name_resolver_cache_heap_deadline(cache, 0) <= now_ms)
     {
-        aeron_name_resolver_cache_entry_t *entry = &cache->entries.array[i];
-
-        if (entry->deadline_ms <= now_ms)
-        {
-            aeron_free((void *)entry->name);
-            aeron_array_fast_unordered_remove(
-                (uint8_t *)cache->entries.array, sizeof(aeron_name_resolver_cache_entry_t), i, last_index);
-            cache->entries.length--;
-            last_index--;
-            num_removed++;
-        }
+        aeron_name_resolver_cache_remove(cache, cache->timeout_heap.array[0]);
+        num_removed++;
     }
 
     if (0 != num_removed)
@@ -163,4 +378,3 @@ int aeron_name_resolver_cache_timeout_old_entries(
 
     return num_removed;
 }
-
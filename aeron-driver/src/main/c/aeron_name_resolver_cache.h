@@ -34,6 +34,8 @@ typedef struct aeron_name_resolver_cache_entry_stct
     int64_t time_of_last_activity_ms;
     size_t name_length;
     const char *name;
+    uint64_t name_hash;
+    size_t timeout_heap_index;
 }
 aeron_name_resolver_cache_entry_t;
 
@@ -47,6 +49,19 @@ typedef struct aeron_name_resolver_cache_stct
         aeron_name_resolver_cache_entry_t *array;
     }
     entries;
+    struct index_stct
+    {
+        size_t capacity;
+        int32_t *slots;
+    }
+    index;
+    struct timeout_heap_stct
+    {
+        size_t length;
+        size_t capacity;
+        int32_t *array;
+    }
+    timeout_heap;
 }
 aeron_name_resolver_cache_t;
 
@@ -23,13 +23,39 @@
 #include <string.h>
 #include <inttypes.h>
 #include "aeron_socket.h"
+
+#if !defined(AERON_COMPILER_MSVC)
+#include <netinet/udp.h>
+#endif
+
 #include "concurrent/aeron_term_scanner.h"
 #include "util/aeron_error.h"
 #include "aeron_network_publication.h"
 #include "aeron_alloc.h"
 #include "media/aeron_send_channel_endpoint.h"
 #include "aeron_driver_conductor.h"
+#include "aeron_driver_sender.h"
+#include "aeron_log_buffer_pre_faulter.h"
+#include "aeron_driver_housekeeper.h"
 #include "concurrent/aeron_logbuffer_unblocker.h"
+#include "aeron_driver_tracepoints.h"
+
+#ifdef _MSC_VER
+#define _Static_assert static_assert
+#endif
+
+_Static_assert(
+    sizeof(struct aeron_network_publication_conductor_fields_stct) <= (6 * AERON_CACHE_LINE_LENGTH),
+    "conductor fields of aeron_network_publication_t must fit in their padded cache lines");
+_Static_assert(
+    offsetof(aeron_network_publication_t, retransmit_handler) >=
+        offsetof(aeron_network_publication_t, unblocked_publications_counter) + sizeof(int64_t *) +
+        (2 * AERON_CACHE_LINE_LENGTH),
+    "sender written fields of aeron_network_publication_t must not share a cache line with read mostly fields");
+_Static_assert(
+    sizeof(aeron_network_publication_t) >=
+        offsetof(aeron_network_publication_t, has_sender_released) + sizeof(bool) + (2 * AERON_CACHE_LINE_LENGTH),
+    "sender written fields of aeron_network_publication_t must be followed by padding");
 
 #if !defined(HAVE_STRUCT_MMSGHDR)
 struct mmsghdr
@@ -43,6 +69,7 @@ int aeron_network_publication_create(
     aeron_network_publication_t **publication,
     aeron_send_channel_endpoint_t *endpoint,
     aeron_driver_context_t *context,
+    aeron_allocator_t *allocator,
     int64_t registration_id,
     int32_t session_id,
     int32_t stream_id,
@@ -52,6 +79,10 @@ int aeron_network_publication_create(
     aeron_position_t *snd_pos_position,
     aeron_position_t *snd_lmt_position,
     aeron_atomic_counter_t *snd_bpe_counter,
+    aeron_atomic_counter_t *snd_term_length_counter,
+    aeron_stream_latency_histogram_t *snd_latency_histogram,
+    aeron_stream_cpu_counters_t *snd_cpu_counters,
+    aeron_position_t *snd_inline_position,
     aeron_flow_control_strategy_t *flow_control_strategy,
     aeron_uri_publication_params_t *params,
     bool is_exclusive,
@@ -67,7 +98,7 @@ int aeron_network_publication_create(
 
     *publication = NULL;
 
-    if (usable_fs_space < log_length)
+    if (!context->term_buffer_memfd && usable_fs_space < log_length)
     {
         aeron_set_err(
             ENOSPC,
@@ -75,41 +106,81 @@ int aeron_network_publication_create(
         return -1;
     }
 
-    if (aeron_alloc((void **)&_pub, sizeof(aeron_network_publication_t)) < 0)
+    if (context->term_buffer_memfd && (path_length = aeron_memfd_log_location(path, sizeof(path), registration_id)) < 0)
+    {
+        aeron_set_err(aeron_errcode(), "could not create memfd for network log: %s", aeron_errmsg());
+        return -1;
+    }
+
+    if (aeron_allocator_alloc(allocator, (void **)&_pub, sizeof(aeron_network_publication_t)) < 0)
     {
         aeron_set_err(ENOMEM, "%s", "Could not allocate network publication");
         return -1;
     }
 
+    _pub->conductor_fields.allocator = allocator;
     _pub->log_file_name = NULL;
-    if (aeron_alloc((void **)(&_pub->log_file_name), (size_t)path_length + 1) < 0)
+    if (aeron_allocator_alloc(allocator, (void **)(&_pub->log_file_name), (size_t)path_length + 1) < 0)
     {
-        aeron_free(_pub);
+        aeron_allocator_free(allocator, _pub, sizeof(aeron_network_publication_t));
         aeron_set_err(ENOMEM, "%s", "Could not allocate network publication log_file_name");
         return -1;
     }
 
     if (aeron_retransmit_handler_init(
         &_pub->retransmit_handler,
-        aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_INVALID_PACKETS),
+        aeron_system_counter_writer_addr(
+            system_counters, AERON_SYSTEM_COUNTER_INVALID_PACKETS, AERON_SYSTEM_COUNTER_WRITER_SENDER),
         context->retransmit_unicast_delay_ns,
         context->retransmit_unicast_linger_ns) < 0)
     {
-        aeron_free(_pub->log_file_name);
-        aeron_free(_pub);
+        aeron_allocator_free(allocator, _pub->log_file_name, (size_t)path_length + 1);
+        aeron_allocator_free(allocator, _pub, sizeof(aeron_network_publication_t));
         aeron_set_err(aeron_errcode(), "Could not init network publication retransmit handler: %s", aeron_errmsg());
         return -1;
     }
 
-    if (context->map_raw_log_func(
-        &_pub->mapped_raw_log, path, params->is_sparse, params->term_length, context->file_page_size) < 0)
+    aeron_retransmit_handler_init_budget(
+        &_pub->retransmit_handler,
+        context->retransmit_budget_rate,
+        NULL,
+        aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_RETRANSMITS_DEFERRED));
+
+    if (endpoint->conductor_fields.udp_channel->is_multicast)
     {
-        aeron_free(_pub->log_file_name);
-        aeron_free(_pub);
+        aeron_retransmit_handler_init_unicast_repair(
+            &_pub->retransmit_handler, context->retransmit_unicast_repair_threshold);
+    }
+
+    _pub->log_buffer_pool = !params->is_sparse && !params->is_huge_pages &&
+        AERON_NUMA_NODE_NONE == params->numa_node ? context->log_buffer_pool : NULL;
+    _pub->housekeeper = context->housekeeper;
+    const bool is_pooled = NULL != _pub->log_buffer_pool && aeron_log_buffer_pool_acquire(
+        _pub->log_buffer_pool, &_pub->mapped_raw_log, path, params->term_length, context->file_page_size) > 0;
+    const bool is_pre_faulted_async = !is_pooled && !params->is_sparse && NULL != context->log_buffer_pre_faulter;
+
+    if (!is_pooled && context->map_raw_log_func(
+        &_pub->mapped_raw_log,
+        path,
+        params->is_sparse || is_pre_faulted_async,
+        params->is_huge_pages,
+        params->numa_node,
+        params->term_length,
+        context->file_page_size) < 0)
+    {
+        aeron_allocator_free(allocator, _pub->log_file_name, (size_t)path_length + 1);
+        aeron_allocator_free(allocator, _pub, sizeof(aeron_network_publication_t));
         aeron_set_err(aeron_errcode(), "error mapping network raw log %s: %s", path, aeron_errmsg());
         return -1;
     }
+
+    if (is_pre_faulted_async)
+    {
+        aeron_log_buffer_pre_faulter_offer(
+            context->log_buffer_pre_faulter, path, context->file_page_size, params->is_huge_pages, params->numa_node);
+    }
     _pub->map_raw_log_close_func = context->map_raw_log_close_func;
+    aeron_term_cleaner_init(&_pub->term_cleaner, context->term_buffer_clean_mode, context->file_page_size);
     _pub->untethered_subscription_state_change_func = context->untethered_subscription_state_change_func;
 
     strncpy(_pub->log_file_name, path, (size_t)path_length);
@@ -163,10 +234,13 @@ int aeron_network_publication_create(
     _pub->cached_clock = context->cached_clock;
     _pub->conductor_fields.subscribable.array = NULL;
     _pub->conductor_fields.subscribable.length = 0;
+    _pub->conductor_fields.subscribable.change_number = 0;
     _pub->conductor_fields.subscribable.capacity = 0;
     _pub->conductor_fields.subscribable.add_position_hook_func = aeron_network_publication_add_subscriber_hook;
     _pub->conductor_fields.subscribable.remove_position_hook_func = aeron_network_publication_remove_subscriber_hook;
     _pub->conductor_fields.subscribable.clientd = _pub;
+    aeron_min_position_tracker_init(&_pub->conductor_fields.min_position_tracker, true);
+    aeron_untethered_tracker_init(&_pub->conductor_fields.untethered_tracker);
     _pub->conductor_fields.managed_resource.registration_id = registration_id;
     _pub->conductor_fields.managed_resource.clientd = _pub;
     _pub->conductor_fields.managed_resource.incref = aeron_network_publication_incref;
@@ -189,33 +263,94 @@ int aeron_network_publication_create(
     _pub->snd_lmt_position.value_addr = snd_lmt_position->value_addr;
     _pub->snd_bpe_counter.counter_id = snd_bpe_counter->counter_id;
     _pub->snd_bpe_counter.value_addr = snd_bpe_counter->value_addr;
+    _pub->snd_term_length_counter.counter_id = snd_term_length_counter->counter_id;
+    _pub->snd_term_length_counter.value_addr = snd_term_length_counter->value_addr;
+    _pub->is_snd_latency_tracked = NULL != snd_latency_histogram;
+    if (_pub->is_snd_latency_tracked)
+    {
+        _pub->snd_latency_histogram = *snd_latency_histogram;
+    }
+    _pub->is_snd_cpu_tracked = NULL != snd_cpu_counters;
+    _pub->trace_ring = NULL;
+    if (_pub->is_snd_cpu_tracked)
+    {
+        _pub->snd_cpu_counters = *snd_cpu_counters;
+    }
+    _pub->is_inline_send = NULL != snd_inline_position;
+    _pub->snd_inline_position.counter_id = _pub->is_inline_send ?
+        snd_inline_position->counter_id : AERON_NULL_COUNTER_ID;
+    _pub->snd_inline_position.value_addr = _pub->is_inline_send ? snd_inline_position->value_addr : NULL;
+    _pub->inline_send_lag_start_ns = AERON_NULL_VALUE;
+    _pub->snd_latency_sample_position = AERON_NULL_VALUE;
+    _pub->snd_latency_sample_ns = 0;
+    _pub->rtt_sample_position = AERON_NULL_VALUE;
+    _pub->rtt_sample_ns = 0;
+    _pub->rtt_ns = 0;
     _pub->tag = params->entity_tag;
     _pub->initial_term_id = initial_term_id;
     _pub->term_buffer_length = _pub->log_meta_data->term_length;
     _pub->term_length_mask = (int32_t)params->term_length - 1;
     _pub->position_bits_to_shift = (size_t)aeron_number_of_trailing_zeroes((int32_t)params->term_length);
     _pub->mtu_length = params->mtu_length;
+    _pub->send_mtu_length = params->mtu_length;
+    _pub->is_pmtu_discovery_enabled = context->pmtu_discovery_enabled &&
+        !endpoint->conductor_fields.udp_channel->is_multicast &&
+        endpoint->conductor_fields.udp_channel->has_explicit_endpoint;
+    _pub->conductor_fields.pmtu_probe_deadline_ns = now_ns;
+    _pub->max_messages_per_send = context->network_publication_max_messages_per_send;
+    _pub->is_send_coalescing = context->network_publication_send_coalescing;
+    _pub->max_gso_segments = 1;
+#if defined(UDP_SEGMENT)
+    if (context->socket_gso_enabled)
+    {
+        size_t max_gso_segments = AERON_NETWORK_PUBLICATION_MAX_GSO_LENGTH / params->mtu_length;
+        _pub->max_gso_segments = max_gso_segments < AERON_NETWORK_PUBLICATION_MAX_GSO_SEGMENTS ?
+            max_gso_segments : AERON_NETWORK_PUBLICATION_MAX_GSO_SEGMENTS;
+    }
+#endif
     _pub->term_window_length = (int64_t)aeron_producer_window_length(
         context->publication_window_length, params->term_length);
     _pub->linger_timeout_ns = (int64_t)params->linger_timeout_ns;
     _pub->unblock_timeout_ns = (int64_t)context->publication_unblock_timeout_ns;
     _pub->connection_timeout_ns = (int64_t)context->publication_connection_timeout_ns;
     _pub->time_of_last_send_or_heartbeat_ns = now_ns - AERON_NETWORK_PUBLICATION_HEARTBEAT_TIMEOUT_NS - 1;
+    _pub->heartbeat_interval_ns = AERON_NETWORK_PUBLICATION_HEARTBEAT_TIMEOUT_NS;
+    _pub->heartbeat_max_interval_ns = AERON_NETWORK_PUBLICATION_HEARTBEAT_TIMEOUT_NS;
+    if (context->network_publication_heartbeat_backoff_enabled &&
+        (int64_t)(context->image_liveness_timeout_ns / 4) > AERON_NETWORK_PUBLICATION_HEARTBEAT_TIMEOUT_NS)
+    {
+        _pub->heartbeat_max_interval_ns = (int64_t)(context->image_liveness_timeout_ns / 4);
+    }
     _pub->time_of_last_setup_ns = now_ns - AERON_NETWORK_PUBLICATION_SETUP_TIMEOUT_NS - 1;
     _pub->status_message_deadline_ns = params->spies_simulate_connection ?
         now_ns : now_ns + (int64_t)context->publication_connection_timeout_ns;
+    _pub->pacing_rate = params->pacing_rate < INT64_MAX ? (int64_t)params->pacing_rate : INT64_MAX;
+    _pub->pacing_time_ns = now_ns;
+    _pub->send_weight = params->weight;
+    _pub->send_quantum = (int64_t)(params->weight > 0 ? params->weight : 1) *
+        (int64_t)(_pub->mtu_length * _pub->max_messages_per_send);
+    _pub->send_budget = INT64_MAX;
+    _pub->pacing_txtime = false;
+    if (_pub->pacing_rate > 0 && params->pacing_txtime)
+    {
+        /* Launch times need the socket option, without it the pacing falls back to holding back sends. */
+        _pub->pacing_txtime = aeron_udp_channel_transport_enable_txtime(&endpoint->transport) >= 0;
+    }
     _pub->is_exclusive = is_exclusive;
     _pub->spies_simulate_connection = params->spies_simulate_connection;
     _pub->signal_eos = params->signal_eos;
     _pub->should_send_setup_frame = true;
     _pub->has_receivers = false;
     _pub->has_spies = false;
+    _pub->has_short_circuit_subscribers = false;
     _pub->is_connected = false;
     _pub->is_end_of_stream = false;
     _pub->track_sender_limits = false;
     _pub->has_sender_released = false;
+    _pub->is_checksum_enabled = params->checksum;
 
-    _pub->short_sends_counter = aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_SHORT_SENDS);
+    _pub->short_sends_counter = aeron_system_counter_writer_addr(
+        system_counters, AERON_SYSTEM_COUNTER_SHORT_SENDS, AERON_SYSTEM_COUNTER_WRITER_SENDER);
     _pub->heartbeats_sent_counter = aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_HEARTBEATS_SENT);
     _pub->sender_flow_control_limits_counter = aeron_system_counter_addr(
         system_counters, AERON_SYSTEM_COUNTER_SENDER_FLOW_CONTROL_LIMITS);
@@ -225,6 +360,9 @@ int aeron_network_publication_create(
 
     _pub->conductor_fields.last_snd_pos = aeron_counter_get(_pub->snd_pos_position.value_addr);
     _pub->conductor_fields.clean_position = _pub->conductor_fields.last_snd_pos;
+    _pub->conductor_fields.throughput_sample_ns = now_ns;
+    _pub->conductor_fields.throughput_sample_position = _pub->conductor_fields.last_snd_pos;
+    _pub->conductor_fields.peak_bytes_per_sec = 0;
 
     *publication = _pub;
 
@@ -243,6 +381,22 @@ void aeron_network_publication_close(
         aeron_counters_manager_free(counters_manager, publication->snd_pos_position.counter_id);
         aeron_counters_manager_free(counters_manager, publication->snd_lmt_position.counter_id);
         aeron_counters_manager_free(counters_manager, publication->snd_bpe_counter.counter_id);
+        aeron_counters_manager_free(counters_manager, publication->snd_term_length_counter.counter_id);
+
+        if (publication->is_snd_latency_tracked)
+        {
+            aeron_stream_latency_histogram_free(&publication->snd_latency_histogram, counters_manager);
+        }
+
+        if (publication->is_snd_cpu_tracked)
+        {
+            aeron_stream_cpu_counters_free(&publication->snd_cpu_counters, counters_manager);
+        }
+
+        if (publication->is_inline_send)
+        {
+            aeron_counters_manager_free(counters_manager, publication->snd_inline_position.counter_id);
+        }
 
         for (size_t i = 0, length = subscribable->length; i < length; i++)
         {
@@ -250,15 +404,26 @@ void aeron_network_publication_close(
         }
 
         aeron_free(subscribable->array);
+        aeron_min_position_tracker_close(&publication->conductor_fields.min_position_tracker);
+        aeron_untethered_tracker_close(&publication->conductor_fields.untethered_tracker);
         publication->conductor_fields.managed_resource.clientd = NULL;
 
         aeron_retransmit_handler_close(&publication->retransmit_handler);
-        publication->map_raw_log_close_func(&publication->mapped_raw_log, publication->log_file_name);
+        if (NULL == publication->log_buffer_pool || aeron_log_buffer_pool_release(
+            publication->log_buffer_pool, &publication->mapped_raw_log, publication->log_file_name) <= 0)
+        {
+            aeron_driver_housekeeper_close_log(
+                publication->housekeeper,
+                publication->map_raw_log_close_func,
+                &publication->mapped_raw_log,
+                publication->log_file_name);
+        }
         publication->flow_control->fini(publication->flow_control);
-        aeron_free(publication->log_file_name);
-    }
 
-    aeron_free(publication);
+        aeron_allocator_t *allocator = publication->conductor_fields.allocator;
+        aeron_allocator_free(allocator, publication->log_file_name, publication->log_file_name_length + 1);
+        aeron_allocator_free(allocator, publication, sizeof(aeron_network_publication_t));
+    }
 }
 
 int aeron_network_publication_setup_message_check(
@@ -323,13 +488,28 @@ int aeron_network_publication_heartbeat_message_check(
 {
     int bytes_sent = 0;
 
-    if (now_ns > (publication->time_of_last_send_or_heartbeat_ns + AERON_NETWORK_PUBLICATION_HEARTBEAT_TIMEOUT_NS))
+    if (now_ns > (publication->time_of_last_send_or_heartbeat_ns + publication->heartbeat_interval_ns))
     {
-        uint8_t heartbeat_buffer[sizeof(aeron_data_header_t)];
-        aeron_data_header_t *data_header = (aeron_data_header_t *)heartbeat_buffer;
-        struct iovec iov[1];
-        struct msghdr msghdr;
+        aeron_send_channel_endpoint_t *endpoint = publication->endpoint;
+        aeron_data_header_t *data_header;
+
+        if (0 == endpoint->heartbeat_batch.length)
+        {
+            if (aeron_driver_sender_add_heartbeat_endpoint(endpoint->sender_proxy->sender, endpoint) < 0)
+            {
+                return -1;
+            }
+        }
+        else if (AERON_SEND_CHANNEL_ENDPOINT_HEARTBEAT_BATCH_CAPACITY == endpoint->heartbeat_batch.length)
+        {
+            if ((bytes_sent = aeron_send_channel_endpoint_flush_heartbeats(
+                endpoint, publication->short_sends_counter)) < 0)
+            {
+                return -1;
+            }
+        }
 
+        data_header = &endpoint->heartbeat_batch.frames[endpoint->heartbeat_batch.length++];
         data_header->frame_header.frame_length = 0;
         data_header->frame_header.version = AERON_FRAME_HEADER_VERSION;
         data_header->frame_header.flags = AERON_DATA_HEADER_BEGIN_FLAG | AERON_DATA_HEADER_END_FLAG;
@@ -344,31 +524,52 @@ int aeron_network_publication_heartbeat_message_check(
         {
             data_header->frame_header.flags =
                 AERON_DATA_HEADER_BEGIN_FLAG | AERON_DATA_HEADER_END_FLAG | AERON_DATA_HEADER_EOS_FLAG;
+            publication->heartbeat_interval_ns = AERON_NETWORK_PUBLICATION_HEARTBEAT_TIMEOUT_NS;
         }
-
-        iov[0].iov_base = heartbeat_buffer;
-        iov[0].iov_len = sizeof(aeron_data_header_t);
-        msghdr.msg_iov = iov;
-        msghdr.msg_iovlen = 1;
-        msghdr.msg_flags = 0;
-        msghdr.msg_control = NULL;
-        msghdr.msg_controllen = 0;
-
-        if ((bytes_sent = aeron_send_channel_sendmsg(publication->endpoint, &msghdr)) != (int)iov[0].iov_len)
+        else if (publication->heartbeat_interval_ns < publication->heartbeat_max_interval_ns)
         {
-            if (bytes_sent >= 0)
-            {
-                aeron_counter_increment(publication->short_sends_counter, 1);
-            }
+            const int64_t interval_ns = publication->heartbeat_interval_ns * 2;
+            publication->heartbeat_interval_ns = interval_ns < publication->heartbeat_max_interval_ns ?
+                interval_ns : publication->heartbeat_max_interval_ns;
         }
 
-        aeron_counter_ordered_increment(publication->heartbeats_sent_counter, 1);
+        aeron_counter_increment(publication->heartbeats_sent_counter, 1);
         publication->time_of_last_send_or_heartbeat_ns = now_ns;
     }
 
     return bytes_sent;
 }
 
+/*
+ * Control messages live on the caller's stack, so only plain datagrams can wait in the endpoint's batch for the end
+ * of the send pass. The frames stay valid in the log until then as the sender position only moves forward.
+ */
+static int aeron_network_publication_coalesce_data(
+    aeron_network_publication_t *publication, struct iovec *iov, int vlen)
+{
+    aeron_send_channel_endpoint_t *endpoint = publication->endpoint;
+
+    if (0 == endpoint->data_batch.length)
+    {
+        if (aeron_driver_sender_add_data_endpoint(endpoint->sender_proxy->sender, endpoint) < 0)
+        {
+            return -1;
+        }
+    }
+    else if (endpoint->data_batch.length + (size_t)vlen > AERON_SEND_CHANNEL_ENDPOINT_DATA_BATCH_CAPACITY)
+    {
+        if (aeron_send_channel_endpoint_flush_data(endpoint, publication->short_sends_counter) < 0)
+        {
+            return -1;
+        }
+    }
+
+    memcpy(&endpoint->data_batch.iov[endpoint->data_batch.length], iov, (size_t)vlen * sizeof(struct iovec));
+    endpoint->data_batch.length += (size_t)vlen;
+
+    return vlen;
+}
+
 int aeron_network_publication_send_data(
     aeron_network_publication_t *publication, int64_t now_ns, int64_t snd_pos, int32_t term_offset)
 {
@@ -376,13 +577,51 @@ int aeron_network_publication_send_data(
     int result = 0, vlen = 0, bytes_sent = 0;
     int32_t available_window = (int32_t)(aeron_counter_get(publication->snd_lmt_position.value_addr) - snd_pos);
     int64_t highest_pos = snd_pos;
-    struct iovec iov[AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND];
-    struct mmsghdr mmsghdr[AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND];
+    struct iovec iov[AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND_MAX];
+    struct mmsghdr mmsghdr[AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND_MAX];
+    size_t segments[AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND_MAX];
+    int32_t flow_control_window = available_window;
+    size_t send_mtu_length;
+    AERON_GET_VOLATILE(send_mtu_length, publication->send_mtu_length);
+    size_t max_gso_segments = publication->max_gso_segments;
+
+    if (send_mtu_length != publication->mtu_length && max_gso_segments > 1)
+    {
+        const size_t max_gso_length_segments = AERON_NETWORK_PUBLICATION_MAX_GSO_LENGTH / send_mtu_length;
+        max_gso_segments = max_gso_length_segments < max_gso_segments ? max_gso_length_segments : max_gso_segments;
+    }
+
+    if (publication->pacing_rate > 0)
+    {
+        const int64_t pacing_budget = aeron_network_publication_pacing_budget(publication, now_ns);
+        if (pacing_budget < available_window)
+        {
+            available_window = (int32_t)pacing_budget;
+        }
+    }
+
+    if (publication->send_budget < available_window)
+    {
+        available_window = (int32_t)publication->send_budget;
+    }
 
-    for (size_t i = 0; i < AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND && available_window > 0; i++)
+    while (available_window > 0)
     {
-        size_t scan_limit = (size_t)available_window < publication->mtu_length ?
-            (size_t)available_window : publication->mtu_length;
+        /*
+         * With GSO a run of frames that fill whole MTU sized datagrams can be extended in place, the kernel then
+         * cuts the run back into datagrams of send_mtu_length with only the last one allowed to be short.
+         */
+        const bool can_extend = vlen > 0 &&
+            segments[vlen - 1] < max_gso_segments &&
+            iov[vlen - 1].iov_len == segments[vlen - 1] * send_mtu_length;
+
+        if (!can_extend && publication->max_messages_per_send == (size_t)vlen)
+        {
+            break;
+        }
+
+        size_t scan_limit = (size_t)available_window < send_mtu_length ?
+            (size_t)available_window : send_mtu_length;
         size_t active_index = aeron_logbuffer_index_by_position(snd_pos, publication->position_bits_to_shift);
         size_t padding = 0;
 
@@ -392,15 +631,26 @@ int aeron_network_publication_send_data(
 
         if (available > 0)
         {
-            iov[i].iov_base = ptr;
-            iov[i].iov_len = (uint32_t)available;
-            mmsghdr[i].msg_hdr.msg_iov = &iov[i];
-            mmsghdr[i].msg_hdr.msg_iovlen = 1;
-            mmsghdr[i].msg_hdr.msg_flags = 0;
-            mmsghdr[i].msg_len = 0;
-            mmsghdr[i].msg_hdr.msg_control = NULL;
-            mmsghdr[i].msg_hdr.msg_controllen = 0;
-            vlen++;
+            if (can_extend)
+            {
+                iov[vlen - 1].iov_len += available;
+                segments[vlen - 1]++;
+            }
+            else
+            {
+                iov[vlen].iov_base = ptr;
+                iov[vlen].iov_len = (uint32_t)available;
+                mmsghdr[vlen].msg_hdr.msg_name = NULL;
+                mmsghdr[vlen].msg_hdr.msg_namelen = 0;
+                mmsghdr[vlen].msg_hdr.msg_iov = &iov[vlen];
+                mmsghdr[vlen].msg_hdr.msg_iovlen = 1;
+                mmsghdr[vlen].msg_hdr.msg_flags = 0;
+                mmsghdr[vlen].msg_len = 0;
+                mmsghdr[vlen].msg_hdr.msg_control = NULL;
+                mmsghdr[vlen].msg_hdr.msg_controllen = 0;
+                segments[vlen] = 1;
+                vlen++;
+            }
 
             bytes_sent += (int)available;
             int32_t total_available = (int32_t)(available + padding);
@@ -417,7 +667,76 @@ int aeron_network_publication_send_data(
 
     if (vlen > 0)
     {
-        if ((result = aeron_send_channel_sendmmsg(publication->endpoint, mmsghdr, (size_t)vlen)) != vlen)
+        if (publication->is_checksum_enabled)
+        {
+            /* Frames are complete once scanned, so the checksum goes into the log and is reused by retransmits. */
+            for (int i = 0; i < vlen; i++)
+            {
+                aeron_data_frames_apply_checksum((uint8_t *)iov[i].iov_base, iov[i].iov_len);
+            }
+        }
+
+        bool has_control = false;
+
+#if defined(UDP_SEGMENT) || defined(HAVE_SO_TXTIME)
+        union aeron_network_publication_control_un
+        {
+            uint64_t align;
+            uint8_t buffer[CMSG_SPACE(sizeof(uint16_t)) + CMSG_SPACE(sizeof(uint64_t))];
+        }
+        control[AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND_MAX];
+        int64_t launch_time_ns = publication->pacing_time_ns;
+
+        for (int i = 0; i < vlen; i++)
+        {
+            size_t control_length = 0;
+            struct cmsghdr *cmsg;
+
+#if defined(UDP_SEGMENT)
+            if (segments[i] > 1)
+            {
+                const uint16_t gso_size = (uint16_t)send_mtu_length;
+
+                cmsg = (struct cmsghdr *)(control[i].buffer + control_length);
+                cmsg->cmsg_level = SOL_UDP;
+                cmsg->cmsg_type = UDP_SEGMENT;
+                cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+                memcpy(CMSG_DATA(cmsg), &gso_size, sizeof(gso_size));
+                control_length += CMSG_SPACE(sizeof(uint16_t));
+            }
+#endif
+
+#if defined(HAVE_SO_TXTIME)
+            if (publication->pacing_txtime)
+            {
+                const uint64_t txtime = (uint64_t)launch_time_ns;
+
+                cmsg = (struct cmsghdr *)(control[i].buffer + control_length);
+                cmsg->cmsg_level = SOL_SOCKET;
+                cmsg->cmsg_type = SCM_TXTIME;
+                cmsg->cmsg_len = CMSG_LEN(sizeof(uint64_t));
+                memcpy(CMSG_DATA(cmsg), &txtime, sizeof(txtime));
+                control_length += CMSG_SPACE(sizeof(uint64_t));
+                launch_time_ns += aeron_network_publication_pacing_duration_ns(publication, iov[i].iov_len);
+            }
+#endif
+
+            if (control_length > 0)
+            {
+                mmsghdr[i].msg_hdr.msg_control = control[i].buffer;
+                mmsghdr[i].msg_hdr.msg_controllen = control_length;
+                has_control = true;
+            }
+        }
+#endif
+
+        const int64_t send_ns = NULL != publication->trace_ring ? aeron_nano_clock() : 0;
+
+        if (publication->is_send_coalescing && !has_control)
+        {
+            result = aeron_network_publication_coalesce_data(publication, iov, vlen);
+        }
+        else if ((result = aeron_send_channel_sendmmsg(publication->endpoint, mmsghdr, (size_t)vlen)) != vlen)
         {
             if (result >= 0)
             {
@@ -425,23 +744,126 @@ int aeron_network_publication_send_data(
             }
         }
 
+        AERON_DRIVER_TRACEPOINT5(
+            publication_send_data, publication->session_id, publication->stream_id, snd_pos, bytes_sent, vlen);
+
+        if (NULL != publication->trace_ring)
+        {
+            for (int i = 0; i < vlen; i++)
+            {
+                aeron_trace_ring_record_frames(
+                    publication->trace_ring, AERON_TRACE_EVENT_SEND, send_ns, iov[i].iov_base, iov[i].iov_len);
+            }
+        }
+
+        if (publication->pacing_rate > 0)
+        {
+            publication->pacing_time_ns += aeron_network_publication_pacing_duration_ns(
+                publication, (size_t)bytes_sent);
+        }
+
         publication->time_of_last_send_or_heartbeat_ns = now_ns;
+        publication->heartbeat_interval_ns = AERON_NETWORK_PUBLICATION_HEARTBEAT_TIMEOUT_NS;
         publication->track_sender_limits = true;
+        if (AERON_NULL_VALUE == publication->rtt_sample_position)
+        {
+            publication->rtt_sample_position = highest_pos;
+            publication->rtt_sample_ns = now_ns;
+        }
         aeron_counter_set_ordered(publication->snd_pos_position.value_addr, highest_pos);
     }
-    else if (publication->track_sender_limits && available_window <= 0)
+    else if (publication->track_sender_limits && flow_control_window <= 0)
     {
         aeron_counter_ordered_increment(publication->snd_bpe_counter.value_addr, 1);
-        aeron_counter_ordered_increment(publication->sender_flow_control_limits_counter, 1);
+        aeron_counter_increment(publication->sender_flow_control_limits_counter, 1);
         publication->track_sender_limits = false;
     }
 
     return result < 0 ? result : bytes_sent;
 }
 
+/*
+ * One position at a time is sampled: the producer position when the Sender first sees data appended beyond the sender
+ * position, recorded once the sender position reaches it. Data sent within the duty cycle in which it is seen records
+ * no latency, so the histogram shows time spent behind flow control, pacing or a busy Sender.
+ */
+static inline void aeron_network_publication_sample_send_latency(
+    aeron_network_publication_t *publication, int64_t now_ns, int64_t snd_pos)
+{
+    if (AERON_NULL_VALUE == publication->snd_latency_sample_position)
+    {
+        const int64_t producer_position = aeron_network_publication_producer_position(publication);
+
+        if (producer_position > snd_pos)
+        {
+            publication->snd_latency_sample_position = producer_position;
+            publication->snd_latency_sample_ns = now_ns;
+        }
+    }
+}
+
+static inline void aeron_network_publication_record_send_latency(
+    aeron_network_publication_t *publication, int64_t now_ns)
+{
+    if (AERON_NULL_VALUE != publication->snd_latency_sample_position &&
+        aeron_counter_get(publication->snd_pos_position.value_addr) >= publication->snd_latency_sample_position)
+    {
+        aeron_stream_latency_histogram_record(
+            &publication->snd_latency_histogram, now_ns - publication->snd_latency_sample_ns);
+        publication->snd_latency_sample_position = AERON_NULL_VALUE;
+    }
+}
+
+/*
+ * Frames the exclusive publisher has sent itself count as sent. What it has appended but not yet sent is left to it
+ * for a grace period before the Sender sends it, so the two rarely send the same frames.
+ */
+static int64_t aeron_network_publication_adopt_inline_send_position(
+    aeron_network_publication_t *publication, int64_t now_ns, int64_t snd_pos, bool *should_defer_send)
+{
+    int64_t inline_pos;
+    AERON_GET_VOLATILE(inline_pos, *publication->snd_inline_position.value_addr);
+
+    if (inline_pos > snd_pos)
+    {
+        snd_pos = inline_pos;
+        aeron_counter_set_ordered(publication->snd_pos_position.value_addr, snd_pos);
+        publication->time_of_last_send_or_heartbeat_ns = now_ns;
+        publication->heartbeat_interval_ns = AERON_NETWORK_PUBLICATION_HEARTBEAT_TIMEOUT_NS;
+        publication->track_sender_limits = true;
+    }
+
+    if (aeron_network_publication_producer_position(publication) > snd_pos)
+    {
+        if (AERON_NULL_VALUE == publication->inline_send_lag_start_ns)
+        {
+            publication->inline_send_lag_start_ns = now_ns;
+        }
+
+        *should_defer_send =
+            now_ns - publication->inline_send_lag_start_ns < AERON_NETWORK_PUBLICATION_INLINE_SEND_GRACE_NS;
+    }
+    else
+    {
+        publication->inline_send_lag_start_ns = AERON_NULL_VALUE;
+        *should_defer_send = false;
+    }
+
+    return snd_pos;
+}
+
 int aeron_network_publication_send(aeron_network_publication_t *publication, int64_t now_ns)
 {
+    const uint64_t start_ticks = publication->is_snd_cpu_tracked ? aeron_tsc_ticks() : 0;
     int64_t snd_pos = aeron_counter_get(publication->snd_pos_position.value_addr);
+    bool should_defer_send = false;
+
+    if (publication->is_inline_send)
+    {
+        snd_pos = aeron_network_publication_adopt_inline_send_position(
+            publication, now_ns, snd_pos, &should_defer_send);
+    }
+
     int32_t active_term_id = aeron_logbuffer_compute_term_id_from_position(
         snd_pos, publication->position_bits_to_shift, publication->initial_term_id);
     int32_t term_offset = (int32_t)snd_pos & publication->term_length_mask;
@@ -454,12 +876,29 @@ int aeron_network_publication_send(aeron_network_publication_t *publication, int
         }
     }
 
-    int bytes_sent = aeron_network_publication_send_data(publication, now_ns, snd_pos, term_offset);
+    if (publication->is_snd_latency_tracked)
+    {
+        aeron_network_publication_sample_send_latency(publication, now_ns, snd_pos);
+    }
+
+    int bytes_sent = should_defer_send ?
+        0 : aeron_network_publication_send_data(publication, now_ns, snd_pos, term_offset);
     if (bytes_sent < 0)
     {
         return -1;
     }
 
+    if (publication->is_inline_send && bytes_sent > 0)
+    {
+        aeron_counter_propose_max_atomic(
+            publication->snd_inline_position.value_addr, aeron_counter_get(publication->snd_pos_position.value_addr));
+    }
+
+    if (publication->is_snd_latency_tracked && bytes_sent > 0)
+    {
+        aeron_network_publication_record_send_latency(publication, now_ns);
+    }
+
     if (0 == bytes_sent)
     {
         bool is_end_of_stream;
@@ -472,10 +911,12 @@ int aeron_network_publication_send(aeron_network_publication_t *publication, int
             return -1;
         }
 
-        bool has_spies;
+        bool has_spies, has_short_circuit_subscribers;
         AERON_GET_VOLATILE(has_spies, publication->has_spies);
+        AERON_GET_VOLATILE(has_short_circuit_subscribers, publication->has_short_circuit_subscribers);
 
-        if (publication->spies_simulate_connection && has_spies && !publication->has_receivers)
+        if ((publication->spies_simulate_connection || has_short_circuit_subscribers) &&
+            has_spies && !publication->has_receivers)
         {
             const int64_t new_snd_pos = aeron_network_publication_max_spy_position(publication, snd_pos);
             aeron_counter_set_ordered(publication->snd_pos_position.value_addr, new_snd_pos);
@@ -498,94 +939,169 @@ int aeron_network_publication_send(aeron_network_publication_t *publication, int
         AERON_PUT_ORDERED(publication->has_receivers, false);
     }
 
+    if (publication->is_snd_cpu_tracked)
+    {
+        aeron_stream_cpu_counters_record(&publication->snd_cpu_counters, AERON_STREAM_CPU_SENDER_SEND, start_ticks);
+    }
+
     aeron_retransmit_handler_process_timeouts(
         &publication->retransmit_handler, now_ns, aeron_network_publication_resend, publication);
 
     return bytes_sent;
 }
 
-int aeron_network_publication_resend(void *clientd, int32_t term_id, int32_t term_offset, size_t length)
+int aeron_network_publication_resend(
+    void *clientd,
+    int32_t term_id,
+    int32_t term_offset,
+    size_t length,
+    const struct sockaddr_storage *repair_addrs,
+    size_t repair_addr_count)
 {
     aeron_network_publication_t *publication = (aeron_network_publication_t *)clientd;
+    const uint64_t start_ticks = publication->is_snd_cpu_tracked ? aeron_tsc_ticks() : 0;
     int64_t sender_position = aeron_counter_get(publication->snd_pos_position.value_addr);
     int64_t resend_position = aeron_logbuffer_compute_position(
         term_id, term_offset, publication->position_bits_to_shift, publication->initial_term_id);
     size_t term_length = (size_t)(publication->term_length_mask + 1L);
     int64_t bottom_resend_window = sender_position - (term_length / 2);
     int result = 0;
+    size_t send_mtu_length;
+    AERON_GET_VOLATILE(send_mtu_length, publication->send_mtu_length);
 
     if (bottom_resend_window <= resend_position && resend_position < sender_position)
     {
+        AERON_DRIVER_TRACEPOINT5(
+            publication_resend, publication->session_id, publication->stream_id, term_id, term_offset, length);
+
         size_t index = aeron_logbuffer_index_by_position(resend_position, publication->position_bits_to_shift);
 
+        struct iovec iov[AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND_MAX];
+        struct mmsghdr mmsghdr[AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND_MAX];
         size_t remaining_bytes = length;
-        int32_t bytes_sent = 0;
         int32_t offset = term_offset;
+        bool is_complete = false;
 
-        do
+        /* Frames of the range go out in batches of max_messages_per_send so a merged range costs few syscalls. */
+        while (!is_complete)
         {
-            offset += bytes_sent;
+            int vlen = 0;
 
-            uint8_t *ptr = publication->mapped_raw_log.term_buffers[index].addr + offset;
-            size_t term_length_left = term_length - (size_t)offset;
-            size_t padding = 0;
-            size_t max_length = remaining_bytes < publication->mtu_length ? remaining_bytes : publication->mtu_length;
+            while (remaining_bytes > 0 && publication->max_messages_per_send > (size_t)vlen)
+            {
+                uint8_t *ptr = publication->mapped_raw_log.term_buffers[index].addr + offset;
+                size_t term_length_left = term_length - (size_t)offset;
+                size_t padding = 0;
+                size_t max_length = remaining_bytes < send_mtu_length ? remaining_bytes : send_mtu_length;
+
+                size_t available = aeron_term_scanner_scan_for_availability(
+                    ptr, term_length_left, max_length, &padding);
+                if (available <= 0)
+                {
+                    is_complete = true;
+                    break;
+                }
 
-            size_t available = aeron_term_scanner_scan_for_availability(ptr, term_length_left, max_length, &padding);
-            if (available <= 0)
+                iov[vlen].iov_base = ptr;
+                iov[vlen].iov_len = (uint32_t)available;
+                mmsghdr[vlen].msg_hdr.msg_name = NULL;
+                mmsghdr[vlen].msg_hdr.msg_namelen = 0;
+                mmsghdr[vlen].msg_hdr.msg_iov = &iov[vlen];
+                mmsghdr[vlen].msg_hdr.msg_iovlen = 1;
+                mmsghdr[vlen].msg_hdr.msg_control = NULL;
+                mmsghdr[vlen].msg_hdr.msg_controllen = 0;
+                mmsghdr[vlen].msg_hdr.msg_flags = 0;
+                mmsghdr[vlen].msg_len = 0;
+                vlen++;
+
+                const size_t bytes_sent = available + padding;
+                remaining_bytes = bytes_sent < remaining_bytes ? remaining_bytes - bytes_sent : 0;
+                offset += (int32_t)bytes_sent;
+            }
+
+            if (0 == vlen)
             {
                 break;
             }
 
-            struct iovec iov[1];
-            struct msghdr msghdr;
-
-            iov[0].iov_base = ptr;
-            iov[0].iov_len = (uint32_t)available;
-            msghdr.msg_iov = iov;
-            msghdr.msg_iovlen = 1;
-            msghdr.msg_control = NULL;
-            msghdr.msg_controllen = 0;
-            msghdr.msg_flags = 0;
+            bool is_short_send = false;
+            size_t target = 0;
 
-            int sendmsg_result;
-            if ((sendmsg_result = aeron_send_channel_sendmsg(publication->endpoint, &msghdr)) != (int)iov[0].iov_len)
+            /* a unicast repair goes to each receiver which NAKed, otherwise to the channel */
+            do
             {
-                if (sendmsg_result >= 0)
-                {
-                    aeron_counter_increment(publication->short_sends_counter, 1);
-                    break;
-                }
-                else
+                int sendmmsg_result = 0 == repair_addr_count ?
+                    aeron_send_channel_sendmmsg(publication->endpoint, mmsghdr, (size_t)vlen) :
+                    aeron_send_channel_sendmmsg_to(
+                        publication->endpoint, mmsghdr, (size_t)vlen, &repair_addrs[target]);
+
+                if (sendmmsg_result != vlen)
                 {
-                    result = -1;
-                    break;
+                    if (sendmmsg_result >= 0)
+                    {
+                        aeron_counter_increment(publication->short_sends_counter, 1);
+                    }
+                    else
+                    {
+                        result = -1;
+                    }
+                    is_short_send = true;
                 }
             }
+            while (++target < repair_addr_count && !is_short_send);
+
+            if (is_short_send)
+            {
+                break;
+            }
 
-            bytes_sent = (int32_t)(available + padding);
-            remaining_bytes -= bytes_sent;
+            is_complete = is_complete || 0 == remaining_bytes;
         }
-        while (remaining_bytes > 0);
 
-        aeron_counter_ordered_increment(publication->retransmits_sent_counter, 1);
+        aeron_counter_increment(publication->retransmits_sent_counter, 1);
+    }
+
+    if (publication->is_snd_cpu_tracked)
+    {
+        aeron_stream_cpu_counters_record(&publication->snd_cpu_counters, AERON_STREAM_CPU_SENDER_RESEND, start_ticks);
     }
 
     return result;
 }
 
 void aeron_network_publication_on_nak(
-    aeron_network_publication_t *publication, int32_t term_id, int32_t term_offset, int32_t length)
+    aeron_network_publication_t *publication,
+    int32_t term_id,
+    int32_t term_offset,
+    int32_t length,
+    struct sockaddr_storage *addr)
 {
-    aeron_retransmit_handler_on_nak(
+    const uint64_t start_ticks = publication->is_snd_cpu_tracked ? aeron_tsc_ticks() : 0;
+    const int64_t resend_ticks = publication->is_snd_cpu_tracked ?
+        aeron_counter_get(publication->snd_cpu_counters.tick_counters[AERON_STREAM_CPU_SENDER_RESEND]) : 0;
+
+    aeron_retransmit_handler_on_nak_from(
         &publication->retransmit_handler,
         term_id,
         term_offset,
         (size_t)length,
         (size_t)(publication->term_length_mask + 1L),
+        addr,
         aeron_clock_cached_nano_time(publication->cached_clock),
         aeron_network_publication_resend,
         publication);
+
+    if (publication->is_snd_cpu_tracked)
+    {
+        /* an immediate resend is already counted against resend so is left out of the NAK handling */
+        const int64_t nested_resend_ticks = aeron_counter_get(
+            publication->snd_cpu_counters.tick_counters[AERON_STREAM_CPU_SENDER_RESEND]) - resend_ticks;
+
+        aeron_stream_cpu_counters_record(
+            &publication->snd_cpu_counters,
+            AERON_STREAM_CPU_SENDER_NAK,
+            start_ticks + (uint64_t)nested_resend_ticks);
+    }
 }
 
 inline static bool aeron_network_publication_has_required_receivers(aeron_network_publication_t *publication)
@@ -613,6 +1129,7 @@ inline static void aeron_network_publication_update_connected_status(
 void aeron_network_publication_on_status_message(
     aeron_network_publication_t *publication, const uint8_t *buffer, size_t length, struct sockaddr_storage *addr)
 {
+    const uint64_t start_ticks = publication->is_snd_cpu_tracked ? aeron_tsc_ticks() : 0;
     const int64_t time_ns = aeron_clock_cached_nano_time(publication->cached_clock);
     publication->status_message_deadline_ns = time_ns + publication->connection_timeout_ns;
 
@@ -636,6 +1153,29 @@ void aeron_network_publication_on_status_message(
     aeron_network_publication_update_connected_status(
         publication,
         aeron_network_publication_has_required_receivers(publication));
+
+    /* the time for sent data to be acknowledged includes the SM interval, which the window has to cover as well */
+    if (AERON_NULL_VALUE != publication->rtt_sample_position && length >= sizeof(aeron_status_message_header_t))
+    {
+        aeron_status_message_header_t *sm = (aeron_status_message_header_t *)buffer;
+        const int64_t consumption_position = aeron_logbuffer_compute_position(
+            sm->consumption_term_id,
+            sm->consumption_term_offset,
+            publication->position_bits_to_shift,
+            publication->initial_term_id);
+
+        if (consumption_position >= publication->rtt_sample_position)
+        {
+            AERON_PUT_ORDERED(publication->rtt_ns, time_ns - publication->rtt_sample_ns);
+            publication->rtt_sample_position = AERON_NULL_VALUE;
+        }
+    }
+
+    if (publication->is_snd_cpu_tracked)
+    {
+        aeron_stream_cpu_counters_record(
+            &publication->snd_cpu_counters, AERON_STREAM_CPU_SENDER_STATUS_MESSAGE, start_ticks);
+    }
 }
 
 void aeron_network_publication_on_rttm(
@@ -691,13 +1231,8 @@ void aeron_network_publication_clean_buffer(aeron_network_publication_t *publica
         size_t bytes_left_in_term = term_length - term_offset;
         size_t length = bytes_to_clean < bytes_left_in_term ? bytes_to_clean : bytes_left_in_term;
 
-        memset(
-            publication->mapped_raw_log.term_buffers[dirty_index].addr + term_offset + sizeof(int64_t),
-            0,
-            length - sizeof(int64_t));
-
-        uint64_t *ptr = (uint64_t *)(publication->mapped_raw_log.term_buffers[dirty_index].addr + term_offset);
-        AERON_PUT_ORDERED(*ptr, (uint64_t)0);
+        aeron_term_cleaner_clean(
+            &publication->term_cleaner, publication->mapped_raw_log.term_buffers[dirty_index].addr, term_offset, length);
 
         publication->conductor_fields.clean_position = clean_position + length;
     }
@@ -714,20 +1249,16 @@ int aeron_network_publication_update_pub_lmt(aeron_network_publication_t *public
     int64_t snd_pos = aeron_counter_get_volatile(publication->snd_pos_position.value_addr);
 
     if (aeron_network_publication_has_required_receivers(publication) ||
-        (publication->spies_simulate_connection && publication->conductor_fields.subscribable.length > 0))
+        aeron_network_publication_has_connected_spies(publication))
     {
         int64_t min_consumer_position = snd_pos;
         if (publication->conductor_fields.subscribable.length > 0)
         {
-            for (size_t i = 0, length = publication->conductor_fields.subscribable.length; i < length; i++)
-            {
-                aeron_tetherable_position_t *tetherable_position = &publication->conductor_fields.subscribable.array[i];
-                if (AERON_SUBSCRIPTION_TETHER_RESTING != tetherable_position->state)
-                {
-                    int64_t position = aeron_counter_get_volatile(tetherable_position->value_addr);
-                    min_consumer_position = position < min_consumer_position ? position : min_consumer_position;
-                }
-            }
+            int64_t min_spy_position = aeron_min_position_tracker_min(
+                &publication->conductor_fields.min_position_tracker,
+                &publication->conductor_fields.subscribable,
+                snd_pos);
+            min_consumer_position = min_spy_position < min_consumer_position ? min_spy_position : min_consumer_position;
         }
 
         int64_t proposed_pub_lmt = min_consumer_position + publication->term_window_length;
@@ -809,7 +1340,9 @@ bool aeron_network_publication_spies_finished_consuming(
     {
         for (size_t i = 0, length = publication->conductor_fields.subscribable.length; i < length; i++)
         {
-            if (aeron_counter_get_volatile(publication->conductor_fields.subscribable.array[i].value_addr) < eos_pos)
+            aeron_tetherable_position_t *tetherable_position = &publication->conductor_fields.subscribable.array[i];
+            if (!tetherable_position->is_observer &&
+                aeron_counter_get_volatile(tetherable_position->value_addr) < eos_pos)
             {
                 return false;
             }
@@ -828,6 +1361,8 @@ bool aeron_network_publication_spies_finished_consuming(
         publication->conductor_fields.subscribable.array = NULL;
         publication->conductor_fields.subscribable.length = 0;
         publication->conductor_fields.subscribable.capacity = 0;
+        aeron_min_position_tracker_close(&publication->conductor_fields.min_position_tracker);
+        aeron_untethered_tracker_close(&publication->conductor_fields.untethered_tracker);
     }
 
     return true;
@@ -839,6 +1374,14 @@ void aeron_network_publication_check_untethered_subscriptions(
     const int64_t sender_position = aeron_counter_get_volatile(publication->snd_pos_position.value_addr);
     int64_t term_window_length = publication->term_window_length;
     int64_t untethered_window_limit = (sender_position - term_window_length) + (term_window_length / 8);
+    int64_t observer_lapped_limit = sender_position - ((int64_t)publication->term_length_mask + 1);
+
+    aeron_untethered_tracker_t *untethered_tracker = &publication->conductor_fields.untethered_tracker;
+    if (aeron_untethered_tracker_is_ahead(
+        untethered_tracker, &publication->conductor_fields.subscribable, untethered_window_limit, now_ns))
+    {
+        return;
+    }
 
     for (size_t i = 0, length = publication->conductor_fields.subscribable.length; i < length; i++)
     {
@@ -856,14 +1399,21 @@ void aeron_network_publication_check_untethered_subscriptions(
             switch (tetherable_position->state)
             {
                 case AERON_SUBSCRIPTION_TETHER_ACTIVE:
-                    if (aeron_counter_get_volatile(tetherable_position->value_addr) > untethered_window_limit)
+                {
+                    int64_t position = aeron_counter_get_volatile(tetherable_position->value_addr);
+                    bool is_lapped = tetherable_position->is_observer && position < observer_lapped_limit;
+
+                    if (!is_lapped && position > untethered_window_limit)
                     {
                         tetherable_position->time_of_last_update_ns = now_ns;
                     }
-                    else if (now_ns > (tetherable_position->time_of_last_update_ns + window_limit_timeout_ns))
+                    else if (is_lapped ||
+                        now_ns > (aeron_untethered_tracker_time_of_last_update_ns(
+                        untethered_tracker, tetherable_position) + window_limit_timeout_ns))
                     {
                         aeron_driver_conductor_on_unavailable_image(
                             conductor,
+                            tetherable_position->subscription_client_id,
                             publication->conductor_fields.managed_resource.registration_id,
                             tetherable_position->subscription_registration_id,
                             publication->stream_id,
@@ -878,6 +1428,7 @@ void aeron_network_publication_check_untethered_subscriptions(
                             publication->session_id);
                     }
                     break;
+                }
 
                 case AERON_SUBSCRIPTION_TETHER_LINGER:
                     if (now_ns > (tetherable_position->time_of_last_update_ns + window_limit_timeout_ns))
@@ -898,6 +1449,7 @@ void aeron_network_publication_check_untethered_subscriptions(
 
                         aeron_driver_conductor_on_available_image(
                             conductor,
+                            tetherable_position->subscription_client_id,
                             publication->conductor_fields.managed_resource.registration_id,
                             publication->stream_id,
                             publication->session_id,
@@ -919,6 +1471,77 @@ void aeron_network_publication_check_untethered_subscriptions(
             }
         }
     }
+
+    aeron_untethered_tracker_on_full_check(untethered_tracker, &publication->conductor_fields.subscribable);
+}
+
+void aeron_network_publication_update_send_mtu_length(aeron_network_publication_t *publication)
+{
+    const struct sockaddr_storage *addr = &publication->endpoint->conductor_fields.udp_channel->remote_data;
+    size_t path_mtu = 0;
+
+    if (aeron_udp_channel_transport_probe_path_mtu(addr, &path_mtu) < 0)
+    {
+        return;
+    }
+
+    const size_t header_length = AF_INET6 == addr->ss_family ?
+        AERON_NETWORK_PUBLICATION_IPV6_UDP_HEADER_LENGTH : AERON_NETWORK_PUBLICATION_IPV4_UDP_HEADER_LENGTH;
+    const size_t max_length = path_mtu < AERON_NETWORK_PUBLICATION_PMTU_MAX_LENGTH ?
+        path_mtu : AERON_NETWORK_PUBLICATION_PMTU_MAX_LENGTH;
+    size_t send_mtu_length = max_length > header_length ?
+        (max_length - header_length) & ~((size_t)AERON_LOGBUFFER_FRAME_ALIGNMENT - 1) : 0;
+
+    if (send_mtu_length < publication->mtu_length)
+    {
+        send_mtu_length = publication->mtu_length;
+    }
+
+    AERON_PUT_ORDERED(publication->send_mtu_length, send_mtu_length);
+}
+
+int32_t aeron_network_publication_recommended_term_length(int64_t peak_bytes_per_sec, int64_t rtt_ns)
+{
+    const double bandwidth_delay_product = ((double)peak_bytes_per_sec * (double)rtt_ns) / (1000.0 * 1000.0 * 1000.0);
+    const double required_length = AERON_NETWORK_PUBLICATION_TERM_LENGTH_WINDOW_MULTIPLE * bandwidth_delay_product;
+
+    if (required_length >= (double)AERON_LOGBUFFER_TERM_MAX_LENGTH)
+    {
+        return AERON_LOGBUFFER_TERM_MAX_LENGTH;
+    }
+
+    const int32_t term_length = aeron_find_next_power_of_two((int32_t)required_length);
+
+    return term_length < AERON_LOGBUFFER_TERM_MIN_LENGTH ? AERON_LOGBUFFER_TERM_MIN_LENGTH : term_length;
+}
+
+static void aeron_network_publication_update_term_length_recommendation(
+    aeron_network_publication_t *publication, int64_t now_ns)
+{
+    const int64_t elapsed_ns = now_ns - publication->conductor_fields.throughput_sample_ns;
+    if (elapsed_ns < AERON_NETWORK_PUBLICATION_THROUGHPUT_SAMPLE_INTERVAL_NS)
+    {
+        return;
+    }
+
+    const int64_t snd_pos = aeron_counter_get_volatile(publication->snd_pos_position.value_addr);
+    const int64_t bytes_per_sec =
+        ((snd_pos - publication->conductor_fields.throughput_sample_position) * 1000 * 1000 * 1000LL) / elapsed_ns;
+
+    publication->conductor_fields.throughput_sample_ns = now_ns;
+    publication->conductor_fields.throughput_sample_position = snd_pos;
+
+    if (bytes_per_sec > publication->conductor_fields.peak_bytes_per_sec)
+    {
+        publication->conductor_fields.peak_bytes_per_sec = bytes_per_sec;
+    }
+
+    int64_t rtt_ns;
+    AERON_GET_VOLATILE(rtt_ns, publication->rtt_ns);
+
+    aeron_counter_set_ordered(
+        publication->snd_term_length_counter.value_addr,
+        aeron_network_publication_recommended_term_length(publication->conductor_fields.peak_bytes_per_sec, rtt_ns));
 }
 
 void aeron_network_publication_on_time_event(
@@ -927,9 +1550,13 @@ void aeron_network_publication_on_time_event(
     bool has_receivers;
     AERON_GET_VOLATILE(has_receivers, publication->has_receivers);
 
+    AERON_PUT_ORDERED(
+        publication->has_short_circuit_subscribers,
+        aeron_network_publication_has_local_short_circuit_subscribers(publication));
+
     bool current_connected_status =
         aeron_network_publication_has_required_receivers(publication) ||
-        (publication->spies_simulate_connection && publication->conductor_fields.subscribable.length > 0);
+        aeron_network_publication_has_connected_spies(publication);
 
     aeron_network_publication_update_connected_status(publication, current_connected_status);
 
@@ -941,7 +1568,16 @@ void aeron_network_publication_on_time_event(
     {
         case AERON_NETWORK_PUBLICATION_STATE_ACTIVE:
         {
+            if (publication->is_pmtu_discovery_enabled && now_ns >= publication->conductor_fields.pmtu_probe_deadline_ns)
+            {
+                publication->conductor_fields.pmtu_probe_deadline_ns =
+                    now_ns + AERON_NETWORK_PUBLICATION_PMTU_PROBE_INTERVAL_NS;
+                aeron_network_publication_update_send_mtu_length(publication);
+            }
+
             aeron_network_publication_check_untethered_subscriptions(conductor, publication, now_ns);
+            aeron_network_publication_update_term_length_recommendation(publication, now_ns);
+            aeron_min_position_tracker_invalidate(&publication->conductor_fields.min_position_tracker);
             if (!publication->is_exclusive)
             {
                 aeron_network_publication_check_for_blocked_publisher(
@@ -1010,6 +1646,8 @@ extern int64_t aeron_network_publication_producer_position(aeron_network_publica
 
 extern int64_t aeron_network_publication_consumer_position(aeron_network_publication_t *publication);
 
+extern int64_t aeron_network_publication_history_position(aeron_network_publication_t *publication);
+
 extern void aeron_network_publication_trigger_send_setup_frame(aeron_network_publication_t *publication);
 
 extern void aeron_network_publication_sender_release(aeron_network_publication_t *publication);
@@ -1018,4 +1656,12 @@ extern bool aeron_network_publication_has_sender_released(aeron_network_publicat
 
 extern int64_t aeron_network_publication_max_spy_position(aeron_network_publication_t *publication, int64_t snd_pos);
 
+extern int64_t aeron_network_publication_pacing_budget(aeron_network_publication_t *publication, int64_t now_ns);
+
+extern int64_t aeron_network_publication_pacing_duration_ns(aeron_network_publication_t *publication, size_t length);
+
 extern size_t aeron_network_publication_num_spy_subscribers(aeron_network_publication_t *publication);
+
+extern bool aeron_network_publication_has_coupled_spies(aeron_network_publication_t *publication);
+extern bool aeron_network_publication_has_local_short_circuit_subscribers(aeron_network_publication_t *publication);
+extern bool aeron_network_publication_has_connected_spies(aeron_network_publication_t *publication);
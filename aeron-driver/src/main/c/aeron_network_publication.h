@@ -19,12 +19,18 @@
 
 #include "util/aeron_bitutil.h"
 #include "util/aeron_fileutil.h"
+#include "concurrent/aeron_term_cleaner.h"
 #include "uri/aeron_uri.h"
 #include "aeron_driver_common.h"
 #include "aeron_driver_context.h"
 #include "concurrent/aeron_counters_manager.h"
 #include "aeron_system_counters.h"
 #include "aeron_retransmit_handler.h"
+#include "aeron_stream_latency_histogram.h"
+#include "aeron_stream_cpu_counters.h"
+#include "concurrent/aeron_trace_ring.h"
+#include "aeron_min_position_tracker.h"
+#include "aeron_alloc.h"
 
 typedef enum aeron_network_publication_state_enum
 {
@@ -37,6 +43,16 @@ aeron_network_publication_state_t;
 
 #define AERON_NETWORK_PUBLICATION_HEARTBEAT_TIMEOUT_NS (100 * 1000 * 1000LL)
 #define AERON_NETWORK_PUBLICATION_SETUP_TIMEOUT_NS (100 * 1000 * 1000LL)
+#define AERON_NETWORK_PUBLICATION_MAX_GSO_SEGMENTS (64)
+#define AERON_NETWORK_PUBLICATION_MAX_GSO_LENGTH (65507)
+#define AERON_NETWORK_PUBLICATION_PACING_BURST_NS (1000 * 1000LL)
+#define AERON_NETWORK_PUBLICATION_PMTU_PROBE_INTERVAL_NS (10 * 1000 * 1000 * 1000LL)
+#define AERON_NETWORK_PUBLICATION_PMTU_MAX_LENGTH (9000)
+#define AERON_NETWORK_PUBLICATION_THROUGHPUT_SAMPLE_INTERVAL_NS (100 * 1000 * 1000LL)
+#define AERON_NETWORK_PUBLICATION_TERM_LENGTH_WINDOW_MULTIPLE (4)
+#define AERON_NETWORK_PUBLICATION_IPV4_UDP_HEADER_LENGTH (20 + 8)
+#define AERON_NETWORK_PUBLICATION_IPV6_UDP_HEADER_LENGTH (40 + 8)
+#define AERON_NETWORK_PUBLICATION_INLINE_SEND_GRACE_NS (50 * 1000LL)
 
 typedef struct aeron_send_channel_endpoint_stct aeron_send_channel_endpoint_t;
 typedef struct aeron_driver_conductor_stct aeron_driver_conductor_t;
@@ -50,26 +66,38 @@ typedef struct aeron_network_publication_stct
         int32_t refcnt;
         aeron_driver_managed_resource_t managed_resource;
         aeron_subscribable_t subscribable;
+        aeron_min_position_tracker_t min_position_tracker;
+        aeron_untethered_tracker_t untethered_tracker;
         int64_t clean_position;
         int64_t time_of_last_activity_ns;
         int64_t last_snd_pos;
+        int64_t pmtu_probe_deadline_ns;
+        int64_t throughput_sample_ns;
+        int64_t throughput_sample_position;
+        int64_t peak_bytes_per_sec;
+        aeron_allocator_t *allocator;
     }
     conductor_fields;
 
     uint8_t conductor_fields_pad[
-        (4 * AERON_CACHE_LINE_LENGTH) - sizeof(struct aeron_network_publication_conductor_fields_stct)];
+        (6 * AERON_CACHE_LINE_LENGTH) - sizeof(struct aeron_network_publication_conductor_fields_stct)];
 
+    /* set when the publication is created and only read after, apart from the flags the conductor flips */
     aeron_mapped_raw_log_t mapped_raw_log;
     aeron_position_t pub_pos_position;
     aeron_position_t pub_lmt_position;
     aeron_position_t snd_pos_position;
     aeron_position_t snd_lmt_position;
     aeron_atomic_counter_t snd_bpe_counter;
-    aeron_retransmit_handler_t retransmit_handler;
+    aeron_atomic_counter_t snd_term_length_counter;
+    aeron_stream_latency_histogram_t snd_latency_histogram;
+    aeron_stream_cpu_counters_t snd_cpu_counters;
+    aeron_position_t snd_inline_position;
     aeron_logbuffer_metadata_t *log_meta_data;
     aeron_send_channel_endpoint_t *endpoint;
     aeron_flow_control_strategy_t *flow_control;
     aeron_clock_cache_t *cached_clock;
+    aeron_trace_ring_t *trace_ring;
 
     char *log_file_name;
     int64_t term_buffer_length;
@@ -78,28 +106,39 @@ typedef struct aeron_network_publication_stct
     int64_t linger_timeout_ns;
     int64_t unblock_timeout_ns;
     int64_t connection_timeout_ns;
-    int64_t time_of_last_send_or_heartbeat_ns;
-    int64_t time_of_last_setup_ns;
-    int64_t status_message_deadline_ns;
+    int64_t heartbeat_max_interval_ns;
+    int64_t pacing_rate;
+    int64_t send_quantum;
     int64_t tag;
     int32_t session_id;
     int32_t stream_id;
     int32_t initial_term_id;
     int32_t term_length_mask;
+    int32_t send_weight;
     size_t log_file_name_length;
     size_t position_bits_to_shift;
     size_t mtu_length;
+    size_t send_mtu_length;
+    size_t max_gso_segments;
+    size_t max_messages_per_send;
+    bool is_send_coalescing;
     bool is_exclusive;
     bool spies_simulate_connection;
     bool signal_eos;
-    bool should_send_setup_frame;
-    bool has_receivers;
+    bool pacing_txtime;
+    bool is_checksum_enabled;
+    bool is_pmtu_discovery_enabled;
+    bool is_snd_latency_tracked;
+    bool is_snd_cpu_tracked;
+    bool is_inline_send;
     bool has_spies;
+    bool has_short_circuit_subscribers;
     bool is_connected;
     bool is_end_of_stream;
-    bool track_sender_limits;
-    bool has_sender_released;
     aeron_map_raw_log_close_func_t map_raw_log_close_func;
+    aeron_log_buffer_pool_t *log_buffer_pool;
+    aeron_driver_housekeeper_t *housekeeper;
+    aeron_term_cleaner_t term_cleaner;
     aeron_untethered_subscription_state_change_func_t untethered_subscription_state_change_func;
 
     int64_t *short_sends_counter;
@@ -107,6 +146,29 @@ typedef struct aeron_network_publication_stct
     int64_t *sender_flow_control_limits_counter;
     int64_t *retransmits_sent_counter;
     int64_t *unblocked_publications_counter;
+
+    uint8_t sender_fields_pre_padding[2 * AERON_CACHE_LINE_LENGTH];
+
+    /* written by the sender as it sends and handles SMs and NAKs */
+    aeron_retransmit_handler_t retransmit_handler;
+    int64_t time_of_last_send_or_heartbeat_ns;
+    int64_t heartbeat_interval_ns;
+    int64_t time_of_last_setup_ns;
+    int64_t status_message_deadline_ns;
+    int64_t pacing_time_ns;
+    int64_t snd_latency_sample_position;
+    int64_t snd_latency_sample_ns;
+    int64_t rtt_sample_position;
+    int64_t rtt_sample_ns;
+    int64_t rtt_ns;
+    int64_t send_budget;
+    int64_t inline_send_lag_start_ns;
+    bool should_send_setup_frame;
+    bool has_receivers;
+    bool track_sender_limits;
+    bool has_sender_released;
+
+    uint8_t sender_fields_post_padding[2 * AERON_CACHE_LINE_LENGTH];
 }
 aeron_network_publication_t;
 
@@ -114,6 +176,7 @@ int aeron_network_publication_create(
     aeron_network_publication_t **publication,
     aeron_send_channel_endpoint_t *endpoint,
     aeron_driver_context_t *context,
+    aeron_allocator_t *allocator,
     int64_t registration_id,
     int32_t session_id,
     int32_t stream_id,
@@ -123,6 +186,10 @@ int aeron_network_publication_create(
     aeron_position_t *snd_pos_position,
     aeron_position_t *snd_lmt_position,
     aeron_atomic_counter_t *snd_bpe_counter,
+    aeron_atomic_counter_t *snd_term_length_counter,
+    aeron_stream_latency_histogram_t *snd_latency_histogram,
+    aeron_stream_cpu_counters_t *snd_cpu_counters,
+    aeron_position_t *snd_inline_position,
     aeron_flow_control_strategy_t *flow_control_strategy,
     aeron_uri_publication_params_t *params,
     bool is_exclusive,
@@ -135,17 +202,38 @@ void aeron_network_publication_incref(void *clientd);
 
 void aeron_network_publication_decref(void *clientd);
 
+/*
+ * Probe the path MTU to the endpoint and let the sender pack datagrams up to it, never below the publication MTU.
+ */
+void aeron_network_publication_update_send_mtu_length(aeron_network_publication_t *publication);
+
 void aeron_network_publication_on_time_event(
     aeron_driver_conductor_t *conductor, aeron_network_publication_t *publication, int64_t now_ns, int64_t now_ms);
 
+/*
+ * Smallest term length whose publication window, half a term, holds two round trips at the peak rate so the
+ * producer is not held back by flow control, rounded up to a power of two within the valid term lengths.
+ */
+int32_t aeron_network_publication_recommended_term_length(int64_t peak_bytes_per_sec, int64_t rtt_ns);
+
 int aeron_network_publication_send(aeron_network_publication_t *publication, int64_t now_ns);
-int aeron_network_publication_resend(void *clientd, int32_t term_id, int32_t term_offset, size_t length);
+int aeron_network_publication_resend(
+    void *clientd,
+    int32_t term_id,
+    int32_t term_offset,
+    size_t length,
+    const struct sockaddr_storage *repair_addrs,
+    size_t repair_addr_count);
 
 int aeron_network_publication_send_data(
     aeron_network_publication_t *publication, int64_t now_ns, int64_t snd_pos, int32_t term_offset);
 
 void aeron_network_publication_on_nak(
-    aeron_network_publication_t *publication, int32_t term_id, int32_t term_offset, int32_t length);
+    aeron_network_publication_t *publication,
+    int32_t term_id,
+    int32_t term_offset,
+    int32_t length,
+    struct sockaddr_storage *addr);
 
 void aeron_network_publication_on_status_message(
     aeron_network_publication_t *publication, const uint8_t *buffer, size_t length, struct sockaddr_storage *addr);
@@ -164,6 +252,7 @@ inline void aeron_network_publication_add_subscriber_hook(void *clientd, int64_t
 {
     aeron_network_publication_t *publication = (aeron_network_publication_t *)clientd;
 
+    aeron_min_position_tracker_invalidate(&publication->conductor_fields.min_position_tracker);
     AERON_PUT_ORDERED(publication->has_spies, true);
     if (publication->spies_simulate_connection)
     {
@@ -176,10 +265,18 @@ inline void aeron_network_publication_remove_subscriber_hook(void *clientd, int6
 {
     aeron_network_publication_t *publication = (aeron_network_publication_t *)clientd;
 
-    if (1 == publication->conductor_fields.subscribable.length)
+    aeron_min_position_tracker_invalidate(&publication->conductor_fields.min_position_tracker);
+
+    for (size_t i = 0, length = publication->conductor_fields.subscribable.length; i < length; i++)
     {
-        AERON_PUT_ORDERED(publication->has_spies, false);
+        aeron_tetherable_position_t *tetherable_position = &publication->conductor_fields.subscribable.array[i];
+        if (!tetherable_position->is_observer && value_addr != tetherable_position->value_addr)
+        {
+            return;
+        }
     }
+
+    AERON_PUT_ORDERED(publication->has_spies, false);
 }
 
 inline bool aeron_network_publication_is_possibly_blocked(
@@ -216,6 +313,21 @@ inline int64_t aeron_network_publication_consumer_position(aeron_network_publica
     return aeron_counter_get_volatile(publication->snd_pos_position.value_addr);
 }
 
+/*
+ * The earliest term start still intact in the log, or the consumer position if that is earlier, for a spy which joins
+ * with the history the log retains rather than at the consumer position. The term behind the sender is only cleaned
+ * once the sender has moved on a term, so spies can always join with some history.
+ */
+inline int64_t aeron_network_publication_history_position(aeron_network_publication_t *publication)
+{
+    const int64_t consumer_position = aeron_network_publication_consumer_position(publication);
+    const int64_t term_length = (int64_t)publication->term_length_mask + 1;
+    const int64_t history_position =
+        (publication->conductor_fields.clean_position + (term_length - 1)) & ~(term_length - 1);
+
+    return history_position < consumer_position ? history_position : consumer_position;
+}
+
 inline void aeron_network_publication_trigger_send_setup_frame(aeron_network_publication_t *publication)
 {
     bool is_end_of_stream;
@@ -246,10 +358,13 @@ inline int64_t aeron_network_publication_max_spy_position(aeron_network_publicat
 
     for (size_t i = 0, length = publication->conductor_fields.subscribable.length; i < length; i++)
     {
-        int64_t spy_position = aeron_counter_get_volatile(
-            publication->conductor_fields.subscribable.array[i].value_addr);
+        aeron_tetherable_position_t *tetherable_position = &publication->conductor_fields.subscribable.array[i];
+        if (!tetherable_position->is_observer)
+        {
+            int64_t spy_position = aeron_counter_get_volatile(tetherable_position->value_addr);
 
-        position = spy_position > position ? spy_position : position;
+            position = spy_position > position ? spy_position : position;
+        }
     }
 
     return position;
@@ -260,4 +375,71 @@ inline size_t aeron_network_publication_num_spy_subscribers(aeron_network_public
     return publication->conductor_fields.subscribable.length;
 }
 
+/*
+ * Observer spies read the log without holding back the publication limit or the simulated connection, so only the
+ * remaining spies are coupled to the publisher.
+ */
+inline bool aeron_network_publication_has_coupled_spies(aeron_network_publication_t *publication)
+{
+    for (size_t i = 0, length = publication->conductor_fields.subscribable.length; i < length; i++)
+    {
+        if (!publication->conductor_fields.subscribable.array[i].is_observer)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+inline bool aeron_network_publication_has_local_short_circuit_subscribers(aeron_network_publication_t *publication)
+{
+    for (size_t i = 0, length = publication->conductor_fields.subscribable.length; i < length; i++)
+    {
+        if (publication->conductor_fields.subscribable.array[i].is_short_circuit)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*
+ * Short-circuited local subscribers have no receiver to report them, so they connect the publication and hold back its
+ * limit whether or not spies simulate connection. Otherwise a slow local subscriber could be lapped.
+ */
+inline bool aeron_network_publication_has_connected_spies(aeron_network_publication_t *publication)
+{
+    return (publication->spies_simulate_connection && aeron_network_publication_has_coupled_spies(publication)) ||
+        aeron_network_publication_has_local_short_circuit_subscribers(publication);
+}
+
+/*
+ * Pacing keeps a virtual send time that advances by the time each byte takes at the pacing rate. Sending is allowed
+ * while that time is no more than a burst ahead of now, with launch times taken from it when SO_TXTIME is in use.
+ */
+inline int64_t aeron_network_publication_pacing_budget(aeron_network_publication_t *publication, int64_t now_ns)
+{
+    if (publication->pacing_time_ns < now_ns)
+    {
+        publication->pacing_time_ns = now_ns;
+    }
+
+    const int64_t lead_ns = (now_ns + AERON_NETWORK_PUBLICATION_PACING_BURST_NS) - publication->pacing_time_ns;
+    if (lead_ns <= 0)
+    {
+        return 0;
+    }
+
+    const int64_t budget = (lead_ns * publication->pacing_rate) / (1000 * 1000 * 1000LL);
+
+    return budget < (int64_t)publication->mtu_length ? (int64_t)publication->mtu_length : budget;
+}
+
+inline int64_t aeron_network_publication_pacing_duration_ns(aeron_network_publication_t *publication, size_t length)
+{
+    return ((int64_t)length * (1000 * 1000 * 1000LL)) / publication->pacing_rate;
+}
+
 #endif //AERON_NETWORK_PUBLICATION_H
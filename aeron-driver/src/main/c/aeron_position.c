@@ -19,8 +19,9 @@
 #include <string.h>
 #include "aeron_position.h"
 #include "aeron_driver_context.h"
+#include "util/aeron_netutil.h"
 
-int32_t aeron_stream_counter_allocate(
+static int32_t aeron_stream_counter_allocate_in_region(
     aeron_counters_manager_t *counters_manager,
     const char *name,
     int32_t type_id,
@@ -29,7 +30,8 @@ int32_t aeron_stream_counter_allocate(
     int32_t stream_id,
     size_t channel_length,
     const char *channel,
-    const char *suffix)
+    const char *suffix,
+    bool compact)
 {
     char label[sizeof(((aeron_counter_metadata_descriptor_t *)0)->label)];
     int label_length = snprintf(
@@ -46,10 +48,49 @@ int32_t aeron_stream_counter_allocate(
 
     strncpy(layout.channel, channel, sizeof(layout.channel) - 1);
 
+    if (compact)
+    {
+        return aeron_counters_manager_allocate_compact(
+            counters_manager, type_id, (const uint8_t *)&layout, sizeof(layout), label, (size_t)label_length);
+    }
+
     return aeron_counters_manager_allocate(
         counters_manager, type_id, (const uint8_t *)&layout, sizeof(layout), label, (size_t)label_length);
 }
 
+int32_t aeron_stream_counter_allocate(
+    aeron_counters_manager_t *counters_manager,
+    const char *name,
+    int32_t type_id,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    size_t channel_length,
+    const char *channel,
+    const char *suffix)
+{
+    return aeron_stream_counter_allocate_in_region(
+        counters_manager, name, type_id, registration_id, session_id, stream_id, channel_length, channel, suffix, false);
+}
+
+/*
+ * For read-mostly counters with a single writer, which may be placed in the compact region when the driver has one.
+ */
+static int32_t aeron_stream_counter_allocate_compact(
+    aeron_counters_manager_t *counters_manager,
+    const char *name,
+    int32_t type_id,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    size_t channel_length,
+    const char *channel,
+    const char *suffix)
+{
+    return aeron_stream_counter_allocate_in_region(
+        counters_manager, name, type_id, registration_id, session_id, stream_id, channel_length, channel, suffix, true);
+}
+
 int32_t aeron_counter_publisher_limit_allocate(
     aeron_counters_manager_t *counters_manager,
     int64_t registration_id,
@@ -135,6 +176,87 @@ int32_t aeron_counter_sender_limit_allocate(
         "");
 }
 
+static void aeron_counter_inline_address(
+    const struct sockaddr_storage *addr, int32_t *address_type, int32_t *port, uint8_t *address)
+{
+    if (AF_INET6 == addr->ss_family)
+    {
+        const struct sockaddr_in6 *in6_addr = (const struct sockaddr_in6 *)addr;
+        *address_type = AERON_COUNTER_SENDER_INLINE_ADDRESS_IPV6;
+        *port = ntohs(in6_addr->sin6_port);
+        memcpy(address, &in6_addr->sin6_addr, sizeof(struct in6_addr));
+    }
+    else
+    {
+        const struct sockaddr_in *in_addr = (const struct sockaddr_in *)addr;
+        *address_type = AERON_COUNTER_SENDER_INLINE_ADDRESS_IPV4;
+        *port = ntohs(in_addr->sin_port);
+        memcpy(address, &in_addr->sin_addr, sizeof(struct in_addr));
+    }
+}
+
+int32_t aeron_counter_sender_inline_position_allocate(
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    const struct sockaddr_storage *endpoint_addr)
+{
+    aeron_sender_inline_position_key_layout_t layout;
+    memset(&layout, 0, sizeof(layout));
+
+    layout.registration_id = registration_id;
+    layout.session_id = session_id;
+    layout.stream_id = stream_id;
+    aeron_counter_inline_address(endpoint_addr, &layout.address_type, &layout.port, layout.address);
+
+    char endpoint[AERON_NETUTIL_FORMATTED_MAX_LENGTH];
+    aeron_format_source_identity(endpoint, sizeof(endpoint), (struct sockaddr_storage *)endpoint_addr);
+
+    char label[sizeof(((aeron_counter_metadata_descriptor_t *)0)->label)];
+    int label_length = snprintf(
+        label, sizeof(label), "%s: %" PRId64 " %" PRId32 " %" PRId32 " %s",
+        AERON_COUNTER_SENDER_INLINE_POSITION_NAME, registration_id, session_id, stream_id, endpoint);
+
+    return aeron_counters_manager_allocate(
+        counters_manager,
+        AERON_COUNTER_SENDER_INLINE_POSITION_TYPE_ID,
+        (const uint8_t *)&layout,
+        sizeof(layout),
+        label,
+        (size_t)label_length);
+}
+
+int32_t aeron_counter_receiver_inline_allocate(
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t stream_id,
+    const struct sockaddr_storage *bind_addr)
+{
+    aeron_receiver_inline_key_layout_t layout;
+    memset(&layout, 0, sizeof(layout));
+
+    layout.registration_id = registration_id;
+    layout.stream_id = stream_id;
+    aeron_counter_inline_address(bind_addr, &layout.address_type, &layout.port, layout.address);
+
+    char endpoint[AERON_NETUTIL_FORMATTED_MAX_LENGTH];
+    aeron_format_source_identity(endpoint, sizeof(endpoint), (struct sockaddr_storage *)bind_addr);
+
+    char label[sizeof(((aeron_counter_metadata_descriptor_t *)0)->label)];
+    int label_length = snprintf(
+        label, sizeof(label), "%s: %" PRId64 " %" PRId32 " %s",
+        AERON_COUNTER_RECEIVER_INLINE_NAME, registration_id, stream_id, endpoint);
+
+    return aeron_counters_manager_allocate(
+        counters_manager,
+        AERON_COUNTER_RECEIVER_INLINE_TYPE_ID,
+        (const uint8_t *)&layout,
+        sizeof(layout),
+        label,
+        (size_t)label_length);
+}
+
 int32_t aeron_counter_receiver_hwm_allocate(
     aeron_counters_manager_t *counters_manager,
     int64_t registration_id,
@@ -155,6 +277,26 @@ int32_t aeron_counter_receiver_hwm_allocate(
         "");
 }
 
+int32_t aeron_counter_receiver_timestamp_allocate(
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    size_t channel_length,
+    const char *channel)
+{
+    return aeron_stream_counter_allocate(
+        counters_manager,
+        AERON_COUNTER_RECEIVER_TIMESTAMP_NAME,
+        AERON_COUNTER_RECEIVER_TIMESTAMP_TYPE_ID,
+        registration_id,
+        session_id,
+        stream_id,
+        channel_length,
+        channel,
+        "");
+}
+
 int32_t aeron_counter_receiver_position_allocate(
     aeron_counters_manager_t *counters_manager,
     int64_t registration_id,
@@ -237,9 +379,10 @@ int32_t aeron_counter_receive_channel_status_allocate(
         channel);
 }
 
-int32_t aeron_counter_local_sockaddr_indicator_allocate(
+static int32_t aeron_counter_local_sockaddr_allocate(
     aeron_counters_manager_t *counters_manager,
     const char *name,
+    int32_t type_id,
     int32_t channel_status_counter_id,
     const char *local_sockaddr)
 {
@@ -258,13 +401,33 @@ int32_t aeron_counter_local_sockaddr_indicator_allocate(
 
     return aeron_counters_manager_allocate(
         counters_manager,
-        AERON_COUNTER_LOCAL_SOCKADDR_TYPE_ID,
+        type_id,
         (const uint8_t *)&sockaddr_layout,
         sizeof(sockaddr_layout),
         label,
         label_length);
 }
 
+int32_t aeron_counter_local_sockaddr_indicator_allocate(
+    aeron_counters_manager_t *counters_manager,
+    const char *name,
+    int32_t channel_status_counter_id,
+    const char *local_sockaddr)
+{
+    return aeron_counter_local_sockaddr_allocate(
+        counters_manager, name, AERON_COUNTER_LOCAL_SOCKADDR_TYPE_ID, channel_status_counter_id, local_sockaddr);
+}
+
+int32_t aeron_counter_receive_destination_allocate(
+    aeron_counters_manager_t *counters_manager,
+    const char *name,
+    int32_t channel_status_counter_id,
+    const char *local_sockaddr)
+{
+    return aeron_counter_local_sockaddr_allocate(
+        counters_manager, name, AERON_COUNTER_RCV_DESTINATION_TYPE_ID, channel_status_counter_id, local_sockaddr);
+}
+
 int32_t aeron_heartbeat_timestamp_allocate(
     aeron_counters_manager_t *counters_manager,
     const char *name,
@@ -301,7 +464,7 @@ int32_t aeron_counter_publisher_position_allocate(
     size_t channel_length,
     const char *channel)
 {
-    return aeron_stream_counter_allocate(
+    return aeron_stream_counter_allocate_compact(
         counters_manager,
         AERON_COUNTER_PUBLISHER_POSITION_NAME,
         AERON_COUNTER_PUBLISHER_POSITION_TYPE_ID,
@@ -321,7 +484,7 @@ int32_t aeron_counter_sender_bpe_allocate(
     size_t channel_length,
     const char *channel)
 {
-    return aeron_stream_counter_allocate(
+    return aeron_stream_counter_allocate_compact(
         counters_manager,
         AERON_COUNTER_SENDER_BPE_NAME,
         AERON_COUNTER_SENDER_BPE_TYPE_ID,
@@ -332,3 +495,113 @@ int32_t aeron_counter_sender_bpe_allocate(
         channel,
         "");
 }
+
+int32_t aeron_counter_sender_term_length_allocate(
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    size_t channel_length,
+    const char *channel)
+{
+    return aeron_stream_counter_allocate_compact(
+        counters_manager,
+        AERON_COUNTER_SENDER_TERM_LENGTH_NAME,
+        AERON_COUNTER_SENDER_TERM_LENGTH_TYPE_ID,
+        registration_id,
+        session_id,
+        stream_id,
+        channel_length,
+        channel,
+        "");
+}
+
+int32_t aeron_counter_subscription_readiness_allocate(
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t stream_id,
+    size_t channel_length,
+    const char *channel)
+{
+    return aeron_stream_counter_allocate(
+        counters_manager,
+        AERON_COUNTER_SUBSCRIPTION_READINESS_NAME,
+        AERON_COUNTER_SUBSCRIPTION_READINESS_TYPE_ID,
+        registration_id,
+        0,
+        stream_id,
+        channel_length,
+        channel,
+        "");
+}
+
+static const char *aeron_counter_publication_offer_metric_names[AERON_PUBLICATION_OFFER_METRIC_COUNT] =
+    {
+        "back-pressured",
+        "not-connected",
+        "admin-action",
+        "max-position-exceeded",
+        "offered-bytes",
+        "accepted-bytes",
+        "back-pressured-ns",
+        "back-pressured up to 10us",
+        "back-pressured up to 100us",
+        "back-pressured up to 1ms",
+        "back-pressured up to 10ms",
+        "back-pressured over 10ms"
+    };
+
+int32_t aeron_counter_publication_offer_allocate(
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    int32_t metric,
+    size_t channel_length,
+    const char *channel)
+{
+    char label[sizeof(((aeron_counter_metadata_descriptor_t *)0)->label)];
+    int label_length = snprintf(
+        label, sizeof(label), "%s: %" PRId64 " %" PRId32 " %" PRId32 " %.*s %s",
+        AERON_COUNTER_PUBLICATION_OFFER_NAME,
+        registration_id,
+        session_id,
+        stream_id,
+        (int)channel_length,
+        channel,
+        aeron_counter_publication_offer_metric_names[metric]);
+
+    aeron_publication_offer_key_layout_t layout =
+        {
+            .registration_id = registration_id,
+            .session_id = session_id,
+            .stream_id = stream_id,
+            .metric = metric,
+            .channel_length = (int32_t)channel_length
+        };
+
+    strncpy(layout.channel, channel, sizeof(layout.channel) - 1);
+
+    return aeron_counters_manager_allocate(
+        counters_manager,
+        AERON_COUNTER_PUBLICATION_OFFER_TYPE_ID,
+        (const uint8_t *)&layout,
+        sizeof(layout),
+        label,
+        (size_t)label_length);
+}
+
+int32_t aeron_counter_sender_shard_bytes_sent_allocate(aeron_counters_manager_t *counters_manager, int32_t shard_index)
+{
+    char label[sizeof(((aeron_counter_metadata_descriptor_t *)0)->label)];
+    int label_length = snprintf(
+        label, sizeof(label), "%s: shard=%" PRId32, AERON_COUNTER_SENDER_SHARD_BYTES_SENT_NAME, shard_index);
+
+    return aeron_counters_manager_allocate(
+        counters_manager,
+        AERON_COUNTER_SENDER_SHARD_BYTES_SENT_TYPE_ID,
+        (const uint8_t *)&shard_index,
+        sizeof(shard_index),
+        label,
+        (size_t)label_length);
+}
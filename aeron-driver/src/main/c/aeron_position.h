@@ -16,6 +16,7 @@
 #ifndef AERON_DRIVER_POSITION_H
 #define AERON_DRIVER_POSITION_H
 
+#include "aeron_socket.h"
 #include "concurrent/aeron_counters_manager.h"
 
 int32_t aeron_stream_counter_allocate(
@@ -75,6 +76,25 @@ int32_t aeron_counter_sender_limit_allocate(
     size_t channel_length,
     const char *channel);
 
+/*
+ * The key carries the resolved endpoint the exclusive publisher should send its frames to.
+ */
+int32_t aeron_counter_sender_inline_position_allocate(
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    const struct sockaddr_storage *endpoint_addr);
+
+/*
+ * The key carries the address the endpoint is bound to, which an inline subscriber binds its own socket to as well.
+ */
+int32_t aeron_counter_receiver_inline_allocate(
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t stream_id,
+    const struct sockaddr_storage *bind_addr);
+
 int32_t aeron_counter_subscription_position_allocate(
     aeron_counters_manager_t *counters_manager,
     int64_t registration_id,
@@ -92,6 +112,14 @@ int32_t aeron_counter_receiver_hwm_allocate(
     size_t channel_length,
     const char *channel);
 
+int32_t aeron_counter_receiver_timestamp_allocate(
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    size_t channel_length,
+    const char *channel);
+
 int32_t aeron_counter_receiver_position_allocate(
     aeron_counters_manager_t *counters_manager,
     int64_t registration_id,
@@ -136,4 +164,39 @@ int32_t aeron_counter_sender_bpe_allocate(
     size_t channel_length,
     const char *channel);
 
+int32_t aeron_counter_sender_term_length_allocate(
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    size_t channel_length,
+    const char *channel);
+
+int32_t aeron_counter_subscription_readiness_allocate(
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t stream_id,
+    size_t channel_length,
+    const char *channel);
+
+/*
+ * The key carries the metric the counter holds, so a client can find each of those for its publication.
+ */
+int32_t aeron_counter_publication_offer_allocate(
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    int32_t metric,
+    size_t channel_length,
+    const char *channel);
+
+int32_t aeron_counter_sender_shard_bytes_sent_allocate(aeron_counters_manager_t *counters_manager, int32_t shard_index);
+
+int32_t aeron_counter_receive_destination_allocate(
+    aeron_counters_manager_t *counters_manager,
+    const char *name,
+    int32_t channel_status_counter_id,
+    const char *local_sockaddr);
+
 #endif
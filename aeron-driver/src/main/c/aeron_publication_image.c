@@ -20,8 +20,31 @@
 #include "concurrent/aeron_term_rebuilder.h"
 #include "aeron_publication_image.h"
 #include "aeron_driver_receiver_proxy.h"
+#include "aeron_driver_receiver.h"
 #include "aeron_driver_conductor.h"
+#include "aeron_log_buffer_pre_faulter.h"
+#include "aeron_driver_housekeeper.h"
 #include "concurrent/aeron_term_gap_filler.h"
+#include "aeron_driver_tracepoints.h"
+
+#ifdef _MSC_VER
+#define _Static_assert static_assert
+#endif
+
+_Static_assert(
+    offsetof(aeron_publication_image_t, source_address) >=
+        offsetof(aeron_publication_image_t, needs_attention) + sizeof(int32_t) + AERON_CACHE_LINE_LENGTH,
+    "read mostly fields of aeron_publication_image_t must not share a cache line with conductor written fields");
+_Static_assert(
+    offsetof(aeron_publication_image_t, connections) >=
+        offsetof(aeron_publication_image_t, rate_limited_images_counter) + sizeof(int64_t *) +
+        (2 * AERON_CACHE_LINE_LENGTH),
+    "receiver written fields of aeron_publication_image_t must not share a cache line with read mostly fields");
+_Static_assert(
+    sizeof(aeron_publication_image_t) >=
+        offsetof(aeron_publication_image_t, last_loss_change_number) + sizeof(int64_t) +
+        (2 * AERON_CACHE_LINE_LENGTH),
+    "receiver written fields of aeron_publication_image_t must be followed by padding");
 
 static void aeron_publication_image_connection_set_control_address(
     aeron_publication_image_connection_t *connection,
@@ -53,11 +76,77 @@ static void aeron_update_active_transport_count(aeron_publication_image_t *image
     }
 }
 
+static void aeron_publication_image_publish_loss(aeron_publication_image_t *image)
+{
+    const int64_t change_number = image->begin_loss_change + 1;
+
+    AERON_PUT_ORDERED(image->begin_loss_change, change_number);
+
+    memcpy(image->loss_gaps, image->pending_loss_gaps, image->pending_loss_gap_count * sizeof(aeron_loss_detector_gap_t));
+    image->loss_gap_count = image->pending_loss_gap_count;
+
+    AERON_PUT_ORDERED(image->end_loss_change, change_number);
+    aeron_publication_image_request_attention(image);
+}
+
+static void aeron_publication_image_on_gap_scanned(void *clientd, int32_t term_id, int32_t term_offset, size_t length)
+{
+    aeron_publication_image_t *image = (aeron_publication_image_t *)clientd;
+    const int64_t gap_position = aeron_logbuffer_compute_position(
+        term_id, term_offset, image->position_bits_to_shift, image->initial_term_id);
+
+    image->last_nak_gap_position = gap_position;
+    if (gap_position == image->tracked_gap_position)
+    {
+        image->is_tracked_gap_naked = true;
+    }
+
+    if (image->pending_loss_gap_count < AERON_LOSS_DETECTOR_MAX_GAPS)
+    {
+        aeron_loss_detector_gap_t *gap = &image->pending_loss_gaps[image->pending_loss_gap_count++];
+        gap->term_id = term_id;
+        gap->term_offset = term_offset;
+        gap->length = length;
+    }
+
+    if (image->loss_reporter_offset >= 0)
+    {
+        const int64_t now_ms = aeron_clock_cached_epoch_time(image->cached_clock);
+        aeron_loss_reporter_record_observation(
+            image->loss_reporter, image->loss_reporter_offset, (int64_t)length, now_ms);
+    }
+    else if (NULL != image->loss_reporter)
+    {
+        if (NULL != image->endpoint)
+        {
+            char source[AERON_MAX_PATH];
+            int source_length = aeron_format_source_identity(source, sizeof(source), &image->source_address);
+
+            image->loss_reporter_offset = aeron_loss_reporter_create_entry(
+                image->loss_reporter,
+                (int64_t)length,
+                aeron_clock_cached_epoch_time(image->cached_clock),
+                image->session_id,
+                image->stream_id,
+                image->endpoint->conductor_fields.udp_channel->original_uri,
+                image->endpoint->conductor_fields.udp_channel->uri_length,
+                source,
+                (size_t)source_length);
+        }
+
+        if (-1 == image->loss_reporter_offset)
+        {
+            image->loss_reporter = NULL;
+        }
+    }
+}
+
 int aeron_publication_image_create(
     aeron_publication_image_t **image,
     aeron_receive_channel_endpoint_t *endpoint,
     aeron_receive_destination_t *destination,
     aeron_driver_context_t *context,
+    aeron_allocator_t *allocator,
     int64_t correlation_id,
     int32_t session_id,
     int32_t stream_id,
@@ -66,6 +155,9 @@ int aeron_publication_image_create(
     int32_t initial_term_offset,
     aeron_position_t *rcv_hwm_position,
     aeron_position_t *rcv_pos_position,
+    aeron_atomic_counter_t *rcv_timestamp_counter,
+    aeron_stream_latency_histogram_t *delivery_latency_histogram,
+    aeron_stream_cpu_counters_t *rcv_cpu_counters,
     aeron_congestion_control_strategy_t *congestion_control,
     struct sockaddr_storage *control_address,
     struct sockaddr_storage *source_address,
@@ -74,6 +166,8 @@ int aeron_publication_image_create(
     aeron_loss_reporter_t *loss_reporter,
     bool is_reliable,
     bool is_sparse,
+    bool is_huge_pages,
+    int32_t numa_node,
     bool treat_as_multicast,
     aeron_system_counters_t *system_counters)
 {
@@ -88,7 +182,7 @@ int aeron_publication_image_create(
 
     *image = NULL;
 
-    if (usable_fs_space < log_length)
+    if (!context->term_buffer_memfd && usable_fs_space < log_length)
     {
         aeron_set_err(
             ENOSPC,
@@ -96,39 +190,93 @@ int aeron_publication_image_create(
         return -1;
     }
 
-    if (aeron_alloc((void **)&_image, sizeof(aeron_publication_image_t)) < 0)
+    if (context->term_buffer_memfd && (path_length = aeron_memfd_log_location(path, sizeof(path), correlation_id)) < 0)
+    {
+        aeron_set_err(aeron_errcode(), "could not create memfd for image log: %s", aeron_errmsg());
+        return -1;
+    }
+
+    if (aeron_allocator_alloc(allocator, (void **)&_image, sizeof(aeron_publication_image_t)) < 0)
     {
         aeron_set_err(ENOMEM, "%s", "Could not allocate publication image");
         return -1;
     }
 
+    _image->conductor_fields.allocator = allocator;
     _image->log_file_name = NULL;
-    if (aeron_alloc((void **)(&_image->log_file_name), (size_t)path_length + 1) < 0)
+    if (aeron_allocator_alloc(allocator, (void **)(&_image->log_file_name), (size_t)path_length + 1) < 0)
     {
-        aeron_free(_image);
+        aeron_allocator_free(allocator, _image, sizeof(aeron_publication_image_t));
         aeron_set_err(ENOMEM, "%s", "Could not allocate publication image log_file_name");
         return -1;
     }
 
+    /* an RTT adaptive image tunes its own copy of the shared delay generator state */
+    _image->nak_delay_state = treat_as_multicast ?
+        context->multicast_delay_feedback_generator : context->unicast_delay_feedback_generator;
+    _image->is_nak_rtt_adaptive = context->nak_rtt_adaptive;
+    _image->nak_delay_rtt_ns = 0;
+    _image->next_nak_rtt_measurement_ns = 0;
+    _image->nak_rtt_ns = 0;
+    _image->is_sm_adaptive = context->status_message_adaptive;
+    _image->hwm_rate_bytes_per_sec = 0;
+
+    const int64_t rate_limit_burst_bytes = (int64_t)(
+        (context->image_rate_limit * AERON_PUBLICATION_IMAGE_RATE_LIMIT_BURST_WINDOW_NS) / 1000000000LL);
+    _image->rate_limit_bytes_per_sec = context->image_rate_limit;
+    _image->rate_limit_burst_bytes = rate_limit_burst_bytes > sender_mtu_length ?
+        rate_limit_burst_bytes : sender_mtu_length;
+    _image->rate_limit_available_bytes = _image->rate_limit_burst_bytes;
+    _image->rate_limit_last_refill_ns = INT64_MIN;
+    _image->time_of_last_rate_limit_ns = INT64_MIN;
+    _image->is_rate_limit_window_applied = false;
+
     if (aeron_loss_detector_init(
         &_image->loss_detector,
-        treat_as_multicast ? &context->multicast_delay_feedback_generator : &context->unicast_delay_feedback_generator,
-        aeron_publication_image_on_gap_detected, _image) < 0)
+        _image->is_nak_rtt_adaptive ? &_image->nak_delay_state :
+            treat_as_multicast ? &context->multicast_delay_feedback_generator : &context->unicast_delay_feedback_generator,
+        aeron_publication_image_on_gap_scanned, _image) < 0)
     {
-        aeron_free(_image);
+        aeron_allocator_free(allocator, _image->log_file_name, (size_t)path_length + 1);
+        aeron_allocator_free(allocator, _image, sizeof(aeron_publication_image_t));
         aeron_set_err(ENOMEM, "%s", "Could not init publication image loss detector");
         return -1;
     }
-
-    if (context->map_raw_log_func(
-        &_image->mapped_raw_log, path, is_sparse, (uint64_t)term_buffer_length, context->file_page_size) < 0)
+    _image->loss_detector.max_gaps = context->nak_max_gaps;
+
+    _image->log_buffer_pool = !is_sparse && !is_huge_pages && AERON_NUMA_NODE_NONE == numa_node ?
+        context->log_buffer_pool : NULL;
+    _image->housekeeper = context->housekeeper;
+    const bool is_pooled = NULL != _image->log_buffer_pool && aeron_log_buffer_pool_acquire(
+        _image->log_buffer_pool,
+        &_image->mapped_raw_log,
+        path,
+        (uint64_t)term_buffer_length,
+        context->file_page_size) > 0;
+    const bool is_pre_faulted_async = !is_pooled && !is_sparse && NULL != context->log_buffer_pre_faulter;
+
+    if (!is_pooled && context->map_raw_log_func(
+        &_image->mapped_raw_log,
+        path,
+        is_sparse || is_pre_faulted_async,
+        is_huge_pages,
+        numa_node,
+        (uint64_t)term_buffer_length,
+        context->file_page_size) < 0)
     {
-        aeron_free(_image->log_file_name);
-        aeron_free(_image);
+        aeron_allocator_free(allocator, _image->log_file_name, (size_t)path_length + 1);
+        aeron_allocator_free(allocator, _image, sizeof(aeron_publication_image_t));
         aeron_set_err(aeron_errcode(), "error mapping network raw log %s: %s", path, aeron_errmsg());
         return -1;
     }
+
+    if (is_pre_faulted_async)
+    {
+        aeron_log_buffer_pre_faulter_offer(
+            context->log_buffer_pre_faulter, path, context->file_page_size, is_huge_pages, numa_node);
+    }
     _image->map_raw_log_close_func = context->map_raw_log_close_func;
+    aeron_term_cleaner_init(&_image->term_cleaner, context->term_buffer_clean_mode, context->file_page_size);
     _image->untethered_subscription_state_change_func = context->untethered_subscription_state_change_func;
 
     _image->nano_clock = context->nano_clock;
@@ -163,12 +311,19 @@ int aeron_publication_image_create(
     _image->congestion_control = congestion_control;
     _image->loss_reporter = loss_reporter;
     _image->loss_reporter_offset = -1;
+    _image->tracked_gap_position = -1;
+    _image->tracked_gap_length = 0;
+    _image->tracked_gap_detected_ns = 0;
+    _image->last_nak_gap_position = -1;
+    _image->is_tracked_gap_naked = false;
     _image->conductor_fields.subscribable.array = NULL;
     _image->conductor_fields.subscribable.length = 0;
+    _image->conductor_fields.subscribable.change_number = 0;
     _image->conductor_fields.subscribable.capacity = 0;
     _image->conductor_fields.subscribable.add_position_hook_func = aeron_driver_subscribable_null_hook;
     _image->conductor_fields.subscribable.remove_position_hook_func = aeron_driver_subscribable_null_hook;
     _image->conductor_fields.subscribable.clientd = NULL;
+    aeron_untethered_tracker_init(&_image->conductor_fields.untethered_tracker);
     _image->conductor_fields.managed_resource.registration_id = correlation_id;
     _image->conductor_fields.managed_resource.clientd = _image;
     _image->conductor_fields.managed_resource.incref = NULL;
@@ -182,6 +337,22 @@ int aeron_publication_image_create(
     _image->rcv_hwm_position.value_addr = rcv_hwm_position->value_addr;
     _image->rcv_pos_position.counter_id = rcv_pos_position->counter_id;
     _image->rcv_pos_position.value_addr = rcv_pos_position->value_addr;
+    _image->rcv_timestamp_counter.counter_id =
+        NULL != rcv_timestamp_counter ? rcv_timestamp_counter->counter_id : AERON_NULL_COUNTER_ID;
+    _image->rcv_timestamp_counter.value_addr = NULL != rcv_timestamp_counter ? rcv_timestamp_counter->value_addr : NULL;
+    _image->is_delivery_latency_tracked = NULL != delivery_latency_histogram;
+    if (_image->is_delivery_latency_tracked)
+    {
+        _image->delivery_latency_histogram = *delivery_latency_histogram;
+    }
+    _image->is_rcv_cpu_tracked = NULL != rcv_cpu_counters;
+    _image->trace_ring = NULL;
+    if (_image->is_rcv_cpu_tracked)
+    {
+        _image->rcv_cpu_counters = *rcv_cpu_counters;
+    }
+    _image->delivery_latency_sample_position = AERON_NULL_VALUE;
+    _image->delivery_latency_sample_ns = 0;
     _image->term_length = term_buffer_length;
     _image->initial_term_id = initial_term_id;
     _image->term_length_mask = term_buffer_length - 1;
@@ -205,24 +376,48 @@ int aeron_publication_image_create(
         system_counters, AERON_SYSTEM_COUNTER_NAK_MESSAGES_SENT);
     _image->loss_gap_fills_counter = aeron_system_counter_addr(
         system_counters, AERON_SYSTEM_COUNTER_LOSS_GAP_FILLS);
+    _image->rate_limited_frames_counter = aeron_system_counter_addr(
+        system_counters, AERON_SYSTEM_COUNTER_RECEIVER_RATE_LIMITED_FRAMES);
+    _image->rate_limited_images_counter = aeron_system_counter_addr(
+        system_counters, AERON_SYSTEM_COUNTER_RECEIVER_RATE_LIMITED_IMAGES);
 
     const int64_t initial_position = aeron_logbuffer_compute_position(
         active_term_id, initial_term_offset, _image->position_bits_to_shift, initial_term_id);
 
     _image->begin_loss_change = -1;
     _image->end_loss_change = -1;
-    _image->loss_term_id = active_term_id;
-    _image->loss_term_offset = initial_term_offset;
-    _image->loss_length = 0;
+    _image->loss_gap_count = 0;
+    _image->pending_loss_gap_count = 0;
 
     _image->begin_sm_change = -1;
     _image->end_sm_change = -1;
+    _image->needs_attention = 0;
+    _image->attention_queue =
+        NULL != endpoint && NULL != endpoint->receiver_proxy && NULL != endpoint->receiver_proxy->receiver ?
+        &endpoint->receiver_proxy->receiver->attention_queue : NULL;
     _image->next_sm_position = initial_position;
     _image->next_sm_receiver_window_length = _image->congestion_control->initial_window_length(
         _image->congestion_control->state);
     _image->last_sm_position = initial_position;
     _image->last_sm_position_window_limit = initial_position + _image->next_sm_receiver_window_length;
     _image->time_of_last_packet_ns = now_ns;
+    _image->in_order_position = initial_position;
+    _image->is_redundant_path_enabled = context->redundant_path_enabled;
+    _image->has_shared_counters = context->receiver_shard_count > 1;
+    _image->is_in_order_fast_path = !_image->is_redundant_path_enabled && 0 == _image->rate_limit_bytes_per_sec;
+    _image->is_inline_receive = false;
+    _image->inline_receive_hwm_position = initial_position;
+    _image->receive_batch = NULL;
+    _image->next_in_receive_batch = NULL;
+    _image->has_batched_positions = false;
+    _image->batched_hwm_position = initial_position;
+    _image->batched_time_of_last_packet_ns = now_ns;
+    for (size_t i = 0; i < AERON_PUBLICATION_IMAGE_ARRIVAL_HISTORY_LENGTH; i++)
+    {
+        _image->arrival_history[i].position = -1;
+    }
+    _image->sm_rate_sample_ns = now_ns;
+    _image->sm_rate_sample_position = initial_position;
     _image->last_status_message_timestamp = 0;
     _image->conductor_fields.clean_position = initial_position;
     _image->conductor_fields.time_of_last_state_change_ns = now_ns;
@@ -244,20 +439,42 @@ int aeron_publication_image_close(aeron_counters_manager_t *counters_manager, ae
         aeron_counters_manager_free(counters_manager, image->rcv_hwm_position.counter_id);
         aeron_counters_manager_free(counters_manager, image->rcv_pos_position.counter_id);
 
+        if (AERON_NULL_COUNTER_ID != image->rcv_timestamp_counter.counter_id)
+        {
+            aeron_counters_manager_free(counters_manager, image->rcv_timestamp_counter.counter_id);
+        }
+
+        if (image->is_delivery_latency_tracked)
+        {
+            aeron_stream_latency_histogram_free(&image->delivery_latency_histogram, counters_manager);
+        }
+
+        if (image->is_rcv_cpu_tracked)
+        {
+            aeron_stream_cpu_counters_free(&image->rcv_cpu_counters, counters_manager);
+        }
+
         for (size_t i = 0, length = subscribable->length; i < length; i++)
         {
             aeron_counters_manager_free(counters_manager, subscribable->array[i].counter_id);
         }
 
         aeron_free(subscribable->array);
+        aeron_untethered_tracker_close(&image->conductor_fields.untethered_tracker);
         aeron_free(image->connections.array);
 
-        image->map_raw_log_close_func(&image->mapped_raw_log, image->log_file_name);
+        if (NULL == image->log_buffer_pool || aeron_log_buffer_pool_release(
+            image->log_buffer_pool, &image->mapped_raw_log, image->log_file_name) <= 0)
+        {
+            aeron_driver_housekeeper_close_log(
+                image->housekeeper, image->map_raw_log_close_func, &image->mapped_raw_log, image->log_file_name);
+        }
         image->congestion_control->fini(image->congestion_control);
-        aeron_free(image->log_file_name);
-    }
 
-    aeron_free(image);
+        aeron_allocator_t *allocator = image->conductor_fields.allocator;
+        aeron_allocator_free(allocator, image->log_file_name, image->log_file_name_length + 1);
+        aeron_allocator_free(allocator, image, sizeof(aeron_publication_image_t));
+    }
 
     return 0;
 }
@@ -274,13 +491,8 @@ void aeron_publication_image_clean_buffer_to(aeron_publication_image_t *image, i
         size_t bytes_left_in_term = term_length - term_offset;
         size_t length = bytes_to_clean < bytes_left_in_term ? bytes_to_clean : bytes_left_in_term;
 
-        memset(
-            image->mapped_raw_log.term_buffers[dirty_index].addr + term_offset + sizeof(int64_t),
-            0,
-            length - sizeof(int64_t));
-
-        uint64_t *ptr = (uint64_t *)(image->mapped_raw_log.term_buffers[dirty_index].addr + term_offset);
-        AERON_PUT_ORDERED(*ptr, (uint64_t)0);
+        aeron_term_cleaner_clean(
+            &image->term_cleaner, image->mapped_raw_log.term_buffers[dirty_index].addr, term_offset, length);
 
         image->conductor_fields.clean_position = clean_position + length;
     }
@@ -289,45 +501,134 @@ void aeron_publication_image_clean_buffer_to(aeron_publication_image_t *image, i
 void aeron_publication_image_on_gap_detected(void *clientd, int32_t term_id, int32_t term_offset, size_t length)
 {
     aeron_publication_image_t *image = (aeron_publication_image_t *)clientd;
-    const int64_t change_number = image->begin_loss_change + 1;
 
-    AERON_PUT_ORDERED(image->begin_loss_change, change_number);
+    AERON_DRIVER_TRACEPOINT5(image_gap_detected, image->session_id, image->stream_id, term_id, term_offset, length);
 
-    image->loss_term_id = term_id;
-    image->loss_term_offset = term_offset;
-    image->loss_length = length;
+    image->pending_loss_gap_count = 0;
+    aeron_publication_image_on_gap_scanned(clientd, term_id, term_offset, length);
+    aeron_publication_image_publish_loss(image);
+}
 
-    AERON_PUT_ORDERED(image->end_loss_change, change_number);
+/*
+ * While subscribers keep well inside the window an SM is only due every half window. Once the sender has no more than
+ * a round trip's worth of data, at its recent rate, left before the limit it was last given, an SM is due as soon as
+ * there is progress to report so the update arrives before the sender stalls on the limit.
+ */
+static bool aeron_publication_image_is_adaptive_sm_due(
+    aeron_publication_image_t *image, int64_t now_ns, int64_t min_sub_pos, int64_t hwm_position, int32_t window_length)
+{
+    const int64_t sample_elapsed_ns = now_ns - image->sm_rate_sample_ns;
 
-    if (image->loss_reporter_offset >= 0)
+    if (sample_elapsed_ns >= AERON_PUBLICATION_IMAGE_SM_RATE_SAMPLE_INTERVAL_NS)
     {
-        const int64_t now_ms = aeron_clock_cached_epoch_time(image->cached_clock);
-        aeron_loss_reporter_record_observation(
-            image->loss_reporter, image->loss_reporter_offset, (int64_t)length, now_ms);
+        const int64_t rate = (int64_t)(
+            (double)(hwm_position - image->sm_rate_sample_position) * 1e9 / (double)sample_elapsed_ns);
+
+        image->hwm_rate_bytes_per_sec = 0 == image->hwm_rate_bytes_per_sec ?
+            rate :
+            image->hwm_rate_bytes_per_sec +
+                ((rate - image->hwm_rate_bytes_per_sec) >> AERON_PUBLICATION_IMAGE_NAK_RTT_SMOOTHING_SHIFT);
+        image->sm_rate_sample_ns = now_ns;
+        image->sm_rate_sample_position = hwm_position;
     }
-    else if (NULL != image->loss_reporter)
+
+    if (min_sub_pos <= image->next_sm_position)
     {
-        if (NULL != image->endpoint)
+        return false;
+    }
+
+    int64_t rtt_ns;
+    AERON_GET_VOLATILE(rtt_ns, image->nak_rtt_ns);
+    rtt_ns = rtt_ns > 0 ? rtt_ns : AERON_PUBLICATION_IMAGE_SM_ADAPTIVE_DEFAULT_RTT_NS;
+
+    const int64_t round_trip_length = (int64_t)((double)image->hwm_rate_bytes_per_sec * (double)rtt_ns / 1e9);
+    const int64_t min_lead_length = window_length / 4;
+    const int64_t lead_length = round_trip_length > min_lead_length ? round_trip_length : min_lead_length;
+    const int64_t sender_limit = image->next_sm_position + image->next_sm_receiver_window_length;
+
+    return (sender_limit - hwm_position) <= lead_length || min_sub_pos > (image->next_sm_position + (window_length / 2));
+}
+
+/*
+ * For a while after the receiver last dropped frames over the rate limit the receiver window is held to the burst so
+ * the sender is back-pressured down towards the limit, forcing an SM whenever the window is reduced or restored.
+ */
+static int32_t aeron_publication_image_rate_limit_window_length(
+    aeron_publication_image_t *image, int64_t now_ns, int32_t window_length, bool *should_force_send_sm)
+{
+    int64_t time_of_last_rate_limit_ns;
+    AERON_GET_VOLATILE(time_of_last_rate_limit_ns, image->time_of_last_rate_limit_ns);
+
+    const bool is_limited = INT64_MIN != time_of_last_rate_limit_ns &&
+        now_ns - time_of_last_rate_limit_ns < AERON_PUBLICATION_IMAGE_RATE_LIMIT_HOLD_NS;
+
+    if (is_limited != image->is_rate_limit_window_applied)
+    {
+        image->is_rate_limit_window_applied = is_limited;
+        *should_force_send_sm = true;
+
+        if (is_limited)
         {
-            char source[AERON_MAX_PATH];
-            int source_length = aeron_format_source_identity(source, sizeof(source), &image->source_address);
+            aeron_system_counter_add(image->rate_limited_images_counter, 1, image->has_shared_counters);
+        }
+    }
 
-            image->loss_reporter_offset = aeron_loss_reporter_create_entry(
-                image->loss_reporter,
-                (int64_t)length,
-                aeron_clock_cached_epoch_time(image->cached_clock),
-                image->session_id,
-                image->stream_id,
-                image->endpoint->conductor_fields.udp_channel->original_uri,
-                image->endpoint->conductor_fields.udp_channel->uri_length,
-                source,
-                (size_t)source_length);
+    return is_limited && image->rate_limit_burst_bytes < window_length ?
+        (int32_t)image->rate_limit_burst_bytes : window_length;
+}
+
+/*
+ * Follows the first gap from detection until rebuild moves past it to report its length, how long it took to fill and
+ * whether it was filled by a retransmit, before any NAK went out, or with padding on an unreliable image.
+ */
+static void aeron_publication_image_track_gap_repair(
+    aeron_publication_image_t *image, int64_t now_ns, int64_t new_rebuild_position, bool loss_found)
+{
+    if (image->tracked_gap_position >= 0 && new_rebuild_position > image->tracked_gap_position)
+    {
+        aeron_loss_reporter_repair_t repair = AERON_LOSS_REPORTER_REPAIR_UNSOLICITED;
+        if (image->is_tracked_gap_naked)
+        {
+            repair = image->conductor_fields.is_reliable ?
+                AERON_LOSS_REPORTER_REPAIR_RETRANSMIT : AERON_LOSS_REPORTER_REPAIR_TIMEOUT;
         }
 
-        if (-1 == image->loss_reporter_offset)
+        if (NULL != image->loss_reporter)
         {
-            image->loss_reporter = NULL;
+            aeron_loss_reporter_record_repair(
+                image->loss_reporter,
+                image->loss_reporter_offset,
+                repair,
+                image->tracked_gap_length,
+                now_ns - image->tracked_gap_detected_ns);
         }
+
+        image->tracked_gap_position = -1;
+    }
+
+    if (loss_found)
+    {
+        const aeron_loss_detector_gap_t *gap = &image->loss_detector.active_gap;
+
+        image->tracked_gap_position = aeron_logbuffer_compute_position(
+            gap->term_id, gap->term_offset, image->position_bits_to_shift, image->initial_term_id);
+        image->tracked_gap_length = (int64_t)gap->length;
+        image->tracked_gap_detected_ns = now_ns;
+        image->is_tracked_gap_naked = image->last_nak_gap_position == image->tracked_gap_position;
+    }
+}
+
+static inline void aeron_publication_image_record_delivery_latency(
+    aeron_publication_image_t *image, int64_t now_ns, int64_t min_sub_pos)
+{
+    int64_t sample_position;
+    AERON_GET_VOLATILE(sample_position, image->delivery_latency_sample_position);
+
+    if (AERON_NULL_VALUE != sample_position && min_sub_pos >= sample_position)
+    {
+        aeron_stream_latency_histogram_record(
+            &image->delivery_latency_histogram, now_ns - image->delivery_latency_sample_ns);
+        AERON_PUT_ORDERED(image->delivery_latency_sample_position, AERON_NULL_VALUE);
     }
 }
 
@@ -354,29 +655,77 @@ void aeron_publication_image_track_rebuild(
             }
         }
 
+        if (image->is_delivery_latency_tracked && INT64_MAX != min_sub_pos)
+        {
+            aeron_publication_image_record_delivery_latency(image, now_ns, min_sub_pos);
+        }
+
         const int64_t rebuild_position = *image->rcv_pos_position.value_addr > max_sub_pos ?
             *image->rcv_pos_position.value_addr : max_sub_pos;
 
+        if (image->is_nak_rtt_adaptive)
+        {
+            int64_t nak_rtt_ns;
+            AERON_GET_VOLATILE(nak_rtt_ns, image->nak_rtt_ns);
+
+            if (nak_rtt_ns > 0 && nak_rtt_ns != image->nak_delay_rtt_ns)
+            {
+                aeron_feedback_delay_state_set_delay(
+                    &image->nak_delay_state, aeron_loss_detector_nak_rtt_delay_ns(nak_rtt_ns));
+                image->nak_delay_rtt_ns = nak_rtt_ns;
+            }
+        }
+
         bool loss_found = false;
-        const size_t index = aeron_logbuffer_index_by_position(rebuild_position, image->position_bits_to_shift);
-        const int32_t rebuild_offset = aeron_loss_detector_scan(
-            &image->loss_detector,
-            &loss_found,
-            image->mapped_raw_log.term_buffers[index].addr,
-            rebuild_position,
-            hwm_position,
-            now_ns,
-            (size_t)image->term_length_mask,
-            image->position_bits_to_shift,
-            image->initial_term_id);
+        int64_t new_rebuild_position;
+        int64_t in_order_position;
+        AERON_GET_VOLATILE(in_order_position, image->in_order_position);
 
-        const int32_t rebuild_term_offset = (int32_t)(rebuild_position & image->term_length_mask);
-        const int64_t new_rebuild_position = (rebuild_position - rebuild_term_offset) + rebuild_offset;
+        /* everything up to the hwm was inserted in order, so there is no gap to scan for */
+        if (in_order_position >= hwm_position)
+        {
+            new_rebuild_position = hwm_position > rebuild_position ? hwm_position : rebuild_position;
+        }
+        else
+        {
+            const size_t index = aeron_logbuffer_index_by_position(rebuild_position, image->position_bits_to_shift);
+            image->pending_loss_gap_count = 0;
+            const int32_t rebuild_offset = aeron_loss_detector_scan(
+                &image->loss_detector,
+                &loss_found,
+                image->mapped_raw_log.term_buffers[index].addr,
+                rebuild_position,
+                hwm_position,
+                now_ns,
+                (size_t)image->term_length_mask,
+                image->position_bits_to_shift,
+                image->initial_term_id);
+
+            /* gaps found by the same scan are published together so the receiver can NAK them in one datagram */
+            if (image->pending_loss_gap_count > 0)
+            {
+                aeron_publication_image_publish_loss(image);
+            }
+
+            const int32_t rebuild_term_offset = (int32_t)(rebuild_position & image->term_length_mask);
+            new_rebuild_position = (rebuild_position - rebuild_term_offset) + rebuild_offset;
+        }
 
         aeron_counter_propose_max_ordered(image->rcv_pos_position.value_addr, new_rebuild_position);
+        aeron_publication_image_track_gap_repair(image, now_ns, new_rebuild_position, loss_found);
+
+        /*
+         * Once gaps are repaired the in order data reaches the hwm again, but repairs land behind where the receiver
+         * expects the next frame so it is moved up here. The receiver may advance it at the same time, so only the
+         * value seen is replaced.
+         */
+        if (new_rebuild_position >= hwm_position && in_order_position < new_rebuild_position)
+        {
+            aeron_cmpxchg64(&image->in_order_position, in_order_position, new_rebuild_position);
+        }
 
         bool should_force_send_sm = false;
-        const int32_t window_length = image->congestion_control->on_track_rebuild(
+        int32_t window_length = image->congestion_control->on_track_rebuild(
             image->congestion_control->state,
             &should_force_send_sm,
             now_ns,
@@ -387,11 +736,20 @@ void aeron_publication_image_track_rebuild(
             new_rebuild_position,
             loss_found);
 
+        if (0 != image->rate_limit_bytes_per_sec)
+        {
+            window_length = aeron_publication_image_rate_limit_window_length(
+                image, now_ns, window_length, &should_force_send_sm);
+        }
+
         const int32_t threshold = window_length / 4;
+        const bool is_sm_due = image->is_sm_adaptive ?
+            aeron_publication_image_is_adaptive_sm_due(image, now_ns, min_sub_pos, hwm_position, window_length) :
+            min_sub_pos > (image->next_sm_position + threshold);
 
         if (should_force_send_sm ||
             (now_ns > (image->last_status_message_timestamp + status_message_timeout)) ||
-            (min_sub_pos > (image->next_sm_position + threshold)))
+            is_sm_due)
         {
             aeron_publication_image_clean_buffer_to(image, min_sub_pos - image->term_length);
             aeron_publication_image_schedule_status_message(image, now_ns, min_sub_pos, window_length);
@@ -406,6 +764,19 @@ void aeron_publication_image_track_rebuild(
 #define AERON_PUBLICATION_IMAGE_COND_EXPECT(exp, c) (exp)
 #endif
 
+static inline void aeron_publication_image_sample_delivery_latency(
+    aeron_publication_image_t *image, int64_t now_ns, int64_t position)
+{
+    int64_t sample_position;
+    AERON_GET_VOLATILE(sample_position, image->delivery_latency_sample_position);
+
+    if (AERON_NULL_VALUE == sample_position)
+    {
+        image->delivery_latency_sample_ns = now_ns;
+        AERON_PUT_ORDERED(image->delivery_latency_sample_position, position);
+    }
+}
+
 static inline void aeron_publication_image_track_connection(
     aeron_publication_image_t *image,
     aeron_receive_destination_t *destination,
@@ -480,18 +851,206 @@ void aeron_publication_image_add_connection_if_unknown(
         image, destination, src_addr, aeron_clock_cached_nano_time(image->cached_clock));
 }
 
-int aeron_publication_image_insert_packet(
+static inline aeron_publication_image_arrival_t *aeron_publication_image_arrival(
+    aeron_publication_image_t *image, int64_t packet_position)
+{
+    const uint64_t hash = (uint64_t)packet_position * UINT64_C(0x9E3779B97F4A7C15);
+
+    return &image->arrival_history[hash >> (64 - AERON_PUBLICATION_IMAGE_ARRIVAL_HISTORY_BITS)];
+}
+
+/*
+ * With redundant paths a frame already in the term arrived first over another destination, so this copy is dropped
+ * before the rebuilder and counted against its destination along with how long after the first copy it arrived.
+ * Arrival times are kept in a small hashed history so lag is only measured while the first arrival is still there.
+ */
+static inline bool aeron_publication_image_is_duplicate_arrival(
+    aeron_publication_image_t *image,
+    aeron_receive_destination_t *destination,
+    const uint8_t *term_frame,
+    int64_t packet_position)
+{
+    const aeron_frame_header_t *frame_header = (const aeron_frame_header_t *)term_frame;
+    const int64_t now_ns = image->nano_clock();
+    aeron_publication_image_arrival_t *arrival = aeron_publication_image_arrival(image, packet_position);
+    int32_t frame_length;
+
+    AERON_GET_VOLATILE(frame_length, frame_header->frame_length);
+    if (0 == frame_length)
+    {
+        arrival->position = packet_position;
+        arrival->time_ns = now_ns;
+        aeron_counter_ordered_increment(destination->first_arrivals_counter.value_addr, 1);
+
+        return false;
+    }
+
+    aeron_counter_ordered_increment(destination->duplicate_arrivals_counter.value_addr, 1);
+
+    if (packet_position == arrival->position)
+    {
+        const int64_t lag_ns = now_ns - arrival->time_ns;
+
+        destination->arrival_lag_ns +=
+            (lag_ns - destination->arrival_lag_ns) >> AERON_PUBLICATION_IMAGE_NAK_RTT_SMOOTHING_SHIFT;
+        aeron_counter_set_ordered(destination->arrival_lag_counter.value_addr, destination->arrival_lag_ns);
+    }
+
+    return true;
+}
+
+/*
+ * Token bucket of data bytes refilled at the image rate limit up to a burst of one burst window. A frame is accepted
+ * while any bytes are available so frames up to the MTU pass at any rate, otherwise it is dropped and counted.
+ */
+static inline bool aeron_publication_image_is_rate_limited(
+    aeron_publication_image_t *image, int64_t now_ns, size_t length)
+{
+    if (INT64_MIN == image->rate_limit_last_refill_ns ||
+        now_ns - image->rate_limit_last_refill_ns >= AERON_PUBLICATION_IMAGE_RATE_LIMIT_BURST_WINDOW_NS)
+    {
+        image->rate_limit_available_bytes = image->rate_limit_burst_bytes;
+        image->rate_limit_last_refill_ns = now_ns;
+    }
+    else
+    {
+        const int64_t refill_bytes = (int64_t)(
+            ((uint64_t)(now_ns - image->rate_limit_last_refill_ns) * image->rate_limit_bytes_per_sec) / 1000000000LL);
+
+        if (refill_bytes > 0)
+        {
+            const int64_t available_bytes = image->rate_limit_available_bytes + refill_bytes;
+
+            image->rate_limit_available_bytes = available_bytes < image->rate_limit_burst_bytes ?
+                available_bytes : image->rate_limit_burst_bytes;
+            image->rate_limit_last_refill_ns = now_ns;
+        }
+    }
+
+    if (image->rate_limit_available_bytes <= 0)
+    {
+        AERON_PUT_ORDERED(image->time_of_last_rate_limit_ns, now_ns);
+        aeron_system_counter_add(image->rate_limited_frames_counter, 1, image->has_shared_counters);
+
+        return true;
+    }
+
+    image->rate_limit_available_bytes -= (int64_t)length;
+
+    return false;
+}
+
+static inline void aeron_publication_image_insert_frame(
+    aeron_publication_image_t *image,
+    aeron_receive_destination_t *destination,
+    uint8_t *term_frame,
+    const uint8_t *buffer,
+    size_t length,
+    int64_t packet_position,
+    int64_t proposed_position,
+    bool is_payload_in_place)
+{
+    if (is_payload_in_place)
+    {
+        aeron_term_rebuilder_insert_header(term_frame, buffer);
+    }
+    else
+    {
+        aeron_term_rebuilder_insert(term_frame, buffer, length);
+    }
+    aeron_logbuffer_notify_data(image->log_meta_data);
+
+    /* the conductor may move the in order position up after a repair, so only the expected value is replaced */
+    aeron_cmpxchg64(&image->in_order_position, packet_position, proposed_position);
+
+    if (NULL != image->rcv_timestamp_counter.value_addr && 0 != destination->transport.recv_timestamp_ns)
+    {
+        aeron_counter_set_ordered(image->rcv_timestamp_counter.value_addr, destination->transport.recv_timestamp_ns);
+    }
+}
+
+/*
+ * A data frame that starts where the in order data ends and fits within the window extends the contiguous region, so
+ * it skips the heartbeat, under run and duplicate checks and, as the conductor sees the in order position reach the
+ * hwm, the loss scan.
+ */
+static inline int aeron_publication_image_insert_in_order(
+    aeron_publication_image_t *image,
+    aeron_receive_destination_t *destination,
+    int32_t term_offset,
+    const uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr,
+    int64_t packet_position,
+    bool is_payload_in_place)
+{
+    const int64_t proposed_position = packet_position + (int64_t)length;
+    const int64_t now_ns = aeron_clock_cached_nano_time(image->cached_clock);
+    const size_t index = aeron_logbuffer_index_by_position(packet_position, image->position_bits_to_shift);
+
+    aeron_publication_image_track_connection(image, destination, addr, now_ns);
+    aeron_publication_image_insert_frame(
+        image,
+        destination,
+        image->mapped_raw_log.term_buffers[index].addr + term_offset,
+        buffer,
+        length,
+        packet_position,
+        proposed_position,
+        is_payload_in_place);
+
+    if (image->is_delivery_latency_tracked)
+    {
+        aeron_publication_image_sample_delivery_latency(image, now_ns, proposed_position);
+    }
+
+    if (NULL != image->receive_batch && !is_payload_in_place)
+    {
+        if (!image->has_batched_positions)
+        {
+            image->has_batched_positions = true;
+            image->next_in_receive_batch = *image->receive_batch;
+            *image->receive_batch = image;
+        }
+
+        image->batched_time_of_last_packet_ns = now_ns;
+        image->batched_hwm_position = proposed_position;
+    }
+    else
+    {
+        AERON_PUT_ORDERED(image->time_of_last_packet_ns, now_ns);
+        aeron_counter_propose_max_ordered(image->rcv_hwm_position.value_addr, proposed_position);
+    }
+
+    return (int)length;
+}
+
+static inline int aeron_publication_image_insert(
     aeron_publication_image_t *image,
     aeron_receive_destination_t *destination,
     int32_t term_id,
     int32_t term_offset,
     const uint8_t *buffer,
     size_t length,
-    struct sockaddr_storage *addr)
+    struct sockaddr_storage *addr,
+    bool is_payload_in_place)
 {
-    const bool is_heartbeat = aeron_publication_image_is_heartbeat(buffer, length);
     const int64_t packet_position = aeron_logbuffer_compute_position(
         term_id, term_offset, image->position_bits_to_shift, image->initial_term_id);
+
+    AERON_DRIVER_TRACEPOINT5(image_insert_packet, image->session_id, image->stream_id, term_id, term_offset, length);
+
+    if (image->is_in_order_fast_path &&
+        packet_position == image->in_order_position &&
+        packet_position >= image->last_sm_position &&
+        packet_position + (int64_t)length <= image->last_sm_position_window_limit &&
+        !aeron_publication_image_is_heartbeat(buffer, length))
+    {
+        return aeron_publication_image_insert_in_order(
+            image, destination, term_offset, buffer, length, addr, packet_position, is_payload_in_place);
+    }
+
+    const bool is_heartbeat = aeron_publication_image_is_heartbeat(buffer, length);
     const int64_t proposed_position = is_heartbeat ? packet_position : packet_position + (int64_t)length;
 
     if (!aeron_publication_image_is_flow_control_over_run(image, proposed_position))
@@ -511,18 +1070,52 @@ int aeron_publication_image_insert_packet(
                     AERON_PUT_ORDERED(image->log_meta_data->end_of_stream_position, packet_position);
                 }
 
-                aeron_counter_ordered_increment(image->heartbeats_received_counter, 1);
+                aeron_system_counter_add(image->heartbeats_received_counter, 1, image->has_shared_counters);
             }
             else
             {
                 const size_t index = aeron_logbuffer_index_by_position(packet_position, image->position_bits_to_shift);
                 uint8_t *term_buffer = image->mapped_raw_log.term_buffers[index].addr;
 
-                aeron_term_rebuilder_insert(term_buffer + term_offset, buffer, length);
+                if (0 != image->rate_limit_bytes_per_sec &&
+                    aeron_publication_image_is_rate_limited(image, now_ns, length))
+                {
+                    return (int)length;
+                }
+
+                if (image->is_redundant_path_enabled && NULL != destination->first_arrivals_counter.value_addr &&
+                    aeron_publication_image_is_duplicate_arrival(
+                        image, destination, term_buffer + term_offset, packet_position))
+                {
+                    return (int)length;
+                }
+
+                aeron_publication_image_insert_frame(
+                    image,
+                    destination,
+                    term_buffer + term_offset,
+                    buffer,
+                    length,
+                    packet_position,
+                    proposed_position,
+                    is_payload_in_place);
+
+                if (image->is_delivery_latency_tracked)
+                {
+                    aeron_publication_image_sample_delivery_latency(image, now_ns, proposed_position);
+                }
             }
 
             AERON_PUT_ORDERED(image->time_of_last_packet_ns, aeron_clock_cached_nano_time(image->cached_clock));
-            aeron_counter_propose_max_ordered(image->rcv_hwm_position.value_addr, proposed_position);
+
+            if (image->is_inline_receive)
+            {
+                aeron_counter_propose_max_atomic(image->rcv_hwm_position.value_addr, proposed_position);
+            }
+            else
+            {
+                aeron_counter_propose_max_ordered(image->rcv_hwm_position.value_addr, proposed_position);
+            }
         }
         else if (proposed_position >= (image->last_sm_position - image->next_sm_receiver_window_length))
         {
@@ -533,6 +1126,115 @@ int aeron_publication_image_insert_packet(
     return (int)length;
 }
 
+/*
+ * Marked frames get a receive record timed before they were inserted and a rebuild record timed once they are in the
+ * term, so the cost of the insert shows up as a hop of its own.
+ */
+static void aeron_publication_image_trace_insert(
+    aeron_publication_image_t *image, const uint8_t *buffer, size_t length, int64_t receive_ns)
+{
+    aeron_trace_ring_record_frames(image->trace_ring, AERON_TRACE_EVENT_RECEIVE, receive_ns, buffer, length);
+    aeron_trace_ring_record_frames(image->trace_ring, AERON_TRACE_EVENT_REBUILD, aeron_nano_clock(), buffer, length);
+}
+
+int aeron_publication_image_insert_packet(
+    aeron_publication_image_t *image,
+    aeron_receive_destination_t *destination,
+    int32_t term_id,
+    int32_t term_offset,
+    const uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr)
+{
+    const uint64_t start_ticks = image->is_rcv_cpu_tracked ? aeron_tsc_ticks() : 0;
+    const int64_t receive_ns = NULL != image->trace_ring ? aeron_nano_clock() : 0;
+    const int result = aeron_publication_image_insert(
+        image, destination, term_id, term_offset, buffer, length, addr, false);
+
+    if (NULL != image->trace_ring && result > 0)
+    {
+        aeron_publication_image_trace_insert(image, buffer, length, receive_ns);
+    }
+
+    if (image->is_rcv_cpu_tracked)
+    {
+        aeron_stream_cpu_counters_record(&image->rcv_cpu_counters, AERON_STREAM_CPU_RECEIVER_REBUILD, start_ticks);
+    }
+
+    return result;
+}
+
+int aeron_publication_image_insert_packet_in_place(
+    aeron_publication_image_t *image,
+    aeron_receive_destination_t *destination,
+    const uint8_t *header,
+    size_t length,
+    struct sockaddr_storage *addr)
+{
+    const uint64_t start_ticks = image->is_rcv_cpu_tracked ? aeron_tsc_ticks() : 0;
+    const int64_t receive_ns = NULL != image->trace_ring ? aeron_nano_clock() : 0;
+    const aeron_data_header_t *data_header = (const aeron_data_header_t *)header;
+
+    const int result = aeron_publication_image_insert(
+        image, destination, data_header->term_id, data_header->term_offset, header, length, addr, true);
+
+    if (NULL != image->trace_ring && result > 0)
+    {
+        aeron_publication_image_trace_insert(image, header, length, receive_ns);
+    }
+
+    if (image->is_rcv_cpu_tracked)
+    {
+        aeron_stream_cpu_counters_record(&image->rcv_cpu_counters, AERON_STREAM_CPU_RECEIVER_REBUILD, start_ticks);
+    }
+
+    return result;
+}
+
+void aeron_publication_image_enable_inline_receive(aeron_publication_image_t *image)
+{
+    AERON_PUT_ORDERED(image->is_in_order_fast_path, false);
+    AERON_PUT_ORDERED(image->is_inline_receive, true);
+}
+
+void aeron_publication_image_flush_receive_batch(aeron_publication_image_t *image)
+{
+    image->has_batched_positions = false;
+    image->next_in_receive_batch = NULL;
+    AERON_PUT_ORDERED(image->time_of_last_packet_ns, image->batched_time_of_last_packet_ns);
+
+    if (image->is_inline_receive)
+    {
+        aeron_counter_propose_max_atomic(image->rcv_hwm_position.value_addr, image->batched_hwm_position);
+    }
+    else
+    {
+        aeron_counter_propose_max_ordered(image->rcv_hwm_position.value_addr, image->batched_hwm_position);
+    }
+}
+
+void aeron_publication_image_track_inline_receive(aeron_publication_image_t *image, int64_t now_ns)
+{
+    const int64_t hwm_position = aeron_counter_get_volatile(image->rcv_hwm_position.value_addr);
+
+    if (hwm_position > image->inline_receive_hwm_position)
+    {
+        image->inline_receive_hwm_position = hwm_position;
+        AERON_PUT_ORDERED(image->time_of_last_packet_ns, now_ns);
+
+        for (size_t i = 0, len = image->connections.length; i < len; i++)
+        {
+            aeron_publication_image_connection_t *connection = &image->connections.array[i];
+
+            if (NULL != connection->control_addr)
+            {
+                connection->time_of_last_activity_ns = now_ns;
+                connection->time_of_last_frame_ns = now_ns;
+            }
+        }
+    }
+}
+
 int aeron_publication_image_on_rttm(
     aeron_publication_image_t *image, aeron_rttm_header_t *header, struct sockaddr_storage *addr)
 {
@@ -541,6 +1243,15 @@ int aeron_publication_image_on_rttm(
 
     image->congestion_control->on_rttm(image->congestion_control->state, now_ns, rtt_in_ns, addr);
 
+    if ((image->is_nak_rtt_adaptive || image->is_sm_adaptive) && rtt_in_ns > 0)
+    {
+        const int64_t smoothed_rtt_ns = 0 == image->nak_rtt_ns ?
+            rtt_in_ns :
+            image->nak_rtt_ns + ((rtt_in_ns - image->nak_rtt_ns) >> AERON_PUBLICATION_IMAGE_NAK_RTT_SMOOTHING_SHIFT);
+
+        AERON_PUT_ORDERED(image->nak_rtt_ns, smoothed_rtt_ns);
+    }
+
     return 1;
 }
 
@@ -555,6 +1266,7 @@ int aeron_publication_image_send_pending_status_message(aeron_publication_image_
 
         if (change_number != image->last_sm_change_number)
         {
+            const uint64_t start_ticks = image->is_rcv_cpu_tracked ? aeron_tsc_ticks() : 0;
             const int64_t sm_position = image->next_sm_position;
             const int32_t receiver_window_length = image->next_sm_receiver_window_length;
 
@@ -573,7 +1285,7 @@ int aeron_publication_image_send_pending_status_message(aeron_publication_image_
 
                     if (aeron_publication_image_connection_is_alive(connection, now_ns))
                     {
-                        int send_sm_result = aeron_receive_channel_endpoint_send_sm(
+                        int send_sm_result = aeron_receive_channel_endpoint_queue_sm(
                             image->endpoint,
                             connection->control_addr,
                             image->stream_id,
@@ -590,7 +1302,7 @@ int aeron_publication_image_send_pending_status_message(aeron_publication_image_
                         }
 
                         work_count++;
-                        aeron_counter_ordered_increment(image->status_messages_sent_counter, 1);
+                        aeron_system_counter_add(image->status_messages_sent_counter, 1, image->has_shared_counters);
                     }
                 }
 
@@ -599,6 +1311,12 @@ int aeron_publication_image_send_pending_status_message(aeron_publication_image_
                 image->last_sm_position_window_limit = sm_position + receiver_window_length;
 
                 aeron_update_active_transport_count(image, now_ns);
+
+                if (image->is_rcv_cpu_tracked)
+                {
+                    aeron_stream_cpu_counters_record(
+                        &image->rcv_cpu_counters, AERON_STREAM_CPU_RECEIVER_STATUS_MESSAGE, start_ticks);
+                }
             }
         }
     }
@@ -617,9 +1335,12 @@ int aeron_publication_image_send_pending_loss(aeron_publication_image_t *image)
 
         if (change_number != image->last_loss_change_number)
         {
-            const int32_t term_id = image->loss_term_id;
-            const int32_t term_offset = image->loss_term_offset;
-            const int32_t length = (int32_t)image->loss_length;
+            const uint64_t start_ticks = image->is_rcv_cpu_tracked ? aeron_tsc_ticks() : 0;
+            aeron_loss_detector_gap_t gaps[AERON_LOSS_DETECTOR_MAX_GAPS];
+            const size_t gap_count = image->loss_gap_count <= AERON_LOSS_DETECTOR_MAX_GAPS ?
+                image->loss_gap_count : AERON_LOSS_DETECTOR_MAX_GAPS;
+
+            memcpy(gaps, image->loss_gaps, gap_count * sizeof(aeron_loss_detector_gap_t));
 
             aeron_acquire();
 
@@ -635,14 +1356,13 @@ int aeron_publication_image_send_pending_loss(aeron_publication_image_t *image)
 
                         if (aeron_publication_image_connection_is_alive(connection, now_ns))
                         {
-                            int send_nak_result = aeron_receive_channel_endpoint_send_nak(
+                            int send_nak_result = aeron_receive_channel_endpoint_queue_naks(
                                 image->endpoint,
                                 connection->control_addr,
                                 image->stream_id,
                                 image->session_id,
-                                term_id,
-                                term_offset,
-                                length);
+                                gaps,
+                                gap_count);
 
                             if (send_nak_result < 0)
                             {
@@ -651,24 +1371,35 @@ int aeron_publication_image_send_pending_loss(aeron_publication_image_t *image)
                             }
 
                             work_count++;
-                            aeron_counter_ordered_increment(image->nak_messages_sent_counter, 1);
+                            aeron_system_counter_add(
+                                image->nak_messages_sent_counter, (int64_t)gap_count, image->has_shared_counters);
                         }
                     }
                 }
                 else
                 {
-                    const size_t index = aeron_logbuffer_index_by_term(image->initial_term_id, term_id);
-                    uint8_t *buffer = image->mapped_raw_log.term_buffers[index].addr;
-
-                    if (aeron_term_gap_filler_try_fill_gap(image->log_meta_data, buffer, term_id, term_offset, length))
+                    for (size_t i = 0; i < gap_count; i++)
                     {
-                        aeron_counter_ordered_increment(image->loss_gap_fills_counter, 1);
+                        const size_t index = aeron_logbuffer_index_by_term(image->initial_term_id, gaps[i].term_id);
+                        uint8_t *buffer = image->mapped_raw_log.term_buffers[index].addr;
+
+                        if (aeron_term_gap_filler_try_fill_gap(
+                            image->log_meta_data, buffer, gaps[i].term_id, gaps[i].term_offset, (int32_t)gaps[i].length))
+                        {
+                            aeron_system_counter_add(image->loss_gap_fills_counter, 1, image->has_shared_counters);
+                        }
                     }
 
                     work_count = 1;
                 }
 
                 image->last_loss_change_number = change_number;
+
+                if (image->is_rcv_cpu_tracked)
+                {
+                    aeron_stream_cpu_counters_record(
+                        &image->rcv_cpu_counters, AERON_STREAM_CPU_RECEIVER_NAK, start_ticks);
+                }
             }
         }
     }
@@ -682,7 +1413,16 @@ int aeron_publication_image_initiate_rttm(aeron_publication_image_t *image, int6
 
     if (NULL != image->endpoint && AERON_PUBLICATION_IMAGE_STATE_ACTIVE == image->conductor_fields.state)
     {
-        if (image->congestion_control->should_measure_rtt(image->congestion_control->state, now_ns))
+        bool should_measure_rtt = image->congestion_control->should_measure_rtt(
+            image->congestion_control->state, now_ns);
+
+        if ((image->is_nak_rtt_adaptive || image->is_sm_adaptive) && now_ns >= image->next_nak_rtt_measurement_ns)
+        {
+            image->next_nak_rtt_measurement_ns = now_ns + AERON_PUBLICATION_IMAGE_NAK_RTT_MEASUREMENT_INTERVAL_NS;
+            should_measure_rtt = true;
+        }
+
+        if (should_measure_rtt)
         {
             for (size_t i = 0, len = image->connections.length; i < len; i++)
             {
@@ -690,7 +1430,7 @@ int aeron_publication_image_initiate_rttm(aeron_publication_image_t *image, int6
 
                 if (aeron_publication_image_connection_is_alive(connection, now_ns))
                 {
-                    int send_rttm_result = aeron_receive_channel_endpoint_send_rttm(
+                    int send_rttm_result = aeron_receive_channel_endpoint_queue_rttm(
                         image->endpoint,
                         connection->control_addr,
                         image->stream_id,
@@ -761,6 +1501,12 @@ int aeron_publication_image_remove_destination(aeron_publication_image_t *image,
 void aeron_publication_image_check_untethered_subscriptions(
     aeron_driver_conductor_t *conductor, aeron_publication_image_t *image, int64_t now_ns)
 {
+    aeron_untethered_tracker_t *untethered_tracker = &image->conductor_fields.untethered_tracker;
+    if (!aeron_untethered_tracker_has_untethered(untethered_tracker, &image->conductor_fields.subscribable))
+    {
+        return;
+    }
+
     int64_t max_sub_pos = 0;
 
     for (size_t i = 0, length = image->conductor_fields.subscribable.length; i < length; i++)
@@ -777,6 +1523,12 @@ void aeron_publication_image_check_untethered_subscriptions(
     int64_t window_length = image->next_sm_receiver_window_length;
     int64_t untethered_window_limit = (max_sub_pos - window_length) + (window_length / 8);
 
+    if (aeron_untethered_tracker_is_ahead(
+        untethered_tracker, &image->conductor_fields.subscribable, untethered_window_limit, now_ns))
+    {
+        return;
+    }
+
     for (size_t i = 0, length = image->conductor_fields.subscribable.length; i < length; i++)
     {
         aeron_tetherable_position_t *tetherable_position = &image->conductor_fields.subscribable.array[i];
@@ -797,10 +1549,12 @@ void aeron_publication_image_check_untethered_subscriptions(
                     {
                         tetherable_position->time_of_last_update_ns = now_ns;
                     }
-                    else if (now_ns > (tetherable_position->time_of_last_update_ns + window_limit_timeout_ns))
+                    else if (now_ns > (aeron_untethered_tracker_time_of_last_update_ns(
+                        untethered_tracker, tetherable_position) + window_limit_timeout_ns))
                     {
                         aeron_driver_conductor_on_unavailable_image(
                             conductor,
+                            tetherable_position->subscription_client_id,
                             image->conductor_fields.managed_resource.registration_id,
                             tetherable_position->subscription_registration_id,
                             image->stream_id,
@@ -838,6 +1592,7 @@ void aeron_publication_image_check_untethered_subscriptions(
                         aeron_counter_set_ordered(tetherable_position->value_addr, *image->rcv_pos_position.value_addr);
                         aeron_driver_conductor_on_available_image(
                             conductor,
+                            tetherable_position->subscription_client_id,
                             image->conductor_fields.managed_resource.registration_id,
                             image->stream_id,
                             image->session_id,
@@ -859,6 +1614,8 @@ void aeron_publication_image_check_untethered_subscriptions(
             }
         }
     }
+
+    aeron_untethered_tracker_on_full_check(untethered_tracker, &image->conductor_fields.subscribable);
 }
 
 void aeron_publication_image_on_time_event(
@@ -885,7 +1642,7 @@ void aeron_publication_image_on_time_event(
                 image->conductor_fields.time_of_last_state_change_ns = now_ns;
 
                 aeron_driver_receiver_proxy_on_remove_publication_image(
-                    conductor->context->receiver_proxy, image->endpoint, image);
+                    image->endpoint->receiver_proxy, image->endpoint, image);
             }
             break;
         }
@@ -928,6 +1685,10 @@ extern bool aeron_publication_image_is_flow_control_under_run(
 extern bool aeron_publication_image_is_flow_control_over_run(
     aeron_publication_image_t *image, int64_t proposed_position);
 
+extern void aeron_publication_image_request_attention(aeron_publication_image_t *image);
+
+extern int64_t aeron_publication_image_in_order_position(aeron_publication_image_t *image);
+
 extern void aeron_publication_image_schedule_status_message(
     aeron_publication_image_t *image, int64_t now_ns, int64_t sm_position, int32_t window_length);
 
@@ -20,8 +20,24 @@
 #include "aeron_driver_common.h"
 #include "media/aeron_receive_channel_endpoint.h"
 #include "aeron_congestion_control.h"
+#include "concurrent/aeron_term_cleaner.h"
 #include "aeron_loss_detector.h"
+#include "aeron_min_position_tracker.h"
 #include "reports/aeron_loss_reporter.h"
+#include "aeron_stream_latency_histogram.h"
+#include "aeron_stream_cpu_counters.h"
+#include "concurrent/aeron_trace_ring.h"
+#include "concurrent/aeron_spsc_concurrent_array_queue.h"
+#include "aeron_alloc.h"
+
+#define AERON_PUBLICATION_IMAGE_NAK_RTT_MEASUREMENT_INTERVAL_NS (100 * 1000 * 1000LL)
+#define AERON_PUBLICATION_IMAGE_NAK_RTT_SMOOTHING_SHIFT (3)
+#define AERON_PUBLICATION_IMAGE_SM_RATE_SAMPLE_INTERVAL_NS (1000 * 1000LL)
+#define AERON_PUBLICATION_IMAGE_SM_ADAPTIVE_DEFAULT_RTT_NS (100 * 1000LL)
+#define AERON_PUBLICATION_IMAGE_RATE_LIMIT_BURST_WINDOW_NS (10 * 1000 * 1000LL)
+#define AERON_PUBLICATION_IMAGE_RATE_LIMIT_HOLD_NS (100 * 1000 * 1000LL)
+#define AERON_PUBLICATION_IMAGE_ARRIVAL_HISTORY_BITS (8)
+#define AERON_PUBLICATION_IMAGE_ARRIVAL_HISTORY_LENGTH (1 << AERON_PUBLICATION_IMAGE_ARRIVAL_HISTORY_BITS)
 
 typedef enum aeron_publication_image_state_enum
 {
@@ -43,6 +59,13 @@ typedef struct aeron_publication_image_connection_stct
 }
 aeron_publication_image_connection_t;
 
+typedef struct aeron_publication_image_arrival_stct
+{
+    int64_t position;
+    int64_t time_ns;
+}
+aeron_publication_image_arrival_t;
+
 typedef struct aeron_publication_image_stct
 {
     uint8_t padding_before[AERON_CACHE_LINE_LENGTH];
@@ -53,37 +76,63 @@ typedef struct aeron_publication_image_stct
         aeron_publication_image_state_t state;
         aeron_driver_managed_resource_t managed_resource;
         aeron_subscribable_t subscribable;
+        aeron_untethered_tracker_t untethered_tracker;
         int64_t time_of_last_state_change_ns;
         int64_t liveness_timeout_ns;
         int64_t clean_position;
+        aeron_allocator_t *allocator;
     }
     conductor_fields;
 
-    uint8_t padding_after[AERON_CACHE_LINE_LENGTH];
+    /* written by the conductor as it rebuilds, including the SM and loss state handed to the receiver */
+    aeron_loss_detector_t loss_detector;
+    aeron_feedback_delay_generator_state_t nak_delay_state;
+    int64_t nak_delay_rtt_ns;
 
-    struct image_connection_entries
-    {
-        size_t length;
-        size_t capacity;
-        aeron_publication_image_connection_t *array;
-    }
-    connections;
+    aeron_loss_reporter_entry_offset_t loss_reporter_offset;
+    int64_t tracked_gap_position;
+    int64_t tracked_gap_length;
+    int64_t tracked_gap_detected_ns;
+    int64_t last_nak_gap_position;
+    bool is_tracked_gap_naked;
+
+    volatile int64_t begin_loss_change;
+    volatile int64_t end_loss_change;
+    size_t loss_gap_count;
+    aeron_loss_detector_gap_t loss_gaps[AERON_LOSS_DETECTOR_MAX_GAPS];
+    size_t pending_loss_gap_count;
+    aeron_loss_detector_gap_t pending_loss_gaps[AERON_LOSS_DETECTOR_MAX_GAPS];
+
+    volatile int64_t begin_sm_change;
+    volatile int64_t end_sm_change;
+    int64_t next_sm_position;
+    int32_t next_sm_receiver_window_length;
+    int64_t last_status_message_timestamp;
+
+    int64_t sm_rate_sample_ns;
+    int64_t sm_rate_sample_position;
+    int64_t hwm_rate_bytes_per_sec;
+    bool is_rate_limit_window_applied;
+
+    volatile int32_t needs_attention;
 
+    uint8_t padding_after[AERON_CACHE_LINE_LENGTH];
+
+    /* set when the image is created and only read after */
     struct sockaddr_storage source_address;
-    aeron_loss_detector_t loss_detector;
+    bool is_nak_rtt_adaptive;
 
     aeron_mapped_raw_log_t mapped_raw_log;
     aeron_position_t rcv_hwm_position;
     aeron_position_t rcv_pos_position;
+    aeron_atomic_counter_t rcv_timestamp_counter;
     aeron_logbuffer_metadata_t *log_meta_data;
 
     aeron_receive_channel_endpoint_t *endpoint;
     aeron_congestion_control_strategy_t *congestion_control;
     aeron_clock_func_t nano_clock;
     aeron_clock_cache_t *cached_clock;
-
     aeron_loss_reporter_t *loss_reporter;
-    aeron_loss_reporter_entry_offset_t loss_reporter_offset;
 
     char *log_file_name;
     int32_t session_id;
@@ -97,35 +146,78 @@ typedef struct aeron_publication_image_stct
     size_t log_file_name_length;
     size_t position_bits_to_shift;
     aeron_map_raw_log_close_func_t map_raw_log_close_func;
+    aeron_log_buffer_pool_t *log_buffer_pool;
+    aeron_driver_housekeeper_t *housekeeper;
+    aeron_term_cleaner_t term_cleaner;
     aeron_untethered_subscription_state_change_func_t untethered_subscription_state_change_func;
 
-    volatile int64_t begin_loss_change;
-    volatile int64_t end_loss_change;
-    int32_t loss_term_id;
-    int32_t loss_term_offset;
-    size_t loss_length;
+    bool is_sm_adaptive;
+    uint64_t rate_limit_bytes_per_sec;
+    int64_t rate_limit_burst_bytes;
+    aeron_spsc_concurrent_array_queue_t *attention_queue;
+    bool is_in_order_fast_path;
+    volatile bool is_inline_receive;
+    bool is_delivery_latency_tracked;
+    aeron_stream_latency_histogram_t delivery_latency_histogram;
+    bool is_rcv_cpu_tracked;
+    aeron_stream_cpu_counters_t rcv_cpu_counters;
+    aeron_trace_ring_t *trace_ring;
+    bool is_redundant_path_enabled;
+    bool has_shared_counters;
 
-    volatile int64_t begin_sm_change;
-    volatile int64_t end_sm_change;
-    int64_t next_sm_position;
-    int32_t next_sm_receiver_window_length;
-    int64_t last_status_message_timestamp;
+    int64_t *heartbeats_received_counter;
+    int64_t *flow_control_under_runs_counter;
+    int64_t *flow_control_over_runs_counter;
+    int64_t *status_messages_sent_counter;
+    int64_t *nak_messages_sent_counter;
+    int64_t *loss_gap_fills_counter;
+    int64_t *rate_limited_frames_counter;
+    int64_t *rate_limited_images_counter;
+
+    uint8_t receiver_fields_pre_padding[2 * AERON_CACHE_LINE_LENGTH];
+
+    /* written by the receiver as frames arrive and SMs and NAKs are sent */
+    struct image_connection_entries
+    {
+        size_t length;
+        size_t capacity;
+        aeron_publication_image_connection_t *array;
+    }
+    connections;
 
     int64_t time_of_last_packet_ns;
+    volatile int64_t in_order_position;
+    bool is_end_of_stream;
+    int64_t inline_receive_hwm_position;
+
+    /*
+     * In order frames from a receive batch only publish the hwm and time of last packet once the batch is flushed. The
+     * image joins the receiver's list of batched images with its first such frame of the batch.
+     */
+    struct aeron_publication_image_stct **receive_batch;
+    struct aeron_publication_image_stct *next_in_receive_batch;
+    bool has_batched_positions;
+    int64_t batched_hwm_position;
+    int64_t batched_time_of_last_packet_ns;
+
+    int64_t next_nak_rtt_measurement_ns;
+    volatile int64_t nak_rtt_ns;
+
+    int64_t rate_limit_available_bytes;
+    int64_t rate_limit_last_refill_ns;
+    volatile int64_t time_of_last_rate_limit_ns;
+
+    /* one arrival at a time is handed from the Receiver to the Conductor to time until subscribers pass it */
+    volatile int64_t delivery_latency_sample_position;
+    volatile int64_t delivery_latency_sample_ns;
+    aeron_publication_image_arrival_t arrival_history[AERON_PUBLICATION_IMAGE_ARRIVAL_HISTORY_LENGTH];
 
     int64_t last_sm_change_number;
     int64_t last_sm_position;
     int64_t last_sm_position_window_limit;
     int64_t last_loss_change_number;
 
-    bool is_end_of_stream;
-
-    int64_t *heartbeats_received_counter;
-    int64_t *flow_control_under_runs_counter;
-    int64_t *flow_control_over_runs_counter;
-    int64_t *status_messages_sent_counter;
-    int64_t *nak_messages_sent_counter;
-    int64_t *loss_gap_fills_counter;
+    uint8_t receiver_fields_post_padding[2 * AERON_CACHE_LINE_LENGTH];
 }
 aeron_publication_image_t;
 
@@ -134,6 +226,7 @@ int aeron_publication_image_create(
     aeron_receive_channel_endpoint_t *endpoint,
     aeron_receive_destination_t *destination,
     aeron_driver_context_t *context,
+    aeron_allocator_t *allocator,
     int64_t correlation_id,
     int32_t session_id,
     int32_t stream_id,
@@ -142,6 +235,9 @@ int aeron_publication_image_create(
     int32_t initial_term_offset,
     aeron_position_t *rcv_hwm_position,
     aeron_position_t *rcv_pos_position,
+    aeron_atomic_counter_t *rcv_timestamp_counter,
+    aeron_stream_latency_histogram_t *delivery_latency_histogram,
+    aeron_stream_cpu_counters_t *rcv_cpu_counters,
     aeron_congestion_control_strategy_t *congestion_control,
     struct sockaddr_storage *control_address,
     struct sockaddr_storage *source_address,
@@ -150,6 +246,8 @@ int aeron_publication_image_create(
     aeron_loss_reporter_t *loss_reporter,
     bool is_reliable,
     bool is_sparse,
+    bool is_huge_pages,
+    int32_t numa_node,
     bool treat_as_multicast,
     aeron_system_counters_t *system_counters);
 
@@ -171,6 +269,63 @@ int aeron_publication_image_insert_packet(
     size_t length,
     struct sockaddr_storage *addr);
 
+/*
+ * Insert a packet whose bytes after the header were received straight into the term at the header's term offset, so
+ * only the header is written. When the packet is not rebuilt, e.g. on flow control over run, the frame at that offset
+ * is left unpublished and the caller must clear the bytes it received there.
+ */
+int aeron_publication_image_insert_packet_in_place(
+    aeron_publication_image_t *image,
+    aeron_receive_destination_t *destination,
+    const uint8_t *header,
+    size_t length,
+    struct sockaddr_storage *addr);
+
+/*
+ * The position at which the next packet is expected when everything up to the high water mark has been received, or
+ * -1 while there are gaps to fill. Packets received in order are tracked by the receiver itself as the rebuild
+ * position only catches up on the conductor's duty cycle.
+ */
+inline int64_t aeron_publication_image_in_order_position(aeron_publication_image_t *image)
+{
+    const int64_t hwm_position = *image->rcv_hwm_position.value_addr;
+    int64_t in_order_position;
+    AERON_GET_VOLATILE(in_order_position, image->in_order_position);
+
+    if (hwm_position != in_order_position)
+    {
+        int64_t rebuild_position;
+        AERON_GET_VOLATILE(rebuild_position, *image->rcv_pos_position.value_addr);
+
+        if (hwm_position != rebuild_position)
+        {
+            return -1;
+        }
+
+        aeron_cmpxchg64(&image->in_order_position, in_order_position, hwm_position);
+    }
+
+    return 0 == (hwm_position & (AERON_LOGBUFFER_FRAME_ALIGNMENT - 1)) ? hwm_position : -1;
+}
+
+/*
+ * Data frames for the image are received and rebuilt by an inline subscriber, which advances the hwm alongside the
+ * receiver. Set by the conductor before the image has frames for the subscriber, so possibly after the receiver has it.
+ */
+void aeron_publication_image_enable_inline_receive(aeron_publication_image_t *image);
+
+/*
+ * Frames rebuilt by an inline subscriber never reach the receiver, so it keeps the image and its connections alive
+ * while the hwm advances.
+ */
+void aeron_publication_image_track_inline_receive(aeron_publication_image_t *image, int64_t now_ns);
+
+/*
+ * Publishes the hwm and time of last packet held back while in order frames of a receive batch were inserted and takes
+ * the image off the batch. Called by the receiver once all the datagrams of a batch have been dispatched.
+ */
+void aeron_publication_image_flush_receive_batch(aeron_publication_image_t *image);
+
 int aeron_publication_image_on_rttm(
     aeron_publication_image_t *image, aeron_rttm_header_t *header, struct sockaddr_storage *addr);
 
@@ -206,7 +361,7 @@ inline bool aeron_publication_image_is_flow_control_under_run(aeron_publication_
 
     if (is_flow_control_under_run)
     {
-        aeron_counter_ordered_increment(image->flow_control_under_runs_counter, 1);
+        aeron_system_counter_add(image->flow_control_under_runs_counter, 1, image->has_shared_counters);
     }
 
     return is_flow_control_under_run;
@@ -218,12 +373,26 @@ inline bool aeron_publication_image_is_flow_control_over_run(aeron_publication_i
 
     if (is_flow_control_over_run)
     {
-        aeron_counter_ordered_increment(image->flow_control_over_runs_counter, 1);
+        aeron_system_counter_add(image->flow_control_over_runs_counter, 1, image->has_shared_counters);
     }
 
     return is_flow_control_over_run;
 }
 
+/*
+ * Queue the image for the receiver to send its pending SM or NAK. It is queued at most once until the receiver has
+ * processed it, and if the queue is full the receiver's periodic scan of all images picks it up.
+ */
+inline void aeron_publication_image_request_attention(aeron_publication_image_t *image)
+{
+    if (NULL != image->attention_queue &&
+        AERON_PUBLICATION_IMAGE_STATE_ACTIVE == image->conductor_fields.state &&
+        aeron_cmpxchg32(&image->needs_attention, 0, 1))
+    {
+        aeron_spsc_concurrent_array_queue_offer(image->attention_queue, image);
+    }
+}
+
 inline void aeron_publication_image_schedule_status_message(
     aeron_publication_image_t *image, int64_t now_ns, int64_t sm_position, int32_t window_length)
 {
@@ -237,6 +406,7 @@ inline void aeron_publication_image_schedule_status_message(
     AERON_PUT_ORDERED(image->end_sm_change, change_number);
 
     image->last_status_message_timestamp = now_ns;
+    aeron_publication_image_request_attention(image);
 }
 
 inline bool aeron_publication_image_is_drained(aeron_publication_image_t *image)
@@ -0,0 +1,316 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _BSD_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <stdlib.h>
+#include <errno.h>
+#include <inttypes.h>
+#include "protocol/aeron_udp_protocol.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+#include "util/aeron_arrayutil.h"
+#include "util/aeron_error.h"
+#include "aeron_flow_control.h"
+#include "aeron_alloc.h"
+#include "aeron_driver_context.h"
+#include "media/aeron_udp_channel.h"
+
+#define AERON_QUORUM_FLOW_CONTROL_PERCENTILE_DEFAULT (100)
+
+typedef struct aeron_quorum_flow_control_strategy_receiver_stct
+{
+    uint8_t padding_before[AERON_CACHE_LINE_LENGTH];
+    int64_t last_position;
+    int64_t last_position_plus_window;
+    int64_t time_of_last_status_message_ns;
+    int64_t receiver_id;
+    uint8_t padding_after[AERON_CACHE_LINE_LENGTH];
+}
+aeron_quorum_flow_control_strategy_receiver_t;
+
+typedef struct aeron_quorum_flow_control_strategy_state_stct
+{
+    struct quorum_receiver_stct
+    {
+        size_t length;
+        size_t capacity;
+        aeron_quorum_flow_control_strategy_receiver_t *array;
+    }
+    receivers;
+
+    struct quorum_limits_stct
+    {
+        size_t capacity;
+        int64_t *array;
+    }
+    limits;
+
+    int64_t receiver_timeout_ns;
+    int32_t group_min_size;
+    bool is_percentile;
+    int32_t quorum;
+    uint64_t max_lag;
+}
+aeron_quorum_flow_control_strategy_state_t;
+
+static void aeron_quorum_flow_control_strategy_state_set_length(
+    aeron_quorum_flow_control_strategy_state_t *state, size_t length)
+{
+    AERON_PUT_VOLATILE(state->receivers.length, length);
+}
+
+static size_t aeron_quorum_flow_control_strategy_state_get_length(aeron_quorum_flow_control_strategy_state_t *state)
+{
+    size_t length;
+    AERON_GET_VOLATILE(length, state->receivers.length);
+    return length;
+}
+
+static int aeron_quorum_flow_control_compare_limits_descending(const void *a, const void *b)
+{
+    const int64_t limit_a = *(const int64_t *)a;
+    const int64_t limit_b = *(const int64_t *)b;
+
+    return limit_a > limit_b ? -1 : (limit_a < limit_b ? 1 : 0);
+}
+
+/*
+ * The limit is the window edge of the k-th fastest receiver among those within max_lag of the leading receiver, so
+ * the slowest receivers outside the quorum no longer hold back the group and have to catch up via retransmits.
+ */
+static int64_t aeron_quorum_flow_control_strategy_quorum_limit(
+    aeron_quorum_flow_control_strategy_state_t *strategy_state, int64_t snd_lmt)
+{
+    const size_t receivers_length = strategy_state->receivers.length;
+
+    if (strategy_state->limits.capacity < receivers_length)
+    {
+        if (aeron_reallocf((void **)&strategy_state->limits.array, receivers_length * sizeof(int64_t)) < 0)
+        {
+            strategy_state->limits.capacity = 0;
+            return snd_lmt;
+        }
+
+        strategy_state->limits.capacity = receivers_length;
+    }
+
+    int64_t max_position = INT64_MIN;
+    for (size_t i = 0; i < receivers_length; i++)
+    {
+        const int64_t position = strategy_state->receivers.array[i].last_position;
+        max_position = position > max_position ? position : max_position;
+    }
+
+    size_t count = 0;
+    for (size_t i = 0; i < receivers_length; i++)
+    {
+        aeron_quorum_flow_control_strategy_receiver_t *receiver = &strategy_state->receivers.array[i];
+        const uint64_t lag = (uint64_t)(max_position - receiver->last_position);
+
+        if (0 == strategy_state->max_lag || lag <= strategy_state->max_lag)
+        {
+            strategy_state->limits.array[count++] = receiver->last_position_plus_window;
+        }
+    }
+
+    size_t k = strategy_state->is_percentile ?
+        ((count * (size_t)strategy_state->quorum) + 99) / 100 : (size_t)strategy_state->quorum;
+    k = k > count ? count : k;
+    k = k < 1 ? 1 : k;
+
+    qsort(strategy_state->limits.array, count, sizeof(int64_t), aeron_quorum_flow_control_compare_limits_descending);
+
+    return strategy_state->limits.array[k - 1];
+}
+
+int64_t aeron_quorum_flow_control_strategy_on_idle(
+    void *state,
+    int64_t now_ns,
+    int64_t snd_lmt,
+    int64_t snd_pos,
+    bool is_end_of_stream)
+{
+    aeron_quorum_flow_control_strategy_state_t *strategy_state = (aeron_quorum_flow_control_strategy_state_t *)state;
+
+    for (int last_index = (int)strategy_state->receivers.length - 1, i = last_index; i >= 0; i--)
+    {
+        aeron_quorum_flow_control_strategy_receiver_t *receiver = &strategy_state->receivers.array[i];
+
+        if ((receiver->time_of_last_status_message_ns + strategy_state->receiver_timeout_ns) - now_ns < 0)
+        {
+            aeron_array_fast_unordered_remove(
+                (uint8_t *)strategy_state->receivers.array,
+                sizeof(aeron_quorum_flow_control_strategy_receiver_t),
+                (size_t)i,
+                (size_t)last_index);
+            last_index--;
+            aeron_quorum_flow_control_strategy_state_set_length(strategy_state, strategy_state->receivers.length - 1);
+        }
+    }
+
+    return strategy_state->receivers.length < (size_t)strategy_state->group_min_size ||
+        strategy_state->receivers.length == 0 ? snd_lmt :
+        aeron_quorum_flow_control_strategy_quorum_limit(strategy_state, snd_lmt);
+}
+
+int64_t aeron_quorum_flow_control_strategy_on_sm(
+    void *state,
+    const uint8_t *sm,
+    size_t length,
+    struct sockaddr_storage *recv_addr,
+    int64_t snd_lmt,
+    int32_t initial_term_id,
+    size_t position_bits_to_shift,
+    int64_t now_ns)
+{
+    aeron_quorum_flow_control_strategy_state_t *strategy_state = (aeron_quorum_flow_control_strategy_state_t *)state;
+    aeron_status_message_header_t *status_message_header = (aeron_status_message_header_t *)sm;
+
+    const int64_t position = aeron_logbuffer_compute_position(
+        status_message_header->consumption_term_id,
+        status_message_header->consumption_term_offset,
+        position_bits_to_shift,
+        initial_term_id);
+    const int64_t window_length = status_message_header->receiver_window;
+    const int64_t receiver_id = status_message_header->receiver_id;
+    bool is_existing = false;
+
+    for (size_t i = 0; i < strategy_state->receivers.length; i++)
+    {
+        aeron_quorum_flow_control_strategy_receiver_t *receiver = &strategy_state->receivers.array[i];
+
+        if (receiver_id == receiver->receiver_id)
+        {
+            receiver->last_position = position > receiver->last_position ? position : receiver->last_position;
+            receiver->last_position_plus_window = position + window_length;
+            receiver->time_of_last_status_message_ns = now_ns;
+            is_existing = true;
+            break;
+        }
+    }
+
+    if (!is_existing)
+    {
+        int ensure_capacity_result = 0;
+        AERON_ARRAY_ENSURE_CAPACITY(
+            ensure_capacity_result,
+            strategy_state->receivers,
+            aeron_quorum_flow_control_strategy_receiver_t);
+
+        if (ensure_capacity_result >= 0)
+        {
+            const size_t receivers_length = strategy_state->receivers.length;
+            aeron_quorum_flow_control_strategy_receiver_t *receiver =
+                &strategy_state->receivers.array[receivers_length];
+            aeron_quorum_flow_control_strategy_state_set_length(strategy_state, receivers_length + 1);
+
+            receiver->last_position = position;
+            receiver->last_position_plus_window = position + window_length;
+            receiver->time_of_last_status_message_ns = now_ns;
+            receiver->receiver_id = receiver_id;
+        }
+    }
+
+    if (strategy_state->receivers.length < (size_t)strategy_state->group_min_size)
+    {
+        return snd_lmt;
+    }
+    else if (strategy_state->receivers.length == 0)
+    {
+        const int64_t position_plus_window = position + window_length;
+        return snd_lmt > position_plus_window ? snd_lmt : position_plus_window;
+    }
+    else
+    {
+        const int64_t quorum_limit = aeron_quorum_flow_control_strategy_quorum_limit(strategy_state, snd_lmt);
+        return snd_lmt > quorum_limit ? snd_lmt : quorum_limit;
+    }
+}
+
+int aeron_quorum_flow_control_strategy_fini(aeron_flow_control_strategy_t *strategy)
+{
+    aeron_quorum_flow_control_strategy_state_t *strategy_state =
+        (aeron_quorum_flow_control_strategy_state_t *)strategy->state;
+
+    aeron_free(strategy_state->receivers.array);
+    aeron_free(strategy_state->limits.array);
+    aeron_free(strategy->state);
+    aeron_free(strategy);
+
+    return 0;
+}
+
+bool aeron_quorum_flow_control_strategy_has_required_receivers(aeron_flow_control_strategy_t *strategy)
+{
+    aeron_quorum_flow_control_strategy_state_t *strategy_state =
+        (aeron_quorum_flow_control_strategy_state_t *)strategy->state;
+
+    size_t receivers_length = aeron_quorum_flow_control_strategy_state_get_length(strategy_state);
+    return (size_t)strategy_state->group_min_size <= receivers_length;
+}
+
+int aeron_quorum_flow_control_strategy_supplier(
+    aeron_flow_control_strategy_t **strategy,
+    aeron_driver_context_t *context,
+    const aeron_udp_channel_t *channel,
+    int32_t stream_id,
+    int64_t registration_id,
+    int32_t initial_term_id,
+    size_t term_buffer_capacity)
+{
+    aeron_flow_control_strategy_t *_strategy;
+    aeron_flow_control_tagged_options_t options;
+
+    const char *fc_options = aeron_uri_find_param_value(&channel->uri.params.udp.additional_params, AERON_URI_FC_KEY);
+    if (aeron_flow_control_parse_tagged_options(NULL != fc_options ? strlen(fc_options) : 0, fc_options, &options) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&_strategy, sizeof(aeron_flow_control_strategy_t)) < 0 ||
+        aeron_alloc(&_strategy->state, sizeof(aeron_quorum_flow_control_strategy_state_t)) < 0)
+    {
+        return -1;
+    }
+
+    _strategy->on_idle = aeron_quorum_flow_control_strategy_on_idle;
+    _strategy->on_status_message = aeron_quorum_flow_control_strategy_on_sm;
+    _strategy->fini = aeron_quorum_flow_control_strategy_fini;
+    _strategy->has_required_receivers = aeron_quorum_flow_control_strategy_has_required_receivers;
+
+    aeron_quorum_flow_control_strategy_state_t *state = (aeron_quorum_flow_control_strategy_state_t *)_strategy->state;
+
+    state->receivers.array = NULL;
+    state->receivers.capacity = 0;
+    aeron_quorum_flow_control_strategy_state_set_length(state, 0);
+    state->limits.array = NULL;
+    state->limits.capacity = 0;
+
+    state->receiver_timeout_ns = options.timeout_ns.is_present ?
+        options.timeout_ns.value : context->flow_control.receiver_timeout_ns;
+    state->group_min_size = options.group_min_size.is_present ?
+        options.group_min_size.value : context->flow_control.group_min_size;
+    state->is_percentile = options.quorum.is_present ? options.quorum.is_percentile : true;
+    state->quorum = options.quorum.is_present ? options.quorum.value : AERON_QUORUM_FLOW_CONTROL_PERCENTILE_DEFAULT;
+    state->max_lag = options.max_lag.is_present ? options.max_lag.value : 0;
+
+    *strategy = _strategy;
+
+    return 0;
+}
@@ -36,6 +36,10 @@ int aeron_retransmit_handler_init(
     handler->invalid_packets_counter = invalid_packets_counter;
     handler->delay_timeout_ns = delay_timeout_ns;
     handler->linger_timeout_ns = linger_timeout_ns;
+    handler->unicast_repair_threshold = 0;
+    handler->sender_budget = NULL;
+    handler->retransmits_deferred_counter = NULL;
+    aeron_retransmit_budget_init(&handler->budget, 0);
 
     for (size_t i = 0; i < AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS; i++)
     {
@@ -51,6 +55,203 @@ int aeron_retransmit_handler_close(aeron_retransmit_handler_t *handler)
     return 0;
 }
 
+void aeron_retransmit_budget_init(aeron_retransmit_budget_t *budget, uint64_t rate_bytes_per_sec)
+{
+    const int64_t burst_bytes = (int64_t)((rate_bytes_per_sec * AERON_RETRANSMIT_BUDGET_BURST_WINDOW_NS) / 1000000000LL);
+
+    budget->rate_bytes_per_sec = rate_bytes_per_sec;
+    budget->burst_bytes = burst_bytes > 0 ? burst_bytes : 1;
+    budget->available_bytes = budget->burst_bytes;
+    budget->last_refill_ns = INT64_MIN;
+}
+
+int64_t aeron_retransmit_budget_wait_ns(aeron_retransmit_budget_t *budget, int64_t now_ns)
+{
+    if (0 == budget->rate_bytes_per_sec)
+    {
+        return 0;
+    }
+
+    if (INT64_MIN == budget->last_refill_ns ||
+        now_ns - budget->last_refill_ns >= AERON_RETRANSMIT_BUDGET_BURST_WINDOW_NS)
+    {
+        budget->available_bytes = budget->burst_bytes;
+        budget->last_refill_ns = now_ns;
+    }
+    else
+    {
+        const int64_t refill_bytes =
+            (int64_t)(((uint64_t)(now_ns - budget->last_refill_ns) * budget->rate_bytes_per_sec) / 1000000000LL);
+
+        if (refill_bytes > 0)
+        {
+            const int64_t available_bytes = budget->available_bytes + refill_bytes;
+
+            budget->available_bytes = available_bytes < budget->burst_bytes ? available_bytes : budget->burst_bytes;
+            budget->last_refill_ns = now_ns;
+        }
+    }
+
+    if (budget->available_bytes > 0)
+    {
+        return 0;
+    }
+
+    const double deficit_bytes = (double)(1 - budget->available_bytes);
+
+    return (int64_t)((deficit_bytes * 1000000000.0) / (double)budget->rate_bytes_per_sec) + 1;
+}
+
+void aeron_retransmit_budget_consume(aeron_retransmit_budget_t *budget, size_t length)
+{
+    if (0 != budget->rate_bytes_per_sec)
+    {
+        budget->available_bytes -= (int64_t)length;
+    }
+}
+
+void aeron_retransmit_handler_init_budget(
+    aeron_retransmit_handler_t *handler,
+    uint64_t rate_bytes_per_sec,
+    aeron_retransmit_budget_t *sender_budget,
+    int64_t *retransmits_deferred_counter)
+{
+    aeron_retransmit_budget_init(&handler->budget, rate_bytes_per_sec);
+    handler->sender_budget = sender_budget;
+    handler->retransmits_deferred_counter = retransmits_deferred_counter;
+}
+
+void aeron_retransmit_handler_init_unicast_repair(aeron_retransmit_handler_t *handler, size_t threshold)
+{
+    handler->unicast_repair_threshold = threshold < AERON_RETRANSMIT_HANDLER_MAX_UNICAST_REPAIR_ADDRS ?
+        threshold : AERON_RETRANSMIT_HANDLER_MAX_UNICAST_REPAIR_ADDRS;
+}
+
+static bool aeron_retransmit_handler_is_same_addr(const struct sockaddr_storage *a, const struct sockaddr_storage *b)
+{
+    if (a->ss_family != b->ss_family)
+    {
+        return false;
+    }
+
+    if (AF_INET6 == a->ss_family)
+    {
+        const struct sockaddr_in6 *a_in6 = (const struct sockaddr_in6 *)a;
+        const struct sockaddr_in6 *b_in6 = (const struct sockaddr_in6 *)b;
+
+        return a_in6->sin6_port == b_in6->sin6_port &&
+            0 == memcmp(&a_in6->sin6_addr, &b_in6->sin6_addr, sizeof(struct in6_addr));
+    }
+
+    const struct sockaddr_in *a_in = (const struct sockaddr_in *)a;
+    const struct sockaddr_in *b_in = (const struct sockaddr_in *)b;
+
+    return a_in->sin_port == b_in->sin_port && a_in->sin_addr.s_addr == b_in->sin_addr.s_addr;
+}
+
+static bool aeron_retransmit_handler_is_repaired_to(
+    aeron_retransmit_action_t *action, const struct sockaddr_storage *nak_addr)
+{
+    if (action->is_repair_to_channel)
+    {
+        return true;
+    }
+
+    for (size_t i = 0; i < action->repair_addr_count; i++)
+    {
+        if (NULL != nak_addr && aeron_retransmit_handler_is_same_addr(&action->repair_addrs[i], nak_addr))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void aeron_retransmit_handler_add_repair_addr(
+    aeron_retransmit_handler_t *handler, aeron_retransmit_action_t *action, const struct sockaddr_storage *nak_addr)
+{
+    if (aeron_retransmit_handler_is_repaired_to(action, nak_addr))
+    {
+        return;
+    }
+
+    if (0 == handler->unicast_repair_threshold || NULL == nak_addr ||
+        action->repair_addr_count >= handler->unicast_repair_threshold)
+    {
+        action->is_repair_to_channel = true;
+        action->repair_addr_count = 0;
+        return;
+    }
+
+    memcpy(&action->repair_addrs[action->repair_addr_count++], nak_addr, sizeof(struct sockaddr_storage));
+}
+
+static void aeron_retransmit_handler_merge_repair_addrs(
+    aeron_retransmit_handler_t *handler, aeron_retransmit_action_t *action, aeron_retransmit_action_t *other)
+{
+    if (other->is_repair_to_channel)
+    {
+        aeron_retransmit_handler_add_repair_addr(handler, action, NULL);
+        return;
+    }
+
+    for (size_t i = 0; i < other->repair_addr_count; i++)
+    {
+        aeron_retransmit_handler_add_repair_addr(handler, action, &other->repair_addrs[i]);
+    }
+}
+
+/*
+ * Resend the action unless the publication or sender retransmit budget is exhausted, in which case it stays delayed
+ * until the budget has refilled so further NAKs for the range merge into it rather than queueing more resends.
+ */
+static int aeron_retransmit_handler_resend(
+    aeron_retransmit_handler_t *handler,
+    aeron_retransmit_action_t *action,
+    int64_t now_ns,
+    aeron_retransmit_handler_resend_func_t resend,
+    void *resend_clientd)
+{
+    int64_t wait_ns = aeron_retransmit_budget_wait_ns(&handler->budget, now_ns);
+
+    if (NULL != handler->sender_budget)
+    {
+        const int64_t sender_wait_ns = aeron_retransmit_budget_wait_ns(handler->sender_budget, now_ns);
+        wait_ns = sender_wait_ns > wait_ns ? sender_wait_ns : wait_ns;
+    }
+
+    if (wait_ns > 0)
+    {
+        action->state = AERON_RETRANSMIT_ACTION_STATE_DELAYED;
+        action->expiry_ns = now_ns + wait_ns;
+
+        if (NULL != handler->retransmits_deferred_counter)
+        {
+            aeron_counter_increment(handler->retransmits_deferred_counter, 1);
+        }
+
+        return 0;
+    }
+
+    aeron_retransmit_budget_consume(&handler->budget, action->length);
+    if (NULL != handler->sender_budget)
+    {
+        aeron_retransmit_budget_consume(handler->sender_budget, action->length);
+    }
+
+    action->state = AERON_RETRANSMIT_ACTION_STATE_LINGERING;
+    action->expiry_ns = now_ns + handler->linger_timeout_ns;
+
+    return resend(
+        resend_clientd,
+        action->term_id,
+        action->term_offset,
+        action->length,
+        action->repair_addrs,
+        action->is_repair_to_channel ? 0 : action->repair_addr_count);
+}
+
 bool aeron_retransmit_handler_is_invalid(aeron_retransmit_handler_t *handler, int32_t term_offset, size_t term_length)
 {
     const bool is_invalid = (term_offset > ((int32_t)(term_length - AERON_DATA_HEADER_LENGTH))) || (term_offset < 0);
@@ -76,6 +277,135 @@ aeron_retransmit_action_t *aeron_retransmit_handler_assign_action(aeron_retransm
     return NULL;
 }
 
+static int32_t aeron_retransmit_handler_action_end(aeron_retransmit_action_t *action)
+{
+    return action->term_offset + (int32_t)action->length;
+}
+
+/*
+ * Trim the parts of a NAK range already resent by lingering actions in the same term so overlapping NAKs from many
+ * receivers do not resend the same frames again.
+ */
+static void aeron_retransmit_handler_trim_lingering(
+    aeron_retransmit_handler_t *handler,
+    int32_t term_id,
+    const struct sockaddr_storage *nak_addr,
+    int32_t *range_offset,
+    int32_t *range_end)
+{
+    bool trimmed;
+
+    do
+    {
+        trimmed = false;
+
+        for (size_t i = 0; i < AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS && *range_offset < *range_end; i++)
+        {
+            aeron_retransmit_action_t *action = &handler->retransmit_action_pool[i];
+
+            /* a unicast repair only covers the receivers it was sent to */
+            if (AERON_RETRANSMIT_ACTION_STATE_LINGERING != action->state || term_id != action->term_id ||
+                !aeron_retransmit_handler_is_repaired_to(action, nak_addr))
+            {
+                continue;
+            }
+
+            const int32_t action_end = aeron_retransmit_handler_action_end(action);
+
+            if (action->term_offset <= *range_offset && *range_offset < action_end)
+            {
+                *range_offset = action_end;
+                trimmed = true;
+            }
+            else if (action->term_offset < *range_end && *range_end <= action_end)
+            {
+                *range_end = action->term_offset;
+                trimmed = true;
+            }
+        }
+    }
+    while (trimmed && *range_offset < *range_end);
+}
+
+static aeron_retransmit_action_t *aeron_retransmit_handler_find_delayed(
+    aeron_retransmit_handler_t *handler,
+    int32_t term_id,
+    int32_t range_offset,
+    int32_t range_end,
+    aeron_retransmit_action_t *exclude)
+{
+    for (size_t i = 0; i < AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS; i++)
+    {
+        aeron_retransmit_action_t *action = &handler->retransmit_action_pool[i];
+
+        if (AERON_RETRANSMIT_ACTION_STATE_DELAYED == action->state &&
+            term_id == action->term_id &&
+            action != exclude &&
+            action->term_offset <= range_end &&
+            range_offset <= aeron_retransmit_handler_action_end(action))
+        {
+            return action;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * Extend a delayed action over an overlapping or adjacent range, absorbing any other delayed actions the union now
+ * touches, so a burst of NAKs is resent as one range when the delay expires.
+ */
+static int aeron_retransmit_handler_merge_delayed(
+    aeron_retransmit_handler_t *handler,
+    aeron_retransmit_action_t *action,
+    const struct sockaddr_storage *nak_addr,
+    int32_t range_offset,
+    int32_t range_end)
+{
+    const int64_t old_key = aeron_map_compound_key(action->term_id, action->term_offset);
+    aeron_retransmit_action_t *other = NULL;
+
+    do
+    {
+        if (NULL != other)
+        {
+            const int32_t other_end = aeron_retransmit_handler_action_end(other);
+
+            range_offset = other->term_offset < range_offset ? other->term_offset : range_offset;
+            range_end = other_end > range_end ? other_end : range_end;
+            aeron_retransmit_handler_merge_repair_addrs(handler, action, other);
+            other->state = AERON_RETRANSMIT_ACTION_STATE_INACTIVE;
+            aeron_int64_to_ptr_hash_map_remove(
+                &handler->active_retransmits_map, aeron_map_compound_key(other->term_id, other->term_offset));
+        }
+
+        const int32_t action_end = aeron_retransmit_handler_action_end(action);
+
+        range_offset = action->term_offset < range_offset ? action->term_offset : range_offset;
+        range_end = action_end > range_end ? action_end : range_end;
+    }
+    while (NULL != (other = aeron_retransmit_handler_find_delayed(
+        handler, action->term_id, range_offset, range_end, action)));
+
+    action->length = (size_t)(range_end - range_offset);
+    aeron_retransmit_handler_add_repair_addr(handler, action, nak_addr);
+
+    if (range_offset != action->term_offset)
+    {
+        aeron_int64_to_ptr_hash_map_remove(&handler->active_retransmits_map, old_key);
+        action->term_offset = range_offset;
+
+        if (aeron_int64_to_ptr_hash_map_put(
+            &handler->active_retransmits_map, aeron_map_compound_key(action->term_id, range_offset), action) < 0)
+        {
+            aeron_set_err_from_last_err_code("could not put retransmit handler map");
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
 int aeron_retransmit_handler_on_nak(
     aeron_retransmit_handler_t *handler,
     int32_t term_id,
@@ -85,15 +415,57 @@ int aeron_retransmit_handler_on_nak(
     int64_t now_ns,
     aeron_retransmit_handler_resend_func_t resend,
     void *resend_clientd)
+{
+    return aeron_retransmit_handler_on_nak_from(
+        handler, term_id, term_offset, length, term_length, NULL, now_ns, resend, resend_clientd);
+}
+
+int aeron_retransmit_handler_on_nak_from(
+    aeron_retransmit_handler_t *handler,
+    int32_t term_id,
+    int32_t term_offset,
+    size_t length,
+    size_t term_length,
+    struct sockaddr_storage *nak_addr,
+    int64_t now_ns,
+    aeron_retransmit_handler_resend_func_t resend,
+    void *resend_clientd)
 {
     int result = 0;
 
     if (!aeron_retransmit_handler_is_invalid(handler, term_offset, term_length))
     {
-        const int64_t key = aeron_map_compound_key(term_id, term_offset);
+        const size_t term_length_left = term_length - term_offset;
+        int32_t range_offset = term_offset;
+        int32_t range_end = term_offset + (int32_t)(length < term_length_left ? length : term_length_left);
+
+        aeron_retransmit_handler_trim_lingering(handler, term_id, nak_addr, &range_offset, &range_end);
+        if (range_offset >= range_end)
+        {
+            return 0;
+        }
+
+        aeron_retransmit_action_t *delayed = aeron_retransmit_handler_find_delayed(
+            handler, term_id, range_offset, range_end, NULL);
+        if (NULL != delayed)
+        {
+            return aeron_retransmit_handler_merge_delayed(handler, delayed, nak_addr, range_offset, range_end);
+        }
+
+        const int64_t key = aeron_map_compound_key(term_id, range_offset);
+        aeron_retransmit_action_t *existing = aeron_int64_to_ptr_hash_map_get(&handler->active_retransmits_map, key);
 
-        if (NULL == aeron_int64_to_ptr_hash_map_get(&handler->active_retransmits_map, key) &&
-            handler->active_retransmits_map.size < AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS)
+        if (NULL != existing)
+        {
+            /* lingering after a unicast repair to other receivers, so repair again with this one added */
+            if (AERON_RETRANSMIT_ACTION_STATE_LINGERING == existing->state &&
+                !aeron_retransmit_handler_is_repaired_to(existing, nak_addr))
+            {
+                aeron_retransmit_handler_add_repair_addr(handler, existing, nak_addr);
+                result = aeron_retransmit_handler_resend(handler, existing, now_ns, resend, resend_clientd);
+            }
+        }
+        else if (handler->active_retransmits_map.size < AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS)
         {
             aeron_retransmit_action_t *action = aeron_retransmit_handler_assign_action(handler);
 
@@ -103,17 +475,16 @@ int aeron_retransmit_handler_on_nak(
                 return -1;
             }
 
-            const size_t term_length_left = term_length - term_offset;
-
             action->term_id = term_id;
-            action->term_offset = term_offset;
-            action->length = length < term_length_left ? length : term_length_left;
+            action->term_offset = range_offset;
+            action->length = (size_t)(range_end - range_offset);
+            action->repair_addr_count = 0;
+            action->is_repair_to_channel = false;
+            aeron_retransmit_handler_add_repair_addr(handler, action, nak_addr);
 
             if (0 == handler->delay_timeout_ns)
             {
-                result = resend(resend_clientd, term_id, term_offset, action->length);
-                action->state = AERON_RETRANSMIT_ACTION_STATE_LINGERING;
-                action->expiry_ns = now_ns + handler->linger_timeout_ns;
+                result = aeron_retransmit_handler_resend(handler, action, now_ns, resend, resend_clientd);
             }
             else
             {
@@ -164,9 +535,7 @@ int aeron_retransmit_handler_process_timeouts(
             {
                 if (now_ns > action->expiry_ns)
                 {
-                    result = resend(resend_clientd, action->term_id, action->term_offset, action->length);
-                    action->state = AERON_RETRANSMIT_ACTION_STATE_LINGERING;
-                    action->expiry_ns = now_ns + handler->linger_timeout_ns;
+                    result = aeron_retransmit_handler_resend(handler, action, now_ns, resend, resend_clientd);
                     result++;
                 }
 
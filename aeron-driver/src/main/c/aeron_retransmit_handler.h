@@ -18,6 +18,7 @@
 #define AERON_RETRANSMIT_HANDLER_H
 
 #include "collections/aeron_int64_to_ptr_hash_map.h"
+#include "aeron_socket.h"
 #include "aeron_driver_common.h"
 #include "aeronmd.h"
 
@@ -29,6 +30,12 @@ typedef enum aeron_retransmit_action_state_enum
 }
 aeron_retransmit_action_state_t;
 
+#define AERON_RETRANSMIT_HANDLER_MAX_UNICAST_REPAIR_ADDRS (4)
+
+/*
+ * With unicast repair the control addresses of the receivers which NAKed the range are kept, until more of them NAK
+ * than the threshold and the action is repaired to the whole channel instead.
+ */
 typedef struct aeron_retransmit_action_stct
 {
     int64_t expiry_ns;
@@ -36,13 +43,39 @@ typedef struct aeron_retransmit_action_stct
     int32_t term_offset;
     size_t length;
     aeron_retransmit_action_state_t state;
+    size_t repair_addr_count;
+    bool is_repair_to_channel;
+    struct sockaddr_storage repair_addrs[AERON_RETRANSMIT_HANDLER_MAX_UNICAST_REPAIR_ADDRS];
 }
 aeron_retransmit_action_t;
 
 #define AERON_RETRANSMIT_HANDLER_MAX_RETRANSMITS (16)
+#define AERON_RETRANSMIT_BUDGET_BURST_WINDOW_NS (10 * 1000 * 1000LL)
+#define AERON_RETRANSMIT_BUDGET_MAX_RATE (100 * 1000 * 1000 * 1000LL)
+
+/*
+ * Token bucket of retransmit bytes refilled at rate_bytes_per_sec up to a burst of one burst window. A resend is
+ * allowed while any bytes are available and may take the bucket into debt so ranges larger than the burst still go.
+ */
+typedef struct aeron_retransmit_budget_stct
+{
+    uint64_t rate_bytes_per_sec;
+    int64_t burst_bytes;
+    int64_t available_bytes;
+    int64_t last_refill_ns;
+}
+aeron_retransmit_budget_t;
 
+/*
+ * Resend a range to each of repair_addrs, or to the destinations of the channel when repair_addr_count is 0.
+ */
 typedef int (*aeron_retransmit_handler_resend_func_t)(
-    void *clientd, int32_t term_id, int32_t term_offset, size_t length);
+    void *clientd,
+    int32_t term_id,
+    int32_t term_offset,
+    size_t length,
+    const struct sockaddr_storage *repair_addrs,
+    size_t repair_addr_count);
 
 typedef struct aeron_retransmit_handler_stct
 {
@@ -50,8 +83,13 @@ typedef struct aeron_retransmit_handler_stct
     aeron_int64_to_ptr_hash_map_t active_retransmits_map;
     uint64_t delay_timeout_ns;
     uint64_t linger_timeout_ns;
+    size_t unicast_repair_threshold;
+
+    aeron_retransmit_budget_t budget;
+    aeron_retransmit_budget_t *sender_budget;
 
     int64_t *invalid_packets_counter;
+    int64_t *retransmits_deferred_counter;
 }
 aeron_retransmit_handler_t;
 
@@ -63,6 +101,24 @@ int aeron_retransmit_handler_init(
 
 int aeron_retransmit_handler_close(aeron_retransmit_handler_t *handler);
 
+void aeron_retransmit_budget_init(aeron_retransmit_budget_t *budget, uint64_t rate_bytes_per_sec);
+
+int64_t aeron_retransmit_budget_wait_ns(aeron_retransmit_budget_t *budget, int64_t now_ns);
+
+void aeron_retransmit_budget_consume(aeron_retransmit_budget_t *budget, size_t length);
+
+void aeron_retransmit_handler_init_budget(
+    aeron_retransmit_handler_t *handler,
+    uint64_t rate_bytes_per_sec,
+    aeron_retransmit_budget_t *sender_budget,
+    int64_t *retransmits_deferred_counter);
+
+/**
+ * Repair a range NAKed by no more than threshold receivers only to their control addresses. Used for multicast where
+ * a resend to the group is processed again by every receiver. 0 disables it.
+ */
+void aeron_retransmit_handler_init_unicast_repair(aeron_retransmit_handler_t *handler, size_t threshold);
+
 int aeron_retransmit_handler_on_nak(
     aeron_retransmit_handler_t *handler,
     int32_t term_id,
@@ -73,6 +129,17 @@ int aeron_retransmit_handler_on_nak(
     aeron_retransmit_handler_resend_func_t resend,
     void *resend_clientd);
 
+int aeron_retransmit_handler_on_nak_from(
+    aeron_retransmit_handler_t *handler,
+    int32_t term_id,
+    int32_t term_offset,
+    size_t length,
+    size_t term_length,
+    struct sockaddr_storage *nak_addr,
+    int64_t now_ns,
+    aeron_retransmit_handler_resend_func_t resend,
+    void *resend_clientd);
+
 int aeron_retransmit_handler_process_timeouts(
     aeron_retransmit_handler_t *handler,
     int64_t now_ns,
@@ -0,0 +1,141 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "aeron_position.h"
+#include "aeron_stream_cpu_counters.h"
+
+static const char *aeron_stream_cpu_counters_sender_suffixes[AERON_STREAM_CPU_SENDER_ACTIVITY_COUNT] =
+    {
+        "send",
+        "resend",
+        "status-message",
+        "nak"
+    };
+
+static const char *aeron_stream_cpu_counters_receiver_suffixes[AERON_STREAM_CPU_RECEIVER_ACTIVITY_COUNT] =
+    {
+        "rebuild",
+        "status-message",
+        "nak"
+    };
+
+static int aeron_stream_cpu_counters_allocate(
+    aeron_stream_cpu_counters_t *cpu_counters,
+    aeron_counters_manager_t *counters_manager,
+    const char *name,
+    int32_t type_id,
+    const char **suffixes,
+    int activity_count,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    size_t channel_length,
+    const char *channel)
+{
+    cpu_counters->activity_count = activity_count;
+    for (int i = 0; i < AERON_STREAM_CPU_COUNTERS_MAX_ACTIVITIES; i++)
+    {
+        cpu_counters->counter_ids[i] = AERON_NULL_COUNTER_ID;
+        cpu_counters->tick_counters[i] = NULL;
+    }
+
+    for (int i = 0; i < activity_count; i++)
+    {
+        const int32_t counter_id = aeron_stream_counter_allocate(
+            counters_manager,
+            name,
+            type_id,
+            registration_id,
+            session_id,
+            stream_id,
+            channel_length,
+            channel,
+            suffixes[i]);
+
+        if (counter_id < 0)
+        {
+            aeron_stream_cpu_counters_free(cpu_counters, counters_manager);
+            return -1;
+        }
+
+        cpu_counters->counter_ids[i] = counter_id;
+        cpu_counters->tick_counters[i] = aeron_counters_manager_addr(counters_manager, counter_id);
+    }
+
+    return 0;
+}
+
+int aeron_stream_cpu_counters_allocate_sender(
+    aeron_stream_cpu_counters_t *cpu_counters,
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    size_t channel_length,
+    const char *channel)
+{
+    return aeron_stream_cpu_counters_allocate(
+        cpu_counters,
+        counters_manager,
+        AERON_COUNTER_SENDER_CPU_TICKS_NAME,
+        AERON_COUNTER_SENDER_CPU_TICKS_TYPE_ID,
+        aeron_stream_cpu_counters_sender_suffixes,
+        AERON_STREAM_CPU_SENDER_ACTIVITY_COUNT,
+        registration_id,
+        session_id,
+        stream_id,
+        channel_length,
+        channel);
+}
+
+int aeron_stream_cpu_counters_allocate_receiver(
+    aeron_stream_cpu_counters_t *cpu_counters,
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    size_t channel_length,
+    const char *channel)
+{
+    return aeron_stream_cpu_counters_allocate(
+        cpu_counters,
+        counters_manager,
+        AERON_COUNTER_RECEIVER_CPU_TICKS_NAME,
+        AERON_COUNTER_RECEIVER_CPU_TICKS_TYPE_ID,
+        aeron_stream_cpu_counters_receiver_suffixes,
+        AERON_STREAM_CPU_RECEIVER_ACTIVITY_COUNT,
+        registration_id,
+        session_id,
+        stream_id,
+        channel_length,
+        channel);
+}
+
+void aeron_stream_cpu_counters_free(aeron_stream_cpu_counters_t *cpu_counters, aeron_counters_manager_t *counters_manager)
+{
+    for (int i = 0; i < AERON_STREAM_CPU_COUNTERS_MAX_ACTIVITIES; i++)
+    {
+        if (AERON_NULL_COUNTER_ID != cpu_counters->counter_ids[i])
+        {
+            aeron_counters_manager_free(counters_manager, cpu_counters->counter_ids[i]);
+            cpu_counters->counter_ids[i] = AERON_NULL_COUNTER_ID;
+            cpu_counters->tick_counters[i] = NULL;
+        }
+    }
+}
+
+extern int64_t aeron_stream_cpu_counters_record(
+    aeron_stream_cpu_counters_t *cpu_counters, int activity, uint64_t start_ticks);
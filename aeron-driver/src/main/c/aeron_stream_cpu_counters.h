@@ -0,0 +1,80 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_STREAM_CPU_COUNTERS_H
+#define AERON_STREAM_CPU_COUNTERS_H
+
+#include <stdint.h>
+
+#include "concurrent/aeron_counters_manager.h"
+#include "util/aeron_clock.h"
+
+#define AERON_STREAM_CPU_COUNTERS_MAX_ACTIVITIES (4)
+
+#define AERON_STREAM_CPU_SENDER_SEND (0)
+#define AERON_STREAM_CPU_SENDER_RESEND (1)
+#define AERON_STREAM_CPU_SENDER_STATUS_MESSAGE (2)
+#define AERON_STREAM_CPU_SENDER_NAK (3)
+#define AERON_STREAM_CPU_SENDER_ACTIVITY_COUNT (4)
+
+#define AERON_STREAM_CPU_RECEIVER_REBUILD (0)
+#define AERON_STREAM_CPU_RECEIVER_STATUS_MESSAGE (1)
+#define AERON_STREAM_CPU_RECEIVER_NAK (2)
+#define AERON_STREAM_CPU_RECEIVER_ACTIVITY_COUNT (3)
+
+/*
+ * TSC ticks spent by the sender or receiver agent on each activity of a stream, one counter per activity, so the
+ * streams responsible for a saturated agent can be found with AeronStat. Ticks are uncalibrated and only comparable
+ * with each other. Each set of counters has a single writer.
+ */
+typedef struct aeron_stream_cpu_counters_stct
+{
+    int32_t counter_ids[AERON_STREAM_CPU_COUNTERS_MAX_ACTIVITIES];
+    int64_t *tick_counters[AERON_STREAM_CPU_COUNTERS_MAX_ACTIVITIES];
+    int activity_count;
+}
+aeron_stream_cpu_counters_t;
+
+int aeron_stream_cpu_counters_allocate_sender(
+    aeron_stream_cpu_counters_t *cpu_counters,
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    size_t channel_length,
+    const char *channel);
+
+int aeron_stream_cpu_counters_allocate_receiver(
+    aeron_stream_cpu_counters_t *cpu_counters,
+    aeron_counters_manager_t *counters_manager,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    size_t channel_length,
+    const char *channel);
+
+void aeron_stream_cpu_counters_free(aeron_stream_cpu_counters_t *cpu_counters, aeron_counters_manager_t *counters_manager);
+
+inline int64_t aeron_stream_cpu_counters_record(
+    aeron_stream_cpu_counters_t *cpu_counters, int activity, uint64_t start_ticks)
+{
+    const int64_t ticks = (int64_t)(aeron_tsc_ticks() - start_ticks);
+    aeron_counter_ordered_increment(cpu_counters->tick_counters[activity], ticks);
+
+    return ticks;
+}
+
+#endif //AERON_STREAM_CPU_COUNTERS_H
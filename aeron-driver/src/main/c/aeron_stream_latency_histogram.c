@@ -0,0 +1,105 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "aeron_position.h"
+#include "aeron_stream_latency_histogram.h"
+
+static const int64_t aeron_stream_latency_histogram_bucket_limits_ns[AERON_STREAM_LATENCY_HISTOGRAM_BUCKET_COUNT - 1] =
+    {
+        10 * 1000LL,
+        100 * 1000LL,
+        1000 * 1000LL,
+        10 * 1000 * 1000LL
+    };
+
+static const char *aeron_stream_latency_histogram_bucket_suffixes[AERON_STREAM_LATENCY_HISTOGRAM_BUCKET_COUNT] =
+    {
+        "up to 10us",
+        "up to 100us",
+        "up to 1ms",
+        "up to 10ms",
+        "over 10ms"
+    };
+
+int aeron_stream_latency_histogram_allocate(
+    aeron_stream_latency_histogram_t *histogram,
+    aeron_counters_manager_t *counters_manager,
+    const char *name,
+    int32_t type_id,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    size_t channel_length,
+    const char *channel)
+{
+    for (int i = 0; i < AERON_STREAM_LATENCY_HISTOGRAM_BUCKET_COUNT; i++)
+    {
+        histogram->counter_ids[i] = AERON_NULL_COUNTER_ID;
+        histogram->bucket_counters[i] = NULL;
+    }
+
+    for (int i = 0; i < AERON_STREAM_LATENCY_HISTOGRAM_BUCKET_COUNT; i++)
+    {
+        const int32_t counter_id = aeron_stream_counter_allocate(
+            counters_manager,
+            name,
+            type_id,
+            registration_id,
+            session_id,
+            stream_id,
+            channel_length,
+            channel,
+            aeron_stream_latency_histogram_bucket_suffixes[i]);
+
+        if (counter_id < 0)
+        {
+            aeron_stream_latency_histogram_free(histogram, counters_manager);
+            return -1;
+        }
+
+        histogram->counter_ids[i] = counter_id;
+        histogram->bucket_counters[i] = aeron_counters_manager_addr(counters_manager, counter_id);
+    }
+
+    return 0;
+}
+
+void aeron_stream_latency_histogram_free(
+    aeron_stream_latency_histogram_t *histogram, aeron_counters_manager_t *counters_manager)
+{
+    for (int i = 0; i < AERON_STREAM_LATENCY_HISTOGRAM_BUCKET_COUNT; i++)
+    {
+        if (AERON_NULL_COUNTER_ID != histogram->counter_ids[i])
+        {
+            aeron_counters_manager_free(counters_manager, histogram->counter_ids[i]);
+            histogram->counter_ids[i] = AERON_NULL_COUNTER_ID;
+            histogram->bucket_counters[i] = NULL;
+        }
+    }
+}
+
+void aeron_stream_latency_histogram_record(aeron_stream_latency_histogram_t *histogram, int64_t latency_ns)
+{
+    int bucket = 0;
+
+    while (bucket < AERON_STREAM_LATENCY_HISTOGRAM_BUCKET_COUNT - 1 &&
+        latency_ns > aeron_stream_latency_histogram_bucket_limits_ns[bucket])
+    {
+        bucket++;
+    }
+
+    aeron_counter_ordered_increment(histogram->bucket_counters[bucket], 1);
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_STREAM_LATENCY_HISTOGRAM_H
+#define AERON_STREAM_LATENCY_HISTOGRAM_H
+
+#include <stdint.h>
+
+#include "concurrent/aeron_counters_manager.h"
+
+#define AERON_STREAM_LATENCY_HISTOGRAM_BUCKET_COUNT (5)
+
+/*
+ * A coarse histogram of the latencies of a stream held in one counter per bucket, so it can be read with AeronStat.
+ * The buckets follow those of the duty cycle tracker: up to 10us, 100us, 1ms, 10ms and over 10ms. Each histogram has a
+ * single writer.
+ */
+typedef struct aeron_stream_latency_histogram_stct
+{
+    int32_t counter_ids[AERON_STREAM_LATENCY_HISTOGRAM_BUCKET_COUNT];
+    int64_t *bucket_counters[AERON_STREAM_LATENCY_HISTOGRAM_BUCKET_COUNT];
+}
+aeron_stream_latency_histogram_t;
+
+int aeron_stream_latency_histogram_allocate(
+    aeron_stream_latency_histogram_t *histogram,
+    aeron_counters_manager_t *counters_manager,
+    const char *name,
+    int32_t type_id,
+    int64_t registration_id,
+    int32_t session_id,
+    int32_t stream_id,
+    size_t channel_length,
+    const char *channel);
+
+void aeron_stream_latency_histogram_free(
+    aeron_stream_latency_histogram_t *histogram, aeron_counters_manager_t *counters_manager);
+
+void aeron_stream_latency_histogram_record(aeron_stream_latency_histogram_t *histogram, int64_t latency_ns);
+
+#endif //AERON_STREAM_LATENCY_HISTOGRAM_H
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <stdio.h>
 #include <string.h>
 #include <errno.h>
 #include "util/aeron_error.h"
@@ -47,11 +48,49 @@ static aeron_system_counter_t system_counters[] =
         { "ControllableIdleStrategy status", AERON_SYSTEM_COUNTER_CONTROLLABLE_IDLE_STRATEGY },
         { "Loss gap fills", AERON_SYSTEM_COUNTER_LOSS_GAP_FILLS},
         { "Client liveness timeouts", AERON_SYSTEM_COUNTER_CLIENT_TIMEOUTS},
-        { "Resolution changes", AERON_SYSTEM_COUNTER_RESOLUTION_CHANGES}
+        { "Resolution changes", AERON_SYSTEM_COUNTER_RESOLUTION_CHANGES},
+        { "Retransmits deferred by budget", AERON_SYSTEM_COUNTER_RETRANSMITS_DEFERRED},
+        { "Frames failing checksum", AERON_SYSTEM_COUNTER_CHECKSUM_FAILURES},
+        { "Conductor max cycle time in ns", AERON_SYSTEM_COUNTER_CONDUCTOR_MAX_CYCLE_TIME},
+        { "Conductor work cycle exceeded threshold count", AERON_SYSTEM_COUNTER_CONDUCTOR_CYCLE_TIME_THRESHOLD_EXCEEDED},
+        { "Conductor cycles up to 10us", AERON_SYSTEM_COUNTER_CONDUCTOR_CYCLE_TIME_10US},
+        { "Conductor cycles up to 100us", AERON_SYSTEM_COUNTER_CONDUCTOR_CYCLE_TIME_100US},
+        { "Conductor cycles up to 1ms", AERON_SYSTEM_COUNTER_CONDUCTOR_CYCLE_TIME_1MS},
+        { "Conductor cycles up to 10ms", AERON_SYSTEM_COUNTER_CONDUCTOR_CYCLE_TIME_10MS},
+        { "Conductor cycles over 10ms", AERON_SYSTEM_COUNTER_CONDUCTOR_CYCLE_TIME_OVER_10MS},
+        { "Sender max cycle time in ns", AERON_SYSTEM_COUNTER_SENDER_MAX_CYCLE_TIME},
+        { "Sender work cycle exceeded threshold count", AERON_SYSTEM_COUNTER_SENDER_CYCLE_TIME_THRESHOLD_EXCEEDED},
+        { "Sender cycles up to 10us", AERON_SYSTEM_COUNTER_SENDER_CYCLE_TIME_10US},
+        { "Sender cycles up to 100us", AERON_SYSTEM_COUNTER_SENDER_CYCLE_TIME_100US},
+        { "Sender cycles up to 1ms", AERON_SYSTEM_COUNTER_SENDER_CYCLE_TIME_1MS},
+        { "Sender cycles up to 10ms", AERON_SYSTEM_COUNTER_SENDER_CYCLE_TIME_10MS},
+        { "Sender cycles over 10ms", AERON_SYSTEM_COUNTER_SENDER_CYCLE_TIME_OVER_10MS},
+        { "Receiver max cycle time in ns", AERON_SYSTEM_COUNTER_RECEIVER_MAX_CYCLE_TIME},
+        { "Receiver work cycle exceeded threshold count", AERON_SYSTEM_COUNTER_RECEIVER_CYCLE_TIME_THRESHOLD_EXCEEDED},
+        { "Receiver cycles up to 10us", AERON_SYSTEM_COUNTER_RECEIVER_CYCLE_TIME_10US},
+        { "Receiver cycles up to 100us", AERON_SYSTEM_COUNTER_RECEIVER_CYCLE_TIME_100US},
+        { "Receiver cycles up to 1ms", AERON_SYSTEM_COUNTER_RECEIVER_CYCLE_TIME_1MS},
+        { "Receiver cycles up to 10ms", AERON_SYSTEM_COUNTER_RECEIVER_CYCLE_TIME_10MS},
+        { "Receiver cycles over 10ms", AERON_SYSTEM_COUNTER_RECEIVER_CYCLE_TIME_OVER_10MS},
+        { "Frames dropped by image rate limit", AERON_SYSTEM_COUNTER_RECEIVER_RATE_LIMITED_FRAMES},
+        { "Receiver windows reduced by image rate limit", AERON_SYSTEM_COUNTER_RECEIVER_RATE_LIMITED_IMAGES},
+        { "Log buffer bytes mapped", AERON_SYSTEM_COUNTER_LOG_BUFFER_MEMORY},
+        { "Log buffers rejected by memory budget", AERON_SYSTEM_COUNTER_LOG_BUFFER_BUDGET_REJECTIONS},
+        { "Pooled log buffers evicted by memory budget", AERON_SYSTEM_COUNTER_LOG_BUFFER_BUDGET_EVICTIONS}
     };
 
 static size_t num_system_counters = sizeof(system_counters) / sizeof(aeron_system_counter_t);
 
+static aeron_system_counter_enum_t striped_system_counters[] =
+    {
+        AERON_SYSTEM_COUNTER_INVALID_PACKETS,
+        AERON_SYSTEM_COUNTER_ERRORS,
+        AERON_SYSTEM_COUNTER_SHORT_SENDS,
+        AERON_SYSTEM_COUNTER_RESOLUTION_CHANGES
+    };
+
+static const char *system_counter_writer_names[] = { "conductor", "sender", "receiver" };
+
 #ifdef AERON_COMPILER_GCC
 _Static_assert(
     AERON_SYSTEM_COUNTER_DUMMY_LAST == sizeof(system_counters) / sizeof(aeron_system_counter_t),
@@ -87,6 +126,51 @@ int aeron_system_counters_init(aeron_system_counters_t *counters, aeron_counters
         }
     }
 
+    size_t num_writer_counters = num_system_counters * AERON_SYSTEM_COUNTER_WRITER_DUMMY_LAST;
+    if (aeron_alloc((void **)&counters->writer_counter_ids, sizeof(int32_t) * num_writer_counters) < 0)
+    {
+        aeron_set_err_from_last_err_code("%s:%d", __FILE__, __LINE__);
+        return -1;
+    }
+
+    for (size_t i = 0; i < num_writer_counters; i++)
+    {
+        counters->writer_counter_ids[i] = counters->counter_ids[i / AERON_SYSTEM_COUNTER_WRITER_DUMMY_LAST];
+    }
+
+    for (size_t i = 0; i < sizeof(striped_system_counters) / sizeof(striped_system_counters[0]); i++)
+    {
+        aeron_system_counter_enum_t type = striped_system_counters[i];
+
+        for (int32_t writer = AERON_SYSTEM_COUNTER_WRITER_SENDER;
+            writer < AERON_SYSTEM_COUNTER_WRITER_DUMMY_LAST;
+            writer++)
+        {
+            aeron_counter_stripe_key_layout_t key = { counters->counter_ids[type], writer };
+            char label[sizeof(((aeron_counter_metadata_descriptor_t *)0)->label)];
+            int label_length = snprintf(
+                label,
+                sizeof(label),
+                "%s: %s stripe",
+                system_counters[type].label,
+                system_counter_writer_names[writer]);
+            int32_t counter_id = aeron_counters_manager_allocate(
+                manager,
+                AERON_COUNTER_STRIPE_TYPE_ID,
+                (const uint8_t *)&key,
+                sizeof(key),
+                label,
+                (size_t)label_length);
+
+            if (counter_id < 0)
+            {
+                return -1;
+            }
+
+            counters->writer_counter_ids[(type * AERON_SYSTEM_COUNTER_WRITER_DUMMY_LAST) + writer] = counter_id;
+        }
+    }
+
     return 0;
 }
 
@@ -95,9 +179,23 @@ void aeron_system_counters_close(aeron_system_counters_t *counters)
     for (int32_t i = 0; i < (int32_t)num_system_counters; i++)
     {
         aeron_counters_manager_free(counters->manager, counters->counter_ids[i]);
+
+        for (int32_t writer = 0; writer < AERON_SYSTEM_COUNTER_WRITER_DUMMY_LAST; writer++)
+        {
+            int32_t counter_id = counters->writer_counter_ids[(i * AERON_SYSTEM_COUNTER_WRITER_DUMMY_LAST) + writer];
+            if (counter_id != counters->counter_ids[i])
+            {
+                aeron_counters_manager_free(counters->manager, counter_id);
+            }
+        }
     }
 
     aeron_free(counters->counter_ids);
+    aeron_free(counters->writer_counter_ids);
 }
 
 extern int64_t *aeron_system_counter_addr(aeron_system_counters_t *counters, aeron_system_counter_enum_t type);
+
+extern int64_t *aeron_system_counter_writer_addr(
+    aeron_system_counters_t *counters, aeron_system_counter_enum_t type, aeron_system_counter_writer_t writer);
+extern void aeron_system_counter_add(volatile int64_t *addr, int64_t value, bool is_shared);
@@ -47,6 +47,34 @@ typedef enum aeron_system_counter_enum_stct
     AERON_SYSTEM_COUNTER_LOSS_GAP_FILLS = 23,
     AERON_SYSTEM_COUNTER_CLIENT_TIMEOUTS = 24,
     AERON_SYSTEM_COUNTER_RESOLUTION_CHANGES = 25,
+    AERON_SYSTEM_COUNTER_RETRANSMITS_DEFERRED = 26,
+    AERON_SYSTEM_COUNTER_CHECKSUM_FAILURES = 27,
+    AERON_SYSTEM_COUNTER_CONDUCTOR_MAX_CYCLE_TIME = 28,
+    AERON_SYSTEM_COUNTER_CONDUCTOR_CYCLE_TIME_THRESHOLD_EXCEEDED = 29,
+    AERON_SYSTEM_COUNTER_CONDUCTOR_CYCLE_TIME_10US = 30,
+    AERON_SYSTEM_COUNTER_CONDUCTOR_CYCLE_TIME_100US = 31,
+    AERON_SYSTEM_COUNTER_CONDUCTOR_CYCLE_TIME_1MS = 32,
+    AERON_SYSTEM_COUNTER_CONDUCTOR_CYCLE_TIME_10MS = 33,
+    AERON_SYSTEM_COUNTER_CONDUCTOR_CYCLE_TIME_OVER_10MS = 34,
+    AERON_SYSTEM_COUNTER_SENDER_MAX_CYCLE_TIME = 35,
+    AERON_SYSTEM_COUNTER_SENDER_CYCLE_TIME_THRESHOLD_EXCEEDED = 36,
+    AERON_SYSTEM_COUNTER_SENDER_CYCLE_TIME_10US = 37,
+    AERON_SYSTEM_COUNTER_SENDER_CYCLE_TIME_100US = 38,
+    AERON_SYSTEM_COUNTER_SENDER_CYCLE_TIME_1MS = 39,
+    AERON_SYSTEM_COUNTER_SENDER_CYCLE_TIME_10MS = 40,
+    AERON_SYSTEM_COUNTER_SENDER_CYCLE_TIME_OVER_10MS = 41,
+    AERON_SYSTEM_COUNTER_RECEIVER_MAX_CYCLE_TIME = 42,
+    AERON_SYSTEM_COUNTER_RECEIVER_CYCLE_TIME_THRESHOLD_EXCEEDED = 43,
+    AERON_SYSTEM_COUNTER_RECEIVER_CYCLE_TIME_10US = 44,
+    AERON_SYSTEM_COUNTER_RECEIVER_CYCLE_TIME_100US = 45,
+    AERON_SYSTEM_COUNTER_RECEIVER_CYCLE_TIME_1MS = 46,
+    AERON_SYSTEM_COUNTER_RECEIVER_CYCLE_TIME_10MS = 47,
+    AERON_SYSTEM_COUNTER_RECEIVER_CYCLE_TIME_OVER_10MS = 48,
+    AERON_SYSTEM_COUNTER_RECEIVER_RATE_LIMITED_FRAMES = 49,
+    AERON_SYSTEM_COUNTER_RECEIVER_RATE_LIMITED_IMAGES = 50,
+    AERON_SYSTEM_COUNTER_LOG_BUFFER_MEMORY = 51,
+    AERON_SYSTEM_COUNTER_LOG_BUFFER_BUDGET_REJECTIONS = 52,
+    AERON_SYSTEM_COUNTER_LOG_BUFFER_BUDGET_EVICTIONS = 53,
 
     // Add all new counters before this one (used for a static assertion).
     AERON_SYSTEM_COUNTER_DUMMY_LAST,
@@ -62,9 +90,26 @@ aeron_system_counter_t;
 
 #define AERON_SYSTEM_COUNTER_TYPE_ID (0)
 
+/*
+ * Agents which increment the system counters. The conductor writes the system counter itself while the sender and
+ * receiver each get their own AERON_COUNTER_STRIPE_TYPE_ID slot of the counters incremented by more than one agent,
+ * so those never bounce a cache line between cores. Readers sum the stripes with
+ * aeron_counters_reader_aggregated_value.
+ */
+typedef enum aeron_system_counter_writer_enum_stct
+{
+    AERON_SYSTEM_COUNTER_WRITER_CONDUCTOR = 0,
+    AERON_SYSTEM_COUNTER_WRITER_SENDER = 1,
+    AERON_SYSTEM_COUNTER_WRITER_RECEIVER = 2,
+
+    AERON_SYSTEM_COUNTER_WRITER_DUMMY_LAST,
+}
+aeron_system_counter_writer_t;
+
 typedef struct aeron_system_counters_stct
 {
     int32_t *counter_ids;
+    int32_t *writer_counter_ids;
     aeron_counters_manager_t *manager;
 }
 aeron_system_counters_t;
@@ -78,4 +123,27 @@ inline int64_t *aeron_system_counter_addr(aeron_system_counters_t *counters, aer
     return aeron_counters_manager_addr(counters->manager, counters->counter_ids[type]);
 }
 
+inline int64_t *aeron_system_counter_writer_addr(
+    aeron_system_counters_t *counters, aeron_system_counter_enum_t type, aeron_system_counter_writer_t writer)
+{
+    return aeron_counters_manager_addr(
+        counters->manager, counters->writer_counter_ids[(type * AERON_SYSTEM_COUNTER_WRITER_DUMMY_LAST) + writer]);
+}
+
+/*
+ * Only receiver shards write the same counter from more than one thread, so they pass is_shared and pay for the
+ * atomic add. A single writer keeps the cheaper ordered add.
+ */
+inline void aeron_system_counter_add(volatile int64_t *addr, int64_t value, bool is_shared)
+{
+    if (is_shared)
+    {
+        aeron_counter_increment(addr, value);
+    }
+    else
+    {
+        aeron_counter_add_ordered(addr, value);
+    }
+}
+
 #endif //AERON_SYSTEM_COUNTERS_H
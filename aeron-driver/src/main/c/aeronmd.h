@@ -97,6 +97,23 @@ size_t aeron_driver_context_get_to_conductor_buffer_length(aeron_driver_context_
 int aeron_driver_context_set_to_clients_buffer_length(aeron_driver_context_t *context, size_t length);
 size_t aeron_driver_context_get_to_clients_buffer_length(aeron_driver_context_t *context);
 
+/**
+ * Should clients be allowed to request a private response buffer so that responses and image notifications for
+ * their own resources are not broadcast to every client. Clients that do not ask keep using the broadcast buffer.
+ */
+#define AERON_CLIENT_DIRECTED_RESPONSES_ENABLED_ENV_VAR "AERON_CLIENT_DIRECTED_RESPONSES_ENABLED"
+
+int aeron_driver_context_set_client_directed_responses_enabled(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_client_directed_responses_enabled(aeron_driver_context_t *context);
+
+/**
+ * Length (in bytes) of each private response buffer from the media driver to a client.
+ */
+#define AERON_CLIENT_DIRECTED_RESPONSES_BUFFER_LENGTH_ENV_VAR "AERON_CLIENT_DIRECTED_RESPONSES_BUFFER_LENGTH"
+
+int aeron_driver_context_set_client_directed_responses_buffer_length(aeron_driver_context_t *context, size_t length);
+size_t aeron_driver_context_get_client_directed_responses_buffer_length(aeron_driver_context_t *context);
+
 /**
  * Length (in bytes) of the value buffer for the system counters.
  */
@@ -105,6 +122,18 @@ size_t aeron_driver_context_get_to_clients_buffer_length(aeron_driver_context_t
 int aeron_driver_context_set_counters_buffer_length(aeron_driver_context_t *context, size_t length);
 size_t aeron_driver_context_get_counters_buffer_length(aeron_driver_context_t *context);
 
+/**
+ * Number of counters in the compact counters region at the end of the CnC file, 0 for none. Read-mostly per stream
+ * counters with a single writer, e.g. sampled publisher positions, are placed there with densely packed values and
+ * small metadata records so very large numbers of streams do not need a very large counters buffer. Allocation falls
+ * back to the main counters buffer when the region is full. Clients must read the region to see these counters,
+ * which the C and C++ clients do.
+ */
+#define AERON_COUNTERS_COMPACT_CAPACITY_ENV_VAR "AERON_COUNTERS_COMPACT_CAPACITY"
+
+int aeron_driver_context_set_counters_compact_capacity(aeron_driver_context_t *context, int32_t capacity);
+int32_t aeron_driver_context_get_counters_compact_capacity(aeron_driver_context_t *context);
+
 /**
  * Length (in bytes) of the buffer for the distinct error log.
  */
@@ -145,6 +174,120 @@ size_t aeron_driver_context_get_ipc_term_buffer_length(aeron_driver_context_t *c
 int aeron_driver_context_set_term_buffer_sparse_file(aeron_driver_context_t *context, bool value);
 bool aeron_driver_context_get_term_buffer_sparse_file(aeron_driver_context_t *context);
 
+/**
+ * Should term buffers be advised to use transparent huge pages. For hugetlbfs place the aeron dir on a hugetlbfs
+ * mount and set the file page size to the huge page size instead.
+ */
+#define AERON_TERM_BUFFER_HUGE_PAGES_ENV_VAR "AERON_TERM_BUFFER_HUGE_PAGES"
+
+int aeron_driver_context_set_term_buffer_huge_pages(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_term_buffer_huge_pages(aeron_driver_context_t *context);
+
+/**
+ * NUMA node preferred for the pages of term buffers, -1 to use the default policy of the conductor thread. Channels
+ * can override it with the numa URI param to place a log on the node of the thread consuming it.
+ */
+#define AERON_TERM_BUFFER_NUMA_NODE_ENV_VAR "AERON_TERM_BUFFER_NUMA_NODE"
+
+int aeron_driver_context_set_term_buffer_numa_node(aeron_driver_context_t *context, int32_t value);
+int32_t aeron_driver_context_get_term_buffer_numa_node(aeron_driver_context_t *context);
+
+/**
+ * NUMA node preferred for the pages of the CnC file holding the command and broadcast buffers and counters, -1 to use
+ * the default policy.
+ */
+#define AERON_CNC_NUMA_NODE_ENV_VAR "AERON_CNC_NUMA_NODE"
+
+int aeron_driver_context_set_cnc_numa_node(aeron_driver_context_t *context, int32_t value);
+int32_t aeron_driver_context_get_cnc_numa_node(aeron_driver_context_t *context);
+
+/**
+ * Should the pages of non-sparse term buffers be faulted in on a background thread rather than by the conductor while
+ * handling the command creating them. The log is created sparse and usable immediately, with pages faulted on first
+ * use until the background pass reaches them.
+ */
+#define AERON_TERM_BUFFER_PRE_FAULT_ASYNC_ENV_VAR "AERON_TERM_BUFFER_PRE_FAULT_ASYNC"
+
+int aeron_driver_context_set_term_buffer_pre_fault_async(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_term_buffer_pre_fault_async(aeron_driver_context_t *context);
+
+/**
+ * Should the conductor hand the unmapping and deletion of log buffers and other files it has finished with to a
+ * background agent rather than doing it inline, so the latency of client commands does not depend on how many
+ * resources reached the end of their linger in the same duty cycle.
+ */
+#define AERON_CONDUCTOR_HOUSEKEEPING_ASYNC_ENV_VAR "AERON_CONDUCTOR_HOUSEKEEPING_ASYNC"
+
+int aeron_driver_context_set_conductor_housekeeping_async(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_conductor_housekeeping_async(aeron_driver_context_t *context);
+
+/**
+ * Number of released log buffers kept mapped for reuse by new publications and images of the same term length, 0 to
+ * delete log buffers when released. Only non-sparse logs without huge page or NUMA placement are pooled.
+ */
+#define AERON_LOG_BUFFER_POOL_CAPACITY_ENV_VAR "AERON_LOG_BUFFER_POOL_CAPACITY"
+
+int aeron_driver_context_set_log_buffer_pool_capacity(aeron_driver_context_t *context, size_t value);
+size_t aeron_driver_context_get_log_buffer_pool_capacity(aeron_driver_context_t *context);
+
+/**
+ * Should log buffers survive a driver restart as pooled buffers. On start an inactive aeron directory is set aside
+ * rather than deleted, and the log buffers of its publications, images and pool are adopted into the new pool up to
+ * its capacity, so they are reused instead of recreated. On close the pool keeps its files. Requires a log buffer pool.
+ */
+#define AERON_LOG_BUFFER_POOL_WARM_RESTART_ENV_VAR "AERON_LOG_BUFFER_POOL_WARM_RESTART"
+
+int aeron_driver_context_set_log_buffer_pool_warm_restart(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_log_buffer_pool_warm_restart(aeron_driver_context_t *context);
+
+/**
+ * Total length of log buffers the driver may map for publications and images, 0 for no limit. Pooled log buffers are
+ * counted and evicted first when a new log would exceed the budget. A publication that still does not fit is rejected
+ * with an error to the client, and an image that does not fit is not created so the subscriber does not join.
+ */
+#define AERON_LOG_BUFFER_MEMORY_BUDGET_ENV_VAR "AERON_LOG_BUFFER_MEMORY_BUDGET"
+
+int aeron_driver_context_set_log_buffer_memory_budget(aeron_driver_context_t *context, uint64_t value);
+uint64_t aeron_driver_context_get_log_buffer_memory_budget(aeron_driver_context_t *context);
+
+/**
+ * Should log buffers be backed by memfd anonymous memory rather than files in the aeron directory. Clients map a log
+ * through the procfs link of the descriptor held by the driver, so they must share its pid namespace and be allowed
+ * to access its /proc entries. Linux only, the log buffer pool is not used.
+ */
+#define AERON_TERM_BUFFER_MEMFD_ENV_VAR "AERON_TERM_BUFFER_MEMFD"
+
+int aeron_driver_context_set_term_buffer_memfd(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_term_buffer_memfd(aeron_driver_context_t *context);
+
+/**
+ * Path of a Unix domain socket on which the driver hands log buffers to clients as file descriptors, so clients that
+ * set the same socket need not share the aeron directory or pid namespace of the driver, e.g. across containers.
+ * Only logs in the aeron directory or memfd logs of the driver are handed out. POSIX platforms only, not set by default.
+ */
+#define AERON_LOG_BUFFER_SOCKET_ENV_VAR "AERON_LOG_BUFFER_SOCKET"
+
+int aeron_driver_context_set_log_buffer_socket(aeron_driver_context_t *context, const char *value);
+const char *aeron_driver_context_get_log_buffer_socket(aeron_driver_context_t *context);
+
+/**
+ * How consumed regions of terms are zeroed before reuse: MEMSET, NON_TEMPORAL to bypass the cache with streaming
+ * stores, or PUNCH_HOLE to release whole pages back to the file system which suits sparse term buffers.
+ */
+#define AERON_TERM_BUFFER_CLEAN_MODE_ENV_VAR "AERON_TERM_BUFFER_CLEAN_MODE"
+
+typedef enum aeron_term_buffer_clean_mode_enum
+{
+    AERON_TERM_BUFFER_CLEAN_MODE_MEMSET,
+    AERON_TERM_BUFFER_CLEAN_MODE_NON_TEMPORAL,
+    AERON_TERM_BUFFER_CLEAN_MODE_PUNCH_HOLE
+}
+aeron_term_buffer_clean_mode_t;
+
+int aeron_driver_context_set_term_buffer_clean_mode(
+    aeron_driver_context_t *context, aeron_term_buffer_clean_mode_t mode);
+aeron_term_buffer_clean_mode_t aeron_driver_context_get_term_buffer_clean_mode(aeron_driver_context_t *context);
+
 /**
  * Should storage checks should be performed when allocating files.
  */
@@ -161,6 +304,17 @@ bool aeron_driver_context_get_perform_storage_checks(aeron_driver_context_t *con
 int aeron_driver_context_set_spies_simulate_connection(aeron_driver_context_t *context, bool value);
 bool aeron_driver_context_get_spies_simulate_connection(aeron_driver_context_t *context);
 
+/**
+ * Should a network subscription read the log of a network publication on the same driver and channel directly, as a
+ * spy does, rather than through the sender, the socket and the receiver. Remote receivers are still sent to, and the
+ * receiver does not create an image for a session published locally. The local subscriber connects the publication
+ * and holds back its limit as a spy does when spies simulate connection, whatever that setting is.
+ */
+#define AERON_NETWORK_SHORT_CIRCUIT_ENABLED_ENV_VAR "AERON_NETWORK_SHORT_CIRCUIT_ENABLED"
+
+int aeron_driver_context_set_network_short_circuit_enabled(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_network_short_circuit_enabled(aeron_driver_context_t *context);
+
 /**
  * Page size for alignment of all files.
  */
@@ -193,6 +347,16 @@ size_t aeron_driver_context_get_ipc_mtu_length(aeron_driver_context_t *context);
 int aeron_driver_context_set_ipc_publication_term_window_length(aeron_driver_context_t *context, size_t value);
 size_t aeron_driver_context_get_ipc_publication_term_window_length(aeron_driver_context_t *context);
 
+/**
+ * Should the limit of IPC Publications be advanced on every conductor duty cycle that sees subscribers consume, rather
+ * than once they have consumed an eighth of the window. The conductor then keeps spinning while an IPC pipeline flows
+ * instead of idling between limit updates and leaving a publisher stalled at its limit until it next wakes.
+ */
+#define AERON_IPC_PUBLICATION_EAGER_LIMIT_ENABLED_ENV_VAR "AERON_IPC_PUBLICATION_EAGER_LIMIT_ENABLED"
+
+int aeron_driver_context_set_ipc_publication_eager_limit_enabled(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_ipc_publication_eager_limit_enabled(aeron_driver_context_t *context);
+
 /**
  * Window limit on Publication side.
  */
@@ -225,6 +389,137 @@ size_t aeron_driver_context_get_socket_so_rcvbuf(aeron_driver_context_t *context
 int aeron_driver_context_set_socket_so_sndbuf(aeron_driver_context_t *context, size_t value);
 size_t aeron_driver_context_get_socket_so_sndbuf(aeron_driver_context_t *context);
 
+/**
+ * Should the sender hand runs of MTU sized frames to the kernel as one UDP_SEGMENT (GSO) send. Linux only.
+ */
+#define AERON_SOCKET_GSO_ENABLED_ENV_VAR "AERON_SOCKET_GSO_ENABLED"
+
+int aeron_driver_context_set_socket_gso_enabled(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_socket_gso_enabled(aeron_driver_context_t *context);
+
+/**
+ * Should receiving sockets accept coalesced UDP_GRO datagrams, which are split before dispatch. Linux only.
+ */
+#define AERON_SOCKET_GRO_ENABLED_ENV_VAR "AERON_SOCKET_GRO_ENABLED"
+
+int aeron_driver_context_set_socket_gro_enabled(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_socket_gro_enabled(aeron_driver_context_t *context);
+
+/**
+ * Should receiving sockets have a socket filter attached that drops data frames for streams with no subscription on
+ * the channel in the kernel, before they are copied to user space. Not applied when incoming interceptors are
+ * configured, as they may transform the frames. Linux only.
+ */
+#define AERON_SOCKET_STREAM_FILTER_ENABLED_ENV_VAR "AERON_SOCKET_STREAM_FILTER_ENABLED"
+
+int aeron_driver_context_set_socket_stream_filter_enabled(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_socket_stream_filter_enabled(aeron_driver_context_t *context);
+
+/**
+ * SO_BUSY_POLL setting in microseconds on the sockets of a Receiver running on its own thread, 0 to disable.
+ * Values above net.core.busy_read need CAP_NET_ADMIN. Linux only.
+ */
+#define AERON_SOCKET_BUSY_POLL_US_ENV_VAR "AERON_SOCKET_BUSY_POLL_US"
+
+int aeron_driver_context_set_socket_busy_poll_us(aeron_driver_context_t *context, uint32_t value);
+uint32_t aeron_driver_context_get_socket_busy_poll_us(aeron_driver_context_t *context);
+
+/**
+ * Should busy polled Receiver sockets also set SO_PREFER_BUSY_POLL to defer NIC interrupts while polling. Linux only.
+ */
+#define AERON_SOCKET_PREFER_BUSY_POLL_ENV_VAR "AERON_SOCKET_PREFER_BUSY_POLL"
+
+int aeron_driver_context_set_socket_prefer_busy_poll(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_socket_prefer_busy_poll(aeron_driver_context_t *context);
+
+/**
+ * Should receiving sockets request SO_TIMESTAMPING receive timestamps. The latest timestamp of each image, hardware
+ * if the NIC provides one or else software, is published in its rcv-ts counter in nanoseconds. Linux only.
+ */
+#define AERON_SOCKET_RX_TIMESTAMPING_ENABLED_ENV_VAR "AERON_SOCKET_RX_TIMESTAMPING_ENABLED"
+
+int aeron_driver_context_set_socket_rx_timestamping_enabled(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_socket_rx_timestamping_enabled(aeron_driver_context_t *context);
+
+/**
+ * Should socket buffers be sized per endpoint rather than only from the global SO_RCVBUF and SO_SNDBUF settings.
+ * Receiving sockets grow SO_RCVBUF to the receiver window of each image they carry and sending sockets grow SO_SNDBUF
+ * to a full send batch. Receiving sockets also report kernel drops (SO_RXQ_OVFL, Linux only) into a rcv-socket-drops
+ * counter per destination.
+ */
+#define AERON_SOCKET_BUFFER_AUTO_ENABLED_ENV_VAR "AERON_SOCKET_BUFFER_AUTO_ENABLED"
+
+int aeron_driver_context_set_socket_buffer_auto_enabled(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_socket_buffer_auto_enabled(aeron_driver_context_t *context);
+
+/**
+ * Should unicast publications discover the path MTU to their endpoint and pack frames into datagrams of up to that
+ * length, capped at 9000 byte jumbo frames. Frames stay within the publication MTU so only the datagram length grows.
+ * The path is probed periodically from the kernel route cache. Linux only.
+ */
+#define AERON_PMTU_DISCOVERY_ENABLED_ENV_VAR "AERON_PMTU_DISCOVERY_ENABLED"
+
+int aeron_driver_context_set_pmtu_discovery_enabled(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_pmtu_discovery_enabled(aeron_driver_context_t *context);
+
+/**
+ * Should the Receiver post its next receive for a single in order image straight into the image's term buffer rather
+ * than copying each datagram from a receive buffer. Falls back to the copying path for anything out of order.
+ */
+#define AERON_RECEIVER_ZERO_COPY_ENABLED_ENV_VAR "AERON_RECEIVER_ZERO_COPY_ENABLED"
+
+int aeron_driver_context_set_receiver_zero_copy_enabled(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_receiver_zero_copy_enabled(aeron_driver_context_t *context);
+
+/**
+ * Should images received over several destinations treat them as redundant paths for the same data, dropping copies
+ * of frames that have already arrived before they reach the term rebuilder and counting, per destination, the frames
+ * it delivered first, the duplicates it delivered and how far it lags the first arrival.
+ */
+#define AERON_RCV_REDUNDANT_PATH_ENABLED_ENV_VAR "AERON_RCV_REDUNDANT_PATH_ENABLED"
+
+int aeron_driver_context_set_rcv_redundant_path_enabled(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_rcv_redundant_path_enabled(aeron_driver_context_t *context);
+
+/**
+ * Should the Receiver create an image straight from the first data frame of a publication whose SETUP it has seen
+ * before on the same channel, using the cached initial term id, term length and MTU, rather than eliciting a new SETUP.
+ */
+#define AERON_RCV_FAST_JOIN_ENABLED_ENV_VAR "AERON_RCV_FAST_JOIN_ENABLED"
+
+int aeron_driver_context_set_rcv_fast_join_enabled(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_rcv_fast_join_enabled(aeron_driver_context_t *context);
+
+/**
+ * Should each network publication and image get histogram counters of sampled latencies. A publication counts the
+ * time from when the Sender first sees data appended until it is sent, and an image the time from when a packet is
+ * received until every subscriber position has passed it, so queueing in the driver can be told apart from a slow
+ * application.
+ */
+#define AERON_STREAM_LATENCY_COUNTERS_ENABLED_ENV_VAR "AERON_STREAM_LATENCY_COUNTERS_ENABLED"
+
+int aeron_driver_context_set_stream_latency_counters_enabled(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_stream_latency_counters_enabled(aeron_driver_context_t *context);
+
+/**
+ * Should each network publication and image get counters of the TSC ticks the Sender or Receiver spends on it. A
+ * publication counts sending, resending and handling status messages and NAKs, and an image counts rebuilding and
+ * sending status messages and NAKs, so the streams behind a saturated agent can be found without a profiler.
+ */
+#define AERON_STREAM_CPU_COUNTERS_ENABLED_ENV_VAR "AERON_STREAM_CPU_COUNTERS_ENABLED"
+
+int aeron_driver_context_set_stream_cpu_counters_enabled(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_stream_cpu_counters_enabled(aeron_driver_context_t *context);
+
+/**
+ * Number of transports up to which a poller reads each socket directly rather than waiting on epoll, kqueue or poll.
+ * Busy polling only takes effect on direct reads so this should cover the number of receive transports.
+ */
+#define AERON_UDP_TRANSPORT_POLLER_ITERATION_THRESHOLD_ENV_VAR "AERON_UDP_TRANSPORT_POLLER_ITERATION_THRESHOLD"
+
+int aeron_driver_context_set_udp_transport_poller_iteration_threshold(aeron_driver_context_t *context, size_t value);
+size_t aeron_driver_context_get_udp_transport_poller_iteration_threshold(aeron_driver_context_t *context);
+
 /**
  * IP_MULTICAST_TTL setting on outgoing UDP sockets.
  */
@@ -233,6 +528,15 @@ size_t aeron_driver_context_get_socket_so_sndbuf(aeron_driver_context_t *context
 int aeron_driver_context_set_socket_multicast_ttl(aeron_driver_context_t *context, uint8_t value);
 uint8_t aeron_driver_context_get_socket_multicast_ttl(aeron_driver_context_t *context);
 
+/**
+ * DSCP (0 to 63) to mark outgoing UDP datagrams with via IP_TOS or IPV6_TCLASS, covering data as well as the status
+ * messages and NAKs sent back by receivers. 0 leaves the socket default. Channels can override it with dscp=.
+ */
+#define AERON_SOCKET_DSCP_ENV_VAR "AERON_SOCKET_DSCP"
+
+int aeron_driver_context_set_socket_dscp(aeron_driver_context_t *context, uint8_t value);
+uint8_t aeron_driver_context_get_socket_dscp(aeron_driver_context_t *context);
+
 /**
  * Ratio of sending data to polling status messages in the Sender.
  */
@@ -241,6 +545,69 @@ uint8_t aeron_driver_context_get_socket_multicast_ttl(aeron_driver_context_t *co
 int aeron_driver_context_set_send_to_status_poll_ratio(aeron_driver_context_t *context, size_t value);
 size_t aeron_driver_context_get_send_to_status_poll_ratio(aeron_driver_context_t *context);
 
+/**
+ * Maximum number of datagrams a network publication will hand to a single sendmmsg call, between 1 and 64.
+ */
+#define AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND_ENV_VAR "AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND"
+
+int aeron_driver_context_set_network_publication_max_messages_per_send(aeron_driver_context_t *context, size_t value);
+size_t aeron_driver_context_get_network_publication_max_messages_per_send(aeron_driver_context_t *context);
+
+/**
+ * Should network publications sharing a send channel endpoint contribute their datagrams to a batch on the endpoint
+ * that the sender flushes with one sendmmsg at the end of its send pass, rather than each making its own call. Sends
+ * needing per datagram control messages, i.e. GSO or SO_TXTIME pacing, are not coalesced.
+ */
+#define AERON_NETWORK_PUBLICATION_SEND_COALESCING_ENV_VAR "AERON_NETWORK_PUBLICATION_SEND_COALESCING"
+
+int aeron_driver_context_set_network_publication_send_coalescing(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_network_publication_send_coalescing(aeron_driver_context_t *context);
+
+/**
+ * Should idle network publications back off their heartbeats. The interval doubles with each heartbeat sent while
+ * idle up to a quarter of the image liveness timeout and drops back as soon as data is sent. New subscribers to an
+ * idle stream may then take up to that interval to join.
+ */
+#define AERON_NETWORK_PUBLICATION_HEARTBEAT_BACKOFF_ENABLED_ENV_VAR "AERON_NETWORK_PUBLICATION_HEARTBEAT_BACKOFF_ENABLED"
+
+int aeron_driver_context_set_network_publication_heartbeat_backoff_enabled(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_network_publication_heartbeat_backoff_enabled(aeron_driver_context_t *context);
+
+/**
+ * Number of datagrams the Receiver reads in a single recvmmsg call, between 1 and 256.
+ */
+#define AERON_RECEIVER_IO_VECTOR_CAPACITY_ENV_VAR "AERON_RECEIVER_IO_VECTOR_CAPACITY"
+
+int aeron_driver_context_set_receiver_io_vector_capacity(aeron_driver_context_t *context, size_t value);
+size_t aeron_driver_context_get_receiver_io_vector_capacity(aeron_driver_context_t *context);
+
+/**
+ * Number of control messages the Sender reads in a single recvmmsg call, between 1 and 256.
+ */
+#define AERON_SENDER_IO_VECTOR_CAPACITY_ENV_VAR "AERON_SENDER_IO_VECTOR_CAPACITY"
+
+int aeron_driver_context_set_sender_io_vector_capacity(aeron_driver_context_t *context, size_t value);
+size_t aeron_driver_context_get_sender_io_vector_capacity(aeron_driver_context_t *context);
+
+/**
+ * Number of Receiver agents, each with its own thread and poller, between 1 and 16. Receive channel endpoints are
+ * assigned to the least loaded agent when created. Values greater than 1 require the DEDICATED threading mode.
+ */
+#define AERON_RECEIVER_SHARD_COUNT_ENV_VAR "AERON_RECEIVER_SHARD_COUNT"
+
+int aeron_driver_context_set_receiver_shard_count(aeron_driver_context_t *context, size_t value);
+size_t aeron_driver_context_get_receiver_shard_count(aeron_driver_context_t *context);
+
+/**
+ * Number of Sender agents, each with its own thread and poller, between 1 and 16. Send channel endpoints, and the
+ * network publications on them, are assigned to the agent with the fewest publications when created. Values greater
+ * than 1 require the DEDICATED threading mode.
+ */
+#define AERON_SENDER_SHARD_COUNT_ENV_VAR "AERON_SENDER_SHARD_COUNT"
+
+int aeron_driver_context_set_sender_shard_count(aeron_driver_context_t *context, size_t value);
+size_t aeron_driver_context_get_sender_shard_count(aeron_driver_context_t *context);
+
 /**
  * Status Message timeout in nanoseconds.
  */
@@ -249,6 +616,52 @@ size_t aeron_driver_context_get_send_to_status_poll_ratio(aeron_driver_context_t
 int aeron_driver_context_set_rcv_status_message_timeout_ns(aeron_driver_context_t *context, uint64_t value);
 uint64_t aeron_driver_context_get_rcv_status_message_timeout_ns(aeron_driver_context_t *context);
 
+/**
+ * Should the status messages of all images on a receive channel endpoint be sent in one sendmmsg per duty cycle.
+ */
+#define AERON_RCV_STATUS_MESSAGE_BATCHING_ENV_VAR "AERON_RCV_STATUS_MESSAGE_BATCHING"
+
+int aeron_driver_context_set_rcv_status_message_batching(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_rcv_status_message_batching(aeron_driver_context_t *context);
+
+/**
+ * Should batched status messages for the same control address be packed into one datagram, implies batching.
+ * Requires senders that read every status message frame in a datagram.
+ */
+#define AERON_RCV_STATUS_MESSAGE_PACKING_ENV_VAR "AERON_RCV_STATUS_MESSAGE_PACKING"
+
+int aeron_driver_context_set_rcv_status_message_packing(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_rcv_status_message_packing(aeron_driver_context_t *context);
+
+/**
+ * Should NAKs and RTTMs be queued with the status messages of a receive channel endpoint and sent in one sendmmsg at
+ * the end of the Receiver duty cycle, rather than a syscall each while data is being read. Implies SM batching.
+ */
+#define AERON_RCV_CONTROL_MESSAGE_BATCHING_ENV_VAR "AERON_RCV_CONTROL_MESSAGE_BATCHING"
+
+int aeron_driver_context_set_rcv_control_message_batching(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_rcv_control_message_batching(aeron_driver_context_t *context);
+
+/**
+ * Should images adapt their status message cadence to consumption and to how close the sender is to its window limit,
+ * sending less often while subscribers keep well inside the window and early when the sender nears the limit. Images
+ * measure RTT when this is set.
+ */
+#define AERON_RCV_STATUS_MESSAGE_ADAPTIVE_ENV_VAR "AERON_RCV_STATUS_MESSAGE_ADAPTIVE"
+
+int aeron_driver_context_set_rcv_status_message_adaptive(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_rcv_status_message_adaptive(aeron_driver_context_t *context);
+
+/**
+ * Max rate in bytes per second each image accepts data frames at, 0 for unlimited. Frames over the rate are dropped
+ * before they are inserted and, for a while after, the image advertises a receiver window no larger than its burst so
+ * a flooding publisher is held back rather than monopolising the receiver.
+ */
+#define AERON_RCV_IMAGE_RATE_LIMIT_ENV_VAR "AERON_RCV_IMAGE_RATE_LIMIT"
+
+int aeron_driver_context_set_rcv_image_rate_limit(aeron_driver_context_t *context, uint64_t value);
+uint64_t aeron_driver_context_get_rcv_image_rate_limit(aeron_driver_context_t *context);
+
 typedef struct aeron_flow_control_strategy_stct aeron_flow_control_strategy_t;
 
 typedef struct aeron_udp_channel_stct aeron_udp_channel_t;
@@ -265,6 +678,7 @@ typedef int (*aeron_flow_control_strategy_supplier_func_t)(
 #define AERON_MULTICAST_MIN_FLOW_CONTROL_STRATEGY_NAME "multicast_min"
 #define AERON_MULTICAST_MAX_FLOW_CONTROL_STRATEGY_NAME "multicast_max"
 #define AERON_MULTICAST_TAGGED_FLOW_CONTROL_STRATEGY_NAME "multicast_tagged"
+#define AERON_MULTICAST_QUORUM_FLOW_CONTROL_STRATEGY_NAME "multicast_quorum"
 #define AERON_UNICAST_MAX_FLOW_CONTROL_STRATEGY_NAME "unicast_max"
 
 /**
@@ -348,6 +762,16 @@ aeron_congestion_control_strategy_supplier_func_t aeron_driver_context_get_conge
 int aeron_driver_context_set_loss_report_buffer_length(aeron_driver_context_t *context, size_t value);
 size_t aeron_driver_context_get_loss_report_buffer_length(aeron_driver_context_t *context);
 
+/**
+ * Number of records kept in each of the sender and receiver trace rings of the trace file, for frames marked for
+ * tracing by the aeron_trace_reserved_value_supplier of publishers. Rounded up to a power of two and at most 2^24.
+ * 0, the default, disables tracing and the file.
+ */
+#define AERON_TRACE_RING_CAPACITY_ENV_VAR "AERON_TRACE_RING_CAPACITY"
+
+int aeron_driver_context_set_trace_ring_capacity(aeron_driver_context_t *context, size_t value);
+size_t aeron_driver_context_get_trace_ring_capacity(aeron_driver_context_t *context);
+
 /**
  * Timeout for publication unblock in nanoseconds.
  */
@@ -372,6 +796,17 @@ uint64_t aeron_driver_context_get_publication_connection_timeout_ns(aeron_driver
 int aeron_driver_context_set_timer_interval_ns(aeron_driver_context_t *context, uint64_t value);
 uint64_t aeron_driver_context_get_timer_interval_ns(aeron_driver_context_t *context);
 
+/**
+ * Longest time (in nanoseconds) conductor work is deferred in the SHARED threading mode while the sender and receiver
+ * are busy, 0 to run the conductor on every duty cycle. When set the data path runs first on each cycle and the
+ * conductor only runs when the data path was idle, client commands are pending or the budget has elapsed. IPC
+ * publication limits are updated by the conductor so the budget should be well under the time to fill a term window.
+ */
+#define AERON_SHARED_CONDUCTOR_BUDGET_ENV_VAR "AERON_SHARED_CONDUCTOR_BUDGET"
+
+int aeron_driver_context_set_shared_conductor_budget_ns(aeron_driver_context_t *context, uint64_t value);
+uint64_t aeron_driver_context_get_shared_conductor_budget_ns(aeron_driver_context_t *context);
+
 /**
  * Idle strategy to be employed by Sender for DEDICATED Threading Mode.
  */
@@ -499,6 +934,30 @@ int64_t aeron_driver_context_get_flow_control_group_tag(aeron_driver_context_t *
 int aeron_driver_context_set_flow_control_group_min_size(aeron_driver_context_t *context, int32_t value);
 int32_t aeron_driver_context_get_flow_control_group_min_size(aeron_driver_context_t *context);
 
+/**
+ * Should the CUBIC congestion control strategy measure RTT or use the initial RTT as a constant.
+ */
+#define AERON_CUBICCONGESTIONCONTROL_MEASURERTT_ENV_VAR "AERON_CUBICCONGESTIONCONTROL_MEASURERTT"
+
+int aeron_driver_context_set_cubic_congestion_control_measure_rtt(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_cubic_congestion_control_measure_rtt(aeron_driver_context_t *context);
+
+/**
+ * Initial RTT in nanoseconds used by the CUBIC congestion control strategy.
+ */
+#define AERON_CUBICCONGESTIONCONTROL_INITIALRTT_ENV_VAR "AERON_CUBICCONGESTIONCONTROL_INITIALRTT"
+
+int aeron_driver_context_set_cubic_congestion_control_initial_rtt_ns(aeron_driver_context_t *context, uint64_t value);
+uint64_t aeron_driver_context_get_cubic_congestion_control_initial_rtt_ns(aeron_driver_context_t *context);
+
+/**
+ * Should the CUBIC congestion control strategy account for TCP behaviour at low RTT after a loss.
+ */
+#define AERON_CUBICCONGESTIONCONTROL_TCPMODE_ENV_VAR "AERON_CUBICCONGESTIONCONTROL_TCPMODE"
+
+int aeron_driver_context_set_cubic_congestion_control_tcp_mode(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_cubic_congestion_control_tcp_mode(aeron_driver_context_t *context);
+
 /**
  * Default receiver tag to be sent on status messages from channel to handle tagged flow control.
  */
@@ -588,6 +1047,23 @@ uint64_t aeron_driver_context_get_driver_timeout_ms(aeron_driver_context_t *cont
 int aeron_driver_context_set_nak_multicast_group_size(aeron_driver_context_t *context, size_t value);
 size_t aeron_driver_context_get_nak_multicast_group_size(aeron_driver_context_t *context);
 
+/**
+ * Max number of gaps in an image NAKed together when the NAK timer of the first gap expires, 1 NAKs only the first gap.
+ */
+#define AERON_NAK_MAX_GAPS_ENV_VAR "AERON_NAK_MAX_GAPS"
+
+int aeron_driver_context_set_nak_max_gaps(aeron_driver_context_t *context, size_t value);
+size_t aeron_driver_context_get_nak_max_gaps(aeron_driver_context_t *context);
+
+/**
+ * Should each image adapt its NAK delay and multicast NAK backoff to its measured RTT. Images measure RTT when this
+ * is set, and use the configured unicast delay and multicast max backoff until the first measurement arrives.
+ */
+#define AERON_NAK_RTT_ADAPTIVE_ENV_VAR "AERON_NAK_RTT_ADAPTIVE"
+
+int aeron_driver_context_set_nak_rtt_adaptive(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_nak_rtt_adaptive(aeron_driver_context_t *context);
+
 /**
  * Max backoff time for multicast NAK delay randomisation in nanoseconds.
  */
@@ -620,6 +1096,32 @@ uint64_t aeron_driver_context_get_retransmit_unicast_delay_ns(aeron_driver_conte
 int aeron_driver_context_set_retransmit_unicast_linger_ns(aeron_driver_context_t *context, uint64_t value);
 uint64_t aeron_driver_context_get_retransmit_unicast_linger_ns(aeron_driver_context_t *context);
 
+/**
+ * Max rate in bytes per second each network publication may retransmit, 0 for unlimited. Resends beyond the budget
+ * are deferred until it refills and further NAKs for a deferred range are merged into it.
+ */
+#define AERON_RETRANSMIT_BUDGET_RATE_ENV_VAR "AERON_RETRANSMIT_BUDGET_RATE"
+
+int aeron_driver_context_set_retransmit_budget_rate(aeron_driver_context_t *context, uint64_t value);
+uint64_t aeron_driver_context_get_retransmit_budget_rate(aeron_driver_context_t *context);
+
+/**
+ * Max rate in bytes per second all network publications of a sender may retransmit together, 0 for unlimited.
+ */
+#define AERON_SENDER_RETRANSMIT_BUDGET_RATE_ENV_VAR "AERON_SENDER_RETRANSMIT_BUDGET_RATE"
+
+int aeron_driver_context_set_sender_retransmit_budget_rate(aeron_driver_context_t *context, uint64_t value);
+uint64_t aeron_driver_context_get_sender_retransmit_budget_rate(aeron_driver_context_t *context);
+
+/**
+ * Max number of receivers of a multicast publication which may NAK a range for it to be repaired by unicast to their
+ * control addresses rather than resent to the group, 0 to always resend to the group. At most 4.
+ */
+#define AERON_RETRANSMIT_UNICAST_REPAIR_THRESHOLD_ENV_VAR "AERON_RETRANSMIT_UNICAST_REPAIR_THRESHOLD"
+
+int aeron_driver_context_set_retransmit_unicast_repair_threshold(aeron_driver_context_t *context, size_t value);
+size_t aeron_driver_context_get_retransmit_unicast_repair_threshold(aeron_driver_context_t *context);
+
 /**
  * Group semantics for network subscriptions.
  */
@@ -748,6 +1250,127 @@ const char *aeron_driver_context_get_name_resolver_init_args(aeron_driver_contex
 int aeron_driver_context_set_re_resolution_check_interval_ns(aeron_driver_context_t *context, uint64_t value);
 uint64_t aeron_driver_context_get_re_resolution_check_interval_ns(aeron_driver_context_t *context);
 
+/**
+ * Should re-resolution of endpoint and control names be done on a background thread rather than by the conductor. Only
+ * applies when the default name resolver is in use, a custom resolver is always invoked on the conductor.
+ */
+#define AERON_DRIVER_RERESOLUTION_ASYNC_ENV_VAR "AERON_DRIVER_RERESOLUTION_ASYNC"
+
+int aeron_driver_context_set_re_resolution_async(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_re_resolution_async(aeron_driver_context_t *context);
+
+/**
+ * Endpoint on which the driver serves its counters and loss report in the Prometheus text format on GET /metrics.
+ * The format is hostname:port and follows the URI format for the interface parameter. Requests are served by an agent
+ * on its own thread which reads the CnC and loss report files directly. Not set by default which disables it.
+ */
+#define AERON_DRIVER_METRICS_HTTP_ENDPOINT_ENV_VAR "AERON_DRIVER_METRICS_HTTP_ENDPOINT"
+
+int aeron_driver_context_set_metrics_http_endpoint(aeron_driver_context_t *context, const char *value);
+const char *aeron_driver_context_get_metrics_http_endpoint(aeron_driver_context_t *context);
+
+/**
+ * Channel whose images are recorded to segment files by an agent embedded in the driver. Prefix the channel with
+ * aeron:spy: to record publications from this driver. Not set by default which disables the recorder.
+ */
+#define AERON_DRIVER_RECORDER_CHANNEL_ENV_VAR "AERON_DRIVER_RECORDER_CHANNEL"
+
+int aeron_driver_context_set_recorder_channel(aeron_driver_context_t *context, const char *value);
+const char *aeron_driver_context_get_recorder_channel(aeron_driver_context_t *context);
+
+/**
+ * Stream id on the recorder channel which is recorded.
+ */
+#define AERON_DRIVER_RECORDER_STREAM_ID_ENV_VAR "AERON_DRIVER_RECORDER_STREAM_ID"
+
+int aeron_driver_context_set_recorder_stream_id(aeron_driver_context_t *context, int32_t value);
+int32_t aeron_driver_context_get_recorder_stream_id(aeron_driver_context_t *context);
+
+/**
+ * Directory holding the recorder catalog and segment files. Segment files follow the archive naming of
+ * recordingId-segmentBasePosition.rec.
+ */
+#define AERON_DRIVER_RECORDER_DIR_ENV_VAR "AERON_DRIVER_RECORDER_DIR"
+
+int aeron_driver_context_set_recorder_dir(aeron_driver_context_t *context, const char *value);
+const char *aeron_driver_context_get_recorder_dir(aeron_driver_context_t *context);
+
+/**
+ * Length of each recorder segment file. Must be a power of 2 and a multiple of the term length of recorded streams.
+ */
+#define AERON_DRIVER_RECORDER_SEGMENT_LENGTH_ENV_VAR "AERON_DRIVER_RECORDER_SEGMENT_LENGTH"
+
+int aeron_driver_context_set_recorder_segment_length(aeron_driver_context_t *context, size_t value);
+size_t aeron_driver_context_get_recorder_segment_length(aeron_driver_context_t *context);
+
+/**
+ * Duty cycle time for the conductor, sender and receiver agents above which the cycle is counted as exceeding the
+ * threshold and recorded in the error log.
+ */
+#define AERON_DRIVER_CONDUCTOR_CYCLE_THRESHOLD_ENV_VAR "AERON_DRIVER_CONDUCTOR_CYCLE_THRESHOLD"
+
+int aeron_driver_context_set_conductor_cycle_threshold_ns(aeron_driver_context_t *context, uint64_t value);
+uint64_t aeron_driver_context_get_conductor_cycle_threshold_ns(aeron_driver_context_t *context);
+
+#define AERON_DRIVER_SENDER_CYCLE_THRESHOLD_ENV_VAR "AERON_DRIVER_SENDER_CYCLE_THRESHOLD"
+
+int aeron_driver_context_set_sender_cycle_threshold_ns(aeron_driver_context_t *context, uint64_t value);
+uint64_t aeron_driver_context_get_sender_cycle_threshold_ns(aeron_driver_context_t *context);
+
+#define AERON_DRIVER_RECEIVER_CYCLE_THRESHOLD_ENV_VAR "AERON_DRIVER_RECEIVER_CYCLE_THRESHOLD"
+
+int aeron_driver_context_set_receiver_cycle_threshold_ns(aeron_driver_context_t *context, uint64_t value);
+uint64_t aeron_driver_context_get_receiver_cycle_threshold_ns(aeron_driver_context_t *context);
+
+/**
+ * List of cpus, e.g. "1,3-5", to pin the conductor, sender and receiver agent threads to. The conductor setting also
+ * applies to the shared agent and the sender setting to the shared network agent, sender and receiver shard threads
+ * use the setting of their agent.
+ */
+#define AERON_CONDUCTOR_CPU_AFFINITY_ENV_VAR "AERON_CONDUCTOR_CPU_AFFINITY"
+
+int aeron_driver_context_set_conductor_cpu_affinity(aeron_driver_context_t *context, const char *value);
+const char *aeron_driver_context_get_conductor_cpu_affinity(aeron_driver_context_t *context);
+
+#define AERON_SENDER_CPU_AFFINITY_ENV_VAR "AERON_SENDER_CPU_AFFINITY"
+
+int aeron_driver_context_set_sender_cpu_affinity(aeron_driver_context_t *context, const char *value);
+const char *aeron_driver_context_get_sender_cpu_affinity(aeron_driver_context_t *context);
+
+#define AERON_RECEIVER_CPU_AFFINITY_ENV_VAR "AERON_RECEIVER_CPU_AFFINITY"
+
+int aeron_driver_context_set_receiver_cpu_affinity(aeron_driver_context_t *context, const char *value);
+const char *aeron_driver_context_get_receiver_cpu_affinity(aeron_driver_context_t *context);
+
+/**
+ * SCHED_FIFO priority for the conductor, sender and receiver agent threads, applied in the same way as the cpu
+ * affinity. 0 leaves a thread with the default scheduling policy.
+ */
+#define AERON_CONDUCTOR_FIFO_PRIORITY_ENV_VAR "AERON_CONDUCTOR_FIFO_PRIORITY"
+
+int aeron_driver_context_set_conductor_fifo_priority(aeron_driver_context_t *context, int32_t value);
+int32_t aeron_driver_context_get_conductor_fifo_priority(aeron_driver_context_t *context);
+
+#define AERON_SENDER_FIFO_PRIORITY_ENV_VAR "AERON_SENDER_FIFO_PRIORITY"
+
+int aeron_driver_context_set_sender_fifo_priority(aeron_driver_context_t *context, int32_t value);
+int32_t aeron_driver_context_get_sender_fifo_priority(aeron_driver_context_t *context);
+
+#define AERON_RECEIVER_FIFO_PRIORITY_ENV_VAR "AERON_RECEIVER_FIFO_PRIORITY"
+
+int aeron_driver_context_set_receiver_fifo_priority(aeron_driver_context_t *context, int32_t value);
+int32_t aeron_driver_context_get_receiver_fifo_priority(aeron_driver_context_t *context);
+
+/**
+ * Use a nano clock derived from the invariant TSC, calibrated at startup and re-synced against the monotonic clock,
+ * instead of calling clock_gettime. Setting it fails if the cpu has no invariant TSC, the environment variable falls
+ * back to the monotonic clock.
+ */
+#define AERON_DRIVER_TSC_NANO_CLOCK_ENV_VAR "AERON_DRIVER_TSC_NANO_CLOCK"
+
+int aeron_driver_context_set_use_tsc_nano_clock(aeron_driver_context_t *context, bool value);
+bool aeron_driver_context_get_use_tsc_nano_clock(aeron_driver_context_t *context);
+
 /**
  * Set the list of filenames to dynamic libraries to load upon context init.
  */
@@ -38,6 +38,14 @@
 #include "aeron_windows.h"
 #include "aeron_alloc.h"
 #include "util/aeron_arrayutil.h"
+#include "util/aeron_bitutil.h"
+#include "concurrent/aeron_atomic.h"
+
+#if defined(_MSC_VER)
+#define AERON_DRIVER_AGENT_THREAD_LOCAL __declspec(thread)
+#else
+#define AERON_DRIVER_AGENT_THREAD_LOCAL __thread
+#endif
 
 #if !defined(HAVE_STRUCT_MMSGHDR)
 struct mmsghdr
@@ -63,6 +71,27 @@ static aeron_driver_agent_dynamic_dissector_entry_t *dynamic_dissector_entries =
 static size_t num_dynamic_dissector_entries = 0;
 static aeron_thread_t log_reader_thread;
 
+typedef struct aeron_driver_agent_producer_stct
+{
+    aeron_spsc_rb_t rb;
+    uint8_t *buffer;
+    uint64_t frame_count;
+    int64_t rate_window_start_ms[AERON_EVENT_LOG_EVENT_TYPE_COUNT];
+    uint32_t rate_window_count[AERON_EVENT_LOG_EVENT_TYPE_COUNT];
+    int64_t dropped_count[AERON_EVENT_LOG_EVENT_TYPE_COUNT];
+}
+aeron_driver_agent_producer_t;
+
+static bool binary_mode = false;
+static size_t frame_capture_length = MAX_FRAME_LENGTH;
+static uint32_t frame_sample_interval = 1;
+static uint32_t max_events_per_second = 0;
+static aeron_driver_agent_producer_t *producers[AERON_EVENT_LOG_MAX_PRODUCERS];
+static int32_t producer_count = 0;
+static int32_t producer_generation = 1;
+static AERON_DRIVER_AGENT_THREAD_LOCAL aeron_driver_agent_producer_t *thread_producer = NULL;
+static AERON_DRIVER_AGENT_THREAD_LOCAL int32_t thread_producer_generation = 0;
+
 aeron_mpsc_rb_t *aeron_driver_agent_mpsc_rb()
 {
     return &logging_mpsc_rb;
@@ -86,17 +115,198 @@ void aeron_agent_format_date(char *str, size_t count, int64_t timestamp)
     snprintf(str, count, "%s%s%s", time_buffer, msec_buffer, tz_buffer);
 }
 
+static aeron_driver_agent_producer_t *aeron_driver_agent_producer()
+{
+    int32_t generation;
+    AERON_GET_VOLATILE(generation, producer_generation);
+
+    if (thread_producer_generation == generation)
+    {
+        return thread_producer;
+    }
+
+    /* claim a ring once per thread, threads beyond the limit share the MPSC ring without sampling or rate limits */
+    aeron_driver_agent_producer_t *producer = NULL;
+    int32_t index;
+    AERON_GET_AND_ADD_INT32(index, producer_count, 1);
+
+    if (index < AERON_EVENT_LOG_MAX_PRODUCERS)
+    {
+        size_t rb_length = AERON_EVENT_LOG_PRODUCER_RING_BUFFER_LENGTH + AERON_RB_TRAILER_LENGTH;
+
+        if (aeron_alloc((void **)&producer, sizeof(aeron_driver_agent_producer_t)) < 0 ||
+            aeron_alloc((void **)&producer->buffer, rb_length) < 0 ||
+            aeron_spsc_rb_init(&producer->rb, producer->buffer, rb_length) < 0)
+        {
+            fprintf(stderr, "could not allocate event log producer ring buffer. exiting.\n");
+            exit(EXIT_FAILURE);
+        }
+
+        AERON_PUT_ORDERED(producers[index], producer);
+    }
+
+    thread_producer = producer;
+    thread_producer_generation = generation;
+
+    return producer;
+}
+
+aeron_spsc_rb_t *aeron_driver_agent_producer_rb()
+{
+    aeron_driver_agent_producer_t *producer = aeron_driver_agent_producer();
+
+    return NULL == producer ? NULL : &producer->rb;
+}
+
+size_t aeron_driver_agent_read_binary_log(aeron_rb_handler_t handler, void *clientd, size_t limit)
+{
+    size_t messages_read = 0;
+    int32_t count;
+    AERON_GET_VOLATILE(count, producer_count);
+    count = count < AERON_EVENT_LOG_MAX_PRODUCERS ? count : AERON_EVENT_LOG_MAX_PRODUCERS;
+
+    for (int32_t i = 0; i < count; i++)
+    {
+        aeron_driver_agent_producer_t *producer;
+        AERON_GET_VOLATILE(producer, producers[i]);
+
+        if (NULL != producer)
+        {
+            messages_read += aeron_spsc_rb_read(&producer->rb, handler, clientd, limit);
+        }
+    }
+
+    messages_read += aeron_mpsc_rb_read(&logging_mpsc_rb, handler, clientd, limit);
+
+    return messages_read;
+}
+
+void aeron_driver_agent_write_binary_log_header(FILE *fpout)
+{
+    aeron_driver_agent_binary_log_header_t header;
+
+    memcpy(header.magic, AERON_EVENT_LOG_BINARY_MAGIC, sizeof(header.magic));
+    header.version = AERON_EVENT_LOG_BINARY_VERSION;
+    header.reserved = 0;
+
+    fwrite(&header, sizeof(header), 1, fpout);
+}
+
+void aeron_driver_agent_write_binary_record(int32_t msg_type_id, const void *message, size_t length, void *clientd)
+{
+    FILE *fpout = (FILE *)clientd;
+    int32_t record_header[2];
+
+    /* the dissector function pointer means nothing outside of this process */
+    if (AERON_ADD_DYNAMIC_DISSECTOR == msg_type_id)
+    {
+        return;
+    }
+
+    record_header[0] = msg_type_id;
+    record_header[1] = (int32_t)length;
+
+    fwrite(record_header, sizeof(record_header), 1, fpout);
+    fwrite(message, length, 1, fpout);
+}
+
 static void *aeron_driver_agent_log_reader(void *arg)
 {
     while (true)
     {
-        aeron_mpsc_rb_read(&logging_mpsc_rb, aeron_driver_agent_log_dissector, NULL, 10);
+        if (binary_mode)
+        {
+            if (aeron_driver_agent_read_binary_log(aeron_driver_agent_write_binary_record, logfp, 64) > 0)
+            {
+                fflush(logfp);
+            }
+        }
+        else
+        {
+            aeron_mpsc_rb_read(&logging_mpsc_rb, aeron_driver_agent_log_dissector, NULL, 10);
+        }
+
         aeron_nano_sleep(1000 * 1000);
     }
 
     return NULL;
 }
 
+static bool aeron_driver_agent_is_frame_event(int32_t event_type)
+{
+    return AERON_FRAME_IN == event_type || AERON_FRAME_OUT == event_type || AERON_FRAME_IN_DROPPED == event_type;
+}
+
+bool aeron_driver_agent_is_event_admitted(int32_t event_type)
+{
+    if (!binary_mode)
+    {
+        return true;
+    }
+
+    aeron_driver_agent_producer_t *producer = aeron_driver_agent_producer();
+    if (NULL == producer)
+    {
+        return true;
+    }
+
+    if (frame_sample_interval > 1 && aeron_driver_agent_is_frame_event(event_type) &&
+        0 != (producer->frame_count++ % frame_sample_interval))
+    {
+        return false;
+    }
+
+    int type_index = aeron_number_of_trailing_zeroes(event_type);
+    if (0 == max_events_per_second || type_index >= AERON_EVENT_LOG_EVENT_TYPE_COUNT)
+    {
+        return true;
+    }
+
+    int64_t now_ms = aeron_epoch_clock();
+    if (now_ms - producer->rate_window_start_ms[type_index] >= 1000)
+    {
+        if (producer->dropped_count[type_index] > 0)
+        {
+            aeron_driver_agent_dropped_log_header_t hdr;
+
+            hdr.time_ms = now_ms;
+            hdr.dropped_count = producer->dropped_count[type_index];
+            hdr.event_type = event_type;
+            hdr.reserved = 0;
+
+            aeron_spsc_rb_write(&producer->rb, AERON_EVENT_LOG_DROPPED, &hdr, sizeof(hdr));
+        }
+
+        producer->rate_window_start_ms[type_index] = now_ms;
+        producer->rate_window_count[type_index] = 0;
+        producer->dropped_count[type_index] = 0;
+    }
+
+    if (producer->rate_window_count[type_index] >= max_events_per_second)
+    {
+        producer->dropped_count[type_index]++;
+        return false;
+    }
+
+    producer->rate_window_count[type_index]++;
+
+    return true;
+}
+
+void aeron_driver_agent_log_event(int32_t event_type, const void *message, size_t length)
+{
+    aeron_driver_agent_producer_t *producer = binary_mode ? aeron_driver_agent_producer() : NULL;
+
+    if (NULL != producer)
+    {
+        aeron_spsc_rb_write(&producer->rb, event_type, message, length);
+    }
+    else
+    {
+        aeron_mpsc_rb_write(&logging_mpsc_rb, event_type, message, length);
+    }
+}
+
 void aeron_init_logging_ring_buffer()
 {
     size_t rb_length = RING_BUFFER_LENGTH + AERON_RB_TRAILER_LENGTH;
@@ -115,6 +325,15 @@ void aeron_init_logging_ring_buffer()
     }
 }
 
+void aeron_init_logging_binary_mode(
+    size_t new_frame_capture_length, uint32_t new_frame_sample_interval, uint32_t new_max_events_per_second)
+{
+    frame_capture_length = new_frame_capture_length < MAX_FRAME_LENGTH ? new_frame_capture_length : MAX_FRAME_LENGTH;
+    frame_sample_interval = new_frame_sample_interval > 1 ? new_frame_sample_interval : 1;
+    max_events_per_second = new_max_events_per_second;
+    binary_mode = true;
+}
+
 void aeron_free_logging_ring_buffer()
 {
     if (NULL != rb_buffer)
@@ -122,6 +341,23 @@ void aeron_free_logging_ring_buffer()
        aeron_free(rb_buffer);
        rb_buffer = NULL;
     }
+
+    for (int32_t i = 0; i < AERON_EVENT_LOG_MAX_PRODUCERS; i++)
+    {
+        if (NULL != producers[i])
+        {
+            aeron_free(producers[i]->buffer);
+            aeron_free(producers[i]);
+            producers[i] = NULL;
+        }
+    }
+
+    producer_count = 0;
+    producer_generation++;
+    binary_mode = false;
+    frame_capture_length = MAX_FRAME_LENGTH;
+    frame_sample_interval = 1;
+    max_events_per_second = 0;
 }
 
 void aeron_set_logging_mask(uint64_t new_mask)
@@ -133,6 +369,7 @@ static void initialize_agent_logging()
 {
     char *mask_str = getenv(AERON_AGENT_MASK_ENV_VAR);
     char *log_filename = getenv(AERON_EVENT_LOG_FILENAME_ENV_VAR);
+    char *mode_str = getenv(AERON_EVENT_LOG_MODE_ENV_VAR);
 
     if (mask_str)
     {
@@ -141,10 +378,18 @@ static void initialize_agent_logging()
 
     if (mask != 0)
     {
+        bool is_binary = NULL != mode_str && 0 == strcmp(mode_str, "binary");
+
+        if (is_binary && NULL == log_filename)
+        {
+            fprintf(stderr, "binary event log requires %s to be set. exiting.\n", AERON_EVENT_LOG_FILENAME_ENV_VAR);
+            exit(EXIT_FAILURE);
+        }
+
         logfp = stdout;
         if (log_filename)
         {
-            if ((logfp = fopen(log_filename, "a")) == NULL)
+            if ((logfp = fopen(log_filename, is_binary ? "wb" : "a")) == NULL)
             {
                 int errcode = errno;
 
@@ -156,48 +401,100 @@ static void initialize_agent_logging()
 
         aeron_init_logging_ring_buffer();
 
-        if (aeron_thread_create(&log_reader_thread, NULL, aeron_driver_agent_log_reader, NULL) != 0)
+        if (is_binary)
+        {
+            char *capture_length_str = getenv(AERON_EVENT_LOG_FRAME_CAPTURE_LENGTH_ENV_VAR);
+            char *sample_interval_str = getenv(AERON_EVENT_LOG_FRAME_SAMPLE_INTERVAL_ENV_VAR);
+            char *rate_limit_str = getenv(AERON_EVENT_LOG_RATE_LIMIT_ENV_VAR);
+
+            aeron_init_logging_binary_mode(
+                capture_length_str ?
+                    (size_t)strtoull(capture_length_str, NULL, 0) : AERON_EVENT_LOG_BINARY_FRAME_CAPTURE_LENGTH_DEFAULT,
+                sample_interval_str ? (uint32_t)strtoul(sample_interval_str, NULL, 0) : 1,
+                rate_limit_str ? (uint32_t)strtoul(rate_limit_str, NULL, 0) : 0);
+
+            aeron_driver_agent_write_binary_log_header(logfp);
+            fflush(logfp);
+        }
+
+        pthread_attr_t attr;
+        char *reader_cpu_affinity = getenv(AERON_EVENT_LOG_READER_CPU_AFFINITY_ENV_VAR);
+
+        if (aeron_thread_attr_init(&attr) != 0)
+        {
+            fprintf(stderr, "could not initialize log reader thread attributes. exiting.\n");
+            exit(EXIT_FAILURE);
+        }
+
+        if (NULL != reader_cpu_affinity && aeron_thread_attr_set_affinity(&attr, reader_cpu_affinity) != 0)
+        {
+            fprintf(stderr, "could not set log reader cpu affinity %s. exiting.\n", reader_cpu_affinity);
+            exit(EXIT_FAILURE);
+        }
+
+        if (aeron_thread_create(&log_reader_thread, &attr, aeron_driver_agent_log_reader, NULL) != 0)
         {
             fprintf(stderr, "could not start log reader thread. exiting.\n");
             exit(EXIT_FAILURE);
         }
 
-        fprintf(logfp, "%s\n", aeron_driver_agent_dissect_log_start(aeron_epoch_clock()));
+        if (!is_binary)
+        {
+            fprintf(logfp, "%s\n", aeron_driver_agent_dissect_log_start(aeron_epoch_clock()));
+        }
     }
 }
 
 void aeron_driver_agent_conductor_to_driver_interceptor(
     int32_t msg_type_id, const void *message, size_t length, void *clientd)
 {
+    if (!aeron_driver_agent_is_event_admitted(AERON_CMD_IN))
+    {
+        return;
+    }
+
     uint8_t buffer[MAX_CMD_LENGTH + sizeof(aeron_driver_agent_cmd_log_header_t)];
     aeron_driver_agent_cmd_log_header_t *hdr = (aeron_driver_agent_cmd_log_header_t *)buffer;
     hdr->time_ms = aeron_epoch_clock();
     hdr->cmd_id = msg_type_id;
     memcpy(buffer + sizeof(aeron_driver_agent_cmd_log_header_t), message, length);
 
-    aeron_mpsc_rb_write(&logging_mpsc_rb, AERON_CMD_IN, buffer, length + sizeof(aeron_driver_agent_cmd_log_header_t));
+    aeron_driver_agent_log_event(AERON_CMD_IN, buffer, length + sizeof(aeron_driver_agent_cmd_log_header_t));
 }
 
 void aeron_driver_agent_conductor_to_client_interceptor(
     aeron_driver_conductor_t *conductor, int32_t msg_type_id, const void *message, size_t length)
 {
+    if (!aeron_driver_agent_is_event_admitted(AERON_CMD_OUT))
+    {
+        return;
+    }
+
     uint8_t buffer[MAX_CMD_LENGTH + sizeof(aeron_driver_agent_cmd_log_header_t)];
     aeron_driver_agent_cmd_log_header_t *hdr = (aeron_driver_agent_cmd_log_header_t *)buffer;
     hdr->time_ms = aeron_epoch_clock();
     hdr->cmd_id = msg_type_id;
     memcpy(buffer + sizeof(aeron_driver_agent_cmd_log_header_t), message, length);
 
-    aeron_mpsc_rb_write(&logging_mpsc_rb, AERON_CMD_OUT, buffer, length + sizeof(aeron_driver_agent_cmd_log_header_t));
+    aeron_driver_agent_log_event(AERON_CMD_OUT, buffer, length + sizeof(aeron_driver_agent_cmd_log_header_t));
 }
 
 int aeron_driver_agent_map_raw_log_interceptor(
     aeron_mapped_raw_log_t *mapped_raw_log,
     const char *path,
     bool use_sparse_files,
+    bool use_huge_pages,
+    int32_t numa_node,
     uint64_t term_length,
     uint64_t page_size)
 {
-    int result = aeron_map_raw_log(mapped_raw_log, path, use_sparse_files, term_length, page_size);
+    int result = aeron_map_raw_log(
+        mapped_raw_log, path, use_sparse_files, use_huge_pages, numa_node, term_length, page_size);
+
+    if (!aeron_driver_agent_is_event_admitted(AERON_MAP_RAW_LOG_OP))
+    {
+        return result;
+    }
 
     uint8_t buffer[AERON_MAX_PATH + sizeof(aeron_driver_agent_map_raw_log_op_header_t)];
     aeron_driver_agent_map_raw_log_op_header_t *hdr = (aeron_driver_agent_map_raw_log_op_header_t *)buffer;
@@ -210,14 +507,19 @@ int aeron_driver_agent_map_raw_log_interceptor(
     memcpy(&hdr->map_raw.map_raw_log.log, mapped_raw_log, sizeof(hdr->map_raw.map_raw_log.log));
     memcpy(buffer + sizeof(aeron_driver_agent_map_raw_log_op_header_t), path, path_len);
 
-    aeron_mpsc_rb_write(
-        &logging_mpsc_rb, AERON_MAP_RAW_LOG_OP, buffer, sizeof(aeron_driver_agent_map_raw_log_op_header_t) + path_len);
+    aeron_driver_agent_log_event(
+        AERON_MAP_RAW_LOG_OP, buffer, sizeof(aeron_driver_agent_map_raw_log_op_header_t) + path_len);
 
     return result;
 }
 
 int aeron_driver_agent_map_raw_log_close_interceptor(aeron_mapped_raw_log_t *mapped_raw_log, const char *filename)
 {
+    if (!aeron_driver_agent_is_event_admitted(AERON_MAP_RAW_LOG_OP_CLOSE))
+    {
+        return aeron_map_raw_log_close(mapped_raw_log, filename);
+    }
+
     uint8_t buffer[AERON_MAX_PATH + sizeof(aeron_driver_agent_map_raw_log_op_header_t)];
     aeron_driver_agent_map_raw_log_op_header_t *hdr = (aeron_driver_agent_map_raw_log_op_header_t *)buffer;
 
@@ -226,8 +528,8 @@ int aeron_driver_agent_map_raw_log_close_interceptor(aeron_mapped_raw_log_t *map
     memcpy(&hdr->map_raw.map_raw_log_close.log, mapped_raw_log, sizeof(hdr->map_raw.map_raw_log.log));
     hdr->map_raw.map_raw_log_close.result = aeron_map_raw_log_close(mapped_raw_log, filename);
 
-    aeron_mpsc_rb_write(
-        &logging_mpsc_rb, AERON_MAP_RAW_LOG_OP_CLOSE, buffer, sizeof(aeron_driver_agent_map_raw_log_op_header_t));
+    aeron_driver_agent_log_event(
+        AERON_MAP_RAW_LOG_OP_CLOSE, buffer, sizeof(aeron_driver_agent_map_raw_log_op_header_t));
 
     return hdr->map_raw.map_raw_log_close.result;
 }
@@ -235,6 +537,11 @@ int aeron_driver_agent_map_raw_log_close_interceptor(aeron_mapped_raw_log_t *map
 void aeron_driver_agent_log_frame(
     int32_t msg_type_id, const struct msghdr *msghdr, int result, int32_t message_len)
 {
+    if (!aeron_driver_agent_is_event_admitted(msg_type_id))
+    {
+        return;
+    }
+
     uint8_t buffer[MAX_FRAME_LENGTH + sizeof(aeron_driver_agent_frame_log_header_t) + sizeof(struct sockaddr_storage)];
     aeron_driver_agent_frame_log_header_t *hdr = (aeron_driver_agent_frame_log_header_t *)buffer;
     size_t length = sizeof(aeron_driver_agent_frame_log_header_t);
@@ -254,11 +561,11 @@ void aeron_driver_agent_log_frame(
     length += msghdr->msg_namelen;
 
     ptr += msghdr->msg_namelen;
-    int32_t copy_length = message_len < MAX_FRAME_LENGTH ? message_len : MAX_FRAME_LENGTH;
+    int32_t copy_length = message_len < (int32_t)frame_capture_length ? message_len : (int32_t)frame_capture_length;
     memcpy(ptr, msghdr->msg_iov[0].iov_base, (size_t)copy_length);
     length += copy_length;
 
-    aeron_mpsc_rb_write(&logging_mpsc_rb, msg_type_id, buffer, (size_t)length);
+    aeron_driver_agent_log_event(msg_type_id, buffer, (size_t)length);
 }
 
 int aeron_driver_agent_outgoing_mmsg(
@@ -352,6 +659,12 @@ void aeron_driver_agent_untethered_subscription_state_change_interceptor(
     int32_t stream_id,
     int32_t session_id)
 {
+    if (!aeron_driver_agent_is_event_admitted(AERON_UNTETHERED_SUBSCRIPTION_STATE_CHANGE))
+    {
+        aeron_untethered_subscription_state_change(tetherable_position, now_ns, new_state, stream_id, session_id);
+        return;
+    }
+
     uint8_t buffer[sizeof(aeron_driver_agent_untethered_subscription_state_change_log_header_t)];
     aeron_driver_agent_untethered_subscription_state_change_log_header_t *hdr =
         (aeron_driver_agent_untethered_subscription_state_change_log_header_t *)buffer;
@@ -365,8 +678,7 @@ void aeron_driver_agent_untethered_subscription_state_change_interceptor(
 
     aeron_untethered_subscription_state_change(tetherable_position, now_ns, new_state, stream_id, session_id);
 
-    aeron_mpsc_rb_write(
-        &logging_mpsc_rb,
+    aeron_driver_agent_log_event(
         AERON_UNTETHERED_SUBSCRIPTION_STATE_CHANGE,
         buffer,
         sizeof(aeron_driver_agent_untethered_subscription_state_change_log_header_t));
@@ -403,6 +715,8 @@ int aeron_init_logging_events_interceptors(aeron_driver_context_t *context)
         incoming_bindings->incoming_transport_notification_func = NULL;
         incoming_bindings->incoming_publication_notification_func = NULL;
         incoming_bindings->incoming_image_notification_func = NULL;
+        incoming_bindings->outgoing_do_work_func = NULL;
+        incoming_bindings->incoming_do_work_func = NULL;
 
         incoming_bindings->meta_info.name = "logging";
         incoming_bindings->meta_info.type = "interceptor";
@@ -448,6 +762,8 @@ int aeron_init_logging_events_interceptors(aeron_driver_context_t *context)
         outgoing_bindings->incoming_transport_notification_func = NULL;
         outgoing_bindings->incoming_publication_notification_func = NULL;
         outgoing_bindings->incoming_image_notification_func = NULL;
+        outgoing_bindings->outgoing_do_work_func = NULL;
+        outgoing_bindings->incoming_do_work_func = NULL;
 
         outgoing_bindings->meta_info.name = "logging";
         outgoing_bindings->meta_info.type = "interceptor";
@@ -542,8 +858,7 @@ int64_t aeron_driver_agent_add_dynamic_dissector(aeron_driver_agent_generic_diss
     AERON_GET_AND_ADD_INT64(hdr->index, dynamic_dissector_index, 1);
     hdr->dissector_func = func;
 
-    aeron_mpsc_rb_write(
-        &logging_mpsc_rb,
+    aeron_driver_agent_log_event(
         AERON_ADD_DYNAMIC_DISSECTOR,
         buffer,
         sizeof(aeron_driver_agent_add_dissector_header_t));
@@ -553,6 +868,11 @@ int64_t aeron_driver_agent_add_dynamic_dissector(aeron_driver_agent_generic_diss
 
 void aeron_driver_agent_log_dynamic_event(int64_t index, const void *message, size_t length)
 {
+    if (!aeron_driver_agent_is_event_admitted(AERON_DYNAMIC_DISSECTOR_EVENT))
+    {
+        return;
+    }
+
     uint8_t buffer[MAX_FRAME_LENGTH + sizeof(aeron_driver_agent_dynamic_event_header_t)];
     aeron_driver_agent_dynamic_event_header_t *hdr =
         (aeron_driver_agent_dynamic_event_header_t *)buffer;
@@ -562,8 +882,7 @@ void aeron_driver_agent_log_dynamic_event(int64_t index, const void *message, si
     hdr->index = index;
     memcpy(buffer + sizeof(aeron_driver_agent_dynamic_event_header_t), message, copy_length);
 
-    aeron_mpsc_rb_write(
-        &logging_mpsc_rb,
+    aeron_driver_agent_log_event(
         AERON_DYNAMIC_DISSECTOR_EVENT,
         buffer,
         sizeof(aeron_driver_agent_dynamic_event_header_t) + copy_length);
@@ -597,6 +916,15 @@ static const char *dissect_command_type_id(int64_t cmd_type_id)
         case AERON_COMMAND_TERMINATE_DRIVER:
             return "TERMINATE_DRIVER";
 
+        case AERON_COMMAND_ADD_DIRECTED_RESPONSES:
+            return "ADD_DIRECTED_RESPONSES";
+
+        case AERON_COMMAND_ADD_COUNTER_LEASE:
+            return "ADD_COUNTER_LEASE";
+
+        case AERON_COMMAND_COUNTER_LEASE_UPDATE:
+            return "COUNTER_LEASE_UPDATE";
+
         default:
             return "unknown command";
     }
@@ -707,6 +1035,30 @@ static const char *dissect_cmd_in(int64_t cmd_id, const void *message, size_t le
             break;
         }
 
+        case AERON_COMMAND_ADD_COUNTER_LEASE:
+        {
+            aeron_counter_lease_command_t *command = (aeron_counter_lease_command_t *)message;
+
+            snprintf(buffer, sizeof(buffer) - 1, "ADD_COUNTER_LEASE %d [%" PRId64 ":%" PRId64 "]",
+                command->counter_count,
+                command->correlated.client_id,
+                command->correlated.correlation_id);
+            break;
+        }
+
+        case AERON_COMMAND_COUNTER_LEASE_UPDATE:
+        {
+            aeron_counter_lease_update_t *command = (aeron_counter_lease_update_t *)message;
+
+            snprintf(buffer, sizeof(buffer) - 1, "COUNTER_LEASE_UPDATE %d %" PRId64 " %s [%" PRId64 ":%" PRId64 "]",
+                command->counter_id,
+                command->registration_id,
+                command->is_allocated ? "allocated" : "freed",
+                command->correlated.client_id,
+                command->correlated.correlation_id);
+            break;
+        }
+
         case AERON_COMMAND_CLIENT_CLOSE:
         {
             aeron_correlated_command_t *command = (aeron_correlated_command_t *)message;
@@ -717,6 +1069,16 @@ static const char *dissect_cmd_in(int64_t cmd_id, const void *message, size_t le
             break;
         }
 
+        case AERON_COMMAND_ADD_DIRECTED_RESPONSES:
+        {
+            aeron_correlated_command_t *command = (aeron_correlated_command_t *)message;
+
+            snprintf(buffer, sizeof(buffer) - 1, "ADD_DIRECTED_RESPONSES [%" PRId64 ":%" PRId64 "]",
+                command->client_id,
+                command->correlation_id);
+            break;
+        }
+
         case AERON_COMMAND_TERMINATE_DRIVER:
         {
             aeron_terminate_driver_command_t *command = (aeron_terminate_driver_command_t *)message;
@@ -845,6 +1207,16 @@ static const char *dissect_cmd_out(int64_t cmd_id, const void *message, size_t l
             break;
         }
 
+        case AERON_RESPONSE_ON_COUNTER_LEASE_READY:
+        {
+            aeron_counter_lease_ready_t *command = (aeron_counter_lease_ready_t *)message;
+
+            snprintf(buffer, sizeof(buffer) - 1, "ON_COUNTER_LEASE_READY %" PRId64 " %d",
+                command->correlation_id,
+                command->counter_count);
+            break;
+        }
+
         case AERON_RESPONSE_ON_CLIENT_TIMEOUT:
         {
             aeron_client_timeout_t *command = (aeron_client_timeout_t *)message;
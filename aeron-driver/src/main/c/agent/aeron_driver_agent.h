@@ -19,13 +19,34 @@
 
 #include "aeron_driver_conductor.h"
 #include "command/aeron_control_protocol.h"
+#include "concurrent/aeron_spsc_rb.h"
 
 #define AERON_AGENT_MASK_ENV_VAR "AERON_EVENT_LOG"
 #define AERON_EVENT_LOG_FILENAME_ENV_VAR "AERON_EVENT_LOG_FILENAME"
+#define AERON_EVENT_LOG_READER_CPU_AFFINITY_ENV_VAR "AERON_EVENT_LOG_READER_CPU_AFFINITY"
 #define RING_BUFFER_LENGTH (8 * 1024 * 1024)
 #define MAX_CMD_LENGTH (512)
 #define MAX_FRAME_LENGTH (1408)
 
+/*
+ * Binary mode writes raw event records to AERON_EVENT_LOG_FILENAME for decoding offline with EventLogTool rather than
+ * dissecting them to text on the reader thread. Each producing thread gets its own SPSC ring buffer, frames are
+ * captured up to AERON_EVENT_LOG_FRAME_CAPTURE_LENGTH, can be sampled, and each event type can be rate limited per
+ * producing thread with the number of events dropped by the limit recorded as AERON_EVENT_LOG_DROPPED.
+ */
+#define AERON_EVENT_LOG_MODE_ENV_VAR "AERON_EVENT_LOG_MODE"
+#define AERON_EVENT_LOG_FRAME_CAPTURE_LENGTH_ENV_VAR "AERON_EVENT_LOG_FRAME_CAPTURE_LENGTH"
+#define AERON_EVENT_LOG_FRAME_SAMPLE_INTERVAL_ENV_VAR "AERON_EVENT_LOG_FRAME_SAMPLE_INTERVAL"
+#define AERON_EVENT_LOG_RATE_LIMIT_ENV_VAR "AERON_EVENT_LOG_RATE_LIMIT"
+
+#define AERON_EVENT_LOG_BINARY_FRAME_CAPTURE_LENGTH_DEFAULT (64)
+#define AERON_EVENT_LOG_PRODUCER_RING_BUFFER_LENGTH (1024 * 1024)
+#define AERON_EVENT_LOG_MAX_PRODUCERS (16)
+#define AERON_EVENT_LOG_EVENT_TYPE_COUNT (9)
+
+#define AERON_EVENT_LOG_BINARY_MAGIC "AERONEVT"
+#define AERON_EVENT_LOG_BINARY_VERSION (1)
+
 #define AERON_CMD_IN (0x01)
 #define AERON_CMD_OUT (0x02)
 #define AERON_FRAME_IN (0x04)
@@ -38,6 +59,28 @@
 
 /* commands only (not mask values) */
 #define AERON_ADD_DYNAMIC_DISSECTOR (0x010000)
+#define AERON_EVENT_LOG_DROPPED (0x020000)
+
+/*
+ * Binary log file layout, all little endian: the header below followed by records of an int32 event type and int32
+ * payload length, the payload being the event header struct for the type followed by its variable length data.
+ */
+typedef struct aeron_driver_agent_binary_log_header_stct
+{
+    char magic[8];
+    int32_t version;
+    int32_t reserved;
+}
+aeron_driver_agent_binary_log_header_t;
+
+typedef struct aeron_driver_agent_dropped_log_header_stct
+{
+    int64_t time_ms;
+    int64_t dropped_count;
+    int32_t event_type;
+    int32_t reserved;
+}
+aeron_driver_agent_dropped_log_header_t;
 
 typedef struct aeron_driver_agent_cmd_log_header_stct
 {
@@ -134,6 +177,33 @@ void aeron_free_logging_ring_buffer();
 
 void aeron_set_logging_mask(uint64_t new_mask);
 
+void aeron_init_logging_binary_mode(
+    size_t frame_capture_length, uint32_t frame_sample_interval, uint32_t max_events_per_second);
+
+/*
+ * Should an event of the given type be recorded by the calling thread, always true in text mode. Checked before an
+ * event is built so sampled out and rate limited events cost next to nothing.
+ */
+bool aeron_driver_agent_is_event_admitted(int32_t event_type);
+
+void aeron_driver_agent_log_event(int32_t event_type, const void *message, size_t length);
+
+void aeron_driver_agent_log_frame(int32_t msg_type_id, const struct msghdr *msghdr, int result, int32_t message_len);
+
+void aeron_driver_agent_conductor_to_driver_interceptor(
+    int32_t msg_type_id, const void *message, size_t length, void *clientd);
+
+void aeron_driver_agent_conductor_to_client_interceptor(
+    aeron_driver_conductor_t *conductor, int32_t msg_type_id, const void *message, size_t length);
+
+aeron_spsc_rb_t *aeron_driver_agent_producer_rb();
+
+size_t aeron_driver_agent_read_binary_log(aeron_rb_handler_t handler, void *clientd, size_t limit);
+
+void aeron_driver_agent_write_binary_log_header(FILE *fpout);
+
+void aeron_driver_agent_write_binary_record(int32_t msg_type_id, const void *message, size_t length, void *clientd);
+
 void aeron_driver_agent_untethered_subscription_state_change_interceptor(
     aeron_tetherable_position_t *tetherable_position,
     int64_t now_ns,
@@ -0,0 +1,108 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _BSD_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <string.h>
+
+#include "util/aeron_platform.h"
+#include "concurrent/aeron_atomic.h"
+#include "concurrent/aeron_term_cleaner.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define AERON_TERM_CLEANER_HAS_NON_TEMPORAL_STORES
+#endif
+
+#if !defined(AERON_COMPILER_MSVC)
+#include <sys/mman.h>
+#endif
+
+void aeron_term_cleaner_init(aeron_term_cleaner_t *cleaner, aeron_term_buffer_clean_mode_t mode, size_t page_size)
+{
+    cleaner->mode = mode;
+    cleaner->page_size = page_size;
+}
+
+static void aeron_term_cleaner_zero_non_temporal(uint8_t *addr, size_t length)
+{
+#if defined(AERON_TERM_CLEANER_HAS_NON_TEMPORAL_STORES)
+    uint8_t *end = addr + length;
+    uint8_t *cursor = (uint8_t *)(((uintptr_t)addr + 15) & ~(uintptr_t)15);
+    cursor = cursor > end ? end : cursor;
+    const __m128i zero = _mm_setzero_si128();
+
+    memset(addr, 0, (size_t)(cursor - addr));
+
+    for (; cursor + 16 <= end; cursor += 16)
+    {
+        _mm_stream_si128((__m128i *)cursor, zero);
+    }
+
+    memset(cursor, 0, (size_t)(end - cursor));
+
+    /* streaming stores are weakly ordered so must be fenced before the first word is released */
+    _mm_sfence();
+#else
+    memset(addr, 0, length);
+#endif
+}
+
+static void aeron_term_cleaner_zero_punch_hole(uint8_t *addr, size_t length, size_t page_size)
+{
+#if defined(MADV_REMOVE)
+    uint8_t *end = addr + length;
+    uint8_t *first_page = (uint8_t *)(((uintptr_t)addr + (page_size - 1)) & ~(uintptr_t)(page_size - 1));
+    uint8_t *last_page = (uint8_t *)((uintptr_t)end & ~(uintptr_t)(page_size - 1));
+
+    if (last_page > first_page && 0 == madvise(first_page, (size_t)(last_page - first_page), MADV_REMOVE))
+    {
+        memset(addr, 0, (size_t)(first_page - addr));
+        memset(last_page, 0, (size_t)(end - last_page));
+        return;
+    }
+#endif
+
+    memset(addr, 0, length);
+}
+
+void aeron_term_cleaner_clean(aeron_term_cleaner_t *cleaner, uint8_t *term_buffer, size_t term_offset, size_t length)
+{
+    uint8_t *addr = term_buffer + term_offset + sizeof(int64_t);
+    const size_t remaining = length - sizeof(int64_t);
+
+    switch (cleaner->mode)
+    {
+        case AERON_TERM_BUFFER_CLEAN_MODE_NON_TEMPORAL:
+            aeron_term_cleaner_zero_non_temporal(addr, remaining);
+            break;
+
+        case AERON_TERM_BUFFER_CLEAN_MODE_PUNCH_HOLE:
+            aeron_term_cleaner_zero_punch_hole(addr, remaining, cleaner->page_size);
+            break;
+
+        case AERON_TERM_BUFFER_CLEAN_MODE_MEMSET:
+        default:
+            memset(addr, 0, remaining);
+            break;
+    }
+
+    uint64_t *ptr = (uint64_t *)(term_buffer + term_offset);
+    AERON_PUT_ORDERED(*ptr, (uint64_t)0);
+}
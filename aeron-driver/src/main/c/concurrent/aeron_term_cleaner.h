@@ -0,0 +1,40 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_TERM_CLEANER_H
+#define AERON_TERM_CLEANER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "aeronmd.h"
+
+typedef struct aeron_term_cleaner_stct
+{
+    aeron_term_buffer_clean_mode_t mode;
+    size_t page_size;
+}
+aeron_term_cleaner_t;
+
+void aeron_term_cleaner_init(aeron_term_cleaner_t *cleaner, aeron_term_buffer_clean_mode_t mode, size_t page_size);
+
+/*
+ * Zero a consumed region of a term, releasing the first word last so a frame length is only seen as zero once the
+ * rest of the region is clean.
+ */
+void aeron_term_cleaner_clean(aeron_term_cleaner_t *cleaner, uint8_t *term_buffer, size_t term_offset, size_t length);
+
+#endif //AERON_TERM_CLEANER_H
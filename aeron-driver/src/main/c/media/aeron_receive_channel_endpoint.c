@@ -14,6 +14,11 @@
  * limitations under the License.
  */
 
+#if defined(__linux__)
+#define _BSD_SOURCE
+#define _GNU_SOURCE
+#endif
+
 #include <stdio.h>
 #include <inttypes.h>
 #include <aeron_driver_context.h>
@@ -26,6 +31,15 @@
 #include "collections/aeron_int64_to_ptr_hash_map.h"
 #include "media/aeron_receive_channel_endpoint.h"
 #include "aeron_driver_receiver.h"
+#include "aeron_driver_tracepoints.h"
+
+#if !defined(HAVE_STRUCT_MMSGHDR)
+struct mmsghdr
+{
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif
 
 int aeron_receive_channel_endpoint_set_group_tag(
     aeron_receive_channel_endpoint_t *endpoint,
@@ -59,6 +73,7 @@ int aeron_receive_channel_endpoint_create(
     aeron_receive_destination_t *straight_through_destination,
     aeron_atomic_counter_t *status_indicator,
     aeron_system_counters_t *system_counters,
+    aeron_driver_receiver_proxy_t *receiver_proxy,
     aeron_driver_context_t *context)
 {
     aeron_receive_channel_endpoint_t *_endpoint = NULL;
@@ -70,7 +85,7 @@ int aeron_receive_channel_endpoint_create(
     }
 
     if (aeron_data_packet_dispatcher_init(
-        &_endpoint->dispatcher, context->conductor_proxy, context->receiver_proxy->receiver) < 0)
+        &_endpoint->dispatcher, context->conductor_proxy, receiver_proxy->receiver) < 0)
     {
         return -1;
     }
@@ -93,16 +108,22 @@ int aeron_receive_channel_endpoint_create(
     _endpoint->conductor_fields.managed_resource.clientd = _endpoint;
     _endpoint->conductor_fields.managed_resource.registration_id = -1;
     _endpoint->conductor_fields.status = AERON_RECEIVE_CHANNEL_ENDPOINT_STATUS_ACTIVE;
+    _endpoint->conductor_fields.has_inline_receive_stream = false;
+    _endpoint->conductor_fields.inline_receive_stream_id = 0;
     _endpoint->channel_status.counter_id = -1;
     _endpoint->transport_bindings = context->udp_channel_transport_bindings;
 
     _endpoint->has_receiver_released = false;
+    _endpoint->is_checksum_enabled = channel->is_checksum_enabled;
+    _endpoint->has_shared_counters = context->receiver_shard_count > 1;
+    _endpoint->is_stream_filter_enabled =
+        context->socket_stream_filter_enabled && NULL == context->udp_channel_incoming_interceptor_bindings;
 
     _endpoint->channel_status.counter_id = status_indicator->counter_id;
     _endpoint->channel_status.value_addr = status_indicator->value_addr;
 
     _endpoint->receiver_id = context->next_receiver_id++;
-    _endpoint->receiver_proxy = context->receiver_proxy;
+    _endpoint->receiver_proxy = receiver_proxy;
 
     if (aeron_receive_channel_endpoint_set_group_tag(_endpoint, channel, context) < 0)
     {
@@ -110,12 +131,21 @@ int aeron_receive_channel_endpoint_create(
         return -1;
     }
 
-    _endpoint->short_sends_counter = aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_SHORT_SENDS);
+    _endpoint->short_sends_counter = aeron_system_counter_writer_addr(
+        system_counters, AERON_SYSTEM_COUNTER_SHORT_SENDS, AERON_SYSTEM_COUNTER_WRITER_RECEIVER);
     _endpoint->possible_ttl_asymmetry_counter =
         aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_POSSIBLE_TTL_ASYMMETRY);
+    _endpoint->checksum_failures_counter =
+        aeron_system_counter_addr(system_counters, AERON_SYSTEM_COUNTER_CHECKSUM_FAILURES);
 
     _endpoint->cached_clock = context->cached_clock;
 
+    _endpoint->control_batch.is_nak_and_rttm_enabled = context->control_message_batching;
+    _endpoint->control_batch.is_enabled =
+        context->status_message_batching || context->status_message_packing || context->control_message_batching;
+    _endpoint->control_batch.is_packing = context->status_message_packing;
+    _endpoint->control_batch.length = 0;
+
     if (NULL != straight_through_destination)
     {
         if (aeron_receive_channel_endpoint_add_destination(_endpoint, straight_through_destination) < 0)
@@ -147,7 +177,10 @@ int aeron_receive_channel_endpoint_delete(
 
         if (endpoint->conductor_fields.status != AERON_RECEIVE_CHANNEL_ENDPOINT_STATUS_CLOSED)
         {
-            endpoint->transport_bindings->close_func(&destination->transport);
+            for (size_t j = 0, count = aeron_receive_destination_transport_count(destination); j < count; j++)
+            {
+                endpoint->transport_bindings->close_func(aeron_receive_destination_transport(destination, j));
+            }
         }
 
         // The endpoint will be deleted by the destination, for simple endpoints, i.e. non-mds the channel is shared.
@@ -171,7 +204,10 @@ int aeron_receive_channel_endpoint_close(aeron_receive_channel_endpoint_t *endpo
     for (size_t i = 0, len = endpoint->destinations.length; i < len; i++)
     {
         aeron_receive_destination_t *destination = endpoint->destinations.array[i].destination;
-        endpoint->transport_bindings->close_func(&destination->transport);
+        for (size_t j = 0, count = aeron_receive_destination_transport_count(destination); j < count; j++)
+        {
+            endpoint->transport_bindings->close_func(aeron_receive_destination_transport(destination, j));
+        }
     }
 
     endpoint->conductor_fields.status = AERON_RECEIVE_CHANNEL_ENDPOINT_STATUS_CLOSED;
@@ -195,9 +231,9 @@ int aeron_receive_channel_endpoint_sendmsg(aeron_receive_channel_endpoint_t *end
     return min_bytes_sent;
 }
 
-int aeron_receive_channel_endpoint_send_sm(
+static size_t aeron_receive_channel_endpoint_write_sm(
     aeron_receive_channel_endpoint_t *endpoint,
-    struct sockaddr_storage *addr,
+    uint8_t *buffer,
     int32_t stream_id,
     int32_t session_id,
     int32_t term_id,
@@ -205,14 +241,10 @@ int aeron_receive_channel_endpoint_send_sm(
     int32_t receiver_window,
     uint8_t flags)
 {
-    uint8_t buffer[sizeof(aeron_status_message_header_t) + sizeof(aeron_status_message_optional_header_t)];
     aeron_status_message_header_t *sm_header = (aeron_status_message_header_t *)buffer;
     aeron_status_message_optional_header_t *sm_optional_header =
         (aeron_status_message_optional_header_t *)(buffer + sizeof(aeron_status_message_header_t));
 
-    struct iovec iov[1];
-    struct msghdr msghdr;
-
     const int32_t frame_length = endpoint->group_tag.is_present ?
         sizeof(aeron_status_message_header_t) + sizeof(aeron_status_message_optional_header_t) :
         sizeof(aeron_status_message_header_t);
@@ -229,8 +261,28 @@ int aeron_receive_channel_endpoint_send_sm(
     sm_header->receiver_id = endpoint->receiver_id;
     sm_optional_header->group_tag = endpoint->group_tag.value;
 
+    return (size_t)frame_length;
+}
+
+int aeron_receive_channel_endpoint_send_sm(
+    aeron_receive_channel_endpoint_t *endpoint,
+    struct sockaddr_storage *addr,
+    int32_t stream_id,
+    int32_t session_id,
+    int32_t term_id,
+    int32_t term_offset,
+    int32_t receiver_window,
+    uint8_t flags)
+{
+    uint8_t buffer[AERON_RECEIVE_CHANNEL_ENDPOINT_SM_MAX_LENGTH];
+    struct iovec iov[1];
+    struct msghdr msghdr;
+
+    AERON_DRIVER_TRACEPOINT6(sm_send, session_id, stream_id, term_id, term_offset, receiver_window, flags);
+
     iov[0].iov_base = buffer;
-    iov[0].iov_len = (size_t)frame_length;
+    iov[0].iov_len = aeron_receive_channel_endpoint_write_sm(
+        endpoint, buffer, stream_id, session_id, term_id, term_offset, receiver_window, flags);
     msghdr.msg_iov = iov;
     msghdr.msg_iovlen = 1;
     msghdr.msg_flags = 0;
@@ -251,6 +303,159 @@ int aeron_receive_channel_endpoint_send_sm(
     return bytes_sent;
 }
 
+static aeron_receive_channel_endpoint_pending_control_t *aeron_receive_channel_endpoint_next_control_entry(
+    aeron_receive_channel_endpoint_t *endpoint, struct sockaddr_storage *addr)
+{
+    if (AERON_RECEIVE_CHANNEL_ENDPOINT_SM_BATCH_CAPACITY == endpoint->control_batch.length &&
+        aeron_receive_channel_endpoint_flush_control_frames(endpoint) < 0)
+    {
+        return NULL;
+    }
+
+    aeron_receive_channel_endpoint_pending_control_t *entry =
+        &endpoint->control_batch.entries[endpoint->control_batch.length++];
+
+    memcpy(&entry->addr, addr, AERON_ADDR_LEN(addr));
+
+    return entry;
+}
+
+int aeron_receive_channel_endpoint_queue_sm(
+    aeron_receive_channel_endpoint_t *endpoint,
+    struct sockaddr_storage *addr,
+    int32_t stream_id,
+    int32_t session_id,
+    int32_t term_id,
+    int32_t term_offset,
+    int32_t receiver_window,
+    uint8_t flags)
+{
+    if (!endpoint->control_batch.is_enabled)
+    {
+        return aeron_receive_channel_endpoint_send_sm(
+            endpoint, addr, stream_id, session_id, term_id, term_offset, receiver_window, flags);
+    }
+
+    aeron_receive_channel_endpoint_pending_control_t *entry =
+        aeron_receive_channel_endpoint_next_control_entry(endpoint, addr);
+    if (NULL == entry)
+    {
+        return -1;
+    }
+
+    entry->frame_length = aeron_receive_channel_endpoint_write_sm(
+        endpoint, entry->frame, stream_id, session_id, term_id, term_offset, receiver_window, flags);
+
+    return 0;
+}
+
+static bool aeron_receive_channel_endpoint_is_same_address(struct sockaddr_storage *lhs, struct sockaddr_storage *rhs)
+{
+    if (lhs->ss_family == rhs->ss_family)
+    {
+        size_t len = AF_INET == lhs->ss_family ? sizeof(struct sockaddr_in) : sizeof(struct sockaddr_in6);
+
+        return 0 == memcmp(lhs, rhs, len);
+    }
+
+    return false;
+}
+
+static inline bool aeron_receive_channel_endpoint_is_sm_entry(
+    aeron_receive_channel_endpoint_pending_control_t *entry)
+{
+    return AERON_HDR_TYPE_SM == ((aeron_frame_header_t *)entry->frame)->type;
+}
+
+int aeron_receive_channel_endpoint_flush_control_frames(aeron_receive_channel_endpoint_t *endpoint)
+{
+    const size_t length = endpoint->control_batch.length;
+
+    if (0 == length)
+    {
+        return 0;
+    }
+
+    struct mmsghdr mmsghdr[AERON_RECEIVE_CHANNEL_ENDPOINT_SM_BATCH_CAPACITY];
+    struct iovec iov[AERON_RECEIVE_CHANNEL_ENDPOINT_SM_BATCH_CAPACITY];
+    aeron_receive_channel_endpoint_pending_control_t *entries = endpoint->control_batch.entries;
+    size_t vlen = 0;
+    size_t iov_count = 0;
+
+    for (size_t i = 0; i < length; i++)
+    {
+        entries[i].is_assigned = false;
+    }
+
+    for (size_t i = 0; i < length; i++)
+    {
+        if (entries[i].is_assigned)
+        {
+            continue;
+        }
+
+        const size_t first_iov = iov_count;
+        const bool is_packing = endpoint->control_batch.is_packing && aeron_receive_channel_endpoint_is_sm_entry(
+            &entries[i]);
+        size_t datagram_length = entries[i].frame_length;
+
+        entries[i].is_assigned = true;
+        iov[iov_count].iov_base = entries[i].frame;
+        iov[iov_count++].iov_len = entries[i].frame_length;
+
+        for (size_t j = i + 1; is_packing && j < length; j++)
+        {
+            if (!entries[j].is_assigned &&
+                aeron_receive_channel_endpoint_is_sm_entry(&entries[j]) &&
+                datagram_length + entries[j].frame_length <= AERON_RECEIVE_CHANNEL_ENDPOINT_SM_PACK_LENGTH &&
+                aeron_receive_channel_endpoint_is_same_address(&entries[i].addr, &entries[j].addr))
+            {
+                entries[j].is_assigned = true;
+                iov[iov_count].iov_base = entries[j].frame;
+                iov[iov_count++].iov_len = entries[j].frame_length;
+                datagram_length += entries[j].frame_length;
+            }
+        }
+
+        mmsghdr[vlen].msg_hdr.msg_name = &entries[i].addr;
+        mmsghdr[vlen].msg_hdr.msg_namelen = AERON_ADDR_LEN(&entries[i].addr);
+        mmsghdr[vlen].msg_hdr.msg_iov = &iov[first_iov];
+        mmsghdr[vlen].msg_hdr.msg_iovlen = iov_count - first_iov;
+        mmsghdr[vlen].msg_hdr.msg_flags = 0;
+        mmsghdr[vlen].msg_hdr.msg_control = NULL;
+        mmsghdr[vlen].msg_hdr.msg_controllen = 0;
+        mmsghdr[vlen].msg_len = 0;
+        vlen++;
+    }
+
+    endpoint->control_batch.length = 0;
+
+    const int result = aeron_receive_channel_endpoint_sendmmsg(endpoint, mmsghdr, vlen);
+    if (result >= 0 && (size_t)result < vlen)
+    {
+        aeron_counter_increment(endpoint->short_sends_counter, 1);
+    }
+
+    return result;
+}
+
+int aeron_receive_channel_endpoint_sendmmsg(
+    aeron_receive_channel_endpoint_t *endpoint, struct mmsghdr *mmsghdr, size_t vlen)
+{
+    int min_msgs_sent = (int)vlen;
+
+    for (size_t i = 0, len = endpoint->destinations.length; i < len; i++)
+    {
+        aeron_receive_destination_t *destination = endpoint->destinations.array[i].destination;
+        const int sendmmsg_result = destination->data_paths->sendmmsg_func(
+            destination->data_paths, &destination->transport, mmsghdr, vlen);
+
+        min_msgs_sent = sendmmsg_result < min_msgs_sent ? sendmmsg_result : min_msgs_sent;
+    }
+
+    return min_msgs_sent;
+}
+
 int aeron_receive_channel_endpoint_send_nak(
     aeron_receive_channel_endpoint_t *endpoint,
     struct sockaddr_storage *addr,
@@ -260,23 +465,59 @@ int aeron_receive_channel_endpoint_send_nak(
     int32_t term_offset,
     int32_t length)
 {
-    uint8_t buffer[sizeof(aeron_nak_header_t)];
-    aeron_nak_header_t *nak_header = (aeron_nak_header_t *)buffer;
+    aeron_loss_detector_gap_t gap;
+
+    gap.term_id = term_id;
+    gap.term_offset = term_offset;
+    gap.length = (size_t)length;
+
+    return aeron_receive_channel_endpoint_send_naks(endpoint, addr, stream_id, session_id, &gap, 1);
+}
+
+static size_t aeron_receive_channel_endpoint_write_naks(
+    uint8_t *buffer,
+    int32_t stream_id,
+    int32_t session_id,
+    const aeron_loss_detector_gap_t *gaps,
+    size_t gap_count)
+{
+    gap_count = gap_count < AERON_LOSS_DETECTOR_MAX_GAPS ? gap_count : AERON_LOSS_DETECTOR_MAX_GAPS;
+
+    for (size_t i = 0; i < gap_count; i++)
+    {
+        aeron_nak_header_t *nak_header = (aeron_nak_header_t *)(buffer + (i * sizeof(aeron_nak_header_t)));
+
+        nak_header->frame_header.frame_length = sizeof(aeron_nak_header_t);
+        nak_header->frame_header.version = AERON_FRAME_HEADER_VERSION;
+        nak_header->frame_header.flags = 0;
+        nak_header->frame_header.type = AERON_HDR_TYPE_NAK;
+        nak_header->session_id = session_id;
+        nak_header->stream_id = stream_id;
+        nak_header->term_id = gaps[i].term_id;
+        nak_header->term_offset = gaps[i].term_offset;
+        nak_header->length = (int32_t)gaps[i].length;
+
+        AERON_DRIVER_TRACEPOINT5(
+            nak_send, session_id, stream_id, gaps[i].term_id, gaps[i].term_offset, gaps[i].length);
+    }
+
+    return sizeof(aeron_nak_header_t) * gap_count;
+}
+
+int aeron_receive_channel_endpoint_send_naks(
+    aeron_receive_channel_endpoint_t *endpoint,
+    struct sockaddr_storage *addr,
+    int32_t stream_id,
+    int32_t session_id,
+    const aeron_loss_detector_gap_t *gaps,
+    size_t gap_count)
+{
+    uint8_t buffer[AERON_RECEIVE_CHANNEL_ENDPOINT_NAKS_MAX_LENGTH];
     struct iovec iov[1];
     struct msghdr msghdr;
 
-    nak_header->frame_header.frame_length = sizeof(aeron_nak_header_t);
-    nak_header->frame_header.version = AERON_FRAME_HEADER_VERSION;
-    nak_header->frame_header.flags = 0;
-    nak_header->frame_header.type = AERON_HDR_TYPE_NAK;
-    nak_header->session_id = session_id;
-    nak_header->stream_id = stream_id;
-    nak_header->term_id = term_id;
-    nak_header->term_offset = term_offset;
-    nak_header->length = length;
-
     iov[0].iov_base = buffer;
-    iov[0].iov_len = sizeof(aeron_nak_header_t);
+    iov[0].iov_len = aeron_receive_channel_endpoint_write_naks(buffer, stream_id, session_id, gaps, gap_count);
     msghdr.msg_iov = iov;
     msghdr.msg_iovlen = 1;
     msghdr.msg_flags = 0;
@@ -297,19 +538,16 @@ int aeron_receive_channel_endpoint_send_nak(
     return bytes_sent;
 }
 
-int aeron_receive_channel_endpoint_send_rttm(
+static size_t aeron_receive_channel_endpoint_write_rttm(
     aeron_receive_channel_endpoint_t *endpoint,
-    struct sockaddr_storage *addr,
+    uint8_t *buffer,
     int32_t stream_id,
     int32_t session_id,
     int64_t echo_timestamp,
     int64_t reception_delta,
     bool is_reply)
 {
-    uint8_t buffer[sizeof(aeron_rttm_header_t)];
     aeron_rttm_header_t *rttm_header = (aeron_rttm_header_t *)buffer;
-    struct iovec iov[1];
-    struct msghdr msghdr;
 
     rttm_header->frame_header.frame_length = sizeof(aeron_rttm_header_t);
     rttm_header->frame_header.version = AERON_FRAME_HEADER_VERSION;
@@ -321,8 +559,51 @@ int aeron_receive_channel_endpoint_send_rttm(
     rttm_header->reception_delta = reception_delta;
     rttm_header->receiver_id = endpoint->receiver_id;
 
+    return sizeof(aeron_rttm_header_t);
+}
+
+int aeron_receive_channel_endpoint_queue_naks(
+    aeron_receive_channel_endpoint_t *endpoint,
+    struct sockaddr_storage *addr,
+    int32_t stream_id,
+    int32_t session_id,
+    const aeron_loss_detector_gap_t *gaps,
+    size_t gap_count)
+{
+    if (!endpoint->control_batch.is_nak_and_rttm_enabled)
+    {
+        return aeron_receive_channel_endpoint_send_naks(endpoint, addr, stream_id, session_id, gaps, gap_count);
+    }
+
+    aeron_receive_channel_endpoint_pending_control_t *entry =
+        aeron_receive_channel_endpoint_next_control_entry(endpoint, addr);
+    if (NULL == entry)
+    {
+        return -1;
+    }
+
+    entry->frame_length = aeron_receive_channel_endpoint_write_naks(
+        entry->frame, stream_id, session_id, gaps, gap_count);
+
+    return 0;
+}
+
+int aeron_receive_channel_endpoint_send_rttm(
+    aeron_receive_channel_endpoint_t *endpoint,
+    struct sockaddr_storage *addr,
+    int32_t stream_id,
+    int32_t session_id,
+    int64_t echo_timestamp,
+    int64_t reception_delta,
+    bool is_reply)
+{
+    uint8_t buffer[sizeof(aeron_rttm_header_t)];
+    struct iovec iov[1];
+    struct msghdr msghdr;
+
     iov[0].iov_base = buffer;
-    iov[0].iov_len = sizeof(aeron_rttm_header_t);
+    iov[0].iov_len = aeron_receive_channel_endpoint_write_rttm(
+        endpoint, buffer, stream_id, session_id, echo_timestamp, reception_delta, is_reply);
     msghdr.msg_iov = iov;
     msghdr.msg_iovlen = 1;
     msghdr.msg_flags = 0;
@@ -343,6 +624,34 @@ int aeron_receive_channel_endpoint_send_rttm(
     return bytes_sent;
 }
 
+int aeron_receive_channel_endpoint_queue_rttm(
+    aeron_receive_channel_endpoint_t *endpoint,
+    struct sockaddr_storage *addr,
+    int32_t stream_id,
+    int32_t session_id,
+    int64_t echo_timestamp,
+    int64_t reception_delta,
+    bool is_reply)
+{
+    if (!endpoint->control_batch.is_nak_and_rttm_enabled)
+    {
+        return aeron_receive_channel_endpoint_send_rttm(
+            endpoint, addr, stream_id, session_id, echo_timestamp, reception_delta, is_reply);
+    }
+
+    aeron_receive_channel_endpoint_pending_control_t *entry =
+        aeron_receive_channel_endpoint_next_control_entry(endpoint, addr);
+    if (NULL == entry)
+    {
+        return -1;
+    }
+
+    entry->frame_length = aeron_receive_channel_endpoint_write_rttm(
+        endpoint, entry->frame, stream_id, session_id, echo_timestamp, reception_delta, is_reply);
+
+    return 0;
+}
+
 void aeron_receive_channel_endpoint_dispatch(
     aeron_udp_channel_data_paths_t *data_paths,
     aeron_udp_channel_transport_t *transport,
@@ -364,6 +673,17 @@ void aeron_receive_channel_endpoint_dispatch(
         return;
     }
 
+    if (NULL != destination && NULL != transport && transport != &destination->transport)
+    {
+        // Fan-out transports share the destination, so carry over the receive timestamp for the image.
+        destination->transport.recv_timestamp_ns = transport->recv_timestamp_ns;
+    }
+
+    if (NULL != destination && NULL != transport)
+    {
+        aeron_receive_destination_report_socket_drops(destination, transport);
+    }
+
     switch (frame_header->type)
     {
         case AERON_HDR_TYPE_PAD:
@@ -402,6 +722,11 @@ void aeron_receive_channel_endpoint_dispatch(
                 {
                     AERON_DRIVER_RECEIVER_ERROR(receiver, "receiver on_rttm: %s", aeron_errmsg());
                 }
+
+                if (endpoint->control_batch.length > 0)
+                {
+                    receiver->has_queued_control_frames = true;
+                }
             }
             else
             {
@@ -426,6 +751,12 @@ int aeron_receive_channel_endpoint_on_data(
     aeron_receive_destination_update_last_activity_ns(
         destination, aeron_clock_cached_nano_time(endpoint->cached_clock));
 
+    if (endpoint->is_checksum_enabled && !aeron_data_frames_verify_checksum(buffer, length))
+    {
+        aeron_system_counter_add(endpoint->checksum_failures_counter, 1, endpoint->has_shared_counters);
+        return 0;
+    }
+
     return aeron_data_packet_dispatcher_on_data(
         &endpoint->dispatcher, endpoint, destination, data_header, buffer, length, addr);
 }
@@ -591,22 +922,85 @@ int aeron_receive_channel_endpoint_decref_to_stream_and_session(
     return result;
 }
 
+typedef struct aeron_receive_channel_endpoint_stream_ids_stct
+{
+    size_t length;
+    int32_t stream_ids[AERON_UDP_CHANNEL_TRANSPORT_STREAM_FILTER_MAX_LENGTH + 1];
+}
+aeron_receive_channel_endpoint_stream_ids_t;
+
+static void aeron_receive_channel_endpoint_collect_stream_id(void *clientd, int64_t key, void *value)
+{
+    aeron_receive_channel_endpoint_stream_ids_t *ids = (aeron_receive_channel_endpoint_stream_ids_t *)clientd;
+
+    if (ids->length < sizeof(ids->stream_ids) / sizeof(ids->stream_ids[0]))
+    {
+        ids->stream_ids[ids->length] = (int32_t)key;
+    }
+
+    ids->length++;
+}
+
+static int aeron_receive_channel_endpoint_update_stream_filter(aeron_receive_channel_endpoint_t *endpoint)
+{
+    if (!endpoint->is_stream_filter_enabled)
+    {
+        return 0;
+    }
+
+    aeron_receive_channel_endpoint_stream_ids_t ids;
+    ids.length = 0;
+    aeron_int64_to_ptr_swiss_map_for_each(
+        &endpoint->dispatcher.session_by_stream_id_map, aeron_receive_channel_endpoint_collect_stream_id, &ids);
+
+    for (size_t i = 0, length = endpoint->destinations.length; i < length; i++)
+    {
+        aeron_receive_destination_t *destination = endpoint->destinations.array[i].destination;
+
+        for (size_t j = 0, count = aeron_receive_destination_transport_count(destination); j < count; j++)
+        {
+            if (aeron_udp_channel_transport_filter_by_stream_ids(
+                aeron_receive_destination_transport(destination, j), ids.stream_ids, ids.length) < 0)
+            {
+                return -1;
+            }
+        }
+    }
+
+    return 0;
+}
+
 int aeron_receive_channel_endpoint_on_add_subscription(
     aeron_receive_channel_endpoint_t *endpoint, int32_t stream_id)
 {
-    return aeron_data_packet_dispatcher_add_subscription(&endpoint->dispatcher, stream_id);
+    if (aeron_data_packet_dispatcher_add_subscription(&endpoint->dispatcher, stream_id) < 0)
+    {
+        return -1;
+    }
+
+    return aeron_receive_channel_endpoint_update_stream_filter(endpoint);
 }
 
 int aeron_receive_channel_endpoint_on_remove_subscription(
     aeron_receive_channel_endpoint_t *endpoint, int32_t stream_id)
 {
-    return aeron_data_packet_dispatcher_remove_subscription(&endpoint->dispatcher, stream_id);
+    if (aeron_data_packet_dispatcher_remove_subscription(&endpoint->dispatcher, stream_id) < 0)
+    {
+        return -1;
+    }
+
+    return aeron_receive_channel_endpoint_update_stream_filter(endpoint);
 }
 
 int aeron_receive_channel_endpoint_on_add_subscription_by_session(
     aeron_receive_channel_endpoint_t *endpoint, int32_t stream_id, int32_t session_id)
 {
-    return aeron_data_packet_dispatcher_add_subscription_by_session(&endpoint->dispatcher, stream_id, session_id);
+    if (aeron_data_packet_dispatcher_add_subscription_by_session(&endpoint->dispatcher, stream_id, session_id) < 0)
+    {
+        return -1;
+    }
+
+    return aeron_receive_channel_endpoint_update_stream_filter(endpoint);
 }
 
 int aeron_receive_channel_endpoint_add_destination(
@@ -622,10 +1016,21 @@ int aeron_receive_channel_endpoint_add_destination(
     }
 
     endpoint->destinations.array[endpoint->destinations.length].destination = destination;
-    destination->transport.dispatch_clientd = endpoint;
+    destination->data_paths = &endpoint->receiver_proxy->receiver->data_paths;
+    for (size_t i = 0, count = aeron_receive_destination_transport_count(destination); i < count; i++)
+    {
+        aeron_udp_channel_transport_t *transport = aeron_receive_destination_transport(destination, i);
+        transport->dispatch_clientd = endpoint;
+        transport->data_paths = destination->data_paths;
+    }
 
     endpoint->destinations.length++;
 
+    if (aeron_receive_channel_endpoint_update_stream_filter(endpoint) < 0)
+    {
+        return -1;
+    }
+
     return (int)endpoint->destinations.length;
 }
 
@@ -662,7 +1067,13 @@ int aeron_receive_channel_endpoint_remove_destination(
 int aeron_receive_channel_endpoint_on_remove_subscription_by_session(
     aeron_receive_channel_endpoint_t *endpoint, int32_t stream_id, int32_t session_id)
 {
-    return aeron_data_packet_dispatcher_remove_subscription_by_session(&endpoint->dispatcher, stream_id, session_id);
+    if (aeron_data_packet_dispatcher_remove_subscription_by_session(
+        &endpoint->dispatcher, stream_id, session_id) < 0)
+    {
+        return -1;
+    }
+
+    return aeron_receive_channel_endpoint_update_stream_filter(endpoint);
 }
 
 int aeron_receive_channel_endpoint_on_add_publication_image(
@@ -726,6 +1137,22 @@ static inline bool aeron_receive_channel_endpoint_validate_so_rcvbuf(
     return true;
 }
 
+int aeron_receive_channel_endpoint_ensure_so_rcvbuf(aeron_receive_channel_endpoint_t *endpoint, size_t window_length)
+{
+    for (size_t i = 0, len = endpoint->destinations.length; i < len; i++)
+    {
+        aeron_receive_destination_t *destination = endpoint->destinations.array[i].destination;
+
+        if (destination->so_rcvbuf < window_length &&
+            aeron_receive_destination_ensure_so_rcvbuf(destination, window_length) < 0)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
 int aeron_receiver_channel_endpoint_validate_sender_mtu_length(
     aeron_receive_channel_endpoint_t *endpoint, size_t sender_mtu_length, size_t window_max_length)
 {
@@ -799,19 +1226,24 @@ int aeron_receive_channel_endpoint_add_poll_transports(
     {
         aeron_receive_destination_t *destination = endpoint->destinations.array[i].destination;
 
-        if (aeron_udp_channel_interceptors_transport_notifications(
-            destination->data_paths,
-            &destination->transport,
-            destination->conductor_fields.udp_channel,
-            &endpoint->dispatcher,
-            AERON_UDP_CHANNEL_INTERCEPTOR_ADD_NOTIFICATION) < 0)
+        for (size_t j = 0, count = aeron_receive_destination_transport_count(destination); j < count; j++)
         {
-            return -1;
-        }
+            aeron_udp_channel_transport_t *transport = aeron_receive_destination_transport(destination, j);
+
+            if (aeron_udp_channel_interceptors_transport_notifications(
+                destination->data_paths,
+                transport,
+                destination->conductor_fields.udp_channel,
+                &endpoint->dispatcher,
+                AERON_UDP_CHANNEL_INTERCEPTOR_ADD_NOTIFICATION) < 0)
+            {
+                return -1;
+            }
 
-        if (endpoint->transport_bindings->poller_add_func(poller, &destination->transport))
-        {
-            return -1;
+            if (endpoint->transport_bindings->poller_add_func(poller, transport))
+            {
+                return -1;
+            }
         }
     }
 
@@ -825,19 +1257,24 @@ int aeron_receive_channel_endpoint_remove_poll_transports(
     {
         aeron_receive_destination_t *destination = endpoint->destinations.array[i].destination;
 
-        if (aeron_udp_channel_interceptors_transport_notifications(
-            destination->data_paths,
-            &destination->transport,
-            destination->conductor_fields.udp_channel,
-            &endpoint->dispatcher,
-            AERON_UDP_CHANNEL_INTERCEPTOR_REMOVE_NOTIFICATION) < 0)
+        for (size_t j = 0, count = aeron_receive_destination_transport_count(destination); j < count; j++)
         {
-            return -1;
-        }
+            aeron_udp_channel_transport_t *transport = aeron_receive_destination_transport(destination, j);
+
+            if (aeron_udp_channel_interceptors_transport_notifications(
+                destination->data_paths,
+                transport,
+                destination->conductor_fields.udp_channel,
+                &endpoint->dispatcher,
+                AERON_UDP_CHANNEL_INTERCEPTOR_REMOVE_NOTIFICATION) < 0)
+            {
+                return -1;
+            }
 
-        if (endpoint->transport_bindings->poller_remove_func(poller, &destination->transport))
-        {
-            return -1;
+            if (endpoint->transport_bindings->poller_remove_func(poller, transport))
+            {
+                return -1;
+            }
         }
     }
 
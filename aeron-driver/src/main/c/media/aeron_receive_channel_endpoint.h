@@ -25,6 +25,22 @@
 #include "aeron_driver_context.h"
 #include "aeron_system_counters.h"
 #include "media/aeron_receive_destination.h"
+#include "aeron_loss_detector.h"
+
+#define AERON_RECEIVE_CHANNEL_ENDPOINT_SM_BATCH_CAPACITY (64)
+#define AERON_RECEIVE_CHANNEL_ENDPOINT_SM_PACK_LENGTH (1024)
+#define AERON_RECEIVE_CHANNEL_ENDPOINT_SM_MAX_LENGTH \
+    (sizeof(aeron_status_message_header_t) + sizeof(aeron_status_message_optional_header_t))
+#define AERON_RECEIVE_CHANNEL_ENDPOINT_NAKS_MAX_LENGTH (sizeof(aeron_nak_header_t) * AERON_LOSS_DETECTOR_MAX_GAPS)
+
+typedef struct aeron_receive_channel_endpoint_pending_control_stct
+{
+    struct sockaddr_storage addr;
+    size_t frame_length;
+    uint8_t frame[AERON_RECEIVE_CHANNEL_ENDPOINT_NAKS_MAX_LENGTH];
+    bool is_assigned;
+}
+aeron_receive_channel_endpoint_pending_control_t;
 
 typedef enum aeron_receive_channel_endpoint_status_enum
 {
@@ -47,6 +63,8 @@ typedef struct aeron_receive_channel_endpoint_stct
         aeron_driver_managed_resource_t managed_resource;
         aeron_udp_channel_t *udp_channel;
         aeron_receive_channel_endpoint_status_t status;
+        bool has_inline_receive_stream;
+        int32_t inline_receive_stream_id;
     }
     conductor_fields;
 
@@ -68,6 +86,9 @@ typedef struct aeron_receive_channel_endpoint_stct
 
     int64_t receiver_id;
     bool has_receiver_released;
+    bool is_checksum_enabled;
+    bool has_shared_counters;
+    bool is_stream_filter_enabled;
     struct
     {
         bool is_present;
@@ -75,8 +96,19 @@ typedef struct aeron_receive_channel_endpoint_stct
     }
     group_tag;
 
+    struct control_batch_stct
+    {
+        bool is_enabled;
+        bool is_packing;
+        bool is_nak_and_rttm_enabled;
+        size_t length;
+        aeron_receive_channel_endpoint_pending_control_t entries[AERON_RECEIVE_CHANNEL_ENDPOINT_SM_BATCH_CAPACITY];
+    }
+    control_batch;
+
     int64_t *short_sends_counter;
     int64_t *possible_ttl_asymmetry_counter;
+    int64_t *checksum_failures_counter;
 }
 aeron_receive_channel_endpoint_t;
 
@@ -86,6 +118,7 @@ int aeron_receive_channel_endpoint_create(
     aeron_receive_destination_t *straight_through_destination,
     aeron_atomic_counter_t *status_indicator,
     aeron_system_counters_t *system_counters,
+    aeron_driver_receiver_proxy_t *receiver_proxy,
     aeron_driver_context_t *context);
 
 int aeron_receive_channel_endpoint_delete(
@@ -105,6 +138,29 @@ int aeron_receive_channel_endpoint_send_sm(
     int32_t receiver_window,
     uint8_t flags);
 
+/*
+ * Queue an SM to go out with the others of the duty cycle on aeron_receive_channel_endpoint_flush_control_frames, or
+ * send it straight away when SM batching is not enabled. A full batch is flushed first.
+ */
+int aeron_receive_channel_endpoint_queue_sm(
+    aeron_receive_channel_endpoint_t *endpoint,
+    struct sockaddr_storage *addr,
+    int32_t stream_id,
+    int32_t session_id,
+    int32_t term_id,
+    int32_t term_offset,
+    int32_t receiver_window,
+    uint8_t flags);
+
+/*
+ * Send the queued control frames in one sendmmsg. SMs are packed one datagram per control address when SM packing is
+ * enabled, NAKs and RTTMs always go in a datagram of their own.
+ */
+int aeron_receive_channel_endpoint_flush_control_frames(aeron_receive_channel_endpoint_t *endpoint);
+
+int aeron_receive_channel_endpoint_sendmmsg(
+    aeron_receive_channel_endpoint_t *endpoint, struct mmsghdr *mmsghdr, size_t vlen);
+
 int aeron_receive_channel_endpoint_send_nak(
     aeron_receive_channel_endpoint_t *endpoint,
     struct sockaddr_storage *addr,
@@ -114,6 +170,30 @@ int aeron_receive_channel_endpoint_send_nak(
     int32_t term_offset,
     int32_t length);
 
+/*
+ * Send a NAK frame for each gap back to back in one datagram, a sender reading only the first frame still repairs the
+ * first gap.
+ */
+int aeron_receive_channel_endpoint_send_naks(
+    aeron_receive_channel_endpoint_t *endpoint,
+    struct sockaddr_storage *addr,
+    int32_t stream_id,
+    int32_t session_id,
+    const aeron_loss_detector_gap_t *gaps,
+    size_t gap_count);
+
+/*
+ * Queue the NAKs to go out with the control frames of the duty cycle when control message batching is enabled,
+ * otherwise send them straight away with aeron_receive_channel_endpoint_send_naks.
+ */
+int aeron_receive_channel_endpoint_queue_naks(
+    aeron_receive_channel_endpoint_t *endpoint,
+    struct sockaddr_storage *addr,
+    int32_t stream_id,
+    int32_t session_id,
+    const aeron_loss_detector_gap_t *gaps,
+    size_t gap_count);
+
 int aeron_receive_channel_endpoint_send_rttm(
     aeron_receive_channel_endpoint_t *endpoint,
     struct sockaddr_storage *addr,
@@ -123,6 +203,18 @@ int aeron_receive_channel_endpoint_send_rttm(
     int64_t reception_delta,
     bool is_reply);
 
+/*
+ * Queue the RTTM like aeron_receive_channel_endpoint_queue_naks. The wait for the flush is part of the measured RTT.
+ */
+int aeron_receive_channel_endpoint_queue_rttm(
+    aeron_receive_channel_endpoint_t *endpoint,
+    struct sockaddr_storage *addr,
+    int32_t stream_id,
+    int32_t session_id,
+    int64_t echo_timestamp,
+    int64_t reception_delta,
+    bool is_reply);
+
 void aeron_receive_channel_endpoint_dispatch(
     aeron_udp_channel_data_paths_t *data_paths,
     aeron_udp_channel_transport_t *transport,
@@ -188,6 +280,11 @@ int aeron_receive_channel_endpoint_on_remove_publication_image(
 int aeron_receiver_channel_endpoint_validate_sender_mtu_length(
     aeron_receive_channel_endpoint_t *endpoint, size_t sender_mtu_length, size_t window_max_length);
 
+/*
+ * Grow SO_RCVBUF on every destination of the endpoint so it can hold a full receiver window.
+ */
+int aeron_receive_channel_endpoint_ensure_so_rcvbuf(aeron_receive_channel_endpoint_t *endpoint, size_t window_length);
+
 void aeron_receive_channel_endpoint_check_for_re_resolution(
     aeron_receive_channel_endpoint_t *endpoint,
     int64_t now_ns,
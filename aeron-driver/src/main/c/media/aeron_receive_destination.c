@@ -14,11 +14,194 @@
  * limitations under the License.
  */
 
+#include <inttypes.h>
+#include <string.h>
+
 #include "util/aeron_error.h"
 #include "aeron_driver_receiver.h"
 #include "aeron_position.h"
 #include "media/aeron_receive_destination.h"
 
+static int aeron_receive_destination_parse_fanout(
+    aeron_udp_channel_t *channel, size_t *fanout, bool *steer_by_session_id)
+{
+    int64_t value = 1;
+    int rc = aeron_uri_get_int64(&channel->uri.params.udp.additional_params, AERON_URI_FANOUT_KEY, &value);
+    if (rc < 0)
+    {
+        return -1;
+    }
+
+    if (0 == rc)
+    {
+        value = 1;
+    }
+
+    if (value < 1 || value > AERON_RECEIVE_DESTINATION_FANOUT_MAX)
+    {
+        aeron_set_err(
+            EINVAL,
+            "%s=%" PRId64 " must be in the range 1..%d",
+            AERON_URI_FANOUT_KEY,
+            value,
+            AERON_RECEIVE_DESTINATION_FANOUT_MAX);
+        return -1;
+    }
+
+    if (value > 1 && channel->is_multicast)
+    {
+        aeron_set_err(EINVAL, "%s is only supported on unicast channels", AERON_URI_FANOUT_KEY);
+        return -1;
+    }
+
+    const char *steering = aeron_uri_find_param_value(
+        &channel->uri.params.udp.additional_params, AERON_URI_FANOUT_STEERING_KEY);
+    *steer_by_session_id = false;
+    if (NULL != steering)
+    {
+        if (0 != strcmp(AERON_URI_FANOUT_STEERING_SESSION_VALUE, steering))
+        {
+            aeron_set_err(EINVAL, "unknown %s=%s", AERON_URI_FANOUT_STEERING_KEY, steering);
+            return -1;
+        }
+
+        *steer_by_session_id = value > 1;
+    }
+
+    *fanout = (size_t)value;
+
+    return 0;
+}
+
+static int aeron_receive_destination_fanout_init(
+    aeron_receive_destination_t *destination,
+    aeron_udp_channel_t *channel,
+    aeron_driver_context_t *context,
+    size_t fanout,
+    bool steer_by_session_id)
+{
+    struct sockaddr_storage bind_addr;
+    socklen_t bind_addr_len = sizeof(bind_addr);
+
+    /* Bind the rest of the group to the resolved address so an ephemeral port is shared. */
+    if (getsockname(destination->transport.fd, (struct sockaddr *)&bind_addr, &bind_addr_len) < 0)
+    {
+        aeron_set_err_from_last_err_code("getsockname");
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&destination->fanout_transports, sizeof(aeron_udp_channel_transport_t) * (fanout - 1)) < 0)
+    {
+        aeron_set_err_from_last_err_code("could not allocate fan-out transports");
+        return -1;
+    }
+
+    for (size_t i = 0; i < fanout - 1; i++)
+    {
+        aeron_udp_channel_transport_t *transport = &destination->fanout_transports[i];
+
+        transport->fd = -1;
+        transport->reuse_port = true;
+        transport->dscp = destination->transport.dscp;
+        transport->data_paths = destination->data_paths;
+        destination->fanout_transports_length++;
+
+        if (context->udp_channel_transport_bindings->init_func(
+            transport,
+            &bind_addr,
+            &channel->local_data,
+            channel->interface_index,
+            0 != channel->multicast_ttl ? channel->multicast_ttl : context->multicast_ttl,
+            context->socket_rcvbuf,
+            context->socket_sndbuf,
+            context,
+            AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_RECEIVER) < 0)
+        {
+            goto error;
+        }
+
+        transport->destination_clientd = destination;
+    }
+
+    if (steer_by_session_id && aeron_udp_channel_transport_steer_reuseport_by_session_id(
+        &destination->transport, fanout) < 0)
+    {
+        goto error;
+    }
+
+    return 0;
+
+error:
+    for (size_t i = 0; i < destination->fanout_transports_length; i++)
+    {
+        context->udp_channel_transport_bindings->close_func(&destination->fanout_transports[i]);
+    }
+    destination->fanout_transports_length = 0;
+
+    return -1;
+}
+
+static int aeron_receive_destination_counter_allocate(
+    aeron_atomic_counter_t *counter,
+    aeron_counters_manager_t *counters_manager,
+    const char *name,
+    int32_t channel_status_counter_id,
+    const char *local_sockaddr)
+{
+    counter->counter_id = aeron_counter_receive_destination_allocate(
+        counters_manager, name, channel_status_counter_id, local_sockaddr);
+
+    if (counter->counter_id < 0)
+    {
+        return -1;
+    }
+
+    counter->value_addr = aeron_counters_manager_addr(counters_manager, counter->counter_id);
+
+    return 0;
+}
+
+static int aeron_receive_destination_arrival_counters_allocate(
+    aeron_receive_destination_t *destination,
+    aeron_counters_manager_t *counters_manager,
+    int32_t channel_status_counter_id,
+    const char *local_sockaddr)
+{
+    if (aeron_receive_destination_counter_allocate(
+        &destination->first_arrivals_counter,
+        counters_manager,
+        AERON_COUNTER_RCV_FIRST_ARRIVALS_NAME,
+        channel_status_counter_id,
+        local_sockaddr) < 0 ||
+        aeron_receive_destination_counter_allocate(
+            &destination->duplicate_arrivals_counter,
+            counters_manager,
+            AERON_COUNTER_RCV_DUPLICATE_ARRIVALS_NAME,
+            channel_status_counter_id,
+            local_sockaddr) < 0 ||
+        aeron_receive_destination_counter_allocate(
+            &destination->arrival_lag_counter,
+            counters_manager,
+            AERON_COUNTER_RCV_ARRIVAL_LAG_NAME,
+            channel_status_counter_id,
+            local_sockaddr) < 0)
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+static void aeron_receive_destination_counter_free(
+    aeron_atomic_counter_t *counter, aeron_counters_manager_t *counters_manager)
+{
+    if (AERON_NULL_COUNTER_ID != counter->counter_id)
+    {
+        aeron_counters_manager_free(counters_manager, counter->counter_id);
+        counter->counter_id = AERON_NULL_COUNTER_ID;
+    }
+}
+
 int aeron_receive_destination_create(
     aeron_receive_destination_t **destination,
     aeron_udp_channel_t *channel,
@@ -39,6 +222,35 @@ int aeron_receive_destination_create(
     _destination->data_paths = &context->receiver_proxy->receiver->data_paths;
     _destination->transport.data_paths = _destination->data_paths;
     _destination->local_sockaddr_indicator.counter_id = AERON_NULL_COUNTER_ID;
+    _destination->first_arrivals_counter.counter_id = AERON_NULL_COUNTER_ID;
+    _destination->first_arrivals_counter.value_addr = NULL;
+    _destination->duplicate_arrivals_counter.counter_id = AERON_NULL_COUNTER_ID;
+    _destination->arrival_lag_counter.counter_id = AERON_NULL_COUNTER_ID;
+    _destination->socket_drops_counter.counter_id = AERON_NULL_COUNTER_ID;
+    _destination->socket_drops_counter.value_addr = NULL;
+    _destination->arrival_lag_ns = 0;
+
+    size_t fanout = 1;
+    bool steer_by_session_id = false;
+    if (aeron_receive_destination_parse_fanout(channel, &fanout, &steer_by_session_id) < 0)
+    {
+        aeron_set_err(aeron_errcode(), "%s: uri=%s", aeron_errmsg(), channel->original_uri);
+        aeron_receive_destination_delete(_destination, counters_manager);
+        return -1;
+    }
+
+    /* an inline subscriber joins the reuseport group of the endpoint socket to receive its stream's data frames */
+    bool is_inline_receive = false;
+    if (aeron_uri_get_bool(
+        &channel->uri.params.udp.additional_params, AERON_URI_INLINE_RECEIVE_KEY, &is_inline_receive) < 0)
+    {
+        aeron_set_err(aeron_errcode(), "%s: uri=%s", aeron_errmsg(), channel->original_uri);
+        aeron_receive_destination_delete(_destination, counters_manager);
+        return -1;
+    }
+
+    _destination->transport.reuse_port = fanout > 1 || is_inline_receive;
+    _destination->transport.dscp = channel->dscp >= 0 ? (uint8_t)channel->dscp : context->socket_dscp;
 
     if (context->udp_channel_transport_bindings->init_func(
         &_destination->transport,
@@ -56,6 +268,14 @@ int aeron_receive_destination_create(
         return -1;
     }
 
+    if (fanout > 1 &&
+        aeron_receive_destination_fanout_init(_destination, channel, context, fanout, steer_by_session_id) < 0)
+    {
+        aeron_set_err(aeron_errcode(), "%s: uri=%s", aeron_errmsg(), channel->original_uri);
+        aeron_receive_destination_delete(_destination, counters_manager);
+        return -1;
+    }
+
     char local_sockaddr[AERON_NETUTIL_FORMATTED_MAX_LENGTH];
     if (context->udp_channel_transport_bindings->bind_addr_and_port_func(
         &_destination->transport, local_sockaddr, sizeof(local_sockaddr)) < 0)
@@ -75,6 +295,24 @@ int aeron_receive_destination_create(
         return -1;
     }
 
+    if (context->redundant_path_enabled && aeron_receive_destination_arrival_counters_allocate(
+        _destination, counters_manager, channel_status_counter_id, local_sockaddr) < 0)
+    {
+        aeron_receive_destination_delete(_destination, counters_manager);
+        return -1;
+    }
+
+    if (context->socket_buffer_auto_enabled && aeron_receive_destination_counter_allocate(
+        &_destination->socket_drops_counter,
+        counters_manager,
+        AERON_COUNTER_RCV_SOCKET_DROPS_NAME,
+        channel_status_counter_id,
+        local_sockaddr) < 0)
+    {
+        aeron_receive_destination_delete(_destination, counters_manager);
+        return -1;
+    }
+
     if (context->udp_channel_transport_bindings->get_so_rcvbuf_func(&_destination->transport, &_destination->so_rcvbuf) < 0)
     {
         aeron_receive_destination_delete(_destination, counters_manager);
@@ -115,10 +353,40 @@ void aeron_receive_destination_delete(
         destination->local_sockaddr_indicator.counter_id = AERON_NULL_COUNTER_ID;
     }
 
+    if (NULL != counters_manager)
+    {
+        aeron_receive_destination_counter_free(&destination->first_arrivals_counter, counters_manager);
+        aeron_receive_destination_counter_free(&destination->duplicate_arrivals_counter, counters_manager);
+        aeron_receive_destination_counter_free(&destination->arrival_lag_counter, counters_manager);
+        aeron_receive_destination_counter_free(&destination->socket_drops_counter, counters_manager);
+    }
+
+    aeron_free(destination->fanout_transports);
     aeron_udp_channel_delete(destination->conductor_fields.udp_channel);
     aeron_free(destination);
 }
 
+int aeron_receive_destination_ensure_so_rcvbuf(aeron_receive_destination_t *destination, size_t length)
+{
+    for (size_t i = 0, count = aeron_receive_destination_transport_count(destination); i < count; i++)
+    {
+        if (aeron_udp_channel_transport_ensure_so_rcvbuf(aeron_receive_destination_transport(destination, i), length) < 0)
+        {
+            return -1;
+        }
+    }
+
+    return aeron_udp_channel_transport_get_so_rcvbuf(&destination->transport, &destination->so_rcvbuf);
+}
+
+extern size_t aeron_receive_destination_transport_count(aeron_receive_destination_t *destination);
+
+extern aeron_udp_channel_transport_t *aeron_receive_destination_transport(
+    aeron_receive_destination_t *destination, size_t index);
+
+extern void aeron_receive_destination_report_socket_drops(
+    aeron_receive_destination_t *destination, aeron_udp_channel_transport_t *transport);
+
 extern void aeron_receive_destination_update_last_activity_ns(aeron_receive_destination_t *destination, int64_t now_ns);
 
 extern bool aeron_receive_destination_re_resolution_required(aeron_receive_destination_t *destination, int64_t now_ns);
@@ -22,6 +22,7 @@
 #include "media/aeron_receive_channel_endpoint.h"
 
 #define AERON_RECEIVE_DESTINATION_TIMEOUT_NS (5 * 1000 * 1000 * 1000LL)
+#define AERON_RECEIVE_DESTINATION_FANOUT_MAX (16)
 
 typedef struct aeron_receive_destination_stct
 {
@@ -32,8 +33,15 @@ typedef struct aeron_receive_destination_stct
     conductor_fields;
 
     aeron_udp_channel_transport_t transport;
+    aeron_udp_channel_transport_t *fanout_transports;
+    size_t fanout_transports_length;
     aeron_udp_channel_data_paths_t *data_paths;
     aeron_atomic_counter_t local_sockaddr_indicator;
+    aeron_atomic_counter_t first_arrivals_counter;
+    aeron_atomic_counter_t duplicate_arrivals_counter;
+    aeron_atomic_counter_t arrival_lag_counter;
+    aeron_atomic_counter_t socket_drops_counter;
+    int64_t arrival_lag_ns;
     struct sockaddr_storage current_control_addr;
     size_t so_rcvbuf;
     bool has_control_addr;
@@ -52,6 +60,37 @@ int aeron_receive_destination_create(
 void aeron_receive_destination_delete(
     aeron_receive_destination_t *destination, aeron_counters_manager_t *counters_manager);
 
+/*
+ * Grow SO_RCVBUF on every transport of the destination to at least length and refresh so_rcvbuf from the primary.
+ */
+int aeron_receive_destination_ensure_so_rcvbuf(aeron_receive_destination_t *destination, size_t length);
+
+inline size_t aeron_receive_destination_transport_count(aeron_receive_destination_t *destination)
+{
+    return 1 + destination->fanout_transports_length;
+}
+
+/*
+ * Index 0 is the primary transport used for control messages, the rest are the SO_REUSEPORT fan-out transports bound
+ * to the same address.
+ */
+inline aeron_udp_channel_transport_t *aeron_receive_destination_transport(
+    aeron_receive_destination_t *destination, size_t index)
+{
+    return 0 == index ? &destination->transport : &destination->fanout_transports[index - 1];
+}
+
+inline void aeron_receive_destination_report_socket_drops(
+    aeron_receive_destination_t *destination, aeron_udp_channel_transport_t *transport)
+{
+    const uint32_t drops = aeron_udp_channel_transport_take_socket_drops(transport);
+
+    if (drops > 0 && NULL != destination->socket_drops_counter.value_addr)
+    {
+        aeron_counter_ordered_increment(destination->socket_drops_counter.value_addr, (int64_t)drops);
+    }
+}
+
 inline void aeron_receive_destination_update_last_activity_ns(aeron_receive_destination_t *destination, int64_t now_ns)
 {
     destination->time_of_last_activity_ns = now_ns;
@@ -38,24 +38,42 @@ struct mmsghdr
 int aeron_send_channel_endpoint_create(
     aeron_send_channel_endpoint_t **endpoint,
     aeron_udp_channel_t *channel,
+    aeron_driver_sender_proxy_t *sender_proxy,
     aeron_driver_context_t *context,
+    aeron_allocator_t *allocator,
     aeron_counters_manager_t *counters_manager)
 {
     aeron_send_channel_endpoint_t *_endpoint = NULL;
     char bind_addr_and_port[AERON_NETUTIL_FORMATTED_MAX_LENGTH];
     int bind_addr_and_port_length;
 
-    if (aeron_alloc((void **)&_endpoint, sizeof(aeron_send_channel_endpoint_t)) < 0)
+    /* striping splits the stream across the destinations so they must all be paths to the same receivers */
+    if (channel->is_striped && !channel->is_manual_control_mode)
     {
+        aeron_set_err(
+            -AERON_ERROR_CODE_INVALID_CHANNEL,
+            "%s=true requires %s=%s: uri=%s",
+            AERON_URI_STRIPE_KEY,
+            AERON_UDP_CHANNEL_CONTROL_MODE_KEY,
+            AERON_UDP_CHANNEL_CONTROL_MODE_MANUAL_VALUE,
+            channel->original_uri);
+        aeron_udp_channel_delete(channel);
         return -1;
     }
 
+    if (aeron_allocator_alloc(allocator, (void **)&_endpoint, sizeof(aeron_send_channel_endpoint_t)) < 0)
+    {
+        return -1;
+    }
+
+    _endpoint->conductor_fields.allocator = allocator;
     _endpoint->destination_tracker = NULL;
-    _endpoint->data_paths = &context->sender_proxy->sender->data_paths;
+    _endpoint->data_paths = &sender_proxy->sender->data_paths;
 
     if (channel->has_explicit_control || channel->is_dynamic_control_mode || channel->is_manual_control_mode)
     {
-        if (aeron_alloc((void **)&_endpoint->destination_tracker, sizeof(aeron_udp_destination_tracker_t)) < 0 ||
+        if (aeron_allocator_alloc(
+            allocator, (void **)&_endpoint->destination_tracker, sizeof(aeron_udp_destination_tracker_t)) < 0 ||
             aeron_udp_destination_tracker_init(
                 _endpoint->destination_tracker,
                 _endpoint->data_paths,
@@ -65,6 +83,8 @@ int aeron_send_channel_endpoint_create(
         {
             return -1;
         }
+
+        _endpoint->destination_tracker->is_striped = channel->is_striped;
     }
 
     _endpoint->conductor_fields.refcnt = 0;
@@ -78,8 +98,8 @@ int aeron_send_channel_endpoint_create(
     _endpoint->channel_status.counter_id = -1;
     _endpoint->local_sockaddr_indicator.counter_id = -1;
     _endpoint->transport_bindings = context->udp_channel_transport_bindings;
-    _endpoint->data_paths = &context->sender_proxy->sender->data_paths;
     _endpoint->transport.data_paths = _endpoint->data_paths;
+    _endpoint->transport.dscp = channel->dscp >= 0 ? (uint8_t)channel->dscp : context->socket_dscp;
 
     if (context->udp_channel_transport_bindings->init_func(
         &_endpoint->transport,
@@ -153,9 +173,11 @@ int aeron_send_channel_endpoint_create(
     aeron_counter_set_ordered(
         _endpoint->local_sockaddr_indicator.value_addr, AERON_COUNTER_CHANNEL_ENDPOINT_STATUS_ACTIVE);
 
-    _endpoint->sender_proxy = context->sender_proxy;
+    _endpoint->sender_proxy = sender_proxy;
     _endpoint->cached_clock = context->cached_clock;
     _endpoint->time_of_last_sm_ns = aeron_clock_cached_nano_time(_endpoint->cached_clock);
+    _endpoint->heartbeat_batch.length = 0;
+    _endpoint->data_batch.length = 0;
     memcpy(&_endpoint->current_data_addr, &channel->remote_data, sizeof(_endpoint->current_data_addr));
 
     *endpoint = _endpoint;
@@ -185,10 +207,11 @@ int aeron_send_channel_endpoint_delete(
     if (NULL != endpoint->destination_tracker)
     {
         aeron_udp_destination_tracker_close(endpoint->destination_tracker);
-        aeron_free(endpoint->destination_tracker);
+        aeron_allocator_free(
+            endpoint->conductor_fields.allocator, endpoint->destination_tracker, sizeof(aeron_udp_destination_tracker_t));
     }
 
-    aeron_free(endpoint);
+    aeron_allocator_free(endpoint->conductor_fields.allocator, endpoint, sizeof(aeron_send_channel_endpoint_t));
 
     return 0;
 }
@@ -235,6 +258,96 @@ int aeron_send_channel_sendmmsg(aeron_send_channel_endpoint_t *endpoint, struct
     return result;
 }
 
+int aeron_send_channel_sendmmsg_to(
+    aeron_send_channel_endpoint_t *endpoint,
+    struct mmsghdr *mmsghdr,
+    size_t vlen,
+    const struct sockaddr_storage *addr)
+{
+    for (size_t i = 0; i < vlen; i++)
+    {
+        mmsghdr[i].msg_hdr.msg_name = (void *)addr;
+        mmsghdr[i].msg_hdr.msg_namelen = AERON_ADDR_LEN(addr);
+    }
+
+    return endpoint->data_paths->sendmmsg_func(endpoint->data_paths, &endpoint->transport, mmsghdr, vlen);
+}
+
+int aeron_send_channel_endpoint_flush_heartbeats(aeron_send_channel_endpoint_t *endpoint, int64_t *short_sends_counter)
+{
+    const size_t length = endpoint->heartbeat_batch.length;
+    struct iovec iov[AERON_SEND_CHANNEL_ENDPOINT_HEARTBEAT_BATCH_CAPACITY];
+    struct mmsghdr mmsghdr[AERON_SEND_CHANNEL_ENDPOINT_HEARTBEAT_BATCH_CAPACITY];
+
+    if (0 == length)
+    {
+        return 0;
+    }
+
+    for (size_t i = 0; i < length; i++)
+    {
+        iov[i].iov_base = &endpoint->heartbeat_batch.frames[i];
+        iov[i].iov_len = sizeof(aeron_data_header_t);
+        mmsghdr[i].msg_hdr.msg_iov = &iov[i];
+        mmsghdr[i].msg_hdr.msg_iovlen = 1;
+        mmsghdr[i].msg_hdr.msg_flags = 0;
+        mmsghdr[i].msg_hdr.msg_control = NULL;
+        mmsghdr[i].msg_hdr.msg_controllen = 0;
+        mmsghdr[i].msg_len = 0;
+    }
+
+    endpoint->heartbeat_batch.length = 0;
+
+    int result = aeron_send_channel_sendmmsg(endpoint, mmsghdr, length);
+    if (result < 0)
+    {
+        return -1;
+    }
+
+    if ((size_t)result != length)
+    {
+        aeron_counter_increment(short_sends_counter, 1);
+    }
+
+    return result * (int)sizeof(aeron_data_header_t);
+}
+
+int aeron_send_channel_endpoint_flush_data(aeron_send_channel_endpoint_t *endpoint, int64_t *short_sends_counter)
+{
+    const size_t length = endpoint->data_batch.length;
+    struct mmsghdr mmsghdr[AERON_SEND_CHANNEL_ENDPOINT_DATA_BATCH_CAPACITY];
+
+    if (0 == length)
+    {
+        return 0;
+    }
+
+    for (size_t i = 0; i < length; i++)
+    {
+        mmsghdr[i].msg_hdr.msg_iov = &endpoint->data_batch.iov[i];
+        mmsghdr[i].msg_hdr.msg_iovlen = 1;
+        mmsghdr[i].msg_hdr.msg_flags = 0;
+        mmsghdr[i].msg_hdr.msg_control = NULL;
+        mmsghdr[i].msg_hdr.msg_controllen = 0;
+        mmsghdr[i].msg_len = 0;
+    }
+
+    endpoint->data_batch.length = 0;
+
+    int result = aeron_send_channel_sendmmsg(endpoint, mmsghdr, length);
+    if (result < 0)
+    {
+        return -1;
+    }
+
+    if ((size_t)result != length)
+    {
+        aeron_counter_increment(short_sends_counter, 1);
+    }
+
+    return result;
+}
+
 int aeron_send_channel_sendmsg(aeron_send_channel_endpoint_t *endpoint, struct msghdr *msghdr)
 {
     int result = 0;
@@ -302,8 +415,18 @@ void aeron_send_channel_endpoint_dispatch(
         case AERON_HDR_TYPE_NAK:
             if (length >= sizeof(aeron_nak_header_t))
             {
-                aeron_send_channel_endpoint_on_nak(endpoint, buffer, length, addr);
-                aeron_counter_ordered_increment(sender->nak_messages_received_counter, 1);
+                size_t offset = 0;
+
+                /* a receiver may bundle a NAK frame per gap into one datagram */
+                do
+                {
+                    aeron_send_channel_endpoint_on_nak(endpoint, buffer + offset, sizeof(aeron_nak_header_t), addr);
+                    aeron_counter_increment(sender->nak_messages_received_counter, 1);
+                    offset += sizeof(aeron_nak_header_t);
+                }
+                while (offset + sizeof(aeron_nak_header_t) <= length &&
+                    AERON_HDR_TYPE_NAK == ((aeron_frame_header_t *)(buffer + offset))->type &&
+                    sizeof(aeron_nak_header_t) == (size_t)((aeron_frame_header_t *)(buffer + offset))->frame_length);
             }
             else
             {
@@ -314,8 +437,32 @@ void aeron_send_channel_endpoint_dispatch(
         case AERON_HDR_TYPE_SM:
             if (length >= sizeof(aeron_status_message_header_t))
             {
+                size_t offset = 0;
+                size_t frame_length = (size_t)frame_header->frame_length;
+
                 aeron_send_channel_endpoint_on_status_message(endpoint, buffer, length, addr);
-                aeron_counter_ordered_increment(sender->status_messages_received_counter, 1);
+                aeron_counter_increment(sender->status_messages_received_counter, 1);
+
+                /* a receiver may pack the SMs of several images into one datagram */
+                while (frame_length >= sizeof(aeron_status_message_header_t) &&
+                    frame_length < length - offset &&
+                    length - offset - frame_length >= sizeof(aeron_status_message_header_t))
+                {
+                    offset += frame_length;
+                    aeron_frame_header_t *next_header = (aeron_frame_header_t *)(buffer + offset);
+                    frame_length = (size_t)next_header->frame_length;
+
+                    if (AERON_HDR_TYPE_SM != next_header->type ||
+                        AERON_FRAME_HEADER_VERSION != next_header->version ||
+                        frame_length < sizeof(aeron_status_message_header_t) ||
+                        frame_length > length - offset)
+                    {
+                        break;
+                    }
+
+                    aeron_send_channel_endpoint_on_status_message(endpoint, buffer + offset, frame_length, addr);
+                    aeron_counter_increment(sender->status_messages_received_counter, 1);
+                }
             }
             else
             {
@@ -349,7 +496,8 @@ void aeron_send_channel_endpoint_on_nak(
 
     if (NULL != publication)
     {
-        aeron_network_publication_on_nak(publication, nak_header->term_id, nak_header->term_offset, nak_header->length);
+        aeron_network_publication_on_nak(
+            publication, nak_header->term_id, nak_header->term_offset, nak_header->length, addr);
     }
 }
 
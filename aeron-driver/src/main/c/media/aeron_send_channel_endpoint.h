@@ -28,6 +28,8 @@
 #include "aeron_driver_sender_proxy.h"
 
 #define AERON_SEND_CHANNEL_ENDPOINT_DESTINATION_TIMEOUT_NS (5 * 1000 * 1000 * 1000LL)
+#define AERON_SEND_CHANNEL_ENDPOINT_HEARTBEAT_BATCH_CAPACITY (16)
+#define AERON_SEND_CHANNEL_ENDPOINT_DATA_BATCH_CAPACITY (AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND_MAX)
 
 typedef enum aeron_send_channel_endpoint_status_enum
 {
@@ -45,6 +47,7 @@ typedef struct aeron_send_channel_endpoint_stct
         bool has_reached_end_of_life;
         const aeron_udp_channel_t *udp_channel;
         aeron_send_channel_endpoint_status_t status;
+        aeron_allocator_t *allocator;
     }
     conductor_fields;
 
@@ -60,6 +63,26 @@ typedef struct aeron_send_channel_endpoint_stct
     struct sockaddr_storage current_data_addr;
     aeron_clock_cache_t *cached_clock;
     int64_t time_of_last_sm_ns;
+
+    /* heartbeats of the publications on the endpoint, sent in one sendmmsg at the end of the sender's send pass */
+    struct aeron_send_channel_endpoint_heartbeat_batch_stct
+    {
+        size_t length;
+        aeron_data_header_t frames[AERON_SEND_CHANNEL_ENDPOINT_HEARTBEAT_BATCH_CAPACITY];
+    }
+    heartbeat_batch;
+
+    /*
+     * data frames of coalescing publications on the endpoint, referenced in place in their logs and sent in one
+     * sendmmsg at the end of the sender's send pass
+     */
+    struct aeron_send_channel_endpoint_data_batch_stct
+    {
+        size_t length;
+        struct iovec iov[AERON_SEND_CHANNEL_ENDPOINT_DATA_BATCH_CAPACITY];
+    }
+    data_batch;
+
     uint8_t padding[AERON_CACHE_LINE_LENGTH];
 }
 aeron_send_channel_endpoint_t;
@@ -67,7 +90,9 @@ aeron_send_channel_endpoint_t;
 int aeron_send_channel_endpoint_create(
     aeron_send_channel_endpoint_t **endpoint,
     aeron_udp_channel_t *channel,
+    aeron_driver_sender_proxy_t *sender_proxy,
     aeron_driver_context_t *context,
+    aeron_allocator_t *allocator,
     aeron_counters_manager_t *counters_manager);
 
 int aeron_send_channel_endpoint_delete(
@@ -79,6 +104,22 @@ void aeron_send_channel_endpoint_decref(void *clientd);
 int aeron_send_channel_sendmmsg(aeron_send_channel_endpoint_t *endpoint, struct mmsghdr *mmsghdr, size_t vlen);
 int aeron_send_channel_sendmsg(aeron_send_channel_endpoint_t *endpoint, struct msghdr *msghdr);
 
+/*
+ * Send to a single address, such as the control address of one receiver, rather than the channel destinations.
+ */
+int aeron_send_channel_sendmmsg_to(
+    aeron_send_channel_endpoint_t *endpoint,
+    struct mmsghdr *mmsghdr,
+    size_t vlen,
+    const struct sockaddr_storage *addr);
+
+int aeron_send_channel_endpoint_flush_heartbeats(aeron_send_channel_endpoint_t *endpoint, int64_t *short_sends_counter);
+
+/*
+ * Returns the number of datagrams sent from the data batch, which is emptied either way.
+ */
+int aeron_send_channel_endpoint_flush_data(aeron_send_channel_endpoint_t *endpoint, int64_t *short_sends_counter);
+
 int aeron_send_channel_endpoint_add_publication(
     aeron_send_channel_endpoint_t *endpoint, aeron_network_publication_t *publication);
 
@@ -181,6 +181,7 @@ int aeron_udp_channel_parse(
         return -1;
     }
 
+    _channel->refcnt = 1;
     if (aeron_uri_parse(uri_length, uri, &_channel->uri) < 0)
     {
         goto error_cleanup;
@@ -198,7 +199,11 @@ int aeron_udp_channel_parse(
     _channel->is_manual_control_mode = false;
     _channel->is_dynamic_control_mode = false;
     _channel->is_multicast = false;
+    _channel->is_checksum_enabled = false;
+    _channel->is_striped = false;
+    _channel->has_generated_canonical_suffix = false;
     _channel->tag_id = AERON_URI_INVALID_TAG;
+    _channel->dscp = -1;
     _channel->ats_status = AERON_URI_ATS_STATUS_DEFAULT;
 
     if (_channel->uri.type != AERON_URI_UDP)
@@ -270,11 +275,44 @@ int aeron_udp_channel_parse(
         }
     }
 
+    _channel->has_generated_canonical_suffix =
+        requires_additional_suffix && AERON_URI_INVALID_TAG == _channel->tag_id && !aeron_is_addr_multicast(&endpoint_addr);
+
     if (aeron_uri_get_ats(&_channel->uri.params.udp.additional_params, &_channel->ats_status) < 0)
     {
         goto error_cleanup;
     }
 
+    if (aeron_uri_get_bool(
+        &_channel->uri.params.udp.additional_params, AERON_URI_CHECKSUM_KEY, &_channel->is_checksum_enabled) < 0)
+    {
+        goto error_cleanup;
+    }
+
+    if (aeron_uri_get_bool(
+        &_channel->uri.params.udp.additional_params, AERON_URI_STRIPE_KEY, &_channel->is_striped) < 0)
+    {
+        goto error_cleanup;
+    }
+
+    int32_t dscp;
+    int dscp_result = aeron_uri_get_int32(&_channel->uri.params.udp.additional_params, AERON_URI_DSCP_KEY, &dscp);
+    if (dscp_result < 0)
+    {
+        goto error_cleanup;
+    }
+    else if (dscp_result > 0)
+    {
+        if (dscp < 0 || AERON_URI_DSCP_MAX < dscp)
+        {
+            aeron_set_err(
+                EINVAL, "%s=%" PRId32 " must be in the range 0 to %d", AERON_URI_DSCP_KEY, dscp, AERON_URI_DSCP_MAX);
+            goto error_cleanup;
+        }
+
+        _channel->dscp = dscp;
+    }
+
     if (aeron_is_addr_multicast(&endpoint_addr))
     {
         memcpy(&_channel->remote_data, &endpoint_addr, AERON_ADDR_LEN(&endpoint_addr));
@@ -360,9 +398,39 @@ int aeron_udp_channel_parse(
     return -1;
 }
 
+int aeron_udp_channel_copy(const aeron_udp_channel_t *src, aeron_udp_channel_t **channel)
+{
+    aeron_udp_channel_t *_channel = NULL;
+
+    if (aeron_alloc((void **)&_channel, sizeof(aeron_udp_channel_t)) < 0)
+    {
+        aeron_set_err(ENOMEM, "%s", "could not allocate UDP channel");
+        return -1;
+    }
+
+    // Resolved addresses and canonical form are copied as is, the URI is re-parsed so the copy owns its params.
+    memcpy(_channel, src, sizeof(aeron_udp_channel_t));
+    _channel->refcnt = 1;
+    if (aeron_uri_parse(src->uri_length, src->original_uri, &_channel->uri) < 0)
+    {
+        aeron_udp_channel_delete(_channel);
+        return -1;
+    }
+
+    *channel = _channel;
+    return 0;
+}
+
+aeron_udp_channel_t *aeron_udp_channel_incref(aeron_udp_channel_t *channel)
+{
+    channel->refcnt++;
+
+    return channel;
+}
+
 void aeron_udp_channel_delete(const aeron_udp_channel_t *channel)
 {
-    if (NULL != channel)
+    if (NULL != channel && 0 == --((aeron_udp_channel_t *)channel)->refcnt)
     {
         aeron_uri_close((aeron_uri_t *)&channel->uri);
         aeron_free((void *)channel);
@@ -371,4 +439,4 @@ void aeron_udp_channel_delete(const aeron_udp_channel_t *channel)
 
 extern bool aeron_udp_channel_is_wildcard(aeron_udp_channel_t *channel);
 
-extern bool aeron_udp_channel_equals(aeron_udp_channel_t *a, aeron_udp_channel_t *b);
+extern bool aeron_udp_channel_equals(const aeron_udp_channel_t *a, const aeron_udp_channel_t *b);
@@ -32,6 +32,8 @@ typedef struct aeron_udp_channel_stct
     struct sockaddr_storage remote_control;
     struct sockaddr_storage local_control;
     int64_t tag_id;
+    int32_t refcnt;
+    int32_t dscp;
     unsigned int interface_index;
     size_t uri_length;
     size_t canonical_length;
@@ -41,6 +43,9 @@ typedef struct aeron_udp_channel_stct
     bool is_manual_control_mode;
     bool is_dynamic_control_mode;
     bool is_multicast;
+    bool is_checksum_enabled;
+    bool is_striped;
+    bool has_generated_canonical_suffix;
     aeron_uri_ats_status_t ats_status;
 }
 aeron_udp_channel_t;
@@ -51,6 +56,14 @@ int aeron_udp_channel_parse(
     aeron_name_resolver_t *resolver,
     aeron_udp_channel_t **channel);
 
+int aeron_udp_channel_copy(const aeron_udp_channel_t *src, aeron_udp_channel_t **channel);
+
+/*
+ * Take another reference to a parsed channel so it can be shared rather than copied. A shared channel must not be
+ * modified apart from settling its defaults. Each reference is released with aeron_udp_channel_delete.
+ */
+aeron_udp_channel_t *aeron_udp_channel_incref(aeron_udp_channel_t *channel);
+
 void aeron_udp_channel_delete(const aeron_udp_channel_t *channel);
 
 inline bool aeron_udp_channel_is_wildcard(aeron_udp_channel_t *channel)
@@ -59,7 +72,7 @@ inline bool aeron_udp_channel_is_wildcard(aeron_udp_channel_t *channel)
         aeron_is_wildcard_addr(&channel->local_data) && aeron_is_wildcard_port(&channel->local_data);
 }
 
-inline bool aeron_udp_channel_equals(aeron_udp_channel_t *a, aeron_udp_channel_t *b)
+inline bool aeron_udp_channel_equals(const aeron_udp_channel_t *a, const aeron_udp_channel_t *b)
 {
     return a == b || (a != NULL && 0 == strncmp(a->canonical_form, b->canonical_form, AERON_MAX_PATH));
 }
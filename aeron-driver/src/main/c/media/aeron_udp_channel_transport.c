@@ -29,12 +29,27 @@
 
 #include "aeron_socket.h"
 
+#if !defined(AERON_COMPILER_MSVC)
+#include <netinet/udp.h>
+#endif
+
+#if defined(HAVE_SO_TIMESTAMPING) || defined(HAVE_SO_TXTIME)
+#include <linux/net_tstamp.h>
+#endif
+
+#if defined(HAVE_SO_ATTACH_REUSEPORT_CBPF) || defined(HAVE_SO_ATTACH_FILTER)
+#include <linux/filter.h>
+#endif
+
+#include <stddef.h>
 #include <string.h>
 #include <fcntl.h>
 #include <errno.h>
 #include <time.h>
 #include "util/aeron_error.h"
 #include "util/aeron_netutil.h"
+#include "protocol/aeron_udp_protocol.h"
+#include "aeron_driver_context.h"
 #include "aeron_udp_channel_transport.h"
 
 #if !defined(HAVE_STRUCT_MMSGHDR)
@@ -55,29 +70,75 @@ int aeron_udp_channel_transport_init(
     size_t socket_sndbuf,
     aeron_driver_context_t *context,
     aeron_udp_channel_transport_affinity_t affinity)
+{
+    aeron_socket_t fd = aeron_socket(bind_addr->ss_family, SOCK_DGRAM, 0);
+
+    if (fd < 0)
+    {
+        transport->fd = -1;
+        return -1;
+    }
+
+    return aeron_udp_channel_transport_init_with_socket(
+        transport,
+        fd,
+        bind_addr,
+        multicast_if_addr,
+        multicast_if_index,
+        ttl,
+        socket_rcvbuf,
+        socket_sndbuf,
+        context,
+        affinity);
+}
+
+int aeron_udp_channel_transport_init_with_socket(
+    aeron_udp_channel_transport_t *transport,
+    aeron_socket_t fd,
+    struct sockaddr_storage *bind_addr,
+    struct sockaddr_storage *multicast_if_addr,
+    unsigned int multicast_if_index,
+    uint8_t ttl,
+    size_t socket_rcvbuf,
+    size_t socket_sndbuf,
+    aeron_driver_context_t *context,
+    aeron_udp_channel_transport_affinity_t affinity)
 {
     bool is_ipv6, is_multicast;
     struct sockaddr_in *in4 = (struct sockaddr_in *)bind_addr;
     struct sockaddr_in6 *in6 = (struct sockaddr_in6 *)bind_addr;
 
-    transport->fd = -1;
+    transport->fd = fd;
     transport->bindings_clientd = NULL;
+    transport->recv_timestamp_ns = 0;
+    transport->socket_drops = 0;
+    transport->socket_drops_reported = 0;
     for (size_t i = 0; i < AERON_UDP_CHANNEL_TRANSPORT_MAX_INTERCEPTORS; i++)
     {
         transport->interceptor_clientds[i] = NULL;
     }
 
-    if ((transport->fd = aeron_socket(bind_addr->ss_family, SOCK_DGRAM, 0)) < 0)
-    {
-        goto error;
-    }
-
     is_ipv6 = AF_INET6 == bind_addr->ss_family;
     is_multicast = aeron_is_addr_multicast(bind_addr);
     socklen_t bind_addr_len = is_ipv6 ? sizeof(struct sockaddr_in6) : sizeof(struct sockaddr_in);
 
     if (!is_multicast)
     {
+        if (transport->reuse_port)
+        {
+#if defined(SO_REUSEPORT)
+            int reuse = 1;
+            if (aeron_setsockopt(transport->fd, SOL_SOCKET, SO_REUSEPORT, &reuse, sizeof(reuse)) < 0)
+            {
+                aeron_set_err_from_last_err_code("setsockopt(SO_REUSEPORT)");
+                goto error;
+            }
+#else
+            aeron_set_err(EINVAL, "%s", "SO_REUSEPORT not supported on this platform");
+            goto error;
+#endif
+        }
+
         if (bind(transport->fd, (struct sockaddr *)bind_addr, bind_addr_len) < 0)
         {
             aeron_set_err_from_last_err_code("unicast bind");
@@ -203,6 +264,90 @@ int aeron_udp_channel_transport_init(
         }
     }
 
+    if (transport->dscp > 0)
+    {
+        /* the DSCP is the upper six bits of the TOS/traffic class octet, the lower two are ECN and left clear */
+        int traffic_class = (int)transport->dscp << 2;
+
+        if (is_ipv6)
+        {
+#if defined(IPV6_TCLASS)
+            if (aeron_setsockopt(transport->fd, IPPROTO_IPV6, IPV6_TCLASS, &traffic_class, sizeof(traffic_class)) < 0)
+            {
+                aeron_set_err_from_last_err_code("setsockopt(IPV6_TCLASS)");
+                goto error;
+            }
+#endif
+        }
+        else
+        {
+#if defined(IP_TOS)
+            if (aeron_setsockopt(transport->fd, IPPROTO_IP, IP_TOS, &traffic_class, sizeof(traffic_class)) < 0)
+            {
+                aeron_set_err_from_last_err_code("setsockopt(IP_TOS)");
+                goto error;
+            }
+#endif
+        }
+    }
+
+
+#if defined(UDP_SEGMENT)
+    if (NULL != context && context->socket_gso_enabled && AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_SENDER == affinity)
+    {
+        int gso_size = 0;
+        socklen_t gso_size_len = sizeof(gso_size);
+
+        if (aeron_getsockopt(transport->fd, SOL_UDP, UDP_SEGMENT, &gso_size, &gso_size_len) < 0)
+        {
+            aeron_set_err_from_last_err_code("getsockopt(UDP_SEGMENT)");
+            goto error;
+        }
+    }
+#endif
+
+#if defined(UDP_GRO)
+    if (NULL != context && context->socket_gro_enabled && AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_RECEIVER == affinity)
+    {
+        int gro = 1;
+
+        if (aeron_setsockopt(transport->fd, SOL_UDP, UDP_GRO, &gro, sizeof(gro)) < 0)
+        {
+            aeron_set_err_from_last_err_code("setsockopt(UDP_GRO)");
+            goto error;
+        }
+    }
+#endif
+
+#if defined(HAVE_SO_TIMESTAMPING)
+    if (NULL != context && context->socket_rx_timestamping_enabled &&
+        AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_RECEIVER == affinity)
+    {
+        int flags =
+            SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE |
+            SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE;
+
+        if (aeron_setsockopt(transport->fd, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags)) < 0)
+        {
+            aeron_set_err_from_last_err_code("setsockopt(SO_TIMESTAMPING)");
+            goto error;
+        }
+    }
+#endif
+
+#if defined(SO_RXQ_OVFL)
+    if (NULL != context && context->socket_buffer_auto_enabled &&
+        AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_RECEIVER == affinity)
+    {
+        int rxq_ovfl = 1;
+
+        if (aeron_setsockopt(transport->fd, SOL_SOCKET, SO_RXQ_OVFL, &rxq_ovfl, sizeof(rxq_ovfl)) < 0)
+        {
+            aeron_set_err_from_last_err_code("setsockopt(SO_RXQ_OVFL)");
+            goto error;
+        }
+    }
+#endif
 
     if (set_socket_non_blocking(transport->fd) < 0)
     {
@@ -232,6 +377,85 @@ int aeron_udp_channel_transport_close(aeron_udp_channel_transport_t *transport)
     return 0;
 }
 
+int aeron_udp_channel_transport_dispatch(
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *msghdr,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr,
+    int64_t *bytes_rcved,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd)
+{
+    size_t segment_length = length;
+    size_t offset = 0;
+    int segments = 0;
+
+    transport->recv_timestamp_ns = 0;
+
+#if defined(UDP_GRO) || defined(HAVE_SO_TIMESTAMPING) || defined(SO_RXQ_OVFL)
+    if (msghdr->msg_controllen > 0)
+    {
+        for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(msghdr); NULL != cmsg; cmsg = CMSG_NXTHDR(msghdr, cmsg))
+        {
+#if defined(UDP_GRO)
+            if (SOL_UDP == cmsg->cmsg_level && UDP_GRO == cmsg->cmsg_type)
+            {
+                int gso_size;
+
+                memcpy(&gso_size, CMSG_DATA(cmsg), sizeof(gso_size));
+                if (gso_size > 0)
+                {
+                    segment_length = (size_t)gso_size;
+                }
+            }
+#endif
+#if defined(HAVE_SO_TIMESTAMPING)
+            if (SOL_SOCKET == cmsg->cmsg_level && SCM_TIMESTAMPING == cmsg->cmsg_type)
+            {
+                /* software, deprecated and raw hardware times in that order */
+                struct timespec ts[3];
+
+                memcpy(ts, CMSG_DATA(cmsg), sizeof(ts));
+                const struct timespec *recv_ts = (0 != ts[2].tv_sec || 0 != ts[2].tv_nsec) ? &ts[2] : &ts[0];
+                transport->recv_timestamp_ns = ((int64_t)recv_ts->tv_sec * 1000000000LL) + recv_ts->tv_nsec;
+            }
+#endif
+#if defined(SO_RXQ_OVFL)
+            if (SOL_SOCKET == cmsg->cmsg_level && SO_RXQ_OVFL == cmsg->cmsg_type)
+            {
+                memcpy(&transport->socket_drops, CMSG_DATA(cmsg), sizeof(transport->socket_drops));
+            }
+#endif
+        }
+    }
+#endif
+
+    do
+    {
+        const size_t remaining = length - offset;
+        const size_t datagram_length = remaining < segment_length ? remaining : segment_length;
+
+        recv_func(
+            transport->data_paths,
+            transport,
+            clientd,
+            transport->dispatch_clientd,
+            transport->destination_clientd,
+            buffer + offset,
+            datagram_length,
+            addr);
+
+        offset += datagram_length;
+        segments++;
+    }
+    while (offset < length);
+
+    *bytes_rcved += length;
+
+    return segments;
+}
+
 int aeron_udp_channel_transport_recvmmsg(
     aeron_udp_channel_transport_t *transport,
     struct mmsghdr *msgvec,
@@ -262,21 +486,22 @@ int aeron_udp_channel_transport_recvmmsg(
     }
     else
     {
+        int work_count = 0;
+
         for (size_t i = 0, length = (size_t)result; i < length; i++)
         {
-            recv_func(
-                transport->data_paths,
+            work_count += aeron_udp_channel_transport_dispatch(
                 transport,
-                clientd,
-                transport->dispatch_clientd,
-                transport->destination_clientd,
+                &msgvec[i].msg_hdr,
                 msgvec[i].msg_hdr.msg_iov[0].iov_base,
                 msgvec[i].msg_len,
-                msgvec[i].msg_hdr.msg_name);
-            *bytes_rcved += msgvec[i].msg_len;
+                msgvec[i].msg_hdr.msg_name,
+                bytes_rcved,
+                recv_func,
+                clientd);
         }
 
-        return result;
+        return work_count;
     }
 #else
     int work_count = 0;
@@ -304,23 +529,43 @@ int aeron_udp_channel_transport_recvmmsg(
         }
 
         msgvec[i].msg_len = (unsigned int)result;
-        recv_func(
-            transport->data_paths,
+        work_count += aeron_udp_channel_transport_dispatch(
             transport,
-            clientd,
-            transport->dispatch_clientd,
-            transport->destination_clientd,
+            &msgvec[i].msg_hdr,
             msgvec[i].msg_hdr.msg_iov[0].iov_base,
             msgvec[i].msg_len,
-            msgvec[i].msg_hdr.msg_name);
-        *bytes_rcved += msgvec[i].msg_len;
-        work_count++;
+            msgvec[i].msg_hdr.msg_name,
+            bytes_rcved,
+            recv_func,
+            clientd);
     }
 
     return work_count;
 #endif
 }
 
+int aeron_udp_channel_transport_recv_scattered(
+    aeron_udp_channel_transport_t *transport, struct msghdr *msghdr, size_t *bytes_rcved)
+{
+    ssize_t result = recvmsg(transport->fd, msghdr, 0);
+    if (result < 0)
+    {
+        int err = errno;
+
+        if (EINTR == err || EAGAIN == err)
+        {
+            return 0;
+        }
+
+        aeron_set_err_from_last_err_code("recvmsg");
+        return -1;
+    }
+
+    *bytes_rcved = (size_t)result;
+
+    return 0 == result ? 0 : 1;
+}
+
 int aeron_udp_channel_transport_sendmmsg(
     aeron_udp_channel_data_paths_t *data_paths,
     aeron_udp_channel_transport_t *transport,
@@ -390,6 +635,78 @@ int aeron_udp_channel_transport_get_so_rcvbuf(aeron_udp_channel_transport_t *tra
     return 0;
 }
 
+static int aeron_udp_channel_transport_ensure_socket_buffer(
+    aeron_udp_channel_transport_t *transport, int option, const char *option_name, size_t length)
+{
+    int current = 0;
+    socklen_t len = sizeof(current);
+
+    if (aeron_getsockopt(transport->fd, SOL_SOCKET, option, &current, &len) < 0)
+    {
+        aeron_set_err_from_last_err_code("getsockopt(%s) %s:%d", option_name, __FILE__, __LINE__);
+        return -1;
+    }
+
+    if (current >= 0 && (size_t)current >= length)
+    {
+        return 0;
+    }
+
+    int value = length > INT32_MAX ? INT32_MAX : (int)length;
+    if (aeron_setsockopt(transport->fd, SOL_SOCKET, option, &value, sizeof(value)) < 0)
+    {
+        aeron_set_err_from_last_err_code("setsockopt(%s) %s:%d", option_name, __FILE__, __LINE__);
+        return -1;
+    }
+
+    return 0;
+}
+
+int aeron_udp_channel_transport_ensure_so_rcvbuf(aeron_udp_channel_transport_t *transport, size_t length)
+{
+    return aeron_udp_channel_transport_ensure_socket_buffer(transport, SO_RCVBUF, "SO_RCVBUF", length);
+}
+
+int aeron_udp_channel_transport_ensure_so_sndbuf(aeron_udp_channel_transport_t *transport, size_t length)
+{
+    return aeron_udp_channel_transport_ensure_socket_buffer(transport, SO_SNDBUF, "SO_SNDBUF", length);
+}
+
+int aeron_udp_channel_transport_probe_path_mtu(const struct sockaddr_storage *addr, size_t *path_mtu)
+{
+#if defined(IP_MTU) && defined(IPV6_MTU)
+    const bool is_ipv6 = AF_INET6 == addr->ss_family;
+    const int level = is_ipv6 ? IPPROTO_IPV6 : IPPROTO_IP;
+    const int discover = is_ipv6 ? IPV6_PMTUDISC_DO : IP_PMTUDISC_DO;
+    socklen_t addr_len = is_ipv6 ? sizeof(struct sockaddr_in6) : sizeof(struct sockaddr_in);
+    int mtu = 0;
+    socklen_t mtu_len = sizeof(mtu);
+    aeron_socket_t fd;
+
+    if ((fd = aeron_socket(addr->ss_family, SOCK_DGRAM, 0)) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_setsockopt(fd, level, is_ipv6 ? IPV6_MTU_DISCOVER : IP_MTU_DISCOVER, &discover, sizeof(discover)) < 0 ||
+        connect(fd, (const struct sockaddr *)addr, addr_len) < 0 ||
+        aeron_getsockopt(fd, level, is_ipv6 ? IPV6_MTU : IP_MTU, &mtu, &mtu_len) < 0)
+    {
+        aeron_set_err_from_last_err_code("probe path MTU %s:%d", __FILE__, __LINE__);
+        aeron_close_socket(fd);
+        return -1;
+    }
+
+    aeron_close_socket(fd);
+    *path_mtu = (size_t)mtu;
+
+    return 0;
+#else
+    aeron_set_err(EINVAL, "%s", "path MTU probing not supported on this platform");
+    return -1;
+#endif
+}
+
 int aeron_udp_channel_transport_bind_addr_and_port(
     aeron_udp_channel_transport_t *transport, char *buffer, size_t length)
 {
@@ -405,8 +722,150 @@ int aeron_udp_channel_transport_bind_addr_and_port(
     return aeron_format_source_identity(buffer, length, &addr);
 }
 
+int aeron_udp_channel_transport_steer_reuseport_by_session_id(
+    aeron_udp_channel_transport_t *transport, size_t group_size)
+{
+#if defined(HAVE_SO_ATTACH_REUSEPORT_CBPF)
+    /*
+     * The program runs with the packet positioned at the UDP payload and returns the index of the socket in the
+     * reuseport group. The session id is at offset 12 in both the data and setup headers, so all frames of an image
+     * land on the same socket. Short frames fail the load and fall back to the kernel's hash selection.
+     */
+    struct sock_filter code[] =
+        {
+            { BPF_LD | BPF_W | BPF_ABS, 0, 0, (uint32_t)offsetof(aeron_data_header_t, session_id) },
+            { BPF_ALU | BPF_MOD | BPF_K, 0, 0, (uint32_t)group_size },
+            { BPF_RET | BPF_A, 0, 0, 0 }
+        };
+    struct sock_fprog program = { .len = sizeof(code) / sizeof(code[0]), .filter = code };
+
+    if (aeron_setsockopt(transport->fd, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &program, sizeof(program)) < 0)
+    {
+        aeron_set_err_from_last_err_code("setsockopt(SO_ATTACH_REUSEPORT_CBPF)");
+        return -1;
+    }
+
+    return 0;
+#else
+    aeron_set_err(EINVAL, "%s", "SO_ATTACH_REUSEPORT_CBPF not supported on this platform");
+    return -1;
+#endif
+}
+
+int aeron_udp_channel_transport_steer_reuseport_by_stream_id(
+    aeron_udp_channel_transport_t *transport, int32_t stream_id)
+{
+#if defined(HAVE_SO_ATTACH_REUSEPORT_CBPF)
+    /*
+     * Data frames with a payload for the stream go to the second socket in the group, all other frames to the first.
+     * The packet is positioned at the UDP payload with absolute loads in network byte order. While the group has a
+     * single socket the second index is out of range and the kernel falls back to it.
+     */
+    struct sock_filter code[] =
+        {
+            { BPF_LD | BPF_W | BPF_LEN, 0, 0, 0 },
+            { BPF_JMP | BPF_JGT | BPF_K, 0, 5, AERON_DATA_HEADER_LENGTH },
+            { BPF_LD | BPF_H | BPF_ABS, 0, 0, (uint32_t)offsetof(aeron_frame_header_t, type) },
+            { BPF_JMP | BPF_JEQ | BPF_K, 0, 3, ntohs(AERON_HDR_TYPE_DATA) },
+            { BPF_LD | BPF_W | BPF_ABS, 0, 0, (uint32_t)offsetof(aeron_data_header_t, stream_id) },
+            { BPF_JMP | BPF_JEQ | BPF_K, 0, 1, ntohl((uint32_t)stream_id) },
+            { BPF_RET | BPF_K, 0, 0, 1 },
+            { BPF_RET | BPF_K, 0, 0, 0 }
+        };
+    struct sock_fprog program = { .len = sizeof(code) / sizeof(code[0]), .filter = code };
+
+    if (aeron_setsockopt(transport->fd, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &program, sizeof(program)) < 0)
+    {
+        aeron_set_err_from_last_err_code("setsockopt(SO_ATTACH_REUSEPORT_CBPF)");
+        return -1;
+    }
+
+    return 0;
+#else
+    aeron_set_err(EINVAL, "%s", "SO_ATTACH_REUSEPORT_CBPF not supported on this platform");
+    return -1;
+#endif
+}
+
+int aeron_udp_channel_transport_filter_by_stream_ids(
+    aeron_udp_channel_transport_t *transport, const int32_t *stream_ids, size_t length)
+{
+#if defined(HAVE_SO_ATTACH_FILTER)
+    if (length > AERON_UDP_CHANNEL_TRANSPORT_STREAM_FILTER_MAX_LENGTH)
+    {
+        int unused = 0;
+        if (aeron_setsockopt(transport->fd, SOL_SOCKET, SO_DETACH_FILTER, &unused, sizeof(unused)) < 0 &&
+            ENOENT != errno)
+        {
+            aeron_set_err_from_last_err_code("setsockopt(SO_DETACH_FILTER)");
+            return -1;
+        }
+
+        return 0;
+    }
+
+    /*
+     * A socket filter runs with the packet positioned at the UDP header, unlike a reuseport program. Absolute loads
+     * are in network byte order so the constants are converted to match the little endian frame fields. Frames of
+     * other types, e.g. setup and RTT measurement, are always accepted so new images can still be elicited.
+     */
+    const uint32_t type_offset = (uint32_t)(sizeof(struct udphdr) + offsetof(aeron_frame_header_t, type));
+    const uint32_t stream_id_offset = (uint32_t)(sizeof(struct udphdr) + offsetof(aeron_data_header_t, stream_id));
+    const uint8_t accept_offset = (uint8_t)(length + 2);
+    struct sock_filter code[AERON_UDP_CHANNEL_TRANSPORT_STREAM_FILTER_MAX_LENGTH + 6];
+    size_t pc = 0;
+
+    code[pc++] = (struct sock_filter){ BPF_LD | BPF_H | BPF_ABS, 0, 0, type_offset };
+    code[pc++] = (struct sock_filter){ BPF_JMP | BPF_JEQ | BPF_K, 1, 0, ntohs(AERON_HDR_TYPE_DATA) };
+    code[pc++] = (struct sock_filter){ BPF_JMP | BPF_JEQ | BPF_K, 0, accept_offset, ntohs(AERON_HDR_TYPE_PAD) };
+    code[pc++] = (struct sock_filter){ BPF_LD | BPF_W | BPF_ABS, 0, 0, stream_id_offset };
+
+    for (size_t i = 0; i < length; i++)
+    {
+        code[pc++] = (struct sock_filter){
+            BPF_JMP | BPF_JEQ | BPF_K, (uint8_t)(length - i), 0, ntohl((uint32_t)stream_ids[i]) };
+    }
+
+    code[pc++] = (struct sock_filter){ BPF_RET | BPF_K, 0, 0, 0 };
+    code[pc++] = (struct sock_filter){ BPF_RET | BPF_K, 0, 0, UINT32_MAX };
+
+    struct sock_fprog program = { .len = (unsigned short)pc, .filter = code };
+
+    if (aeron_setsockopt(transport->fd, SOL_SOCKET, SO_ATTACH_FILTER, &program, sizeof(program)) < 0)
+    {
+        aeron_set_err_from_last_err_code("setsockopt(SO_ATTACH_FILTER)");
+        return -1;
+    }
+
+    return 0;
+#else
+    aeron_set_err(EINVAL, "%s", "SO_ATTACH_FILTER not supported on this platform");
+    return -1;
+#endif
+}
+
+int aeron_udp_channel_transport_enable_txtime(aeron_udp_channel_transport_t *transport)
+{
+#if defined(HAVE_SO_TXTIME)
+    struct sock_txtime txtime = { .clockid = CLOCK_MONOTONIC, .flags = 0 };
+
+    if (aeron_setsockopt(transport->fd, SOL_SOCKET, SO_TXTIME, &txtime, sizeof(txtime)) < 0)
+    {
+        aeron_set_err_from_last_err_code("setsockopt(SO_TXTIME)");
+        return -1;
+    }
+
+    return 0;
+#else
+    aeron_set_err(EINVAL, "%s", "SO_TXTIME not supported on this platform");
+    return -1;
+#endif
+}
+
 extern void *aeron_udp_channel_transport_get_interceptor_clientd(
     aeron_udp_channel_transport_t *transport, int interceptor_index);
 
 extern void aeron_udp_channel_transport_set_interceptor_clientd(
     aeron_udp_channel_transport_t *transport, int interceptor_index, void *clientd);
+
+extern uint32_t aeron_udp_channel_transport_take_socket_drops(aeron_udp_channel_transport_t *transport);
@@ -29,9 +29,20 @@ typedef struct aeron_udp_channel_transport_stct
     void *bindings_clientd;
     void *destination_clientd;
     void *interceptor_clientds[AERON_UDP_CHANNEL_TRANSPORT_MAX_INTERCEPTORS];
+    int64_t recv_timestamp_ns;
+    uint32_t socket_drops;
+    uint32_t socket_drops_reported;
+    uint8_t dscp;
+    bool reuse_port;
 }
 aeron_udp_channel_transport_t;
 
+/*
+ * Space for the ancillary data of a received datagram, e.g. the UDP_GRO segment size and SO_TIMESTAMPING times.
+ */
+#define AERON_UDP_CHANNEL_TRANSPORT_CONTROL_LENGTH (128)
+#define AERON_UDP_CHANNEL_TRANSPORT_STREAM_FILTER_MAX_LENGTH (128)
+
 struct mmsghdr;
 
 int aeron_udp_channel_transport_init(
@@ -45,8 +56,86 @@ int aeron_udp_channel_transport_init(
     aeron_driver_context_t *context,
     aeron_udp_channel_transport_affinity_t affinity);
 
+/*
+ * As aeron_udp_channel_transport_init but configures a socket the caller created, e.g. with flags the bindings need.
+ * The transport takes ownership of the socket and closes it on failure.
+ */
+int aeron_udp_channel_transport_init_with_socket(
+    aeron_udp_channel_transport_t *transport,
+    aeron_socket_t fd,
+    struct sockaddr_storage *bind_addr,
+    struct sockaddr_storage *multicast_if_addr,
+    unsigned int multicast_if_index,
+    uint8_t ttl,
+    size_t socket_rcvbuf,
+    size_t socket_sndbuf,
+    aeron_driver_context_t *context,
+    aeron_udp_channel_transport_affinity_t affinity);
+
 int aeron_udp_channel_transport_close(aeron_udp_channel_transport_t *transport);
 
+/**
+ * Attach a classic BPF program to the reuseport group of the transport that selects the socket for a datagram by
+ * session id modulo the group size, keeping each image on a single socket.
+ *
+ * @param transport any transport in the reuseport group.
+ * @param group_size number of sockets bound in the group.
+ * @return 0 on success or -1 on error, including when the platform does not support it.
+ */
+int aeron_udp_channel_transport_steer_reuseport_by_session_id(
+    aeron_udp_channel_transport_t *transport, size_t group_size);
+
+/**
+ * Attach a classic BPF program to the reuseport group of the transport that selects the second socket in the group
+ * for data frames of the given stream and the first for everything else, so a subscriber bound to the same address
+ * receives the stream's data while setup, heartbeat and other frames still reach the driver.
+ *
+ * @param transport the first transport bound in the reuseport group.
+ * @param stream_id of the data frames to steer to the second socket.
+ * @return 0 on success or -1 on error, including when the platform does not support it.
+ */
+int aeron_udp_channel_transport_steer_reuseport_by_stream_id(
+    aeron_udp_channel_transport_t *transport, int32_t stream_id);
+
+/**
+ * Attach a classic BPF socket filter to the transport that drops data and pad frames for any stream not in the given
+ * set in the kernel, before they are copied to user space. All other frame types are accepted. The filter replaces
+ * any previous one and is removed, accepting all frames, when there are more than
+ * AERON_UDP_CHANNEL_TRANSPORT_STREAM_FILTER_MAX_LENGTH stream ids.
+ *
+ * @param transport to filter the datagrams of.
+ * @param stream_ids to accept data frames for.
+ * @param length of the stream ids.
+ * @return 0 on success or -1 on error, including when the platform does not support it.
+ */
+int aeron_udp_channel_transport_filter_by_stream_ids(
+    aeron_udp_channel_transport_t *transport, const int32_t *stream_ids, size_t length);
+
+/**
+ * Enable SO_TXTIME on the transport so datagrams sent with an SCM_TXTIME launch time, in CLOCK_MONOTONIC
+ * nanoseconds, are held by a time based qdisc, e.g. fq, until that time. Datagrams without a launch time are sent
+ * immediately.
+ *
+ * @param transport to enable launch times on.
+ * @return 0 on success or -1 on error, including when the platform does not support it.
+ */
+int aeron_udp_channel_transport_enable_txtime(aeron_udp_channel_transport_t *transport);
+
+/*
+ * Dispatch a received buffer to recv_func, splitting it into its segments when the kernel coalesced several
+ * datagrams with UDP_GRO. Any SO_TIMESTAMPING receive time is left in recv_timestamp_ns for the duration of the
+ * dispatch and is 0 when there is none. Returns the number of datagrams dispatched.
+ */
+int aeron_udp_channel_transport_dispatch(
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *msghdr,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr,
+    int64_t *bytes_rcved,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd);
+
 int aeron_udp_channel_transport_recvmmsg(
     aeron_udp_channel_transport_t *transport,
     struct mmsghdr *msgvec,
@@ -55,6 +144,14 @@ int aeron_udp_channel_transport_recvmmsg(
     aeron_udp_transport_recv_func_t recv_func,
     void *clientd);
 
+/*
+ * Receive a single datagram into the iovecs of msghdr without dispatching it, so the caller can scatter it straight
+ * into its final location. Returns 1 with the length in bytes_rcved when a datagram was received, 0 when there was
+ * nothing to receive, or -1 on error.
+ */
+int aeron_udp_channel_transport_recv_scattered(
+    aeron_udp_channel_transport_t *transport, struct msghdr *msghdr, size_t *bytes_rcved);
+
 int aeron_udp_channel_transport_sendmmsg(
     aeron_udp_channel_data_paths_t *data_paths,
     aeron_udp_channel_transport_t *transport,
@@ -67,6 +164,30 @@ int aeron_udp_channel_transport_sendmsg(
     struct msghdr *message);
 
 int aeron_udp_channel_transport_get_so_rcvbuf(aeron_udp_channel_transport_t *transport, size_t *so_rcvbuf);
+
+/*
+ * Grow SO_RCVBUF or SO_SNDBUF to at least length, never shrinking it. The kernel may cap the value, so the caller
+ * should read it back where it matters.
+ */
+int aeron_udp_channel_transport_ensure_so_rcvbuf(aeron_udp_channel_transport_t *transport, size_t length);
+int aeron_udp_channel_transport_ensure_so_sndbuf(aeron_udp_channel_transport_t *transport, size_t length);
+
+/*
+ * Path MTU to addr as known to the kernel, i.e. the route MTU lowered by any ICMP fragmentation needed reports.
+ */
+int aeron_udp_channel_transport_probe_path_mtu(const struct sockaddr_storage *addr, size_t *path_mtu);
+
+/*
+ * Number of datagrams the kernel dropped on the socket since the last call, from the SO_RXQ_OVFL count carried on
+ * received datagrams.
+ */
+inline uint32_t aeron_udp_channel_transport_take_socket_drops(aeron_udp_channel_transport_t *transport)
+{
+    const uint32_t drops = transport->socket_drops - transport->socket_drops_reported;
+    transport->socket_drops_reported = transport->socket_drops;
+
+    return drops;
+}
 int aeron_udp_channel_transport_bind_addr_and_port(
     aeron_udp_channel_transport_t *transport, char *buffer, size_t length);
 
@@ -0,0 +1,688 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _BSD_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <string.h>
+
+#include "aeron_udp_channel_transport_af_xdp.h"
+
+#define AERON_AF_XDP_ETH_HEADER_LENGTH (14)
+#define AERON_AF_XDP_VLAN_HEADER_LENGTH (4)
+#define AERON_AF_XDP_ETH_P_IP (0x0800)
+#define AERON_AF_XDP_ETH_P_IPV6 (0x86DD)
+#define AERON_AF_XDP_ETH_P_8021Q (0x8100)
+#define AERON_AF_XDP_IPV4_MIN_HEADER_LENGTH (20)
+#define AERON_AF_XDP_IPV6_HEADER_LENGTH (40)
+#define AERON_AF_XDP_UDP_HEADER_LENGTH (8)
+#define AERON_AF_XDP_IPPROTO_UDP (17)
+
+static inline uint16_t aeron_af_xdp_read_be16(const uint8_t *buffer)
+{
+    return (uint16_t)((buffer[0] << 8) | buffer[1]);
+}
+
+int aeron_udp_channel_transport_af_xdp_parse_frame(
+    uint8_t *buffer, size_t length, aeron_udp_channel_transport_af_xdp_frame_t *frame)
+{
+    size_t offset = AERON_AF_XDP_ETH_HEADER_LENGTH;
+    uint16_t src_port, dst_port, udp_length;
+
+    if (length < AERON_AF_XDP_ETH_HEADER_LENGTH)
+    {
+        return -1;
+    }
+
+    uint16_t ether_type = aeron_af_xdp_read_be16(buffer + 12);
+    if (AERON_AF_XDP_ETH_P_8021Q == ether_type)
+    {
+        if (length < AERON_AF_XDP_ETH_HEADER_LENGTH + AERON_AF_XDP_VLAN_HEADER_LENGTH)
+        {
+            return -1;
+        }
+
+        ether_type = aeron_af_xdp_read_be16(buffer + 16);
+        offset += AERON_AF_XDP_VLAN_HEADER_LENGTH;
+    }
+
+    memset(&frame->src_addr, 0, sizeof(frame->src_addr));
+    memset(&frame->dst_addr, 0, sizeof(frame->dst_addr));
+
+    if (AERON_AF_XDP_ETH_P_IP == ether_type)
+    {
+        uint8_t *ip = buffer + offset;
+
+        if (length < offset + AERON_AF_XDP_IPV4_MIN_HEADER_LENGTH || 4 != (ip[0] >> 4))
+        {
+            return -1;
+        }
+
+        size_t ip_header_length = (size_t)(ip[0] & 0x0F) * 4;
+        uint16_t flags_and_offset = aeron_af_xdp_read_be16(ip + 6);
+
+        if (ip_header_length < AERON_AF_XDP_IPV4_MIN_HEADER_LENGTH ||
+            AERON_AF_XDP_IPPROTO_UDP != ip[9] ||
+            0 != (flags_and_offset & 0x3FFF))
+        {
+            return -1;
+        }
+
+        struct sockaddr_in *src = (struct sockaddr_in *)&frame->src_addr;
+        struct sockaddr_in *dst = (struct sockaddr_in *)&frame->dst_addr;
+        src->sin_family = AF_INET;
+        dst->sin_family = AF_INET;
+        memcpy(&src->sin_addr, ip + 12, sizeof(src->sin_addr));
+        memcpy(&dst->sin_addr, ip + 16, sizeof(dst->sin_addr));
+
+        offset += ip_header_length;
+    }
+    else if (AERON_AF_XDP_ETH_P_IPV6 == ether_type)
+    {
+        uint8_t *ip = buffer + offset;
+
+        if (length < offset + AERON_AF_XDP_IPV6_HEADER_LENGTH || 6 != (ip[0] >> 4) || AERON_AF_XDP_IPPROTO_UDP != ip[6])
+        {
+            return -1;
+        }
+
+        struct sockaddr_in6 *src = (struct sockaddr_in6 *)&frame->src_addr;
+        struct sockaddr_in6 *dst = (struct sockaddr_in6 *)&frame->dst_addr;
+        src->sin6_family = AF_INET6;
+        dst->sin6_family = AF_INET6;
+        memcpy(&src->sin6_addr, ip + 8, sizeof(src->sin6_addr));
+        memcpy(&dst->sin6_addr, ip + 24, sizeof(dst->sin6_addr));
+
+        offset += AERON_AF_XDP_IPV6_HEADER_LENGTH;
+    }
+    else
+    {
+        return -1;
+    }
+
+    if (length < offset + AERON_AF_XDP_UDP_HEADER_LENGTH)
+    {
+        return -1;
+    }
+
+    memcpy(&src_port, buffer + offset, sizeof(src_port));
+    memcpy(&dst_port, buffer + offset + 2, sizeof(dst_port));
+    udp_length = aeron_af_xdp_read_be16(buffer + offset + 4);
+
+    if (udp_length < AERON_AF_XDP_UDP_HEADER_LENGTH || length < offset + udp_length)
+    {
+        return -1;
+    }
+
+    if (AF_INET == frame->src_addr.ss_family)
+    {
+        ((struct sockaddr_in *)&frame->src_addr)->sin_port = src_port;
+        ((struct sockaddr_in *)&frame->dst_addr)->sin_port = dst_port;
+    }
+    else
+    {
+        ((struct sockaddr_in6 *)&frame->src_addr)->sin6_port = src_port;
+        ((struct sockaddr_in6 *)&frame->dst_addr)->sin6_port = dst_port;
+    }
+
+    frame->payload = buffer + offset + AERON_AF_XDP_UDP_HEADER_LENGTH;
+    frame->payload_length = udp_length - AERON_AF_XDP_UDP_HEADER_LENGTH;
+
+    return 0;
+}
+
+#if defined(HAVE_AF_XDP)
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <net/if.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <linux/bpf.h>
+#include <linux/if_xdp.h>
+
+#include "concurrent/aeron_atomic.h"
+#include "util/aeron_arrayutil.h"
+#include "util/aeron_bitutil.h"
+#include "util/aeron_error.h"
+#include "aeron_alloc.h"
+#include "aeron_udp_channel_transport.h"
+#include "aeron_udp_transport_poller.h"
+
+typedef struct aeron_af_xdp_ring_stct
+{
+    uint32_t *producer;
+    uint32_t *consumer;
+    uint32_t *flags;
+    void *descs;
+    void *map;
+    size_t map_length;
+    uint32_t mask;
+    uint32_t size;
+}
+aeron_af_xdp_ring_t;
+
+typedef struct aeron_af_xdp_entry_stct
+{
+    aeron_udp_channel_transport_t *transport;
+    struct sockaddr_storage bind_addr;
+}
+aeron_af_xdp_entry_t;
+
+typedef struct aeron_af_xdp_socket_stct
+{
+    int fd;
+    int xskmap_fd;
+    uint32_t queue_id;
+    uint8_t *umem;
+    size_t umem_length;
+    aeron_af_xdp_ring_t rx;
+    aeron_af_xdp_ring_t fill;
+    aeron_af_xdp_ring_t completion;
+
+    struct aeron_af_xdp_entries_stct
+    {
+        aeron_af_xdp_entry_t *array;
+        size_t length;
+        size_t capacity;
+    }
+    entries;
+}
+aeron_af_xdp_socket_t;
+
+static int aeron_af_xdp_bpf(int cmd, union bpf_attr *attr)
+{
+    return (int)syscall(__NR_bpf, cmd, attr, sizeof(union bpf_attr));
+}
+
+static int aeron_af_xdp_parse_uint32(const char *name, const char *str, uint32_t def, uint32_t *value)
+{
+    char *end_ptr = NULL;
+
+    if (NULL == str)
+    {
+        *value = def;
+        return 0;
+    }
+
+    errno = 0;
+    unsigned long long result = strtoull(str, &end_ptr, 10);
+    if (0 != errno || '\0' != *end_ptr || end_ptr == str || result > UINT32_MAX)
+    {
+        aeron_set_err(EINVAL, "could not parse %s: %s", name, str);
+        return -1;
+    }
+
+    *value = (uint32_t)result;
+    return 0;
+}
+
+static int aeron_af_xdp_map_ring(
+    aeron_af_xdp_socket_t *xsk,
+    aeron_af_xdp_ring_t *ring,
+    struct xdp_ring_offset *offsets,
+    uint32_t size,
+    size_t desc_size,
+    off_t pgoff,
+    const char *name)
+{
+    ring->map_length = offsets->desc + (size * desc_size);
+    void *map = mmap(NULL, ring->map_length, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, xsk->fd, pgoff);
+    if (MAP_FAILED == map)
+    {
+        aeron_set_err_from_last_err_code("mmap(%s)", name);
+        return -1;
+    }
+
+    uint8_t *base = (uint8_t *)map;
+    ring->map = map;
+    ring->producer = (uint32_t *)(base + offsets->producer);
+    ring->consumer = (uint32_t *)(base + offsets->consumer);
+    ring->flags = (uint32_t *)(base + offsets->flags);
+    ring->descs = base + offsets->desc;
+    ring->mask = size - 1;
+    ring->size = size;
+
+    return 0;
+}
+
+static void aeron_af_xdp_socket_delete(aeron_af_xdp_socket_t *xsk)
+{
+    if (xsk->xskmap_fd >= 0)
+    {
+        union bpf_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.map_fd = (uint32_t)xsk->xskmap_fd;
+        attr.key = (uint64_t)(uintptr_t)&xsk->queue_id;
+        aeron_af_xdp_bpf(BPF_MAP_DELETE_ELEM, &attr);
+        close(xsk->xskmap_fd);
+    }
+
+    aeron_af_xdp_ring_t *rings[] = { &xsk->rx, &xsk->fill, &xsk->completion };
+    for (size_t i = 0; i < sizeof(rings) / sizeof(rings[0]); i++)
+    {
+        if (NULL != rings[i]->map)
+        {
+            munmap(rings[i]->map, rings[i]->map_length);
+        }
+    }
+
+    if (xsk->fd >= 0)
+    {
+        close(xsk->fd);
+    }
+
+    if (NULL != xsk->umem)
+    {
+        munmap(xsk->umem, xsk->umem_length);
+    }
+
+    aeron_free(xsk->entries.array);
+    aeron_free(xsk);
+}
+
+static int aeron_af_xdp_socket_setup(aeron_af_xdp_socket_t *xsk)
+{
+    const char *interface_name = getenv(AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_INTERFACE_ENV_VAR);
+    const char *xskmap_path = getenv(AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_XSKMAP_PATH_ENV_VAR);
+    uint32_t frame_count;
+
+    if (NULL == interface_name || NULL == xskmap_path)
+    {
+        aeron_set_err(
+            EINVAL,
+            "%s and %s must be set for af_xdp bindings",
+            AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_INTERFACE_ENV_VAR,
+            AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_XSKMAP_PATH_ENV_VAR);
+        return -1;
+    }
+
+    if (aeron_af_xdp_parse_uint32(
+        AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_QUEUE_ENV_VAR,
+        getenv(AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_QUEUE_ENV_VAR),
+        AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_QUEUE_DEFAULT,
+        &xsk->queue_id) < 0 ||
+        aeron_af_xdp_parse_uint32(
+            AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_FRAME_COUNT_ENV_VAR,
+            getenv(AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_FRAME_COUNT_ENV_VAR),
+            AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_FRAME_COUNT_DEFAULT,
+            &frame_count) < 0)
+    {
+        return -1;
+    }
+
+    if (!AERON_IS_POWER_OF_TWO(frame_count))
+    {
+        aeron_set_err(
+            EINVAL, "%s must be a power of 2: %" PRIu32, AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_FRAME_COUNT_ENV_VAR, frame_count);
+        return -1;
+    }
+
+    unsigned int ifindex = if_nametoindex(interface_name);
+    if (0 == ifindex)
+    {
+        aeron_set_err_from_last_err_code("if_nametoindex(%s)", interface_name);
+        return -1;
+    }
+
+    xsk->umem_length = (size_t)frame_count * AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_FRAME_SIZE;
+    void *umem = mmap(NULL, xsk->umem_length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+    if (MAP_FAILED == umem)
+    {
+        aeron_set_err_from_last_err_code("mmap(umem)");
+        return -1;
+    }
+    xsk->umem = (uint8_t *)umem;
+
+    if ((xsk->fd = socket(AF_XDP, SOCK_RAW, 0)) < 0)
+    {
+        aeron_set_err_from_last_err_code("socket(AF_XDP)");
+        return -1;
+    }
+
+    struct xdp_umem_reg umem_reg;
+    memset(&umem_reg, 0, sizeof(umem_reg));
+    umem_reg.addr = (uint64_t)(uintptr_t)xsk->umem;
+    umem_reg.len = xsk->umem_length;
+    umem_reg.chunk_size = AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_FRAME_SIZE;
+    umem_reg.headroom = 0;
+
+    if (setsockopt(xsk->fd, SOL_XDP, XDP_UMEM_REG, &umem_reg, sizeof(umem_reg)) < 0)
+    {
+        aeron_set_err_from_last_err_code("setsockopt(XDP_UMEM_REG)");
+        return -1;
+    }
+
+    if (setsockopt(xsk->fd, SOL_XDP, XDP_UMEM_FILL_RING, &frame_count, sizeof(frame_count)) < 0 ||
+        setsockopt(xsk->fd, SOL_XDP, XDP_UMEM_COMPLETION_RING, &frame_count, sizeof(frame_count)) < 0 ||
+        setsockopt(xsk->fd, SOL_XDP, XDP_RX_RING, &frame_count, sizeof(frame_count)) < 0)
+    {
+        aeron_set_err_from_last_err_code("setsockopt(XDP rings)");
+        return -1;
+    }
+
+    struct xdp_mmap_offsets offsets;
+    socklen_t offsets_length = sizeof(offsets);
+    if (getsockopt(xsk->fd, SOL_XDP, XDP_MMAP_OFFSETS, &offsets, &offsets_length) < 0)
+    {
+        aeron_set_err_from_last_err_code("getsockopt(XDP_MMAP_OFFSETS)");
+        return -1;
+    }
+
+    if (aeron_af_xdp_map_ring(
+        xsk, &xsk->rx, &offsets.rx, frame_count, sizeof(struct xdp_desc), XDP_PGOFF_RX_RING, "rx") < 0 ||
+        aeron_af_xdp_map_ring(
+            xsk, &xsk->fill, &offsets.fr, frame_count, sizeof(uint64_t), XDP_UMEM_PGOFF_FILL_RING, "fill") < 0 ||
+        aeron_af_xdp_map_ring(
+            xsk,
+            &xsk->completion,
+            &offsets.cr,
+            frame_count,
+            sizeof(uint64_t),
+            XDP_UMEM_PGOFF_COMPLETION_RING,
+            "completion") < 0)
+    {
+        return -1;
+    }
+
+    uint64_t *fill_descs = (uint64_t *)xsk->fill.descs;
+    for (uint32_t i = 0; i < frame_count; i++)
+    {
+        fill_descs[i] = (uint64_t)i * AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_FRAME_SIZE;
+    }
+    AERON_PUT_ORDERED(*xsk->fill.producer, frame_count);
+
+    struct sockaddr_xdp sxdp;
+    memset(&sxdp, 0, sizeof(sxdp));
+    sxdp.sxdp_family = AF_XDP;
+    sxdp.sxdp_ifindex = ifindex;
+    sxdp.sxdp_queue_id = xsk->queue_id;
+    sxdp.sxdp_flags = XDP_USE_NEED_WAKEUP;
+
+    if (bind(xsk->fd, (struct sockaddr *)&sxdp, sizeof(sxdp)) < 0)
+    {
+        aeron_set_err_from_last_err_code("bind(AF_XDP %s:%" PRIu32 ")", interface_name, xsk->queue_id);
+        return -1;
+    }
+
+    union bpf_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.pathname = (uint64_t)(uintptr_t)xskmap_path;
+    if ((xsk->xskmap_fd = aeron_af_xdp_bpf(BPF_OBJ_GET, &attr)) < 0)
+    {
+        aeron_set_err_from_last_err_code("bpf(BPF_OBJ_GET %s)", xskmap_path);
+        return -1;
+    }
+
+    int fd = xsk->fd;
+    memset(&attr, 0, sizeof(attr));
+    attr.map_fd = (uint32_t)xsk->xskmap_fd;
+    attr.key = (uint64_t)(uintptr_t)&xsk->queue_id;
+    attr.value = (uint64_t)(uintptr_t)&fd;
+    attr.flags = BPF_ANY;
+    if (aeron_af_xdp_bpf(BPF_MAP_UPDATE_ELEM, &attr) < 0)
+    {
+        aeron_set_err_from_last_err_code("bpf(BPF_MAP_UPDATE_ELEM %s)", xskmap_path);
+        return -1;
+    }
+
+    return 0;
+}
+
+static bool aeron_af_xdp_addr_matches(struct sockaddr_storage *bind_addr, struct sockaddr_storage *dst_addr)
+{
+    if (bind_addr->ss_family != dst_addr->ss_family)
+    {
+        return false;
+    }
+
+    if (AF_INET == bind_addr->ss_family)
+    {
+        struct sockaddr_in *bind_in = (struct sockaddr_in *)bind_addr;
+        struct sockaddr_in *dst_in = (struct sockaddr_in *)dst_addr;
+
+        return bind_in->sin_port == dst_in->sin_port &&
+            (INADDR_ANY == bind_in->sin_addr.s_addr || bind_in->sin_addr.s_addr == dst_in->sin_addr.s_addr);
+    }
+    else
+    {
+        struct sockaddr_in6 *bind_in6 = (struct sockaddr_in6 *)bind_addr;
+        struct sockaddr_in6 *dst_in6 = (struct sockaddr_in6 *)dst_addr;
+
+        return bind_in6->sin6_port == dst_in6->sin6_port &&
+            (0 == memcmp(&bind_in6->sin6_addr, &in6addr_any, sizeof(struct in6_addr)) ||
+            0 == memcmp(&bind_in6->sin6_addr, &dst_in6->sin6_addr, sizeof(struct in6_addr)));
+    }
+}
+
+static int aeron_af_xdp_poll_rx(
+    aeron_af_xdp_socket_t *xsk, int64_t *bytes_rcved, aeron_udp_transport_recv_func_t recv_func, void *clientd)
+{
+    uint32_t rx_producer, rx_consumer = *xsk->rx.consumer;
+    uint32_t fill_producer = *xsk->fill.producer;
+    struct xdp_desc *rx_descs = (struct xdp_desc *)xsk->rx.descs;
+    uint64_t *fill_descs = (uint64_t *)xsk->fill.descs;
+    int work_count = 0;
+
+    AERON_GET_VOLATILE(rx_producer, *xsk->rx.producer);
+
+    for (int i = 0; rx_consumer != rx_producer && i < AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_RX_BATCH_SIZE; i++)
+    {
+        struct xdp_desc *desc = &rx_descs[rx_consumer & xsk->rx.mask];
+        aeron_udp_channel_transport_af_xdp_frame_t frame;
+
+        if (aeron_udp_channel_transport_af_xdp_parse_frame(xsk->umem + desc->addr, desc->len, &frame) >= 0)
+        {
+            for (size_t j = 0, length = xsk->entries.length; j < length; j++)
+            {
+                aeron_af_xdp_entry_t *entry = &xsk->entries.array[j];
+
+                if (aeron_af_xdp_addr_matches(&entry->bind_addr, &frame.dst_addr))
+                {
+                    aeron_udp_channel_transport_t *transport = entry->transport;
+
+                    recv_func(
+                        transport->data_paths,
+                        transport,
+                        clientd,
+                        transport->dispatch_clientd,
+                        transport->destination_clientd,
+                        frame.payload,
+                        frame.payload_length,
+                        &frame.src_addr);
+
+                    *bytes_rcved += frame.payload_length;
+                    work_count++;
+                    break;
+                }
+            }
+        }
+
+        fill_descs[fill_producer & xsk->fill.mask] = desc->addr - (desc->addr % AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_FRAME_SIZE);
+        fill_producer++;
+        rx_consumer++;
+    }
+
+    AERON_PUT_ORDERED(*xsk->rx.consumer, rx_consumer);
+    AERON_PUT_ORDERED(*xsk->fill.producer, fill_producer);
+
+    uint32_t fill_flags;
+    AERON_GET_VOLATILE(fill_flags, *xsk->fill.flags);
+    if (fill_flags & XDP_RING_NEED_WAKEUP)
+    {
+        recvfrom(xsk->fd, NULL, 0, MSG_DONTWAIT, NULL, NULL);
+    }
+
+    return work_count;
+}
+
+int aeron_udp_transport_poller_af_xdp_init(
+    aeron_udp_transport_poller_t *poller,
+    aeron_driver_context_t *context,
+    aeron_udp_channel_transport_affinity_t affinity)
+{
+    aeron_af_xdp_socket_t *xsk = NULL;
+
+    if (aeron_udp_transport_poller_init(poller, context, affinity) < 0)
+    {
+        return -1;
+    }
+
+    if (AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_RECEIVER != affinity)
+    {
+        return 0;
+    }
+
+    if (aeron_alloc((void **)&xsk, sizeof(aeron_af_xdp_socket_t)) < 0)
+    {
+        aeron_udp_transport_poller_close(poller);
+        return -1;
+    }
+
+    xsk->fd = -1;
+    xsk->xskmap_fd = -1;
+
+    if (aeron_af_xdp_socket_setup(xsk) < 0)
+    {
+        aeron_af_xdp_socket_delete(xsk);
+        aeron_udp_transport_poller_close(poller);
+        return -1;
+    }
+
+    poller->bindings_clientd = xsk;
+
+    return 0;
+}
+
+int aeron_udp_transport_poller_af_xdp_close(aeron_udp_transport_poller_t *poller)
+{
+    aeron_af_xdp_socket_t *xsk = (aeron_af_xdp_socket_t *)poller->bindings_clientd;
+
+    if (NULL != xsk)
+    {
+        aeron_af_xdp_socket_delete(xsk);
+        poller->bindings_clientd = NULL;
+    }
+
+    return aeron_udp_transport_poller_close(poller);
+}
+
+int aeron_udp_transport_poller_af_xdp_add(
+    aeron_udp_transport_poller_t *poller, aeron_udp_channel_transport_t *transport)
+{
+    aeron_af_xdp_socket_t *xsk = (aeron_af_xdp_socket_t *)poller->bindings_clientd;
+
+    if (NULL != xsk)
+    {
+        int ensure_capacity_result = 0;
+
+        AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, xsk->entries, aeron_af_xdp_entry_t);
+        if (ensure_capacity_result < 0)
+        {
+            return -1;
+        }
+
+        aeron_af_xdp_entry_t *entry = &xsk->entries.array[xsk->entries.length];
+        socklen_t addr_length = sizeof(entry->bind_addr);
+
+        if (getsockname(transport->fd, (struct sockaddr *)&entry->bind_addr, &addr_length) < 0)
+        {
+            aeron_set_err_from_last_err_code("getsockname");
+            return -1;
+        }
+
+        entry->transport = transport;
+        xsk->entries.length++;
+    }
+
+    return aeron_udp_transport_poller_add(poller, transport);
+}
+
+int aeron_udp_transport_poller_af_xdp_remove(
+    aeron_udp_transport_poller_t *poller, aeron_udp_channel_transport_t *transport)
+{
+    aeron_af_xdp_socket_t *xsk = (aeron_af_xdp_socket_t *)poller->bindings_clientd;
+
+    if (NULL != xsk)
+    {
+        int last_index = (int)xsk->entries.length - 1;
+
+        for (int i = last_index; i >= 0; i--)
+        {
+            if (xsk->entries.array[i].transport == transport)
+            {
+                aeron_array_fast_unordered_remove(
+                    (uint8_t *)xsk->entries.array, sizeof(aeron_af_xdp_entry_t), (size_t)i, (size_t)last_index);
+                xsk->entries.length--;
+                break;
+            }
+        }
+    }
+
+    return aeron_udp_transport_poller_remove(poller, transport);
+}
+
+int aeron_udp_transport_poller_af_xdp_poll(
+    aeron_udp_transport_poller_t *poller,
+    struct mmsghdr *msgvec,
+    size_t vlen,
+    int64_t *bytes_rcved,
+    aeron_udp_transport_recv_func_t recv_func,
+    aeron_udp_channel_transport_recvmmsg_func_t recvmmsg_func,
+    void *clientd)
+{
+    aeron_af_xdp_socket_t *xsk = (aeron_af_xdp_socket_t *)poller->bindings_clientd;
+    int work_count = 0;
+
+    if (NULL != xsk)
+    {
+        work_count += aeron_af_xdp_poll_rx(xsk, bytes_rcved, recv_func, clientd);
+    }
+
+    int result = aeron_udp_transport_poller_poll(
+        poller, msgvec, vlen, bytes_rcved, recv_func, recvmmsg_func, clientd);
+
+    return result < 0 ? result : work_count + result;
+}
+
+aeron_udp_channel_transport_bindings_t aeron_udp_channel_transport_bindings_af_xdp =
+    {
+        aeron_udp_channel_transport_init,
+        aeron_udp_channel_transport_close,
+        aeron_udp_channel_transport_recvmmsg,
+        aeron_udp_channel_transport_sendmmsg,
+        aeron_udp_channel_transport_sendmsg,
+        aeron_udp_channel_transport_get_so_rcvbuf,
+        aeron_udp_channel_transport_bind_addr_and_port,
+        aeron_udp_transport_poller_af_xdp_init,
+        aeron_udp_transport_poller_af_xdp_close,
+        aeron_udp_transport_poller_af_xdp_add,
+        aeron_udp_transport_poller_af_xdp_remove,
+        aeron_udp_transport_poller_af_xdp_poll,
+        {
+            "af_xdp",
+            "media",
+            NULL,
+            NULL
+        }
+    };
+
+#endif
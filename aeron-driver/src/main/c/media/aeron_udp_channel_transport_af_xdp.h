@@ -0,0 +1,90 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_H
+#define AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_H
+
+#include "aeron_udp_channel_transport_bindings.h"
+
+/**
+ * Network interface, e.g. eth0, whose RX queue is attached to the AF_XDP socket of the receiver poller.
+ */
+#define AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_INTERFACE_ENV_VAR "AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_INTERFACE"
+
+/**
+ * RX queue of the interface to attach to.
+ */
+#define AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_QUEUE_ENV_VAR "AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_QUEUE"
+
+/**
+ * Path of the pinned BPF_MAP_TYPE_XSKMAP used by the XDP program loaded on the interface. The socket is inserted
+ * with the queue id as the key so the program can redirect Aeron traffic with bpf_redirect_map.
+ */
+#define AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_XSKMAP_PATH_ENV_VAR "AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_XSKMAP_PATH"
+
+/**
+ * Number of UMEM frames, must be a power of 2.
+ */
+#define AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_FRAME_COUNT_ENV_VAR "AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_FRAME_COUNT"
+
+#define AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_QUEUE_DEFAULT (0)
+#define AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_FRAME_COUNT_DEFAULT (4096)
+#define AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_FRAME_SIZE (4096)
+#define AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_RX_BATCH_SIZE (64)
+
+typedef struct aeron_udp_channel_transport_af_xdp_frame_stct
+{
+    struct sockaddr_storage src_addr;
+    struct sockaddr_storage dst_addr;
+    uint8_t *payload;
+    size_t payload_length;
+}
+aeron_udp_channel_transport_af_xdp_frame_t;
+
+/**
+ * Parse an Ethernet frame carrying an unfragmented IPv4 or IPv6 UDP datagram, with an optional 802.1Q tag.
+ *
+ * @param buffer containing the frame.
+ * @param length of the frame.
+ * @param frame to fill in with the addresses and payload location.
+ * @return 0 if the frame is a UDP datagram or -1 if it is not.
+ */
+int aeron_udp_channel_transport_af_xdp_parse_frame(
+    uint8_t *buffer, size_t length, aeron_udp_channel_transport_af_xdp_frame_t *frame);
+
+int aeron_udp_transport_poller_af_xdp_init(
+    aeron_udp_transport_poller_t *poller,
+    aeron_driver_context_t *context,
+    aeron_udp_channel_transport_affinity_t affinity);
+
+int aeron_udp_transport_poller_af_xdp_close(aeron_udp_transport_poller_t *poller);
+
+int aeron_udp_transport_poller_af_xdp_add(
+    aeron_udp_transport_poller_t *poller, aeron_udp_channel_transport_t *transport);
+
+int aeron_udp_transport_poller_af_xdp_remove(
+    aeron_udp_transport_poller_t *poller, aeron_udp_channel_transport_t *transport);
+
+int aeron_udp_transport_poller_af_xdp_poll(
+    aeron_udp_transport_poller_t *poller,
+    struct mmsghdr *msgvec,
+    size_t vlen,
+    int64_t *bytes_rcved,
+    aeron_udp_transport_recv_func_t recv_func,
+    aeron_udp_channel_transport_recvmmsg_func_t recvmmsg_func,
+    void *clientd);
+
+#endif //AERON_UDP_CHANNEL_TRANSPORT_AF_XDP_H
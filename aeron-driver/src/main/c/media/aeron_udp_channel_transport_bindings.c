@@ -67,6 +67,18 @@ aeron_udp_channel_transport_bindings_t *aeron_udp_channel_transport_bindings_loa
     {
         return aeron_udp_channel_transport_bindings_load_media("aeron_udp_channel_transport_bindings_default");
     }
+    else if (strncmp(bindings_name, "io_uring", sizeof("io_uring")) == 0)
+    {
+        return aeron_udp_channel_transport_bindings_load_media("aeron_udp_channel_transport_bindings_io_uring");
+    }
+    else if (strncmp(bindings_name, "af_xdp", sizeof("af_xdp")) == 0)
+    {
+        return aeron_udp_channel_transport_bindings_load_media("aeron_udp_channel_transport_bindings_af_xdp");
+    }
+    else if (strncmp(bindings_name, "rio", sizeof("rio")) == 0)
+    {
+        return aeron_udp_channel_transport_bindings_load_media("aeron_udp_channel_transport_bindings_rio");
+    }
     else
     {
         if ((bindings = (aeron_udp_channel_transport_bindings_t *)aeron_dlsym(RTLD_DEFAULT, bindings_name)) == NULL)
@@ -96,6 +108,22 @@ static aeron_udp_channel_interceptor_bindings_load_func_t *aeron_udp_channel_int
     {
         return aeron_udp_channel_interceptor_bindings_load_interceptor("aeron_udp_channel_interceptor_loss_load");
     }
+    else if (strncmp(interceptor_name, "fec", sizeof("fec")) == 0)
+    {
+        return aeron_udp_channel_interceptor_bindings_load_interceptor("aeron_udp_channel_interceptor_fec_load");
+    }
+    else if (strncmp(interceptor_name, "impair", sizeof("impair")) == 0)
+    {
+        return aeron_udp_channel_interceptor_bindings_load_interceptor("aeron_udp_channel_interceptor_impair_load");
+    }
+    else if (strncmp(interceptor_name, "compress", sizeof("compress")) == 0)
+    {
+        return aeron_udp_channel_interceptor_bindings_load_interceptor("aeron_udp_channel_interceptor_compress_load");
+    }
+    else if (strncmp(interceptor_name, "crypto", sizeof("crypto")) == 0)
+    {
+        return aeron_udp_channel_interceptor_bindings_load_interceptor("aeron_udp_channel_interceptor_crypto_load");
+    }
     else
     {
 #if defined(AERON_COMPILER_GCC)
@@ -232,6 +260,7 @@ int aeron_udp_channel_data_paths_init(
             interceptor->outgoing_transport_notification_func = binding->outgoing_transport_notification_func;
             interceptor->outgoing_publication_notification_func = binding->outgoing_publication_notification_func;
             interceptor->outgoing_image_notification_func = binding->outgoing_image_notification_func;
+            interceptor->do_work_func = binding->outgoing_do_work_func;
             interceptor->next_interceptor = NULL;
 
             if (binding->outgoing_init_func(&interceptor->interceptor_state, context, affinity) < 0)
@@ -271,6 +300,7 @@ int aeron_udp_channel_data_paths_init(
         outgoing_transport_interceptor->outgoing_mmsg_func = aeron_udp_channel_outgoing_interceptor_mmsg_to_transport;
         outgoing_transport_interceptor->outgoing_msg_func = aeron_udp_channel_outgoing_interceptor_msg_to_transport;
         outgoing_transport_interceptor->close_func = NULL;
+        outgoing_transport_interceptor->do_work_func = NULL;
         outgoing_transport_interceptor->next_interceptor = NULL;
         last_outgoing_interceptor->next_interceptor = outgoing_transport_interceptor;
         /* set up to pass into interceptors */
@@ -302,6 +332,7 @@ int aeron_udp_channel_data_paths_init(
             interceptor->incoming_transport_notification_func = binding->incoming_transport_notification_func;
             interceptor->incoming_publication_notification_func = binding->incoming_publication_notification_func;
             interceptor->incoming_image_notification_func = binding->incoming_image_notification_func;
+            interceptor->do_work_func = binding->incoming_do_work_func;
             interceptor->next_interceptor = NULL;
 
             if (binding->incoming_init_func(&interceptor->interceptor_state, context, affinity) < 0)
@@ -338,6 +369,7 @@ int aeron_udp_channel_data_paths_init(
 #endif
         incoming_transport_interceptor->incoming_func = aeron_udp_channel_incoming_interceptor_to_endpoint;
         incoming_transport_interceptor->close_func = NULL;
+        incoming_transport_interceptor->do_work_func = NULL;
         incoming_transport_interceptor->next_interceptor = NULL;
         last_incoming_interceptor->next_interceptor = incoming_transport_interceptor;
         data_paths->recv_func = aeron_udp_channel_incoming_interceptor_recv_func;
@@ -446,3 +478,5 @@ extern int aeron_udp_channel_interceptors_image_notifications(
     aeron_udp_channel_transport_t *transport,
     aeron_publication_image_t *image,
     aeron_udp_channel_interceptor_notification_type_t type);
+
+extern int aeron_udp_channel_data_paths_do_work(aeron_udp_channel_data_paths_t *data_paths);
@@ -205,6 +205,18 @@ typedef int (*aeron_udp_channel_interceptor_image_notification_func_t)(
     aeron_publication_image_t *image,
     aeron_udp_channel_interceptor_notification_type_t type);
 
+/*
+ * Called on each duty cycle of the agent owning the data paths so an interceptor can forward datagrams it has held
+ * back, e.g. to model delay. Returns the amount of work done.
+ */
+typedef int (*aeron_udp_channel_interceptor_outgoing_do_work_func_t)(
+    void *interceptor_state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate);
+
+typedef int (*aeron_udp_channel_interceptor_incoming_do_work_func_t)(
+    void *interceptor_state,
+    aeron_udp_channel_incoming_interceptor_t *delegate);
+
 struct aeron_udp_channel_interceptor_bindings_stct
 {
     aeron_udp_channel_interceptor_init_func_t outgoing_init_func;
@@ -220,6 +232,8 @@ struct aeron_udp_channel_interceptor_bindings_stct
     aeron_udp_channel_interceptor_publication_notification_func_t incoming_publication_notification_func;
     aeron_udp_channel_interceptor_image_notification_func_t outgoing_image_notification_func;
     aeron_udp_channel_interceptor_image_notification_func_t incoming_image_notification_func;
+    aeron_udp_channel_interceptor_outgoing_do_work_func_t outgoing_do_work_func;
+    aeron_udp_channel_interceptor_incoming_do_work_func_t incoming_do_work_func;
     struct interceptor_meta_info_fields
     {
         const char *name;
@@ -239,6 +253,7 @@ struct aeron_udp_channel_outgoing_interceptor_stct
     aeron_udp_channel_interceptor_transport_notification_func_t outgoing_transport_notification_func;
     aeron_udp_channel_interceptor_publication_notification_func_t outgoing_publication_notification_func;
     aeron_udp_channel_interceptor_image_notification_func_t outgoing_image_notification_func;
+    aeron_udp_channel_interceptor_outgoing_do_work_func_t do_work_func;
     aeron_udp_channel_outgoing_interceptor_t *next_interceptor;
 };
 
@@ -250,6 +265,7 @@ struct aeron_udp_channel_incoming_interceptor_stct
     aeron_udp_channel_interceptor_transport_notification_func_t incoming_transport_notification_func;
     aeron_udp_channel_interceptor_publication_notification_func_t incoming_publication_notification_func;
     aeron_udp_channel_interceptor_image_notification_func_t incoming_image_notification_func;
+    aeron_udp_channel_interceptor_incoming_do_work_func_t do_work_func;
     aeron_udp_channel_incoming_interceptor_t *next_interceptor;
 };
 
@@ -488,4 +504,33 @@ inline int aeron_udp_channel_interceptors_image_notifications(
     return 0;
 }
 
+inline int aeron_udp_channel_data_paths_do_work(aeron_udp_channel_data_paths_t *data_paths)
+{
+    int work_count = 0;
+
+    for (
+        aeron_udp_channel_outgoing_interceptor_t *interceptor = data_paths->outgoing_interceptors;
+        NULL != interceptor;
+        interceptor = interceptor->next_interceptor)
+    {
+        if (NULL != interceptor->do_work_func)
+        {
+            work_count += interceptor->do_work_func(interceptor->interceptor_state, interceptor->next_interceptor);
+        }
+    }
+
+    for (
+        aeron_udp_channel_incoming_interceptor_t *interceptor = data_paths->incoming_interceptors;
+        NULL != interceptor;
+        interceptor = interceptor->next_interceptor)
+    {
+        if (NULL != interceptor->do_work_func)
+        {
+            work_count += interceptor->do_work_func(interceptor->interceptor_state, interceptor->next_interceptor);
+        }
+    }
+
+    return work_count;
+}
+
 #endif //AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_H
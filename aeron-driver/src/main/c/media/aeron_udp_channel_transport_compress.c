@@ -0,0 +1,755 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _BSD_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(AERON_COMPILER_MSVC)
+#include <netinet/udp.h>
+#endif
+
+#include "concurrent/aeron_thread.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+#include "util/aeron_error.h"
+#include "util/aeron_arrayutil.h"
+#include "aeron_alloc.h"
+#include "aeron_windows.h"
+#include "aeron_udp_channel.h"
+#include "aeron_udp_channel_transport_compress.h"
+
+#if !defined(HAVE_STRUCT_MMSGHDR)
+struct mmsghdr
+{
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif
+
+#define AERON_CONFIG_GETENV_OR_DEFAULT(e, d) ((NULL == getenv(e)) ? (d) : getenv(e))
+#define AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_COMPRESS_ARGS_ENV_VAR "AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_COMPRESS_ARGS"
+
+#define AERON_LZ4_MIN_MATCH (4)
+#define AERON_LZ4_LAST_LITERALS (5)
+#define AERON_LZ4_MF_LIMIT (12)
+#define AERON_LZ4_MAX_OFFSET (65535)
+#define AERON_LZ4_RUN_MASK (15)
+
+static AERON_INIT_ONCE env_is_initialized = AERON_INIT_ONCE_VALUE;
+
+static const aeron_udp_channel_interceptor_compress_params_t *aeron_udp_channel_interceptor_compress_params = NULL;
+
+aeron_udp_channel_interceptor_bindings_t *aeron_udp_channel_interceptor_compress_load(
+    const aeron_udp_channel_interceptor_bindings_t *delegate_bindings)
+{
+    aeron_udp_channel_interceptor_bindings_t *interceptor_bindings;
+    if (aeron_alloc((void **)&interceptor_bindings, sizeof(aeron_udp_channel_interceptor_bindings_t)) < 0)
+    {
+        return NULL;
+    }
+
+    interceptor_bindings->incoming_init_func = aeron_udp_channel_interceptor_compress_init_incoming;
+    interceptor_bindings->outgoing_init_func = aeron_udp_channel_interceptor_compress_init_outgoing;
+    interceptor_bindings->outgoing_mmsg_func = aeron_udp_channel_interceptor_compress_outgoing_mmsg;
+    interceptor_bindings->outgoing_msg_func = aeron_udp_channel_interceptor_compress_outgoing_msg;
+    interceptor_bindings->incoming_func = aeron_udp_channel_interceptor_compress_incoming;
+    interceptor_bindings->outgoing_close_func = aeron_udp_channel_interceptor_compress_close_outgoing;
+    interceptor_bindings->incoming_close_func = aeron_udp_channel_interceptor_compress_close_incoming;
+    interceptor_bindings->outgoing_transport_notification_func =
+        aeron_udp_channel_interceptor_compress_transport_notification;
+    interceptor_bindings->outgoing_publication_notification_func = NULL;
+    interceptor_bindings->outgoing_image_notification_func = NULL;
+    interceptor_bindings->incoming_transport_notification_func = NULL;
+    interceptor_bindings->incoming_publication_notification_func = NULL;
+    interceptor_bindings->incoming_image_notification_func = NULL;
+    interceptor_bindings->outgoing_do_work_func = NULL;
+    interceptor_bindings->incoming_do_work_func = NULL;
+
+    interceptor_bindings->meta_info.name = "compress";
+    interceptor_bindings->meta_info.type = "interceptor";
+    interceptor_bindings->meta_info.next_interceptor_bindings = delegate_bindings;
+
+    return interceptor_bindings;
+}
+
+void aeron_udp_channel_transport_compress_load_env()
+{
+    aeron_udp_channel_interceptor_compress_params_t *params;
+    const char *args = AERON_CONFIG_GETENV_OR_DEFAULT(AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_COMPRESS_ARGS_ENV_VAR, "");
+    char *args_dup = strdup(args);
+
+    if (aeron_alloc((void **)&params, sizeof(aeron_udp_channel_interceptor_compress_params_t)) < 0)
+    {
+        aeron_free(args_dup);
+        return;
+    }
+
+    params->min_length = AERON_UDP_CHANNEL_INTERCEPTOR_COMPRESS_MIN_LENGTH_DEFAULT;
+
+    if (aeron_udp_channel_interceptor_compress_parse_params(args_dup, params) >= 0)
+    {
+        aeron_udp_channel_interceptor_compress_params = params;
+    }
+    else
+    {
+        aeron_free(params);
+    }
+
+    aeron_free(args_dup);
+}
+
+int aeron_udp_channel_interceptor_compress_init_outgoing(
+    void **interceptor_state, aeron_driver_context_t *context, aeron_udp_channel_transport_affinity_t affinity)
+{
+    (void)aeron_thread_once(&env_is_initialized, aeron_udp_channel_transport_compress_load_env);
+
+    if (NULL == aeron_udp_channel_interceptor_compress_params)
+    {
+        aeron_set_err(EINVAL, "%s", "could not load compress interceptor args");
+        return -1;
+    }
+
+    aeron_udp_channel_interceptor_compress_outgoing_state_t *state;
+    if (aeron_alloc((void **)&state, sizeof(aeron_udp_channel_interceptor_compress_outgoing_state_t)) < 0)
+    {
+        aeron_set_err_from_last_err_code("could not allocate compress outgoing state");
+        return -1;
+    }
+
+    state->min_length = aeron_udp_channel_interceptor_compress_params->min_length;
+    *interceptor_state = state;
+
+    return 0;
+}
+
+int aeron_udp_channel_interceptor_compress_init_incoming(
+    void **interceptor_state, aeron_driver_context_t *context, aeron_udp_channel_transport_affinity_t affinity)
+{
+    aeron_udp_channel_interceptor_compress_incoming_state_t *state;
+    if (aeron_alloc((void **)&state, sizeof(aeron_udp_channel_interceptor_compress_incoming_state_t)) < 0)
+    {
+        aeron_set_err_from_last_err_code("could not allocate compress incoming state");
+        return -1;
+    }
+
+    *interceptor_state = state;
+
+    return 0;
+}
+
+int aeron_udp_channel_interceptor_compress_close_outgoing(void *interceptor_state)
+{
+    aeron_udp_channel_interceptor_compress_outgoing_state_t *state = interceptor_state;
+
+    if (NULL != state)
+    {
+        for (size_t i = 0; i < AERON_UDP_CHANNEL_INTERCEPTOR_COMPRESS_MAX_MESSAGES; i++)
+        {
+            aeron_free(state->slots[i].buffer);
+        }
+
+        aeron_free(state->transports.array);
+        aeron_free(state);
+    }
+
+    return 0;
+}
+
+int aeron_udp_channel_interceptor_compress_close_incoming(void *interceptor_state)
+{
+    aeron_udp_channel_interceptor_compress_incoming_state_t *state = interceptor_state;
+
+    if (NULL != state)
+    {
+        aeron_free(state->slot.buffer);
+        aeron_free(state);
+    }
+
+    return 0;
+}
+
+static int aeron_udp_channel_interceptor_compress_ensure_capacity(
+    aeron_udp_channel_interceptor_compress_slot_t *slot, size_t length)
+{
+    if (length > slot->capacity)
+    {
+        if (aeron_reallocf((void **)&slot->buffer, length) < 0)
+        {
+            slot->capacity = 0;
+            return -1;
+        }
+
+        slot->capacity = length;
+    }
+
+    return 0;
+}
+
+static inline uint32_t aeron_lz4_read32(const uint8_t *p)
+{
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static inline uint32_t aeron_lz4_hash(uint32_t sequence)
+{
+    return (sequence * 2654435761u) >> (32 - AERON_UDP_CHANNEL_INTERCEPTOR_COMPRESS_LZ4_HASH_LOG);
+}
+
+static inline size_t aeron_lz4_extra_length_bytes(size_t length)
+{
+    return length >= AERON_LZ4_RUN_MASK ? ((length - AERON_LZ4_RUN_MASK) / 255) + 1 : 0;
+}
+
+static inline uint8_t *aeron_lz4_write_extra_length(uint8_t *op, size_t length)
+{
+    for (length -= AERON_LZ4_RUN_MASK; length >= 255; length -= 255)
+    {
+        *op++ = 255;
+    }
+
+    *op++ = (uint8_t)length;
+
+    return op;
+}
+
+static uint8_t *aeron_lz4_write_sequence(
+    uint8_t *op, const uint8_t *literals, size_t literal_length, size_t offset, size_t match_length)
+{
+    uint8_t *token = op++;
+
+    if (literal_length >= AERON_LZ4_RUN_MASK)
+    {
+        *token = AERON_LZ4_RUN_MASK << 4;
+        op = aeron_lz4_write_extra_length(op, literal_length);
+    }
+    else
+    {
+        *token = (uint8_t)(literal_length << 4);
+    }
+
+    memcpy(op, literals, literal_length);
+    op += literal_length;
+
+    if (0 != offset)
+    {
+        *op++ = (uint8_t)(offset & 0xFF);
+        *op++ = (uint8_t)(offset >> 8);
+
+        if (match_length >= AERON_LZ4_RUN_MASK)
+        {
+            *token |= AERON_LZ4_RUN_MASK;
+            op = aeron_lz4_write_extra_length(op, match_length);
+        }
+        else
+        {
+            *token |= (uint8_t)match_length;
+        }
+    }
+
+    return op;
+}
+
+/*
+ * Greedy single pass match finder over a hash of the next four bytes. It trades ratio for speed, which suits the
+ * repeated field names and values of text and SBE payloads.
+ */
+size_t aeron_udp_channel_interceptor_compress_lz4_encode(
+    const uint8_t *src, size_t length, uint8_t *dst, size_t capacity, uint16_t *table)
+{
+    if (length > UINT16_MAX)
+    {
+        return 0;
+    }
+
+    const uint8_t *ip = src;
+    const uint8_t *anchor = src;
+    const uint8_t *iend = src + length;
+    uint8_t *op = dst;
+    uint8_t *oend = dst + capacity;
+
+    memset(table, 0, sizeof(uint16_t) << AERON_UDP_CHANNEL_INTERCEPTOR_COMPRESS_LZ4_HASH_LOG);
+
+    if (length > AERON_LZ4_MF_LIMIT)
+    {
+        const uint8_t *mflimit = iend - AERON_LZ4_MF_LIMIT;
+        const uint8_t *matchlimit = iend - AERON_LZ4_LAST_LITERALS;
+
+        while (ip < mflimit)
+        {
+            const uint32_t sequence = aeron_lz4_read32(ip);
+            const uint32_t hash = aeron_lz4_hash(sequence);
+            const uint8_t *ref = src + table[hash];
+
+            table[hash] = (uint16_t)(ip - src);
+
+            if (ref >= ip || (size_t)(ip - ref) > AERON_LZ4_MAX_OFFSET || aeron_lz4_read32(ref) != sequence)
+            {
+                ip++;
+                continue;
+            }
+
+            const uint8_t *match_end = ip + AERON_LZ4_MIN_MATCH;
+            const uint8_t *ref_end = ref + AERON_LZ4_MIN_MATCH;
+            while (match_end < matchlimit && *match_end == *ref_end)
+            {
+                match_end++;
+                ref_end++;
+            }
+
+            while (ip > anchor && ref > src && ip[-1] == ref[-1])
+            {
+                ip--;
+                ref--;
+            }
+
+            const size_t literal_length = (size_t)(ip - anchor);
+            const size_t match_length = (size_t)(match_end - ip) - AERON_LZ4_MIN_MATCH;
+            const size_t required = 1 + aeron_lz4_extra_length_bytes(literal_length) + literal_length + 2 +
+                aeron_lz4_extra_length_bytes(match_length);
+
+            if ((size_t)(oend - op) < required)
+            {
+                return 0;
+            }
+
+            op = aeron_lz4_write_sequence(op, anchor, literal_length, (size_t)(ip - ref), match_length);
+            ip = match_end;
+            anchor = ip;
+        }
+    }
+
+    const size_t literal_length = (size_t)(iend - anchor);
+    if ((size_t)(oend - op) < 1 + aeron_lz4_extra_length_bytes(literal_length) + literal_length)
+    {
+        return 0;
+    }
+
+    op = aeron_lz4_write_sequence(op, anchor, literal_length, 0, 0);
+
+    return (size_t)(op - dst);
+}
+
+static inline bool aeron_lz4_read_extra_length(const uint8_t **ip, const uint8_t *iend, size_t *length)
+{
+    uint8_t b;
+
+    do
+    {
+        if (*ip >= iend)
+        {
+            return false;
+        }
+
+        b = *(*ip)++;
+        *length += b;
+    }
+    while (255 == b);
+
+    return true;
+}
+
+size_t aeron_udp_channel_interceptor_compress_lz4_decode(
+    const uint8_t *src, size_t length, uint8_t *dst, size_t capacity)
+{
+    const uint8_t *ip = src;
+    const uint8_t *iend = src + length;
+    uint8_t *op = dst;
+    uint8_t *oend = dst + capacity;
+
+    while (ip < iend)
+    {
+        const uint8_t token = *ip++;
+        size_t literal_length = token >> 4;
+
+        if (AERON_LZ4_RUN_MASK == literal_length && !aeron_lz4_read_extra_length(&ip, iend, &literal_length))
+        {
+            return 0;
+        }
+
+        if (literal_length > (size_t)(iend - ip) || literal_length > (size_t)(oend - op))
+        {
+            return 0;
+        }
+
+        memcpy(op, ip, literal_length);
+        op += literal_length;
+        ip += literal_length;
+
+        if (ip == iend)
+        {
+            break;
+        }
+
+        if (iend - ip < 2)
+        {
+            return 0;
+        }
+
+        const size_t offset = (size_t)ip[0] | ((size_t)ip[1] << 8);
+        ip += 2;
+
+        if (0 == offset || offset > (size_t)(op - dst))
+        {
+            return 0;
+        }
+
+        size_t match_length = token & AERON_LZ4_RUN_MASK;
+        if (AERON_LZ4_RUN_MASK == match_length && !aeron_lz4_read_extra_length(&ip, iend, &match_length))
+        {
+            return 0;
+        }
+
+        match_length += AERON_LZ4_MIN_MATCH;
+        if (match_length > (size_t)(oend - op))
+        {
+            return 0;
+        }
+
+        /* matches may overlap the bytes they produce so copy forwards a byte at a time */
+        const uint8_t *ref = op - offset;
+        for (size_t i = 0; i < match_length; i++)
+        {
+            op[i] = ref[i];
+        }
+
+        op += match_length;
+    }
+
+    return (size_t)(op - dst);
+}
+
+static bool aeron_udp_channel_interceptor_compress_is_tracked(
+    aeron_udp_channel_interceptor_compress_outgoing_state_t *state, aeron_udp_channel_transport_t *transport)
+{
+    for (size_t i = 0; i < state->transports.length; i++)
+    {
+        if (transport == state->transports.array[i])
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static bool aeron_udp_channel_interceptor_compress_is_segmented(struct msghdr *message)
+{
+#if defined(UDP_SEGMENT)
+    if (NULL != message->msg_control)
+    {
+        for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(message); NULL != cmsg; cmsg = CMSG_NXTHDR(message, cmsg))
+        {
+            if (SOL_UDP == cmsg->cmsg_level && UDP_SEGMENT == cmsg->cmsg_type)
+            {
+                return true;
+            }
+        }
+    }
+#endif
+
+    return false;
+}
+
+/*
+ * Compress a data datagram into the slot filling in iov, returning false when it should go out as is. A GSO send is
+ * split by the kernel into equal sized segments, which compressed datagrams are not, so it is left alone.
+ */
+static bool aeron_udp_channel_interceptor_compress_message(
+    aeron_udp_channel_interceptor_compress_outgoing_state_t *state,
+    aeron_udp_channel_interceptor_compress_slot_t *slot,
+    struct msghdr *message,
+    struct iovec *iov)
+{
+    if (1 != message->msg_iovlen || aeron_udp_channel_interceptor_compress_is_segmented(message))
+    {
+        return false;
+    }
+
+    const uint8_t *buffer = message->msg_iov[0].iov_base;
+    const size_t length = message->msg_iov[0].iov_len;
+    const size_t header_length = sizeof(aeron_udp_channel_interceptor_compress_header_t);
+
+    if (length < (size_t)state->min_length ||
+        length > AERON_MAX_UDP_PAYLOAD_LENGTH ||
+        AERON_HDR_TYPE_DATA != ((const aeron_frame_header_t *)buffer)->type ||
+        aeron_udp_channel_interceptor_compress_ensure_capacity(slot, length) < 0)
+    {
+        return false;
+    }
+
+    const size_t compressed_length = aeron_udp_channel_interceptor_compress_lz4_encode(
+        buffer, length, slot->buffer + header_length, length - header_length - 1, state->lz4_table);
+
+    if (0 == compressed_length)
+    {
+        return false;
+    }
+
+    aeron_udp_channel_interceptor_compress_header_t *header =
+        (aeron_udp_channel_interceptor_compress_header_t *)slot->buffer;
+
+    header->frame_header.frame_length = (int32_t)(header_length + compressed_length);
+    header->frame_header.version = AERON_FRAME_HEADER_VERSION;
+    header->frame_header.flags = 0;
+    header->frame_header.type = AERON_UDP_CHANNEL_INTERCEPTOR_COMPRESS_HDR_TYPE;
+    header->uncompressed_length = (int32_t)length;
+    header->codec = AERON_UDP_CHANNEL_INTERCEPTOR_COMPRESS_CODEC_LZ4;
+
+    iov->iov_base = slot->buffer;
+    iov->iov_len = header_length + compressed_length;
+
+    state->compressed_count++;
+    state->uncompressed_bytes += (int64_t)length;
+    state->compressed_bytes += (int64_t)iov->iov_len;
+
+    return true;
+}
+
+int aeron_udp_channel_interceptor_compress_outgoing_mmsg(
+    void *interceptor_state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen)
+{
+    aeron_udp_channel_interceptor_compress_outgoing_state_t *state = interceptor_state;
+
+    if (!aeron_udp_channel_interceptor_compress_is_tracked(state, transport))
+    {
+        return delegate->outgoing_mmsg_func(
+            delegate->interceptor_state, delegate->next_interceptor, transport, msgvec, vlen);
+    }
+
+    struct mmsghdr compressed_msgvec[AERON_UDP_CHANNEL_INTERCEPTOR_COMPRESS_MAX_MESSAGES];
+    struct iovec iov[AERON_UDP_CHANNEL_INTERCEPTOR_COMPRESS_MAX_MESSAGES];
+    int sent = 0;
+
+    /* callers see the lengths they handed in, not those that went on the wire */
+    for (size_t offset = 0; offset < vlen; offset += AERON_UDP_CHANNEL_INTERCEPTOR_COMPRESS_MAX_MESSAGES)
+    {
+        const size_t remaining = vlen - offset;
+        const size_t batch = remaining < AERON_UDP_CHANNEL_INTERCEPTOR_COMPRESS_MAX_MESSAGES ?
+            remaining : AERON_UDP_CHANNEL_INTERCEPTOR_COMPRESS_MAX_MESSAGES;
+
+        for (size_t i = 0; i < batch; i++)
+        {
+            compressed_msgvec[i] = msgvec[offset + i];
+            if (aeron_udp_channel_interceptor_compress_message(
+                state, &state->slots[i], &msgvec[offset + i].msg_hdr, &iov[i]))
+            {
+                compressed_msgvec[i].msg_hdr.msg_iov = &iov[i];
+            }
+        }
+
+        const int result = delegate->outgoing_mmsg_func(
+            delegate->interceptor_state, delegate->next_interceptor, transport, compressed_msgvec, batch);
+
+        if (result < 0)
+        {
+            return 0 == sent ? result : sent;
+        }
+
+        for (int i = 0; i < result; i++)
+        {
+            msgvec[offset + i].msg_len = &iov[i] == compressed_msgvec[i].msg_hdr.msg_iov ?
+                (unsigned int)msgvec[offset + i].msg_hdr.msg_iov[0].iov_len : compressed_msgvec[i].msg_len;
+        }
+
+        sent += result;
+
+        if ((size_t)result < batch)
+        {
+            break;
+        }
+    }
+
+    return sent;
+}
+
+int aeron_udp_channel_interceptor_compress_outgoing_msg(
+    void *interceptor_state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *message)
+{
+    aeron_udp_channel_interceptor_compress_outgoing_state_t *state = interceptor_state;
+    struct msghdr compressed_message;
+    struct iovec iov;
+
+    if (!aeron_udp_channel_interceptor_compress_is_tracked(state, transport) ||
+        !aeron_udp_channel_interceptor_compress_message(state, &state->slots[0], message, &iov))
+    {
+        return delegate->outgoing_msg_func(delegate->interceptor_state, delegate->next_interceptor, transport, message);
+    }
+
+    compressed_message = *message;
+    compressed_message.msg_iov = &iov;
+
+    const int result = delegate->outgoing_msg_func(
+        delegate->interceptor_state, delegate->next_interceptor, transport, &compressed_message);
+
+    return result > 0 ? (int)message->msg_iov[0].iov_len : result;
+}
+
+void aeron_udp_channel_interceptor_compress_incoming(
+    void *interceptor_state,
+    aeron_udp_channel_incoming_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    void *receiver_clientd,
+    void *endpoint_clientd,
+    void *destination_clientd,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr)
+{
+    aeron_udp_channel_interceptor_compress_incoming_state_t *state = interceptor_state;
+    const aeron_frame_header_t *frame_header = (const aeron_frame_header_t *)buffer;
+
+    if (length >= sizeof(aeron_frame_header_t) &&
+        AERON_UDP_CHANNEL_INTERCEPTOR_COMPRESS_HDR_TYPE == frame_header->type)
+    {
+        const aeron_udp_channel_interceptor_compress_header_t *header =
+            (const aeron_udp_channel_interceptor_compress_header_t *)buffer;
+        const size_t header_length = sizeof(aeron_udp_channel_interceptor_compress_header_t);
+
+        if (length <= header_length ||
+            AERON_UDP_CHANNEL_INTERCEPTOR_COMPRESS_CODEC_LZ4 != header->codec ||
+            header->uncompressed_length <= 0 ||
+            header->uncompressed_length > AERON_MAX_UDP_PAYLOAD_LENGTH ||
+            aeron_udp_channel_interceptor_compress_ensure_capacity(
+                &state->slot, (size_t)header->uncompressed_length) < 0)
+        {
+            state->malformed_count++;
+            return;
+        }
+
+        const size_t uncompressed_length = aeron_udp_channel_interceptor_compress_lz4_decode(
+            buffer + header_length, length - header_length, state->slot.buffer, (size_t)header->uncompressed_length);
+
+        /* a datagram that does not decode is dropped like a corrupt one and recovered by a NAK */
+        if (uncompressed_length != (size_t)header->uncompressed_length)
+        {
+            state->malformed_count++;
+            return;
+        }
+
+        buffer = state->slot.buffer;
+        length = uncompressed_length;
+    }
+
+    delegate->incoming_func(
+        delegate->interceptor_state,
+        delegate->next_interceptor,
+        transport,
+        receiver_clientd,
+        endpoint_clientd,
+        destination_clientd,
+        buffer,
+        length,
+        addr);
+}
+
+int aeron_udp_channel_interceptor_compress_transport_notification(
+    void *interceptor_state,
+    aeron_udp_channel_transport_t *transport,
+    const aeron_udp_channel_t *udp_channel,
+    aeron_data_packet_dispatcher_t *data_packet_dispatcher,
+    aeron_udp_channel_interceptor_notification_type_t type)
+{
+    aeron_udp_channel_interceptor_compress_outgoing_state_t *state = interceptor_state;
+
+    if (AERON_UDP_CHANNEL_INTERCEPTOR_ADD_NOTIFICATION == type)
+    {
+        const char *codec = NULL != udp_channel ?
+            aeron_uri_find_param_value(&udp_channel->uri.params.udp.additional_params, AERON_URI_COMPRESS_KEY) : NULL;
+
+        if (NULL == codec || aeron_udp_channel_interceptor_compress_is_tracked(state, transport))
+        {
+            return 0;
+        }
+
+        if (0 != strncmp(codec, AERON_URI_COMPRESS_LZ4_VALUE, sizeof(AERON_URI_COMPRESS_LZ4_VALUE)))
+        {
+            aeron_set_err(EINVAL, "unsupported %s=%s in URI: %s", AERON_URI_COMPRESS_KEY, codec, udp_channel->original_uri);
+            return -1;
+        }
+
+        int ensure_capacity_result = 0;
+        AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, state->transports, aeron_udp_channel_transport_t *);
+        if (ensure_capacity_result < 0)
+        {
+            aeron_set_err_from_last_err_code("could not track compressed transport");
+            return -1;
+        }
+
+        state->transports.array[state->transports.length++] = transport;
+    }
+    else
+    {
+        for (size_t i = 0, last_index = state->transports.length - 1; i < state->transports.length; i++)
+        {
+            if (transport == state->transports.array[i])
+            {
+                aeron_array_fast_unordered_remove(
+                    (uint8_t *)state->transports.array, sizeof(aeron_udp_channel_transport_t *), i, last_index);
+                state->transports.length--;
+                break;
+            }
+        }
+    }
+
+    return 0;
+}
+
+int aeron_udp_channel_interceptor_compress_parse_params(
+    char *uri, aeron_udp_channel_interceptor_compress_params_t *params)
+{
+    return aeron_uri_parse_params(uri, aeron_udp_channel_interceptor_compress_parse_callback, (void *)params);
+}
+
+int aeron_udp_channel_interceptor_compress_parse_callback(void *clientd, const char *key, const char *value)
+{
+    aeron_udp_channel_interceptor_compress_params_t *params = clientd;
+    int result = 0;
+
+    if (strncmp(key, "min-length", sizeof("min-length")) == 0)
+    {
+        errno = 0;
+        char *endptr;
+        const long min_length = strtol(value, &endptr, 10);
+
+        if (errno != 0 || value == endptr ||
+            min_length < (long)(sizeof(aeron_udp_channel_interceptor_compress_header_t) + AERON_DATA_HEADER_LENGTH) ||
+            min_length > AERON_MAX_UDP_PAYLOAD_LENGTH)
+        {
+            aeron_set_err(EINVAL, "Could not parse compress %s from: %s", key, value);
+            result = -1;
+        }
+        else
+        {
+            params->min_length = (int32_t)min_length;
+        }
+    }
+
+    return result;
+}
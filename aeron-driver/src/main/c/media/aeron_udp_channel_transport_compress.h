@@ -0,0 +1,147 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_UDP_CHANNEL_TRANSPORT_COMPRESS_H
+#define AERON_UDP_CHANNEL_TRANSPORT_COMPRESS_H
+
+#include "protocol/aeron_udp_protocol.h"
+#include "aeron_udp_channel_transport_bindings.h"
+
+#define AERON_UDP_CHANNEL_INTERCEPTOR_COMPRESS_HDR_TYPE (0x0E)
+#define AERON_UDP_CHANNEL_INTERCEPTOR_COMPRESS_CODEC_LZ4 (1)
+#define AERON_UDP_CHANNEL_INTERCEPTOR_COMPRESS_MIN_LENGTH_DEFAULT (128)
+#define AERON_UDP_CHANNEL_INTERCEPTOR_COMPRESS_MAX_MESSAGES (16)
+#define AERON_UDP_CHANNEL_INTERCEPTOR_COMPRESS_LZ4_HASH_LOG (12)
+
+#pragma pack(push)
+#pragma pack(4)
+/*
+ * A compressed datagram is this header followed by the original datagram, which may hold several frames, encoded
+ * with the codec.
+ */
+typedef struct aeron_udp_channel_interceptor_compress_header_stct
+{
+    aeron_frame_header_t frame_header;
+    int32_t uncompressed_length;
+    int32_t codec;
+}
+aeron_udp_channel_interceptor_compress_header_t;
+#pragma pack(pop)
+
+typedef struct aeron_udp_channel_interceptor_compress_params_stct
+{
+    int32_t min_length;
+}
+aeron_udp_channel_interceptor_compress_params_t;
+
+typedef struct aeron_udp_channel_interceptor_compress_slot_stct
+{
+    size_t capacity;
+    uint8_t *buffer;
+}
+aeron_udp_channel_interceptor_compress_slot_t;
+
+typedef struct aeron_udp_channel_interceptor_compress_outgoing_state_stct
+{
+    int32_t min_length;
+    uint16_t lz4_table[1u << AERON_UDP_CHANNEL_INTERCEPTOR_COMPRESS_LZ4_HASH_LOG];
+    aeron_udp_channel_interceptor_compress_slot_t slots[AERON_UDP_CHANNEL_INTERCEPTOR_COMPRESS_MAX_MESSAGES];
+
+    /* transports of channels with compress=lz4, only their data is compressed */
+    struct aeron_udp_channel_interceptor_compress_transports_stct
+    {
+        aeron_udp_channel_transport_t **array;
+        size_t length;
+        size_t capacity;
+    }
+    transports;
+
+    int64_t compressed_count;
+    int64_t uncompressed_bytes;
+    int64_t compressed_bytes;
+}
+aeron_udp_channel_interceptor_compress_outgoing_state_t;
+
+typedef struct aeron_udp_channel_interceptor_compress_incoming_state_stct
+{
+    aeron_udp_channel_interceptor_compress_slot_t slot;
+    int64_t malformed_count;
+}
+aeron_udp_channel_interceptor_compress_incoming_state_t;
+
+aeron_udp_channel_interceptor_bindings_t *aeron_udp_channel_interceptor_compress_load(
+    const aeron_udp_channel_interceptor_bindings_t *delegate_bindings);
+
+int aeron_udp_channel_interceptor_compress_init_outgoing(
+    void **interceptor_state, aeron_driver_context_t *context, aeron_udp_channel_transport_affinity_t affinity);
+
+int aeron_udp_channel_interceptor_compress_init_incoming(
+    void **interceptor_state, aeron_driver_context_t *context, aeron_udp_channel_transport_affinity_t affinity);
+
+int aeron_udp_channel_interceptor_compress_close_outgoing(void *interceptor_state);
+
+int aeron_udp_channel_interceptor_compress_close_incoming(void *interceptor_state);
+
+int aeron_udp_channel_interceptor_compress_outgoing_mmsg(
+    void *interceptor_state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen);
+
+int aeron_udp_channel_interceptor_compress_outgoing_msg(
+    void *interceptor_state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *message);
+
+void aeron_udp_channel_interceptor_compress_incoming(
+    void *interceptor_state,
+    aeron_udp_channel_incoming_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    void *receiver_clientd,
+    void *endpoint_clientd,
+    void *destination_clientd,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr);
+
+int aeron_udp_channel_interceptor_compress_transport_notification(
+    void *interceptor_state,
+    aeron_udp_channel_transport_t *transport,
+    const aeron_udp_channel_t *udp_channel,
+    aeron_data_packet_dispatcher_t *data_packet_dispatcher,
+    aeron_udp_channel_interceptor_notification_type_t type);
+
+/*
+ * Encode src as an LZ4 block into dst returning the encoded length, or 0 when it does not fit in capacity. The
+ * table is scratch space for the match finder and src must be no longer than UINT16_MAX.
+ */
+size_t aeron_udp_channel_interceptor_compress_lz4_encode(
+    const uint8_t *src, size_t length, uint8_t *dst, size_t capacity, uint16_t *table);
+
+/*
+ * Decode an LZ4 block into dst returning the decoded length, or 0 when the block is malformed or does not fit.
+ */
+size_t aeron_udp_channel_interceptor_compress_lz4_decode(
+    const uint8_t *src, size_t length, uint8_t *dst, size_t capacity);
+
+int aeron_udp_channel_interceptor_compress_parse_params(
+    char *uri, aeron_udp_channel_interceptor_compress_params_t *params);
+
+int aeron_udp_channel_interceptor_compress_parse_callback(void *clientd, const char *key, const char *value);
+
+#endif //AERON_UDP_CHANNEL_TRANSPORT_COMPRESS_H
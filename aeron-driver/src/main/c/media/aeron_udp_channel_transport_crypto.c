@@ -0,0 +1,756 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _BSD_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#if !defined(AERON_COMPILER_MSVC)
+#include <netinet/udp.h>
+#endif
+
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+#include <openssl/crypto.h>
+
+#include "concurrent/aeron_thread.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+#include "util/aeron_error.h"
+#include "util/aeron_dlopen.h"
+#include "util/aeron_parse_util.h"
+#include "aeron_alloc.h"
+#include "aeron_windows.h"
+#include "aeron_udp_channel_transport_crypto.h"
+
+#if !defined(HAVE_STRUCT_MMSGHDR)
+struct mmsghdr
+{
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif
+
+#define AERON_CONFIG_GETENV_OR_DEFAULT(e, d) ((NULL == getenv(e)) ? (d) : getenv(e))
+#define AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_CRYPTO_ARGS_ENV_VAR "AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_CRYPTO_ARGS"
+
+static AERON_INIT_ONCE env_is_initialized = AERON_INIT_ONCE_VALUE;
+
+static const aeron_udp_channel_interceptor_crypto_params_t *aeron_udp_channel_interceptor_crypto_params = NULL;
+
+aeron_udp_channel_interceptor_bindings_t *aeron_udp_channel_interceptor_crypto_load(
+    const aeron_udp_channel_interceptor_bindings_t *delegate_bindings)
+{
+    aeron_udp_channel_interceptor_bindings_t *interceptor_bindings;
+    if (aeron_alloc((void **)&interceptor_bindings, sizeof(aeron_udp_channel_interceptor_bindings_t)) < 0)
+    {
+        return NULL;
+    }
+
+    interceptor_bindings->incoming_init_func = aeron_udp_channel_interceptor_crypto_init_incoming;
+    interceptor_bindings->outgoing_init_func = aeron_udp_channel_interceptor_crypto_init_outgoing;
+    interceptor_bindings->outgoing_mmsg_func = aeron_udp_channel_interceptor_crypto_outgoing_mmsg;
+    interceptor_bindings->outgoing_msg_func = aeron_udp_channel_interceptor_crypto_outgoing_msg;
+    interceptor_bindings->incoming_func = aeron_udp_channel_interceptor_crypto_incoming;
+    interceptor_bindings->outgoing_close_func = aeron_udp_channel_interceptor_crypto_close_outgoing;
+    interceptor_bindings->incoming_close_func = aeron_udp_channel_interceptor_crypto_close_incoming;
+    interceptor_bindings->outgoing_transport_notification_func = NULL;
+    interceptor_bindings->outgoing_publication_notification_func = NULL;
+    interceptor_bindings->outgoing_image_notification_func = NULL;
+    interceptor_bindings->incoming_transport_notification_func = NULL;
+    interceptor_bindings->incoming_publication_notification_func = NULL;
+    interceptor_bindings->incoming_image_notification_func = NULL;
+    interceptor_bindings->outgoing_do_work_func = NULL;
+    interceptor_bindings->incoming_do_work_func = NULL;
+
+    interceptor_bindings->meta_info.name = "crypto";
+    interceptor_bindings->meta_info.type = "interceptor";
+    interceptor_bindings->meta_info.next_interceptor_bindings = delegate_bindings;
+
+    return interceptor_bindings;
+}
+
+int aeron_udp_channel_interceptor_crypto_configure(const aeron_udp_channel_interceptor_crypto_params_t *crypto_params)
+{
+    aeron_udp_channel_interceptor_crypto_params = crypto_params;
+
+    return 0;
+}
+
+void aeron_udp_channel_transport_crypto_load_env()
+{
+    aeron_udp_channel_interceptor_crypto_params_t *params;
+    const char *args = AERON_CONFIG_GETENV_OR_DEFAULT(AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_CRYPTO_ARGS_ENV_VAR, "");
+    char *args_dup = strdup(args);
+
+    if (aeron_alloc((void **)&params, sizeof(aeron_udp_channel_interceptor_crypto_params_t)) < 0)
+    {
+        aeron_free(args_dup);
+        return;
+    }
+
+    if (aeron_udp_channel_interceptor_crypto_parse_params(args_dup, params) >= 0 && 0 != params->key_length)
+    {
+        aeron_udp_channel_interceptor_crypto_configure(params);
+    }
+    else
+    {
+        OPENSSL_cleanse(params, sizeof(aeron_udp_channel_interceptor_crypto_params_t));
+        aeron_free(params);
+    }
+
+    aeron_free(args_dup);
+}
+
+static const EVP_CIPHER *aeron_udp_channel_interceptor_crypto_cipher(size_t key_length)
+{
+    return 16 == key_length ? EVP_aes_128_gcm() : EVP_aes_256_gcm();
+}
+
+/*
+ * The cipher context is keyed once here so each datagram only resets the IV, which keeps the expanded AES-NI key
+ * schedule warm across a whole mmsghdr vector.
+ */
+static EVP_CIPHER_CTX *aeron_udp_channel_interceptor_crypto_new_ctx(
+    const aeron_udp_channel_interceptor_crypto_params_t *params, bool encrypt)
+{
+    EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
+
+    if (NULL == ctx)
+    {
+        aeron_set_err(ENOMEM, "%s", "could not allocate crypto cipher context");
+        return NULL;
+    }
+
+    const EVP_CIPHER *cipher = aeron_udp_channel_interceptor_crypto_cipher(params->key_length);
+    const int result = encrypt ?
+        EVP_EncryptInit_ex(ctx, cipher, NULL, params->key, NULL) :
+        EVP_DecryptInit_ex(ctx, cipher, NULL, params->key, NULL);
+
+    if (1 != result)
+    {
+        EVP_CIPHER_CTX_free(ctx);
+        aeron_set_err(EINVAL, "%s", "could not initialise crypto cipher context");
+        return NULL;
+    }
+
+    return ctx;
+}
+
+int aeron_udp_channel_interceptor_crypto_init_outgoing(
+    void **interceptor_state, aeron_driver_context_t *context, aeron_udp_channel_transport_affinity_t affinity)
+{
+    (void)aeron_thread_once(&env_is_initialized, aeron_udp_channel_transport_crypto_load_env);
+
+    if (NULL == aeron_udp_channel_interceptor_crypto_params)
+    {
+        aeron_set_err(EINVAL, "%s", "could not load crypto interceptor key");
+        return -1;
+    }
+
+    aeron_udp_channel_interceptor_crypto_outgoing_state_t *state;
+    if (aeron_alloc((void **)&state, sizeof(aeron_udp_channel_interceptor_crypto_outgoing_state_t)) < 0)
+    {
+        aeron_set_err_from_last_err_code("could not allocate crypto outgoing state");
+        return -1;
+    }
+
+    /* a random salt and starting counter per state keep IVs unique across agents sharing the key */
+    if (1 != RAND_bytes(state->iv_salt, sizeof(state->iv_salt)) ||
+        1 != RAND_bytes((uint8_t *)&state->iv_counter, sizeof(state->iv_counter)) ||
+        NULL == (state->cipher_ctx = aeron_udp_channel_interceptor_crypto_new_ctx(
+            aeron_udp_channel_interceptor_crypto_params, true)))
+    {
+        aeron_set_err(EINVAL, "%s", "could not initialise crypto outgoing state");
+        aeron_free(state);
+        return -1;
+    }
+
+    state->key_id = aeron_udp_channel_interceptor_crypto_params->key_id;
+    *interceptor_state = state;
+
+    return 0;
+}
+
+int aeron_udp_channel_interceptor_crypto_init_incoming(
+    void **interceptor_state, aeron_driver_context_t *context, aeron_udp_channel_transport_affinity_t affinity)
+{
+    (void)aeron_thread_once(&env_is_initialized, aeron_udp_channel_transport_crypto_load_env);
+
+    if (NULL == aeron_udp_channel_interceptor_crypto_params)
+    {
+        aeron_set_err(EINVAL, "%s", "could not load crypto interceptor key");
+        return -1;
+    }
+
+    aeron_udp_channel_interceptor_crypto_incoming_state_t *state;
+    if (aeron_alloc((void **)&state, sizeof(aeron_udp_channel_interceptor_crypto_incoming_state_t)) < 0)
+    {
+        aeron_set_err_from_last_err_code("could not allocate crypto incoming state");
+        return -1;
+    }
+
+    if (NULL == (state->cipher_ctx = aeron_udp_channel_interceptor_crypto_new_ctx(
+        aeron_udp_channel_interceptor_crypto_params, false)))
+    {
+        aeron_free(state);
+        return -1;
+    }
+
+    state->key_id = aeron_udp_channel_interceptor_crypto_params->key_id;
+    state->allow_plaintext = aeron_udp_channel_interceptor_crypto_params->allow_plaintext;
+    *interceptor_state = state;
+
+    return 0;
+}
+
+int aeron_udp_channel_interceptor_crypto_close_outgoing(void *interceptor_state)
+{
+    aeron_udp_channel_interceptor_crypto_outgoing_state_t *state = interceptor_state;
+
+    if (NULL != state)
+    {
+        for (size_t i = 0; i < AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_MAX_MESSAGES; i++)
+        {
+            aeron_free(state->slots[i].buffer);
+        }
+
+        EVP_CIPHER_CTX_free(state->cipher_ctx);
+        aeron_free(state);
+    }
+
+    return 0;
+}
+
+int aeron_udp_channel_interceptor_crypto_close_incoming(void *interceptor_state)
+{
+    aeron_udp_channel_interceptor_crypto_incoming_state_t *state = interceptor_state;
+
+    if (NULL != state)
+    {
+        if (NULL != state->slot.buffer)
+        {
+            OPENSSL_cleanse(state->slot.buffer, state->slot.capacity);
+        }
+
+        aeron_free(state->slot.buffer);
+        EVP_CIPHER_CTX_free(state->cipher_ctx);
+        aeron_free(state);
+    }
+
+    return 0;
+}
+
+static int aeron_udp_channel_interceptor_crypto_ensure_capacity(
+    aeron_udp_channel_interceptor_crypto_slot_t *slot, size_t length)
+{
+    if (length > slot->capacity)
+    {
+        if (aeron_reallocf((void **)&slot->buffer, length) < 0)
+        {
+            slot->capacity = 0;
+            aeron_set_err_from_last_err_code("could not allocate crypto buffer");
+            return -1;
+        }
+
+        slot->capacity = length;
+    }
+
+    return 0;
+}
+
+static struct cmsghdr *aeron_udp_channel_interceptor_crypto_find_segment_cmsg(struct msghdr *message)
+{
+#if defined(UDP_SEGMENT)
+    if (NULL != message->msg_control)
+    {
+        for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(message); NULL != cmsg; cmsg = CMSG_NXTHDR(message, cmsg))
+        {
+            if (SOL_UDP == cmsg->cmsg_level && UDP_SEGMENT == cmsg->cmsg_type)
+            {
+                return cmsg;
+            }
+        }
+    }
+#endif
+
+    return NULL;
+}
+
+/*
+ * Seal the gathered iovs as one datagram into out, returning the sealed length or -1.
+ */
+static int aeron_udp_channel_interceptor_crypto_seal(
+    aeron_udp_channel_interceptor_crypto_outgoing_state_t *state,
+    const struct iovec *iov,
+    size_t iovlen,
+    size_t length,
+    uint8_t *out)
+{
+    EVP_CIPHER_CTX *ctx = state->cipher_ctx;
+    aeron_udp_channel_interceptor_crypto_header_t *header = (aeron_udp_channel_interceptor_crypto_header_t *)out;
+    uint8_t *ciphertext = out + sizeof(aeron_udp_channel_interceptor_crypto_header_t);
+    const uint64_t iv_counter = state->iv_counter++;
+    int out_length = 0;
+
+    header->frame_header.frame_length = (int32_t)(length + AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_OVERHEAD);
+    header->frame_header.version = AERON_FRAME_HEADER_VERSION;
+    header->frame_header.flags = 0;
+    header->frame_header.type = AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_HDR_TYPE;
+    header->key_id = state->key_id;
+    memcpy(header->iv, state->iv_salt, sizeof(state->iv_salt));
+    memcpy(header->iv + sizeof(state->iv_salt), &iv_counter, sizeof(iv_counter));
+
+    if (1 != EVP_EncryptInit_ex(ctx, NULL, NULL, NULL, header->iv) ||
+        1 != EVP_EncryptUpdate(
+            ctx, NULL, &out_length, out, (int)sizeof(aeron_udp_channel_interceptor_crypto_header_t)))
+    {
+        aeron_set_err(EINVAL, "%s", "could not start crypto seal");
+        return -1;
+    }
+
+    for (size_t i = 0; i < iovlen; i++)
+    {
+        if (1 != EVP_EncryptUpdate(ctx, ciphertext, &out_length, iov[i].iov_base, (int)iov[i].iov_len))
+        {
+            aeron_set_err(EINVAL, "%s", "could not seal datagram");
+            return -1;
+        }
+
+        ciphertext += out_length;
+    }
+
+    if (1 != EVP_EncryptFinal_ex(ctx, ciphertext, &out_length) ||
+        1 != EVP_CIPHER_CTX_ctrl(
+            ctx, EVP_CTRL_GCM_GET_TAG, AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_TAG_LENGTH, ciphertext + out_length))
+    {
+        aeron_set_err(EINVAL, "%s", "could not finish crypto seal");
+        return -1;
+    }
+
+    return header->frame_header.frame_length;
+}
+
+/*
+ * Seal a message into the slot and point sealed at it. A GSO send is sealed one segment at a time with the segment
+ * size grown by the overhead, so the receiver still gets one authenticated datagram per segment.
+ */
+static int aeron_udp_channel_interceptor_crypto_seal_message(
+    aeron_udp_channel_interceptor_crypto_outgoing_state_t *state,
+    aeron_udp_channel_interceptor_crypto_slot_t *slot,
+    struct msghdr *message,
+    struct msghdr *sealed,
+    struct iovec *sealed_iov)
+{
+    struct cmsghdr *segment_cmsg = aeron_udp_channel_interceptor_crypto_find_segment_cmsg(message);
+    size_t length = 0;
+
+    for (size_t i = 0; i < (size_t)message->msg_iovlen; i++)
+    {
+        length += message->msg_iov[i].iov_len;
+    }
+
+    *sealed = *message;
+    sealed->msg_iov = sealed_iov;
+    sealed->msg_iovlen = 1;
+
+    if (NULL == segment_cmsg)
+    {
+        if (length + AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_OVERHEAD > AERON_MAX_UDP_PAYLOAD_LENGTH)
+        {
+            aeron_set_err(EMSGSIZE, "datagram too long to seal: %" PRIu64, (uint64_t)length);
+            return -1;
+        }
+
+        if (aeron_udp_channel_interceptor_crypto_ensure_capacity(
+            slot, length + AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_OVERHEAD) < 0)
+        {
+            return -1;
+        }
+
+        const int sealed_length = aeron_udp_channel_interceptor_crypto_seal(
+            state, message->msg_iov, (size_t)message->msg_iovlen, length, slot->buffer);
+        if (sealed_length < 0)
+        {
+            return -1;
+        }
+
+        sealed_iov->iov_base = slot->buffer;
+        sealed_iov->iov_len = (size_t)sealed_length;
+
+        return 0;
+    }
+
+    uint16_t segment_length;
+    memcpy(&segment_length, CMSG_DATA(segment_cmsg), sizeof(segment_length));
+
+    const size_t segment_count = (length + segment_length - 1) / segment_length;
+    const size_t sealed_segment_length = segment_length + AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_OVERHEAD;
+    const size_t sealed_length = length + (segment_count * AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_OVERHEAD);
+
+    if (1 != message->msg_iovlen ||
+        message->msg_controllen > sizeof(slot->control) ||
+        sealed_segment_length > UINT16_MAX ||
+        sealed_length > AERON_MAX_UDP_PAYLOAD_LENGTH)
+    {
+        aeron_set_err(EINVAL, "could not seal GSO message of %" PRIu64 " bytes", (uint64_t)length);
+        return -1;
+    }
+
+    if (aeron_udp_channel_interceptor_crypto_ensure_capacity(slot, sealed_length) < 0)
+    {
+        return -1;
+    }
+
+    const uint8_t *buffer = message->msg_iov[0].iov_base;
+    for (size_t offset = 0, out_offset = 0; offset < length; offset += segment_length)
+    {
+        struct iovec segment_iov;
+        const size_t remaining = length - offset;
+
+        segment_iov.iov_base = (void *)(buffer + offset);
+        segment_iov.iov_len = remaining < segment_length ? remaining : segment_length;
+
+        const int result = aeron_udp_channel_interceptor_crypto_seal(
+            state, &segment_iov, 1, segment_iov.iov_len, slot->buffer + out_offset);
+        if (result < 0)
+        {
+            return -1;
+        }
+
+        out_offset += (size_t)result;
+    }
+
+    /* the caller's control buffer is left as it was, the sealed message carries a copy with the larger segment */
+    memcpy(slot->control, message->msg_control, message->msg_controllen);
+    sealed->msg_control = slot->control;
+    const uint16_t sealed_segment = (uint16_t)sealed_segment_length;
+    memcpy(
+        (uint8_t *)slot->control + ((uint8_t *)CMSG_DATA(segment_cmsg) - (uint8_t *)message->msg_control),
+        &sealed_segment,
+        sizeof(sealed_segment));
+
+    sealed_iov->iov_base = slot->buffer;
+    sealed_iov->iov_len = sealed_length;
+
+    return 0;
+}
+
+int aeron_udp_channel_interceptor_crypto_outgoing_mmsg(
+    void *interceptor_state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen)
+{
+    aeron_udp_channel_interceptor_crypto_outgoing_state_t *state = interceptor_state;
+    struct mmsghdr sealed_msgvec[AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_MAX_MESSAGES];
+    struct iovec iov[AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_MAX_MESSAGES];
+    int sent = 0;
+
+    /* seal the whole vector with the one keyed context then hand it on as a single send */
+    for (size_t offset = 0; offset < vlen; offset += AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_MAX_MESSAGES)
+    {
+        const size_t remaining = vlen - offset;
+        const size_t batch = remaining < AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_MAX_MESSAGES ?
+            remaining : AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_MAX_MESSAGES;
+
+        for (size_t i = 0; i < batch; i++)
+        {
+            sealed_msgvec[i].msg_len = 0;
+            if (aeron_udp_channel_interceptor_crypto_seal_message(
+                state, &state->slots[i], &msgvec[offset + i].msg_hdr, &sealed_msgvec[i].msg_hdr, &iov[i]) < 0)
+            {
+                return 0 == sent ? -1 : sent;
+            }
+        }
+
+        const int result = delegate->outgoing_mmsg_func(
+            delegate->interceptor_state, delegate->next_interceptor, transport, sealed_msgvec, batch);
+
+        if (result < 0)
+        {
+            return 0 == sent ? result : sent;
+        }
+
+        for (int i = 0; i < result; i++)
+        {
+            size_t length = 0;
+            for (size_t j = 0; j < (size_t)msgvec[offset + i].msg_hdr.msg_iovlen; j++)
+            {
+                length += msgvec[offset + i].msg_hdr.msg_iov[j].iov_len;
+            }
+
+            msgvec[offset + i].msg_len = (unsigned int)length;
+        }
+
+        sent += result;
+
+        if ((size_t)result < batch)
+        {
+            break;
+        }
+    }
+
+    return sent;
+}
+
+int aeron_udp_channel_interceptor_crypto_outgoing_msg(
+    void *interceptor_state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *message)
+{
+    aeron_udp_channel_interceptor_crypto_outgoing_state_t *state = interceptor_state;
+    struct msghdr sealed;
+    struct iovec iov;
+
+    if (aeron_udp_channel_interceptor_crypto_seal_message(state, &state->slots[0], message, &sealed, &iov) < 0)
+    {
+        return -1;
+    }
+
+    const int result = delegate->outgoing_msg_func(
+        delegate->interceptor_state, delegate->next_interceptor, transport, &sealed);
+
+    if (result > 0)
+    {
+        size_t length = 0;
+        for (size_t i = 0; i < (size_t)message->msg_iovlen; i++)
+        {
+            length += message->msg_iov[i].iov_len;
+        }
+
+        return (int)length;
+    }
+
+    return result;
+}
+
+static size_t aeron_udp_channel_interceptor_crypto_open(
+    aeron_udp_channel_interceptor_crypto_incoming_state_t *state, const uint8_t *buffer, size_t length)
+{
+    const aeron_udp_channel_interceptor_crypto_header_t *header =
+        (const aeron_udp_channel_interceptor_crypto_header_t *)buffer;
+    EVP_CIPHER_CTX *ctx = state->cipher_ctx;
+
+    if (length <= AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_OVERHEAD ||
+        state->key_id != header->key_id ||
+        (size_t)header->frame_header.frame_length != length)
+    {
+        return 0;
+    }
+
+    const size_t ciphertext_length = length - AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_OVERHEAD;
+    const uint8_t *ciphertext = buffer + sizeof(aeron_udp_channel_interceptor_crypto_header_t);
+    int out_length = 0;
+    int final_length = 0;
+
+    if (aeron_udp_channel_interceptor_crypto_ensure_capacity(&state->slot, ciphertext_length) < 0 ||
+        1 != EVP_DecryptInit_ex(ctx, NULL, NULL, NULL, header->iv) ||
+        1 != EVP_DecryptUpdate(
+            ctx, NULL, &out_length, buffer, (int)sizeof(aeron_udp_channel_interceptor_crypto_header_t)) ||
+        1 != EVP_DecryptUpdate(ctx, state->slot.buffer, &out_length, ciphertext, (int)ciphertext_length) ||
+        1 != EVP_CIPHER_CTX_ctrl(
+            ctx,
+            EVP_CTRL_GCM_SET_TAG,
+            AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_TAG_LENGTH,
+            (void *)(ciphertext + ciphertext_length)) ||
+        1 != EVP_DecryptFinal_ex(ctx, state->slot.buffer + out_length, &final_length))
+    {
+        return 0;
+    }
+
+    return (size_t)(out_length + final_length);
+}
+
+void aeron_udp_channel_interceptor_crypto_incoming(
+    void *interceptor_state,
+    aeron_udp_channel_incoming_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    void *receiver_clientd,
+    void *endpoint_clientd,
+    void *destination_clientd,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr)
+{
+    aeron_udp_channel_interceptor_crypto_incoming_state_t *state = interceptor_state;
+    const aeron_frame_header_t *frame_header = (const aeron_frame_header_t *)buffer;
+
+    if (length >= sizeof(aeron_frame_header_t) && AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_HDR_TYPE == frame_header->type)
+    {
+        const size_t opened_length = aeron_udp_channel_interceptor_crypto_open(state, buffer, length);
+
+        /* a datagram that fails authentication is treated as lost so a forgery cannot reach the endpoint */
+        if (0 == opened_length)
+        {
+            state->rejected_count++;
+            return;
+        }
+
+        buffer = state->slot.buffer;
+        length = opened_length;
+    }
+    else if (!state->allow_plaintext)
+    {
+        state->rejected_count++;
+        return;
+    }
+
+    delegate->incoming_func(
+        delegate->interceptor_state,
+        delegate->next_interceptor,
+        transport,
+        receiver_clientd,
+        endpoint_clientd,
+        destination_clientd,
+        buffer,
+        length,
+        addr);
+}
+
+static int aeron_udp_channel_interceptor_crypto_decode_key(
+    const char *hex, aeron_udp_channel_interceptor_crypto_params_t *params)
+{
+    size_t length = 0;
+
+    for (const char *c = hex; '\0' != *c; c++)
+    {
+        if (isspace((unsigned char)*c))
+        {
+            continue;
+        }
+
+        const int digit = isdigit((unsigned char)*c) ? *c - '0' :
+            isxdigit((unsigned char)*c) ? tolower((unsigned char)*c) - 'a' + 10 : -1;
+
+        if (digit < 0 || length >= 2 * AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_KEY_MAX_LENGTH)
+        {
+            return -1;
+        }
+
+        params->key[length / 2] = (uint8_t)((params->key[length / 2] << 4) | digit);
+        length++;
+    }
+
+    if (32 != length && 64 != length)
+    {
+        return -1;
+    }
+
+    params->key_length = length / 2;
+
+    return 0;
+}
+
+static int aeron_udp_channel_interceptor_crypto_read_key_file(
+    const char *path, aeron_udp_channel_interceptor_crypto_params_t *params)
+{
+    char hex[(4 * AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_KEY_MAX_LENGTH) + 1];
+    FILE *file = fopen(path, "r");
+
+    if (NULL == file)
+    {
+        aeron_set_err_from_last_err_code("could not open crypto key-file: %s", path);
+        return -1;
+    }
+
+    const size_t read = fread(hex, 1, sizeof(hex) - 1, file);
+    fclose(file);
+    hex[read] = '\0';
+
+    const int result = aeron_udp_channel_interceptor_crypto_decode_key(hex, params);
+    OPENSSL_cleanse(hex, sizeof(hex));
+
+    if (result < 0)
+    {
+        aeron_set_err(EINVAL, "crypto key-file must hold a 128 or 256 bit key as hex: %s", path);
+        return -1;
+    }
+
+    return 0;
+}
+
+int aeron_udp_channel_interceptor_crypto_parse_params(char *uri, aeron_udp_channel_interceptor_crypto_params_t *params)
+{
+    return aeron_uri_parse_params(uri, aeron_udp_channel_interceptor_crypto_parse_callback, (void *)params);
+}
+
+int aeron_udp_channel_interceptor_crypto_parse_callback(void *clientd, const char *key, const char *value)
+{
+    aeron_udp_channel_interceptor_crypto_params_t *params = clientd;
+
+    if (strncmp(key, "key-file", sizeof("key-file")) == 0)
+    {
+        return aeron_udp_channel_interceptor_crypto_read_key_file(value, params);
+    }
+    else if (strncmp(key, "key-supplier", sizeof("key-supplier")) == 0)
+    {
+        aeron_udp_channel_interceptor_crypto_key_supplier_func_t supplier;
+
+#if defined(AERON_COMPILER_GCC)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+        supplier = (aeron_udp_channel_interceptor_crypto_key_supplier_func_t)aeron_dlsym(RTLD_DEFAULT, value);
+#if defined(AERON_COMPILER_GCC)
+#pragma GCC diagnostic pop
+#endif
+
+        if (NULL == supplier)
+        {
+            aeron_set_err(EINVAL, "could not find crypto key-supplier %s: dlsym - %s", value, aeron_dlerror());
+            return -1;
+        }
+
+        const int key_length = supplier(params->key, sizeof(params->key));
+        if (16 != key_length && 32 != key_length)
+        {
+            aeron_set_err(EINVAL, "crypto key-supplier %s must supply a 128 or 256 bit key", value);
+            return -1;
+        }
+
+        params->key_length = (size_t)key_length;
+    }
+    else if (strncmp(key, "key-id", sizeof("key-id")) == 0)
+    {
+        errno = 0;
+        char *endptr;
+        const long key_id = strtol(value, &endptr, 10);
+
+        if (errno != 0 || value == endptr || key_id < 0 || key_id > INT32_MAX)
+        {
+            aeron_set_err(EINVAL, "Could not parse crypto %s from: %s", key, value);
+            return -1;
+        }
+
+        params->key_id = (int32_t)key_id;
+    }
+    else if (strncmp(key, "allow-plaintext", sizeof("allow-plaintext")) == 0)
+    {
+        params->allow_plaintext = aeron_parse_bool(value, false);
+    }
+
+    return 0;
+}
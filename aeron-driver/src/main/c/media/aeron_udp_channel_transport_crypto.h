@@ -0,0 +1,134 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_UDP_CHANNEL_TRANSPORT_CRYPTO_H
+#define AERON_UDP_CHANNEL_TRANSPORT_CRYPTO_H
+
+#include "protocol/aeron_udp_protocol.h"
+#include "aeron_udp_channel_transport_bindings.h"
+
+#define AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_HDR_TYPE (0x0D)
+#define AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_IV_LENGTH (12)
+#define AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_TAG_LENGTH (16)
+#define AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_KEY_MAX_LENGTH (32)
+#define AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_MAX_MESSAGES (16)
+#define AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_CONTROL_MAX (64)
+
+#pragma pack(push)
+#pragma pack(4)
+/*
+ * An encrypted datagram is this header, which is also the additional authenticated data, followed by the AES-GCM
+ * ciphertext of the original datagram and the tag.
+ */
+typedef struct aeron_udp_channel_interceptor_crypto_header_stct
+{
+    aeron_frame_header_t frame_header;
+    int32_t key_id;
+    uint8_t iv[AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_IV_LENGTH];
+}
+aeron_udp_channel_interceptor_crypto_header_t;
+#pragma pack(pop)
+
+#define AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_OVERHEAD \
+    (sizeof(aeron_udp_channel_interceptor_crypto_header_t) + AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_TAG_LENGTH)
+
+/*
+ * Supplies the key from a library named in AERON_DRIVER_DYNAMIC_LIBRARIES so it need not sit in a file. Returns the
+ * key length, 16 or 32, or -1 on error.
+ */
+typedef int (*aeron_udp_channel_interceptor_crypto_key_supplier_func_t)(uint8_t *key, size_t key_capacity);
+
+typedef struct aeron_udp_channel_interceptor_crypto_params_stct
+{
+    uint8_t key[AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_KEY_MAX_LENGTH];
+    size_t key_length;
+    int32_t key_id;
+    bool allow_plaintext;
+}
+aeron_udp_channel_interceptor_crypto_params_t;
+
+typedef struct aeron_udp_channel_interceptor_crypto_slot_stct
+{
+    size_t capacity;
+    uint8_t *buffer;
+    uint8_t control[AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_CONTROL_MAX];
+}
+aeron_udp_channel_interceptor_crypto_slot_t;
+
+typedef struct aeron_udp_channel_interceptor_crypto_outgoing_state_stct
+{
+    void *cipher_ctx;
+    int32_t key_id;
+    uint8_t iv_salt[4];
+    uint64_t iv_counter;
+    aeron_udp_channel_interceptor_crypto_slot_t slots[AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_MAX_MESSAGES];
+}
+aeron_udp_channel_interceptor_crypto_outgoing_state_t;
+
+typedef struct aeron_udp_channel_interceptor_crypto_incoming_state_stct
+{
+    void *cipher_ctx;
+    int32_t key_id;
+    bool allow_plaintext;
+    aeron_udp_channel_interceptor_crypto_slot_t slot;
+    int64_t rejected_count;
+}
+aeron_udp_channel_interceptor_crypto_incoming_state_t;
+
+aeron_udp_channel_interceptor_bindings_t *aeron_udp_channel_interceptor_crypto_load(
+    const aeron_udp_channel_interceptor_bindings_t *delegate_bindings);
+
+int aeron_udp_channel_interceptor_crypto_init_outgoing(
+    void **interceptor_state, aeron_driver_context_t *context, aeron_udp_channel_transport_affinity_t affinity);
+
+int aeron_udp_channel_interceptor_crypto_init_incoming(
+    void **interceptor_state, aeron_driver_context_t *context, aeron_udp_channel_transport_affinity_t affinity);
+
+int aeron_udp_channel_interceptor_crypto_close_outgoing(void *interceptor_state);
+
+int aeron_udp_channel_interceptor_crypto_close_incoming(void *interceptor_state);
+
+int aeron_udp_channel_interceptor_crypto_outgoing_mmsg(
+    void *interceptor_state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen);
+
+int aeron_udp_channel_interceptor_crypto_outgoing_msg(
+    void *interceptor_state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *message);
+
+void aeron_udp_channel_interceptor_crypto_incoming(
+    void *interceptor_state,
+    aeron_udp_channel_incoming_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    void *receiver_clientd,
+    void *endpoint_clientd,
+    void *destination_clientd,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr);
+
+int aeron_udp_channel_interceptor_crypto_configure(const aeron_udp_channel_interceptor_crypto_params_t *crypto_params);
+
+int aeron_udp_channel_interceptor_crypto_parse_params(char *uri, aeron_udp_channel_interceptor_crypto_params_t *params);
+
+int aeron_udp_channel_interceptor_crypto_parse_callback(void *clientd, const char *key, const char *value);
+
+#endif //AERON_UDP_CHANNEL_TRANSPORT_CRYPTO_H
@@ -0,0 +1,729 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _BSD_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(AERON_COMPILER_MSVC)
+#include <netinet/udp.h>
+#endif
+
+#include "concurrent/aeron_thread.h"
+#include "util/aeron_error.h"
+#include "aeron_alloc.h"
+#include "aeron_windows.h"
+#include "aeron_udp_channel_transport_fec.h"
+
+#if !defined(HAVE_STRUCT_MMSGHDR)
+struct mmsghdr
+{
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif
+
+#define AERON_CONFIG_GETENV_OR_DEFAULT(e, d) ((NULL == getenv(e)) ? (d) : getenv(e))
+#define AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_FEC_ARGS_ENV_VAR "AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_FEC_ARGS"
+
+static AERON_INIT_ONCE env_is_initialized = AERON_INIT_ONCE_VALUE;
+
+static const aeron_udp_channel_interceptor_fec_params_t *aeron_udp_channel_interceptor_fec_params = NULL;
+
+aeron_udp_channel_interceptor_bindings_t *aeron_udp_channel_interceptor_fec_load(
+    const aeron_udp_channel_interceptor_bindings_t *delegate_bindings)
+{
+    aeron_udp_channel_interceptor_bindings_t *interceptor_bindings;
+    if (aeron_alloc((void **)&interceptor_bindings, sizeof(aeron_udp_channel_interceptor_bindings_t)) < 0)
+    {
+        return NULL;
+    }
+
+    interceptor_bindings->incoming_init_func = aeron_udp_channel_interceptor_fec_init_incoming;
+    interceptor_bindings->outgoing_init_func = aeron_udp_channel_interceptor_fec_init_outgoing;
+    interceptor_bindings->outgoing_mmsg_func = aeron_udp_channel_interceptor_fec_outgoing_mmsg;
+    interceptor_bindings->outgoing_msg_func = aeron_udp_channel_interceptor_fec_outgoing_msg;
+    interceptor_bindings->incoming_func = aeron_udp_channel_interceptor_fec_incoming;
+    interceptor_bindings->outgoing_close_func = aeron_udp_channel_interceptor_fec_close_outgoing;
+    interceptor_bindings->incoming_close_func = aeron_udp_channel_interceptor_fec_close_incoming;
+    interceptor_bindings->outgoing_transport_notification_func = NULL;
+    interceptor_bindings->outgoing_publication_notification_func = NULL;
+    interceptor_bindings->outgoing_image_notification_func = NULL;
+    interceptor_bindings->incoming_transport_notification_func = NULL;
+    interceptor_bindings->incoming_publication_notification_func = NULL;
+    interceptor_bindings->incoming_image_notification_func = NULL;
+    interceptor_bindings->outgoing_do_work_func = NULL;
+    interceptor_bindings->incoming_do_work_func = NULL;
+
+    interceptor_bindings->meta_info.name = "fec";
+    interceptor_bindings->meta_info.type = "interceptor";
+    interceptor_bindings->meta_info.next_interceptor_bindings = delegate_bindings;
+
+    return interceptor_bindings;
+}
+
+int aeron_udp_channel_interceptor_fec_configure(const aeron_udp_channel_interceptor_fec_params_t *fec_params)
+{
+    aeron_udp_channel_interceptor_fec_params = fec_params;
+
+    return 0;
+}
+
+void aeron_udp_channel_transport_fec_load_env()
+{
+    aeron_udp_channel_interceptor_fec_params_t *params;
+    const char *args = AERON_CONFIG_GETENV_OR_DEFAULT(AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_FEC_ARGS_ENV_VAR, "");
+    char *args_dup = strdup(args);
+
+    if (aeron_alloc((void **)&params, sizeof(aeron_udp_channel_interceptor_fec_params_t)) < 0)
+    {
+        aeron_free(args_dup);
+        return;
+    }
+
+    params->block = AERON_UDP_CHANNEL_INTERCEPTOR_FEC_BLOCK_DEFAULT;
+
+    if (aeron_udp_channel_interceptor_fec_parse_params(args_dup, params) >= 0)
+    {
+        aeron_udp_channel_interceptor_fec_configure(params);
+    }
+    else
+    {
+        aeron_free(params);
+    }
+
+    aeron_free(args_dup);
+}
+
+int aeron_udp_channel_interceptor_fec_init_outgoing(
+    void **interceptor_state, aeron_driver_context_t *context, aeron_udp_channel_transport_affinity_t affinity)
+{
+    (void)aeron_thread_once(&env_is_initialized, aeron_udp_channel_transport_fec_load_env);
+
+    if (NULL == aeron_udp_channel_interceptor_fec_params)
+    {
+        return -1;
+    }
+
+    aeron_udp_channel_interceptor_fec_outgoing_state_t *state;
+    if (aeron_alloc((void **)&state, sizeof(aeron_udp_channel_interceptor_fec_outgoing_state_t)) < 0)
+    {
+        aeron_set_err_from_last_err_code("could not allocate fec outgoing state");
+        return -1;
+    }
+
+    state->block = aeron_udp_channel_interceptor_fec_params->block;
+    *interceptor_state = state;
+
+    return 0;
+}
+
+int aeron_udp_channel_interceptor_fec_init_incoming(
+    void **interceptor_state, aeron_driver_context_t *context, aeron_udp_channel_transport_affinity_t affinity)
+{
+    (void)aeron_thread_once(&env_is_initialized, aeron_udp_channel_transport_fec_load_env);
+
+    if (NULL == aeron_udp_channel_interceptor_fec_params)
+    {
+        return -1;
+    }
+
+    aeron_udp_channel_interceptor_fec_incoming_state_t *state;
+    if (aeron_alloc((void **)&state, sizeof(aeron_udp_channel_interceptor_fec_incoming_state_t)) < 0)
+    {
+        aeron_set_err_from_last_err_code("could not allocate fec incoming state");
+        return -1;
+    }
+
+    *interceptor_state = state;
+
+    return 0;
+}
+
+int aeron_udp_channel_interceptor_fec_close_outgoing(void *interceptor_state)
+{
+    aeron_udp_channel_interceptor_fec_outgoing_state_t *state = interceptor_state;
+
+    if (NULL != state)
+    {
+        for (size_t i = 0; i < AERON_UDP_CHANNEL_INTERCEPTOR_FEC_MAX_STREAMS; i++)
+        {
+            aeron_free(state->blocks[i].buffer);
+        }
+
+        aeron_free(state);
+    }
+
+    return 0;
+}
+
+int aeron_udp_channel_interceptor_fec_close_incoming(void *interceptor_state)
+{
+    aeron_udp_channel_interceptor_fec_incoming_state_t *state = interceptor_state;
+
+    if (NULL != state)
+    {
+        for (size_t i = 0; i < AERON_UDP_CHANNEL_INTERCEPTOR_FEC_MAX_STREAMS; i++)
+        {
+            for (size_t j = 0; j < AERON_UDP_CHANNEL_INTERCEPTOR_FEC_RING_LENGTH; j++)
+            {
+                aeron_free(state->rings[i].slots[j].buffer);
+            }
+        }
+
+        aeron_free(state->recovery_buffer);
+        aeron_free(state);
+    }
+
+    return 0;
+}
+
+static int aeron_udp_channel_interceptor_fec_ensure_capacity(uint8_t **buffer, size_t *capacity, size_t length)
+{
+    if (length > *capacity)
+    {
+        if (aeron_reallocf((void **)buffer, length) < 0)
+        {
+            *capacity = 0;
+            return -1;
+        }
+
+        memset(*buffer + *capacity, 0, length - *capacity);
+        *capacity = length;
+    }
+
+    return 0;
+}
+
+static bool aeron_udp_channel_interceptor_fec_is_protected(const uint8_t *buffer, size_t length)
+{
+    const aeron_data_header_t *data_header = (const aeron_data_header_t *)buffer;
+
+    if (length < AERON_DATA_HEADER_LENGTH)
+    {
+        return false;
+    }
+
+    return AERON_HDR_TYPE_DATA == data_header->frame_header.type ||
+        AERON_HDR_TYPE_PAD == data_header->frame_header.type;
+}
+
+static aeron_udp_channel_interceptor_fec_block_t *aeron_udp_channel_interceptor_fec_find_block(
+    aeron_udp_channel_interceptor_fec_outgoing_state_t *state,
+    int32_t session_id,
+    int32_t stream_id,
+    const void *addr,
+    socklen_t addr_len)
+{
+    aeron_udp_channel_interceptor_fec_block_t *unused = NULL;
+
+    for (size_t i = 0; i < AERON_UDP_CHANNEL_INTERCEPTOR_FEC_MAX_STREAMS; i++)
+    {
+        aeron_udp_channel_interceptor_fec_block_t *block = &state->blocks[i];
+
+        if (!block->in_use)
+        {
+            unused = NULL == unused ? block : unused;
+        }
+        else if (session_id == block->session_id &&
+            stream_id == block->stream_id &&
+            addr_len == block->addr_len &&
+            (0 == addr_len || 0 == memcmp(addr, &block->addr, addr_len)))
+        {
+            return block;
+        }
+    }
+
+    aeron_udp_channel_interceptor_fec_block_t *block = unused;
+    if (NULL == block)
+    {
+        block = &state->blocks[state->next_eviction++ % AERON_UDP_CHANNEL_INTERCEPTOR_FEC_MAX_STREAMS];
+        if (NULL != block->buffer)
+        {
+            memset(block->buffer, 0, block->parity_length);
+        }
+    }
+
+    block->in_use = true;
+    block->session_id = session_id;
+    block->stream_id = stream_id;
+    block->addr_len = addr_len <= sizeof(block->addr) ? addr_len : 0;
+    block->member_count = 0;
+    block->length_xor = 0;
+    block->parity_length = 0;
+    if (block->addr_len > 0)
+    {
+        memcpy(&block->addr, addr, block->addr_len);
+    }
+
+    return block;
+}
+
+static void aeron_udp_channel_interceptor_fec_send_parity(
+    aeron_udp_channel_interceptor_fec_block_t *block,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport)
+{
+    uint8_t header_buffer[
+        sizeof(aeron_udp_channel_interceptor_fec_header_t) +
+        (AERON_UDP_CHANNEL_INTERCEPTOR_FEC_BLOCK_MAX * sizeof(aeron_udp_channel_interceptor_fec_member_t))];
+    aeron_udp_channel_interceptor_fec_header_t *header = (aeron_udp_channel_interceptor_fec_header_t *)header_buffer;
+    const size_t members_length = (size_t)block->member_count * sizeof(aeron_udp_channel_interceptor_fec_member_t);
+    const size_t header_length = sizeof(aeron_udp_channel_interceptor_fec_header_t) + members_length;
+    struct iovec iov[2];
+    struct msghdr msghdr;
+
+    header->frame_header.frame_length = (int32_t)(header_length + block->parity_length);
+    header->frame_header.version = AERON_FRAME_HEADER_VERSION;
+    header->frame_header.flags = 0;
+    header->frame_header.type = AERON_UDP_CHANNEL_INTERCEPTOR_FEC_HDR_TYPE;
+    header->session_id = block->session_id;
+    header->stream_id = block->stream_id;
+    header->length_xor = block->length_xor;
+    header->member_count = block->member_count;
+    memcpy(header_buffer + sizeof(aeron_udp_channel_interceptor_fec_header_t), block->members, members_length);
+
+    iov[0].iov_base = header_buffer;
+    iov[0].iov_len = header_length;
+    iov[1].iov_base = block->buffer;
+    iov[1].iov_len = block->parity_length;
+    msghdr.msg_name = block->addr_len > 0 ? &block->addr : NULL;
+    msghdr.msg_namelen = block->addr_len;
+    msghdr.msg_iov = iov;
+    msghdr.msg_iovlen = 2;
+    msghdr.msg_control = NULL;
+    msghdr.msg_controllen = 0;
+    msghdr.msg_flags = 0;
+
+    /* parity is best effort, a failed send leaves recovery of the block to NAKs */
+    delegate->outgoing_msg_func(delegate->interceptor_state, delegate->next_interceptor, transport, &msghdr);
+
+    memset(block->buffer, 0, block->parity_length);
+    block->member_count = 0;
+    block->length_xor = 0;
+    block->parity_length = 0;
+}
+
+static void aeron_udp_channel_interceptor_fec_on_datagram(
+    aeron_udp_channel_interceptor_fec_outgoing_state_t *state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    const uint8_t *buffer,
+    size_t length,
+    const void *addr,
+    socklen_t addr_len)
+{
+    if (!aeron_udp_channel_interceptor_fec_is_protected(buffer, length))
+    {
+        return;
+    }
+
+    const aeron_data_header_t *data_header = (const aeron_data_header_t *)buffer;
+    aeron_udp_channel_interceptor_fec_block_t *block = aeron_udp_channel_interceptor_fec_find_block(
+        state, data_header->session_id, data_header->stream_id, addr, addr_len);
+
+    /* a heartbeat means the stream has gone quiet so the partial block is closed rather than left unprotected */
+    if (0 == data_header->frame_header.frame_length && AERON_DATA_HEADER_LENGTH == length)
+    {
+        if (block->member_count > 0)
+        {
+            aeron_udp_channel_interceptor_fec_send_parity(block, delegate, transport);
+        }
+
+        return;
+    }
+
+    if (aeron_udp_channel_interceptor_fec_ensure_capacity(&block->buffer, &block->capacity, length) < 0)
+    {
+        block->in_use = false;
+        return;
+    }
+
+    for (size_t i = 0; i < length; i++)
+    {
+        block->buffer[i] ^= buffer[i];
+    }
+
+    block->parity_length = length > block->parity_length ? length : block->parity_length;
+    block->length_xor ^= (int32_t)length;
+    block->members[block->member_count].term_id = data_header->term_id;
+    block->members[block->member_count].term_offset = data_header->term_offset;
+    block->member_count++;
+
+    if (block->member_count >= state->block)
+    {
+        aeron_udp_channel_interceptor_fec_send_parity(block, delegate, transport);
+    }
+}
+
+static size_t aeron_udp_channel_interceptor_fec_segment_length(struct msghdr *message)
+{
+#if defined(UDP_SEGMENT)
+    if (NULL != message->msg_control)
+    {
+        for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(message); NULL != cmsg; cmsg = CMSG_NXTHDR(message, cmsg))
+        {
+            if (SOL_UDP == cmsg->cmsg_level && UDP_SEGMENT == cmsg->cmsg_type)
+            {
+                uint16_t gso_size;
+                memcpy(&gso_size, CMSG_DATA(cmsg), sizeof(gso_size));
+                return gso_size;
+            }
+        }
+    }
+#endif
+
+    return 0;
+}
+
+static void aeron_udp_channel_interceptor_fec_on_message(
+    aeron_udp_channel_interceptor_fec_outgoing_state_t *state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *message)
+{
+    if (1 != message->msg_iovlen)
+    {
+        return;
+    }
+
+    const uint8_t *buffer = message->msg_iov[0].iov_base;
+    const size_t length = message->msg_iov[0].iov_len;
+    const size_t segment_length = aeron_udp_channel_interceptor_fec_segment_length(message);
+
+    /* a GSO send reaches the receiver as datagrams of segment_length so each one is a member of the block */
+    if (0 == segment_length)
+    {
+        aeron_udp_channel_interceptor_fec_on_datagram(
+            state, delegate, transport, buffer, length, message->msg_name, message->msg_namelen);
+        return;
+    }
+
+    for (size_t offset = 0; offset < length; offset += segment_length)
+    {
+        const size_t remaining = length - offset;
+
+        aeron_udp_channel_interceptor_fec_on_datagram(
+            state,
+            delegate,
+            transport,
+            buffer + offset,
+            remaining < segment_length ? remaining : segment_length,
+            message->msg_name,
+            message->msg_namelen);
+    }
+}
+
+int aeron_udp_channel_interceptor_fec_outgoing_mmsg(
+    void *interceptor_state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen)
+{
+    const int result = delegate->outgoing_mmsg_func(
+        delegate->interceptor_state, delegate->next_interceptor, transport, msgvec, vlen);
+
+    for (int i = 0; i < result; i++)
+    {
+        aeron_udp_channel_interceptor_fec_on_message(interceptor_state, delegate, transport, &msgvec[i].msg_hdr);
+    }
+
+    return result;
+}
+
+int aeron_udp_channel_interceptor_fec_outgoing_msg(
+    void *interceptor_state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *message)
+{
+    const int result = delegate->outgoing_msg_func(
+        delegate->interceptor_state, delegate->next_interceptor, transport, message);
+
+    if (result >= 0)
+    {
+        aeron_udp_channel_interceptor_fec_on_message(interceptor_state, delegate, transport, message);
+    }
+
+    return result;
+}
+
+static aeron_udp_channel_interceptor_fec_ring_t *aeron_udp_channel_interceptor_fec_find_ring(
+    aeron_udp_channel_interceptor_fec_incoming_state_t *state, int32_t session_id, int32_t stream_id, bool create)
+{
+    aeron_udp_channel_interceptor_fec_ring_t *unused = NULL;
+
+    for (size_t i = 0; i < AERON_UDP_CHANNEL_INTERCEPTOR_FEC_MAX_STREAMS; i++)
+    {
+        aeron_udp_channel_interceptor_fec_ring_t *ring = &state->rings[i];
+
+        if (!ring->in_use)
+        {
+            unused = NULL == unused ? ring : unused;
+        }
+        else if (session_id == ring->session_id && stream_id == ring->stream_id)
+        {
+            return ring;
+        }
+    }
+
+    if (!create)
+    {
+        return NULL;
+    }
+
+    aeron_udp_channel_interceptor_fec_ring_t *ring = unused;
+    if (NULL == ring)
+    {
+        ring = &state->rings[state->next_eviction++ % AERON_UDP_CHANNEL_INTERCEPTOR_FEC_MAX_STREAMS];
+    }
+
+    ring->in_use = true;
+    ring->session_id = session_id;
+    ring->stream_id = stream_id;
+    ring->next_slot = 0;
+    for (size_t i = 0; i < AERON_UDP_CHANNEL_INTERCEPTOR_FEC_RING_LENGTH; i++)
+    {
+        ring->slots[i].is_valid = false;
+    }
+
+    return ring;
+}
+
+static void aeron_udp_channel_interceptor_fec_store(
+    aeron_udp_channel_interceptor_fec_incoming_state_t *state, const uint8_t *buffer, size_t length)
+{
+    const aeron_data_header_t *data_header = (const aeron_data_header_t *)buffer;
+    aeron_udp_channel_interceptor_fec_ring_t *ring = aeron_udp_channel_interceptor_fec_find_ring(
+        state, data_header->session_id, data_header->stream_id, true);
+    aeron_udp_channel_interceptor_fec_slot_t *slot =
+        &ring->slots[ring->next_slot++ % AERON_UDP_CHANNEL_INTERCEPTOR_FEC_RING_LENGTH];
+
+    if (aeron_udp_channel_interceptor_fec_ensure_capacity(&slot->buffer, &slot->capacity, length) < 0)
+    {
+        slot->is_valid = false;
+        return;
+    }
+
+    memcpy(slot->buffer, buffer, length);
+    slot->length = length;
+    slot->member.term_id = data_header->term_id;
+    slot->member.term_offset = data_header->term_offset;
+    slot->is_valid = true;
+}
+
+static aeron_udp_channel_interceptor_fec_slot_t *aeron_udp_channel_interceptor_fec_find_slot(
+    aeron_udp_channel_interceptor_fec_ring_t *ring, const aeron_udp_channel_interceptor_fec_member_t *member)
+{
+    for (size_t i = 0; i < AERON_UDP_CHANNEL_INTERCEPTOR_FEC_RING_LENGTH; i++)
+    {
+        aeron_udp_channel_interceptor_fec_slot_t *slot = &ring->slots[i];
+
+        if (slot->is_valid &&
+            member->term_id == slot->member.term_id &&
+            member->term_offset == slot->member.term_offset)
+        {
+            return slot;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * Rebuild the one datagram of a block that did not arrive, returning its length or 0 when the block is complete,
+ * lost more than one datagram, or has fallen out of the ring.
+ */
+static size_t aeron_udp_channel_interceptor_fec_recover(
+    aeron_udp_channel_interceptor_fec_incoming_state_t *state, const uint8_t *buffer, size_t length)
+{
+    const aeron_udp_channel_interceptor_fec_header_t *header =
+        (const aeron_udp_channel_interceptor_fec_header_t *)buffer;
+
+    if (length < sizeof(aeron_udp_channel_interceptor_fec_header_t) ||
+        header->member_count <= 0 ||
+        header->member_count > AERON_UDP_CHANNEL_INTERCEPTOR_FEC_BLOCK_MAX)
+    {
+        return 0;
+    }
+
+    const aeron_udp_channel_interceptor_fec_member_t *members = (const aeron_udp_channel_interceptor_fec_member_t *)
+        (buffer + sizeof(aeron_udp_channel_interceptor_fec_header_t));
+    const size_t header_length = sizeof(aeron_udp_channel_interceptor_fec_header_t) +
+        ((size_t)header->member_count * sizeof(aeron_udp_channel_interceptor_fec_member_t));
+
+    if (length <= header_length)
+    {
+        return 0;
+    }
+
+    aeron_udp_channel_interceptor_fec_ring_t *ring = aeron_udp_channel_interceptor_fec_find_ring(
+        state, header->session_id, header->stream_id, false);
+    if (NULL == ring)
+    {
+        return 0;
+    }
+
+    aeron_udp_channel_interceptor_fec_slot_t *present[AERON_UDP_CHANNEL_INTERCEPTOR_FEC_BLOCK_MAX];
+    int32_t missing = -1;
+
+    for (int32_t i = 0; i < header->member_count; i++)
+    {
+        if (NULL == (present[i] = aeron_udp_channel_interceptor_fec_find_slot(ring, &members[i])))
+        {
+            if (missing >= 0)
+            {
+                return 0;
+            }
+
+            missing = i;
+        }
+    }
+
+    const size_t parity_length = length - header_length;
+    if (missing < 0 || aeron_udp_channel_interceptor_fec_ensure_capacity(
+        &state->recovery_buffer, &state->recovery_capacity, parity_length) < 0)
+    {
+        return 0;
+    }
+
+    uint8_t *recovered = state->recovery_buffer;
+    size_t recovered_length = (size_t)header->length_xor;
+
+    memcpy(recovered, buffer + header_length, parity_length);
+    for (int32_t i = 0; i < header->member_count; i++)
+    {
+        if (i == missing)
+        {
+            continue;
+        }
+
+        if (present[i]->length > parity_length)
+        {
+            return 0;
+        }
+
+        for (size_t j = 0; j < present[i]->length; j++)
+        {
+            recovered[j] ^= present[i]->buffer[j];
+        }
+
+        recovered_length ^= present[i]->length;
+    }
+
+    const aeron_data_header_t *data_header = (const aeron_data_header_t *)recovered;
+    if (recovered_length < AERON_DATA_HEADER_LENGTH ||
+        recovered_length > parity_length ||
+        data_header->session_id != header->session_id ||
+        data_header->stream_id != header->stream_id ||
+        data_header->term_id != members[missing].term_id ||
+        data_header->term_offset != members[missing].term_offset)
+    {
+        return 0;
+    }
+
+    return recovered_length;
+}
+
+void aeron_udp_channel_interceptor_fec_incoming(
+    void *interceptor_state,
+    aeron_udp_channel_incoming_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    void *receiver_clientd,
+    void *endpoint_clientd,
+    void *destination_clientd,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr)
+{
+    aeron_udp_channel_interceptor_fec_incoming_state_t *state = interceptor_state;
+    const aeron_frame_header_t *frame_header = (const aeron_frame_header_t *)buffer;
+
+    if (length >= sizeof(aeron_frame_header_t) && AERON_UDP_CHANNEL_INTERCEPTOR_FEC_HDR_TYPE == frame_header->type)
+    {
+        const size_t recovered_length = aeron_udp_channel_interceptor_fec_recover(state, buffer, length);
+
+        if (recovered_length > 0)
+        {
+            aeron_udp_channel_interceptor_fec_store(state, state->recovery_buffer, recovered_length);
+            delegate->incoming_func(
+                delegate->interceptor_state,
+                delegate->next_interceptor,
+                transport,
+                receiver_clientd,
+                endpoint_clientd,
+                destination_clientd,
+                state->recovery_buffer,
+                recovered_length,
+                addr);
+        }
+
+        return;
+    }
+
+    if (aeron_udp_channel_interceptor_fec_is_protected(buffer, length) &&
+        0 != ((const aeron_data_header_t *)buffer)->frame_header.frame_length)
+    {
+        aeron_udp_channel_interceptor_fec_store(state, buffer, length);
+    }
+
+    delegate->incoming_func(
+        delegate->interceptor_state,
+        delegate->next_interceptor,
+        transport,
+        receiver_clientd,
+        endpoint_clientd,
+        destination_clientd,
+        buffer,
+        length,
+        addr);
+}
+
+int aeron_udp_channel_interceptor_fec_parse_params(char *uri, aeron_udp_channel_interceptor_fec_params_t *params)
+{
+    return aeron_uri_parse_params(uri, aeron_udp_channel_interceptor_fec_parse_callback, (void *)params);
+}
+
+int aeron_udp_channel_interceptor_fec_parse_callback(void *clientd, const char *key, const char *value)
+{
+    aeron_udp_channel_interceptor_fec_params_t *fec_params = clientd;
+    int result = 0;
+
+    if (strncmp(key, "block", sizeof("block")) == 0)
+    {
+        errno = 0;
+        char *endptr;
+        const long block = strtol(value, &endptr, 10);
+
+        if (errno != 0 || value == endptr || block < 2 || block > AERON_UDP_CHANNEL_INTERCEPTOR_FEC_BLOCK_MAX)
+        {
+            aeron_set_err(EINVAL, "Could not parse fec %s from: %s:", key, value);
+            result = -1;
+        }
+        else
+        {
+            fec_params->block = (int32_t)block;
+        }
+    }
+
+    return result;
+}
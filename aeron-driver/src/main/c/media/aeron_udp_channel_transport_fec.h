@@ -0,0 +1,155 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_UDP_CHANNEL_TRANSPORT_FEC_H
+#define AERON_UDP_CHANNEL_TRANSPORT_FEC_H
+
+#include "protocol/aeron_udp_protocol.h"
+#include "aeron_udp_channel_transport_bindings.h"
+
+#define AERON_UDP_CHANNEL_INTERCEPTOR_FEC_HDR_TYPE (0x0F)
+#define AERON_UDP_CHANNEL_INTERCEPTOR_FEC_BLOCK_DEFAULT (8)
+#define AERON_UDP_CHANNEL_INTERCEPTOR_FEC_BLOCK_MAX (16)
+#define AERON_UDP_CHANNEL_INTERCEPTOR_FEC_MAX_STREAMS (16)
+#define AERON_UDP_CHANNEL_INTERCEPTOR_FEC_RING_LENGTH (2 * AERON_UDP_CHANNEL_INTERCEPTOR_FEC_BLOCK_MAX)
+
+#pragma pack(push)
+#pragma pack(4)
+typedef struct aeron_udp_channel_interceptor_fec_member_stct
+{
+    int32_t term_id;
+    int32_t term_offset;
+}
+aeron_udp_channel_interceptor_fec_member_t;
+
+/*
+ * A parity frame is this header followed by member_count members identifying the datagrams of the block by the first
+ * frame in each, then the XOR of those datagrams each zero padded to the longest.
+ */
+typedef struct aeron_udp_channel_interceptor_fec_header_stct
+{
+    aeron_frame_header_t frame_header;
+    int32_t session_id;
+    int32_t stream_id;
+    int32_t length_xor;
+    int32_t member_count;
+}
+aeron_udp_channel_interceptor_fec_header_t;
+#pragma pack(pop)
+
+typedef struct aeron_udp_channel_interceptor_fec_params_stct
+{
+    int32_t block;
+}
+aeron_udp_channel_interceptor_fec_params_t;
+
+typedef struct aeron_udp_channel_interceptor_fec_block_stct
+{
+    bool in_use;
+    int32_t session_id;
+    int32_t stream_id;
+    struct sockaddr_storage addr;
+    socklen_t addr_len;
+    int32_t member_count;
+    int32_t length_xor;
+    size_t parity_length;
+    size_t capacity;
+    uint8_t *buffer;
+    aeron_udp_channel_interceptor_fec_member_t members[AERON_UDP_CHANNEL_INTERCEPTOR_FEC_BLOCK_MAX];
+}
+aeron_udp_channel_interceptor_fec_block_t;
+
+typedef struct aeron_udp_channel_interceptor_fec_slot_stct
+{
+    bool is_valid;
+    aeron_udp_channel_interceptor_fec_member_t member;
+    size_t length;
+    size_t capacity;
+    uint8_t *buffer;
+}
+aeron_udp_channel_interceptor_fec_slot_t;
+
+typedef struct aeron_udp_channel_interceptor_fec_ring_stct
+{
+    bool in_use;
+    int32_t session_id;
+    int32_t stream_id;
+    size_t next_slot;
+    aeron_udp_channel_interceptor_fec_slot_t slots[AERON_UDP_CHANNEL_INTERCEPTOR_FEC_RING_LENGTH];
+}
+aeron_udp_channel_interceptor_fec_ring_t;
+
+typedef struct aeron_udp_channel_interceptor_fec_outgoing_state_stct
+{
+    int32_t block;
+    size_t next_eviction;
+    aeron_udp_channel_interceptor_fec_block_t blocks[AERON_UDP_CHANNEL_INTERCEPTOR_FEC_MAX_STREAMS];
+}
+aeron_udp_channel_interceptor_fec_outgoing_state_t;
+
+typedef struct aeron_udp_channel_interceptor_fec_incoming_state_stct
+{
+    size_t next_eviction;
+    size_t recovery_capacity;
+    uint8_t *recovery_buffer;
+    aeron_udp_channel_interceptor_fec_ring_t rings[AERON_UDP_CHANNEL_INTERCEPTOR_FEC_MAX_STREAMS];
+}
+aeron_udp_channel_interceptor_fec_incoming_state_t;
+
+aeron_udp_channel_interceptor_bindings_t *aeron_udp_channel_interceptor_fec_load(
+    const aeron_udp_channel_interceptor_bindings_t *delegate_bindings);
+
+int aeron_udp_channel_interceptor_fec_init_outgoing(
+    void **interceptor_state, aeron_driver_context_t *context, aeron_udp_channel_transport_affinity_t affinity);
+
+int aeron_udp_channel_interceptor_fec_init_incoming(
+    void **interceptor_state, aeron_driver_context_t *context, aeron_udp_channel_transport_affinity_t affinity);
+
+int aeron_udp_channel_interceptor_fec_close_outgoing(void *interceptor_state);
+
+int aeron_udp_channel_interceptor_fec_close_incoming(void *interceptor_state);
+
+int aeron_udp_channel_interceptor_fec_outgoing_mmsg(
+    void *interceptor_state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen);
+
+int aeron_udp_channel_interceptor_fec_outgoing_msg(
+    void *interceptor_state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *message);
+
+void aeron_udp_channel_interceptor_fec_incoming(
+    void *interceptor_state,
+    aeron_udp_channel_incoming_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    void *receiver_clientd,
+    void *endpoint_clientd,
+    void *destination_clientd,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr);
+
+int aeron_udp_channel_interceptor_fec_configure(const aeron_udp_channel_interceptor_fec_params_t *fec_params);
+
+int aeron_udp_channel_interceptor_fec_parse_params(char *uri, aeron_udp_channel_interceptor_fec_params_t *params);
+
+int aeron_udp_channel_interceptor_fec_parse_callback(void *clientd, const char *key, const char *value);
+
+#endif //AERON_UDP_CHANNEL_TRANSPORT_FEC_H
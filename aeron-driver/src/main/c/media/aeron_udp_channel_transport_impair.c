@@ -0,0 +1,1171 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _BSD_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <errno.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "concurrent/aeron_thread.h"
+#include "protocol/aeron_udp_protocol.h"
+#include "util/aeron_error.h"
+#include "util/aeron_parse_util.h"
+#include "aeron_alloc.h"
+#include "aeron_windows.h"
+#include "aeron_driver_context.h"
+#include "aeron_udp_channel.h"
+#include "aeron_udp_channel_transport_impair.h"
+
+#if !defined(HAVE_STRUCT_MMSGHDR)
+struct mmsghdr
+{
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif
+
+#define AERON_CONFIG_GETENV_OR_DEFAULT(e, d) ((NULL == getenv(e)) ? (d) : getenv(e))
+#define AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_IMPAIR_ARGS_ENV_VAR "AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_IMPAIR_ARGS"
+#define AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_IMPAIR_OUTGOING_ARGS_ENV_VAR \
+    "AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_IMPAIR_OUTGOING_ARGS"
+#define AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_IMPAIR_INCOMING_ARGS_ENV_VAR \
+    "AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_IMPAIR_INCOMING_ARGS"
+
+#define AERON_UDP_CHANNEL_INTERCEPTOR_IMPAIR_PI (3.14159265358979323846)
+
+typedef enum aeron_udp_channel_interceptor_impair_action_en
+{
+    AERON_UDP_CHANNEL_INTERCEPTOR_IMPAIR_SEND,
+    AERON_UDP_CHANNEL_INTERCEPTOR_IMPAIR_HOLD,
+    AERON_UDP_CHANNEL_INTERCEPTOR_IMPAIR_DROP
+}
+aeron_udp_channel_interceptor_impair_action_t;
+
+typedef struct aeron_udp_channel_interceptor_impair_decision_stct
+{
+    aeron_udp_channel_interceptor_impair_action_t action;
+    int64_t release_ns;
+    bool is_duplicated;
+    int64_t duplicate_release_ns;
+}
+aeron_udp_channel_interceptor_impair_decision_t;
+
+static AERON_INIT_ONCE env_is_initialized = AERON_INIT_ONCE_VALUE;
+
+static const aeron_udp_channel_interceptor_impair_params_t *aeron_udp_channel_interceptor_impair_outgoing_params = NULL;
+static const aeron_udp_channel_interceptor_impair_params_t *aeron_udp_channel_interceptor_impair_incoming_params = NULL;
+
+aeron_udp_channel_interceptor_bindings_t *aeron_udp_channel_interceptor_impair_load(
+    const aeron_udp_channel_interceptor_bindings_t *delegate_bindings)
+{
+    aeron_udp_channel_interceptor_bindings_t *interceptor_bindings;
+    if (aeron_alloc((void **)&interceptor_bindings, sizeof(aeron_udp_channel_interceptor_bindings_t)) < 0)
+    {
+        return NULL;
+    }
+
+    interceptor_bindings->incoming_init_func = aeron_udp_channel_interceptor_impair_init_incoming;
+    interceptor_bindings->outgoing_init_func = aeron_udp_channel_interceptor_impair_init_outgoing;
+    interceptor_bindings->outgoing_mmsg_func = aeron_udp_channel_interceptor_impair_outgoing_mmsg;
+    interceptor_bindings->outgoing_msg_func = aeron_udp_channel_interceptor_impair_outgoing_msg;
+    interceptor_bindings->incoming_func = aeron_udp_channel_interceptor_impair_incoming;
+    interceptor_bindings->outgoing_close_func = aeron_udp_channel_interceptor_impair_close;
+    interceptor_bindings->incoming_close_func = aeron_udp_channel_interceptor_impair_close;
+    interceptor_bindings->outgoing_transport_notification_func =
+        aeron_udp_channel_interceptor_impair_transport_notification;
+    interceptor_bindings->outgoing_publication_notification_func = NULL;
+    interceptor_bindings->outgoing_image_notification_func = NULL;
+    interceptor_bindings->incoming_transport_notification_func =
+        aeron_udp_channel_interceptor_impair_transport_notification;
+    interceptor_bindings->incoming_publication_notification_func = NULL;
+    interceptor_bindings->incoming_image_notification_func = NULL;
+    interceptor_bindings->outgoing_do_work_func = aeron_udp_channel_interceptor_impair_outgoing_do_work;
+    interceptor_bindings->incoming_do_work_func = aeron_udp_channel_interceptor_impair_incoming_do_work;
+
+    interceptor_bindings->meta_info.name = "impair";
+    interceptor_bindings->meta_info.type = "interceptor";
+    interceptor_bindings->meta_info.next_interceptor_bindings = delegate_bindings;
+
+    return interceptor_bindings;
+}
+
+void aeron_udp_channel_interceptor_impair_params_default(aeron_udp_channel_interceptor_impair_params_t *params)
+{
+    memset(params, 0, sizeof(aeron_udp_channel_interceptor_impair_params_t));
+    params->distribution = AERON_UDP_CHANNEL_INTERCEPTOR_IMPAIR_DISTRIBUTION_UNIFORM;
+    params->ge_bad_loss = 1.0;
+    params->limit = AERON_UDP_CHANNEL_INTERCEPTOR_IMPAIR_LIMIT_DEFAULT;
+    params->msg_type_mask = ~0UL;
+}
+
+static const aeron_udp_channel_interceptor_impair_params_t *aeron_udp_channel_transport_impair_load_params(
+    const char *direction_env_var)
+{
+    aeron_udp_channel_interceptor_impair_params_t *params;
+    const char *args = getenv(direction_env_var);
+    if (NULL == args)
+    {
+        args = AERON_CONFIG_GETENV_OR_DEFAULT(AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_IMPAIR_ARGS_ENV_VAR, "");
+    }
+
+    char *args_dup = strdup(args);
+    if (NULL == args_dup)
+    {
+        return NULL;
+    }
+
+    if (aeron_alloc((void **)&params, sizeof(aeron_udp_channel_interceptor_impair_params_t)) < 0)
+    {
+        aeron_free(args_dup);
+        return NULL;
+    }
+
+    aeron_udp_channel_interceptor_impair_params_default(params);
+
+    if (aeron_udp_channel_interceptor_impair_parse_params(args_dup, params) < 0)
+    {
+        aeron_free(params);
+        params = NULL;
+    }
+
+    aeron_free(args_dup);
+
+    return params;
+}
+
+void aeron_udp_channel_transport_impair_load_env()
+{
+    aeron_udp_channel_interceptor_impair_outgoing_params = aeron_udp_channel_transport_impair_load_params(
+        AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_IMPAIR_OUTGOING_ARGS_ENV_VAR);
+    aeron_udp_channel_interceptor_impair_incoming_params = aeron_udp_channel_transport_impair_load_params(
+        AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_IMPAIR_INCOMING_ARGS_ENV_VAR);
+}
+
+int aeron_udp_channel_interceptor_impair_state_create(
+    aeron_udp_channel_interceptor_impair_state_t **state,
+    const aeron_udp_channel_interceptor_impair_params_t *params,
+    aeron_clock_func_t nano_clock)
+{
+    aeron_udp_channel_interceptor_impair_state_t *_state;
+
+    if (aeron_alloc((void **)&_state, sizeof(aeron_udp_channel_interceptor_impair_state_t)) < 0)
+    {
+        aeron_set_err_from_last_err_code("could not allocate impair state");
+        return -1;
+    }
+
+    _state->nano_clock = nano_clock;
+    _state->is_enabled = NULL != params;
+
+    if (_state->is_enabled)
+    {
+        _state->params = *params;
+
+        const size_t limit = 0 == params->limit ?
+            AERON_UDP_CHANNEL_INTERCEPTOR_IMPAIR_LIMIT_DEFAULT : (size_t)params->limit;
+        _state->params.limit = limit;
+
+        if (aeron_alloc((void **)&_state->packets, limit * sizeof(aeron_udp_channel_interceptor_impair_packet_t)) < 0 ||
+            aeron_alloc((void **)&_state->heap, limit * sizeof(aeron_udp_channel_interceptor_impair_packet_t *)) < 0 ||
+            aeron_alloc(
+                (void **)&_state->free_packets, limit * sizeof(aeron_udp_channel_interceptor_impair_packet_t *)) < 0)
+        {
+            aeron_set_err_from_last_err_code("could not allocate impair queue");
+            aeron_udp_channel_interceptor_impair_close(_state);
+            return -1;
+        }
+
+        for (size_t i = 0; i < limit; i++)
+        {
+            _state->free_packets[i] = &_state->packets[limit - 1 - i];
+        }
+        _state->free_length = limit;
+
+        _state->xsubi[2] = (unsigned short)(params->seed & 0xFFFF);
+        _state->xsubi[1] = (unsigned short)((params->seed >> 16) & 0xFFFF);
+        _state->xsubi[0] = (unsigned short)((params->seed >> 32) & 0xFFFF);
+    }
+
+    *state = _state;
+
+    return 0;
+}
+
+static int aeron_udp_channel_interceptor_impair_init(
+    void **interceptor_state,
+    const aeron_udp_channel_interceptor_impair_params_t *params,
+    aeron_driver_context_t *context,
+    aeron_udp_channel_transport_affinity_t affinity)
+{
+    if (NULL == params)
+    {
+        aeron_set_err(EINVAL, "%s", "could not load impair interceptor args");
+        return -1;
+    }
+
+    aeron_udp_channel_interceptor_impair_state_t *state;
+    aeron_clock_func_t nano_clock = NULL != context ? context->nano_clock : aeron_nano_clock;
+
+    /* the name resolver shares the interceptors but has no duty cycle hook, so its traffic passes unimpaired */
+    if (aeron_udp_channel_interceptor_impair_state_create(
+        &state, AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_CONDUCTOR == affinity ? NULL : params, nano_clock) < 0)
+    {
+        return -1;
+    }
+
+    *interceptor_state = state;
+
+    return 0;
+}
+
+int aeron_udp_channel_interceptor_impair_init_outgoing(
+    void **interceptor_state, aeron_driver_context_t *context, aeron_udp_channel_transport_affinity_t affinity)
+{
+    (void)aeron_thread_once(&env_is_initialized, aeron_udp_channel_transport_impair_load_env);
+
+    return aeron_udp_channel_interceptor_impair_init(
+        interceptor_state, aeron_udp_channel_interceptor_impair_outgoing_params, context, affinity);
+}
+
+int aeron_udp_channel_interceptor_impair_init_incoming(
+    void **interceptor_state, aeron_driver_context_t *context, aeron_udp_channel_transport_affinity_t affinity)
+{
+    (void)aeron_thread_once(&env_is_initialized, aeron_udp_channel_transport_impair_load_env);
+
+    return aeron_udp_channel_interceptor_impair_init(
+        interceptor_state, aeron_udp_channel_interceptor_impair_incoming_params, context, affinity);
+}
+
+int aeron_udp_channel_interceptor_impair_close(void *interceptor_state)
+{
+    aeron_udp_channel_interceptor_impair_state_t *state = interceptor_state;
+
+    if (NULL != state)
+    {
+        if (NULL != state->packets)
+        {
+            for (size_t i = 0; i < state->params.limit; i++)
+            {
+                aeron_free(state->packets[i].buffer);
+            }
+        }
+
+        aeron_free(state->packets);
+        aeron_free(state->heap);
+        aeron_free(state->free_packets);
+        aeron_free(state->transports.array);
+        aeron_free(state);
+    }
+
+    return 0;
+}
+
+static inline double aeron_udp_channel_interceptor_impair_rand(aeron_udp_channel_interceptor_impair_state_t *state)
+{
+    return aeron_erand48(state->xsubi);
+}
+
+static inline bool aeron_udp_channel_interceptor_impair_packet_before(
+    const aeron_udp_channel_interceptor_impair_packet_t *lhs, const aeron_udp_channel_interceptor_impair_packet_t *rhs)
+{
+    return lhs->release_ns < rhs->release_ns || (lhs->release_ns == rhs->release_ns && lhs->sequence < rhs->sequence);
+}
+
+static void aeron_udp_channel_interceptor_impair_sift_down(
+    aeron_udp_channel_interceptor_impair_state_t *state, size_t index)
+{
+    aeron_udp_channel_interceptor_impair_packet_t **heap = state->heap;
+    const size_t length = state->heap_length;
+
+    while (true)
+    {
+        const size_t left = (2 * index) + 1;
+        const size_t right = left + 1;
+        size_t smallest = index;
+
+        if (left < length && aeron_udp_channel_interceptor_impair_packet_before(heap[left], heap[smallest]))
+        {
+            smallest = left;
+        }
+
+        if (right < length && aeron_udp_channel_interceptor_impair_packet_before(heap[right], heap[smallest]))
+        {
+            smallest = right;
+        }
+
+        if (smallest == index)
+        {
+            break;
+        }
+
+        aeron_udp_channel_interceptor_impair_packet_t *tmp = heap[index];
+        heap[index] = heap[smallest];
+        heap[smallest] = tmp;
+        index = smallest;
+    }
+}
+
+static void aeron_udp_channel_interceptor_impair_push(
+    aeron_udp_channel_interceptor_impair_state_t *state, aeron_udp_channel_interceptor_impair_packet_t *packet)
+{
+    aeron_udp_channel_interceptor_impair_packet_t **heap = state->heap;
+    size_t index = state->heap_length++;
+
+    heap[index] = packet;
+
+    while (index > 0)
+    {
+        const size_t parent = (index - 1) / 2;
+
+        if (!aeron_udp_channel_interceptor_impair_packet_before(heap[index], heap[parent]))
+        {
+            break;
+        }
+
+        aeron_udp_channel_interceptor_impair_packet_t *tmp = heap[index];
+        heap[index] = heap[parent];
+        heap[parent] = tmp;
+        index = parent;
+    }
+}
+
+static aeron_udp_channel_interceptor_impair_packet_t *aeron_udp_channel_interceptor_impair_pop_due(
+    aeron_udp_channel_interceptor_impair_state_t *state, int64_t now_ns)
+{
+    if (0 == state->heap_length || state->heap[0]->release_ns > now_ns)
+    {
+        return NULL;
+    }
+
+    aeron_udp_channel_interceptor_impair_packet_t *packet = state->heap[0];
+    state->heap[0] = state->heap[--state->heap_length];
+    aeron_udp_channel_interceptor_impair_sift_down(state, 0);
+
+    return packet;
+}
+
+static inline void aeron_udp_channel_interceptor_impair_release_packet(
+    aeron_udp_channel_interceptor_impair_state_t *state, aeron_udp_channel_interceptor_impair_packet_t *packet)
+{
+    state->free_packets[state->free_length++] = packet;
+}
+
+static uint16_t aeron_udp_channel_interceptor_impair_port(const struct sockaddr_storage *addr)
+{
+    if (AF_INET == addr->ss_family)
+    {
+        return ntohs(((const struct sockaddr_in *)addr)->sin_port);
+    }
+    else if (AF_INET6 == addr->ss_family)
+    {
+        return ntohs(((const struct sockaddr_in6 *)addr)->sin6_port);
+    }
+
+    return 0;
+}
+
+static bool aeron_udp_channel_interceptor_impair_is_tracked(
+    aeron_udp_channel_interceptor_impair_state_t *state, aeron_udp_channel_transport_t *transport)
+{
+    for (size_t i = 0; i < state->transports.length; i++)
+    {
+        if (transport == state->transports.array[i])
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static bool aeron_udp_channel_interceptor_impair_applies(
+    aeron_udp_channel_interceptor_impair_state_t *state,
+    aeron_udp_channel_transport_t *transport,
+    const uint8_t *buffer,
+    size_t length)
+{
+    if (length >= sizeof(aeron_frame_header_t))
+    {
+        const aeron_frame_header_t *frame_header = (const aeron_frame_header_t *)buffer;
+        const unsigned long msg_type_bit = 1UL << ((unsigned int)frame_header->type & 0x1Fu);
+
+        if (0 == (msg_type_bit & state->params.msg_type_mask))
+        {
+            return false;
+        }
+    }
+
+    return 0 == state->params.port || aeron_udp_channel_interceptor_impair_is_tracked(state, transport);
+}
+
+static bool aeron_udp_channel_interceptor_impair_should_drop(aeron_udp_channel_interceptor_impair_state_t *state)
+{
+    const aeron_udp_channel_interceptor_impair_params_t *params = &state->params;
+
+    if (params->ge_p > 0.0)
+    {
+        if (state->is_bad)
+        {
+            state->is_bad = !(aeron_udp_channel_interceptor_impair_rand(state) < params->ge_r);
+        }
+        else
+        {
+            state->is_bad = aeron_udp_channel_interceptor_impair_rand(state) < params->ge_p;
+        }
+
+        const double rate = state->is_bad ? params->ge_bad_loss : params->ge_good_loss;
+        if (rate > 0.0 && aeron_udp_channel_interceptor_impair_rand(state) < rate)
+        {
+            return true;
+        }
+    }
+
+    return params->loss > 0.0 && aeron_udp_channel_interceptor_impair_rand(state) < params->loss;
+}
+
+static int64_t aeron_udp_channel_interceptor_impair_delay_ns(aeron_udp_channel_interceptor_impair_state_t *state)
+{
+    const aeron_udp_channel_interceptor_impair_params_t *params = &state->params;
+    int64_t delay_ns = (int64_t)params->delay_ns;
+
+    if (params->jitter_ns > 0)
+    {
+        double offset;
+
+        if (AERON_UDP_CHANNEL_INTERCEPTOR_IMPAIR_DISTRIBUTION_NORMAL == params->distribution)
+        {
+            const double u1 = 1.0 - aeron_udp_channel_interceptor_impair_rand(state);
+            const double u2 = aeron_udp_channel_interceptor_impair_rand(state);
+
+            offset = sqrt(-2.0 * log(u1)) * cos(2.0 * AERON_UDP_CHANNEL_INTERCEPTOR_IMPAIR_PI * u2);
+        }
+        else
+        {
+            offset = (2.0 * aeron_udp_channel_interceptor_impair_rand(state)) - 1.0;
+        }
+
+        delay_ns += (int64_t)(offset * (double)params->jitter_ns);
+    }
+
+    return delay_ns < 0 ? 0 : delay_ns;
+}
+
+/*
+ * Datagrams are delayed first and then serialised onto a link of the configured bandwidth, so the queue builds up
+ * when the offered rate exceeds it and tail drops once the limit is reached, as a bottleneck router would.
+ */
+static int64_t aeron_udp_channel_interceptor_impair_release_ns(
+    aeron_udp_channel_interceptor_impair_state_t *state, int64_t now_ns, size_t length)
+{
+    int64_t release_ns = now_ns + aeron_udp_channel_interceptor_impair_delay_ns(state);
+
+    if (state->params.bandwidth > 0)
+    {
+        const int64_t start_ns = release_ns > state->link_free_ns ? release_ns : state->link_free_ns;
+
+        state->link_free_ns = start_ns + (int64_t)(((double)length * 1e9) / (double)state->params.bandwidth);
+        release_ns = state->link_free_ns;
+    }
+
+    return release_ns;
+}
+
+static void aeron_udp_channel_interceptor_impair_decide(
+    aeron_udp_channel_interceptor_impair_state_t *state,
+    int64_t now_ns,
+    size_t length,
+    aeron_udp_channel_interceptor_impair_decision_t *decision)
+{
+    const aeron_udp_channel_interceptor_impair_params_t *params = &state->params;
+
+    decision->is_duplicated = false;
+
+    if (aeron_udp_channel_interceptor_impair_should_drop(state))
+    {
+        state->dropped_count++;
+        decision->action = AERON_UDP_CHANNEL_INTERCEPTOR_IMPAIR_DROP;
+        return;
+    }
+
+    /* a reordered datagram skips the delay and overtakes those held back, so reordering needs a delay to show */
+    if (params->reorder > 0.0 && aeron_udp_channel_interceptor_impair_rand(state) < params->reorder)
+    {
+        state->reordered_count++;
+        decision->action = AERON_UDP_CHANNEL_INTERCEPTOR_IMPAIR_SEND;
+    }
+    else
+    {
+        decision->release_ns = aeron_udp_channel_interceptor_impair_release_ns(state, now_ns, length);
+        decision->action = decision->release_ns <= now_ns && 0 == state->heap_length ?
+            AERON_UDP_CHANNEL_INTERCEPTOR_IMPAIR_SEND : AERON_UDP_CHANNEL_INTERCEPTOR_IMPAIR_HOLD;
+    }
+
+    if (params->duplicate > 0.0 && aeron_udp_channel_interceptor_impair_rand(state) < params->duplicate)
+    {
+        state->duplicated_count++;
+        decision->is_duplicated = true;
+        decision->duplicate_release_ns = aeron_udp_channel_interceptor_impair_release_ns(state, now_ns, length);
+    }
+}
+
+static aeron_udp_channel_interceptor_impair_packet_t *aeron_udp_channel_interceptor_impair_enqueue(
+    aeron_udp_channel_interceptor_impair_state_t *state,
+    int64_t release_ns,
+    aeron_udp_channel_transport_t *transport,
+    const struct iovec *iov,
+    size_t iovlen,
+    const void *addr,
+    socklen_t addr_len)
+{
+    size_t length = 0;
+    for (size_t i = 0; i < iovlen; i++)
+    {
+        length += iov[i].iov_len;
+    }
+
+    if (0 == state->free_length)
+    {
+        state->overflow_count++;
+        return NULL;
+    }
+
+    aeron_udp_channel_interceptor_impair_packet_t *packet = state->free_packets[state->free_length - 1];
+
+    if (length > packet->capacity)
+    {
+        if (aeron_reallocf((void **)&packet->buffer, length) < 0)
+        {
+            packet->capacity = 0;
+            state->overflow_count++;
+            return NULL;
+        }
+
+        packet->capacity = length;
+    }
+
+    state->free_length--;
+
+    size_t offset = 0;
+    for (size_t i = 0; i < iovlen; i++)
+    {
+        memcpy(packet->buffer + offset, iov[i].iov_base, iov[i].iov_len);
+        offset += iov[i].iov_len;
+    }
+
+    packet->release_ns = release_ns;
+    packet->sequence = state->next_sequence++;
+    packet->transport = transport;
+    packet->receiver_clientd = NULL;
+    packet->endpoint_clientd = NULL;
+    packet->destination_clientd = NULL;
+    packet->length = length;
+    packet->control_length = 0;
+    packet->addr_len = NULL != addr && addr_len <= sizeof(packet->addr) ? addr_len : 0;
+    if (packet->addr_len > 0)
+    {
+        memcpy(&packet->addr, addr, packet->addr_len);
+    }
+
+    aeron_udp_channel_interceptor_impair_push(state, packet);
+    state->delayed_count++;
+
+    return packet;
+}
+
+static void aeron_udp_channel_interceptor_impair_enqueue_message(
+    aeron_udp_channel_interceptor_impair_state_t *state,
+    int64_t release_ns,
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *message)
+{
+    aeron_udp_channel_interceptor_impair_packet_t *packet = aeron_udp_channel_interceptor_impair_enqueue(
+        state, release_ns, transport, message->msg_iov, message->msg_iovlen, message->msg_name, message->msg_namelen);
+
+    if (NULL != packet && NULL != message->msg_control)
+    {
+        memcpy(packet->control, message->msg_control, message->msg_controllen);
+        packet->control_length = message->msg_controllen;
+    }
+}
+
+static int aeron_udp_channel_interceptor_impair_release_outgoing(
+    aeron_udp_channel_interceptor_impair_state_t *state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    int64_t now_ns)
+{
+    aeron_udp_channel_interceptor_impair_packet_t *packet;
+    int work_count = 0;
+
+    while (NULL != (packet = aeron_udp_channel_interceptor_impair_pop_due(state, now_ns)))
+    {
+        struct iovec iov;
+        struct msghdr msghdr;
+
+        iov.iov_base = packet->buffer;
+        iov.iov_len = packet->length;
+        msghdr.msg_name = packet->addr_len > 0 ? &packet->addr : NULL;
+        msghdr.msg_namelen = packet->addr_len;
+        msghdr.msg_iov = &iov;
+        msghdr.msg_iovlen = 1;
+        msghdr.msg_control = packet->control_length > 0 ? packet->control : NULL;
+        msghdr.msg_controllen = packet->control_length;
+        msghdr.msg_flags = 0;
+
+        /* a failed send of a held back datagram is a loss to be recovered by the protocol like any other */
+        delegate->outgoing_msg_func(
+            delegate->interceptor_state, delegate->next_interceptor, packet->transport, &msghdr);
+
+        aeron_udp_channel_interceptor_impair_release_packet(state, packet);
+        work_count++;
+    }
+
+    return work_count;
+}
+
+static int aeron_udp_channel_interceptor_impair_release_incoming(
+    aeron_udp_channel_interceptor_impair_state_t *state,
+    aeron_udp_channel_incoming_interceptor_t *delegate,
+    int64_t now_ns)
+{
+    aeron_udp_channel_interceptor_impair_packet_t *packet;
+    int work_count = 0;
+
+    while (NULL != (packet = aeron_udp_channel_interceptor_impair_pop_due(state, now_ns)))
+    {
+        delegate->incoming_func(
+            delegate->interceptor_state,
+            delegate->next_interceptor,
+            packet->transport,
+            packet->receiver_clientd,
+            packet->endpoint_clientd,
+            packet->destination_clientd,
+            packet->buffer,
+            packet->length,
+            &packet->addr);
+
+        aeron_udp_channel_interceptor_impair_release_packet(state, packet);
+        work_count++;
+    }
+
+    return work_count;
+}
+
+static bool aeron_udp_channel_interceptor_impair_applies_to_message(
+    aeron_udp_channel_interceptor_impair_state_t *state,
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *message)
+{
+    if (message->msg_iovlen < 1 ||
+        (NULL != message->msg_control && message->msg_controllen > AERON_UDP_CHANNEL_INTERCEPTOR_IMPAIR_CONTROL_MAX))
+    {
+        return false;
+    }
+
+    return aeron_udp_channel_interceptor_impair_applies(
+        state, transport, message->msg_iov[0].iov_base, message->msg_iov[0].iov_len);
+}
+
+static size_t aeron_udp_channel_interceptor_impair_message_length(struct msghdr *message)
+{
+    size_t length = 0;
+
+    for (size_t i = 0; i < (size_t)message->msg_iovlen; i++)
+    {
+        length += message->msg_iov[i].iov_len;
+    }
+
+    return length;
+}
+
+int aeron_udp_channel_interceptor_impair_outgoing_mmsg(
+    void *interceptor_state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen)
+{
+    aeron_udp_channel_interceptor_impair_state_t *state = interceptor_state;
+
+    if (!state->is_enabled)
+    {
+        return delegate->outgoing_mmsg_func(
+            delegate->interceptor_state, delegate->next_interceptor, transport, msgvec, vlen);
+    }
+
+    const int64_t now_ns = state->nano_clock();
+    aeron_udp_channel_interceptor_impair_release_outgoing(state, delegate, now_ns);
+
+    size_t run_start = 0;
+    for (size_t i = 0; i < vlen; i++)
+    {
+        struct msghdr *message = &msgvec[i].msg_hdr;
+        aeron_udp_channel_interceptor_impair_decision_t decision;
+
+        if (!aeron_udp_channel_interceptor_impair_applies_to_message(state, transport, message))
+        {
+            continue;
+        }
+
+        const size_t length = aeron_udp_channel_interceptor_impair_message_length(message);
+        aeron_udp_channel_interceptor_impair_decide(state, now_ns, length, &decision);
+
+        if (decision.is_duplicated)
+        {
+            aeron_udp_channel_interceptor_impair_enqueue_message(
+                state, decision.duplicate_release_ns, transport, message);
+        }
+
+        if (AERON_UDP_CHANNEL_INTERCEPTOR_IMPAIR_SEND == decision.action)
+        {
+            continue;
+        }
+
+        /* datagrams sent as they are keep their batching, the run before one held or dropped is flushed first */
+        if (i > run_start)
+        {
+            const size_t run_length = i - run_start;
+            const int result = delegate->outgoing_mmsg_func(
+                delegate->interceptor_state, delegate->next_interceptor, transport, &msgvec[run_start], run_length);
+
+            if (result < (int)run_length)
+            {
+                return result < 0 ? (0 == run_start ? result : (int)run_start) : (int)run_start + result;
+            }
+        }
+
+        if (AERON_UDP_CHANNEL_INTERCEPTOR_IMPAIR_HOLD == decision.action)
+        {
+            aeron_udp_channel_interceptor_impair_enqueue_message(state, decision.release_ns, transport, message);
+        }
+
+        msgvec[i].msg_len = (unsigned int)length;
+        run_start = i + 1;
+    }
+
+    if (vlen > run_start)
+    {
+        const int result = delegate->outgoing_mmsg_func(
+            delegate->interceptor_state, delegate->next_interceptor, transport, &msgvec[run_start], vlen - run_start);
+
+        return result < 0 ? (0 == run_start ? result : (int)run_start) : (int)run_start + result;
+    }
+
+    return (int)vlen;
+}
+
+int aeron_udp_channel_interceptor_impair_outgoing_msg(
+    void *interceptor_state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *message)
+{
+    aeron_udp_channel_interceptor_impair_state_t *state = interceptor_state;
+
+    if (!state->is_enabled)
+    {
+        return delegate->outgoing_msg_func(delegate->interceptor_state, delegate->next_interceptor, transport, message);
+    }
+
+    const int64_t now_ns = state->nano_clock();
+    aeron_udp_channel_interceptor_impair_release_outgoing(state, delegate, now_ns);
+
+    if (!aeron_udp_channel_interceptor_impair_applies_to_message(state, transport, message))
+    {
+        return delegate->outgoing_msg_func(delegate->interceptor_state, delegate->next_interceptor, transport, message);
+    }
+
+    const size_t length = aeron_udp_channel_interceptor_impair_message_length(message);
+    aeron_udp_channel_interceptor_impair_decision_t decision;
+
+    aeron_udp_channel_interceptor_impair_decide(state, now_ns, length, &decision);
+
+    if (decision.is_duplicated)
+    {
+        aeron_udp_channel_interceptor_impair_enqueue_message(state, decision.duplicate_release_ns, transport, message);
+    }
+
+    switch (decision.action)
+    {
+        case AERON_UDP_CHANNEL_INTERCEPTOR_IMPAIR_SEND:
+            return delegate->outgoing_msg_func(
+                delegate->interceptor_state, delegate->next_interceptor, transport, message);
+
+        case AERON_UDP_CHANNEL_INTERCEPTOR_IMPAIR_HOLD:
+            aeron_udp_channel_interceptor_impair_enqueue_message(state, decision.release_ns, transport, message);
+            break;
+
+        default:
+            break;
+    }
+
+    return (int)length;
+}
+
+static void aeron_udp_channel_interceptor_impair_enqueue_incoming(
+    aeron_udp_channel_interceptor_impair_state_t *state,
+    int64_t release_ns,
+    aeron_udp_channel_transport_t *transport,
+    void *receiver_clientd,
+    void *endpoint_clientd,
+    void *destination_clientd,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr)
+{
+    struct iovec iov;
+    iov.iov_base = buffer;
+    iov.iov_len = length;
+
+    aeron_udp_channel_interceptor_impair_packet_t *packet = aeron_udp_channel_interceptor_impair_enqueue(
+        state, release_ns, transport, &iov, 1, addr, NULL != addr ? sizeof(struct sockaddr_storage) : 0);
+
+    if (NULL != packet)
+    {
+        packet->receiver_clientd = receiver_clientd;
+        packet->endpoint_clientd = endpoint_clientd;
+        packet->destination_clientd = destination_clientd;
+    }
+}
+
+void aeron_udp_channel_interceptor_impair_incoming(
+    void *interceptor_state,
+    aeron_udp_channel_incoming_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    void *receiver_clientd,
+    void *endpoint_clientd,
+    void *destination_clientd,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr)
+{
+    aeron_udp_channel_interceptor_impair_state_t *state = interceptor_state;
+    aeron_udp_channel_interceptor_impair_decision_t decision;
+
+    decision.action = AERON_UDP_CHANNEL_INTERCEPTOR_IMPAIR_SEND;
+    decision.is_duplicated = false;
+
+    if (state->is_enabled)
+    {
+        const int64_t now_ns = state->nano_clock();
+        aeron_udp_channel_interceptor_impair_release_incoming(state, delegate, now_ns);
+
+        if (aeron_udp_channel_interceptor_impair_applies(state, transport, buffer, length))
+        {
+            aeron_udp_channel_interceptor_impair_decide(state, now_ns, length, &decision);
+        }
+    }
+
+    if (decision.is_duplicated)
+    {
+        aeron_udp_channel_interceptor_impair_enqueue_incoming(
+            state,
+            decision.duplicate_release_ns,
+            transport,
+            receiver_clientd,
+            endpoint_clientd,
+            destination_clientd,
+            buffer,
+            length,
+            addr);
+    }
+
+    if (AERON_UDP_CHANNEL_INTERCEPTOR_IMPAIR_SEND == decision.action)
+    {
+        delegate->incoming_func(
+            delegate->interceptor_state,
+            delegate->next_interceptor,
+            transport,
+            receiver_clientd,
+            endpoint_clientd,
+            destination_clientd,
+            buffer,
+            length,
+            addr);
+    }
+    else if (AERON_UDP_CHANNEL_INTERCEPTOR_IMPAIR_HOLD == decision.action)
+    {
+        aeron_udp_channel_interceptor_impair_enqueue_incoming(
+            state,
+            decision.release_ns,
+            transport,
+            receiver_clientd,
+            endpoint_clientd,
+            destination_clientd,
+            buffer,
+            length,
+            addr);
+    }
+}
+
+int aeron_udp_channel_interceptor_impair_outgoing_do_work(
+    void *interceptor_state, aeron_udp_channel_outgoing_interceptor_t *delegate)
+{
+    aeron_udp_channel_interceptor_impair_state_t *state = interceptor_state;
+
+    if (0 == state->heap_length)
+    {
+        return 0;
+    }
+
+    return aeron_udp_channel_interceptor_impair_release_outgoing(state, delegate, state->nano_clock());
+}
+
+int aeron_udp_channel_interceptor_impair_incoming_do_work(
+    void *interceptor_state, aeron_udp_channel_incoming_interceptor_t *delegate)
+{
+    aeron_udp_channel_interceptor_impair_state_t *state = interceptor_state;
+
+    if (0 == state->heap_length)
+    {
+        return 0;
+    }
+
+    return aeron_udp_channel_interceptor_impair_release_incoming(state, delegate, state->nano_clock());
+}
+
+static void aeron_udp_channel_interceptor_impair_purge(
+    aeron_udp_channel_interceptor_impair_state_t *state, aeron_udp_channel_transport_t *transport)
+{
+    size_t length = 0;
+
+    for (size_t i = 0; i < state->heap_length; i++)
+    {
+        aeron_udp_channel_interceptor_impair_packet_t *packet = state->heap[i];
+
+        if (transport == packet->transport)
+        {
+            aeron_udp_channel_interceptor_impair_release_packet(state, packet);
+        }
+        else
+        {
+            state->heap[length++] = packet;
+        }
+    }
+
+    state->heap_length = length;
+
+    for (size_t i = length / 2; i > 0; i--)
+    {
+        aeron_udp_channel_interceptor_impair_sift_down(state, i - 1);
+    }
+}
+
+int aeron_udp_channel_interceptor_impair_transport_notification(
+    void *interceptor_state,
+    aeron_udp_channel_transport_t *transport,
+    const aeron_udp_channel_t *udp_channel,
+    aeron_data_packet_dispatcher_t *data_packet_dispatcher,
+    aeron_udp_channel_interceptor_notification_type_t type)
+{
+    aeron_udp_channel_interceptor_impair_state_t *state = interceptor_state;
+
+    if (!state->is_enabled)
+    {
+        return 0;
+    }
+
+    if (AERON_UDP_CHANNEL_INTERCEPTOR_ADD_NOTIFICATION == type)
+    {
+        const uint16_t port = state->params.port;
+
+        if (0 != port && NULL != udp_channel &&
+            (port == aeron_udp_channel_interceptor_impair_port(&udp_channel->remote_data) ||
+            port == aeron_udp_channel_interceptor_impair_port(&udp_channel->local_data)) &&
+            !aeron_udp_channel_interceptor_impair_is_tracked(state, transport))
+        {
+            if (state->transports.length >= state->transports.capacity)
+            {
+                const size_t new_capacity = 0 == state->transports.capacity ? 4 : state->transports.capacity * 2;
+
+                if (aeron_reallocf(
+                    (void **)&state->transports.array, new_capacity * sizeof(aeron_udp_channel_transport_t *)) < 0)
+                {
+                    state->transports.capacity = 0;
+                    state->transports.length = 0;
+                    aeron_set_err_from_last_err_code("could not track impaired transport");
+                    return -1;
+                }
+
+                state->transports.capacity = new_capacity;
+            }
+
+            state->transports.array[state->transports.length++] = transport;
+        }
+    }
+    else
+    {
+        /* held back datagrams must not outlive the transport and endpoint they reference */
+        aeron_udp_channel_interceptor_impair_purge(state, transport);
+
+        for (size_t i = 0; i < state->transports.length; i++)
+        {
+            if (transport == state->transports.array[i])
+            {
+                state->transports.array[i] = state->transports.array[--state->transports.length];
+                break;
+            }
+        }
+    }
+
+    return 0;
+}
+
+int aeron_udp_channel_interceptor_impair_parse_params(char *uri, aeron_udp_channel_interceptor_impair_params_t *params)
+{
+    return aeron_uri_parse_params(uri, aeron_udp_channel_interceptor_impair_parse_callback, (void *)params);
+}
+
+static int aeron_udp_channel_interceptor_impair_parse_rate(const char *key, const char *value, double *rate)
+{
+    errno = 0;
+    char *endptr;
+    const double result = strtod(value, &endptr);
+
+    if (errno != 0 || value == endptr || result < 0.0 || result > 1.0)
+    {
+        aeron_set_err(EINVAL, "Could not parse impair %s from: %s", key, value);
+        return -1;
+    }
+
+    *rate = result;
+
+    return 0;
+}
+
+int aeron_udp_channel_interceptor_impair_parse_callback(void *clientd, const char *key, const char *value)
+{
+    aeron_udp_channel_interceptor_impair_params_t *params = clientd;
+
+    if (strncmp(key, "delay", sizeof("delay")) == 0 || strncmp(key, "jitter", sizeof("jitter")) == 0)
+    {
+        uint64_t *duration_ns = 'd' == key[0] ? &params->delay_ns : &params->jitter_ns;
+
+        if (aeron_parse_duration_ns(value, duration_ns) < 0)
+        {
+            aeron_set_err(EINVAL, "Could not parse impair %s from: %s", key, value);
+            return -1;
+        }
+    }
+    else if (strncmp(key, "distribution", sizeof("distribution")) == 0)
+    {
+        if (strncmp(value, "uniform", sizeof("uniform")) == 0)
+        {
+            params->distribution = AERON_UDP_CHANNEL_INTERCEPTOR_IMPAIR_DISTRIBUTION_UNIFORM;
+        }
+        else if (strncmp(value, "normal", sizeof("normal")) == 0)
+        {
+            params->distribution = AERON_UDP_CHANNEL_INTERCEPTOR_IMPAIR_DISTRIBUTION_NORMAL;
+        }
+        else
+        {
+            aeron_set_err(EINVAL, "Could not parse impair %s from: %s", key, value);
+            return -1;
+        }
+    }
+    else if (strncmp(key, "loss", sizeof("loss")) == 0)
+    {
+        return aeron_udp_channel_interceptor_impair_parse_rate(key, value, &params->loss);
+    }
+    else if (strncmp(key, "ge-p", sizeof("ge-p")) == 0)
+    {
+        return aeron_udp_channel_interceptor_impair_parse_rate(key, value, &params->ge_p);
+    }
+    else if (strncmp(key, "ge-r", sizeof("ge-r")) == 0)
+    {
+        return aeron_udp_channel_interceptor_impair_parse_rate(key, value, &params->ge_r);
+    }
+    else if (strncmp(key, "ge-good-loss", sizeof("ge-good-loss")) == 0)
+    {
+        return aeron_udp_channel_interceptor_impair_parse_rate(key, value, &params->ge_good_loss);
+    }
+    else if (strncmp(key, "ge-bad-loss", sizeof("ge-bad-loss")) == 0)
+    {
+        return aeron_udp_channel_interceptor_impair_parse_rate(key, value, &params->ge_bad_loss);
+    }
+    else if (strncmp(key, "reorder", sizeof("reorder")) == 0)
+    {
+        return aeron_udp_channel_interceptor_impair_parse_rate(key, value, &params->reorder);
+    }
+    else if (strncmp(key, "duplicate", sizeof("duplicate")) == 0)
+    {
+        return aeron_udp_channel_interceptor_impair_parse_rate(key, value, &params->duplicate);
+    }
+    else if (strncmp(key, "bandwidth", sizeof("bandwidth")) == 0)
+    {
+        if (aeron_parse_size64(value, &params->bandwidth) < 0)
+        {
+            aeron_set_err(EINVAL, "Could not parse impair %s from: %s", key, value);
+            return -1;
+        }
+    }
+    else if (strncmp(key, "limit", sizeof("limit")) == 0)
+    {
+        errno = 0;
+        char *endptr;
+        params->limit = strtoull(value, &endptr, 10);
+
+        if (errno != 0 || value == endptr || 0 == params->limit)
+        {
+            aeron_set_err(EINVAL, "Could not parse impair %s from: %s", key, value);
+            return -1;
+        }
+    }
+    else if (strncmp(key, "port", sizeof("port")) == 0)
+    {
+        errno = 0;
+        char *endptr;
+        const unsigned long port = strtoul(value, &endptr, 10);
+
+        if (errno != 0 || value == endptr || port > UINT16_MAX)
+        {
+            aeron_set_err(EINVAL, "Could not parse impair %s from: %s", key, value);
+            return -1;
+        }
+
+        params->port = (uint16_t)port;
+    }
+    else if (strncmp(key, "msg-mask", sizeof("msg-mask")) == 0)
+    {
+        errno = 0;
+        char *endptr;
+        params->msg_type_mask = strtoul(value, &endptr, 16);
+
+        if (errno != 0 || value == endptr)
+        {
+            aeron_set_err(EINVAL, "Could not parse impair %s from: %s", key, value);
+            return -1;
+        }
+    }
+    else if (strncmp(key, "seed", sizeof("seed")) == 0)
+    {
+        errno = 0;
+        char *endptr;
+        params->seed = strtoull(value, &endptr, 10);
+
+        if (errno != 0 || value == endptr)
+        {
+            aeron_set_err(EINVAL, "Could not parse impair %s from: %s", key, value);
+            return -1;
+        }
+    }
+
+    return 0;
+}
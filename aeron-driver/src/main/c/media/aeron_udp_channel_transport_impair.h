@@ -0,0 +1,169 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_UDP_CHANNEL_TRANSPORT_IMPAIR_H
+#define AERON_UDP_CHANNEL_TRANSPORT_IMPAIR_H
+
+#include "aeronc.h"
+#include "aeron_udp_channel_transport_bindings.h"
+
+#define AERON_UDP_CHANNEL_INTERCEPTOR_IMPAIR_LIMIT_DEFAULT (4096)
+#define AERON_UDP_CHANNEL_INTERCEPTOR_IMPAIR_CONTROL_MAX (64)
+
+typedef enum aeron_udp_channel_interceptor_impair_distribution_en
+{
+    AERON_UDP_CHANNEL_INTERCEPTOR_IMPAIR_DISTRIBUTION_UNIFORM,
+    AERON_UDP_CHANNEL_INTERCEPTOR_IMPAIR_DISTRIBUTION_NORMAL
+}
+aeron_udp_channel_interceptor_impair_distribution_t;
+
+/*
+ * Loss is the independent loss rate. Burst loss follows a Gilbert-Elliott model which moves from the good to the bad
+ * state with probability ge_p and back with probability ge_r per datagram, losing ge_good_loss or ge_bad_loss of the
+ * datagrams in each state. Bandwidth is in bytes per second with 0 being unlimited, and port restricts impairment to
+ * channels whose local or remote data port matches, 0 being all channels.
+ */
+typedef struct aeron_udp_channel_interceptor_impair_params_stct
+{
+    uint64_t delay_ns;
+    uint64_t jitter_ns;
+    aeron_udp_channel_interceptor_impair_distribution_t distribution;
+    double loss;
+    double ge_p;
+    double ge_r;
+    double ge_good_loss;
+    double ge_bad_loss;
+    double reorder;
+    double duplicate;
+    uint64_t bandwidth;
+    uint64_t limit;
+    uint16_t port;
+    unsigned long msg_type_mask;
+    unsigned long long seed;
+}
+aeron_udp_channel_interceptor_impair_params_t;
+
+typedef struct aeron_udp_channel_interceptor_impair_packet_stct
+{
+    int64_t release_ns;
+    int64_t sequence;
+    aeron_udp_channel_transport_t *transport;
+    void *receiver_clientd;
+    void *endpoint_clientd;
+    void *destination_clientd;
+    struct sockaddr_storage addr;
+    socklen_t addr_len;
+    size_t length;
+    size_t capacity;
+    uint8_t *buffer;
+    size_t control_length;
+    uint64_t control[AERON_UDP_CHANNEL_INTERCEPTOR_IMPAIR_CONTROL_MAX / sizeof(uint64_t)];
+}
+aeron_udp_channel_interceptor_impair_packet_t;
+
+typedef struct aeron_udp_channel_interceptor_impair_state_stct
+{
+    aeron_udp_channel_interceptor_impair_params_t params;
+    aeron_clock_func_t nano_clock;
+    bool is_enabled;
+    bool is_bad;
+    unsigned short xsubi[3];
+    int64_t link_free_ns;
+    int64_t next_sequence;
+
+    /* datagrams held back ordered by release time in a binary heap over a fixed pool */
+    aeron_udp_channel_interceptor_impair_packet_t *packets;
+    aeron_udp_channel_interceptor_impair_packet_t **heap;
+    aeron_udp_channel_interceptor_impair_packet_t **free_packets;
+    size_t heap_length;
+    size_t free_length;
+
+    struct transports_stct
+    {
+        aeron_udp_channel_transport_t **array;
+        size_t length;
+        size_t capacity;
+    }
+    transports;
+
+    int64_t dropped_count;
+    int64_t overflow_count;
+    int64_t duplicated_count;
+    int64_t reordered_count;
+    int64_t delayed_count;
+}
+aeron_udp_channel_interceptor_impair_state_t;
+
+aeron_udp_channel_interceptor_bindings_t *aeron_udp_channel_interceptor_impair_load(
+    const aeron_udp_channel_interceptor_bindings_t *delegate_bindings);
+
+int aeron_udp_channel_interceptor_impair_state_create(
+    aeron_udp_channel_interceptor_impair_state_t **state,
+    const aeron_udp_channel_interceptor_impair_params_t *params,
+    aeron_clock_func_t nano_clock);
+
+int aeron_udp_channel_interceptor_impair_init_outgoing(
+    void **interceptor_state, aeron_driver_context_t *context, aeron_udp_channel_transport_affinity_t affinity);
+
+int aeron_udp_channel_interceptor_impair_init_incoming(
+    void **interceptor_state, aeron_driver_context_t *context, aeron_udp_channel_transport_affinity_t affinity);
+
+int aeron_udp_channel_interceptor_impair_close(void *interceptor_state);
+
+int aeron_udp_channel_interceptor_impair_outgoing_mmsg(
+    void *interceptor_state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen);
+
+int aeron_udp_channel_interceptor_impair_outgoing_msg(
+    void *interceptor_state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *message);
+
+void aeron_udp_channel_interceptor_impair_incoming(
+    void *interceptor_state,
+    aeron_udp_channel_incoming_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    void *receiver_clientd,
+    void *endpoint_clientd,
+    void *destination_clientd,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr);
+
+int aeron_udp_channel_interceptor_impair_outgoing_do_work(
+    void *interceptor_state, aeron_udp_channel_outgoing_interceptor_t *delegate);
+
+int aeron_udp_channel_interceptor_impair_incoming_do_work(
+    void *interceptor_state, aeron_udp_channel_incoming_interceptor_t *delegate);
+
+int aeron_udp_channel_interceptor_impair_transport_notification(
+    void *interceptor_state,
+    aeron_udp_channel_transport_t *transport,
+    const aeron_udp_channel_t *udp_channel,
+    aeron_data_packet_dispatcher_t *data_packet_dispatcher,
+    aeron_udp_channel_interceptor_notification_type_t type);
+
+void aeron_udp_channel_interceptor_impair_params_default(aeron_udp_channel_interceptor_impair_params_t *params);
+
+int aeron_udp_channel_interceptor_impair_parse_params(char *uri, aeron_udp_channel_interceptor_impair_params_t *params);
+
+int aeron_udp_channel_interceptor_impair_parse_callback(void *clientd, const char *key, const char *value);
+
+#endif //AERON_UDP_CHANNEL_TRANSPORT_IMPAIR_H
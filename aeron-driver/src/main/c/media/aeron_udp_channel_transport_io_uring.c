@@ -0,0 +1,802 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _BSD_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include "aeron_udp_channel_transport_io_uring.h"
+
+#if defined(HAVE_IO_URING)
+
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+
+#include "concurrent/aeron_atomic.h"
+#include "util/aeron_arrayutil.h"
+#include "util/aeron_bitutil.h"
+#include "util/aeron_error.h"
+#include "aeron_alloc.h"
+#include "aeron_driver_context.h"
+#include "aeron_udp_channel_transport.h"
+#include "aeron_udp_transport_poller.h"
+
+#define AERON_UDP_CHANNEL_TRANSPORT_IO_URING_MAX_BUFFER_COUNT (32768)
+#define AERON_UDP_CHANNEL_TRANSPORT_IO_URING_CLOSE_MAX_WAITS (64)
+
+typedef struct aeron_udp_transport_io_uring_entry_stct
+{
+    aeron_udp_channel_transport_t *transport;
+    struct msghdr msghdr;
+    bool is_armed;
+    bool is_removed;
+}
+aeron_udp_transport_io_uring_entry_t;
+
+typedef struct aeron_udp_transport_io_uring_stct
+{
+    int ring_fd;
+
+    void *sq_ring;
+    size_t sq_ring_length;
+    void *cq_ring;
+    size_t cq_ring_length;
+    struct io_uring_sqe *sqes;
+    size_t sqes_length;
+
+    unsigned *sq_head;
+    unsigned *sq_tail;
+    unsigned sq_ring_mask;
+    unsigned sq_ring_entries;
+    unsigned sqe_tail;
+
+    unsigned *cq_head;
+    unsigned *cq_tail;
+    unsigned cq_ring_mask;
+    struct io_uring_cqe *cqes;
+
+    struct io_uring_buf_ring *buf_ring;
+    size_t buf_ring_length;
+    uint8_t *buffers;
+    size_t buffers_length;
+    size_t buffer_length;
+    uint16_t buffer_count;
+    uint16_t buf_ring_tail;
+
+    struct aeron_udp_transport_io_uring_entries_stct
+    {
+        aeron_udp_transport_io_uring_entry_t **array;
+        size_t length;
+        size_t capacity;
+    }
+    entries;
+
+    struct aeron_udp_transport_io_uring_entries_stct retired;
+
+    size_t unarmed_count;
+}
+aeron_udp_transport_io_uring_t;
+
+static void aeron_udp_transport_io_uring_delete(aeron_udp_transport_io_uring_t *ring)
+{
+    if (NULL != ring->buffers)
+    {
+        munmap(ring->buffers, ring->buffers_length);
+    }
+
+    if (NULL != ring->buf_ring)
+    {
+        munmap(ring->buf_ring, ring->buf_ring_length);
+    }
+
+    if (NULL != ring->sqes)
+    {
+        munmap(ring->sqes, ring->sqes_length);
+    }
+
+    if (NULL != ring->cq_ring && ring->cq_ring != ring->sq_ring)
+    {
+        munmap(ring->cq_ring, ring->cq_ring_length);
+    }
+
+    if (NULL != ring->sq_ring)
+    {
+        munmap(ring->sq_ring, ring->sq_ring_length);
+    }
+
+    if (ring->ring_fd >= 0)
+    {
+        close(ring->ring_fd);
+    }
+
+    for (size_t i = 0; i < ring->entries.length; i++)
+    {
+        aeron_free(ring->entries.array[i]);
+    }
+
+    for (size_t i = 0; i < ring->retired.length; i++)
+    {
+        aeron_free(ring->retired.array[i]);
+    }
+
+    aeron_free(ring->entries.array);
+    aeron_free(ring->retired.array);
+    aeron_free(ring);
+}
+
+static int aeron_udp_transport_io_uring_setup(aeron_udp_transport_io_uring_t *ring, unsigned entries)
+{
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+
+    if ((ring->ring_fd = (int)syscall(__NR_io_uring_setup, entries, &params)) < 0)
+    {
+        aeron_set_err_from_last_err_code("io_uring_setup");
+        return -1;
+    }
+
+    ring->sq_ring_length = params.sq_off.array + (params.sq_entries * sizeof(unsigned));
+    ring->cq_ring_length = params.cq_off.cqes + (params.cq_entries * sizeof(struct io_uring_cqe));
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        if (ring->cq_ring_length > ring->sq_ring_length)
+        {
+            ring->sq_ring_length = ring->cq_ring_length;
+        }
+        ring->cq_ring_length = ring->sq_ring_length;
+    }
+
+    void *sq_ring = mmap(
+        NULL, ring->sq_ring_length, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ring_fd, IORING_OFF_SQ_RING);
+    if (MAP_FAILED == sq_ring)
+    {
+        aeron_set_err_from_last_err_code("mmap(IORING_OFF_SQ_RING)");
+        return -1;
+    }
+    ring->sq_ring = sq_ring;
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        ring->cq_ring = ring->sq_ring;
+    }
+    else
+    {
+        void *cq_ring = mmap(
+            NULL,
+            ring->cq_ring_length,
+            PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE,
+            ring->ring_fd,
+            IORING_OFF_CQ_RING);
+        if (MAP_FAILED == cq_ring)
+        {
+            aeron_set_err_from_last_err_code("mmap(IORING_OFF_CQ_RING)");
+            return -1;
+        }
+        ring->cq_ring = cq_ring;
+    }
+
+    ring->sqes_length = params.sq_entries * sizeof(struct io_uring_sqe);
+    void *sqes = mmap(
+        NULL, ring->sqes_length, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ring_fd, IORING_OFF_SQES);
+    if (MAP_FAILED == sqes)
+    {
+        aeron_set_err_from_last_err_code("mmap(IORING_OFF_SQES)");
+        return -1;
+    }
+    ring->sqes = (struct io_uring_sqe *)sqes;
+
+    uint8_t *sq_ptr = (uint8_t *)ring->sq_ring;
+    uint8_t *cq_ptr = (uint8_t *)ring->cq_ring;
+    unsigned *sq_array = (unsigned *)(sq_ptr + params.sq_off.array);
+
+    ring->sq_head = (unsigned *)(sq_ptr + params.sq_off.head);
+    ring->sq_tail = (unsigned *)(sq_ptr + params.sq_off.tail);
+    ring->sq_ring_mask = *(unsigned *)(sq_ptr + params.sq_off.ring_mask);
+    ring->sq_ring_entries = *(unsigned *)(sq_ptr + params.sq_off.ring_entries);
+    ring->sqe_tail = *ring->sq_tail;
+
+    ring->cq_head = (unsigned *)(cq_ptr + params.cq_off.head);
+    ring->cq_tail = (unsigned *)(cq_ptr + params.cq_off.tail);
+    ring->cq_ring_mask = *(unsigned *)(cq_ptr + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *)(cq_ptr + params.cq_off.cqes);
+
+    for (unsigned i = 0; i < ring->sq_ring_entries; i++)
+    {
+        sq_array[i] = i;
+    }
+
+    return 0;
+}
+
+static inline void aeron_udp_transport_io_uring_buf_ring_add(aeron_udp_transport_io_uring_t *ring, uint16_t bid)
+{
+    struct io_uring_buf *buf = &ring->buf_ring->bufs[ring->buf_ring_tail & (ring->buffer_count - 1)];
+
+    buf->addr = (uint64_t)(uintptr_t)(ring->buffers + (bid * ring->buffer_length));
+    buf->len = (uint32_t)ring->buffer_length;
+    buf->bid = bid;
+    ring->buf_ring_tail++;
+}
+
+static inline void aeron_udp_transport_io_uring_buf_ring_publish(aeron_udp_transport_io_uring_t *ring)
+{
+    AERON_PUT_ORDERED(ring->buf_ring->tail, ring->buf_ring_tail);
+}
+
+static int aeron_udp_transport_io_uring_setup_buffers(
+    aeron_udp_transport_io_uring_t *ring, uint16_t buffer_count, size_t max_payload_length)
+{
+    struct io_uring_buf_reg reg;
+    const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+
+    ring->buffer_count = buffer_count;
+    ring->buffer_length = AERON_ALIGN(
+        sizeof(struct io_uring_recvmsg_out) + sizeof(struct sockaddr_storage) +
+        AERON_UDP_CHANNEL_TRANSPORT_CONTROL_LENGTH + max_payload_length,
+        AERON_CACHE_LINE_LENGTH);
+    ring->buffers_length = AERON_ALIGN(ring->buffer_length * buffer_count, page_size);
+    ring->buf_ring_length = AERON_ALIGN(sizeof(struct io_uring_buf) * buffer_count, page_size);
+
+    void *buf_ring = mmap(
+        NULL, ring->buf_ring_length, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+    if (MAP_FAILED == buf_ring)
+    {
+        aeron_set_err_from_last_err_code("mmap(buf_ring)");
+        return -1;
+    }
+    ring->buf_ring = (struct io_uring_buf_ring *)buf_ring;
+
+    void *buffers = mmap(
+        NULL, ring->buffers_length, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE | MAP_POPULATE, -1, 0);
+    if (MAP_FAILED == buffers)
+    {
+        aeron_set_err_from_last_err_code("mmap(buffers)");
+        return -1;
+    }
+    ring->buffers = (uint8_t *)buffers;
+
+    memset(&reg, 0, sizeof(reg));
+    reg.ring_addr = (uint64_t)(uintptr_t)ring->buf_ring;
+    reg.ring_entries = buffer_count;
+    reg.bgid = AERON_UDP_CHANNEL_TRANSPORT_IO_URING_BUFFER_GROUP_ID;
+
+    if (syscall(__NR_io_uring_register, ring->ring_fd, IORING_REGISTER_PBUF_RING, &reg, 1) < 0)
+    {
+        aeron_set_err_from_last_err_code("io_uring_register(IORING_REGISTER_PBUF_RING)");
+        return -1;
+    }
+
+    ring->buf_ring_tail = 0;
+    for (uint16_t i = 0; i < buffer_count; i++)
+    {
+        aeron_udp_transport_io_uring_buf_ring_add(ring, i);
+    }
+    aeron_udp_transport_io_uring_buf_ring_publish(ring);
+
+    return 0;
+}
+
+static int aeron_udp_transport_io_uring_submit(
+    aeron_udp_transport_io_uring_t *ring, unsigned min_complete, unsigned flags)
+{
+    unsigned sq_head;
+
+    AERON_PUT_ORDERED(*ring->sq_tail, ring->sqe_tail);
+    AERON_GET_VOLATILE(sq_head, *ring->sq_head);
+
+    unsigned to_submit = ring->sqe_tail - sq_head;
+    if (0 == to_submit && 0 == min_complete)
+    {
+        return 0;
+    }
+
+    int result = (int)syscall(__NR_io_uring_enter, ring->ring_fd, to_submit, min_complete, flags, NULL, 0);
+    if (result < 0)
+    {
+        if (EINTR == errno || EAGAIN == errno || EBUSY == errno)
+        {
+            return 0;
+        }
+
+        aeron_set_err_from_last_err_code("io_uring_enter");
+        return -1;
+    }
+
+    return result;
+}
+
+static struct io_uring_sqe *aeron_udp_transport_io_uring_get_sqe(aeron_udp_transport_io_uring_t *ring)
+{
+    unsigned sq_head;
+
+    AERON_GET_VOLATILE(sq_head, *ring->sq_head);
+    if (ring->sqe_tail - sq_head >= ring->sq_ring_entries)
+    {
+        if (aeron_udp_transport_io_uring_submit(ring, 0, 0) < 0)
+        {
+            return NULL;
+        }
+
+        AERON_GET_VOLATILE(sq_head, *ring->sq_head);
+        if (ring->sqe_tail - sq_head >= ring->sq_ring_entries)
+        {
+            aeron_set_err(EBUSY, "%s", "io_uring submission queue is full");
+            return NULL;
+        }
+    }
+
+    struct io_uring_sqe *sqe = &ring->sqes[ring->sqe_tail & ring->sq_ring_mask];
+    memset(sqe, 0, sizeof(struct io_uring_sqe));
+    ring->sqe_tail++;
+
+    return sqe;
+}
+
+static int aeron_udp_transport_io_uring_arm(
+    aeron_udp_transport_io_uring_t *ring, aeron_udp_transport_io_uring_entry_t *entry)
+{
+    struct io_uring_sqe *sqe = aeron_udp_transport_io_uring_get_sqe(ring);
+    if (NULL == sqe)
+    {
+        return -1;
+    }
+
+    sqe->opcode = IORING_OP_RECVMSG;
+    sqe->fd = entry->transport->fd;
+    sqe->addr = (uint64_t)(uintptr_t)&entry->msghdr;
+    sqe->len = 1;
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = AERON_UDP_CHANNEL_TRANSPORT_IO_URING_BUFFER_GROUP_ID;
+    sqe->user_data = (uint64_t)(uintptr_t)entry;
+
+    entry->is_armed = true;
+
+    return 0;
+}
+
+static int aeron_udp_transport_io_uring_cancel(
+    aeron_udp_transport_io_uring_t *ring, aeron_udp_transport_io_uring_entry_t *entry)
+{
+    struct io_uring_sqe *sqe = aeron_udp_transport_io_uring_get_sqe(ring);
+    if (NULL == sqe)
+    {
+        return -1;
+    }
+
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = -1;
+    sqe->addr = (uint64_t)(uintptr_t)entry;
+    sqe->user_data = 0;
+
+    return 0;
+}
+
+/*
+ * Armed entries are referenced by the kernel until their final CQE, so they move to the retired list rather than being
+ * freed. Capacity is reserved when the entry is added, so retiring never fails.
+ */
+static void aeron_udp_transport_io_uring_retire(
+    aeron_udp_transport_io_uring_t *ring, aeron_udp_transport_io_uring_entry_t *entry)
+{
+    entry->is_removed = true;
+    ring->retired.array[ring->retired.length++] = entry;
+}
+
+static void aeron_udp_transport_io_uring_release(
+    aeron_udp_transport_io_uring_t *ring, aeron_udp_transport_io_uring_entry_t *entry)
+{
+    int last_index = (int)ring->retired.length - 1;
+
+    for (int i = last_index; i >= 0; i--)
+    {
+        if (ring->retired.array[i] == entry)
+        {
+            aeron_array_fast_unordered_remove(
+                (uint8_t *)ring->retired.array,
+                sizeof(aeron_udp_transport_io_uring_entry_t *),
+                (size_t)i,
+                (size_t)last_index);
+            ring->retired.length--;
+            aeron_free(entry);
+            break;
+        }
+    }
+}
+
+static int aeron_udp_transport_io_uring_reap(
+    aeron_udp_transport_io_uring_t *ring,
+    int64_t *bytes_rcved,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd)
+{
+    int work_count = 0;
+    int result = 0;
+    unsigned cq_head = *ring->cq_head;
+    unsigned cq_tail;
+
+    AERON_GET_VOLATILE(cq_tail, *ring->cq_tail);
+
+    for (; cq_head != cq_tail; cq_head++)
+    {
+        struct io_uring_cqe *cqe = &ring->cqes[cq_head & ring->cq_ring_mask];
+        aeron_udp_transport_io_uring_entry_t *entry = (aeron_udp_transport_io_uring_entry_t *)(uintptr_t)cqe->user_data;
+
+        if (NULL == entry)
+        {
+            continue;
+        }
+
+        if (cqe->flags & IORING_CQE_F_BUFFER)
+        {
+            uint16_t bid = (uint16_t)(cqe->flags >> IORING_CQE_BUFFER_SHIFT);
+
+            if (cqe->res > 0 && !entry->is_removed)
+            {
+                uint8_t *buffer = ring->buffers + (bid * ring->buffer_length);
+                struct io_uring_recvmsg_out *out = (struct io_uring_recvmsg_out *)buffer;
+
+                if (0 == (out->flags & MSG_TRUNC))
+                {
+                    struct sockaddr_storage *addr =
+                        (struct sockaddr_storage *)(buffer + sizeof(struct io_uring_recvmsg_out));
+                    uint8_t *control = (uint8_t *)addr + entry->msghdr.msg_namelen;
+                    uint8_t *payload = control + entry->msghdr.msg_controllen;
+                    struct msghdr msghdr;
+
+                    memset(&msghdr, 0, sizeof(msghdr));
+                    msghdr.msg_control = control;
+                    msghdr.msg_controllen = out->controllen;
+
+                    work_count += aeron_udp_channel_transport_dispatch(
+                        entry->transport,
+                        &msghdr,
+                        payload,
+                        (size_t)out->payloadlen,
+                        addr,
+                        bytes_rcved,
+                        recv_func,
+                        clientd);
+                }
+            }
+
+            aeron_udp_transport_io_uring_buf_ring_add(ring, bid);
+        }
+
+        if (0 == (cqe->flags & IORING_CQE_F_MORE))
+        {
+            entry->is_armed = false;
+
+            if (entry->is_removed)
+            {
+                aeron_udp_transport_io_uring_release(ring, entry);
+            }
+            else
+            {
+                ring->unarmed_count++;
+
+                if (cqe->res < 0 && -ENOBUFS != cqe->res && -ECANCELED != cqe->res && 0 == result)
+                {
+                    aeron_set_err(-cqe->res, "io_uring recvmsg: %s", strerror(-cqe->res));
+                    result = -1;
+                }
+            }
+        }
+    }
+
+    AERON_PUT_ORDERED(*ring->cq_head, cq_head);
+    aeron_udp_transport_io_uring_buf_ring_publish(ring);
+
+    return result < 0 ? result : work_count;
+}
+
+static size_t aeron_udp_transport_io_uring_max_payload_length(
+    aeron_driver_context_t *context, aeron_udp_channel_transport_affinity_t affinity)
+{
+    return AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_RECEIVER == affinity ?
+        AERON_DRIVER_RECEIVER_MAX_UDP_PACKET_LENGTH : context->mtu_length;
+}
+
+int aeron_udp_transport_poller_io_uring_init(
+    aeron_udp_transport_poller_t *poller,
+    aeron_driver_context_t *context,
+    aeron_udp_channel_transport_affinity_t affinity)
+{
+    aeron_udp_transport_io_uring_t *ring = NULL;
+    uint64_t buffer_count = AERON_UDP_CHANNEL_TRANSPORT_IO_URING_BUFFER_COUNT_DEFAULT;
+    const char *buffer_count_str = getenv(AERON_UDP_CHANNEL_TRANSPORT_IO_URING_BUFFER_COUNT_ENV_VAR);
+
+    if (NULL != buffer_count_str)
+    {
+        char *end_ptr = NULL;
+
+        errno = 0;
+        buffer_count = strtoull(buffer_count_str, &end_ptr, 10);
+        if (0 != errno || '\0' != *end_ptr || end_ptr == buffer_count_str ||
+            buffer_count > AERON_UDP_CHANNEL_TRANSPORT_IO_URING_MAX_BUFFER_COUNT ||
+            !AERON_IS_POWER_OF_TWO(buffer_count))
+        {
+            aeron_set_err(
+                EINVAL,
+                "%s must be a power of 2 no greater than %d: %s",
+                AERON_UDP_CHANNEL_TRANSPORT_IO_URING_BUFFER_COUNT_ENV_VAR,
+                AERON_UDP_CHANNEL_TRANSPORT_IO_URING_MAX_BUFFER_COUNT,
+                buffer_count_str);
+            return -1;
+        }
+    }
+
+    if (aeron_udp_transport_poller_init(poller, context, affinity) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_alloc((void **)&ring, sizeof(aeron_udp_transport_io_uring_t)) < 0)
+    {
+        aeron_udp_transport_poller_close(poller);
+        return -1;
+    }
+
+    ring->ring_fd = -1;
+    ring->entries.array = NULL;
+    ring->entries.length = 0;
+    ring->entries.capacity = 0;
+    ring->retired.array = NULL;
+    ring->retired.length = 0;
+    ring->retired.capacity = 0;
+    ring->unarmed_count = 0;
+
+    if (aeron_udp_transport_io_uring_setup(ring, AERON_UDP_CHANNEL_TRANSPORT_IO_URING_RING_ENTRIES) < 0 ||
+        aeron_udp_transport_io_uring_setup_buffers(
+            ring, (uint16_t)buffer_count, aeron_udp_transport_io_uring_max_payload_length(context, affinity)) < 0)
+    {
+        aeron_udp_transport_io_uring_delete(ring);
+        aeron_udp_transport_poller_close(poller);
+        return -1;
+    }
+
+    poller->bindings_clientd = ring;
+
+    return 0;
+}
+
+int aeron_udp_transport_poller_io_uring_close(aeron_udp_transport_poller_t *poller)
+{
+    aeron_udp_transport_io_uring_t *ring = (aeron_udp_transport_io_uring_t *)poller->bindings_clientd;
+
+    if (NULL != ring)
+    {
+        int64_t bytes_rcved = 0;
+
+        /* Nothing is dispatched once closing, and a final CQE reaped below leaves the entry here to be freed. */
+        for (size_t i = 0; i < ring->entries.length; i++)
+        {
+            ring->entries.array[i]->is_removed = true;
+        }
+
+        for (size_t i = 0; i < ring->entries.length; i++)
+        {
+            aeron_udp_transport_io_uring_entry_t *entry = ring->entries.array[i];
+
+            if (entry->is_armed && aeron_udp_transport_io_uring_cancel(ring, entry) < 0)
+            {
+                aeron_udp_transport_io_uring_submit(ring, 0, 0);
+                aeron_udp_transport_io_uring_reap(ring, &bytes_rcved, NULL, NULL);
+
+                if (entry->is_armed)
+                {
+                    aeron_udp_transport_io_uring_cancel(ring, entry);
+                }
+            }
+
+            if (entry->is_armed)
+            {
+                aeron_udp_transport_io_uring_retire(ring, entry);
+            }
+            else
+            {
+                aeron_free(entry);
+            }
+        }
+        ring->entries.length = 0;
+
+        for (int i = 0; ring->retired.length > 0 && i < AERON_UDP_CHANNEL_TRANSPORT_IO_URING_CLOSE_MAX_WAITS; i++)
+        {
+            if (aeron_udp_transport_io_uring_submit(ring, 1, IORING_ENTER_GETEVENTS) < 0)
+            {
+                break;
+            }
+
+            aeron_udp_transport_io_uring_reap(ring, &bytes_rcved, NULL, NULL);
+        }
+
+        aeron_udp_transport_io_uring_delete(ring);
+        poller->bindings_clientd = NULL;
+    }
+
+    return aeron_udp_transport_poller_close(poller);
+}
+
+int aeron_udp_transport_poller_io_uring_add(
+    aeron_udp_transport_poller_t *poller, aeron_udp_channel_transport_t *transport)
+{
+    aeron_udp_transport_io_uring_t *ring = (aeron_udp_transport_io_uring_t *)poller->bindings_clientd;
+    aeron_udp_transport_io_uring_entry_t *entry = NULL;
+    int ensure_capacity_result = 0;
+
+    AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, ring->entries, aeron_udp_transport_io_uring_entry_t *);
+    if (ensure_capacity_result < 0)
+    {
+        return -1;
+    }
+
+    const size_t retired_capacity = ring->retired.length + ring->entries.length + 1;
+    if (ring->retired.capacity < retired_capacity)
+    {
+        if (aeron_array_ensure_capacity(
+            (uint8_t **)&ring->retired.array,
+            sizeof(aeron_udp_transport_io_uring_entry_t *),
+            ring->retired.capacity,
+            retired_capacity) < 0)
+        {
+            return -1;
+        }
+
+        ring->retired.capacity = retired_capacity;
+    }
+
+    if (aeron_alloc((void **)&entry, sizeof(aeron_udp_transport_io_uring_entry_t)) < 0)
+    {
+        return -1;
+    }
+
+    entry->transport = transport;
+    entry->msghdr.msg_name = NULL;
+    entry->msghdr.msg_namelen = sizeof(struct sockaddr_storage);
+    entry->msghdr.msg_iov = NULL;
+    entry->msghdr.msg_iovlen = 0;
+    entry->msghdr.msg_control = NULL;
+    entry->msghdr.msg_controllen = AERON_UDP_CHANNEL_TRANSPORT_CONTROL_LENGTH;
+    entry->msghdr.msg_flags = 0;
+    entry->is_armed = false;
+    entry->is_removed = false;
+
+    if (aeron_udp_transport_io_uring_arm(ring, entry) < 0 || aeron_udp_transport_io_uring_submit(ring, 0, 0) < 0)
+    {
+        aeron_free(entry);
+        return -1;
+    }
+
+    ring->entries.array[ring->entries.length++] = entry;
+
+    return aeron_udp_transport_poller_add(poller, transport);
+}
+
+int aeron_udp_transport_poller_io_uring_remove(
+    aeron_udp_transport_poller_t *poller, aeron_udp_channel_transport_t *transport)
+{
+    aeron_udp_transport_io_uring_t *ring = (aeron_udp_transport_io_uring_t *)poller->bindings_clientd;
+    int index = -1, last_index = (int)ring->entries.length - 1;
+
+    for (int i = last_index; i >= 0; i--)
+    {
+        if (ring->entries.array[i]->transport == transport)
+        {
+            index = i;
+            break;
+        }
+    }
+
+    if (index >= 0)
+    {
+        aeron_udp_transport_io_uring_entry_t *entry = ring->entries.array[index];
+
+        aeron_array_fast_unordered_remove(
+            (uint8_t *)ring->entries.array,
+            sizeof(aeron_udp_transport_io_uring_entry_t *),
+            (size_t)index,
+            (size_t)last_index);
+        ring->entries.length--;
+
+        if (entry->is_armed)
+        {
+            aeron_udp_transport_io_uring_retire(ring, entry);
+
+            if (aeron_udp_transport_io_uring_cancel(ring, entry) < 0 ||
+                aeron_udp_transport_io_uring_submit(ring, 0, 0) < 0)
+            {
+                return -1;
+            }
+        }
+        else
+        {
+            ring->unarmed_count--;
+            aeron_free(entry);
+        }
+    }
+
+    return aeron_udp_transport_poller_remove(poller, transport);
+}
+
+int aeron_udp_transport_poller_io_uring_poll(
+    aeron_udp_transport_poller_t *poller,
+    struct mmsghdr *msgvec,
+    size_t vlen,
+    int64_t *bytes_rcved,
+    aeron_udp_transport_recv_func_t recv_func,
+    aeron_udp_channel_transport_recvmmsg_func_t recvmmsg_func,
+    void *clientd)
+{
+    aeron_udp_transport_io_uring_t *ring = (aeron_udp_transport_io_uring_t *)poller->bindings_clientd;
+
+    int work_count = aeron_udp_transport_io_uring_reap(ring, bytes_rcved, recv_func, clientd);
+
+    if (ring->unarmed_count > 0)
+    {
+        for (size_t i = 0, length = ring->entries.length; i < length; i++)
+        {
+            aeron_udp_transport_io_uring_entry_t *entry = ring->entries.array[i];
+
+            if (!entry->is_armed)
+            {
+                if (aeron_udp_transport_io_uring_arm(ring, entry) < 0)
+                {
+                    return -1;
+                }
+                ring->unarmed_count--;
+            }
+        }
+    }
+
+    if (ring->sqe_tail != *ring->sq_tail && aeron_udp_transport_io_uring_submit(ring, 0, 0) < 0)
+    {
+        return -1;
+    }
+
+    return work_count;
+}
+
+aeron_udp_channel_transport_bindings_t aeron_udp_channel_transport_bindings_io_uring =
+    {
+        aeron_udp_channel_transport_init,
+        aeron_udp_channel_transport_close,
+        aeron_udp_channel_transport_recvmmsg,
+        aeron_udp_channel_transport_sendmmsg,
+        aeron_udp_channel_transport_sendmsg,
+        aeron_udp_channel_transport_get_so_rcvbuf,
+        aeron_udp_channel_transport_bind_addr_and_port,
+        aeron_udp_transport_poller_io_uring_init,
+        aeron_udp_transport_poller_io_uring_close,
+        aeron_udp_transport_poller_io_uring_add,
+        aeron_udp_transport_poller_io_uring_remove,
+        aeron_udp_transport_poller_io_uring_poll,
+        {
+            "io_uring",
+            "media",
+            NULL,
+            NULL
+        }
+    };
+
+#endif
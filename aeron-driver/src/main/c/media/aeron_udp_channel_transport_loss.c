@@ -71,6 +71,8 @@ aeron_udp_channel_interceptor_bindings_t *aeron_udp_channel_interceptor_loss_loa
     interceptor_bindings->incoming_transport_notification_func = NULL;
     interceptor_bindings->incoming_publication_notification_func = NULL;
     interceptor_bindings->incoming_image_notification_func = NULL;
+    interceptor_bindings->outgoing_do_work_func = NULL;
+    interceptor_bindings->incoming_do_work_func = NULL;
 
     interceptor_bindings->meta_info.name = "loss";
     interceptor_bindings->meta_info.type = "interceptor";
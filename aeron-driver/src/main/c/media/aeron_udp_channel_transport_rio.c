@@ -0,0 +1,585 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "aeron_udp_channel_transport_rio.h"
+
+#if defined(HAVE_WINSOCK_RIO)
+
+#include <errno.h>
+#include <inttypes.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "aeron_socket.h"
+#include <mswsock.h>
+
+#include "util/aeron_error.h"
+#include "aeron_alloc.h"
+#include "aeron_driver_context.h"
+#include "aeron_udp_channel_transport.h"
+#include "aeron_udp_transport_poller.h"
+
+#define AERON_UDP_CHANNEL_TRANSPORT_RIO_MAX_SLOT_COUNT (16384)
+#define AERON_UDP_CHANNEL_TRANSPORT_RIO_ADDR_SLOT_LENGTH (sizeof(struct sockaddr_storage))
+
+/*
+ * Each transport owns its request queue, so it can be created on the socket at init, and a completion queue per
+ * direction. The registered buffer holds the receive slots, then the send slots, then the address of each slot.
+ */
+typedef struct aeron_udp_channel_transport_rio_stct
+{
+    RIO_RQ request_queue;
+    RIO_CQ receive_cq;
+    RIO_CQ send_cq;
+    RIO_BUFFERID buffer_id;
+    uint8_t *buffer;
+    size_t receive_slot_length;
+    size_t send_slot_length;
+    size_t send_slots_offset;
+    size_t addr_slots_offset;
+    uint32_t slot_count;
+    uint32_t free_send_slot_count;
+    uint32_t *free_send_slots;
+    RIORESULT *results;
+}
+aeron_udp_channel_transport_rio_t;
+
+static RIO_EXTENSION_FUNCTION_TABLE aeron_udp_channel_transport_rio_functions;
+static bool aeron_udp_channel_transport_rio_functions_loaded = false;
+
+static int aeron_udp_channel_transport_rio_load_functions(aeron_socket_t fd)
+{
+    if (!aeron_udp_channel_transport_rio_functions_loaded)
+    {
+        GUID function_table_id = WSAID_MULTIPLE_RIO;
+        DWORD bytes = 0;
+
+        if (0 != WSAIoctl(
+            (SOCKET)fd,
+            SIO_GET_MULTIPLE_EXTENSION_FUNCTION_POINTER,
+            &function_table_id,
+            sizeof(function_table_id),
+            &aeron_udp_channel_transport_rio_functions,
+            sizeof(aeron_udp_channel_transport_rio_functions),
+            &bytes,
+            NULL,
+            NULL))
+        {
+            aeron_set_err_from_last_err_code("WSAIoctl(SIO_GET_MULTIPLE_EXTENSION_FUNCTION_POINTER)");
+            return -1;
+        }
+
+        aeron_udp_channel_transport_rio_functions_loaded = true;
+    }
+
+    return 0;
+}
+
+static inline uint8_t *aeron_udp_channel_transport_rio_addr(aeron_udp_channel_transport_rio_t *rio, uint32_t slot)
+{
+    return rio->buffer + rio->addr_slots_offset + (slot * AERON_UDP_CHANNEL_TRANSPORT_RIO_ADDR_SLOT_LENGTH);
+}
+
+static void aeron_udp_channel_transport_rio_delete(aeron_udp_channel_transport_rio_t *rio)
+{
+    if (RIO_INVALID_CQ != rio->receive_cq)
+    {
+        aeron_udp_channel_transport_rio_functions.RIOCloseCompletionQueue(rio->receive_cq);
+    }
+
+    if (RIO_INVALID_CQ != rio->send_cq)
+    {
+        aeron_udp_channel_transport_rio_functions.RIOCloseCompletionQueue(rio->send_cq);
+    }
+
+    if (RIO_INVALID_BUFFERID != rio->buffer_id)
+    {
+        aeron_udp_channel_transport_rio_functions.RIODeregisterBuffer(rio->buffer_id);
+    }
+
+    if (NULL != rio->buffer)
+    {
+        VirtualFree(rio->buffer, 0, MEM_RELEASE);
+    }
+
+    aeron_free(rio->free_send_slots);
+    aeron_free(rio->results);
+    aeron_free(rio);
+}
+
+static int aeron_udp_channel_transport_rio_post_receive(
+    aeron_udp_channel_transport_rio_t *rio, uint32_t slot, DWORD flags)
+{
+    RIO_BUF data_buf;
+    RIO_BUF addr_buf;
+
+    data_buf.BufferId = rio->buffer_id;
+    data_buf.Offset = (ULONG)(slot * rio->receive_slot_length);
+    data_buf.Length = (ULONG)rio->receive_slot_length;
+    addr_buf.BufferId = rio->buffer_id;
+    addr_buf.Offset = (ULONG)(aeron_udp_channel_transport_rio_addr(rio, slot) - rio->buffer);
+    addr_buf.Length = sizeof(SOCKADDR_INET);
+
+    if (!aeron_udp_channel_transport_rio_functions.RIOReceiveEx(
+        rio->request_queue, &data_buf, 1, NULL, &addr_buf, NULL, NULL, flags, (PVOID)(uintptr_t)slot))
+    {
+        aeron_set_err_from_last_err_code("RIOReceiveEx");
+        return -1;
+    }
+
+    return 0;
+}
+
+static int aeron_udp_channel_transport_rio_create(
+    aeron_udp_channel_transport_t *transport,
+    uint32_t slot_count,
+    size_t receive_slot_length,
+    size_t send_slot_length)
+{
+    aeron_udp_channel_transport_rio_t *rio = NULL;
+
+    if (aeron_alloc((void **)&rio, sizeof(aeron_udp_channel_transport_rio_t)) < 0)
+    {
+        return -1;
+    }
+
+    rio->request_queue = RIO_INVALID_RQ;
+    rio->receive_cq = RIO_INVALID_CQ;
+    rio->send_cq = RIO_INVALID_CQ;
+    rio->buffer_id = RIO_INVALID_BUFFERID;
+    rio->buffer = NULL;
+    rio->receive_slot_length = receive_slot_length;
+    rio->send_slot_length = send_slot_length;
+    rio->send_slots_offset = slot_count * receive_slot_length;
+    rio->addr_slots_offset = rio->send_slots_offset + (slot_count * send_slot_length);
+    rio->slot_count = slot_count;
+    rio->free_send_slot_count = 0;
+    rio->free_send_slots = NULL;
+    rio->results = NULL;
+
+    size_t buffer_length = rio->addr_slots_offset + (2 * slot_count * AERON_UDP_CHANNEL_TRANSPORT_RIO_ADDR_SLOT_LENGTH);
+
+    if (aeron_alloc((void **)&rio->free_send_slots, sizeof(uint32_t) * slot_count) < 0 ||
+        aeron_alloc((void **)&rio->results, sizeof(RIORESULT) * slot_count) < 0)
+    {
+        goto error;
+    }
+
+    if (NULL == (rio->buffer = VirtualAlloc(NULL, buffer_length, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE)))
+    {
+        aeron_set_err_from_last_err_code("VirtualAlloc(%" PRIu64 ")", (uint64_t)buffer_length);
+        goto error;
+    }
+
+    if (RIO_INVALID_BUFFERID == (rio->buffer_id = aeron_udp_channel_transport_rio_functions.RIORegisterBuffer(
+        (PCHAR)rio->buffer, (DWORD)buffer_length)))
+    {
+        aeron_set_err_from_last_err_code("RIORegisterBuffer");
+        goto error;
+    }
+
+    if (RIO_INVALID_CQ == (rio->receive_cq = aeron_udp_channel_transport_rio_functions.RIOCreateCompletionQueue(
+        slot_count, NULL)) ||
+        RIO_INVALID_CQ == (rio->send_cq = aeron_udp_channel_transport_rio_functions.RIOCreateCompletionQueue(
+        slot_count, NULL)))
+    {
+        aeron_set_err_from_last_err_code("RIOCreateCompletionQueue");
+        goto error;
+    }
+
+    if (RIO_INVALID_RQ == (rio->request_queue = aeron_udp_channel_transport_rio_functions.RIOCreateRequestQueue(
+        (SOCKET)transport->fd, slot_count, 1, slot_count, 1, rio->receive_cq, rio->send_cq, transport)))
+    {
+        aeron_set_err_from_last_err_code("RIOCreateRequestQueue");
+        goto error;
+    }
+
+    for (uint32_t slot = 0; slot < slot_count; slot++)
+    {
+        rio->free_send_slots[rio->free_send_slot_count++] = slot;
+
+        if (aeron_udp_channel_transport_rio_post_receive(rio, slot, 0) < 0)
+        {
+            goto error;
+        }
+    }
+
+    transport->bindings_clientd = rio;
+
+    return 0;
+
+    error:
+        aeron_udp_channel_transport_rio_delete(rio);
+        return -1;
+}
+
+int aeron_udp_channel_transport_rio_init(
+    aeron_udp_channel_transport_t *transport,
+    struct sockaddr_storage *bind_addr,
+    struct sockaddr_storage *multicast_if_addr,
+    unsigned int multicast_if_index,
+    uint8_t ttl,
+    size_t socket_rcvbuf,
+    size_t socket_sndbuf,
+    aeron_driver_context_t *context,
+    aeron_udp_channel_transport_affinity_t affinity)
+{
+    uint64_t slot_count = AERON_UDP_CHANNEL_TRANSPORT_RIO_SLOT_COUNT_DEFAULT;
+    const char *slot_count_str = getenv(AERON_UDP_CHANNEL_TRANSPORT_RIO_SLOT_COUNT_ENV_VAR);
+
+    transport->fd = -1;
+
+    if (NULL != slot_count_str)
+    {
+        char *end_ptr = NULL;
+
+        errno = 0;
+        slot_count = strtoull(slot_count_str, &end_ptr, 10);
+        if (0 != errno || '\0' != *end_ptr || end_ptr == slot_count_str ||
+            0 == slot_count || slot_count > AERON_UDP_CHANNEL_TRANSPORT_RIO_MAX_SLOT_COUNT)
+        {
+            aeron_set_err(
+                EINVAL,
+                "%s must be between 1 and %d: %s",
+                AERON_UDP_CHANNEL_TRANSPORT_RIO_SLOT_COUNT_ENV_VAR,
+                AERON_UDP_CHANNEL_TRANSPORT_RIO_MAX_SLOT_COUNT,
+                slot_count_str);
+            return -1;
+        }
+    }
+
+    aeron_net_init();
+
+    SOCKET handle = WSASocketW(bind_addr->ss_family, SOCK_DGRAM, IPPROTO_UDP, NULL, 0, WSA_FLAG_REGISTERED_IO);
+    if (INVALID_SOCKET == handle)
+    {
+        aeron_set_err_from_last_err_code("WSASocket(WSA_FLAG_REGISTERED_IO)");
+        return -1;
+    }
+
+    if (aeron_udp_channel_transport_init_with_socket(
+        transport,
+        (aeron_socket_t)handle,
+        bind_addr,
+        multicast_if_addr,
+        multicast_if_index,
+        ttl,
+        socket_rcvbuf,
+        socket_sndbuf,
+        context,
+        affinity) < 0)
+    {
+        return -1;
+    }
+
+    size_t mtu_length = NULL != context ? context->mtu_length : AERON_DRIVER_RECEIVER_MAX_UDP_PACKET_LENGTH;
+    size_t receive_slot_length = AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_RECEIVER == affinity ?
+        AERON_DRIVER_RECEIVER_MAX_UDP_PACKET_LENGTH : mtu_length;
+
+    if (aeron_udp_channel_transport_rio_load_functions(transport->fd) < 0 ||
+        aeron_udp_channel_transport_rio_create(transport, (uint32_t)slot_count, receive_slot_length, mtu_length) < 0)
+    {
+        aeron_udp_channel_transport_close(transport);
+        transport->fd = -1;
+        return -1;
+    }
+
+    return 0;
+}
+
+int aeron_udp_channel_transport_rio_close(aeron_udp_channel_transport_t *transport)
+{
+    aeron_udp_channel_transport_rio_t *rio = (aeron_udp_channel_transport_rio_t *)transport->bindings_clientd;
+
+    /* closing the socket closes its request queue, which must go before the completion queues it posts to */
+    int result = aeron_udp_channel_transport_close(transport);
+
+    if (NULL != rio)
+    {
+        aeron_udp_channel_transport_rio_delete(rio);
+        transport->bindings_clientd = NULL;
+    }
+
+    return result;
+}
+
+int aeron_udp_channel_transport_rio_recvmmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen,
+    int64_t *bytes_rcved,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd)
+{
+    aeron_udp_channel_transport_rio_t *rio = (aeron_udp_channel_transport_rio_t *)transport->bindings_clientd;
+    ULONG limit = (ULONG)(vlen < rio->slot_count ? vlen : rio->slot_count);
+    ULONG count = aeron_udp_channel_transport_rio_functions.RIODequeueCompletion(rio->receive_cq, rio->results, limit);
+
+    if (RIO_CORRUPT_CQ == count)
+    {
+        aeron_set_err(EINVAL, "%s", "RIODequeueCompletion: receive completion queue is corrupt");
+        return -1;
+    }
+
+    int work_count = 0;
+
+    for (ULONG i = 0; i < count; i++)
+    {
+        RIORESULT *result = &rio->results[i];
+        uint32_t slot = (uint32_t)result->RequestContext;
+
+        if (NO_ERROR == result->Status)
+        {
+            struct msghdr msghdr;
+            uint8_t *addr = aeron_udp_channel_transport_rio_addr(rio, slot);
+
+            memset(&msghdr, 0, sizeof(msghdr));
+            msghdr.msg_name = addr;
+            msghdr.msg_namelen = sizeof(SOCKADDR_INET);
+
+            work_count += aeron_udp_channel_transport_dispatch(
+                transport,
+                &msghdr,
+                rio->buffer + (slot * rio->receive_slot_length),
+                result->BytesTransferred,
+                (struct sockaddr_storage *)addr,
+                bytes_rcved,
+                recv_func,
+                clientd);
+        }
+
+        if (aeron_udp_channel_transport_rio_post_receive(rio, slot, RIO_MSG_DEFER) < 0)
+        {
+            return -1;
+        }
+    }
+
+    if (count > 0 && !aeron_udp_channel_transport_rio_functions.RIOReceiveEx(
+        rio->request_queue, NULL, 0, NULL, NULL, NULL, NULL, RIO_MSG_COMMIT_ONLY, NULL))
+    {
+        aeron_set_err_from_last_err_code("RIOReceiveEx(RIO_MSG_COMMIT_ONLY)");
+        return -1;
+    }
+
+    return work_count;
+}
+
+static void aeron_udp_channel_transport_rio_reap_sends(aeron_udp_channel_transport_rio_t *rio)
+{
+    ULONG count = aeron_udp_channel_transport_rio_functions.RIODequeueCompletion(
+        rio->send_cq, rio->results, rio->slot_count);
+
+    if (RIO_CORRUPT_CQ != count)
+    {
+        for (ULONG i = 0; i < count; i++)
+        {
+            rio->free_send_slots[rio->free_send_slot_count++] = (uint32_t)rio->results[i].RequestContext;
+        }
+    }
+}
+
+static int aeron_udp_channel_transport_rio_commit_sends(aeron_udp_channel_transport_rio_t *rio)
+{
+    if (!aeron_udp_channel_transport_rio_functions.RIOSendEx(
+        rio->request_queue, NULL, 0, NULL, NULL, NULL, NULL, RIO_MSG_COMMIT_ONLY, NULL))
+    {
+        aeron_set_err_from_last_err_code("RIOSendEx(RIO_MSG_COMMIT_ONLY)");
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * Copy the message into a free send slot and post it. Returns the length sent, 0 when no slot is free, or -1 on error.
+ * Messages which do not fit a slot go through Winsock directly, which a RIO socket still supports.
+ */
+static int aeron_udp_channel_transport_rio_send(
+    aeron_udp_channel_transport_t *transport, aeron_udp_channel_transport_rio_t *rio, struct msghdr *message, DWORD flags)
+{
+    size_t length = 0;
+
+    for (ULONG i = 0; i < message->msg_iovlen; i++)
+    {
+        length += message->msg_iov[i].iov_len;
+    }
+
+    if (length > rio->send_slot_length || (size_t)message->msg_namelen > sizeof(SOCKADDR_INET))
+    {
+        if (RIO_MSG_DEFER == flags && aeron_udp_channel_transport_rio_commit_sends(rio) < 0)
+        {
+            return -1;
+        }
+
+        ssize_t sendmsg_result = sendmsg(transport->fd, message, 0);
+        if (sendmsg_result < 0)
+        {
+            aeron_set_err_from_last_err_code("sendmsg");
+            return -1;
+        }
+
+        return (int)sendmsg_result;
+    }
+
+    if (0 == rio->free_send_slot_count)
+    {
+        return 0;
+    }
+
+    uint32_t slot = rio->free_send_slots[--rio->free_send_slot_count];
+    size_t data_offset = rio->send_slots_offset + (slot * rio->send_slot_length);
+    uint8_t *addr = aeron_udp_channel_transport_rio_addr(rio, rio->slot_count + slot);
+    RIO_BUF data_buf;
+    RIO_BUF addr_buf;
+
+    for (ULONG i = 0, offset = 0; i < message->msg_iovlen; i++)
+    {
+        memcpy(rio->buffer + data_offset + offset, message->msg_iov[i].iov_base, message->msg_iov[i].iov_len);
+        offset += message->msg_iov[i].iov_len;
+    }
+
+    data_buf.BufferId = rio->buffer_id;
+    data_buf.Offset = (ULONG)data_offset;
+    data_buf.Length = (ULONG)length;
+
+    if (NULL != message->msg_name)
+    {
+        memcpy(addr, message->msg_name, (size_t)message->msg_namelen);
+        addr_buf.BufferId = rio->buffer_id;
+        addr_buf.Offset = (ULONG)(addr - rio->buffer);
+        addr_buf.Length = sizeof(SOCKADDR_INET);
+    }
+
+    if (!aeron_udp_channel_transport_rio_functions.RIOSendEx(
+        rio->request_queue,
+        &data_buf,
+        1,
+        NULL,
+        NULL != message->msg_name ? &addr_buf : NULL,
+        NULL,
+        NULL,
+        flags,
+        (PVOID)(uintptr_t)slot))
+    {
+        rio->free_send_slots[rio->free_send_slot_count++] = slot;
+        aeron_set_err_from_last_err_code("RIOSendEx");
+        return -1;
+    }
+
+    return (int)length;
+}
+
+int aeron_udp_channel_transport_rio_sendmmsg(
+    aeron_udp_channel_data_paths_t *data_paths,
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen)
+{
+    aeron_udp_channel_transport_rio_t *rio = (aeron_udp_channel_transport_rio_t *)transport->bindings_clientd;
+    int result = 0;
+
+    aeron_udp_channel_transport_rio_reap_sends(rio);
+
+    for (size_t i = 0; i < vlen; i++)
+    {
+        int send_result = aeron_udp_channel_transport_rio_send(transport, rio, &msgvec[i].msg_hdr, RIO_MSG_DEFER);
+
+        if (send_result < 0)
+        {
+            return -1;
+        }
+
+        msgvec[i].msg_len = (unsigned int)send_result;
+
+        if (0 == send_result)
+        {
+            break;
+        }
+
+        result++;
+    }
+
+    if (result > 0 && aeron_udp_channel_transport_rio_commit_sends(rio) < 0)
+    {
+        return -1;
+    }
+
+    return result;
+}
+
+int aeron_udp_channel_transport_rio_sendmsg(
+    aeron_udp_channel_data_paths_t *data_paths,
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *message)
+{
+    aeron_udp_channel_transport_rio_t *rio = (aeron_udp_channel_transport_rio_t *)transport->bindings_clientd;
+
+    aeron_udp_channel_transport_rio_reap_sends(rio);
+
+    return aeron_udp_channel_transport_rio_send(transport, rio, message, 0);
+}
+
+int aeron_udp_transport_poller_rio_poll(
+    aeron_udp_transport_poller_t *poller,
+    struct mmsghdr *msgvec,
+    size_t vlen,
+    int64_t *bytes_rcved,
+    aeron_udp_transport_recv_func_t recv_func,
+    aeron_udp_channel_transport_recvmmsg_func_t recvmmsg_func,
+    void *clientd)
+{
+    int work_count = 0;
+
+    /* dequeuing a completion queue is a user mode read so every transport is checked on each poll */
+    for (size_t i = 0, length = poller->transports.length; i < length; i++)
+    {
+        int recv_result = recvmmsg_func(
+            poller->transports.array[i].transport, msgvec, vlen, bytes_rcved, recv_func, clientd);
+
+        if (recv_result < 0)
+        {
+            return recv_result;
+        }
+
+        work_count += recv_result;
+    }
+
+    return work_count;
+}
+
+aeron_udp_channel_transport_bindings_t aeron_udp_channel_transport_bindings_rio =
+    {
+        aeron_udp_channel_transport_rio_init,
+        aeron_udp_channel_transport_rio_close,
+        aeron_udp_channel_transport_rio_recvmmsg,
+        aeron_udp_channel_transport_rio_sendmmsg,
+        aeron_udp_channel_transport_rio_sendmsg,
+        aeron_udp_channel_transport_get_so_rcvbuf,
+        aeron_udp_channel_transport_bind_addr_and_port,
+        aeron_udp_transport_poller_init,
+        aeron_udp_transport_poller_close,
+        aeron_udp_transport_poller_add,
+        aeron_udp_transport_poller_remove,
+        aeron_udp_transport_poller_rio_poll,
+        {
+            "rio",
+            "media",
+            NULL,
+            NULL
+        }
+    };
+
+#endif
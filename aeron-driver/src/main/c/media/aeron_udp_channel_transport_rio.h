@@ -0,0 +1,74 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AERON_UDP_CHANNEL_TRANSPORT_RIO_H
+#define AERON_UDP_CHANNEL_TRANSPORT_RIO_H
+
+#include "aeron_udp_channel_transport_bindings.h"
+
+/**
+ * Number of receive and of send slots in the buffer each transport registers with Winsock Registered I/O. Every
+ * receive slot is kept posted to the socket and a send waits for a free send slot, so this bounds the datagrams in
+ * flight in each direction.
+ */
+#define AERON_UDP_CHANNEL_TRANSPORT_RIO_SLOT_COUNT_ENV_VAR "AERON_UDP_CHANNEL_TRANSPORT_RIO_SLOT_COUNT"
+
+#define AERON_UDP_CHANNEL_TRANSPORT_RIO_SLOT_COUNT_DEFAULT (128)
+
+struct mmsghdr;
+
+int aeron_udp_channel_transport_rio_init(
+    aeron_udp_channel_transport_t *transport,
+    struct sockaddr_storage *bind_addr,
+    struct sockaddr_storage *multicast_if_addr,
+    unsigned int multicast_if_index,
+    uint8_t ttl,
+    size_t socket_rcvbuf,
+    size_t socket_sndbuf,
+    aeron_driver_context_t *context,
+    aeron_udp_channel_transport_affinity_t affinity);
+
+int aeron_udp_channel_transport_rio_close(aeron_udp_channel_transport_t *transport);
+
+int aeron_udp_channel_transport_rio_recvmmsg(
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen,
+    int64_t *bytes_rcved,
+    aeron_udp_transport_recv_func_t recv_func,
+    void *clientd);
+
+int aeron_udp_channel_transport_rio_sendmmsg(
+    aeron_udp_channel_data_paths_t *data_paths,
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen);
+
+int aeron_udp_channel_transport_rio_sendmsg(
+    aeron_udp_channel_data_paths_t *data_paths,
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *message);
+
+int aeron_udp_transport_poller_rio_poll(
+    aeron_udp_transport_poller_t *poller,
+    struct mmsghdr *msgvec,
+    size_t vlen,
+    int64_t *bytes_rcved,
+    aeron_udp_transport_recv_func_t recv_func,
+    aeron_udp_channel_transport_recvmmsg_func_t recvmmsg_func,
+    void *clientd);
+
+#endif //AERON_UDP_CHANNEL_TRANSPORT_RIO_H
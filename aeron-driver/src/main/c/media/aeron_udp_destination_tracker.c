@@ -23,6 +23,9 @@
 #include "protocol/aeron_udp_protocol.h"
 #include "util/aeron_netutil.h"
 #include "util/aeron_arrayutil.h"
+#include "util/aeron_bitutil.h"
+#include "util/aeron_strutil.h"
+#include "aeron_alloc.h"
 #include "media/aeron_send_channel_endpoint.h"
 #include "aeron_driver_conductor.h"
 #include "media/aeron_udp_destination_tracker.h"
@@ -48,7 +51,16 @@ int aeron_udp_destination_tracker_init(
     tracker->destinations.array = NULL;
     tracker->destinations.length = 0;
     tracker->destinations.capacity = 0;
+    tracker->index.by_addr = NULL;
+    tracker->index.by_receiver = NULL;
+    tracker->index.capacity = 0;
+    tracker->activity.head = -1;
+    tracker->activity.tail = -1;
+    tracker->fan_out.array = NULL;
+    tracker->fan_out.capacity = 0;
     tracker->is_manual_control_mode = is_manual_control_model;
+    tracker->is_striped = false;
+    tracker->stripe_index = 0;
 
     return 0;
 }
@@ -64,11 +76,361 @@ int aeron_udp_destination_tracker_close(aeron_udp_destination_tracker_t *tracker
         }
 
         aeron_free(tracker->destinations.array);
+        aeron_free(tracker->index.by_addr);
+        aeron_free(tracker->index.by_receiver);
+        aeron_free(tracker->fan_out.array);
     }
 
     return 0;
 }
 
+static uint64_t aeron_udp_destination_tracker_addr_hash(struct sockaddr_storage *addr)
+{
+    uint8_t key[sizeof(struct in6_addr) + sizeof(uint16_t)];
+    size_t key_length;
+
+    if (AF_INET6 == addr->ss_family)
+    {
+        struct sockaddr_in6 *in6_addr = (struct sockaddr_in6 *)addr;
+        memcpy(key, &in6_addr->sin6_addr, sizeof(struct in6_addr));
+        memcpy(key + sizeof(struct in6_addr), &in6_addr->sin6_port, sizeof(uint16_t));
+        key_length = sizeof(struct in6_addr) + sizeof(uint16_t);
+    }
+    else
+    {
+        struct sockaddr_in *in_addr = (struct sockaddr_in *)addr;
+        memcpy(key, &in_addr->sin_addr, sizeof(struct in_addr));
+        memcpy(key + sizeof(struct in_addr), &in_addr->sin_port, sizeof(uint16_t));
+        key_length = sizeof(struct in_addr) + sizeof(uint16_t);
+    }
+
+    return aeron_fnv_64a_buf(key, key_length);
+}
+
+static uint64_t aeron_udp_destination_tracker_receiver_hash(int64_t receiver_id, struct sockaddr_storage *addr)
+{
+    uint8_t key[sizeof(int64_t) + sizeof(uint16_t)];
+    uint16_t port = AF_INET6 == addr->ss_family ?
+        ((struct sockaddr_in6 *)addr)->sin6_port : ((struct sockaddr_in *)addr)->sin_port;
+
+    memcpy(key, &receiver_id, sizeof(int64_t));
+    memcpy(key + sizeof(int64_t), &port, sizeof(uint16_t));
+
+    return aeron_fnv_64a_buf(key, sizeof(key));
+}
+
+static inline uint64_t aeron_udp_destination_tracker_entry_hash(
+    aeron_udp_destination_tracker_t *tracker, int32_t entry_index, bool by_receiver)
+{
+    aeron_udp_destination_entry_t *entry = &tracker->destinations.array[entry_index];
+    return by_receiver ? entry->receiver_hash : entry->addr_hash;
+}
+
+static void aeron_udp_destination_tracker_index_insert(
+    aeron_udp_destination_tracker_t *tracker, int32_t *slots, uint64_t hash, int32_t entry_index)
+{
+    const size_t mask = tracker->index.capacity - 1;
+    size_t i = (size_t)hash & mask;
+
+    while (-1 != slots[i])
+    {
+        i = (i + 1) & mask;
+    }
+
+    slots[i] = entry_index;
+}
+
+static void aeron_udp_destination_tracker_index_remove(
+    aeron_udp_destination_tracker_t *tracker, int32_t *slots, bool by_receiver, uint64_t hash, int32_t entry_index)
+{
+    const size_t mask = tracker->index.capacity - 1;
+    size_t i = (size_t)hash & mask;
+
+    while (entry_index != slots[i])
+    {
+        i = (i + 1) & mask;
+    }
+
+    slots[i] = -1;
+
+    for (size_t j = (i + 1) & mask; -1 != slots[j]; j = (j + 1) & mask)
+    {
+        const size_t ideal = (size_t)aeron_udp_destination_tracker_entry_hash(tracker, slots[j], by_receiver) & mask;
+
+        if (((j - ideal) & mask) >= ((j - i) & mask))
+        {
+            slots[i] = slots[j];
+            slots[j] = -1;
+            i = j;
+        }
+    }
+}
+
+static void aeron_udp_destination_tracker_index_replace(
+    aeron_udp_destination_tracker_t *tracker, int32_t *slots, uint64_t hash, int32_t old_index, int32_t new_index)
+{
+    const size_t mask = tracker->index.capacity - 1;
+    size_t i = (size_t)hash & mask;
+
+    while (old_index != slots[i])
+    {
+        i = (i + 1) & mask;
+    }
+
+    slots[i] = new_index;
+}
+
+static int aeron_udp_destination_tracker_index_ensure_capacity(aeron_udp_destination_tracker_t *tracker)
+{
+    const size_t required_capacity =
+        (size_t)aeron_find_next_power_of_two((int32_t)(tracker->destinations.capacity * 2));
+    if (tracker->index.capacity >= required_capacity)
+    {
+        return 0;
+    }
+
+    int32_t *by_addr = NULL;
+    int32_t *by_receiver = NULL;
+
+    if (aeron_alloc((void **)&by_addr, required_capacity * sizeof(int32_t)) < 0 ||
+        aeron_alloc((void **)&by_receiver, required_capacity * sizeof(int32_t)) < 0)
+    {
+        aeron_free(by_addr);
+        return -1;
+    }
+
+    memset(by_addr, 0xFF, required_capacity * sizeof(int32_t));
+    memset(by_receiver, 0xFF, required_capacity * sizeof(int32_t));
+
+    aeron_free(tracker->index.by_addr);
+    aeron_free(tracker->index.by_receiver);
+    tracker->index.by_addr = by_addr;
+    tracker->index.by_receiver = by_receiver;
+    tracker->index.capacity = required_capacity;
+
+    for (size_t i = 0, length = tracker->destinations.length; i < length; i++)
+    {
+        aeron_udp_destination_entry_t *entry = &tracker->destinations.array[i];
+
+        aeron_udp_destination_tracker_index_insert(tracker, by_addr, entry->addr_hash, (int32_t)i);
+        if (entry->is_receiver_id_valid)
+        {
+            aeron_udp_destination_tracker_index_insert(tracker, by_receiver, entry->receiver_hash, (int32_t)i);
+        }
+    }
+
+    return 0;
+}
+
+static void aeron_udp_destination_tracker_activity_unlink(aeron_udp_destination_tracker_t *tracker, int32_t index)
+{
+    aeron_udp_destination_entry_t *entry = &tracker->destinations.array[index];
+
+    if (-1 != entry->prev_activity_index)
+    {
+        tracker->destinations.array[entry->prev_activity_index].next_activity_index = entry->next_activity_index;
+    }
+    else
+    {
+        tracker->activity.head = entry->next_activity_index;
+    }
+
+    if (-1 != entry->next_activity_index)
+    {
+        tracker->destinations.array[entry->next_activity_index].prev_activity_index = entry->prev_activity_index;
+    }
+    else
+    {
+        tracker->activity.tail = entry->prev_activity_index;
+    }
+
+    entry->prev_activity_index = -1;
+    entry->next_activity_index = -1;
+}
+
+static void aeron_udp_destination_tracker_activity_append(aeron_udp_destination_tracker_t *tracker, int32_t index)
+{
+    aeron_udp_destination_entry_t *entry = &tracker->destinations.array[index];
+
+    entry->prev_activity_index = tracker->activity.tail;
+    entry->next_activity_index = -1;
+
+    if (-1 != tracker->activity.tail)
+    {
+        tracker->destinations.array[tracker->activity.tail].next_activity_index = index;
+    }
+    else
+    {
+        tracker->activity.head = index;
+    }
+
+    tracker->activity.tail = index;
+}
+
+static void aeron_udp_destination_tracker_on_activity(
+    aeron_udp_destination_tracker_t *tracker, int32_t index, int64_t now_ns)
+{
+    tracker->destinations.array[index].time_of_last_activity_ns = now_ns;
+
+    if (tracker->activity.tail != index)
+    {
+        aeron_udp_destination_tracker_activity_unlink(tracker, index);
+        aeron_udp_destination_tracker_activity_append(tracker, index);
+    }
+}
+
+static void aeron_udp_destination_tracker_remove_at(aeron_udp_destination_tracker_t *tracker, int32_t index)
+{
+    aeron_udp_destination_entry_t *entry = &tracker->destinations.array[index];
+    const int32_t last_index = (int32_t)tracker->destinations.length - 1;
+
+    aeron_udp_destination_tracker_index_remove(tracker, tracker->index.by_addr, false, entry->addr_hash, index);
+    if (entry->is_receiver_id_valid)
+    {
+        aeron_udp_destination_tracker_index_remove(
+            tracker, tracker->index.by_receiver, true, entry->receiver_hash, index);
+    }
+    aeron_udp_destination_tracker_activity_unlink(tracker, index);
+
+    if (index != last_index)
+    {
+        aeron_udp_destination_entry_t *moved = &tracker->destinations.array[last_index];
+
+        aeron_udp_destination_tracker_index_replace(
+            tracker, tracker->index.by_addr, moved->addr_hash, last_index, index);
+        if (moved->is_receiver_id_valid)
+        {
+            aeron_udp_destination_tracker_index_replace(
+                tracker, tracker->index.by_receiver, moved->receiver_hash, last_index, index);
+        }
+
+        if (-1 != moved->prev_activity_index)
+        {
+            tracker->destinations.array[moved->prev_activity_index].next_activity_index = index;
+        }
+        else
+        {
+            tracker->activity.head = index;
+        }
+
+        if (-1 != moved->next_activity_index)
+        {
+            tracker->destinations.array[moved->next_activity_index].prev_activity_index = index;
+        }
+        else
+        {
+            tracker->activity.tail = index;
+        }
+
+        aeron_array_fast_unordered_remove(
+            (uint8_t *)tracker->destinations.array,
+            sizeof(aeron_udp_destination_entry_t),
+            (size_t)index,
+            (size_t)last_index);
+    }
+
+    tracker->destinations.length--;
+}
+
+static void aeron_udp_destination_tracker_remove_timed_out(aeron_udp_destination_tracker_t *tracker, int64_t now_ns)
+{
+    while (-1 != tracker->activity.head)
+    {
+        aeron_udp_destination_entry_t *entry = &tracker->destinations.array[tracker->activity.head];
+
+        if (now_ns <= (entry->time_of_last_activity_ns + tracker->destination_timeout_ns))
+        {
+            break;
+        }
+
+        aeron_udp_destination_tracker_remove_at(tracker, tracker->activity.head);
+    }
+}
+
+static int aeron_udp_destination_tracker_sendmmsg_per_destination(
+    aeron_udp_destination_tracker_t *tracker,
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *mmsghdr,
+    size_t vlen)
+{
+    int min_msgs_sent = (int)vlen;
+
+    for (size_t i = 0, length = tracker->destinations.length; i < length; i++)
+    {
+        aeron_udp_destination_entry_t *entry = &tracker->destinations.array[i];
+
+        for (size_t j = 0; j < vlen; j++)
+        {
+            mmsghdr[j].msg_hdr.msg_name = &entry->addr;
+            mmsghdr[j].msg_hdr.msg_namelen = AERON_ADDR_LEN(&entry->addr);
+            mmsghdr[j].msg_len = 0;
+        }
+
+        const int sendmmsg_result = tracker->data_paths->sendmmsg_func(tracker->data_paths, transport, mmsghdr, vlen);
+
+        min_msgs_sent = sendmmsg_result < min_msgs_sent ? sendmmsg_result : min_msgs_sent;
+    }
+
+    return min_msgs_sent;
+}
+
+static bool aeron_udp_destination_tracker_is_data(struct mmsghdr *mmsghdr, size_t vlen)
+{
+    for (size_t i = 0; i < vlen; i++)
+    {
+        struct iovec *iov = mmsghdr[i].msg_hdr.msg_iov;
+
+        if (NULL == iov || iov->iov_len < AERON_DATA_HEADER_LENGTH)
+        {
+            return false;
+        }
+
+        aeron_frame_header_t *frame_header = (aeron_frame_header_t *)iov->iov_base;
+        if (AERON_HDR_TYPE_DATA != frame_header->type || frame_header->frame_length <= 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+ * Each message goes to just one destination, dealt round robin, so the destinations share the load rather than each
+ * carrying a full copy. The receiver merges the paths back into one image by position.
+ */
+static int aeron_udp_destination_tracker_sendmmsg_striped(
+    aeron_udp_destination_tracker_t *tracker,
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *mmsghdr,
+    size_t vlen)
+{
+    const size_t destinations_length = tracker->destinations.length;
+
+    for (size_t j = 0; j < vlen; j++)
+    {
+        aeron_udp_destination_entry_t *entry =
+            &tracker->destinations.array[(tracker->stripe_index + j) % destinations_length];
+
+        mmsghdr[j].msg_hdr.msg_name = &entry->addr;
+        mmsghdr[j].msg_hdr.msg_namelen = AERON_ADDR_LEN(&entry->addr);
+        mmsghdr[j].msg_len = 0;
+    }
+
+    const int sendmmsg_result = tracker->data_paths->sendmmsg_func(tracker->data_paths, transport, mmsghdr, vlen);
+    if (sendmmsg_result > 0)
+    {
+        tracker->stripe_index = (tracker->stripe_index + (size_t)sendmmsg_result) % destinations_length;
+    }
+
+    return sendmmsg_result;
+}
+
+/*
+ * The messages are replicated once per destination into a single vector, each copy sharing the iovecs and control of
+ * the original but with its own msg_name, so a fan out to many destinations costs one sendmmsg per batch rather than
+ * one per destination.
+ */
 int aeron_udp_destination_tracker_sendmmsg(
     aeron_udp_destination_tracker_t *tracker,
     aeron_udp_channel_transport_t *transport,
@@ -78,33 +440,75 @@ int aeron_udp_destination_tracker_sendmmsg(
     const bool is_dynamic_control_mode = !tracker->is_manual_control_mode;
     int min_msgs_sent = (int)vlen;
 
-    for (int last_index = (int)tracker->destinations.length - 1, i = last_index; i >= 0; i--)
+    if (is_dynamic_control_mode)
     {
-        aeron_udp_destination_entry_t *entry = &tracker->destinations.array[i];
+        aeron_udp_destination_tracker_remove_timed_out(tracker, now_ns);
+    }
 
-        if (is_dynamic_control_mode && now_ns > (entry->time_of_last_activity_ns + tracker->destination_timeout_ns))
+    const size_t destinations_length = tracker->destinations.length;
+    if (tracker->is_striped && destinations_length > 1 && aeron_udp_destination_tracker_is_data(mmsghdr, vlen))
+    {
+        return aeron_udp_destination_tracker_sendmmsg_striped(tracker, transport, mmsghdr, vlen);
+    }
+
+    if (destinations_length < 2 || 0 == vlen || vlen > AERON_UDP_DESTINATION_TRACKER_FAN_OUT_MAX_MESSAGES)
+    {
+        return aeron_udp_destination_tracker_sendmmsg_per_destination(tracker, transport, mmsghdr, vlen);
+    }
+
+    const size_t max_destinations_per_send = AERON_UDP_DESTINATION_TRACKER_FAN_OUT_MAX_MESSAGES / vlen;
+    const size_t destinations_per_send = destinations_length < max_destinations_per_send ?
+        destinations_length : max_destinations_per_send;
+    const size_t fan_out_capacity = destinations_per_send * vlen;
+
+    if (tracker->fan_out.capacity < fan_out_capacity)
+    {
+        if (aeron_reallocf((void **)&tracker->fan_out.array, fan_out_capacity * sizeof(struct mmsghdr)) < 0)
         {
-            aeron_array_fast_unordered_remove(
-                (uint8_t *)tracker->destinations.array,
-                sizeof(aeron_udp_destination_entry_t),
-                (size_t)i,
-                (size_t)last_index);
-            last_index--;
-            tracker->destinations.length--;
+            tracker->fan_out.capacity = 0;
+            return aeron_udp_destination_tracker_sendmmsg_per_destination(tracker, transport, mmsghdr, vlen);
         }
-        else
+
+        tracker->fan_out.capacity = fan_out_capacity;
+    }
+
+    struct mmsghdr *fan_out = tracker->fan_out.array;
+
+    for (size_t i = 0; i < destinations_length; i += destinations_per_send)
+    {
+        const size_t remaining = destinations_length - i;
+        const size_t batch_destinations = remaining < destinations_per_send ? remaining : destinations_per_send;
+        size_t fan_out_length = 0;
+
+        for (size_t d = 0; d < batch_destinations; d++)
         {
+            aeron_udp_destination_entry_t *entry = &tracker->destinations.array[i + d];
+
             for (size_t j = 0; j < vlen; j++)
             {
-                mmsghdr[j].msg_hdr.msg_name = &entry->addr;
-                mmsghdr[j].msg_hdr.msg_namelen = AERON_ADDR_LEN(&entry->addr);
-                mmsghdr[j].msg_len = 0;
+                fan_out[fan_out_length].msg_hdr = mmsghdr[j].msg_hdr;
+                fan_out[fan_out_length].msg_hdr.msg_name = &entry->addr;
+                fan_out[fan_out_length].msg_hdr.msg_namelen = AERON_ADDR_LEN(&entry->addr);
+                fan_out[fan_out_length].msg_len = 0;
+                fan_out_length++;
             }
+        }
 
-            const int sendmmsg_result = tracker->data_paths->sendmmsg_func(
-                tracker->data_paths, transport, mmsghdr, vlen);
+        const int sendmmsg_result = tracker->data_paths->sendmmsg_func(
+            tracker->data_paths, transport, fan_out, fan_out_length);
 
-            min_msgs_sent = sendmmsg_result < min_msgs_sent ? sendmmsg_result : min_msgs_sent;
+        if (sendmmsg_result < 0)
+        {
+            min_msgs_sent = sendmmsg_result;
+            continue;
+        }
+
+        for (size_t d = 0; d < batch_destinations; d++)
+        {
+            const int64_t sent = (int64_t)sendmmsg_result - (int64_t)(d * vlen);
+            const int msgs_sent = sent <= 0 ? 0 : (sent >= (int64_t)vlen ? (int)vlen : (int)sent);
+
+            min_msgs_sent = msgs_sent < min_msgs_sent ? msgs_sent : min_msgs_sent;
         }
     }
 
@@ -118,29 +522,21 @@ int aeron_udp_destination_tracker_sendmsg(
     const bool is_dynamic_control_mode = !tracker->is_manual_control_mode;
     int min_bytes_sent = (int)msghdr->msg_iov->iov_len;
 
-    for (int last_index = (int)tracker->destinations.length - 1, i = last_index; i >= 0; i--)
+    if (is_dynamic_control_mode)
+    {
+        aeron_udp_destination_tracker_remove_timed_out(tracker, now_ns);
+    }
+
+    for (size_t i = 0, length = tracker->destinations.length; i < length; i++)
     {
         aeron_udp_destination_entry_t *entry = &tracker->destinations.array[i];
 
-        if (is_dynamic_control_mode && now_ns > (entry->time_of_last_activity_ns + tracker->destination_timeout_ns))
-        {
-            aeron_array_fast_unordered_remove(
-                (uint8_t *)tracker->destinations.array,
-                sizeof(aeron_udp_destination_entry_t),
-                (size_t)i,
-                (size_t)last_index);
-            last_index--;
-            tracker->destinations.length--;
-        }
-        else
-        {
-            msghdr->msg_name = &entry->addr;
-            msghdr->msg_namelen = AERON_ADDR_LEN(&entry->addr);
+        msghdr->msg_name = &entry->addr;
+        msghdr->msg_namelen = AERON_ADDR_LEN(&entry->addr);
 
-            const int sendmsg_result = tracker->data_paths->sendmsg_func(tracker->data_paths, transport, msghdr);
+        const int sendmsg_result = tracker->data_paths->sendmsg_func(tracker->data_paths, transport, msghdr);
 
-            min_bytes_sent = sendmsg_result < min_bytes_sent ? sendmsg_result : min_bytes_sent;
-        }
+        min_bytes_sent = sendmsg_result < min_bytes_sent ? sendmsg_result : min_bytes_sent;
     }
 
     return min_bytes_sent;
@@ -203,7 +599,13 @@ int aeron_udp_destination_tracker_add_destination(
     AERON_ARRAY_ENSURE_CAPACITY(result, tracker->destinations, aeron_udp_destination_entry_t);
     if (result >= 0)
     {
-        aeron_udp_destination_entry_t *entry = &tracker->destinations.array[tracker->destinations.length++];
+        result = aeron_udp_destination_tracker_index_ensure_capacity(tracker);
+    }
+
+    if (result >= 0)
+    {
+        const int32_t index = (int32_t)tracker->destinations.length++;
+        aeron_udp_destination_entry_t *entry = &tracker->destinations.array[index];
 
         entry->receiver_id = receiver_id;
         entry->is_receiver_id_valid = is_receiver_id_valid;
@@ -211,46 +613,118 @@ int aeron_udp_destination_tracker_add_destination(
         entry->destination_timeout_ns = AERON_UDP_DESTINATION_TRACKER_DESTINATION_TIMEOUT_NS;
         entry->uri = uri;
         memcpy(&entry->addr, addr, sizeof(struct sockaddr_storage));
+        entry->addr_hash = aeron_udp_destination_tracker_addr_hash(addr);
+        entry->receiver_hash = aeron_udp_destination_tracker_receiver_hash(receiver_id, addr);
+
+        aeron_udp_destination_tracker_index_insert(tracker, tracker->index.by_addr, entry->addr_hash, index);
+        if (is_receiver_id_valid)
+        {
+            aeron_udp_destination_tracker_index_insert(
+                tracker, tracker->index.by_receiver, entry->receiver_hash, index);
+        }
+        aeron_udp_destination_tracker_activity_append(tracker, index);
     }
 
     return result;
 }
 
-int aeron_udp_destination_tracker_on_status_message(
-    aeron_udp_destination_tracker_t *tracker, const uint8_t *buffer, size_t len, struct sockaddr_storage *addr)
+static int32_t aeron_udp_destination_tracker_find_by_receiver(
+    aeron_udp_destination_tracker_t *tracker, int64_t receiver_id, struct sockaddr_storage *addr)
 {
-    const aeron_status_message_header_t *status_message_header = (aeron_status_message_header_t *)buffer;
-    const int64_t now_ns = aeron_clock_cached_nano_time(tracker->cached_clock);
-    const int64_t receiver_id = status_message_header->receiver_id;
-    const bool is_dynamic_control_mode = !tracker->is_manual_control_mode;
+    if (0 == tracker->index.capacity)
+    {
+        return -1;
+    }
 
-    int result = 0;
-    bool is_existing = false;
+    const size_t mask = tracker->index.capacity - 1;
+    const int32_t *slots = tracker->index.by_receiver;
 
-    for (size_t i = 0, size = tracker->destinations.length; i < size; i++)
+    for (size_t i = (size_t)aeron_udp_destination_tracker_receiver_hash(receiver_id, addr) & mask;
+        -1 != slots[i];
+        i = (i + 1) & mask)
     {
-        aeron_udp_destination_entry_t *entry = &tracker->destinations.array[i];
+        aeron_udp_destination_entry_t *entry = &tracker->destinations.array[slots[i]];
 
-        if (entry->is_receiver_id_valid && receiver_id == entry->receiver_id &&
-            aeron_udp_destination_tracker_same_port(&entry->addr, addr))
+        if (receiver_id == entry->receiver_id && aeron_udp_destination_tracker_same_port(&entry->addr, addr))
         {
-            entry->time_of_last_activity_ns = now_ns;
-            is_existing = true;
-            break;
+            return slots[i];
+        }
+    }
+
+    return -1;
+}
+
+int aeron_udp_destination_tracker_address_compare(struct sockaddr_storage *lhs, struct sockaddr_storage *rhs)
+{
+    if (lhs->ss_family == rhs->ss_family)
+    {
+        size_t len = AF_INET == lhs->ss_family ? sizeof(struct sockaddr_in) : sizeof(struct sockaddr_in6);
+
+        return memcmp(lhs, rhs, len);
+    }
+
+    return 1;
+}
+
+static int32_t aeron_udp_destination_tracker_find_by_addr(
+    aeron_udp_destination_tracker_t *tracker, struct sockaddr_storage *addr, bool is_exact_match)
+{
+    if (0 == tracker->index.capacity)
+    {
+        return -1;
+    }
+
+    const size_t mask = tracker->index.capacity - 1;
+    const int32_t *slots = tracker->index.by_addr;
+
+    for (size_t i = (size_t)aeron_udp_destination_tracker_addr_hash(addr) & mask; -1 != slots[i]; i = (i + 1) & mask)
+    {
+        aeron_udp_destination_entry_t *entry = &tracker->destinations.array[slots[i]];
+
+        if (is_exact_match)
+        {
+            if (0 == aeron_udp_destination_tracker_address_compare(&entry->addr, addr))
+            {
+                return slots[i];
+            }
         }
         else if (!entry->is_receiver_id_valid &&
             aeron_udp_destination_tracker_same_addr(&entry->addr, addr) &&
             aeron_udp_destination_tracker_same_port(&entry->addr, addr))
         {
-            entry->time_of_last_activity_ns = now_ns;
-            entry->receiver_id = receiver_id;
-            entry->is_receiver_id_valid = true;
-            is_existing = true;
-            break;
+            return slots[i];
         }
     }
 
-    if (is_dynamic_control_mode && !is_existing)
+    return -1;
+}
+
+int aeron_udp_destination_tracker_on_status_message(
+    aeron_udp_destination_tracker_t *tracker, const uint8_t *buffer, size_t len, struct sockaddr_storage *addr)
+{
+    const aeron_status_message_header_t *status_message_header = (aeron_status_message_header_t *)buffer;
+    const int64_t now_ns = aeron_clock_cached_nano_time(tracker->cached_clock);
+    const int64_t receiver_id = status_message_header->receiver_id;
+    const bool is_dynamic_control_mode = !tracker->is_manual_control_mode;
+
+    int result = 0;
+    int32_t index = aeron_udp_destination_tracker_find_by_receiver(tracker, receiver_id, addr);
+
+    if (-1 == index && -1 != (index = aeron_udp_destination_tracker_find_by_addr(tracker, addr, false)))
+    {
+        aeron_udp_destination_entry_t *entry = &tracker->destinations.array[index];
+
+        entry->receiver_id = receiver_id;
+        entry->is_receiver_id_valid = true;
+        entry->receiver_hash = aeron_udp_destination_tracker_receiver_hash(receiver_id, &entry->addr);
+        aeron_udp_destination_tracker_index_insert(tracker, tracker->index.by_receiver, entry->receiver_hash, index);
+    }
+
+    if (-1 != index)
+    {
+        aeron_udp_destination_tracker_on_activity(tracker, index, now_ns);
+    }
+    else if (is_dynamic_control_mode)
     {
         result = aeron_udp_destination_tracker_add_destination(tracker, receiver_id, true, now_ns, NULL, addr);
     }
@@ -269,19 +743,7 @@ int aeron_udp_destination_tracker_manual_add_destination(
         return 0;
     }
 
-    return aeron_udp_destination_tracker_add_destination(tracker, now_ns, 0, false, uri, addr);
-}
-
-int aeron_udp_destination_tracker_address_compare(struct sockaddr_storage *lhs, struct sockaddr_storage *rhs)
-{
-    if (lhs->ss_family == rhs->ss_family)
-    {
-        size_t len = AF_INET == lhs->ss_family ? sizeof(struct sockaddr_in) : sizeof(struct sockaddr_in6);
-
-        return memcmp(lhs, rhs, len);
-    }
-
-    return 1;
+    return aeron_udp_destination_tracker_add_destination(tracker, 0, false, now_ns, uri, addr);
 }
 
 int aeron_udp_destination_tracker_remove_destination(
@@ -289,23 +751,12 @@ int aeron_udp_destination_tracker_remove_destination(
     struct sockaddr_storage *addr,
     aeron_uri_t **removed_uri)
 {
-    for (int last_index = (int)tracker->destinations.length - 1, i = last_index; i >= 0; i--)
-    {
-        aeron_udp_destination_entry_t *entry = &tracker->destinations.array[i];
+    const int32_t index = aeron_udp_destination_tracker_find_by_addr(tracker, addr, true);
 
-        if (aeron_udp_destination_tracker_address_compare(&entry->addr, addr) == 0)
-        {
-            *removed_uri = entry->uri;
-
-            aeron_array_fast_unordered_remove(
-                (uint8_t *)tracker->destinations.array,
-                sizeof(aeron_udp_destination_entry_t),
-                (size_t)i,
-                (size_t)last_index);
-
-            tracker->destinations.length--;
-            break;
-        }
+    if (-1 != index)
+    {
+        *removed_uri = tracker->destinations.array[index].uri;
+        aeron_udp_destination_tracker_remove_at(tracker, index);
     }
 
     return 0;
@@ -319,18 +770,21 @@ void aeron_udp_destination_tracker_check_for_re_resolution(
 {
     if (tracker->is_manual_control_mode)
     {
-        for (size_t i = 0; i < tracker->destinations.length; i++)
+        while (-1 != tracker->activity.head)
         {
-            aeron_udp_destination_entry_t *destination = &tracker->destinations.array[i];
+            const int32_t index = tracker->activity.head;
+            aeron_udp_destination_entry_t *destination = &tracker->destinations.array[index];
 
-            if (now_ns > (destination->time_of_last_activity_ns + destination->destination_timeout_ns))
+            if (now_ns <= (destination->time_of_last_activity_ns + destination->destination_timeout_ns))
             {
-                assert(NULL != destination->uri);
-
-                aeron_driver_conductor_proxy_on_re_resolve_endpoint(
-                    conductor_proxy, destination->uri->params.udp.endpoint, endpoint, &destination->addr);
-                destination->time_of_last_activity_ns = now_ns;
+                break;
             }
+
+            assert(NULL != destination->uri);
+
+            aeron_driver_conductor_proxy_on_re_resolve_endpoint(
+                conductor_proxy, destination->uri->params.udp.endpoint, endpoint, &destination->addr);
+            aeron_udp_destination_tracker_on_activity(tracker, index, now_ns);
         }
     }
 }
@@ -347,7 +801,28 @@ void aeron_udp_destination_tracker_resolution_change(
 
             if (0 == strncmp(endpoint_name, destination->uri->params.udp.endpoint, endpoint_name_len + 1))
             {
+                const int32_t index = (int32_t)i;
+
+                aeron_udp_destination_tracker_index_remove(
+                    tracker, tracker->index.by_addr, false, destination->addr_hash, index);
+                if (destination->is_receiver_id_valid)
+                {
+                    aeron_udp_destination_tracker_index_remove(
+                        tracker, tracker->index.by_receiver, true, destination->receiver_hash, index);
+                }
+
                 memcpy(&destination->addr, addr, sizeof(destination->addr));
+                destination->addr_hash = aeron_udp_destination_tracker_addr_hash(addr);
+                destination->receiver_hash = aeron_udp_destination_tracker_receiver_hash(
+                    destination->receiver_id, addr);
+
+                aeron_udp_destination_tracker_index_insert(
+                    tracker, tracker->index.by_addr, destination->addr_hash, index);
+                if (destination->is_receiver_id_valid)
+                {
+                    aeron_udp_destination_tracker_index_insert(
+                        tracker, tracker->index.by_receiver, destination->receiver_hash, index);
+                }
             }
         }
     }
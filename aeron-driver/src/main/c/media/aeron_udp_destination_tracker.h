@@ -22,6 +22,7 @@
 #include "aeron_udp_channel_transport.h"
 
 #define AERON_UDP_DESTINATION_TRACKER_DESTINATION_TIMEOUT_NS (5 * 1000 * 1000 * 1000LL)
+#define AERON_UDP_DESTINATION_TRACKER_FAN_OUT_MAX_MESSAGES (1024)
 
 typedef struct aeron_udp_destination_entry_stct
 {
@@ -32,6 +33,10 @@ typedef struct aeron_udp_destination_entry_stct
     bool is_receiver_id_valid;
     aeron_uri_t *uri;
     struct sockaddr_storage addr;
+    uint64_t addr_hash;
+    uint64_t receiver_hash;
+    int32_t prev_activity_index;
+    int32_t next_activity_index;
     uint8_t padding_after[AERON_CACHE_LINE_LENGTH];
 }
 aeron_udp_destination_entry_t;
@@ -46,7 +51,38 @@ typedef struct aeron_udp_destination_tracker_stct
     }
     destinations;
 
+    /*
+     * Open addressing indices of destination array positions, one keyed by address and port and one by receiver id
+     * and port, so control messages find their destination without scanning.
+     */
+    struct aeron_udp_destination_tracker_index_stct
+    {
+        int32_t *by_addr;
+        int32_t *by_receiver;
+        size_t capacity;
+    }
+    index;
+
+    /*
+     * Destinations linked in order of last activity, least recent at the head, so timeouts only visit expired entries.
+     */
+    struct aeron_udp_destination_tracker_activity_stct
+    {
+        int32_t head;
+        int32_t tail;
+    }
+    activity;
+
+    struct aeron_udp_destination_tracker_fan_out_stct
+    {
+        struct mmsghdr *array;
+        size_t capacity;
+    }
+    fan_out;
+
     bool is_manual_control_mode;
+    bool is_striped;
+    size_t stripe_index;
     aeron_clock_cache_t *cached_clock;
     int64_t destination_timeout_ns;
     aeron_udp_channel_data_paths_t *data_paths;
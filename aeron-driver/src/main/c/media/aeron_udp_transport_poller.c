@@ -24,6 +24,7 @@
 
 #include "util/aeron_arrayutil.h"
 #include "aeron_alloc.h"
+#include "aeron_socket.h"
 #include "media/aeron_udp_transport_poller.h"
 
 int aeron_udp_transport_poller_init(
@@ -42,20 +43,78 @@ int aeron_udp_transport_poller_init(
         return -1;
     }
     poller->epoll_events = NULL;
+#elif defined(HAVE_KQUEUE)
+    if ((poller->kqueue_fd = kqueue()) < 0)
+    {
+        aeron_set_err_from_last_err_code("kqueue");
+        return -1;
+    }
+    poller->kevents = NULL;
 #elif defined(HAVE_POLL) || defined(HAVE_WSAPOLL)
     poller->pollfds = NULL;
 #endif
 
+    poller->iteration_threshold = context->udp_transport_poller_iteration_threshold;
+    poller->busy_poll_us = 0;
+    poller->prefer_busy_poll = false;
+
+    /*
+     * Busy polling only pays off when the thread calling recvmmsg is already spinning on the receive path, so it is
+     * restricted to a Receiver with a thread of its own.
+     */
+    if (AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_RECEIVER == affinity &&
+        AERON_THREADING_MODE_DEDICATED == context->threading_mode)
+    {
+        poller->busy_poll_us = (int)context->socket_busy_poll_us;
+        poller->prefer_busy_poll = context->socket_busy_poll_us > 0 && context->socket_prefer_busy_poll;
+    }
+
     poller->bindings_clientd = NULL;
     return 0;
 }
 
+static int aeron_udp_transport_poller_set_busy_poll(
+    aeron_udp_transport_poller_t *poller, aeron_udp_channel_transport_t *transport)
+{
+#if defined(SO_BUSY_POLL)
+    if (poller->busy_poll_us > 0)
+    {
+        int busy_poll_us = poller->busy_poll_us;
+
+        if (aeron_setsockopt(transport->fd, SOL_SOCKET, SO_BUSY_POLL, &busy_poll_us, sizeof(busy_poll_us)) < 0)
+        {
+            aeron_set_err_from_last_err_code("setsockopt(SO_BUSY_POLL)");
+            return -1;
+        }
+    }
+#endif
+
+#if defined(SO_PREFER_BUSY_POLL)
+    if (poller->prefer_busy_poll)
+    {
+        int prefer_busy_poll = 1;
+
+        if (aeron_setsockopt(
+            transport->fd, SOL_SOCKET, SO_PREFER_BUSY_POLL, &prefer_busy_poll, sizeof(prefer_busy_poll)) < 0)
+        {
+            aeron_set_err_from_last_err_code("setsockopt(SO_PREFER_BUSY_POLL)");
+            return -1;
+        }
+    }
+#endif
+
+    return 0;
+}
+
 int aeron_udp_transport_poller_close(aeron_udp_transport_poller_t *poller)
 {
     aeron_free(poller->transports.array);
 #if defined(HAVE_EPOLL)
     close(poller->epoll_fd);
     aeron_free(poller->epoll_events);
+#elif defined(HAVE_KQUEUE)
+    close(poller->kqueue_fd);
+    aeron_free(poller->kevents);
 #elif defined(HAVE_POLL) || defined(HAVE_WSAPOLL)
     aeron_free(poller->pollfds);
 #endif
@@ -67,6 +126,11 @@ int aeron_udp_transport_poller_add(aeron_udp_transport_poller_t *poller, aeron_u
     int ensure_capacity_result = 0;
     size_t old_capacity = poller->transports.capacity, index = poller->transports.length;
 
+    if (aeron_udp_transport_poller_set_busy_poll(poller, transport) < 0)
+    {
+        return -1;
+    }
+
     AERON_ARRAY_ENSURE_CAPACITY(ensure_capacity_result, poller->transports, aeron_udp_channel_transport_entry_t);
     if (ensure_capacity_result < 0)
     {
@@ -98,6 +162,27 @@ int aeron_udp_transport_poller_add(aeron_udp_transport_poller_t *poller, aeron_u
         return -1;
     }
 
+#elif defined(HAVE_KQUEUE)
+    size_t new_capacity = poller->transports.capacity;
+
+    if (new_capacity > old_capacity)
+    {
+        if (aeron_array_ensure_capacity(
+            (uint8_t **)&poller->kevents, sizeof(struct kevent), old_capacity, new_capacity) < 0)
+        {
+            return -1;
+        }
+    }
+
+    struct kevent event;
+
+    EV_SET(&event, transport->fd, EVFILT_READ, EV_ADD, 0, 0, transport);
+    if (kevent(poller->kqueue_fd, &event, 1, NULL, 0, NULL) < 0)
+    {
+        aeron_set_err_from_last_err_code("kevent(EV_ADD)");
+        return -1;
+    }
+
 #elif defined(HAVE_POLL) || defined(HAVE_WSAPOLL)
     size_t new_capacity = poller->transports.capacity;
 
@@ -160,6 +245,16 @@ int aeron_udp_transport_poller_remove(aeron_udp_transport_poller_t *poller, aero
             return -1;
         }
 
+#elif defined(HAVE_KQUEUE)
+        struct kevent event;
+
+        EV_SET(&event, transport->fd, EVFILT_READ, EV_DELETE, 0, 0, transport);
+        if (kevent(poller->kqueue_fd, &event, 1, NULL, 0, NULL) < 0)
+        {
+            aeron_set_err_from_last_err_code("kevent(EV_DELETE)");
+            return -1;
+        }
+
 #elif defined(HAVE_POLL) || defined(HAVE_WSAPOLL)
         aeron_array_fast_unordered_remove(
             (uint8_t *)poller->pollfds,
@@ -184,7 +279,7 @@ int aeron_udp_transport_poller_poll(
 {
     int work_count = 0;
 
-    if (poller->transports.length <= AERON_UDP_TRANSPORT_POLLER_ITERATION_THRESHOLD)
+    if (poller->transports.length <= poller->iteration_threshold)
     {
         for (size_t i = 0, length = poller->transports.length; i < length; i++)
         {
@@ -240,6 +335,46 @@ int aeron_udp_transport_poller_poll(
             }
         }
 
+#elif defined(HAVE_KQUEUE)
+        struct timespec timeout = { 0, 0 };
+        int result = kevent(
+            poller->kqueue_fd, NULL, 0, poller->kevents, (int)poller->transports.length, &timeout);
+
+        if (result < 0)
+        {
+            int err = errno;
+
+            if (EINTR == err || EAGAIN == err)
+            {
+                return 0;
+            }
+
+            aeron_set_err_from_last_err_code("kevent");
+            return -1;
+        }
+        else if (0 == result)
+        {
+            return 0;
+        }
+        else
+        {
+            for (size_t i = 0, length = (size_t)result; i < length; i++)
+            {
+                if (EVFILT_READ == poller->kevents[i].filter && 0 == (poller->kevents[i].flags & EV_ERROR))
+                {
+                    int recv_result = recvmmsg_func(
+                        poller->kevents[i].udata, msgvec, vlen, bytes_rcved, recv_func, clientd);
+
+                    if (recv_result < 0)
+                    {
+                        return recv_result;
+                    }
+
+                    work_count += recv_result;
+                }
+            }
+        }
+
 #elif defined(HAVE_POLL) || defined(HAVE_WSAPOLL)
         int result = poll(poller->pollfds, (nfds_t)poller->transports.length, 0);
 
@@ -19,6 +19,9 @@
 
 #if defined(HAVE_EPOLL)
 #include <sys/epoll.h>
+#elif defined(HAVE_KQUEUE)
+#include <sys/types.h>
+#include <sys/event.h>
 #elif defined(HAVE_POLL)
 #include <poll.h>
 #elif defined(HAVE_WSAPOLL)
@@ -27,8 +30,6 @@
 
 #include "aeron_driver_conductor.h"
 
-#define AERON_UDP_TRANSPORT_POLLER_ITERATION_THRESHOLD (5)
-
 typedef struct aeron_udp_channel_transport_entry_stct
 {
     aeron_udp_channel_transport_t *transport;
@@ -48,10 +49,17 @@ typedef struct aeron_udp_transport_poller_stct
 #if defined(HAVE_EPOLL)
     int epoll_fd;
     struct epoll_event *epoll_events;
+#elif defined(HAVE_KQUEUE)
+    int kqueue_fd;
+    struct kevent *kevents;
 #elif defined(HAVE_POLL) || defined(HAVE_WSAPOLL)
     struct pollfd *pollfds;
 #endif
 
+    size_t iteration_threshold;
+    int busy_poll_us;
+    bool prefer_busy_poll;
+
     void *bindings_clientd;
 }
 aeron_udp_transport_poller_t;
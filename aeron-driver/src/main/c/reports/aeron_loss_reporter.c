@@ -83,8 +83,17 @@ extern void aeron_loss_reporter_record_observation(
     int64_t bytes_lost,
     int64_t timestamp_ms);
 
-size_t aeron_loss_reporter_read(
-    const uint8_t *buffer, size_t capacity, aeron_loss_reporter_read_entry_func_t entry_func, void *clientd)
+extern size_t aeron_loss_reporter_histogram_bucket(int64_t value, int shift);
+
+extern void aeron_loss_reporter_record_repair(
+    aeron_loss_reporter_t *reporter,
+    aeron_loss_reporter_entry_offset_t offset,
+    aeron_loss_reporter_repair_t repair,
+    int64_t gap_length,
+    int64_t repair_time_ns);
+
+size_t aeron_loss_reporter_read_full(
+    const uint8_t *buffer, size_t capacity, aeron_loss_reporter_read_full_entry_func_t entry_func, void *clientd)
 {
     size_t records_read = 0;
     size_t offset = 0;
@@ -113,18 +122,7 @@ size_t aeron_loss_reporter_read(
         ptr += sizeof(int32_t);
         const char *source = (const char *)ptr;
 
-        entry_func(
-            clientd,
-            entry->observation_count,
-            entry->total_bytes_lost,
-            entry->first_observation_timestamp,
-            entry->last_observation_timestamp,
-            entry->session_id,
-            entry->stream_id,
-            channel,
-            channel_length,
-            source,
-            source_length);
+        entry_func(clientd, entry, channel, channel_length, source, source_length);
 
         const size_t record_length =
             sizeof(aeron_loss_reporter_entry_t) + (2 * sizeof(int32_t)) + channel_length + source_length;
@@ -133,3 +131,42 @@ size_t aeron_loss_reporter_read(
 
     return records_read;
 }
+
+typedef struct aeron_loss_reporter_read_clientd_stct
+{
+    aeron_loss_reporter_read_entry_func_t entry_func;
+    void *clientd;
+}
+aeron_loss_reporter_read_clientd_t;
+
+static void aeron_loss_reporter_on_full_entry(
+    void *clientd,
+    const aeron_loss_reporter_entry_t *entry,
+    const char *channel,
+    int32_t channel_length,
+    const char *source,
+    int32_t source_length)
+{
+    aeron_loss_reporter_read_clientd_t *read_clientd = (aeron_loss_reporter_read_clientd_t *)clientd;
+
+    read_clientd->entry_func(
+        read_clientd->clientd,
+        entry->observation_count,
+        entry->total_bytes_lost,
+        entry->first_observation_timestamp,
+        entry->last_observation_timestamp,
+        entry->session_id,
+        entry->stream_id,
+        channel,
+        channel_length,
+        source,
+        source_length);
+}
+
+size_t aeron_loss_reporter_read(
+    const uint8_t *buffer, size_t capacity, aeron_loss_reporter_read_entry_func_t entry_func, void *clientd)
+{
+    aeron_loss_reporter_read_clientd_t read_clientd = { entry_func, clientd };
+
+    return aeron_loss_reporter_read_full(buffer, capacity, aeron_loss_reporter_on_full_entry, &read_clientd);
+}
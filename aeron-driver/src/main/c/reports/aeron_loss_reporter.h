@@ -24,6 +24,29 @@
 #include "util/aeron_error.h"
 #include "util/aeron_bitutil.h"
 
+#define AERON_LOSS_REPORTER_HISTOGRAM_BUCKETS (16)
+#define AERON_LOSS_REPORTER_GAP_LENGTH_BUCKET_SHIFT (5)
+#define AERON_LOSS_REPORTER_REPAIR_TIME_US_BUCKET_SHIFT (3)
+
+/*
+ * How a gap came to be filled: by a retransmit after it was NAKed, before any NAK went out, e.g. by reordering or FEC
+ * recovery, or by giving up on it and filling it with padding once its NAK delay expired on an unreliable image.
+ */
+typedef enum aeron_loss_reporter_repair_enum
+{
+    AERON_LOSS_REPORTER_REPAIR_RETRANSMIT = 0,
+    AERON_LOSS_REPORTER_REPAIR_UNSOLICITED = 1,
+    AERON_LOSS_REPORTER_REPAIR_TIMEOUT = 2
+}
+aeron_loss_reporter_repair_t;
+
+#define AERON_LOSS_REPORTER_REPAIR_TYPE_COUNT (3)
+
+/*
+ * Bucket i of the gap length histogram counts gaps of [32 << i, 64 << i) bytes and bucket i of the repair time
+ * histogram repairs taking [8 << i, 16 << i) microseconds, with the first buckets taking anything shorter and the last
+ * anything longer.
+ */
 #pragma pack(push)
 #pragma pack(4)
 typedef struct aeron_loss_reporter_entry_stct
@@ -34,6 +57,9 @@ typedef struct aeron_loss_reporter_entry_stct
     int64_t first_observation_timestamp;
     int32_t session_id;
     int32_t stream_id;
+    int64_t repair_counts[AERON_LOSS_REPORTER_REPAIR_TYPE_COUNT];
+    int64_t gap_length_histogram[AERON_LOSS_REPORTER_HISTOGRAM_BUCKETS];
+    int64_t repair_time_histogram[AERON_LOSS_REPORTER_HISTOGRAM_BUCKETS];
 }
 aeron_loss_reporter_entry_t;
 #pragma pack(pop)
@@ -81,6 +107,48 @@ inline void aeron_loss_reporter_record_observation(
     }
 }
 
+inline size_t aeron_loss_reporter_histogram_bucket(int64_t value, int shift)
+{
+    if (value < (INT64_C(2) << shift))
+    {
+        return 0;
+    }
+
+    const int64_t max_value = INT64_C(1) << (shift + AERON_LOSS_REPORTER_HISTOGRAM_BUCKETS - 1);
+    if (value >= max_value)
+    {
+        return AERON_LOSS_REPORTER_HISTOGRAM_BUCKETS - 1;
+    }
+
+    return (size_t)(31 - aeron_number_of_leading_zeroes((int32_t)value) - shift);
+}
+
+/*
+ * Record how a gap was repaired, its length and the time from it being detected to it being filled.
+ */
+inline void aeron_loss_reporter_record_repair(
+    aeron_loss_reporter_t *reporter,
+    aeron_loss_reporter_entry_offset_t offset,
+    aeron_loss_reporter_repair_t repair,
+    int64_t gap_length,
+    int64_t repair_time_ns)
+{
+    if (offset >= 0)
+    {
+        uint8_t *ptr = reporter->buffer + offset;
+        aeron_loss_reporter_entry_t *entry = (aeron_loss_reporter_entry_t *)ptr;
+        const size_t length_bucket = aeron_loss_reporter_histogram_bucket(
+            gap_length, AERON_LOSS_REPORTER_GAP_LENGTH_BUCKET_SHIFT);
+        const size_t time_bucket = aeron_loss_reporter_histogram_bucket(
+            repair_time_ns / 1000, AERON_LOSS_REPORTER_REPAIR_TIME_US_BUCKET_SHIFT);
+        int64_t dest;
+
+        AERON_GET_AND_ADD_INT64(dest, entry->gap_length_histogram[length_bucket], 1);
+        AERON_GET_AND_ADD_INT64(dest, entry->repair_time_histogram[time_bucket], 1);
+        AERON_GET_AND_ADD_INT64(dest, entry->repair_counts[repair], 1);
+    }
+}
+
 typedef void (*aeron_loss_reporter_read_entry_func_t)(
     void *clientd,
     int64_t observation_count,
@@ -97,4 +165,19 @@ typedef void (*aeron_loss_reporter_read_entry_func_t)(
 size_t aeron_loss_reporter_read(
     const uint8_t *buffer, size_t capacity, aeron_loss_reporter_read_entry_func_t entry_func, void *clientd);
 
+typedef void (*aeron_loss_reporter_read_full_entry_func_t)(
+    void *clientd,
+    const aeron_loss_reporter_entry_t *entry,
+    const char *channel,
+    int32_t channel_length,
+    const char *source,
+    int32_t source_length);
+
+/*
+ * Read entries including their repair counts and histograms, which are updated concurrently so are only consistent
+ * with each other to within the observations in flight.
+ */
+size_t aeron_loss_reporter_read_full(
+    const uint8_t *buffer, size_t capacity, aeron_loss_reporter_read_full_entry_func_t entry_func, void *clientd);
+
 #endif //AERON_LOSS_REPORTER_H
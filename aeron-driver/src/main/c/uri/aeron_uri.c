@@ -340,6 +340,12 @@ int aeron_uri_get_term_length_param(aeron_uri_params_t *uri_params, aeron_uri_pu
     {
         uint64_t value;
 
+        if (strcmp(value_str, AERON_URI_TERM_LENGTH_AUTO_VALUE) == 0)
+        {
+            params->is_term_length_auto = true;
+            return 0;
+        }
+
         if (-1 == aeron_parse_size64(value_str, &value))
         {
             aeron_set_err(EINVAL, "could not parse %s=%s in URI", AERON_URI_TERM_LENGTH_KEY, value_str);
@@ -357,6 +363,28 @@ int aeron_uri_get_term_length_param(aeron_uri_params_t *uri_params, aeron_uri_pu
     return 0;
 }
 
+int aeron_uri_get_numa_node_param(aeron_uri_params_t *uri_params, int32_t *numa_node)
+{
+    const char *value_str;
+
+    if ((value_str = aeron_uri_find_param_value(uri_params, AERON_URI_NUMA_KEY)) != NULL)
+    {
+        errno = 0;
+        char *end_ptr = NULL;
+        const long value = strtol(value_str, &end_ptr, 10);
+
+        if (0 != errno || end_ptr == value_str || '\0' != *end_ptr || value < 0 || value >= AERON_NUMA_NODE_MAX)
+        {
+            aeron_set_err(EINVAL, "could not parse %s=%s in URI", AERON_URI_NUMA_KEY, value_str);
+            return -1;
+        }
+
+        *numa_node = (int32_t)value;
+    }
+
+    return 0;
+}
+
 int aeron_uri_get_mtu_length_param(aeron_uri_params_t *uri_params, aeron_uri_publication_params_t *params)
 {
     const char *value_str;
@@ -382,6 +410,43 @@ int aeron_uri_get_mtu_length_param(aeron_uri_params_t *uri_params, aeron_uri_pub
     return 0;
 }
 
+int aeron_uri_pacing_params(aeron_uri_params_t *uri_params, aeron_uri_publication_params_t *params)
+{
+    const char *value_str;
+
+    if ((value_str = aeron_uri_find_param_value(uri_params, AERON_URI_PACING_RATE_KEY)) != NULL)
+    {
+        uint64_t value;
+
+        if (-1 == aeron_parse_size64(value_str, &value))
+        {
+            aeron_set_err(EINVAL, "could not parse %s=%s in URI", AERON_URI_PACING_RATE_KEY, value_str);
+            return -1;
+        }
+
+        params->pacing_rate = value;
+    }
+
+    if ((value_str = aeron_uri_find_param_value(uri_params, AERON_URI_PACING_MODE_KEY)) != NULL)
+    {
+        if (strcmp(value_str, AERON_URI_PACING_MODE_TXTIME_VALUE) == 0)
+        {
+            params->pacing_txtime = true;
+        }
+        else if (strcmp(value_str, AERON_URI_PACING_MODE_BUCKET_VALUE) == 0)
+        {
+            params->pacing_txtime = false;
+        }
+        else
+        {
+            aeron_set_err(EINVAL, "unknown %s=%s in URI", AERON_URI_PACING_MODE_KEY, value_str);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
 int aeron_uri_linger_timeout_param(aeron_uri_params_t *uri_params, aeron_uri_publication_params_t *params)
 {
     const char *value_str;
@@ -433,6 +498,31 @@ int aeron_uri_get_int32(aeron_uri_params_t *uri_params, const char *key, int32_t
     return 1;
 }
 
+int aeron_uri_weight_param(aeron_uri_params_t *uri_params, aeron_uri_publication_params_t *params)
+{
+    int32_t value;
+    int result = aeron_uri_get_int32(uri_params, AERON_URI_WEIGHT_KEY, &value);
+
+    if (result < 0)
+    {
+        return -1;
+    }
+
+    if (result > 0)
+    {
+        if (value < 1 || AERON_URI_WEIGHT_MAX < value)
+        {
+            aeron_set_err(
+                EINVAL, "%s=%" PRId32 " must be in the range 1 to %d", AERON_URI_WEIGHT_KEY, value, AERON_URI_WEIGHT_MAX);
+            return -1;
+        }
+
+        params->weight = value;
+    }
+
+    return 0;
+}
+
 int aeron_uri_get_int64(aeron_uri_params_t *uri_params, const char *key, int64_t *retval)
 {
     const char *value_str;
@@ -571,17 +661,27 @@ int aeron_uri_publication_params(
 
     params->linger_timeout_ns = context->publication_linger_timeout_ns;
     params->term_length = AERON_URI_IPC == uri->type ? context->ipc_term_buffer_length : context->term_buffer_length;
+    params->is_term_length_auto = false;
     params->mtu_length = AERON_URI_IPC == uri->type ? context->ipc_mtu_length : context->mtu_length;
     params->initial_term_id = 0;
     params->term_offset = 0;
     params->term_id = 0;
     params->has_position = false;
     params->is_sparse = context->term_buffer_sparse_file;
+    params->is_huge_pages = context->term_buffer_huge_pages;
+    params->numa_node = context->term_buffer_numa_node;
     params->signal_eos = true;
     params->spies_simulate_connection = context->spies_simulate_connection;
     params->has_session_id = false;
     params->session_id = 0;
     params->entity_tag = AERON_URI_INVALID_TAG;
+    params->pacing_rate = 0;
+    params->pacing_txtime = true;
+    params->checksum = false;
+    params->is_inline_send = false;
+    params->retain_history = false;
+    params->is_offer_stats = false;
+    params->weight = 0;
 
     aeron_uri_params_t *uri_params = AERON_URI_IPC == uri->type ?
         &uri->params.ipc.additional_params : &uri->params.udp.additional_params;
@@ -621,6 +721,50 @@ int aeron_uri_publication_params(
         return -1;
     }
 
+    if (AERON_URI_UDP == uri->type && aeron_uri_pacing_params(uri_params, params) < 0)
+    {
+        return -1;
+    }
+
+    if (AERON_URI_UDP == uri->type && aeron_uri_get_bool(uri_params, AERON_URI_CHECKSUM_KEY, &params->checksum) < 0)
+    {
+        return -1;
+    }
+
+    if (AERON_URI_UDP == uri->type && aeron_uri_weight_param(uri_params, params) < 0)
+    {
+        return -1;
+    }
+
+    if (AERON_URI_UDP == uri->type &&
+        aeron_uri_get_bool(uri_params, AERON_URI_INLINE_SEND_KEY, &params->is_inline_send) < 0)
+    {
+        return -1;
+    }
+
+    if (params->is_inline_send && !is_exclusive)
+    {
+        aeron_set_err(EINVAL, "param: %s is only supported for exclusive publications", AERON_URI_INLINE_SEND_KEY);
+        return -1;
+    }
+
+    if (params->is_inline_send && params->checksum)
+    {
+        aeron_set_err(
+            EINVAL, "params: %s and %s can not be combined", AERON_URI_INLINE_SEND_KEY, AERON_URI_CHECKSUM_KEY);
+        return -1;
+    }
+
+    if (aeron_uri_get_bool(uri_params, AERON_URI_HISTORY_KEY, &params->retain_history) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_uri_get_bool(uri_params, AERON_URI_OFFER_STATS_KEY, &params->is_offer_stats) < 0)
+    {
+        return -1;
+    }
+
     int count = 0;
 
     int32_t initial_term_id;
@@ -719,6 +863,16 @@ int aeron_uri_publication_params(
         return -1;
     }
 
+    if (aeron_uri_get_bool(uri_params, AERON_URI_HUGE_PAGES_KEY, &params->is_huge_pages) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_uri_get_numa_node_param(uri_params, &params->numa_node) < 0)
+    {
+        return -1;
+    }
+
     if (aeron_uri_get_bool(uri_params, AERON_URI_EOS_KEY, &params->signal_eos) < 0)
     {
         return -1;
@@ -739,8 +893,14 @@ int aeron_uri_subscription_params(
 
     params->is_reliable = context->reliable_stream;
     params->is_sparse = context->term_buffer_sparse_file;
+    params->is_huge_pages = context->term_buffer_huge_pages;
+    params->numa_node = context->term_buffer_numa_node;
     params->is_tether = context->tether_subscriptions;
+    params->is_observer = false;
     params->is_rejoin = context->rejoin_stream;
+    params->is_readiness_tracked = false;
+    params->is_inline_receive = false;
+    params->is_join_history = false;
 
     aeron_uri_params_t *uri_params = AERON_URI_IPC == uri->type ?
         &uri->params.ipc.additional_params : &uri->params.udp.additional_params;
@@ -755,16 +915,46 @@ int aeron_uri_subscription_params(
         return -1;
     }
 
+    if (aeron_uri_get_bool(uri_params, AERON_URI_HUGE_PAGES_KEY, &params->is_huge_pages) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_uri_get_numa_node_param(uri_params, &params->numa_node) < 0)
+    {
+        return -1;
+    }
+
     if (aeron_uri_get_bool(uri_params, AERON_URI_TETHER_KEY, &params->is_tether) < 0)
     {
         return -1;
     }
 
+    if (aeron_uri_get_bool(uri_params, AERON_URI_OBSERVER_KEY, &params->is_observer) < 0)
+    {
+        return -1;
+    }
+
+    if (params->is_observer)
+    {
+        params->is_tether = false;
+    }
+
     if (aeron_uri_get_bool(uri_params, AERON_URI_REJOIN_KEY, &params->is_rejoin) < 0)
     {
         return -1;
     }
 
+    if (aeron_uri_get_bool(uri_params, AERON_URI_READINESS_KEY, &params->is_readiness_tracked) < 0)
+    {
+        return -1;
+    }
+
+    if (aeron_uri_get_bool(uri_params, AERON_URI_JOIN_HISTORY_KEY, &params->is_join_history) < 0)
+    {
+        return -1;
+    }
+
     params->group = aeron_config_parse_inferable_boolean(
         aeron_uri_find_param_value(uri_params, AERON_URI_GROUP_KEY), context->receiver_group_consideration);
 
@@ -773,6 +963,23 @@ int aeron_uri_subscription_params(
         return -1;
     }
 
+    if (AERON_URI_UDP == uri->type &&
+        aeron_uri_get_bool(uri_params, AERON_URI_INLINE_RECEIVE_KEY, &params->is_inline_receive) < 0)
+    {
+        return -1;
+    }
+
+    if (params->is_inline_receive && (params->has_session_id || params->is_observer))
+    {
+        aeron_set_err(
+            EINVAL,
+            "param: %s can not be combined with %s or %s",
+            AERON_URI_INLINE_RECEIVE_KEY,
+            AERON_URI_SESSION_ID_KEY,
+            AERON_URI_OBSERVER_KEY);
+        return -1;
+    }
+
     return 0;
 }
 
@@ -52,8 +52,11 @@ aeron_uri_params_t;
 #define AERON_URI_LINGER_TIMEOUT_KEY "linger"
 #define AERON_URI_MTU_LENGTH_KEY "mtu"
 #define AERON_URI_SPARSE_TERM_KEY "sparse"
+#define AERON_URI_HUGE_PAGES_KEY "huge-pages"
+#define AERON_URI_NUMA_KEY "numa"
 #define AERON_URI_EOS_KEY "eos"
 #define AERON_URI_TETHER_KEY "tether"
+#define AERON_URI_OBSERVER_KEY "observer"
 #define AERON_URI_TAGS_KEY "tags"
 #define AERON_URI_SESSION_ID_KEY "session-id"
 #define AERON_URI_GROUP_KEY "group"
@@ -63,15 +66,40 @@ aeron_uri_params_t;
 #define AERON_URI_CC_KEY "cc"
 #define AERON_URI_SPIES_SIMULATE_CONNECTION_KEY "ssc"
 #define AERON_URI_ATS_KEY "ats"
+#define AERON_URI_FANOUT_KEY "fanout"
+#define AERON_URI_FANOUT_STEERING_KEY "fanout-steering"
+#define AERON_URI_FANOUT_STEERING_SESSION_VALUE "session"
+#define AERON_URI_PACING_RATE_KEY "pacing-rate"
+#define AERON_URI_PACING_MODE_KEY "pacing-mode"
+#define AERON_URI_PACING_MODE_TXTIME_VALUE "txtime"
+#define AERON_URI_PACING_MODE_BUCKET_VALUE "bucket"
+#define AERON_URI_CHECKSUM_KEY "checksum"
+#define AERON_URI_WEIGHT_KEY "weight"
+#define AERON_URI_DSCP_KEY "dscp"
+#define AERON_URI_DSCP_MAX (63)
+#define AERON_URI_STRIPE_KEY "stripe"
+#define AERON_URI_TERM_LENGTH_AUTO_VALUE "auto"
+#define AERON_URI_WEIGHT_MAX (1024)
+#define AERON_URI_COMPRESS_KEY "compress"
+#define AERON_URI_COMPRESS_LZ4_VALUE "lz4"
+#define AERON_URI_READINESS_KEY "readiness"
+#define AERON_URI_INLINE_SEND_KEY "inline-send"
+#define AERON_URI_INLINE_RECEIVE_KEY "inline-receive"
+#define AERON_URI_HISTORY_KEY "history"
+#define AERON_URI_JOIN_HISTORY_KEY "join-history"
+#define AERON_URI_OFFER_STATS_KEY "offer-stats"
 
 typedef struct aeron_uri_publication_params_stct
 {
     bool has_position;
     bool is_sparse;
+    bool is_huge_pages;
+    int32_t numa_node;
     bool signal_eos;
     bool spies_simulate_connection;
     size_t mtu_length;
     size_t term_length;
+    bool is_term_length_auto;
     size_t term_offset;
     int32_t initial_term_id;
     int32_t term_id;
@@ -79,6 +107,13 @@ typedef struct aeron_uri_publication_params_stct
     bool has_session_id;
     int32_t session_id;
     int64_t entity_tag;
+    uint64_t pacing_rate;
+    bool pacing_txtime;
+    bool checksum;
+    bool is_inline_send;
+    bool retain_history;
+    bool is_offer_stats;
+    int32_t weight;
 }
 aeron_uri_publication_params_t;
 
@@ -86,11 +121,17 @@ typedef struct aeron_uri_subscription_params_stct
 {
     bool is_reliable;
     bool is_sparse;
+    bool is_huge_pages;
+    int32_t numa_node;
     bool is_tether;
+    bool is_observer;
     bool is_rejoin;
+    bool is_readiness_tracked;
     aeron_inferable_boolean_t group;
     bool has_session_id;
     int32_t session_id;
+    bool is_inline_receive;
+    bool is_join_history;
 }
 aeron_uri_subscription_params_t;
 
@@ -157,6 +198,7 @@ void aeron_uri_close(aeron_uri_t *params);
 uint8_t aeron_uri_multicast_ttl(aeron_uri_t *uri);
 
 const char *aeron_uri_find_param_value(const aeron_uri_params_t *uri_params, const char *key);
+int aeron_uri_get_int32(aeron_uri_params_t *uri_params, const char *key, int32_t *retval);
 int aeron_uri_get_int64(aeron_uri_params_t *uri_params, const char *key, int64_t *retval);
 int aeron_uri_get_bool(aeron_uri_params_t *uri_params, const char *key, bool *retval);
 int aeron_uri_get_ats(aeron_uri_params_t *uri_params, aeron_uri_ats_status_t *uri_ats_status);
@@ -26,6 +26,7 @@
 #endif
 #endif
 
+#include <cstring>
 #include <string>
 #include <thread>
 #include <atomic>
@@ -42,7 +43,7 @@ class EmbeddedMediaDriver
 public:
     EmbeddedMediaDriver() = default;
 
-    ~EmbeddedMediaDriver()
+    virtual ~EmbeddedMediaDriver()
     {
         aeron_driver_close(m_driver);
         aeron_driver_context_close(m_context);
@@ -110,6 +111,7 @@ protected:
         aeron_driver_context_set_term_buffer_length(m_context, 64 * 1024);
         aeron_driver_context_set_driver_termination_validator(m_context, validateTermination, nullptr);
         aeron_driver_context_set_driver_termination_hook(m_context, terminationHook, this);
+        configure(m_context);
 
         if (aeron_driver_init(&m_driver, m_context) < 0)
         {
@@ -126,6 +128,13 @@ protected:
         return 0;
     }
 
+    /**
+     * Override to change the driver context after the defaults above are applied and before the driver is started.
+     */
+    virtual void configure(aeron_driver_context_t *context)
+    {
+    }
+
 private:
     std::atomic<bool> m_running = { true };
     std::thread m_thread;
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "aeron_async_name_resolver.h"
+#include "media/aeron_udp_channel.h"
+}
+
+class AsyncNameResolverTest : public testing::Test
+{
+public:
+    void SetUp() override
+    {
+        ASSERT_EQ(0, aeron_async_name_resolver_init(&m_resolver, nullptr));
+    }
+
+    void TearDown() override
+    {
+        aeron_async_name_resolver_on_close(&m_resolver);
+    }
+
+    static void onResolution(void *clientd, aeron_async_name_resolution_t *resolution)
+    {
+        auto *test = static_cast<AsyncNameResolverTest *>(clientd);
+        test->m_result = resolution->result;
+        test->m_endpoint = resolution->endpoint;
+        memcpy(&test->m_resolved_addr, &resolution->resolved_addr, sizeof(test->m_resolved_addr));
+    }
+
+protected:
+    aeron_async_name_resolver_t m_resolver = {};
+    struct sockaddr_storage m_existing_addr = {};
+    struct sockaddr_storage m_resolved_addr = {};
+    void *m_endpoint = nullptr;
+    int m_result = 0;
+};
+
+TEST_F(AsyncNameResolverTest, shouldResolveOnDoWorkAndCompleteOnPoll)
+{
+    int endpoint = 0;
+    ASSERT_EQ(0, aeron_async_name_resolver_offer(
+        &m_resolver, "127.0.0.1:40123", AERON_UDP_CHANNEL_ENDPOINT_KEY, false, &endpoint, nullptr, &m_existing_addr));
+
+    EXPECT_EQ(0, aeron_async_name_resolver_poll(&m_resolver, onResolution, this, 10));
+    EXPECT_EQ(1, aeron_async_name_resolver_do_work(&m_resolver));
+    EXPECT_EQ(0, aeron_async_name_resolver_do_work(&m_resolver));
+    EXPECT_EQ(1, aeron_async_name_resolver_poll(&m_resolver, onResolution, this, 10));
+
+    EXPECT_EQ(0, m_result);
+    EXPECT_EQ(&endpoint, m_endpoint);
+    ASSERT_EQ(AF_INET, m_resolved_addr.ss_family);
+    auto *addr = (struct sockaddr_in *)&m_resolved_addr;
+    EXPECT_EQ(htonl(INADDR_LOOPBACK), addr->sin_addr.s_addr);
+    EXPECT_EQ(htons(40123), addr->sin_port);
+}
+
+TEST_F(AsyncNameResolverTest, shouldCompleteWithErrorForUnresolvableName)
+{
+    ASSERT_EQ(0, aeron_async_name_resolver_offer(
+        &m_resolver, "no.such.host.invalid:40123", AERON_UDP_CHANNEL_ENDPOINT_KEY, false, nullptr, nullptr,
+        &m_existing_addr));
+
+    EXPECT_EQ(1, aeron_async_name_resolver_do_work(&m_resolver));
+    EXPECT_EQ(1, aeron_async_name_resolver_poll(&m_resolver, onResolution, this, 10));
+    EXPECT_EQ(-1, m_result);
+}
+
+TEST_F(AsyncNameResolverTest, shouldHoldCompletionWhenCompletionQueueIsFull)
+{
+    for (int i = 0; i <= AERON_ASYNC_NAME_RESOLVER_QUEUE_CAPACITY; i++)
+    {
+        ASSERT_EQ(0, aeron_async_name_resolver_offer(
+            &m_resolver, "127.0.0.1:40123", AERON_UDP_CHANNEL_ENDPOINT_KEY, false, nullptr, nullptr,
+            &m_existing_addr));
+
+        if (i < AERON_ASYNC_NAME_RESOLVER_QUEUE_CAPACITY)
+        {
+            ASSERT_EQ(1, aeron_async_name_resolver_do_work(&m_resolver));
+        }
+    }
+
+    EXPECT_EQ(0, aeron_async_name_resolver_do_work(&m_resolver));
+    EXPECT_NE(nullptr, m_resolver.pending_completion);
+
+    EXPECT_EQ(1, aeron_async_name_resolver_poll(&m_resolver, onResolution, this, 1));
+    EXPECT_EQ(1, aeron_async_name_resolver_do_work(&m_resolver));
+    EXPECT_EQ(nullptr, m_resolver.pending_completion);
+    EXPECT_EQ(
+        AERON_ASYNC_NAME_RESOLVER_QUEUE_CAPACITY,
+        aeron_async_name_resolver_poll(&m_resolver, onResolution, this, AERON_ASYNC_NAME_RESOLVER_QUEUE_CAPACITY * 2));
+}
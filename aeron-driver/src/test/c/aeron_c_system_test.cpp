@@ -24,6 +24,12 @@ extern "C"
 {
 #include "concurrent/aeron_atomic.h"
 #include "aeronc.h"
+#include "aeron_common.h"
+#include "util/aeron_fileutil.h"
+#include "aeron_embedded_invoker.h"
+#include "aeron_exclusive_publication.h"
+#include "aeron_subscription.h"
+#include "concurrent/aeron_counters_manager.h"
 }
 
 #define PUB_URI "aeron:udp?endpoint=localhost:24325"
@@ -547,3 +553,683 @@ TEST_P(CSystemTest, shouldAllowImageToGoUnavailableWithPollAfter)
     EXPECT_EQ(aeron_subscription_close(subscription, nullptr, nullptr), 0);
 }
 
+
+class CSystemDirectedResponsesTest : public CSystemTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        setenv(AERON_CLIENT_DIRECTED_RESPONSES_ENABLED_ENV_VAR, "true", 1);
+        setenv(AERON_CLIENT_DIRECTED_RESPONSES_ENV_VAR, "true", 1);
+    }
+
+    static void TearDownTestSuite()
+    {
+        unsetenv(AERON_CLIENT_DIRECTED_RESPONSES_ENABLED_ENV_VAR);
+        unsetenv(AERON_CLIENT_DIRECTED_RESPONSES_ENV_VAR);
+    }
+};
+
+TEST_F(CSystemDirectedResponsesTest, shouldOfferAndPollOneMessageUsingDirectedResponses)
+{
+    aeron_async_add_publication_t *async_pub;
+    aeron_publication_t *publication;
+    aeron_async_add_subscription_t *async_sub;
+    aeron_subscription_t *subscription;
+    const char message[] = "message";
+
+    ASSERT_TRUE(connect());
+    ASSERT_EQ(aeron_async_add_publication(&async_pub, m_aeron, AERON_IPC_CHANNEL, STREAM_ID), 0);
+    ASSERT_TRUE((publication = awaitPublicationOrError(async_pub))) << aeron_errmsg();
+    ASSERT_EQ(aeron_async_add_subscription(
+        &async_sub, m_aeron, AERON_IPC_CHANNEL, STREAM_ID, nullptr, nullptr, nullptr, nullptr), 0);
+    ASSERT_TRUE((subscription = awaitSubscriptionOrError(async_sub))) << aeron_errmsg();
+    awaitConnected(subscription);
+
+    char path[AERON_MAX_PATH];
+    aeron_client_responses_location(path, sizeof(path), m_driver.directory(), aeron_client_id(m_aeron));
+    EXPECT_GT(aeron_file_length(path), 0);
+
+    while (aeron_publication_offer(
+        publication, (const uint8_t *)message, strlen(message), nullptr, nullptr) < 0)
+    {
+        std::this_thread::yield();
+    }
+
+    bool called = false;
+    poll_handler_t handler = [&](const uint8_t *buffer, size_t length, aeron_header_t *header)
+    {
+        EXPECT_EQ(length, strlen(message));
+        called = true;
+    };
+
+    while (0 == poll(subscription, handler, 1))
+    {
+        std::this_thread::yield();
+    }
+    EXPECT_TRUE(called);
+
+    EXPECT_EQ(aeron_publication_close(publication, nullptr, nullptr), 0);
+    EXPECT_EQ(aeron_subscription_close(subscription, nullptr, nullptr), 0);
+}
+
+class CSystemSharedConductorBudgetTest : public CSystemTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        setenv(AERON_SHARED_CONDUCTOR_BUDGET_ENV_VAR, "100us", 1);
+    }
+
+    static void TearDownTestSuite()
+    {
+        unsetenv(AERON_SHARED_CONDUCTOR_BUDGET_ENV_VAR);
+    }
+};
+
+TEST_F(CSystemSharedConductorBudgetTest, shouldOfferAndPollMessagesWithConductorDeferred)
+{
+    aeron_async_add_publication_t *async_pub;
+    aeron_publication_t *publication;
+    aeron_async_add_subscription_t *async_sub;
+    aeron_subscription_t *subscription;
+    const char message[] = "message";
+    const int message_count = 100;
+
+    ASSERT_TRUE(connect());
+    ASSERT_EQ(aeron_async_add_publication(&async_pub, m_aeron, PUB_URI, STREAM_ID), 0);
+    ASSERT_TRUE((publication = awaitPublicationOrError(async_pub))) << aeron_errmsg();
+    ASSERT_EQ(aeron_async_add_subscription(
+        &async_sub, m_aeron, PUB_URI, STREAM_ID, nullptr, nullptr, nullptr, nullptr), 0);
+    ASSERT_TRUE((subscription = awaitSubscriptionOrError(async_sub))) << aeron_errmsg();
+    awaitConnected(subscription);
+
+    int received = 0;
+    poll_handler_t handler = [&](const uint8_t *buffer, size_t length, aeron_header_t *header)
+    {
+        EXPECT_EQ(length, strlen(message));
+        received++;
+    };
+
+    for (int i = 0; i < message_count; i++)
+    {
+        while (aeron_publication_offer(
+            publication, (const uint8_t *)message, strlen(message), nullptr, nullptr) < 0)
+        {
+            poll(subscription, handler, 10);
+            std::this_thread::yield();
+        }
+    }
+
+    while (received < message_count)
+    {
+        if (0 == poll(subscription, handler, 10))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    EXPECT_EQ(received, message_count);
+    EXPECT_EQ(aeron_publication_close(publication, nullptr, nullptr), 0);
+    EXPECT_EQ(aeron_subscription_close(subscription, nullptr, nullptr), 0);
+}
+
+class CSystemInlineSendTest : public CSystemTest
+{
+};
+
+#define INLINE_SEND_URI PUB_URI "|inline-send=true"
+
+TEST_F(CSystemInlineSendTest, shouldRejectInlineSendOnConcurrentPublication)
+{
+    aeron_async_add_publication_t *async_pub;
+
+    ASSERT_TRUE(connect());
+    ASSERT_EQ(aeron_async_add_publication(&async_pub, m_aeron, INLINE_SEND_URI, STREAM_ID), 0);
+    ASSERT_EQ(nullptr, awaitPublicationOrError(async_pub));
+}
+
+TEST_F(CSystemInlineSendTest, shouldOfferAndPollMessagesSentInline)
+{
+    aeron_async_add_exclusive_publication_t *async_pub;
+    aeron_exclusive_publication_t *publication;
+    aeron_async_add_subscription_t *async_sub;
+    aeron_subscription_t *subscription;
+    const char message[] = "message";
+    const int message_count = 100;
+
+    ASSERT_TRUE(connect());
+    ASSERT_EQ(aeron_async_add_exclusive_publication(&async_pub, m_aeron, INLINE_SEND_URI, STREAM_ID), 0);
+    ASSERT_TRUE((publication = awaitExclusivePublicationOrError(async_pub))) << aeron_errmsg();
+    ASSERT_NE(nullptr, publication->inline_send.position);
+    ASSERT_EQ(aeron_async_add_subscription(
+        &async_sub, m_aeron, PUB_URI, STREAM_ID, nullptr, nullptr, nullptr, nullptr), 0);
+    ASSERT_TRUE((subscription = awaitSubscriptionOrError(async_sub))) << aeron_errmsg();
+    awaitConnected(subscription);
+
+    int received = 0;
+    poll_handler_t handler = [&](const uint8_t *buffer, size_t length, aeron_header_t *header)
+    {
+        EXPECT_EQ(length, strlen(message));
+        received++;
+    };
+
+    for (int i = 0; i < message_count; i++)
+    {
+        while (aeron_exclusive_publication_offer(
+            publication, (const uint8_t *)message, strlen(message), nullptr, nullptr) < 0)
+        {
+            poll(subscription, handler, 10);
+            std::this_thread::yield();
+        }
+    }
+
+    while (received < message_count)
+    {
+        if (0 == poll(subscription, handler, 10))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    EXPECT_EQ(received, message_count);
+    EXPECT_GE(*publication->inline_send.position, aeron_exclusive_publication_position(publication));
+    EXPECT_EQ(aeron_exclusive_publication_close(publication, nullptr, nullptr), 0);
+    EXPECT_EQ(aeron_subscription_close(subscription, nullptr, nullptr), 0);
+}
+
+class CSystemInlineReceiveTest : public CSystemTest
+{
+};
+
+#define INLINE_RECEIVE_URI PUB_URI "|inline-receive=true"
+
+TEST_F(CSystemInlineReceiveTest, shouldRejectSecondSubscriptionToInlineReceiveStream)
+{
+    aeron_async_add_subscription_t *async_sub;
+    aeron_subscription_t *subscription;
+
+    ASSERT_TRUE(connect());
+    ASSERT_EQ(aeron_async_add_subscription(
+        &async_sub, m_aeron, INLINE_RECEIVE_URI, STREAM_ID, nullptr, nullptr, nullptr, nullptr), 0);
+    ASSERT_TRUE((subscription = awaitSubscriptionOrError(async_sub))) << aeron_errmsg();
+
+    ASSERT_EQ(aeron_async_add_subscription(
+        &async_sub, m_aeron, PUB_URI, STREAM_ID, nullptr, nullptr, nullptr, nullptr), 0);
+    ASSERT_EQ(nullptr, awaitSubscriptionOrError(async_sub));
+
+    EXPECT_EQ(aeron_subscription_close(subscription, nullptr, nullptr), 0);
+}
+
+TEST_F(CSystemInlineReceiveTest, shouldPollMessagesReceivedInline)
+{
+    aeron_async_add_publication_t *async_pub;
+    aeron_publication_t *publication;
+    aeron_async_add_subscription_t *async_sub;
+    aeron_subscription_t *subscription;
+    const char message[] = "message";
+    const int message_count = 100;
+
+    ASSERT_TRUE(connect());
+    ASSERT_EQ(aeron_async_add_subscription(
+        &async_sub, m_aeron, INLINE_RECEIVE_URI, STREAM_ID, nullptr, nullptr, nullptr, nullptr), 0);
+    ASSERT_TRUE((subscription = awaitSubscriptionOrError(async_sub))) << aeron_errmsg();
+    ASSERT_NE(-1, subscription->inline_receive.fd);
+    ASSERT_EQ(aeron_async_add_publication(&async_pub, m_aeron, PUB_URI, STREAM_ID), 0);
+    ASSERT_TRUE((publication = awaitPublicationOrError(async_pub))) << aeron_errmsg();
+    awaitConnected(subscription);
+
+    int received = 0;
+    poll_handler_t handler = [&](const uint8_t *buffer, size_t length, aeron_header_t *header)
+    {
+        EXPECT_EQ(length, strlen(message));
+        received++;
+    };
+
+    for (int i = 0; i < message_count; i++)
+    {
+        while (aeron_publication_offer(publication, (const uint8_t *)message, strlen(message), nullptr, nullptr) < 0)
+        {
+            poll(subscription, handler, 10);
+            std::this_thread::yield();
+        }
+    }
+
+    while (received < message_count)
+    {
+        if (0 == poll(subscription, handler, 10))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    EXPECT_EQ(received, message_count);
+    EXPECT_GT(*subscription->inline_receive.bytes_received, 0);
+    EXPECT_EQ(aeron_publication_close(publication, nullptr, nullptr), 0);
+    EXPECT_EQ(aeron_subscription_close(subscription, nullptr, nullptr), 0);
+}
+
+class CSystemJoinHistoryTest : public CSystemTest
+{
+public:
+    aeron_subscription_t *addSubscription(const char *uri)
+    {
+        aeron_async_add_subscription_t *async_sub;
+
+        if (aeron_async_add_subscription(&async_sub, m_aeron, uri, STREAM_ID, nullptr, nullptr, nullptr, nullptr) < 0)
+        {
+            return nullptr;
+        }
+
+        return awaitSubscriptionOrError(async_sub);
+    }
+};
+
+#define HISTORY_TERM_LENGTH (64 * 1024)
+#define HISTORY_PUB_URI "aeron:ipc?term-length=64k|history=true"
+#define HISTORY_SUB_URI "aeron:ipc?join-history=true"
+
+TEST_F(CSystemJoinHistoryTest, shouldJoinIpcPublicationWithRetainedHistory)
+{
+    aeron_async_add_publication_t *async_pub;
+    aeron_publication_t *publication;
+    aeron_subscription_t *live_subscription;
+    aeron_subscription_t *late_subscription;
+    aeron_subscription_t *history_subscription;
+    uint8_t message[1000] = { 0 };
+    const int message_count = 4 * HISTORY_TERM_LENGTH / 1024;
+
+    ASSERT_TRUE(connect());
+    ASSERT_EQ(aeron_async_add_publication(&async_pub, m_aeron, HISTORY_PUB_URI, STREAM_ID), 0);
+    ASSERT_TRUE((publication = awaitPublicationOrError(async_pub))) << aeron_errmsg();
+    ASSERT_TRUE((live_subscription = addSubscription("aeron:ipc"))) << aeron_errmsg();
+    awaitConnected(live_subscription);
+
+    int received = 0;
+    poll_handler_t handler = [&](const uint8_t *buffer, size_t length, aeron_header_t *header)
+    {
+        EXPECT_EQ(length, sizeof(message));
+        received++;
+    };
+
+    for (int i = 0; i < message_count; i++)
+    {
+        while (aeron_publication_offer(publication, message, sizeof(message), nullptr, nullptr) < 0)
+        {
+            poll(live_subscription, handler, 10);
+            std::this_thread::yield();
+        }
+    }
+
+    while (received < message_count)
+    {
+        if (0 == poll(live_subscription, handler, 10))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    const int64_t position = aeron_publication_position(publication);
+
+    ASSERT_TRUE((late_subscription = addSubscription("aeron:ipc"))) << aeron_errmsg();
+    awaitConnected(late_subscription);
+    EXPECT_EQ(aeron_image_position(aeron_subscription_image_at_index(late_subscription, 0)), position);
+
+    ASSERT_TRUE((history_subscription = addSubscription(HISTORY_SUB_URI))) << aeron_errmsg();
+    awaitConnected(history_subscription);
+    const int64_t join_position = aeron_image_position(aeron_subscription_image_at_index(history_subscription, 0));
+    EXPECT_EQ(join_position & (HISTORY_TERM_LENGTH - 1), 0);
+    EXPECT_LT(join_position, position);
+    EXPECT_GE(join_position, position - (2 * HISTORY_TERM_LENGTH));
+
+    received = 0;
+    int64_t history_position = join_position;
+    while (history_position < position)
+    {
+        if (0 == poll(history_subscription, handler, 10))
+        {
+            std::this_thread::yield();
+        }
+
+        history_position = aeron_image_position(aeron_subscription_image_at_index(history_subscription, 0));
+    }
+
+    EXPECT_EQ(history_position, position);
+    EXPECT_GT(received, 0);
+
+    EXPECT_EQ(aeron_publication_close(publication, nullptr, nullptr), 0);
+    EXPECT_EQ(aeron_subscription_close(live_subscription, nullptr, nullptr), 0);
+    EXPECT_EQ(aeron_subscription_close(late_subscription, nullptr, nullptr), 0);
+    EXPECT_EQ(aeron_subscription_close(history_subscription, nullptr, nullptr), 0);
+}
+
+class CSystemOfferStatsTest : public CSystemTest
+{
+public:
+    static int64_t offerCounterValue(aeron_counters_reader_t *counters_reader, const char *metric)
+    {
+        std::pair<std::string, int64_t> state(std::string(" ") + metric, -1);
+
+        aeron_counters_reader_foreach_counter(
+            counters_reader,
+            [](int64_t value, int32_t id, const char *label, size_t label_length, void *clientd)
+            {
+                auto *state = static_cast<std::pair<std::string, int64_t> *>(clientd);
+                const std::string counter_label(label, label_length);
+                const std::string &suffix = state->first;
+
+                if (0 == counter_label.rfind(AERON_COUNTER_PUBLICATION_OFFER_NAME, 0) &&
+                    counter_label.length() > suffix.length() &&
+                    0 == counter_label.compare(counter_label.length() - suffix.length(), suffix.length(), suffix))
+                {
+                    state->second = value;
+                }
+            },
+            &state);
+
+        return state.second;
+    }
+};
+
+TEST_F(CSystemOfferStatsTest, shouldCountOfferResultsAndBytes)
+{
+    aeron_async_add_publication_t *async_pub;
+    aeron_async_add_subscription_t *async_sub;
+    aeron_publication_t *publication;
+    aeron_subscription_t *subscription;
+    uint8_t message[100] = { 0 };
+    const int message_count = 10;
+
+    ASSERT_TRUE(connect());
+    ASSERT_EQ(aeron_async_add_publication(&async_pub, m_aeron, "aeron:ipc?offer-stats=true", STREAM_ID), 0);
+    ASSERT_TRUE((publication = awaitPublicationOrError(async_pub))) << aeron_errmsg();
+
+    aeron_counters_reader_t *counters_reader = aeron_counters_reader(m_aeron);
+    EXPECT_EQ(aeron_publication_offer(publication, message, sizeof(message), nullptr, nullptr),
+        AERON_PUBLICATION_NOT_CONNECTED);
+    EXPECT_EQ(offerCounterValue(counters_reader, "not-connected"), 1);
+
+    ASSERT_EQ(aeron_async_add_subscription(
+        &async_sub, m_aeron, "aeron:ipc", STREAM_ID, nullptr, nullptr, nullptr, nullptr), 0);
+    ASSERT_TRUE((subscription = awaitSubscriptionOrError(async_sub))) << aeron_errmsg();
+    awaitConnected(subscription);
+
+    int received = 0;
+    poll_handler_t handler = [&](const uint8_t *buffer, size_t length, aeron_header_t *header)
+    {
+        received++;
+    };
+
+    for (int i = 0; i < message_count; i++)
+    {
+        while (aeron_publication_offer(publication, message, sizeof(message), nullptr, nullptr) < 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    while (received < message_count)
+    {
+        if (0 == poll(subscription, handler, 10))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    const int64_t offered_bytes = offerCounterValue(counters_reader, "offered-bytes");
+    EXPECT_EQ(offerCounterValue(counters_reader, "accepted-bytes"), message_count * (int64_t)sizeof(message));
+    EXPECT_GE(offered_bytes, (message_count + 1) * (int64_t)sizeof(message));
+
+    EXPECT_EQ(aeron_publication_close(publication, nullptr, nullptr), 0);
+    EXPECT_EQ(aeron_subscription_close(subscription, nullptr, nullptr), 0);
+}
+
+class CSystemCounterLeaseTest : public CSystemTest
+{
+public:
+    static aeron_counter_lease_t *awaitCounterLeaseOrError(aeron_async_add_counter_lease_t *async)
+    {
+        aeron_counter_lease_t *lease = nullptr;
+
+        do
+        {
+            std::this_thread::yield();
+            if (aeron_async_add_counter_lease_poll(&lease, async) < 0)
+            {
+                return nullptr;
+            }
+        }
+        while (!lease);
+
+        return lease;
+    }
+
+    static std::string counterLabel(aeron_counters_reader_t *counters_reader, int32_t counter_id)
+    {
+        std::pair<int32_t, std::string> state(counter_id, "");
+
+        aeron_counters_reader_foreach_counter(
+            counters_reader,
+            [](int64_t value, int32_t id, const char *label, size_t label_length, void *clientd)
+            {
+                auto *state = static_cast<std::pair<int32_t, std::string> *>(clientd);
+                if (id == state->first)
+                {
+                    state->second = std::string(label, label_length);
+                }
+            },
+            &state);
+
+        return state.second;
+    }
+
+    std::atomic<int64_t> m_availableRegistrationId = { AERON_NULL_VALUE };
+    std::atomic<int64_t> m_unavailableRegistrationId = { AERON_NULL_VALUE };
+};
+
+TEST_F(CSystemCounterLeaseTest, shouldRejectLeaseLargerThanMaxLength)
+{
+    aeron_async_add_counter_lease_t *async;
+
+    ASSERT_TRUE(connect());
+    ASSERT_EQ(-1, aeron_async_add_counter_lease(&async, m_aeron, AERON_COUNTER_CLIENT_LEASE_MAX_LENGTH + 1));
+}
+
+TEST_F(CSystemCounterLeaseTest, shouldAllocateAndFreeCountersFromLease)
+{
+    std::atomic<bool> leaseClosedFlag(false);
+    aeron_async_add_counter_lease_t *async;
+    aeron_counter_lease_t *lease;
+    aeron_counter_constants_t constants[4];
+    aeron_counter_constants_t extra;
+    const char label[] = "leased counter";
+
+    ASSERT_TRUE(connect());
+
+    aeron_on_available_counter_pair_t available_pair =
+        {
+            [](void *clientd, aeron_counters_reader_t *reader, int64_t registration_id, int32_t counter_id)
+            {
+                static_cast<CSystemCounterLeaseTest *>(clientd)->m_availableRegistrationId = registration_id;
+            },
+            this
+        };
+    aeron_on_unavailable_counter_pair_t unavailable_pair =
+        {
+            [](void *clientd, aeron_counters_reader_t *reader, int64_t registration_id, int32_t counter_id)
+            {
+                static_cast<CSystemCounterLeaseTest *>(clientd)->m_unavailableRegistrationId = registration_id;
+            },
+            this
+        };
+    ASSERT_EQ(0, aeron_add_available_counter_handler(m_aeron, &available_pair));
+    ASSERT_EQ(0, aeron_add_unavailable_counter_handler(m_aeron, &unavailable_pair));
+
+    ASSERT_EQ(0, aeron_async_add_counter_lease(&async, m_aeron, 4));
+    ASSERT_TRUE((lease = awaitCounterLeaseOrError(async))) << aeron_errmsg();
+    ASSERT_EQ(4u, aeron_counter_lease_available(lease));
+
+    for (auto &constant : constants)
+    {
+        ASSERT_EQ(0, aeron_counter_lease_allocate(lease, 1001, nullptr, 0, label, strlen(label), &constant))
+            << aeron_errmsg();
+    }
+    EXPECT_EQ(0u, aeron_counter_lease_available(lease));
+    EXPECT_EQ(-1, aeron_counter_lease_allocate(lease, 1001, nullptr, 0, label, strlen(label), &extra));
+
+    aeron_counters_reader_t *counters_reader = aeron_counters_reader(m_aeron);
+    EXPECT_EQ(std::string(label), counterLabel(counters_reader, constants[3].counter_id));
+
+    while (constants[3].registration_id != m_availableRegistrationId)
+    {
+        std::this_thread::yield();
+    }
+
+    int64_t *addr = aeron_counter_lease_counter_addr(lease, constants[3].counter_id);
+    aeron_counter_set_ordered(addr, 42);
+    EXPECT_EQ(42, *aeron_counters_reader_addr(counters_reader, constants[3].counter_id));
+
+    ASSERT_EQ(0, aeron_counter_lease_free(lease, constants[3].counter_id));
+    EXPECT_EQ(-1, aeron_counter_lease_free(lease, constants[3].counter_id));
+    EXPECT_EQ(1u, aeron_counter_lease_available(lease));
+    EXPECT_NE(std::string(label), counterLabel(counters_reader, constants[3].counter_id));
+
+    while (constants[3].registration_id != m_unavailableRegistrationId)
+    {
+        std::this_thread::yield();
+    }
+
+    ASSERT_EQ(0, aeron_counter_lease_allocate(lease, 1001, nullptr, 0, label, strlen(label), &extra));
+    EXPECT_EQ(constants[3].counter_id, extra.counter_id);
+    EXPECT_NE(constants[3].registration_id, extra.registration_id);
+
+    aeron_counter_lease_close(lease, setFlagOnClose, &leaseClosedFlag);
+
+    while (!leaseClosedFlag)
+    {
+        std::this_thread::yield();
+    }
+}
+
+TEST_F(CSystemCounterLeaseTest, shouldPublishLeasedCounterRecordAfterRewritingIt)
+{
+    std::atomic<bool> leaseClosedFlag(false);
+    aeron_async_add_counter_lease_t *async;
+    aeron_counter_lease_t *lease;
+    aeron_counter_constants_t constants;
+    const char label[] = "leased counter";
+    int64_t registration_id = AERON_NULL_VALUE;
+    int32_t state = AERON_COUNTER_RECORD_UNUSED;
+
+    ASSERT_TRUE(connect());
+
+    ASSERT_EQ(0, aeron_async_add_counter_lease(&async, m_aeron, 1));
+    ASSERT_TRUE((lease = awaitCounterLeaseOrError(async))) << aeron_errmsg();
+
+    aeron_counters_reader_t *counters_reader = aeron_counters_reader(m_aeron);
+
+    ASSERT_EQ(0, aeron_counter_lease_allocate(lease, 1001, nullptr, 0, label, strlen(label), &constants))
+        << aeron_errmsg();
+    ASSERT_EQ(0, aeron_counters_reader_counter_state(counters_reader, constants.counter_id, &state));
+    EXPECT_EQ(AERON_COUNTER_RECORD_ALLOCATED, state);
+    ASSERT_EQ(0, aeron_counters_reader_counter_registration_id(
+        counters_reader, constants.counter_id, &registration_id));
+    EXPECT_EQ(constants.registration_id, registration_id);
+    EXPECT_EQ(std::string(label), counterLabel(counters_reader, constants.counter_id));
+
+    ASSERT_EQ(0, aeron_counter_lease_free(lease, constants.counter_id));
+    ASSERT_EQ(0, aeron_counters_reader_counter_state(counters_reader, constants.counter_id, &state));
+    EXPECT_EQ(AERON_COUNTER_RECORD_ALLOCATED, state);
+    ASSERT_EQ(0, aeron_counters_reader_counter_registration_id(
+        counters_reader, constants.counter_id, &registration_id));
+    EXPECT_EQ(AERON_COUNTER_REGISTRATION_ID_DEFAULT, registration_id);
+    EXPECT_NE(std::string(label), counterLabel(counters_reader, constants.counter_id));
+
+    aeron_counter_lease_close(lease, setFlagOnClose, &leaseClosedFlag);
+
+    while (!leaseClosedFlag)
+    {
+        std::this_thread::yield();
+    }
+}
+
+struct EmbeddedInvokerState
+{
+    aeron_publication_t *publication = nullptr;
+    aeron_subscription_t *subscription = nullptr;
+    int sent = 0;
+    int received = 0;
+};
+
+static void embeddedInvokerOnFragment(void *clientd, const uint8_t *buffer, size_t length, aeron_header_t *header)
+{
+    static_cast<EmbeddedInvokerState *>(clientd)->received++;
+}
+
+static int embeddedInvokerAppWork(void *clientd)
+{
+    auto *state = static_cast<EmbeddedInvokerState *>(clientd);
+    const char message[] = "message";
+    int work_count = 0;
+
+    if (state->sent < 100 && aeron_publication_offer(
+        state->publication, (const uint8_t *)message, strlen(message), nullptr, nullptr) > 0)
+    {
+        state->sent++;
+        work_count++;
+    }
+
+    return work_count + aeron_subscription_poll(state->subscription, embeddedInvokerOnFragment, state, 10);
+}
+
+TEST(CSystemEmbeddedInvokerTest, shouldOfferAndPollFromSingleDutyCycle)
+{
+    aeron_driver_context_t *driver_context = nullptr;
+    aeron_context_t *client_context = nullptr;
+    aeron_embedded_invoker_t *invoker = nullptr;
+    aeron_async_add_publication_t *async_pub = nullptr;
+    aeron_async_add_subscription_t *async_sub = nullptr;
+    EmbeddedInvokerState state;
+
+    ASSERT_EQ(aeron_driver_context_init(&driver_context), 0) << aeron_errmsg();
+    aeron_driver_context_set_dir_delete_on_start(driver_context, true);
+    aeron_driver_context_set_dir_delete_on_shutdown(driver_context, true);
+    aeron_driver_context_set_term_buffer_sparse_file(driver_context, true);
+    aeron_driver_context_set_term_buffer_length(driver_context, 64 * 1024);
+    ASSERT_EQ(aeron_context_init(&client_context), 0) << aeron_errmsg();
+
+    ASSERT_EQ(aeron_embedded_invoker_init(&invoker, driver_context, client_context), 0) << aeron_errmsg();
+    EXPECT_EQ(aeron_driver_context_get_threading_mode(driver_context), AERON_THREADING_MODE_INVOKER);
+    EXPECT_TRUE(aeron_context_get_use_conductor_agent_invoker(client_context));
+
+    ASSERT_EQ(aeron_async_add_publication(&async_pub, invoker->client, PUB_URI, STREAM_ID), 0);
+    ASSERT_EQ(aeron_async_add_subscription(
+        &async_sub, invoker->client, PUB_URI, STREAM_ID, nullptr, nullptr, nullptr, nullptr), 0);
+
+    while (nullptr == state.publication || nullptr == state.subscription)
+    {
+        ASSERT_GE(aeron_embedded_invoker_do_work(invoker, nullptr, nullptr), 0) << aeron_errmsg();
+        if (nullptr == state.publication)
+        {
+            ASSERT_GE(aeron_async_add_publication_poll(&state.publication, async_pub), 0) << aeron_errmsg();
+        }
+        if (nullptr == state.subscription)
+        {
+            ASSERT_GE(aeron_async_add_subscription_poll(&state.subscription, async_sub), 0) << aeron_errmsg();
+        }
+    }
+
+    while (state.received < 100)
+    {
+        int work_count = aeron_embedded_invoker_do_work(invoker, embeddedInvokerAppWork, &state);
+        ASSERT_GE(work_count, 0) << aeron_errmsg();
+        aeron_embedded_invoker_idle(invoker, work_count);
+    }
+
+    EXPECT_EQ(state.sent, 100);
+    EXPECT_EQ(aeron_publication_close(state.publication, nullptr, nullptr), 0);
+    EXPECT_EQ(aeron_subscription_close(state.subscription, nullptr, nullptr), 0);
+    EXPECT_EQ(aeron_embedded_invoker_close(invoker), 0);
+    aeron_context_close(client_context);
+    aeron_driver_context_close(driver_context);
+}
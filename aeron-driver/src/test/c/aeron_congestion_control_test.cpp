@@ -0,0 +1,230 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <array>
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "concurrent/aeron_counters_manager.h"
+#include "aeron_congestion_control.h"
+#include "aeron_driver_context.h"
+}
+
+#define TERM_LENGTH (1024 * 1024)
+#define MTU_LENGTH (4096)
+#define WINDOW_LENGTH (128 * 1024)
+#define NOW_NS (1000 * 1000 * 1000LL)
+
+static int64_t null_epoch_clock()
+{
+    return 0;
+}
+
+class CongestionControlTest : public testing::Test
+{
+public:
+    void SetUp() override
+    {
+        ASSERT_EQ(0, aeron_driver_context_init(&m_context)) << aeron_errmsg();
+        m_context->initial_window_length = WINDOW_LENGTH;
+        aeron_clock_update_cached_time(m_context->cached_clock, NOW_NS / (1000 * 1000), NOW_NS);
+
+        m_metadata.fill(0);
+        m_values.fill(0);
+        ASSERT_EQ(0, aeron_counters_manager_init(
+            &m_counters_manager,
+            m_metadata.data(),
+            m_metadata.size(),
+            m_values.data(),
+            m_values.size(),
+            null_epoch_clock,
+            0));
+    }
+
+    void TearDown() override
+    {
+        if (nullptr != m_strategy)
+        {
+            m_strategy->fini(m_strategy);
+        }
+
+        aeron_counters_manager_close(&m_counters_manager);
+        aeron_driver_context_close(m_context);
+    }
+
+    int supply(const char *channel)
+    {
+        struct sockaddr_storage address = {};
+
+        return aeron_congestion_control_default_strategy_supplier(
+            &m_strategy,
+            strlen(channel),
+            channel,
+            1001,
+            42,
+            7,
+            TERM_LENGTH,
+            MTU_LENGTH,
+            &address,
+            &address,
+            m_context,
+            &m_counters_manager);
+    }
+
+    int32_t trackRebuild(int64_t now_ns, bool loss_occurred, bool *should_force_sm)
+    {
+        return m_strategy->on_track_rebuild(
+            m_strategy->state, should_force_sm, now_ns, 0, 0, 0, 0, 0, loss_occurred);
+    }
+
+    int32_t trackRebuildToHwm(int64_t now_ns, int64_t hwm_position, bool *should_force_sm)
+    {
+        return m_strategy->on_track_rebuild(
+            m_strategy->state, should_force_sm, now_ns, 0, 0, hwm_position, 0, hwm_position, false);
+    }
+
+    int64_t counterValue(int32_t counter_id)
+    {
+        return aeron_counter_get(aeron_counters_manager_addr(&m_counters_manager, counter_id));
+    }
+
+protected:
+    static const size_t NUM_COUNTERS = 4;
+    std::array<std::uint8_t, NUM_COUNTERS * AERON_COUNTERS_MANAGER_METADATA_LENGTH> m_metadata{};
+    std::array<std::uint8_t, NUM_COUNTERS * AERON_COUNTERS_MANAGER_VALUE_LENGTH> m_values{};
+    aeron_counters_manager_t m_counters_manager{};
+    aeron_driver_context_t *m_context = nullptr;
+    aeron_congestion_control_strategy_t *m_strategy = nullptr;
+};
+
+TEST_F(CongestionControlTest, shouldSupplyStaticWindowByDefault)
+{
+    ASSERT_EQ(0, supply("aeron:udp?endpoint=localhost:40123")) << aeron_errmsg();
+
+    EXPECT_EQ(WINDOW_LENGTH, m_strategy->initial_window_length(m_strategy->state));
+    EXPECT_FALSE(m_strategy->should_measure_rtt(m_strategy->state, NOW_NS));
+}
+
+TEST_F(CongestionControlTest, shouldSupplyCubicFromCcParam)
+{
+    ASSERT_EQ(0, supply("aeron:udp?endpoint=localhost:40123|cc=cubic")) << aeron_errmsg();
+
+    EXPECT_EQ(MTU_LENGTH, m_strategy->initial_window_length(m_strategy->state));
+    EXPECT_EQ(2, aeron_counters_manager_next_counter_id(&m_counters_manager));
+}
+
+TEST_F(CongestionControlTest, shouldFailToSupplyUnknownCcParam)
+{
+    EXPECT_EQ(-1, supply("aeron:udp?endpoint=localhost:40123|cc=unknown"));
+    EXPECT_EQ(nullptr, m_strategy);
+}
+
+TEST_F(CongestionControlTest, shouldGrowCubicWindowTowardsMaxAndReduceOnLoss)
+{
+    ASSERT_EQ(0, supply("aeron:udp?endpoint=localhost:40123|cc=cubic")) << aeron_errmsg();
+    bool should_force_sm = true;
+
+    // w_max starts at the max of 32 MTUs, K = cbrt(32 * 0.2 / 0.4) so the window starts in the concave region.
+    const int32_t window = trackRebuild(NOW_NS + (1000 * 1000), false, &should_force_sm);
+    EXPECT_FALSE(should_force_sm);
+    EXPECT_EQ(26 * MTU_LENGTH, window);
+
+    EXPECT_EQ(20 * MTU_LENGTH, trackRebuild(NOW_NS + (2 * 1000 * 1000), true, &should_force_sm));
+    EXPECT_TRUE(should_force_sm);
+
+    const int64_t after_k_ns = NOW_NS + (10 * 1000 * 1000 * 1000LL);
+    EXPECT_EQ(WINDOW_LENGTH, trackRebuild(after_k_ns, false, &should_force_sm));
+    EXPECT_FALSE(should_force_sm);
+}
+
+TEST_F(CongestionControlTest, shouldMeasureCubicRttWhenEnabled)
+{
+    m_context->cubic_congestion_control.measure_rtt = true;
+    ASSERT_EQ(0, supply("aeron:udp?endpoint=localhost:40123|cc=cubic")) << aeron_errmsg();
+
+    EXPECT_TRUE(m_strategy->should_measure_rtt(m_strategy->state, NOW_NS));
+    EXPECT_FALSE(m_strategy->should_measure_rtt(m_strategy->state, NOW_NS + (20 * 1000 * 1000)));
+
+    m_strategy->on_rttm(m_strategy->state, NOW_NS + (30 * 1000 * 1000), 250 * 1000, nullptr);
+    EXPECT_EQ(250 * 1000, aeron_counter_get(aeron_counters_manager_addr(&m_counters_manager, 0)));
+    EXPECT_FALSE(m_strategy->should_measure_rtt(m_strategy->state, NOW_NS + (35 * 1000 * 1000)));
+    EXPECT_TRUE(m_strategy->should_measure_rtt(m_strategy->state, NOW_NS + (41 * 1000 * 1000)));
+}
+
+TEST_F(CongestionControlTest, shouldSupplyBbrFromCcParam)
+{
+    ASSERT_EQ(0, supply("aeron:udp?endpoint=localhost:40123|cc=bbr")) << aeron_errmsg();
+
+    EXPECT_EQ(16 * MTU_LENGTH, m_strategy->initial_window_length(m_strategy->state));
+    EXPECT_EQ(3, aeron_counters_manager_next_counter_id(&m_counters_manager));
+    EXPECT_TRUE(m_strategy->should_measure_rtt(m_strategy->state, NOW_NS));
+}
+
+TEST_F(CongestionControlTest, shouldSizeBbrWindowToBandwidthDelayProductOnceBandwidthStopsGrowing)
+{
+    ASSERT_EQ(0, supply("aeron:udp?endpoint=localhost:40123|cc=bbr")) << aeron_errmsg();
+    const int64_t rtt_ns = 1000 * 1000;
+    const int64_t bytes_per_round = 16 * 1024;
+    bool should_force_sm = true;
+
+    m_strategy->on_rttm(m_strategy->state, NOW_NS, rtt_ns, nullptr);
+    EXPECT_EQ(rtt_ns, counterValue(0));
+    EXPECT_EQ(16 * MTU_LENGTH, trackRebuildToHwm(NOW_NS, 0, &should_force_sm));
+    EXPECT_FALSE(should_force_sm);
+
+    // Startup keeps the window while the bandwidth-delay product is below it and the bandwidth is flat.
+    for (int64_t round = 1; round <= 3; round++)
+    {
+        const int64_t now_ns = NOW_NS + (round * rtt_ns);
+        EXPECT_EQ(16 * MTU_LENGTH, trackRebuildToHwm(now_ns, round * bytes_per_round, &should_force_sm));
+        EXPECT_FALSE(should_force_sm);
+    }
+
+    EXPECT_EQ(2 * bytes_per_round, trackRebuildToHwm(NOW_NS + (4 * rtt_ns), 4 * bytes_per_round, &should_force_sm));
+    EXPECT_TRUE(should_force_sm);
+    EXPECT_EQ(bytes_per_round * 1000, counterValue(1));
+    EXPECT_EQ(2 * bytes_per_round, counterValue(2));
+}
+
+TEST_F(CongestionControlTest, shouldProbeBbrMinRttWhenExpired)
+{
+    ASSERT_EQ(0, supply("aeron:udp?endpoint=localhost:40123|cc=bbr")) << aeron_errmsg();
+    const int64_t rtt_ns = 1000 * 1000;
+    const int64_t bytes_per_round = 16 * 1024;
+    bool should_force_sm = false;
+
+    m_strategy->on_rttm(m_strategy->state, NOW_NS, rtt_ns, nullptr);
+    trackRebuildToHwm(NOW_NS, 0, &should_force_sm);
+    for (int64_t round = 1; round <= 4; round++)
+    {
+        trackRebuildToHwm(NOW_NS + (round * rtt_ns), round * bytes_per_round, &should_force_sm);
+    }
+
+    const int64_t expired_ns = NOW_NS + (11 * 1000 * 1000 * 1000LL);
+    EXPECT_EQ(4 * MTU_LENGTH, trackRebuildToHwm(expired_ns, 4 * bytes_per_round, &should_force_sm));
+    EXPECT_TRUE(should_force_sm);
+
+    m_strategy->on_rttm(m_strategy->state, expired_ns + rtt_ns, 2 * rtt_ns, nullptr);
+    EXPECT_EQ(4 * MTU_LENGTH, trackRebuildToHwm(expired_ns + (100 * rtt_ns), 4 * bytes_per_round, &should_force_sm));
+    EXPECT_FALSE(should_force_sm);
+
+    const int64_t probe_done_ns = expired_ns + (200 * rtt_ns);
+    EXPECT_EQ(4 * bytes_per_round, trackRebuildToHwm(probe_done_ns, 4 * bytes_per_round, &should_force_sm));
+    EXPECT_TRUE(should_force_sm);
+    EXPECT_EQ(2 * rtt_ns, counterValue(0));
+}
@@ -218,6 +218,32 @@ TEST_F(CountersManagerTest, shouldFreeAndReuseCountersAfterCoolDown)
     EXPECT_EQ(aeron_counters_manager_allocate(&m_manager, 0, nullptr, 0, "the next label", 14), def);
 }
 
+TEST_F(CountersManagerTest, shouldReuseCountersInOrderFreedAcrossFreeListGrowth)
+{
+    ASSERT_EQ(counters_manager_with_cool_down_init(), 0);
+
+    std::vector<int32_t> ids;
+    for (size_t i = 0; i < NUM_COUNTERS; i++)
+    {
+        ids.push_back(aeron_counters_manager_allocate(&m_manager, 0, nullptr, 0, "abc", 3));
+        ASSERT_GE(ids.back(), 0);
+    }
+
+    ASSERT_EQ(aeron_counters_manager_free(&m_manager, ids[2]), 0);
+    ASSERT_EQ(aeron_counters_manager_free(&m_manager, ids[0]), 0);
+    ms_timestamp += FREE_TO_REUSE_TIMEOUT_MS;
+    EXPECT_EQ(aeron_counters_manager_allocate(&m_manager, 0, nullptr, 0, "abc", 3), ids[2]);
+
+    ASSERT_EQ(aeron_counters_manager_free(&m_manager, ids[3]), 0);
+    ASSERT_EQ(aeron_counters_manager_free(&m_manager, ids[1]), 0);
+    EXPECT_EQ(aeron_counters_manager_allocate(&m_manager, 0, nullptr, 0, "abc", 3), ids[0]);
+    EXPECT_EQ(aeron_counters_manager_allocate(&m_manager, 0, nullptr, 0, "abc", 3), -1);
+
+    ms_timestamp += FREE_TO_REUSE_TIMEOUT_MS;
+    EXPECT_EQ(aeron_counters_manager_allocate(&m_manager, 0, nullptr, 0, "abc", 3), ids[3]);
+    EXPECT_EQ(aeron_counters_manager_allocate(&m_manager, 0, nullptr, 0, "abc", 3), ids[1]);
+}
+
 TEST_F(CountersManagerTest, shouldStoreAndLoadCounterValue)
 {
     ASSERT_EQ(counters_manager_init(), 0);
@@ -271,6 +271,60 @@ TEST_F(DataPacketDispatcherTest, shouldRequestCreateImageUponReceivingSetupMulti
         3));
 }
 
+TEST_F(DataPacketDispatcherTest, shouldFastJoinFromDataFrameOfPublicationWithCachedSetup)
+{
+    AERON_DECL_ALIGNED(buffer_t data_buffer, 16);
+
+    int32_t session_id = 123123;
+    int32_t stream_id = 434523;
+    size_t len = sizeof(aeron_data_header_t) + 8;
+
+    aeron_driver_context_set_rcv_fast_join_enabled(m_context, true);
+    ASSERT_EQ(0, aeron_data_packet_dispatcher_add_subscription(m_dispatcher, stream_id));
+
+    aeron_setup_header_t *setup_header = setupPacket(data_buffer, stream_id, session_id);
+    ASSERT_EQ(0, aeron_data_packet_dispatcher_on_setup(
+        m_dispatcher,
+        m_receive_endpoint,
+        m_destination,
+        setup_header,
+        data_buffer.data(),
+        sizeof(*setup_header),
+        &m_receive_endpoint->conductor_fields.udp_channel->local_data));
+
+    ASSERT_EQ(UINT64_C(1), aeron_mpsc_concurrent_array_queue_drain(
+        m_conductor_proxy.command_queue, verify_conductor_cmd_function, get_on_publication_image_fptr(), 1));
+
+    aeron_data_packet_dispatcher_remove_with_state(
+        m_dispatcher, session_id, stream_id, AERON_DATA_PACKET_DISPATCHER_IMAGE_INIT_IN_PROGRESS);
+
+    aeron_data_header_t *data_header = dataPacket(data_buffer, stream_id, session_id, 1, 1024);
+    ASSERT_EQ(0, aeron_data_packet_dispatcher_on_data(
+        m_dispatcher,
+        m_receive_endpoint,
+        m_destination,
+        data_header,
+        data_buffer.data(),
+        len,
+        &m_receive_endpoint->conductor_fields.udp_channel->local_data));
+
+    ASSERT_EQ(0, m_test_bindings_state->sm_count);
+    ASSERT_EQ(UINT64_C(1), aeron_mpsc_concurrent_array_queue_drain(
+        m_conductor_proxy.command_queue, verify_conductor_cmd_function, get_on_publication_image_fptr(), 1));
+
+    aeron_data_header_t *other_header = dataPacket(data_buffer, stream_id, session_id + 1);
+    ASSERT_EQ(0, aeron_data_packet_dispatcher_on_data(
+        m_dispatcher,
+        m_receive_endpoint,
+        m_destination,
+        other_header,
+        data_buffer.data(),
+        len,
+        &m_receive_endpoint->conductor_fields.udp_channel->local_data));
+
+    ASSERT_EQ(1, m_test_bindings_state->sm_count);
+}
+
 TEST_F(DataPacketDispatcherTest, DISABLED_shouldSetImageInactiveOnRemoveSubscription)
 {
     int32_t session_id = 123123;
@@ -342,6 +396,45 @@ TEST_F(DataPacketDispatcherTest, shouldIgnoreDataAndSetupAfterImageRemoved)
     ASSERT_EQ(UINT64_C(0), aeron_mpsc_concurrent_array_queue_size(m_conductor_proxy.command_queue));
 }
 
+TEST_F(DataPacketDispatcherTest, shouldNotInsertDataIntoCachedImageAfterImageRemoved)
+{
+    AERON_DECL_ALIGNED(buffer_t data_buffer, 16);
+
+    int32_t session_id = 123123;
+    int32_t stream_id = 434523;
+
+    aeron_publication_image_t *image = createImage(stream_id, session_id);
+    ASSERT_NE(nullptr, image) << aeron_errmsg();
+
+    ASSERT_EQ(0, aeron_data_packet_dispatcher_add_subscription(m_dispatcher, stream_id));
+    ASSERT_EQ(0, aeron_data_packet_dispatcher_add_publication_image(m_dispatcher, image));
+
+    aeron_data_header_t *data_header = dataPacket(data_buffer, stream_id, session_id);
+    size_t len = sizeof(aeron_data_header_t) + 8;
+
+    ASSERT_EQ((int)len, aeron_data_packet_dispatcher_on_data(
+        m_dispatcher,
+        m_receive_endpoint,
+        m_destination,
+        data_header,
+        data_buffer.data(),
+        len,
+        &m_receive_endpoint->conductor_fields.udp_channel->local_data));
+
+    ASSERT_EQ(0, aeron_data_packet_dispatcher_remove_publication_image(m_dispatcher, image));
+
+    data_header->term_offset = (int32_t)len;
+    ASSERT_EQ(0, aeron_data_packet_dispatcher_on_data(
+        m_dispatcher,
+        m_receive_endpoint,
+        m_destination,
+        data_header,
+        data_buffer.data(),
+        len,
+        &m_receive_endpoint->conductor_fields.udp_channel->local_data));
+    ASSERT_EQ((int64_t)len, *image->rcv_hwm_position.value_addr);
+}
+
 TEST_F(DataPacketDispatcherTest, shouldNotIgnoreDataAndSetupAfterImageRemovedAndCoolDownRemoved)
 {
     AERON_DECL_ALIGNED(buffer_t data_buffer, 16);
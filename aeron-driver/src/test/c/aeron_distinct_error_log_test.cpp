@@ -27,6 +27,7 @@ extern "C"
 
 typedef std::array<std::uint8_t, CAPACITY> buffer_t;
 typedef std::array<std::uint8_t, 32> insufficient_buffer_t;
+typedef std::array<std::uint8_t, 64 * 1024> large_buffer_t;
 
 class DistinctErrorLogTest : public testing::Test
 {
@@ -133,6 +134,36 @@ TEST_F(DistinctErrorLogTest, shouldRecordTwoDistinctObservations)
     EXPECT_EQ(aeron_distinct_error_log_num_observations(&m_log), (size_t)2);
 }
 
+TEST_F(DistinctErrorLogTest, shouldSummariseManyDistinctObservationsByCodeAndDescription)
+{
+    AERON_DECL_ALIGNED(static large_buffer_t buffer, 16);
+    buffer.fill(0);
+    const int num_descriptions = 100;
+
+    ASSERT_EQ(aeron_distinct_error_log_init(&m_log, buffer.data(), buffer.size(), clock, linger_resource, nullptr), 0);
+
+    for (int round = 0; round < 2; round++)
+    {
+        for (int i = 0; i < num_descriptions; i++)
+        {
+            std::string description = "description " + std::to_string(i);
+            ASSERT_EQ(aeron_distinct_error_log_record(&m_log, 1, description.c_str(), "message"), 0);
+            ASSERT_EQ(aeron_distinct_error_log_record(&m_log, 2, description.c_str(), "message"), 0);
+        }
+    }
+
+    EXPECT_EQ(aeron_distinct_error_log_record(&m_log, 1, "description", "message"), 0);
+    EXPECT_EQ(aeron_distinct_error_log_num_observations(&m_log), (size_t)(num_descriptions * 2) + 1);
+
+    size_t offset = 0;
+    for (int i = 0; i < num_descriptions * 2; i++)
+    {
+        auto *entry = (aeron_error_log_entry_t *)(buffer.data() + offset);
+        EXPECT_EQ(entry->observation_count, 2);
+        offset += AERON_ALIGN(entry->length, AERON_ERROR_LOG_RECORD_ALIGNMENT);
+    }
+}
+
 static void error_log_reader_no_entries(
     int32_t observation_count,
     int64_t first_observation_timestamp,
@@ -207,6 +207,56 @@ TEST_F(DriverConductorIpcTest, shouldNotLinkSubscriptionOnAddPublicationAfterFir
     readAllBroadcastsFromConductor(mock_broadcast_handler);
 }
 
+TEST_F(DriverConductorIpcTest, shouldAdvanceEagerIpcPublicationLimitOnAnySubscriberProgress)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t sub_id = nextCorrelationId();
+    int64_t pub_id = nextCorrelationId();
+
+    ASSERT_EQ(0, aeron_driver_context_set_ipc_publication_eager_limit_enabled(m_context.m_context, true));
+    ASSERT_EQ(addIpcSubscription(client_id, sub_id, STREAM_ID_1, -1), 0);
+    ASSERT_EQ(addIpcPublication(client_id, pub_id, STREAM_ID_1, false), 0);
+    doWork();
+
+    aeron_ipc_publication_t *publication = aeron_driver_conductor_find_ipc_publication(
+        &m_conductor.m_conductor, pub_id);
+    ASSERT_NE(nullptr, publication);
+    EXPECT_EQ(0, publication->trip_gain);
+
+    int64_t *sub_position = publication->conductor_fields.subscribable.array[0].value_addr;
+    aeron_counter_set_ordered(sub_position, 64);
+    EXPECT_EQ(1, aeron_ipc_publication_update_pub_lmt(publication));
+    EXPECT_EQ(64 + publication->term_window_length, aeron_counter_get(publication->pub_lmt_position.value_addr));
+
+    aeron_counter_set_ordered(sub_position, 96);
+    EXPECT_EQ(1, aeron_ipc_publication_update_pub_lmt(publication));
+    EXPECT_EQ(96 + publication->term_window_length, aeron_counter_get(publication->pub_lmt_position.value_addr));
+    EXPECT_EQ(0, aeron_ipc_publication_update_pub_lmt(publication));
+}
+
+TEST_F(DriverConductorIpcTest, shouldRejectIpcPublicationWhenLogBufferMemoryBudgetIsExhausted)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t pub_id_1 = nextCorrelationId();
+    int64_t pub_id_2 = nextCorrelationId();
+
+    ASSERT_EQ(0, aeron_driver_context_set_log_buffer_memory_budget(
+        m_context.m_context, aeron_logbuffer_compute_log_length(TERM_LENGTH, m_context.m_context->file_page_size)));
+    ASSERT_EQ(addIpcPublication(client_id, pub_id_1, STREAM_ID_1, false), 0);
+    ASSERT_EQ(addIpcPublication(client_id, pub_id_2, STREAM_ID_2, false), 0);
+    doWork();
+
+    EXPECT_NE(nullptr, aeron_driver_conductor_find_ipc_publication(&m_conductor.m_conductor, pub_id_1));
+    EXPECT_EQ(nullptr, aeron_driver_conductor_find_ipc_publication(&m_conductor.m_conductor, pub_id_2));
+    EXPECT_EQ(1, aeron_counter_get(aeron_system_counter_addr(
+        &m_conductor.m_conductor.system_counters, AERON_SYSTEM_COUNTER_LOG_BUFFER_BUDGET_REJECTIONS)));
+
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_COUNTER_READY, _, _));
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_PUBLICATION_READY, _, _));
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_ERROR, _, _)).With(IsError(pub_id_2));
+    readAllBroadcastsFromConductor(mock_broadcast_handler);
+}
+
 // TODO: Paramterise
 TEST_F(DriverConductorIpcTest, shouldBeAbleToTimeoutMultipleIpcSubscriptions)
 {
@@ -414,3 +464,66 @@ TEST_F(DriverConductorIpcTest, shouldNotAddIpcSubscriptionThenPublicationWithDif
         .Times(0);
     readAllBroadcastsFromConductor(mock_broadcast_handler);
 }
+
+TEST_F(DriverConductorIpcTest, shouldErrorOnDirectedResponsesWhenNotEnabled)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t request_id = nextCorrelationId();
+
+    ASSERT_EQ(addDirectedResponses(client_id, request_id), 0);
+    doWork();
+
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_ERROR, _, _)).With(IsError(request_id));
+    readAllBroadcastsFromConductor(mock_broadcast_handler);
+}
+
+TEST_F(DriverConductorIpcTest, shouldSendResponsesForClientToDirectedBufferWhenRequested)
+{
+    char aeron_dir[] = "/tmp/aeron-directed-XXXXXX";
+    ASSERT_NE(mkdtemp(aeron_dir), nullptr);
+    snprintf(m_context.m_context->aeron_dir, AERON_MAX_PATH - 1, "%s", aeron_dir);
+    std::string clients_dir = std::string(aeron_dir) + "/" + AERON_CLIENTS_DIR;
+    ASSERT_EQ(aeron_mkdir(clients_dir.c_str(), S_IRWXU), 0);
+    m_context.m_context->client_directed_responses_enabled = true;
+
+    int64_t client_id = nextCorrelationId();
+    int64_t request_id = nextCorrelationId();
+    int64_t sub_id = nextCorrelationId();
+    int64_t pub_id = nextCorrelationId();
+
+    ASSERT_EQ(addDirectedResponses(client_id, request_id), 0);
+    doWork();
+
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_COUNTER_READY, _, _));
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_OPERATION_SUCCESS, _, _))
+        .With(IsOperationSuccess(request_id));
+    readAllBroadcastsFromConductor(mock_broadcast_handler);
+    testing::Mock::VerifyAndClearExpectations(&m_mockCallbacks);
+
+    char path[AERON_MAX_PATH];
+    aeron_client_responses_location(path, sizeof(path), aeron_dir, client_id);
+    aeron_mapped_file_t directed_map = {};
+    ASSERT_EQ(aeron_map_existing_file(&directed_map, path), 0) << aeron_errmsg();
+    aeron_broadcast_receiver_t directed_receiver;
+    ASSERT_EQ(aeron_broadcast_receiver_init(&directed_receiver, directed_map.addr, directed_map.length), 0);
+
+    ASSERT_EQ(addIpcSubscription(client_id, sub_id, STREAM_ID_1, -1), 0);
+    ASSERT_EQ(addIpcPublication(client_id, pub_id, STREAM_ID_1, false), 0);
+    doWork();
+
+    EXPECT_EQ(readAllBroadcastsFromConductor(null_broadcast_handler), 0u);
+
+    testing::Sequence sequence;
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_SUBSCRIPTION_READY, _, _))
+        .With(IsSubscriptionReady(sub_id))
+        .InSequence(sequence);
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_PUBLICATION_READY, _, _))
+        .InSequence(sequence);
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_AVAILABLE_IMAGE, _, _))
+        .InSequence(sequence);
+    EXPECT_EQ(
+        aeron_broadcast_receiver_receive_batch(&directed_receiver, mock_broadcast_handler, &m_mockCallbacks), 3);
+
+    aeron_unmap(&directed_map);
+    aeron_delete_directory(aeron_dir);
+}
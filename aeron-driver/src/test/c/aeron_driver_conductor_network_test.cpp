@@ -698,6 +698,42 @@ TEST_F(DriverConductorNetworkTest, shouldFailToAddPublicationWithAtsEnabled)
     readAllBroadcastsFromConductor(mock_broadcast_handler);
 }
 
+TEST_F(DriverConductorNetworkTest, shouldLimitSendsToPacingBudgetOfPublication)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t pub_id = nextCorrelationId();
+
+    ASSERT_EQ(addPublication(client_id, pub_id, CHANNEL_1 "|pacing-rate=8m|pacing-mode=bucket", STREAM_ID_1, false), 0);
+    doWork();
+    readAllBroadcastsFromConductor(null_broadcast_handler);
+
+    aeron_network_publication_t *publication = aeron_driver_conductor_find_network_publication(
+        &m_conductor.m_conductor, pub_id);
+    ASSERT_NE(publication, (aeron_network_publication_t *)nullptr);
+    EXPECT_EQ(8 * 1024 * 1024, publication->pacing_rate);
+    EXPECT_FALSE(publication->pacing_txtime);
+
+    const int64_t now_ns = publication->pacing_time_ns;
+    EXPECT_EQ((8 * 1024 * 1024) / 1000, aeron_network_publication_pacing_budget(publication, now_ns));
+
+    publication->pacing_time_ns += aeron_network_publication_pacing_duration_ns(publication, 8 * 1024 * 1024 / 500);
+    EXPECT_EQ(0, aeron_network_publication_pacing_budget(publication, now_ns));
+    EXPECT_EQ(
+        (int64_t)publication->mtu_length,
+        aeron_network_publication_pacing_budget(publication, now_ns + AERON_NETWORK_PUBLICATION_PACING_BURST_NS + 1));
+}
+
+TEST_F(DriverConductorNetworkTest, shouldFailToAddPublicationWithUnknownPacingMode)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t pub_id = nextCorrelationId();
+
+    ASSERT_EQ(addPublication(client_id, pub_id, CHANNEL_1 "|pacing-rate=8m|pacing-mode=fast", STREAM_ID_1, false), 0);
+    doWork();
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_ERROR, _, _));
+    readAllBroadcastsFromConductor(mock_broadcast_handler);
+}
+
 TEST_F(DriverConductorNetworkTest, shouldFailToAddSubscriptionWithAtsEnabled)
 {
     int64_t client_id = nextCorrelationId();
@@ -709,3 +745,223 @@ TEST_F(DriverConductorNetworkTest, shouldFailToAddSubscriptionWithAtsEnabled)
     EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_ERROR, _, _));
     readAllBroadcastsFromConductor(mock_broadcast_handler);
 }
+
+TEST_F(DriverConductorNetworkTest, shouldAddNetworkSubscriptionWithFanoutTransports)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t sub_id = nextCorrelationId();
+
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id, CHANNEL_1 "|fanout=3", STREAM_ID_1), 0);
+    doWork();
+
+    aeron_receive_channel_endpoint_t *endpoint = aeron_driver_conductor_find_receive_channel_endpoint(
+        &m_conductor.m_conductor, CHANNEL_1 "|fanout=3");
+    ASSERT_NE(endpoint, (aeron_receive_channel_endpoint_t *)nullptr);
+    ASSERT_EQ(1u, endpoint->destinations.length);
+
+    aeron_receive_destination_t *destination = endpoint->destinations.array[0].destination;
+    ASSERT_EQ(3u, aeron_receive_destination_transport_count(destination));
+    for (size_t i = 1; i < aeron_receive_destination_transport_count(destination); i++)
+    {
+        aeron_udp_channel_transport_t *transport = aeron_receive_destination_transport(destination, i);
+        EXPECT_NE(-1, transport->fd);
+        EXPECT_EQ(endpoint, transport->dispatch_clientd);
+        EXPECT_EQ(destination, transport->destination_clientd);
+    }
+
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(_, _, _));
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_SUBSCRIPTION_READY, _, _));
+    readAllBroadcastsFromConductor(mock_broadcast_handler);
+}
+
+TEST_F(DriverConductorNetworkTest, shouldFailToAddMulticastSubscriptionWithFanout)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t sub_id = nextCorrelationId();
+
+    ASSERT_EQ(addNetworkSubscription(
+        client_id, sub_id, "aeron:udp?endpoint=224.20.30.39:40456|interface=localhost|fanout=2", STREAM_ID_1), 0);
+    doWork();
+
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(_, _, _));
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_ERROR, _, _));
+    readAllBroadcastsFromConductor(mock_broadcast_handler);
+}
+
+TEST_F(DriverConductorNetworkTest, shouldFailToAddNetworkSubscriptionWithJoinHistory)
+{
+    int64_t client_id = nextCorrelationId();
+    int64_t sub_id = nextCorrelationId();
+
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id, CHANNEL_1 "|join-history=true", STREAM_ID_1), 0);
+    doWork();
+
+    EXPECT_EQ(0u, m_conductor.m_conductor.network_subscriptions.length);
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_ERROR, _, _));
+    readAllBroadcastsFromConductor(mock_broadcast_handler);
+}
+
+TEST_F(DriverConductorNetworkTest, shouldAssignReceiveChannelEndpointsToLeastLoadedReceiverShard)
+{
+    aeron_driver_receiver_proxy_t shard_proxy = m_conductor.m_receiver.receiver_proxy;
+    aeron_driver_receiver_proxy_t *shard_proxies[] = { &m_conductor.m_receiver.receiver_proxy, &shard_proxy };
+    m_context.m_context->receiver_shard_proxies = shard_proxies;
+    m_context.m_context->receiver_shard_proxies_length = 2;
+
+    int64_t client_id = nextCorrelationId();
+    int64_t sub_id_1 = nextCorrelationId();
+    int64_t sub_id_2 = nextCorrelationId();
+    int64_t sub_id_3 = nextCorrelationId();
+
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id_1, CHANNEL_1, STREAM_ID_1), 0);
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id_2, CHANNEL_2, STREAM_ID_1), 0);
+    doWork();
+
+    aeron_receive_channel_endpoint_t *endpoint_1 = aeron_driver_conductor_find_receive_channel_endpoint(
+        &m_conductor.m_conductor, CHANNEL_1);
+    aeron_receive_channel_endpoint_t *endpoint_2 = aeron_driver_conductor_find_receive_channel_endpoint(
+        &m_conductor.m_conductor, CHANNEL_2);
+    ASSERT_NE(endpoint_1, (aeron_receive_channel_endpoint_t *)nullptr);
+    ASSERT_NE(endpoint_2, (aeron_receive_channel_endpoint_t *)nullptr);
+    EXPECT_EQ(endpoint_1->receiver_proxy, shard_proxies[0]);
+    EXPECT_EQ(endpoint_2->receiver_proxy, shard_proxies[1]);
+
+    ASSERT_EQ(removeSubscription(client_id, nextCorrelationId(), sub_id_1), 0);
+    doWork();
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id_3, CHANNEL_3, STREAM_ID_1), 0);
+    doWork();
+
+    aeron_receive_channel_endpoint_t *endpoint_3 = aeron_driver_conductor_find_receive_channel_endpoint(
+        &m_conductor.m_conductor, CHANNEL_3);
+    ASSERT_NE(endpoint_3, (aeron_receive_channel_endpoint_t *)nullptr);
+    EXPECT_EQ(endpoint_3->receiver_proxy, shard_proxies[0]);
+
+    m_context.m_context->receiver_shard_proxies = nullptr;
+    m_context.m_context->receiver_shard_proxies_length = 0;
+}
+
+TEST_F(DriverConductorNetworkTest, shouldAssignSendChannelEndpointsToSenderShardWithFewestPublications)
+{
+    aeron_driver_sender_proxy_t shard_proxy = m_conductor.m_sender.sender_proxy;
+    aeron_driver_sender_proxy_t *shard_proxies[] = { &m_conductor.m_sender.sender_proxy, &shard_proxy };
+    m_context.m_context->sender_shard_proxies = shard_proxies;
+    m_context.m_context->sender_shard_proxies_length = 2;
+
+    int64_t client_id = nextCorrelationId();
+
+    ASSERT_EQ(addPublication(client_id, nextCorrelationId(), CHANNEL_1, STREAM_ID_1, false), 0);
+    ASSERT_EQ(addPublication(client_id, nextCorrelationId(), CHANNEL_1, STREAM_ID_2, false), 0);
+    ASSERT_EQ(addPublication(client_id, nextCorrelationId(), CHANNEL_2, STREAM_ID_1, false), 0);
+    ASSERT_EQ(addPublication(client_id, nextCorrelationId(), CHANNEL_3, STREAM_ID_1, false), 0);
+    doWork();
+
+    aeron_send_channel_endpoint_t *endpoint_1 = aeron_driver_conductor_find_send_channel_endpoint(
+        &m_conductor.m_conductor, CHANNEL_1);
+    aeron_send_channel_endpoint_t *endpoint_2 = aeron_driver_conductor_find_send_channel_endpoint(
+        &m_conductor.m_conductor, CHANNEL_2);
+    aeron_send_channel_endpoint_t *endpoint_3 = aeron_driver_conductor_find_send_channel_endpoint(
+        &m_conductor.m_conductor, CHANNEL_3);
+    ASSERT_NE(endpoint_1, (aeron_send_channel_endpoint_t *)nullptr);
+    ASSERT_NE(endpoint_2, (aeron_send_channel_endpoint_t *)nullptr);
+    ASSERT_NE(endpoint_3, (aeron_send_channel_endpoint_t *)nullptr);
+    EXPECT_EQ(endpoint_1->sender_proxy, shard_proxies[0]);
+    EXPECT_EQ(endpoint_2->sender_proxy, shard_proxies[1]);
+    EXPECT_EQ(endpoint_3->sender_proxy, shard_proxies[1]);
+
+    m_context.m_context->sender_shard_proxies = nullptr;
+    m_context.m_context->sender_shard_proxies_length = 0;
+}
+
+TEST_F(DriverConductorNetworkTest, shouldLinkLocalNetworkSubscriptionToNetworkPublicationWhenShortCircuitEnabled)
+{
+    m_context.m_context->network_short_circuit_enabled = true;
+
+    int64_t client_id = nextCorrelationId();
+    int64_t sub_id = nextCorrelationId();
+    int64_t pub_id = nextCorrelationId();
+    int64_t remove_correlation_id = nextCorrelationId();
+
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id, CHANNEL_1, STREAM_ID_1), 0);
+    ASSERT_EQ(addPublication(client_id, pub_id, CHANNEL_1, STREAM_ID_1, false), 0);
+    doWork();
+
+    aeron_network_publication_t *publication = aeron_driver_conductor_find_network_publication(
+        &m_conductor.m_conductor, pub_id);
+    ASSERT_NE(publication, (aeron_network_publication_t *)nullptr);
+    EXPECT_EQ(aeron_network_publication_num_spy_subscribers(publication), 1u);
+
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(_, _, _)).Times(testing::AnyNumber());
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_AVAILABLE_IMAGE, _, _)).Times(1);
+    readAllBroadcastsFromConductor(mock_broadcast_handler);
+
+    ASSERT_EQ(removeSubscription(client_id, remove_correlation_id, sub_id), 0);
+    doWork();
+
+    EXPECT_EQ(aeron_network_publication_num_spy_subscribers(publication), 0u);
+}
+
+TEST_F(DriverConductorNetworkTest, shouldConnectAndHoldBackPublicationForShortCircuitSubscriberWithoutReceivers)
+{
+    m_context.m_context->network_short_circuit_enabled = true;
+    m_context.m_context->spies_simulate_connection = false;
+
+    int64_t client_id = nextCorrelationId();
+    int64_t sub_id = nextCorrelationId();
+    int64_t pub_id = nextCorrelationId();
+
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id, CHANNEL_1, STREAM_ID_1), 0);
+    ASSERT_EQ(addPublication(client_id, pub_id, CHANNEL_1, STREAM_ID_1, false), 0);
+    doWork();
+    readAllBroadcastsFromConductor(null_broadcast_handler);
+
+    aeron_network_publication_t *publication = aeron_driver_conductor_find_network_publication(
+        &m_conductor.m_conductor, pub_id);
+    ASSERT_NE(publication, (aeron_network_publication_t *)nullptr);
+
+    doWorkForNs(m_context.m_context->timer_interval_ns * 2);
+
+    EXPECT_TRUE(publication->is_connected);
+    EXPECT_TRUE(publication->has_short_circuit_subscribers);
+
+    int64_t sub_position = *publication->conductor_fields.subscribable.array[0].value_addr;
+    EXPECT_EQ(
+        aeron_counter_get(publication->pub_lmt_position.value_addr),
+        sub_position + (int64_t)publication->term_window_length);
+}
+
+TEST_F(DriverConductorNetworkTest, shouldNotCreateImageForSessionPublishedLocallyWhenShortCircuitEnabled)
+{
+    m_context.m_context->network_short_circuit_enabled = true;
+
+    int64_t client_id = nextCorrelationId();
+    int64_t pub_id = nextCorrelationId();
+    int64_t sub_id = nextCorrelationId();
+    std::string channel = std::string(CHANNEL_1) + "|session-id=" + std::to_string(SESSION_ID);
+
+    ASSERT_EQ(addPublication(client_id, pub_id, channel, STREAM_ID_1, false), 0);
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id, CHANNEL_1, STREAM_ID_1), 0);
+    doWork();
+    readAllBroadcastsFromConductor(null_broadcast_handler);
+
+    aeron_network_publication_t *publication = aeron_driver_conductor_find_network_publication(
+        &m_conductor.m_conductor, pub_id);
+    ASSERT_NE(publication, (aeron_network_publication_t *)nullptr);
+    EXPECT_EQ(aeron_network_publication_num_spy_subscribers(publication), 1u);
+
+    aeron_receive_channel_endpoint_t *endpoint = aeron_driver_conductor_find_receive_channel_endpoint(
+        &m_conductor.m_conductor, CHANNEL_1);
+
+    createPublicationImage(endpoint, STREAM_ID_1, 1000);
+
+    EXPECT_EQ(aeron_driver_conductor_num_images(&m_conductor.m_conductor), 0u);
+}
+
+TEST_F(DriverConductorNetworkTest, shouldApplyNakUnicastDelayTuningOnConductor)
+{
+    const int64_t delay_ns = 5 * 1000 * 1000LL;
+
+    aeron_driver_conductor_on_tuning_change(
+        &m_conductor.m_conductor, AERON_DRIVER_TUNING_NAK_UNICAST_DELAY_NS, delay_ns);
+
+    EXPECT_EQ(delay_ns, m_context.m_context->unicast_delay_feedback_generator.static_delay.delay_ns);
+}
@@ -702,6 +702,57 @@ TEST_P(DriverConductorPubSubTest, shouldBeAbleToAddMultipleNetworkSubscriptionsW
     readAllBroadcastsFromConductor(null_broadcast_handler);
 }
 
+TEST_P(DriverConductorPubSubTest, shouldRemoveNetworkSubscriptionsInAnyOrderAfterAddingMany)
+{
+    const char *channel = GetParam()->m_channel;
+
+    int64_t client_id = nextCorrelationId();
+    int64_t sub_id_1 = nextCorrelationId();
+    int64_t sub_id_2 = nextCorrelationId();
+    int64_t sub_id_3 = nextCorrelationId();
+    int64_t sub_id_4 = nextCorrelationId();
+
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id_1, channel, STREAM_ID_1), 0);
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id_2, channel, STREAM_ID_2), 0);
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id_3, channel, STREAM_ID_3), 0);
+    ASSERT_EQ(addNetworkSubscription(client_id, sub_id_4, channel, STREAM_ID_4), 0);
+    doWork();
+    ASSERT_EQ(GetParam()->numSubscriptions(&m_conductor.m_conductor), 4u);
+    readAllBroadcastsFromConductor(null_broadcast_handler);
+
+    int64_t remove_correlation_id_1 = nextCorrelationId();
+    int64_t remove_correlation_id_2 = nextCorrelationId();
+    int64_t remove_correlation_id_3 = nextCorrelationId();
+    int64_t remove_correlation_id_4 = nextCorrelationId();
+
+    ASSERT_EQ(removeSubscription(client_id, remove_correlation_id_1, sub_id_1), 0);
+    ASSERT_EQ(removeSubscription(client_id, remove_correlation_id_2, sub_id_3), 0);
+    ASSERT_EQ(removeSubscription(client_id, remove_correlation_id_3, sub_id_1), 0);
+    ASSERT_EQ(removeSubscription(client_id, remove_correlation_id_4, sub_id_4), 0);
+    doWork();
+    ASSERT_EQ(GetParam()->numSubscriptions(&m_conductor.m_conductor), 1u);
+
+    testing::Sequence sequence;
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_OPERATION_SUCCESS, _, _))
+        .With(IsOperationSuccess(remove_correlation_id_1))
+        .InSequence(sequence);
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_OPERATION_SUCCESS, _, _))
+        .With(IsOperationSuccess(remove_correlation_id_2))
+        .InSequence(sequence);
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_ERROR, _, _))
+        .With(IsError(remove_correlation_id_3))
+        .InSequence(sequence);
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_OPERATION_SUCCESS, _, _))
+        .With(IsOperationSuccess(remove_correlation_id_4))
+        .InSequence(sequence);
+    readAllBroadcastsFromConductor(mock_broadcast_handler);
+
+    int64_t remove_correlation_id_5 = nextCorrelationId();
+    ASSERT_EQ(removeSubscription(client_id, remove_correlation_id_5, sub_id_2), 0);
+    doWork();
+    ASSERT_EQ(GetParam()->numSubscriptions(&m_conductor.m_conductor), 0u);
+}
+
 TEST_F(DriverConductorPubSubTest, shouldErrorOnRemovePublicationOnUnknownRegistrationId)
 {
     int64_t client_id = nextCorrelationId();
@@ -852,6 +903,47 @@ TEST_P(DriverConductorPubSubTest, shouldBeAbleToNotTimeoutNetworkSubscriptionOnK
     EXPECT_EQ(GetParam()->numSubscriptions(&m_conductor.m_conductor), 1u);
 }
 
+TEST_P(DriverConductorPubSubTest, shouldRemoveClosedClientOnNextTimerCheck)
+{
+    const char *channel = GetParam()->m_channel;
+    int64_t client_id_1 = nextCorrelationId();
+    int64_t client_id_2 = nextCorrelationId();
+    int64_t sub_id_1 = nextCorrelationId();
+    int64_t sub_id_2 = nextCorrelationId();
+
+    ASSERT_EQ(addNetworkSubscription(client_id_1, sub_id_1, channel, STREAM_ID_1), 0);
+    ASSERT_EQ(addNetworkSubscription(client_id_2, sub_id_2, channel, STREAM_ID_2), 0);
+    doWork();
+    readAllBroadcastsFromConductor(null_broadcast_handler);
+
+    doWorkForNs(
+        m_context.m_context->client_liveness_timeout_ns * 2,
+        100,
+        [&]()
+        {
+            clientKeepalive(client_id_1);
+            clientKeepalive(client_id_2);
+        });
+    EXPECT_EQ(aeron_driver_conductor_num_clients(&m_conductor.m_conductor), 2u);
+
+    ASSERT_EQ(closeClient(client_id_1), 0);
+    doWork();
+    EXPECT_LE(
+        m_conductor.m_conductor.clients_deadline_ms,
+        (int64_t)(m_context.m_context->client_liveness_timeout_ns / (1000 * 1000)));
+
+    doWorkForNs(
+        m_context.m_context->timer_interval_ns * 2,
+        100,
+        [&]()
+        {
+            clientKeepalive(client_id_2);
+        });
+
+    EXPECT_EQ(aeron_driver_conductor_num_clients(&m_conductor.m_conductor), 1u);
+    EXPECT_EQ(GetParam()->numSubscriptions(&m_conductor.m_conductor), 1u);
+}
+
 TEST_P(DriverConductorPubSubTest, shouldBeAbleToTimeoutSendChannelEndpointWithClientKeepaliveAfterRemovePublication)
 {
     const char *channel = GetParam()->m_channel;
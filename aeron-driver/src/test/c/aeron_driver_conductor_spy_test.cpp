@@ -671,3 +671,63 @@ TEST_F(DriverConductorSpyTest, shouldNotAddSingleSpyThenNetworkPublicationWithDi
         .Times(0);
     readAllBroadcastsFromConductor(mock_broadcast_handler);
 }
+
+TEST_F(DriverConductorSpyTest, shouldNotHoldBackPublicationForObserverSpyAndNotifyWhenLapped)
+{
+    const int64_t client_id = nextCorrelationId();
+    const int64_t pub_id = nextCorrelationId();
+    const int64_t spy_id = nextCorrelationId();
+    const int64_t observer_id = nextCorrelationId();
+
+    ASSERT_EQ(addPublication(client_id, pub_id, CHANNEL_1 "|ssc=true", STREAM_ID_1, false), 0);
+    ASSERT_EQ(addSpySubscription(client_id, observer_id, CHANNEL_1 "|observer=true", STREAM_ID_1, -1), 0);
+    doWork();
+
+    aeron_network_publication_t *publication = aeron_driver_conductor_find_network_publication(
+        &m_conductor.m_conductor, pub_id);
+    ASSERT_NE(nullptr, publication);
+    EXPECT_EQ(aeron_network_publication_num_spy_subscribers(publication), 1u);
+    EXPECT_FALSE(aeron_network_publication_has_coupled_spies(publication));
+    EXPECT_FALSE(publication->has_spies);
+
+    ASSERT_EQ(addSpySubscription(client_id, spy_id, CHANNEL_1, STREAM_ID_1, -1), 0);
+    doWork();
+    ASSERT_EQ(aeron_network_publication_num_spy_subscribers(publication), 2u);
+    EXPECT_TRUE(aeron_network_publication_has_coupled_spies(publication));
+    readAllBroadcastsFromConductor(null_broadcast_handler);
+
+    aeron_tetherable_position_t *observer = nullptr;
+    aeron_tetherable_position_t *spy = nullptr;
+    for (size_t i = 0; i < publication->conductor_fields.subscribable.length; i++)
+    {
+        aeron_tetherable_position_t *position = &publication->conductor_fields.subscribable.array[i];
+        (position->is_observer ? observer : spy) = position;
+    }
+    ASSERT_NE(nullptr, observer);
+    ASSERT_NE(nullptr, spy);
+    EXPECT_FALSE(observer->is_tether);
+
+    const int64_t term_length = publication->term_length_mask + 1;
+    const int64_t sender_position = term_length * 2;
+    aeron_counter_set_ordered(publication->snd_pos_position.value_addr, sender_position);
+    aeron_counter_set_ordered(spy->value_addr, sender_position);
+
+    EXPECT_EQ(1, aeron_network_publication_update_pub_lmt(publication));
+    EXPECT_EQ(
+        sender_position + publication->term_window_length,
+        aeron_counter_get(publication->pub_lmt_position.value_addr));
+
+    doWorkForNs(
+        (int64_t)m_context.m_context->timer_interval_ns * 2,
+        10,
+        [&]()
+        {
+            clientKeepalive(client_id);
+        });
+    EXPECT_EQ(AERON_SUBSCRIPTION_TETHER_LINGER, observer->state);
+    EXPECT_EQ(AERON_SUBSCRIPTION_TETHER_ACTIVE, spy->state);
+
+    EXPECT_CALL(m_mockCallbacks, broadcastToClient(AERON_RESPONSE_ON_UNAVAILABLE_IMAGE, _, _))
+        .With(IsUnavailableImage(STREAM_ID_1, pub_id, observer_id, AERON_IPC_CHANNEL));
+    readAllBroadcastsFromConductor(mock_broadcast_handler);
+}
@@ -102,11 +102,17 @@ static void test_increment_nano_time(int64_t delta_ns)
 }
 
 static int test_malloc_map_raw_log(
-    aeron_mapped_raw_log_t *log, const char *path, bool use_sparse_file, uint64_t term_length, uint64_t page_size)
+    aeron_mapped_raw_log_t *log,
+    const char *path,
+    bool use_sparse_file,
+    bool use_huge_pages,
+    int32_t numa_node,
+    uint64_t term_length,
+    uint64_t page_size)
 {
     uint64_t log_length = aeron_logbuffer_compute_log_length(term_length, page_size);
 
-    log->mapped_file.length = 0;
+    log->mapped_file.length = (size_t)log_length;
     log->mapped_file.addr = malloc(log_length);
 
     memset(log->mapped_file.addr, 0, log_length);
@@ -416,6 +422,26 @@ public:
         return writeCommand(AERON_COMMAND_CLIENT_KEEPALIVE, sizeof(aeron_correlated_command_t));
     }
 
+    int closeClient(int64_t client_id)
+    {
+        aeron_correlated_command_t *cmd = reinterpret_cast<aeron_correlated_command_t *>(m_command_buffer);
+
+        cmd->client_id = client_id;
+        cmd->correlation_id = 0;
+
+        return writeCommand(AERON_COMMAND_CLIENT_CLOSE, sizeof(aeron_correlated_command_t));
+    }
+
+    int addDirectedResponses(int64_t client_id, int64_t correlation_id)
+    {
+        aeron_correlated_command_t *cmd = reinterpret_cast<aeron_correlated_command_t *>(m_command_buffer);
+
+        cmd->client_id = client_id;
+        cmd->correlation_id = correlation_id;
+
+        return writeCommand(AERON_COMMAND_ADD_DIRECTED_RESPONSES, sizeof(aeron_correlated_command_t));
+    }
+
     int addCounter(
         int64_t client_id,
         int64_t correlation_id,
@@ -21,6 +21,7 @@
 extern "C"
 {
 #include "aeronmd.h"
+#include "util/aeron_env.h"
 }
 
 class DriverConfigurationTest : public testing::Test
@@ -55,3 +56,87 @@ TEST_F(DriverConfigurationTest, shouldNotFindNonBuiltinFlowControlStrategies)
 {
     EXPECT_EQ(aeron_flow_control_strategy_supplier_by_name("should not be found"), nullptr);
 }
+
+TEST_F(DriverConfigurationTest, shouldDefaultIoVectorCapacities)
+{
+    EXPECT_EQ(2u, aeron_driver_context_get_network_publication_max_messages_per_send(m_context));
+    EXPECT_EQ(2u, aeron_driver_context_get_receiver_io_vector_capacity(m_context));
+    EXPECT_EQ(2u, aeron_driver_context_get_sender_io_vector_capacity(m_context));
+}
+
+TEST_F(DriverConfigurationTest, shouldParseAndClampIoVectorCapacitiesFromEnvironment)
+{
+    aeron_driver_context_t *context = nullptr;
+
+    aeron_env_set(AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND_ENV_VAR, "1000");
+    aeron_env_set(AERON_RECEIVER_IO_VECTOR_CAPACITY_ENV_VAR, "32");
+    aeron_env_set(AERON_SENDER_IO_VECTOR_CAPACITY_ENV_VAR, "0");
+    ASSERT_EQ(0, aeron_driver_context_init(&context));
+    aeron_env_unset(AERON_NETWORK_PUBLICATION_MAX_MESSAGES_PER_SEND_ENV_VAR);
+    aeron_env_unset(AERON_RECEIVER_IO_VECTOR_CAPACITY_ENV_VAR);
+    aeron_env_unset(AERON_SENDER_IO_VECTOR_CAPACITY_ENV_VAR);
+
+    EXPECT_EQ(64u, aeron_driver_context_get_network_publication_max_messages_per_send(context));
+    EXPECT_EQ(32u, aeron_driver_context_get_receiver_io_vector_capacity(context));
+    EXPECT_EQ(1u, aeron_driver_context_get_sender_io_vector_capacity(context));
+
+    aeron_driver_context_close(context);
+}
+
+TEST_F(DriverConfigurationTest, shouldParseAndClampReceiverShardCountFromEnvironment)
+{
+    aeron_driver_context_t *context = nullptr;
+
+    EXPECT_EQ(1u, aeron_driver_context_get_receiver_shard_count(m_context));
+
+    aeron_env_set(AERON_RECEIVER_SHARD_COUNT_ENV_VAR, "4");
+    ASSERT_EQ(0, aeron_driver_context_init(&context));
+    EXPECT_EQ(4u, aeron_driver_context_get_receiver_shard_count(context));
+    aeron_driver_context_close(context);
+
+    aeron_env_set(AERON_RECEIVER_SHARD_COUNT_ENV_VAR, "1000");
+    ASSERT_EQ(0, aeron_driver_context_init(&context));
+    aeron_env_unset(AERON_RECEIVER_SHARD_COUNT_ENV_VAR);
+    EXPECT_EQ(16u, aeron_driver_context_get_receiver_shard_count(context));
+    aeron_driver_context_close(context);
+}
+
+TEST_F(DriverConfigurationTest, shouldParseAndClampSenderShardCountFromEnvironment)
+{
+    aeron_driver_context_t *context = nullptr;
+
+    EXPECT_EQ(1u, aeron_driver_context_get_sender_shard_count(m_context));
+
+    aeron_env_set(AERON_SENDER_SHARD_COUNT_ENV_VAR, "3");
+    ASSERT_EQ(0, aeron_driver_context_init(&context));
+    EXPECT_EQ(3u, aeron_driver_context_get_sender_shard_count(context));
+    aeron_driver_context_close(context);
+
+    aeron_env_set(AERON_SENDER_SHARD_COUNT_ENV_VAR, "0");
+    ASSERT_EQ(0, aeron_driver_context_init(&context));
+    aeron_env_unset(AERON_SENDER_SHARD_COUNT_ENV_VAR);
+    EXPECT_EQ(1u, aeron_driver_context_get_sender_shard_count(context));
+    aeron_driver_context_close(context);
+}
+
+TEST_F(DriverConfigurationTest, shouldParseCubicCongestionControlFromEnvironment)
+{
+    aeron_driver_context_t *context = nullptr;
+
+    EXPECT_FALSE(aeron_driver_context_get_cubic_congestion_control_measure_rtt(m_context));
+    EXPECT_EQ(100 * 1000u, aeron_driver_context_get_cubic_congestion_control_initial_rtt_ns(m_context));
+    EXPECT_FALSE(aeron_driver_context_get_cubic_congestion_control_tcp_mode(m_context));
+
+    aeron_env_set(AERON_CUBICCONGESTIONCONTROL_MEASURERTT_ENV_VAR, "true");
+    aeron_env_set(AERON_CUBICCONGESTIONCONTROL_INITIALRTT_ENV_VAR, "2ms");
+    aeron_env_set(AERON_CUBICCONGESTIONCONTROL_TCPMODE_ENV_VAR, "true");
+    ASSERT_EQ(0, aeron_driver_context_init(&context));
+    aeron_env_unset(AERON_CUBICCONGESTIONCONTROL_MEASURERTT_ENV_VAR);
+    aeron_env_unset(AERON_CUBICCONGESTIONCONTROL_INITIALRTT_ENV_VAR);
+    aeron_env_unset(AERON_CUBICCONGESTIONCONTROL_TCPMODE_ENV_VAR);
+
+    EXPECT_TRUE(aeron_driver_context_get_cubic_congestion_control_measure_rtt(context));
+    EXPECT_EQ(2 * 1000 * 1000u, aeron_driver_context_get_cubic_congestion_control_initial_rtt_ns(context));
+    EXPECT_TRUE(aeron_driver_context_get_cubic_congestion_control_tcp_mode(context));
+    aeron_driver_context_close(context);
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "aeron_common.h"
+#include "util/aeron_fileutil.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+#include "aeron_driver_housekeeper.h"
+}
+
+#define TERM_LENGTH (AERON_LOGBUFFER_TERM_MIN_LENGTH)
+#define PAGE_SIZE (4 * 1024)
+
+class DriverHousekeeperTest : public testing::Test
+{
+public:
+    void SetUp() override
+    {
+        ASSERT_GT(aeron_temp_filename(m_path, sizeof(m_path)), 0u);
+        ASSERT_EQ(0, aeron_map_raw_log(
+            &m_mapped_raw_log, m_path, true, false, AERON_NUMA_NODE_NONE, TERM_LENGTH, PAGE_SIZE)) << aeron_errmsg();
+        ASSERT_EQ(0, aeron_driver_housekeeper_init(&m_housekeeper, nullptr));
+    }
+
+    void TearDown() override
+    {
+        aeron_driver_housekeeper_on_close(&m_housekeeper);
+        aeron_map_raw_log_close(&m_mapped_raw_log, m_path);
+        remove(m_path);
+    }
+
+protected:
+    char m_path[AERON_MAX_PATH] = {};
+    aeron_mapped_raw_log_t m_mapped_raw_log = {};
+    aeron_driver_housekeeper_t m_housekeeper = {};
+};
+
+TEST_F(DriverHousekeeperTest, shouldCloseLogOnDoWork)
+{
+    aeron_driver_housekeeper_close_log(&m_housekeeper, aeron_map_raw_log_close, &m_mapped_raw_log, m_path);
+    EXPECT_EQ(nullptr, m_mapped_raw_log.mapped_file.addr);
+    EXPECT_LT(0, aeron_file_length(m_path));
+    EXPECT_EQ(0, m_housekeeper.completed_count);
+
+    EXPECT_EQ(1, aeron_driver_housekeeper_do_work(&m_housekeeper));
+    EXPECT_EQ(1, m_housekeeper.completed_count);
+    EXPECT_EQ(-1, aeron_file_length(m_path));
+    EXPECT_EQ(0, aeron_driver_housekeeper_do_work(&m_housekeeper));
+}
+
+TEST_F(DriverHousekeeperTest, shouldCloseLogInlineWithoutHousekeeper)
+{
+    aeron_driver_housekeeper_close_log(nullptr, aeron_map_raw_log_close, &m_mapped_raw_log, m_path);
+
+    EXPECT_EQ(nullptr, m_mapped_raw_log.mapped_file.addr);
+    EXPECT_EQ(-1, aeron_file_length(m_path));
+}
+
+TEST_F(DriverHousekeeperTest, shouldCompleteQueuedTasksOnClose)
+{
+    aeron_driver_housekeeper_close_log(&m_housekeeper, aeron_map_raw_log_close, &m_mapped_raw_log, m_path);
+    EXPECT_LT(0, aeron_file_length(m_path));
+
+    aeron_driver_housekeeper_on_close(&m_housekeeper);
+    EXPECT_EQ(-1, aeron_file_length(m_path));
+
+    ASSERT_EQ(0, aeron_driver_housekeeper_init(&m_housekeeper, nullptr));
+}
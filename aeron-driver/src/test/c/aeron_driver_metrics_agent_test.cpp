@@ -0,0 +1,181 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "aeron_driver_metrics_agent.h"
+#include "concurrent/aeron_counters_manager.h"
+#include "reports/aeron_loss_reporter.h"
+#include "util/aeron_error.h"
+}
+
+#define COUNTERS_CAPACITY (16 * AERON_COUNTERS_MANAGER_VALUE_LENGTH)
+#define LOSS_REPORT_CAPACITY (1024)
+
+static int64_t null_epoch_clock()
+{
+    return 0;
+}
+
+class DriverMetricsAgentTest : public testing::Test
+{
+public:
+    void SetUp() override
+    {
+        m_metadata.fill(0);
+        m_values.fill(0);
+        m_loss_report.fill(0);
+
+        ASSERT_EQ(0, aeron_counters_manager_init(
+            &m_manager,
+            m_metadata.data(),
+            m_metadata.size(),
+            m_values.data(),
+            m_values.size(),
+            null_epoch_clock,
+            0));
+        ASSERT_EQ(0, aeron_loss_reporter_init(&m_loss_reporter, m_loss_report.data(), m_loss_report.size()));
+    }
+
+    void TearDown() override
+    {
+        aeron_driver_metrics_agent_on_close(&m_agent);
+        aeron_counters_manager_close(&m_manager);
+    }
+
+    int agentInit(const char *endpoint)
+    {
+        return aeron_driver_metrics_agent_init(
+            &m_agent,
+            endpoint,
+            m_metadata.data(),
+            m_metadata.size(),
+            m_values.data(),
+            m_values.size(),
+            m_loss_report.data(),
+            m_loss_report.size(),
+            nullptr);
+    }
+
+    std::string render()
+    {
+        EXPECT_EQ(0, aeron_driver_metrics_agent_render(&m_agent)) << aeron_errmsg();
+        return std::string(m_agent.response, m_agent.response_length);
+    }
+
+protected:
+    std::array<std::uint8_t, COUNTERS_CAPACITY * 2> m_metadata = {};
+    std::array<std::uint8_t, COUNTERS_CAPACITY> m_values = {};
+    std::array<std::uint8_t, LOSS_REPORT_CAPACITY> m_loss_report = {};
+    aeron_counters_manager_t m_manager = {};
+    aeron_loss_reporter_t m_loss_reporter = {};
+    aeron_driver_metrics_agent_t m_agent = {};
+};
+
+TEST_F(DriverMetricsAgentTest, shouldRenderAllocatedCountersWithEscapedLabels)
+{
+    const char *label = "pub-pos \"a\\b\"";
+    const int32_t counter_id = aeron_counters_manager_allocate(&m_manager, 1, nullptr, 0, label, strlen(label));
+    ASSERT_GE(counter_id, 0);
+    *aeron_counters_manager_addr(&m_manager, counter_id) = 42;
+
+    ASSERT_EQ(0, agentInit(nullptr)) << aeron_errmsg();
+    const std::string metrics = render();
+
+    EXPECT_NE(std::string::npos, metrics.find("# TYPE aeron_counter gauge\n"));
+    EXPECT_NE(
+        std::string::npos,
+        metrics.find("aeron_counter{id=\"0\",type_id=\"1\",label=\"pub-pos \\\"a\\\\b\\\"\"} 42\n")) << metrics;
+}
+
+TEST_F(DriverMetricsAgentTest, shouldRenderLossReportAsCumulativeHistograms)
+{
+    const char *channel = "aeron:udp?endpoint=localhost:40123";
+    const char *source = "127.0.0.1:40124";
+    aeron_loss_reporter_entry_offset_t offset = aeron_loss_reporter_create_entry(
+        &m_loss_reporter, 100, 0, 7, 1001, channel, strlen(channel), source, strlen(source));
+    ASSERT_GE(offset, 0);
+
+    aeron_loss_reporter_record_repair(&m_loss_reporter, offset, AERON_LOSS_REPORTER_REPAIR_RETRANSMIT, 100, 20 * 1000);
+    aeron_loss_reporter_record_repair(&m_loss_reporter, offset, AERON_LOSS_REPORTER_REPAIR_TIMEOUT, 10, 1000);
+
+    ASSERT_EQ(0, agentInit(nullptr)) << aeron_errmsg();
+    const std::string metrics = render();
+    const std::string labels =
+        "{session_id=\"7\",stream_id=\"1001\",channel=\"aeron:udp?endpoint=localhost:40123\",source=\"127.0.0.1:40124\"";
+
+    EXPECT_NE(std::string::npos, metrics.find("aeron_loss_bytes_total" + labels + "} 100\n")) << metrics;
+    EXPECT_NE(std::string::npos, metrics.find("aeron_loss_repairs_total" + labels + ",repair=\"retransmit\"} 1\n"));
+    EXPECT_NE(std::string::npos, metrics.find("aeron_loss_repairs_total" + labels + ",repair=\"timeout\"} 1\n"));
+    EXPECT_NE(std::string::npos, metrics.find("aeron_loss_gap_length_bytes_bucket" + labels + ",le=\"63\"} 1\n"));
+    EXPECT_NE(std::string::npos, metrics.find("aeron_loss_gap_length_bytes_bucket" + labels + ",le=\"127\"} 2\n"));
+    EXPECT_NE(std::string::npos, metrics.find("aeron_loss_gap_length_bytes_bucket" + labels + ",le=\"+Inf\"} 2\n"));
+    EXPECT_NE(std::string::npos, metrics.find("aeron_loss_gap_length_bytes_count" + labels + "} 2\n"));
+    EXPECT_LT(metrics.find("aeron_loss_bytes_total"), metrics.find("aeron_loss_repairs_total"));
+}
+
+TEST_F(DriverMetricsAgentTest, shouldServeMetricsOverHttp)
+{
+    const char *label = "Bytes sent";
+    const int32_t counter_id = aeron_counters_manager_allocate(&m_manager, 0, nullptr, 0, label, strlen(label));
+    ASSERT_GE(counter_id, 0);
+    *aeron_counters_manager_addr(&m_manager, counter_id) = 1234;
+
+    ASSERT_EQ(0, agentInit("127.0.0.1:0")) << aeron_errmsg();
+
+    struct sockaddr_in addr = {};
+    socklen_t addr_len = sizeof(addr);
+    ASSERT_EQ(0, getsockname(m_agent.listen_fd, (struct sockaddr *)&addr, &addr_len));
+
+    std::string response;
+    std::thread client(
+        [&]()
+        {
+            aeron_socket_t fd = aeron_socket(AF_INET, SOCK_STREAM, 0);
+            ASSERT_GE(fd, 0);
+            ASSERT_EQ(0, connect(fd, (struct sockaddr *)&addr, addr_len));
+
+            const char *request = "GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n";
+            ASSERT_EQ((ssize_t)strlen(request), send(fd, request, (int)strlen(request), 0));
+
+            char buffer[1024];
+            ssize_t received;
+            while ((received = recv(fd, buffer, sizeof(buffer), 0)) > 0)
+            {
+                response.append(buffer, (size_t)received);
+            }
+
+            aeron_close_socket(fd);
+        });
+
+    int work_count = 0;
+    while (0 == work_count)
+    {
+        work_count = aeron_driver_metrics_agent_do_work(&m_agent);
+        std::this_thread::yield();
+    }
+
+    client.join();
+
+    EXPECT_EQ(0u, response.find("HTTP/1.1 200 OK\r\n")) << response;
+    EXPECT_NE(std::string::npos, response.find("aeron_counter{id=\"0\",type_id=\"0\",label=\"Bytes sent\"} 1234\n"));
+}
@@ -0,0 +1,200 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "EmbeddedMediaDriver.h"
+
+extern "C"
+{
+#include "aeronc.h"
+#include "aeron_driver_recorder.h"
+#include "protocol/aeron_udp_protocol.h"
+#include "util/aeron_error.h"
+#include "util/aeron_fileutil.h"
+}
+
+#define RECORDED_URI "aeron:ipc"
+#define STREAM_ID (1001)
+#define TERM_LENGTH (64 * 1024)
+#define SEGMENT_LENGTH (2 * TERM_LENGTH)
+#define MESSAGE_LENGTH (100)
+#define MESSAGE_COUNT (10)
+
+using namespace aeron;
+
+class RecordingMediaDriver : public EmbeddedMediaDriver
+{
+public:
+    RecordingMediaDriver(std::string aeronDir, std::string recorderDir) :
+        m_aeronDir(std::move(aeronDir)), m_recorderDir(std::move(recorderDir))
+    {
+    }
+
+protected:
+    void configure(aeron_driver_context_t *context) override
+    {
+        aeron_driver_context_set_dir(context, m_aeronDir.c_str());
+        aeron_driver_context_set_ipc_term_buffer_length(context, TERM_LENGTH);
+        aeron_driver_context_set_recorder_channel(context, RECORDED_URI);
+        aeron_driver_context_set_recorder_stream_id(context, STREAM_ID);
+        aeron_driver_context_set_recorder_dir(context, m_recorderDir.c_str());
+        aeron_driver_context_set_recorder_segment_length(context, SEGMENT_LENGTH);
+    }
+
+private:
+    std::string m_aeronDir;
+    std::string m_recorderDir;
+};
+
+class DriverRecorderTest : public testing::Test
+{
+public:
+    void SetUp() override
+    {
+        char dir[AERON_MAX_PATH];
+        ASSERT_GT(aeron_temp_filename(dir, sizeof(dir)), 0u);
+        m_aeronDir = std::string(dir) + "-driver";
+        m_recorderDir = std::string(dir) + "-recordings";
+    }
+
+    void TearDown() override
+    {
+        closeClient();
+        aeron_delete_directory(m_recorderDir.c_str());
+    }
+
+    void connect(const char *aeronDir)
+    {
+        ASSERT_EQ(0, aeron_context_init(&m_context));
+        ASSERT_EQ(0, aeron_context_set_dir(m_context, aeronDir));
+        ASSERT_EQ(0, aeron_init(&m_aeron, m_context)) << aeron_errmsg();
+        ASSERT_EQ(0, aeron_start(m_aeron)) << aeron_errmsg();
+    }
+
+    void closeClient()
+    {
+        aeron_close(m_aeron);
+        m_aeron = nullptr;
+        aeron_context_close(m_context);
+        m_context = nullptr;
+    }
+
+    std::vector<uint8_t> readFile(const std::string &path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    std::string catalogPath()
+    {
+        return m_recorderDir + "/" + AERON_DRIVER_RECORDER_CATALOG_FILE;
+    }
+
+    template<typename Predicate>
+    static bool awaitCondition(Predicate predicate)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+
+        while (!predicate())
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                return false;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        return true;
+    }
+
+protected:
+    std::string m_aeronDir;
+    std::string m_recorderDir;
+    aeron_context_t *m_context = nullptr;
+    aeron_t *m_aeron = nullptr;
+};
+
+TEST_F(DriverRecorderTest, shouldRecordPublicationToSegmentFileAndCatalog)
+{
+    RecordingMediaDriver driver(m_aeronDir, m_recorderDir);
+    driver.start();
+    connect(driver.directory());
+
+    aeron_async_add_publication_t *async = nullptr;
+    aeron_publication_t *publication = nullptr;
+    ASSERT_EQ(0, aeron_async_add_publication(&async, m_aeron, RECORDED_URI, STREAM_ID));
+    ASSERT_TRUE(awaitCondition([&]() { return 0 != aeron_async_add_publication_poll(&publication, async); }));
+    ASSERT_NE(nullptr, publication) << aeron_errmsg();
+
+    ASSERT_TRUE(awaitCondition(
+        [&]() { return readFile(catalogPath()).size() >= sizeof(aeron_driver_recorder_catalog_entry_t); }));
+    ASSERT_TRUE(awaitCondition([&]() { return aeron_publication_is_connected(publication); }));
+
+    uint8_t message[MESSAGE_LENGTH];
+    for (int i = 0; i < MESSAGE_COUNT; i++)
+    {
+        memset(message, 'a' + i, sizeof(message));
+        ASSERT_TRUE(awaitCondition(
+            [&]() { return aeron_publication_offer(publication, message, sizeof(message), nullptr, nullptr) > 0; }));
+    }
+
+    const size_t frameLength = AERON_ALIGN(AERON_DATA_HEADER_LENGTH + MESSAGE_LENGTH, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    const std::string segmentPath = m_recorderDir + "/0-0" + AERON_DRIVER_RECORDER_SEGMENT_FILE_SUFFIX;
+    ASSERT_TRUE(awaitCondition([&]() { return readFile(segmentPath).size() >= MESSAGE_COUNT * frameLength; }));
+
+    closeClient();
+    driver.joinAndClose();
+
+    std::vector<uint8_t> catalog = readFile(catalogPath());
+    ASSERT_GE(catalog.size(), sizeof(aeron_driver_recorder_catalog_entry_t));
+    aeron_driver_recorder_catalog_entry_t entry;
+    memcpy(&entry, catalog.data(), sizeof(entry));
+
+    EXPECT_EQ(0, entry.recording_id);
+    EXPECT_EQ(STREAM_ID, entry.stream_id);
+    EXPECT_EQ(TERM_LENGTH, entry.term_buffer_length);
+    EXPECT_EQ(SEGMENT_LENGTH, entry.segment_file_length);
+    EXPECT_EQ(0, entry.start_position);
+    EXPECT_EQ((int64_t)(MESSAGE_COUNT * frameLength), entry.stop_position);
+    EXPECT_NE(AERON_NULL_VALUE, entry.stop_timestamp);
+    EXPECT_STREQ(RECORDED_URI, entry.channel);
+
+    std::vector<uint8_t> segment = readFile(segmentPath);
+    for (int i = 0; i < MESSAGE_COUNT; i++)
+    {
+        const auto *header = reinterpret_cast<const aeron_data_header_t *>(segment.data() + (i * frameLength));
+        EXPECT_EQ(AERON_HDR_TYPE_DATA, header->frame_header.type);
+        EXPECT_EQ((int32_t)(AERON_DATA_HEADER_LENGTH + MESSAGE_LENGTH), header->frame_header.frame_length);
+        EXPECT_EQ('a' + i, segment[(i * frameLength) + AERON_DATA_HEADER_LENGTH]);
+    }
+}
+
+TEST_F(DriverRecorderTest, shouldRejectSegmentLengthWhichIsNotPowerOfTwo)
+{
+    aeron_driver_recorder_t recorder;
+
+    EXPECT_EQ(-1, aeron_driver_recorder_init(
+        &recorder, m_aeronDir.c_str(), RECORDED_URI, STREAM_ID, m_recorderDir.c_str(), 3 * TERM_LENGTH, nullptr));
+    aeron_driver_recorder_on_close(&recorder);
+}
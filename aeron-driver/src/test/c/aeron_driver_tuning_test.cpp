@@ -0,0 +1,90 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+#include <utility>
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "aeron_driver_context.h"
+#include "aeron_driver_tuning.h"
+}
+
+#define METADATA_LENGTH (16 * 1024)
+#define VALUES_LENGTH (METADATA_LENGTH / 2)
+
+class DriverTuningTest : public testing::Test
+{
+public:
+    DriverTuningTest()
+    {
+        aeron_driver_context_init(&m_context);
+        aeron_counters_manager_init(
+            &m_counters,
+            &m_buffer[0], METADATA_LENGTH,
+            &m_buffer[METADATA_LENGTH], VALUES_LENGTH,
+            aeron_epoch_clock, 1000);
+    }
+
+    ~DriverTuningTest() override
+    {
+        aeron_counters_manager_close(&m_counters);
+        aeron_driver_context_close(m_context);
+    }
+
+protected:
+    static void onChange(void *clientd, aeron_driver_tuning_param_t param, int64_t value)
+    {
+        static_cast<DriverTuningTest *>(clientd)->m_changes.emplace_back(param, value);
+    }
+
+    aeron_driver_context_t *m_context = nullptr;
+    aeron_counters_manager_t m_counters = {};
+    aeron_driver_tuning_t m_tuning = {};
+    uint8_t m_buffer[METADATA_LENGTH + VALUES_LENGTH] = {};
+    std::vector<std::pair<aeron_driver_tuning_param_t, int64_t>> m_changes;
+};
+
+TEST_F(DriverTuningTest, shouldPublishCurrentValuesAndReportChanges)
+{
+    ASSERT_EQ(0, aeron_driver_tuning_init(&m_tuning, &m_counters, m_context));
+
+    int64_t *ratio = m_tuning.counter_addrs[AERON_DRIVER_TUNING_SEND_TO_SM_POLL_RATIO];
+    EXPECT_EQ((int64_t)m_context->send_to_sm_poll_ratio, *ratio);
+    EXPECT_EQ(0, aeron_driver_tuning_poll(&m_tuning, onChange, this));
+
+    *ratio = 7;
+    EXPECT_EQ(1, aeron_driver_tuning_poll(&m_tuning, onChange, this));
+    ASSERT_EQ(1u, m_changes.size());
+    EXPECT_EQ(AERON_DRIVER_TUNING_SEND_TO_SM_POLL_RATIO, m_changes[0].first);
+    EXPECT_EQ(7, m_changes[0].second);
+
+    EXPECT_EQ(0, aeron_driver_tuning_poll(&m_tuning, onChange, this));
+}
+
+TEST_F(DriverTuningTest, shouldRestoreCounterWhenValueOutOfRange)
+{
+    ASSERT_EQ(0, aeron_driver_tuning_init(&m_tuning, &m_counters, m_context));
+
+    int64_t *timeout = m_tuning.counter_addrs[AERON_DRIVER_TUNING_STATUS_MESSAGE_TIMEOUT_NS];
+    const int64_t original = *timeout;
+
+    *timeout = -1;
+    EXPECT_EQ(0, aeron_driver_tuning_poll(&m_tuning, onChange, this));
+    EXPECT_TRUE(m_changes.empty());
+    EXPECT_EQ(original, *timeout);
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "aeron_duty_cycle_tracker.h"
+#include "util/aeron_clock.h"
+}
+
+#define METADATA_LENGTH (32 * 1024)
+#define VALUES_LENGTH (METADATA_LENGTH / 2)
+#define ERROR_LOG_LENGTH (8192)
+
+class DutyCycleTrackerTest : public testing::Test
+{
+public:
+    void SetUp() override
+    {
+        ASSERT_EQ(0, aeron_counters_manager_init(
+            &m_counters_manager,
+            m_counters_buffer, METADATA_LENGTH,
+            m_counters_buffer + METADATA_LENGTH, VALUES_LENGTH,
+            aeron_epoch_clock, 1000));
+        ASSERT_EQ(0, aeron_system_counters_init(&m_system_counters, &m_counters_manager));
+        ASSERT_EQ(0, aeron_distinct_error_log_init(
+            &m_error_log,
+            m_error_log_buffer,
+            ERROR_LOG_LENGTH,
+            aeron_epoch_clock,
+            [](void *clientd, uint8_t *resource){},
+            nullptr));
+
+        aeron_duty_cycle_tracker_init(
+            &m_tracker,
+            &m_system_counters,
+            AERON_SYSTEM_COUNTER_SENDER_MAX_CYCLE_TIME,
+            5 * 1000 * 1000LL,
+            &m_error_log,
+            "sender");
+    }
+
+    void TearDown() override
+    {
+        aeron_distinct_error_log_close(&m_error_log);
+        aeron_system_counters_close(&m_system_counters);
+        aeron_counters_manager_close(&m_counters_manager);
+    }
+
+    int64_t counter(aeron_system_counter_enum_t type)
+    {
+        return aeron_counter_get(aeron_system_counter_addr(&m_system_counters, type));
+    }
+
+    static void errorCounter(
+        int32_t observation_count,
+        int64_t first_observation_timestamp,
+        int64_t last_observation_timestamp,
+        const char *error,
+        size_t error_length,
+        void *clientd)
+    {
+        *static_cast<int32_t *>(clientd) += observation_count;
+    }
+
+protected:
+    aeron_counters_manager_t m_counters_manager = {};
+    aeron_system_counters_t m_system_counters = {};
+    aeron_distinct_error_log_t m_error_log = {};
+    aeron_duty_cycle_tracker_t m_tracker = {};
+    uint8_t m_counters_buffer[METADATA_LENGTH + VALUES_LENGTH] = {};
+    uint8_t m_error_log_buffer[ERROR_LOG_LENGTH] = {};
+};
+
+TEST_F(DutyCycleTrackerTest, shouldTrackMaxCycleTimeAndHistogram)
+{
+    aeron_duty_cycle_tracker_update(&m_tracker, 5 * 1000LL);
+    aeron_duty_cycle_tracker_update(&m_tracker, 10 * 1000LL);
+    aeron_duty_cycle_tracker_update(&m_tracker, 50 * 1000LL);
+    aeron_duty_cycle_tracker_update(&m_tracker, 2 * 1000 * 1000LL);
+    aeron_duty_cycle_tracker_update(&m_tracker, 1000 * 1000LL);
+
+    EXPECT_EQ(2 * 1000 * 1000LL, counter(AERON_SYSTEM_COUNTER_SENDER_MAX_CYCLE_TIME));
+    EXPECT_EQ(2, counter(AERON_SYSTEM_COUNTER_SENDER_CYCLE_TIME_10US));
+    EXPECT_EQ(1, counter(AERON_SYSTEM_COUNTER_SENDER_CYCLE_TIME_100US));
+    EXPECT_EQ(1, counter(AERON_SYSTEM_COUNTER_SENDER_CYCLE_TIME_1MS));
+    EXPECT_EQ(1, counter(AERON_SYSTEM_COUNTER_SENDER_CYCLE_TIME_10MS));
+    EXPECT_EQ(0, counter(AERON_SYSTEM_COUNTER_SENDER_CYCLE_TIME_OVER_10MS));
+    EXPECT_EQ(0, counter(AERON_SYSTEM_COUNTER_SENDER_CYCLE_TIME_THRESHOLD_EXCEEDED));
+    EXPECT_EQ(0, counter(AERON_SYSTEM_COUNTER_CONDUCTOR_MAX_CYCLE_TIME));
+    EXPECT_EQ(0, counter(AERON_SYSTEM_COUNTER_RECEIVER_MAX_CYCLE_TIME));
+}
+
+TEST_F(DutyCycleTrackerTest, shouldCountAndLogCyclesExceedingThreshold)
+{
+    aeron_duty_cycle_tracker_update(&m_tracker, 20 * 1000 * 1000LL);
+    aeron_duty_cycle_tracker_update(&m_tracker, 6 * 1000 * 1000LL);
+
+    EXPECT_EQ(2, counter(AERON_SYSTEM_COUNTER_SENDER_CYCLE_TIME_THRESHOLD_EXCEEDED));
+    EXPECT_EQ(1, counter(AERON_SYSTEM_COUNTER_SENDER_CYCLE_TIME_OVER_10MS));
+    EXPECT_EQ(20 * 1000 * 1000LL, counter(AERON_SYSTEM_COUNTER_SENDER_MAX_CYCLE_TIME));
+
+    int32_t observations = 0;
+    aeron_error_log_read(m_error_log_buffer, ERROR_LOG_LENGTH, errorCounter, &observations, 0);
+    EXPECT_EQ(2, observations);
+}
+
+static int do_work_once(void *state)
+{
+    (*static_cast<int *>(state))++;
+    return 3;
+}
+
+TEST_F(DutyCycleTrackerTest, shouldMeasureWorkCycleOfSharedAgent)
+{
+    int calls = 0;
+
+    EXPECT_EQ(3, aeron_duty_cycle_tracker_do_work(&m_tracker, do_work_once, &calls));
+    EXPECT_EQ(1, calls);
+
+    int64_t histogram_total = 0;
+    for (int i = 0; i < AERON_DUTY_CYCLE_TRACKER_BUCKET_COUNT; i++)
+    {
+        histogram_total += aeron_counter_get(m_tracker.cycle_time_counters[i]);
+    }
+
+    EXPECT_EQ(1, histogram_total);
+}
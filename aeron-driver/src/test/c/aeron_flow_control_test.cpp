@@ -151,6 +151,10 @@ class MaxFlowControlTest : public FlowControlTest
 {
 };
 
+class QuorumFlowControlTest : public FlowControlTest
+{
+};
+
 class ParameterisedSuccessfulOptionsParsingTest :
     public testing::TestWithParam<std::tuple<const char *, const char *, uint64_t, bool, int32_t, bool, int32_t>>
 {
@@ -231,6 +235,37 @@ TEST_F(MinFlowControlTest, shouldTimeoutWithMinStrategy)
     ASSERT_EQ(sender_limit, m_strategy->on_idle(m_strategy->state, 701 * 1000000, sender_limit, 0, false));
 }
 
+TEST_F(MinFlowControlTest, shouldTrackMinimumAndTimeoutsAcrossManyReceivers)
+{
+    const int64_t sender_limit = 0;
+    const int receiver_count = 100;
+    initialise_channel("aeron:udp?endpoint=224.20.30.39:24326|interface=localhost|fc=min,t:500ms");
+
+    ASSERT_EQ(0, aeron_default_multicast_flow_control_strategy_supplier(
+        &m_strategy, context,
+        m_channel,
+        1001, 1001, 0, 64 * 1024));
+    ASSERT_FALSE(nullptr == m_strategy);
+
+    for (int i = 0; i < receiver_count; i++)
+    {
+        const int32_t position = (receiver_count - i) * 64;
+        ASSERT_EQ(WINDOW_LENGTH + position, apply_status_message(m_strategy, i, position, 0, i * 1000000LL));
+    }
+
+    const int32_t last_position = 64;
+    ASSERT_EQ(WINDOW_LENGTH + 2 * last_position, apply_status_message(
+        m_strategy, receiver_count - 1, (receiver_count + 1) * 64, 0, receiver_count * 1000000LL));
+
+    ASSERT_EQ(
+        WINDOW_LENGTH + 2 * last_position,
+        m_strategy->on_idle(m_strategy->state, 549 * 1000000LL, sender_limit, 0, false));
+    ASSERT_EQ(
+        WINDOW_LENGTH + (receiver_count + 1) * 64,
+        m_strategy->on_idle(m_strategy->state, 599 * 1000000LL, sender_limit, 0, false));
+    ASSERT_EQ(sender_limit, m_strategy->on_idle(m_strategy->state, 601 * 1000000LL, sender_limit, 0, false));
+}
+
 TEST_F(MaxFlowControlTest, shouldFallbackToMaxStrategy)
 {
     initialise_channel("aeron:udp?endpoint=224.20.30.39:24326|interface=localhost");
@@ -519,6 +554,99 @@ TEST_F(TaggedFlowControlTest, shouldUseSenderLimitWhenRequiredReceiversNotMet)
     ASSERT_EQ(term_offset + WINDOW_LENGTH, m_strategy->on_idle(m_strategy->state, 0, sender_limit, 0, false));
 }
 
+TEST_F(QuorumFlowControlTest, shouldBehaveAsMinWithoutQuorum)
+{
+    initialise_channel("aeron:udp?endpoint=224.20.30.39:24326|interface=localhost|fc=quorum");
+
+    ASSERT_EQ(0, aeron_default_multicast_flow_control_strategy_supplier(
+        &m_strategy, context, m_channel,
+        1001, 1001, 0, 64 * 1024));
+
+    ASSERT_EQ(WINDOW_LENGTH + 1000, apply_status_message(m_strategy, 1, 1000, -1));
+    ASSERT_EQ(WINDOW_LENGTH + 1000, apply_status_message(m_strategy, 2, 2000, -1));
+    ASSERT_EQ(WINDOW_LENGTH + 994, apply_status_message(m_strategy, 3, 994, -1));
+}
+
+TEST_F(QuorumFlowControlTest, shouldUseWindowOfKthFastestReceiver)
+{
+    initialise_channel("aeron:udp?endpoint=224.20.30.39:24326|interface=localhost|fc=quorum,q:2");
+
+    ASSERT_EQ(0, aeron_default_multicast_flow_control_strategy_supplier(
+        &m_strategy, context, m_channel,
+        1001, 1001, 0, 64 * 1024));
+
+    ASSERT_EQ(WINDOW_LENGTH + 1000, apply_status_message(m_strategy, 1, 1000, -1));
+    ASSERT_EQ(WINDOW_LENGTH + 1000, apply_status_message(m_strategy, 2, 3000, -1));
+    ASSERT_EQ(WINDOW_LENGTH + 2000, apply_status_message(m_strategy, 3, 2000, -1));
+    ASSERT_EQ(WINDOW_LENGTH + 2000, m_strategy->on_idle(m_strategy->state, 0, 0, 0, false));
+}
+
+TEST_F(QuorumFlowControlTest, shouldUseWindowOfReceiverAtPercentile)
+{
+    initialise_channel("aeron:udp?endpoint=224.20.30.39:24326|interface=localhost|fc=quorum,q:75%");
+
+    ASSERT_EQ(0, aeron_default_multicast_flow_control_strategy_supplier(
+        &m_strategy, context, m_channel,
+        1001, 1001, 0, 64 * 1024));
+
+    for (int32_t i = 1; i <= 4; i++)
+    {
+        apply_status_message(m_strategy, i, i * 1000, -1);
+    }
+
+    ASSERT_EQ(WINDOW_LENGTH + 2000, m_strategy->on_idle(m_strategy->state, 0, 0, 0, false));
+}
+
+TEST_F(QuorumFlowControlTest, shouldDropReceiversLaggingBeyondMaxLag)
+{
+    initialise_channel("aeron:udp?endpoint=224.20.30.39:24326|interface=localhost|fc=quorum,l:1500");
+
+    ASSERT_EQ(0, aeron_default_multicast_flow_control_strategy_supplier(
+        &m_strategy, context, m_channel,
+        1001, 1001, 0, 64 * 1024));
+
+    ASSERT_EQ(WINDOW_LENGTH + 1000, apply_status_message(m_strategy, 1, 1000, -1));
+    ASSERT_EQ(WINDOW_LENGTH + 4000, apply_status_message(m_strategy, 2, 4000, -1));
+    ASSERT_EQ(WINDOW_LENGTH + 3000, apply_status_message(m_strategy, 3, 3000, -1));
+    ASSERT_EQ(WINDOW_LENGTH + 3000, m_strategy->on_idle(m_strategy->state, 0, 0, 0, false));
+}
+
+TEST_F(QuorumFlowControlTest, shouldUseSenderLimitWhenRequiredReceiversNotMet)
+{
+    initialise_channel("aeron:udp?endpoint=224.20.30.39:24326|interface=localhost|fc=quorum,q:1,g:/2");
+
+    ASSERT_EQ(0, aeron_default_multicast_flow_control_strategy_supplier(
+        &m_strategy, context, m_channel,
+        1001, 1001, 0, 64 * 1024));
+
+    int sender_limit = 500;
+
+    ASSERT_EQ(sender_limit, apply_status_message(m_strategy, 1, 1000, -1, 0, false, sender_limit));
+    ASSERT_FALSE(m_strategy->has_required_receivers(m_strategy));
+    ASSERT_EQ(2000 + WINDOW_LENGTH, apply_status_message(m_strategy, 2, 2000, -1, 0, false, sender_limit));
+    ASSERT_TRUE(m_strategy->has_required_receivers(m_strategy));
+}
+
+TEST_F(FlowControlTest, shouldParseQuorumOptions)
+{
+    aeron_flow_control_tagged_options_t options;
+    const char *count_options = "quorum,q:3,l:64k";
+    const char *percentile_options = "quorum,q:90%";
+
+    ASSERT_EQ(1, aeron_flow_control_parse_tagged_options(strlen(count_options), count_options, &options));
+    EXPECT_TRUE(options.quorum.is_present);
+    EXPECT_FALSE(options.quorum.is_percentile);
+    EXPECT_EQ(3, options.quorum.value);
+    EXPECT_TRUE(options.max_lag.is_present);
+    EXPECT_EQ(64u * 1024u, options.max_lag.value);
+
+    ASSERT_EQ(1, aeron_flow_control_parse_tagged_options(strlen(percentile_options), percentile_options, &options));
+    EXPECT_TRUE(options.quorum.is_present);
+    EXPECT_TRUE(options.quorum.is_percentile);
+    EXPECT_EQ(90, options.quorum.value);
+    EXPECT_FALSE(options.max_lag.is_present);
+}
+
 TEST_P(ParameterisedSuccessfulOptionsParsingTest, shouldBeValid)
 {
     const char* fc_options = std::get<0>(GetParam());
@@ -600,4 +728,8 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_tuple("min,o:-1", -EINVAL),
         std::make_tuple("tagged,g:1/", -EINVAL),
         std::make_tuple("tagged,g:", -EINVAL),
-        std::make_tuple("tagged,g:/", -EINVAL)));
+        std::make_tuple("tagged,g:/", -EINVAL),
+        std::make_tuple("quorum,q:0", -EINVAL),
+        std::make_tuple("quorum,q:101%", -EINVAL),
+        std::make_tuple("quorum,q:5%%", -EINVAL),
+        std::make_tuple("quorum,l:1x", -EINVAL)));
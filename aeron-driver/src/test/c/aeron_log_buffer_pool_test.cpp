@@ -0,0 +1,173 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include <unistd.h>
+#include "aeron_common.h"
+#include "util/aeron_error.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+#include "aeron_log_buffer_pool.h"
+}
+
+#define TERM_LENGTH (AERON_LOGBUFFER_TERM_MIN_LENGTH)
+#define PAGE_SIZE (4 * 1024)
+#define CAPACITY (2)
+
+class LogBufferPoolTest : public testing::Test
+{
+public:
+    void SetUp() override
+    {
+        char dir[AERON_MAX_PATH];
+        ASSERT_GT(aeron_temp_filename(dir, sizeof(dir)), 0u);
+        m_dir = dir;
+        ASSERT_EQ(0, aeron_mkdir(m_dir.c_str(), S_IRWXU));
+        ASSERT_EQ(0, aeron_log_buffer_pool_init(&m_pool, m_dir.c_str(), CAPACITY)) << aeron_errmsg();
+    }
+
+    void TearDown() override
+    {
+        aeron_log_buffer_pool_close(&m_pool);
+        aeron_delete_directory(m_dir.c_str());
+    }
+
+    std::string logPath(int64_t id)
+    {
+        return m_dir + "/" + std::to_string(id) + ".logbuffer";
+    }
+
+    void mapLog(aeron_mapped_raw_log_t *mapped_raw_log, const std::string &path, uint64_t term_length)
+    {
+        ASSERT_EQ(0, aeron_map_raw_log(
+            mapped_raw_log, path.c_str(), true, false, AERON_NUMA_NODE_NONE, term_length, PAGE_SIZE)) << aeron_errmsg();
+    }
+
+    void cleanAll()
+    {
+        while (aeron_log_buffer_pool_do_work(&m_pool) > 0)
+        {
+        }
+    }
+
+protected:
+    std::string m_dir;
+    aeron_log_buffer_pool_t m_pool = {};
+};
+
+TEST_F(LogBufferPoolTest, shouldReuseReleasedLogOnceCleaned)
+{
+    aeron_mapped_raw_log_t released = {};
+    aeron_mapped_raw_log_t acquired = {};
+    mapLog(&released, logPath(1), TERM_LENGTH);
+    ((uint8_t *)released.term_buffers[0].addr)[0] = 0x7f;
+    void *addr = released.mapped_file.addr;
+
+    ASSERT_EQ(1, aeron_log_buffer_pool_release(&m_pool, &released, logPath(1).c_str()));
+    EXPECT_EQ(nullptr, released.mapped_file.addr);
+    EXPECT_NE(0, access(logPath(1).c_str(), F_OK));
+    EXPECT_EQ(0, aeron_log_buffer_pool_acquire(&m_pool, &acquired, logPath(2).c_str(), TERM_LENGTH, PAGE_SIZE));
+
+    cleanAll();
+
+    ASSERT_EQ(1, aeron_log_buffer_pool_acquire(&m_pool, &acquired, logPath(2).c_str(), TERM_LENGTH, PAGE_SIZE));
+    EXPECT_EQ(addr, acquired.mapped_file.addr);
+    EXPECT_EQ(0, ((uint8_t *)acquired.term_buffers[0].addr)[0]);
+    EXPECT_EQ(0, access(logPath(2).c_str(), F_OK));
+
+    aeron_map_raw_log_close(&acquired, logPath(2).c_str());
+}
+
+TEST_F(LogBufferPoolTest, shouldNotAcquireLogOfDifferentTermLength)
+{
+    aeron_mapped_raw_log_t released = {};
+    aeron_mapped_raw_log_t acquired = {};
+    mapLog(&released, logPath(1), TERM_LENGTH);
+
+    ASSERT_EQ(1, aeron_log_buffer_pool_release(&m_pool, &released, logPath(1).c_str()));
+    cleanAll();
+
+    EXPECT_EQ(0, aeron_log_buffer_pool_acquire(&m_pool, &acquired, logPath(2).c_str(), TERM_LENGTH * 2, PAGE_SIZE));
+}
+
+TEST_F(LogBufferPoolTest, shouldNotReleaseWhenFull)
+{
+    aeron_mapped_raw_log_t logs[CAPACITY + 1] = {};
+
+    for (int i = 0; i < CAPACITY + 1; i++)
+    {
+        mapLog(&logs[i], logPath(i), TERM_LENGTH);
+    }
+
+    EXPECT_EQ(1, aeron_log_buffer_pool_release(&m_pool, &logs[0], logPath(0).c_str()));
+    EXPECT_EQ(1, aeron_log_buffer_pool_release(&m_pool, &logs[1], logPath(1).c_str()));
+    EXPECT_EQ(0, aeron_log_buffer_pool_release(&m_pool, &logs[2], logPath(2).c_str()));
+
+    aeron_map_raw_log_close(&logs[2], logPath(2).c_str());
+}
+
+TEST_F(LogBufferPoolTest, shouldAdoptLogsFromSetAsideDirectory)
+{
+    const std::string warmDir = m_dir + AERON_LOG_BUFFER_POOL_WARM_DIR_SUFFIX;
+    const std::string publicationsDir = warmDir + "/" + AERON_PUBLICATIONS_DIR;
+    const std::string logPathInWarmDir = publicationsDir + "/1.logbuffer";
+    aeron_mapped_raw_log_t previous = {};
+    aeron_mapped_raw_log_t acquired = {};
+
+    ASSERT_EQ(0, aeron_mkdir(warmDir.c_str(), S_IRWXU));
+    ASSERT_EQ(0, aeron_mkdir(publicationsDir.c_str(), S_IRWXU));
+    mapLog(&previous, logPathInWarmDir, TERM_LENGTH);
+    aeron_logbuffer_metadata_t *log_meta_data = (aeron_logbuffer_metadata_t *)previous.log_meta_data.addr;
+    log_meta_data->term_length = TERM_LENGTH;
+    log_meta_data->page_size = PAGE_SIZE;
+    ((uint8_t *)previous.term_buffers[1].addr)[0] = 0x7f;
+    aeron_unmap(&previous.mapped_file);
+
+    EXPECT_EQ(1, aeron_log_buffer_pool_adopt_set_aside_dir(&m_pool, m_dir.c_str()));
+    EXPECT_FALSE(aeron_is_directory(warmDir.c_str()));
+
+    cleanAll();
+
+    ASSERT_EQ(1, aeron_log_buffer_pool_acquire(&m_pool, &acquired, logPath(2).c_str(), TERM_LENGTH, PAGE_SIZE));
+    EXPECT_EQ(0, ((uint8_t *)acquired.term_buffers[1].addr)[0]);
+
+    aeron_map_raw_log_close(&acquired, logPath(2).c_str());
+}
+
+TEST_F(LogBufferPoolTest, shouldKeepPooledLogsWhenRetainedOnClose)
+{
+    aeron_mapped_raw_log_t released = {};
+    mapLog(&released, logPath(1), TERM_LENGTH);
+    aeron_logbuffer_metadata_t *log_meta_data = (aeron_logbuffer_metadata_t *)released.log_meta_data.addr;
+    log_meta_data->term_length = TERM_LENGTH;
+    log_meta_data->page_size = PAGE_SIZE;
+
+    ASSERT_EQ(1, aeron_log_buffer_pool_release(&m_pool, &released, logPath(1).c_str()));
+    cleanAll();
+
+    m_pool.retain_on_close = true;
+    aeron_log_buffer_pool_close(&m_pool);
+
+    ASSERT_EQ(1, aeron_log_buffer_pool_set_aside_dir(m_dir.c_str()));
+    ASSERT_EQ(0, aeron_mkdir(m_dir.c_str(), S_IRWXU));
+    ASSERT_EQ(0, aeron_log_buffer_pool_init(&m_pool, m_dir.c_str(), CAPACITY)) << aeron_errmsg();
+
+    EXPECT_EQ(1, aeron_log_buffer_pool_adopt_set_aside_dir(&m_pool, m_dir.c_str()));
+}
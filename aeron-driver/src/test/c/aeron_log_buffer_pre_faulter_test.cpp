@@ -0,0 +1,83 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "aeron_common.h"
+#include "util/aeron_fileutil.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+#include "aeron_log_buffer_pre_faulter.h"
+}
+
+#define TERM_LENGTH (AERON_LOGBUFFER_TERM_MIN_LENGTH)
+#define PAGE_SIZE (4 * 1024)
+
+class LogBufferPreFaulterTest : public testing::Test
+{
+public:
+    void SetUp() override
+    {
+        ASSERT_GT(aeron_temp_filename(m_path, sizeof(m_path)), 0u);
+        ASSERT_EQ(0, aeron_map_raw_log(
+            &m_mapped_raw_log, m_path, true, false, AERON_NUMA_NODE_NONE, TERM_LENGTH, PAGE_SIZE)) << aeron_errmsg();
+        ASSERT_EQ(0, aeron_log_buffer_pre_faulter_init(&m_pre_faulter, nullptr));
+    }
+
+    void TearDown() override
+    {
+        aeron_log_buffer_pre_faulter_on_close(&m_pre_faulter);
+        aeron_unmap(&m_mapped_raw_log.mapped_file);
+        remove(m_path);
+    }
+
+protected:
+    char m_path[AERON_MAX_PATH] = {};
+    aeron_mapped_raw_log_t m_mapped_raw_log = {};
+    aeron_log_buffer_pre_faulter_t m_pre_faulter = {};
+};
+
+TEST_F(LogBufferPreFaulterTest, shouldPreFaultWithoutAlteringContents)
+{
+    auto *base = (int64_t *)m_mapped_raw_log.mapped_file.addr;
+    base[0] = 7;
+    base[PAGE_SIZE / sizeof(int64_t)] = 11;
+
+    ASSERT_EQ(0, aeron_log_buffer_pre_fault(m_path, PAGE_SIZE, false, AERON_NUMA_NODE_NONE)) << aeron_errmsg();
+
+    EXPECT_EQ(7, base[0]);
+    EXPECT_EQ(11, base[PAGE_SIZE / sizeof(int64_t)]);
+}
+
+TEST_F(LogBufferPreFaulterTest, shouldPreFaultOfferedLogOnDoWork)
+{
+    aeron_log_buffer_pre_faulter_offer(&m_pre_faulter, m_path, PAGE_SIZE, false, AERON_NUMA_NODE_NONE);
+    EXPECT_EQ(0, m_pre_faulter.pre_faulted_count);
+
+    EXPECT_EQ(1, aeron_log_buffer_pre_faulter_do_work(&m_pre_faulter));
+    EXPECT_EQ(1, m_pre_faulter.pre_faulted_count);
+    EXPECT_EQ(0, aeron_log_buffer_pre_faulter_do_work(&m_pre_faulter));
+}
+
+TEST_F(LogBufferPreFaulterTest, shouldSkipLogDeletedBeforeItIsReached)
+{
+    aeron_log_buffer_pre_faulter_offer(&m_pre_faulter, m_path, PAGE_SIZE, false, AERON_NUMA_NODE_NONE);
+    remove(m_path);
+
+    EXPECT_EQ(1, aeron_log_buffer_pre_faulter_do_work(&m_pre_faulter));
+    EXPECT_EQ(1, m_pre_faulter.pre_faulted_count);
+}
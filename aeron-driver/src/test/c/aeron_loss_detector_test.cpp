@@ -16,6 +16,7 @@
 
 #include <array>
 #include <functional>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -689,3 +690,80 @@ TEST_F(LossDetectorTest, shouldHandleNonZeroInitialTermOffset)
     EXPECT_EQ(called, 1);
     EXPECT_TRUE(loss_found);
 }
+
+TEST_F(LossDetectorTest, shouldNakFurtherGapsWithFirstGapWhenMaxGapsAboveOne)
+{
+    int64_t rebuild_position = 0;
+    const int64_t hwm_position = rebuild_position + (ALIGNED_FRAME_LENGTH * 7);
+    bool loss_found;
+    std::vector<int32_t> nak_offsets;
+
+    insert_frame(offset_of_message(0));
+    insert_frame(offset_of_message(2));
+    insert_frame(offset_of_message(4));
+    insert_frame(offset_of_message(6));
+
+    ASSERT_EQ(feedback_delay_state_init(false), 0);
+    ASSERT_EQ(aeron_loss_detector_init(
+        &m_detector, &m_delay_generator_state, LossDetectorTest::on_gap_detected, this), 0);
+    m_detector.max_gaps = 4;
+
+    m_on_gap_detected =
+        [&](int32_t term_id, int32_t term_offset, size_t length)
+        {
+            EXPECT_EQ(term_id, TERM_ID);
+            EXPECT_EQ(length, ALIGNED_FRAME_LENGTH);
+            nak_offsets.push_back(term_offset);
+        };
+
+    ASSERT_EQ(aeron_loss_detector_scan(
+        &m_detector, &loss_found, m_ptr, rebuild_position, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID),
+        offset_of_message(1));
+    EXPECT_TRUE(nak_offsets.empty());
+
+    m_time = 40 * 1000 * 1000L;
+    ASSERT_EQ(aeron_loss_detector_scan(
+        &m_detector, &loss_found, m_ptr, rebuild_position, hwm_position, m_time, MASK, POSITION_BITS_TO_SHIFT, TERM_ID),
+        offset_of_message(1));
+    ASSERT_EQ(3u, nak_offsets.size());
+    EXPECT_EQ(offset_of_message(1), nak_offsets[0]);
+    EXPECT_EQ(offset_of_message(3), nak_offsets[1]);
+    EXPECT_EQ(offset_of_message(5), nak_offsets[2]);
+    EXPECT_EQ(offset_of_message(1), m_detector.active_gap.term_offset);
+}
+
+TEST_F(LossDetectorTest, shouldAdaptNakDelayToRtt)
+{
+    ASSERT_EQ(aeron_feedback_delay_state_init(
+        &m_delay_generator_state,
+        aeron_loss_detector_nak_unicast_delay_generator,
+        60 * 1000 * 1000LL,
+        1,
+        false), 0);
+
+    aeron_feedback_delay_state_set_delay(&m_delay_generator_state, aeron_loss_detector_nak_rtt_delay_ns(1000 * 1000));
+    EXPECT_EQ(2 * 1000 * 1000, m_delay_generator_state.delay_generator(&m_delay_generator_state));
+
+    EXPECT_EQ(AERON_LOSS_DETECTOR_NAK_RTT_MIN_DELAY_NS, aeron_loss_detector_nak_rtt_delay_ns(1000));
+    EXPECT_EQ(AERON_LOSS_DETECTOR_NAK_RTT_MAX_DELAY_NS, aeron_loss_detector_nak_rtt_delay_ns(1000 * 1000 * 1000LL));
+}
+
+TEST_F(LossDetectorTest, shouldBoundMulticastBackoffByAdaptedDelay)
+{
+    ASSERT_EQ(aeron_feedback_delay_state_init(
+        &m_delay_generator_state,
+        aeron_loss_detector_nak_multicast_delay_generator,
+        60 * 1000 * 1000LL,
+        10,
+        false), 0);
+
+    const int64_t delay_ns = aeron_loss_detector_nak_rtt_delay_ns(500 * 1000);
+    aeron_feedback_delay_state_set_delay(&m_delay_generator_state, delay_ns);
+
+    for (int i = 0; i < 1000; i++)
+    {
+        const int64_t backoff_ns = m_delay_generator_state.delay_generator(&m_delay_generator_state);
+        EXPECT_GE(backoff_ns, 0);
+        EXPECT_LE(backoff_ns, delay_ns);
+    }
+}
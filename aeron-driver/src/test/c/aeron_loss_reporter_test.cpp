@@ -151,6 +151,41 @@ TEST_F(LossReporterTest, shouldUpdateEntry)
     EXPECT_EQ(entry->last_observation_timestamp, latest_timestamp);
 }
 
+TEST_F(LossReporterTest, shouldRecordRepairsInHistogramBuckets)
+{
+    ASSERT_EQ(aeron_loss_reporter_init(&m_reporter, m_ptr, CAPACITY), 0);
+
+    const char *channel = "aeron:udp://stuff";
+    const char *source = "127.0.0.1:8888";
+
+    aeron_loss_reporter_entry_offset_t offset = aeron_loss_reporter_create_entry(
+        &m_reporter, 32, 7, SESSION_ID, STREAM_ID, channel, strlen(channel), source, strlen(source));
+
+    EXPECT_EQ(offset, 0);
+
+    aeron_loss_reporter_record_repair(&m_reporter, offset, AERON_LOSS_REPORTER_REPAIR_RETRANSMIT, 32, 5 * 1000);
+    aeron_loss_reporter_record_repair(&m_reporter, offset, AERON_LOSS_REPORTER_REPAIR_RETRANSMIT, 64, 16 * 1000);
+    aeron_loss_reporter_record_repair(&m_reporter, offset, AERON_LOSS_REPORTER_REPAIR_UNSOLICITED, 4095, 200 * 1000);
+    aeron_loss_reporter_record_repair(
+        &m_reporter, offset, AERON_LOSS_REPORTER_REPAIR_TIMEOUT, 16 * 1024 * 1024, INT64_C(10) * 1000 * 1000 * 1000);
+
+    aeron_loss_reporter_entry_t *entry = (aeron_loss_reporter_entry_t *)m_ptr;
+    EXPECT_EQ(entry->repair_counts[AERON_LOSS_REPORTER_REPAIR_RETRANSMIT], 2);
+    EXPECT_EQ(entry->repair_counts[AERON_LOSS_REPORTER_REPAIR_UNSOLICITED], 1);
+    EXPECT_EQ(entry->repair_counts[AERON_LOSS_REPORTER_REPAIR_TIMEOUT], 1);
+
+    EXPECT_EQ(entry->gap_length_histogram[0], 1);
+    EXPECT_EQ(entry->gap_length_histogram[1], 1);
+    EXPECT_EQ(entry->gap_length_histogram[6], 1);
+    EXPECT_EQ(entry->gap_length_histogram[AERON_LOSS_REPORTER_HISTOGRAM_BUCKETS - 1], 1);
+
+    EXPECT_EQ(entry->repair_time_histogram[0], 1);
+    EXPECT_EQ(entry->repair_time_histogram[1], 1);
+    EXPECT_EQ(entry->repair_time_histogram[4], 1);
+    EXPECT_EQ(entry->repair_time_histogram[AERON_LOSS_REPORTER_HISTOGRAM_BUCKETS - 1], 1);
+    EXPECT_EQ(entry->observation_count, 1);
+}
+
 TEST_F(LossReporterTest, shouldReadNoEntriesInEmptyReport)
 {
     size_t called = 0;
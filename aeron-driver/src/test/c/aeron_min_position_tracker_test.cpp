@@ -0,0 +1,199 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "aeron_min_position_tracker.h"
+}
+
+#define MAX_POSITIONS (37)
+
+class MinPositionTrackerTest : public testing::Test
+{
+public:
+    void SetUp() override
+    {
+        m_values.fill(0);
+        m_subscribable.length = 0;
+        m_subscribable.capacity = MAX_POSITIONS;
+        m_subscribable.array = m_positions.data();
+        aeron_min_position_tracker_init(&m_tracker, false);
+    }
+
+    void TearDown() override
+    {
+        aeron_min_position_tracker_close(&m_tracker);
+    }
+
+    void addPosition(int64_t position, bool is_observer = false, bool is_tether = true)
+    {
+        size_t index = m_subscribable.length++;
+        m_subscribable.change_number++;
+        aeron_tetherable_position_t *tetherable_position = &m_positions[index];
+
+        m_values[index] = position;
+        tetherable_position->is_tether = is_tether;
+        tetherable_position->is_observer = is_observer;
+        tetherable_position->state = AERON_SUBSCRIPTION_TETHER_ACTIVE;
+        tetherable_position->counter_id = (int32_t)index;
+        tetherable_position->value_addr = &m_values[index];
+
+        aeron_min_position_tracker_invalidate(&m_tracker);
+    }
+
+    int64_t min(int64_t target = INT64_MAX)
+    {
+        return aeron_min_position_tracker_min(&m_tracker, &m_subscribable, target);
+    }
+
+protected:
+    std::array<int64_t, MAX_POSITIONS> m_values = {};
+    std::array<aeron_tetherable_position_t, MAX_POSITIONS> m_positions = {};
+    aeron_subscribable_t m_subscribable = {};
+    aeron_min_position_tracker_t m_tracker = {};
+};
+
+TEST_F(MinPositionTrackerTest, shouldReturnMaxValueWhenEmpty)
+{
+    EXPECT_EQ(INT64_MAX, min());
+}
+
+TEST_F(MinPositionTrackerTest, shouldTrackExactMinimumAsPositionsAdvance)
+{
+    for (int i = 0; i < MAX_POSITIONS; i++)
+    {
+        addPosition(1000 + (i * 64));
+    }
+
+    EXPECT_EQ(1000, min());
+
+    for (int64_t step = 1; step <= 100; step++)
+    {
+        for (size_t i = 0; i < MAX_POSITIONS; i++)
+        {
+            m_values[i] += (int64_t)((i * 7 + (size_t)step * 13) % 50);
+        }
+
+        int64_t expected = INT64_MAX;
+        for (size_t i = 0; i < MAX_POSITIONS; i++)
+        {
+            expected = m_values[i] < expected ? m_values[i] : expected;
+        }
+
+        ASSERT_EQ(expected, min()) << "step " << step;
+    }
+}
+
+TEST_F(MinPositionTrackerTest, shouldReturnLowerBoundAtOrAboveTarget)
+{
+    addPosition(100);
+    addPosition(200);
+    addPosition(300);
+
+    EXPECT_EQ(100, min(50));
+
+    m_values[0] = 500;
+    m_values[1] = 600;
+    m_values[2] = 700;
+
+    const int64_t lower_bound = min(150);
+    EXPECT_GE(lower_bound, 150);
+    EXPECT_LE(lower_bound, 500);
+
+    EXPECT_EQ(500, min());
+}
+
+TEST_F(MinPositionTrackerTest, shouldExcludeRestingPositions)
+{
+    addPosition(100);
+    addPosition(200);
+    m_positions[0].state = AERON_SUBSCRIPTION_TETHER_RESTING;
+    aeron_min_position_tracker_invalidate(&m_tracker);
+
+    EXPECT_EQ(200, min());
+
+    m_positions[0].state = AERON_SUBSCRIPTION_TETHER_ACTIVE;
+    aeron_min_position_tracker_invalidate(&m_tracker);
+
+    EXPECT_EQ(100, min());
+}
+
+TEST_F(MinPositionTrackerTest, shouldExcludeObserversWhenRequested)
+{
+    aeron_min_position_tracker_close(&m_tracker);
+    aeron_min_position_tracker_init(&m_tracker, true);
+
+    addPosition(100, true);
+    EXPECT_EQ(INT64_MAX, min());
+
+    addPosition(300);
+    EXPECT_EQ(300, min());
+}
+
+TEST_F(MinPositionTrackerTest, shouldRebuildAfterPositionRemoved)
+{
+    addPosition(100);
+    addPosition(200);
+    addPosition(300);
+    EXPECT_EQ(100, min());
+
+    m_positions[0] = m_positions[2];
+    m_subscribable.length = 2;
+    aeron_min_position_tracker_invalidate(&m_tracker);
+
+    EXPECT_EQ(200, min());
+}
+
+TEST_F(MinPositionTrackerTest, shouldSkipUntetheredCheckOnlyWhileAllUntetheredAreActiveAndAhead)
+{
+    aeron_untethered_tracker_t tracker;
+    aeron_untethered_tracker_init(&tracker);
+
+    EXPECT_TRUE(aeron_untethered_tracker_is_ahead(&tracker, &m_subscribable, 100, 1));
+
+    addPosition(0);
+    addPosition(200, false, false);
+    addPosition(300, false, false);
+    EXPECT_TRUE(aeron_untethered_tracker_is_ahead(&tracker, &m_subscribable, 100, 2));
+    EXPECT_EQ(2, aeron_untethered_tracker_time_of_last_update_ns(&tracker, &m_positions[1]));
+
+    EXPECT_FALSE(aeron_untethered_tracker_is_ahead(&tracker, &m_subscribable, 250, 3));
+    EXPECT_EQ(2, aeron_untethered_tracker_time_of_last_update_ns(&tracker, &m_positions[1]));
+
+    m_positions[1].state = AERON_SUBSCRIPTION_TETHER_LINGER;
+    aeron_untethered_tracker_on_full_check(&tracker, &m_subscribable);
+    EXPECT_FALSE(aeron_untethered_tracker_is_ahead(&tracker, &m_subscribable, 100, 4));
+
+    m_positions[1].state = AERON_SUBSCRIPTION_TETHER_ACTIVE;
+    aeron_untethered_tracker_on_full_check(&tracker, &m_subscribable);
+    EXPECT_TRUE(aeron_untethered_tracker_is_ahead(&tracker, &m_subscribable, 100, 5));
+
+    aeron_untethered_tracker_close(&tracker);
+}
+
+TEST_F(MinPositionTrackerTest, shouldExcludeTetheredPositionsWhenRequested)
+{
+    m_tracker.exclude_tethered = true;
+    addPosition(10);
+    addPosition(20, false, false);
+
+    EXPECT_EQ(20, min());
+}
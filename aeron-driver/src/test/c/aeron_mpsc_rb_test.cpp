@@ -327,6 +327,72 @@ TEST_F(MpscRbTest, shouldLimitReadOfMessages)
     }
 }
 
+TEST_F(MpscRbTest, shouldClaimCommitAndReadMessageEncodedInPlace)
+{
+    aeron_mpsc_rb_t rb;
+    size_t length = 12;
+    size_t recordLength = length + AERON_RB_RECORD_HEADER_LENGTH;
+
+    ASSERT_EQ(aeron_mpsc_rb_init(&rb, m_buffer.data(), m_buffer.size()), 0);
+
+    const int32_t index = aeron_mpsc_rb_try_claim(&rb, MSG_TYPE_ID, length);
+    ASSERT_EQ(index, (int32_t)AERON_RB_RECORD_HEADER_LENGTH);
+
+    aeron_rb_record_descriptor_t *record = (aeron_rb_record_descriptor_t *)(rb.buffer);
+    EXPECT_EQ(record->length, -(int32_t)recordLength);
+    EXPECT_EQ(record->msg_type_id, (int32_t)MSG_TYPE_ID);
+
+    memset(rb.buffer + index, 7, length);
+
+    size_t timesCalled = 0;
+    EXPECT_EQ(aeron_mpsc_rb_read(&rb, countTimesAsSizeT, &timesCalled, 10), (size_t)0);
+
+    ASSERT_EQ(aeron_mpsc_rb_commit(&rb, index), AERON_RB_SUCCESS);
+    EXPECT_EQ(record->length, (int32_t)recordLength);
+
+    EXPECT_EQ(aeron_mpsc_rb_read(&rb, countTimesAsSizeT, &timesCalled, 10), (size_t)1);
+    EXPECT_EQ(timesCalled, (size_t)1);
+}
+
+TEST_F(MpscRbTest, shouldSkipAbortedClaim)
+{
+    aeron_mpsc_rb_t rb;
+    size_t length = 12;
+    size_t alignedRecordLength = AERON_ALIGN(length + AERON_RB_RECORD_HEADER_LENGTH, AERON_RB_ALIGNMENT);
+
+    ASSERT_EQ(aeron_mpsc_rb_init(&rb, m_buffer.data(), m_buffer.size()), 0);
+
+    const int32_t index = aeron_mpsc_rb_try_claim(&rb, MSG_TYPE_ID, length);
+    ASSERT_GT(index, 0);
+    ASSERT_EQ(aeron_mpsc_rb_abort(&rb, index), AERON_RB_SUCCESS);
+
+    aeron_rb_record_descriptor_t *record = (aeron_rb_record_descriptor_t *)(rb.buffer);
+    EXPECT_EQ(record->msg_type_id, AERON_RB_PADDING_MSG_TYPE_ID);
+
+    size_t timesCalled = 0;
+    EXPECT_EQ(aeron_mpsc_rb_read(&rb, countTimesAsSizeT, &timesCalled, 10), (size_t)0);
+    EXPECT_EQ(timesCalled, (size_t)0);
+    EXPECT_EQ(rb.descriptor->head_position, (int64_t)alignedRecordLength);
+}
+
+TEST_F(MpscRbTest, shouldRejectCommitOrAbortOfUnclaimedSpace)
+{
+    aeron_mpsc_rb_t rb;
+
+    ASSERT_EQ(aeron_mpsc_rb_init(&rb, m_buffer.data(), m_buffer.size()), 0);
+
+    EXPECT_EQ(aeron_mpsc_rb_try_claim(&rb, MSG_TYPE_ID, rb.max_message_length + 1), AERON_RB_ERROR);
+
+    const int32_t index = aeron_mpsc_rb_try_claim(&rb, MSG_TYPE_ID, 8);
+    ASSERT_GT(index, 0);
+
+    EXPECT_EQ(aeron_mpsc_rb_commit(&rb, 0), AERON_RB_ERROR);
+    EXPECT_EQ(aeron_mpsc_rb_commit(&rb, (int32_t)rb.capacity + 8), AERON_RB_ERROR);
+    EXPECT_EQ(aeron_mpsc_rb_commit(&rb, index), AERON_RB_SUCCESS);
+    EXPECT_EQ(aeron_mpsc_rb_commit(&rb, index), AERON_RB_ERROR);
+    EXPECT_EQ(aeron_mpsc_rb_abort(&rb, index), AERON_RB_ERROR);
+}
+
 TEST_F(MpscRbTest, shouldNotUnblockWhenEmpty)
 {
     aeron_mpsc_rb_t rb;
@@ -522,3 +588,72 @@ TEST(MpscRbConcurrentTest, shouldExchangeMessages)
     }
 }
 
+TEST(MpscRbConcurrentTest, shouldExchangeClaimedMessages)
+{
+    AERON_DECL_ALIGNED(buffer_t mpsc_buffer, 16);
+    mpsc_buffer.fill(0);
+
+    aeron_mpsc_rb_t rb;
+    ASSERT_EQ(aeron_mpsc_rb_init(&rb, mpsc_buffer.data(), mpsc_buffer.size()), 0);
+
+    std::atomic<int> countDown(NUM_PUBLISHERS);
+    std::atomic<unsigned int> publisherId(0);
+
+    std::vector<std::thread> threads;
+    size_t msgCount = 0;
+    uint32_t counts[NUM_PUBLISHERS];
+
+    for (unsigned int &count : counts)
+    {
+        count = 0;
+    }
+
+    for (int i = 0; i < NUM_PUBLISHERS; i++)
+    {
+        threads.push_back(std::thread(
+            [&]()
+            {
+                uint32_t id = publisherId.fetch_add(1);
+
+                countDown--;
+                while (countDown > 0)
+                {
+                    std::this_thread::yield();
+                }
+
+                for (uint32_t m = 0; m < NUM_MESSAGES_PER_PUBLISHER; m++)
+                {
+                    int32_t index;
+                    while ((index = aeron_mpsc_rb_try_claim(&rb, MSG_TYPE_ID, sizeof(mpsc_concurrent_test_data_t))) < 0)
+                    {
+                        std::this_thread::yield();
+                    }
+
+                    mpsc_concurrent_test_data_t *data = (mpsc_concurrent_test_data_t *)(rb.buffer + index);
+                    data->id = id;
+                    data->num = m;
+
+                    ASSERT_EQ(aeron_mpsc_rb_commit(&rb, index), AERON_RB_SUCCESS);
+                }
+            }));
+    }
+
+    while (msgCount < (NUM_MESSAGES_PER_PUBLISHER * NUM_PUBLISHERS))
+    {
+        const size_t readCount = aeron_mpsc_rb_read(
+            &rb, mpsc_rb_concurrent_handler, counts, std::numeric_limits<size_t>::max());
+
+        if (0 == readCount)
+        {
+            std::this_thread::yield();
+        }
+
+        msgCount += readCount;
+    }
+
+    for (std::thread &thr: threads)
+    {
+        thr.join();
+    }
+}
+
@@ -112,3 +112,46 @@ TEST_F(NameResolverCacheTest, shouldTimeoutEntries)
     ASSERT_EQ(-1, aeron_name_resolver_cache_lookup_by_name(
         &m_cache, "hostname2", strlen("hostname2"), cache_addr.res_type, nullptr));
 }
+
+TEST_F(NameResolverCacheTest, shouldTimeoutEntriesOutOfInsertionOrderAndKeepLookupsConsistent)
+{
+    aeron_name_resolver_cache_init(&m_cache, 1000);
+    aeron_name_resolver_cache_addr_t cache_addr = {};
+    cache_addr.res_type = AERON_RES_HEADER_TYPE_NAME_TO_IP4_MD;
+    const int count = 500;
+
+    for (int i = 0; i < count; i++)
+    {
+        char name[16];
+        snprintf(name, sizeof(name), "hostname%d", i);
+        cache_addr.port = (uint16_t)i;
+
+        ASSERT_EQ(1, aeron_name_resolver_cache_add_or_update(
+            &m_cache, name, strlen(name), &cache_addr, (i * 7919) % count, &m_counter));
+    }
+
+    for (int64_t now_ms = 1000; now_ms < 1000 + count; now_ms += 50)
+    {
+        aeron_name_resolver_cache_timeout_old_entries(&m_cache, now_ms, &m_counter);
+        ASSERT_EQ(m_counter, (int64_t)m_cache.entries.length);
+
+        for (int i = 0; i < count; i++)
+        {
+            char name[16];
+            snprintf(name, sizeof(name), "hostname%d", i);
+            aeron_name_resolver_cache_entry_t *cache_entry = nullptr;
+            int index = aeron_name_resolver_cache_lookup_by_name(
+                &m_cache, name, strlen(name), cache_addr.res_type, &cache_entry);
+
+            if ((i * 7919) % count + 1000 <= now_ms)
+            {
+                ASSERT_EQ(-1, index) << name << " at " << now_ms;
+            }
+            else
+            {
+                ASSERT_LE(0, index) << name << " at " << now_ms;
+                ASSERT_EQ((uint16_t)i, cache_entry->cache_addr.port);
+            }
+        }
+    }
+}
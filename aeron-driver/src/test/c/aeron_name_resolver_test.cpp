@@ -28,7 +28,7 @@ extern "C"
 #include "agent/aeron_driver_agent.h"
 }
 
-#define METADATA_LENGTH (16 * 1024)
+#define METADATA_LENGTH (32 * 1024)
 #define VALUES_LENGTH (METADATA_LENGTH / 2)
 #define ERROR_LOG_LENGTH (8192)
 
@@ -86,6 +86,7 @@ protected:
         aeron_driver_context_set_resolver_interface(resolver_fields->context, driver_resolver_interface);
         aeron_driver_context_set_resolver_bootstrap_neighbor(resolver_fields->context, driver_bootstrap_neighbour);
 
+        memset(resolver_fields->counters_buffer, 0, sizeof(resolver_fields->counters_buffer));
         aeron_counters_manager_init(
             &resolver_fields->counters,
             &resolver_fields->counters_buffer[0], METADATA_LENGTH,
@@ -363,6 +364,37 @@ TEST_F(NameResolverTest, shouldSeeNeighborFromGossip)
     ASSERT_LE(0, m_a.resolver.resolve_func(&m_a.resolver, "A", "endpoint", false, &resolved_address));
 }
 
+TEST_F(NameResolverTest, shouldGossipNewEntriesBeforeNeighborResolutionInterval)
+{
+    int64_t timestamp_ms = INTMAX_C(8932472347945);
+    const int64_t resolution_deadline_ms = timestamp_ms + AERON_NAME_RESOLVER_DRIVER_NEIGHBOUR_RESOLUTION_INTERVAL_MS;
+    initResolver(&m_a, AERON_NAME_RESOLVER_DRIVER, "", timestamp_ms, "A", "0.0.0.0:8050");
+    initResolver(&m_b, AERON_NAME_RESOLVER_DRIVER, "", timestamp_ms, "B", "0.0.0.0:8051", "localhost:8050");
+    initResolver(&m_c, AERON_NAME_RESOLVER_DRIVER, "", timestamp_ms, "C", "0.0.0.0:8052", "localhost:8051");
+
+    struct sockaddr_storage resolved_address;
+    resolved_address.ss_family = AF_INET;
+
+    while (2 > readCacheEntriesCounter(&m_c))
+    {
+        ASSERT_LT(timestamp_ms, resolution_deadline_ms) << "C did not learn of A from a delta" << *this;
+
+        timestamp_ms += 10;
+        m_c.resolver.do_work_func(&m_c.resolver, timestamp_ms);
+        ASSERT_EQ(0, aeron_errcode()) << aeron_errmsg();
+
+        m_b.resolver.do_work_func(&m_b.resolver, timestamp_ms);
+        ASSERT_EQ(0, aeron_errcode()) << aeron_errmsg();
+
+        m_a.resolver.do_work_func(&m_a.resolver, timestamp_ms);
+        ASSERT_EQ(0, aeron_errcode()) << aeron_errmsg();
+
+        aeron_micro_sleep(1000);
+    }
+
+    ASSERT_LE(0, m_c.resolver.resolve_func(&m_c.resolver, "A", "endpoint", false, &resolved_address));
+}
+
 TEST_F(NameResolverTest, shouldHandleSettingNameOnHeader)
 {
     uint8_t buffer[1024];
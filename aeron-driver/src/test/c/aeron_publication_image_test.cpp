@@ -443,3 +443,810 @@ TEST_F(PublicationImageTest, shouldTrackUnderRunningTransportsWithLastSmAndRecei
 
     ASSERT_EQ(4, test_bindings_state->sm_count);
 }
+
+TEST_F(PublicationImageTest, shouldPublishReceiveTimestampOfDestinationTransport)
+{
+    struct sockaddr_storage addr = {};
+    uint8_t data[128] = {};
+    aeron_data_header_t *message = reinterpret_cast<aeron_data_header_t *>(data);
+    const char *uri = "aeron:udp?endpoint=localhost:9090";
+    aeron_receive_channel_endpoint_t *endpoint = createMdsEndpoint();
+    int32_t stream_id = 1001;
+    int32_t session_id = 1000001;
+    size_t message_length = 64;
+
+    aeron_udp_channel_t *channel = createChannel(uri);
+    aeron_receive_destination_t *dest;
+
+    ASSERT_LE(0, aeron_receive_destination_create(
+        &dest, channel, m_context, &m_counters_manager, endpoint->channel_status.counter_id));
+    ASSERT_EQ(1, aeron_receive_channel_endpoint_add_destination(endpoint, dest));
+
+    aeron_atomic_counter_t rcv_timestamp_counter;
+    rcv_timestamp_counter.counter_id = aeron_counter_receiver_timestamp_allocate(
+        &m_counters_manager, 0, session_id, stream_id, strlen(uri), uri);
+    ASSERT_LE(0, rcv_timestamp_counter.counter_id);
+    rcv_timestamp_counter.value_addr =
+        aeron_counters_manager_addr(&m_counters_manager, rcv_timestamp_counter.counter_id);
+
+    aeron_publication_image_t *image = createImage(endpoint, dest, stream_id, session_id, 0, &rcv_timestamp_counter);
+    ASSERT_NE(nullptr, image);
+
+    message->stream_id = stream_id;
+    message->session_id = session_id;
+    message->frame_header.frame_length = (int32_t)message_length;
+
+    dest->transport.recv_timestamp_ns = 0;
+    aeron_publication_image_insert_packet(image, dest, 0, 0, data, message_length, &addr);
+    EXPECT_EQ(0, aeron_counter_get(rcv_timestamp_counter.value_addr));
+
+    dest->transport.recv_timestamp_ns = INT64_C(1600000000123456789);
+    message->term_offset = (int32_t)message_length;
+    aeron_publication_image_insert_packet(image, dest, 0, (int32_t)message_length, data, message_length, &addr);
+    EXPECT_EQ(INT64_C(1600000000123456789), aeron_counter_get(rcv_timestamp_counter.value_addr));
+}
+
+TEST_F(PublicationImageTest, shouldDropDuplicateArrivalsAndCountFirstArrivalsPerDestination)
+{
+    struct sockaddr_storage addr = {};
+    uint8_t data[128] = {};
+    aeron_data_header_t *message = reinterpret_cast<aeron_data_header_t *>(data);
+    aeron_receive_channel_endpoint_t *endpoint = createMdsEndpoint();
+    int32_t stream_id = 1001;
+    int32_t session_id = 1000001;
+    size_t message_length = 64;
+
+    aeron_driver_context_set_rcv_redundant_path_enabled(m_context, true);
+
+    aeron_udp_channel_t *channel_1 = createChannel("aeron:udp?endpoint=localhost:9090");
+    aeron_udp_channel_t *channel_2 = createChannel("aeron:udp?endpoint=localhost:9091");
+    aeron_receive_destination_t *dest_1;
+    aeron_receive_destination_t *dest_2;
+
+    ASSERT_LE(0, aeron_receive_destination_create(
+        &dest_1, channel_1, m_context, &m_counters_manager, endpoint->channel_status.counter_id));
+    ASSERT_EQ(1, aeron_receive_channel_endpoint_add_destination(endpoint, dest_1));
+    ASSERT_LE(0, aeron_receive_destination_create(
+        &dest_2, channel_2, m_context, &m_counters_manager, endpoint->channel_status.counter_id));
+    ASSERT_EQ(2, aeron_receive_channel_endpoint_add_destination(endpoint, dest_2));
+
+    aeron_publication_image_t *image = createImage(endpoint, dest_1, stream_id, session_id);
+    ASSERT_NE(nullptr, image);
+    ASSERT_EQ(2, aeron_publication_image_add_destination(image, dest_2));
+
+    message->stream_id = stream_id;
+    message->session_id = session_id;
+    message->frame_header.frame_length = (int32_t)message_length;
+    data[AERON_DATA_HEADER_LENGTH] = 1;
+
+    aeron_publication_image_insert_packet(image, dest_1, 0, 0, data, message_length, &addr);
+
+    data[AERON_DATA_HEADER_LENGTH] = 2;
+    aeron_publication_image_insert_packet(image, dest_2, 0, 0, data, message_length, &addr);
+
+    message->term_offset = (int32_t)message_length;
+    aeron_publication_image_insert_packet(image, dest_2, 0, (int32_t)message_length, data, message_length, &addr);
+
+    const uint8_t *term_buffer = image->mapped_raw_log.term_buffers[0].addr;
+    EXPECT_EQ(1, term_buffer[AERON_DATA_HEADER_LENGTH]);
+    EXPECT_EQ(2, term_buffer[message_length + AERON_DATA_HEADER_LENGTH]);
+
+    EXPECT_EQ(1, aeron_counter_get(dest_1->first_arrivals_counter.value_addr));
+    EXPECT_EQ(0, aeron_counter_get(dest_1->duplicate_arrivals_counter.value_addr));
+    EXPECT_EQ(1, aeron_counter_get(dest_2->first_arrivals_counter.value_addr));
+    EXPECT_EQ(1, aeron_counter_get(dest_2->duplicate_arrivals_counter.value_addr));
+    EXPECT_LE(0, aeron_counter_get(dest_2->arrival_lag_counter.value_addr));
+    EXPECT_EQ((int64_t)(2 * message_length), aeron_counter_get(image->rcv_hwm_position.value_addr));
+}
+
+TEST_F(PublicationImageTest, shouldMeasureRttForRttAdaptiveNakDelay)
+{
+    struct sockaddr_storage addr = {};
+    uint8_t data[128] = {};
+    aeron_data_header_t *message = reinterpret_cast<aeron_data_header_t *>(data);
+    aeron_rttm_header_t rttm = {};
+    const char *uri = "aeron:udp?endpoint=localhost:9090";
+    aeron_receive_channel_endpoint_t *endpoint = createMdsEndpoint();
+    int32_t stream_id = 1001;
+    int32_t session_id = 1000001;
+    size_t message_length = 64;
+    int64_t t0_ns = 2 * m_context->image_liveness_timeout_ns;
+
+    aeron_udp_channel_t *channel = createChannel(uri);
+    aeron_receive_destination_t *dest;
+
+    ASSERT_LE(0, aeron_receive_destination_create(
+        &dest, channel, m_context, &m_counters_manager, endpoint->channel_status.counter_id));
+    ASSERT_EQ(1, aeron_receive_channel_endpoint_add_destination(endpoint, dest));
+
+    m_context->nak_rtt_adaptive = true;
+    aeron_publication_image_t *image = createImage(endpoint, dest, stream_id, session_id);
+    ASSERT_EQ(&image->nak_delay_state, image->loss_detector.feedback_delay_state);
+
+    aeron_test_udp_bindings_state_t *test_bindings_state =
+        static_cast<aeron_test_udp_bindings_state_t *>(dest->transport.bindings_clientd);
+
+    message->stream_id = stream_id;
+    message->session_id = session_id;
+    message->frame_header.frame_length = (int32_t)message_length;
+
+    aeron_clock_update_cached_time(m_context->cached_clock, t0_ns / (1000 * 1000), t0_ns);
+    aeron_publication_image_insert_packet(image, dest, 0, 0, data, message_length, &addr);
+
+    aeron_publication_image_initiate_rttm(image, t0_ns);
+    EXPECT_EQ(1, test_bindings_state->rttm_count);
+    aeron_publication_image_initiate_rttm(image, t0_ns + (1000 * 1000));
+    EXPECT_EQ(1, test_bindings_state->rttm_count);
+    aeron_publication_image_initiate_rttm(image, t0_ns + AERON_PUBLICATION_IMAGE_NAK_RTT_MEASUREMENT_INTERVAL_NS);
+    EXPECT_EQ(2, test_bindings_state->rttm_count);
+
+    const int64_t rtt_ns = 5 * 1000 * 1000;
+    rttm.echo_timestamp = image->nano_clock() - rtt_ns;
+    aeron_publication_image_on_rttm(image, &rttm, &addr);
+    EXPECT_GE(image->nak_rtt_ns, rtt_ns);
+    EXPECT_LT(image->nak_rtt_ns, 2 * rtt_ns);
+}
+
+TEST_F(PublicationImageTest, shouldPackStatusMessagesOfImagesOnEndpointIntoOneDatagram)
+{
+    struct sockaddr_storage addr = {};
+    uint8_t data[128] = {};
+    aeron_data_header_t *message = reinterpret_cast<aeron_data_header_t *>(data);
+    const char *uri = "aeron:udp?endpoint=localhost:9090";
+    m_context->status_message_packing = true;
+    aeron_receive_channel_endpoint_t *endpoint = createMdsEndpoint();
+    int32_t stream_id = 1001;
+    size_t message_length = 64;
+
+    aeron_udp_channel_t *channel = createChannel(uri);
+    aeron_receive_destination_t *dest;
+
+    ASSERT_LE(0, aeron_receive_destination_create(
+        &dest, channel, m_context, &m_counters_manager, endpoint->channel_status.counter_id));
+    ASSERT_EQ(1, aeron_receive_channel_endpoint_add_destination(endpoint, dest));
+
+    aeron_test_udp_bindings_state_t *test_bindings_state =
+        static_cast<aeron_test_udp_bindings_state_t *>(dest->transport.bindings_clientd);
+
+    message->stream_id = stream_id;
+    message->frame_header.frame_length = (int32_t)message_length;
+
+    for (int32_t session_id = 1; session_id <= 3; session_id++)
+    {
+        aeron_publication_image_t *image = createImage(endpoint, dest, stream_id, session_id, session_id);
+        ASSERT_NE(nullptr, image) << aeron_errmsg();
+        message->session_id = session_id;
+        aeron_publication_image_insert_packet(image, dest, 0, 0, data, message_length, &addr);
+
+        aeron_publication_image_schedule_status_message(image, 1000000000, 0, TERM_BUFFER_SIZE);
+        EXPECT_EQ(1, aeron_publication_image_send_pending_status_message(image));
+    }
+
+    EXPECT_EQ(3u, endpoint->control_batch.length);
+    EXPECT_EQ(0, test_bindings_state->sm_count);
+
+    EXPECT_EQ(1, aeron_receive_channel_endpoint_flush_control_frames(endpoint));
+    EXPECT_EQ(0u, endpoint->control_batch.length);
+    EXPECT_EQ(1, test_bindings_state->mmsg_count);
+    EXPECT_EQ(3, test_bindings_state->sm_count);
+    EXPECT_EQ(0, aeron_receive_channel_endpoint_flush_control_frames(endpoint));
+}
+
+TEST_F(PublicationImageTest, shouldBatchNaksAndRttmsWithStatusMessages)
+{
+    const char *uri = "aeron:udp?endpoint=localhost:9090";
+    m_context->control_message_batching = true;
+    aeron_receive_channel_endpoint_t *endpoint = createMdsEndpoint();
+    int32_t stream_id = 1001;
+    int32_t session_id = 1000001;
+
+    aeron_udp_channel_t *channel = createChannel(uri);
+    aeron_receive_destination_t *dest;
+
+    ASSERT_LE(0, aeron_receive_destination_create(
+        &dest, channel, m_context, &m_counters_manager, endpoint->channel_status.counter_id));
+    ASSERT_EQ(1, aeron_receive_channel_endpoint_add_destination(endpoint, dest));
+
+    aeron_publication_image_t *image = createImage(endpoint, dest, stream_id, session_id);
+    ASSERT_NE(nullptr, image) << aeron_errmsg();
+    image->congestion_control->should_measure_rtt = always_measure_rtt;
+
+    aeron_test_udp_bindings_state_t *test_bindings_state =
+        static_cast<aeron_test_udp_bindings_state_t *>(dest->transport.bindings_clientd);
+
+    aeron_publication_image_schedule_status_message(image, 1000000000, 0, TERM_BUFFER_SIZE);
+    EXPECT_EQ(1, aeron_publication_image_send_pending_status_message(image));
+
+    aeron_publication_image_on_gap_detected(image, 0, 0, 1);
+    EXPECT_EQ(1, aeron_publication_image_send_pending_loss(image));
+    EXPECT_EQ(1, aeron_publication_image_initiate_rttm(image, 1000000000));
+
+    EXPECT_EQ(3u, endpoint->control_batch.length);
+    EXPECT_EQ(0, test_bindings_state->sm_count);
+    EXPECT_EQ(0, test_bindings_state->nak_count);
+    EXPECT_EQ(0, test_bindings_state->rttm_count);
+    EXPECT_EQ(1, aeron_counter_get(image->nak_messages_sent_counter));
+
+    EXPECT_EQ(3, aeron_receive_channel_endpoint_flush_control_frames(endpoint));
+    EXPECT_EQ(1, test_bindings_state->mmsg_count);
+    EXPECT_EQ(1, test_bindings_state->sm_count);
+    EXPECT_EQ(1, test_bindings_state->nak_count);
+    EXPECT_EQ(1, test_bindings_state->rttm_count);
+}
+
+TEST_F(PublicationImageTest, shouldQueueImageForReceiverAttentionOnceUntilServiced)
+{
+    const char *uri = "aeron:udp?endpoint=localhost:9090";
+    aeron_receive_channel_endpoint_t *endpoint = createMdsEndpoint();
+    aeron_udp_channel_t *channel = createChannel(uri);
+    aeron_receive_destination_t *dest;
+
+    ASSERT_LE(0, aeron_receive_destination_create(
+        &dest, channel, m_context, &m_counters_manager, endpoint->channel_status.counter_id));
+    ASSERT_EQ(1, aeron_receive_channel_endpoint_add_destination(endpoint, dest));
+
+    aeron_publication_image_t *image = createImage(endpoint, dest, 1001, 1);
+    ASSERT_NE(nullptr, image) << aeron_errmsg();
+
+    EXPECT_EQ(&m_receiver.attention_queue, image->attention_queue);
+    EXPECT_EQ(0u, aeron_spsc_concurrent_array_queue_size(&m_receiver.attention_queue));
+
+    aeron_publication_image_schedule_status_message(image, 1000000000, 0, TERM_BUFFER_SIZE);
+    aeron_publication_image_schedule_status_message(image, 2000000000, 0, TERM_BUFFER_SIZE);
+    EXPECT_EQ(1u, aeron_spsc_concurrent_array_queue_size(&m_receiver.attention_queue));
+    EXPECT_EQ(image, aeron_spsc_concurrent_array_queue_poll(&m_receiver.attention_queue));
+
+    aeron_cmpxchg32(&image->needs_attention, 1, 0);
+    aeron_publication_image_schedule_status_message(image, 3000000000, 0, TERM_BUFFER_SIZE);
+    EXPECT_EQ(1u, aeron_spsc_concurrent_array_queue_size(&m_receiver.attention_queue));
+}
+
+TEST_F(PublicationImageTest, shouldInsertPacketReceivedInPlaceAndTrackInOrderPosition)
+{
+    struct sockaddr_storage addr = {};
+    uint8_t header_data[AERON_DATA_HEADER_LENGTH] = {};
+    aeron_data_header_t *header = reinterpret_cast<aeron_data_header_t *>(header_data);
+    const char *uri = "aeron:udp?endpoint=localhost:9090";
+    aeron_receive_channel_endpoint_t *endpoint = createMdsEndpoint();
+    int32_t stream_id = 1001;
+    int32_t session_id = 1000001;
+    size_t message_length = 64;
+
+    aeron_udp_channel_t *channel = createChannel(uri);
+    aeron_receive_destination_t *dest;
+
+    ASSERT_LE(0, aeron_receive_destination_create(
+        &dest, channel, m_context, &m_counters_manager, endpoint->channel_status.counter_id));
+    ASSERT_EQ(1, aeron_receive_channel_endpoint_add_destination(endpoint, dest));
+
+    aeron_publication_image_t *image = createImage(endpoint, dest, stream_id, session_id);
+    ASSERT_NE(nullptr, image) << aeron_errmsg();
+    uint8_t *term_buffer = image->mapped_raw_log.term_buffers[0].addr;
+
+    EXPECT_EQ(0, aeron_publication_image_in_order_position(image));
+
+    header->frame_header.frame_length = (int32_t)message_length;
+    header->frame_header.version = AERON_FRAME_HEADER_VERSION;
+    header->frame_header.type = AERON_HDR_TYPE_DATA;
+    header->stream_id = stream_id;
+    header->session_id = session_id;
+    memset(term_buffer + AERON_DATA_HEADER_LENGTH, 'x', message_length - AERON_DATA_HEADER_LENGTH);
+
+    aeron_publication_image_insert_packet_in_place(image, dest, header_data, message_length, &addr);
+
+    aeron_data_header_t *inserted = reinterpret_cast<aeron_data_header_t *>(term_buffer);
+    EXPECT_EQ((int32_t)message_length, inserted->frame_header.frame_length);
+    EXPECT_EQ(session_id, inserted->session_id);
+    EXPECT_EQ('x', term_buffer[message_length - 1]);
+    EXPECT_EQ((int64_t)message_length, aeron_counter_get(image->rcv_hwm_position.value_addr));
+    EXPECT_EQ((int64_t)message_length, aeron_publication_image_in_order_position(image));
+
+    header->term_offset = (int32_t)(3 * message_length);
+    aeron_publication_image_insert_packet_in_place(image, dest, header_data, message_length, &addr);
+    EXPECT_EQ(-1, aeron_publication_image_in_order_position(image));
+
+    aeron_counter_set_ordered(image->rcv_pos_position.value_addr, (int64_t)(4 * message_length));
+    EXPECT_EQ((int64_t)(4 * message_length), aeron_publication_image_in_order_position(image));
+}
+
+TEST_F(PublicationImageTest, shouldSendAdaptiveStatusMessagesLessOftenUntilSenderNearsWindowLimit)
+{
+    const char *uri = "aeron:udp?endpoint=localhost:9090";
+    m_context->status_message_adaptive = true;
+    aeron_receive_channel_endpoint_t *endpoint = createMdsEndpoint();
+    aeron_udp_channel_t *channel = createChannel(uri);
+    aeron_receive_destination_t *dest;
+
+    ASSERT_LE(0, aeron_receive_destination_create(
+        &dest, channel, m_context, &m_counters_manager, endpoint->channel_status.counter_id));
+    ASSERT_EQ(1, aeron_receive_channel_endpoint_add_destination(endpoint, dest));
+
+    aeron_publication_image_t *image = createImage(endpoint, dest, 1001, 1000001);
+    ASSERT_NE(nullptr, image) << aeron_errmsg();
+
+    const int64_t now_ns = image->sm_rate_sample_ns + 1000;
+    const int64_t status_message_timeout_ns = INT64_C(1) << 62;
+    const int64_t window_length = image->next_sm_receiver_window_length;
+
+    aeron_subscribable_t *subscribable = &image->conductor_fields.subscribable;
+    ASSERT_EQ(0, aeron_alloc((void **)&subscribable->array, sizeof(aeron_tetherable_position_t)));
+    subscribable->capacity = 1;
+    subscribable->length = 1;
+    subscribable->array[0].state = AERON_SUBSCRIPTION_TETHER_ACTIVE;
+    subscribable->array[0].counter_id = aeron_counters_manager_allocate(
+        &m_counters_manager, 0, nullptr, 0, "sub-pos", strlen("sub-pos"));
+    subscribable->array[0].value_addr = aeron_counters_manager_addr(
+        &m_counters_manager, subscribable->array[0].counter_id);
+
+    const int64_t sm_change = image->end_sm_change;
+    const int64_t sub_position = (window_length / 4) + AERON_LOGBUFFER_FRAME_ALIGNMENT;
+    aeron_counter_set_ordered(subscribable->array[0].value_addr, sub_position);
+    aeron_counter_set_ordered(image->rcv_hwm_position.value_addr, sub_position);
+    aeron_publication_image_track_rebuild(image, now_ns, status_message_timeout_ns);
+    EXPECT_EQ(sm_change, image->end_sm_change);
+
+    aeron_counter_set_ordered(image->rcv_hwm_position.value_addr, window_length - (window_length / 8));
+    aeron_counter_set_ordered(image->rcv_pos_position.value_addr, window_length - (window_length / 8));
+    aeron_publication_image_track_rebuild(image, now_ns, status_message_timeout_ns);
+    EXPECT_EQ(sm_change + 1, image->end_sm_change);
+    EXPECT_EQ(sub_position, image->next_sm_position);
+}
+
+TEST_F(PublicationImageTest, shouldRecordDeliveryLatencyOnceSubscriberPassesSampledPacket)
+{
+    struct sockaddr_storage addr = {};
+    uint8_t data[128] = {};
+    aeron_data_header_t *message = reinterpret_cast<aeron_data_header_t *>(data);
+    const char *uri = "aeron:udp?endpoint=localhost:9090";
+    aeron_receive_channel_endpoint_t *endpoint = createMdsEndpoint();
+    int32_t stream_id = 1001;
+    int32_t session_id = 1000001;
+    size_t message_length = 64;
+    int64_t t0_ns = 2 * m_context->image_liveness_timeout_ns;
+    int64_t status_message_timeout_ns = INT64_C(1) << 62;
+
+    aeron_udp_channel_t *channel = createChannel(uri);
+    aeron_receive_destination_t *dest;
+
+    ASSERT_LE(0, aeron_receive_destination_create(
+        &dest, channel, m_context, &m_counters_manager, endpoint->channel_status.counter_id));
+    ASSERT_EQ(1, aeron_receive_channel_endpoint_add_destination(endpoint, dest));
+
+    aeron_stream_latency_histogram_t histogram;
+    ASSERT_EQ(0, aeron_stream_latency_histogram_allocate(
+        &histogram,
+        &m_counters_manager,
+        AERON_COUNTER_DELIVERY_LATENCY_NAME,
+        AERON_COUNTER_DELIVERY_LATENCY_TYPE_ID,
+        0,
+        session_id,
+        stream_id,
+        strlen(uri),
+        uri));
+
+    aeron_publication_image_t *image = createImage(endpoint, dest, stream_id, session_id, 0, nullptr, &histogram);
+    ASSERT_NE(nullptr, image) << aeron_errmsg();
+
+    aeron_subscribable_t *subscribable = &image->conductor_fields.subscribable;
+    ASSERT_EQ(0, aeron_alloc((void **)&subscribable->array, sizeof(aeron_tetherable_position_t)));
+    subscribable->capacity = 1;
+    subscribable->length = 1;
+    subscribable->array[0].state = AERON_SUBSCRIPTION_TETHER_ACTIVE;
+    subscribable->array[0].counter_id = aeron_counters_manager_allocate(
+        &m_counters_manager, 0, nullptr, 0, "sub-pos", strlen("sub-pos"));
+    subscribable->array[0].value_addr = aeron_counters_manager_addr(
+        &m_counters_manager, subscribable->array[0].counter_id);
+
+    message->stream_id = stream_id;
+    message->session_id = session_id;
+    message->frame_header.frame_length = (int32_t)message_length;
+
+    aeron_clock_update_cached_time(m_context->cached_clock, t0_ns / 1000000, t0_ns);
+
+    for (int32_t i = 0; i < 2; i++)
+    {
+        message->term_offset = i * (int32_t)message_length;
+        aeron_publication_image_insert_packet(image, dest, 0, message->term_offset, data, message_length, &addr);
+    }
+
+    EXPECT_EQ((int64_t)message_length, image->delivery_latency_sample_position);
+
+    aeron_publication_image_track_rebuild(image, t0_ns + 50 * 1000, status_message_timeout_ns);
+    EXPECT_EQ((int64_t)message_length, image->delivery_latency_sample_position);
+
+    aeron_counter_set_ordered(subscribable->array[0].value_addr, (int64_t)message_length);
+    aeron_publication_image_track_rebuild(image, t0_ns + 500 * 1000, status_message_timeout_ns);
+    EXPECT_EQ(AERON_NULL_VALUE, image->delivery_latency_sample_position);
+
+    for (int i = 0; i < AERON_STREAM_LATENCY_HISTOGRAM_BUCKET_COUNT; i++)
+    {
+        EXPECT_EQ(2 == i ? 1 : 0, aeron_counter_get(histogram.bucket_counters[i])) << i;
+    }
+
+    message->term_offset = 2 * (int32_t)message_length;
+    aeron_publication_image_insert_packet(image, dest, 0, message->term_offset, data, message_length, &addr);
+    EXPECT_EQ((int64_t)(3 * message_length), image->delivery_latency_sample_position);
+}
+
+TEST_F(PublicationImageTest, shouldAccountReceiverTicksPerActivity)
+{
+    struct sockaddr_storage addr = {};
+    uint8_t data[128] = {};
+    aeron_data_header_t *message = reinterpret_cast<aeron_data_header_t *>(data);
+    const char *uri = "aeron:udp?endpoint=localhost:9090";
+    aeron_receive_channel_endpoint_t *endpoint = createMdsEndpoint();
+    int32_t stream_id = 1001;
+    int32_t session_id = 1000001;
+    size_t message_length = 64;
+
+    aeron_udp_channel_t *channel = createChannel(uri);
+    aeron_receive_destination_t *dest;
+
+    ASSERT_LE(0, aeron_receive_destination_create(
+        &dest, channel, m_context, &m_counters_manager, endpoint->channel_status.counter_id));
+    ASSERT_EQ(1, aeron_receive_channel_endpoint_add_destination(endpoint, dest));
+
+    aeron_stream_cpu_counters_t cpu_counters;
+    ASSERT_EQ(0, aeron_stream_cpu_counters_allocate_receiver(
+        &cpu_counters, &m_counters_manager, 0, session_id, stream_id, strlen(uri), uri));
+
+    aeron_publication_image_t *image = createImage(
+        endpoint, dest, stream_id, session_id, 0, nullptr, nullptr, &cpu_counters);
+    ASSERT_NE(nullptr, image) << aeron_errmsg();
+
+    message->stream_id = stream_id;
+    message->session_id = session_id;
+    message->frame_header.frame_length = (int32_t)message_length;
+
+    int64_t previous_ticks = 0;
+    for (int32_t i = 0; i < 3; i++)
+    {
+        message->term_offset = i * (int32_t)message_length;
+        aeron_publication_image_insert_packet(image, dest, 0, message->term_offset, data, message_length, &addr);
+
+        const int64_t ticks = aeron_counter_get(cpu_counters.tick_counters[AERON_STREAM_CPU_RECEIVER_REBUILD]);
+        EXPECT_LE(previous_ticks, ticks);
+        previous_ticks = ticks;
+    }
+
+    EXPECT_LT(0, previous_ticks);
+    EXPECT_EQ(0, aeron_counter_get(cpu_counters.tick_counters[AERON_STREAM_CPU_RECEIVER_STATUS_MESSAGE]));
+    EXPECT_EQ(0, aeron_counter_get(cpu_counters.tick_counters[AERON_STREAM_CPU_RECEIVER_NAK]));
+
+    const aeron_counter_metadata_descriptor_t *metadata = (aeron_counter_metadata_descriptor_t *)(
+        m_counters_manager.metadata + AERON_COUNTER_METADATA_OFFSET(cpu_counters.counter_ids[0]));
+    EXPECT_EQ(AERON_COUNTER_RECEIVER_CPU_TICKS_TYPE_ID, metadata->type_id);
+    EXPECT_NE(nullptr, strstr((const char *)metadata->label, "rebuild"));
+}
+
+TEST_F(PublicationImageTest, shouldDropFramesOverRateLimitAndReduceReceiverWindow)
+{
+    struct sockaddr_storage addr = {};
+    uint8_t data[128] = {};
+    aeron_data_header_t *message = reinterpret_cast<aeron_data_header_t *>(data);
+    const char *uri = "aeron:udp?endpoint=localhost:9090";
+    aeron_receive_channel_endpoint_t *endpoint = createMdsEndpoint();
+    int32_t stream_id = 1001;
+    int32_t session_id = 1000001;
+    size_t message_length = 64;
+    int64_t t0_ns = 2 * m_context->image_liveness_timeout_ns;
+    int64_t status_message_timeout_ns = INT64_C(1) << 62;
+
+    ASSERT_EQ(0, aeron_driver_context_set_rcv_image_rate_limit(m_context, 100 * 1000));
+    aeron_udp_channel_t *channel = createChannel(uri);
+    aeron_receive_destination_t *dest;
+
+    ASSERT_LE(0, aeron_receive_destination_create(
+        &dest, channel, m_context, &m_counters_manager, endpoint->channel_status.counter_id));
+    ASSERT_EQ(1, aeron_receive_channel_endpoint_add_destination(endpoint, dest));
+
+    aeron_publication_image_t *image = createImage(endpoint, dest, stream_id, session_id);
+    ASSERT_NE(nullptr, image) << aeron_errmsg();
+    ASSERT_EQ(MTU, image->rate_limit_burst_bytes);
+
+    const int32_t window_length = image->next_sm_receiver_window_length;
+    aeron_subscribable_t *subscribable = &image->conductor_fields.subscribable;
+    ASSERT_EQ(0, aeron_alloc((void **)&subscribable->array, sizeof(aeron_tetherable_position_t)));
+    subscribable->capacity = 1;
+    subscribable->length = 1;
+    subscribable->array[0].state = AERON_SUBSCRIPTION_TETHER_ACTIVE;
+    subscribable->array[0].counter_id = aeron_counters_manager_allocate(
+        &m_counters_manager, 0, nullptr, 0, "sub-pos", strlen("sub-pos"));
+    subscribable->array[0].value_addr = aeron_counters_manager_addr(
+        &m_counters_manager, subscribable->array[0].counter_id);
+
+    message->stream_id = stream_id;
+    message->session_id = session_id;
+    message->frame_header.frame_length = (int32_t)message_length;
+
+    aeron_clock_update_cached_time(m_context->cached_clock, t0_ns / 1000000, t0_ns);
+
+    const int32_t accepted_count = (int32_t)((MTU + message_length - 1) / message_length);
+    for (int32_t i = 0; i < 2 * accepted_count; i++)
+    {
+        message->term_offset = i * (int32_t)message_length;
+        aeron_publication_image_insert_packet(image, dest, 0, message->term_offset, data, message_length, &addr);
+    }
+
+    int64_t *rate_limited_frames = aeron_system_counter_addr(
+        &m_system_counters, AERON_SYSTEM_COUNTER_RECEIVER_RATE_LIMITED_FRAMES);
+    int64_t *rate_limited_images = aeron_system_counter_addr(
+        &m_system_counters, AERON_SYSTEM_COUNTER_RECEIVER_RATE_LIMITED_IMAGES);
+
+    EXPECT_EQ(accepted_count * (int64_t)message_length, aeron_counter_get(image->rcv_hwm_position.value_addr));
+    EXPECT_EQ(accepted_count, aeron_counter_get(rate_limited_frames));
+
+    const int64_t sm_change = image->end_sm_change;
+    aeron_publication_image_track_rebuild(image, t0_ns, status_message_timeout_ns);
+    EXPECT_EQ(sm_change + 1, image->end_sm_change);
+    EXPECT_EQ(MTU, image->next_sm_receiver_window_length);
+    EXPECT_EQ(1, aeron_counter_get(rate_limited_images));
+
+    const int64_t t1_ns = t0_ns + AERON_PUBLICATION_IMAGE_RATE_LIMIT_HOLD_NS;
+    aeron_publication_image_track_rebuild(image, t1_ns, status_message_timeout_ns);
+    EXPECT_EQ(sm_change + 2, image->end_sm_change);
+    EXPECT_EQ(window_length, image->next_sm_receiver_window_length);
+    EXPECT_EQ(1, aeron_counter_get(rate_limited_images));
+}
+
+TEST_F(PublicationImageTest, shouldAdvanceRebuildToHwmWithoutScanningWhileInsertedInOrder)
+{
+    struct sockaddr_storage addr = {};
+    uint8_t data[128] = {};
+    aeron_data_header_t *message = reinterpret_cast<aeron_data_header_t *>(data);
+    const char *uri = "aeron:udp?endpoint=localhost:9090";
+    aeron_receive_channel_endpoint_t *endpoint = createMdsEndpoint();
+    int32_t stream_id = 1001;
+    int32_t session_id = 1000001;
+    size_t message_length = 64;
+    int64_t now_ns = 2 * m_context->image_liveness_timeout_ns;
+    int64_t status_message_timeout_ns = INT64_C(1) << 62;
+
+    ASSERT_EQ(0, aeron_feedback_delay_state_init(
+        &m_context->unicast_delay_feedback_generator,
+        aeron_loss_detector_nak_multicast_delay_generator,
+        (int64_t)m_context->nak_unicast_delay_ns,
+        1,
+        true));
+
+    aeron_udp_channel_t *channel = createChannel(uri);
+    aeron_receive_destination_t *dest;
+
+    ASSERT_LE(0, aeron_receive_destination_create(
+        &dest, channel, m_context, &m_counters_manager, endpoint->channel_status.counter_id));
+    ASSERT_EQ(1, aeron_receive_channel_endpoint_add_destination(endpoint, dest));
+
+    aeron_publication_image_t *image = createImage(endpoint, dest, stream_id, session_id);
+    ASSERT_NE(nullptr, image) << aeron_errmsg();
+    ASSERT_TRUE(image->is_in_order_fast_path);
+
+    aeron_subscribable_t *subscribable = &image->conductor_fields.subscribable;
+    ASSERT_EQ(0, aeron_alloc((void **)&subscribable->array, sizeof(aeron_tetherable_position_t)));
+    subscribable->capacity = 1;
+    subscribable->length = 1;
+    subscribable->array[0].state = AERON_SUBSCRIPTION_TETHER_ACTIVE;
+    subscribable->array[0].counter_id = aeron_counters_manager_allocate(
+        &m_counters_manager, 0, nullptr, 0, "sub-pos", strlen("sub-pos"));
+    subscribable->array[0].value_addr = aeron_counters_manager_addr(
+        &m_counters_manager, subscribable->array[0].counter_id);
+
+    message->stream_id = stream_id;
+    message->session_id = session_id;
+    message->frame_header.frame_length = (int32_t)message_length;
+
+    for (int32_t i = 0; i < 3; i++)
+    {
+        message->term_offset = i * (int32_t)message_length;
+        aeron_publication_image_insert_packet(image, dest, 0, message->term_offset, data, message_length, &addr);
+    }
+
+    EXPECT_EQ((int64_t)(3 * message_length), image->in_order_position);
+    EXPECT_EQ((int64_t)(3 * message_length), aeron_counter_get(image->rcv_hwm_position.value_addr));
+
+    const int64_t loss_change = image->end_loss_change;
+    aeron_publication_image_track_rebuild(image, now_ns, status_message_timeout_ns);
+    EXPECT_EQ((int64_t)(3 * message_length), aeron_counter_get(image->rcv_pos_position.value_addr));
+    EXPECT_EQ(loss_change, image->end_loss_change);
+
+    message->term_offset = (int32_t)(5 * message_length);
+    aeron_publication_image_insert_packet(image, dest, 0, message->term_offset, data, message_length, &addr);
+
+    EXPECT_EQ((int64_t)(3 * message_length), image->in_order_position);
+    EXPECT_EQ((int64_t)(6 * message_length), aeron_counter_get(image->rcv_hwm_position.value_addr));
+
+    aeron_publication_image_track_rebuild(image, now_ns, status_message_timeout_ns);
+    EXPECT_EQ((int64_t)(3 * message_length), aeron_counter_get(image->rcv_pos_position.value_addr));
+    EXPECT_EQ(loss_change + 1, image->end_loss_change);
+}
+
+TEST_F(PublicationImageTest, shouldResumeInOrderInsertOnceGapIsRepaired)
+{
+    struct sockaddr_storage addr = {};
+    uint8_t data[128] = {};
+    aeron_data_header_t *message = reinterpret_cast<aeron_data_header_t *>(data);
+    const char *uri = "aeron:udp?endpoint=localhost:9090";
+    aeron_receive_channel_endpoint_t *endpoint = createMdsEndpoint();
+    int32_t stream_id = 1001;
+    int32_t session_id = 1000001;
+    size_t message_length = 64;
+    int64_t now_ns = 2 * m_context->image_liveness_timeout_ns;
+    int64_t status_message_timeout_ns = INT64_C(1) << 62;
+
+    ASSERT_EQ(0, aeron_feedback_delay_state_init(
+        &m_context->unicast_delay_feedback_generator,
+        aeron_loss_detector_nak_multicast_delay_generator,
+        (int64_t)m_context->nak_unicast_delay_ns,
+        1,
+        true));
+
+    aeron_udp_channel_t *channel = createChannel(uri);
+    aeron_receive_destination_t *dest;
+
+    ASSERT_LE(0, aeron_receive_destination_create(
+        &dest, channel, m_context, &m_counters_manager, endpoint->channel_status.counter_id));
+    ASSERT_EQ(1, aeron_receive_channel_endpoint_add_destination(endpoint, dest));
+
+    aeron_publication_image_t *image = createImage(endpoint, dest, stream_id, session_id);
+    ASSERT_NE(nullptr, image) << aeron_errmsg();
+    ASSERT_TRUE(image->is_in_order_fast_path);
+
+    aeron_subscribable_t *subscribable = &image->conductor_fields.subscribable;
+    ASSERT_EQ(0, aeron_alloc((void **)&subscribable->array, sizeof(aeron_tetherable_position_t)));
+    subscribable->capacity = 1;
+    subscribable->length = 1;
+    subscribable->array[0].state = AERON_SUBSCRIPTION_TETHER_ACTIVE;
+    subscribable->array[0].counter_id = aeron_counters_manager_allocate(
+        &m_counters_manager, 0, nullptr, 0, "sub-pos", strlen("sub-pos"));
+    subscribable->array[0].value_addr = aeron_counters_manager_addr(
+        &m_counters_manager, subscribable->array[0].counter_id);
+
+    message->stream_id = stream_id;
+    message->session_id = session_id;
+    message->frame_header.frame_length = (int32_t)message_length;
+
+    const int32_t frame_order[] = { 0, 2, 1 };
+    for (int32_t frame : frame_order)
+    {
+        message->term_offset = frame * (int32_t)message_length;
+        aeron_publication_image_insert_packet(image, dest, 0, message->term_offset, data, message_length, &addr);
+    }
+
+    EXPECT_EQ((int64_t)(2 * message_length), image->in_order_position);
+    EXPECT_EQ((int64_t)(3 * message_length), aeron_counter_get(image->rcv_hwm_position.value_addr));
+
+    aeron_publication_image_track_rebuild(image, now_ns, status_message_timeout_ns);
+    EXPECT_EQ((int64_t)(3 * message_length), aeron_counter_get(image->rcv_pos_position.value_addr));
+    EXPECT_EQ((int64_t)(3 * message_length), image->in_order_position);
+
+    message->term_offset = (int32_t)(3 * message_length);
+    aeron_publication_image_insert_packet(image, dest, 0, message->term_offset, data, message_length, &addr);
+
+    EXPECT_EQ((int64_t)(4 * message_length), image->in_order_position);
+    EXPECT_EQ((int64_t)(4 * message_length), aeron_counter_get(image->rcv_hwm_position.value_addr));
+
+    const int64_t loss_change = image->end_loss_change;
+    aeron_publication_image_track_rebuild(image, now_ns, status_message_timeout_ns);
+    EXPECT_EQ((int64_t)(4 * message_length), aeron_counter_get(image->rcv_pos_position.value_addr));
+    EXPECT_EQ(loss_change, image->end_loss_change);
+}
+
+TEST_F(PublicationImageTest, shouldPublishHwmOnceReceiveBatchIsFlushed)
+{
+    struct sockaddr_storage addr = {};
+    uint8_t data[128] = {};
+    aeron_data_header_t *message = reinterpret_cast<aeron_data_header_t *>(data);
+    const char *uri = "aeron:udp?endpoint=localhost:9090";
+    aeron_receive_channel_endpoint_t *endpoint = createMdsEndpoint();
+    int32_t stream_id = 1001;
+    int32_t session_id = 1000001;
+    size_t message_length = 64;
+    aeron_publication_image_t *receive_batch = nullptr;
+
+    aeron_udp_channel_t *channel = createChannel(uri);
+    aeron_receive_destination_t *dest;
+
+    ASSERT_LE(0, aeron_receive_destination_create(
+        &dest, channel, m_context, &m_counters_manager, endpoint->channel_status.counter_id));
+    ASSERT_EQ(1, aeron_receive_channel_endpoint_add_destination(endpoint, dest));
+
+    aeron_publication_image_t *image = createImage(endpoint, dest, stream_id, session_id);
+    ASSERT_NE(nullptr, image) << aeron_errmsg();
+    ASSERT_TRUE(image->is_in_order_fast_path);
+    image->receive_batch = &receive_batch;
+
+    message->stream_id = stream_id;
+    message->session_id = session_id;
+    message->frame_header.frame_length = (int32_t)message_length;
+
+    for (int32_t i = 0; i < 3; i++)
+    {
+        message->term_offset = i * (int32_t)message_length;
+        aeron_publication_image_insert_packet(image, dest, 0, message->term_offset, data, message_length, &addr);
+    }
+
+    EXPECT_EQ((int64_t)(3 * message_length), image->in_order_position);
+    EXPECT_EQ(0, aeron_counter_get(image->rcv_hwm_position.value_addr));
+    EXPECT_EQ(image, receive_batch);
+    EXPECT_EQ(nullptr, image->next_in_receive_batch);
+
+    aeron_publication_image_flush_receive_batch(image);
+    EXPECT_EQ((int64_t)(3 * message_length), aeron_counter_get(image->rcv_hwm_position.value_addr));
+    EXPECT_FALSE(image->has_batched_positions);
+
+    message->term_offset = (int32_t)(5 * message_length);
+    aeron_publication_image_insert_packet(image, dest, 0, message->term_offset, data, message_length, &addr);
+
+    EXPECT_FALSE(image->has_batched_positions);
+    EXPECT_EQ((int64_t)(6 * message_length), aeron_counter_get(image->rcv_hwm_position.value_addr));
+}
+
+TEST_F(PublicationImageTest, shouldResumeReceiveBatchingOnceGapIsRepaired)
+{
+    struct sockaddr_storage addr = {};
+    uint8_t data[128] = {};
+    aeron_data_header_t *message = reinterpret_cast<aeron_data_header_t *>(data);
+    const char *uri = "aeron:udp?endpoint=localhost:9090";
+    aeron_receive_channel_endpoint_t *endpoint = createMdsEndpoint();
+    int32_t stream_id = 1001;
+    int32_t session_id = 1000001;
+    size_t message_length = 64;
+    int64_t now_ns = 2 * m_context->image_liveness_timeout_ns;
+    int64_t status_message_timeout_ns = INT64_C(1) << 62;
+    aeron_publication_image_t *receive_batch = nullptr;
+
+    ASSERT_EQ(0, aeron_feedback_delay_state_init(
+        &m_context->unicast_delay_feedback_generator,
+        aeron_loss_detector_nak_multicast_delay_generator,
+        (int64_t)m_context->nak_unicast_delay_ns,
+        1,
+        true));
+
+    aeron_udp_channel_t *channel = createChannel(uri);
+    aeron_receive_destination_t *dest;
+
+    ASSERT_LE(0, aeron_receive_destination_create(
+        &dest, channel, m_context, &m_counters_manager, endpoint->channel_status.counter_id));
+    ASSERT_EQ(1, aeron_receive_channel_endpoint_add_destination(endpoint, dest));
+
+    aeron_publication_image_t *image = createImage(endpoint, dest, stream_id, session_id);
+    ASSERT_NE(nullptr, image) << aeron_errmsg();
+    image->receive_batch = &receive_batch;
+
+    aeron_subscribable_t *subscribable = &image->conductor_fields.subscribable;
+    ASSERT_EQ(0, aeron_alloc((void **)&subscribable->array, sizeof(aeron_tetherable_position_t)));
+    subscribable->capacity = 1;
+    subscribable->length = 1;
+    subscribable->array[0].state = AERON_SUBSCRIPTION_TETHER_ACTIVE;
+    subscribable->array[0].counter_id = aeron_counters_manager_allocate(
+        &m_counters_manager, 0, nullptr, 0, "sub-pos", strlen("sub-pos"));
+    subscribable->array[0].value_addr = aeron_counters_manager_addr(
+        &m_counters_manager, subscribable->array[0].counter_id);
+
+    message->stream_id = stream_id;
+    message->session_id = session_id;
+    message->frame_header.frame_length = (int32_t)message_length;
+
+    const int32_t frame_order[] = { 0, 2, 1 };
+    for (int32_t frame : frame_order)
+    {
+        message->term_offset = frame * (int32_t)message_length;
+        aeron_publication_image_insert_packet(image, dest, 0, message->term_offset, data, message_length, &addr);
+    }
+
+    receive_batch = nullptr;
+    aeron_publication_image_flush_receive_batch(image);
+    EXPECT_EQ((int64_t)(3 * message_length), aeron_counter_get(image->rcv_hwm_position.value_addr));
+
+    aeron_publication_image_track_rebuild(image, now_ns, status_message_timeout_ns);
+    EXPECT_EQ((int64_t)(3 * message_length), image->in_order_position);
+
+    message->term_offset = (int32_t)(3 * message_length);
+    aeron_publication_image_insert_packet(image, dest, 0, message->term_offset, data, message_length, &addr);
+
+    EXPECT_TRUE(image->has_batched_positions);
+    EXPECT_EQ(image, receive_batch);
+    EXPECT_EQ((int64_t)(3 * message_length), aeron_counter_get(image->rcv_hwm_position.value_addr));
+
+    aeron_publication_image_flush_receive_batch(image);
+    EXPECT_EQ((int64_t)(4 * message_length), aeron_counter_get(image->rcv_hwm_position.value_addr));
+}
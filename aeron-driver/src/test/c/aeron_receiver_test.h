@@ -149,7 +149,7 @@ protected:
 
         aeron_receive_channel_endpoint_t *endpoint = nullptr;
         if (0 != aeron_receive_channel_endpoint_create(
-            &endpoint, channel, destination, &status_indicator, &m_system_counters, m_context))
+            &endpoint, channel, destination, &status_indicator, &m_system_counters, m_context->receiver_proxy, m_context))
         {
             return nullptr;
         }
@@ -192,7 +192,10 @@ protected:
         aeron_receive_destination_t *destination,
         int32_t stream_id,
         int32_t session_id,
-        int64_t correlation_id = 0)
+        int64_t correlation_id = 0,
+        aeron_atomic_counter_t *rcv_timestamp_counter = nullptr,
+        aeron_stream_latency_histogram_t *delivery_latency_histogram = nullptr,
+        aeron_stream_cpu_counters_t *rcv_cpu_counters = nullptr)
     {
         aeron_publication_image_t *image;
         aeron_congestion_control_strategy_t *congestion_control_strategy;
@@ -216,10 +219,12 @@ protected:
             &m_counters_manager);
 
         if (aeron_publication_image_create(
-            &image, endpoint, destination, m_context, correlation_id, session_id, stream_id, 0, 0, 0,
-            &hwm_position, &pos_position, congestion_control_strategy,
+            &image, endpoint, destination, m_context, nullptr, correlation_id, session_id, stream_id, 0, 0, 0,
+            &hwm_position, &pos_position, rcv_timestamp_counter, delivery_latency_histogram, rcv_cpu_counters,
+            congestion_control_strategy,
             &channel->remote_control, &channel->local_data,
-            TERM_BUFFER_SIZE, MTU, nullptr, true, true, false, &m_system_counters) < 0)
+            TERM_BUFFER_SIZE, MTU, nullptr, true, true, false, AERON_NUMA_NODE_NONE, false,
+            &m_system_counters) < 0)
         {
             return nullptr;
         }
@@ -234,6 +239,7 @@ protected:
     {
         aeron_data_header_t *data_header = (aeron_data_header_t *)buffer.data();
         data_header->frame_header.type = AERON_HDR_TYPE_DATA;
+        data_header->frame_header.flags = 0;
         data_header->stream_id = stream_id;
         data_header->session_id = session_id;
         data_header->term_id = term_id;
@@ -247,12 +253,15 @@ protected:
     {
         aeron_setup_header_t *setup_header = (aeron_setup_header_t *)buffer.data();
         setup_header->frame_header.type = AERON_HDR_TYPE_SETUP;
+        setup_header->frame_header.flags = 0;
         setup_header->stream_id = stream_id;
         setup_header->session_id = session_id;
         setup_header->initial_term_id = term_id;
         setup_header->active_term_id = term_id;
         setup_header->term_offset = term_offset;
         setup_header->term_length = TERM_BUFFER_SIZE;
+        setup_header->mtu = MTU;
+        setup_header->ttl = 0;
 
         return setup_header;
     }
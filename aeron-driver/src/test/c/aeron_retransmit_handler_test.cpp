@@ -16,6 +16,7 @@
 
 #include <array>
 #include <functional>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -50,18 +51,36 @@ public:
         aeron_retransmit_handler_close(&m_handler);
     }
 
-    static int on_resend(void *clientd, int32_t term_id, int32_t term_offset, size_t length)
+    static int on_resend(
+        void *clientd,
+        int32_t term_id,
+        int32_t term_offset,
+        size_t length,
+        const struct sockaddr_storage *repair_addrs,
+        size_t repair_addr_count)
     {
         RetransmitHandlerTest *t = (RetransmitHandlerTest *)clientd;
 
+        t->m_repair_addr_count = repair_addr_count;
         return t->m_resend(term_id, term_offset, length);
     }
 
+    static void receiverAddr(struct sockaddr_storage *addr, uint16_t port)
+    {
+        struct sockaddr_in *in4 = (struct sockaddr_in *)addr;
+
+        memset(addr, 0, sizeof(struct sockaddr_storage));
+        in4->sin_family = AF_INET;
+        in4->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        in4->sin_port = htons(port);
+    }
+
 protected:
     int64_t m_time;
     int64_t m_invalid_packet_counter;
     aeron_retransmit_handler_t m_handler;
     std::function<int(int32_t, int32_t, size_t)> m_resend;
+    size_t m_repair_addr_count = 0;
 };
 
 TEST_F(RetransmitHandlerTest, shouldImmediateRetransmitOnNak)
@@ -181,3 +200,210 @@ TEST_F(RetransmitHandlerTest, shouldRetransmitOnMultipleNaks)
         &m_handler, TERM_ID, nak_offset_2, nak_length_2, TERM_LENGTH, m_time, RetransmitHandlerTest::on_resend, this), 0);
     EXPECT_EQ(called, 2u);
 }
+
+TEST_F(RetransmitHandlerTest, shouldOnlyRetransmitUncoveredPartOfOverlappingNakWhileInLinger)
+{
+    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, 0, LINGER_TIMEOUT_20MS), 0);
+
+    const int32_t nak_offset = (ALIGNED_FRAME_LENGTH * 2);
+    const size_t nak_length = ALIGNED_FRAME_LENGTH * 2;
+
+    size_t called = 0;
+    m_resend =
+        [&](int32_t term_id, int32_t term_offset, size_t length)
+        {
+            called++;
+
+            EXPECT_EQ(term_id, TERM_ID);
+            if (1 == called)
+            {
+                EXPECT_EQ(term_offset, nak_offset);
+                EXPECT_EQ(length, nak_length);
+            }
+            else if (2 == called)
+            {
+                EXPECT_EQ(term_offset, nak_offset + (int32_t)nak_length);
+                EXPECT_EQ(length, (size_t)ALIGNED_FRAME_LENGTH);
+            }
+            return 0;
+        };
+
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, nak_offset, nak_length, TERM_LENGTH, m_time, RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler,
+        TERM_ID,
+        nak_offset + ALIGNED_FRAME_LENGTH,
+        nak_length,
+        TERM_LENGTH,
+        m_time,
+        RetransmitHandlerTest::on_resend,
+        this), 0);
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, nak_offset, nak_length, TERM_LENGTH, m_time, RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(called, 2u);
+}
+
+TEST_F(RetransmitHandlerTest, shouldMergeAdjacentAndOverlappingDelayedNaks)
+{
+    const int64_t delay_timeout_ns = 5 * 1000 * 1000L;
+    ASSERT_EQ(aeron_retransmit_handler_init(
+        &m_handler, &m_invalid_packet_counter, delay_timeout_ns, LINGER_TIMEOUT_20MS), 0);
+
+    size_t called = 0;
+    m_resend =
+        [&](int32_t term_id, int32_t term_offset, size_t length)
+        {
+            called++;
+
+            EXPECT_EQ(term_id, TERM_ID);
+            EXPECT_EQ(term_offset, (int32_t)ALIGNED_FRAME_LENGTH);
+            EXPECT_EQ(length, (size_t)(ALIGNED_FRAME_LENGTH * 6));
+            return 0;
+        };
+
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler,
+        TERM_ID,
+        ALIGNED_FRAME_LENGTH * 5,
+        ALIGNED_FRAME_LENGTH * 2,
+        TERM_LENGTH,
+        m_time,
+        RetransmitHandlerTest::on_resend,
+        this), 0);
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler,
+        TERM_ID,
+        ALIGNED_FRAME_LENGTH,
+        ALIGNED_FRAME_LENGTH * 2,
+        TERM_LENGTH,
+        m_time,
+        RetransmitHandlerTest::on_resend,
+        this), 0);
+    EXPECT_EQ(m_handler.active_retransmits_map.size, 2u);
+
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler,
+        TERM_ID,
+        ALIGNED_FRAME_LENGTH * 2,
+        ALIGNED_FRAME_LENGTH * 3,
+        TERM_LENGTH,
+        m_time,
+        RetransmitHandlerTest::on_resend,
+        this), 0);
+    EXPECT_EQ(m_handler.active_retransmits_map.size, 1u);
+    EXPECT_EQ(called, 0u);
+
+    m_time = delay_timeout_ns + 1;
+    EXPECT_EQ(aeron_retransmit_handler_process_timeouts(&m_handler, m_time, RetransmitHandlerTest::on_resend, this), 1);
+    EXPECT_EQ(called, 1u);
+}
+
+TEST_F(RetransmitHandlerTest, shouldDeferResendAndMergeNaksWhenBudgetExhausted)
+{
+    const uint64_t rate_bytes_per_sec = 100 * 1000;
+    int64_t deferred_counter = 0;
+    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, 0, LINGER_TIMEOUT_20MS), 0);
+    aeron_retransmit_handler_init_budget(&m_handler, rate_bytes_per_sec, nullptr, &deferred_counter);
+
+    std::vector<std::pair<int32_t, size_t>> resends;
+    m_resend =
+        [&](int32_t term_id, int32_t term_offset, size_t length)
+        {
+            resends.emplace_back(term_offset, length);
+            return 0;
+        };
+
+    // The burst of 1000 bytes goes into debt for the first range so the next ones are deferred.
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, 0, 2048, TERM_LENGTH, m_time, RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, 4096, 1024, TERM_LENGTH, m_time, RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, 5120, 1024, TERM_LENGTH, m_time, RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(1u, resends.size());
+    EXPECT_EQ(1, deferred_counter);
+
+    m_time += 5 * 1000 * 1000;
+    aeron_retransmit_handler_process_timeouts(&m_handler, m_time, RetransmitHandlerTest::on_resend, this);
+    EXPECT_EQ(1u, resends.size());
+
+    m_time += 10 * 1000 * 1000;
+    aeron_retransmit_handler_process_timeouts(&m_handler, m_time, RetransmitHandlerTest::on_resend, this);
+    ASSERT_EQ(2u, resends.size());
+    EXPECT_EQ(4096, resends[1].first);
+    EXPECT_EQ(2048u, resends[1].second);
+}
+
+TEST_F(RetransmitHandlerTest, shouldShareSenderBudgetAcrossHandlers)
+{
+    aeron_retransmit_budget_t sender_budget;
+    aeron_retransmit_handler_t other_handler;
+    int64_t deferred_counter = 0;
+    size_t called = 0;
+    aeron_retransmit_budget_init(&sender_budget, 100 * 1000);
+
+    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, 0, LINGER_TIMEOUT_20MS), 0);
+    ASSERT_EQ(aeron_retransmit_handler_init(&other_handler, &m_invalid_packet_counter, 0, LINGER_TIMEOUT_20MS), 0);
+    aeron_retransmit_handler_init_budget(&m_handler, 0, &sender_budget, &deferred_counter);
+    aeron_retransmit_handler_init_budget(&other_handler, 0, &sender_budget, &deferred_counter);
+
+    m_resend =
+        [&](int32_t term_id, int32_t term_offset, size_t length)
+        {
+            called++;
+            return 0;
+        };
+
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &m_handler, TERM_ID, 0, 2048, TERM_LENGTH, m_time, RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(aeron_retransmit_handler_on_nak(
+        &other_handler, TERM_ID, 0, 2048, TERM_LENGTH, m_time, RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(1u, called);
+    EXPECT_EQ(1, deferred_counter);
+
+    aeron_retransmit_handler_close(&other_handler);
+}
+
+TEST_F(RetransmitHandlerTest, shouldRepairByUnicastUntilMoreReceiversThanThresholdNak)
+{
+    ASSERT_EQ(aeron_retransmit_handler_init(&m_handler, &m_invalid_packet_counter, 0, LINGER_TIMEOUT_20MS), 0);
+    aeron_retransmit_handler_init_unicast_repair(&m_handler, 1);
+
+    const int32_t nak_offset = (ALIGNED_FRAME_LENGTH * 2);
+    const size_t nak_length = ALIGNED_FRAME_LENGTH;
+    struct sockaddr_storage receiver_a;
+    struct sockaddr_storage receiver_b;
+    receiverAddr(&receiver_a, 40001);
+    receiverAddr(&receiver_b, 40002);
+
+    size_t called = 0;
+    m_resend =
+        [&](int32_t term_id, int32_t term_offset, size_t length)
+        {
+            called++;
+            return 0;
+        };
+
+    EXPECT_EQ(aeron_retransmit_handler_on_nak_from(
+        &m_handler, TERM_ID, nak_offset, nak_length, TERM_LENGTH, &receiver_a, m_time,
+        RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(called, 1u);
+    EXPECT_EQ(m_repair_addr_count, 1u);
+
+    EXPECT_EQ(aeron_retransmit_handler_on_nak_from(
+        &m_handler, TERM_ID, nak_offset, nak_length, TERM_LENGTH, &receiver_a, m_time,
+        RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(called, 1u);
+
+    EXPECT_EQ(aeron_retransmit_handler_on_nak_from(
+        &m_handler, TERM_ID, nak_offset, nak_length, TERM_LENGTH, &receiver_b, m_time,
+        RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(called, 2u);
+    EXPECT_EQ(m_repair_addr_count, 0u);
+
+    EXPECT_EQ(aeron_retransmit_handler_on_nak_from(
+        &m_handler, TERM_ID, nak_offset, nak_length, TERM_LENGTH, &receiver_b, m_time,
+        RetransmitHandlerTest::on_resend, this), 0);
+    EXPECT_EQ(called, 2u);
+}
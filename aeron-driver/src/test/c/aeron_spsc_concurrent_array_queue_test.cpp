@@ -158,6 +158,66 @@ TEST_F(SpscQueueTest, shouldDrainingFullQueueWithLimit)
     EXPECT_EQ(aeron_spsc_concurrent_array_queue_size(&m_q), CAPACITY - limit);
 }
 
+TEST_F(SpscQueueTest, shouldOfferBulkUpToCapacity)
+{
+    void *elements[CAPACITY + 2];
+    for (size_t i = 0; i < CAPACITY + 2; i++)
+    {
+        elements[i] = (void *)(i + 1);
+    }
+
+    EXPECT_EQ(aeron_spsc_concurrent_array_queue_offer_bulk(&m_q, elements, 3), 3u);
+    EXPECT_EQ(aeron_spsc_concurrent_array_queue_offer_bulk(&m_q, elements + 3, CAPACITY), CAPACITY - 3);
+    EXPECT_EQ(aeron_spsc_concurrent_array_queue_offer_bulk(&m_q, elements + CAPACITY, 2), 0u);
+    EXPECT_EQ(aeron_spsc_concurrent_array_queue_size(&m_q), CAPACITY);
+
+    int64_t counter = 1;
+    m_drain =
+        [&](volatile void *e)
+        {
+            ASSERT_EQ(e, (void *)counter);
+            counter++;
+        };
+
+    EXPECT_EQ(aeron_spsc_concurrent_array_queue_drain_all(&m_q, SpscQueueTest::drain_func, this), CAPACITY);
+}
+
+TEST_F(SpscQueueTest, shouldStopOfferBulkAtNullElement)
+{
+    void *elements[] = { (void *)1, (void *)2, nullptr, (void *)4 };
+
+    EXPECT_EQ(aeron_spsc_concurrent_array_queue_offer_bulk(&m_q, elements, 4), 2u);
+    EXPECT_EQ(aeron_spsc_concurrent_array_queue_size(&m_q), 2u);
+}
+
+TEST_F(SpscQueueTest, shouldWakeProducerWaitingForSpace)
+{
+    fillQueue();
+    std::atomic<bool> offered(false);
+
+    std::thread producer(
+        [&]()
+        {
+            while (AERON_OFFER_SUCCESS != aeron_spsc_concurrent_array_queue_offer(&m_q, (void *)(CAPACITY + 1)))
+            {
+                aeron_spsc_concurrent_array_queue_wait_for_space(&m_q, 10 * 1000 * 1000 * 1000LL);
+            }
+            offered = true;
+        });
+
+    while (0 == m_q.space_notification.waiter_count)
+    {
+        std::this_thread::yield();
+    }
+
+    m_drain = [&](volatile void *e) {};
+    EXPECT_EQ(aeron_spsc_concurrent_array_queue_drain(&m_q, SpscQueueTest::drain_func, this, 1), 1u);
+
+    producer.join();
+    EXPECT_TRUE(offered);
+    EXPECT_EQ(aeron_spsc_concurrent_array_queue_size(&m_q), CAPACITY);
+}
+
 #define NUM_MESSAGES (10 * 1000 * 1000)
 
 static void spsc_queue_concurrent_handler(void *clientd, volatile void *element)
@@ -370,6 +370,72 @@ TEST_F(SpscRbTest, shouldLimitReadOfMessages)
 #define NUM_MESSAGES (10 * 1000 * 1000)
 #define NUM_IDS_PER_THREAD (10 * 1000 * 1000)
 
+TEST_F(SpscRbTest, shouldClaimCommitAndReadMessageEncodedInPlace)
+{
+    aeron_spsc_rb_t rb;
+    size_t length = 12;
+    size_t recordLength = length + AERON_RB_RECORD_HEADER_LENGTH;
+
+    ASSERT_EQ(aeron_spsc_rb_init(&rb, m_buffer.data(), m_buffer.size()), 0);
+
+    const int32_t index = aeron_spsc_rb_try_claim(&rb, MSG_TYPE_ID, length);
+    ASSERT_EQ(index, (int32_t)AERON_RB_RECORD_HEADER_LENGTH);
+
+    aeron_rb_record_descriptor_t *record = (aeron_rb_record_descriptor_t *)(rb.buffer);
+    EXPECT_EQ(record->length, -(int32_t)recordLength);
+    EXPECT_EQ(record->msg_type_id, (int32_t)MSG_TYPE_ID);
+
+    memset(rb.buffer + index, 7, length);
+
+    size_t timesCalled = 0;
+    EXPECT_EQ(aeron_spsc_rb_read(&rb, countTimesAsSizeT, &timesCalled, 10), (size_t)0);
+
+    ASSERT_EQ(aeron_spsc_rb_commit(&rb, index), AERON_RB_SUCCESS);
+    EXPECT_EQ(record->length, (int32_t)recordLength);
+
+    EXPECT_EQ(aeron_spsc_rb_read(&rb, countTimesAsSizeT, &timesCalled, 10), (size_t)1);
+    EXPECT_EQ(timesCalled, (size_t)1);
+}
+
+TEST_F(SpscRbTest, shouldSkipAbortedClaim)
+{
+    aeron_spsc_rb_t rb;
+    size_t length = 12;
+    size_t alignedRecordLength = AERON_ALIGN(length + AERON_RB_RECORD_HEADER_LENGTH, AERON_RB_ALIGNMENT);
+
+    ASSERT_EQ(aeron_spsc_rb_init(&rb, m_buffer.data(), m_buffer.size()), 0);
+
+    const int32_t index = aeron_spsc_rb_try_claim(&rb, MSG_TYPE_ID, length);
+    ASSERT_GT(index, 0);
+    ASSERT_EQ(aeron_spsc_rb_abort(&rb, index), AERON_RB_SUCCESS);
+
+    aeron_rb_record_descriptor_t *record = (aeron_rb_record_descriptor_t *)(rb.buffer);
+    EXPECT_EQ(record->msg_type_id, AERON_RB_PADDING_MSG_TYPE_ID);
+
+    size_t timesCalled = 0;
+    EXPECT_EQ(aeron_spsc_rb_read(&rb, countTimesAsSizeT, &timesCalled, 10), (size_t)0);
+    EXPECT_EQ(timesCalled, (size_t)0);
+    EXPECT_EQ(rb.descriptor->head_position, (int64_t)alignedRecordLength);
+}
+
+TEST_F(SpscRbTest, shouldRejectCommitOrAbortOfUnclaimedSpace)
+{
+    aeron_spsc_rb_t rb;
+
+    ASSERT_EQ(aeron_spsc_rb_init(&rb, m_buffer.data(), m_buffer.size()), 0);
+
+    EXPECT_EQ(aeron_spsc_rb_try_claim(&rb, MSG_TYPE_ID, rb.max_message_length + 1), AERON_RB_ERROR);
+
+    const int32_t index = aeron_spsc_rb_try_claim(&rb, MSG_TYPE_ID, 8);
+    ASSERT_GT(index, 0);
+
+    EXPECT_EQ(aeron_spsc_rb_commit(&rb, 0), AERON_RB_ERROR);
+    EXPECT_EQ(aeron_spsc_rb_commit(&rb, (int32_t)rb.capacity + 8), AERON_RB_ERROR);
+    EXPECT_EQ(aeron_spsc_rb_commit(&rb, index), AERON_RB_SUCCESS);
+    EXPECT_EQ(aeron_spsc_rb_commit(&rb, index), AERON_RB_ERROR);
+    EXPECT_EQ(aeron_spsc_rb_abort(&rb, index), AERON_RB_ERROR);
+}
+
 TEST(SpscRbConcurrentTest, shouldProvideCorrelationIds)
 {
     AERON_DECL_ALIGNED(buffer_t buffer, 16);
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "aeron_common.h"
+#include "util/aeron_error.h"
+#include "util/aeron_fileutil.h"
+#include "concurrent/aeron_term_cleaner.h"
+}
+
+#define TERM_LENGTH (64 * 1024)
+#define PAGE_SIZE (4 * 1024)
+
+class TermCleanerTest : public testing::TestWithParam<aeron_term_buffer_clean_mode_t>
+{
+public:
+    void SetUp() override
+    {
+        ASSERT_GT(aeron_temp_filename(m_path, sizeof(m_path)), 0u);
+        ASSERT_EQ(0, aeron_map_new_file(&m_mapped_file, m_path, true)) << aeron_errmsg();
+        memset(m_mapped_file.addr, 0x5a, m_mapped_file.length);
+        aeron_term_cleaner_init(&m_cleaner, GetParam(), PAGE_SIZE);
+    }
+
+    void TearDown() override
+    {
+        aeron_unmap(&m_mapped_file);
+        remove(m_path);
+    }
+
+    void cleanAndVerify(size_t term_offset, size_t length)
+    {
+        auto *buffer = (uint8_t *)m_mapped_file.addr;
+        aeron_term_cleaner_clean(&m_cleaner, buffer, term_offset, length);
+
+        for (size_t i = 0; i < TERM_LENGTH; i++)
+        {
+            const uint8_t expected = (i >= term_offset && i < term_offset + length) ? 0 : 0x5a;
+            ASSERT_EQ(expected, buffer[i]) << "index " << i;
+        }
+    }
+
+protected:
+    char m_path[AERON_MAX_PATH] = {};
+    aeron_mapped_file_t m_mapped_file = { nullptr, TERM_LENGTH };
+    aeron_term_cleaner_t m_cleaner = {};
+};
+
+TEST_P(TermCleanerTest, shouldCleanRegionWithinPage)
+{
+    cleanAndVerify(96, 1024);
+}
+
+TEST_P(TermCleanerTest, shouldCleanRegionSpanningPages)
+{
+    cleanAndVerify(PAGE_SIZE - 32, (PAGE_SIZE * 3) + 64);
+}
+
+TEST_P(TermCleanerTest, shouldCleanPageAlignedRegion)
+{
+    cleanAndVerify(PAGE_SIZE, PAGE_SIZE * 4);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    TermCleanerModes,
+    TermCleanerTest,
+    testing::Values(
+        AERON_TERM_BUFFER_CLEAN_MODE_MEMSET,
+        AERON_TERM_BUFFER_CLEAN_MODE_NON_TEMPORAL,
+        AERON_TERM_BUFFER_CLEAN_MODE_PUNCH_HOLE));
@@ -189,3 +189,55 @@ TEST_F(TermScannerTest, shouldScanLastMessageInBufferMinusPaddingLimitedByMtu)
         m_ptr, CAPACITY - offset, mtu, &m_padding), (size_t)aligned_frame_length);
     EXPECT_EQ(m_padding, 0u);
 }
+
+TEST_F(TermScannerTest, shouldScanRunOfEqualMessagesUpToMtu)
+{
+    int32_t frame_length = AERON_ALIGN((AERON_DATA_HEADER_LENGTH + 32), AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    size_t frame_count = (MTU_LENGTH / frame_length) + 8;
+
+    for (size_t i = 0; i < frame_count; i++)
+    {
+        aeron_data_header_t *data_header = (aeron_data_header_t *)(m_ptr + (i * frame_length));
+        data_header->frame_header.frame_length = frame_length;
+        data_header->frame_header.type = AERON_HDR_TYPE_DATA;
+        data_header->frame_header.flags = i % 2 ? AERON_DATA_HEADER_BEGIN_FLAG : AERON_DATA_HEADER_END_FLAG;
+    }
+
+    EXPECT_EQ(aeron_term_scanner_scan_for_availability(
+        m_ptr, CAPACITY, MTU_LENGTH, &m_padding), (size_t)((MTU_LENGTH / frame_length) * frame_length));
+    EXPECT_EQ(m_padding, 0u);
+}
+
+TEST_F(TermScannerTest, shouldStopRunAtMessageNotYetAvailable)
+{
+    int32_t frame_length = AERON_ALIGN((AERON_DATA_HEADER_LENGTH + 32), AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    size_t available_count = 6;
+
+    for (size_t i = 0; i < available_count; i++)
+    {
+        aeron_data_header_t *data_header = (aeron_data_header_t *)(m_ptr + (i * frame_length));
+        data_header->frame_header.frame_length = frame_length;
+        data_header->frame_header.type = AERON_HDR_TYPE_DATA;
+    }
+
+    EXPECT_EQ(aeron_term_scanner_scan_for_availability(
+        m_ptr, CAPACITY, MTU_LENGTH, &m_padding), available_count * frame_length);
+    EXPECT_EQ(m_padding, 0u);
+}
+
+TEST_F(TermScannerTest, shouldStopRunAtPaddingFrame)
+{
+    int32_t frame_length = AERON_ALIGN((AERON_DATA_HEADER_LENGTH + 32), AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    size_t data_count = 5;
+
+    for (size_t i = 0; i < data_count + 3; i++)
+    {
+        aeron_data_header_t *data_header = (aeron_data_header_t *)(m_ptr + (i * frame_length));
+        data_header->frame_header.frame_length = frame_length;
+        data_header->frame_header.type = i == data_count ? AERON_HDR_TYPE_PAD : AERON_HDR_TYPE_DATA;
+    }
+
+    EXPECT_EQ(aeron_term_scanner_scan_for_availability(
+        m_ptr, CAPACITY, MTU_LENGTH, &m_padding), (data_count * frame_length) + AERON_DATA_HEADER_LENGTH);
+    EXPECT_EQ(m_padding, (size_t)(frame_length - AERON_DATA_HEADER_LENGTH));
+}
@@ -80,7 +80,34 @@ int aeron_test_udp_channel_transport_sendmmsg(
 {
     aeron_test_udp_bindings_state_t *state = (aeron_test_udp_bindings_state_t *)transport->bindings_clientd;
     state->mmsg_count++;
-    return 0;
+
+    for (size_t i = 0; i < vlen; i++)
+    {
+        for (size_t j = 0; j < (size_t)msgvec[i].msg_hdr.msg_iovlen; j++)
+        {
+            aeron_frame_header_t *header = (aeron_frame_header_t *)msgvec[i].msg_hdr.msg_iov[j].iov_base;
+
+            switch (header->type)
+            {
+                case AERON_HDR_TYPE_SM:
+                    state->sm_count++;
+                    break;
+
+                case AERON_HDR_TYPE_NAK:
+                    state->nak_count++;
+                    break;
+
+                case AERON_HDR_TYPE_RTTM:
+                    state->rttm_count++;
+                    break;
+
+                default:
+                    break;
+            }
+        }
+    }
+
+    return (int)vlen;
 }
 
 int aeron_test_udp_channel_transport_sendmsg(
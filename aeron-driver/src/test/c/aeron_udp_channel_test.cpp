@@ -413,6 +413,60 @@ TEST_F(UdpChannelTest, shouldHandleTooSmallBuffer)
     ASSERT_LE(aeron_format_source_identity(buffer, AERON_NETUTIL_FORMATTED_MAX_LENGTH - 1, &addr), 0);
 }
 
+TEST_F(UdpChannelTest, shouldCopyParsedChannelWithIndependentUri)
+{
+    ASSERT_EQ(parse_udp_channel("aeron:udp?interface=localhost|endpoint=localhost:40124|session-id=12"), 0)
+        << aeron_errmsg();
+
+    aeron_udp_channel_t *copy = nullptr;
+    ASSERT_EQ(aeron_udp_channel_copy(m_channel, &copy), 0) << aeron_errmsg();
+    ASSERT_NE(m_channel, copy);
+    EXPECT_TRUE(aeron_udp_channel_equals(m_channel, copy));
+    EXPECT_FALSE(copy->has_generated_canonical_suffix);
+    EXPECT_EQ(port(&copy->remote_data), 40124);
+    EXPECT_STREQ(inet_ntop(&copy->local_data), "127.0.0.1");
+    EXPECT_NE(m_channel->uri.params.udp.endpoint, copy->uri.params.udp.endpoint);
+    EXPECT_STREQ(copy->uri.params.udp.endpoint, "localhost:40124");
+    EXPECT_STREQ(aeron_uri_find_param_value(&copy->uri.params.udp.additional_params, "session-id"), "12");
+
+    aeron_udp_channel_delete(copy);
+}
+
+TEST_F(UdpChannelTest, shouldShareParsedChannelUntilLastReferenceDeleted)
+{
+    ASSERT_EQ(parse_udp_channel("aeron:udp?endpoint=localhost:40124"), 0) << aeron_errmsg();
+    EXPECT_EQ(1, m_channel->refcnt);
+
+    aeron_udp_channel_t *shared = aeron_udp_channel_incref(m_channel);
+    ASSERT_EQ(m_channel, shared);
+    EXPECT_EQ(2, m_channel->refcnt);
+    EXPECT_TRUE(aeron_udp_channel_equals(m_channel, shared));
+
+    aeron_udp_channel_delete(shared);
+    EXPECT_EQ(1, m_channel->refcnt);
+    EXPECT_EQ(port(&m_channel->remote_data), 40124);
+}
+
+TEST_F(UdpChannelTest, shouldFlagGeneratedCanonicalSuffixForWildcardPortWithoutTag)
+{
+    ASSERT_EQ(parse_udp_channel("aeron:udp?endpoint=localhost:0"), 0) << aeron_errmsg();
+    EXPECT_TRUE(m_channel->has_generated_canonical_suffix);
+
+    ASSERT_EQ(parse_udp_channel("aeron:udp?endpoint=localhost:0|tags=1001"), 0) << aeron_errmsg();
+    EXPECT_FALSE(m_channel->has_generated_canonical_suffix);
+}
+
+TEST_F(UdpChannelTest, shouldParseDscp)
+{
+    ASSERT_EQ(parse_udp_channel("aeron:udp?endpoint=localhost:40124"), 0) << aeron_errmsg();
+    EXPECT_EQ(-1, m_channel->dscp);
+
+    ASSERT_EQ(parse_udp_channel("aeron:udp?endpoint=localhost:40124|dscp=46"), 0) << aeron_errmsg();
+    EXPECT_EQ(46, m_channel->dscp);
+
+    ASSERT_EQ(parse_udp_channel("aeron:udp?endpoint=localhost:40124|dscp=64"), -1);
+}
+
 TEST_P(UdpChannelNamesParameterisedTest, shouldBeValid)
 {
     const char *endpoint_name = std::get<0>(GetParam());
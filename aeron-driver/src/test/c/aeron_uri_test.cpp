@@ -25,6 +25,7 @@ extern "C"
 #include "util/aeron_netutil.h"
 #include "aeron_driver_context.h"
 #include "aeron_driver_conductor.h"
+#include "aeron_network_publication.h"
 #include "aeron_name_resolver.h"
 }
 
@@ -151,6 +152,73 @@ TEST_F(UriTest, shouldParsePublicationParamLingerTimeout)
     EXPECT_EQ(params.linger_timeout_ns, 7777u);
 }
 
+TEST_F(UriTest, shouldParsePublicationParamHugePages)
+{
+    aeron_uri_publication_params_t params;
+
+    EXPECT_EQ(AERON_URI_PARSE("aeron:udp?endpoint=224.10.9.8", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_publication_params(&m_uri, &params, &m_conductor, false), 0);
+    EXPECT_FALSE(params.is_huge_pages);
+
+    EXPECT_EQ(AERON_URI_PARSE("aeron:ipc?huge-pages=true", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_publication_params(&m_uri, &params, &m_conductor, false), 0);
+    EXPECT_TRUE(params.is_huge_pages);
+}
+
+TEST_F(UriTest, shouldParsePublicationParamNumaNode)
+{
+    aeron_uri_publication_params_t params;
+
+    EXPECT_EQ(AERON_URI_PARSE("aeron:udp?endpoint=224.10.9.8", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_publication_params(&m_uri, &params, &m_conductor, false), 0);
+    EXPECT_EQ(params.numa_node, AERON_NUMA_NODE_NONE);
+
+    EXPECT_EQ(AERON_URI_PARSE("aeron:ipc?numa=1", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_publication_params(&m_uri, &params, &m_conductor, false), 0);
+    EXPECT_EQ(params.numa_node, 1);
+
+    EXPECT_EQ(AERON_URI_PARSE("aeron:ipc?numa=foo", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_publication_params(&m_uri, &params, &m_conductor, false), -1);
+}
+
+TEST_F(UriTest, shouldParsePublicationParamWeight)
+{
+    aeron_uri_publication_params_t params;
+
+    EXPECT_EQ(AERON_URI_PARSE("aeron:udp?endpoint=224.10.9.8", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_publication_params(&m_uri, &params, &m_conductor, false), 0);
+    EXPECT_EQ(params.weight, 0);
+
+    EXPECT_EQ(AERON_URI_PARSE("aeron:udp?endpoint=224.10.9.8|weight=8", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_publication_params(&m_uri, &params, &m_conductor, false), 0);
+    EXPECT_EQ(params.weight, 8);
+
+    EXPECT_EQ(AERON_URI_PARSE("aeron:udp?endpoint=224.10.9.8|weight=0", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_publication_params(&m_uri, &params, &m_conductor, false), -1);
+
+    EXPECT_EQ(AERON_URI_PARSE("aeron:udp?endpoint=224.10.9.8|weight=foo", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_publication_params(&m_uri, &params, &m_conductor, false), -1);
+}
+
+TEST_F(UriTest, shouldParsePublicationParamTermLengthAuto)
+{
+    aeron_uri_publication_params_t params;
+
+    EXPECT_EQ(AERON_URI_PARSE("aeron:udp?endpoint=224.10.9.8|term-length=auto", &m_uri), 0);
+    EXPECT_EQ(aeron_uri_publication_params(&m_uri, &params, &m_conductor, false), 0);
+    EXPECT_TRUE(params.is_term_length_auto);
+    EXPECT_EQ(params.term_length, m_conductor.context->term_buffer_length);
+}
+
+TEST_F(UriTest, shouldRecommendTermLengthFromBandwidthDelayProduct)
+{
+    EXPECT_EQ(aeron_network_publication_recommended_term_length(0, 0), AERON_LOGBUFFER_TERM_MIN_LENGTH);
+    EXPECT_EQ(aeron_network_publication_recommended_term_length(100 * 1000 * 1000, 1000 * 1000), 512 * 1024);
+    EXPECT_EQ(
+        aeron_network_publication_recommended_term_length(INT64_MAX / 2, 1000 * 1000 * 1000),
+        AERON_LOGBUFFER_TERM_MAX_LENGTH);
+}
+
 TEST_F(UriTest, shouldParsePublicationParamUdpTermLength)
 {
     aeron_uri_publication_params_t params;
@@ -15,6 +15,7 @@
  */
 
 #include <functional>
+#include <thread>
 
 #include <gtest/gtest.h>
 #include <cinttypes>
@@ -113,3 +114,102 @@ TEST_F(DriverAgentTest, shouldLogUntetheredSubscriptionStateChange)
     EXPECT_EQ(messagesRead, (size_t)1);
     EXPECT_EQ(timesCalled, (size_t)1);
 }
+
+TEST_F(DriverAgentTest, shouldLogToProducerRingInBinaryMode)
+{
+    aeron_init_logging_ring_buffer();
+    aeron_init_logging_binary_mode(AERON_EVENT_LOG_BINARY_FRAME_CAPTURE_LENGTH_DEFAULT, 1, 0);
+
+    int64_t correlation_id = 42;
+    aeron_driver_agent_conductor_to_driver_interceptor(
+        AERON_COMMAND_CLIENT_KEEPALIVE, &correlation_id, sizeof(correlation_id), nullptr);
+
+    auto message_handler =
+        [](int32_t msg_type_id, const void *msg, size_t length, void *clientd)
+        {
+            EXPECT_EQ(msg_type_id, AERON_CMD_IN);
+            EXPECT_EQ(length, sizeof(aeron_driver_agent_cmd_log_header_t) + sizeof(int64_t));
+            EXPECT_EQ(((aeron_driver_agent_cmd_log_header_t *)msg)->cmd_id, AERON_COMMAND_CLIENT_KEEPALIVE);
+        };
+
+    EXPECT_EQ(aeron_mpsc_rb_read(aeron_driver_agent_mpsc_rb(), message_handler, nullptr, 10), (size_t)0);
+    EXPECT_EQ(aeron_spsc_rb_read(aeron_driver_agent_producer_rb(), message_handler, nullptr, 10), (size_t)1);
+}
+
+TEST_F(DriverAgentTest, shouldSampleAndTruncateFramesInBinaryMode)
+{
+    aeron_init_logging_ring_buffer();
+    aeron_init_logging_binary_mode(AERON_EVENT_LOG_BINARY_FRAME_CAPTURE_LENGTH_DEFAULT, 4, 0);
+
+    uint8_t frame[512] = {};
+    struct sockaddr_storage addr = {};
+    struct iovec iov = {};
+    struct msghdr message = {};
+
+    iov.iov_base = frame;
+    iov.iov_len = sizeof(frame);
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+    message.msg_name = &addr;
+    message.msg_namelen = sizeof(addr);
+
+    for (int i = 0; i < 8; i++)
+    {
+        aeron_driver_agent_log_frame(AERON_FRAME_OUT, &message, sizeof(frame), sizeof(frame));
+    }
+
+    auto message_handler =
+        [](int32_t msg_type_id, const void *msg, size_t length, void *clientd)
+        {
+            EXPECT_EQ(msg_type_id, AERON_FRAME_OUT);
+            EXPECT_EQ(
+                length,
+                sizeof(aeron_driver_agent_frame_log_header_t) + sizeof(struct sockaddr_storage) +
+                AERON_EVENT_LOG_BINARY_FRAME_CAPTURE_LENGTH_DEFAULT);
+            EXPECT_EQ(((aeron_driver_agent_frame_log_header_t *)msg)->message_len, 512);
+        };
+
+    EXPECT_EQ(aeron_driver_agent_read_binary_log(message_handler, nullptr, 10), (size_t)2);
+}
+
+TEST_F(DriverAgentTest, shouldRateLimitEventsAndRecordDroppedCountInBinaryMode)
+{
+    aeron_init_logging_ring_buffer();
+    aeron_init_logging_binary_mode(AERON_EVENT_LOG_BINARY_FRAME_CAPTURE_LENGTH_DEFAULT, 1, 2);
+
+    int64_t correlation_id = 42;
+    for (int i = 0; i < 5; i++)
+    {
+        aeron_driver_agent_conductor_to_driver_interceptor(
+            AERON_COMMAND_CLIENT_KEEPALIVE, &correlation_id, sizeof(correlation_id), nullptr);
+    }
+
+    auto count_handler =
+        [](int32_t msg_type_id, const void *msg, size_t length, void *clientd)
+        {
+            EXPECT_EQ(msg_type_id, AERON_CMD_IN);
+        };
+
+    EXPECT_EQ(aeron_driver_agent_read_binary_log(count_handler, nullptr, 10), (size_t)2);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+
+    aeron_driver_agent_conductor_to_driver_interceptor(
+        AERON_COMMAND_CLIENT_KEEPALIVE, &correlation_id, sizeof(correlation_id), nullptr);
+
+    auto dropped_handler =
+        [](int32_t msg_type_id, const void *msg, size_t length, void *clientd)
+        {
+            if (AERON_EVENT_LOG_DROPPED == msg_type_id)
+            {
+                auto *hdr = (aeron_driver_agent_dropped_log_header_t *)msg;
+                EXPECT_EQ(hdr->event_type, AERON_CMD_IN);
+                EXPECT_EQ(hdr->dropped_count, 3);
+                (*(size_t *)clientd)++;
+            }
+        };
+
+    size_t dropped_records = 0;
+    EXPECT_EQ(aeron_driver_agent_read_binary_log(dropped_handler, &dropped_records, 10), (size_t)2);
+    EXPECT_EQ(dropped_records, (size_t)1);
+}
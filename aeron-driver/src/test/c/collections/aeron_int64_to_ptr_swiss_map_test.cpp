@@ -0,0 +1,229 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <functional>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "collections/aeron_int64_to_ptr_swiss_map.h"
+}
+
+class Int64ToPtrSwissMapTest : public testing::Test
+{
+public:
+    ~Int64ToPtrSwissMapTest() override
+    {
+        aeron_int64_to_ptr_swiss_map_delete(&m_map);
+    }
+
+protected:
+    static void for_each(void *clientd, int64_t key, void *value)
+    {
+        Int64ToPtrSwissMapTest *t = (Int64ToPtrSwissMapTest *)clientd;
+
+        t->m_for_each(key, value);
+    }
+
+    static bool remove_if(void *clientd, int64_t key, void *value)
+    {
+        Int64ToPtrSwissMapTest *t = (Int64ToPtrSwissMapTest *)clientd;
+
+        return t->m_remove_if(key, value);
+    }
+
+    void for_each(const std::function<void(int64_t, void *)> &func)
+    {
+        m_for_each = func;
+        aeron_int64_to_ptr_swiss_map_for_each(&m_map, Int64ToPtrSwissMapTest::for_each, this);
+    }
+
+    void remove_if(const std::function<bool(int64_t, void *)> &func)
+    {
+        m_remove_if = func;
+        aeron_int64_to_ptr_swiss_map_remove_if(&m_map, Int64ToPtrSwissMapTest::remove_if, this);
+    }
+
+    aeron_int64_to_ptr_swiss_map_t m_map;
+    std::function<void(int64_t, void *)> m_for_each;
+    std::function<bool(int64_t, void *)> m_remove_if;
+};
+
+TEST_F(Int64ToPtrSwissMapTest, shouldDoPutAndThenGetOnEmptyMap)
+{
+    int value = 42;
+    ASSERT_EQ(aeron_int64_to_ptr_swiss_map_init(&m_map, 8, AERON_MAP_DEFAULT_LOAD_FACTOR), 0);
+
+    EXPECT_EQ(aeron_int64_to_ptr_swiss_map_put(&m_map, 7, (void *)&value), 0);
+    EXPECT_EQ(aeron_int64_to_ptr_swiss_map_get(&m_map, 7), &value);
+    EXPECT_EQ(m_map.size, 1u);
+}
+
+TEST_F(Int64ToPtrSwissMapTest, shouldReplaceExistingValueForTheSameKey)
+{
+    int value = 42, new_value = 43;
+    ASSERT_EQ(aeron_int64_to_ptr_swiss_map_init(&m_map, 8, AERON_MAP_DEFAULT_LOAD_FACTOR), 0);
+
+    EXPECT_EQ(aeron_int64_to_ptr_swiss_map_put(&m_map, 7, (void *)&value), 0);
+    EXPECT_EQ(aeron_int64_to_ptr_swiss_map_put(&m_map, 7, (void *)&new_value), 0);
+    EXPECT_EQ(aeron_int64_to_ptr_swiss_map_get(&m_map, 7), &new_value);
+    EXPECT_EQ(m_map.size, 1u);
+}
+
+TEST_F(Int64ToPtrSwissMapTest, shouldGrowWhenThresholdExceeded)
+{
+    int value = 42, value_at_16 = 43;
+    ASSERT_EQ(aeron_int64_to_ptr_swiss_map_init(&m_map, 32, 0.5f), 0);
+
+    for (size_t i = 0; i < 16; i++)
+    {
+        EXPECT_EQ(aeron_int64_to_ptr_swiss_map_put(&m_map, i, (void *)&value), 0);
+    }
+
+    EXPECT_EQ(m_map.resize_threshold, 16u);
+    EXPECT_EQ(m_map.capacity, 32u);
+    EXPECT_EQ(m_map.size, 16u);
+
+    EXPECT_EQ(aeron_int64_to_ptr_swiss_map_put(&m_map, 16, (void *)&value_at_16), 0);
+
+    EXPECT_EQ(m_map.resize_threshold, 32u);
+    EXPECT_EQ(m_map.capacity, 64u);
+    EXPECT_EQ(m_map.size, 17u);
+
+    EXPECT_EQ(aeron_int64_to_ptr_swiss_map_get(&m_map, 16), &value_at_16);
+}
+
+TEST_F(Int64ToPtrSwissMapTest, shouldRemoveEntryAndReuseSlots)
+{
+    int value = 42;
+    ASSERT_EQ(aeron_int64_to_ptr_swiss_map_init(&m_map, 16, AERON_MAP_DEFAULT_LOAD_FACTOR), 0);
+    const size_t capacity = m_map.capacity;
+
+    for (int64_t i = 0; i < 10000; i++)
+    {
+        EXPECT_EQ(aeron_int64_to_ptr_swiss_map_put(&m_map, i, (void *)&value), 0);
+        EXPECT_EQ(aeron_int64_to_ptr_swiss_map_remove(&m_map, i), &value);
+        EXPECT_EQ(aeron_int64_to_ptr_swiss_map_get(&m_map, i), (void *)nullptr);
+    }
+
+    EXPECT_EQ(m_map.size, 0u);
+    EXPECT_EQ(m_map.capacity, capacity);
+}
+
+TEST_F(Int64ToPtrSwissMapTest, shouldFindAllKeysAfterInterleavedPutsAndRemoves)
+{
+    static int values[4096];
+    ASSERT_EQ(aeron_int64_to_ptr_swiss_map_init(&m_map, 8, AERON_MAP_DEFAULT_LOAD_FACTOR), 0);
+
+    for (int64_t i = 0; i < 4096; i++)
+    {
+        EXPECT_EQ(aeron_int64_to_ptr_swiss_map_put(&m_map, i * 1024, (void *)&values[i]), 0);
+        if (0 == (i % 3))
+        {
+            EXPECT_EQ(aeron_int64_to_ptr_swiss_map_remove(&m_map, (i / 2) * 1024), &values[i / 2]);
+            EXPECT_EQ(aeron_int64_to_ptr_swiss_map_put(&m_map, (i / 2) * 1024, (void *)&values[i / 2]), 0);
+        }
+    }
+
+    EXPECT_EQ(m_map.size, 4096u);
+    for (int64_t i = 0; i < 4096; i++)
+    {
+        EXPECT_EQ(aeron_int64_to_ptr_swiss_map_get(&m_map, i * 1024), &values[i]);
+        EXPECT_EQ(aeron_int64_to_ptr_swiss_map_get(&m_map, (i * 1024) + 1), (void *)nullptr);
+    }
+}
+
+TEST_F(Int64ToPtrSwissMapTest, shouldNotForEachEmptyMap)
+{
+    ASSERT_EQ(aeron_int64_to_ptr_swiss_map_init(&m_map, 8, AERON_MAP_DEFAULT_LOAD_FACTOR), 0);
+
+    size_t called = 0;
+    for_each(
+        [&](int64_t key, void *value_ptr)
+        {
+            called++;
+        });
+
+    ASSERT_EQ(called, 0u);
+}
+
+TEST_F(Int64ToPtrSwissMapTest, shouldForEachNonEmptyMap)
+{
+    int value = 42;
+    ASSERT_EQ(aeron_int64_to_ptr_swiss_map_init(&m_map, 8, AERON_MAP_DEFAULT_LOAD_FACTOR), 0);
+
+    EXPECT_EQ(aeron_int64_to_ptr_swiss_map_put(&m_map, 7, (void *)&value), 0);
+
+    size_t called = 0;
+    for_each(
+        [&](int64_t key, void *value_ptr)
+        {
+            EXPECT_EQ(key, 7);
+            EXPECT_EQ(value_ptr, &value);
+            called++;
+        });
+
+    ASSERT_EQ(called, 1u);
+}
+
+TEST_F(Int64ToPtrSwissMapTest, shouldNotRemoveIfEmptyMap)
+{
+    ASSERT_EQ(aeron_int64_to_ptr_swiss_map_init(&m_map, 8, AERON_MAP_DEFAULT_LOAD_FACTOR), 0);
+
+    size_t called = 0;
+    remove_if(
+        [&](int64_t key, void *value_ptr)
+        {
+            called++;
+            return false;
+        });
+
+    ASSERT_EQ(called, 0u);
+}
+
+TEST_F(Int64ToPtrSwissMapTest, shouldRemoveIfNonEmptyMap)
+{
+    int value0 = 42;
+    int value1 = 43;
+    ASSERT_EQ(aeron_int64_to_ptr_swiss_map_init(&m_map, 8, AERON_MAP_DEFAULT_LOAD_FACTOR), 0);
+
+    for (int i = 0; i < 100; i++)
+    {
+        void *value = ((i & 1) == 0) ? &value0 : &value1;
+        EXPECT_EQ(aeron_int64_to_ptr_swiss_map_put(&m_map, i, value), 0);
+    }
+
+    size_t called = 0;
+    remove_if(
+        [&](int64_t key, void *value_ptr)
+        {
+            called++;
+            int val = *((int *)value_ptr);
+            return (val & 1) == 1;
+        });
+
+    ASSERT_EQ(called, 100u);
+    ASSERT_EQ(m_map.size, 50u);
+
+    for_each(
+        [&](int64_t key, void *value_ptr)
+        {
+            int val = *((int *)value_ptr);
+            EXPECT_EQ(0, val & 1);
+            called++;
+        });
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include <arpa/inet.h>
+#include <netinet/in.h>
+
+#include "media/aeron_udp_channel_transport_af_xdp.h"
+}
+
+class UdpChannelTransportAfXdpTest : public testing::Test
+{
+public:
+    UdpChannelTransportAfXdpTest() = default;
+
+protected:
+    size_t writeIpv4Frame(
+        const char *payload, bool vlan = false, uint8_t protocol = 17, uint16_t flags_and_offset = 0x4000)
+    {
+        const size_t payload_length = strlen(payload);
+        size_t offset = 12;
+
+        m_frame.fill(0);
+        if (vlan)
+        {
+            m_frame[offset++] = 0x81;
+            m_frame[offset++] = 0x00;
+            m_frame[offset++] = 0x00;
+            m_frame[offset++] = 0x07;
+        }
+        m_frame[offset++] = 0x08;
+        m_frame[offset++] = 0x00;
+
+        uint8_t *ip = m_frame.data() + offset;
+        ip[0] = 0x45;
+        ip[6] = (uint8_t)(flags_and_offset >> 8);
+        ip[7] = (uint8_t)(flags_and_offset & 0xFF);
+        ip[9] = protocol;
+        ip[12] = 10; ip[13] = 0; ip[14] = 0; ip[15] = 1;
+        ip[16] = 224; ip[17] = 0; ip[18] = 1; ip[19] = 1;
+        offset += 20;
+
+        writeUdp(offset, payload, payload_length);
+
+        return offset + 8 + payload_length;
+    }
+
+    void writeUdp(size_t offset, const char *payload, size_t payload_length)
+    {
+        uint8_t *udp = m_frame.data() + offset;
+        const uint16_t udp_length = (uint16_t)(8 + payload_length);
+
+        udp[0] = (uint8_t)(40123 >> 8);
+        udp[1] = (uint8_t)(40123 & 0xFF);
+        udp[2] = (uint8_t)(40456 >> 8);
+        udp[3] = (uint8_t)(40456 & 0xFF);
+        udp[4] = (uint8_t)(udp_length >> 8);
+        udp[5] = (uint8_t)(udp_length & 0xFF);
+        memcpy(udp + 8, payload, payload_length);
+    }
+
+    std::array<uint8_t, 256> m_frame = {};
+    aeron_udp_channel_transport_af_xdp_frame_t m_parsed = {};
+};
+
+TEST_F(UdpChannelTransportAfXdpTest, shouldParseIpv4UdpFrame)
+{
+    const size_t length = writeIpv4Frame("hello");
+
+    ASSERT_EQ(0, aeron_udp_channel_transport_af_xdp_parse_frame(m_frame.data(), length, &m_parsed));
+
+    auto *src = (struct sockaddr_in *)&m_parsed.src_addr;
+    auto *dst = (struct sockaddr_in *)&m_parsed.dst_addr;
+    EXPECT_EQ(AF_INET, src->sin_family);
+    EXPECT_EQ(htonl(0x0A000001), src->sin_addr.s_addr);
+    EXPECT_EQ(htons(40123), src->sin_port);
+    EXPECT_EQ(htonl(0xE0000101), dst->sin_addr.s_addr);
+    EXPECT_EQ(htons(40456), dst->sin_port);
+    ASSERT_EQ(5u, m_parsed.payload_length);
+    EXPECT_EQ(0, memcmp("hello", m_parsed.payload, 5));
+}
+
+TEST_F(UdpChannelTransportAfXdpTest, shouldParseVlanTaggedFrame)
+{
+    const size_t length = writeIpv4Frame("tagged", true);
+
+    ASSERT_EQ(0, aeron_udp_channel_transport_af_xdp_parse_frame(m_frame.data(), length, &m_parsed));
+    ASSERT_EQ(6u, m_parsed.payload_length);
+    EXPECT_EQ(0, memcmp("tagged", m_parsed.payload, 6));
+}
+
+TEST_F(UdpChannelTransportAfXdpTest, shouldParseIpv6UdpFrame)
+{
+    m_frame.fill(0);
+    m_frame[12] = 0x86;
+    m_frame[13] = 0xDD;
+
+    uint8_t *ip = m_frame.data() + 14;
+    ip[0] = 0x60;
+    ip[6] = 17;
+    ip[8 + 15] = 1;
+    ip[24] = 0xFF;
+    ip[24 + 15] = 2;
+    writeUdp(14 + 40, "v6", 2);
+
+    ASSERT_EQ(0, aeron_udp_channel_transport_af_xdp_parse_frame(m_frame.data(), 14 + 40 + 8 + 2, &m_parsed));
+
+    auto *src = (struct sockaddr_in6 *)&m_parsed.src_addr;
+    auto *dst = (struct sockaddr_in6 *)&m_parsed.dst_addr;
+    EXPECT_EQ(AF_INET6, src->sin6_family);
+    EXPECT_EQ(1, src->sin6_addr.s6_addr[15]);
+    EXPECT_EQ(0xFF, dst->sin6_addr.s6_addr[0]);
+    EXPECT_EQ(htons(40456), dst->sin6_port);
+    ASSERT_EQ(2u, m_parsed.payload_length);
+    EXPECT_EQ(0, memcmp("v6", m_parsed.payload, 2));
+}
+
+TEST_F(UdpChannelTransportAfXdpTest, shouldRejectNonUdpFrame)
+{
+    const size_t length = writeIpv4Frame("tcp", false, 6);
+
+    EXPECT_EQ(-1, aeron_udp_channel_transport_af_xdp_parse_frame(m_frame.data(), length, &m_parsed));
+}
+
+TEST_F(UdpChannelTransportAfXdpTest, shouldRejectFragmentedFrame)
+{
+    const size_t length = writeIpv4Frame("fragment", false, 17, 0x2000);
+
+    EXPECT_EQ(-1, aeron_udp_channel_transport_af_xdp_parse_frame(m_frame.data(), length, &m_parsed));
+}
+
+TEST_F(UdpChannelTransportAfXdpTest, shouldRejectTruncatedFrame)
+{
+    const size_t length = writeIpv4Frame("truncated");
+
+    EXPECT_EQ(-1, aeron_udp_channel_transport_af_xdp_parse_frame(m_frame.data(), length - 1, &m_parsed));
+    EXPECT_EQ(-1, aeron_udp_channel_transport_af_xdp_parse_frame(m_frame.data(), 20, &m_parsed));
+}
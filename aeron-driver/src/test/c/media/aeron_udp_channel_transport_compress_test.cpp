@@ -0,0 +1,331 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+#include <string>
+#include <cstdlib>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "media/aeron_udp_channel.h"
+#include "aeron_name_resolver.h"
+#include "media/aeron_udp_channel_transport.h"
+#include "media/aeron_udp_channel_transport_compress.h"
+#include "protocol/aeron_udp_protocol.h"
+
+#if !defined(HAVE_STRUCT_MMSGHDR)
+struct mmsghdr
+{
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif
+}
+
+#define SESSION_ID (7)
+#define STREAM_ID (1001)
+#define TERM_ID (3)
+
+typedef std::vector<std::vector<uint8_t>> datagrams_t;
+
+static void capture(datagrams_t *datagrams, struct msghdr *message)
+{
+    std::vector<uint8_t> datagram;
+
+    for (size_t i = 0; i < (size_t)message->msg_iovlen; i++)
+    {
+        const uint8_t *base = (const uint8_t *)message->msg_iov[i].iov_base;
+        datagram.insert(datagram.end(), base, base + message->msg_iov[i].iov_len);
+    }
+
+    datagrams->push_back(datagram);
+}
+
+static int capture_outgoing_mmsg(
+    void *interceptor_state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen)
+{
+    for (size_t i = 0; i < vlen; i++)
+    {
+        capture((datagrams_t *)interceptor_state, &msgvec[i].msg_hdr);
+        msgvec[i].msg_len = (unsigned int)((datagrams_t *)interceptor_state)->back().size();
+    }
+
+    return (int)vlen;
+}
+
+static int capture_outgoing_msg(
+    void *interceptor_state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *message)
+{
+    capture((datagrams_t *)interceptor_state, message);
+
+    return (int)((datagrams_t *)interceptor_state)->back().size();
+}
+
+static void capture_incoming(
+    void *interceptor_state,
+    aeron_udp_channel_incoming_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    void *receiver_clientd,
+    void *endpoint_clientd,
+    void *destination_clientd,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr)
+{
+    ((datagrams_t *)interceptor_state)->emplace_back(buffer, buffer + length);
+}
+
+class UdpChannelTransportCompressTest : public testing::Test
+{
+public:
+    void SetUp() override
+    {
+        aeron_default_name_resolver_supplier(&m_resolver, nullptr, nullptr);
+
+        ASSERT_EQ(0, aeron_udp_channel_interceptor_compress_init_outgoing(
+            &m_outgoing_state, nullptr, AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_SENDER)) << aeron_errmsg();
+        ASSERT_EQ(0, aeron_udp_channel_interceptor_compress_init_incoming(
+            &m_incoming_state, nullptr, AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_RECEIVER)) << aeron_errmsg();
+
+        m_outgoing_delegate.interceptor_state = &m_sent;
+        m_outgoing_delegate.outgoing_mmsg_func = capture_outgoing_mmsg;
+        m_outgoing_delegate.outgoing_msg_func = capture_outgoing_msg;
+        m_outgoing_delegate.next_interceptor = nullptr;
+
+        m_incoming_delegate.interceptor_state = &m_received;
+        m_incoming_delegate.incoming_func = capture_incoming;
+        m_incoming_delegate.next_interceptor = nullptr;
+    }
+
+    void TearDown() override
+    {
+        aeron_udp_channel_interceptor_compress_close_outgoing(m_outgoing_state);
+        aeron_udp_channel_interceptor_compress_close_incoming(m_incoming_state);
+        aeron_udp_channel_delete(m_udp_channel);
+        m_resolver.close_func(&m_resolver);
+    }
+
+    void addChannel(const char *uri)
+    {
+        ASSERT_EQ(0, aeron_udp_channel_parse(strlen(uri), uri, &m_resolver, &m_udp_channel)) << aeron_errmsg();
+        ASSERT_EQ(0, aeron_udp_channel_interceptor_compress_transport_notification(
+            m_outgoing_state, &m_transport, m_udp_channel, nullptr, AERON_UDP_CHANNEL_INTERCEPTOR_ADD_NOTIFICATION))
+            << aeron_errmsg();
+    }
+
+    static std::vector<uint8_t> dataFrame(int32_t term_offset, size_t length)
+    {
+        static const char *fields = "8=FIX.4.4|9=176|35=D|49=SENDER|56=TARGET|34=12|52=20200101-00:00:00.000|";
+        std::vector<uint8_t> frame(length);
+        auto *header = (aeron_data_header_t *)frame.data();
+
+        header->frame_header.frame_length = (int32_t)length;
+        header->frame_header.version = AERON_FRAME_HEADER_VERSION;
+        header->frame_header.flags = AERON_DATA_HEADER_UNFRAGMENTED;
+        header->frame_header.type = AERON_HDR_TYPE_DATA;
+        header->term_offset = term_offset;
+        header->session_id = SESSION_ID;
+        header->stream_id = STREAM_ID;
+        header->term_id = TERM_ID;
+
+        for (size_t i = AERON_DATA_HEADER_LENGTH; i < length; i++)
+        {
+            frame[i] = (uint8_t)fields[i % strlen(fields)];
+        }
+
+        return frame;
+    }
+
+    void sendOne(std::vector<uint8_t> &frame)
+    {
+        struct iovec iov;
+        struct msghdr msghdr = {};
+
+        iov.iov_base = frame.data();
+        iov.iov_len = frame.size();
+        msghdr.msg_iov = &iov;
+        msghdr.msg_iovlen = 1;
+
+        ASSERT_EQ((int)frame.size(), aeron_udp_channel_interceptor_compress_outgoing_msg(
+            m_outgoing_state, &m_outgoing_delegate, &m_transport, &msghdr));
+    }
+
+    void receive(std::vector<uint8_t> &datagram)
+    {
+        aeron_udp_channel_interceptor_compress_incoming(
+            m_incoming_state,
+            &m_incoming_delegate,
+            &m_transport,
+            nullptr,
+            nullptr,
+            nullptr,
+            datagram.data(),
+            datagram.size(),
+            nullptr);
+    }
+
+protected:
+    void *m_outgoing_state = nullptr;
+    void *m_incoming_state = nullptr;
+    aeron_name_resolver_t m_resolver = {};
+    aeron_udp_channel_t *m_udp_channel = nullptr;
+    aeron_udp_channel_transport_t m_transport = {};
+    aeron_udp_channel_outgoing_interceptor_t m_outgoing_delegate = {};
+    aeron_udp_channel_incoming_interceptor_t m_incoming_delegate = {};
+    datagrams_t m_sent;
+    datagrams_t m_received;
+};
+
+TEST_F(UdpChannelTransportCompressTest, shouldRoundTripLz4Blocks)
+{
+    uint16_t table[1u << AERON_UDP_CHANNEL_INTERCEPTOR_COMPRESS_LZ4_HASH_LOG];
+    std::vector<uint8_t> encoded(2048);
+    std::vector<uint8_t> decoded(1408);
+    std::vector<std::vector<uint8_t>> inputs =
+    {
+        dataFrame(0, 1408),
+        std::vector<uint8_t>(1000, 'a'),
+        std::vector<uint8_t>(13, 'b'),
+        std::vector<uint8_t>(1, 'c'),
+    };
+
+    std::vector<uint8_t> random(1024);
+    srand(42);
+    for (auto &b : random)
+    {
+        b = (uint8_t)rand();
+    }
+    inputs.push_back(random);
+
+    for (auto &input : inputs)
+    {
+        const size_t encoded_length = aeron_udp_channel_interceptor_compress_lz4_encode(
+            input.data(), input.size(), encoded.data(), encoded.size(), table);
+        ASSERT_GT(encoded_length, 0u);
+
+        const size_t decoded_length = aeron_udp_channel_interceptor_compress_lz4_decode(
+            encoded.data(), encoded_length, decoded.data(), decoded.size());
+        ASSERT_EQ(input.size(), decoded_length);
+        EXPECT_EQ(input, std::vector<uint8_t>(decoded.begin(), decoded.begin() + (long)decoded_length));
+    }
+}
+
+TEST_F(UdpChannelTransportCompressTest, shouldRejectMalformedLz4Block)
+{
+    std::vector<uint8_t> decoded(64);
+    const uint8_t offset_before_start[] = { 0x14, 'a', 0x05, 0x00 };
+    const uint8_t truncated_literals[] = { 0x50, 'a', 'b' };
+
+    EXPECT_EQ(0u, aeron_udp_channel_interceptor_compress_lz4_decode(
+        offset_before_start, sizeof(offset_before_start), decoded.data(), decoded.size()));
+    EXPECT_EQ(0u, aeron_udp_channel_interceptor_compress_lz4_decode(
+        truncated_literals, sizeof(truncated_literals), decoded.data(), decoded.size()));
+}
+
+TEST_F(UdpChannelTransportCompressTest, shouldCompressAndDecompressDataOnCompressedChannel)
+{
+    addChannel("aeron:udp?endpoint=localhost:24325|compress=lz4");
+    std::vector<uint8_t> frame = dataFrame(0, 1408);
+
+    sendOne(frame);
+
+    ASSERT_EQ(1u, m_sent.size());
+    auto *header = (aeron_udp_channel_interceptor_compress_header_t *)m_sent[0].data();
+    EXPECT_EQ(AERON_UDP_CHANNEL_INTERCEPTOR_COMPRESS_HDR_TYPE, header->frame_header.type);
+    EXPECT_EQ((int32_t)m_sent[0].size(), header->frame_header.frame_length);
+    EXPECT_EQ((int32_t)frame.size(), header->uncompressed_length);
+    EXPECT_LT(m_sent[0].size() * 3, frame.size());
+
+    receive(m_sent[0]);
+
+    ASSERT_EQ(1u, m_received.size());
+    EXPECT_EQ(frame, m_received[0]);
+}
+
+TEST_F(UdpChannelTransportCompressTest, shouldReportOriginalLengthsForCompressedBatch)
+{
+    addChannel("aeron:udp?endpoint=localhost:24325|compress=lz4");
+    std::vector<uint8_t> frames[2] = { dataFrame(0, 1408), dataFrame(1408, 512) };
+    struct iovec iov[2];
+    struct mmsghdr mmsghdr[2] = {};
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        iov[i].iov_base = frames[i].data();
+        iov[i].iov_len = frames[i].size();
+        mmsghdr[i].msg_hdr.msg_iov = &iov[i];
+        mmsghdr[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    ASSERT_EQ(2, aeron_udp_channel_interceptor_compress_outgoing_mmsg(
+        m_outgoing_state, &m_outgoing_delegate, &m_transport, mmsghdr, 2));
+
+    ASSERT_EQ(2u, m_sent.size());
+    for (size_t i = 0; i < 2; i++)
+    {
+        EXPECT_EQ(frames[i].size(), mmsghdr[i].msg_len);
+        EXPECT_LT(m_sent[i].size(), frames[i].size());
+        receive(m_sent[i]);
+        EXPECT_EQ(frames[i], m_received[i]);
+    }
+}
+
+TEST_F(UdpChannelTransportCompressTest, shouldPassThroughChannelsWithoutCompressAndSmallFrames)
+{
+    std::vector<uint8_t> frame = dataFrame(0, 1408);
+    sendOne(frame);
+
+    addChannel("aeron:udp?endpoint=localhost:24325|compress=lz4");
+    std::vector<uint8_t> small = dataFrame(1408, AERON_UDP_CHANNEL_INTERCEPTOR_COMPRESS_MIN_LENGTH_DEFAULT - 32);
+    sendOne(small);
+
+    ASSERT_EQ(2u, m_sent.size());
+    EXPECT_EQ(frame, m_sent[0]);
+    EXPECT_EQ(small, m_sent[1]);
+
+    receive(m_sent[0]);
+    ASSERT_EQ(1u, m_received.size());
+    EXPECT_EQ(frame, m_received[0]);
+}
+
+TEST_F(UdpChannelTransportCompressTest, shouldRejectUnknownCodec)
+{
+    const char *uri = "aeron:udp?endpoint=localhost:24325|compress=zstd";
+
+    ASSERT_EQ(0, aeron_udp_channel_parse(strlen(uri), uri, &m_resolver, &m_udp_channel)) << aeron_errmsg();
+    EXPECT_EQ(-1, aeron_udp_channel_interceptor_compress_transport_notification(
+        m_outgoing_state, &m_transport, m_udp_channel, nullptr, AERON_UDP_CHANNEL_INTERCEPTOR_ADD_NOTIFICATION));
+}
+
+TEST_F(UdpChannelTransportCompressTest, shouldParseMinLengthParam)
+{
+    aeron_udp_channel_interceptor_compress_params_t params = { AERON_UDP_CHANNEL_INTERCEPTOR_COMPRESS_MIN_LENGTH_DEFAULT };
+    char valid[] = "min-length=256";
+    char too_small[] = "min-length=16";
+
+    ASSERT_EQ(0, aeron_udp_channel_interceptor_compress_parse_params(valid, &params));
+    EXPECT_EQ(256, params.min_length);
+    EXPECT_EQ(-1, aeron_udp_channel_interceptor_compress_parse_params(too_small, &params));
+}
@@ -0,0 +1,282 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "media/aeron_udp_channel_transport.h"
+#include "media/aeron_udp_channel_transport_crypto.h"
+#include "protocol/aeron_udp_protocol.h"
+
+#if !defined(HAVE_STRUCT_MMSGHDR)
+struct mmsghdr
+{
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif
+}
+
+#define SESSION_ID (7)
+#define STREAM_ID (1001)
+#define TERM_ID (3)
+
+typedef std::vector<std::vector<uint8_t>> datagrams_t;
+
+static void capture(datagrams_t *datagrams, struct msghdr *message)
+{
+    std::vector<uint8_t> datagram;
+
+    for (size_t i = 0; i < (size_t)message->msg_iovlen; i++)
+    {
+        const uint8_t *base = (const uint8_t *)message->msg_iov[i].iov_base;
+        datagram.insert(datagram.end(), base, base + message->msg_iov[i].iov_len);
+    }
+
+    datagrams->push_back(datagram);
+}
+
+static int capture_outgoing_mmsg(
+    void *interceptor_state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen)
+{
+    for (size_t i = 0; i < vlen; i++)
+    {
+        capture((datagrams_t *)interceptor_state, &msgvec[i].msg_hdr);
+    }
+
+    return (int)vlen;
+}
+
+static int capture_outgoing_msg(
+    void *interceptor_state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *message)
+{
+    capture((datagrams_t *)interceptor_state, message);
+
+    return (int)((datagrams_t *)interceptor_state)->back().size();
+}
+
+static void capture_incoming(
+    void *interceptor_state,
+    aeron_udp_channel_incoming_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    void *receiver_clientd,
+    void *endpoint_clientd,
+    void *destination_clientd,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr)
+{
+    ((datagrams_t *)interceptor_state)->emplace_back(buffer, buffer + length);
+}
+
+class UdpChannelTransportCryptoTest : public testing::Test
+{
+public:
+    void SetUp() override
+    {
+        char args[] = "key-id=3";
+
+        for (size_t i = 0; i < 32; i++)
+        {
+            m_params.key[i] = (uint8_t)(i * 7);
+        }
+        m_params.key_length = 32;
+        ASSERT_EQ(0, aeron_udp_channel_interceptor_crypto_parse_params(args, &m_params));
+        aeron_udp_channel_interceptor_crypto_configure(&m_params);
+
+        ASSERT_EQ(0, aeron_udp_channel_interceptor_crypto_init_outgoing(
+            &m_outgoing_state, nullptr, AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_SENDER)) << aeron_errmsg();
+        ASSERT_EQ(0, aeron_udp_channel_interceptor_crypto_init_incoming(
+            &m_incoming_state, nullptr, AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_RECEIVER)) << aeron_errmsg();
+
+        m_outgoing_delegate.interceptor_state = &m_sent;
+        m_outgoing_delegate.outgoing_mmsg_func = capture_outgoing_mmsg;
+        m_outgoing_delegate.outgoing_msg_func = capture_outgoing_msg;
+        m_outgoing_delegate.next_interceptor = nullptr;
+
+        m_incoming_delegate.interceptor_state = &m_received;
+        m_incoming_delegate.incoming_func = capture_incoming;
+        m_incoming_delegate.next_interceptor = nullptr;
+    }
+
+    void TearDown() override
+    {
+        aeron_udp_channel_interceptor_crypto_close_outgoing(m_outgoing_state);
+        aeron_udp_channel_interceptor_crypto_close_incoming(m_incoming_state);
+    }
+
+    static std::vector<uint8_t> dataFrame(int32_t term_offset, size_t length)
+    {
+        std::vector<uint8_t> frame(length);
+        auto *header = (aeron_data_header_t *)frame.data();
+
+        header->frame_header.frame_length = (int32_t)length;
+        header->frame_header.version = AERON_FRAME_HEADER_VERSION;
+        header->frame_header.flags = AERON_DATA_HEADER_UNFRAGMENTED;
+        header->frame_header.type = AERON_HDR_TYPE_DATA;
+        header->term_offset = term_offset;
+        header->session_id = SESSION_ID;
+        header->stream_id = STREAM_ID;
+        header->term_id = TERM_ID;
+
+        for (size_t i = AERON_DATA_HEADER_LENGTH; i < length; i++)
+        {
+            frame[i] = (uint8_t)(i * 31 + term_offset);
+        }
+
+        return frame;
+    }
+
+    void sendOne(std::vector<uint8_t> &frame)
+    {
+        struct iovec iov;
+        struct msghdr msghdr = {};
+
+        iov.iov_base = frame.data();
+        iov.iov_len = frame.size();
+        msghdr.msg_iov = &iov;
+        msghdr.msg_iovlen = 1;
+
+        ASSERT_EQ((int)frame.size(), aeron_udp_channel_interceptor_crypto_outgoing_msg(
+            m_outgoing_state, &m_outgoing_delegate, nullptr, &msghdr)) << aeron_errmsg();
+    }
+
+    void receive(std::vector<uint8_t> &datagram)
+    {
+        aeron_udp_channel_interceptor_crypto_incoming(
+            m_incoming_state,
+            &m_incoming_delegate,
+            nullptr,
+            nullptr,
+            nullptr,
+            nullptr,
+            datagram.data(),
+            datagram.size(),
+            nullptr);
+    }
+
+protected:
+    aeron_udp_channel_interceptor_crypto_params_t m_params = {};
+    void *m_outgoing_state = nullptr;
+    void *m_incoming_state = nullptr;
+    aeron_udp_channel_outgoing_interceptor_t m_outgoing_delegate = {};
+    aeron_udp_channel_incoming_interceptor_t m_incoming_delegate = {};
+    datagrams_t m_sent;
+    datagrams_t m_received;
+};
+
+TEST_F(UdpChannelTransportCryptoTest, shouldSealAndOpenBatch)
+{
+    std::vector<std::vector<uint8_t>> frames = { dataFrame(0, 1408), dataFrame(1408, 96), dataFrame(1504, 32) };
+    struct iovec iov[3];
+    struct mmsghdr mmsghdr[3] = {};
+
+    for (size_t i = 0; i < frames.size(); i++)
+    {
+        iov[i].iov_base = frames[i].data();
+        iov[i].iov_len = frames[i].size();
+        mmsghdr[i].msg_hdr.msg_iov = &iov[i];
+        mmsghdr[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    ASSERT_EQ(3, aeron_udp_channel_interceptor_crypto_outgoing_mmsg(
+        m_outgoing_state, &m_outgoing_delegate, nullptr, mmsghdr, frames.size())) << aeron_errmsg();
+
+    ASSERT_EQ(3u, m_sent.size());
+    for (size_t i = 0; i < frames.size(); i++)
+    {
+        auto *header = (aeron_udp_channel_interceptor_crypto_header_t *)m_sent[i].data();
+        EXPECT_EQ(AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_HDR_TYPE, header->frame_header.type);
+        EXPECT_EQ(3, header->key_id);
+        EXPECT_EQ(frames[i].size() + AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_OVERHEAD, m_sent[i].size());
+        EXPECT_EQ(frames[i].size(), mmsghdr[i].msg_len);
+
+        receive(m_sent[i]);
+    }
+
+    ASSERT_EQ(frames, m_received);
+    EXPECT_NE(0, memcmp(
+        ((aeron_udp_channel_interceptor_crypto_header_t *)m_sent[0].data())->iv,
+        ((aeron_udp_channel_interceptor_crypto_header_t *)m_sent[1].data())->iv,
+        AERON_UDP_CHANNEL_INTERCEPTOR_CRYPTO_IV_LENGTH));
+}
+
+TEST_F(UdpChannelTransportCryptoTest, shouldRejectTamperedDatagram)
+{
+    std::vector<uint8_t> frame = dataFrame(0, 256);
+    sendOne(frame);
+
+    std::vector<uint8_t> tampered_body = m_sent[0];
+    tampered_body[sizeof(aeron_udp_channel_interceptor_crypto_header_t) + 40] ^= 0x01;
+    std::vector<uint8_t> tampered_header = m_sent[0];
+    ((aeron_udp_channel_interceptor_crypto_header_t *)tampered_header.data())->frame_header.flags = 0x80;
+
+    receive(tampered_body);
+    receive(tampered_header);
+    EXPECT_EQ(0u, m_received.size());
+
+    receive(m_sent[0]);
+    ASSERT_EQ(1u, m_received.size());
+    EXPECT_EQ(frame, m_received[0]);
+}
+
+TEST_F(UdpChannelTransportCryptoTest, shouldRejectPlaintextUnlessAllowed)
+{
+    std::vector<uint8_t> frame = dataFrame(0, 128);
+
+    receive(frame);
+    EXPECT_EQ(0u, m_received.size());
+
+    ((aeron_udp_channel_interceptor_crypto_incoming_state_t *)m_incoming_state)->allow_plaintext = true;
+    receive(frame);
+    EXPECT_EQ(1u, m_received.size());
+}
+
+TEST_F(UdpChannelTransportCryptoTest, shouldReadKeyFile)
+{
+    aeron_udp_channel_interceptor_crypto_params_t params = {};
+    char path[] = "/tmp/aeron_crypto_key_XXXXXX";
+    const int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    FILE *file = fdopen(fd, "w");
+    fputs("000102030405060708090a0b0c0d0e0f\n", file);
+    fclose(file);
+
+    std::string args = std::string("key-file=") + path;
+    std::vector<char> args_buffer(args.begin(), args.end());
+    args_buffer.push_back('\0');
+
+    ASSERT_EQ(0, aeron_udp_channel_interceptor_crypto_parse_params(args_buffer.data(), &params)) << aeron_errmsg();
+    EXPECT_EQ(16u, params.key_length);
+    EXPECT_EQ(0x0f, params.key[15]);
+    remove(path);
+
+    char missing[] = "key-file=/tmp/aeron_crypto_key_does_not_exist";
+    EXPECT_EQ(-1, aeron_udp_channel_interceptor_crypto_parse_params(missing, &params));
+}
@@ -0,0 +1,289 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+#include <cstdlib>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "media/aeron_udp_channel_transport.h"
+#include "media/aeron_udp_channel_transport_fec.h"
+#include "protocol/aeron_udp_protocol.h"
+
+#if !defined(HAVE_STRUCT_MMSGHDR)
+struct mmsghdr
+{
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif
+}
+
+#define SESSION_ID (7)
+#define STREAM_ID (1001)
+#define TERM_ID (3)
+#define BLOCK (4)
+
+typedef std::vector<std::vector<uint8_t>> datagrams_t;
+
+static void capture(datagrams_t *datagrams, struct msghdr *message)
+{
+    std::vector<uint8_t> datagram;
+
+    for (size_t i = 0; i < (size_t)message->msg_iovlen; i++)
+    {
+        const uint8_t *base = (const uint8_t *)message->msg_iov[i].iov_base;
+        datagram.insert(datagram.end(), base, base + message->msg_iov[i].iov_len);
+    }
+
+    datagrams->push_back(datagram);
+}
+
+static int capture_outgoing_mmsg(
+    void *interceptor_state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen)
+{
+    for (size_t i = 0; i < vlen; i++)
+    {
+        capture((datagrams_t *)interceptor_state, &msgvec[i].msg_hdr);
+    }
+
+    return (int)vlen;
+}
+
+static int capture_outgoing_msg(
+    void *interceptor_state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *message)
+{
+    capture((datagrams_t *)interceptor_state, message);
+
+    return 0;
+}
+
+static void capture_incoming(
+    void *interceptor_state,
+    aeron_udp_channel_incoming_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    void *receiver_clientd,
+    void *endpoint_clientd,
+    void *destination_clientd,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr)
+{
+    ((datagrams_t *)interceptor_state)->emplace_back(buffer, buffer + length);
+}
+
+class UdpChannelTransportFecTest : public testing::Test
+{
+public:
+    void SetUp() override
+    {
+        setenv("AERON_UDP_CHANNEL_TRANSPORT_BINDINGS_FEC_ARGS", "block=4", 1);
+
+        ASSERT_EQ(0, aeron_udp_channel_interceptor_fec_init_outgoing(
+            &m_outgoing_state, nullptr, AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_SENDER)) << aeron_errmsg();
+        ASSERT_EQ(0, aeron_udp_channel_interceptor_fec_init_incoming(
+            &m_incoming_state, nullptr, AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_RECEIVER)) << aeron_errmsg();
+
+        m_outgoing_delegate.interceptor_state = &m_sent;
+        m_outgoing_delegate.outgoing_mmsg_func = capture_outgoing_mmsg;
+        m_outgoing_delegate.outgoing_msg_func = capture_outgoing_msg;
+        m_outgoing_delegate.next_interceptor = nullptr;
+
+        m_incoming_delegate.interceptor_state = &m_received;
+        m_incoming_delegate.incoming_func = capture_incoming;
+        m_incoming_delegate.next_interceptor = nullptr;
+    }
+
+    void TearDown() override
+    {
+        aeron_udp_channel_interceptor_fec_close_outgoing(m_outgoing_state);
+        aeron_udp_channel_interceptor_fec_close_incoming(m_incoming_state);
+    }
+
+    static std::vector<uint8_t> dataFrame(int32_t term_offset, size_t length)
+    {
+        std::vector<uint8_t> frame(length);
+        auto *header = (aeron_data_header_t *)frame.data();
+
+        header->frame_header.frame_length = (int32_t)length;
+        header->frame_header.version = AERON_FRAME_HEADER_VERSION;
+        header->frame_header.flags = AERON_DATA_HEADER_UNFRAGMENTED;
+        header->frame_header.type = AERON_HDR_TYPE_DATA;
+        header->term_offset = term_offset;
+        header->session_id = SESSION_ID;
+        header->stream_id = STREAM_ID;
+        header->term_id = TERM_ID;
+
+        for (size_t i = AERON_DATA_HEADER_LENGTH; i < length; i++)
+        {
+            frame[i] = (uint8_t)(i * 31 + term_offset);
+        }
+
+        return frame;
+    }
+
+    void sendBlock(std::vector<std::vector<uint8_t>> &frames)
+    {
+        struct iovec iov[BLOCK];
+        struct mmsghdr mmsghdr[BLOCK] = {};
+
+        for (size_t i = 0; i < frames.size(); i++)
+        {
+            iov[i].iov_base = frames[i].data();
+            iov[i].iov_len = frames[i].size();
+            mmsghdr[i].msg_hdr.msg_iov = &iov[i];
+            mmsghdr[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        ASSERT_EQ((int)frames.size(), aeron_udp_channel_interceptor_fec_outgoing_mmsg(
+            m_outgoing_state, &m_outgoing_delegate, nullptr, mmsghdr, frames.size()));
+    }
+
+    void sendOne(std::vector<uint8_t> &frame)
+    {
+        struct iovec iov;
+        struct msghdr msghdr = {};
+
+        iov.iov_base = frame.data();
+        iov.iov_len = frame.size();
+        msghdr.msg_iov = &iov;
+        msghdr.msg_iovlen = 1;
+
+        ASSERT_EQ(0, aeron_udp_channel_interceptor_fec_outgoing_msg(
+            m_outgoing_state, &m_outgoing_delegate, nullptr, &msghdr));
+    }
+
+    void receive(std::vector<uint8_t> &datagram)
+    {
+        aeron_udp_channel_interceptor_fec_incoming(
+            m_incoming_state,
+            &m_incoming_delegate,
+            nullptr,
+            nullptr,
+            nullptr,
+            nullptr,
+            datagram.data(),
+            datagram.size(),
+            nullptr);
+    }
+
+protected:
+    void *m_outgoing_state = nullptr;
+    void *m_incoming_state = nullptr;
+    aeron_udp_channel_outgoing_interceptor_t m_outgoing_delegate = {};
+    aeron_udp_channel_incoming_interceptor_t m_incoming_delegate = {};
+    datagrams_t m_sent;
+    datagrams_t m_received;
+};
+
+TEST_F(UdpChannelTransportFecTest, shouldSendParityAfterEachBlock)
+{
+    std::vector<std::vector<uint8_t>> frames = { dataFrame(0, 96), dataFrame(96, 64), dataFrame(160, 128),
+        dataFrame(288, 32) };
+
+    sendBlock(frames);
+
+    ASSERT_EQ(BLOCK + 1u, m_sent.size());
+    auto *header = (aeron_udp_channel_interceptor_fec_header_t *)m_sent[BLOCK].data();
+    EXPECT_EQ(AERON_UDP_CHANNEL_INTERCEPTOR_FEC_HDR_TYPE, header->frame_header.type);
+    EXPECT_EQ(BLOCK, header->member_count);
+    EXPECT_EQ(SESSION_ID, header->session_id);
+    EXPECT_EQ(STREAM_ID, header->stream_id);
+    EXPECT_EQ((int32_t)m_sent[BLOCK].size(), header->frame_header.frame_length);
+    EXPECT_EQ(
+        sizeof(aeron_udp_channel_interceptor_fec_header_t) +
+        (BLOCK * sizeof(aeron_udp_channel_interceptor_fec_member_t)) + 128,
+        m_sent[BLOCK].size());
+}
+
+TEST_F(UdpChannelTransportFecTest, shouldRecoverSingleLostDatagramOfBlock)
+{
+    std::vector<std::vector<uint8_t>> frames = { dataFrame(0, 96), dataFrame(96, 64), dataFrame(160, 128),
+        dataFrame(288, 32) };
+
+    sendBlock(frames);
+
+    for (size_t i = 0; i < m_sent.size(); i++)
+    {
+        if (1 != i)
+        {
+            receive(m_sent[i]);
+        }
+    }
+
+    ASSERT_EQ((size_t)BLOCK, m_received.size());
+    EXPECT_EQ(frames[1], m_received[BLOCK - 1]);
+}
+
+TEST_F(UdpChannelTransportFecTest, shouldNotRecoverWhenMoreThanOneDatagramOfBlockIsLost)
+{
+    std::vector<std::vector<uint8_t>> frames = { dataFrame(0, 96), dataFrame(96, 64), dataFrame(160, 128),
+        dataFrame(288, 32) };
+
+    sendBlock(frames);
+
+    receive(m_sent[0]);
+    receive(m_sent[3]);
+    receive(m_sent[BLOCK]);
+
+    EXPECT_EQ(2u, m_received.size());
+}
+
+TEST_F(UdpChannelTransportFecTest, shouldCloseBlockOnHeartbeat)
+{
+    std::vector<uint8_t> first = dataFrame(0, 64);
+    std::vector<uint8_t> second = dataFrame(64, 96);
+    std::vector<uint8_t> heartbeat = dataFrame(160, AERON_DATA_HEADER_LENGTH);
+    ((aeron_data_header_t *)heartbeat.data())->frame_header.frame_length = 0;
+
+    sendOne(first);
+    sendOne(second);
+    sendOne(heartbeat);
+
+    ASSERT_EQ(4u, m_sent.size());
+    auto *header = (aeron_udp_channel_interceptor_fec_header_t *)m_sent[3].data();
+    EXPECT_EQ(AERON_UDP_CHANNEL_INTERCEPTOR_FEC_HDR_TYPE, header->frame_header.type);
+    EXPECT_EQ(2, header->member_count);
+
+    receive(m_sent[0]);
+    receive(m_sent[2]);
+    receive(m_sent[3]);
+
+    ASSERT_EQ(3u, m_received.size());
+    EXPECT_EQ(second, m_received[2]);
+}
+
+TEST_F(UdpChannelTransportFecTest, shouldParseBlockParam)
+{
+    aeron_udp_channel_interceptor_fec_params_t params = { AERON_UDP_CHANNEL_INTERCEPTOR_FEC_BLOCK_DEFAULT };
+    char valid[] = "block=12";
+    char too_small[] = "block=1";
+    char too_large[] = "block=17";
+
+    ASSERT_EQ(0, aeron_udp_channel_interceptor_fec_parse_params(valid, &params));
+    EXPECT_EQ(12, params.block);
+    EXPECT_EQ(-1, aeron_udp_channel_interceptor_fec_parse_params(too_small, &params));
+    EXPECT_EQ(-1, aeron_udp_channel_interceptor_fec_parse_params(too_large, &params));
+}
@@ -0,0 +1,415 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "media/aeron_udp_channel.h"
+#include "media/aeron_udp_channel_transport.h"
+#include "media/aeron_udp_channel_transport_impair.h"
+#include "protocol/aeron_udp_protocol.h"
+
+#if !defined(HAVE_STRUCT_MMSGHDR)
+struct mmsghdr
+{
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif
+}
+
+#define FRAME_LENGTH (1000)
+#define ONE_MS_NS (1000 * 1000LL)
+
+typedef std::vector<std::vector<uint8_t>> datagrams_t;
+
+static int64_t test_now_ns = 0;
+
+static int64_t test_nano_clock()
+{
+    return test_now_ns;
+}
+
+static int capture_outgoing_mmsg(
+    void *interceptor_state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen)
+{
+    for (size_t i = 0; i < vlen; i++)
+    {
+        const uint8_t *base = (const uint8_t *)msgvec[i].msg_hdr.msg_iov[0].iov_base;
+        ((datagrams_t *)interceptor_state)->emplace_back(base, base + msgvec[i].msg_hdr.msg_iov[0].iov_len);
+    }
+
+    return (int)vlen;
+}
+
+static int capture_outgoing_msg(
+    void *interceptor_state,
+    aeron_udp_channel_outgoing_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    struct msghdr *message)
+{
+    const uint8_t *base = (const uint8_t *)message->msg_iov[0].iov_base;
+    ((datagrams_t *)interceptor_state)->emplace_back(base, base + message->msg_iov[0].iov_len);
+
+    return (int)message->msg_iov[0].iov_len;
+}
+
+static void capture_incoming(
+    void *interceptor_state,
+    aeron_udp_channel_incoming_interceptor_t *delegate,
+    aeron_udp_channel_transport_t *transport,
+    void *receiver_clientd,
+    void *endpoint_clientd,
+    void *destination_clientd,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr)
+{
+    ((datagrams_t *)interceptor_state)->emplace_back(buffer, buffer + length);
+}
+
+class UdpChannelTransportImpairTest : public testing::Test
+{
+public:
+    void SetUp() override
+    {
+        test_now_ns = 0;
+        aeron_udp_channel_interceptor_impair_params_default(&m_params);
+
+        m_outgoing_delegate.interceptor_state = &m_sent;
+        m_outgoing_delegate.outgoing_mmsg_func = capture_outgoing_mmsg;
+        m_outgoing_delegate.outgoing_msg_func = capture_outgoing_msg;
+        m_outgoing_delegate.next_interceptor = nullptr;
+
+        m_incoming_delegate.interceptor_state = &m_received;
+        m_incoming_delegate.incoming_func = capture_incoming;
+        m_incoming_delegate.next_interceptor = nullptr;
+    }
+
+    void TearDown() override
+    {
+        aeron_udp_channel_interceptor_impair_close(m_state);
+    }
+
+    void create(const char *args)
+    {
+        std::string args_dup(args);
+
+        ASSERT_EQ(0, aeron_udp_channel_interceptor_impair_parse_params(&args_dup[0], &m_params)) << aeron_errmsg();
+        ASSERT_EQ(0, aeron_udp_channel_interceptor_impair_state_create(&m_state, &m_params, test_nano_clock));
+    }
+
+    static std::vector<uint8_t> dataFrame(int32_t term_offset)
+    {
+        std::vector<uint8_t> frame(FRAME_LENGTH);
+        auto *header = (aeron_data_header_t *)frame.data();
+
+        header->frame_header.frame_length = FRAME_LENGTH;
+        header->frame_header.type = AERON_HDR_TYPE_DATA;
+        header->term_offset = term_offset;
+
+        return frame;
+    }
+
+    static int32_t termOffset(const std::vector<uint8_t> &datagram)
+    {
+        return ((const aeron_data_header_t *)datagram.data())->term_offset;
+    }
+
+    int sendBatch(std::vector<std::vector<uint8_t>> &frames, aeron_udp_channel_transport_t *transport = nullptr)
+    {
+        std::vector<struct iovec> iov(frames.size());
+        std::vector<struct mmsghdr> mmsghdr(frames.size());
+
+        for (size_t i = 0; i < frames.size(); i++)
+        {
+            iov[i].iov_base = frames[i].data();
+            iov[i].iov_len = frames[i].size();
+            mmsghdr[i] = {};
+            mmsghdr[i].msg_hdr.msg_iov = &iov[i];
+            mmsghdr[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        return aeron_udp_channel_interceptor_impair_outgoing_mmsg(
+            m_state, &m_outgoing_delegate, transport, mmsghdr.data(), frames.size());
+    }
+
+    int sendOne(std::vector<uint8_t> &frame, aeron_udp_channel_transport_t *transport = nullptr)
+    {
+        struct iovec iov;
+        struct msghdr msghdr = {};
+
+        iov.iov_base = frame.data();
+        iov.iov_len = frame.size();
+        msghdr.msg_iov = &iov;
+        msghdr.msg_iovlen = 1;
+
+        return aeron_udp_channel_interceptor_impair_outgoing_msg(m_state, &m_outgoing_delegate, transport, &msghdr);
+    }
+
+    void receive(std::vector<uint8_t> &datagram)
+    {
+        aeron_udp_channel_interceptor_impair_incoming(
+            m_state,
+            &m_incoming_delegate,
+            nullptr,
+            nullptr,
+            nullptr,
+            nullptr,
+            datagram.data(),
+            datagram.size(),
+            nullptr);
+    }
+
+    int doWorkOutgoingAt(int64_t now_ns)
+    {
+        test_now_ns = now_ns;
+        return aeron_udp_channel_interceptor_impair_outgoing_do_work(m_state, &m_outgoing_delegate);
+    }
+
+    int doWorkIncomingAt(int64_t now_ns)
+    {
+        test_now_ns = now_ns;
+        return aeron_udp_channel_interceptor_impair_incoming_do_work(m_state, &m_incoming_delegate);
+    }
+
+protected:
+    aeron_udp_channel_interceptor_impair_params_t m_params = {};
+    aeron_udp_channel_interceptor_impair_state_t *m_state = nullptr;
+    aeron_udp_channel_outgoing_interceptor_t m_outgoing_delegate = {};
+    aeron_udp_channel_incoming_interceptor_t m_incoming_delegate = {};
+    datagrams_t m_sent;
+    datagrams_t m_received;
+};
+
+TEST_F(UdpChannelTransportImpairTest, shouldParseParams)
+{
+    create(
+        "delay=2ms|jitter=500us|distribution=normal|loss=0.01|ge-p=0.02|ge-r=0.3|ge-good-loss=0.001|"
+        "ge-bad-loss=0.5|reorder=0.1|duplicate=0.05|bandwidth=125m|limit=128|port=20121|msg-mask=1|seed=42");
+
+    EXPECT_EQ(2 * ONE_MS_NS, (int64_t)m_params.delay_ns);
+    EXPECT_EQ(500 * 1000, (int64_t)m_params.jitter_ns);
+    EXPECT_EQ(AERON_UDP_CHANNEL_INTERCEPTOR_IMPAIR_DISTRIBUTION_NORMAL, m_params.distribution);
+    EXPECT_DOUBLE_EQ(0.01, m_params.loss);
+    EXPECT_DOUBLE_EQ(0.02, m_params.ge_p);
+    EXPECT_DOUBLE_EQ(0.3, m_params.ge_r);
+    EXPECT_DOUBLE_EQ(0.001, m_params.ge_good_loss);
+    EXPECT_DOUBLE_EQ(0.5, m_params.ge_bad_loss);
+    EXPECT_DOUBLE_EQ(0.1, m_params.reorder);
+    EXPECT_DOUBLE_EQ(0.05, m_params.duplicate);
+    EXPECT_EQ(125ULL * 1024 * 1024, m_params.bandwidth);
+    EXPECT_EQ(128u, m_params.limit);
+    EXPECT_EQ(20121, m_params.port);
+    EXPECT_EQ(1UL, m_params.msg_type_mask);
+    EXPECT_EQ(42ULL, m_params.seed);
+}
+
+TEST_F(UdpChannelTransportImpairTest, shouldRejectInvalidParams)
+{
+    char rate[] = "loss=1.5";
+    char distribution[] = "distribution=pareto";
+    char delay[] = "delay=soon";
+
+    EXPECT_EQ(-1, aeron_udp_channel_interceptor_impair_parse_params(rate, &m_params));
+    EXPECT_EQ(-1, aeron_udp_channel_interceptor_impair_parse_params(distribution, &m_params));
+    EXPECT_EQ(-1, aeron_udp_channel_interceptor_impair_parse_params(delay, &m_params));
+}
+
+TEST_F(UdpChannelTransportImpairTest, shouldPassThroughWithoutImpairment)
+{
+    create("");
+    std::vector<std::vector<uint8_t>> frames = { dataFrame(0), dataFrame(FRAME_LENGTH), dataFrame(2 * FRAME_LENGTH) };
+
+    EXPECT_EQ(3, sendBatch(frames));
+
+    ASSERT_EQ(3u, m_sent.size());
+    EXPECT_EQ(0, termOffset(m_sent[0]));
+    EXPECT_EQ(2 * FRAME_LENGTH, termOffset(m_sent[2]));
+    EXPECT_EQ(0, doWorkOutgoingAt(ONE_MS_NS));
+}
+
+TEST_F(UdpChannelTransportImpairTest, shouldHoldBackUntilDelayHasElapsed)
+{
+    create("delay=1ms");
+    std::vector<std::vector<uint8_t>> frames = { dataFrame(0), dataFrame(FRAME_LENGTH) };
+
+    EXPECT_EQ(2, sendBatch(frames));
+    EXPECT_EQ(0u, m_sent.size());
+
+    EXPECT_EQ(0, doWorkOutgoingAt(ONE_MS_NS - 1));
+    EXPECT_EQ(0u, m_sent.size());
+
+    EXPECT_EQ(2, doWorkOutgoingAt(ONE_MS_NS));
+    ASSERT_EQ(2u, m_sent.size());
+    EXPECT_EQ(0, termOffset(m_sent[0]));
+    EXPECT_EQ(FRAME_LENGTH, termOffset(m_sent[1]));
+}
+
+TEST_F(UdpChannelTransportImpairTest, shouldKeepJitterWithinBounds)
+{
+    create("delay=1ms|jitter=500us|seed=7");
+
+    for (int32_t i = 0; i < 100; i++)
+    {
+        std::vector<uint8_t> frame = dataFrame(i * FRAME_LENGTH);
+        sendOne(frame);
+    }
+
+    EXPECT_EQ(0, doWorkOutgoingAt(ONE_MS_NS / 2 - 1));
+    EXPECT_LT(0, doWorkOutgoingAt(ONE_MS_NS));
+    EXPECT_GT(100u, m_sent.size());
+    doWorkOutgoingAt((3 * ONE_MS_NS) / 2);
+    EXPECT_EQ(100u, m_sent.size());
+}
+
+TEST_F(UdpChannelTransportImpairTest, shouldReorderDatagramsWhichSkipTheDelay)
+{
+    create("delay=1ms");
+    std::vector<uint8_t> first = dataFrame(0);
+    std::vector<uint8_t> second = dataFrame(FRAME_LENGTH);
+
+    receive(first);
+    m_state->params.reorder = 1.0;
+    receive(second);
+
+    ASSERT_EQ(1u, m_received.size());
+    EXPECT_EQ(FRAME_LENGTH, termOffset(m_received[0]));
+
+    EXPECT_EQ(1, doWorkIncomingAt(ONE_MS_NS));
+    ASSERT_EQ(2u, m_received.size());
+    EXPECT_EQ(0, termOffset(m_received[1]));
+    EXPECT_EQ(1, m_state->reordered_count);
+}
+
+TEST_F(UdpChannelTransportImpairTest, shouldDuplicateDatagrams)
+{
+    create("duplicate=1.0");
+    std::vector<uint8_t> frame = dataFrame(0);
+
+    receive(frame);
+    EXPECT_EQ(1u, m_received.size());
+
+    EXPECT_EQ(1, doWorkIncomingAt(0));
+    ASSERT_EQ(2u, m_received.size());
+    EXPECT_EQ(m_received[0], m_received[1]);
+    EXPECT_EQ(1, m_state->duplicated_count);
+}
+
+TEST_F(UdpChannelTransportImpairTest, shouldLoseAllDatagramsInBadState)
+{
+    create("ge-p=1.0|ge-r=0.0|ge-bad-loss=1.0");
+
+    for (int32_t i = 0; i < 10; i++)
+    {
+        std::vector<uint8_t> frame = dataFrame(i * FRAME_LENGTH);
+        EXPECT_EQ(FRAME_LENGTH, sendOne(frame));
+    }
+
+    EXPECT_EQ(0u, m_sent.size());
+    EXPECT_EQ(10, m_state->dropped_count);
+}
+
+TEST_F(UdpChannelTransportImpairTest, shouldLoseInBurstsWithGilbertElliott)
+{
+    create("ge-p=0.01|ge-r=0.25|ge-good-loss=0.0|ge-bad-loss=1.0|seed=3");
+    int bursts = 0;
+    bool was_lost = false;
+    const int count = 100000;
+
+    for (int32_t i = 0; i < count; i++)
+    {
+        std::vector<uint8_t> frame = dataFrame(i);
+        const size_t sent_before = m_sent.size();
+        sendOne(frame);
+
+        const bool is_lost = sent_before == m_sent.size();
+        bursts += is_lost && !was_lost ? 1 : 0;
+        was_lost = is_lost;
+    }
+
+    /* stationary loss is p / (p + r) ~= 3.8% with a mean burst length of 1 / r = 4 */
+    const double loss_rate = (double)m_state->dropped_count / count;
+    const double mean_burst = (double)m_state->dropped_count / bursts;
+
+    EXPECT_NEAR(0.038, loss_rate, 0.01);
+    EXPECT_NEAR(4.0, mean_burst, 0.5);
+}
+
+TEST_F(UdpChannelTransportImpairTest, shouldLimitBandwidth)
+{
+    create("bandwidth=1000000");
+    std::vector<std::vector<uint8_t>> frames;
+
+    for (int32_t i = 0; i < 10; i++)
+    {
+        frames.push_back(dataFrame(i * FRAME_LENGTH));
+    }
+
+    EXPECT_EQ(10, sendBatch(frames));
+    EXPECT_EQ(0u, m_sent.size());
+
+    EXPECT_EQ(5, doWorkOutgoingAt(5 * ONE_MS_NS));
+    EXPECT_EQ(5, doWorkOutgoingAt(10 * ONE_MS_NS));
+    ASSERT_EQ(10u, m_sent.size());
+    EXPECT_EQ(9 * FRAME_LENGTH, termOffset(m_sent[9]));
+}
+
+TEST_F(UdpChannelTransportImpairTest, shouldDropWhenQueueLimitReached)
+{
+    create("delay=1ms|limit=2");
+    std::vector<std::vector<uint8_t>> frames = { dataFrame(0), dataFrame(FRAME_LENGTH), dataFrame(2 * FRAME_LENGTH) };
+
+    EXPECT_EQ(3, sendBatch(frames));
+    EXPECT_EQ(1, m_state->overflow_count);
+    EXPECT_EQ(2, doWorkOutgoingAt(ONE_MS_NS));
+}
+
+TEST_F(UdpChannelTransportImpairTest, shouldOnlyImpairChannelsMatchingPort)
+{
+    create("delay=1ms|port=20121");
+    aeron_udp_channel_t udp_channel = {};
+    auto *remote_data = (struct sockaddr_in *)&udp_channel.remote_data;
+    aeron_udp_channel_transport_t matching = {};
+    aeron_udp_channel_transport_t other = {};
+
+    remote_data->sin_family = AF_INET;
+    remote_data->sin_port = htons(20121);
+
+    ASSERT_EQ(0, aeron_udp_channel_interceptor_impair_transport_notification(
+        m_state, &matching, &udp_channel, nullptr, AERON_UDP_CHANNEL_INTERCEPTOR_ADD_NOTIFICATION));
+
+    std::vector<uint8_t> held = dataFrame(0);
+    std::vector<uint8_t> passed = dataFrame(FRAME_LENGTH);
+    sendOne(held, &matching);
+    sendOne(passed, &other);
+
+    ASSERT_EQ(1u, m_sent.size());
+    EXPECT_EQ(FRAME_LENGTH, termOffset(m_sent[0]));
+
+    ASSERT_EQ(0, aeron_udp_channel_interceptor_impair_transport_notification(
+        m_state, &matching, &udp_channel, nullptr, AERON_UDP_CHANNEL_INTERCEPTOR_REMOVE_NOTIFICATION));
+
+    EXPECT_EQ(0, doWorkOutgoingAt(ONE_MS_NS));
+    EXPECT_EQ(1u, m_sent.size());
+}
@@ -0,0 +1,266 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <unistd.h>
+
+#include "aeron_driver_context.h"
+#include "media/aeron_udp_channel_transport.h"
+#include "media/aeron_udp_channel_transport_io_uring.h"
+#include "media/aeron_udp_transport_poller.h"
+#include "util/aeron_env.h"
+
+#if !defined(HAVE_STRUCT_MMSGHDR)
+struct mmsghdr
+{
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif
+}
+
+#define MAX_POLL_ATTEMPTS (1000)
+
+typedef struct io_uring_recv_state_stct
+{
+    int messages_received;
+    size_t bytes_received;
+    char last_message[64];
+}
+io_uring_recv_state_t;
+
+static void io_uring_test_recv_func(
+    aeron_udp_channel_data_paths_t *data_paths,
+    aeron_udp_channel_transport_t *transport,
+    void *receiver_clientd,
+    void *endpoint_clientd,
+    void *destination_clientd,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr)
+{
+    auto *state = (io_uring_recv_state_t *)receiver_clientd;
+
+    state->messages_received++;
+    state->bytes_received += length;
+    memset(state->last_message, 0, sizeof(state->last_message));
+    memcpy(state->last_message, buffer, std::min(length, sizeof(state->last_message) - 1));
+}
+
+class UdpChannelTransportIoUringTest : public testing::Test
+{
+public:
+    UdpChannelTransportIoUringTest() = default;
+
+protected:
+    void SetUp() override
+    {
+#if !defined(HAVE_IO_URING)
+        GTEST_SKIP() << "io_uring not available";
+#endif
+        m_bindings = aeron_udp_channel_transport_bindings_load_media("io_uring");
+        ASSERT_NE(nullptr, m_bindings) << aeron_errmsg();
+        ASSERT_EQ(0, aeron_driver_context_init(&m_context)) << aeron_errmsg();
+
+        if (m_bindings->poller_init_func(&m_poller, m_context, AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_RECEIVER) < 0)
+        {
+            aeron_driver_context_close(m_context);
+            m_context = nullptr;
+            GTEST_SKIP() << "io_uring poller could not be created: " << aeron_errmsg();
+        }
+        m_poller_initialised = true;
+
+        struct sockaddr_in *bind_addr = (struct sockaddr_in *)&m_bind_addr;
+        memset(&m_bind_addr, 0, sizeof(m_bind_addr));
+        bind_addr->sin_family = AF_INET;
+        bind_addr->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        bind_addr->sin_port = 0;
+
+        ASSERT_EQ(0, m_bindings->init_func(
+            &m_transport, &m_bind_addr, nullptr, 0, 0, 0, 0, m_context, AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_RECEIVER))
+            << aeron_errmsg();
+        m_transport_initialised = true;
+
+        socklen_t addr_len = sizeof(m_bind_addr);
+        ASSERT_EQ(0, getsockname(m_transport.fd, (struct sockaddr *)&m_bind_addr, &addr_len));
+
+        m_send_fd = socket(AF_INET, SOCK_DGRAM, 0);
+        ASSERT_LE(0, m_send_fd);
+    }
+
+    void TearDown() override
+    {
+        if (m_send_fd >= 0)
+        {
+            close(m_send_fd);
+        }
+
+        if (m_poller_initialised)
+        {
+            m_bindings->poller_close_func(&m_poller);
+        }
+
+        if (m_transport_initialised)
+        {
+            m_bindings->close_func(&m_transport);
+        }
+
+        aeron_driver_context_close(m_context);
+    }
+
+    void send(const char *message)
+    {
+        ASSERT_EQ(
+            (ssize_t)strlen(message),
+            sendto(m_send_fd, message, strlen(message), 0, (struct sockaddr *)&m_bind_addr, sizeof(struct sockaddr_in)));
+    }
+
+    int pollUntil(io_uring_recv_state_t *state, int expected_messages)
+    {
+        int64_t bytes_rcved = 0;
+
+        for (int i = 0; i < MAX_POLL_ATTEMPTS && state->messages_received < expected_messages; i++)
+        {
+            int result = m_bindings->poller_poll_func(
+                &m_poller, nullptr, 0, &bytes_rcved, io_uring_test_recv_func, nullptr, state);
+            if (result < 0)
+            {
+                return result;
+            }
+
+            if (0 == result)
+            {
+                usleep(1000);
+            }
+        }
+
+        return state->messages_received;
+    }
+
+    aeron_udp_channel_transport_bindings_t *m_bindings = nullptr;
+    aeron_driver_context_t *m_context = nullptr;
+    aeron_udp_transport_poller_t m_poller = {};
+    aeron_udp_channel_transport_t m_transport = {};
+    struct sockaddr_storage m_bind_addr = {};
+    bool m_poller_initialised = false;
+    bool m_transport_initialised = false;
+    int m_send_fd = -1;
+};
+
+TEST_F(UdpChannelTransportIoUringTest, shouldLoadBindingsByName)
+{
+    EXPECT_STREQ("io_uring", m_bindings->meta_info.name);
+    EXPECT_STREQ("media", m_bindings->meta_info.type);
+}
+
+TEST_F(UdpChannelTransportIoUringTest, shouldReceiveDatagramsWithMultishotRecv)
+{
+    io_uring_recv_state_t state = {};
+
+    ASSERT_EQ(0, m_bindings->poller_add_func(&m_poller, &m_transport)) << aeron_errmsg();
+
+    send("hello");
+    send("world");
+    send("again");
+
+    ASSERT_EQ(3, pollUntil(&state, 3)) << aeron_errmsg();
+    EXPECT_EQ(15u, state.bytes_received);
+    EXPECT_STREQ("again", state.last_message);
+}
+
+TEST_F(UdpChannelTransportIoUringTest, shouldRecycleBuffersBeyondBufferCount)
+{
+    io_uring_recv_state_t state = {};
+    const int message_count = AERON_UDP_CHANNEL_TRANSPORT_IO_URING_BUFFER_COUNT_DEFAULT * 3;
+
+    ASSERT_EQ(0, m_bindings->poller_add_func(&m_poller, &m_transport)) << aeron_errmsg();
+
+    for (int i = 0; i < message_count; i++)
+    {
+        send("msg");
+        if (0 == (i % 32))
+        {
+            pollUntil(&state, state.messages_received + 1);
+        }
+    }
+
+    ASSERT_EQ(message_count, pollUntil(&state, message_count)) << aeron_errmsg();
+}
+
+TEST_F(UdpChannelTransportIoUringTest, shouldNotDeliverAfterRemove)
+{
+    io_uring_recv_state_t state = {};
+    int64_t bytes_rcved = 0;
+
+    ASSERT_EQ(0, m_bindings->poller_add_func(&m_poller, &m_transport)) << aeron_errmsg();
+    send("first");
+    ASSERT_EQ(1, pollUntil(&state, 1)) << aeron_errmsg();
+
+    ASSERT_EQ(0, m_bindings->poller_remove_func(&m_poller, &m_transport)) << aeron_errmsg();
+    EXPECT_EQ(0u, m_poller.transports.length);
+
+    send("second");
+    usleep(10 * 1000);
+
+    for (int i = 0; i < 10; i++)
+    {
+        ASSERT_LE(0, m_bindings->poller_poll_func(
+            &m_poller, nullptr, 0, &bytes_rcved, io_uring_test_recv_func, nullptr, &state)) << aeron_errmsg();
+    }
+
+    EXPECT_EQ(1, state.messages_received);
+}
+
+TEST_F(UdpChannelTransportIoUringTest, shouldCloseWithArmedEntriesAndUnreapedCompletions)
+{
+    aeron_udp_channel_transport_t removed_transport = {};
+    struct sockaddr_storage removed_addr = m_bind_addr;
+
+    ((struct sockaddr_in *)&removed_addr)->sin_port = 0;
+    ASSERT_EQ(0, m_bindings->init_func(
+        &removed_transport, &removed_addr, nullptr, 0, 0, 0, 0, m_context, AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_RECEIVER))
+        << aeron_errmsg();
+
+    ASSERT_EQ(0, m_bindings->poller_add_func(&m_poller, &removed_transport)) << aeron_errmsg();
+    ASSERT_EQ(0, m_bindings->poller_add_func(&m_poller, &m_transport)) << aeron_errmsg();
+    ASSERT_EQ(0, m_bindings->poller_remove_func(&m_poller, &removed_transport)) << aeron_errmsg();
+
+    for (int i = 0; i < 16; i++)
+    {
+        send("pending");
+    }
+    usleep(10 * 1000);
+
+    m_poller_initialised = false;
+    EXPECT_EQ(0, m_bindings->poller_close_func(&m_poller)) << aeron_errmsg();
+    EXPECT_EQ(nullptr, m_poller.bindings_clientd);
+
+    m_bindings->close_func(&removed_transport);
+}
+
+TEST_F(UdpChannelTransportIoUringTest, shouldRejectInvalidBufferCount)
+{
+    aeron_udp_transport_poller_t poller = {};
+
+    aeron_env_set(AERON_UDP_CHANNEL_TRANSPORT_IO_URING_BUFFER_COUNT_ENV_VAR, "100");
+    EXPECT_EQ(-1, m_bindings->poller_init_func(&poller, m_context, AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_RECEIVER));
+    aeron_env_unset(AERON_UDP_CHANNEL_TRANSPORT_IO_URING_BUFFER_COUNT_ENV_VAR);
+}
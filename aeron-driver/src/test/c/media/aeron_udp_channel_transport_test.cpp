@@ -0,0 +1,517 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstddef>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include <netinet/in.h>
+#include <netinet/udp.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "aeron_driver_context.h"
+#include "protocol/aeron_udp_protocol.h"
+#include "media/aeron_udp_channel_transport.h"
+#include "media/aeron_udp_transport_poller.h"
+#include "aeron_network_publication.h"
+
+#if !defined(HAVE_STRUCT_MMSGHDR)
+struct mmsghdr
+{
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif
+}
+
+#define SEGMENT_LENGTH (128)
+#define SEGMENT_COUNT (3)
+#define MAX_POLL_ATTEMPTS (1000)
+
+static void transport_test_recv_func(
+    aeron_udp_channel_data_paths_t *data_paths,
+    aeron_udp_channel_transport_t *transport,
+    void *receiver_clientd,
+    void *endpoint_clientd,
+    void *destination_clientd,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr)
+{
+    auto *lengths = (std::vector<size_t> *)receiver_clientd;
+    lengths->push_back(length);
+}
+
+static void transport_test_timestamp_recv_func(
+    aeron_udp_channel_data_paths_t *data_paths,
+    aeron_udp_channel_transport_t *transport,
+    void *receiver_clientd,
+    void *endpoint_clientd,
+    void *destination_clientd,
+    uint8_t *buffer,
+    size_t length,
+    struct sockaddr_storage *addr)
+{
+    auto *timestamps = (std::vector<int64_t> *)receiver_clientd;
+    timestamps->push_back(transport->recv_timestamp_ns);
+}
+
+class UdpChannelTransportTest : public testing::Test
+{
+public:
+    UdpChannelTransportTest() = default;
+
+protected:
+    void SetUp() override
+    {
+        ASSERT_EQ(0, aeron_driver_context_init(&m_context)) << aeron_errmsg();
+    }
+
+    void TearDown() override
+    {
+        if (m_receiver_initialised)
+        {
+            aeron_udp_channel_transport_close(&m_receiver);
+        }
+
+        if (m_sender_initialised)
+        {
+            aeron_udp_channel_transport_close(&m_sender);
+        }
+
+        aeron_driver_context_close(m_context);
+    }
+
+    void initTransports()
+    {
+        struct sockaddr_in *addr = (struct sockaddr_in *)&m_receiver_addr;
+        addr->sin_family = AF_INET;
+        addr->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr->sin_port = 0;
+
+        ASSERT_EQ(0, aeron_udp_channel_transport_init(
+            &m_receiver, &m_receiver_addr, nullptr, 0, 0, 0, 0, m_context, AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_RECEIVER))
+            << aeron_errmsg();
+        m_receiver_initialised = true;
+
+        socklen_t addr_len = sizeof(m_receiver_addr);
+        ASSERT_EQ(0, getsockname(m_receiver.fd, (struct sockaddr *)&m_receiver_addr, &addr_len));
+
+        struct sockaddr_storage sender_addr = {};
+        struct sockaddr_in *sender_in = (struct sockaddr_in *)&sender_addr;
+        sender_in->sin_family = AF_INET;
+        sender_in->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        sender_in->sin_port = 0;
+
+        ASSERT_EQ(0, aeron_udp_channel_transport_init(
+            &m_sender, &sender_addr, nullptr, 0, 0, 0, 0, m_context, AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_SENDER))
+            << aeron_errmsg();
+        m_sender_initialised = true;
+    }
+
+    void sendSegmented(size_t length, uint16_t gso_size)
+    {
+        union
+        {
+            struct cmsghdr align;
+            uint8_t buffer[CMSG_SPACE(sizeof(uint16_t))];
+        }
+        control = {};
+        struct iovec iov = { m_send_buffer, length };
+        struct mmsghdr msg = {};
+
+        msg.msg_hdr.msg_name = &m_receiver_addr;
+        msg.msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+        msg.msg_hdr.msg_iov = &iov;
+        msg.msg_hdr.msg_iovlen = 1;
+        msg.msg_hdr.msg_control = control.buffer;
+        msg.msg_hdr.msg_controllen = sizeof(control.buffer);
+
+        struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg.msg_hdr);
+        cmsg->cmsg_level = SOL_UDP;
+        cmsg->cmsg_type = UDP_SEGMENT;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+        memcpy(CMSG_DATA(cmsg), &gso_size, sizeof(gso_size));
+
+        ASSERT_EQ(1, aeron_udp_channel_transport_sendmmsg(nullptr, &m_sender, &msg, 1)) << aeron_errmsg();
+    }
+
+    std::vector<size_t> receive(size_t expected_datagrams)
+    {
+        std::vector<size_t> lengths;
+        int64_t bytes_rcved = 0;
+
+        for (int i = 0; i < MAX_POLL_ATTEMPTS && lengths.size() < expected_datagrams; i++)
+        {
+            struct mmsghdr msg = {};
+            struct iovec iov = { m_recv_buffer, sizeof(m_recv_buffer) };
+            struct sockaddr_storage addr = {};
+
+            msg.msg_hdr.msg_name = &addr;
+            msg.msg_hdr.msg_namelen = sizeof(addr);
+            msg.msg_hdr.msg_iov = &iov;
+            msg.msg_hdr.msg_iovlen = 1;
+            msg.msg_hdr.msg_control = m_control;
+            msg.msg_hdr.msg_controllen = sizeof(m_control);
+
+            int result = aeron_udp_channel_transport_recvmmsg(
+                &m_receiver, &msg, 1, &bytes_rcved, transport_test_recv_func, &lengths);
+            EXPECT_LE(0, result) << aeron_errmsg();
+            if (0 == result)
+            {
+                usleep(1000);
+            }
+        }
+
+        return lengths;
+    }
+
+    aeron_driver_context_t *m_context = nullptr;
+    aeron_udp_channel_transport_t m_receiver = {};
+    aeron_udp_channel_transport_t m_sender = {};
+    struct sockaddr_storage m_receiver_addr = {};
+    bool m_receiver_initialised = false;
+    bool m_sender_initialised = false;
+    uint8_t m_send_buffer[SEGMENT_LENGTH * SEGMENT_COUNT] = {};
+    uint8_t m_recv_buffer[64 * 1024] = {};
+    uint64_t m_control[AERON_UDP_CHANNEL_TRANSPORT_CONTROL_LENGTH / sizeof(uint64_t)] = {};
+};
+
+TEST_F(UdpChannelTransportTest, shouldReceiveSegmentedSendAsSeparateDatagrams)
+{
+    aeron_driver_context_set_socket_gso_enabled(m_context, true);
+    initTransports();
+
+    sendSegmented(SEGMENT_LENGTH * SEGMENT_COUNT - 10, SEGMENT_LENGTH);
+
+    std::vector<size_t> lengths = receive(SEGMENT_COUNT);
+    ASSERT_EQ((size_t)SEGMENT_COUNT, lengths.size());
+    EXPECT_EQ((size_t)SEGMENT_LENGTH, lengths[0]);
+    EXPECT_EQ((size_t)SEGMENT_LENGTH, lengths[1]);
+    EXPECT_EQ((size_t)SEGMENT_LENGTH - 10, lengths[2]);
+}
+
+TEST_F(UdpChannelTransportTest, shouldSplitGroCoalescedDatagrams)
+{
+    aeron_driver_context_set_socket_gso_enabled(m_context, true);
+    aeron_driver_context_set_socket_gro_enabled(m_context, true);
+    initTransports();
+
+    sendSegmented(SEGMENT_LENGTH * SEGMENT_COUNT - 10, SEGMENT_LENGTH);
+
+    std::vector<size_t> lengths = receive(SEGMENT_COUNT);
+    ASSERT_EQ((size_t)SEGMENT_COUNT, lengths.size());
+    EXPECT_EQ((size_t)SEGMENT_LENGTH, lengths[0]);
+    EXPECT_EQ((size_t)SEGMENT_LENGTH, lengths[1]);
+    EXPECT_EQ((size_t)SEGMENT_LENGTH - 10, lengths[2]);
+}
+
+TEST_F(UdpChannelTransportTest, shouldSetBusyPollOnReceiverPollerSockets)
+{
+    aeron_driver_context_set_socket_busy_poll_us(m_context, 50);
+    initTransports();
+
+    aeron_udp_transport_poller_t poller = {};
+    ASSERT_EQ(0, aeron_udp_transport_poller_init(&poller, m_context, AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_RECEIVER));
+
+    if (aeron_udp_transport_poller_add(&poller, &m_receiver) < 0)
+    {
+        aeron_udp_transport_poller_close(&poller);
+        GTEST_SKIP() << "SO_BUSY_POLL not permitted: " << aeron_errmsg();
+    }
+
+    int busy_poll_us = 0;
+    socklen_t len = sizeof(busy_poll_us);
+    ASSERT_EQ(0, getsockopt(m_receiver.fd, SOL_SOCKET, SO_BUSY_POLL, &busy_poll_us, &len));
+    EXPECT_EQ(50, busy_poll_us);
+
+    EXPECT_EQ(0, aeron_udp_transport_poller_remove(&poller, &m_receiver));
+    aeron_udp_transport_poller_close(&poller);
+}
+
+TEST_F(UdpChannelTransportTest, shouldNotSetBusyPollOnSenderPollerSockets)
+{
+    aeron_driver_context_set_socket_busy_poll_us(m_context, 50);
+    initTransports();
+
+    aeron_udp_transport_poller_t poller = {};
+    ASSERT_EQ(0, aeron_udp_transport_poller_init(&poller, m_context, AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_SENDER));
+    ASSERT_EQ(0, aeron_udp_transport_poller_add(&poller, &m_sender)) << aeron_errmsg();
+
+    int busy_poll_us = -1;
+    socklen_t len = sizeof(busy_poll_us);
+    ASSERT_EQ(0, getsockopt(m_sender.fd, SOL_SOCKET, SO_BUSY_POLL, &busy_poll_us, &len));
+    EXPECT_EQ(0, busy_poll_us);
+
+    EXPECT_EQ(0, aeron_udp_transport_poller_remove(&poller, &m_sender));
+    aeron_udp_transport_poller_close(&poller);
+}
+
+TEST_F(UdpChannelTransportTest, shouldReadDirectlyUpToIterationThreshold)
+{
+    aeron_driver_context_set_udp_transport_poller_iteration_threshold(m_context, 0);
+    initTransports();
+
+    aeron_udp_transport_poller_t poller = {};
+    ASSERT_EQ(0, aeron_udp_transport_poller_init(&poller, m_context, AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_RECEIVER));
+    ASSERT_EQ(0u, poller.iteration_threshold);
+    ASSERT_EQ(0, aeron_udp_transport_poller_add(&poller, &m_receiver)) << aeron_errmsg();
+
+    sendSegmented(SEGMENT_LENGTH, SEGMENT_LENGTH);
+
+    std::vector<size_t> lengths;
+    int64_t bytes_rcved = 0;
+    for (int i = 0; i < MAX_POLL_ATTEMPTS && lengths.empty(); i++)
+    {
+        struct mmsghdr msg = {};
+        struct iovec iov = { m_recv_buffer, sizeof(m_recv_buffer) };
+        struct sockaddr_storage addr = {};
+
+        msg.msg_hdr.msg_name = &addr;
+        msg.msg_hdr.msg_namelen = sizeof(addr);
+        msg.msg_hdr.msg_iov = &iov;
+        msg.msg_hdr.msg_iovlen = 1;
+
+        int result = aeron_udp_transport_poller_poll(
+            &poller, &msg, 1, &bytes_rcved, transport_test_recv_func, aeron_udp_channel_transport_recvmmsg, &lengths);
+        ASSERT_LE(0, result) << aeron_errmsg();
+        if (0 == result)
+        {
+            usleep(1000);
+        }
+    }
+
+    ASSERT_EQ(1u, lengths.size());
+    EXPECT_EQ((size_t)SEGMENT_LENGTH, lengths[0]);
+
+    EXPECT_EQ(0, aeron_udp_transport_poller_remove(&poller, &m_receiver));
+    aeron_udp_transport_poller_close(&poller);
+}
+
+TEST_F(UdpChannelTransportTest, shouldProvideReceiveTimestampDuringDispatch)
+{
+#if !defined(HAVE_SO_TIMESTAMPING)
+    GTEST_SKIP() << "SO_TIMESTAMPING not available";
+#endif
+    aeron_driver_context_set_socket_rx_timestamping_enabled(m_context, true);
+    initTransports();
+
+    struct timespec before = {};
+    clock_gettime(CLOCK_REALTIME, &before);
+    sendSegmented(SEGMENT_LENGTH, SEGMENT_LENGTH);
+
+    std::vector<int64_t> timestamps;
+    int64_t bytes_rcved = 0;
+    for (int i = 0; i < MAX_POLL_ATTEMPTS && timestamps.empty(); i++)
+    {
+        struct mmsghdr msg = {};
+        struct iovec iov = { m_recv_buffer, sizeof(m_recv_buffer) };
+        struct sockaddr_storage addr = {};
+
+        msg.msg_hdr.msg_name = &addr;
+        msg.msg_hdr.msg_namelen = sizeof(addr);
+        msg.msg_hdr.msg_iov = &iov;
+        msg.msg_hdr.msg_iovlen = 1;
+        msg.msg_hdr.msg_control = m_control;
+        msg.msg_hdr.msg_controllen = sizeof(m_control);
+
+        int result = aeron_udp_channel_transport_recvmmsg(
+            &m_receiver, &msg, 1, &bytes_rcved, transport_test_timestamp_recv_func, &timestamps);
+        ASSERT_LE(0, result) << aeron_errmsg();
+        if (0 == result)
+        {
+            usleep(1000);
+        }
+    }
+
+    ASSERT_EQ(1u, timestamps.size());
+    EXPECT_LE(((int64_t)before.tv_sec * 1000000000LL) + before.tv_nsec, timestamps[0]);
+}
+
+TEST_F(UdpChannelTransportTest, shouldBindReusePortTransportsToSamePort)
+{
+    m_receiver.reuse_port = true;
+    initTransports();
+
+    aeron_udp_channel_transport_t fanout = {};
+    fanout.reuse_port = true;
+    ASSERT_EQ(0, aeron_udp_channel_transport_init(
+        &fanout, &m_receiver_addr, nullptr, 0, 0, 0, 0, m_context, AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_RECEIVER))
+        << aeron_errmsg();
+
+    struct sockaddr_storage fanout_addr = {};
+    socklen_t addr_len = sizeof(fanout_addr);
+    ASSERT_EQ(0, getsockname(fanout.fd, (struct sockaddr *)&fanout_addr, &addr_len));
+    EXPECT_EQ(
+        ((struct sockaddr_in *)&m_receiver_addr)->sin_port, ((struct sockaddr_in *)&fanout_addr)->sin_port);
+
+    aeron_udp_channel_transport_t exclusive = {};
+    EXPECT_EQ(-1, aeron_udp_channel_transport_init(
+        &exclusive, &m_receiver_addr, nullptr, 0, 0, 0, 0, m_context, AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_RECEIVER));
+
+    aeron_udp_channel_transport_close(&exclusive);
+    aeron_udp_channel_transport_close(&fanout);
+}
+
+TEST_F(UdpChannelTransportTest, shouldSteerReusePortDatagramsBySessionId)
+{
+#if !defined(HAVE_SO_ATTACH_REUSEPORT_CBPF)
+    GTEST_SKIP() << "SO_ATTACH_REUSEPORT_CBPF not available";
+#endif
+    m_receiver.reuse_port = true;
+    initTransports();
+
+    aeron_udp_channel_transport_t fanout = {};
+    fanout.reuse_port = true;
+    ASSERT_EQ(0, aeron_udp_channel_transport_init(
+        &fanout, &m_receiver_addr, nullptr, 0, 0, 0, 0, m_context, AERON_UDP_CHANNEL_TRANSPORT_AFFINITY_RECEIVER))
+        << aeron_errmsg();
+    ASSERT_EQ(0, aeron_udp_channel_transport_steer_reuseport_by_session_id(&m_receiver, 2)) << aeron_errmsg();
+
+    const int32_t session_id = htonl(1);
+    memcpy(m_send_buffer + offsetof(aeron_data_header_t, session_id), &session_id, sizeof(session_id));
+    sendSegmented(SEGMENT_LENGTH, SEGMENT_LENGTH);
+
+    std::vector<size_t> lengths;
+    int64_t bytes_rcved = 0;
+    for (int i = 0; i < MAX_POLL_ATTEMPTS && lengths.empty(); i++)
+    {
+        struct mmsghdr msg = {};
+        struct iovec iov = { m_recv_buffer, sizeof(m_recv_buffer) };
+        struct sockaddr_storage addr = {};
+
+        msg.msg_hdr.msg_name = &addr;
+        msg.msg_hdr.msg_namelen = sizeof(addr);
+        msg.msg_hdr.msg_iov = &iov;
+        msg.msg_hdr.msg_iovlen = 1;
+        msg.msg_hdr.msg_control = m_control;
+        msg.msg_hdr.msg_controllen = sizeof(m_control);
+
+        int result = aeron_udp_channel_transport_recvmmsg(
+            &fanout, &msg, 1, &bytes_rcved, transport_test_recv_func, &lengths);
+        ASSERT_LE(0, result) << aeron_errmsg();
+        if (0 == result)
+        {
+            usleep(1000);
+        }
+    }
+
+    EXPECT_EQ(1u, lengths.size());
+
+    struct mmsghdr msg = {};
+    struct iovec iov = { m_recv_buffer, sizeof(m_recv_buffer) };
+    struct sockaddr_storage addr = {};
+    msg.msg_hdr.msg_name = &addr;
+    msg.msg_hdr.msg_namelen = sizeof(addr);
+    msg.msg_hdr.msg_iov = &iov;
+    msg.msg_hdr.msg_iovlen = 1;
+    EXPECT_EQ(0, aeron_udp_channel_transport_recvmmsg(
+        &m_receiver, &msg, 1, &bytes_rcved, transport_test_recv_func, &lengths));
+
+    aeron_udp_channel_transport_close(&fanout);
+}
+
+TEST_F(UdpChannelTransportTest, shouldGrowButNotShrinkSocketBuffers)
+{
+    initTransports();
+
+    int small = 4096;
+    ASSERT_EQ(0, setsockopt(m_receiver.fd, SOL_SOCKET, SO_RCVBUF, &small, sizeof(small)));
+
+    ASSERT_EQ(0, aeron_udp_channel_transport_ensure_so_rcvbuf(&m_receiver, 64 * 1024)) << aeron_errmsg();
+    int so_rcvbuf = 0;
+    socklen_t len = sizeof(so_rcvbuf);
+    ASSERT_EQ(0, getsockopt(m_receiver.fd, SOL_SOCKET, SO_RCVBUF, &so_rcvbuf, &len));
+    EXPECT_LE(64 * 1024, so_rcvbuf);
+
+    ASSERT_EQ(0, aeron_udp_channel_transport_ensure_so_rcvbuf(&m_receiver, 4096)) << aeron_errmsg();
+    int after = 0;
+    ASSERT_EQ(0, getsockopt(m_receiver.fd, SOL_SOCKET, SO_RCVBUF, &after, &len));
+    EXPECT_EQ(so_rcvbuf, after);
+}
+
+TEST_F(UdpChannelTransportTest, shouldReportKernelDropsWhenSocketBufferAutoEnabled)
+{
+#if !defined(SO_RXQ_OVFL)
+    GTEST_SKIP() << "SO_RXQ_OVFL not available";
+#endif
+    aeron_driver_context_set_socket_buffer_auto_enabled(m_context, true);
+    initTransports();
+
+    int small = 4096;
+    ASSERT_EQ(0, setsockopt(m_receiver.fd, SOL_SOCKET, SO_RCVBUF, &small, sizeof(small)));
+
+    for (int i = 0; i < 64; i++)
+    {
+        sendSegmented(SEGMENT_LENGTH, SEGMENT_LENGTH);
+    }
+
+    const size_t queued = receive(64).size();
+    ASSERT_GT(64u, queued);
+
+    // The drop count is carried by datagrams queued after the drops.
+    sendSegmented(SEGMENT_LENGTH, SEGMENT_LENGTH);
+    ASSERT_EQ(1u, receive(1).size());
+    EXPECT_LT(0u, aeron_udp_channel_transport_take_socket_drops(&m_receiver));
+    EXPECT_EQ(0u, aeron_udp_channel_transport_take_socket_drops(&m_receiver));
+}
+
+TEST_F(UdpChannelTransportTest, shouldProbePathMtuToLoopback)
+{
+#if !defined(IP_MTU)
+    GTEST_SKIP() << "IP_MTU not available";
+#endif
+    initTransports();
+
+    size_t path_mtu = 0;
+    ASSERT_EQ(0, aeron_udp_channel_transport_probe_path_mtu(&m_receiver_addr, &path_mtu)) << aeron_errmsg();
+    EXPECT_LT((size_t)AERON_NETWORK_PUBLICATION_PMTU_MAX_LENGTH, path_mtu);
+}
+
+TEST_F(UdpChannelTransportTest, shouldDropDataFramesForUnfilteredStreamsInKernel)
+{
+#if !defined(HAVE_SO_ATTACH_FILTER)
+    GTEST_SKIP() << "SO_ATTACH_FILTER not available";
+#endif
+    initTransports();
+
+    const int32_t stream_id = 1001;
+    ASSERT_EQ(0, aeron_udp_channel_transport_filter_by_stream_ids(&m_receiver, &stream_id, 1)) << aeron_errmsg();
+
+    auto *data_header = (aeron_data_header_t *)m_send_buffer;
+    data_header->frame_header.type = AERON_HDR_TYPE_DATA;
+    data_header->stream_id = 1002;
+    sendSegmented(64, 64);
+    data_header->stream_id = 1001;
+    sendSegmented(96, 96);
+    data_header->frame_header.type = AERON_HDR_TYPE_SETUP;
+    data_header->stream_id = 1002;
+    sendSegmented(SEGMENT_LENGTH, SEGMENT_LENGTH);
+
+    EXPECT_EQ(std::vector<size_t>({ 96, SEGMENT_LENGTH }), receive(2));
+
+    std::vector<int32_t> stream_ids(AERON_UDP_CHANNEL_TRANSPORT_STREAM_FILTER_MAX_LENGTH + 1, stream_id);
+    ASSERT_EQ(0, aeron_udp_channel_transport_filter_by_stream_ids(
+        &m_receiver, stream_ids.data(), stream_ids.size())) << aeron_errmsg();
+
+    data_header->frame_header.type = AERON_HDR_TYPE_DATA;
+    sendSegmented(64, 64);
+    EXPECT_EQ(std::vector<size_t>({ 64 }), receive(1));
+}
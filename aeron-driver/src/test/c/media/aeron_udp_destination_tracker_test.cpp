@@ -0,0 +1,268 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "aeron_alloc.h"
+#include "media/aeron_send_channel_endpoint.h"
+#include "aeron_driver_conductor.h"
+#include "media/aeron_udp_destination_tracker.h"
+
+#if !defined(HAVE_STRUCT_MMSGHDR)
+struct mmsghdr
+{
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif
+}
+
+#define NOW_NS (1000 * 1000 * 1000LL)
+
+typedef struct capture_state_stct
+{
+    int calls;
+    int max_msgs_sent;
+    std::vector<uint16_t> ports;
+}
+capture_state_t;
+
+static capture_state_t capture_state;
+
+static int capture_sendmmsg(
+    aeron_udp_channel_data_paths_t *data_paths,
+    aeron_udp_channel_transport_t *transport,
+    struct mmsghdr *msgvec,
+    size_t vlen)
+{
+    capture_state.calls++;
+
+    for (size_t i = 0; i < vlen; i++)
+    {
+        capture_state.ports.push_back(ntohs(((struct sockaddr_in *)msgvec[i].msg_hdr.msg_name)->sin_port));
+    }
+
+    return capture_state.max_msgs_sent < (int)vlen ? capture_state.max_msgs_sent : (int)vlen;
+}
+
+class UdpDestinationTrackerTest : public testing::Test
+{
+public:
+    void SetUp() override
+    {
+        capture_state.calls = 0;
+        capture_state.max_msgs_sent = INT32_MAX;
+        capture_state.ports.clear();
+
+        m_data_paths.sendmmsg_func = capture_sendmmsg;
+        ASSERT_EQ(0, aeron_clock_cache_alloc(&m_cached_clock));
+        aeron_clock_update_cached_time(m_cached_clock, NOW_NS / (1000 * 1000), NOW_NS);
+        ASSERT_EQ(0, aeron_udp_destination_tracker_init(
+            &m_tracker, &m_data_paths, m_cached_clock, true, AERON_UDP_DESTINATION_TRACKER_DESTINATION_TIMEOUT_NS));
+    }
+
+    void TearDown() override
+    {
+        aeron_udp_destination_tracker_close(&m_tracker);
+        aeron_free(m_cached_clock);
+    }
+
+    static struct sockaddr_storage loopbackAddress(uint16_t port)
+    {
+        struct sockaddr_storage addr = {};
+        struct sockaddr_in *addr_in = reinterpret_cast<sockaddr_in *>(&addr);
+
+        addr_in->sin_family = AF_INET;
+        addr_in->sin_port = htons(port);
+        addr_in->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+        return addr;
+    }
+
+    void addDestination(uint16_t port)
+    {
+        aeron_uri_t *uri;
+        struct sockaddr_storage addr = loopbackAddress(port);
+
+        ASSERT_EQ(0, aeron_alloc((void **)&uri, sizeof(aeron_uri_t)));
+        ASSERT_LE(0, aeron_udp_destination_tracker_manual_add_destination(&m_tracker, NOW_NS, uri, &addr));
+    }
+
+    void onStatusMessage(int64_t receiver_id, uint16_t port)
+    {
+        aeron_status_message_header_t status_message = {};
+        struct sockaddr_storage addr = loopbackAddress(port);
+
+        status_message.receiver_id = receiver_id;
+        ASSERT_EQ(0, aeron_udp_destination_tracker_on_status_message(
+            &m_tracker, (const uint8_t *)&status_message, sizeof(status_message), &addr));
+    }
+
+    void useDynamicControlMode()
+    {
+        aeron_udp_destination_tracker_close(&m_tracker);
+        ASSERT_EQ(0, aeron_udp_destination_tracker_init(
+            &m_tracker, &m_data_paths, m_cached_clock, false, AERON_UDP_DESTINATION_TRACKER_DESTINATION_TIMEOUT_NS));
+    }
+
+    void setTime(int64_t now_ns)
+    {
+        aeron_clock_update_cached_time(m_cached_clock, now_ns / (1000 * 1000), now_ns);
+    }
+
+    int send(size_t vlen, int32_t frame_length = -1)
+    {
+        std::vector<struct mmsghdr> mmsghdr(vlen);
+        struct iovec iov = {};
+        aeron_data_header_t data_header = {};
+
+        if (frame_length >= 0)
+        {
+            data_header.frame_header.type = AERON_HDR_TYPE_DATA;
+            data_header.frame_header.frame_length = frame_length;
+            iov.iov_base = &data_header;
+            iov.iov_len = sizeof(data_header);
+        }
+
+        for (auto &msg : mmsghdr)
+        {
+            msg.msg_hdr.msg_iov = &iov;
+            msg.msg_hdr.msg_iovlen = 1;
+        }
+
+        return aeron_udp_destination_tracker_sendmmsg(&m_tracker, nullptr, mmsghdr.data(), vlen);
+    }
+
+protected:
+    aeron_udp_channel_data_paths_t m_data_paths = {};
+    aeron_clock_cache_t *m_cached_clock = nullptr;
+    aeron_udp_destination_tracker_t m_tracker = {};
+};
+
+TEST_F(UdpDestinationTrackerTest, shouldFanOutToAllDestinationsInOneSend)
+{
+    addDestination(40001);
+    addDestination(40002);
+    addDestination(40003);
+
+    EXPECT_EQ(2, send(2));
+    EXPECT_EQ(1, capture_state.calls);
+    EXPECT_EQ(std::vector<uint16_t>({ 40001, 40001, 40002, 40002, 40003, 40003 }), capture_state.ports);
+}
+
+TEST_F(UdpDestinationTrackerTest, shouldReportMinimumSentAcrossDestinationsOnPartialSend)
+{
+    addDestination(40001);
+    addDestination(40002);
+    capture_state.max_msgs_sent = 3;
+
+    EXPECT_EQ(1, send(2));
+}
+
+TEST_F(UdpDestinationTrackerTest, shouldSplitFanOutWhenExceedingMaxMessages)
+{
+    const size_t vlen = AERON_UDP_DESTINATION_TRACKER_FAN_OUT_MAX_MESSAGES / 2;
+    addDestination(40001);
+    addDestination(40002);
+    addDestination(40003);
+
+    EXPECT_EQ((int)vlen, send(vlen));
+    EXPECT_EQ(2, capture_state.calls);
+    EXPECT_EQ(3 * vlen, capture_state.ports.size());
+    EXPECT_EQ(40003, capture_state.ports.back());
+}
+
+TEST_F(UdpDestinationTrackerTest, shouldStripeDataFramesAcrossDestinations)
+{
+    m_tracker.is_striped = true;
+    addDestination(40001);
+    addDestination(40002);
+    addDestination(40003);
+
+    EXPECT_EQ(2, send(2, 1024));
+    EXPECT_EQ(2, send(2, 1024));
+    EXPECT_EQ(2, capture_state.calls);
+    EXPECT_EQ(std::vector<uint16_t>({ 40001, 40002, 40003, 40001 }), capture_state.ports);
+}
+
+TEST_F(UdpDestinationTrackerTest, shouldReplicateHeartbeatsWhenStriped)
+{
+    m_tracker.is_striped = true;
+    addDestination(40001);
+    addDestination(40002);
+
+    EXPECT_EQ(1, send(1, 0));
+    EXPECT_EQ(std::vector<uint16_t>({ 40001, 40002 }), capture_state.ports);
+}
+
+TEST_F(UdpDestinationTrackerTest, shouldRemoveManualDestinationByAddress)
+{
+    addDestination(40001);
+    addDestination(40002);
+    addDestination(40003);
+
+    aeron_uri_t *removed_uri = nullptr;
+    struct sockaddr_storage addr = loopbackAddress(40001);
+    ASSERT_EQ(0, aeron_udp_destination_tracker_remove_destination(&m_tracker, &addr, &removed_uri));
+    ASSERT_NE(nullptr, removed_uri);
+    aeron_free(removed_uri);
+
+    onStatusMessage(7, 40002);
+    EXPECT_EQ(2u, m_tracker.destinations.length);
+    EXPECT_EQ(1, send(1));
+    EXPECT_EQ(std::vector<uint16_t>({ 40003, 40002 }), capture_state.ports);
+}
+
+TEST_F(UdpDestinationTrackerTest, shouldTrackAndTimeoutManyDynamicDestinations)
+{
+    const int destination_count = 1000;
+    useDynamicControlMode();
+
+    for (int i = 0; i < destination_count; i++)
+    {
+        onStatusMessage(i, (uint16_t)(40000 + i));
+    }
+
+    for (int i = 0; i < destination_count; i++)
+    {
+        onStatusMessage(i, (uint16_t)(40000 + i));
+    }
+
+    ASSERT_EQ((size_t)destination_count, m_tracker.destinations.length);
+
+    setTime(NOW_NS + AERON_UDP_DESTINATION_TRACKER_DESTINATION_TIMEOUT_NS / 2);
+    for (int i = 0; i < destination_count; i += 2)
+    {
+        onStatusMessage(i, (uint16_t)(40000 + i));
+    }
+
+    setTime(NOW_NS + AERON_UDP_DESTINATION_TRACKER_DESTINATION_TIMEOUT_NS + 1);
+    EXPECT_EQ(1, send(1));
+    ASSERT_EQ((size_t)destination_count / 2, capture_state.ports.size());
+    for (uint16_t port : capture_state.ports)
+    {
+        EXPECT_EQ(0, (port - 40000) % 2);
+    }
+
+    onStatusMessage(1, 40001);
+    EXPECT_EQ((size_t)destination_count / 2 + 1, m_tracker.destinations.length);
+    onStatusMessage(2, 40002);
+    EXPECT_EQ((size_t)destination_count / 2 + 1, m_tracker.destinations.length);
+}
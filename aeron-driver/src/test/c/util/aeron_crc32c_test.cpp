@@ -0,0 +1,83 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "util/aeron_crc32c.h"
+#include "protocol/aeron_udp_protocol.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+}
+
+class Crc32cTest : public testing::Test
+{
+public:
+    Crc32cTest() = default;
+
+protected:
+    static void writeFrame(uint8_t *buffer, int32_t frame_length, uint8_t fill)
+    {
+        auto *data_header = (aeron_data_header_t *)buffer;
+
+        memset(buffer, fill, (size_t)AERON_ALIGN(frame_length, AERON_LOGBUFFER_FRAME_ALIGNMENT));
+        data_header->frame_header.frame_length = frame_length;
+        data_header->frame_header.type = AERON_HDR_TYPE_DATA;
+        data_header->reserved_value = 0;
+    }
+};
+
+TEST_F(Crc32cTest, shouldMatchKnownCheckValue)
+{
+    const char *value = "123456789";
+
+    EXPECT_EQ(UINT32_C(0xE3069283), aeron_crc32c(0, (const uint8_t *)value, strlen(value)));
+}
+
+TEST_F(Crc32cTest, shouldContinueFromPreviousCrc)
+{
+    std::array<uint8_t, 1031> buffer = {};
+    for (size_t i = 0; i < buffer.size(); i++)
+    {
+        buffer[i] = (uint8_t)(i * 31);
+    }
+
+    const uint32_t whole = aeron_crc32c(0, buffer.data(), buffer.size());
+    const uint32_t split = aeron_crc32c(aeron_crc32c(0, buffer.data(), 13), buffer.data() + 13, buffer.size() - 13);
+
+    EXPECT_EQ(whole, split);
+}
+
+TEST_F(Crc32cTest, shouldVerifyChecksummedFrames)
+{
+    std::array<uint8_t, 256> buffer = {};
+    const int32_t first_length = AERON_DATA_HEADER_LENGTH + 13;
+    const int32_t second_offset = AERON_ALIGN(first_length, AERON_LOGBUFFER_FRAME_ALIGNMENT);
+    const size_t length = (size_t)second_offset + AERON_DATA_HEADER_LENGTH + 40;
+
+    writeFrame(buffer.data(), first_length, 0x5A);
+    writeFrame(buffer.data() + second_offset, AERON_DATA_HEADER_LENGTH + 40, 0xA5);
+
+    EXPECT_FALSE(aeron_data_frames_verify_checksum(buffer.data(), length));
+
+    aeron_data_frames_apply_checksum(buffer.data(), length);
+    EXPECT_TRUE(aeron_data_frames_verify_checksum(buffer.data(), length));
+
+    buffer[second_offset + AERON_DATA_HEADER_LENGTH + 7] ^= 0x01;
+    EXPECT_FALSE(aeron_data_frames_verify_checksum(buffer.data(), length));
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <thread>
+#include <atomic>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "aeron_common.h"
+#include "util/aeron_error.h"
+#include "util/aeron_fileutil.h"
+#include "util/aeron_fd_transfer.h"
+#include "concurrent/aeron_logbuffer_descriptor.h"
+}
+
+#define TERM_LENGTH (AERON_LOGBUFFER_TERM_MIN_LENGTH)
+#define PAGE_SIZE (4 * 1024)
+
+#if defined(__linux__)
+TEST(FileUtilTest, shouldMapMemfdLogThroughProcLinkAndReleaseOnClose)
+{
+    char path[AERON_MAX_PATH];
+    aeron_mapped_raw_log_t mapped_raw_log = {};
+    aeron_mapped_raw_log_t client_log = {};
+
+    ASSERT_GT(aeron_memfd_log_location(path, sizeof(path), 42), 0) << aeron_errmsg();
+    ASSERT_EQ(0, aeron_map_raw_log(
+        &mapped_raw_log, path, true, false, AERON_NUMA_NODE_NONE, TERM_LENGTH, PAGE_SIZE)) << aeron_errmsg();
+
+    auto *log_meta_data = (aeron_logbuffer_metadata_t *)mapped_raw_log.log_meta_data.addr;
+    log_meta_data->term_length = TERM_LENGTH;
+    log_meta_data->page_size = PAGE_SIZE;
+    ((uint8_t *)mapped_raw_log.term_buffers[1].addr)[0] = 0x5a;
+
+    ASSERT_EQ(0, aeron_map_existing_log(&client_log, path, false)) << aeron_errmsg();
+    EXPECT_EQ(mapped_raw_log.mapped_file.length, client_log.mapped_file.length);
+    EXPECT_EQ(0x5a, ((uint8_t *)client_log.term_buffers[1].addr)[0]);
+    aeron_unmap(&client_log.mapped_file);
+
+    ASSERT_EQ(0, aeron_map_raw_log_close(&mapped_raw_log, path));
+    EXPECT_LT(aeron_file_length(path), 0);
+}
+#endif
+
+TEST(FileUtilTest, shouldPreTouchAndLockExistingLogWithoutChangingIt)
+{
+    char path[AERON_MAX_PATH];
+    aeron_mapped_raw_log_t mapped_raw_log = {};
+    aeron_mapped_raw_log_t client_log = {};
+
+    aeron_temp_filename(path, sizeof(path));
+    ASSERT_EQ(0, aeron_map_raw_log(
+        &mapped_raw_log, path, false, false, AERON_NUMA_NODE_NONE, TERM_LENGTH, PAGE_SIZE)) << aeron_errmsg();
+
+    auto *log_meta_data = (aeron_logbuffer_metadata_t *)mapped_raw_log.log_meta_data.addr;
+    log_meta_data->term_length = TERM_LENGTH;
+    log_meta_data->page_size = PAGE_SIZE;
+    *(int32_t *)mapped_raw_log.term_buffers[2].addr = 0x5a5a;
+
+    ASSERT_EQ(0, aeron_map_existing_log(&client_log, path, true)) << aeron_errmsg();
+    ASSERT_EQ(0, aeron_lock_mapped_file(&client_log.mapped_file)) << aeron_errmsg();
+    EXPECT_EQ(0x5a5a, *(int32_t *)client_log.term_buffers[2].addr);
+    aeron_unmap(&client_log.mapped_file);
+
+    ASSERT_EQ(0, aeron_map_raw_log_close(&mapped_raw_log, path));
+}
+
+#if !defined(_MSC_VER)
+TEST(FileUtilTest, shouldMapLogReceivedAsDescriptorAndRefuseLogsOutsideRootDir)
+{
+    char path[AERON_MAX_PATH];
+    char socket_path[AERON_MAX_PATH];
+    aeron_mapped_raw_log_t mapped_raw_log = {};
+    aeron_mapped_raw_log_t client_log = {};
+    aeron_fd_transfer_server_t server;
+    std::atomic<bool> is_done(false);
+    int log_fd = -1, refused_fd = 0;
+
+    aeron_temp_filename(path, sizeof(path));
+    aeron_temp_filename(socket_path, sizeof(socket_path));
+    ASSERT_EQ(0, aeron_map_raw_log(
+        &mapped_raw_log, path, false, false, AERON_NUMA_NODE_NONE, TERM_LENGTH, PAGE_SIZE)) << aeron_errmsg();
+
+    auto *log_meta_data = (aeron_logbuffer_metadata_t *)mapped_raw_log.log_meta_data.addr;
+    log_meta_data->term_length = TERM_LENGTH;
+    log_meta_data->page_size = PAGE_SIZE;
+    *(int32_t *)mapped_raw_log.term_buffers[1].addr = 0x5a5a;
+
+    ASSERT_EQ(0, aeron_fd_transfer_server_init(&server, socket_path, "/tmp")) << aeron_errmsg();
+
+    std::thread client([&]()
+    {
+        log_fd = aeron_fd_transfer_request(socket_path, path, 5000);
+        refused_fd = aeron_fd_transfer_request(socket_path, "/tmp/../etc/passwd", 5000);
+        is_done = true;
+    });
+
+    while (!is_done)
+    {
+        aeron_fd_transfer_server_poll(&server);
+        std::this_thread::yield();
+    }
+
+    client.join();
+    aeron_fd_transfer_server_close(&server);
+
+    EXPECT_EQ(-1, refused_fd);
+    ASSERT_GE(log_fd, 0);
+    ASSERT_EQ(0, aeron_map_existing_log_fd(&client_log, log_fd, false)) << aeron_errmsg();
+    EXPECT_EQ(mapped_raw_log.mapped_file.length, client_log.mapped_file.length);
+    EXPECT_EQ(0x5a5a, *(int32_t *)client_log.term_buffers[1].addr);
+    aeron_unmap(&client_log.mapped_file);
+
+    EXPECT_LT(aeron_file_length(socket_path), 0);
+    ASSERT_EQ(0, aeron_map_raw_log_close(&mapped_raw_log, path));
+}
+#endif
@@ -0,0 +1,64 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+extern "C"
+{
+#include "util/aeron_memcpy.h"
+}
+
+class MemcpyTest : public testing::TestWithParam<size_t>
+{
+};
+
+INSTANTIATE_TEST_SUITE_P(MemcpyLengths, MemcpyTest, testing::Values(0, 1, 15, 33, 127, 129, 4093));
+
+TEST_P(MemcpyTest, shouldCopyWithNonTemporalStoresForUnalignedDestinations)
+{
+    const size_t length = GetParam();
+    std::vector<uint8_t> src(length + 64);
+    for (size_t i = 0; i < src.size(); i++)
+    {
+        src[i] = (uint8_t)(i * 13);
+    }
+
+    for (size_t offset = 0; offset < 33; offset += 5)
+    {
+        std::vector<uint8_t> dst(length + 64, 0);
+
+        aeron_memcpy_non_temporal(dst.data() + offset, src.data() + 3, length);
+
+        EXPECT_EQ(0, memcmp(dst.data() + offset, src.data() + 3, length)) << offset;
+        EXPECT_EQ(0u, dst[offset + length]);
+    }
+}
+
+TEST_P(MemcpyTest, shouldCopyBulkRegionWhetherOrNotStreamed)
+{
+    const size_t length = GetParam();
+    std::vector<uint8_t> src(length, 0x5A);
+    std::vector<uint8_t> dst(length + 1, 0);
+
+    aeron_memcpy_bulk(dst.data(), src.data(), length, length);
+    aeron_memcpy_bulk(dst.data(), src.data(), length, AERON_MEMCPY_NON_TEMPORAL_THRESHOLD);
+
+    EXPECT_EQ(0, memcmp(dst.data(), src.data(), length));
+    EXPECT_EQ(0u, dst[length]);
+}
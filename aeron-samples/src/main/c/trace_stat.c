@@ -0,0 +1,318 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+#define _BSD_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include <string.h>
+
+#if !defined(_MSC_VER)
+#include <unistd.h>
+#endif
+
+#include <hdr_histogram.h>
+
+#include "aeronc.h"
+#include "aeron_common.h"
+
+const char usage_str[] =
+    "[-h][-v][-p prefix][-f file] [recorder-file...]\n"
+    "    -h               help\n"
+    "    -v               print every traced frame\n"
+    "    -p prefix        aeron.dir location specified as prefix\n"
+    "    -f file          driver trace file, defaults to " AERON_TRACE_FILE " in the aeron.dir\n";
+
+#define HOP_COUNT (4)
+#define HISTOGRAM_HIGHEST_TRACKABLE_VALUE_NS (10 * 1000 * 1000 * 1000LL)
+
+static const char *hop_names[HOP_COUNT] =
+{
+    "append->send",
+    "send->receive",
+    "receive->rebuild",
+    "rebuild->poll"
+};
+
+typedef struct trace_events_stct
+{
+    aeron_trace_event_t *array;
+    size_t length;
+    size_t capacity;
+}
+trace_events_t;
+
+void collect_event(void *clientd, const aeron_trace_event_t *event)
+{
+    trace_events_t *events = (trace_events_t *)clientd;
+
+    if (events->length == events->capacity)
+    {
+        size_t new_capacity = 0 == events->capacity ? 1024 : events->capacity * 2;
+        aeron_trace_event_t *new_array = realloc(events->array, new_capacity * sizeof(aeron_trace_event_t));
+        if (NULL == new_array)
+        {
+            return;
+        }
+
+        events->array = new_array;
+        events->capacity = new_capacity;
+    }
+
+    events->array[events->length++] = *event;
+}
+
+int compare_events(const void *a, const void *b)
+{
+    const aeron_trace_event_t *lhs = (const aeron_trace_event_t *)a;
+    const aeron_trace_event_t *rhs = (const aeron_trace_event_t *)b;
+
+    if (lhs->session_id != rhs->session_id)
+    {
+        return lhs->session_id < rhs->session_id ? -1 : 1;
+    }
+
+    if (lhs->stream_id != rhs->stream_id)
+    {
+        return lhs->stream_id < rhs->stream_id ? -1 : 1;
+    }
+
+    if (lhs->term_id != rhs->term_id)
+    {
+        return lhs->term_id < rhs->term_id ? -1 : 1;
+    }
+
+    if (lhs->term_offset != rhs->term_offset)
+    {
+        return lhs->term_offset < rhs->term_offset ? -1 : 1;
+    }
+
+    if (lhs->append_timestamp_ns != rhs->append_timestamp_ns)
+    {
+        return lhs->append_timestamp_ns < rhs->append_timestamp_ns ? -1 : 1;
+    }
+
+    if (lhs->event_type != rhs->event_type)
+    {
+        return lhs->event_type < rhs->event_type ? -1 : 1;
+    }
+
+    return lhs->timestamp_ns < rhs->timestamp_ns ? -1 : (lhs->timestamp_ns > rhs->timestamp_ns ? 1 : 0);
+}
+
+bool is_same_frame(const aeron_trace_event_t *lhs, const aeron_trace_event_t *rhs)
+{
+    return lhs->session_id == rhs->session_id &&
+        lhs->stream_id == rhs->stream_id &&
+        lhs->term_id == rhs->term_id &&
+        lhs->term_offset == rhs->term_offset &&
+        lhs->append_timestamp_ns == rhs->append_timestamp_ns;
+}
+
+/*
+ * Timestamps keep only their low 56 bits, so take the difference modulo 2^56 and treat anything past half the range
+ * as a negative hop, which can happen when the clocks of two hosts are compared.
+ */
+int64_t hop_ns(int64_t from_ns, int64_t to_ns)
+{
+    const int64_t delta = (to_ns - from_ns) & AERON_TRACE_TIMESTAMP_MASK;
+
+    return delta > (AERON_TRACE_TIMESTAMP_MASK >> 1) ? -1 : delta;
+}
+
+int main(int argc, char **argv)
+{
+    int status = EXIT_FAILURE, opt;
+    char default_directory[AERON_MAX_PATH];
+    char trace_filename[AERON_MAX_PATH];
+    const char *aeron_dir = NULL;
+    const char *driver_filename = NULL;
+    trace_events_t events = { NULL, 0, 0 };
+    struct hdr_histogram *histograms[HOP_COUNT] = { NULL };
+    int64_t skipped[HOP_COUNT] = { 0 };
+    bool verbose = false;
+    size_t frames = 0;
+
+    while ((opt = getopt(argc, argv, "hvp:f:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'p':
+            {
+                aeron_dir = optarg;
+                break;
+            }
+
+            case 'f':
+            {
+                driver_filename = optarg;
+                break;
+            }
+
+            case 'v':
+            {
+                verbose = true;
+                break;
+            }
+
+            case 'h':
+            default:
+                fprintf(stderr, "Usage: %s %s", argv[0], usage_str);
+                exit(status);
+        }
+    }
+
+    if (NULL == driver_filename)
+    {
+        if (NULL == aeron_dir)
+        {
+            if (aeron_default_path(default_directory, sizeof(default_directory)) < 0)
+            {
+                fprintf(stderr, "failed to resolve aeron directory path\n");
+                goto cleanup;
+            }
+
+            aeron_dir = default_directory;
+        }
+
+        snprintf(trace_filename, sizeof(trace_filename) - 1, "%s/%s", aeron_dir, AERON_TRACE_FILE);
+        driver_filename = trace_filename;
+    }
+
+    if (aeron_trace_file_read(driver_filename, collect_event, &events) < 0)
+    {
+        fprintf(stderr, "failed to read %s: %s\n", driver_filename, aeron_errmsg());
+        goto cleanup;
+    }
+
+    for (int i = optind; i < argc; i++)
+    {
+        if (aeron_trace_file_read(argv[i], collect_event, &events) < 0)
+        {
+            fprintf(stderr, "failed to read %s: %s\n", argv[i], aeron_errmsg());
+            goto cleanup;
+        }
+    }
+
+    for (int i = 0; i < HOP_COUNT; i++)
+    {
+        if (hdr_init(1, HISTOGRAM_HIGHEST_TRACKABLE_VALUE_NS, 3, &histograms[i]) != 0)
+        {
+            fprintf(stderr, "failed to create histogram\n");
+            goto cleanup;
+        }
+    }
+
+    if (events.length > 0)
+    {
+        qsort(events.array, events.length, sizeof(aeron_trace_event_t), compare_events);
+    }
+
+    for (size_t start = 0, end; start < events.length; start = end)
+    {
+        int64_t event_ns[HOP_COUNT + 1];
+        const aeron_trace_event_t *frame = &events.array[start];
+
+        event_ns[0] = frame->append_timestamp_ns;
+        for (int i = 1; i <= HOP_COUNT; i++)
+        {
+            event_ns[i] = AERON_NULL_VALUE;
+        }
+
+        /* events are sorted by time within each type, so the first of a type is the first send of a retransmit */
+        for (end = start; end < events.length && is_same_frame(frame, &events.array[end]); end++)
+        {
+            const aeron_trace_event_t *event = &events.array[end];
+
+            if (event->event_type >= AERON_TRACE_EVENT_SEND && event->event_type <= AERON_TRACE_EVENT_POLL &&
+                AERON_NULL_VALUE == event_ns[event->event_type])
+            {
+                event_ns[event->event_type] = event->timestamp_ns;
+            }
+        }
+
+        frames++;
+
+        if (verbose)
+        {
+            printf("session=%" PRId32 " stream=%" PRId32 " term_id=%" PRId32 " term_offset=%" PRId32 " length=%" PRId32,
+                frame->session_id, frame->stream_id, frame->term_id, frame->term_offset, frame->length);
+        }
+
+        for (int i = 0; i < HOP_COUNT; i++)
+        {
+            if (AERON_NULL_VALUE == event_ns[i] || AERON_NULL_VALUE == event_ns[i + 1])
+            {
+                continue;
+            }
+
+            const int64_t delta_ns = hop_ns(event_ns[i], event_ns[i + 1]);
+            if (delta_ns < 0 || !hdr_record_value(histograms[i], delta_ns))
+            {
+                skipped[i]++;
+                continue;
+            }
+
+            if (verbose)
+            {
+                printf(" %s=%" PRId64 "ns", hop_names[i], delta_ns);
+            }
+        }
+
+        if (verbose)
+        {
+            printf("\n");
+        }
+    }
+
+    printf("%" PRIu64 " traced frames from %" PRIu64 " records\n", (uint64_t)frames, (uint64_t)events.length);
+
+    for (int i = 0; i < HOP_COUNT; i++)
+    {
+        struct hdr_histogram *histogram = histograms[i];
+
+        printf(
+            "%-17s count=%" PRId64 " min=%" PRId64 "ns p50=%" PRId64 "ns p99=%" PRId64 "ns max=%" PRId64 "ns"
+            " skipped=%" PRId64 "\n",
+            hop_names[i],
+            histogram->total_count,
+            0 == histogram->total_count ? 0 : hdr_min(histogram),
+            hdr_value_at_percentile(histogram, 50.0),
+            hdr_value_at_percentile(histogram, 99.0),
+            hdr_max(histogram),
+            skipped[i]);
+    }
+
+    status = EXIT_SUCCESS;
+
+cleanup:
+    for (int i = 0; i < HOP_COUNT; i++)
+    {
+        if (NULL != histograms[i])
+        {
+            hdr_close(histograms[i]);
+        }
+    }
+
+    free(events.array);
+
+    return status;
+}
@@ -20,8 +20,12 @@
 #include <cstdio>
 #include <csignal>
 #include <cinttypes>
+#include <algorithm>
+#include <regex>
+#include <vector>
 
 #include "util/CommandOptionParser.h"
+#include "concurrent/CountersIndex.h"
 #include "Context.h"
 
 using namespace aeron;
@@ -36,14 +40,35 @@ void sigIntHandler(int)
     running = false;
 }
 
-static const char optHelp   = 'h';
-static const char optPath   = 'p';
-static const char optPeriod = 'u';
+static const char optHelp      = 'h';
+static const char optPath      = 'p';
+static const char optPeriod    = 'u';
+static const char optRates     = 'r';
+static const char optTypeId    = 't';
+static const char optLabel     = 'l';
+static const char optFormat    = 'f';
+static const char optSelection = 's';
+static const char optCount     = 'n';
+
+enum class Format
+{
+    TEXT,
+    JSON,
+    PROMETHEUS
+};
 
 struct Settings
 {
     std::string basePath = Context::defaultAeronPath();
     int updateIntervalMs = 1000;
+    bool showRates = false;
+    bool hasTypeId = false;
+    std::int32_t typeId = 0;
+    bool hasLabelFilter = false;
+    std::regex labelFilter;
+    Format format = Format::TEXT;
+    int selectionIntervalMs = 1000;
+    int count = 0;
 };
 
 Settings parseCmdLine(CommandOptionParser &cp, int argc, char **argv)
@@ -59,16 +84,386 @@ Settings parseCmdLine(CommandOptionParser &cp, int argc, char **argv)
 
     settings.basePath = cp.getOption(optPath).getParam(0, settings.basePath);
     settings.updateIntervalMs = cp.getOption(optPeriod).getParamAsInt(0, 1, 1000000, settings.updateIntervalMs);
+    settings.showRates = cp.getOption(optRates).isPresent();
+    settings.selectionIntervalMs = cp.getOption(optSelection).getParamAsInt(
+        0, 1, 1000000, settings.selectionIntervalMs);
+    settings.count = cp.getOption(optCount).getParamAsInt(0, 0, INT32_MAX, settings.count);
+
+    if (cp.getOption(optTypeId).isPresent())
+    {
+        settings.hasTypeId = true;
+        settings.typeId = cp.getOption(optTypeId).getParamAsInt(0, INT32_MIN, INT32_MAX, 0);
+    }
+
+    if (cp.getOption(optLabel).isPresent())
+    {
+        try
+        {
+            settings.labelFilter = std::regex(cp.getOption(optLabel).getParam(0));
+            settings.hasLabelFilter = true;
+        }
+        catch (const std::regex_error &e)
+        {
+            throw CommandOptionException(std::string("invalid label regex: ") + e.what(), SOURCEINFO);
+        }
+    }
+
+    const std::string format = cp.getOption(optFormat).getParam(0, "text");
+    if ("json" == format)
+    {
+        settings.format = Format::JSON;
+    }
+    else if ("prometheus" == format)
+    {
+        settings.format = Format::PROMETHEUS;
+    }
+    else if ("text" != format)
+    {
+        throw CommandOptionException("unknown format: " + format, SOURCEINFO);
+    }
 
     return settings;
 }
 
+/*
+ * The counters being watched with their values held in compact arrays, so a sample reads only the value of each
+ * selected counter. Labels and other metadata are read only when the selection is refreshed.
+ */
+struct Selection
+{
+    std::vector<std::int32_t> counterIds;
+    std::vector<std::int32_t> typeIds;
+    std::vector<std::int64_t> registrationIds;
+    std::vector<std::string> labels;
+    std::vector<std::int64_t> values;
+    std::vector<std::int64_t> previousValues;
+    std::vector<std::uint8_t> hasValue;
+    std::vector<std::uint8_t> hasPreviousValue;
+    std::vector<std::int32_t> stripeCounterIds;
+    std::vector<std::size_t> stripeIndexes;
+
+    void add(std::int32_t counterId, std::int32_t typeId, std::int64_t registrationId, std::string label)
+    {
+        counterIds.push_back(counterId);
+        typeIds.push_back(typeId);
+        registrationIds.push_back(registrationId);
+        labels.push_back(std::move(label));
+        values.push_back(0);
+        previousValues.push_back(0);
+        hasValue.push_back(0);
+        hasPreviousValue.push_back(0);
+    }
+
+    std::size_t size() const
+    {
+        return counterIds.size();
+    }
+};
+
+void selectCounters(CountersIndex &index, const Settings &settings, Selection &selection)
+{
+    const CountersReader &reader = index.countersReader();
+    Selection next;
+
+    const auto consider =
+        [&](std::int32_t counterId, std::int32_t typeId, const std::string &label)
+        {
+            if (CountersReader::STRIPE_TYPE_ID == typeId && !settings.hasTypeId)
+            {
+                return;
+            }
+
+            if (!settings.hasLabelFilter || std::regex_search(label, settings.labelFilter))
+            {
+                next.add(counterId, typeId, reader.getCounterRegistrationId(counterId), label);
+            }
+        };
+
+    if (settings.hasTypeId)
+    {
+        std::vector<std::int32_t> counterIds;
+
+        index.refresh();
+        index.forEachByTypeId(settings.typeId, [&](std::int32_t counterId) { counterIds.push_back(counterId); });
+        std::sort(counterIds.begin(), counterIds.end());
+
+        for (const std::int32_t counterId : counterIds)
+        {
+            consider(counterId, settings.typeId, reader.getCounterLabel(counterId));
+        }
+    }
+    else
+    {
+        reader.forEach(
+            [&](std::int32_t counterId, std::int32_t typeId, const AtomicBuffer &, const std::string &label)
+            {
+                consider(counterId, typeId, label);
+            });
+    }
+
+    // fold the per writer stripes of a selected counter into it so a striped counter shows a single total
+    reader.forEach(
+        [&](std::int32_t counterId, std::int32_t typeId, const AtomicBuffer &key, const std::string &)
+        {
+            if (CountersReader::STRIPE_TYPE_ID == typeId)
+            {
+                const std::int32_t aggregateCounterId = key.getInt32(0);
+                const auto it = std::lower_bound(next.counterIds.begin(), next.counterIds.end(), aggregateCounterId);
+
+                if (it != next.counterIds.end() && *it == aggregateCounterId)
+                {
+                    next.stripeCounterIds.push_back(counterId);
+                    next.stripeIndexes.push_back(static_cast<std::size_t>(it - next.counterIds.begin()));
+                }
+            }
+        });
+
+    // carry the last value of counters still selected so their delta is not lost to the refresh
+    for (std::size_t i = 0, j = 0; i < next.size() && j < selection.size();)
+    {
+        if (next.counterIds[i] < selection.counterIds[j])
+        {
+            i++;
+        }
+        else if (next.counterIds[i] > selection.counterIds[j])
+        {
+            j++;
+        }
+        else
+        {
+            if (next.typeIds[i] == selection.typeIds[j] && next.registrationIds[i] == selection.registrationIds[j])
+            {
+                next.values[i] = selection.values[j];
+                next.hasValue[i] = selection.hasValue[j];
+            }
+            i++;
+            j++;
+        }
+    }
+
+    selection = std::move(next);
+}
+
+void sampleCounters(const CountersReader &reader, Selection &selection)
+{
+    for (std::size_t i = 0, size = selection.size(); i < size; i++)
+    {
+        selection.previousValues[i] = selection.values[i];
+        selection.hasPreviousValue[i] = selection.hasValue[i];
+        selection.values[i] = reader.getCounterValue(selection.counterIds[i]);
+        selection.hasValue[i] = 1;
+    }
+
+    for (std::size_t i = 0, size = selection.stripeCounterIds.size(); i < size; i++)
+    {
+        selection.values[selection.stripeIndexes[i]] += reader.getCounterValue(selection.stripeCounterIds[i]);
+    }
+}
+
+std::string escapeJson(const std::string &value)
+{
+    std::string result;
+
+    for (const char c : value)
+    {
+        switch (c)
+        {
+            case '"': result += "\\\""; break;
+            case '\\': result += "\\\\"; break;
+            case '\n': result += "\\n"; break;
+            case '\r': result += "\\r"; break;
+            case '\t': result += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    char buffer[8];
+                    std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned int>(c));
+                    result += buffer;
+                }
+                else
+                {
+                    result += c;
+                }
+        }
+    }
+
+    return result;
+}
+
+std::string escapePrometheus(const std::string &value)
+{
+    std::string result;
+
+    for (const char c : value)
+    {
+        switch (c)
+        {
+            case '"': result += "\\\""; break;
+            case '\\': result += "\\\\"; break;
+            case '\n': result += "\\n"; break;
+            default: result += c;
+        }
+    }
+
+    return result;
+}
+
+void printText(
+    const Selection &selection,
+    const Settings &settings,
+    double elapsedSeconds,
+    std::int32_t cncVersion,
+    std::int64_t pid,
+    std::int64_t clientLivenessTimeoutNs)
+{
+    time_t rawtime;
+    char currentTime[80];
+
+    ::time(&rawtime);
+    struct tm localTm{};
+
+#ifdef _MSC_VER
+    localtime_s(&localTm, &rawtime);
+#else
+    ::localtime_r(&rawtime, &localTm);
+#endif
+    ::strftime(currentTime, sizeof(currentTime) - 1, "%H:%M:%S", &localTm);
+
+    std::printf("\033[H\033[2J");
+
+    std::printf(
+        "%s - Aeron Stat (CnC v%s), pid %" PRId64 ", client liveness %s ns\n",
+        currentTime,
+        semanticVersionToString(cncVersion).c_str(),
+        pid,
+        toStringWithCommas(clientLivenessTimeoutNs).c_str());
+    std::printf("===========================\n");
+
+    if (settings.showRates)
+    {
+        std::printf("%3s  %20s %20s %20s   %s\n", "id", "value", "delta", "rate/s", "label");
+    }
+
+    for (std::size_t i = 0, size = selection.size(); i < size; i++)
+    {
+        const std::int64_t value = selection.values[i];
+
+        if (!settings.showRates)
+        {
+            std::printf(
+                "%3d: %20s - %s\n",
+                selection.counterIds[i],
+                toStringWithCommas(value).c_str(),
+                selection.labels[i].c_str());
+        }
+        else if (selection.hasPreviousValue[i] && elapsedSeconds > 0)
+        {
+            const std::int64_t delta = value - selection.previousValues[i];
+
+            std::printf(
+                "%3d: %20s %20s %20s - %s\n",
+                selection.counterIds[i],
+                toStringWithCommas(value).c_str(),
+                toStringWithCommas(delta).c_str(),
+                toStringWithCommas(static_cast<std::int64_t>(static_cast<double>(delta) / elapsedSeconds)).c_str(),
+                selection.labels[i].c_str());
+        }
+        else
+        {
+            std::printf(
+                "%3d: %20s %20s %20s - %s\n",
+                selection.counterIds[i],
+                toStringWithCommas(value).c_str(),
+                "-",
+                "-",
+                selection.labels[i].c_str());
+        }
+    }
+
+    std::fflush(stdout);
+}
+
+void printJson(const Selection &selection, const Settings &settings, double elapsedSeconds)
+{
+    const long long timestampMs = duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count();
+
+    std::printf("{\"timestamp\":%lld,\"counters\":[", timestampMs);
+
+    for (std::size_t i = 0, size = selection.size(); i < size; i++)
+    {
+        std::printf(
+            "%s{\"id\":%" PRId32 ",\"typeId\":%" PRId32 ",\"registrationId\":%" PRId64
+            ",\"label\":\"%s\",\"value\":%" PRId64,
+            0 == i ? "" : ",",
+            selection.counterIds[i],
+            selection.typeIds[i],
+            selection.registrationIds[i],
+            escapeJson(selection.labels[i]).c_str(),
+            selection.values[i]);
+
+        if (settings.showRates && selection.hasPreviousValue[i] && elapsedSeconds > 0)
+        {
+            const std::int64_t delta = selection.values[i] - selection.previousValues[i];
+            std::printf(",\"delta\":%" PRId64 ",\"rate\":%.3f", delta, static_cast<double>(delta) / elapsedSeconds);
+        }
+
+        std::printf("}");
+    }
+
+    std::printf("]}\n");
+    std::fflush(stdout);
+}
+
+void printPrometheus(const Selection &selection, const Settings &settings, double elapsedSeconds)
+{
+    std::printf("# HELP aeron_counter_value Value of an Aeron counter.\n");
+    std::printf("# TYPE aeron_counter_value gauge\n");
+
+    for (std::size_t i = 0, size = selection.size(); i < size; i++)
+    {
+        std::printf(
+            "aeron_counter_value{id=\"%" PRId32 "\",type_id=\"%" PRId32 "\",label=\"%s\"} %" PRId64 "\n",
+            selection.counterIds[i],
+            selection.typeIds[i],
+            escapePrometheus(selection.labels[i]).c_str(),
+            selection.values[i]);
+    }
+
+    if (settings.showRates)
+    {
+        std::printf("# HELP aeron_counter_rate Per second rate of change of an Aeron counter.\n");
+        std::printf("# TYPE aeron_counter_rate gauge\n");
+
+        for (std::size_t i = 0, size = selection.size(); i < size; i++)
+        {
+            if (selection.hasPreviousValue[i] && elapsedSeconds > 0)
+            {
+                std::printf(
+                    "aeron_counter_rate{id=\"%" PRId32 "\",type_id=\"%" PRId32 "\",label=\"%s\"} %.3f\n",
+                    selection.counterIds[i],
+                    selection.typeIds[i],
+                    escapePrometheus(selection.labels[i]).c_str(),
+                    static_cast<double>(selection.values[i] - selection.previousValues[i]) / elapsedSeconds);
+            }
+        }
+    }
+
+    std::printf("\n");
+    std::fflush(stdout);
+}
+
 int main (int argc, char** argv)
 {
     CommandOptionParser cp;
-    cp.addOption(CommandOption(optHelp,   0, 0, "                Displays help information."));
-    cp.addOption(CommandOption(optPath,   1, 1, "basePath        Base Path to shared memory. Default: " + Context::defaultAeronPath()));
-    cp.addOption(CommandOption(optPeriod, 1, 1, "update period   Update period in milliseconds. Default: 1000ms"));
+    cp.addOption(CommandOption(optHelp,      0, 0, "                Displays help information."));
+    cp.addOption(CommandOption(optPath,      1, 1, "basePath        Base Path to shared memory. Default: " + Context::defaultAeronPath()));
+    cp.addOption(CommandOption(optPeriod,    1, 1, "update period   Update period in milliseconds. Default: 1000ms"));
+    cp.addOption(CommandOption(optRates,     0, 0, "                Show deltas and per second rates."));
+    cp.addOption(CommandOption(optTypeId,    1, 1, "typeId          Only show counters of this type id."));
+    cp.addOption(CommandOption(optLabel,     1, 1, "regex           Only show counters with a matching label."));
+    cp.addOption(CommandOption(optFormat,    1, 1, "format          text, json or prometheus. Default: text"));
+    cp.addOption(CommandOption(optSelection, 1, 1, "period          Selection refresh period in ms. Default: 1000ms"));
+    cp.addOption(CommandOption(optCount,     1, 1, "count           Updates before exit, 0 for none. Default: 0"));
 
     signal(SIGINT, sigIntHandler);
 
@@ -95,46 +490,59 @@ int main (int argc, char** argv)
 
         AtomicBuffer metadataBuffer = CncFileDescriptor::createCounterMetadataBuffer(cncFile);
         AtomicBuffer valuesBuffer = CncFileDescriptor::createCounterValuesBuffer(cncFile);
+        AtomicBuffer compactBuffer = CncFileDescriptor::createCounterCompactBuffer(cncFile);
 
-        CountersReader counters(metadataBuffer, valuesBuffer);
+        CountersReader counters(metadataBuffer, valuesBuffer, compactBuffer);
+        CountersIndex index(counters);
+        Selection selection;
+
+        steady_clock::time_point nextSelection = steady_clock::now();
+        steady_clock::time_point lastSample = nextSelection;
+        steady_clock::time_point nextUpdate = nextSelection;
+        int updates = 0;
 
         while (running)
         {
-            time_t rawtime;
-            char currentTime[80];
+            const steady_clock::time_point now = steady_clock::now();
 
-            ::time(&rawtime);
-            struct tm localTm{};
+            if (now >= nextSelection)
+            {
+                selectCounters(index, settings, selection);
+                nextSelection = now + milliseconds(settings.selectionIntervalMs);
+            }
 
-#ifdef _MSC_VER
-            localtime_s(&localTm, &rawtime);
-#else
-            ::localtime_r(&rawtime, &localTm);
-#endif
-            ::strftime(currentTime, sizeof(currentTime) - 1, "%H:%M:%S", &localTm);
+            sampleCounters(counters, selection);
+            const double elapsedSeconds = duration_cast<duration<double>>(now - lastSample).count();
+            lastSample = now;
 
-            std::printf("\033[H\033[2J");
+            switch (settings.format)
+            {
+                case Format::TEXT:
+                    printText(selection, settings, elapsedSeconds, cncVersion, pid, clientLivenessTimeoutNs);
+                    break;
 
-            std::printf(
-                "%s - Aeron Stat (CnC v%s), pid %" PRId64 ", client liveness %s ns\n",
-                currentTime,
-                semanticVersionToString(cncVersion).c_str(),
-                pid,
-                toStringWithCommas(clientLivenessTimeoutNs).c_str());
-            std::printf("===========================\n");
-
-            counters.forEach(
-                [&](std::int32_t counterId, std::int32_t, const AtomicBuffer &, const std::string &l)
-                {
-                    std::int64_t value = counters.getCounterValue(counterId);
+                case Format::JSON:
+                    printJson(selection, settings, elapsedSeconds);
+                    break;
+
+                case Format::PROMETHEUS:
+                    printPrometheus(selection, settings, elapsedSeconds);
+                    break;
+            }
 
-                    std::printf("%3d: %20s - %s\n", counterId, toStringWithCommas(value).c_str(), l.c_str());
-                });
+            if (settings.count > 0 && ++updates >= settings.count)
+            {
+                break;
+            }
 
-            std::this_thread::sleep_for(std::chrono::milliseconds(settings.updateIntervalMs));
+            nextUpdate += milliseconds(settings.updateIntervalMs);
+            std::this_thread::sleep_until(nextUpdate);
         }
 
-        std::cout << "Exiting..." << std::endl;
+        if (Format::TEXT == settings.format)
+        {
+            std::cout << "Exiting..." << std::endl;
+        }
     }
     catch (const CommandOptionException &e)
     {
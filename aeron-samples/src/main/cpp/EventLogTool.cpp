@@ -0,0 +1,418 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cstring>
+#include <cstdlib>
+#include <cinttypes>
+
+#include "util/CommandOptionParser.h"
+#include "concurrent/logbuffer/DataFrameHeader.h"
+
+using namespace aeron::util;
+using namespace aeron::concurrent::logbuffer;
+
+static const char optHelp = 'h';
+static const char optFile = 'f';
+
+/*
+ * Mirrors the binary event log written by the C media driver when AERON_EVENT_LOG_MODE=binary, see
+ * aeron_driver_agent.h. The log is read on the same platform it was written on.
+ */
+static const char LOG_MAGIC[8] = { 'A', 'E', 'R', 'O', 'N', 'E', 'V', 'T' };
+static const std::int32_t LOG_VERSION = 1;
+
+static const std::int32_t CMD_IN = 0x01;
+static const std::int32_t CMD_OUT = 0x02;
+static const std::int32_t FRAME_IN = 0x04;
+static const std::int32_t FRAME_IN_DROPPED = 0x08;
+static const std::int32_t FRAME_OUT = 0x10;
+static const std::int32_t MAP_RAW_LOG_OP = 0x20;
+static const std::int32_t MAP_RAW_LOG_OP_CLOSE = 0x40;
+static const std::int32_t UNTETHERED_SUBSCRIPTION_STATE_CHANGE = 0x80;
+static const std::int32_t DYNAMIC_DISSECTOR_EVENT = 0x100;
+static const std::int32_t EVENT_LOG_DROPPED = 0x020000;
+
+struct LogHeader
+{
+    char magic[8];
+    std::int32_t version;
+    std::int32_t reserved;
+};
+
+struct RecordHeader
+{
+    std::int32_t type;
+    std::int32_t length;
+};
+
+struct CmdLogHeader
+{
+    std::int64_t timeMs;
+    std::int64_t cmdId;
+};
+
+struct FrameLogHeader
+{
+    std::int64_t timeMs;
+    std::int32_t result;
+    std::int32_t sockaddrLen;
+    std::int32_t messageLen;
+};
+
+struct MappedBuffer
+{
+    std::uint8_t *addr;
+    std::size_t length;
+};
+
+struct MappedRawLog
+{
+    MappedBuffer termBuffers[3];
+    MappedBuffer logMetaData;
+    MappedBuffer mappedFile;
+    std::size_t termLength;
+};
+
+struct MapRawLogOpHeader
+{
+    std::int64_t timeMs;
+    union
+    {
+        struct
+        {
+            MappedRawLog log;
+            int result;
+            std::uintptr_t addr;
+            std::int32_t pathLen;
+        }
+        mapRawLog;
+
+        struct
+        {
+            MappedRawLog log;
+            int result;
+            std::uintptr_t addr;
+        }
+        mapRawLogClose;
+    }
+    mapRaw;
+};
+
+struct UntetheredStateChangeHeader
+{
+    std::int64_t timeMs;
+    std::int64_t subscriptionId;
+    std::int32_t streamId;
+    std::int32_t sessionId;
+    std::int32_t oldState;
+    std::int32_t newState;
+};
+
+struct DynamicEventHeader
+{
+    std::int64_t timeMs;
+    std::int64_t index;
+};
+
+struct DroppedLogHeader
+{
+    std::int64_t timeMs;
+    std::int64_t droppedCount;
+    std::int32_t eventType;
+    std::int32_t reserved;
+};
+
+struct Settings
+{
+    std::string filename;
+};
+
+Settings parseCmdLine(CommandOptionParser &cp, int argc, char **argv)
+{
+    cp.parse(argc, argv);
+    if (cp.getOption(optHelp).isPresent() || !cp.getOption(optFile).isPresent())
+    {
+        cp.displayOptionsHelp(std::cout);
+        exit(0);
+    }
+
+    Settings s;
+
+    s.filename = cp.getOption(optFile).getParam(0);
+
+    return s;
+}
+
+const char *typeName(std::int32_t type)
+{
+    switch (type)
+    {
+        case CMD_IN: return "CMD_IN";
+        case CMD_OUT: return "CMD_OUT";
+        case FRAME_IN: return "FRAME_IN";
+        case FRAME_IN_DROPPED: return "FRAME_IN_DROPPED";
+        case FRAME_OUT: return "FRAME_OUT";
+        case MAP_RAW_LOG_OP: return "MAP_RAW_LOG_OP";
+        case MAP_RAW_LOG_OP_CLOSE: return "MAP_RAW_LOG_OP_CLOSE";
+        case UNTETHERED_SUBSCRIPTION_STATE_CHANGE: return "UNTETHERED_SUBSCRIPTION_STATE_CHANGE";
+        case DYNAMIC_DISSECTOR_EVENT: return "DYNAMIC_DISSECTOR_EVENT";
+        case EVENT_LOG_DROPPED: return "DROPPED";
+        default: return "unknown";
+    }
+}
+
+const char *tetherStateName(std::int32_t state)
+{
+    switch (state)
+    {
+        case 0: return "ACTIVE";
+        case 1: return "LINGER";
+        case 2: return "RESTING";
+        default: return "unknown";
+    }
+}
+
+const char *frameTypeName(std::uint16_t type)
+{
+    switch (type)
+    {
+        case DataFrameHeader::HDR_TYPE_PAD: return "PAD";
+        case DataFrameHeader::HDR_TYPE_DATA: return "DATA";
+        case DataFrameHeader::HDR_TYPE_NAK: return "NAK";
+        case DataFrameHeader::HDR_TYPE_SM: return "SM";
+        case DataFrameHeader::HDR_TYPE_ERR: return "ERR";
+        case DataFrameHeader::HDR_TYPE_SETUP: return "SETUP";
+        case DataFrameHeader::HDR_TYPE_EXT: return "EXT";
+        default: return "unknown";
+    }
+}
+
+std::string timestamp(std::int64_t timeMs)
+{
+    char buffer[80];
+    std::snprintf(buffer, sizeof(buffer) - 1, "%" PRId64 ".%03" PRId64, timeMs / 1000, timeMs % 1000);
+    return std::string(buffer);
+}
+
+template<typename T>
+bool readHeader(const std::vector<std::uint8_t> &payload, T &header)
+{
+    if (payload.size() < sizeof(T))
+    {
+        return false;
+    }
+
+    std::memcpy(&header, payload.data(), sizeof(T));
+    return true;
+}
+
+void printFrame(std::int32_t type, const std::vector<std::uint8_t> &payload)
+{
+    FrameLogHeader hdr{};
+    if (!readHeader(payload, hdr))
+    {
+        std::cout << typeName(type) << " truncated" << std::endl;
+        return;
+    }
+
+    std::cout << "[" << timestamp(hdr.timeMs) << "] " << typeName(type)
+              << " result=" << hdr.result << " length=" << hdr.messageLen
+              << " sockaddr_len=" << hdr.sockaddrLen;
+
+    const std::size_t frameOffset = sizeof(FrameLogHeader) + static_cast<std::size_t>(hdr.sockaddrLen);
+    if (payload.size() >= frameOffset + sizeof(DataFrameHeader::DataFrameHeaderDefn))
+    {
+        DataFrameHeader::DataFrameHeaderDefn frame{};
+        std::memcpy(&frame, payload.data() + frameOffset, sizeof(frame));
+
+        std::cout << " type=" << frameTypeName(frame.type)
+                  << " flags=" << static_cast<int>(frame.flags)
+                  << " frame_length=" << frame.frameLength
+                  << " session_id=" << frame.sessionId
+                  << " stream_id=" << frame.streamId
+                  << " term_id=" << frame.termId
+                  << " term_offset=" << frame.termOffset;
+    }
+
+    std::cout << " captured=" << (payload.size() > frameOffset ? payload.size() - frameOffset : 0) << std::endl;
+}
+
+void printRecord(std::int32_t type, const std::vector<std::uint8_t> &payload)
+{
+    switch (type)
+    {
+        case CMD_IN:
+        case CMD_OUT:
+        {
+            CmdLogHeader hdr{};
+            if (readHeader(payload, hdr))
+            {
+                std::cout << "[" << timestamp(hdr.timeMs) << "] " << typeName(type)
+                          << " cmd_id=0x" << std::hex << hdr.cmdId << std::dec
+                          << " length=" << payload.size() - sizeof(CmdLogHeader) << std::endl;
+            }
+            break;
+        }
+
+        case FRAME_IN:
+        case FRAME_IN_DROPPED:
+        case FRAME_OUT:
+            printFrame(type, payload);
+            break;
+
+        case MAP_RAW_LOG_OP:
+        {
+            MapRawLogOpHeader hdr{};
+            if (readHeader(payload, hdr))
+            {
+                std::string path(
+                    reinterpret_cast<const char *>(payload.data()) + sizeof(MapRawLogOpHeader),
+                    payload.size() - sizeof(MapRawLogOpHeader));
+
+                std::cout << "[" << timestamp(hdr.timeMs) << "] " << typeName(type)
+                          << " result=" << hdr.mapRaw.mapRawLog.result
+                          << " addr=0x" << std::hex << hdr.mapRaw.mapRawLog.addr << std::dec
+                          << " path=" << path << std::endl;
+            }
+            break;
+        }
+
+        case MAP_RAW_LOG_OP_CLOSE:
+        {
+            MapRawLogOpHeader hdr{};
+            if (readHeader(payload, hdr))
+            {
+                std::cout << "[" << timestamp(hdr.timeMs) << "] " << typeName(type)
+                          << " result=" << hdr.mapRaw.mapRawLogClose.result
+                          << " addr=0x" << std::hex << hdr.mapRaw.mapRawLogClose.addr << std::dec << std::endl;
+            }
+            break;
+        }
+
+        case UNTETHERED_SUBSCRIPTION_STATE_CHANGE:
+        {
+            UntetheredStateChangeHeader hdr{};
+            if (readHeader(payload, hdr))
+            {
+                std::cout << "[" << timestamp(hdr.timeMs) << "] " << typeName(type)
+                          << " subscription_id=" << hdr.subscriptionId
+                          << " stream_id=" << hdr.streamId
+                          << " session_id=" << hdr.sessionId
+                          << " " << tetherStateName(hdr.oldState) << " -> " << tetherStateName(hdr.newState)
+                          << std::endl;
+            }
+            break;
+        }
+
+        case DYNAMIC_DISSECTOR_EVENT:
+        {
+            DynamicEventHeader hdr{};
+            if (readHeader(payload, hdr))
+            {
+                std::cout << "[" << timestamp(hdr.timeMs) << "] " << typeName(type)
+                          << " index=" << hdr.index
+                          << " length=" << payload.size() - sizeof(DynamicEventHeader) << std::endl;
+            }
+            break;
+        }
+
+        case EVENT_LOG_DROPPED:
+        {
+            DroppedLogHeader hdr{};
+            if (readHeader(payload, hdr))
+            {
+                std::cout << "[" << timestamp(hdr.timeMs) << "] " << typeName(type)
+                          << " event=" << typeName(hdr.eventType)
+                          << " count=" << hdr.droppedCount << std::endl;
+            }
+            break;
+        }
+
+        default:
+            std::cout << typeName(type) << " type=0x" << std::hex << type << std::dec
+                      << " length=" << payload.size() << std::endl;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    CommandOptionParser cp;
+    cp.addOption(CommandOption(optHelp, 0, 0, "           Displays help information."));
+    cp.addOption(CommandOption(optFile, 1, 1, "filename   Binary event log written with AERON_EVENT_LOG_MODE=binary."));
+
+    try
+    {
+        Settings settings = parseCmdLine(cp, argc, argv);
+
+        std::ifstream in(settings.filename, std::ios::binary);
+        if (!in)
+        {
+            std::cerr << "could not open " << settings.filename << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        LogHeader logHeader{};
+        if (!in.read(reinterpret_cast<char *>(&logHeader), sizeof(logHeader)) ||
+            0 != std::memcmp(logHeader.magic, LOG_MAGIC, sizeof(LOG_MAGIC)))
+        {
+            std::cerr << "not a binary event log: " << settings.filename << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        if (LOG_VERSION != logHeader.version)
+        {
+            std::cerr << "event log version not supported: " << logHeader.version << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        RecordHeader recordHeader{};
+        std::vector<std::uint8_t> payload;
+
+        while (in.read(reinterpret_cast<char *>(&recordHeader), sizeof(recordHeader)))
+        {
+            if (recordHeader.length < 0)
+            {
+                std::cerr << "corrupt record length: " << recordHeader.length << std::endl;
+                return EXIT_FAILURE;
+            }
+
+            payload.resize(static_cast<std::size_t>(recordHeader.length));
+            if (!in.read(reinterpret_cast<char *>(payload.data()), recordHeader.length))
+            {
+                std::cerr << "truncated record at end of log" << std::endl;
+                break;
+            }
+
+            printRecord(recordHeader.type, payload);
+        }
+    }
+    catch (const CommandOptionException &e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl << std::endl;
+        cp.displayOptionsHelp(std::cerr);
+        return -1;
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "FAILED: " << e.what() << " : " << std::endl;
+        return -1;
+    }
+
+    return 0;
+}
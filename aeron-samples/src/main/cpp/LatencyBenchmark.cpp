@@ -0,0 +1,465 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <csignal>
+#include <atomic>
+#include <string>
+#include <vector>
+
+extern "C"
+{
+#include <hdr_histogram.h>
+
+#ifdef AERON_SAMPLES_EMBEDDED_DRIVER
+#include "aeronmd.h"
+#endif
+}
+
+#include "Configuration.h"
+#include "concurrent/BusySpinIdleStrategy.h"
+#include "util/CommandOptionParser.h"
+#include "FragmentAssembler.h"
+#include "Aeron.h"
+
+using namespace std::chrono;
+using namespace aeron::util;
+using namespace aeron;
+
+std::atomic<bool> running(true);
+
+void sigIntHandler(int)
+{
+    running = false;
+}
+
+static const char optHelp           = 'h';
+static const char optPrefix         = 'p';
+static const char optPingChannel    = 'c';
+static const char optPongChannel    = 'C';
+static const char optPingStreamId   = 's';
+static const char optPongStreamId   = 'S';
+static const char optFrags          = 'f';
+static const char optMessages       = 'm';
+static const char optLength         = 'L';
+static const char optWarmupMessages = 'w';
+static const char optRate           = 'r';
+static const char optOutputDir      = 'o';
+static const char optName           = 'n';
+static const char optExternalPong   = 'x';
+static const char optEmbeddedDriver = 'E';
+
+static const long long DEFAULT_MESSAGE_RATE = 100000;
+static const std::int64_t HISTOGRAM_HIGHEST_TRACKABLE_VALUE_NS = 10 * 1000 * 1000 * 1000LL;
+
+struct Settings
+{
+    std::string dirPrefix = "";
+    std::string pingChannel = samples::configuration::DEFAULT_PING_CHANNEL;
+    std::string pongChannel = samples::configuration::DEFAULT_PONG_CHANNEL;
+    std::int32_t pingStreamId = samples::configuration::DEFAULT_PING_STREAM_ID;
+    std::int32_t pongStreamId = samples::configuration::DEFAULT_PONG_STREAM_ID;
+    long long numberOfWarmupMessages = samples::configuration::DEFAULT_NUMBER_OF_WARM_UP_MESSAGES;
+    long long numberOfMessages = 1000000;
+    long long messageRate = DEFAULT_MESSAGE_RATE;
+    std::vector<int> messageLengths;
+    int fragmentCountLimit = samples::configuration::DEFAULT_FRAGMENT_COUNT_LIMIT;
+    std::string outputDir = ".";
+    std::string name = "latency";
+    bool externalPong = false;
+    bool embeddedDriver = false;
+};
+
+/*
+ * The first word of each ping is the time at which the message was intended to be sent according to the fixed rate
+ * schedule, the second is the time at which it was actually sent. Measuring from the intended time includes any
+ * time the sender was held up, e.g. by back pressure or a slow response, which is the correction for coordinated
+ * omission.
+ */
+static const index_t INTENDED_TIME_OFFSET = 0;
+static const index_t SEND_TIME_OFFSET = sizeof(std::int64_t);
+static const int MIN_MESSAGE_LENGTH = 2 * sizeof(std::int64_t);
+
+inline std::int64_t nanoTime()
+{
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+Settings parseCmdLine(CommandOptionParser &cp, int argc, char **argv)
+{
+    cp.parse(argc, argv);
+    if (cp.getOption(optHelp).isPresent())
+    {
+        cp.displayOptionsHelp(std::cout);
+        exit(0);
+    }
+
+    Settings s;
+
+    s.dirPrefix = cp.getOption(optPrefix).getParam(0, s.dirPrefix);
+    s.pingChannel = cp.getOption(optPingChannel).getParam(0, s.pingChannel);
+    s.pongChannel = cp.getOption(optPongChannel).getParam(0, s.pongChannel);
+    s.pingStreamId = cp.getOption(optPingStreamId).getParamAsInt(0, 1, INT32_MAX, s.pingStreamId);
+    s.pongStreamId = cp.getOption(optPongStreamId).getParamAsInt(0, 1, INT32_MAX, s.pongStreamId);
+    s.numberOfMessages = cp.getOption(optMessages).getParamAsLong(0, 1, INT64_MAX, s.numberOfMessages);
+    s.messageRate = cp.getOption(optRate).getParamAsLong(0, 1, 1000 * 1000 * 1000LL, s.messageRate);
+    s.fragmentCountLimit = cp.getOption(optFrags).getParamAsInt(0, 1, INT32_MAX, s.fragmentCountLimit);
+    s.numberOfWarmupMessages = cp.getOption(optWarmupMessages).getParamAsLong(
+        0, 0, INT64_MAX, s.numberOfWarmupMessages);
+    s.outputDir = cp.getOption(optOutputDir).getParam(0, s.outputDir);
+    s.name = cp.getOption(optName).getParam(0, s.name);
+    s.externalPong = cp.getOption(optExternalPong).isPresent();
+    s.embeddedDriver = cp.getOption(optEmbeddedDriver).isPresent();
+
+    const CommandOption &lengthOption = cp.getOption(optLength);
+    if (lengthOption.isPresent())
+    {
+        for (std::size_t i = 0; i < lengthOption.getNumParams(); i++)
+        {
+            s.messageLengths.push_back(lengthOption.getParamAsInt(i, MIN_MESSAGE_LENGTH, INT32_MAX, 0));
+        }
+    }
+    else
+    {
+        s.messageLengths.push_back(samples::configuration::DEFAULT_MESSAGE_LENGTH);
+    }
+
+    return s;
+}
+
+#ifdef AERON_SAMPLES_EMBEDDED_DRIVER
+class EmbeddedDriver
+{
+public:
+    explicit EmbeddedDriver(const std::string &dir)
+    {
+        if (aeron_driver_context_init(&m_context) < 0 ||
+            (!dir.empty() && aeron_driver_context_set_dir(m_context, dir.c_str()) < 0) ||
+            aeron_driver_context_set_dir_delete_on_start(m_context, true) < 0 ||
+            aeron_driver_context_set_dir_delete_on_shutdown(m_context, true) < 0 ||
+            aeron_driver_init(&m_driver, m_context) < 0 ||
+            aeron_driver_start(m_driver, true) < 0)
+        {
+            const std::string errorMessage = aeron_errmsg();
+            close();
+            throw std::runtime_error("failed to start embedded driver: " + errorMessage);
+        }
+
+        m_thread = std::thread(
+            [&]()
+            {
+                while (m_running)
+                {
+                    aeron_driver_main_idle_strategy(m_driver, aeron_driver_main_do_work(m_driver));
+                }
+            });
+    }
+
+    ~EmbeddedDriver()
+    {
+        m_running = false;
+        m_thread.join();
+        close();
+    }
+
+private:
+    std::atomic<bool> m_running = { true };
+    std::thread m_thread;
+    aeron_driver_context_t *m_context = nullptr;
+    aeron_driver_t *m_driver = nullptr;
+
+    void close()
+    {
+        aeron_driver_close(m_driver);
+        aeron_driver_context_close(m_context);
+        m_driver = nullptr;
+        m_context = nullptr;
+    }
+};
+#endif
+
+/*
+ * Send pings at a fixed rate while polling for the pongs, rather than waiting for each pong before sending the next
+ * ping, so that a slow response delays the following pings and is reflected in their corrected latencies.
+ */
+void sendPingsAtFixedRateAndReceivePongs(
+    const fragment_handler_t &fragmentHandler,
+    Publication &publication,
+    Subscription &subscription,
+    int messageLength,
+    long long numberOfMessages,
+    const Settings &settings)
+{
+    std::unique_ptr<std::uint8_t[]> buffer(new std::uint8_t[messageLength]);
+    concurrent::AtomicBuffer srcBuffer(buffer.get(), static_cast<size_t>(messageLength));
+    const std::int64_t sendIntervalNs = 1000 * 1000 * 1000LL / settings.messageRate;
+
+    srcBuffer.setMemory(0, messageLength, 0);
+
+    while (!subscription.isConnected())
+    {
+        std::this_thread::yield();
+    }
+
+    std::shared_ptr<Image> imageSharedPtr = subscription.imageByIndex(0);
+    Image &image = *imageSharedPtr;
+
+    long long sentCount = 0;
+    std::int64_t lastPosition = 0;
+    std::int64_t nextSendTimeNs = nanoTime();
+
+    while (running)
+    {
+        if (sentCount < numberOfMessages && nanoTime() >= nextSendTimeNs)
+        {
+            srcBuffer.putInt64(INTENDED_TIME_OFFSET, nextSendTimeNs);
+            srcBuffer.putInt64(SEND_TIME_OFFSET, nanoTime());
+
+            const std::int64_t position = publication.offer(srcBuffer, 0, messageLength);
+            if (position > 0)
+            {
+                lastPosition = position;
+                nextSendTimeNs += sendIntervalNs;
+                sentCount++;
+            }
+        }
+
+        image.poll(fragmentHandler, settings.fragmentCountLimit);
+
+        if (sentCount >= numberOfMessages && image.position() >= lastPosition)
+        {
+            break;
+        }
+    }
+}
+
+void writeHistogram(hdr_histogram *histogram, const std::string &filename)
+{
+    FILE *file = fopen(filename.c_str(), "w");
+    if (nullptr == file)
+    {
+        throw std::runtime_error("could not open " + filename);
+    }
+
+    hdr_percentiles_print(histogram, file, 5, 1000.0, CLASSIC);
+    fclose(file);
+}
+
+std::shared_ptr<Subscription> findSubscription(std::shared_ptr<Aeron> aeron, std::int64_t id)
+{
+    std::shared_ptr<Subscription> subscription = aeron->findSubscription(id);
+
+    while (!subscription)
+    {
+        std::this_thread::yield();
+        subscription = aeron->findSubscription(id);
+    }
+
+    return subscription;
+}
+
+std::shared_ptr<Publication> findPublication(std::shared_ptr<Aeron> aeron, std::int64_t id)
+{
+    std::shared_ptr<Publication> publication = aeron->findPublication(id);
+
+    while (!publication)
+    {
+        std::this_thread::yield();
+        publication = aeron->findPublication(id);
+    }
+
+    return publication;
+}
+
+int main(int argc, char **argv)
+{
+    CommandOptionParser cp;
+    cp.addOption(CommandOption(optHelp,           0, 0,  "                Displays help information."));
+    cp.addOption(CommandOption(optPrefix,         1, 1,  "dir             Prefix directory for aeron driver."));
+    cp.addOption(CommandOption(optPingChannel,    1, 1,  "channel         Ping Channel (IPC, UDP or multicast)."));
+    cp.addOption(CommandOption(optPongChannel,    1, 1,  "channel         Pong Channel."));
+    cp.addOption(CommandOption(optPingStreamId,   1, 1,  "streamId        Ping Stream ID."));
+    cp.addOption(CommandOption(optPongStreamId,   1, 1,  "streamId        Pong Stream ID."));
+    cp.addOption(CommandOption(optMessages,       1, 1,  "number          Number of Messages per length."));
+    cp.addOption(CommandOption(optLength,         1, 32, "length...       Message lengths to sweep."));
+    cp.addOption(CommandOption(optRate,           1, 1,  "rate            Messages per second to offer."));
+    cp.addOption(CommandOption(optFrags,          1, 1,  "limit           Fragment Count Limit."));
+    cp.addOption(CommandOption(optWarmupMessages, 1, 1,  "number          Number of Messages for warmup."));
+    cp.addOption(CommandOption(optOutputDir,      1, 1,  "dir             Directory to write .hgrm files to."));
+    cp.addOption(CommandOption(optName,           1, 1,  "name            Name prefix of the .hgrm files."));
+    cp.addOption(CommandOption(optExternalPong,   0, 0,  "                Use an external Pong."));
+    cp.addOption(CommandOption(optEmbeddedDriver, 0, 0,  "                Run an embedded media driver."));
+
+    signal(SIGINT, sigIntHandler);
+
+    try
+    {
+        Settings settings = parseCmdLine(cp, argc, argv);
+
+#ifdef AERON_SAMPLES_EMBEDDED_DRIVER
+        std::unique_ptr<EmbeddedDriver> embeddedDriver;
+        if (settings.embeddedDriver)
+        {
+            embeddedDriver.reset(new EmbeddedDriver(settings.dirPrefix));
+        }
+#else
+        if (settings.embeddedDriver)
+        {
+            throw std::runtime_error("built without support for an embedded media driver");
+        }
+#endif
+
+        std::cout << "Pong at " << settings.pongChannel << " on Stream ID " << settings.pongStreamId << std::endl;
+        std::cout << "Ping at " << settings.pingChannel << " on Stream ID " << settings.pingStreamId << std::endl;
+
+        aeron::Context context;
+
+        if (!settings.dirPrefix.empty())
+        {
+            context.aeronDir(settings.dirPrefix);
+        }
+
+        context.preTouchMappedMemory(true);
+
+        std::shared_ptr<Aeron> aeron = Aeron::connect(context);
+
+        std::shared_ptr<Subscription> pongSubscription = findSubscription(
+            aeron, aeron->addSubscription(settings.pongChannel, settings.pongStreamId));
+        std::shared_ptr<Publication> pingPublication = findPublication(
+            aeron, aeron->addPublication(settings.pingChannel, settings.pingStreamId));
+        std::shared_ptr<Subscription> pingSubscription;
+        std::shared_ptr<Publication> pongPublication;
+        std::thread pongThread;
+
+        if (!settings.externalPong)
+        {
+            pingSubscription = findSubscription(
+                aeron, aeron->addSubscription(settings.pingChannel, settings.pingStreamId));
+            pongPublication = findPublication(
+                aeron, aeron->addPublication(settings.pongChannel, settings.pongStreamId));
+
+            pongThread = std::thread(
+                [&]()
+                {
+                    Publication &pongPublicationRef = *pongPublication;
+                    Subscription &pingSubscriptionRef = *pingSubscription;
+                    BusySpinIdleStrategy idleStrategy;
+                    BusySpinIdleStrategy pingHandlerIdleStrategy;
+                    FragmentAssembler pingFragmentAssembler(
+                        [&](AtomicBuffer &buffer, index_t offset, index_t length, const Header &header)
+                        {
+                            while (pongPublicationRef.offer(buffer, offset, length) < 0L && running)
+                            {
+                                pingHandlerIdleStrategy.idle();
+                            }
+                        });
+                    fragment_handler_t pingHandler = pingFragmentAssembler.handler();
+
+                    while (running)
+                    {
+                        idleStrategy.idle(pingSubscriptionRef.poll(pingHandler, settings.fragmentCountLimit));
+                    }
+                });
+        }
+
+        hdr_histogram *histogram;
+        hdr_histogram *uncorrectedHistogram;
+        hdr_init(1, HISTOGRAM_HIGHEST_TRACKABLE_VALUE_NS, 3, &histogram);
+        hdr_init(1, HISTOGRAM_HIGHEST_TRACKABLE_VALUE_NS, 3, &uncorrectedHistogram);
+
+        FragmentAssembler fragmentAssembler(
+            [&](const AtomicBuffer &buffer, index_t offset, index_t length, const Header &header)
+            {
+                const std::int64_t nowNs = nanoTime();
+
+                hdr_record_value(histogram, nowNs - buffer.getInt64(offset + INTENDED_TIME_OFFSET));
+                hdr_record_value(uncorrectedHistogram, nowNs - buffer.getInt64(offset + SEND_TIME_OFFSET));
+            });
+        fragment_handler_t pongHandler = fragmentAssembler.handler();
+
+        for (std::size_t i = 0; i < settings.messageLengths.size() && running; i++)
+        {
+            const int messageLength = settings.messageLengths[i];
+
+            if (settings.numberOfWarmupMessages > 0)
+            {
+                std::cout << "Warming up with "
+                          << toStringWithCommas(settings.numberOfWarmupMessages) << " messages of length "
+                          << toStringWithCommas(messageLength) << std::endl;
+
+                sendPingsAtFixedRateAndReceivePongs(
+                    [](AtomicBuffer &, index_t, index_t, Header &) {},
+                    *pingPublication,
+                    *pongSubscription,
+                    messageLength,
+                    settings.numberOfWarmupMessages,
+                    settings);
+            }
+
+            hdr_reset(histogram);
+            hdr_reset(uncorrectedHistogram);
+
+            std::cout << "Pinging "
+                      << toStringWithCommas(settings.numberOfMessages) << " messages of length "
+                      << toStringWithCommas(messageLength) << " bytes at "
+                      << toStringWithCommas(settings.messageRate) << " msgs/sec" << std::endl;
+
+            sendPingsAtFixedRateAndReceivePongs(
+                pongHandler, *pingPublication, *pongSubscription, messageLength, settings.numberOfMessages, settings);
+
+            hdr_percentiles_print(histogram, stdout, 5, 1000.0, CLASSIC);
+            std::cout << "Uncorrected: mean=" << hdr_mean(uncorrectedHistogram) / 1000.0
+                      << "us 99%=" << hdr_value_at_percentile(uncorrectedHistogram, 99.0) / 1000.0
+                      << "us max=" << hdr_max(uncorrectedHistogram) / 1000.0 << "us" << std::endl;
+
+            const std::string filePrefix =
+                settings.outputDir + "/" + settings.name + "-" + std::to_string(messageLength);
+            writeHistogram(histogram, filePrefix + ".hgrm");
+            writeHistogram(uncorrectedHistogram, filePrefix + "-uncorrected.hgrm");
+            std::cout << "Wrote " << filePrefix << ".hgrm" << std::endl;
+        }
+
+        hdr_close(histogram);
+        hdr_close(uncorrectedHistogram);
+
+        running = false;
+
+        if (pongThread.joinable())
+        {
+            pongThread.join();
+        }
+    }
+    catch (const CommandOptionException &e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl << std::endl;
+        cp.displayOptionsHelp(std::cerr);
+        return -1;
+    }
+    catch (const SourcedException &e)
+    {
+        std::cerr << "FAILED: " << e.what() << " : " << e.where() << std::endl;
+        return -1;
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "FAILED: " << e.what() << " : " << std::endl;
+        return -1;
+    }
+
+    return 0;
+}
@@ -31,10 +31,12 @@ using namespace std::chrono;
 
 static const char optHelp = 'h';
 static const char optPath = 'p';
+static const char optHistograms = 'H';
 
 struct Settings
 {
     std::string basePath = Context::defaultAeronPath();
+    bool showHistograms = false;
 };
 
 Settings parseCmdLine(CommandOptionParser &cp, int argc, char **argv)
@@ -49,6 +51,7 @@ Settings parseCmdLine(CommandOptionParser &cp, int argc, char **argv)
     Settings s;
 
     s.basePath = cp.getOption(optPath).getParam(0, s.basePath);
+    s.showHistograms = cp.getOption(optHistograms).isPresent();
 
     return s;
 }
@@ -80,11 +83,24 @@ std::string formatDate(std::int64_t millisecondsSinceEpoch)
     return std::string(timeBuffer) + std::string(msecBuffer) + std::string(tzBuffer);
 }
 
+std::string formatHistogram(const std::int64_t *buckets)
+{
+    std::string result;
+
+    for (std::size_t i = 0; i < LossReportDescriptor::HISTOGRAM_BUCKETS; i++)
+    {
+        result += (0 == i ? "" : " ") + std::to_string(buckets[i]);
+    }
+
+    return result;
+}
+
 int main(int argc, char **argv)
 {
     CommandOptionParser cp;
     cp.addOption(CommandOption(optHelp,   0, 0, "              Displays help information."));
     cp.addOption(CommandOption(optPath,   1, 1, "basePath      Base Path to shared memory. Default: " + Context::defaultAeronPath()));
+    cp.addOption(CommandOption(optHistograms, 0, 0, "              Append repair counts and gap length and repair time histograms."));
 
     try
     {
@@ -108,28 +124,43 @@ int main(int argc, char **argv)
             "SESSION_ID, " <<
             "STREAM_ID, " <<
             "CHANNEL, " <<
-            "SOURCE" << std::endl;
+            "SOURCE";
+
+        if (settings.showHistograms)
+        {
+            std::cout <<
+                ", RETRANSMIT_REPAIRS, " <<
+                "UNSOLICITED_REPAIRS, " <<
+                "TIMEOUT_REPAIRS, " <<
+                "GAP_LENGTH_HISTOGRAM, " <<
+                "REPAIR_TIME_HISTOGRAM";
+        }
+
+        std::cout << std::endl;
 
-        const int entriesRead = LossReportReader::read(
+        const int entriesRead = LossReportReader::readEntries(
             buffer,
-            [](
-                std::int64_t observationCount,
-                std::int64_t totalBytesLost,
-                std::int64_t firstObservationTimestamp,
-                std::int64_t lastObservationTimestamp,
-                std::int32_t sessionId,
-                std::int32_t streamId,
-                const std::string &channel,
-                const std::string &source)
+            [&](const LossReportDescriptor::LossReportEntryDefn &entry, const std::string &channel, const std::string &source)
             {
-                std::cout << std::to_string(observationCount) << ",";
-                std::cout << std::to_string(totalBytesLost) << ",";
-                std::cout << formatDate(firstObservationTimestamp) << ",";
-                std::cout << formatDate(lastObservationTimestamp) << ",";
-                std::cout << std::to_string(sessionId) << ",";
-                std::cout << std::to_string(streamId) << ",";
+                std::cout << std::to_string(entry.observationCount) << ",";
+                std::cout << std::to_string(entry.totalBytesLost) << ",";
+                std::cout << formatDate(entry.firstObservationTimestamp) << ",";
+                std::cout << formatDate(entry.lastObservationTimestamp) << ",";
+                std::cout << std::to_string(entry.sessionId) << ",";
+                std::cout << std::to_string(entry.streamId) << ",";
                 std::cout << channel << ",";
-                std::cout << source << std::endl;
+                std::cout << source;
+
+                if (settings.showHistograms)
+                {
+                    std::cout << "," << std::to_string(entry.repairCounts[LossReportDescriptor::RETRANSMIT]);
+                    std::cout << "," << std::to_string(entry.repairCounts[LossReportDescriptor::UNSOLICITED]);
+                    std::cout << "," << std::to_string(entry.repairCounts[LossReportDescriptor::TIMEOUT]);
+                    std::cout << "," << formatHistogram(entry.gapLengthHistogram);
+                    std::cout << "," << formatHistogram(entry.repairTimeHistogram);
+                }
+
+                std::cout << std::endl;
             });
 
         std::cout << std::to_string(entriesRead) << " entries read" << std::endl;
@@ -0,0 +1,492 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <csignal>
+#include <thread>
+#include <cinttypes>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "util/CommandOptionParser.h"
+#include "concurrent/BusySpinIdleStrategy.h"
+#include "Configuration.h"
+#include "Aeron.h"
+
+using namespace std::chrono;
+using namespace aeron::util;
+using namespace aeron;
+
+std::atomic<bool> running(true);
+
+void sigIntHandler(int)
+{
+    running = false;
+}
+
+static const char optHelp           = 'h';
+static const char optPrefix         = 'p';
+static const char optChannel        = 'c';
+static const char optStreamId       = 's';
+static const char optStreams        = 'k';
+static const char optPublishers     = 'n';
+static const char optSubscribers    = 'N';
+static const char optDuration       = 'd';
+static const char optLength         = 'L';
+static const char optFrags          = 'f';
+static const char optAffinity       = 'a';
+
+/*
+ * Driver system counters, keyed by their system counter id, which show how busy the conductor, sender, and
+ * receiver duty cycles are.
+ */
+static const std::int32_t SYSTEM_COUNTER_TYPE_ID = 0;
+static const std::int32_t BYTES_SENT_COUNTER_ID = 0;
+static const std::int32_t BYTES_RECEIVED_COUNTER_ID = 1;
+static const std::int32_t CONDUCTOR_MAX_CYCLE_TIME_COUNTER_ID = 28;
+static const std::int32_t CONDUCTOR_CYCLE_TIME_THRESHOLD_EXCEEDED_COUNTER_ID = 29;
+static const std::int32_t SENDER_MAX_CYCLE_TIME_COUNTER_ID = 35;
+static const std::int32_t SENDER_CYCLE_TIME_THRESHOLD_EXCEEDED_COUNTER_ID = 36;
+static const std::int32_t RECEIVER_MAX_CYCLE_TIME_COUNTER_ID = 42;
+static const std::int32_t RECEIVER_CYCLE_TIME_THRESHOLD_EXCEEDED_COUNTER_ID = 43;
+
+struct Settings
+{
+    std::string dirPrefix = "";
+    std::string channel = samples::configuration::DEFAULT_CHANNEL;
+    std::int32_t streamId = samples::configuration::DEFAULT_STREAM_ID;
+    int numberOfStreams = 4;
+    int numberOfPublishers = 1;
+    int numberOfSubscribers = 1;
+    int durationSeconds = 10;
+    int messageLength = samples::configuration::DEFAULT_MESSAGE_LENGTH;
+    int fragmentCountLimit = samples::configuration::DEFAULT_FRAGMENT_COUNT_LIMIT;
+    std::vector<int> cpus;
+};
+
+/*
+ * Counts for a stream which are written by its publisher and subscriber threads and read by the reporting thread.
+ * The publisher and subscriber counts are padded apart so that the threads do not contend on the same cache line.
+ */
+struct StreamStats
+{
+    char paddingBefore[BitUtil::CACHE_LINE_LENGTH]{};
+    std::atomic<std::int64_t> messagesSent = { 0 };
+    std::atomic<std::int64_t> backPressureCount = { 0 };
+    char paddingBetween[BitUtil::CACHE_LINE_LENGTH]{};
+    std::atomic<std::int64_t> messagesReceived = { 0 };
+    std::atomic<std::int64_t> bytesReceived = { 0 };
+    char paddingAfter[BitUtil::CACHE_LINE_LENGTH]{};
+};
+
+Settings parseCmdLine(CommandOptionParser &cp, int argc, char **argv)
+{
+    cp.parse(argc, argv);
+    if (cp.getOption(optHelp).isPresent())
+    {
+        cp.displayOptionsHelp(std::cout);
+        exit(0);
+    }
+
+    Settings s;
+
+    s.dirPrefix = cp.getOption(optPrefix).getParam(0, s.dirPrefix);
+    s.channel = cp.getOption(optChannel).getParam(0, s.channel);
+    s.streamId = cp.getOption(optStreamId).getParamAsInt(0, 1, INT32_MAX, s.streamId);
+    s.numberOfStreams = cp.getOption(optStreams).getParamAsInt(0, 1, 1024, s.numberOfStreams);
+    s.numberOfPublishers = cp.getOption(optPublishers).getParamAsInt(0, 1, 1024, s.numberOfPublishers);
+    s.numberOfSubscribers = cp.getOption(optSubscribers).getParamAsInt(0, 1, 1024, s.numberOfSubscribers);
+    s.durationSeconds = cp.getOption(optDuration).getParamAsInt(0, 1, INT32_MAX, s.durationSeconds);
+    s.messageLength = cp.getOption(optLength).getParamAsInt(0, sizeof(std::int64_t), INT32_MAX, s.messageLength);
+    s.fragmentCountLimit = cp.getOption(optFrags).getParamAsInt(0, 1, INT32_MAX, s.fragmentCountLimit);
+
+    const CommandOption &affinityOption = cp.getOption(optAffinity);
+    for (std::size_t i = 0; affinityOption.isPresent() && i < affinityOption.getNumParams(); i++)
+    {
+        s.cpus.push_back(affinityOption.getParamAsInt(i, 0, INT32_MAX, 0));
+    }
+
+    return s;
+}
+
+/*
+ * Pin a thread to a cpu. Threads are numbered publishers first then subscribers and take the cpus given on the
+ * command line in that order. Threads beyond the number of cpus given are left unpinned.
+ */
+void pinThread(std::thread &thread, const Settings &settings, std::size_t threadIndex)
+{
+    if (threadIndex >= settings.cpus.size())
+    {
+        return;
+    }
+
+#if defined(__linux__)
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(settings.cpus[threadIndex], &cpuSet);
+
+    if (0 != pthread_setaffinity_np(thread.native_handle(), sizeof(cpuSet), &cpuSet))
+    {
+        std::cerr << "WARNING: could not pin thread " << threadIndex << " to cpu " << settings.cpus[threadIndex]
+                  << std::endl;
+    }
+#else
+    std::cerr << "WARNING: thread pinning is not supported on this platform" << std::endl;
+#endif
+}
+
+inline bool isRunning()
+{
+    return std::atomic_load_explicit(&running, std::memory_order_relaxed);
+}
+
+void publisherLoop(
+    const std::vector<std::shared_ptr<ExclusivePublication>> &publications,
+    const std::vector<std::size_t> &streamIndices,
+    StreamStats *stats,
+    const Settings &settings)
+{
+    BusySpinIdleStrategy idleStrategy;
+    BufferClaim bufferClaim;
+
+    while (isRunning())
+    {
+        int workCount = 0;
+
+        for (const std::size_t streamIndex : streamIndices)
+        {
+            StreamStats &streamStats = stats[streamIndex];
+
+            if (publications[streamIndex]->tryClaim(settings.messageLength, bufferClaim) > 0)
+            {
+                const std::int64_t sent = streamStats.messagesSent.load(std::memory_order_relaxed);
+
+                bufferClaim.buffer().putInt64(bufferClaim.offset(), sent);
+                bufferClaim.commit();
+
+                streamStats.messagesSent.store(sent + 1, std::memory_order_release);
+                workCount++;
+            }
+            else
+            {
+                streamStats.backPressureCount.store(
+                    streamStats.backPressureCount.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+            }
+        }
+
+        idleStrategy.idle(workCount);
+    }
+}
+
+void subscriberLoop(
+    const std::vector<std::shared_ptr<Subscription>> &subscriptions,
+    const std::vector<std::size_t> &streamIndices,
+    StreamStats *stats,
+    const Settings &settings)
+{
+    BusySpinIdleStrategy idleStrategy;
+    std::vector<fragment_handler_t> handlers;
+
+    for (const std::size_t streamIndex : streamIndices)
+    {
+        StreamStats &streamStats = stats[streamIndex];
+
+        handlers.emplace_back(
+            [&streamStats](AtomicBuffer &, util::index_t, util::index_t length, Header &)
+            {
+                streamStats.messagesReceived.store(
+                    streamStats.messagesReceived.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+                streamStats.bytesReceived.store(
+                    streamStats.bytesReceived.load(std::memory_order_relaxed) + length, std::memory_order_release);
+            });
+    }
+
+    while (isRunning())
+    {
+        int workCount = 0;
+
+        for (std::size_t i = 0; i < streamIndices.size(); i++)
+        {
+            workCount += subscriptions[streamIndices[i]]->poll(handlers[i], settings.fragmentCountLimit);
+        }
+
+        idleStrategy.idle(workCount);
+    }
+}
+
+/*
+ * Find the counter ids of the driver system counters in the CnC file by their system counter id.
+ */
+std::vector<std::int32_t> findSystemCounters(CountersReader &countersReader, const std::vector<std::int32_t> &keys)
+{
+    std::vector<std::int32_t> counterIds(keys.size(), std::int32_t{ CountersReader::NULL_COUNTER_ID });
+
+    countersReader.forEach(
+        [&](std::int32_t id, std::int32_t typeId, const AtomicBuffer &keyBuffer, const std::string &label)
+        {
+            if (SYSTEM_COUNTER_TYPE_ID == typeId)
+            {
+                const std::int32_t systemCounterId = keyBuffer.getInt32(0);
+
+                for (std::size_t i = 0; i < keys.size(); i++)
+                {
+                    if (keys[i] == systemCounterId)
+                    {
+                        counterIds[i] = id;
+                    }
+                }
+            }
+        });
+
+    return counterIds;
+}
+
+int main(int argc, char **argv)
+{
+    CommandOptionParser cp;
+    cp.addOption(CommandOption(optHelp,        0, 0,   "                Displays help information."));
+    cp.addOption(CommandOption(optPrefix,      1, 1,   "dir             Prefix directory for aeron driver."));
+    cp.addOption(CommandOption(optChannel,     1, 1,   "channel         Channel."));
+    cp.addOption(CommandOption(optStreamId,    1, 1,   "streamId        First Stream ID."));
+    cp.addOption(CommandOption(optStreams,     1, 1,   "number          Number of Streams."));
+    cp.addOption(CommandOption(optPublishers,  1, 1,   "number          Number of publisher threads."));
+    cp.addOption(CommandOption(optSubscribers, 1, 1,   "number          Number of subscriber threads."));
+    cp.addOption(CommandOption(optDuration,    1, 1,   "seconds         Duration of the run."));
+    cp.addOption(CommandOption(optLength,      1, 1,   "length          Length of Messages."));
+    cp.addOption(CommandOption(optFrags,       1, 1,   "limit           Fragment Count Limit."));
+    cp.addOption(CommandOption(optAffinity,    1, 256, "cpu...          Cpus for publisher then subscriber threads."));
+
+    signal(SIGINT, sigIntHandler);
+
+    try
+    {
+        Settings settings = parseCmdLine(cp, argc, argv);
+        const auto streamCount = static_cast<std::size_t>(settings.numberOfStreams);
+
+        std::cout << "Streaming " << settings.messageLength << " byte messages on " << settings.channel
+                  << " over " << streamCount << " streams from Stream ID " << settings.streamId << " with "
+                  << settings.numberOfPublishers << " publisher and " << settings.numberOfSubscribers
+                  << " subscriber threads for " << settings.durationSeconds << " seconds" << std::endl;
+
+        aeron::Context context;
+
+        if (!settings.dirPrefix.empty())
+        {
+            context.aeronDir(settings.dirPrefix);
+        }
+
+        Aeron aeron(context);
+
+        std::vector<std::shared_ptr<ExclusivePublication>> publications;
+        std::vector<std::shared_ptr<Subscription>> subscriptions;
+        std::unique_ptr<StreamStats[]> stats(new StreamStats[streamCount]);
+
+        for (std::size_t i = 0; i < streamCount; i++)
+        {
+            const std::int32_t streamId = settings.streamId + static_cast<std::int32_t>(i);
+            const std::int64_t subscriptionId = aeron.addSubscription(settings.channel, streamId);
+            const std::int64_t publicationId = aeron.addExclusivePublication(settings.channel, streamId);
+
+            std::shared_ptr<Subscription> subscription = aeron.findSubscription(subscriptionId);
+            while (!subscription)
+            {
+                std::this_thread::yield();
+                subscription = aeron.findSubscription(subscriptionId);
+            }
+
+            std::shared_ptr<ExclusivePublication> publication = aeron.findExclusivePublication(publicationId);
+            while (!publication)
+            {
+                std::this_thread::yield();
+                publication = aeron.findExclusivePublication(publicationId);
+            }
+
+            subscriptions.push_back(subscription);
+            publications.push_back(publication);
+        }
+
+        for (std::size_t i = 0; i < streamCount; i++)
+        {
+            while (!subscriptions[i]->isConnected() && isRunning())
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        const std::vector<std::int32_t> systemCounterIds = findSystemCounters(
+            aeron.countersReader(),
+            {
+                BYTES_SENT_COUNTER_ID,
+                BYTES_RECEIVED_COUNTER_ID,
+                CONDUCTOR_MAX_CYCLE_TIME_COUNTER_ID,
+                CONDUCTOR_CYCLE_TIME_THRESHOLD_EXCEEDED_COUNTER_ID,
+                SENDER_MAX_CYCLE_TIME_COUNTER_ID,
+                SENDER_CYCLE_TIME_THRESHOLD_EXCEEDED_COUNTER_ID,
+                RECEIVER_MAX_CYCLE_TIME_COUNTER_ID,
+                RECEIVER_CYCLE_TIME_THRESHOLD_EXCEEDED_COUNTER_ID
+            });
+
+        auto readSystemCounters =
+            [&]()
+            {
+                std::vector<std::int64_t> values;
+
+                for (const std::int32_t counterId : systemCounterIds)
+                {
+                    values.push_back(CountersReader::NULL_COUNTER_ID == counterId ?
+                        0 : aeron.countersReader().getCounterValue(counterId));
+                }
+
+                return values;
+            };
+
+        std::vector<std::thread> threads;
+        std::vector<std::vector<std::size_t>> publisherStreams(static_cast<std::size_t>(settings.numberOfPublishers));
+        std::vector<std::vector<std::size_t>> subscriberStreams(static_cast<std::size_t>(settings.numberOfSubscribers));
+
+        for (std::size_t i = 0; i < streamCount; i++)
+        {
+            publisherStreams[i % publisherStreams.size()].push_back(i);
+            subscriberStreams[i % subscriberStreams.size()].push_back(i);
+        }
+
+        for (const std::vector<std::size_t> &streamIndices : publisherStreams)
+        {
+            threads.emplace_back(
+                [&]()
+                {
+                    publisherLoop(publications, streamIndices, stats.get(), settings);
+                });
+            pinThread(threads.back(), settings, threads.size() - 1);
+        }
+
+        for (const std::vector<std::size_t> &streamIndices : subscriberStreams)
+        {
+            threads.emplace_back(
+                [&]()
+                {
+                    subscriberLoop(subscriptions, streamIndices, stats.get(), settings);
+                });
+            pinThread(threads.back(), settings, threads.size() - 1);
+        }
+
+        std::vector<std::int64_t> lastReceived(streamCount, 0);
+        std::vector<std::int64_t> lastCounters = readSystemCounters();
+        const std::vector<std::int64_t> initialCounters = lastCounters;
+        steady_clock::time_point start = steady_clock::now();
+        steady_clock::time_point lastReport = start;
+
+        for (int second = 0; second < settings.durationSeconds && isRunning(); second++)
+        {
+            std::this_thread::sleep_for(seconds(1));
+
+            const steady_clock::time_point now = steady_clock::now();
+            const double intervalSec = duration<double>(now - lastReport).count();
+            const std::vector<std::int64_t> counters = readSystemCounters();
+            std::int64_t intervalMessages = 0;
+
+            for (std::size_t i = 0; i < streamCount; i++)
+            {
+                const std::int64_t received = stats[i].messagesReceived.load(std::memory_order_acquire);
+                const std::int64_t messages = received - lastReceived[i];
+
+                std::printf("  stream %d: %.04g msgs/sec, back pressure total %" PRId64 "\n",
+                    settings.streamId + static_cast<std::int32_t>(i),
+                    static_cast<double>(messages) / intervalSec,
+                    stats[i].backPressureCount.load(std::memory_order_acquire));
+
+                intervalMessages += messages;
+                lastReceived[i] = received;
+            }
+
+            std::printf(
+                "total: %.04g msgs/sec, %.04g payload bytes/sec, driver %.04g bytes sent/sec, "
+                "%.04g bytes received/sec\n",
+                static_cast<double>(intervalMessages) / intervalSec,
+                static_cast<double>(intervalMessages * settings.messageLength) / intervalSec,
+                static_cast<double>(counters[0] - lastCounters[0]) / intervalSec,
+                static_cast<double>(counters[1] - lastCounters[1]) / intervalSec);
+            std::printf(
+                "duty cycle: conductor max %" PRId64 "ns exceeded %" PRId64
+                ", sender max %" PRId64 "ns exceeded %" PRId64
+                ", receiver max %" PRId64 "ns exceeded %" PRId64 "\n",
+                counters[2], counters[3] - lastCounters[3],
+                counters[4], counters[5] - lastCounters[5],
+                counters[6], counters[7] - lastCounters[7]);
+
+            lastCounters = counters;
+            lastReport = now;
+        }
+
+        running = false;
+
+        for (std::thread &thread : threads)
+        {
+            thread.join();
+        }
+
+        const double runSec = duration<double>(steady_clock::now() - start).count();
+        std::int64_t totalMessages = 0;
+        std::int64_t totalBytes = 0;
+
+        std::cout << "Summary over " << runSec << " seconds" << std::endl;
+        for (std::size_t i = 0; i < streamCount; i++)
+        {
+            const std::int64_t received = stats[i].messagesReceived.load(std::memory_order_acquire);
+            const std::int64_t sent = stats[i].messagesSent.load(std::memory_order_acquire);
+            const std::int64_t backPressure = stats[i].backPressureCount.load(std::memory_order_acquire);
+
+            std::printf("  stream %d: %.04g msgs/sec, back pressure ratio %.04g\n",
+                settings.streamId + static_cast<std::int32_t>(i),
+                static_cast<double>(received) / runSec,
+                0 == sent ? 0.0 : static_cast<double>(backPressure) / static_cast<double>(sent));
+
+            totalMessages += received;
+            totalBytes += stats[i].bytesReceived.load(std::memory_order_acquire);
+        }
+
+        const std::vector<std::int64_t> finalCounters = readSystemCounters();
+        std::printf("total: %.04g msgs/sec, %.04g payload bytes/sec\n",
+            static_cast<double>(totalMessages) / runSec, static_cast<double>(totalBytes) / runSec);
+        std::printf(
+            "duty cycle thresholds exceeded: conductor %" PRId64 ", sender %" PRId64 ", receiver %" PRId64 "\n",
+            finalCounters[3] - initialCounters[3],
+            finalCounters[5] - initialCounters[5],
+            finalCounters[7] - initialCounters[7]);
+    }
+    catch (const CommandOptionException &e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl << std::endl;
+        cp.displayOptionsHelp(std::cerr);
+        return -1;
+    }
+    catch (const SourcedException &e)
+    {
+        std::cerr << "FAILED: " << e.what() << " : " << e.where() << std::endl;
+        return -1;
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "FAILED: " << e.what() << " : " << std::endl;
+        return -1;
+    }
+
+    return 0;
+}
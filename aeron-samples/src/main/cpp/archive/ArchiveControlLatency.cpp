@@ -0,0 +1,198 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <csignal>
+#include <atomic>
+#include <thread>
+
+extern "C"
+{
+#include <hdr_histogram.h>
+}
+
+#include "util/CommandOptionParser.h"
+#include "concurrent/BusySpinIdleStrategy.h"
+#include "Configuration.h"
+#include "Aeron.h"
+#include "client/AeronArchive.h"
+#include "client/RecordingPos.h"
+
+using namespace std::chrono;
+using namespace aeron::util;
+using namespace aeron;
+using namespace aeron::archive::client;
+
+std::atomic<bool> running(true);
+
+void sigIntHandler(int)
+{
+    running = false;
+}
+
+static const char optHelp           = 'h';
+static const char optPrefix         = 'p';
+static const char optChannel        = 'c';
+static const char optStreamId       = 's';
+static const char optRequests       = 'm';
+static const char optWarmupRequests = 'w';
+
+static const std::int64_t HISTOGRAM_HIGHEST_TRACKABLE_VALUE_NS = 10 * 1000 * 1000 * 1000LL;
+
+struct Settings
+{
+    std::string dirPrefix = "";
+    std::string channel = IPC_CHANNEL;
+    std::int32_t streamId = samples::configuration::DEFAULT_STREAM_ID;
+    long long numberOfRequests = 100000;
+    long long numberOfWarmupRequests = 10000;
+};
+
+Settings parseCmdLine(CommandOptionParser &cp, int argc, char **argv)
+{
+    cp.parse(argc, argv);
+    if (cp.getOption(optHelp).isPresent())
+    {
+        cp.displayOptionsHelp(std::cout);
+        exit(0);
+    }
+
+    Settings s;
+
+    s.dirPrefix = cp.getOption(optPrefix).getParam(0, s.dirPrefix);
+    s.channel = cp.getOption(optChannel).getParam(0, s.channel);
+    s.streamId = cp.getOption(optStreamId).getParamAsInt(0, 1, INT32_MAX, s.streamId);
+    s.numberOfRequests = cp.getOption(optRequests).getParamAsLong(0, 1, INT64_MAX, s.numberOfRequests);
+    s.numberOfWarmupRequests = cp.getOption(optWarmupRequests).getParamAsLong(
+        0, 0, INT64_MAX, s.numberOfWarmupRequests);
+
+    return s;
+}
+
+/*
+ * Each request is a recording position query for an active recording, which the archive answers from its conductor
+ * without touching the recording files, so the round trip is dominated by the control request and response path.
+ */
+void sendRequests(AeronArchive &archive, std::int64_t recordingId, long long count, hdr_histogram *histogram)
+{
+    for (long long i = 0; i < count && running; i++)
+    {
+        const steady_clock::time_point start = steady_clock::now();
+
+        archive.getRecordingPosition<aeron::concurrent::BusySpinIdleStrategy>(recordingId);
+
+        if (nullptr != histogram)
+        {
+            hdr_record_value(histogram, duration<std::int64_t, std::nano>(steady_clock::now() - start).count());
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    CommandOptionParser cp;
+    cp.addOption(CommandOption(optHelp,           0, 0, "                Displays help information."));
+    cp.addOption(CommandOption(optPrefix,         1, 1, "dir             Prefix directory for aeron driver."));
+    cp.addOption(CommandOption(optChannel,        1, 1, "channel         Channel to record for the queries."));
+    cp.addOption(CommandOption(optStreamId,       1, 1, "streamId        Stream ID to record for the queries."));
+    cp.addOption(CommandOption(optRequests,       1, 1, "number          Number of control requests."));
+    cp.addOption(CommandOption(optWarmupRequests, 1, 1, "number          Number of control requests for warmup."));
+
+    signal(SIGINT, sigIntHandler);
+
+    try
+    {
+        Settings settings = parseCmdLine(cp, argc, argv);
+
+        AeronArchive::Context_t context;
+        if (!settings.dirPrefix.empty())
+        {
+            context.aeronDirectoryName(settings.dirPrefix);
+        }
+
+        std::shared_ptr<AeronArchive> archive = AeronArchive::connect(context);
+        CountersReader &countersReader = archive->context().aeron()->countersReader();
+
+        std::cout << "Control request channel " << archive->context().controlRequestChannel()
+                  << " on Stream ID " << archive->context().controlRequestStreamId() << std::endl;
+
+        std::shared_ptr<Publication> publication = archive->addRecordedPublication(
+            settings.channel, settings.streamId);
+
+        std::int32_t counterId;
+        while (CountersReader::NULL_COUNTER_ID ==
+            (counterId = RecordingPos::findCounterIdBySessionId(countersReader, publication->sessionId())))
+        {
+            std::this_thread::yield();
+        }
+
+        const std::int64_t recordingId = RecordingPos::getRecordingId(countersReader, counterId);
+
+        if (settings.numberOfWarmupRequests > 0)
+        {
+            const steady_clock::time_point start = steady_clock::now();
+
+            std::cout << "Warming up the archive with "
+                      << toStringWithCommas(settings.numberOfWarmupRequests) << " requests" << std::endl;
+
+            sendRequests(*archive, recordingId, settings.numberOfWarmupRequests, nullptr);
+
+            std::int64_t nanoDuration = duration<std::int64_t, std::nano>(steady_clock::now() - start).count();
+
+            std::cout << "Warmed up the archive in " << nanoDuration << " [ns]" << std::endl;
+        }
+
+        hdr_histogram *histogram;
+        hdr_init(1, HISTOGRAM_HIGHEST_TRACKABLE_VALUE_NS, 3, &histogram);
+
+        do
+        {
+            hdr_reset(histogram);
+
+            std::cout << "Sending " << toStringWithCommas(settings.numberOfRequests)
+                      << " recording position requests" << std::endl;
+
+            sendRequests(*archive, recordingId, settings.numberOfRequests, histogram);
+
+            std::cout << "Control request round trip [us]:" << std::endl;
+            hdr_percentiles_print(histogram, stdout, 5, 1000.0, CLASSIC);
+            fflush(stdout);
+        }
+        while (running && continuationBarrier("Execute again?"));
+
+        archive->stopRecording(publication);
+        hdr_close(histogram);
+    }
+    catch (const CommandOptionException &e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl << std::endl;
+        cp.displayOptionsHelp(std::cerr);
+        return -1;
+    }
+    catch (const SourcedException &e)
+    {
+        std::cerr << "FAILED: " << e.what() << " : " << e.where() << std::endl;
+        return -1;
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "FAILED: " << e.what() << " : " << std::endl;
+        return -1;
+    }
+
+    return 0;
+}
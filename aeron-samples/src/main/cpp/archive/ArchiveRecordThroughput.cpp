@@ -0,0 +1,262 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <csignal>
+#include <atomic>
+#include <deque>
+#include <thread>
+
+extern "C"
+{
+#include <hdr_histogram.h>
+}
+
+#include "util/CommandOptionParser.h"
+#include "Configuration.h"
+#include "Aeron.h"
+#include "client/AeronArchive.h"
+#include "client/RecordingPos.h"
+
+using namespace std::chrono;
+using namespace aeron::util;
+using namespace aeron;
+using namespace aeron::archive::client;
+
+std::atomic<bool> running(true);
+
+void sigIntHandler(int)
+{
+    running = false;
+}
+
+static const char optHelp     = 'h';
+static const char optPrefix   = 'p';
+static const char optChannel  = 'c';
+static const char optStreamId = 's';
+static const char optMessages = 'm';
+static const char optLength   = 'L';
+static const char optRate     = 'r';
+
+static const long long DEFAULT_MESSAGE_RATE = 100000;
+static const std::int64_t HISTOGRAM_HIGHEST_TRACKABLE_VALUE_NS = 10 * 1000 * 1000 * 1000LL;
+
+struct Settings
+{
+    std::string dirPrefix = "";
+    std::string channel = IPC_CHANNEL;
+    std::int32_t streamId = samples::configuration::DEFAULT_STREAM_ID;
+    long long numberOfMessages = 1000000;
+    int messageLength = samples::configuration::DEFAULT_MESSAGE_LENGTH;
+    long long messageRate = DEFAULT_MESSAGE_RATE;
+};
+
+struct PendingMessage
+{
+    std::int64_t position;
+    std::int64_t intendedNs;
+};
+
+inline std::int64_t nanoTime()
+{
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+Settings parseCmdLine(CommandOptionParser &cp, int argc, char **argv)
+{
+    cp.parse(argc, argv);
+    if (cp.getOption(optHelp).isPresent())
+    {
+        cp.displayOptionsHelp(std::cout);
+        exit(0);
+    }
+
+    Settings s;
+
+    s.dirPrefix = cp.getOption(optPrefix).getParam(0, s.dirPrefix);
+    s.channel = cp.getOption(optChannel).getParam(0, s.channel);
+    s.streamId = cp.getOption(optStreamId).getParamAsInt(0, 1, INT32_MAX, s.streamId);
+    s.numberOfMessages = cp.getOption(optMessages).getParamAsLong(0, 1, INT64_MAX, s.numberOfMessages);
+    s.messageLength = cp.getOption(optLength).getParamAsInt(0, sizeof(std::int64_t), INT32_MAX, s.messageLength);
+    s.messageRate = cp.getOption(optRate).getParamAsLong(0, 1, 1000 * 1000 * 1000LL, s.messageRate);
+
+    return s;
+}
+
+/*
+ * Record the time from when each message was due to be sent, according to the fixed rate schedule, until the
+ * recording position counter shows the archive has written it. Measuring from the intended time means back pressure
+ * from a recording that cannot keep up is reflected in the latencies rather than hidden by a slower send rate.
+ */
+int drainRecorded(
+    CountersReader &countersReader,
+    std::int32_t counterId,
+    std::deque<PendingMessage> &pending,
+    hdr_histogram *histogram)
+{
+    const std::int64_t recordedPosition = countersReader.getCounterValue(counterId);
+    const std::int64_t nowNs = nanoTime();
+    int count = 0;
+
+    while (!pending.empty() && pending.front().position <= recordedPosition)
+    {
+        hdr_record_value(histogram, nowNs - pending.front().intendedNs);
+        pending.pop_front();
+        count++;
+    }
+
+    return count;
+}
+
+void publishAtFixedRateAndAwaitRecording(
+    ExclusivePublication &publication,
+    CountersReader &countersReader,
+    std::int32_t counterId,
+    hdr_histogram *histogram,
+    const Settings &settings)
+{
+    std::unique_ptr<std::uint8_t[]> buffer(new std::uint8_t[settings.messageLength]);
+    concurrent::AtomicBuffer srcBuffer(buffer.get(), static_cast<size_t>(settings.messageLength));
+    std::deque<PendingMessage> pending;
+
+    const std::int64_t intervalNs = 1000 * 1000 * 1000LL / settings.messageRate;
+    std::int64_t intendedNs = nanoTime();
+
+    for (long long i = 0; i < settings.numberOfMessages && running; i++)
+    {
+        while (nanoTime() < intendedNs)
+        {
+            drainRecorded(countersReader, counterId, pending, histogram);
+        }
+
+        srcBuffer.putInt64(0, i);
+
+        std::int64_t position;
+        while ((position = publication.offer(srcBuffer, 0, settings.messageLength)) < 0)
+        {
+            if (PUBLICATION_CLOSED == position || MAX_POSITION_EXCEEDED == position)
+            {
+                throw std::runtime_error("publication can no longer be offered to: " + std::to_string(position));
+            }
+
+            drainRecorded(countersReader, counterId, pending, histogram);
+        }
+
+        pending.push_back({ position, intendedNs });
+        intendedNs += intervalNs;
+    }
+
+    while (!pending.empty() && running)
+    {
+        if (0 == drainRecorded(countersReader, counterId, pending, histogram))
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    CommandOptionParser cp;
+    cp.addOption(CommandOption(optHelp,     0, 0, "                Displays help information."));
+    cp.addOption(CommandOption(optPrefix,   1, 1, "dir             Prefix directory for aeron driver."));
+    cp.addOption(CommandOption(optChannel,  1, 1, "channel         Channel to publish and record."));
+    cp.addOption(CommandOption(optStreamId, 1, 1, "streamId        Stream ID."));
+    cp.addOption(CommandOption(optMessages, 1, 1, "number          Number of Messages."));
+    cp.addOption(CommandOption(optLength,   1, 1, "length          Length of Messages."));
+    cp.addOption(CommandOption(optRate,     1, 1, "rate            Target message rate per second."));
+
+    signal(SIGINT, sigIntHandler);
+
+    try
+    {
+        Settings settings = parseCmdLine(cp, argc, argv);
+
+        std::cout << "Recording " << settings.channel << " on Stream ID " << settings.streamId << std::endl;
+
+        AeronArchive::Context_t context;
+        if (!settings.dirPrefix.empty())
+        {
+            context.aeronDirectoryName(settings.dirPrefix);
+        }
+
+        std::shared_ptr<AeronArchive> archive = AeronArchive::connect(context);
+        CountersReader &countersReader = archive->context().aeron()->countersReader();
+
+        std::shared_ptr<ExclusivePublication> publication = archive->addRecordedExclusivePublication(
+            settings.channel, settings.streamId);
+
+        std::int32_t counterId;
+        while (CountersReader::NULL_COUNTER_ID ==
+            (counterId = RecordingPos::findCounterIdBySessionId(countersReader, publication->sessionId())))
+        {
+            std::this_thread::yield();
+        }
+
+        std::cout << "Recording id " << RecordingPos::getRecordingId(countersReader, counterId) << std::endl;
+
+        hdr_histogram *histogram;
+        hdr_init(1, HISTOGRAM_HIGHEST_TRACKABLE_VALUE_NS, 3, &histogram);
+
+        do
+        {
+            hdr_reset(histogram);
+
+            std::cout << "Publishing "
+                      << toStringWithCommas(settings.numberOfMessages) << " messages of length "
+                      << toStringWithCommas(settings.messageLength) << " bytes at "
+                      << toStringWithCommas(settings.messageRate) << " msgs/sec" << std::endl;
+
+            const std::int64_t startPosition = countersReader.getCounterValue(counterId);
+            const steady_clock::time_point start = steady_clock::now();
+
+            publishAtFixedRateAndAwaitRecording(*publication, countersReader, counterId, histogram, settings);
+
+            const double durationSeconds = duration<double>(steady_clock::now() - start).count();
+            const std::int64_t recordedBytes = countersReader.getCounterValue(counterId) - startPosition;
+
+            std::cout << "Recorded " << toStringWithCommas(recordedBytes) << " bytes in " << durationSeconds
+                      << "s, " << (recordedBytes / durationSeconds) / (1024 * 1024) << " MB/sec, "
+                      << histogram->total_count / durationSeconds << " msgs/sec" << std::endl;
+            std::cout << "Time from intended send to recorded [us]:" << std::endl;
+            hdr_percentiles_print(histogram, stdout, 5, 1000.0, CLASSIC);
+            fflush(stdout);
+        }
+        while (running && continuationBarrier("Execute again?"));
+
+        archive->stopRecording(publication);
+        hdr_close(histogram);
+    }
+    catch (const CommandOptionException &e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl << std::endl;
+        cp.displayOptionsHelp(std::cerr);
+        return -1;
+    }
+    catch (const SourcedException &e)
+    {
+        std::cerr << "FAILED: " << e.what() << " : " << e.where() << std::endl;
+        return -1;
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "FAILED: " << e.what() << " : " << std::endl;
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,330 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <csignal>
+#include <atomic>
+#include <thread>
+
+extern "C"
+{
+#include <hdr_histogram.h>
+}
+
+#include "util/CommandOptionParser.h"
+#include "concurrent/YieldingIdleStrategy.h"
+#include "ChannelUriStringBuilder.h"
+#include "Configuration.h"
+#include "Aeron.h"
+#include "client/AeronArchive.h"
+#include "client/ReplayMerge.h"
+#include "client/RecordingPos.h"
+
+using namespace std::chrono;
+using namespace aeron::util;
+using namespace aeron;
+using namespace aeron::archive::client;
+
+std::atomic<bool> running(true);
+
+void sigIntHandler(int)
+{
+    running = false;
+}
+
+static const char optHelp            = 'h';
+static const char optPrefix          = 'p';
+static const char optStreamId        = 's';
+static const char optLength          = 'L';
+static const char optRate            = 'r';
+static const char optBacklogMs       = 'b';
+static const char optIterations      = 'i';
+static const char optFrags           = 'f';
+static const char optControlEndpoint = 'e';
+
+static const long long DEFAULT_MESSAGE_RATE = 100000;
+static const std::int64_t HISTOGRAM_HIGHEST_TRACKABLE_VALUE_NS = 60 * 1000 * 1000 * 1000LL;
+
+static const std::string RECORDING_ENDPOINT = "localhost:20126";
+static const std::string LIVE_ENDPOINT = "localhost:20127";
+static const std::string REPLAY_ENDPOINT = "localhost:20128";
+
+struct Settings
+{
+    std::string dirPrefix = "";
+    std::int32_t streamId = samples::configuration::DEFAULT_STREAM_ID;
+    int messageLength = samples::configuration::DEFAULT_MESSAGE_LENGTH;
+    long long messageRate = DEFAULT_MESSAGE_RATE;
+    long long backlogMs = 1000;
+    long long iterations = 10;
+    int fragmentCountLimit = samples::configuration::DEFAULT_FRAGMENT_COUNT_LIMIT;
+    std::string controlEndpoint = "localhost:20125";
+};
+
+inline std::int64_t nanoTime()
+{
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+Settings parseCmdLine(CommandOptionParser &cp, int argc, char **argv)
+{
+    cp.parse(argc, argv);
+    if (cp.getOption(optHelp).isPresent())
+    {
+        cp.displayOptionsHelp(std::cout);
+        exit(0);
+    }
+
+    Settings s;
+
+    s.dirPrefix = cp.getOption(optPrefix).getParam(0, s.dirPrefix);
+    s.streamId = cp.getOption(optStreamId).getParamAsInt(0, 1, INT32_MAX, s.streamId);
+    s.messageLength = cp.getOption(optLength).getParamAsInt(0, 1, INT32_MAX, s.messageLength);
+    s.messageRate = cp.getOption(optRate).getParamAsLong(0, 1, 1000 * 1000 * 1000LL, s.messageRate);
+    s.backlogMs = cp.getOption(optBacklogMs).getParamAsLong(0, 0, INT64_MAX, s.backlogMs);
+    s.iterations = cp.getOption(optIterations).getParamAsLong(0, 1, INT64_MAX, s.iterations);
+    s.fragmentCountLimit = cp.getOption(optFrags).getParamAsInt(0, 1, INT32_MAX, s.fragmentCountLimit);
+    s.controlEndpoint = cp.getOption(optControlEndpoint).getParam(0, s.controlEndpoint);
+
+    return s;
+}
+
+void publishAtFixedRate(Publication &publication, const std::atomic<bool> &publishing, const Settings &settings)
+{
+    std::unique_ptr<std::uint8_t[]> buffer(new std::uint8_t[settings.messageLength]);
+    concurrent::AtomicBuffer srcBuffer(buffer.get(), static_cast<size_t>(settings.messageLength));
+    srcBuffer.setMemory(0, settings.messageLength, 0);
+
+    const std::int64_t intervalNs = 1000 * 1000 * 1000LL / settings.messageRate;
+    std::int64_t intendedNs = nanoTime();
+
+    while (publishing)
+    {
+        if (nanoTime() < intendedNs)
+        {
+            continue;
+        }
+
+        if (publication.offer(srcBuffer, 0, settings.messageLength) > 0)
+        {
+            intendedNs += intervalNs;
+        }
+    }
+}
+
+/*
+ * Replay from the given position while the live stream keeps advancing at the configured rate, and return the time
+ * taken until the replay has caught up and been merged with the live stream, or -1 if the merge failed.
+ */
+std::int64_t replayMergeFrom(
+    std::shared_ptr<AeronArchive> archive,
+    std::int32_t sessionId,
+    std::int64_t recordingId,
+    std::int64_t startPosition,
+    const Settings &settings)
+{
+    ChannelUriStringBuilder subscriptionChannel, liveDestination, replayDestination, replayChannel;
+
+    subscriptionChannel
+        .media(UDP_MEDIA)
+        .controlMode(MDC_CONTROL_MODE_MANUAL)
+        .sessionId(sessionId);
+
+    liveDestination
+        .media(UDP_MEDIA)
+        .endpoint(LIVE_ENDPOINT)
+        .controlEndpoint(settings.controlEndpoint);
+
+    replayDestination
+        .media(UDP_MEDIA)
+        .endpoint(REPLAY_ENDPOINT);
+
+    replayChannel
+        .media(UDP_MEDIA)
+        .isSessionIdTagged(true)
+        .sessionId(2)
+        .endpoint(REPLAY_ENDPOINT);
+
+    Aeron &aeron = *archive->context().aeron();
+    const std::int64_t subscriptionId = aeron.addSubscription(subscriptionChannel.build(), settings.streamId);
+    std::shared_ptr<Subscription> subscription = aeron.findSubscription(subscriptionId);
+    while (!subscription)
+    {
+        std::this_thread::yield();
+        subscription = aeron.findSubscription(subscriptionId);
+    }
+
+    const steady_clock::time_point start = steady_clock::now();
+    ReplayMerge replayMerge(
+        subscription,
+        archive,
+        replayChannel.build(),
+        replayDestination.build(),
+        liveDestination.build(),
+        recordingId,
+        startPosition);
+
+    fragment_handler_t handler = [](AtomicBuffer &, index_t, index_t, Header &) {};
+    aeron::concurrent::YieldingIdleStrategy idleStrategy;
+
+    while (!replayMerge.isMerged() && running)
+    {
+        const int fragments = replayMerge.poll(handler, settings.fragmentCountLimit);
+        if (0 == fragments && replayMerge.hasFailed())
+        {
+            return -1;
+        }
+
+        idleStrategy.idle(fragments);
+    }
+
+    return duration<std::int64_t, std::nano>(steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    CommandOptionParser cp;
+    cp.addOption(CommandOption(optHelp,            0, 0, "                Displays help information."));
+    cp.addOption(CommandOption(optPrefix,          1, 1, "dir             Prefix directory for aeron driver."));
+    cp.addOption(CommandOption(optStreamId,        1, 1, "streamId        Stream ID."));
+    cp.addOption(CommandOption(optLength,          1, 1, "length          Length of Messages."));
+    cp.addOption(CommandOption(optRate,            1, 1, "rate            Live message rate per second."));
+    cp.addOption(CommandOption(optBacklogMs,       1, 1, "ms              Time the replay starts behind live."));
+    cp.addOption(CommandOption(optIterations,      1, 1, "number          Number of merges per run."));
+    cp.addOption(CommandOption(optFrags,           1, 1, "limit           Fragment Count Limit."));
+    cp.addOption(CommandOption(optControlEndpoint, 1, 1, "endpoint        Control endpoint of the live stream."));
+
+    signal(SIGINT, sigIntHandler);
+
+    try
+    {
+        Settings settings = parseCmdLine(cp, argc, argv);
+
+        AeronArchive::Context_t context;
+        if (!settings.dirPrefix.empty())
+        {
+            context.aeronDirectoryName(settings.dirPrefix);
+        }
+
+        std::shared_ptr<AeronArchive> archive = AeronArchive::connect(context);
+        Aeron &aeron = *archive->context().aeron();
+        CountersReader &countersReader = aeron.countersReader();
+
+        ChannelUriStringBuilder publicationChannel, recordingChannel;
+
+        publicationChannel
+            .media(UDP_MEDIA)
+            .tags("1,2")
+            .controlEndpoint(settings.controlEndpoint)
+            .controlMode(MDC_CONTROL_MODE_DYNAMIC)
+            .flowControl("tagged,g:99901/1,t:5s");
+
+        const std::int64_t publicationId = aeron.addPublication(publicationChannel.build(), settings.streamId);
+        std::shared_ptr<Publication> publication = aeron.findPublication(publicationId);
+        while (!publication)
+        {
+            std::this_thread::yield();
+            publication = aeron.findPublication(publicationId);
+        }
+
+        const std::int32_t sessionId = publication->sessionId();
+
+        recordingChannel
+            .media(UDP_MEDIA)
+            .groupTag(99901)
+            .endpoint(RECORDING_ENDPOINT)
+            .controlEndpoint(settings.controlEndpoint)
+            .sessionId(sessionId);
+
+        const std::int64_t recordingSubscriptionId = archive->startRecording(
+            recordingChannel.build(), settings.streamId, AeronArchive::SourceLocation::REMOTE);
+
+        std::int32_t counterId;
+        while (CountersReader::NULL_COUNTER_ID ==
+            (counterId = RecordingPos::findCounterIdBySessionId(countersReader, sessionId)))
+        {
+            std::this_thread::yield();
+        }
+
+        const std::int64_t recordingId = RecordingPos::getRecordingId(countersReader, counterId);
+
+        std::atomic<bool> publishing(true);
+        std::thread publisherThread([&]() { publishAtFixedRate(*publication, publishing, settings); });
+
+        hdr_histogram *histogram;
+        hdr_init(1, HISTOGRAM_HIGHEST_TRACKABLE_VALUE_NS, 3, &histogram);
+
+        do
+        {
+            hdr_reset(histogram);
+
+            std::cout << "Merging replay of recording " << recordingId << " with live stream at "
+                      << toStringWithCommas(settings.messageRate) << " msgs/sec of length "
+                      << toStringWithCommas(settings.messageLength) << " bytes, starting "
+                      << settings.backlogMs << "ms behind" << std::endl;
+
+            for (long long i = 0; i < settings.iterations && running; i++)
+            {
+                const std::int64_t startPosition = publication->position();
+                std::this_thread::sleep_for(milliseconds(settings.backlogMs));
+                const std::int64_t backlog = publication->position() - startPosition;
+
+                const std::int64_t catchupNs = replayMergeFrom(
+                    archive, sessionId, recordingId, startPosition, settings);
+
+                if (catchupNs < 0)
+                {
+                    std::cout << "Merge failed from position " << startPosition << std::endl;
+                    continue;
+                }
+
+                hdr_record_value(histogram, catchupNs);
+                std::cout << "Caught up " << toStringWithCommas(backlog) << " bytes in "
+                          << catchupNs / (1000 * 1000) << "ms" << std::endl;
+            }
+
+            std::cout << "Replay merge catch-up time [us]:" << std::endl;
+            hdr_percentiles_print(histogram, stdout, 5, 1000.0, CLASSIC);
+            fflush(stdout);
+        }
+        while (running && continuationBarrier("Execute again?"));
+
+        publishing = false;
+        publisherThread.join();
+
+        archive->stopRecording(recordingSubscriptionId);
+        hdr_close(histogram);
+    }
+    catch (const CommandOptionException &e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl << std::endl;
+        cp.displayOptionsHelp(std::cerr);
+        return -1;
+    }
+    catch (const SourcedException &e)
+    {
+        std::cerr << "FAILED: " << e.what() << " : " << e.where() << std::endl;
+        return -1;
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "FAILED: " << e.what() << " : " << std::endl;
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,269 @@
+/*
+ * Copyright 2014-2020 Real Logic Limited.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <csignal>
+#include <atomic>
+#include <thread>
+
+extern "C"
+{
+#include <hdr_histogram.h>
+}
+
+#include "util/CommandOptionParser.h"
+#include "concurrent/BusySpinIdleStrategy.h"
+#include "Configuration.h"
+#include "Aeron.h"
+#include "client/AeronArchive.h"
+#include "client/RecordingPos.h"
+
+using namespace std::chrono;
+using namespace aeron::util;
+using namespace aeron;
+using namespace aeron::archive::client;
+
+std::atomic<bool> running(true);
+
+void sigIntHandler(int)
+{
+    running = false;
+}
+
+static const char optHelp            = 'h';
+static const char optPrefix          = 'p';
+static const char optChannel         = 'c';
+static const char optStreamId        = 's';
+static const char optReplayChannel   = 'C';
+static const char optReplayStreamId  = 'S';
+static const char optRecordingLength = 'R';
+static const char optLength          = 'L';
+static const char optFrags           = 'f';
+
+static const long long DEFAULT_RECORDING_LENGTH = 1024 * 1024 * 1024LL;
+static const std::int64_t SAMPLE_LENGTH = 1024 * 1024;
+static const std::int64_t HISTOGRAM_HIGHEST_TRACKABLE_VALUE_NS = 10 * 1000 * 1000 * 1000LL;
+
+struct Settings
+{
+    std::string dirPrefix = "";
+    std::string channel = IPC_CHANNEL;
+    std::int32_t streamId = samples::configuration::DEFAULT_STREAM_ID;
+    std::string replayChannel = IPC_CHANNEL;
+    std::int32_t replayStreamId = samples::configuration::DEFAULT_STREAM_ID + 1;
+    long long recordingLength = DEFAULT_RECORDING_LENGTH;
+    int messageLength = 1024;
+    int fragmentCountLimit = samples::configuration::DEFAULT_FRAGMENT_COUNT_LIMIT;
+};
+
+Settings parseCmdLine(CommandOptionParser &cp, int argc, char **argv)
+{
+    cp.parse(argc, argv);
+    if (cp.getOption(optHelp).isPresent())
+    {
+        cp.displayOptionsHelp(std::cout);
+        exit(0);
+    }
+
+    Settings s;
+
+    s.dirPrefix = cp.getOption(optPrefix).getParam(0, s.dirPrefix);
+    s.channel = cp.getOption(optChannel).getParam(0, s.channel);
+    s.streamId = cp.getOption(optStreamId).getParamAsInt(0, 1, INT32_MAX, s.streamId);
+    s.replayChannel = cp.getOption(optReplayChannel).getParam(0, s.replayChannel);
+    s.replayStreamId = cp.getOption(optReplayStreamId).getParamAsInt(0, 1, INT32_MAX, s.replayStreamId);
+    s.recordingLength = cp.getOption(optRecordingLength).getParamAsLong(0, 1, INT64_MAX, s.recordingLength);
+    s.messageLength = cp.getOption(optLength).getParamAsInt(0, 1, INT32_MAX, s.messageLength);
+    s.fragmentCountLimit = cp.getOption(optFrags).getParamAsInt(0, 1, INT32_MAX, s.fragmentCountLimit);
+
+    return s;
+}
+
+std::int64_t recordStream(AeronArchive &archive, const Settings &settings)
+{
+    std::shared_ptr<ExclusivePublication> publication = archive.addRecordedExclusivePublication(
+        settings.channel, settings.streamId);
+    CountersReader &countersReader = archive.context().aeron()->countersReader();
+
+    std::int32_t counterId;
+    while (CountersReader::NULL_COUNTER_ID ==
+        (counterId = RecordingPos::findCounterIdBySessionId(countersReader, publication->sessionId())))
+    {
+        std::this_thread::yield();
+    }
+
+    const std::int64_t recordingId = RecordingPos::getRecordingId(countersReader, counterId);
+
+    std::unique_ptr<std::uint8_t[]> buffer(new std::uint8_t[settings.messageLength]);
+    concurrent::AtomicBuffer srcBuffer(buffer.get(), static_cast<size_t>(settings.messageLength));
+    srcBuffer.setMemory(0, settings.messageLength, 0);
+
+    while (publication->position() < settings.recordingLength && running)
+    {
+        if (publication->offer(srcBuffer, 0, settings.messageLength) < 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    while (countersReader.getCounterValue(counterId) < publication->position() && running)
+    {
+        std::this_thread::yield();
+    }
+
+    archive.stopRecording(publication);
+
+    return recordingId;
+}
+
+/*
+ * Replay the recording from the start and record the time taken to receive each SAMPLE_LENGTH bytes, so the
+ * histogram shows how steady the replay rate is as well as the overall throughput.
+ */
+std::int64_t replayAndReceive(
+    AeronArchive &archive,
+    Subscription &subscription,
+    std::int64_t recordingId,
+    std::int64_t length,
+    hdr_histogram *histogram,
+    const Settings &settings)
+{
+    const std::int64_t replaySessionId = archive.startReplay(
+        recordingId, 0, length, settings.replayChannel, settings.replayStreamId);
+    const std::int32_t sessionId = static_cast<std::int32_t>(replaySessionId);
+
+    std::shared_ptr<Image> image;
+    while (!(image = subscription.imageBySessionId(sessionId)))
+    {
+        std::this_thread::yield();
+    }
+
+    aeron::concurrent::BusySpinIdleStrategy idleStrategy;
+    fragment_handler_t handler = [](AtomicBuffer &, index_t, index_t, Header &) {};
+    std::int64_t nextSamplePosition = SAMPLE_LENGTH;
+    steady_clock::time_point sampleStart = steady_clock::now();
+
+    while (image->position() < length && running)
+    {
+        const int fragments = image->poll(handler, settings.fragmentCountLimit);
+        if (0 == fragments && image->isClosed())
+        {
+            break;
+        }
+
+        const std::int64_t position = image->position();
+        if (position >= nextSamplePosition)
+        {
+            const steady_clock::time_point now = steady_clock::now();
+            hdr_record_value(histogram, duration<std::int64_t, std::nano>(now - sampleStart).count());
+            sampleStart = now;
+            nextSamplePosition = position + SAMPLE_LENGTH;
+        }
+
+        idleStrategy.idle(fragments);
+    }
+
+    return image->position();
+}
+
+int main(int argc, char **argv)
+{
+    CommandOptionParser cp;
+    cp.addOption(CommandOption(optHelp,            0, 0, "                Displays help information."));
+    cp.addOption(CommandOption(optPrefix,          1, 1, "dir             Prefix directory for aeron driver."));
+    cp.addOption(CommandOption(optChannel,         1, 1, "channel         Channel to record."));
+    cp.addOption(CommandOption(optStreamId,        1, 1, "streamId        Stream ID to record."));
+    cp.addOption(CommandOption(optReplayChannel,   1, 1, "channel         Replay Channel."));
+    cp.addOption(CommandOption(optReplayStreamId,  1, 1, "streamId        Replay Stream ID."));
+    cp.addOption(CommandOption(optRecordingLength, 1, 1, "length          Length of the recording in bytes."));
+    cp.addOption(CommandOption(optLength,          1, 1, "length          Length of Messages."));
+    cp.addOption(CommandOption(optFrags,           1, 1, "limit           Fragment Count Limit."));
+
+    signal(SIGINT, sigIntHandler);
+
+    try
+    {
+        Settings settings = parseCmdLine(cp, argc, argv);
+
+        AeronArchive::Context_t context;
+        if (!settings.dirPrefix.empty())
+        {
+            context.aeronDirectoryName(settings.dirPrefix);
+        }
+
+        std::shared_ptr<AeronArchive> archive = AeronArchive::connect(context);
+        Aeron &aeron = *archive->context().aeron();
+
+        std::cout << "Recording " << toStringWithCommas(settings.recordingLength) << " bytes of "
+                  << settings.channel << " on Stream ID " << settings.streamId << std::endl;
+
+        const std::int64_t recordingId = recordStream(*archive, settings);
+        const std::int64_t length = archive->getStopPosition(recordingId);
+
+        const std::int64_t subscriptionId = aeron.addSubscription(settings.replayChannel, settings.replayStreamId);
+        std::shared_ptr<Subscription> subscription = aeron.findSubscription(subscriptionId);
+        while (!subscription)
+        {
+            std::this_thread::yield();
+            subscription = aeron.findSubscription(subscriptionId);
+        }
+
+        hdr_histogram *histogram;
+        hdr_init(1, HISTOGRAM_HIGHEST_TRACKABLE_VALUE_NS, 3, &histogram);
+
+        do
+        {
+            hdr_reset(histogram);
+
+            std::cout << "Replaying recording " << recordingId << " of "
+                      << toStringWithCommas(length) << " bytes to " << settings.replayChannel
+                      << " on Stream ID " << settings.replayStreamId << std::endl;
+
+            const steady_clock::time_point start = steady_clock::now();
+            const std::int64_t replayedBytes = replayAndReceive(
+                *archive, *subscription, recordingId, length, histogram, settings);
+            const double durationSeconds = duration<double>(steady_clock::now() - start).count();
+
+            std::cout << "Replayed " << toStringWithCommas(replayedBytes) << " bytes in " << durationSeconds
+                      << "s, " << (replayedBytes / durationSeconds) / (1024 * 1024) << " MB/sec" << std::endl;
+            std::cout << "Time per " << toStringWithCommas(SAMPLE_LENGTH) << " bytes replayed [us]:" << std::endl;
+            hdr_percentiles_print(histogram, stdout, 5, 1000.0, CLASSIC);
+            fflush(stdout);
+        }
+        while (running && continuationBarrier("Execute again?"));
+
+        hdr_close(histogram);
+    }
+    catch (const CommandOptionException &e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl << std::endl;
+        cp.displayOptionsHelp(std::cerr);
+        return -1;
+    }
+    catch (const SourcedException &e)
+    {
+        std::cerr << "FAILED: " << e.what() << " : " << e.where() << std::endl;
+        return -1;
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "FAILED: " << e.what() << " : " << std::endl;
+        return -1;
+    }
+
+    return 0;
+}